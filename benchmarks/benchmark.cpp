@@ -0,0 +1,82 @@
+/**************************************************************************/
+/*  benchmark.cpp                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "benchmark.h"
+
+#include "core/config/engine.h"
+#include "core/io/file_access.h"
+#include "core/io/json.h"
+#include "core/string/print_string.h"
+
+LocalVector<Benchmark::Result> Benchmark::results;
+volatile uint64_t Benchmark::sink = 0;
+
+void Benchmark::_add_result(const String &p_name, uint64_t p_iterations, LocalVector<double> &p_samples) {
+	p_samples.sort();
+
+	Result result;
+	result.name = p_name;
+	result.iterations = p_iterations;
+	result.nsec_per_iteration = p_samples[p_samples.size() / 2];
+	result.min_nsec_per_iteration = p_samples[0];
+	result.max_nsec_per_iteration = p_samples[p_samples.size() - 1];
+	results.push_back(result);
+
+	print_line(vformat("%s: %.1f ns (min %.1f ns, max %.1f ns, %d iterations)", p_name, result.nsec_per_iteration, result.min_nsec_per_iteration, result.max_nsec_per_iteration, p_iterations));
+}
+
+void Benchmark::clear_results() {
+	results.clear();
+}
+
+Error Benchmark::save_results(const String &p_path) {
+	Array benchmarks;
+	for (const Result &result : results) {
+		Dictionary entry;
+		entry["name"] = result.name;
+		entry["iterations"] = result.iterations;
+		entry["nsec_per_iteration"] = result.nsec_per_iteration;
+		entry["min_nsec_per_iteration"] = result.min_nsec_per_iteration;
+		entry["max_nsec_per_iteration"] = result.max_nsec_per_iteration;
+		benchmarks.push_back(entry);
+	}
+
+	Dictionary data;
+	data["version"] = Engine::get_singleton()->get_version_info();
+	data["processor_name"] = OS::get_singleton()->get_processor_name();
+	data["processor_count"] = OS::get_singleton()->get_processor_count();
+	data["benchmarks"] = benchmarks;
+
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, "Can't save benchmark results to: " + p_path);
+	f->store_string(JSON::stringify(data, "\t"));
+	return OK;
+}
@@ -0,0 +1,97 @@
+/**************************************************************************/
+/*  benchmark.h                                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include "core/os/os.h"
+#include "core/string/ustring.h"
+#include "core/templates/local_vector.h"
+
+// Micro-benchmarks are doctest cases in a "[Benchmark]" suite, only built with `benchmarks=yes`.
+// They are skipped by a regular `--test` run and selected with `--test --benchmarks`.
+class Benchmark {
+	struct Result {
+		String name;
+		uint64_t iterations = 0;
+		double nsec_per_iteration = 0.0;
+		double min_nsec_per_iteration = 0.0;
+		double max_nsec_per_iteration = 0.0;
+	};
+
+	static LocalVector<Result> results;
+	static volatile uint64_t sink;
+
+	static void _add_result(const String &p_name, uint64_t p_iterations, LocalVector<double> &p_samples);
+
+public:
+	enum {
+		MIN_BATCH_USEC = 20000, // Iterations are doubled until a batch takes at least this long.
+		SAMPLE_COUNT = 5,
+	};
+
+	// Prevents the compiler from optimizing away a benchmarked result.
+	template <class T>
+	_ALWAYS_INLINE_ static void keep(const T &p_value) {
+		sink = sink + *(const volatile uint8_t *)&p_value;
+	}
+
+	// Runs p_function in batches, and records the median time of an iteration over SAMPLE_COUNT batches.
+	template <class F>
+	static void run(const String &p_name, F p_function) {
+		uint64_t iterations = 1;
+		while (true) {
+			uint64_t begin = OS::get_singleton()->get_ticks_usec();
+			for (uint64_t i = 0; i < iterations; i++) {
+				p_function();
+			}
+			if (OS::get_singleton()->get_ticks_usec() - begin >= MIN_BATCH_USEC || iterations >= (1ULL << 40)) {
+				break;
+			}
+			iterations *= 2;
+		}
+
+		LocalVector<double> samples;
+		for (int i = 0; i < SAMPLE_COUNT; i++) {
+			uint64_t begin = OS::get_singleton()->get_ticks_usec();
+			for (uint64_t j = 0; j < iterations; j++) {
+				p_function();
+			}
+			samples.push_back(double(OS::get_singleton()->get_ticks_usec() - begin) * 1000.0 / iterations);
+		}
+
+		_add_result(p_name, iterations, samples);
+	}
+
+	static void clear_results();
+	static Error save_results(const String &p_path);
+};
+
+#endif // BENCHMARK_H
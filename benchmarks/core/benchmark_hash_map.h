@@ -0,0 +1,100 @@
+/**************************************************************************/
+/*  benchmark_hash_map.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef BENCHMARK_HASH_MAP_H
+#define BENCHMARK_HASH_MAP_H
+
+#include "core/templates/hash_map.h"
+
+#include "benchmarks/benchmark.h"
+#include "tests/test_macros.h"
+
+namespace BenchmarkHashMap {
+
+TEST_SUITE("[Benchmark]") {
+	TEST_CASE("[Benchmark][HashMap] Insert") {
+		Benchmark::run("HashMap<int, int> insert 1000", []() {
+			HashMap<int, int> map;
+			for (int i = 0; i < 1000; i++) {
+				map.insert(i * 7919, i);
+			}
+			Benchmark::keep(map.size());
+		});
+	}
+
+	TEST_CASE("[Benchmark][HashMap] Lookup") {
+		HashMap<int, int> map;
+		for (int i = 0; i < 1000; i++) {
+			map.insert(i * 7919, i);
+		}
+
+		Benchmark::run("HashMap<int, int> lookup 1000", [&]() {
+			int sum = 0;
+			for (int i = 0; i < 1000; i++) {
+				sum += map.getptr(i * 7919) ? 1 : 0;
+			}
+			Benchmark::keep(sum);
+		});
+
+		HashMap<String, int> string_map;
+		LocalVector<String> keys;
+		for (int i = 0; i < 1000; i++) {
+			keys.push_back("key_" + itos(i));
+			string_map.insert(keys[i], i);
+		}
+
+		Benchmark::run("HashMap<String, int> lookup 1000", [&]() {
+			int sum = 0;
+			for (const String &key : keys) {
+				sum += string_map.getptr(key) ? 1 : 0;
+			}
+			Benchmark::keep(sum);
+		});
+	}
+
+	TEST_CASE("[Benchmark][HashMap] Iterate") {
+		HashMap<int, int> map;
+		for (int i = 0; i < 1000; i++) {
+			map.insert(i * 7919, i);
+		}
+
+		Benchmark::run("HashMap<int, int> iterate 1000", [&]() {
+			int sum = 0;
+			for (const KeyValue<int, int> &E : map) {
+				sum += E.value;
+			}
+			Benchmark::keep(sum);
+		});
+	}
+}
+
+} // namespace BenchmarkHashMap
+
+#endif // BENCHMARK_HASH_MAP_H
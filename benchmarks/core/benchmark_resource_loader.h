@@ -0,0 +1,75 @@
+/**************************************************************************/
+/*  benchmark_resource_loader.h                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef BENCHMARK_RESOURCE_LOADER_H
+#define BENCHMARK_RESOURCE_LOADER_H
+
+#include "core/io/dir_access.h"
+#include "core/io/resource_loader.h"
+#include "core/io/resource_saver.h"
+#include "scene/resources/gradient.h"
+
+#include "benchmarks/benchmark.h"
+#include "tests/test_macros.h"
+
+namespace BenchmarkResourceLoader {
+
+TEST_SUITE("[Benchmark]") {
+	TEST_CASE("[Benchmark][ResourceLoader] Load text and binary resources") {
+		Ref<Gradient> gradient;
+		gradient.instantiate();
+		for (int i = 0; i < 256; i++) {
+			gradient->add_point(i / 255.0, Color(i / 255.0, 0.5, 1.0 - i / 255.0));
+		}
+
+		const String text_path = OS::get_singleton()->get_cache_path().path_join("benchmark_resource.tres");
+		const String binary_path = OS::get_singleton()->get_cache_path().path_join("benchmark_resource.res");
+		REQUIRE(ResourceSaver::save(gradient, text_path) == OK);
+		REQUIRE(ResourceSaver::save(gradient, binary_path) == OK);
+
+		// Ignore the cache so every iteration parses the file.
+		Benchmark::run("ResourceLoader load .tres", [&]() {
+			Ref<Resource> resource = ResourceLoader::load(text_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+			Benchmark::keep(resource);
+		});
+
+		Benchmark::run("ResourceLoader load .res", [&]() {
+			Ref<Resource> resource = ResourceLoader::load(binary_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+			Benchmark::keep(resource);
+		});
+
+		DirAccess::remove_absolute(text_path);
+		DirAccess::remove_absolute(binary_path);
+	}
+}
+
+} // namespace BenchmarkResourceLoader
+
+#endif // BENCHMARK_RESOURCE_LOADER_H
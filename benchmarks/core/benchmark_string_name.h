@@ -0,0 +1,82 @@
+/**************************************************************************/
+/*  benchmark_string_name.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef BENCHMARK_STRING_NAME_H
+#define BENCHMARK_STRING_NAME_H
+
+#include "core/string/string_name.h"
+
+#include "benchmarks/benchmark.h"
+#include "tests/test_macros.h"
+
+namespace BenchmarkStringName {
+
+TEST_SUITE("[Benchmark]") {
+	TEST_CASE("[Benchmark][StringName] Creation") {
+		String string = "benchmark_string_name";
+		// Interned, so this only measures the lookup of an existing name.
+		StringName interned = string;
+
+		Benchmark::run("StringName from String", [&]() {
+			StringName name = string;
+			Benchmark::keep(name);
+		});
+
+		Benchmark::run("StringName from const char *", []() {
+			StringName name = "benchmark_string_name";
+			Benchmark::keep(name);
+		});
+
+		Benchmark::run("SNAME", []() {
+			const StringName &name = SNAME("benchmark_string_name");
+			Benchmark::keep(name);
+		});
+	}
+
+	TEST_CASE("[Benchmark][StringName] Comparison") {
+		StringName a = "benchmark_string_name_a";
+		StringName b = "benchmark_string_name_b";
+		String string = "benchmark_string_name_a";
+
+		Benchmark::run("StringName == StringName", [&]() {
+			bool equal = a == b;
+			Benchmark::keep(equal);
+		});
+
+		Benchmark::run("StringName == String", [&]() {
+			bool equal = a == string;
+			Benchmark::keep(equal);
+		});
+	}
+}
+
+} // namespace BenchmarkStringName
+
+#endif // BENCHMARK_STRING_NAME_H
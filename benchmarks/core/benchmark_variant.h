@@ -0,0 +1,92 @@
+/**************************************************************************/
+/*  benchmark_variant.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef BENCHMARK_VARIANT_H
+#define BENCHMARK_VARIANT_H
+
+#include "core/variant/callable.h"
+#include "core/variant/variant.h"
+
+#include "benchmarks/benchmark.h"
+#include "tests/test_macros.h"
+
+namespace BenchmarkVariant {
+
+TEST_SUITE("[Benchmark]") {
+	TEST_CASE("[Benchmark][Variant] Operators") {
+		Variant a = 21;
+		Variant b = 2;
+
+		Benchmark::run("Variant int * int", [&]() {
+			Variant result;
+			bool valid = false;
+			Variant::evaluate(Variant::OP_MULTIPLY, a, b, result, valid);
+			Benchmark::keep(result);
+		});
+
+		Variant va = Vector3(1, 2, 3);
+		Variant vb = Vector3(4, 5, 6);
+
+		Benchmark::run("Variant Vector3 + Vector3", [&]() {
+			Variant result;
+			bool valid = false;
+			Variant::evaluate(Variant::OP_ADD, va, vb, result, valid);
+			Benchmark::keep(result);
+		});
+	}
+
+	TEST_CASE("[Benchmark][Variant] Method calls") {
+		Variant string = "benchmark";
+		StringName length = "length";
+
+		Benchmark::run("Variant String.length() call", [&]() {
+			Callable::CallError ce;
+			Variant result;
+			string.callp(length, nullptr, 0, result, ce);
+			Benchmark::keep(result);
+		});
+
+		Variant vector = Vector3(1, 2, 3);
+		Variant other = Vector3(4, 5, 6);
+		StringName dot = "dot";
+		const Variant *args[1] = { &other };
+
+		Benchmark::run("Variant Vector3.dot() call", [&]() {
+			Callable::CallError ce;
+			Variant result;
+			vector.callp(dot, args, 1, result, ce);
+			Benchmark::keep(result);
+		});
+	}
+}
+
+} // namespace BenchmarkVariant
+
+#endif // BENCHMARK_VARIANT_H
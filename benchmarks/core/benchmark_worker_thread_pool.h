@@ -0,0 +1,63 @@
+/**************************************************************************/
+/*  benchmark_worker_thread_pool.h                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef BENCHMARK_WORKER_THREAD_POOL_H
+#define BENCHMARK_WORKER_THREAD_POOL_H
+
+#include "core/object/worker_thread_pool.h"
+
+#include "benchmarks/benchmark.h"
+#include "tests/test_macros.h"
+
+namespace BenchmarkWorkerThreadPool {
+
+static void empty_task(void *p_userdata) {
+}
+
+static void empty_group_task(void *p_userdata, uint32_t p_index) {
+}
+
+TEST_SUITE("[Benchmark]") {
+	TEST_CASE("[Benchmark][WorkerThreadPool] Task overhead") {
+		Benchmark::run("WorkerThreadPool add and wait task", []() {
+			WorkerThreadPool::TaskID task = WorkerThreadPool::get_singleton()->add_native_task(&empty_task, nullptr, true);
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(task);
+		});
+
+		Benchmark::run("WorkerThreadPool add and wait group task of 1024", []() {
+			WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(&empty_group_task, nullptr, 1024, -1, true);
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+		});
+	}
+}
+
+} // namespace BenchmarkWorkerThreadPool
+
+#endif // BENCHMARK_WORKER_THREAD_POOL_H
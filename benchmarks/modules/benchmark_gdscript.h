@@ -0,0 +1,105 @@
+/**************************************************************************/
+/*  benchmark_gdscript.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef BENCHMARK_GDSCRIPT_H
+#define BENCHMARK_GDSCRIPT_H
+
+#include "modules/modules_enabled.gen.h" // For gdscript.
+
+#ifdef MODULE_GDSCRIPT_ENABLED
+
+#include "modules/gdscript/gdscript.h"
+
+#include "benchmarks/benchmark.h"
+#include "tests/test_macros.h"
+
+namespace BenchmarkGDScript {
+
+// Each function runs a loop of 1000 iterations, so opcode dispatch dominates the call overhead.
+static const char *benchmark_source = R"(
+extends RefCounted
+
+static func typed_arithmetic() -> int:
+	var sum := 0
+	for i in 1000:
+		sum += i * 2 - 1
+	return sum
+
+static func untyped_arithmetic():
+	var sum = 0
+	for i in 1000:
+		sum += i * 2 - 1
+	return sum
+
+static func array_access() -> int:
+	var array: Array[int] = []
+	array.resize(1000)
+	var sum := 0
+	for i in 1000:
+		array[i] = i
+		sum += array[i]
+	return sum
+
+static func method_calls() -> int:
+	var sum := 0
+	for i in 1000:
+		sum += absi(-i)
+	return sum
+)";
+
+TEST_SUITE("[Benchmark]") {
+	TEST_CASE("[Benchmark][Modules][GDScript] VM opcodes") {
+		Ref<GDScript> gdscript;
+		gdscript.instantiate();
+		gdscript->set_source_code(benchmark_source);
+		ERR_PRINT_OFF;
+		const Error error = gdscript->reload();
+		ERR_PRINT_ON;
+		REQUIRE(error == OK);
+
+		// Static functions are called on the script itself.
+		Object *script_object = gdscript.ptr();
+		const char *functions[] = { "typed_arithmetic", "untyped_arithmetic", "array_access", "method_calls" };
+		for (const char *function : functions) {
+			StringName method = function;
+			Benchmark::run(vformat("GDScript %s", function), [&]() {
+				Callable::CallError ce;
+				Variant result = script_object->callp(method, nullptr, 0, ce);
+				Benchmark::keep(result);
+			});
+		}
+	}
+}
+
+} // namespace BenchmarkGDScript
+
+#endif // MODULE_GDSCRIPT_ENABLED
+
+#endif // BENCHMARK_GDSCRIPT_H
@@ -0,0 +1,91 @@
+/**************************************************************************/
+/*  benchmark_navigation_server_3d.h                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef BENCHMARK_NAVIGATION_SERVER_3D_H
+#define BENCHMARK_NAVIGATION_SERVER_3D_H
+
+#include "scene/resources/navigation_mesh_source_geometry_data_3d.h"
+#include "scene/resources/primitive_meshes.h"
+#include "servers/navigation_server_3d.h"
+
+#include "benchmarks/benchmark.h"
+#include "tests/test_macros.h"
+
+namespace BenchmarkNavigationServer3D {
+
+// The "[Navigation]" suite name makes the test runner create the navigation servers.
+TEST_SUITE("[Navigation][Benchmark]") {
+	TEST_CASE("[Benchmark][NavigationServer3D] Path queries") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh;
+		navigation_mesh.instantiate();
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry;
+		source_geometry.instantiate();
+
+		// A floor with a grid of pillars, so paths have to go around obstacles.
+		Array arr;
+		arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(arr, Vector3(100.0, 0.001, 100.0));
+		source_geometry->add_mesh_array(arr, Transform3D());
+		BoxMesh::create_mesh_array(arr, Vector3(2.0, 4.0, 2.0));
+		for (int x = -4; x <= 4; x++) {
+			for (int z = -4; z <= 4; z++) {
+				source_geometry->add_mesh_array(arr, Transform3D(Basis(), Vector3(x * 10.0 + 5.0, 2.0, z * 10.0 + 5.0)));
+			}
+		}
+		navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+		REQUIRE(navigation_mesh->get_polygon_count() > 0);
+
+		RID map = navigation_server->map_create();
+		RID region = navigation_server->region_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+
+		Benchmark::run("NavigationServer3D map_get_path across map", [&]() {
+			Vector<Vector3> path = navigation_server->map_get_path(map, Vector3(-45, 0, -45), Vector3(45, 0, 45), true);
+			Benchmark::keep(path);
+		});
+
+		Benchmark::run("NavigationServer3D map_get_closest_point", [&]() {
+			Vector3 point = navigation_server->map_get_closest_point(map, Vector3(12, 3, -7));
+			Benchmark::keep(point);
+		});
+
+		navigation_server->free(region);
+		navigation_server->free(map);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+	}
+}
+
+} // namespace BenchmarkNavigationServer3D
+
+#endif // BENCHMARK_NAVIGATION_SERVER_3D_H
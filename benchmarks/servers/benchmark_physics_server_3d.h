@@ -0,0 +1,108 @@
+/**************************************************************************/
+/*  benchmark_physics_server_3d.h                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef BENCHMARK_PHYSICS_SERVER_3D_H
+#define BENCHMARK_PHYSICS_SERVER_3D_H
+
+#include "servers/physics_server_3d.h"
+
+#include "benchmarks/benchmark.h"
+#include "tests/test_macros.h"
+
+namespace BenchmarkPhysicsServer3D {
+
+TEST_SUITE("[Benchmark]") {
+	TEST_CASE("[Benchmark][PhysicsServer3D] Step") {
+		PhysicsServer3D *physics_server = PhysicsServer3DManager::get_singleton()->new_default_server();
+		REQUIRE(physics_server);
+		physics_server->init();
+
+		RID space = physics_server->space_create();
+		physics_server->space_set_active(space, true);
+
+		RID floor_shape = physics_server->box_shape_create();
+		physics_server->shape_set_data(floor_shape, Vector3(50, 1, 50));
+		RID floor = physics_server->body_create();
+		physics_server->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+		physics_server->body_add_shape(floor, floor_shape);
+		physics_server->body_set_space(floor, space);
+
+		RID sphere_shape = physics_server->sphere_shape_create();
+		physics_server->shape_set_data(sphere_shape, 0.5);
+
+		LocalVector<RID> bodies;
+		LocalVector<Transform3D> initial_transforms;
+		for (int x = 0; x < 10; x++) {
+			for (int y = 0; y < 5; y++) {
+				for (int z = 0; z < 10; z++) {
+					RID body = physics_server->body_create();
+					physics_server->body_set_mode(body, PhysicsServer3D::BODY_MODE_RIGID);
+					physics_server->body_add_shape(body, sphere_shape);
+					physics_server->body_set_space(body, space);
+					bodies.push_back(body);
+					initial_transforms.push_back(Transform3D(Basis(), Vector3(x * 1.1 - 5.0, y * 1.1 + 2.0, z * 1.1 - 5.0)));
+				}
+			}
+		}
+
+		// Bodies are dropped again regularly, so the steps aren't only measuring sleeping bodies.
+		int steps = 0;
+		Benchmark::run("PhysicsServer3D step, 500 spheres falling on a floor", [&]() {
+			if (steps % 120 == 0) {
+				for (uint32_t i = 0; i < bodies.size(); i++) {
+					physics_server->body_set_state(bodies[i], PhysicsServer3D::BODY_STATE_TRANSFORM, initial_transforms[i]);
+					physics_server->body_set_state(bodies[i], PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY, Vector3());
+					physics_server->body_set_state(bodies[i], PhysicsServer3D::BODY_STATE_SLEEPING, false);
+				}
+			}
+			steps++;
+
+			physics_server->sync();
+			physics_server->flush_queries();
+			physics_server->end_sync();
+			physics_server->step(1.0 / 60.0);
+		});
+
+		for (const RID &body : bodies) {
+			physics_server->free(body);
+		}
+		physics_server->free(floor);
+		physics_server->free(sphere_shape);
+		physics_server->free(floor_shape);
+		physics_server->free(space);
+
+		physics_server->finish();
+		memdelete(physics_server);
+	}
+}
+
+} // namespace BenchmarkPhysicsServer3D
+
+#endif // BENCHMARK_PHYSICS_SERVER_3D_H
@@ -122,6 +122,23 @@ ResourceUID::ID ResourceLoader::get_resource_uid(const String &p_path) {
 	return ::ResourceLoader::get_resource_uid(p_path);
 }
 
+void ResourceLoader::set_retention_budget(const StringName &p_type, int64_t p_bytes) {
+	ERR_FAIL_COND(p_bytes < 0);
+	ResourceCache::set_retention_budget(p_type, p_bytes);
+}
+
+int64_t ResourceLoader::get_retention_budget(const StringName &p_type) {
+	return ResourceCache::get_retention_budget(p_type);
+}
+
+Dictionary ResourceLoader::get_retention_stats() {
+	return ResourceCache::get_retention_stats();
+}
+
+void ResourceLoader::clear_retained_resources() {
+	ResourceCache::clear_retained();
+}
+
 void ResourceLoader::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("load_threaded_request", "path", "type_hint", "use_sub_threads", "cache_mode"), &ResourceLoader::load_threaded_request, DEFVAL(""), DEFVAL(false), DEFVAL(CACHE_MODE_REUSE));
 	ClassDB::bind_method(D_METHOD("load_threaded_get_status", "path", "progress"), &ResourceLoader::load_threaded_get_status, DEFVAL(Array()));
@@ -136,6 +153,10 @@ void ResourceLoader::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("has_cached", "path"), &ResourceLoader::has_cached);
 	ClassDB::bind_method(D_METHOD("exists", "path", "type_hint"), &ResourceLoader::exists, DEFVAL(""));
 	ClassDB::bind_method(D_METHOD("get_resource_uid", "path"), &ResourceLoader::get_resource_uid);
+	ClassDB::bind_method(D_METHOD("set_retention_budget", "type", "bytes"), &ResourceLoader::set_retention_budget);
+	ClassDB::bind_method(D_METHOD("get_retention_budget", "type"), &ResourceLoader::get_retention_budget);
+	ClassDB::bind_method(D_METHOD("get_retention_stats"), &ResourceLoader::get_retention_stats);
+	ClassDB::bind_method(D_METHOD("clear_retained_resources"), &ResourceLoader::clear_retained_resources);
 
 	BIND_ENUM_CONSTANT(THREAD_LOAD_INVALID_RESOURCE);
 	BIND_ENUM_CONSTANT(THREAD_LOAD_IN_PROGRESS);
@@ -847,6 +868,67 @@ TypedArray<PackedVector2Array> Geometry2D::offset_polyline(const Vector<Vector2>
 	return ret;
 }
 
+static Dictionary _pack_polygon_batch(const Vector<Vector<Vector<Point2>>> &p_results) {
+	int polygon_count = 0;
+	int point_count = 0;
+	for (const Vector<Vector<Point2>> &polygons : p_results) {
+		polygon_count += polygons.size();
+		for (const Vector<Point2> &polygon : polygons) {
+			point_count += polygon.size();
+		}
+	}
+
+	PackedVector2Array points;
+	PackedInt32Array polygon_sizes;
+	PackedInt32Array polygon_counts;
+	points.resize(point_count);
+	polygon_sizes.resize(polygon_count);
+	polygon_counts.resize(p_results.size());
+
+	Vector2 *points_ptr = points.ptrw();
+	int32_t *polygon_sizes_ptr = polygon_sizes.ptrw();
+	int32_t *polygon_counts_ptr = polygon_counts.ptrw();
+	for (const Vector<Vector<Point2>> &polygons : p_results) {
+		*polygon_counts_ptr++ = polygons.size();
+		for (const Vector<Point2> &polygon : polygons) {
+			*polygon_sizes_ptr++ = polygon.size();
+			memcpy(points_ptr, polygon.ptr(), polygon.size() * sizeof(Vector2));
+			points_ptr += polygon.size();
+		}
+	}
+
+	Dictionary ret;
+	ret["points"] = points;
+	ret["polygon_sizes"] = polygon_sizes;
+	ret["polygon_counts"] = polygon_counts;
+	return ret;
+}
+
+Dictionary Geometry2D::boolean_polygons_batch(PolyBooleanOperation p_operation, const TypedArray<PackedVector2Array> &p_polygons_a, const TypedArray<PackedVector2Array> &p_polygons_b) {
+	Vector<Vector<Point2>> polygons_a;
+	polygons_a.resize(p_polygons_a.size());
+	for (int i = 0; i < p_polygons_a.size(); i++) {
+		polygons_a.write[i] = p_polygons_a[i];
+	}
+	Vector<Vector<Point2>> polygons_b;
+	polygons_b.resize(p_polygons_b.size());
+	for (int i = 0; i < p_polygons_b.size(); i++) {
+		polygons_b.write[i] = p_polygons_b[i];
+	}
+
+	return _pack_polygon_batch(::Geometry2D::polygons_do_operation_batch(::Geometry2D::PolyBooleanOperation(p_operation), polygons_a, polygons_b));
+}
+
+Dictionary Geometry2D::offset_polygons_batch(const TypedArray<PackedVector2Array> &p_polygons, real_t p_delta, PolyJoinType p_join_type) {
+	Vector<Vector<Point2>> polygons;
+	polygons.resize(p_polygons.size());
+	for (int i = 0; i < p_polygons.size(); i++) {
+		polygons.write[i] = p_polygons[i];
+	}
+
+	return _pack_polygon_batch(::Geometry2D::offset_polygons_batch(polygons, p_delta, ::Geometry2D::PolyJoinType(p_join_type)));
+}
+
 Dictionary Geometry2D::make_atlas(const Vector<Size2> &p_rects) {
 	Dictionary ret;
 
@@ -903,6 +985,9 @@ void Geometry2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("offset_polygon", "polygon", "delta", "join_type"), &Geometry2D::offset_polygon, DEFVAL(JOIN_SQUARE));
 	ClassDB::bind_method(D_METHOD("offset_polyline", "polyline", "delta", "join_type", "end_type"), &Geometry2D::offset_polyline, DEFVAL(JOIN_SQUARE), DEFVAL(END_SQUARE));
 
+	ClassDB::bind_method(D_METHOD("boolean_polygons_batch", "operation", "polygons_a", "polygons_b"), &Geometry2D::boolean_polygons_batch);
+	ClassDB::bind_method(D_METHOD("offset_polygons_batch", "polygons", "delta", "join_type"), &Geometry2D::offset_polygons_batch, DEFVAL(JOIN_SQUARE));
+
 	ClassDB::bind_method(D_METHOD("make_atlas", "sizes"), &Geometry2D::make_atlas);
 
 	BIND_ENUM_CONSTANT(OPERATION_UNION);
@@ -84,6 +84,11 @@ public:
 	bool exists(const String &p_path, const String &p_type_hint = "");
 	ResourceUID::ID get_resource_uid(const String &p_path);
 
+	void set_retention_budget(const StringName &p_type, int64_t p_bytes);
+	int64_t get_retention_budget(const StringName &p_type);
+	Dictionary get_retention_stats();
+	void clear_retained_resources();
+
 	ResourceLoader() { singleton = this; }
 };
 
@@ -303,6 +308,10 @@ public:
 		END_ROUND
 	};
 	TypedArray<PackedVector2Array> offset_polygon(const Vector<Vector2> &p_polygon, real_t p_delta, PolyJoinType p_join_type = JOIN_SQUARE);
+
+	// Batched 2D polygon operations, results are packed into a Dictionary of packed arrays.
+	Dictionary boolean_polygons_batch(PolyBooleanOperation p_operation, const TypedArray<PackedVector2Array> &p_polygons_a, const TypedArray<PackedVector2Array> &p_polygons_b);
+	Dictionary offset_polygons_batch(const TypedArray<PackedVector2Array> &p_polygons, real_t p_delta, PolyJoinType p_join_type = JOIN_SQUARE);
 	TypedArray<PackedVector2Array> offset_polyline(const Vector<Vector2> &p_polygon, real_t p_delta, PolyJoinType p_join_type = JOIN_SQUARE, PolyEndType p_end_type = END_SQUARE);
 
 	Dictionary make_atlas(const Vector<Size2> &p_rects);
@@ -0,0 +1,133 @@
+/**************************************************************************/
+/*  trace_recorder.cpp                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "trace_recorder.h"
+
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+
+bool TraceRecorder::enabled = false;
+String TraceRecorder::output_path;
+BinaryMutex TraceRecorder::buffers_mutex;
+LocalVector<TraceRecorder::ThreadBuffer *> TraceRecorder::buffers;
+thread_local TraceRecorder::ThreadBuffer *TraceRecorder::thread_buffer = nullptr;
+
+// Buffers outlive their threads, so events of finished threads are still saved.
+TraceRecorder::ThreadBuffer *TraceRecorder::_get_thread_buffer() {
+	if (!thread_buffer) {
+		thread_buffer = memnew(ThreadBuffer);
+		thread_buffer->thread_id = Thread::get_caller_id();
+		if (Thread::is_main_thread()) {
+			thread_buffer->thread_name = "Main";
+		}
+
+		MutexLock lock(buffers_mutex);
+		buffers.push_back(thread_buffer);
+	}
+	return thread_buffer;
+}
+
+void TraceRecorder::_add_event(const char *p_static_name, const String &p_name, bool p_begin) {
+	ThreadBuffer *buffer = _get_thread_buffer();
+
+	buffer->lock.lock();
+	if (buffer->events.size() >= MAX_EVENTS_PER_THREAD) {
+		buffer->dropped_events++;
+	} else {
+		Event event;
+		event.static_name = p_static_name;
+		event.name = p_name;
+		event.usec = OS::get_singleton()->get_ticks_usec();
+		event.begin = p_begin;
+		buffer->events.push_back(event);
+	}
+	buffer->lock.unlock();
+}
+
+void TraceRecorder::start(const String &p_output_path) {
+	output_path = p_output_path;
+	enabled = true;
+}
+
+void TraceRecorder::stop() {
+	if (!enabled) {
+		return;
+	}
+	enabled = false;
+
+	MutexLock lock(buffers_mutex);
+
+	Ref<FileAccess> f = FileAccess::open(output_path, FileAccess::WRITE);
+	if (f.is_null()) {
+		ERR_PRINT("Can't save trace to: " + output_path);
+	} else {
+		f->store_string("{\"traceEvents\":[\n");
+		bool first = true;
+		for (ThreadBuffer *buffer : buffers) {
+			buffer->lock.lock();
+
+			String thread_name = buffer->thread_name.is_empty() ? vformat("Thread %d", (uint64_t)buffer->thread_id) : buffer->thread_name;
+			f->store_string(vformat("%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}", first ? "" : ",\n", (uint64_t)buffer->thread_id, thread_name.json_escape()));
+			first = false;
+
+			// Zones still open when recording stopped are left unterminated, which trace viewers handle.
+			for (const Event &event : buffer->events) {
+				if (event.begin) {
+					String name = event.static_name ? String(event.static_name) : event.name;
+					f->store_string(vformat(",\n{\"name\":\"%s\",\"ph\":\"B\",\"ts\":%d,\"pid\":1,\"tid\":%d}", name.json_escape(), event.usec, (uint64_t)buffer->thread_id));
+				} else {
+					f->store_string(vformat(",\n{\"ph\":\"E\",\"ts\":%d,\"pid\":1,\"tid\":%d}", event.usec, (uint64_t)buffer->thread_id));
+				}
+			}
+
+			if (buffer->dropped_events > 0) {
+				WARN_PRINT(vformat("Trace buffer of \"%s\" was full, %d events were dropped.", thread_name, buffer->dropped_events));
+			}
+			buffer->events.clear();
+			buffer->lock.unlock();
+		}
+		f->store_string("\n]}\n");
+		print_line("Trace saved to: " + output_path);
+	}
+
+	// Threads may still be running, so their buffers are kept, only emptied.
+}
+
+void TraceRecorder::set_thread_name(const String &p_name) {
+	if (!enabled) {
+		return;
+	}
+	ThreadBuffer *buffer = _get_thread_buffer();
+	if (buffer->thread_name != p_name) {
+		buffer->lock.lock();
+		buffer->thread_name = p_name;
+		buffer->lock.unlock();
+	}
+}
@@ -0,0 +1,124 @@
+/**************************************************************************/
+/*  trace_recorder.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TRACE_RECORDER_H
+#define TRACE_RECORDER_H
+
+#include "core/os/mutex.h"
+#include "core/os/spin_lock.h"
+#include "core/os/thread.h"
+#include "core/string/ustring.h"
+#include "core/templates/local_vector.h"
+
+// Records scoped zones from every thread, and saves them as a Chrome trace (also readable by Perfetto).
+// Enabled with the `--trace-file <path>` command line argument, including in release builds.
+class TraceRecorder {
+	struct Event {
+		const char *static_name = nullptr; // Used when the name is a literal, to avoid copying it.
+		String name;
+		uint64_t usec = 0;
+		bool begin = false;
+	};
+
+	struct ThreadBuffer {
+		Thread::ID thread_id = 0;
+		String thread_name;
+		SpinLock lock;
+		LocalVector<Event> events;
+		uint32_t dropped_events = 0;
+	};
+
+	enum {
+		MAX_EVENTS_PER_THREAD = 1 << 22,
+	};
+
+	static bool enabled;
+	static String output_path;
+	static BinaryMutex buffers_mutex;
+	static LocalVector<ThreadBuffer *> buffers;
+	static thread_local ThreadBuffer *thread_buffer;
+
+	static ThreadBuffer *_get_thread_buffer();
+	static void _add_event(const char *p_static_name, const String &p_name, bool p_begin);
+
+public:
+	_FORCE_INLINE_ static bool is_enabled() { return enabled; }
+
+	static void start(const String &p_output_path);
+	static void stop();
+
+	static void set_thread_name(const String &p_name);
+
+	_FORCE_INLINE_ static void begin_zone(const char *p_name) {
+		if (enabled) {
+			_add_event(p_name, String(), true);
+		}
+	}
+	_FORCE_INLINE_ static void begin_zone(const String &p_name) {
+		if (enabled) {
+			_add_event(nullptr, p_name, true);
+		}
+	}
+	_FORCE_INLINE_ static void end_zone() {
+		if (enabled) {
+			_add_event(nullptr, String(), false);
+		}
+	}
+};
+
+class TraceZone {
+	bool active = false;
+
+public:
+	_FORCE_INLINE_ TraceZone(const char *p_name) {
+		if (TraceRecorder::is_enabled()) {
+			active = true;
+			TraceRecorder::begin_zone(p_name);
+		}
+	}
+	_FORCE_INLINE_ TraceZone(const String &p_name) {
+		if (TraceRecorder::is_enabled()) {
+			active = true;
+			TraceRecorder::begin_zone(p_name);
+		}
+	}
+	_FORCE_INLINE_ ~TraceZone() {
+		if (active) {
+			TraceRecorder::end_zone();
+		}
+	}
+};
+
+#define TRACE_ZONE_CAT2(m_a, m_b) m_a##m_b
+#define TRACE_ZONE_CAT(m_a, m_b) TRACE_ZONE_CAT2(m_a, m_b)
+// Records a zone from here to the end of the scope.
+#define TRACE_ZONE(m_name) TraceZone TRACE_ZONE_CAT(_trace_zone_, __LINE__)(m_name)
+
+#endif // TRACE_RECORDER_H
@@ -556,6 +556,7 @@ void GDExtension::initialize_library(InitializationLevel p_level) {
 	ERR_FAIL_COND(initialization.initialize == nullptr);
 
 	initialization.initialize(initialization.userdata, GDExtensionInitializationLevel(p_level));
+	ClassDB::refresh_lookup_tables(); // Registering its classes dropped them.
 }
 void GDExtension::deinitialize_library(InitializationLevel p_level) {
 	ERR_FAIL_NULL(library);
@@ -563,6 +564,7 @@ void GDExtension::deinitialize_library(InitializationLevel p_level) {
 
 	level_initialized = int32_t(p_level) - 1;
 	initialization.deinitialize(initialization.userdata, GDExtensionInitializationLevel(p_level));
+	ClassDB::refresh_lookup_tables(); // Unregistering its classes dropped them.
 }
 
 void GDExtension::_bind_methods() {
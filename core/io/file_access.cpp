@@ -36,6 +36,7 @@
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_pack.h"
 #include "core/io/marshalls.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 
 FileAccess::CreateFunc FileAccess::create_func[ACCESS_MAX] = { nullptr, nullptr };
@@ -473,6 +474,39 @@ uint64_t FileAccess::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return i;
 }
 
+uint64_t FileAccess::get_buffer_at(uint64_t p_position, uint8_t *p_dst, uint64_t p_length) const {
+	// Implementations without positioned reads go through the cursor, one read at a time.
+	MutexLock lock(buffer_at_mutex);
+	uint64_t original_pos = get_position();
+	const_cast<FileAccess *>(this)->seek(p_position);
+
+	uint64_t read = get_buffer(p_dst, p_length);
+
+	const_cast<FileAccess *>(this)->seek(original_pos);
+	return read;
+}
+
+void FileAccess::_read_async_task(void *p_userdata) {
+	AsyncRead *ar = (AsyncRead *)p_userdata;
+	uint64_t read = ar->file->get_buffer_at(ar->position, ar->dst, ar->length);
+	if (ar->r_read) {
+		*ar->r_read = read;
+	}
+	memdelete(ar);
+}
+
+int64_t FileAccess::read_async(uint64_t p_position, uint8_t *p_dst, uint64_t p_length, uint64_t *r_read) {
+	ERR_FAIL_COND_V(!p_dst && p_length > 0, WorkerThreadPool::INVALID_TASK_ID);
+
+	AsyncRead *ar = memnew(AsyncRead);
+	ar->file = Ref<FileAccess>(this); // Keep the file open until the read is done.
+	ar->position = p_position;
+	ar->dst = p_dst;
+	ar->length = p_length;
+	ar->r_read = r_read;
+	return WorkerThreadPool::get_singleton()->add_native_task(&FileAccess::_read_async_task, ar, false, "FileAccess async read");
+}
+
 Vector<uint8_t> FileAccess::get_buffer(int64_t p_length) const {
 	Vector<uint8_t> data;
 
@@ -725,18 +759,12 @@ void FileAccess::store_buffer(const Vector<uint8_t> &p_buffer) {
 
 void FileAccess::store_var(const Variant &p_var, bool p_full_objects) {
 	int len;
-	Error err = encode_variant(p_var, nullptr, len, p_full_objects);
-	ERR_FAIL_COND_MSG(err != OK, "Error when trying to encode Variant.");
-
 	Vector<uint8_t> buff;
-	buff.resize(len);
-
-	uint8_t *w = buff.ptrw();
-	err = encode_variant(p_var, &w[0], len, p_full_objects);
+	Error err = encode_variant_to_buffer(p_var, buff, 0, len, p_full_objects);
 	ERR_FAIL_COND_MSG(err != OK, "Error when trying to encode Variant.");
 
 	store_32(len);
-	store_buffer(buff);
+	store_buffer(buff.ptr(), len);
 }
 
 Vector<uint8_t> FileAccess::get_file_as_bytes(const String &p_path, Error *r_error) {
@@ -35,6 +35,7 @@
 #include "core/math/math_defs.h"
 #include "core/object/ref_counted.h"
 #include "core/os/memory.h"
+#include "core/os/mutex.h"
 #include "core/string/ustring.h"
 #include "core/typedefs.h"
 
@@ -121,6 +122,17 @@ private:
 
 	static Ref<FileAccess> _open(const String &p_path, ModeFlags p_mode_flags);
 
+	mutable BinaryMutex buffer_at_mutex;
+
+	struct AsyncRead {
+		Ref<FileAccess> file;
+		uint64_t position = 0;
+		uint8_t *dst = nullptr;
+		uint64_t length = 0;
+		uint64_t *r_read = nullptr;
+	};
+	static void _read_async_task(void *p_userdata);
+
 public:
 	static void set_file_close_fail_notify_callback(FileCloseFailNotify p_cbk) { close_fail_notify = p_cbk; }
 
@@ -149,6 +161,9 @@ public:
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const; ///< get an array of bytes
 	Vector<uint8_t> get_buffer(int64_t p_length) const;
+	virtual const uint8_t *map_range(uint64_t p_length) const { return nullptr; } ///< get the next bytes without copying them (valid until the file is closed), nullptr if the file can't be memory mapped
+	virtual uint64_t get_buffer_at(uint64_t p_position, uint8_t *p_dst, uint64_t p_length) const; ///< get an array of bytes at a position without moving the cursor, can be called from several threads at once
+	int64_t read_async(uint64_t p_position, uint8_t *p_dst, uint64_t p_length, uint64_t *r_read = nullptr); ///< get_buffer_at() on the WorkerThreadPool, returns the task to wait for, p_dst must stay valid until then
 	virtual String get_line() const;
 	virtual String get_token() const;
 	virtual Vector<String> get_csv_line(const String &p_delim = ",") const;
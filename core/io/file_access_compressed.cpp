@@ -30,6 +30,7 @@
 
 #include "file_access_compressed.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/string/print_string.h"
 
 void FileAccessCompressed::configure(const String &p_magic, Compression::Mode p_mode, uint32_t p_block_size) {
@@ -144,22 +145,25 @@ void FileAccessCompressed::_close() {
 			f->store_32(0); //compressed sizes, will update later
 		}
 
-		Vector<int> block_sizes;
-		for (uint32_t i = 0; i < bc; i++) {
-			uint32_t bl = i == (bc - 1) ? write_max % block_size : block_size;
-			uint8_t *bp = &write_ptr[i * block_size];
-
-			Vector<uint8_t> cblock;
-			cblock.resize(Compression::get_max_compressed_buffer_size(bl, cmode));
-			int s = Compression::compress(cblock.ptrw(), bp, bl, cmode);
+		// Blocks are compressed independently of each other, so big files are compressed on several threads.
+		Vector<Vector<uint8_t>> cblocks;
+		cblocks.resize(bc);
+		if (bc > 1 && WorkerThreadPool::get_singleton()) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &FileAccessCompressed::_compress_block, cblocks.ptrw(), bc, -1, true, SNAME("FileAccessCompressedBlocks"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			for (uint32_t i = 0; i < bc; i++) {
+				_compress_block(i, cblocks.ptrw());
+			}
+		}
 
-			f->store_buffer(cblock.ptr(), s);
-			block_sizes.push_back(s);
+		for (uint32_t i = 0; i < bc; i++) {
+			f->store_buffer(cblocks[i].ptr(), cblocks[i].size());
 		}
 
 		f->seek(16); //ok write block sizes
 		for (uint32_t i = 0; i < bc; i++) {
-			f->store_32(block_sizes[i]);
+			f->store_32(cblocks[i].size());
 		}
 		f->seek_end();
 		f->store_buffer((const uint8_t *)mgc.get_data(), mgc.length()); //magic at the end too
@@ -174,6 +178,16 @@ void FileAccessCompressed::_close() {
 	f.unref();
 }
 
+void FileAccessCompressed::_compress_block(uint32_t p_index, Vector<uint8_t> *p_blocks) {
+	uint32_t bc = (write_max / block_size) + 1;
+	uint32_t bl = p_index == (bc - 1) ? write_max % block_size : block_size;
+
+	Vector<uint8_t> &cblock = p_blocks[p_index];
+	cblock.resize(Compression::get_max_compressed_buffer_size(bl, cmode));
+	int s = Compression::compress(cblock.ptrw(), &write_ptr[p_index * block_size], bl, cmode);
+	cblock.resize(s);
+}
+
 bool FileAccessCompressed::is_open() const {
 	return f.is_valid();
 }
@@ -349,6 +363,19 @@ void FileAccessCompressed::store_8(uint8_t p_dest) {
 	write_ptr[write_pos++] = p_dest;
 }
 
+void FileAccessCompressed::store_buffer(const uint8_t *p_src, uint64_t p_length) {
+	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(!writing, "File has not been opened in write mode.");
+	ERR_FAIL_COND(!p_src && p_length > 0);
+	if (p_length == 0) {
+		return;
+	}
+
+	WRITE_FIT(p_length);
+	memcpy(&write_ptr[write_pos], p_src, p_length);
+	write_pos += p_length;
+}
+
 bool FileAccessCompressed::file_exists(const String &p_name) {
 	Ref<FileAccess> fa = FileAccess::open(p_name, FileAccess::READ);
 	if (fa.is_null()) {
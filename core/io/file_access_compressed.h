@@ -64,6 +64,7 @@ class FileAccessCompressed : public FileAccess {
 	Ref<FileAccess> f;
 
 	void _close();
+	void _compress_block(uint32_t p_index, Vector<uint8_t> *p_blocks);
 
 public:
 	void configure(const String &p_magic, Compression::Mode p_mode = Compression::MODE_ZSTD, uint32_t p_block_size = 4096);
@@ -90,6 +91,7 @@ public:
 
 	virtual void flush() override;
 	virtual void store_8(uint8_t p_dest) override; ///< store a byte
+	virtual void store_buffer(const uint8_t *p_src, uint64_t p_length) override; ///< store an array of bytes
 
 	virtual bool file_exists(const String &p_name) override; ///< return true if a file exists
 
@@ -32,19 +32,23 @@
 #define FILE_ACCESS_MEMORY_H
 
 #include "core/io/file_access.h"
+#include "core/templates/local_vector.h"
 
 class FileAccessMemory : public FileAccess {
 	uint8_t *data = nullptr;
 	uint64_t length = 0;
 	mutable uint64_t pos = 0;
+	LocalVector<uint8_t> *write_buffer = nullptr; // Grows when written past its end, see open_write_buffer().
 
 	static Ref<FileAccess> create();
+	void _grow(uint64_t p_length);
 
 public:
 	static void register_file(String p_name, Vector<uint8_t> p_data);
 	static void cleanup();
 
 	virtual Error open_custom(const uint8_t *p_data, uint64_t p_len); ///< open a file
+	virtual Error open_write_buffer(LocalVector<uint8_t> *r_buffer); ///< open a buffer, which grows as needed when writing
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override; ///< open a file
 	virtual bool is_open() const override; ///< true when file is open
 
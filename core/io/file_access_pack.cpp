@@ -31,7 +31,9 @@
 #include "file_access_pack.h"
 
 #include "core/io/file_access_encrypted.h"
+#include "core/io/marshalls.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/version.h"
 
@@ -47,7 +49,7 @@ Error PackedData::add_pack(const String &p_path, bool p_replace_files, uint64_t
 	return ERR_FILE_UNRECOGNIZED;
 }
 
-void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted) {
+void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted, bool p_compressed) {
 	String simplified_path = p_path.simplify_path();
 	PathMD5 pmd5(simplified_path.md5_buffer());
 
@@ -55,6 +57,7 @@ void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64
 
 	PackedFile pf;
 	pf.encrypted = p_encrypted;
+	pf.compressed = p_compressed;
 	pf.pack = p_pkg_path;
 	pf.offset = p_ofs;
 	pf.size = p_size;
@@ -118,6 +121,95 @@ void PackedData::_free_packed_dirs(PackedDir *p_dir) {
 	memdelete(p_dir);
 }
 
+const uint8_t *PackedData::_get_mapped_range(const String &p_pack, uint64_t p_offset, uint64_t p_size) {
+	MutexLock lock(mapped_packs_mutex);
+
+	HashMap<String, MappedPack>::Iterator E = mapped_packs.find(p_pack);
+	if (!E) {
+		MappedPack mp;
+		mp.file = FileAccess::open(p_pack, FileAccess::READ);
+		if (mp.file.is_valid()) {
+			mp.size = mp.file->get_length();
+			mp.data = mp.file->map_range(mp.size);
+		}
+		if (!mp.data) {
+			mp.file = Ref<FileAccess>(); // Not mappable, keep the entry so it's not tried again.
+		}
+		E = mapped_packs.insert(p_pack, mp);
+	}
+
+	if (!E->value.data || p_offset + p_size > E->value.size) {
+		return nullptr;
+	}
+	return E->value.data + p_offset;
+}
+
+struct PackCompression {
+	const uint8_t *src = nullptr;
+	uint64_t size = 0;
+	Compression::Mode mode = Compression::MODE_ZSTD;
+	LocalVector<Vector<uint8_t>> blocks;
+};
+
+static void _pack_compress_block(void *p_userdata, uint32_t p_index) {
+	PackCompression *pc = (PackCompression *)p_userdata;
+	uint64_t from = uint64_t(p_index) * PACK_COMPRESSION_BLOCK_SIZE;
+	int size = MIN(pc->size - from, (uint64_t)PACK_COMPRESSION_BLOCK_SIZE);
+
+	Vector<uint8_t> &block = pc->blocks[p_index];
+	block.resize(Compression::get_max_compressed_buffer_size(size, pc->mode));
+	int compressed_size = Compression::compress(block.ptrw(), pc->src + from, size, pc->mode);
+	if (compressed_size < 0 || compressed_size >= size) {
+		// Stored as is, readers tell it apart because its size is the uncompressed one.
+		block.resize(size);
+		memcpy(block.ptrw(), pc->src + from, size);
+	} else {
+		block.resize(compressed_size);
+	}
+}
+
+Vector<uint8_t> PackedData::compress_file(const uint8_t *p_data, uint64_t p_size, Compression::Mode p_mode) {
+	ERR_FAIL_COND_V(p_mode == Compression::MODE_BROTLI, Vector<uint8_t>()); // Decompression only.
+
+	PackCompression pc;
+	pc.src = p_data;
+	pc.size = p_size;
+	pc.mode = p_mode;
+
+	uint32_t block_count = (p_size + PACK_COMPRESSION_BLOCK_SIZE - 1) / PACK_COMPRESSION_BLOCK_SIZE;
+	pc.blocks.resize(block_count);
+	if (block_count > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&_pack_compress_block, &pc, block_count, -1, true, "Compress pack file");
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (block_count == 1) {
+		_pack_compress_block(&pc, 0);
+	}
+
+	uint64_t total_size = PACK_COMPRESSION_HEADER_SIZE + block_count * 4;
+	for (const Vector<uint8_t> &block : pc.blocks) {
+		total_size += block.size();
+	}
+	if (total_size >= p_size) {
+		return Vector<uint8_t>();
+	}
+
+	Vector<uint8_t> ret;
+	ret.resize(total_size);
+	uint8_t *w = ret.ptrw();
+	w += encode_uint32(p_mode, w);
+	w += encode_uint32(PACK_COMPRESSION_BLOCK_SIZE, w);
+	w += encode_uint32(block_count, w);
+	for (const Vector<uint8_t> &block : pc.blocks) {
+		w += encode_uint32(block.size(), w);
+	}
+	for (const Vector<uint8_t> &block : pc.blocks) {
+		memcpy(w, block.ptr(), block.size());
+		w += block.size();
+	}
+
+	return ret;
+}
+
 PackedData::~PackedData() {
 	for (int i = 0; i < sources.size(); i++) {
 		memdelete(sources[i]);
@@ -248,7 +340,7 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		f->get_buffer(md5, 16);
 		uint32_t flags = f->get_32();
 
-		PackedData::get_singleton()->add_path(p_path, path, ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED));
+		PackedData::get_singleton()->add_path(p_path, path, ofs + p_offset, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED), (flags & PACK_FILE_COMPRESSED));
 	}
 
 	return true;
@@ -266,7 +358,9 @@ Error FileAccessPack::open_internal(const String &p_path, int p_mode_flags) {
 }
 
 bool FileAccessPack::is_open() const {
-	if (f.is_valid()) {
+	if (data) {
+		return true;
+	} else if (f.is_valid()) {
 		return f->is_open();
 	} else {
 		return false;
@@ -274,7 +368,7 @@ bool FileAccessPack::is_open() const {
 }
 
 void FileAccessPack::seek(uint64_t p_position) {
-	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(f.is_null() && !data, "File must be opened before use.");
 
 	if (p_position > pf.size) {
 		eof = true;
@@ -282,7 +376,9 @@ void FileAccessPack::seek(uint64_t p_position) {
 		eof = false;
 	}
 
-	f->seek(off + p_position);
+	if (f.is_valid() && !pf.compressed) {
+		f->seek(off + p_position);
+	}
 	pos = p_position;
 }
 
@@ -303,18 +399,26 @@ bool FileAccessPack::eof_reached() const {
 }
 
 uint8_t FileAccessPack::get_8() const {
-	ERR_FAIL_COND_V_MSG(f.is_null(), 0, "File must be opened before use.");
+	ERR_FAIL_COND_V_MSG(f.is_null() && !data, 0, "File must be opened before use.");
 	if (pos >= pf.size) {
 		eof = true;
 		return 0;
 	}
 
+	if (pf.compressed) {
+		uint8_t b = 0;
+		_get_buffer_compressed(pos++, &b, 1, true);
+		return b;
+	}
+	if (data) {
+		return data[pos++];
+	}
 	pos++;
 	return f->get_8();
 }
 
 uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
-	ERR_FAIL_COND_V_MSG(f.is_null(), -1, "File must be opened before use.");
+	ERR_FAIL_COND_V_MSG(f.is_null() && !data, -1, "File must be opened before use.");
 	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
 
 	if (eof) {
@@ -327,21 +431,152 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 		to_read = (int64_t)pf.size - (int64_t)pos;
 	}
 
+	uint64_t from = pos;
 	pos += p_length;
 
 	if (to_read <= 0) {
 		return 0;
 	}
-	f->get_buffer(p_dst, to_read);
+	if (pf.compressed) {
+		return _get_buffer_compressed(from, p_dst, to_read, true);
+	}
+	if (data) {
+		memcpy(p_dst, data + from, to_read);
+	} else {
+		f->get_buffer(p_dst, to_read);
+	}
 
 	return to_read;
 }
 
+const uint8_t *FileAccessPack::map_range(uint64_t p_length) const {
+	if (!data || pf.compressed || eof || pos + p_length > pf.size) {
+		return nullptr;
+	}
+	const uint8_t *r = data + pos;
+	pos += p_length;
+	return r;
+}
+
+uint64_t FileAccessPack::get_buffer_at(uint64_t p_position, uint8_t *p_dst, uint64_t p_length) const {
+	ERR_FAIL_COND_V_MSG(f.is_null() && !data, -1, "File must be opened before use.");
+	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
+
+	if (p_position >= pf.size) {
+		return 0;
+	}
+	uint64_t to_read = MIN(p_length, pf.size - p_position);
+	if (pf.compressed) {
+		return _get_buffer_compressed(p_position, p_dst, to_read, false); // Leaves the block cache alone, as other threads may be reading.
+	}
+	if (data) {
+		memcpy(p_dst, data + p_position, to_read);
+		return to_read;
+	}
+	return f->get_buffer_at(off + p_position, p_dst, to_read);
+}
+
+bool FileAccessPack::_parse_compression_header() {
+	uint8_t header[PACK_COMPRESSION_HEADER_SIZE];
+	ERR_FAIL_COND_V(_read_stored(0, header, PACK_COMPRESSION_HEADER_SIZE) != PACK_COMPRESSION_HEADER_SIZE, false);
+
+	compression_mode = Compression::Mode(decode_uint32(header));
+	block_size = decode_uint32(header + 4);
+	uint32_t block_count = decode_uint32(header + 8);
+	ERR_FAIL_COND_V(block_size == 0 || block_count != (pf.size + block_size - 1) / block_size, false);
+
+	Vector<uint8_t> sizes;
+	sizes.resize(block_count * 4);
+	ERR_FAIL_COND_V(_read_stored(PACK_COMPRESSION_HEADER_SIZE, sizes.ptrw(), sizes.size()) != (uint64_t)sizes.size(), false);
+
+	block_offsets.resize(block_count + 1);
+	block_offsets[0] = PACK_COMPRESSION_HEADER_SIZE + sizes.size();
+	for (uint32_t i = 0; i < block_count; i++) {
+		block_offsets[i + 1] = block_offsets[i] + decode_uint32(sizes.ptr() + i * 4);
+	}
+
+	if (data) {
+		// Only the header was checked to be inside the mapping so far.
+		data = PackedData::get_singleton()->_get_mapped_range(pf.pack, pf.offset, block_offsets[block_count]);
+		ERR_FAIL_NULL_V(data, false);
+	}
+	return true;
+}
+
+uint64_t FileAccessPack::_read_stored(uint64_t p_from, uint8_t *p_dst, uint64_t p_length) const {
+	if (data) {
+		memcpy(p_dst, data + p_from, p_length);
+		return p_length;
+	}
+	return f->get_buffer_at(off + p_from, p_dst, p_length);
+}
+
+bool FileAccessPack::_decompress_block(uint32_t p_block, uint8_t *p_dst, LocalVector<uint8_t> &r_read_buffer) const {
+	uint64_t from = block_offsets[p_block];
+	uint64_t stored_size = block_offsets[p_block + 1] - from;
+	uint64_t size = MIN((uint64_t)block_size, pf.size - uint64_t(p_block) * block_size);
+
+	const uint8_t *src = nullptr;
+	if (data) {
+		src = data + from;
+	} else {
+		r_read_buffer.resize(stored_size);
+		ERR_FAIL_COND_V(_read_stored(from, r_read_buffer.ptr(), stored_size) != stored_size, false);
+		src = r_read_buffer.ptr();
+	}
+
+	if (stored_size == size) {
+		memcpy(p_dst, src, size);
+		return true;
+	}
+	int ret = Compression::decompress(p_dst, size, src, stored_size, compression_mode);
+	ERR_FAIL_COND_V_MSG(ret != (int)size, false, "Can't decompress block " + itos(p_block) + " of pack-referenced file '" + String(pf.pack) + "'.");
+	return true;
+}
+
+uint64_t FileAccessPack::_get_buffer_compressed(uint64_t p_position, uint8_t *p_dst, uint64_t p_length, bool p_use_cache) const {
+	LocalVector<uint8_t> local_block;
+	LocalVector<uint8_t> local_read_buffer;
+
+	uint64_t read = 0;
+	while (read < p_length) {
+		uint64_t position = p_position + read;
+		uint32_t block = position / block_size;
+		uint64_t block_from = position % block_size;
+		uint64_t block_read = MIN(MIN((uint64_t)block_size, pf.size - uint64_t(block) * block_size) - block_from, p_length - read);
+
+		const uint8_t *src = nullptr;
+		if (p_use_cache) {
+			if (cached_block != block) {
+				block_cache.resize(block_size);
+				cached_block = -1;
+				if (!_decompress_block(block, block_cache.ptr(), block_read_buffer)) {
+					break;
+				}
+				cached_block = block;
+			}
+			src = block_cache.ptr();
+		} else {
+			local_block.resize(block_size);
+			if (!_decompress_block(block, local_block.ptr(), local_read_buffer)) {
+				break;
+			}
+			src = local_block.ptr();
+		}
+
+		memcpy(p_dst + read, src + block_from, block_read);
+		read += block_read;
+	}
+	return read;
+}
+
 void FileAccessPack::set_big_endian(bool p_big_endian) {
-	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(f.is_null() && !data, "File must be opened before use.");
 
 	FileAccess::set_big_endian(p_big_endian);
-	f->set_big_endian(p_big_endian);
+	if (f.is_valid()) {
+		f->set_big_endian(p_big_endian);
+	}
 }
 
 Error FileAccessPack::get_error() const {
@@ -369,11 +604,31 @@ bool FileAccessPack::file_exists(const String &p_name) {
 
 void FileAccessPack::close() {
 	f = Ref<FileAccess>();
+	data = nullptr;
+	block_cache.clear();
+	block_read_buffer.clear();
+	cached_block = -1;
 }
 
 FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file) :
-		pf(p_file),
-		f(FileAccess::open(pf.pack, FileAccess::READ)) {
+		pf(p_file) {
+	pos = 0;
+	eof = false;
+
+	if (!pf.encrypted) {
+		// Read straight from the mapped pack, without opening it again for every file.
+		data = PackedData::get_singleton()->_get_mapped_range(pf.pack, pf.offset, pf.compressed ? PACK_COMPRESSION_HEADER_SIZE : pf.size);
+		if (data) {
+			off = pf.offset;
+			if (pf.compressed && !_parse_compression_header()) {
+				close();
+				ERR_FAIL_MSG("Can't read compressed pack-referenced file '" + String(pf.pack) + "'.");
+			}
+			return;
+		}
+	}
+
+	f = FileAccess::open(pf.pack, FileAccess::READ);
 	ERR_FAIL_COND_MSG(f.is_null(), "Can't open pack-referenced file '" + String(pf.pack) + "'.");
 
 	f->seek(pf.offset);
@@ -395,8 +650,11 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 		f = fae;
 		off = 0;
 	}
-	pos = 0;
-	eof = false;
+
+	if (pf.compressed && !_parse_compression_header()) {
+		close();
+		ERR_FAIL_MSG("Can't read compressed pack-referenced file '" + String(pf.pack) + "'.");
+	}
 }
 
 //////////////////////////////////////////////////////////////////////////////////
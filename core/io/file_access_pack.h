@@ -31,11 +31,14 @@
 #ifndef FILE_ACCESS_PACK_H
 #define FILE_ACCESS_PACK_H
 
+#include "core/io/compression.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/os/mutex.h"
 #include "core/string/print_string.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rb_map.h"
 
 // Godot's packed file magic header ("GDPC" in ASCII).
@@ -48,9 +51,15 @@ enum PackFlags {
 };
 
 enum PackFileFlags {
-	PACK_FILE_ENCRYPTED = 1 << 0
+	PACK_FILE_ENCRYPTED = 1 << 0,
+	PACK_FILE_COMPRESSED = 1 << 1
 };
 
+// Compressed files are split in blocks of this size, so reads only decompress the blocks they touch.
+#define PACK_COMPRESSION_BLOCK_SIZE (64 * 1024)
+// Mode, block size and block count, followed by the compressed size of every block.
+#define PACK_COMPRESSION_HEADER_SIZE 12
+
 class PackSource;
 
 class PackedData {
@@ -66,6 +75,7 @@ public:
 		uint8_t md5[16];
 		PackSource *src = nullptr;
 		bool encrypted;
+		bool compressed = false; // size is the uncompressed size.
 	};
 
 private:
@@ -105,11 +115,25 @@ private:
 	static PackedData *singleton;
 	bool disabled = false;
 
+	// Pack files kept open and memory mapped, shared by every file read from them.
+	struct MappedPack {
+		Ref<FileAccess> file;
+		const uint8_t *data = nullptr;
+		uint64_t size = 0;
+	};
+
+	Mutex mapped_packs_mutex;
+	HashMap<String, MappedPack> mapped_packs;
+
 	void _free_packed_dirs(PackedDir *p_dir);
+	const uint8_t *_get_mapped_range(const String &p_pack, uint64_t p_offset, uint64_t p_size);
 
 public:
 	void add_pack_source(PackSource *p_source);
-	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false); // for PackSource
+	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false, bool p_compressed = false); // for PackSource
+
+	// Stored form of a file with PACK_FILE_COMPRESSED, empty if compressing doesn't make it smaller. Blocks are compressed in parallel.
+	static Vector<uint8_t> compress_file(const uint8_t *p_data, uint64_t p_size, Compression::Mode p_mode);
 
 	void set_disabled(bool p_disabled) { disabled = p_disabled; }
 	_FORCE_INLINE_ bool is_disabled() const { return disabled; }
@@ -147,7 +171,21 @@ class FileAccessPack : public FileAccess {
 	mutable bool eof;
 	uint64_t off;
 
+	const uint8_t *data = nullptr; // Contents of the file, if the pack is memory mapped.
 	Ref<FileAccess> f;
+
+	Compression::Mode compression_mode = Compression::MODE_ZSTD;
+	uint32_t block_size = 0;
+	LocalVector<uint64_t> block_offsets; // Where each block starts in the stored data, plus the end of the last one.
+	mutable LocalVector<uint8_t> block_cache;
+	mutable LocalVector<uint8_t> block_read_buffer;
+	mutable int64_t cached_block = -1;
+
+	bool _parse_compression_header();
+	uint64_t _read_stored(uint64_t p_from, uint8_t *p_dst, uint64_t p_length) const;
+	bool _decompress_block(uint32_t p_block, uint8_t *p_dst, LocalVector<uint8_t> &r_read_buffer) const;
+	uint64_t _get_buffer_compressed(uint64_t p_position, uint8_t *p_dst, uint64_t p_length, bool p_use_cache) const;
+
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override;
 	virtual uint64_t _get_modified_time(const String &p_file) override { return 0; }
 	virtual BitField<FileAccess::UnixPermissionFlags> _get_unix_permissions(const String &p_file) override { return 0; }
@@ -171,6 +209,8 @@ public:
 	virtual uint8_t get_8() const override;
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual const uint8_t *map_range(uint64_t p_length) const override;
+	virtual uint64_t get_buffer_at(uint64_t p_position, uint8_t *p_dst, uint64_t p_length) const override;
 
 	virtual void set_big_endian(bool p_big_endian) override;
 
@@ -146,6 +146,37 @@ unzFile ZipArchive::get_file_handle(String p_file) const {
 	return pkg;
 }
 
+Ref<FileAccess> ZipArchive::get_stored_file(const String &p_file, uint64_t &r_offset, uint64_t &r_size) {
+	MutexLock lock(files_mutex);
+	HashMap<String, File>::Iterator E = files.find(p_file);
+	if (!E || E->value.compression_method != 0) {
+		return Ref<FileAccess>();
+	}
+
+	if (E->value.data_offset == 0) {
+		// The local header size is only known once minizip parsed it, keep the result for the next opens.
+		unzFile pkg = get_file_handle(p_file);
+		if (!pkg) {
+			return Ref<FileAccess>();
+		}
+		E->value.data_offset = unzGetCurrentFileZStreamPos64(pkg);
+		close_handle(pkg);
+	}
+
+	Ref<FileAccess> f = FileAccess::open(packages[E->value.package].filename, FileAccess::READ);
+	if (f.is_null()) {
+		return Ref<FileAccess>();
+	}
+	r_offset = E->value.data_offset;
+	r_size = E->value.uncompressed_size;
+	return f;
+}
+
+uint64_t ZipArchive::get_uncompressed_size(const String &p_file) const {
+	const File *f = files.getptr(p_file);
+	return f ? f->uncompressed_size : 0;
+}
+
 bool ZipArchive::try_open_pack(const String &p_path, bool p_replace_files, uint64_t p_offset = 0) {
 	// load with offset feature only supported for PCK files
 	ERR_FAIL_COND_V_MSG(p_offset != 0, false, "Invalid PCK data. Note that loading files with a non-zero offset isn't supported with ZIP archives.");
@@ -189,6 +220,8 @@ bool ZipArchive::try_open_pack(const String &p_path, bool p_replace_files, uint6
 
 		File f;
 		f.package = pkg_num;
+		f.compression_method = file_info.compression_method;
+		f.uncompressed_size = file_info.uncompressed_size;
 		unzGetFilePos(zfile, &f.file_pos);
 
 		String fname = String("res://") + String::utf8(filename_inzip);
@@ -240,6 +273,13 @@ Error FileAccessZip::open_internal(const String &p_path, int p_mode_flags) {
 	ERR_FAIL_COND_V(p_mode_flags & FileAccess::WRITE, FAILED);
 	ZipArchive *arch = ZipArchive::get_singleton();
 	ERR_FAIL_NULL_V(arch, FAILED);
+
+	stored_file = arch->get_stored_file(p_path, stored_offset, stored_size);
+	if (stored_file.is_valid()) {
+		stored_file->seek(stored_offset);
+		return OK;
+	}
+
 	zfile = arch->get_file_handle(p_path);
 	ERR_FAIL_COND_V(!zfile, FAILED);
 
@@ -249,7 +289,39 @@ Error FileAccessZip::open_internal(const String &p_path, int p_mode_flags) {
 	return OK;
 }
 
+bool FileAccessZip::_inflate_to_memory() {
+	// Big entries keep streaming, and re-inflate on backward seeks.
+	const uint64_t max_inflated_size = 64 * 1024 * 1024;
+	if (file_info.uncompressed_size > max_inflated_size) {
+		return false;
+	}
+
+	unzSeekCurrentFile(zfile, 0);
+	inflated.resize(file_info.uncompressed_size);
+	uint64_t total = 0;
+	while (total < file_info.uncompressed_size) {
+		int read = unzReadCurrentFile(zfile, inflated.ptrw() + total, MIN(file_info.uncompressed_size - total, (uint64_t)INT32_MAX));
+		if (read <= 0) {
+			break;
+		}
+		total += read;
+	}
+	if (total != file_info.uncompressed_size) {
+		inflated.clear();
+		return false;
+	}
+
+	use_inflated = true;
+	return true;
+}
+
 void FileAccessZip::_close() {
+	stored_file.unref();
+	inflated.clear();
+	use_inflated = false;
+	pos = 0;
+	at_eof = false;
+
 	if (!zfile) {
 		return;
 	}
@@ -261,32 +333,59 @@ void FileAccessZip::_close() {
 }
 
 bool FileAccessZip::is_open() const {
-	return zfile != nullptr;
+	return zfile != nullptr || stored_file.is_valid();
 }
 
 void FileAccessZip::seek(uint64_t p_position) {
-	ERR_FAIL_COND(!zfile);
+	ERR_FAIL_COND(!is_open());
+
+	at_eof = false;
+	if (stored_file.is_valid()) {
+		pos = MIN(p_position, stored_size);
+		stored_file->seek(stored_offset + pos);
+		return;
+	}
+
+	if (!use_inflated && p_position < (uint64_t)unztell(zfile) && _inflate_to_memory()) {
+		// The entry is in memory now, no need to keep reading from minizip.
+		ZipArchive::get_singleton()->close_handle(zfile);
+		zfile = nullptr;
+	}
+
+	if (use_inflated) {
+		pos = MIN(p_position, (uint64_t)inflated.size());
+		return;
+	}
 
 	unzSeekCurrentFile(zfile, p_position);
 }
 
 void FileAccessZip::seek_end(int64_t p_position) {
-	ERR_FAIL_COND(!zfile);
-	unzSeekCurrentFile(zfile, get_length() + p_position);
+	ERR_FAIL_COND(!is_open());
+	seek(get_length() + p_position);
 }
 
 uint64_t FileAccessZip::get_position() const {
-	ERR_FAIL_COND_V(!zfile, 0);
+	ERR_FAIL_COND_V(!is_open(), 0);
+	if (stored_file.is_valid() || use_inflated) {
+		return pos;
+	}
 	return unztell(zfile);
 }
 
 uint64_t FileAccessZip::get_length() const {
-	ERR_FAIL_COND_V(!zfile, 0);
+	ERR_FAIL_COND_V(!is_open(), 0);
+	if (stored_file.is_valid()) {
+		return stored_size;
+	}
+	if (use_inflated) {
+		return inflated.size();
+	}
 	return file_info.uncompressed_size;
 }
 
 bool FileAccessZip::eof_reached() const {
-	ERR_FAIL_COND_V(!zfile, true);
+	ERR_FAIL_COND_V(!is_open(), true);
 
 	return at_eof;
 }
@@ -299,7 +398,22 @@ uint8_t FileAccessZip::get_8() const {
 
 uint64_t FileAccessZip::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
-	ERR_FAIL_COND_V(!zfile, -1);
+	ERR_FAIL_COND_V(!is_open(), -1);
+
+	if (stored_file.is_valid() || use_inflated) {
+		uint64_t size = stored_file.is_valid() ? stored_size : inflated.size();
+		uint64_t to_read = MIN(p_length, size - pos);
+		if (stored_file.is_valid()) {
+			to_read = stored_file->get_buffer(p_dst, to_read);
+		} else {
+			memcpy(p_dst, inflated.ptr() + pos, to_read);
+		}
+		pos += to_read;
+		if (to_read < p_length) {
+			at_eof = true;
+		}
+		return to_read;
+	}
 
 	at_eof = unzeof(zfile);
 	if (at_eof) {
@@ -314,7 +428,7 @@ uint64_t FileAccessZip::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 }
 
 Error FileAccessZip::get_error() const {
-	if (!zfile) {
+	if (!is_open()) {
 		return ERR_UNCONFIGURED;
 	}
 	if (eof_reached()) {
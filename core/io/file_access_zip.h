@@ -34,6 +34,7 @@
 #ifdef MINIZIP_ENABLED
 
 #include "core/io/file_access_pack.h"
+#include "core/os/mutex.h"
 #include "core/templates/rb_map.h"
 
 #include "thirdparty/minizip/unzip.h"
@@ -45,6 +46,9 @@ public:
 	struct File {
 		int package = -1;
 		unz_file_pos file_pos;
+		int compression_method = 0;
+		uint64_t uncompressed_size = 0;
+		uint64_t data_offset = 0; // Start of the data in the archive for stored entries, 0 until first opened.
 		File() {}
 	};
 
@@ -56,12 +60,15 @@ private:
 	Vector<Package> packages;
 
 	HashMap<String, File> files;
+	Mutex files_mutex;
 
 	static ZipArchive *instance;
 
 public:
 	void close_handle(unzFile p_file) const;
 	unzFile get_file_handle(String p_file) const;
+	Ref<FileAccess> get_stored_file(const String &p_file, uint64_t &r_offset, uint64_t &r_size);
+	uint64_t get_uncompressed_size(const String &p_file) const;
 
 	Error add_package(String p_name);
 
@@ -80,8 +87,19 @@ class FileAccessZip : public FileAccess {
 	unzFile zfile = nullptr;
 	unz_file_info64 file_info;
 
+	// Stored entries are read straight from the archive, without going through minizip.
+	Ref<FileAccess> stored_file;
+	uint64_t stored_offset = 0;
+	uint64_t stored_size = 0;
+
+	// Deflated entries are inflated to memory on the first backward seek, so seeking doesn't inflate from the start again.
+	Vector<uint8_t> inflated;
+	bool use_inflated = false;
+
+	mutable uint64_t pos = 0;
 	mutable bool at_eof = false;
 
+	bool _inflate_to_memory();
 	void _close();
 
 public:
@@ -0,0 +1,971 @@
+/**************************************************************************/
+/*  json_stream.cpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "json_stream.h"
+
+#include "core/io/json.h"
+
+static void _append_utf8(LocalVector<uint8_t> &r_bytes, uint32_t p_char) {
+	if (p_char < 0x80) {
+		r_bytes.push_back(p_char);
+	} else if (p_char < 0x800) {
+		r_bytes.push_back(0xC0 | (p_char >> 6));
+		r_bytes.push_back(0x80 | (p_char & 0x3F));
+	} else if (p_char < 0x10000) {
+		r_bytes.push_back(0xE0 | (p_char >> 12));
+		r_bytes.push_back(0x80 | ((p_char >> 6) & 0x3F));
+		r_bytes.push_back(0x80 | (p_char & 0x3F));
+	} else {
+		r_bytes.push_back(0xF0 | (p_char >> 18));
+		r_bytes.push_back(0x80 | ((p_char >> 12) & 0x3F));
+		r_bytes.push_back(0x80 | ((p_char >> 6) & 0x3F));
+		r_bytes.push_back(0x80 | (p_char & 0x3F));
+	}
+}
+
+bool JSONReader::_refill() {
+	if (source_eof) {
+		return false;
+	}
+
+	buffer_pos = 0;
+	buffer_len = 0;
+	if (file.is_valid()) {
+		buffer_len = file->get_buffer(buffer.ptrw(), CHUNK_SIZE);
+	} else if (stream.is_valid()) {
+		// Blocks until at least one byte arrives, or the stream is closed.
+		int bytes = CLAMP(stream->get_available_bytes(), 1, CHUNK_SIZE);
+		if (stream->get_data(buffer.ptrw(), bytes) == OK) {
+			buffer_len = bytes;
+		}
+	}
+
+	if (buffer_len <= 0) {
+		buffer_len = 0;
+		source_eof = true;
+		return false;
+	}
+	return true;
+}
+
+void JSONReader::_reset() {
+	file.unref();
+	stream.unref();
+	buffer_pos = 0;
+	buffer_len = 0;
+	source_eof = true;
+
+	state = STATE_VALUE;
+	containers.clear();
+	token.clear();
+	token_is_integer = false;
+
+	event_type = EVENT_NONE;
+	key = String();
+	value = Variant();
+	line = 0;
+	err_str = String();
+	err_line = 0;
+}
+
+Error JSONReader::_fail(const String &p_message) {
+	err_str = p_message;
+	err_line = line;
+	state = STATE_ERROR;
+	event_type = EVENT_NONE;
+	value = Variant();
+	return ERR_PARSE_ERROR;
+}
+
+int JSONReader::_skip_whitespace() {
+	while (true) {
+		int c = _peek_char();
+		if (c < 0 || c > 32) {
+			return c;
+		}
+		if (c == '\n') {
+			line++;
+		}
+		buffer_pos++;
+	}
+}
+
+Error JSONReader::_parse_hex(uint32_t &r_value) {
+	r_value = 0;
+	for (int i = 0; i < 4; i++) {
+		int c = _next_char();
+		if (c < 0) {
+			return _fail("Unterminated String");
+		}
+		if (!is_hex_digit(c)) {
+			return _fail("Malformed hex constant in string");
+		}
+		uint32_t v;
+		if (is_digit(c)) {
+			v = c - '0';
+		} else if (c >= 'a' && c <= 'f') {
+			v = c - 'a' + 10;
+		} else {
+			v = c - 'A' + 10;
+		}
+		r_value = (r_value << 4) | v;
+	}
+	return OK;
+}
+
+Error JSONReader::_parse_string(String &r_string) {
+	token.clear();
+	while (true) {
+		// Copy runs of plain characters straight from the buffer.
+		const uint8_t *src = buffer.ptr();
+		int start = buffer_pos;
+		while (buffer_pos < buffer_len && src[buffer_pos] != '"' && src[buffer_pos] != '\\' && src[buffer_pos] != '\n') {
+			buffer_pos++;
+		}
+		if (buffer_pos > start) {
+			uint32_t size = token.size();
+			token.resize(size + buffer_pos - start);
+			memcpy(token.ptr() + size, src + start, buffer_pos - start);
+		}
+
+		int c = _next_char();
+		if (c < 0) {
+			return _fail("Unterminated String");
+		} else if (c == '"') {
+			break;
+		} else if (c == '\n') {
+			line++;
+			token.push_back(c);
+		} else if (c == '\\') {
+			int next = _next_char();
+			uint32_t res = 0;
+
+			switch (next) {
+				case -1:
+					return _fail("Unterminated String");
+				case 'b':
+					res = 8;
+					break;
+				case 't':
+					res = 9;
+					break;
+				case 'n':
+					res = 10;
+					break;
+				case 'f':
+					res = 12;
+					break;
+				case 'r':
+					res = 13;
+					break;
+				case 'u': {
+					Error err = _parse_hex(res);
+					if (err != OK) {
+						return err;
+					}
+
+					if ((res & 0xfffffc00) == 0xd800) {
+						if (_next_char() != '\\' || _next_char() != 'u') {
+							return _fail("Invalid UTF-16 sequence in string, unpaired lead surrogate");
+						}
+						uint32_t trail;
+						err = _parse_hex(trail);
+						if (err != OK) {
+							return err;
+						}
+						if ((trail & 0xfffffc00) != 0xdc00) {
+							return _fail("Invalid UTF-16 sequence in string, unpaired lead surrogate");
+						}
+						res = (res << 10UL) + trail - ((0xd800 << 10UL) + 0xdc00 - 0x10000);
+					} else if ((res & 0xfffffc00) == 0xdc00) {
+						return _fail("Invalid UTF-16 sequence in string, unpaired trail surrogate");
+					}
+				} break;
+				case '"':
+				case '\\':
+				case '/': {
+					res = next;
+				} break;
+				default: {
+					return _fail("Invalid escape sequence.");
+				}
+			}
+
+			_append_utf8(token, res);
+		}
+	}
+
+	r_string = String();
+	if (token.size()) {
+		r_string.parse_utf8((const char *)token.ptr(), token.size());
+	}
+	return OK;
+}
+
+Error JSONReader::_parse_number() {
+	token.clear();
+	token_is_integer = true;
+	while (true) {
+		int c = _peek_char();
+		if (c == '.' || c == 'e' || c == 'E') {
+			token_is_integer = false;
+		} else if (!is_digit(c) && c != '-' && c != '+') {
+			break;
+		}
+		token.push_back(c);
+		buffer_pos++;
+	}
+	token.push_back(0);
+
+	value = String::to_float((const char *)token.ptr());
+	return OK;
+}
+
+Error JSONReader::_parse_identifier() {
+	token.clear();
+	while (is_ascii_char(_peek_char()) && token.size() < 8) {
+		token.push_back(_next_char());
+	}
+	token.push_back(0);
+
+	const char *id = (const char *)token.ptr();
+	if (strcmp(id, "true") == 0) {
+		value = true;
+	} else if (strcmp(id, "false") == 0) {
+		value = false;
+	} else if (strcmp(id, "null") == 0) {
+		value = Variant();
+	} else {
+		return _fail("Expected 'true','false' or 'null', got '" + String(id) + "'.");
+	}
+	return OK;
+}
+
+Error JSONReader::_parse_value_start(int p_char) {
+	switch (p_char) {
+		case '{':
+		case '[': {
+			if (containers.size() >= Variant::MAX_RECURSION_DEPTH) {
+				return _fail("JSON structure is too deep. Bailing.");
+			}
+			buffer_pos++;
+			bool object = p_char == '{';
+			containers.push_back(object);
+			state = object ? STATE_FIRST_KEY : STATE_FIRST_ARRAY_VALUE;
+			event_type = object ? EVENT_OBJECT_BEGIN : EVENT_ARRAY_BEGIN;
+			return OK;
+		}
+		case '"': {
+			buffer_pos++;
+			String str;
+			Error err = _parse_string(str);
+			if (err != OK) {
+				return err;
+			}
+			value = str;
+		} break;
+		case -1: {
+			return _fail("Expected value, got EOF.");
+		}
+		default: {
+			Error err;
+			if (p_char == '-' || is_digit(p_char)) {
+				err = _parse_number();
+			} else if (is_ascii_char(p_char)) {
+				err = _parse_identifier();
+			} else {
+				return _fail("Expected value.");
+			}
+			if (err != OK) {
+				return err;
+			}
+		}
+	}
+
+	state = STATE_AFTER_VALUE;
+	event_type = EVENT_VALUE;
+	return OK;
+}
+
+Error JSONReader::open(const String &p_path) {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, "Cannot open file '" + p_path + "'.");
+	return open_file(f);
+}
+
+Error JSONReader::open_file(const Ref<FileAccess> &p_file) {
+	ERR_FAIL_COND_V(p_file.is_null(), ERR_INVALID_PARAMETER);
+
+	_reset();
+	file = p_file;
+	buffer.resize(CHUNK_SIZE);
+	source_eof = false;
+
+	// Skip the UTF-8 BOM, if any.
+	if (_peek_char() == 0xEF && buffer_len - buffer_pos >= 3 && buffer[buffer_pos + 1] == 0xBB && buffer[buffer_pos + 2] == 0xBF) {
+		buffer_pos += 3;
+	}
+	return OK;
+}
+
+Error JSONReader::open_buffer(const Vector<uint8_t> &p_buffer) {
+	_reset();
+	buffer = p_buffer;
+	buffer_len = buffer.size();
+
+	if (buffer_len >= 3 && buffer[0] == 0xEF && buffer[1] == 0xBB && buffer[2] == 0xBF) {
+		buffer_pos = 3;
+	}
+	return OK;
+}
+
+Error JSONReader::open_stream(const Ref<StreamPeer> &p_stream) {
+	ERR_FAIL_COND_V(p_stream.is_null(), ERR_INVALID_PARAMETER);
+
+	_reset();
+	stream = p_stream;
+	buffer.resize(CHUNK_SIZE);
+	source_eof = false;
+	return OK;
+}
+
+void JSONReader::close() {
+	_reset();
+	buffer = Vector<uint8_t>();
+	state = STATE_DONE;
+}
+
+Error JSONReader::read() {
+	value = Variant();
+
+	while (true) {
+		if (state == STATE_DONE) {
+			event_type = EVENT_NONE;
+			return ERR_FILE_EOF;
+		} else if (state == STATE_ERROR) {
+			return ERR_PARSE_ERROR;
+		}
+
+		int c = _skip_whitespace();
+		switch (state) {
+			case STATE_FIRST_KEY: {
+				if (c == '}') {
+					buffer_pos++;
+					containers.resize(containers.size() - 1);
+					state = STATE_AFTER_VALUE;
+					event_type = EVENT_OBJECT_END;
+					return OK;
+				}
+				[[fallthrough]];
+			}
+			case STATE_KEY: {
+				if (c != '"') {
+					return _fail("Expected key");
+				}
+				buffer_pos++;
+				Error err = _parse_string(key);
+				if (err != OK) {
+					return err;
+				}
+				if (_skip_whitespace() != ':') {
+					return _fail("Expected ':'");
+				}
+				buffer_pos++;
+				state = STATE_VALUE;
+				event_type = EVENT_KEY;
+				return OK;
+			}
+			case STATE_FIRST_ARRAY_VALUE: {
+				if (c == ']') {
+					buffer_pos++;
+					containers.resize(containers.size() - 1);
+					state = STATE_AFTER_VALUE;
+					event_type = EVENT_ARRAY_END;
+					return OK;
+				}
+				[[fallthrough]];
+			}
+			case STATE_VALUE: {
+				return _parse_value_start(c);
+			}
+			case STATE_AFTER_VALUE: {
+				if (containers.is_empty()) {
+					if (c != -1) {
+						return _fail("Expected 'EOF'");
+					}
+					state = STATE_DONE;
+					continue;
+				}
+
+				bool object = containers[containers.size() - 1];
+				if (c == ',') {
+					// A trailing comma is accepted, as JSON::parse() does.
+					buffer_pos++;
+					state = object ? STATE_FIRST_KEY : STATE_FIRST_ARRAY_VALUE;
+					continue;
+				}
+				if (c == (object ? '}' : ']')) {
+					buffer_pos++;
+					containers.resize(containers.size() - 1);
+					event_type = object ? EVENT_OBJECT_END : EVENT_ARRAY_END;
+					return OK;
+				}
+				return _fail(object ? "Expected '}' or ','" : "Expected ']' or ','");
+			}
+			default: {
+				ERR_FAIL_V(ERR_BUG);
+			}
+		}
+	}
+}
+
+Error JSONReader::skip_section() {
+	if (event_type == EVENT_KEY) {
+		Error err = read();
+		if (err != OK) {
+			return err;
+		}
+	}
+
+	if (event_type != EVENT_OBJECT_BEGIN && event_type != EVENT_ARRAY_BEGIN) {
+		return OK;
+	}
+
+	uint32_t depth = containers.size();
+	while (containers.size() >= depth) {
+		Error err = read();
+		if (err != OK) {
+			return err;
+		}
+	}
+	return OK;
+}
+
+Variant JSONReader::read_value() {
+	if (event_type == EVENT_KEY && read() != OK) {
+		return Variant();
+	}
+
+	if (event_type == EVENT_VALUE) {
+		return value;
+	} else if (event_type != EVENT_OBJECT_BEGIN && event_type != EVENT_ARRAY_BEGIN) {
+		return Variant();
+	}
+
+	// Built without recursion, the containers are shared so items can be added to them through copies.
+	LocalVector<Variant> stack;
+	LocalVector<String> keys;
+	stack.push_back(event_type == EVENT_OBJECT_BEGIN ? Variant(Dictionary()) : Variant(Array()));
+	keys.push_back(String());
+
+	while (true) {
+		if (read() != OK) {
+			return Variant();
+		}
+
+		Variant item;
+		switch (event_type) {
+			case EVENT_KEY: {
+				keys[keys.size() - 1] = key;
+				continue;
+			}
+			case EVENT_OBJECT_BEGIN:
+			case EVENT_ARRAY_BEGIN: {
+				stack.push_back(event_type == EVENT_OBJECT_BEGIN ? Variant(Dictionary()) : Variant(Array()));
+				keys.push_back(String());
+				continue;
+			}
+			case EVENT_VALUE: {
+				item = value;
+			} break;
+			default: {
+				item = stack[stack.size() - 1];
+				stack.resize(stack.size() - 1);
+				keys.resize(keys.size() - 1);
+				if (stack.is_empty()) {
+					return item;
+				}
+			}
+		}
+
+		const Variant &parent = stack[stack.size() - 1];
+		if (parent.get_type() == Variant::DICTIONARY) {
+			Dictionary d = parent;
+			d[keys[keys.size() - 1]] = item;
+		} else {
+			Array a = parent;
+			a.push_back(item);
+		}
+	}
+}
+
+template <class T>
+Error JSONReader::_read_packed(Vector<T> &r_array) {
+	while (true) {
+		Error err = read();
+		if (err != OK) {
+			return err;
+		}
+
+		if (event_type == EVENT_ARRAY_END) {
+			return OK;
+		}
+
+		if constexpr (std::is_same<T, String>::value) {
+			if (event_type != EVENT_VALUE || value.get_type() != Variant::STRING) {
+				return _fail("Expected a string in the packed array.");
+			}
+			r_array.push_back(value);
+		} else {
+			if (event_type != EVENT_VALUE || value.get_type() != Variant::FLOAT) {
+				return _fail("Expected a number in the packed array.");
+			}
+			if constexpr (std::is_floating_point<T>::value) {
+				r_array.push_back(double(value));
+			} else if (token_is_integer) {
+				// Parsed from the text, so integers above 2^53 are exact.
+				r_array.push_back(String::to_int((const char *)token.ptr(), token.size() - 1));
+			} else {
+				r_array.push_back(int64_t(double(value)));
+			}
+		}
+	}
+}
+
+Variant JSONReader::read_packed_array(Variant::Type p_type) {
+	if (event_type == EVENT_KEY && read() != OK) {
+		return Variant();
+	}
+	ERR_FAIL_COND_V_MSG(event_type != EVENT_ARRAY_BEGIN, Variant(), "The current event must be the beginning of an array.");
+
+	switch (p_type) {
+		case Variant::PACKED_BYTE_ARRAY: {
+			PackedByteArray array;
+			return _read_packed(array) == OK ? Variant(array) : Variant();
+		}
+		case Variant::PACKED_INT32_ARRAY: {
+			PackedInt32Array array;
+			return _read_packed(array) == OK ? Variant(array) : Variant();
+		}
+		case Variant::PACKED_INT64_ARRAY: {
+			PackedInt64Array array;
+			return _read_packed(array) == OK ? Variant(array) : Variant();
+		}
+		case Variant::PACKED_FLOAT32_ARRAY: {
+			PackedFloat32Array array;
+			return _read_packed(array) == OK ? Variant(array) : Variant();
+		}
+		case Variant::PACKED_FLOAT64_ARRAY: {
+			PackedFloat64Array array;
+			return _read_packed(array) == OK ? Variant(array) : Variant();
+		}
+		case Variant::PACKED_STRING_ARRAY: {
+			PackedStringArray array;
+			return _read_packed(array) == OK ? Variant(array) : Variant();
+		}
+		default: {
+			ERR_FAIL_V_MSG(Variant(), "Unsupported packed array type: " + Variant::get_type_name(p_type) + ".");
+		}
+	}
+}
+
+void JSONReader::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("open", "path"), &JSONReader::open);
+	ClassDB::bind_method(D_METHOD("open_file", "file"), &JSONReader::open_file);
+	ClassDB::bind_method(D_METHOD("open_buffer", "buffer"), &JSONReader::open_buffer);
+	ClassDB::bind_method(D_METHOD("open_stream", "stream"), &JSONReader::open_stream);
+	ClassDB::bind_method(D_METHOD("close"), &JSONReader::close);
+
+	ClassDB::bind_method(D_METHOD("read"), &JSONReader::read);
+	ClassDB::bind_method(D_METHOD("get_event_type"), &JSONReader::get_event_type);
+	ClassDB::bind_method(D_METHOD("get_key"), &JSONReader::get_key);
+	ClassDB::bind_method(D_METHOD("get_value"), &JSONReader::get_value);
+	ClassDB::bind_method(D_METHOD("get_depth"), &JSONReader::get_depth);
+	ClassDB::bind_method(D_METHOD("get_current_line"), &JSONReader::get_current_line);
+
+	ClassDB::bind_method(D_METHOD("skip_section"), &JSONReader::skip_section);
+	ClassDB::bind_method(D_METHOD("read_value"), &JSONReader::read_value);
+	ClassDB::bind_method(D_METHOD("read_packed_array", "type"), &JSONReader::read_packed_array);
+
+	ClassDB::bind_method(D_METHOD("get_error_line"), &JSONReader::get_error_line);
+	ClassDB::bind_method(D_METHOD("get_error_message"), &JSONReader::get_error_message);
+
+	BIND_ENUM_CONSTANT(EVENT_NONE);
+	BIND_ENUM_CONSTANT(EVENT_OBJECT_BEGIN);
+	BIND_ENUM_CONSTANT(EVENT_OBJECT_END);
+	BIND_ENUM_CONSTANT(EVENT_ARRAY_BEGIN);
+	BIND_ENUM_CONSTANT(EVENT_ARRAY_END);
+	BIND_ENUM_CONSTANT(EVENT_KEY);
+	BIND_ENUM_CONSTANT(EVENT_VALUE);
+}
+
+////////////
+
+void JSONWriter::_reset() {
+	file.unref();
+	stream.unref();
+	buffer.clear();
+	error = OK;
+
+	containers.clear();
+	root_written = false;
+	markers.clear();
+}
+
+void JSONWriter::_flush_buffer() {
+	if (buffer.is_empty()) {
+		return;
+	}
+
+	if (file.is_valid()) {
+		file->store_buffer(buffer.ptr(), buffer.size());
+		if (file->get_error() != OK && error == OK) {
+			error = ERR_FILE_CANT_WRITE;
+		}
+	} else if (stream.is_valid()) {
+		Error err = stream->put_data(buffer.ptr(), buffer.size());
+		if (err != OK && error == OK) {
+			error = err;
+		}
+	}
+	buffer.clear();
+}
+
+void JSONWriter::_write(const String &p_string) {
+	CharString utf8 = p_string.utf8();
+	uint32_t size = buffer.size();
+	buffer.resize(size + utf8.length());
+	memcpy(buffer.ptr() + size, utf8.get_data(), utf8.length());
+
+	if (buffer.size() >= CHUNK_SIZE) {
+		_flush_buffer();
+	}
+}
+
+void JSONWriter::_write_ascii(const char *p_string) {
+	while (*p_string) {
+		buffer.push_back(*p_string);
+		p_string++;
+	}
+
+	if (buffer.size() >= CHUNK_SIZE) {
+		_flush_buffer();
+	}
+}
+
+void JSONWriter::_write_newline(int p_depth) {
+	if (indent.is_empty()) {
+		return;
+	}
+	_write_ascii("\n");
+	for (int i = 0; i < p_depth; i++) {
+		_write(indent);
+	}
+}
+
+bool JSONWriter::_begin_item() {
+	ERR_FAIL_COND_V_MSG(file.is_null() && stream.is_null(), false, "The JSONWriter is not open.");
+
+	if (containers.is_empty()) {
+		ERR_FAIL_COND_V_MSG(root_written, false, "A JSON document can only have one root value.");
+		return true;
+	}
+
+	Container &container = containers[containers.size() - 1];
+	if (container.object) {
+		ERR_FAIL_COND_V_MSG(!container.has_key, false, "Values in an object need a key, call write_key() first.");
+		return true;
+	}
+
+	if (container.has_items) {
+		_write_ascii(",");
+	}
+	_write_newline(containers.size());
+	return true;
+}
+
+void JSONWriter::_end_item() {
+	if (containers.is_empty()) {
+		root_written = true;
+		return;
+	}
+
+	Container &container = containers[containers.size() - 1];
+	container.has_items = true;
+	container.has_key = false;
+}
+
+template <class T>
+void JSONWriter::_write_packed(const Vector<T> &p_array) {
+	uint32_t depth = containers.size();
+	begin_array();
+	if (containers.size() == depth) {
+		return;
+	}
+
+	for (int i = 0; i < p_array.size(); i++) {
+		write_value(p_array[i]);
+	}
+	end_array();
+}
+
+Error JSONWriter::open(const String &p_path) {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, "Cannot open file '" + p_path + "'.");
+	return open_file(f);
+}
+
+Error JSONWriter::open_file(const Ref<FileAccess> &p_file) {
+	ERR_FAIL_COND_V(p_file.is_null(), ERR_INVALID_PARAMETER);
+
+	close();
+	file = p_file;
+	return OK;
+}
+
+Error JSONWriter::open_stream(const Ref<StreamPeer> &p_stream) {
+	ERR_FAIL_COND_V(p_stream.is_null(), ERR_INVALID_PARAMETER);
+
+	close();
+	stream = p_stream;
+	return OK;
+}
+
+Error JSONWriter::flush() {
+	_flush_buffer();
+	if (file.is_valid()) {
+		file->flush();
+	}
+	return error;
+}
+
+Error JSONWriter::close() {
+	if (file.is_null() && stream.is_null()) {
+		return OK;
+	}
+
+	if (!containers.is_empty()) {
+		WARN_PRINT("Closing JSONWriter with unterminated objects or arrays.");
+	}
+	Error err = flush();
+	_reset();
+	return err;
+}
+
+void JSONWriter::begin_object() {
+	if (!_begin_item()) {
+		return;
+	}
+	_write_ascii("{");
+
+	Container container;
+	container.object = true;
+	containers.push_back(container);
+}
+
+void JSONWriter::end_object() {
+	ERR_FAIL_COND_MSG(containers.is_empty() || !containers[containers.size() - 1].object, "There is no object to end.");
+	ERR_FAIL_COND_MSG(containers[containers.size() - 1].has_key, "The last key of the object has no value.");
+
+	bool has_items = containers[containers.size() - 1].has_items;
+	containers.resize(containers.size() - 1);
+	if (has_items) {
+		_write_newline(containers.size());
+	} else if (!indent.is_empty()) {
+		// JSON::stringify() keeps both line breaks for empty objects, unlike for empty arrays.
+		_write_ascii("\n");
+		_write_newline(containers.size());
+	}
+	_write_ascii("}");
+	_end_item();
+}
+
+void JSONWriter::begin_array() {
+	if (!_begin_item()) {
+		return;
+	}
+	_write_ascii("[");
+	containers.push_back(Container());
+}
+
+void JSONWriter::end_array() {
+	ERR_FAIL_COND_MSG(containers.is_empty() || containers[containers.size() - 1].object, "There is no array to end.");
+
+	bool has_items = containers[containers.size() - 1].has_items;
+	containers.resize(containers.size() - 1);
+	if (has_items) {
+		_write_newline(containers.size());
+	}
+	_write_ascii("]");
+	_end_item();
+}
+
+void JSONWriter::write_key(const String &p_key) {
+	ERR_FAIL_COND_MSG(containers.is_empty() || !containers[containers.size() - 1].object, "Keys can only be written inside an object.");
+
+	Container &container = containers[containers.size() - 1];
+	ERR_FAIL_COND_MSG(container.has_key, "The previous key has no value yet.");
+
+	if (container.has_items) {
+		_write_ascii(",");
+	}
+	_write_newline(containers.size());
+	_write("\"" + p_key.json_escape() + "\"");
+	_write_ascii(indent.is_empty() ? ":" : ": ");
+	container.has_key = true;
+}
+
+void JSONWriter::write_value(const Variant &p_value) {
+	switch (p_value.get_type()) {
+		case Variant::ARRAY: {
+			Array a = p_value;
+			ERR_FAIL_COND_MSG(markers.has(a.id()), "Converting circular structure to JSON.");
+			ERR_FAIL_COND_MSG(containers.size() >= Variant::MAX_RECURSION_DEPTH, "JSON structure is too deep. Bailing.");
+
+			uint32_t depth = containers.size();
+			begin_array();
+			if (containers.size() == depth) {
+				return;
+			}
+
+			markers.insert(a.id());
+			for (int i = 0; i < a.size(); i++) {
+				write_value(a[i]);
+			}
+			markers.erase(a.id());
+			end_array();
+		} break;
+		case Variant::DICTIONARY: {
+			Dictionary d = p_value;
+			ERR_FAIL_COND_MSG(markers.has(d.id()), "Converting circular structure to JSON.");
+			ERR_FAIL_COND_MSG(containers.size() >= Variant::MAX_RECURSION_DEPTH, "JSON structure is too deep. Bailing.");
+
+			uint32_t depth = containers.size();
+			begin_object();
+			if (containers.size() == depth) {
+				return;
+			}
+
+			markers.insert(d.id());
+			List<Variant> keys;
+			d.get_key_list(&keys);
+			if (sort_keys) {
+				keys.sort();
+			}
+			for (const Variant &E : keys) {
+				write_key(E);
+				write_value(d[E]);
+			}
+			markers.erase(d.id());
+			end_object();
+		} break;
+		case Variant::PACKED_INT32_ARRAY: {
+			_write_packed<int32_t>(p_value);
+		} break;
+		case Variant::PACKED_INT64_ARRAY: {
+			_write_packed<int64_t>(p_value);
+		} break;
+		case Variant::PACKED_FLOAT32_ARRAY: {
+			_write_packed<float>(p_value);
+		} break;
+		case Variant::PACKED_FLOAT64_ARRAY: {
+			_write_packed<double>(p_value);
+		} break;
+		case Variant::PACKED_STRING_ARRAY: {
+			_write_packed<String>(p_value);
+		} break;
+		default: {
+			if (!_begin_item()) {
+				return;
+			}
+			_write(JSON::_stringify(p_value, "", 0, false, markers, full_precision));
+			_end_item();
+		}
+	}
+}
+
+void JSONWriter::set_indent(const String &p_indent) {
+	indent = p_indent;
+}
+
+String JSONWriter::get_indent() const {
+	return indent;
+}
+
+void JSONWriter::set_sort_keys(bool p_enable) {
+	sort_keys = p_enable;
+}
+
+bool JSONWriter::is_sorting_keys() const {
+	return sort_keys;
+}
+
+void JSONWriter::set_full_precision(bool p_enable) {
+	full_precision = p_enable;
+}
+
+bool JSONWriter::is_full_precision() const {
+	return full_precision;
+}
+
+void JSONWriter::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("open", "path"), &JSONWriter::open);
+	ClassDB::bind_method(D_METHOD("open_file", "file"), &JSONWriter::open_file);
+	ClassDB::bind_method(D_METHOD("open_stream", "stream"), &JSONWriter::open_stream);
+	ClassDB::bind_method(D_METHOD("flush"), &JSONWriter::flush);
+	ClassDB::bind_method(D_METHOD("close"), &JSONWriter::close);
+
+	ClassDB::bind_method(D_METHOD("begin_object"), &JSONWriter::begin_object);
+	ClassDB::bind_method(D_METHOD("end_object"), &JSONWriter::end_object);
+	ClassDB::bind_method(D_METHOD("begin_array"), &JSONWriter::begin_array);
+	ClassDB::bind_method(D_METHOD("end_array"), &JSONWriter::end_array);
+	ClassDB::bind_method(D_METHOD("write_key", "key"), &JSONWriter::write_key);
+	ClassDB::bind_method(D_METHOD("write_value", "value"), &JSONWriter::write_value);
+
+	ClassDB::bind_method(D_METHOD("get_depth"), &JSONWriter::get_depth);
+	ClassDB::bind_method(D_METHOD("get_error"), &JSONWriter::get_error);
+
+	ClassDB::bind_method(D_METHOD("set_indent", "indent"), &JSONWriter::set_indent);
+	ClassDB::bind_method(D_METHOD("get_indent"), &JSONWriter::get_indent);
+	ClassDB::bind_method(D_METHOD("set_sort_keys", "enable"), &JSONWriter::set_sort_keys);
+	ClassDB::bind_method(D_METHOD("is_sorting_keys"), &JSONWriter::is_sorting_keys);
+	ClassDB::bind_method(D_METHOD("set_full_precision", "enable"), &JSONWriter::set_full_precision);
+	ClassDB::bind_method(D_METHOD("is_full_precision"), &JSONWriter::is_full_precision);
+
+	ADD_PROPERTY(PropertyInfo(Variant::STRING, "indent"), "set_indent", "get_indent");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "sort_keys"), "set_sort_keys", "is_sorting_keys");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "full_precision"), "set_full_precision", "is_full_precision");
+}
+
+JSONWriter::~JSONWriter() {
+	close();
+}
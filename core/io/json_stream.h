@@ -0,0 +1,209 @@
+/**************************************************************************/
+/*  json_stream.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef JSON_STREAM_H
+#define JSON_STREAM_H
+
+#include "core/io/file_access.h"
+#include "core/io/stream_peer.h"
+#include "core/object/ref_counted.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
+
+// Pull parser reading JSON as a sequence of events, without building the whole document in memory.
+// Input is UTF-8 and is read in chunks, so it can come from a file or a blocking StreamPeer.
+
+class JSONReader : public RefCounted {
+	GDCLASS(JSONReader, RefCounted);
+
+public:
+	enum EventType {
+		EVENT_NONE,
+		EVENT_OBJECT_BEGIN,
+		EVENT_OBJECT_END,
+		EVENT_ARRAY_BEGIN,
+		EVENT_ARRAY_END,
+		EVENT_KEY,
+		EVENT_VALUE,
+	};
+
+private:
+	enum State {
+		STATE_VALUE,
+		STATE_FIRST_ARRAY_VALUE,
+		STATE_KEY,
+		STATE_FIRST_KEY,
+		STATE_AFTER_VALUE,
+		STATE_DONE,
+		STATE_ERROR,
+	};
+
+	static const int CHUNK_SIZE = 64 * 1024;
+
+	Ref<FileAccess> file;
+	Ref<StreamPeer> stream;
+	Vector<uint8_t> buffer;
+	int buffer_pos = 0;
+	int buffer_len = 0;
+	bool source_eof = true;
+
+	State state = STATE_DONE;
+	LocalVector<bool> containers; // True for objects.
+	LocalVector<uint8_t> token;
+	bool token_is_integer = false;
+
+	EventType event_type = EVENT_NONE;
+	String key;
+	Variant value;
+	int line = 1;
+	String err_str;
+	int err_line = 0;
+
+	bool _refill();
+	_FORCE_INLINE_ int _peek_char() {
+		if (buffer_pos == buffer_len && !_refill()) {
+			return -1;
+		}
+		return buffer.ptr()[buffer_pos];
+	}
+	_FORCE_INLINE_ int _next_char() {
+		int c = _peek_char();
+		if (c >= 0) {
+			buffer_pos++;
+		}
+		return c;
+	}
+
+	void _reset();
+	Error _fail(const String &p_message);
+	int _skip_whitespace();
+	Error _parse_hex(uint32_t &r_value);
+	Error _parse_string(String &r_string);
+	Error _parse_number();
+	Error _parse_identifier();
+	Error _parse_value_start(int p_char);
+	template <class T>
+	Error _read_packed(Vector<T> &r_array);
+
+protected:
+	static void _bind_methods();
+
+public:
+	Error open(const String &p_path);
+	Error open_file(const Ref<FileAccess> &p_file);
+	Error open_buffer(const Vector<uint8_t> &p_buffer);
+	Error open_stream(const Ref<StreamPeer> &p_stream);
+	void close();
+
+	Error read();
+	EventType get_event_type() const { return event_type; }
+	String get_key() const { return key; }
+	Variant get_value() const { return value; }
+	int get_depth() const { return containers.size(); }
+	int get_current_line() const { return line; }
+
+	Error skip_section();
+	Variant read_value();
+	Variant read_packed_array(Variant::Type p_type);
+
+	int get_error_line() const { return err_line; }
+	String get_error_message() const { return err_str; }
+};
+
+// Writes JSON incrementally, using the same formatting as JSON::stringify().
+// Output is buffered and sent to the file or StreamPeer in chunks.
+
+class JSONWriter : public RefCounted {
+	GDCLASS(JSONWriter, RefCounted);
+
+	static const int CHUNK_SIZE = 64 * 1024;
+
+	struct Container {
+		bool object = false;
+		bool has_items = false;
+		bool has_key = false;
+	};
+
+	Ref<FileAccess> file;
+	Ref<StreamPeer> stream;
+	LocalVector<uint8_t> buffer;
+	Error error = OK;
+
+	LocalVector<Container> containers;
+	bool root_written = false;
+	HashSet<const void *> markers;
+
+	String indent;
+	bool sort_keys = true;
+	bool full_precision = false;
+
+	void _reset();
+	void _flush_buffer();
+	void _write(const String &p_string);
+	void _write_ascii(const char *p_string);
+	void _write_newline(int p_depth);
+	bool _begin_item();
+	void _end_item();
+	template <class T>
+	void _write_packed(const Vector<T> &p_array);
+
+protected:
+	static void _bind_methods();
+
+public:
+	Error open(const String &p_path);
+	Error open_file(const Ref<FileAccess> &p_file);
+	Error open_stream(const Ref<StreamPeer> &p_stream);
+	Error flush();
+	Error close();
+
+	void begin_object();
+	void end_object();
+	void begin_array();
+	void end_array();
+	void write_key(const String &p_key);
+	void write_value(const Variant &p_value);
+
+	int get_depth() const { return containers.size(); }
+	Error get_error() const { return error; }
+
+	void set_indent(const String &p_indent);
+	String get_indent() const;
+	void set_sort_keys(bool p_enable);
+	bool is_sorting_keys() const;
+	void set_full_precision(bool p_enable);
+	bool is_full_precision() const;
+
+	~JSONWriter();
+};
+
+VARIANT_ENUM_CAST(JSONReader::EventType);
+
+#endif // JSON_STREAM_H
@@ -1814,6 +1814,168 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 	return OK;
 }
 
+static Error _encode_reserve(Vector<uint8_t> &r_buffer, int64_t p_size, uint8_t *&r_ptr) {
+	ERR_FAIL_COND_V_MSG(p_size > INT_MAX, ERR_OUT_OF_MEMORY, "Encoded Variant is too large.");
+	if (unlikely(r_buffer.size() < p_size)) {
+		r_buffer.resize(p_size < (1 << 30) ? next_power_of_2(p_size) : p_size);
+	}
+	r_ptr = r_buffer.ptrw();
+	return OK;
+}
+
+static Error _encode_variant_to_buffer(const Variant &p_variant, Vector<uint8_t> &r_buffer, int &r_pos, bool p_full_objects, int p_depth) {
+	ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Potential infinite recursion detected. Bailing.");
+
+	uint8_t *w = nullptr;
+	switch (p_variant.get_type()) {
+		case Variant::STRING:
+		case Variant::STRING_NAME: {
+			CharString utf8 = String(p_variant).utf8();
+			int len = utf8.length();
+			int pad = (4 - len % 4) % 4;
+			Error err = _encode_reserve(r_buffer, int64_t(r_pos) + 8 + len + pad, w);
+			ERR_FAIL_COND_V(err, err);
+
+			w += r_pos;
+			encode_uint32(p_variant.get_type(), w);
+			encode_uint32(len, w + 4);
+			memcpy(w + 8, utf8.get_data(), len);
+			memset(w + 8 + len, 0, pad);
+			r_pos += 8 + len + pad;
+		} break;
+		case Variant::DICTIONARY: {
+			Dictionary d = p_variant;
+			Error err = _encode_reserve(r_buffer, int64_t(r_pos) + 8, w);
+			ERR_FAIL_COND_V(err, err);
+
+			encode_uint32(Variant::DICTIONARY, w + r_pos);
+			encode_uint32(uint32_t(d.size()), w + r_pos + 4);
+			r_pos += 8;
+
+			List<Variant> keys;
+			d.get_key_list(&keys);
+
+			for (const Variant &E : keys) {
+				err = _encode_variant_to_buffer(E, r_buffer, r_pos, p_full_objects, p_depth + 1);
+				ERR_FAIL_COND_V(err, err);
+				Variant *v = d.getptr(E);
+				ERR_FAIL_NULL_V(v, ERR_BUG);
+				err = _encode_variant_to_buffer(*v, r_buffer, r_pos, p_full_objects, p_depth + 1);
+				ERR_FAIL_COND_V(err, err);
+			}
+		} break;
+		case Variant::ARRAY: {
+			Array a = p_variant;
+			Error err = _encode_reserve(r_buffer, int64_t(r_pos) + 8, w);
+			ERR_FAIL_COND_V(err, err);
+
+			encode_uint32(Variant::ARRAY, w + r_pos);
+			encode_uint32(uint32_t(a.size()), w + r_pos + 4);
+			r_pos += 8;
+
+			for (int i = 0; i < a.size(); i++) {
+				err = _encode_variant_to_buffer(a.get(i), r_buffer, r_pos, p_full_objects, p_depth + 1);
+				ERR_FAIL_COND_V(err, err);
+			}
+		} break;
+		case Variant::PACKED_STRING_ARRAY: {
+			Vector<String> data = p_variant;
+			Error err = _encode_reserve(r_buffer, int64_t(r_pos) + 8, w);
+			ERR_FAIL_COND_V(err, err);
+
+			encode_uint32(Variant::PACKED_STRING_ARRAY, w + r_pos);
+			encode_uint32(data.size(), w + r_pos + 4);
+			r_pos += 8;
+
+			for (int i = 0; i < data.size(); i++) {
+				CharString utf8 = data[i].utf8();
+				int len = utf8.length() + 1; // Includes the terminator.
+				int pad = (4 - len % 4) % 4;
+				err = _encode_reserve(r_buffer, int64_t(r_pos) + 4 + len + pad, w);
+				ERR_FAIL_COND_V(err, err);
+
+				w += r_pos;
+				encode_uint32(len, w);
+				memcpy(w + 4, utf8.get_data(), len);
+				memset(w + 4 + len, 0, pad);
+				r_pos += 4 + len + pad;
+			}
+		} break;
+		default: {
+			// Every other type either has a constant size or a size that is known without converting its data,
+			// so measuring it first is cheap and the data is still only written once.
+			int len;
+			Error err = encode_variant(p_variant, nullptr, len, p_full_objects, p_depth);
+			ERR_FAIL_COND_V(err, err);
+			err = _encode_reserve(r_buffer, int64_t(r_pos) + len, w);
+			ERR_FAIL_COND_V(err, err);
+			err = encode_variant(p_variant, w + r_pos, len, p_full_objects, p_depth);
+			ERR_FAIL_COND_V(err, err);
+			r_pos += len;
+		}
+	}
+
+	return OK;
+}
+
+Error encode_variant_to_buffer(const Variant &p_variant, Vector<uint8_t> &r_buffer, int p_offset, int &r_len, bool p_full_objects) {
+	ERR_FAIL_COND_V(p_offset < 0, ERR_INVALID_PARAMETER);
+
+	int pos = p_offset;
+	Error err = _encode_variant_to_buffer(p_variant, r_buffer, pos, p_full_objects, 0);
+	r_len = pos - p_offset;
+	return err;
+}
+
+Error decode_packed_array_view(EncodedPackedArray &r_array, const uint8_t *p_buffer, int p_len, int *r_len) {
+	ERR_FAIL_COND_V(p_len < 8, ERR_INVALID_DATA);
+
+	uint32_t type = decode_uint32(p_buffer);
+	bool is_64 = type & ENCODE_FLAG_64;
+	int item_size = 0;
+	switch (type & ENCODE_MASK) {
+		case Variant::PACKED_BYTE_ARRAY: {
+			item_size = 1;
+		} break;
+		case Variant::PACKED_INT32_ARRAY:
+		case Variant::PACKED_FLOAT32_ARRAY: {
+			item_size = 4;
+		} break;
+		case Variant::PACKED_INT64_ARRAY:
+		case Variant::PACKED_FLOAT64_ARRAY: {
+			item_size = 8;
+		} break;
+		case Variant::PACKED_VECTOR2_ARRAY: {
+			item_size = is_64 ? sizeof(double) * 2 : sizeof(float) * 2;
+		} break;
+		case Variant::PACKED_VECTOR3_ARRAY: {
+			item_size = is_64 ? sizeof(double) * 3 : sizeof(float) * 3;
+		} break;
+		case Variant::PACKED_COLOR_ARRAY: {
+			item_size = 4 * 4;
+		} break;
+		default: {
+			ERR_FAIL_V_MSG(ERR_INVALID_PARAMETER, "The encoded Variant is not a packed array of numbers.");
+		}
+	}
+
+	int32_t count = decode_uint32(p_buffer + 4);
+	ERR_FAIL_MUL_OF(count, item_size, ERR_INVALID_DATA);
+	ERR_FAIL_COND_V(count < 0 || count * item_size > p_len - 8, ERR_INVALID_DATA);
+
+	r_array.type = Variant::Type(type & ENCODE_MASK);
+	r_array.is_64 = is_64;
+	r_array.data = p_buffer + 8;
+	r_array.count = count;
+	r_array.item_size = item_size;
+
+	if (r_len) {
+		int size = 8 + count * item_size;
+		*r_len = size + (4 - size % 4) % 4;
+	}
+	return OK;
+}
+
 Vector<float> vector3_to_float32_array(const Vector3 *vecs, size_t count) {
 	// We always allocate a new array, and we don't memcpy.
 	// We also don't consider returning a pointer to the passed vectors when sizeof(real_t) == 4.
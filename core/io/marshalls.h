@@ -215,6 +215,21 @@ public:
 Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len = nullptr, bool p_allow_objects = false, int p_depth = 0);
 Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_full_objects = false, int p_depth = 0);
 
+// Encodes in a single pass at p_offset of r_buffer, growing it as needed. The buffer may end up larger than p_offset + r_len, so it can be reused.
+Error encode_variant_to_buffer(const Variant &p_variant, Vector<uint8_t> &r_buffer, int p_offset, int &r_len, bool p_full_objects = false);
+
+// Items of an encoded packed array of numbers, pointing into the encoded buffer instead of being copied.
+// They are stored in little-endian order, and vectors use doubles if is_64 is set.
+struct EncodedPackedArray {
+	Variant::Type type = Variant::NIL;
+	bool is_64 = false;
+	const uint8_t *data = nullptr;
+	int count = 0;
+	int item_size = 0;
+};
+
+Error decode_packed_array_view(EncodedPackedArray &r_array, const uint8_t *p_buffer, int p_len, int *r_len = nullptr);
+
 Vector<float> vector3_to_float32_array(const Vector3 *vecs, size_t count);
 
 #endif // MARSHALLS_H
@@ -40,3 +40,16 @@ NetSocket *NetSocket::create() {
 	ERR_PRINT("Unable to create network socket, platform not supported");
 	return nullptr;
 }
+
+Error NetSocket::recvfrom_batch(uint8_t *p_buffer, int p_len, int p_count, int *r_read, IPAddress *r_ip, uint16_t *r_port, int &r_received) {
+	r_received = 0;
+	while (r_received < p_count) {
+		Error err = recvfrom(p_buffer + r_received * p_len, p_len, r_read[r_received], r_ip[r_received], r_port[r_received]);
+		if (err != OK) {
+			// Report the error on the next call if something was already received.
+			return r_received > 0 ? OK : err;
+		}
+		r_received++;
+	}
+	return OK;
+}
@@ -61,6 +61,8 @@ public:
 	virtual Error poll(PollType p_type, int timeout) const = 0;
 	virtual Error recv(uint8_t *p_buffer, int p_len, int &r_read) = 0;
 	virtual Error recvfrom(uint8_t *p_buffer, int p_len, int &r_read, IPAddress &r_ip, uint16_t &r_port, bool p_peek = false) = 0;
+	// Receives up to p_count datagrams, each one in its own p_len bytes slot of p_buffer. Returns ERR_BUSY if none are available.
+	virtual Error recvfrom_batch(uint8_t *p_buffer, int p_len, int p_count, int *r_read, IPAddress *r_ip, uint16_t *r_port, int &r_received);
 	virtual Error send(const uint8_t *p_buffer, int p_len, int &r_sent) = 0;
 	virtual Error sendto(const uint8_t *p_buffer, int p_len, int &r_sent, IPAddress p_ip, uint16_t p_port) = 0;
 	virtual Ref<NetSocket> accept(IPAddress &r_ip, uint16_t &r_port) = 0;
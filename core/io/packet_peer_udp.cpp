@@ -274,19 +274,18 @@ Error PacketPeerUDP::_poll() {
 		return OK; // Handled by UDPServer.
 	}
 
+	if (recv_batch.is_empty()) {
+		recv_batch.resize(PACKET_BUFFER_SIZE * RECV_BATCH_SIZE);
+	}
+
 	Error err;
-	int read;
-	IPAddress ip;
-	uint16_t port;
+	int read[RECV_BATCH_SIZE];
+	IPAddress ip[RECV_BATCH_SIZE];
+	uint16_t port[RECV_BATCH_SIZE];
+	int received = 0;
 
 	while (true) {
-		if (connected) {
-			err = _sock->recv(recv_buffer, sizeof(recv_buffer), read);
-			ip = peer_addr;
-			port = peer_port;
-		} else {
-			err = _sock->recvfrom(recv_buffer, sizeof(recv_buffer), read, ip, port);
-		}
+		err = _sock->recvfrom_batch(recv_batch.ptr(), PACKET_BUFFER_SIZE, RECV_BATCH_SIZE, read, ip, port, received);
 
 		if (err != OK) {
 			if (err == ERR_BUSY) {
@@ -295,12 +294,19 @@ Error PacketPeerUDP::_poll() {
 			return FAILED;
 		}
 
-		err = store_packet(ip, port, recv_buffer, read);
+		for (int i = 0; i < received; i++) {
+			if (connected) {
+				// A connected socket only receives from its peer.
+				ip[i] = peer_addr;
+				port[i] = peer_port;
+			}
+			err = store_packet(ip[i], port[i], recv_batch.ptr() + i * PACKET_BUFFER_SIZE, read[i]);
 #ifdef TOOLS_ENABLED
-		if (err != OK) {
-			WARN_PRINT("Buffer full, dropping packets!");
-		}
+			if (err != OK) {
+				WARN_PRINT("Buffer full, dropping packets!");
+			}
 #endif
+		}
 	}
 
 	return OK;
@@ -34,6 +34,7 @@
 #include "core/io/ip.h"
 #include "core/io/net_socket.h"
 #include "core/io/packet_peer.h"
+#include "core/templates/local_vector.h"
 
 class UDPServer;
 
@@ -42,11 +43,12 @@ class PacketPeerUDP : public PacketPeer {
 
 protected:
 	enum {
-		PACKET_BUFFER_SIZE = 65536
+		PACKET_BUFFER_SIZE = 65536,
+		RECV_BATCH_SIZE = 8,
 	};
 
 	RingBuffer<uint8_t> rb;
-	uint8_t recv_buffer[PACKET_BUFFER_SIZE];
+	LocalVector<uint8_t> recv_batch; // RECV_BATCH_SIZE slots of PACKET_BUFFER_SIZE, allocated on first poll.
 	uint8_t packet_buffer[PACKET_BUFFER_SIZE];
 	IPAddress packet_ip;
 	int packet_port = 0;
@@ -482,8 +482,15 @@ Mutex ResourceCache::lock;
 #ifdef TOOLS_ENABLED
 RWLock ResourceCache::path_cache_lock;
 #endif
+Mutex ResourceCache::retention_lock;
+HashMap<StringName, ResourceCache::RetentionPool *> ResourceCache::retention_pools;
 
 void ResourceCache::clear() {
+	for (const KeyValue<StringName, RetentionPool *> &E : retention_pools) {
+		memdelete(E.value);
+	}
+	retention_pools.clear();
+
 	if (resources.size()) {
 		ERR_PRINT("Resources still in use at exit (run with --verbose for details).");
 		if (OS::get_singleton()->is_stdout_verbose()) {
@@ -571,3 +578,130 @@ int ResourceCache::get_cached_resource_count() {
 
 	return rc;
 }
+
+ResourceCache::RetentionPool *ResourceCache::_find_retention_pool(const StringName &p_class) {
+	StringName class_name = p_class;
+	while (class_name != StringName()) {
+		HashMap<StringName, RetentionPool *>::Iterator E = retention_pools.find(class_name);
+		if (E) {
+			return E->value;
+		}
+		class_name = ClassDB::get_parent_class_nocheck(class_name);
+	}
+	return nullptr;
+}
+
+void ResourceCache::_evict_retained(RetentionPool *p_pool, LocalVector<Ref<Resource>> &r_released, bool p_all) {
+	while (p_pool->resources.get_size() && (p_all || p_pool->used > p_pool->budget)) {
+		const RetainedResource &retained = p_pool->resources.get_least_recent();
+		p_pool->used -= retained.size;
+		r_released.push_back(retained.resource);
+		p_pool->resources.erase_least_recent();
+		p_pool->evictions++;
+	}
+}
+
+void ResourceCache::retain(const Ref<Resource> &p_resource, const String &p_source_path) {
+	ERR_FAIL_COND(p_resource.is_null());
+	if (p_resource->get_path().is_empty()) {
+		return;
+	}
+
+	{
+		MutexLock mutex_lock(retention_lock);
+		if (retention_pools.is_empty()) {
+			return;
+		}
+		RetentionPool *pool = _find_retention_pool(p_resource->get_class_name());
+		if (!pool) {
+			return;
+		}
+		const RetainedResource *retained = pool->resources.getptr(p_resource->get_path());
+		if (retained && retained->resource == p_resource) {
+			pool->hits++;
+			return;
+		}
+		pool->misses++;
+	}
+
+	// Estimated from the size of the file it was loaded from, which for imported resources is close to the size they take in memory.
+	uint64_t size = 0;
+	String source_path = ResourceLoader::import_remap(p_source_path);
+	Ref<FileAccess> f = FileAccess::open(source_path, FileAccess::READ);
+	if (f.is_valid()) {
+		size = f->get_length();
+	}
+
+	LocalVector<Ref<Resource>> released; // Freed once the lock is released, as they may release other resources.
+	MutexLock mutex_lock(retention_lock);
+	RetentionPool *pool = _find_retention_pool(p_resource->get_class_name());
+	if (!pool) {
+		return; // Disabled meanwhile.
+	}
+	const RetainedResource *existing = pool->resources.getptr(p_resource->get_path());
+	if (existing) {
+		pool->used -= existing->size;
+		released.push_back(existing->resource);
+		pool->resources.erase(p_resource->get_path());
+	}
+
+	RetainedResource retained;
+	retained.resource = p_resource;
+	retained.size = size;
+	pool->resources.insert(p_resource->get_path(), retained);
+	pool->used += size;
+	_evict_retained(pool, released);
+}
+
+void ResourceCache::set_retention_budget(const StringName &p_type, uint64_t p_bytes) {
+	ERR_FAIL_COND_MSG(!ClassDB::is_parent_class(p_type, "Resource"), "'" + String(p_type) + "' isn't a resource type.");
+
+	LocalVector<Ref<Resource>> released;
+	MutexLock mutex_lock(retention_lock);
+	HashMap<StringName, RetentionPool *>::Iterator E = retention_pools.find(p_type);
+	if (p_bytes == 0) {
+		if (E) {
+			RetentionPool *pool = E->value;
+			_evict_retained(pool, released, true);
+			retention_pools.remove(E);
+			memdelete(pool);
+		}
+		return;
+	}
+
+	if (!E) {
+		E = retention_pools.insert(p_type, memnew(RetentionPool));
+	}
+	E->value->budget = p_bytes;
+	_evict_retained(E->value, released);
+}
+
+uint64_t ResourceCache::get_retention_budget(const StringName &p_type) {
+	MutexLock mutex_lock(retention_lock);
+	RetentionPool *const *pool = retention_pools.getptr(p_type);
+	return pool ? (*pool)->budget : 0;
+}
+
+Dictionary ResourceCache::get_retention_stats() {
+	MutexLock mutex_lock(retention_lock);
+	Dictionary stats;
+	for (const KeyValue<StringName, RetentionPool *> &E : retention_pools) {
+		Dictionary pool_stats;
+		pool_stats["budget"] = E.value->budget;
+		pool_stats["used"] = E.value->used;
+		pool_stats["count"] = (uint64_t)E.value->resources.get_size();
+		pool_stats["hits"] = E.value->hits;
+		pool_stats["misses"] = E.value->misses;
+		pool_stats["evictions"] = E.value->evictions;
+		stats[E.key] = pool_stats;
+	}
+	return stats;
+}
+
+void ResourceCache::clear_retained() {
+	LocalVector<Ref<Resource>> released;
+	MutexLock mutex_lock(retention_lock);
+	for (KeyValue<StringName, RetentionPool *> &E : retention_pools) {
+		_evict_retained(E.value, released, true);
+	}
+}
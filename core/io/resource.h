@@ -34,6 +34,7 @@
 #include "core/io/resource_uid.h"
 #include "core/object/class_db.h"
 #include "core/object/ref_counted.h"
+#include "core/templates/lru.h"
 #include "core/templates/safe_refcount.h"
 #include "core/templates/self_list.h"
 
@@ -159,11 +160,42 @@ class ResourceCache {
 	static void clear();
 	friend void register_core_types();
 
+	// Loaded resources kept alive after their last user releases them, so loading them again is free.
+	// Bounded by a memory budget per type, the least recently loaded ones are released first.
+	struct RetainedResource {
+		Ref<Resource> resource;
+		uint64_t size = 0;
+	};
+
+	struct RetentionPool {
+		LRUCache<String, RetainedResource> resources;
+		uint64_t budget = 0;
+		uint64_t used = 0;
+		uint64_t hits = 0;
+		uint64_t misses = 0;
+		uint64_t evictions = 0;
+
+		RetentionPool() :
+				resources(INT32_MAX) {}
+	};
+
+	static Mutex retention_lock;
+	static HashMap<StringName, RetentionPool *> retention_pools;
+
+	static RetentionPool *_find_retention_pool(const StringName &p_class);
+	static void _evict_retained(RetentionPool *p_pool, LocalVector<Ref<Resource>> &r_released, bool p_all = false);
+
 public:
 	static bool has(const String &p_path);
 	static Ref<Resource> get_ref(const String &p_path);
 	static void get_cached_resources(List<Ref<Resource>> *p_resources);
 	static int get_cached_resource_count();
+
+	static void retain(const Ref<Resource> &p_resource, const String &p_source_path); // Called by ResourceLoader for every load, p_source_path is used to estimate the size.
+	static void set_retention_budget(const StringName &p_type, uint64_t p_bytes); // Also applies to types inheriting p_type, 0 disables it.
+	static uint64_t get_retention_budget(const StringName &p_type);
+	static Dictionary get_retention_stats();
+	static void clear_retained();
 };
 
 #endif // RESOURCE_H
@@ -33,10 +33,12 @@
 #include "core/config/project_settings.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access_compressed.h"
+#include "core/io/file_access_memory.h"
 #include "core/io/image.h"
 #include "core/io/marshalls.h"
 #include "core/io/missing_resource.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/version.h"
 
 //#define print_bl(m_what) print_line(m_what)
@@ -885,14 +887,19 @@ static String get_ustring(Ref<FileAccess> f) {
 
 String ResourceLoaderBinary::get_unicode_string() {
 	int len = f->get_32();
-	if (len > str_buf.size()) {
-		str_buf.resize(len);
-	}
 	if (len == 0) {
 		return String();
 	}
-	f->get_buffer((uint8_t *)&str_buf[0], len);
 	String s;
+	const uint8_t *mapped = f->map_range(len);
+	if (mapped) {
+		s.parse_utf8((const char *)mapped, len);
+		return s;
+	}
+	if (len > str_buf.size()) {
+		str_buf.resize(len);
+	}
+	f->get_buffer((uint8_t *)&str_buf[0], len);
 	s.parse_utf8(&str_buf[0]);
 	return s;
 }
@@ -2059,6 +2066,23 @@ static String _resource_get_class(Ref<Resource> p_resource) {
 	}
 }
 
+void ResourceFormatSaverBinaryInstance::_encode_resource(uint32_t p_index, ResourceEncodeData *p_data) {
+	const ResourceData &rd = *p_data->resources[p_index];
+
+	Ref<FileAccessMemory> f;
+	f.instantiate();
+	f->open_write_buffer(&p_data->buffers[p_index]);
+	f->set_big_endian(big_endian);
+
+	save_unicode_string(f, rd.type);
+	f->store_32(rd.properties.size());
+
+	for (const Property &p : rd.properties) {
+		f->store_32(p.name_idx);
+		write_variant(f, p.value, *p_data->resource_map, external_resources, string_map, p.pi);
+	}
+}
+
 Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Resource> &p_resource, uint32_t p_flags) {
 	Error err;
 	Ref<FileAccess> f;
@@ -2274,14 +2298,34 @@ Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Re
 	Vector<uint64_t> ofs_table;
 
 	//now actually save the resources
+	LocalVector<const ResourceData *> resource_list;
 	for (const ResourceData &rd : resources) {
-		ofs_table.push_back(f->get_position());
-		save_unicode_string(f, rd.type);
-		f->store_32(rd.properties.size());
+		resource_list.push_back(&rd);
+	}
+
+	// Resources are encoded into memory on worker threads and written in order. A few at a time, to bound the memory used.
+	WorkerThreadPool *thread_pool = WorkerThreadPool::get_singleton();
+	uint32_t batch_size = thread_pool ? MAX(1, thread_pool->get_thread_count()) * 2 : 1;
+
+	ResourceEncodeData encode_data;
+	encode_data.buffers.resize(batch_size);
+	encode_data.resource_map = &resource_map;
+
+	for (uint32_t from = 0; from < resource_list.size(); from += batch_size) {
+		uint32_t count = MIN(batch_size, resource_list.size() - from);
+		encode_data.resources = resource_list.ptr() + from;
+
+		if (count > 1) {
+			WorkerThreadPool::GroupID group_task = thread_pool->add_template_group_task(this, &ResourceFormatSaverBinaryInstance::_encode_resource, &encode_data, count, -1, true, SNAME("ResourceSaverBinaryEncode"));
+			thread_pool->wait_for_group_task_completion(group_task);
+		} else {
+			_encode_resource(0, &encode_data);
+		}
 
-		for (const Property &p : rd.properties) {
-			f->store_32(p.name_idx);
-			write_variant(f, p.value, resource_map, external_resources, string_map, p.pi);
+		for (uint32_t i = 0; i < count; i++) {
+			ofs_table.push_back(f->get_position());
+			f->store_buffer(encode_data.buffers[i].ptr(), encode_data.buffers[i].size());
+			encode_data.buffers[i].clear();
 		}
 	}
 
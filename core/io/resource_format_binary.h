@@ -34,6 +34,7 @@
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/templates/local_vector.h"
 
 class ResourceLoaderBinary {
 	bool translation_remapped = false;
@@ -157,6 +158,14 @@ class ResourceFormatSaverBinaryInstance {
 		List<Property> properties;
 	};
 
+	struct ResourceEncodeData {
+		const ResourceData *const *resources = nullptr;
+		LocalVector<LocalVector<uint8_t>> buffers;
+		HashMap<Ref<Resource>, int> *resource_map = nullptr;
+	};
+
+	void _encode_resource(uint32_t p_index, ResourceEncodeData *p_data);
+
 	static void _pad_buffer(Ref<FileAccess> f, int p_bytes);
 	void _find_resources(const Variant &p_variant, bool p_main = false);
 	static void save_unicode_string(Ref<FileAccess> f, const String &p_string, bool p_bit_on_len = false);
@@ -239,6 +239,8 @@ ResourceLoader::LoadToken::~LoadToken() {
 }
 
 Ref<Resource> ResourceLoader::_load(const String &p_path, const String &p_original_path, const String &p_type_hint, ResourceFormatLoader::CacheMode p_cache_mode, Error *r_error, bool p_use_sub_threads, float *r_progress) {
+	MEMORY_TAG_SCOPE("Resources");
+
 	load_nesting++;
 	if (load_paths_stack->size()) {
 		thread_load_mutex.lock();
@@ -361,8 +363,15 @@ void ResourceLoader::_thread_load_function(void *p_userdata) {
 		}
 	}
 
+	Ref<Resource> loaded = load_task.cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE ? load_task.resource : Ref<Resource>();
+	String loaded_from = load_task.remapped_path;
+
 	thread_load_mutex.unlock();
 
+	if (loaded.is_valid()) {
+		ResourceCache::retain(loaded, loaded_from);
+	}
+
 	if (load_nesting == 0) {
 		if (mq_override) {
 			memdelete(mq_override);
@@ -464,6 +473,8 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 			if (p_cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
 				Ref<Resource> existing = ResourceCache::get_ref(local_path);
 				if (existing.is_valid()) {
+					ResourceCache::retain(existing, load_task.remapped_path);
+
 					//referencing is fine
 					load_task.resource = existing;
 					load_task.status = THREAD_LOAD_LOADED;
@@ -490,7 +501,10 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 		if (run_on_current_thread) {
 			load_task_ptr->thread_id = Thread::get_caller_id();
 		} else {
-			load_task_ptr->task_id = WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoader::_thread_load_function, load_task_ptr);
+			// Dependencies of a distributed load are awaited by it right away. Run them on the pool threads, which
+			// keep solving tasks while waiting, instead of spawning a low priority thread for every dependency.
+			bool high_priority = p_thread_mode == LOAD_THREAD_DISTRIBUTE && is_within_load();
+			load_task_ptr->task_id = WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoader::_thread_load_function, load_task_ptr, high_priority);
 		}
 	}
 
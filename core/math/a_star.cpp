@@ -57,10 +57,13 @@ void AStar3D::add_point(int64_t p_id, const Vector3 &p_pos, real_t p_weight_scal
 		pt->id = p_id;
 		pt->pos = p_pos;
 		pt->weight_scale = p_weight_scale;
-		pt->prev_point = nullptr;
-		pt->open_pass = 0;
-		pt->closed_pass = 0;
 		pt->enabled = true;
+		if (free_point_indices.is_empty()) {
+			pt->index = point_index_count++;
+		} else {
+			pt->index = free_point_indices[free_point_indices.size() - 1];
+			free_point_indices.remove_at(free_point_indices.size() - 1);
+		}
 		points.set(p_id, pt);
 	} else {
 		found_pt->pos = p_pos;
@@ -122,6 +125,7 @@ void AStar3D::remove_point(int64_t p_id) {
 		(*it.value)->unlinked_neighbours.remove(p->id);
 	}
 
+	free_point_indices.push_back(p->index);
 	memdelete(p);
 	points.remove(p_id);
 	last_free_id = p_id;
@@ -248,6 +252,8 @@ void AStar3D::clear() {
 	}
 	segments.clear();
 	points.clear();
+	point_index_count = 0;
+	free_point_indices.clear();
 }
 
 int64_t AStar3D::get_point_count() const {
@@ -318,8 +324,33 @@ Vector3 AStar3D::get_closest_position_in_segment(const Vector3 &p_point) const {
 	return closest_point;
 }
 
-bool AStar3D::_solve(Point *begin_point, Point *end_point) {
-	pass++;
+AStar3D::SearchState *AStar3D::_acquire_search_state() {
+	SearchState *state = nullptr;
+	{
+		MutexLock lock(search_states_mutex);
+		if (!search_states.is_empty()) {
+			state = search_states[search_states.size() - 1];
+			search_states.remove_at(search_states.size() - 1);
+		}
+	}
+	if (!state) {
+		state = memnew(SearchState);
+	}
+
+	// Slots added since the state was last used start with a zero pass, so they read as unvisited.
+	if (state->states.size() < point_index_count) {
+		state->states.resize(point_index_count);
+	}
+	return state;
+}
+
+void AStar3D::_release_search_state(SearchState *p_state) {
+	MutexLock lock(search_states_mutex);
+	search_states.push_back(p_state);
+}
+
+bool AStar3D::_solve(Point *begin_point, Point *end_point, AStar3D::SearchState &r_state) {
+	r_state.pass++;
 
 	if (!end_point->enabled) {
 		return false;
@@ -327,53 +358,54 @@ bool AStar3D::_solve(Point *begin_point, Point *end_point) {
 
 	bool found_route = false;
 
-	LocalVector<Point *> open_list;
-	SortArray<Point *, SortPoints> sorter;
+	const uint64_t pass = r_state.pass;
+	AStar3D::SearchState::PointState *states = r_state.states.ptr();
+	LocalVector<AStar3D::SearchState::OpenEntry> &open_list = r_state.open_list;
+	SortArray<AStar3D::SearchState::OpenEntry, AStar3D::SortOpenEntries> sorter;
 
-	begin_point->g_score = 0;
-	begin_point->f_score = _estimate_cost(begin_point->id, end_point->id);
-	open_list.push_back(begin_point);
+	open_list.clear();
+	states[begin_point->index].g_score = 0;
+	states[begin_point->index].open_pass = pass;
+	open_list.push_back({ begin_point, _estimate_cost(begin_point->id, end_point->id), 0 });
 
 	while (!open_list.is_empty()) {
-		Point *p = open_list[0]; // The currently processed point.
+		Point *p = open_list[0].point; // The currently processed point.
+		AStar3D::SearchState::PointState &p_state = states[p->index];
+
+		sorter.pop_heap(0, open_list.size(), open_list.ptr()); // Remove the current point from the open list.
+		open_list.remove_at(open_list.size() - 1);
+
+		if (p_state.closed_pass == pass) {
+			continue; // Outdated entry, the point was already reached with a lower cost.
+		}
 
 		if (p == end_point) {
 			found_route = true;
 			break;
 		}
 
-		sorter.pop_heap(0, open_list.size(), open_list.ptr()); // Remove the current point from the open list.
-		open_list.remove_at(open_list.size() - 1);
-		p->closed_pass = pass; // Mark the point as closed.
+		p_state.closed_pass = pass; // Mark the point as closed.
 
 		for (OAHashMap<int64_t, Point *>::Iterator it = p->neighbors.iter(); it.valid; it = p->neighbors.next_iter(it)) {
 			Point *e = *(it.value); // The neighbor point.
+			AStar3D::SearchState::PointState &e_state = states[e->index];
 
-			if (!e->enabled || e->closed_pass == pass) {
+			if (!e->enabled || e_state.closed_pass == pass) {
 				continue;
 			}
 
-			real_t tentative_g_score = p->g_score + _compute_cost(p->id, e->id) * e->weight_scale;
+			real_t tentative_g_score = p_state.g_score + _compute_cost(p->id, e->id) * e->weight_scale;
 
-			bool new_point = false;
-
-			if (e->open_pass != pass) { // The point wasn't inside the open list.
-				e->open_pass = pass;
-				open_list.push_back(e);
-				new_point = true;
-			} else if (tentative_g_score >= e->g_score) { // The new path is worse than the previous.
+			if (e_state.open_pass == pass && tentative_g_score >= e_state.g_score) { // The new path is worse than the previous.
 				continue;
 			}
 
-			e->prev_point = p;
-			e->g_score = tentative_g_score;
-			e->f_score = e->g_score + _estimate_cost(e->id, end_point->id);
+			e_state.open_pass = pass;
+			e_state.prev_point = p;
+			e_state.g_score = tentative_g_score;
 
-			if (new_point) { // The position of the new points is already known.
-				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptr());
-			} else {
-				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptr());
-			}
+			open_list.push_back({ e, tentative_g_score + _estimate_cost(e->id, end_point->id), tentative_g_score });
+			sorter.push_heap(0, open_list.size() - 1, 0, open_list[open_list.size() - 1], open_list.ptr());
 		}
 	}
 
@@ -432,16 +464,19 @@ Vector<Vector3> AStar3D::get_point_path(int64_t p_from_id, int64_t p_to_id) {
 	Point *begin_point = a;
 	Point *end_point = b;
 
-	bool found_route = _solve(begin_point, end_point);
+	AStar3D::SearchState *state = _acquire_search_state();
+	bool found_route = _solve(begin_point, end_point, *state);
 	if (!found_route) {
+		_release_search_state(state);
 		return Vector<Vector3>();
 	}
+	const AStar3D::SearchState::PointState *states = state->states.ptr();
 
 	Point *p = end_point;
 	int64_t pc = 1; // Begin point
 	while (p != begin_point) {
 		pc++;
-		p = p->prev_point;
+		p = states[p->index].prev_point;
 	}
 
 	Vector<Vector3> path;
@@ -454,12 +489,13 @@ Vector<Vector3> AStar3D::get_point_path(int64_t p_from_id, int64_t p_to_id) {
 		int64_t idx = pc - 1;
 		while (p2 != begin_point) {
 			w[idx--] = p2->pos;
-			p2 = p2->prev_point;
+			p2 = states[p2->index].prev_point;
 		}
 
 		w[0] = p2->pos; // Assign first
 	}
 
+	_release_search_state(state);
 	return path;
 }
 
@@ -481,16 +517,19 @@ Vector<int64_t> AStar3D::get_id_path(int64_t p_from_id, int64_t p_to_id) {
 	Point *begin_point = a;
 	Point *end_point = b;
 
-	bool found_route = _solve(begin_point, end_point);
+	AStar3D::SearchState *state = _acquire_search_state();
+	bool found_route = _solve(begin_point, end_point, *state);
 	if (!found_route) {
+		_release_search_state(state);
 		return Vector<int64_t>();
 	}
+	const AStar3D::SearchState::PointState *states = state->states.ptr();
 
 	Point *p = end_point;
 	int64_t pc = 1; // Begin point
 	while (p != begin_point) {
 		pc++;
-		p = p->prev_point;
+		p = states[p->index].prev_point;
 	}
 
 	Vector<int64_t> path;
@@ -503,12 +542,13 @@ Vector<int64_t> AStar3D::get_id_path(int64_t p_from_id, int64_t p_to_id) {
 		int64_t idx = pc - 1;
 		while (p != begin_point) {
 			w[idx--] = p->id;
-			p = p->prev_point;
+			p = states[p->index].prev_point;
 		}
 
 		w[0] = p->id; // Assign first
 	}
 
+	_release_search_state(state);
 	return path;
 }
 
@@ -564,6 +604,9 @@ void AStar3D::_bind_methods() {
 
 AStar3D::~AStar3D() {
 	clear();
+	for (SearchState *state : search_states) {
+		memdelete(state);
+	}
 }
 
 /////////////////////////////////////////////////////////////
@@ -705,16 +748,19 @@ Vector<Vector2> AStar2D::get_point_path(int64_t p_from_id, int64_t p_to_id) {
 	AStar3D::Point *begin_point = a;
 	AStar3D::Point *end_point = b;
 
-	bool found_route = _solve(begin_point, end_point);
+	AStar3D::SearchState *state = astar._acquire_search_state();
+	bool found_route = _solve(begin_point, end_point, *state);
 	if (!found_route) {
+		astar._release_search_state(state);
 		return Vector<Vector2>();
 	}
+	const AStar3D::SearchState::PointState *states = state->states.ptr();
 
 	AStar3D::Point *p = end_point;
 	int64_t pc = 1; // Begin point
 	while (p != begin_point) {
 		pc++;
-		p = p->prev_point;
+		p = states[p->index].prev_point;
 	}
 
 	Vector<Vector2> path;
@@ -727,12 +773,13 @@ Vector<Vector2> AStar2D::get_point_path(int64_t p_from_id, int64_t p_to_id) {
 		int64_t idx = pc - 1;
 		while (p2 != begin_point) {
 			w[idx--] = Vector2(p2->pos.x, p2->pos.y);
-			p2 = p2->prev_point;
+			p2 = states[p2->index].prev_point;
 		}
 
 		w[0] = Vector2(p2->pos.x, p2->pos.y); // Assign first
 	}
 
+	astar._release_search_state(state);
 	return path;
 }
 
@@ -754,16 +801,19 @@ Vector<int64_t> AStar2D::get_id_path(int64_t p_from_id, int64_t p_to_id) {
 	AStar3D::Point *begin_point = a;
 	AStar3D::Point *end_point = b;
 
-	bool found_route = _solve(begin_point, end_point);
+	AStar3D::SearchState *state = astar._acquire_search_state();
+	bool found_route = _solve(begin_point, end_point, *state);
 	if (!found_route) {
+		astar._release_search_state(state);
 		return Vector<int64_t>();
 	}
+	const AStar3D::SearchState::PointState *states = state->states.ptr();
 
 	AStar3D::Point *p = end_point;
 	int64_t pc = 1; // Begin point
 	while (p != begin_point) {
 		pc++;
-		p = p->prev_point;
+		p = states[p->index].prev_point;
 	}
 
 	Vector<int64_t> path;
@@ -776,17 +826,18 @@ Vector<int64_t> AStar2D::get_id_path(int64_t p_from_id, int64_t p_to_id) {
 		int64_t idx = pc - 1;
 		while (p != begin_point) {
 			w[idx--] = p->id;
-			p = p->prev_point;
+			p = states[p->index].prev_point;
 		}
 
 		w[0] = p->id; // Assign first
 	}
 
+	astar._release_search_state(state);
 	return path;
 }
 
-bool AStar2D::_solve(AStar3D::Point *begin_point, AStar3D::Point *end_point) {
-	astar.pass++;
+bool AStar2D::_solve(AStar3D::Point *begin_point, AStar3D::Point *end_point, AStar3D::SearchState &r_state) {
+	r_state.pass++;
 
 	if (!end_point->enabled) {
 		return false;
@@ -794,53 +845,54 @@ bool AStar2D::_solve(AStar3D::Point *begin_point, AStar3D::Point *end_point) {
 
 	bool found_route = false;
 
-	LocalVector<AStar3D::Point *> open_list;
-	SortArray<AStar3D::Point *, AStar3D::SortPoints> sorter;
+	const uint64_t pass = r_state.pass;
+	AStar3D::SearchState::PointState *states = r_state.states.ptr();
+	LocalVector<AStar3D::SearchState::OpenEntry> &open_list = r_state.open_list;
+	SortArray<AStar3D::SearchState::OpenEntry, AStar3D::SortOpenEntries> sorter;
 
-	begin_point->g_score = 0;
-	begin_point->f_score = _estimate_cost(begin_point->id, end_point->id);
-	open_list.push_back(begin_point);
+	open_list.clear();
+	states[begin_point->index].g_score = 0;
+	states[begin_point->index].open_pass = pass;
+	open_list.push_back({ begin_point, _estimate_cost(begin_point->id, end_point->id), 0 });
 
 	while (!open_list.is_empty()) {
-		AStar3D::Point *p = open_list[0]; // The currently processed point.
+		AStar3D::Point *p = open_list[0].point; // The currently processed point.
+		AStar3D::SearchState::PointState &p_state = states[p->index];
+
+		sorter.pop_heap(0, open_list.size(), open_list.ptr()); // Remove the current point from the open list.
+		open_list.remove_at(open_list.size() - 1);
+
+		if (p_state.closed_pass == pass) {
+			continue; // Outdated entry, the point was already reached with a lower cost.
+		}
 
 		if (p == end_point) {
 			found_route = true;
 			break;
 		}
 
-		sorter.pop_heap(0, open_list.size(), open_list.ptr()); // Remove the current point from the open list.
-		open_list.remove_at(open_list.size() - 1);
-		p->closed_pass = astar.pass; // Mark the point as closed.
+		p_state.closed_pass = pass; // Mark the point as closed.
 
 		for (OAHashMap<int64_t, AStar3D::Point *>::Iterator it = p->neighbors.iter(); it.valid; it = p->neighbors.next_iter(it)) {
 			AStar3D::Point *e = *(it.value); // The neighbor point.
+			AStar3D::SearchState::PointState &e_state = states[e->index];
 
-			if (!e->enabled || e->closed_pass == astar.pass) {
+			if (!e->enabled || e_state.closed_pass == pass) {
 				continue;
 			}
 
-			real_t tentative_g_score = p->g_score + _compute_cost(p->id, e->id) * e->weight_scale;
-
-			bool new_point = false;
+			real_t tentative_g_score = p_state.g_score + _compute_cost(p->id, e->id) * e->weight_scale;
 
-			if (e->open_pass != astar.pass) { // The point wasn't inside the open list.
-				e->open_pass = astar.pass;
-				open_list.push_back(e);
-				new_point = true;
-			} else if (tentative_g_score >= e->g_score) { // The new path is worse than the previous.
+			if (e_state.open_pass == pass && tentative_g_score >= e_state.g_score) { // The new path is worse than the previous.
 				continue;
 			}
 
-			e->prev_point = p;
-			e->g_score = tentative_g_score;
-			e->f_score = e->g_score + _estimate_cost(e->id, end_point->id);
+			e_state.open_pass = pass;
+			e_state.prev_point = p;
+			e_state.g_score = tentative_g_score;
 
-			if (new_point) { // The position of the new points is already known.
-				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptr());
-			} else {
-				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptr());
-			}
+			open_list.push_back({ e, tentative_g_score + _estimate_cost(e->id, end_point->id), tentative_g_score });
+			sorter.push_heap(0, open_list.size() - 1, 0, open_list[open_list.size() - 1], open_list.ptr());
 		}
 	}
 
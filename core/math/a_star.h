@@ -33,6 +33,8 @@
 
 #include "core/object/gdvirtual.gen.inc"
 #include "core/object/ref_counted.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/oa_hash_map.h"
 
 /**
@@ -54,22 +56,38 @@ class AStar3D : public RefCounted {
 		OAHashMap<int64_t, Point *> neighbors = 4u;
 		OAHashMap<int64_t, Point *> unlinked_neighbours = 4u;
 
-		// Used for pathfinding.
-		Point *prev_point = nullptr;
-		real_t g_score = 0;
-		real_t f_score = 0;
-		uint64_t open_pass = 0;
-		uint64_t closed_pass = 0;
+		uint32_t index = 0; // Slot of this point in the search state.
 	};
 
-	struct SortPoints {
-		_FORCE_INLINE_ bool operator()(const Point *A, const Point *B) const { // Returns true when the Point A is worse than Point B.
-			if (A->f_score > B->f_score) {
+	// Per-query pathfinding data, kept out of the points so several threads can search the same graph.
+	struct SearchState {
+		struct PointState {
+			Point *prev_point = nullptr;
+			real_t g_score = 0;
+			uint64_t open_pass = 0;
+			uint64_t closed_pass = 0;
+		};
+
+		// Scores are copied into the entry, so a point reached again with a lower cost is pushed anew instead of searched for.
+		struct OpenEntry {
+			Point *point = nullptr;
+			real_t f_score = 0;
+			real_t g_score = 0;
+		};
+
+		LocalVector<PointState> states; // Indexed by Point::index.
+		LocalVector<OpenEntry> open_list;
+		uint64_t pass = 0;
+	};
+
+	struct SortOpenEntries {
+		_FORCE_INLINE_ bool operator()(const SearchState::OpenEntry &A, const SearchState::OpenEntry &B) const { // Returns true when the entry A is worse than entry B.
+			if (A.f_score > B.f_score) {
 				return true;
-			} else if (A->f_score < B->f_score) {
+			} else if (A.f_score < B.f_score) {
 				return false;
 			} else {
-				return A->g_score < B->g_score; // If the f_costs are the same then prioritize the points that are further away from the start.
+				return A.g_score < B.g_score; // If the f_costs are the same then prioritize the points that are further away from the start.
 			}
 		}
 	};
@@ -105,12 +123,20 @@ class AStar3D : public RefCounted {
 	};
 
 	int64_t last_free_id = 0;
-	uint64_t pass = 1;
 
 	OAHashMap<int64_t, Point *> points;
 	HashSet<Segment, Segment> segments;
 
-	bool _solve(Point *begin_point, Point *end_point);
+	uint32_t point_index_count = 0;
+	LocalVector<uint32_t> free_point_indices;
+
+	Mutex search_states_mutex;
+	LocalVector<SearchState *> search_states; // Idle states, reused by the next queries.
+
+	SearchState *_acquire_search_state();
+	void _release_search_state(SearchState *p_state);
+
+	bool _solve(Point *begin_point, Point *end_point, SearchState &r_state);
 
 protected:
 	static void _bind_methods();
@@ -160,7 +186,7 @@ class AStar2D : public RefCounted {
 	GDCLASS(AStar2D, RefCounted);
 	AStar3D astar;
 
-	bool _solve(AStar3D::Point *begin_point, AStar3D::Point *end_point);
+	bool _solve(AStar3D::Point *begin_point, AStar3D::Point *end_point, AStar3D::SearchState &r_state);
 
 protected:
 	static void _bind_methods();
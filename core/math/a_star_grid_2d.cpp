@@ -30,6 +30,7 @@
 
 #include "a_star_grid_2d.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/variant/typed_array.h"
 
 #define GET_POINT_UNCHECKED(m_id) points[m_id.y - region.position.y][m_id.x - region.position.x]
@@ -119,6 +120,10 @@ void AStarGrid2D::update() {
 		}
 		points.push_back(line);
 	}
+	solid_mask.resize((int64_t(region.size.width) * region.size.height + 63) / 64);
+	for (uint64_t &bits : solid_mask) {
+		bits = 0;
+	}
 	dirty = false;
 }
 
@@ -172,13 +177,13 @@ AStarGrid2D::Heuristic AStarGrid2D::get_default_estimate_heuristic() const {
 void AStarGrid2D::set_point_solid(const Vector2i &p_id, bool p_solid) {
 	ERR_FAIL_COND_MSG(dirty, "Grid is not initialized. Call the update method.");
 	ERR_FAIL_COND_MSG(!is_in_boundsv(p_id), vformat("Can't set if point is disabled. Point %s out of bounds %s.", p_id, region));
-	GET_POINT_UNCHECKED(p_id).solid = p_solid;
+	_set_solid_unchecked(p_id.x, p_id.y, p_solid);
 }
 
 bool AStarGrid2D::is_point_solid(const Vector2i &p_id) const {
 	ERR_FAIL_COND_V_MSG(dirty, false, "Grid is not initialized. Call the update method.");
 	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_id), false, vformat("Can't get if point is disabled. Point %s out of bounds %s.", p_id, region));
-	return GET_POINT_UNCHECKED(p_id).solid;
+	return _is_solid_unchecked(p_id.x, p_id.y);
 }
 
 void AStarGrid2D::set_point_weight_scale(const Vector2i &p_id, real_t p_weight_scale) {
@@ -205,7 +210,7 @@ void AStarGrid2D::fill_solid_region(const Rect2i &p_region, bool p_solid) {
 
 	for (int x = from_x; x < end_x; x++) {
 		for (int y = from_y; y < end_y; y++) {
-			GET_POINT_UNCHECKED(Vector2i(x, y)).solid = p_solid;
+			_set_solid_unchecked(x, y, p_solid);
 		}
 	}
 }
@@ -226,11 +231,11 @@ void AStarGrid2D::fill_weight_scale_region(const Rect2i &p_region, real_t p_weig
 	}
 }
 
-AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to) {
-	if (!p_to || p_to->solid) {
+AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to, const Point *p_end) {
+	if (!p_to || _is_solid(p_to)) {
 		return nullptr;
 	}
-	if (p_to == end) {
+	if (p_to == p_end) {
 		return p_to;
 	}
 
@@ -248,10 +253,10 @@ AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to) {
 			if ((_is_walkable(to_x - dx, to_y + dy) && !_is_walkable(to_x - dx, to_y)) || (_is_walkable(to_x + dx, to_y - dy) && !_is_walkable(to_x, to_y - dy))) {
 				return p_to;
 			}
-			if (_jump(p_to, _get_point(to_x + dx, to_y)) != nullptr) {
+			if (_jump(p_to, _get_point(to_x + dx, to_y), p_end) != nullptr) {
 				return p_to;
 			}
-			if (_jump(p_to, _get_point(to_x, to_y + dy)) != nullptr) {
+			if (_jump(p_to, _get_point(to_x, to_y + dy), p_end) != nullptr) {
 				return p_to;
 			}
 		} else {
@@ -266,17 +271,17 @@ AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to) {
 			}
 		}
 		if (_is_walkable(to_x + dx, to_y + dy) && (diagonal_mode == DIAGONAL_MODE_ALWAYS || (_is_walkable(to_x + dx, to_y) || _is_walkable(to_x, to_y + dy)))) {
-			return _jump(p_to, _get_point(to_x + dx, to_y + dy));
+			return _jump(p_to, _get_point(to_x + dx, to_y + dy), p_end);
 		}
 	} else if (diagonal_mode == DIAGONAL_MODE_ONLY_IF_NO_OBSTACLES) {
 		if (dx != 0 && dy != 0) {
 			if ((_is_walkable(to_x + dx, to_y + dy) && !_is_walkable(to_x, to_y + dy)) || !_is_walkable(to_x + dx, to_y)) {
 				return p_to;
 			}
-			if (_jump(p_to, _get_point(to_x + dx, to_y)) != nullptr) {
+			if (_jump(p_to, _get_point(to_x + dx, to_y), p_end) != nullptr) {
 				return p_to;
 			}
-			if (_jump(p_to, _get_point(to_x, to_y + dy)) != nullptr) {
+			if (_jump(p_to, _get_point(to_x, to_y + dy), p_end) != nullptr) {
 				return p_to;
 			}
 		} else {
@@ -291,7 +296,7 @@ AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to) {
 			}
 		}
 		if (_is_walkable(to_x + dx, to_y + dy) && _is_walkable(to_x + dx, to_y) && _is_walkable(to_x, to_y + dy)) {
-			return _jump(p_to, _get_point(to_x + dx, to_y + dy));
+			return _jump(p_to, _get_point(to_x + dx, to_y + dy), p_end);
 		}
 	} else { // DIAGONAL_MODE_NEVER
 		if (dx != 0) {
@@ -302,14 +307,14 @@ AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to) {
 			if ((_is_walkable(to_x - 1, to_y) && !_is_walkable(to_x - 1, to_y - dy)) || (_is_walkable(to_x + 1, to_y) && !_is_walkable(to_x + 1, to_y - dy))) {
 				return p_to;
 			}
-			if (_jump(p_to, _get_point(to_x + 1, to_y)) != nullptr) {
+			if (_jump(p_to, _get_point(to_x + 1, to_y), p_end) != nullptr) {
 				return p_to;
 			}
-			if (_jump(p_to, _get_point(to_x - 1, to_y)) != nullptr) {
+			if (_jump(p_to, _get_point(to_x - 1, to_y), p_end) != nullptr) {
 				return p_to;
 			}
 		}
-		return _jump(p_to, _get_point(to_x + dx, to_y + dy));
+		return _jump(p_to, _get_point(to_x + dx, to_y + dy), p_end);
 	}
 	return nullptr;
 }
@@ -362,19 +367,19 @@ void AStarGrid2D::_get_nbors(Point *p_point, LocalVector<Point *> &r_nbors) {
 		}
 	}
 
-	if (top && !top->solid) {
+	if (top && !_is_solid(top)) {
 		r_nbors.push_back(top);
 		ts0 = true;
 	}
-	if (right && !right->solid) {
+	if (right && !_is_solid(right)) {
 		r_nbors.push_back(right);
 		ts1 = true;
 	}
-	if (bottom && !bottom->solid) {
+	if (bottom && !_is_solid(bottom)) {
 		r_nbors.push_back(bottom);
 		ts2 = true;
 	}
-	if (left && !left->solid) {
+	if (left && !_is_solid(left)) {
 		r_nbors.push_back(left);
 		ts3 = true;
 	}
@@ -404,16 +409,16 @@ void AStarGrid2D::_get_nbors(Point *p_point, LocalVector<Point *> &r_nbors) {
 			break;
 	}
 
-	if (td0 && (top_left && !top_left->solid)) {
+	if (td0 && (top_left && !_is_solid(top_left))) {
 		r_nbors.push_back(top_left);
 	}
-	if (td1 && (top_right && !top_right->solid)) {
+	if (td1 && (top_right && !_is_solid(top_right))) {
 		r_nbors.push_back(top_right);
 	}
-	if (td2 && (bottom_right && !bottom_right->solid)) {
+	if (td2 && (bottom_right && !_is_solid(bottom_right))) {
 		r_nbors.push_back(bottom_right);
 	}
-	if (td3 && (bottom_left && !bottom_left->solid)) {
+	if (td3 && (bottom_left && !_is_solid(bottom_left))) {
 		r_nbors.push_back(bottom_left);
 	}
 }
@@ -421,7 +426,7 @@ void AStarGrid2D::_get_nbors(Point *p_point, LocalVector<Point *> &r_nbors) {
 bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point) {
 	pass++;
 
-	if (p_end_point->solid) {
+	if (_is_solid(p_end_point)) {
 		return false;
 	}
 
@@ -433,7 +438,6 @@ bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point) {
 	p_begin_point->g_score = 0;
 	p_begin_point->f_score = _estimate_cost(p_begin_point->id, p_end_point->id);
 	open_list.push_back(p_begin_point);
-	end = p_end_point;
 
 	while (!open_list.is_empty()) {
 		Point *p = open_list[0]; // The currently processed point.
@@ -455,12 +459,12 @@ bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point) {
 
 			if (jumping_enabled) {
 				// TODO: Make it works with weight_scale.
-				e = _jump(p, e);
+				e = _jump(p, e, p_end_point);
 				if (!e || e->closed_pass == pass) {
 					continue;
 				}
 			} else {
-				if (e->solid || e->closed_pass == pass) {
+				if (_is_solid(e) || e->closed_pass == pass) {
 					continue;
 				}
 				weight_scale = e->weight_scale;
@@ -510,6 +514,7 @@ real_t AStarGrid2D::_compute_cost(const Vector2i &p_from_id, const Vector2i &p_t
 
 void AStarGrid2D::clear() {
 	points.clear();
+	solid_mask.clear();
 	region = Rect2i();
 }
 
@@ -613,6 +618,165 @@ TypedArray<Vector2i> AStarGrid2D::get_id_path(const Vector2i &p_from_id, const V
 	return path;
 }
 
+bool AStarGrid2D::_solve_query(Point *p_begin_point, Point *p_end_point, QueryState &r_state) {
+	// Same search as _solve(), with the state of the points kept apart so queries can run at the same time.
+	r_state.pass++;
+
+	if (_is_solid(p_end_point)) {
+		return false;
+	}
+
+	LocalVector<uint32_t> open_list;
+	SortArray<uint32_t, SortQueryPoints> sorter;
+	sorter.compare.state = &r_state;
+
+	const uint32_t begin_index = _get_point_index(p_begin_point->id.x, p_begin_point->id.y);
+	const uint32_t end_index = _get_point_index(p_end_point->id.x, p_end_point->id.y);
+	r_state.g_score[begin_index] = 0;
+	r_state.f_score[begin_index] = _estimate_cost(p_begin_point->id, p_end_point->id);
+	r_state.visit_pass[begin_index] = r_state.pass * 2;
+	open_list.push_back(begin_index);
+
+	LocalVector<Point *> nbors;
+	while (!open_list.is_empty()) {
+		const uint32_t p_index = open_list[0];
+		if (p_index == end_index) {
+			return true;
+		}
+
+		sorter.pop_heap(0, open_list.size(), open_list.ptr());
+		open_list.remove_at(open_list.size() - 1);
+		r_state.visit_pass[p_index] = r_state.pass * 2 + 1;
+
+		const Vector2i p_id = Vector2i(region.position.x + p_index % region.size.width, region.position.y + p_index / region.size.width);
+		Point *p = _get_point_unchecked(p_id.x, p_id.y);
+
+		nbors.clear();
+		_get_nbors(p, nbors);
+
+		for (Point *e : nbors) {
+			real_t weight_scale = 1.0;
+
+			if (jumping_enabled) {
+				e = _jump(p, e, p_end_point);
+				if (!e) {
+					continue;
+				}
+			} else {
+				if (_is_solid(e)) {
+					continue;
+				}
+				weight_scale = e->weight_scale;
+			}
+
+			const uint32_t e_index = _get_point_index(e->id.x, e->id.y);
+			if (r_state.visit_pass[e_index] == r_state.pass * 2 + 1) {
+				continue;
+			}
+
+			real_t tentative_g_score = r_state.g_score[p_index] + _compute_cost(p->id, e->id) * weight_scale;
+			bool new_point = false;
+
+			if (r_state.visit_pass[e_index] != r_state.pass * 2) {
+				r_state.visit_pass[e_index] = r_state.pass * 2;
+				open_list.push_back(e_index);
+				new_point = true;
+			} else if (tentative_g_score >= r_state.g_score[e_index]) {
+				continue;
+			}
+
+			r_state.prev_point[e_index] = p_index;
+			r_state.g_score[e_index] = tentative_g_score;
+			r_state.f_score[e_index] = tentative_g_score + _estimate_cost(e->id, p_end_point->id);
+
+			if (new_point) {
+				sorter.push_heap(0, open_list.size() - 1, 0, e_index, open_list.ptr());
+			} else {
+				sorter.push_heap(0, open_list.find(e_index), 0, e_index, open_list.ptr());
+			}
+		}
+	}
+
+	return false;
+}
+
+Vector<Vector2i> AStarGrid2D::_get_query_id_path(const Vector2i &p_from_id, const Vector2i &p_to_id, QueryState &r_state) {
+	Vector<Vector2i> path;
+	if (!is_in_boundsv(p_from_id) || !is_in_boundsv(p_to_id)) {
+		return path;
+	}
+	if (p_from_id == p_to_id) {
+		path.push_back(p_from_id);
+		return path;
+	}
+
+	if (!_solve_query(_get_point_unchecked(p_from_id.x, p_from_id.y), _get_point_unchecked(p_to_id.x, p_to_id.y), r_state)) {
+		return path;
+	}
+
+	const uint32_t begin_index = _get_point_index(p_from_id.x, p_from_id.y);
+	uint32_t index = _get_point_index(p_to_id.x, p_to_id.y);
+	while (index != begin_index) {
+		path.push_back(Vector2i(region.position.x + index % region.size.width, region.position.y + index / region.size.width));
+		index = r_state.prev_point[index];
+	}
+	path.push_back(p_from_id);
+	path.reverse();
+	return path;
+}
+
+void AStarGrid2D::_solve_query_batch(uint32_t p_batch, PathQueries *p_queries) {
+	// Every batch reuses one search state for its share of the queries.
+	const uint32_t point_count = region.size.width * region.size.height;
+	QueryState state;
+	state.prev_point.resize(point_count);
+	state.g_score.resize(point_count);
+	state.f_score.resize(point_count);
+	state.visit_pass.resize(point_count);
+	for (uint32_t i = 0; i < point_count; i++) {
+		state.visit_pass[i] = 0;
+	}
+
+	for (uint32_t i = p_batch; i < p_queries->from_ids.size(); i += p_queries->batches) {
+		p_queries->paths[i] = _get_query_id_path(p_queries->from_ids[i], p_queries->to_ids[i], state);
+	}
+}
+
+TypedArray<Array> AStarGrid2D::get_id_paths(const TypedArray<Vector2i> &p_from_ids, const TypedArray<Vector2i> &p_to_ids) {
+	ERR_FAIL_COND_V_MSG(dirty, TypedArray<Array>(), "Grid is not initialized. Call the update method.");
+	ERR_FAIL_COND_V_MSG(p_from_ids.size() != p_to_ids.size(), TypedArray<Array>(), "The from and to id arrays need to have the same size.");
+
+	PathQueries queries;
+	queries.from_ids.resize(p_from_ids.size());
+	queries.to_ids.resize(p_to_ids.size());
+	queries.paths.resize(p_from_ids.size());
+	for (int i = 0; i < p_from_ids.size(); i++) {
+		queries.from_ids[i] = p_from_ids[i];
+		queries.to_ids[i] = p_to_ids[i];
+	}
+
+	// Scripted costs can't be called from other threads.
+	if (GDVIRTUAL_IS_OVERRIDDEN(_estimate_cost) || GDVIRTUAL_IS_OVERRIDDEN(_compute_cost) || queries.from_ids.size() < 2) {
+		_solve_query_batch(0, &queries);
+	} else {
+		queries.batches = MIN(queries.from_ids.size(), (uint32_t)WorkerThreadPool::get_singleton()->get_thread_count());
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &AStarGrid2D::_solve_query_batch, &queries, queries.batches, -1, true, SNAME("AStarGrid2DPathQueries"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
+	TypedArray<Array> paths;
+	paths.resize(queries.paths.size());
+	for (uint32_t i = 0; i < queries.paths.size(); i++) {
+		TypedArray<Vector2i> path;
+		path.resize(queries.paths[i].size());
+		for (int j = 0; j < queries.paths[i].size(); j++) {
+			path[j] = queries.paths[i][j];
+		}
+		paths[i] = path;
+	}
+	return paths;
+}
+
 void AStarGrid2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_region", "region"), &AStarGrid2D::set_region);
 	ClassDB::bind_method(D_METHOD("get_region"), &AStarGrid2D::get_region);
@@ -645,6 +809,7 @@ void AStarGrid2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_point_position", "id"), &AStarGrid2D::get_point_position);
 	ClassDB::bind_method(D_METHOD("get_point_path", "from_id", "to_id"), &AStarGrid2D::get_point_path);
 	ClassDB::bind_method(D_METHOD("get_id_path", "from_id", "to_id"), &AStarGrid2D::get_id_path);
+	ClassDB::bind_method(D_METHOD("get_id_paths", "from_ids", "to_ids"), &AStarGrid2D::get_id_paths);
 
 	GDVIRTUAL_BIND(_estimate_cost, "from_id", "to_id")
 	GDVIRTUAL_BIND(_compute_cost, "from_id", "to_id")
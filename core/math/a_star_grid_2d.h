@@ -70,7 +70,6 @@ private:
 	struct Point {
 		Vector2i id;
 
-		bool solid = false;
 		Vector2 pos;
 		real_t weight_scale = 1.0;
 
@@ -100,14 +99,67 @@ private:
 	};
 
 	LocalVector<LocalVector<Point>> points;
-	Point *end = nullptr;
+	// One bit per point, row by row, so walkability checks don't touch the points.
+	LocalVector<uint64_t> solid_mask;
 
 	uint64_t pass = 1;
 
+	// Search state of one query of get_id_paths(), indexed like `solid_mask`.
+	struct QueryState {
+		LocalVector<uint32_t> prev_point;
+		LocalVector<real_t> g_score;
+		LocalVector<real_t> f_score;
+		LocalVector<uint32_t> visit_pass; // `pass * 2` once opened, `pass * 2 + 1` once closed.
+		uint32_t pass = 0;
+	};
+
+	struct SortQueryPoints {
+		const QueryState *state = nullptr;
+
+		_FORCE_INLINE_ bool operator()(uint32_t A, uint32_t B) const { // Same order as SortPoints.
+			if (state->f_score[A] > state->f_score[B]) {
+				return true;
+			} else if (state->f_score[A] < state->f_score[B]) {
+				return false;
+			} else {
+				return state->g_score[A] < state->g_score[B];
+			}
+		}
+	};
+
+	struct PathQueries {
+		LocalVector<Vector2i> from_ids;
+		LocalVector<Vector2i> to_ids;
+		LocalVector<Vector<Vector2i>> paths;
+		uint32_t batches = 1;
+	};
+
 private: // Internal routines.
+	_FORCE_INLINE_ uint32_t _get_point_index(int64_t p_x, int64_t p_y) const {
+		return (p_y - region.position.y) * region.size.width + (p_x - region.position.x);
+	}
+
+	_FORCE_INLINE_ bool _is_solid_unchecked(int64_t p_x, int64_t p_y) const {
+		const uint32_t index = _get_point_index(p_x, p_y);
+		return solid_mask[index >> 6] & (uint64_t(1) << (index & 63));
+	}
+
+	_FORCE_INLINE_ bool _is_solid(const Point *p_point) const {
+		return _is_solid_unchecked(p_point->id.x, p_point->id.y);
+	}
+
+	_FORCE_INLINE_ void _set_solid_unchecked(int64_t p_x, int64_t p_y, bool p_solid) {
+		const uint32_t index = _get_point_index(p_x, p_y);
+		if (p_solid) {
+			solid_mask[index >> 6] |= uint64_t(1) << (index & 63);
+		} else {
+			solid_mask[index >> 6] &= ~(uint64_t(1) << (index & 63));
+		}
+	}
+
 	_FORCE_INLINE_ bool _is_walkable(int64_t p_x, int64_t p_y) const {
 		if (region.has_point(Vector2i(p_x, p_y))) {
-			return !points[p_y - region.position.y][p_x - region.position.x].solid;
+			return !_is_solid_unchecked(p_x, p_y);
 		}
 		return false;
 	}
@@ -124,8 +176,11 @@ private: // Internal routines.
 	}
 
 	void _get_nbors(Point *p_point, LocalVector<Point *> &r_nbors);
-	Point *_jump(Point *p_from, Point *p_to);
+	Point *_jump(Point *p_from, Point *p_to, const Point *p_end);
 	bool _solve(Point *p_begin_point, Point *p_end_point);
+	bool _solve_query(Point *p_begin_point, Point *p_end_point, QueryState &r_state);
+	Vector<Vector2i> _get_query_id_path(const Vector2i &p_from_id, const Vector2i &p_to_id, QueryState &r_state);
+	void _solve_query_batch(uint32_t p_batch, PathQueries *p_queries);
 
 protected:
 	static void _bind_methods();
@@ -184,6 +239,7 @@ public:
 	Vector2 get_point_position(const Vector2i &p_id) const;
 	Vector<Vector2> get_point_path(const Vector2i &p_from, const Vector2i &p_to);
 	TypedArray<Vector2i> get_id_path(const Vector2i &p_from, const Vector2i &p_to);
+	TypedArray<Array> get_id_paths(const TypedArray<Vector2i> &p_from_ids, const TypedArray<Vector2i> &p_to_ids);
 };
 
 VARIANT_ENUM_CAST(AStarGrid2D::DiagonalMode);
@@ -0,0 +1,102 @@
+/**************************************************************************/
+/*  batch_math.cpp                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "batch_math.h"
+
+void BatchMath::xform_points(const Transform3D &p_xform, const Vector3 *p_src, Vector3 *r_dst, uint32_t p_count) {
+#ifdef BATCH_MATH_SIMD
+	Vec4 columns[4];
+	_get_columns(p_xform, columns);
+	for (uint32_t i = 0; i < p_count; i++) {
+		_store3(r_dst[i].coord, _xform(columns, p_src[i].coord));
+	}
+#else
+	for (uint32_t i = 0; i < p_count; i++) {
+		r_dst[i] = p_xform.xform(p_src[i]);
+	}
+#endif
+}
+
+void BatchMath::xform_aabbs(const Transform3D &p_xform, const AABB *p_src, AABB *r_dst, uint32_t p_count) {
+#ifdef BATCH_MATH_SIMD
+	Vec4 columns[4];
+	_get_columns(p_xform, columns);
+	for (uint32_t i = 0; i < p_count; i++) {
+		_xform_aabb(columns, p_src[i], r_dst[i]);
+	}
+#else
+	for (uint32_t i = 0; i < p_count; i++) {
+		r_dst[i] = p_xform.xform(p_src[i]);
+	}
+#endif
+}
+
+void BatchMath::multiply_transforms(const Transform3D &p_a, const Transform3D *p_src, Transform3D *r_dst, uint32_t p_count) {
+#ifdef BATCH_MATH_SIMD
+	// The left hand side is the same for every element, so splat it once.
+	Vec4 columns[4];
+	_get_columns(p_a, columns);
+	Vec4 splats[9];
+	for (int i = 0; i < 9; i++) {
+		splats[i] = _splat(p_a.basis.rows[i / 3][i % 3]);
+	}
+	for (uint32_t i = 0; i < p_count; i++) {
+		const Basis &b = p_src[i].basis;
+		const Vec4 row0 = _multiply_row(splats[0], splats[1], splats[2], b);
+		const Vec4 row1 = _multiply_row(splats[3], splats[4], splats[5], b);
+		const Vec4 row2 = _multiply_row(splats[6], splats[7], splats[8], b);
+		const Vec4 origin = _xform(columns, p_src[i].origin.coord);
+		_store3(r_dst[i].basis.rows[0].coord, row0);
+		_store3(r_dst[i].basis.rows[1].coord, row1);
+		_store3(r_dst[i].basis.rows[2].coord, row2);
+		_store3(r_dst[i].origin.coord, origin);
+	}
+#else
+	for (uint32_t i = 0; i < p_count; i++) {
+		r_dst[i] = p_a * p_src[i];
+	}
+#endif
+}
+
+void BatchMath::multiply_transforms(const Transform3D *p_a, const Transform3D *p_b, Transform3D *r_dst, uint32_t p_count) {
+	for (uint32_t i = 0; i < p_count; i++) {
+		r_dst[i] = multiply(p_a[i], p_b[i]);
+	}
+}
+
+const char *BatchMath::get_backend_name() {
+#if defined(BATCH_MATH_SSE2)
+	return "SSE2";
+#elif defined(BATCH_MATH_NEON)
+	return "NEON";
+#else
+	return "Scalar";
+#endif
+}
@@ -0,0 +1,172 @@
+/**************************************************************************/
+/*  batch_math.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef BATCH_MATH_H
+#define BATCH_MATH_H
+
+#include "core/math/aabb.h"
+#include "core/math/transform_3d.h"
+
+// The vector kernels only handle single precision, double builds use the scalar operators.
+#ifndef REAL_T_IS_DOUBLE
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BATCH_MATH_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define BATCH_MATH_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
+#if defined(BATCH_MATH_SSE2) || defined(BATCH_MATH_NEON)
+#define BATCH_MATH_SIMD
+#endif
+
+// Transform kernels for loops that push many points, AABBs or transforms through the same math.
+// Results match the Transform3D operators (the operations happen in the same order),
+// and destinations may alias the sources.
+class BatchMath {
+#ifdef BATCH_MATH_SIMD
+#ifdef BATCH_MATH_SSE2
+	typedef __m128 Vec4;
+
+	static _FORCE_INLINE_ Vec4 _load3(const real_t *p_ptr) {
+		return _mm_movelh_ps(_mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)p_ptr), _mm_load_ss(p_ptr + 2));
+	}
+	static _FORCE_INLINE_ void _store3(real_t *r_ptr, Vec4 p_v) {
+		_mm_storel_pi((__m64 *)r_ptr, p_v);
+		_mm_store_ss(r_ptr + 2, _mm_movehl_ps(p_v, p_v));
+	}
+	static _FORCE_INLINE_ Vec4 _set3(real_t p_x, real_t p_y, real_t p_z) { return _mm_setr_ps(p_x, p_y, p_z, 0.0f); }
+	static _FORCE_INLINE_ Vec4 _splat(real_t p_v) { return _mm_set1_ps(p_v); }
+	static _FORCE_INLINE_ Vec4 _add(Vec4 p_a, Vec4 p_b) { return _mm_add_ps(p_a, p_b); }
+	static _FORCE_INLINE_ Vec4 _sub(Vec4 p_a, Vec4 p_b) { return _mm_sub_ps(p_a, p_b); }
+	static _FORCE_INLINE_ Vec4 _mul(Vec4 p_a, Vec4 p_b) { return _mm_mul_ps(p_a, p_b); }
+	static _FORCE_INLINE_ Vec4 _min(Vec4 p_a, Vec4 p_b) { return _mm_min_ps(p_a, p_b); }
+	static _FORCE_INLINE_ Vec4 _max(Vec4 p_a, Vec4 p_b) { return _mm_max_ps(p_a, p_b); }
+#else
+	typedef float32x4_t Vec4;
+
+	static _FORCE_INLINE_ Vec4 _load3(const real_t *p_ptr) {
+		return vcombine_f32(vld1_f32(p_ptr), vld1_lane_f32(p_ptr + 2, vdup_n_f32(0.0f), 0));
+	}
+	static _FORCE_INLINE_ void _store3(real_t *r_ptr, Vec4 p_v) {
+		vst1_f32(r_ptr, vget_low_f32(p_v));
+		vst1q_lane_f32(r_ptr + 2, p_v, 2);
+	}
+	static _FORCE_INLINE_ Vec4 _set3(real_t p_x, real_t p_y, real_t p_z) {
+		const float v[4] = { p_x, p_y, p_z, 0.0f };
+		return vld1q_f32(v);
+	}
+	static _FORCE_INLINE_ Vec4 _splat(real_t p_v) { return vdupq_n_f32(p_v); }
+	static _FORCE_INLINE_ Vec4 _add(Vec4 p_a, Vec4 p_b) { return vaddq_f32(p_a, p_b); }
+	static _FORCE_INLINE_ Vec4 _sub(Vec4 p_a, Vec4 p_b) { return vsubq_f32(p_a, p_b); }
+	static _FORCE_INLINE_ Vec4 _mul(Vec4 p_a, Vec4 p_b) { return vmulq_f32(p_a, p_b); }
+	static _FORCE_INLINE_ Vec4 _min(Vec4 p_a, Vec4 p_b) { return vminq_f32(p_a, p_b); }
+	static _FORCE_INLINE_ Vec4 _max(Vec4 p_a, Vec4 p_b) { return vmaxq_f32(p_a, p_b); }
+#endif
+
+	// Basis columns in 0-2, origin in 3.
+	static _FORCE_INLINE_ void _get_columns(const Transform3D &p_xform, Vec4 *r_columns) {
+		const Basis &b = p_xform.basis;
+		r_columns[0] = _set3(b.rows[0][0], b.rows[1][0], b.rows[2][0]);
+		r_columns[1] = _set3(b.rows[0][1], b.rows[1][1], b.rows[2][1]);
+		r_columns[2] = _set3(b.rows[0][2], b.rows[1][2], b.rows[2][2]);
+		r_columns[3] = _load3(p_xform.origin.coord);
+	}
+
+	static _FORCE_INLINE_ Vec4 _xform(const Vec4 *p_columns, const real_t *p_point) {
+		Vec4 r = _add(_mul(p_columns[0], _splat(p_point[0])), _mul(p_columns[1], _splat(p_point[1])));
+		return _add(_add(r, _mul(p_columns[2], _splat(p_point[2]))), p_columns[3]);
+	}
+
+	static _FORCE_INLINE_ void _xform_aabb(const Vec4 *p_columns, const AABB &p_aabb, AABB &r_aabb) {
+		Vec4 tmin = p_columns[3];
+		Vec4 tmax = p_columns[3];
+		for (int i = 0; i < 3; i++) {
+			const Vec4 e = _mul(p_columns[i], _splat(p_aabb.position.coord[i]));
+			const Vec4 f = _mul(p_columns[i], _splat(p_aabb.position.coord[i] + p_aabb.size.coord[i]));
+			tmin = _add(tmin, _min(e, f));
+			tmax = _add(tmax, _max(e, f));
+		}
+		_store3(r_aabb.position.coord, tmin);
+		_store3(r_aabb.size.coord, _sub(tmax, tmin));
+	}
+
+	// Row i of the product is the rows of p_b weighted by row i of the left hand side, passed pre-splatted.
+	static _FORCE_INLINE_ Vec4 _multiply_row(Vec4 p_x, Vec4 p_y, Vec4 p_z, const Basis &p_b) {
+		Vec4 r = _add(_mul(p_x, _load3(p_b.rows[0].coord)), _mul(p_y, _load3(p_b.rows[1].coord)));
+		return _add(r, _mul(p_z, _load3(p_b.rows[2].coord)));
+	}
+#endif
+
+public:
+	static _FORCE_INLINE_ AABB xform(const Transform3D &p_xform, const AABB &p_aabb) {
+#ifdef BATCH_MATH_SIMD
+		Vec4 columns[4];
+		_get_columns(p_xform, columns);
+		AABB r;
+		_xform_aabb(columns, p_aabb, r);
+		return r;
+#else
+		return p_xform.xform(p_aabb);
+#endif
+	}
+
+	static _FORCE_INLINE_ Transform3D multiply(const Transform3D &p_a, const Transform3D &p_b) {
+#ifdef BATCH_MATH_SIMD
+		Vec4 columns[4];
+		_get_columns(p_a, columns);
+		const Basis &a = p_a.basis;
+		const Vec4 row0 = _multiply_row(_splat(a.rows[0][0]), _splat(a.rows[0][1]), _splat(a.rows[0][2]), p_b.basis);
+		const Vec4 row1 = _multiply_row(_splat(a.rows[1][0]), _splat(a.rows[1][1]), _splat(a.rows[1][2]), p_b.basis);
+		const Vec4 row2 = _multiply_row(_splat(a.rows[2][0]), _splat(a.rows[2][1]), _splat(a.rows[2][2]), p_b.basis);
+		Transform3D r;
+		_store3(r.basis.rows[0].coord, row0);
+		_store3(r.basis.rows[1].coord, row1);
+		_store3(r.basis.rows[2].coord, row2);
+		_store3(r.origin.coord, _xform(columns, p_b.origin.coord));
+		return r;
+#else
+		return p_a * p_b;
+#endif
+	}
+
+	static void xform_points(const Transform3D &p_xform, const Vector3 *p_src, Vector3 *r_dst, uint32_t p_count);
+	static void xform_aabbs(const Transform3D &p_xform, const AABB *p_src, AABB *r_dst, uint32_t p_count);
+	// r_dst[i] = p_a * p_src[i].
+	static void multiply_transforms(const Transform3D &p_a, const Transform3D *p_src, Transform3D *r_dst, uint32_t p_count);
+	// r_dst[i] = p_a[i] * p_b[i].
+	static void multiply_transforms(const Transform3D *p_a, const Transform3D *p_b, Transform3D *r_dst, uint32_t p_count);
+
+	static const char *get_backend_name();
+};
+
+#endif // BATCH_MATH_H
@@ -88,6 +88,13 @@ public:
 		tree.params_set_pairing_expansion(p_value);
 	}
 
+	// update() rebuilds a tree once its SAH cost grows past this factor of the cost after its last rebuild.
+	// Zero or less disables the automatic rebuilds.
+	void params_set_rebuild_threshold(real_t p_value) {
+		BVH_LOCKED_FUNCTION
+		tree._rebuild_threshold = p_value;
+	}
+
 	void set_pair_callback(PairCallback p_callback, void *p_userdata) {
 		BVH_LOCKED_FUNCTION
 		pair_callback = p_callback;
@@ -306,6 +313,14 @@ public:
 #endif
 	}
 
+	// rebuild all the trees from scratch, e.g. after moving or adding many items at once
+	void rebuild() {
+		BVH_LOCKED_FUNCTION
+		for (int n = 0; n < NUM_TREES; n++) {
+			tree.rebuild(n);
+		}
+	}
+
 	// this can be called more frequently than per frame if necessary
 	void update_collisions() {
 		BVH_LOCKED_FUNCTION
@@ -398,6 +413,58 @@ public:
 		return params.result_count_overall;
 	}
 
+	// Concurrent cull tests. These take no lock and write the hit references to r_hits
+	// instead of the tree's shared hit list, so several threads can run them at once.
+	// The caller must hold lock_for_concurrent_culls() for as long as any are running,
+	// to stop the tree being modified underneath them.
+	typedef LocalVector<uint32_t, uint32_t, true> CullHits;
+
+	void lock_for_concurrent_culls() {
+		if (BVH_THREAD_SAFE && _thread_safe) {
+			_mutex.lock();
+		}
+	}
+
+	void unlock_for_concurrent_culls() {
+		if (BVH_THREAD_SAFE && _thread_safe) {
+			_mutex.unlock();
+		}
+	}
+
+	int cull_aabb_concurrent(const BOUNDS &p_aabb, T **p_result_array, int p_result_max, CullHits &r_hits, const T *p_tester, uint32_t p_tree_collision_mask = 0xFFFFFFFF, int *p_subindex_array = nullptr) {
+		typename BVHTREE_CLASS::CullParams params;
+
+		params.result_count_overall = 0;
+		params.result_max = p_result_max;
+		params.result_array = p_result_array;
+		params.subindex_array = p_subindex_array;
+		params.tree_collision_mask = p_tree_collision_mask;
+		params.abb.from(p_aabb);
+		params.tester = p_tester;
+
+		tree.cull_aabb_to(params, r_hits);
+
+		return params.result_count_overall;
+	}
+
+	int cull_segment_concurrent(const POINT &p_from, const POINT &p_to, T **p_result_array, int p_result_max, CullHits &r_hits, const T *p_tester, uint32_t p_tree_collision_mask = 0xFFFFFFFF, int *p_subindex_array = nullptr) {
+		typename BVHTREE_CLASS::CullParams params;
+
+		params.result_count_overall = 0;
+		params.result_max = p_result_max;
+		params.result_array = p_result_array;
+		params.subindex_array = p_subindex_array;
+		params.tester = p_tester;
+		params.tree_collision_mask = p_tree_collision_mask;
+
+		params.segment.from = p_from;
+		params.segment.to = p_to;
+
+		tree.cull_segment_to(params, r_hits);
+
+		return params.result_count_overall;
+	}
+
 	int cull_convex(const Vector<Plane> &p_convex, T **p_result_array, int p_result_max, const T *p_tester, uint32_t p_tree_collision_mask = 0xFFFFFFFF) {
 		BVH_LOCKED_FUNCTION
 		if (!p_convex.size()) {
@@ -435,6 +502,20 @@ private:
 			return;
 		}
 
+		// With enough changed items, the overlap culls are run for all of them up front
+		// on the worker threads. These only read the tree, and the pairing below
+		// only changes the pair lists, so the results are the same as culling inline.
+		WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+		bool parallel_cull = pool && changed_items.size() >= (uint32_t)PAIRING_PARALLEL_MIN_ITEMS;
+
+		if (parallel_cull) {
+			if (_pairing_hits.size() < changed_items.size()) {
+				_pairing_hits.resize(changed_items.size());
+			}
+			WorkerThreadPool::GroupID group = pool->add_template_range_group_task(this, &BVH_Manager::_pairing_cull_task, nullptr, changed_items.size(), PAIRING_PARALLEL_MIN_ITEMS / 8, -1, true);
+			pool->wait_for_group_task_completion(group);
+		}
+
 		BOUNDS bb;
 
 		typename BVHTREE_CLASS::CullParams params;
@@ -444,26 +525,34 @@ private:
 		params.result_array = nullptr;
 		params.subindex_array = nullptr;
 
-		for (const BVHHandle &h : changed_items) {
+		// Callbacks are always sent serially in changed_items order,
+		// so the pairs generated don't depend on the thread count.
+		for (uint32_t i = 0; i < changed_items.size(); i++) {
+			const BVHHandle &h = changed_items[i];
+
 			// use the expanded aabb for pairing
 			const BOUNDS &expanded_aabb = tree._pairs[h.id()].expanded_aabb;
 			BVHABB_CLASS abb;
 			abb.from(expanded_aabb);
 
-			tree.item_fill_cullparams(h, params);
-
 			// find all the existing paired aabbs that are no longer
 			// paired, and send callbacks
 			_find_leavers(h, abb, p_full_check);
 
 			uint32_t changed_item_ref_id = h.id();
 
-			params.abb = abb;
+			const LocalVector<uint32_t, uint32_t, true> *hits = &tree._cull_hits;
+			if (parallel_cull) {
+				hits = &_pairing_hits[i];
+			} else {
+				tree.item_fill_cullparams(h, params);
+				params.abb = abb;
 
-			params.result_count_overall = 0; // might not be needed
-			tree.cull_aabb(params, false);
+				params.result_count_overall = 0; // might not be needed
+				tree.cull_aabb(params, false);
+			}
 
-			for (const uint32_t ref_id : tree._cull_hits) {
+			for (const uint32_t ref_id : *hits) {
 				// don't collide against ourself
 				if (ref_id == changed_item_ref_id) {
 					continue;
@@ -480,6 +569,24 @@ private:
 		_reset();
 	}
 
+	void _pairing_cull_task(uint32_t p_from, uint32_t p_to, void *p_userdata) {
+		typename BVHTREE_CLASS::CullParams params;
+
+		params.result_count_overall = 0;
+		params.result_max = INT_MAX;
+		params.result_array = nullptr;
+		params.subindex_array = nullptr;
+
+		for (uint32_t i = p_from; i < p_to; i++) {
+			const BVHHandle &h = changed_items[i];
+
+			tree.item_fill_cullparams(h, params);
+			params.abb.from(tree._pairs[h.id()].expanded_aabb);
+
+			tree.cull_aabb_to(params, _pairing_hits[i], false);
+		}
+	}
+
 public:
 	void item_get_AABB(BVHHandle p_handle, BOUNDS &r_aabb) {
 		DEV_ASSERT(!p_handle.is_invalid());
@@ -773,6 +880,13 @@ private:
 	LocalVector<BVHHandle, uint32_t, true> changed_items;
 	uint32_t _tick = 1; // Start from 1 so items with 0 indicate never updated.
 
+	// Below this many changed items, pairing culls are done inline on the calling thread.
+	enum { PAIRING_PARALLEL_MIN_ITEMS = 128 };
+
+	// Overlap results per changed item, filled by _pairing_cull_task().
+	// Kept between ticks so the hit lists keep their capacity.
+	LocalVector<LocalVector<uint32_t, uint32_t, true>> _pairing_hits;
+
 	class BVHLockedFunction {
 	public:
 		BVHLockedFunction(Mutex *p_mutex, bool p_thread_safe) {
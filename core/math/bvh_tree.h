@@ -43,6 +43,7 @@
 #include "core/math/bvh_abb.h"
 #include "core/math/geometry_3d.h"
 #include "core/math/vector3.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/pooled_list.h"
 #include <limits.h>
@@ -451,6 +452,7 @@ private:
 #include "bvh_logic.inc"
 #include "bvh_misc.inc"
 #include "bvh_public.inc"
+#include "bvh_rebuild.inc"
 #include "bvh_refit.inc"
 #include "bvh_split.inc"
 };
@@ -61,6 +61,7 @@ subject to the following restrictions:
 #include "core/error/error_macros.h"
 #include "core/math/aabb.h"
 #include "core/math/math_defs.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/memory.h"
 #include "core/templates/oa_hash_map.h"
 #include "core/templates/paged_allocator.h"
@@ -2343,3 +2344,42 @@ Error ConvexHullComputer::convex_hull(const Vector<Vector3> &p_points, Geometry3
 
 	return OK;
 }
+
+struct ConvexHullBatch {
+	const Vector<Vector3> *point_sets = nullptr;
+	Geometry3D::MeshData *meshes = nullptr;
+	Error *errors = nullptr;
+
+	static void compute(void *p_batch, uint32_t p_index) {
+		ConvexHullBatch *batch = (ConvexHullBatch *)p_batch;
+		batch->errors[p_index] = ConvexHullComputer::convex_hull(batch->point_sets[p_index], batch->meshes[p_index]);
+	}
+};
+
+Error ConvexHullComputer::convex_hull_batch(const Vector<Vector<Vector3>> &p_point_sets, Vector<Geometry3D::MeshData> &r_meshes) {
+	r_meshes.resize(p_point_sets.size());
+
+	LocalVector<Error> errors;
+	errors.resize(p_point_sets.size());
+
+	ConvexHullBatch batch;
+	batch.point_sets = p_point_sets.ptr();
+	batch.meshes = r_meshes.ptrw();
+	batch.errors = errors.ptr();
+
+	if (p_point_sets.size() < 2 || !WorkerThreadPool::get_singleton()) {
+		for (int i = 0; i < p_point_sets.size(); i++) {
+			ConvexHullBatch::compute(&batch, i);
+		}
+	} else {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&ConvexHullBatch::compute, &batch, p_point_sets.size(), -1, true, SNAME("ConvexHullBatch"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
+	for (const Error &err : errors) {
+		if (err != OK) {
+			return err;
+		}
+	}
+	return OK;
+}
@@ -111,6 +111,8 @@ public:
 	real_t compute(const Vector3 *p_coords, int32_t p_count, real_t p_shrink, real_t p_shrink_clamp);
 
 	static Error convex_hull(const Vector<Vector3> &p_points, Geometry3D::MeshData &r_mesh);
+	// Computes the hull of every point set on the WorkerThreadPool. Returns the first error, the hulls that failed are left empty.
+	static Error convex_hull_batch(const Vector<Vector<Vector3>> &p_point_sets, Vector<Geometry3D::MeshData> &r_meshes);
 };
 
 #endif // CONVEX_HULL_H
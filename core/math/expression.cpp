@@ -35,6 +35,7 @@
 #include "core/object/class_db.h"
 #include "core/object/ref_counted.h"
 #include "core/os/os.h"
+#include "core/variant/variant_internal.h"
 #include "core/variant/variant_parser.h"
 
 Error Expression::_get_token(Token &r_token) {
@@ -1467,7 +1468,294 @@ bool Expression::_execute(const Array &p_inputs, Object *p_instance, Expression:
 	return false;
 }
 
+void Expression::_compile_code() {
+	code.clear();
+	stack.clear();
+	argument_slots.clear();
+	argument_pointers.clear();
+	result_slot = -1;
+
+	if (!root) {
+		return;
+	}
+
+	bool constant = false;
+	result_slot = _compile_node(root, constant);
+
+	// The stack doesn't grow anymore, so arguments can point to their slots directly.
+	argument_pointers.resize(argument_slots.size());
+	for (uint32_t i = 0; i < argument_slots.size(); i++) {
+		argument_pointers[i] = &stack[argument_slots[i]];
+	}
+}
+
+int Expression::_compile_node(ENode *p_node, bool &r_constant) {
+	r_constant = false;
+
+	LocalVector<ENode *> children;
+	switch (p_node->type) {
+		case ENode::TYPE_CONSTANT: {
+			r_constant = true;
+			stack.push_back(static_cast<const ConstantNode *>(p_node)->value);
+			return stack.size() - 1;
+		}
+		case ENode::TYPE_INPUT:
+		case ENode::TYPE_SELF: {
+		} break;
+		case ENode::TYPE_OPERATOR: {
+			const OperatorNode *op = static_cast<const OperatorNode *>(p_node);
+			children.push_back(op->nodes[0]);
+			if (op->nodes[1]) {
+				children.push_back(op->nodes[1]);
+			}
+		} break;
+		case ENode::TYPE_INDEX: {
+			const IndexNode *index = static_cast<const IndexNode *>(p_node);
+			children.push_back(index->base);
+			children.push_back(index->index);
+		} break;
+		case ENode::TYPE_NAMED_INDEX: {
+			children.push_back(static_cast<const NamedIndexNode *>(p_node)->base);
+		} break;
+		case ENode::TYPE_ARRAY: {
+			for (ENode *E : static_cast<const ArrayNode *>(p_node)->array) {
+				children.push_back(E);
+			}
+		} break;
+		case ENode::TYPE_DICTIONARY: {
+			for (ENode *E : static_cast<const DictionaryNode *>(p_node)->dict) {
+				children.push_back(E);
+			}
+		} break;
+		case ENode::TYPE_CONSTRUCTOR: {
+			for (ENode *E : static_cast<const ConstructorNode *>(p_node)->arguments) {
+				children.push_back(E);
+			}
+		} break;
+		case ENode::TYPE_BUILTIN_FUNC: {
+			for (ENode *E : static_cast<const BuiltinFuncNode *>(p_node)->arguments) {
+				children.push_back(E);
+			}
+		} break;
+		case ENode::TYPE_CALL: {
+			const CallNode *call = static_cast<const CallNode *>(p_node);
+			children.push_back(call->base);
+			for (ENode *E : call->arguments) {
+				children.push_back(E);
+			}
+		} break;
+	}
+
+	LocalVector<int> slots;
+	bool all_constant = true;
+	for (ENode *child : children) {
+		bool constant = false;
+		slots.push_back(_compile_node(child, constant));
+		all_constant = all_constant && constant;
+	}
+
+	if (all_constant && !children.is_empty()) {
+		Variant value;
+		if (_fold_constant(p_node, slots, value)) {
+			r_constant = true;
+			stack.push_back(value);
+			return stack.size() - 1;
+		}
+	}
+
+	Instruction instruction;
+	instruction.node = p_node;
+	instruction.arguments = argument_slots.size();
+	instruction.argument_count = slots.size();
+	for (int slot : slots) {
+		argument_slots.push_back(slot);
+	}
+	stack.push_back(Variant());
+	instruction.target = stack.size() - 1;
+	code.push_back(instruction);
+	return instruction.target;
+}
+
+bool Expression::_fold_constant(const ENode *p_node, const LocalVector<int> &p_slots, Variant &r_value) {
+	// Only values are folded, a folded Array or Object would be shared by every execution.
+	switch (p_node->type) {
+		case ENode::TYPE_OPERATOR: {
+			const OperatorNode *op = static_cast<const OperatorNode *>(p_node);
+			bool valid = true;
+			Variant::evaluate(op->op, stack[p_slots[0]], p_slots.size() > 1 ? stack[p_slots[1]] : Variant(), r_value, valid);
+			return valid && r_value.get_type() < Variant::OBJECT;
+		}
+		case ENode::TYPE_INDEX: {
+			const Variant &base = stack[p_slots[0]];
+			if (base.get_type() >= Variant::OBJECT) {
+				return false;
+			}
+			bool valid = false;
+			r_value = base.get(stack[p_slots[1]], &valid);
+			return valid && r_value.get_type() < Variant::OBJECT;
+		}
+		case ENode::TYPE_NAMED_INDEX: {
+			const Variant &base = stack[p_slots[0]];
+			if (base.get_type() >= Variant::OBJECT) {
+				return false;
+			}
+			bool valid = false;
+			r_value = base.get_named(static_cast<const NamedIndexNode *>(p_node)->name, valid);
+			return valid && r_value.get_type() < Variant::OBJECT;
+		}
+		case ENode::TYPE_CONSTRUCTOR: {
+			const ConstructorNode *constructor = static_cast<const ConstructorNode *>(p_node);
+			if (constructor->data_type >= Variant::OBJECT) {
+				return false;
+			}
+			LocalVector<const Variant *> argp;
+			for (int slot : p_slots) {
+				argp.push_back(&stack[slot]);
+			}
+			Callable::CallError ce;
+			Variant::construct(constructor->data_type, r_value, argp.ptr(), argp.size(), ce);
+			return ce.error == Callable::CallError::CALL_OK;
+		}
+		default: {
+			// Calls may have side effects, and containers must be new on every execution.
+			return false;
+		}
+	}
+}
+
+bool Expression::_execute_code(const Array &p_inputs, Object *p_instance, Variant &r_ret, bool p_const_calls_only, String &r_error_str) {
+	static const Variant nil;
+
+	for (Instruction &instruction : code) {
+		const Variant **argp = argument_pointers.ptr() + instruction.arguments;
+		Variant &target = stack[instruction.target];
+
+		switch (instruction.node->type) {
+			case ENode::TYPE_INPUT: {
+				const InputNode *in = static_cast<const InputNode *>(instruction.node);
+				if (in->index < 0 || in->index >= p_inputs.size()) {
+					r_error_str = vformat(RTR("Invalid input %d (not passed) in expression"), in->index);
+					return true;
+				}
+				target = p_inputs[in->index];
+			} break;
+			case ENode::TYPE_CONSTANT: {
+				// Constants live in their slots.
+			} break;
+			case ENode::TYPE_SELF: {
+				if (!p_instance) {
+					r_error_str = RTR("self can't be used because instance is null (not passed)");
+					return true;
+				}
+				target = p_instance;
+			} break;
+			case ENode::TYPE_OPERATOR: {
+				const OperatorNode *op = static_cast<const OperatorNode *>(instruction.node);
+				const Variant &a = *argp[0];
+				const Variant &b = instruction.argument_count > 1 ? *argp[1] : nil;
+
+				Variant::Type type_a = a.get_type();
+				Variant::Type type_b = b.get_type();
+				if (type_a != instruction.operator_types[0] || type_b != instruction.operator_types[1]) {
+					instruction.operator_types[0] = type_a;
+					instruction.operator_types[1] = type_b;
+					// Objects may have been freed, leave them to the checked path.
+					instruction.operator_evaluator = type_a == Variant::OBJECT || type_b == Variant::OBJECT ? nullptr : Variant::get_validated_operator_evaluator(op->op, type_a, type_b);
+					instruction.operator_return_type = Variant::get_operator_return_type(op->op, type_a, type_b);
+				}
+
+				if (instruction.operator_evaluator) {
+					if (target.get_type() != instruction.operator_return_type) {
+						VariantInternal::initialize(&target, instruction.operator_return_type);
+					}
+					instruction.operator_evaluator(&a, &b, &target);
+				} else {
+					bool valid = true;
+					Variant::evaluate(op->op, a, b, target, valid);
+					if (!valid) {
+						r_error_str = vformat(RTR("Invalid operands to operator %s, %s and %s."), Variant::get_operator_name(op->op), Variant::get_type_name(type_a), Variant::get_type_name(type_b));
+						return true;
+					}
+				}
+			} break;
+			case ENode::TYPE_INDEX: {
+				bool valid;
+				target = argp[0]->get(*argp[1], &valid);
+				if (!valid) {
+					r_error_str = vformat(RTR("Invalid index of type %s for base type %s"), Variant::get_type_name(argp[1]->get_type()), Variant::get_type_name(argp[0]->get_type()));
+					return true;
+				}
+			} break;
+			case ENode::TYPE_NAMED_INDEX: {
+				const NamedIndexNode *index = static_cast<const NamedIndexNode *>(instruction.node);
+				bool valid;
+				target = argp[0]->get_named(index->name, valid);
+				if (!valid) {
+					r_error_str = vformat(RTR("Invalid named index '%s' for base type %s"), String(index->name), Variant::get_type_name(argp[0]->get_type()));
+					return true;
+				}
+			} break;
+			case ENode::TYPE_ARRAY: {
+				Array arr;
+				arr.resize(instruction.argument_count);
+				for (int i = 0; i < instruction.argument_count; i++) {
+					arr[i] = *argp[i];
+				}
+				target = arr;
+			} break;
+			case ENode::TYPE_DICTIONARY: {
+				Dictionary d;
+				for (int i = 0; i < instruction.argument_count; i += 2) {
+					d[*argp[i + 0]] = *argp[i + 1];
+				}
+				target = d;
+			} break;
+			case ENode::TYPE_CONSTRUCTOR: {
+				const ConstructorNode *constructor = static_cast<const ConstructorNode *>(instruction.node);
+				Callable::CallError ce;
+				Variant::construct(constructor->data_type, target, argp, instruction.argument_count, ce);
+				if (ce.error != Callable::CallError::CALL_OK) {
+					r_error_str = vformat(RTR("Invalid arguments to construct '%s'"), Variant::get_type_name(constructor->data_type));
+					return true;
+				}
+			} break;
+			case ENode::TYPE_BUILTIN_FUNC: {
+				const BuiltinFuncNode *bifunc = static_cast<const BuiltinFuncNode *>(instruction.node);
+				target = Variant(); //may not return anything
+				Callable::CallError ce;
+				Variant::call_utility_function(bifunc->func, &target, argp, instruction.argument_count, ce);
+				if (ce.error != Callable::CallError::CALL_OK) {
+					r_error_str = "Builtin call failed: " + Variant::get_call_error_text(bifunc->func, argp, instruction.argument_count, ce);
+					return true;
+				}
+			} break;
+			case ENode::TYPE_CALL: {
+				const CallNode *call = static_cast<const CallNode *>(instruction.node);
+				// Calls on value types may change the base, so don't call on its slot.
+				Variant base = *argp[0];
+				Callable::CallError ce;
+				if (p_const_calls_only) {
+					base.call_const(call->method, argp + 1, instruction.argument_count - 1, target, ce);
+				} else {
+					base.callp(call->method, argp + 1, instruction.argument_count - 1, target, ce);
+				}
+				if (ce.error != Callable::CallError::CALL_OK) {
+					r_error_str = vformat(RTR("On call to '%s':"), String(call->method));
+					return true;
+				}
+			} break;
+		}
+	}
+
+	if (result_slot >= 0) {
+		r_ret = stack[result_slot];
+	}
+	return false;
+}
+
 Error Expression::parse(const String &p_expression, const Vector<String> &p_input_names) {
+	ERR_FAIL_COND_V_MSG(executing, ERR_BUSY, "Can't parse an expression while it is being executed.");
+
 	if (nodes) {
 		memdelete(nodes);
 		nodes = nullptr;
@@ -1488,9 +1776,11 @@ Error Expression::parse(const String &p_expression, const Vector<String> &p_inpu
 			memdelete(nodes);
 		}
 		nodes = nullptr;
+		_compile_code();
 		return ERR_INVALID_PARAMETER;
 	}
 
+	_compile_code();
 	return OK;
 }
 
@@ -1500,7 +1790,21 @@ Variant Expression::execute(Array p_inputs, Object *p_base, bool p_show_error, b
 	execution_error = false;
 	Variant output;
 	String error_txt;
-	bool err = _execute(p_inputs, p_base, root, output, p_const_calls_only, error_txt);
+	bool err;
+	if (executing) {
+		// Called again from one of its own calls, the stack is in use.
+		err = _execute(p_inputs, p_base, root, output, p_const_calls_only, error_txt);
+	} else {
+		executing = true;
+		err = _execute_code(p_inputs, p_base, output, p_const_calls_only, error_txt);
+		// Don't keep references alive until the next execution.
+		for (const Instruction &instruction : code) {
+			if (stack[instruction.target].get_type() >= Variant::OBJECT) {
+				stack[instruction.target] = Variant();
+			}
+		}
+		executing = false;
+	}
 	if (err) {
 		execution_error = true;
 		error_str = error_txt;
@@ -32,6 +32,7 @@
 #define EXPRESSION_H
 
 #include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
 
 class Expression : public RefCounted {
 	GDCLASS(Expression, RefCounted);
@@ -259,6 +260,31 @@ private:
 	bool execution_error = false;
 	bool _execute(const Array &p_inputs, Object *p_instance, Expression::ENode *p_node, Variant &r_ret, bool p_const_calls_only, String &r_error_str);
 
+	// The tree is compiled into instructions that each write one slot of a flat stack, reading their
+	// arguments from the slots of earlier instructions. Constant subtrees of value types are folded into
+	// slots at compile time, and operators cache the validated evaluator of the last operand types they saw.
+	struct Instruction {
+		ENode *node = nullptr;
+		int target = 0;
+		int arguments = 0; // Offset in argument_slots.
+		int argument_count = 0;
+		Variant::Type operator_types[2] = { Variant::VARIANT_MAX, Variant::VARIANT_MAX };
+		Variant::Type operator_return_type = Variant::NIL;
+		Variant::ValidatedOperatorEvaluator operator_evaluator = nullptr;
+	};
+
+	LocalVector<Instruction> code;
+	LocalVector<Variant> stack;
+	LocalVector<int> argument_slots;
+	LocalVector<const Variant *> argument_pointers;
+	int result_slot = -1;
+	bool executing = false;
+
+	void _compile_code();
+	int _compile_node(ENode *p_node, bool &r_constant);
+	bool _fold_constant(const ENode *p_node, const LocalVector<int> &p_slots, Variant &r_value);
+	bool _execute_code(const Array &p_inputs, Object *p_instance, Variant &r_ret, bool p_const_calls_only, String &r_error_str);
+
 protected:
 	static void _bind_methods();
 
@@ -30,6 +30,8 @@
 
 #include "geometry_2d.h"
 
+#include "core/object/worker_thread_pool.h"
+
 #include "thirdparty/misc/clipper.hpp"
 #include "thirdparty/misc/polypartition.h"
 #define STB_RECT_PACK_IMPLEMENTATION
@@ -254,6 +256,56 @@ Vector<Vector<Point2>> Geometry2D::_polypaths_do_operation(PolyBooleanOperation
 	return polypaths;
 }
 
+Vector<Vector<Vector<Point2>>> Geometry2D::polygons_do_operation_batch(PolyBooleanOperation p_op, const Vector<Vector<Point2>> &p_polygons_a, const Vector<Vector<Point2>> &p_polygons_b) {
+	Vector<Vector<Vector<Point2>>> results;
+	ERR_FAIL_COND_V_MSG(p_polygons_b.size() != p_polygons_a.size() && p_polygons_b.size() != 1, results, "The second polygon array must have the same size as the first one, or a single polygon.");
+
+	results.resize(p_polygons_a.size());
+	PolygonBatch batch;
+	batch.op = p_op;
+	batch.polygons_a = p_polygons_a.ptr();
+	batch.polygons_b = p_polygons_b.ptr();
+	batch.polygons_b_count = p_polygons_b.size();
+	batch.results = results.ptrw();
+	_run_polygon_batch(batch, p_polygons_a.size());
+	return results;
+}
+
+Vector<Vector<Vector<Point2>>> Geometry2D::offset_polygons_batch(const Vector<Vector<Point2>> &p_polygons, real_t p_delta, PolyJoinType p_join_type) {
+	Vector<Vector<Vector<Point2>>> results;
+	results.resize(p_polygons.size());
+	PolygonBatch batch;
+	batch.offset = true;
+	batch.delta = p_delta;
+	batch.join_type = p_join_type;
+	batch.polygons_a = p_polygons.ptr();
+	batch.results = results.ptrw();
+	_run_polygon_batch(batch, p_polygons.size());
+	return results;
+}
+
+void Geometry2D::_polygon_batch_task(void *p_batch, uint32_t p_index) {
+	PolygonBatch *batch = (PolygonBatch *)p_batch;
+	if (batch->offset) {
+		batch->results[p_index] = _polypath_offset(batch->polygons_a[p_index], batch->delta, batch->join_type, END_POLYGON);
+	} else {
+		const Vector<Point2> &polygon_b = batch->polygons_b[batch->polygons_b_count == 1 ? 0 : p_index];
+		batch->results[p_index] = _polypaths_do_operation(batch->op, batch->polygons_a[p_index], polygon_b);
+	}
+}
+
+void Geometry2D::_run_polygon_batch(PolygonBatch &p_batch, int p_count) {
+	if (p_count < 2 || !WorkerThreadPool::get_singleton()) {
+		for (int i = 0; i < p_count; i++) {
+			_polygon_batch_task(&p_batch, i);
+		}
+		return;
+	}
+	// Each result is written by a single task, Clipper keeps no shared state.
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&Geometry2D::_polygon_batch_task, &p_batch, p_count, -1, true, SNAME("Geometry2DPolygonBatch"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
 Vector<Vector<Point2>> Geometry2D::_polypath_offset(const Vector<Point2> &p_polypath, real_t p_delta, PolyJoinType p_join_type, PolyEndType p_end_type) {
 	using namespace ClipperLib;
 
@@ -302,6 +302,12 @@ public:
 		return _polypath_offset(p_polygon, p_delta, p_join_type, p_end_type);
 	}
 
+	// Batched versions of the operations above, spread over the WorkerThreadPool. p_polygons_b holds either
+	// one polygon per polygon of p_polygons_a, or a single polygon used against all of them.
+	// The result holds the resulting polygons of each input polygon, in order.
+	static Vector<Vector<Vector<Point2>>> polygons_do_operation_batch(PolyBooleanOperation p_op, const Vector<Vector<Point2>> &p_polygons_a, const Vector<Vector<Point2>> &p_polygons_b);
+	static Vector<Vector<Vector<Point2>>> offset_polygons_batch(const Vector<Vector<Point2>> &p_polygons, real_t p_delta, PolyJoinType p_join_type);
+
 	static Vector<int> triangulate_delaunay(const Vector<Vector2> &p_points) {
 		Vector<Delaunay2D::Triangle> tr = Delaunay2D::triangulate(p_points);
 		Vector<int> triangles;
@@ -467,6 +473,20 @@ public:
 	static Vector<Vector3i> partial_pack_rects(const Vector<Vector2i> &p_sizes, const Size2i &p_atlas_size);
 
 private:
+	struct PolygonBatch {
+		PolyBooleanOperation op = OPERATION_UNION;
+		bool offset = false;
+		real_t delta = 0;
+		PolyJoinType join_type = JOIN_SQUARE;
+		const Vector<Point2> *polygons_a = nullptr;
+		const Vector<Point2> *polygons_b = nullptr;
+		int polygons_b_count = 0;
+		Vector<Vector<Point2>> *results = nullptr;
+	};
+
+	static void _polygon_batch_task(void *p_batch, uint32_t p_index);
+	static void _run_polygon_batch(PolygonBatch &p_batch, int p_count);
+
 	static Vector<Vector<Point2>> _polypaths_do_operation(PolyBooleanOperation p_op, const Vector<Point2> &p_polypath_a, const Vector<Point2> &p_polypath_b, bool is_a_open = false);
 	static Vector<Vector<Point2>> _polypath_offset(const Vector<Point2> &p_polypath, real_t p_delta, PolyJoinType p_join_type, PolyEndType p_end_type);
 };
@@ -30,51 +30,135 @@
 
 #include "triangle_mesh.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/sort_array.h"
 
-int TriangleMesh::_create_bvh(BVH *p_bvh, BVH **p_bb, int p_from, int p_size, int p_depth, int &r_max_depth, int &r_max_alloc) {
-	if (p_depth > r_max_depth) {
-		r_max_depth = p_depth;
+int TriangleMesh::_split_bvh(BVH **p_bb, int p_size, const AABB &p_aabb, int p_depth) {
+	AABB centers(p_bb[0]->center, Vector3());
+	for (int i = 1; i < p_size; i++) {
+		centers.expand_to(p_bb[i]->center);
 	}
+	int axis = centers.get_longest_axis_index();
+	real_t extent = centers.size[axis];
+
+	if (p_size > 2 && extent > CMP_EPSILON && p_depth < BVH_SAH_MAX_DEPTH) {
+		// Binned surface area heuristic.
+		struct Bin {
+			AABB aabb;
+			int count = 0;
+		};
+		Bin bins[BVH_SAH_BINS];
+		real_t bin_scale = real_t(BVH_SAH_BINS) / extent;
+		real_t bin_origin = centers.position[axis];
+
+		for (int i = 0; i < p_size; i++) {
+			int b = MIN(int((p_bb[i]->center[axis] - bin_origin) * bin_scale), BVH_SAH_BINS - 1);
+			if (bins[b].count == 0) {
+				bins[b].aabb = p_bb[i]->aabb;
+			} else {
+				bins[b].aabb.merge_with(p_bb[i]->aabb);
+			}
+			bins[b].count++;
+		}
 
-	if (p_size == 1) {
-		return p_bb[p_from] - p_bvh;
-	} else if (p_size == 0) {
-		return -1;
-	}
+		// Cost of everything right of each split.
+		real_t right_cost[BVH_SAH_BINS - 1];
+		int right_count = 0;
+		AABB right_aabb;
+		for (int i = BVH_SAH_BINS - 1; i > 0; i--) {
+			if (bins[i].count) {
+				right_aabb = right_count ? right_aabb.merge(bins[i].aabb) : bins[i].aabb;
+				right_count += bins[i].count;
+			}
+			Vector3 s = right_aabb.size;
+			right_cost[i - 1] = right_count ? (s.x * s.y + s.y * s.z + s.z * s.x) * right_count : -1;
+		}
 
-	AABB aabb;
-	aabb = p_bb[p_from]->aabb;
-	for (int i = 1; i < p_size; i++) {
-		aabb.merge_with(p_bb[p_from + i]->aabb);
-	}
+		int best_bin = -1;
+		real_t best_cost = 0;
+		int left_count = 0;
+		AABB left_aabb;
+		for (int i = 0; i < BVH_SAH_BINS - 1; i++) {
+			if (bins[i].count) {
+				left_aabb = left_count ? left_aabb.merge(bins[i].aabb) : bins[i].aabb;
+				left_count += bins[i].count;
+			}
+			if (left_count == 0 || right_cost[i] < 0) {
+				continue;
+			}
+			Vector3 s = left_aabb.size;
+			real_t cost = (s.x * s.y + s.y * s.z + s.z * s.x) * left_count + right_cost[i];
+			if (best_bin == -1 || cost < best_cost) {
+				best_bin = i;
+				best_cost = cost;
+			}
+		}
 
-	int li = aabb.get_longest_axis_index();
+		if (best_bin != -1) {
+			int mid = 0;
+			for (int i = 0; i < p_size; i++) {
+				int b = MIN(int((p_bb[i]->center[axis] - bin_origin) * bin_scale), BVH_SAH_BINS - 1);
+				if (b <= best_bin) {
+					SWAP(p_bb[i], p_bb[mid]);
+					mid++;
+				}
+			}
+			return mid;
+		}
+	}
 
-	switch (li) {
+	switch (p_aabb.get_longest_axis_index()) {
 		case Vector3::AXIS_X: {
 			SortArray<BVH *, BVHCmpX> sort_x;
-			sort_x.nth_element(0, p_size, p_size / 2, &p_bb[p_from]);
-			//sort_x.sort(&p_bb[p_from],p_size);
+			sort_x.nth_element(0, p_size, p_size / 2, p_bb);
 		} break;
 		case Vector3::AXIS_Y: {
 			SortArray<BVH *, BVHCmpY> sort_y;
-			sort_y.nth_element(0, p_size, p_size / 2, &p_bb[p_from]);
-			//sort_y.sort(&p_bb[p_from],p_size);
+			sort_y.nth_element(0, p_size, p_size / 2, p_bb);
 		} break;
 		case Vector3::AXIS_Z: {
 			SortArray<BVH *, BVHCmpZ> sort_z;
-			sort_z.nth_element(0, p_size, p_size / 2, &p_bb[p_from]);
-			//sort_z.sort(&p_bb[p_from],p_size);
-
+			sort_z.nth_element(0, p_size, p_size / 2, p_bb);
 		} break;
 	}
+	return p_size / 2;
+}
+
+int TriangleMesh::_create_bvh(BVHBuild &p_build, int p_from, int p_size, int p_node_from, int p_depth, int &r_max_depth, bool p_defer) {
+	if (p_depth > r_max_depth) {
+		r_max_depth = p_depth;
+	}
+
+	BVH **bb = p_build.bb + p_from;
+	if (p_size == 1) {
+		return bb[0] - p_build.bvh;
+	} else if (p_size == 0) {
+		return -1;
+	}
+
+	int index = p_node_from + p_size - 2;
+	if (p_defer && p_size <= p_build.task_size) {
+		BVHBuildTask task;
+		task.from = p_from;
+		task.size = p_size;
+		task.node_from = p_node_from;
+		task.depth = p_depth;
+		p_build.tasks.push_back(task);
+		return index;
+	}
+
+	AABB aabb;
+	aabb = bb[0]->aabb;
+	for (int i = 1; i < p_size; i++) {
+		aabb.merge_with(bb[i]->aabb);
+	}
+
+	int split = _split_bvh(bb, p_size, aabb, p_depth);
 
-	int left = _create_bvh(p_bvh, p_bb, p_from, p_size / 2, p_depth + 1, r_max_depth, r_max_alloc);
-	int right = _create_bvh(p_bvh, p_bb, p_from + p_size / 2, p_size - p_size / 2, p_depth + 1, r_max_depth, r_max_alloc);
+	int left = _create_bvh(p_build, p_from, split, p_node_from, p_depth + 1, r_max_depth, p_defer);
+	int right = _create_bvh(p_build, p_from + split, p_size - split, p_node_from + split - 1, p_depth + 1, r_max_depth, p_defer);
 
-	int index = r_max_alloc++;
-	BVH *_new = &p_bvh[index];
+	BVH *_new = &p_build.bvh[index];
 	_new->aabb = aabb;
 	_new->center = aabb.get_center();
 	_new->face_index = -1;
@@ -84,6 +168,12 @@ int TriangleMesh::_create_bvh(BVH *p_bvh, BVH **p_bb, int p_from, int p_size, in
 	return index;
 }
 
+void TriangleMesh::_create_bvh_task(uint32_t p_index, BVHBuild *p_build) {
+	BVHBuildTask &task = p_build->tasks[p_index];
+	task.max_depth = task.depth;
+	_create_bvh(*p_build, task.from, task.size, task.node_from, task.depth, task.max_depth, false);
+}
+
 void TriangleMesh::get_indices(Vector<int> *r_triangles_indices) const {
 	if (!valid) {
 		return;
@@ -114,7 +204,7 @@ void TriangleMesh::create(const Vector<Vector3> &p_faces, const Vector<int32_t>
 	fc /= 3;
 	triangles.resize(fc);
 
-	bvh.resize(fc * 3); //will never be larger than this (todo make better)
+	bvh.resize(fc * 2 - 1); // Faces, then the internal nodes.
 	BVH *bw = bvh.ptrw();
 
 	{
@@ -173,11 +263,24 @@ void TriangleMesh::create(const Vector<Vector3> &p_faces, const Vector<int32_t>
 		bwp[i] = &bw[i];
 	}
 
+	BVHBuild build;
+	build.bvh = bw;
+	build.bb = bwp;
+	bool parallel = fc >= BVH_PARALLEL_MIN_FACES && WorkerThreadPool::get_singleton();
+	if (parallel) {
+		build.task_size = MAX(fc / (WorkerThreadPool::get_singleton()->get_thread_count() * 4), BVH_PARALLEL_MIN_FACES / 4);
+	}
+
 	max_depth = 0;
-	int max_alloc = fc;
-	_create_bvh(bw, bwp, 0, fc, 1, max_depth, max_alloc);
+	_create_bvh(build, 0, fc, fc, 1, max_depth, parallel);
 
-	bvh.resize(max_alloc); //resize back
+	if (!build.tasks.is_empty()) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &TriangleMesh::_create_bvh_task, &build, build.tasks.size(), -1, true, SNAME("TriangleMeshBVH"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		for (const BVHBuildTask &task : build.tasks) {
+			max_depth = MAX(max_depth, task.max_depth);
+		}
+	}
 
 	valid = true;
 }
@@ -384,6 +487,93 @@ bool TriangleMesh::intersect_ray(const Vector3 &p_begin, const Vector3 &p_dir, V
 	return inters;
 }
 
+void TriangleMesh::_intersect_packet(const Vector3 *p_begins, const Vector3 *p_targets, int p_count, bool p_segments, RayResult *r_results) const {
+	// Each stack entry holds a node and the rays of the packet still interested in it.
+	uint32_t *stack_nodes = (uint32_t *)alloca(sizeof(uint32_t) * (max_depth + 1));
+	uint32_t *stack_masks = (uint32_t *)alloca(sizeof(uint32_t) * (max_depth + 1));
+
+	Vector3 n[RAY_PACKET_SIZE];
+	real_t d[RAY_PACKET_SIZE];
+	for (int i = 0; i < p_count; i++) {
+		n[i] = p_segments ? (p_targets[i] - p_begins[i]).normalized() : p_targets[i];
+		d[i] = p_segments ? 1e10 : 1e20;
+		r_results[i] = RayResult();
+	}
+
+	const Triangle *triangleptr = triangles.ptr();
+	const Vector3 *vertexptr = vertices.ptr();
+	const BVH *bvhptr = bvh.ptr();
+
+	int level = 0;
+	stack_nodes[0] = bvh.size() - 1;
+	stack_masks[0] = (1u << p_count) - 1;
+
+	while (level >= 0) {
+		const BVH &b = bvhptr[stack_nodes[level]];
+		uint32_t mask = stack_masks[level];
+		level--;
+
+		uint32_t active = 0;
+		for (int i = 0; i < p_count; i++) {
+			if ((mask & (1u << i)) && (p_segments ? b.aabb.intersects_segment(p_begins[i], p_targets[i]) : b.aabb.intersects_ray(p_begins[i], p_targets[i]))) {
+				active |= 1u << i;
+			}
+		}
+		if (!active) {
+			continue;
+		}
+
+		if (b.face_index >= 0) {
+			const Triangle &s = triangleptr[b.face_index];
+			Face3 f3(vertexptr[s.indices[0]], vertexptr[s.indices[1]], vertexptr[s.indices[2]]);
+
+			for (int i = 0; i < p_count; i++) {
+				if (!(active & (1u << i))) {
+					continue;
+				}
+				Vector3 res;
+				if (p_segments ? f3.intersects_segment(p_begins[i], p_targets[i], &res) : f3.intersects_ray(p_begins[i], p_targets[i], &res)) {
+					real_t nd = n[i].dot(res);
+					if (nd < d[i]) {
+						d[i] = nd;
+						r_results[i].point = res;
+						r_results[i].normal = f3.get_plane().get_normal();
+						r_results[i].surface_index = s.surface_index;
+						r_results[i].hit = true;
+					}
+				}
+			}
+		} else {
+			level++;
+			stack_nodes[level] = b.right;
+			stack_masks[level] = active;
+			level++;
+			stack_nodes[level] = b.left;
+			stack_masks[level] = active;
+		}
+	}
+
+	for (int i = 0; i < p_count; i++) {
+		if (r_results[i].hit && n[i].dot(r_results[i].normal) > 0) {
+			r_results[i].normal = -r_results[i].normal;
+		}
+	}
+}
+
+void TriangleMesh::intersect_rays(const Vector3 *p_begins, const Vector3 *p_dirs, int p_count, RayResult *r_results) const {
+	ERR_FAIL_COND(!valid);
+	for (int i = 0; i < p_count; i += RAY_PACKET_SIZE) {
+		_intersect_packet(p_begins + i, p_dirs + i, MIN(int(RAY_PACKET_SIZE), p_count - i), false, r_results + i);
+	}
+}
+
+void TriangleMesh::intersect_segments(const Vector3 *p_begins, const Vector3 *p_ends, int p_count, RayResult *r_results) const {
+	ERR_FAIL_COND(!valid);
+	for (int i = 0; i < p_count; i += RAY_PACKET_SIZE) {
+		_intersect_packet(p_begins + i, p_ends + i, MIN(int(RAY_PACKET_SIZE), p_count - i), true, r_results + i);
+	}
+}
+
 bool TriangleMesh::inside_convex_shape(const Plane *p_planes, int p_plane_count, const Vector3 *p_points, int p_point_count, Vector3 p_scale) const {
 	uint32_t *stack = (uint32_t *)alloca(sizeof(int) * max_depth);
 
@@ -33,6 +33,7 @@
 
 #include "core/math/face3.h"
 #include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
 
 class TriangleMesh : public RefCounted {
 	GDCLASS(TriangleMesh, RefCounted);
@@ -44,6 +45,13 @@ public:
 		int32_t surface_index;
 	};
 
+	struct RayResult {
+		Vector3 point;
+		Vector3 normal;
+		int32_t surface_index = 0;
+		bool hit = false;
+	};
+
 private:
 	Vector<Triangle> triangles;
 	Vector<Vector3> vertices;
@@ -74,7 +82,34 @@ private:
 		}
 	};
 
-	int _create_bvh(BVH *p_bvh, BVH **p_bb, int p_from, int p_size, int p_depth, int &max_depth, int &max_alloc);
+	enum {
+		BVH_SAH_BINS = 16,
+		BVH_SAH_MAX_DEPTH = 48, // Deeper nodes use median splits, which keeps the traversal stack small.
+		BVH_PARALLEL_MIN_FACES = 16384,
+		RAY_PACKET_SIZE = 16,
+	};
+
+	// Subtrees are handed to the WorkerThreadPool once they are small enough. A subtree of N faces always
+	// uses N - 1 internal nodes, so every subtree knows where its nodes go before its parent is done.
+	struct BVHBuildTask {
+		int from = 0;
+		int size = 0;
+		int node_from = 0;
+		int depth = 0;
+		int max_depth = 0;
+	};
+
+	struct BVHBuild {
+		BVH *bvh = nullptr;
+		BVH **bb = nullptr;
+		int task_size = 0;
+		LocalVector<BVHBuildTask> tasks;
+	};
+
+	int _create_bvh(BVHBuild &p_build, int p_from, int p_size, int p_node_from, int p_depth, int &r_max_depth, bool p_defer);
+	int _split_bvh(BVH **p_bb, int p_size, const AABB &p_aabb, int p_depth);
+	void _create_bvh_task(uint32_t p_index, BVHBuild *p_build);
+	void _intersect_packet(const Vector3 *p_begins, const Vector3 *p_targets, int p_count, bool p_segments, RayResult *r_results) const;
 
 	Vector<BVH> bvh;
 	int max_depth;
@@ -84,6 +119,9 @@ public:
 	bool is_valid() const;
 	bool intersect_segment(const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_point, Vector3 &r_normal, int32_t *r_surf_index = nullptr) const;
 	bool intersect_ray(const Vector3 &p_begin, const Vector3 &p_dir, Vector3 &r_point, Vector3 &r_normal, int32_t *r_surf_index = nullptr) const;
+	// Trace many rays (or segments) at once, in packets that share the BVH traversal.
+	void intersect_rays(const Vector3 *p_begins, const Vector3 *p_dirs, int p_count, RayResult *r_results) const;
+	void intersect_segments(const Vector3 *p_begins, const Vector3 *p_ends, int p_count, RayResult *r_results) const;
 	bool inside_convex_shape(const Plane *p_planes, int p_plane_count, const Vector3 *p_points, int p_point_count, Vector3 p_scale = Vector3(1, 1, 1)) const;
 	Vector<Face3> get_faces() const;
 
@@ -164,6 +164,8 @@ ClassDB::APIType ClassDB::get_api_type(const StringName &p_class) {
 }
 
 uint32_t ClassDB::get_api_hash(APIType p_api) {
+	initialize_lazy_classes();
+
 	OBJTYPE_RLOCK;
 #ifdef DEBUG_METHODS_ENABLED
 
@@ -327,6 +329,8 @@ StringName ClassDB::get_compatibility_class(const StringName &p_class) {
 }
 
 Object *ClassDB::instantiate(const StringName &p_class) {
+	_initialize_lazy_class(p_class);
+
 	ClassInfo *ti;
 	{
 		OBJTYPE_RLOCK;
@@ -409,8 +413,18 @@ void ClassDB::_add_class2(const StringName &p_class, const StringName &p_inherit
 
 	const StringName &name = p_class;
 
-	ERR_FAIL_COND_MSG(classes.has(name), "Class '" + String(p_class) + "' already exists.");
+	ClassInfo *existing = classes.getptr(name);
+	if (existing && existing->lazy) {
+		// Registered with register_lazy_class() and being bound now, also when constructed directly.
+		if (existing->lazy_initializer) {
+			existing->lazy_initializer = nullptr;
+			lazy_pending_count.fetch_sub(1, std::memory_order_release);
+		}
+		return;
+	}
+	ERR_FAIL_COND_MSG(existing, "Class '" + String(p_class) + "' already exists.");
 
+	_invalidate_lookup_tables();
 	classes[name] = ClassInfo();
 	ClassInfo &ti = classes[name];
 	ti.name = name;
@@ -426,6 +440,82 @@ void ClassDB::_add_class2(const StringName &p_class, const StringName &p_inherit
 	}
 }
 
+bool ClassDB::_add_lazy_class(const StringName &p_class, const StringName &p_inherits, void (*p_initializer)()) {
+	OBJTYPE_WLOCK;
+
+	if (classes.has(p_class) || !classes.has(p_inherits)) {
+		return false; // Already initialized, or the parent was never registered on its own.
+	}
+
+	_invalidate_lookup_tables();
+	ClassInfo &ti = classes[p_class];
+	ti.name = p_class;
+	ti.inherits = p_inherits;
+	ti.inherits_ptr = &classes[p_inherits];
+	ti.api = current_api;
+	ti.lazy = true;
+	ti.lazy_initializer = p_initializer;
+	lazy_pending_count.fetch_add(1, std::memory_order_release);
+	return true;
+}
+
+void ClassDB::_initialize_lazy_class(const StringName &p_class) {
+	if (likely(lazy_pending_count.load(std::memory_order_acquire) == 0)) {
+		return;
+	}
+
+	// Not locked, like has_method(), classes are only added while registering types.
+	ClassInfo *ti = classes.getptr(p_class);
+	while (ti && !ti->lazy) {
+		ti = ti->inherits_ptr;
+	}
+	if (likely(!ti)) {
+		return;
+	}
+
+	MutexLock lazy_lock(lazy_mutex);
+	if (lazy_initializing) {
+		return; // Looked up while binding, the lock is recursive.
+	}
+	while (ti && !ti->lazy_initializer) {
+		ti = ti->inherits_ptr;
+	}
+	if (!ti) {
+		return; // Already bound.
+	}
+
+	// Binds the parents too.
+	lazy_initializing = true;
+	ti->lazy_initializer();
+	lazy_initializing = false;
+
+	for (; ti; ti = ti->inherits_ptr) {
+		if (ti->lazy_initializer) {
+			ti->lazy_initializer = nullptr;
+			lazy_pending_count.fetch_sub(1, std::memory_order_release);
+		}
+	}
+}
+
+void ClassDB::initialize_lazy_classes() {
+	if (lazy_pending_count.load(std::memory_order_acquire) == 0) {
+		return;
+	}
+
+	LocalVector<StringName> pending;
+	{
+		OBJTYPE_RLOCK;
+		for (const KeyValue<StringName, ClassInfo> &E : classes) {
+			if (E.value.lazy_initializer) {
+				pending.push_back(E.key);
+			}
+		}
+	}
+	for (const StringName &name : pending) {
+		_initialize_lazy_class(name);
+	}
+}
+
 static MethodInfo info_from_bind(MethodBind *p_method) {
 	MethodInfo minfo;
 	minfo.name = p_method->get_name();
@@ -448,6 +538,8 @@ static MethodInfo info_from_bind(MethodBind *p_method) {
 }
 
 void ClassDB::get_method_list(const StringName &p_class, List<MethodInfo> *p_methods, bool p_no_inheritance, bool p_exclude_from_properties) {
+	_initialize_lazy_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -498,6 +590,8 @@ void ClassDB::get_method_list(const StringName &p_class, List<MethodInfo> *p_met
 }
 
 bool ClassDB::get_method_info(const StringName &p_class, const StringName &p_method, MethodInfo *r_info, bool p_no_inheritance, bool p_exclude_from_properties) {
+	_initialize_lazy_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -548,6 +642,20 @@ bool ClassDB::get_method_info(const StringName &p_class, const StringName &p_met
 }
 
 MethodBind *ClassDB::get_method(const StringName &p_class, const StringName &p_name) {
+	LookupTables *tables = lookup_tables.load(std::memory_order_acquire);
+	if (likely(tables)) {
+		ClassLookupTable **table = tables->classes.getptr(p_class);
+		if (!table) {
+			return nullptr;
+		}
+		if (likely(!(*table)->lazy)) {
+			MethodBind **method = (*table)->methods.getptr(p_name);
+			return method ? *method : nullptr;
+		}
+	}
+
+	_initialize_lazy_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -563,6 +671,8 @@ MethodBind *ClassDB::get_method(const StringName &p_class, const StringName &p_n
 }
 
 Vector<uint32_t> ClassDB::get_method_compatibility_hashes(const StringName &p_class, const StringName &p_name) {
+	_initialize_lazy_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -582,6 +692,8 @@ Vector<uint32_t> ClassDB::get_method_compatibility_hashes(const StringName &p_cl
 }
 
 MethodBind *ClassDB::get_method_with_compatibility(const StringName &p_class, const StringName &p_name, uint64_t p_hash, bool *r_method_exists, bool *r_is_deprecated) {
+	_initialize_lazy_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -654,6 +766,8 @@ void ClassDB::bind_integer_constant(const StringName &p_class, const StringName
 }
 
 void ClassDB::get_integer_constant_list(const StringName &p_class, List<String> *p_constants, bool p_no_inheritance) {
+	_initialize_lazy_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -679,6 +793,8 @@ void ClassDB::get_integer_constant_list(const StringName &p_class, List<String>
 }
 
 int64_t ClassDB::get_integer_constant(const StringName &p_class, const StringName &p_name, bool *p_success) {
+	_initialize_lazy_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -703,6 +819,8 @@ int64_t ClassDB::get_integer_constant(const StringName &p_class, const StringNam
 }
 
 bool ClassDB::has_integer_constant(const StringName &p_class, const StringName &p_name, bool p_no_inheritance) {
+	_initialize_lazy_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -722,6 +840,8 @@ bool ClassDB::has_integer_constant(const StringName &p_class, const StringName &
 }
 
 StringName ClassDB::get_integer_constant_enum(const StringName &p_class, const StringName &p_name, bool p_no_inheritance) {
+	_initialize_lazy_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -746,6 +866,8 @@ StringName ClassDB::get_integer_constant_enum(const StringName &p_class, const S
 }
 
 void ClassDB::get_enum_list(const StringName &p_class, List<StringName> *p_enums, bool p_no_inheritance) {
+	_initialize_lazy_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -764,6 +886,8 @@ void ClassDB::get_enum_list(const StringName &p_class, List<StringName> *p_enums
 }
 
 void ClassDB::get_enum_constants(const StringName &p_class, const StringName &p_enum, List<StringName> *p_constants, bool p_no_inheritance) {
+	_initialize_lazy_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -797,6 +921,8 @@ void ClassDB::set_method_error_return_values(const StringName &p_class, const St
 }
 
 Vector<Error> ClassDB::get_method_error_return_values(const StringName &p_class, const StringName &p_method) {
+	_initialize_lazy_class(p_class);
+
 #ifdef DEBUG_METHODS_ENABLED
 	ClassInfo *type = classes.getptr(p_class);
 
@@ -812,6 +938,8 @@ Vector<Error> ClassDB::get_method_error_return_values(const StringName &p_class,
 }
 
 bool ClassDB::has_enum(const StringName &p_class, const StringName &p_name, bool p_no_inheritance) {
+	_initialize_lazy_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -831,6 +959,8 @@ bool ClassDB::has_enum(const StringName &p_class, const StringName &p_name, bool
 }
 
 bool ClassDB::is_enum_bitfield(const StringName &p_class, const StringName &p_name, bool p_no_inheritance) {
+	_initialize_lazy_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -869,6 +999,8 @@ void ClassDB::add_signal(const StringName &p_class, const MethodInfo &p_signal)
 }
 
 void ClassDB::get_signal_list(const StringName &p_class, List<MethodInfo> *p_signals, bool p_no_inheritance) {
+	_initialize_lazy_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -890,6 +1022,8 @@ void ClassDB::get_signal_list(const StringName &p_class, List<MethodInfo> *p_sig
 }
 
 bool ClassDB::has_signal(const StringName &p_class, const StringName &p_signal, bool p_no_inheritance) {
+	_initialize_lazy_class(p_class);
+
 	OBJTYPE_RLOCK;
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
@@ -907,6 +1041,8 @@ bool ClassDB::has_signal(const StringName &p_class, const StringName &p_signal,
 }
 
 bool ClassDB::get_signal(const StringName &p_class, const StringName &p_signal, MethodInfo *r_signal) {
+	_initialize_lazy_class(p_class);
+
 	OBJTYPE_RLOCK;
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
@@ -1017,6 +1153,9 @@ void ClassDB::add_property(const StringName &p_class, const PropertyInfo &p_pinf
 	psg.index = p_index;
 	psg.type = p_pinfo.type;
 
+	if (!type->lazy) {
+		_invalidate_lookup_tables();
+	}
 	type->property_setget[p_pinfo.name] = psg;
 }
 
@@ -1045,6 +1184,8 @@ void ClassDB::add_linked_property(const StringName &p_class, const String &p_pro
 }
 
 void ClassDB::get_property_list(const StringName &p_class, List<PropertyInfo> *p_list, bool p_no_inheritance, const Object *p_validator) {
+	_initialize_lazy_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *type = classes.getptr(p_class);
@@ -1069,6 +1210,8 @@ void ClassDB::get_property_list(const StringName &p_class, List<PropertyInfo> *p
 }
 
 void ClassDB::get_linked_properties_info(const StringName &p_class, const StringName &p_property, List<StringName> *r_properties, bool p_no_inheritance) {
+	_initialize_lazy_class(p_class);
+
 #ifdef TOOLS_ENABLED
 	ClassInfo *check = classes.getptr(p_class);
 	while (check) {
@@ -1088,6 +1231,8 @@ void ClassDB::get_linked_properties_info(const StringName &p_class, const String
 }
 
 bool ClassDB::get_property_info(const StringName &p_class, const StringName &p_property, PropertyInfo *r_info, bool p_no_inheritance, const Object *p_validator) {
+	_initialize_lazy_class(p_class);
+
 	OBJTYPE_RLOCK;
 
 	ClassInfo *check = classes.getptr(p_class);
@@ -1114,50 +1259,64 @@ bool ClassDB::get_property_info(const StringName &p_class, const StringName &p_p
 bool ClassDB::set_property(Object *p_object, const StringName &p_property, const Variant &p_value, bool *r_valid) {
 	ERR_FAIL_NULL_V(p_object, false);
 
-	ClassInfo *type = classes.getptr(p_object->get_class_name());
-	ClassInfo *check = type;
-	while (check) {
-		const PropertySetGet *psg = check->property_setget.getptr(p_property);
-		if (psg) {
-			if (!psg->setter) {
-				if (r_valid) {
-					*r_valid = false;
-				}
-				return true; //return true but do nothing
+	const PropertySetGet *psg = nullptr;
+	LookupTables *tables = lookup_tables.load(std::memory_order_acquire);
+	if (likely(tables)) {
+		ClassLookupTable **table = tables->classes.getptr(p_object->get_class_name());
+		if (unlikely(table && (*table)->lazy)) {
+			tables = nullptr; // Not flattened, look it up below.
+		} else {
+			const PropertySetGet **found = table ? (*table)->property_setget.getptr(p_property) : nullptr;
+			if (found) {
+				psg = *found;
 			}
+		}
+	}
+	if (!tables) {
+		ClassInfo *check = classes.getptr(p_object->get_class_name());
+		while (check && !psg) {
+			psg = check->property_setget.getptr(p_property);
+			check = check->inherits_ptr;
+		}
+	}
 
-			Callable::CallError ce;
+	if (!psg) {
+		return false;
+	}
 
-			if (psg->index >= 0) {
-				Variant index = psg->index;
-				const Variant *arg[2] = { &index, &p_value };
-				//p_object->call(psg->setter,arg,2,ce);
-				if (psg->_setptr) {
-					psg->_setptr->call(p_object, arg, 2, ce);
-				} else {
-					p_object->callp(psg->setter, arg, 2, ce);
-				}
+	if (!psg->setter) {
+		if (r_valid) {
+			*r_valid = false;
+		}
+		return true; //return true but do nothing
+	}
 
-			} else {
-				const Variant *arg[1] = { &p_value };
-				if (psg->_setptr) {
-					psg->_setptr->call(p_object, arg, 1, ce);
-				} else {
-					p_object->callp(psg->setter, arg, 1, ce);
-				}
-			}
+	Callable::CallError ce;
 
-			if (r_valid) {
-				*r_valid = ce.error == Callable::CallError::CALL_OK;
-			}
+	if (psg->index >= 0) {
+		Variant index = psg->index;
+		const Variant *arg[2] = { &index, &p_value };
+		//p_object->call(psg->setter,arg,2,ce);
+		if (psg->_setptr) {
+			psg->_setptr->call(p_object, arg, 2, ce);
+		} else {
+			p_object->callp(psg->setter, arg, 2, ce);
+		}
 
-			return true;
+	} else {
+		const Variant *arg[1] = { &p_value };
+		if (psg->_setptr) {
+			psg->_setptr->call(p_object, arg, 1, ce);
+		} else {
+			p_object->callp(psg->setter, arg, 1, ce);
 		}
+	}
 
-		check = check->inherits_ptr;
+	if (r_valid) {
+		*r_valid = ce.error == Callable::CallError::CALL_OK;
 	}
 
-	return false;
+	return true;
 }
 
 bool ClassDB::get_property(Object *p_object, const StringName &p_property, Variant &r_value) {
@@ -1212,6 +1371,8 @@ bool ClassDB::get_property(Object *p_object, const StringName &p_property, Varia
 }
 
 int ClassDB::get_property_index(const StringName &p_class, const StringName &p_property, bool *r_is_valid) {
+	_initialize_lazy_class(p_class);
+
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
 	while (check) {
@@ -1234,6 +1395,8 @@ int ClassDB::get_property_index(const StringName &p_class, const StringName &p_p
 }
 
 Variant::Type ClassDB::get_property_type(const StringName &p_class, const StringName &p_property, bool *r_is_valid) {
+	_initialize_lazy_class(p_class);
+
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
 	while (check) {
@@ -1256,6 +1419,8 @@ Variant::Type ClassDB::get_property_type(const StringName &p_class, const String
 }
 
 StringName ClassDB::get_property_setter(const StringName &p_class, const StringName &p_property) {
+	_initialize_lazy_class(p_class);
+
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
 	while (check) {
@@ -1271,6 +1436,8 @@ StringName ClassDB::get_property_setter(const StringName &p_class, const StringN
 }
 
 StringName ClassDB::get_property_getter(const StringName &p_class, const StringName &p_property) {
+	_initialize_lazy_class(p_class);
+
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
 	while (check) {
@@ -1286,6 +1453,8 @@ StringName ClassDB::get_property_getter(const StringName &p_class, const StringN
 }
 
 bool ClassDB::has_property(const StringName &p_class, const StringName &p_property, bool p_no_inheritance) {
+	_initialize_lazy_class(p_class);
+
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
 	while (check) {
@@ -1312,6 +1481,8 @@ void ClassDB::set_method_flags(const StringName &p_class, const StringName &p_me
 }
 
 bool ClassDB::has_method(const StringName &p_class, const StringName &p_method, bool p_no_inheritance) {
+	_initialize_lazy_class(p_class);
+
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
 	while (check) {
@@ -1361,6 +1532,9 @@ void ClassDB::_bind_method_custom(const StringName &p_class, MethodBind *p_metho
 	type->method_order.push_back(p_method->get_name());
 #endif
 
+	if (!type->lazy) {
+		_invalidate_lookup_tables();
+	}
 	type->method_map[p_method->get_name()] = p_method;
 }
 
@@ -1387,6 +1561,9 @@ MethodBind *ClassDB::_bind_vararg_method(MethodBind *p_bind, const StringName &p
 		// Overloading not supported
 		ERR_FAIL_V_MSG(nullptr, "Method already bound: " + instance_type + "::" + p_name + ".");
 	}
+	if (!type->lazy) {
+		_invalidate_lookup_tables();
+	}
 	type->method_map[p_name] = bind;
 #ifdef DEBUG_METHODS_ENABLED
 	// FIXME: <reduz> set_return_type is no longer in MethodBind, so I guess it should be moved to vararg method bind
@@ -1445,6 +1622,9 @@ MethodBind *ClassDB::bind_methodfi(uint32_t p_flags, MethodBind *p_bind, bool p_
 	if (p_compatibility) {
 		_bind_compatibility(type, p_bind);
 	} else {
+		if (!type->lazy) {
+			_invalidate_lookup_tables();
+		}
 		type->method_map[mdname] = p_bind;
 	}
 
@@ -1495,6 +1675,8 @@ void ClassDB::add_virtual_method(const StringName &p_class, const MethodInfo &p_
 }
 
 void ClassDB::get_virtual_methods(const StringName &p_class, List<MethodInfo> *p_methods, bool p_no_inheritance) {
+	_initialize_lazy_class(p_class);
+
 	ERR_FAIL_COND_MSG(!classes.has(p_class), "Request for nonexistent class '" + p_class + "'.");
 
 #ifdef DEBUG_METHODS_ENABLED
@@ -1574,6 +1756,8 @@ HashMap<StringName, HashMap<StringName, Variant>> ClassDB::default_values;
 HashSet<StringName> ClassDB::default_values_cached;
 
 Variant ClassDB::class_get_default_property_value(const StringName &p_class, const StringName &p_property, bool *r_valid) {
+	_initialize_lazy_class(p_class);
+
 	if (!default_values_cached.has(p_class)) {
 		if (!default_values.has(p_class)) {
 			default_values[p_class] = HashMap<StringName, Variant>();
@@ -1683,12 +1867,14 @@ void ClassDB::register_extension_class(ObjectGDExtension *p_extension) {
 		}
 	}
 
+	_invalidate_lookup_tables();
 	classes[p_extension->class_name] = c;
 }
 
 void ClassDB::unregister_extension_class(const StringName &p_class) {
 	ClassInfo *c = classes.getptr(p_class);
 	ERR_FAIL_NULL_MSG(c, "Class '" + String(p_class) + "' does not exist.");
+	_invalidate_lookup_tables();
 	for (KeyValue<StringName, MethodBind *> &F : c->method_map) {
 		memdelete(F.value);
 	}
@@ -1721,6 +1907,113 @@ uint64_t ClassDB::get_native_struct_size(const StringName &p_name) {
 
 RWLock ClassDB::lock;
 
+std::atomic<ClassDB::LookupTables *> ClassDB::lookup_tables = nullptr;
+Mutex ClassDB::lazy_mutex;
+bool ClassDB::lazy_initializing = false;
+std::atomic<uint32_t> ClassDB::lazy_pending_count = 0;
+LocalVector<ClassDB::LookupTables *> ClassDB::retired_lookup_tables;
+bool ClassDB::lookup_tables_enabled = false;
+
+void ClassDB::_invalidate_lookup_tables() {
+	LookupTables *tables = lookup_tables.exchange(nullptr, std::memory_order_acq_rel);
+	if (tables) {
+		retired_lookup_tables.push_back(tables);
+	}
+}
+
+void ClassDB::build_lookup_tables() {
+	OBJTYPE_WLOCK;
+
+	LookupTables *tables = memnew(LookupTables);
+	tables->classes.reserve(classes.size());
+
+	for (const KeyValue<StringName, ClassInfo> &E : classes) {
+		ClassLookupTable *table = memnew(ClassLookupTable);
+
+		for (const ClassInfo *check = &E.value; check; check = check->inherits_ptr) {
+			if (check->lazy) {
+				// May still be bound later, without dropping the tables.
+				table->lazy = true;
+				break;
+			}
+		}
+
+		// Walk up from the class itself, so members found first shadow the inherited ones.
+		for (const ClassInfo *check = &E.value; check && !table->lazy; check = check->inherits_ptr) {
+			for (const KeyValue<StringName, MethodBind *> &F : check->method_map) {
+				if (F.value && !table->methods.has(F.key)) {
+					table->methods.insert(F.key, F.value);
+				}
+			}
+			for (const KeyValue<StringName, PropertySetGet> &F : check->property_setget) {
+				if (!table->property_setget.has(F.key)) {
+					table->property_setget.insert(F.key, &F.value);
+				}
+			}
+		}
+
+		tables->classes.insert(E.key, table);
+	}
+
+	_invalidate_lookup_tables();
+	lookup_tables.store(tables, std::memory_order_release);
+	lookup_tables_enabled = true;
+}
+
+void ClassDB::refresh_lookup_tables() {
+	{
+		OBJTYPE_RLOCK;
+		if (!lookup_tables_enabled || lookup_tables.load(std::memory_order_acquire)) {
+			return;
+		}
+	}
+	build_lookup_tables();
+}
+
+const ClassDB::ClassInfo *ClassDB::get_instantiable_class_info(const StringName &p_class) {
+	_initialize_lazy_class(p_class);
+
+	OBJTYPE_RLOCK;
+	// Same checks as instantiate(), without the errors. Callers fall back to it to report them.
+	ClassInfo *ti = classes.getptr(p_class);
+	if (!ti || ti->disabled || !ti->creation_func || (ti->gdextension && !ti->gdextension->create_instance)) {
+		if (compat_classes.has(p_class)) {
+			ti = classes.getptr(compat_classes[p_class]);
+		}
+	}
+	if (!ti || ti->disabled || !ti->creation_func) {
+		return nullptr;
+	}
+#ifdef TOOLS_ENABLED
+	if (ti->api == API_EDITOR && !Engine::get_singleton()->is_editor_hint()) {
+		return nullptr;
+	}
+#endif
+	return ti;
+}
+
+Object *ClassDB::instantiate_class_info(const ClassInfo *p_info) {
+	ERR_FAIL_NULL_V(p_info, nullptr);
+	if (p_info->gdextension && p_info->gdextension->create_instance) {
+		return (Object *)p_info->gdextension->create_instance(p_info->gdextension->class_userdata);
+	} else {
+		return p_info->creation_func();
+	}
+}
+
+const ClassDB::PropertySetGet *ClassDB::get_property_setget(const StringName &p_class, const StringName &p_property) {
+	LookupTables *tables = lookup_tables.load(std::memory_order_acquire);
+	if (!tables) {
+		return nullptr;
+	}
+	ClassLookupTable **table = tables->classes.getptr(p_class);
+	if (!table || (*table)->lazy) {
+		return nullptr;
+	}
+	const PropertySetGet **found = (*table)->property_setget.getptr(p_property);
+	return found ? *found : nullptr;
+}
+
 void ClassDB::cleanup_defaults() {
 	default_values.clear();
 	default_values_cached.clear();
@@ -1729,6 +2022,13 @@ void ClassDB::cleanup_defaults() {
 void ClassDB::cleanup() {
 	//OBJTYPE_LOCK; hah not here
 
+	lookup_tables_enabled = false;
+	_invalidate_lookup_tables();
+	for (LookupTables *tables : retired_lookup_tables) {
+		memdelete(tables);
+	}
+	retired_lookup_tables.clear();
+
 	for (KeyValue<StringName, ClassInfo> &E : classes) {
 		ClassInfo &ti = E.value;
 
@@ -1743,6 +2043,7 @@ void ClassDB::cleanup() {
 	}
 
 	classes.clear();
+	lazy_pending_count.store(0, std::memory_order_release);
 	resource_base_extensions.clear();
 	compat_classes.clear();
 	native_structs.clear();
@@ -38,8 +38,10 @@
 // Makes callable_mp readily available in all classes connecting signals.
 // Needs to come after method_bind and object have been included.
 #include "core/object/callable_method_pointer.h"
+#include "core/templates/flat_hash_map.h"
 #include "core/templates/hash_set.h"
 
+#include <atomic>
 #include <type_traits>
 
 #define DEFVAL(m_defval) (m_defval)
@@ -132,6 +134,8 @@ public:
 		bool disabled = false;
 		bool exposed = false;
 		bool is_virtual = false;
+		bool lazy = false; // Registered with register_lazy_class(), never flattened in the lookup tables.
+		void (*lazy_initializer)() = nullptr; // Set until its methods, properties and signals are bound.
 		Object *(*creation_func)() = nullptr;
 
 		ClassInfo() {}
@@ -169,6 +173,41 @@ public:
 	};
 	static HashMap<StringName, NativeStruct> native_structs;
 
+	// Every class with its inherited methods and properties flattened in, so the hottest queries are
+	// a single probe per table without taking the lock. Built once classes are registered,
+	// and dropped if they change afterwards until built again.
+	struct ClassLookupTable {
+		FlatHashMap<StringName, MethodBind *> methods;
+		FlatHashMap<StringName, const PropertySetGet *> property_setget;
+		bool lazy = false; // Inherits a lazy class, use the regular lookups.
+	};
+	struct LookupTables {
+		FlatHashMap<StringName, ClassLookupTable *> classes;
+
+		~LookupTables() {
+			for (KeyValue<StringName, ClassLookupTable *> &E : classes) {
+				memdelete(E.value);
+			}
+		}
+	};
+	static std::atomic<LookupTables *> lookup_tables;
+	static LocalVector<LookupTables *> retired_lookup_tables; // Lock-free readers may still use them, freed on cleanup.
+	static bool lookup_tables_enabled; // build_lookup_tables() was called, so later registrations should rebuild them.
+
+	static void _invalidate_lookup_tables();
+
+	static Mutex lazy_mutex;
+	static bool lazy_initializing;
+	static std::atomic<uint32_t> lazy_pending_count;
+
+	static bool _add_lazy_class(const StringName &p_class, const StringName &p_inherits, void (*p_initializer)());
+	static void _initialize_lazy_class(const StringName &p_class);
+
+	template <class T>
+	static void _initialize_lazy() {
+		T::initialize_class();
+	}
+
 private:
 	// Non-locking variants of get_parent_class and is_parent_class.
 	static StringName _get_parent_class(const StringName &p_class);
@@ -199,6 +238,29 @@ public:
 		T::register_custom_data_to_otdb();
 	}
 
+	// Like register_class(), but the methods, properties and signals are only bound the first time
+	// the class is looked up or instantiated through ClassDB, to speed up startup for rarely used classes.
+	// Constructing it directly also binds it, but without locking, so don't use this for classes that
+	// may be first constructed with memnew() from several threads.
+	template <class T>
+	static void register_lazy_class() {
+		GLOBAL_LOCK_FUNCTION;
+		static_assert(TypesAreSame<typename T::self_type, T>::value, "Class not declared properly, please use GDCLASS.");
+		if (!_add_lazy_class(T::get_class_static(), T::get_parent_class_static(), &_initialize_lazy<T>)) {
+			register_class<T>();
+			return;
+		}
+		ClassInfo *t = classes.getptr(T::get_class_static());
+		ERR_FAIL_NULL(t);
+		t->creation_func = &creator<T>;
+		t->exposed = true;
+		t->class_ptr = T::get_class_ptr_static();
+		T::register_custom_data_to_otdb();
+	}
+
+	// Binds all the classes registered with register_lazy_class(), for tools that read ClassInfo directly.
+	static void initialize_lazy_classes();
+
 	template <class T>
 	static void register_abstract_class() {
 		GLOBAL_LOCK_FUNCTION;
@@ -437,6 +499,17 @@ public:
 
 	static void set_current_api(APIType p_api);
 	static APIType get_current_api();
+	static void build_lookup_tables();
+	// Rebuilds the tables if they were built before and registering or unregistering classes dropped them.
+	static void refresh_lookup_tables();
+
+	// For callers caching class lookups across calls, such as SceneState. The returned pointers stay valid while
+	// get_lookup_tables_id() doesn't change, which happens whenever classes are registered or modified.
+	static const void *get_lookup_tables_id() { return lookup_tables.load(std::memory_order_acquire); }
+	static const ClassInfo *get_instantiable_class_info(const StringName &p_class);
+	static Object *instantiate_class_info(const ClassInfo *p_info);
+	static const PropertySetGet *get_property_setget(const StringName &p_class, const StringName &p_property);
+
 	static void cleanup_defaults();
 	static void cleanup();
 
@@ -494,6 +567,10 @@ _FORCE_INLINE_ Vector<Error> errarray(P... p_args) {
 	if (m_class::_class_is_enabled) {             \
 		::ClassDB::register_class<m_class>(true); \
 	}
+#define GDREGISTER_LAZY_CLASS(m_class)             \
+	if (m_class::_class_is_enabled) {              \
+		::ClassDB::register_lazy_class<m_class>(); \
+	}
 #define GDREGISTER_ABSTRACT_CLASS(m_class)             \
 	if (m_class::_class_is_enabled) {                  \
 		::ClassDB::register_abstract_class<m_class>(); \
@@ -30,10 +30,13 @@
 
 #include "message_queue.h"
 
+#include "core/config/engine.h"
 #include "core/config/project_settings.h"
 #include "core/core_string_names.h"
 #include "core/object/class_db.h"
 #include "core/object/script_language.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
 
 #ifdef DEV_ENABLED
 // Includes sanity checks to ensure that a queue set as a thread singleton override
@@ -82,30 +85,49 @@ Error CallQueue::push_set(Object *p_object, const StringName &p_prop, const Vari
 	return push_set(p_object->get_instance_id(), p_prop, p_value);
 }
 
-Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error) {
-	uint32_t room_needed = sizeof(Message) + sizeof(Variant) * p_argcount;
-
-	ERR_FAIL_COND_V_MSG(room_needed > uint32_t(PAGE_SIZE_BYTES), ERR_INVALID_PARAMETER, "Message is too large to fit on a page (" + itos(PAGE_SIZE_BYTES) + " bytes), consider passing less arguments.");
+CallQueue *CallQueue::_get_push_queue() {
+	if (this == MessageQueue::main_singleton && !Thread::is_main_thread()) {
+		return MessageQueue::_get_thread_queue();
+	}
+	return this;
+}
 
+CallQueue::Message *CallQueue::_push_begin(uint32_t p_room_needed) {
 	LOCK_MUTEX;
 
 	_ensure_first_page();
 
-	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
+	if ((page_bytes[pages_used - 1] + p_room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
 		if (pages_used == max_pages) {
-			ERR_PRINT("Failed method: " + p_callable + ". Message queue out of memory. " + error_text);
-			statistics();
 			UNLOCK_MUTEX;
-			return ERR_OUT_OF_MEMORY;
+			return nullptr;
 		}
 		_add_page();
 	}
 
-	Page *page = pages[pages_used - 1];
+	Message *msg = (Message *)&pages[pages_used - 1]->data[page_bytes[pages_used - 1]];
+	page_bytes[pages_used - 1] += p_room_needed;
+	return msg;
+}
 
-	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
+void CallQueue::_push_end() {
+	UNLOCK_MUTEX;
+}
+
+Error CallQueue::_push_call_begin(const Callable &p_callable, int p_argcount, bool p_show_error, CallQueue *&r_queue, Message *&r_message) {
+	uint32_t room_needed = sizeof(Message) + sizeof(Variant) * p_argcount;
+
+	ERR_FAIL_COND_V_MSG(room_needed > uint32_t(PAGE_SIZE_BYTES), ERR_INVALID_PARAMETER, "Message is too large to fit on a page (" + itos(PAGE_SIZE_BYTES) + " bytes), consider passing less arguments.");
 
-	Message *msg = memnew_placement(buffer_end, Message);
+	r_queue = _get_push_queue();
+	r_message = r_queue->_push_begin(room_needed);
+	if (!r_message) {
+		ERR_PRINT("Failed method: " + p_callable + ". Message queue out of memory. " + r_queue->error_text);
+		r_queue->statistics();
+		return ERR_OUT_OF_MEMORY;
+	}
+
+	Message *msg = memnew_placement(r_message, Message);
 	msg->args = p_argcount;
 	msg->callable = p_callable;
 	msg->type = TYPE_CALL;
@@ -117,90 +139,69 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 		msg->type |= FLAG_NULL_IS_OK;
 	}
 
-	buffer_end += sizeof(Message);
+	return OK;
+}
 
-	for (int i = 0; i < p_argcount; i++) {
-		Variant *v = memnew_placement(buffer_end, Variant);
-		buffer_end += sizeof(Variant);
-		*v = *p_args[i];
+Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error) {
+	CallQueue *queue = nullptr;
+	Message *msg = nullptr;
+	Error err = _push_call_begin(p_callable, p_argcount, p_show_error, queue, msg);
+	if (err != OK) {
+		return err;
 	}
 
-	page_bytes[pages_used - 1] += room_needed;
+	Variant *args = (Variant *)(msg + 1);
+	for (int i = 0; i < p_argcount; i++) {
+		memnew_placement(&args[i], Variant(*p_args[i]));
+	}
 
-	UNLOCK_MUTEX;
+	queue->_push_end();
 
 	return OK;
 }
 
 Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value) {
-	LOCK_MUTEX;
-	uint32_t room_needed = sizeof(Message) + sizeof(Variant);
-
-	_ensure_first_page();
-
-	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
-			String type;
-			if (ObjectDB::get_instance(p_id)) {
-				type = ObjectDB::get_instance(p_id)->get_class();
-			}
-			ERR_PRINT("Failed set: " + type + ":" + p_prop + " target ID: " + itos(p_id) + ". Message queue out of memory. " + error_text);
-			statistics();
-
-			UNLOCK_MUTEX;
-			return ERR_OUT_OF_MEMORY;
+	CallQueue *queue = _get_push_queue();
+	Message *msg = queue->_push_begin(sizeof(Message) + sizeof(Variant));
+	if (!msg) {
+		String type;
+		if (ObjectDB::get_instance(p_id)) {
+			type = ObjectDB::get_instance(p_id)->get_class();
 		}
-		_add_page();
+		ERR_PRINT("Failed set: " + type + ":" + p_prop + " target ID: " + itos(p_id) + ". Message queue out of memory. " + queue->error_text);
+		queue->statistics();
+		return ERR_OUT_OF_MEMORY;
 	}
 
-	Page *page = pages[pages_used - 1];
-	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
-
-	Message *msg = memnew_placement(buffer_end, Message);
+	memnew_placement(msg, Message);
 	msg->args = 1;
 	msg->callable = Callable(p_id, p_prop);
 	msg->type = TYPE_SET;
 
-	buffer_end += sizeof(Message);
+	memnew_placement(msg + 1, Variant(p_value));
 
-	Variant *v = memnew_placement(buffer_end, Variant);
-	*v = p_value;
-
-	page_bytes[pages_used - 1] += room_needed;
-	UNLOCK_MUTEX;
+	queue->_push_end();
 
 	return OK;
 }
 
 Error CallQueue::push_notification(ObjectID p_id, int p_notification) {
 	ERR_FAIL_COND_V(p_notification < 0, ERR_INVALID_PARAMETER);
-	LOCK_MUTEX;
-	uint32_t room_needed = sizeof(Message);
 
-	_ensure_first_page();
-
-	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
-			ERR_PRINT("Failed notification: " + itos(p_notification) + " target ID: " + itos(p_id) + ". Message queue out of memory. " + error_text);
-			statistics();
-			UNLOCK_MUTEX;
-			return ERR_OUT_OF_MEMORY;
-		}
-		_add_page();
+	CallQueue *queue = _get_push_queue();
+	Message *msg = queue->_push_begin(sizeof(Message));
+	if (!msg) {
+		ERR_PRINT("Failed notification: " + itos(p_notification) + " target ID: " + itos(p_id) + ". Message queue out of memory. " + queue->error_text);
+		queue->statistics();
+		return ERR_OUT_OF_MEMORY;
 	}
 
-	Page *page = pages[pages_used - 1];
-	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
-
-	Message *msg = memnew_placement(buffer_end, Message);
-
+	memnew_placement(msg, Message);
 	msg->type = TYPE_NOTIFICATION;
 	msg->callable = Callable(p_id, CoreStringNames::get_singleton()->notification); //name is meaningless but callable needs it
-	//msg->target;
 	msg->notification = p_notification;
 
-	page_bytes[pages_used - 1] += room_needed;
-	UNLOCK_MUTEX;
+	queue->_push_end();
 
 	return OK;
 }
@@ -228,7 +229,7 @@ Error CallQueue::_transfer_messages_to_main_queue() {
 	}
 
 	CallQueue *mq = MessageQueue::main_singleton;
-	DEV_ASSERT(!mq->allocator_is_custom && !allocator_is_custom); // Transferring pages is only safe if using the same alloator parameters.
+	DEV_ASSERT((!mq->allocator_is_custom && !allocator_is_custom) || allocator == mq->allocator); // Transferring pages is only safe if using the same alloator parameters.
 
 	mq->mutex.lock();
 
@@ -280,6 +281,11 @@ Error CallQueue::flush() {
 		return _transfer_messages_to_main_queue();
 	}
 
+	const bool is_main_queue = this == MessageQueue::main_singleton;
+	if (is_main_queue) {
+		MessageQueue::_merge_thread_queues();
+	}
+
 	LOCK_MUTEX;
 
 	if (pages.size() == 0) {
@@ -295,6 +301,9 @@ Error CallQueue::flush() {
 
 	flushing = true;
 
+	const uint64_t flush_start = is_main_queue ? OS::get_singleton()->get_ticks_usec() : 0;
+	uint32_t flushed_messages = 0;
+
 	uint32_t i = 0;
 	uint32_t offset = 0;
 
@@ -345,6 +354,7 @@ Error CallQueue::flush() {
 		}
 
 		message->~Message();
+		flushed_messages++;
 
 		LOCK_MUTEX;
 		if (offset == page_bytes[i]) {
@@ -358,6 +368,10 @@ Error CallQueue::flush() {
 
 	flushing = false;
 	UNLOCK_MUTEX;
+
+	if (is_main_queue) {
+		MessageQueue::_record_flush(flushed_messages, OS::get_singleton()->get_ticks_usec() - flush_start);
+	}
 	return OK;
 }
 
@@ -501,7 +515,7 @@ bool CallQueue::is_flushing() const {
 	return flushing;
 }
 
-bool CallQueue::has_messages() const {
+bool CallQueue::_has_own_messages() const {
 	if (pages_used == 0) {
 		return false;
 	}
@@ -512,6 +526,40 @@ bool CallQueue::has_messages() const {
 	return true;
 }
 
+int CallQueue::_get_own_message_count() const {
+	int count = 0;
+	for (uint32_t i = 0; i < pages_used; i++) {
+		uint32_t offset = 0;
+		while (offset < page_bytes[i]) {
+			const Message *message = (const Message *)&pages[i]->data[offset];
+			offset += sizeof(Message);
+			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
+				offset += sizeof(Variant) * message->args;
+			}
+			count++;
+		}
+	}
+	return count;
+}
+
+bool CallQueue::has_messages() const {
+	if (_has_own_messages()) {
+		return true;
+	}
+	return this == MessageQueue::main_singleton && MessageQueue::_thread_queues_have_messages();
+}
+
+int CallQueue::get_message_count() const {
+	LOCK_MUTEX;
+	int count = _get_own_message_count();
+	UNLOCK_MUTEX;
+
+	if (this == MessageQueue::main_singleton) {
+		count += MessageQueue::_get_thread_queues_message_count();
+	}
+	return count;
+}
+
 int CallQueue::get_max_buffer_usage() const {
 	return pages.size() * PAGE_SIZE_BYTES;
 }
@@ -548,6 +596,90 @@ CallQueue::~CallQueue() {
 CallQueue *MessageQueue::main_singleton = nullptr;
 thread_local CallQueue *MessageQueue::thread_singleton = nullptr;
 
+thread_local CallQueue *MessageQueue::thread_queue = nullptr;
+thread_local uint32_t MessageQueue::thread_queue_generation = 0;
+uint32_t MessageQueue::generation = 0;
+Mutex MessageQueue::thread_queues_mutex;
+LocalVector<CallQueue *> MessageQueue::thread_queues;
+
+uint64_t MessageQueue::stats_frame = 0;
+uint32_t MessageQueue::frame_flushed_messages = 0;
+uint64_t MessageQueue::frame_flush_usec = 0;
+uint32_t MessageQueue::last_frame_flushed_messages = 0;
+uint64_t MessageQueue::last_frame_flush_usec = 0;
+
+CallQueue *MessageQueue::_get_thread_queue() {
+	if (unlikely(thread_queue_generation != generation)) {
+		MutexLock lock(thread_queues_mutex);
+		thread_queue = memnew(CallQueue(main_singleton->allocator, main_singleton->max_pages, main_singleton->error_text));
+		thread_queues.push_back(thread_queue);
+		thread_queue_generation = generation;
+	}
+	return thread_queue;
+}
+
+void MessageQueue::_merge_thread_queues() {
+	MutexLock lock(thread_queues_mutex);
+	for (CallQueue *queue : thread_queues) {
+		MutexLock queue_lock(queue->mutex);
+		if (queue->has_messages()) {
+			queue->_transfer_messages_to_main_queue();
+		}
+	}
+}
+
+bool MessageQueue::_thread_queues_have_messages() {
+	MutexLock lock(thread_queues_mutex);
+	for (const CallQueue *queue : thread_queues) {
+		MutexLock queue_lock(queue->mutex);
+		if (queue->_has_own_messages()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+int MessageQueue::_get_thread_queues_message_count() {
+	MutexLock lock(thread_queues_mutex);
+	int count = 0;
+	for (const CallQueue *queue : thread_queues) {
+		MutexLock queue_lock(queue->mutex);
+		count += queue->_get_own_message_count();
+	}
+	return count;
+}
+
+void MessageQueue::_record_flush(uint32_t p_messages, uint64_t p_usec) {
+	const uint64_t frame = Engine::get_singleton()->get_process_frames();
+	if (frame != stats_frame) {
+		last_frame_flushed_messages = frame_flushed_messages;
+		last_frame_flush_usec = frame_flush_usec;
+		frame_flushed_messages = 0;
+		frame_flush_usec = 0;
+		stats_frame = frame;
+	}
+	frame_flushed_messages += p_messages;
+	frame_flush_usec += p_usec;
+}
+
+void MessageQueue::thread_exit() {
+	if (!thread_queue || thread_queue_generation != generation) {
+		return; // Never pushed to the main queue, or did so to one that no longer exists.
+	}
+
+	MutexLock lock(thread_queues_mutex);
+	{
+		MutexLock queue_lock(thread_queue->mutex);
+		if (thread_queue->has_messages()) {
+			thread_queue->_transfer_messages_to_main_queue();
+		}
+	}
+	thread_queues.erase(thread_queue);
+	memdelete(thread_queue);
+	thread_queue = nullptr;
+	thread_queue_generation = 0;
+}
+
 void MessageQueue::set_thread_singleton_override(CallQueue *p_thread_singleton) {
 	DEV_ASSERT(p_thread_singleton); // To unset the thread singleton, don't call this with nullptr, but just memfree() it.
 #ifdef DEV_ENABLED
@@ -569,8 +701,17 @@ MessageQueue::MessageQueue() :
 				"Message queue out of memory. Try increasing 'memory/limits/message_queue/max_size_mb' in project settings.") {
 	ERR_FAIL_COND_MSG(main_singleton != nullptr, "A MessageQueue singleton already exists.");
 	main_singleton = this;
+	generation++;
 }
 
 MessageQueue::~MessageQueue() {
+	{
+		MutexLock lock(thread_queues_mutex);
+		for (CallQueue *queue : thread_queues) {
+			memdelete(queue);
+		}
+		thread_queues.clear();
+		generation++;
+	}
 	main_singleton = nullptr;
 }
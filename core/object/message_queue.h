@@ -99,9 +99,25 @@ private:
 	}
 
 	Error _transfer_messages_to_main_queue();
+	bool _has_own_messages() const;
+	int _get_own_message_count() const;
 
 	void _add_page();
 
+	CallQueue *_get_push_queue();
+	// Locks the queue and reserves room for a message, which the caller builds before calling _push_end().
+	// Returns nullptr, unlocked, if the queue is out of pages.
+	Message *_push_begin(uint32_t p_room_needed);
+	void _push_end();
+	Error _push_call_begin(const Callable &p_callable, int p_argcount, bool p_show_error, CallQueue *&r_queue, Message *&r_message);
+
+	template <typename... VarArgs>
+	static _FORCE_INLINE_ void _construct_args(Variant *r_args, VarArgs... p_args) {
+		// Built right in the page, instead of being copied there from a temporary array.
+		((new (r_args++) Variant(p_args)), ...);
+		(void)r_args;
+	}
+
 	void _call_function(const Callable &p_callable, const Variant *p_args, int p_argcount, bool p_show_error);
 
 	String error_text;
@@ -110,12 +126,7 @@ public:
 	Error push_callp(ObjectID p_id, const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error = false);
 	template <typename... VarArgs>
 	Error push_call(ObjectID p_id, const StringName &p_method, VarArgs... p_args) {
-		Variant args[sizeof...(p_args) + 1] = { p_args..., Variant() }; // +1 makes sure zero sized arrays are also supported.
-		const Variant *argptrs[sizeof...(p_args) + 1];
-		for (uint32_t i = 0; i < sizeof...(p_args); i++) {
-			argptrs[i] = &args[i];
-		}
-		return push_callp(p_id, p_method, sizeof...(p_args) == 0 ? nullptr : (const Variant **)argptrs, sizeof...(p_args));
+		return push_callable(Callable(p_id, p_method), p_args...);
 	}
 
 	Error push_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error = false);
@@ -124,23 +135,20 @@ public:
 
 	template <typename... VarArgs>
 	Error push_callable(const Callable &p_callable, VarArgs... p_args) {
-		Variant args[sizeof...(p_args) + 1] = { p_args..., Variant() }; // +1 makes sure zero sized arrays are also supported.
-		const Variant *argptrs[sizeof...(p_args) + 1];
-		for (uint32_t i = 0; i < sizeof...(p_args); i++) {
-			argptrs[i] = &args[i];
+		CallQueue *queue = nullptr;
+		Message *msg = nullptr;
+		Error err = _push_call_begin(p_callable, sizeof...(p_args), false, queue, msg);
+		if (likely(err == OK)) {
+			_construct_args((Variant *)(msg + 1), p_args...);
+			queue->_push_end();
 		}
-		return push_callablep(p_callable, sizeof...(p_args) == 0 ? nullptr : (const Variant **)argptrs, sizeof...(p_args));
+		return err;
 	}
 
 	Error push_callp(Object *p_object, const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error = false);
 	template <typename... VarArgs>
 	Error push_call(Object *p_object, const StringName &p_method, VarArgs... p_args) {
-		Variant args[sizeof...(p_args) + 1] = { p_args..., Variant() }; // +1 makes sure zero sized arrays are also supported.
-		const Variant *argptrs[sizeof...(p_args) + 1];
-		for (uint32_t i = 0; i < sizeof...(p_args); i++) {
-			argptrs[i] = &args[i];
-		}
-		return push_callp(p_object, p_method, sizeof...(p_args) == 0 ? nullptr : (const Variant **)argptrs, sizeof...(p_args));
+		return push_callable(Callable(p_object, p_method), p_args...);
 	}
 
 	Error push_notification(Object *p_object, int p_notification);
@@ -150,7 +158,9 @@ public:
 	void clear();
 	void statistics();
 
+	// For the main queue, these include the calls other threads pushed that weren't merged into it yet.
 	bool has_messages() const;
+	int get_message_count() const;
 
 	bool is_flushing() const;
 	int get_max_buffer_usage() const;
@@ -164,11 +174,38 @@ class MessageQueue : public CallQueue {
 	static thread_local CallQueue *thread_singleton;
 	friend class CallQueue;
 
+	// Calls pushed to the main queue from other threads go to a queue of each thread, so they don't contend
+	// on its lock. They are merged into the main queue whenever it's flushed.
+	static thread_local CallQueue *thread_queue;
+	static thread_local uint32_t thread_queue_generation;
+	static uint32_t generation; // Tells apart thread queues of an old main queue.
+	static Mutex thread_queues_mutex;
+	static LocalVector<CallQueue *> thread_queues;
+
+	static uint64_t stats_frame;
+	static uint32_t frame_flushed_messages;
+	static uint64_t frame_flush_usec;
+	static uint32_t last_frame_flushed_messages;
+	static uint64_t last_frame_flush_usec;
+
+	static CallQueue *_get_thread_queue();
+	static void _merge_thread_queues();
+	static bool _thread_queues_have_messages();
+	static int _get_thread_queues_message_count();
+	static void _record_flush(uint32_t p_messages, uint64_t p_usec);
+
 public:
 	_FORCE_INLINE_ static CallQueue *get_singleton() { return thread_singleton ? thread_singleton : main_singleton; }
 
 	static void set_thread_singleton_override(CallQueue *p_thread_singleton);
 
+	// Hands pending calls of the current thread over to the main queue, and releases its thread queue.
+	static void thread_exit();
+
+	// Totals of the main queue flushes during the last frame.
+	static uint32_t get_last_frame_flushed_messages() { return last_frame_flushed_messages; }
+	static uint64_t get_last_frame_flush_usec() { return last_frame_flush_usec; }
+
 	MessageQueue();
 	~MessageQueue();
 };
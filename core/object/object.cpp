@@ -40,21 +40,10 @@
 #include "core/string/translation.h"
 #include "core/templates/local_vector.h"
 #include "core/variant/typed_array.h"
+#include "core/variant/variant_internal.h"
 
 #ifdef DEBUG_ENABLED
 
-struct _ObjectDebugLock {
-	Object *obj;
-
-	_ObjectDebugLock(Object *p_obj) {
-		obj = p_obj;
-		obj->_lock_index.ref();
-	}
-	~_ObjectDebugLock() {
-		obj->_lock_index.unref();
-	}
-};
-
 #define OBJ_DEBUG_LOCK _ObjectDebugLock _debug_lock(this);
 
 #else
@@ -1078,23 +1067,20 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 
 	List<_ObjectSignalDisconnectData> disconnect_data;
 
+	if (s->cached_slots_dirty) {
+		_cache_signal_slots(*s);
+	}
+
 	// Ensure that disconnecting the signal or even deleting the object
 	// will not affect the signal calling.
-	LocalVector<Connection> slot_conns;
-	slot_conns.resize(s->slot_map.size());
-	{
-		uint32_t idx = 0;
-		for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
-			slot_conns[idx++] = slot_kv.value.conn;
-		}
-		DEV_ASSERT(idx == s->slot_map.size());
-	}
+	const Vector<SignalData::CachedSlot> slots = s->cached_slots;
 
 	OBJ_DEBUG_LOCK
 
 	Error err = OK;
 
-	for (const Connection &c : slot_conns) {
+	for (const SignalData::CachedSlot &slot : slots) {
+		const Connection &c = slot.conn;
 		Object *target = c.callable.get_object();
 		if (!target) {
 			// Target might have been deleted during signal callback, this is expected and OK.
@@ -1109,8 +1095,10 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		} else {
 			Callable::CallError ce;
 			_emitting = true;
-			Variant ret;
-			c.callable.callp(args, argc, ret, ce);
+			if (!slot.method || target->script_instance || !_signal_ptrcall(slot, target, args, argc)) {
+				Variant ret;
+				c.callable.callp(args, argc, ret, ce);
+			}
 			_emitting = false;
 
 			if (ce.error != Callable::CallError::CALL_OK) {
@@ -1153,6 +1141,84 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 	return err;
 }
 
+// Large enough for any signal of the engine, slots to methods with more parameters use the regular call path.
+static constexpr int MAX_SIGNAL_PTRCALL_ARGS = 8;
+
+void Object::_cache_signal_slots(SignalData &r_signal) {
+	Vector<SignalData::CachedSlot> slots;
+	slots.resize(r_signal.slot_map.size());
+	SignalData::CachedSlot *slot = slots.ptrw();
+
+	for (const KeyValue<Callable, SignalData::Slot> &slot_kv : r_signal.slot_map) {
+		slot->conn = slot_kv.value.conn;
+		const Callable &callable = slot->conn.callable;
+		Object *target = callable.get_object();
+
+		if (callable.is_standard() && target && !(slot->conn.flags & CONNECT_DEFERRED)) {
+			MethodBind *method = ClassDB::get_method(target->get_class_name(), callable.get_method());
+			if (method && !method->is_vararg() && !method->is_static() && method->get_argument_count() <= MAX_SIGNAL_PTRCALL_ARGS && !(method->has_return() && method->get_argument_type(-1) == Variant::OBJECT)) {
+				for (int i = 0; i < method->get_argument_count(); i++) {
+					if (method->get_argument_type(i) == Variant::OBJECT) {
+						slot->object_classes.resize(method->get_argument_count());
+						slot->object_classes.write[i] = method->get_argument_info(i).class_name;
+					}
+				}
+				slot->method = method;
+			}
+		}
+		slot++;
+	}
+
+	r_signal.cached_slots = slots;
+	r_signal.cached_slots_dirty = false;
+}
+
+bool Object::_signal_ptrcall(const SignalData::CachedSlot &p_slot, Object *p_target, const Variant **p_args, int p_argcount) {
+	const MethodBind *method = p_slot.method;
+	if (p_argcount != method->get_argument_count()) {
+		return false; // Default arguments are handled by the regular call path.
+	}
+
+	// There is no conversion here, so the arguments must already have the exact parameter types.
+	const void *argptrs[MAX_SIGNAL_PTRCALL_ARGS];
+	for (int i = 0; i < p_argcount; i++) {
+		const Variant *arg = p_args[i];
+		const Variant::Type type = method->get_argument_type(i);
+		if (type == Variant::NIL) {
+			argptrs[i] = arg; // Variant parameter.
+			continue;
+		}
+		if (arg->get_type() != type) {
+			return false;
+		}
+		if (type == Variant::OBJECT) {
+			const Object *obj = arg->get_validated_object();
+			if (!obj || (obj->get_class_name() != p_slot.object_classes[i] && !ClassDB::is_parent_class(obj->get_class_name(), p_slot.object_classes[i]))) {
+				return false;
+			}
+		}
+		argptrs[i] = VariantInternal::get_opaque_pointer(arg);
+	}
+
+	Variant ret;
+	void *ret_ptr = nullptr;
+	if (method->has_return()) {
+		const Variant::Type ret_type = method->get_argument_type(-1);
+		if (ret_type == Variant::NIL) {
+			ret_ptr = &ret;
+		} else {
+			VariantInternal::initialize(&ret, ret_type);
+			ret_ptr = VariantInternal::get_opaque_pointer(&ret);
+		}
+	}
+
+#ifdef DEBUG_ENABLED
+	_ObjectDebugLock debug_lock(p_target);
+#endif
+	method->ptrcall(p_target, argptrs, ret_ptr);
+	return true;
+}
+
 void Object::_add_user_signal(const String &p_name, const Array &p_args) {
 	// this version of add_user_signal is meant to be used from scripts or external apis
 	// without access to ADD_SIGNAL in bind_methods
@@ -1352,6 +1418,7 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, ui
 
 	//use callable version as key, so binds can be ignored
 	s->slot_map[*target.get_base_comparator()] = slot;
+	s->cached_slots_dirty = true;
 
 	return OK;
 }
@@ -1408,6 +1475,7 @@ bool Object::_disconnect(const StringName &p_signal, const Callable &p_callable,
 
 	target_object->connections.erase(slot->cE);
 	s->slot_map.erase(*p_callable.get_base_comparator());
+	s->cached_slots_dirty = true;
 
 	if (s->slot_map.is_empty() && ClassDB::has_signal(get_class_name(), p_signal)) {
 		//not user signal, delete
@@ -1857,6 +1925,8 @@ void Object::_construct_object(bool p_reference) {
 #endif
 }
 
+PagedAllocator<HashMapElement<StringName, Object::SignalData>, true> Object::SignalDataAllocator::pool;
+
 Object::Object(bool p_reference) {
 	_construct_object(p_reference);
 }
@@ -603,11 +603,31 @@ private:
 			List<Connection>::Element *cE = nullptr;
 		};
 
+		struct CachedSlot {
+			Connection conn;
+			// Native method of a plain method callable, called through ptrcall when the emitted arguments match its types.
+			MethodBind *method = nullptr;
+			Vector<StringName> object_classes; // Expected class of each Object parameter of `method`, empty if it has none.
+		};
+
 		MethodInfo user;
 		HashMap<Callable, Slot, HashableHasher<Callable>> slot_map;
+		// Copy-on-write snapshot of `slot_map`, rebuilt on the first emission after connections change.
+		// Emitting keeps a reference to it, so callbacks are free to connect and disconnect.
+		Vector<CachedSlot> cached_slots;
+		bool cached_slots_dirty = true;
 	};
 
-	HashMap<StringName, SignalData> signal_map;
+	// Signal map elements of all objects come from the same pool, instead of one heap allocation each.
+	struct SignalDataAllocator {
+		static PagedAllocator<HashMapElement<StringName, SignalData>, true> pool;
+
+		template <class... Args>
+		_FORCE_INLINE_ HashMapElement<StringName, SignalData> *new_allocation(const Args &&...p_args) { return pool.alloc(static_cast<const Args &&>(p_args)...); }
+		_FORCE_INLINE_ void delete_allocation(HashMapElement<StringName, SignalData> *p_allocation) { pool.free(p_allocation); }
+	};
+
+	HashMap<StringName, SignalData, HashMapHasherDefault, HashMapComparatorDefault<StringName>, SignalDataAllocator> signal_map;
 	List<Connection> connections;
 #ifdef DEBUG_ENABLED
 	SafeRefCount _lock_index;
@@ -633,6 +653,8 @@ private:
 	void _add_user_signal(const String &p_name, const Array &p_args = Array());
 	bool _has_user_signal(const StringName &p_name) const;
 	Error _emit_signal(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
+	static void _cache_signal_slots(SignalData &r_signal);
+	static bool _signal_ptrcall(const SignalData::CachedSlot &p_slot, Object *p_target, const Variant **p_args, int p_argcount);
 	TypedArray<Dictionary> _get_signal_list() const;
 	TypedArray<Dictionary> _get_signal_connection_list(const StringName &p_signal) const;
 	TypedArray<Dictionary> _get_incoming_connections() const;
@@ -960,6 +982,21 @@ public:
 	virtual ~Object();
 };
 
+#ifdef DEBUG_ENABLED
+// Keeps the object from being freed while one of its methods runs.
+struct _ObjectDebugLock {
+	Object *obj;
+
+	_ObjectDebugLock(Object *p_obj) {
+		obj = p_obj;
+		obj->_lock_index.ref();
+	}
+	~_ObjectDebugLock() {
+		obj->_lock_index.unref();
+	}
+};
+#endif
+
 bool predelete_handler(Object *p_object);
 void postinitialize_handler(Object *p_object);
 
@@ -30,6 +30,7 @@
 
 #include "worker_thread_pool.h"
 
+#include "core/debugger/trace_recorder.h"
 #include "core/os/os.h"
 #include "core/os/thread_safe.h"
 
@@ -40,16 +41,104 @@ void WorkerThreadPool::Task::free_template_userdata() {
 	memdelete(btu);
 }
 
+bool WorkerThreadPool::TaskDeque::push(Task *p_task) {
+	int64_t b = bottom.load(std::memory_order_relaxed);
+	int64_t t = top.load(std::memory_order_acquire);
+	if (b - t >= CAPACITY) {
+		return false; // Full, caller must fall back to the shared queue.
+	}
+	buffer[b & (CAPACITY - 1)].store(p_task, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	bottom.store(b + 1, std::memory_order_relaxed);
+	return true;
+}
+
+WorkerThreadPool::Task *WorkerThreadPool::TaskDeque::pop() {
+	int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+	bottom.store(b, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	int64_t t = top.load(std::memory_order_relaxed);
+
+	if (t > b) {
+		// Empty.
+		bottom.store(b + 1, std::memory_order_relaxed);
+		return nullptr;
+	}
+
+	Task *task = buffer[b & (CAPACITY - 1)].load(std::memory_order_relaxed);
+	if (t == b) {
+		// Last element, race against thieves for it.
+		if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+			task = nullptr;
+		}
+		bottom.store(b + 1, std::memory_order_relaxed);
+	}
+	return task;
+}
+
+WorkerThreadPool::Task *WorkerThreadPool::TaskDeque::steal() {
+	int64_t t = top.load(std::memory_order_acquire);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	int64_t b = bottom.load(std::memory_order_acquire);
+
+	if (t >= b) {
+		return nullptr;
+	}
+
+	Task *task = buffer[t & (CAPACITY - 1)].load(std::memory_order_relaxed);
+	if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+		return nullptr; // Lost the race against the owner or another thief.
+	}
+	return task;
+}
+
 WorkerThreadPool *WorkerThreadPool::singleton = nullptr;
 
 void WorkerThreadPool::_process_task_queue() {
-	task_mutex.lock();
-	Task *task = task_queue.first()->self();
-	task_queue.remove(task_queue.first());
-	task_mutex.unlock();
+	Task *task = nullptr;
+	if (use_work_stealing) {
+		task = _pop_task_work_stealing();
+	} else {
+		task_mutex.lock();
+		task = task_queue.first()->self();
+		task_queue.remove(task_queue.first());
+		task_mutex.unlock();
+	}
 	_process_task(task);
 }
 
+WorkerThreadPool::Task *WorkerThreadPool::_pop_task_work_stealing() {
+	// The semaphore is only posted after a task has been queued somewhere and it's always
+	// consumed before taking one, so there is guaranteed to be a task for this thread.
+	// Stealing can fail spuriously on contention, so keep trying until one is obtained.
+	int thread_index = _get_current_pool_thread_index();
+	DEV_ASSERT(thread_index != -1);
+
+	while (true) {
+		Task *task = threads[thread_index].deque->pop();
+		if (task) {
+			return task;
+		}
+
+		for (uint32_t i = 1; i < threads.size(); i++) {
+			task = threads[(thread_index + i) % threads.size()].deque->steal();
+			if (task) {
+				return task;
+			}
+		}
+
+		task_mutex.lock();
+		if (task_queue.first()) {
+			task = task_queue.first()->self();
+			task_queue.remove(task_queue.first());
+		}
+		task_mutex.unlock();
+		if (task) {
+			return task;
+		}
+	}
+}
+
 void WorkerThreadPool::_process_task(Task *p_task) {
 	bool low_priority = p_task->low_priority;
 	int pool_thread_index = -1;
@@ -72,6 +161,16 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		task_mutex.unlock();
 	}
 
+	// The name is copied when the zone begins, the task may not outlive its work.
+	const bool traced = TraceRecorder::is_enabled();
+	if (traced) {
+		if (p_task->description.is_empty()) {
+			TraceRecorder::begin_zone("WorkerThreadPool task");
+		} else {
+			TraceRecorder::begin_zone(p_task->description);
+		}
+	}
+
 	if (p_task->group) {
 		// Handling a group
 		bool do_post = false;
@@ -80,7 +179,32 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		Variant arg;
 		Variant *argptr = &arg;
 
-		while (true) {
+		while (p_task->group->min_grain > 0) {
+			// Range group. The chunk size is derived from the remaining work, so it's only a hint
+			// and may be off if other threads grab chunks meanwhile; fetching the range is still atomic.
+			Group *group = p_task->group;
+			uint32_t remaining = group->max - MIN(group->index.get(), group->max);
+			uint32_t chunk = MAX(group->min_grain, remaining / (group->tasks_used * 2));
+			uint32_t from = group->index.postadd(chunk);
+
+			if (from >= group->max) {
+				break;
+			}
+			uint32_t to = MIN(from + chunk, group->max);
+			if (p_task->native_range_group_func) {
+				p_task->native_range_group_func(p_task->native_func_userdata, from, to);
+			} else {
+				p_task->template_userdata->callback_range(from, to);
+			}
+
+			uint32_t completed_amount = group->completed_index.add(to - from);
+
+			if (completed_amount == group->max) {
+				do_post = true;
+			}
+		}
+
+		while (p_task->group->min_grain == 0) {
 			uint32_t work_index = p_task->group->index.postincrement();
 
 			if (work_index >= p_task->group->max) {
@@ -108,15 +232,15 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		}
 
 		if (low_priority && use_native_low_priority_threads) {
-			p_task->completed = true;
-			p_task->done_semaphore.post();
 			if (do_post) {
-				p_task->group->completed.set_to(true);
+				_mark_group_completed(p_task->group);
 			}
+			p_task->completed = true;
+			p_task->done_semaphore.post();
 		} else {
 			if (do_post) {
+				_mark_group_completed(p_task->group);
 				p_task->group->done_semaphore.post();
-				p_task->group->completed.set_to(true);
 			}
 			uint32_t max_users = p_task->group->tasks_used + 1; // Add 1 because the thread waiting for it is also user. Read before to avoid another thread freeing task after increment.
 			uint32_t finished_users = p_task->group->finished.increment();
@@ -146,8 +270,10 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 			p_task->callable.callp(nullptr, 0, ret, ce);
 		}
 
+		TightLocalVector<PendingWork *> ready_work;
 		task_mutex.lock();
 		p_task->completed = true;
+		_collect_ready_work(p_task->dependents, ready_work);
 		for (uint8_t i = 0; i < p_task->waiting; i++) {
 			p_task->done_semaphore.post();
 		}
@@ -155,6 +281,12 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 			p_task->pool_thread_index = -1;
 		}
 		task_mutex.unlock(); // Keep mutex down to here since on unlock the task may be freed.
+
+		_post_ready_work(ready_work);
+	}
+
+	if (traced) {
+		TraceRecorder::end_zone();
 	}
 
 	// Task may have been freed by now (all callers notified).
@@ -185,6 +317,8 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 }
 
 void WorkerThreadPool::_thread_function(void *p_user) {
+	TraceRecorder::set_thread_name(vformat("WorkerThread %d", ((ThreadData *)p_user)->index));
+
 	while (true) {
 		singleton->task_available_semaphore.wait();
 		if (singleton->exit_threads) {
@@ -209,15 +343,25 @@ void WorkerThreadPool::_post_task(Task *p_task, bool p_high_priority) {
 		return;
 	}
 
+	if (use_work_stealing && p_high_priority) {
+		// Tasks spawned from within the pool go to the local deque of the spawning thread,
+		// so they skip the shared queue and its lock entirely. Idle threads will steal them.
+		int thread_index = _get_current_pool_thread_index();
+		if (thread_index != -1) {
+			p_task->low_priority = false;
+			if (threads[thread_index].deque->push(p_task)) {
+				task_available_semaphore.post();
+				return;
+			}
+		}
+	}
+
 	task_mutex.lock();
 	p_task->low_priority = !p_high_priority;
 	if (!p_high_priority && use_native_low_priority_threads) {
 		p_task->low_priority_thread = native_thread_allocator.alloc();
 		task_mutex.unlock();
 
-		if (p_task->group) {
-			p_task->group->low_priority_native_tasks.push_back(p_task);
-		}
 		p_task->low_priority_thread->start(_native_low_priority_thread_function, p_task); // Pask task directly to thread.
 	} else if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
 		task_queue.add_last(&p_task->task_elem);
@@ -233,6 +377,68 @@ void WorkerThreadPool::_post_task(Task *p_task, bool p_high_priority) {
 	}
 }
 
+WorkerThreadPool::PendingWork *WorkerThreadPool::_create_pending_work(const Vector<int64_t> &p_dependencies, bool p_high_priority) {
+	// Must be called with the task mutex locked.
+	// IDs no longer registered belong to work already completed and awaited, so there is nothing to wait for.
+	PendingWork *work = nullptr;
+	for (int64_t id : p_dependencies) {
+		TightLocalVector<PendingWork *> *dependents = nullptr;
+		Task **taskp = tasks.getptr(id);
+		if (taskp) {
+			if (!(*taskp)->completed) {
+				dependents = &(*taskp)->dependents;
+			}
+		} else {
+			Group **groupp = groups.getptr(id);
+			if (groupp && !(*groupp)->completed.is_set()) {
+				dependents = &(*groupp)->dependents;
+			}
+		}
+
+		if (dependents) {
+			if (!work) {
+				work = pending_work_allocator.alloc();
+				work->high_priority = p_high_priority;
+			}
+			work->dependencies_left++;
+			dependents->push_back(work);
+		}
+	}
+	return work;
+}
+
+void WorkerThreadPool::_collect_ready_work(TightLocalVector<PendingWork *> &p_dependents, TightLocalVector<PendingWork *> &r_ready) {
+	// Must be called with the task mutex locked.
+	for (PendingWork *work : p_dependents) {
+		work->dependencies_left--;
+		if (work->dependencies_left == 0) {
+			r_ready.push_back(work);
+		}
+	}
+	p_dependents.clear();
+}
+
+void WorkerThreadPool::_post_ready_work(const TightLocalVector<PendingWork *> &p_ready) {
+	for (PendingWork *work : p_ready) {
+		for (Task *task : work->tasks) {
+			_post_task(task, work->high_priority);
+		}
+		task_mutex.lock();
+		pending_work_allocator.free(work);
+		task_mutex.unlock();
+	}
+}
+
+void WorkerThreadPool::_mark_group_completed(Group *p_group) {
+	TightLocalVector<PendingWork *> ready_work;
+	task_mutex.lock();
+	p_group->completed.set_to(true);
+	_collect_ready_work(p_group->dependents, ready_work);
+	task_mutex.unlock();
+
+	_post_ready_work(ready_work);
+}
+
 bool WorkerThreadPool::_try_promote_low_priority_task() {
 	if (low_priority_task_queue.first()) {
 		Task *low_prio_task = low_priority_task_queue.first()->self();
@@ -266,7 +472,7 @@ WorkerThreadPool::TaskID WorkerThreadPool::add_native_task(void (*p_func)(void *
 	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description);
 }
 
-WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description) {
+WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, const Vector<int64_t> &p_dependencies) {
 	task_mutex.lock();
 	// Get a free task
 	Task *task = task_allocator.alloc();
@@ -276,10 +482,19 @@ WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable,
 	task->native_func_userdata = p_userdata;
 	task->description = p_description;
 	task->template_userdata = p_template_userdata;
+	task->low_priority = !p_high_priority;
 	tasks.insert(id, task);
+
+	PendingWork *pending_work = _create_pending_work(p_dependencies, p_high_priority);
+	if (pending_work) {
+		// Posted by whoever completes the last dependency.
+		pending_work->tasks.push_back(task);
+	}
 	task_mutex.unlock();
 
-	_post_task(task, p_high_priority);
+	if (!pending_work) {
+		_post_task(task, p_high_priority);
+	}
 
 	return id;
 }
@@ -288,6 +503,14 @@ WorkerThreadPool::TaskID WorkerThreadPool::add_task(const Callable &p_action, bo
 	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description);
 }
 
+WorkerThreadPool::TaskID WorkerThreadPool::add_native_dependent_task(void (*p_func)(void *), void *p_userdata, const Vector<int64_t> &p_dependencies, bool p_high_priority, const String &p_description) {
+	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description, p_dependencies);
+}
+
+WorkerThreadPool::TaskID WorkerThreadPool::add_dependent_task(const Callable &p_action, const Vector<int64_t> &p_dependencies, bool p_high_priority, const String &p_description) {
+	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description, p_dependencies);
+}
+
 bool WorkerThreadPool::is_task_completed(TaskID p_task_id) const {
 	task_mutex.lock();
 	const Task *const *taskp = tasks.getptr(p_task_id);
@@ -401,7 +624,7 @@ Error WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
 	}
 
 	if (task->waiting == 0) {
-		if (use_native_low_priority_threads && task->low_priority) {
+		if (task->low_priority_thread) {
 			task->low_priority_thread->wait_to_finish();
 			native_thread_allocator.free(task->low_priority_thread);
 		}
@@ -413,19 +636,26 @@ Error WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
 	return OK;
 }
 
-WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description) {
+WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void (*p_range_func)(void *, uint32_t, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_min_grain, int p_tasks, bool p_high_priority, const String &p_description, const Vector<int64_t> &p_dependencies) {
 	ERR_FAIL_COND_V(p_elements < 0, INVALID_TASK_ID);
+	ERR_FAIL_COND_V(p_min_grain < 0, INVALID_TASK_ID);
 	if (p_tasks < 0) {
 		p_tasks = MAX(1u, threads.size());
 	}
+	if (p_min_grain > 0) {
+		// No point in having more tasks than chunks.
+		p_tasks = CLAMP((p_elements + p_min_grain - 1) / p_min_grain, 1, p_tasks);
+	}
 
 	task_mutex.lock();
 	Group *group = group_allocator.alloc();
 	GroupID id = last_task++;
 	group->max = p_elements;
+	group->min_grain = p_min_grain;
 	group->self = id;
 
 	Task **tasks_posted = nullptr;
+	PendingWork *pending_work = nullptr;
 	if (p_elements == 0) {
 		// Should really not call it with zero Elements, but at least it should work.
 		group->completed.set_to(true);
@@ -442,32 +672,61 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 		for (int i = 0; i < p_tasks; i++) {
 			Task *task = task_allocator.alloc();
 			task->native_group_func = p_func;
+			task->native_range_group_func = p_range_func;
 			task->native_func_userdata = p_userdata;
 			task->description = p_description;
 			task->group = group;
 			task->callable = p_callable;
 			task->template_userdata = p_template_userdata;
+			task->low_priority = !p_high_priority;
 			tasks_posted[i] = task;
 			// No task ID is used.
+
+			if (!p_high_priority && use_native_low_priority_threads && threads.size() > 0) {
+				// Registered upfront, so waiting works even if the tasks are still pending on dependencies.
+				group->low_priority_native_tasks.push_back(task);
+			}
+		}
+
+		pending_work = _create_pending_work(p_dependencies, p_high_priority);
+		if (pending_work) {
+			// Posted by whoever completes the last dependency.
+			for (int i = 0; i < p_tasks; i++) {
+				pending_work->tasks.push_back(tasks_posted[i]);
+			}
 		}
 	}
 
 	groups[id] = group;
 	task_mutex.unlock();
 
-	for (int i = 0; i < p_tasks; i++) {
-		_post_task(tasks_posted[i], p_high_priority);
+	if (!pending_work) {
+		for (int i = 0; i < p_tasks; i++) {
+			_post_task(tasks_posted[i], p_high_priority);
+		}
 	}
 
 	return id;
 }
 
 WorkerThreadPool::GroupID WorkerThreadPool::add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description) {
-	return _add_group_task(Callable(), p_func, p_userdata, nullptr, p_elements, p_tasks, p_high_priority, p_description);
+	return _add_group_task(Callable(), p_func, nullptr, p_userdata, nullptr, p_elements, 0, p_tasks, p_high_priority, p_description);
 }
 
 WorkerThreadPool::GroupID WorkerThreadPool::add_group_task(const Callable &p_action, int p_elements, int p_tasks, bool p_high_priority, const String &p_description) {
-	return _add_group_task(p_action, nullptr, nullptr, nullptr, p_elements, p_tasks, p_high_priority, p_description);
+	return _add_group_task(p_action, nullptr, nullptr, nullptr, nullptr, p_elements, 0, p_tasks, p_high_priority, p_description);
+}
+
+WorkerThreadPool::GroupID WorkerThreadPool::add_native_dependent_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, const Vector<int64_t> &p_dependencies, int p_tasks, bool p_high_priority, const String &p_description) {
+	return _add_group_task(Callable(), p_func, nullptr, p_userdata, nullptr, p_elements, 0, p_tasks, p_high_priority, p_description, p_dependencies);
+}
+
+WorkerThreadPool::GroupID WorkerThreadPool::add_dependent_group_task(const Callable &p_action, int p_elements, const Vector<int64_t> &p_dependencies, int p_tasks, bool p_high_priority, const String &p_description) {
+	return _add_group_task(p_action, nullptr, nullptr, nullptr, nullptr, p_elements, 0, p_tasks, p_high_priority, p_description, p_dependencies);
+}
+
+WorkerThreadPool::GroupID WorkerThreadPool::add_native_range_group_task(void (*p_func)(void *, uint32_t, uint32_t), void *p_userdata, int p_elements, int p_min_grain, int p_tasks, bool p_high_priority, const String &p_description) {
+	return _add_group_task(Callable(), nullptr, p_func, p_userdata, nullptr, p_elements, MAX(1, p_min_grain), p_tasks, p_high_priority, p_description);
 }
 
 uint32_t WorkerThreadPool::get_group_processed_element_count(GroupID p_group) const {
@@ -504,6 +763,7 @@ void WorkerThreadPool::wait_for_group_task_completion(GroupID p_group) {
 
 	if (group->low_priority_native_tasks.size() > 0) {
 		for (Task *task : group->low_priority_native_tasks) {
+			task->done_semaphore.wait(); // The thread may not even have been started yet if the group has dependencies.
 			task->low_priority_thread->wait_to_finish();
 			task_mutex.lock();
 			native_thread_allocator.free(task->low_priority_thread);
@@ -533,7 +793,7 @@ void WorkerThreadPool::wait_for_group_task_completion(GroupID p_group) {
 	task_mutex.unlock();
 }
 
-void WorkerThreadPool::init(int p_thread_count, bool p_use_native_threads_low_priority, float p_low_priority_task_ratio) {
+void WorkerThreadPool::init(int p_thread_count, bool p_use_native_threads_low_priority, float p_low_priority_task_ratio, bool p_use_work_stealing) {
 	ERR_FAIL_COND(threads.size() > 0);
 	if (p_thread_count < 0) {
 		p_thread_count = OS::get_singleton()->get_default_thread_pool_size();
@@ -546,11 +806,16 @@ void WorkerThreadPool::init(int p_thread_count, bool p_use_native_threads_low_pr
 	}
 
 	use_native_low_priority_threads = p_use_native_threads_low_priority;
+	use_work_stealing = p_use_work_stealing;
+	exit_threads = false;
 
 	threads.resize(p_thread_count);
 
 	for (uint32_t i = 0; i < threads.size(); i++) {
 		threads[i].index = i;
+		if (use_work_stealing) {
+			threads[i].deque = memnew(TaskDeque);
+		}
 		threads[i].thread.start(&WorkerThreadPool::_thread_function, &threads[i]);
 		thread_ids.insert(threads[i].thread.get_id(), i);
 	}
@@ -579,15 +844,25 @@ void WorkerThreadPool::finish() {
 		data.thread.wait_to_finish();
 	}
 
+	for (ThreadData &data : threads) {
+		if (data.deque) {
+			memdelete(data.deque);
+			data.deque = nullptr;
+		}
+	}
+
 	threads.clear();
+	thread_ids.clear();
 }
 
 void WorkerThreadPool::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("add_task", "action", "high_priority", "description"), &WorkerThreadPool::add_task, DEFVAL(false), DEFVAL(String()));
+	ClassDB::bind_method(D_METHOD("add_dependent_task", "action", "dependencies", "high_priority", "description"), &WorkerThreadPool::add_dependent_task, DEFVAL(false), DEFVAL(String()));
 	ClassDB::bind_method(D_METHOD("is_task_completed", "task_id"), &WorkerThreadPool::is_task_completed);
 	ClassDB::bind_method(D_METHOD("wait_for_task_completion", "task_id"), &WorkerThreadPool::wait_for_task_completion);
 
 	ClassDB::bind_method(D_METHOD("add_group_task", "action", "elements", "tasks_needed", "high_priority", "description"), &WorkerThreadPool::add_group_task, DEFVAL(-1), DEFVAL(false), DEFVAL(String()));
+	ClassDB::bind_method(D_METHOD("add_dependent_group_task", "action", "elements", "dependencies", "tasks_needed", "high_priority", "description"), &WorkerThreadPool::add_dependent_group_task, DEFVAL(-1), DEFVAL(false), DEFVAL(String()));
 	ClassDB::bind_method(D_METHOD("is_group_task_completed", "group_id"), &WorkerThreadPool::is_group_task_completed);
 	ClassDB::bind_method(D_METHOD("get_group_processed_element_count", "group_id"), &WorkerThreadPool::get_group_processed_element_count);
 	ClassDB::bind_method(D_METHOD("wait_for_group_task_completion", "group_id"), &WorkerThreadPool::wait_for_group_task_completion);
@@ -52,10 +52,12 @@ public:
 
 private:
 	struct Task;
+	struct PendingWork;
 
 	struct BaseTemplateUserdata {
 		virtual void callback() {}
 		virtual void callback_indexed(uint32_t p_index) {}
+		virtual void callback_range(uint32_t p_from, uint32_t p_to) {}
 		virtual ~BaseTemplateUserdata() {}
 	};
 
@@ -64,17 +66,20 @@ private:
 		SafeNumeric<uint32_t> index;
 		SafeNumeric<uint32_t> completed_index;
 		uint32_t max = 0;
+		uint32_t min_grain = 0; // Non-zero for range groups, which process elements in chunks of at least this size.
 		Semaphore done_semaphore;
 		SafeFlag completed;
 		SafeNumeric<uint32_t> finished;
 		uint32_t tasks_used = 0;
 		TightLocalVector<Task *> low_priority_native_tasks;
+		TightLocalVector<PendingWork *> dependents;
 	};
 
 	struct Task {
 		Callable callable;
 		void (*native_func)(void *) = nullptr;
 		void (*native_group_func)(void *, uint32_t) = nullptr;
+		void (*native_range_group_func)(void *, uint32_t, uint32_t) = nullptr;
 		void *native_func_userdata = nullptr;
 		String description;
 		Semaphore done_semaphore;
@@ -86,13 +91,22 @@ private:
 		BaseTemplateUserdata *template_userdata = nullptr;
 		Thread *low_priority_thread = nullptr;
 		int pool_thread_index = -1;
+		TightLocalVector<PendingWork *> dependents;
 
 		void free_template_userdata();
 		Task() :
 				task_elem(this) {}
 	};
 
+	// Tasks that can only be posted once all the tasks and groups they depend on have completed.
+	struct PendingWork {
+		uint32_t dependencies_left = 0;
+		bool high_priority = false;
+		TightLocalVector<Task *> tasks;
+	};
+
 	PagedAllocator<Task> task_allocator;
+	PagedAllocator<PendingWork> pending_work_allocator;
 	PagedAllocator<Group> group_allocator;
 	PagedAllocator<Thread> native_thread_allocator;
 
@@ -102,10 +116,26 @@ private:
 	Mutex task_mutex;
 	Semaphore task_available_semaphore;
 
+	// Chase-Lev work-stealing deque. Only the owning thread may push and pop
+	// (LIFO, to keep freshly spawned work hot in cache), while any other pool
+	// thread may steal from the opposite end (FIFO).
+	struct TaskDeque {
+		static const int64_t CAPACITY = 1024; // Must be a power of two.
+
+		std::atomic<int64_t> top = { 0 };
+		std::atomic<int64_t> bottom = { 0 };
+		std::atomic<Task *> buffer[CAPACITY] = {};
+
+		bool push(Task *p_task);
+		Task *pop();
+		Task *steal();
+	};
+
 	struct ThreadData {
 		uint32_t index;
 		Thread thread;
 		Task *current_low_prio_task = nullptr;
+		TaskDeque *deque = nullptr;
 	};
 
 	TightLocalVector<ThreadData> threads;
@@ -116,6 +146,7 @@ private:
 	HashMap<GroupID, Group *> groups;
 
 	bool use_native_low_priority_threads = false;
+	bool use_work_stealing = false;
 	uint32_t max_low_priority_threads = 0;
 	uint32_t low_priority_threads_used = 0;
 	uint32_t low_priority_tasks_running = 0;
@@ -126,18 +157,29 @@ private:
 	static void _thread_function(void *p_user);
 	static void _native_low_priority_thread_function(void *p_user);
 
+	_FORCE_INLINE_ int _get_current_pool_thread_index() const {
+		const int *index = thread_ids.getptr(Thread::get_caller_id());
+		return index ? *index : -1;
+	}
+
 	void _process_task_queue();
+	Task *_pop_task_work_stealing();
 	void _process_task(Task *task);
 
 	void _post_task(Task *p_task, bool p_high_priority);
 
+	PendingWork *_create_pending_work(const Vector<int64_t> &p_dependencies, bool p_high_priority);
+	void _collect_ready_work(TightLocalVector<PendingWork *> &p_dependents, TightLocalVector<PendingWork *> &r_ready);
+	void _post_ready_work(const TightLocalVector<PendingWork *> &p_ready);
+	void _mark_group_completed(Group *p_group);
+
 	bool _try_promote_low_priority_task();
 	void _prevent_low_prio_saturation_deadlock();
 
 	static WorkerThreadPool *singleton;
 
-	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description);
-	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description);
+	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, const Vector<int64_t> &p_dependencies = Vector<int64_t>());
+	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void (*p_range_func)(void *, uint32_t, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_min_grain, int p_tasks, bool p_high_priority, const String &p_description, const Vector<int64_t> &p_dependencies = Vector<int64_t>());
 
 	template <class C, class M, class U>
 	struct TaskUserData : public BaseTemplateUserdata {
@@ -159,6 +201,16 @@ private:
 		}
 	};
 
+	template <class C, class M, class U>
+	struct GroupRangeUserData : public BaseTemplateUserdata {
+		C *instance;
+		M method;
+		U userdata;
+		virtual void callback_range(uint32_t p_from, uint32_t p_to) override {
+			(instance->*method)(p_from, p_to, userdata);
+		}
+	};
+
 protected:
 	static void _bind_methods();
 
@@ -175,6 +227,20 @@ public:
 	TaskID add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority = false, const String &p_description = String());
 	TaskID add_task(const Callable &p_action, bool p_high_priority = false, const String &p_description = String());
 
+	// Dependent variants. The task is only posted once every task and group in p_dependencies
+	// has completed, which lets callers chain work without blocking on a wait in between.
+	template <class C, class M, class U>
+	TaskID add_template_dependent_task(C *p_instance, M p_method, U p_userdata, const Vector<int64_t> &p_dependencies, bool p_high_priority = false, const String &p_description = String()) {
+		typedef TaskUserData<C, M, U> TUD;
+		TUD *ud = memnew(TUD);
+		ud->instance = p_instance;
+		ud->method = p_method;
+		ud->userdata = p_userdata;
+		return _add_task(Callable(), nullptr, nullptr, ud, p_high_priority, p_description, p_dependencies);
+	}
+	TaskID add_native_dependent_task(void (*p_func)(void *), void *p_userdata, const Vector<int64_t> &p_dependencies, bool p_high_priority = false, const String &p_description = String());
+	TaskID add_dependent_task(const Callable &p_action, const Vector<int64_t> &p_dependencies, bool p_high_priority = false, const String &p_description = String());
+
 	bool is_task_completed(TaskID p_task_id) const;
 	Error wait_for_task_completion(TaskID p_task_id);
 
@@ -185,18 +251,46 @@ public:
 		ud->instance = p_instance;
 		ud->method = p_method;
 		ud->userdata = p_userdata;
-		return _add_group_task(Callable(), nullptr, nullptr, ud, p_elements, p_tasks, p_high_priority, p_description);
+		return _add_group_task(Callable(), nullptr, nullptr, nullptr, ud, p_elements, 0, p_tasks, p_high_priority, p_description);
 	}
 	GroupID add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
 	GroupID add_group_task(const Callable &p_action, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
+
+	template <class C, class M, class U>
+	GroupID add_template_dependent_group_task(C *p_instance, M p_method, U p_userdata, int p_elements, const Vector<int64_t> &p_dependencies, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String()) {
+		typedef GroupUserData<C, M, U> GroupUD;
+		GroupUD *ud = memnew(GroupUD);
+		ud->instance = p_instance;
+		ud->method = p_method;
+		ud->userdata = p_userdata;
+		return _add_group_task(Callable(), nullptr, nullptr, nullptr, ud, p_elements, 0, p_tasks, p_high_priority, p_description, p_dependencies);
+	}
+	GroupID add_native_dependent_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, const Vector<int64_t> &p_dependencies, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
+	GroupID add_dependent_group_task(const Callable &p_action, int p_elements, const Vector<int64_t> &p_dependencies, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
+
+	// Range variants. Instead of once per element, the callback receives a [p_from, p_to) range of elements.
+	// Chunks start large and shrink as work runs out to keep threads balanced, but never go below p_min_grain
+	// elements (except for the last one), so cheap per-element work isn't dominated by scheduling overhead.
+	template <class C, class M, class U>
+	GroupID add_template_range_group_task(C *p_instance, M p_method, U p_userdata, int p_elements, int p_min_grain = 1, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String()) {
+		typedef GroupRangeUserData<C, M, U> GroupUD;
+		GroupUD *ud = memnew(GroupUD);
+		ud->instance = p_instance;
+		ud->method = p_method;
+		ud->userdata = p_userdata;
+		return _add_group_task(Callable(), nullptr, nullptr, nullptr, ud, p_elements, MAX(1, p_min_grain), p_tasks, p_high_priority, p_description);
+	}
+	GroupID add_native_range_group_task(void (*p_func)(void *, uint32_t, uint32_t), void *p_userdata, int p_elements, int p_min_grain = 1, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String());
 	uint32_t get_group_processed_element_count(GroupID p_group) const;
 	bool is_group_task_completed(GroupID p_group) const;
 	void wait_for_group_task_completion(GroupID p_group);
 
 	_FORCE_INLINE_ int get_thread_count() const { return threads.size(); }
+	_FORCE_INLINE_ int get_thread_index() const { return _get_current_pool_thread_index(); } // -1 if not called from a pool thread.
+	_FORCE_INLINE_ bool is_using_work_stealing() const { return use_work_stealing; }
 
 	static WorkerThreadPool *get_singleton() { return singleton; }
-	void init(int p_thread_count = -1, bool p_use_native_threads_low_priority = true, float p_low_priority_task_ratio = 0.3);
+	void init(int p_thread_count = -1, bool p_use_native_threads_low_priority = true, float p_low_priority_task_ratio = 0.3, bool p_use_work_stealing = false);
 	void finish();
 	WorkerThreadPool();
 	~WorkerThreadPool();
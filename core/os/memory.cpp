@@ -31,10 +31,12 @@
 #include "memory.h"
 
 #include "core/error/error_macros.h"
+#include "core/os/spin_lock.h"
 #include "core/templates/safe_refcount.h"
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 void *operator new(size_t p_size, const char *p_description) {
 	return Memory::alloc_static(p_size, false);
@@ -61,6 +63,16 @@ void operator delete(void *p_mem, void *p_pointer, size_t check, const char *p_d
 #ifdef DEBUG_ENABLED
 SafeNumeric<uint64_t> Memory::mem_usage;
 SafeNumeric<uint64_t> Memory::max_usage;
+
+Memory::TagStats Memory::tag_stats[MAX_TAGS];
+SafeNumeric<uint32_t> Memory::tag_count;
+thread_local Memory::Tag Memory::current_tag = Memory::TAG_UNTAGGED;
+
+// The tag is kept in the top byte of the size stored in the header.
+#define MEMORY_TAG_SHIFT 56
+#define MEMORY_SIZE_MASK ((uint64_t(1) << MEMORY_TAG_SHIFT) - 1)
+
+static SpinLock tag_register_lock;
 #endif
 
 SafeNumeric<uint64_t> Memory::alloc_count;
@@ -87,6 +99,12 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 #ifdef DEBUG_ENABLED
 		uint64_t new_mem_usage = mem_usage.add(p_bytes);
 		max_usage.exchange_if_greater(new_mem_usage);
+
+		Tag tag = current_tag;
+		*s |= uint64_t(tag) << MEMORY_TAG_SHIFT;
+		TagStats &stats = tag_stats[tag];
+		stats.max_usage.exchange_if_greater(stats.usage.add(p_bytes));
+		stats.allocations.increment();
 #endif
 		return s8 + PAD_ALIGN;
 	} else {
@@ -112,11 +130,17 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 		uint64_t *s = (uint64_t *)mem;
 
 #ifdef DEBUG_ENABLED
-		if (p_bytes > *s) {
-			uint64_t new_mem_usage = mem_usage.add(p_bytes - *s);
+		// Resized memory stays with the tag it was allocated with.
+		uint64_t header = *s;
+		uint64_t old_bytes = header & MEMORY_SIZE_MASK;
+		TagStats &stats = tag_stats[header >> MEMORY_TAG_SHIFT];
+		if (p_bytes > old_bytes) {
+			uint64_t new_mem_usage = mem_usage.add(p_bytes - old_bytes);
 			max_usage.exchange_if_greater(new_mem_usage);
+			stats.max_usage.exchange_if_greater(stats.usage.add(p_bytes - old_bytes));
 		} else {
-			mem_usage.sub(*s - p_bytes);
+			mem_usage.sub(old_bytes - p_bytes);
+			stats.usage.sub(old_bytes - p_bytes);
 		}
 #endif
 
@@ -132,6 +156,9 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 			s = (uint64_t *)mem;
 
 			*s = p_bytes;
+#ifdef DEBUG_ENABLED
+			*s |= header & ~MEMORY_SIZE_MASK;
+#endif
 
 			return mem + PAD_ALIGN;
 		}
@@ -161,8 +188,10 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 		mem -= PAD_ALIGN;
 
 #ifdef DEBUG_ENABLED
-		uint64_t *s = (uint64_t *)mem;
-		mem_usage.sub(*s);
+		uint64_t header = *(uint64_t *)mem;
+		uint64_t bytes = header & MEMORY_SIZE_MASK;
+		mem_usage.sub(bytes);
+		tag_stats[header >> MEMORY_TAG_SHIFT].usage.sub(bytes);
 #endif
 
 		free(mem);
@@ -171,6 +200,234 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 	}
 }
 
+#define FRAME_ARENA_BLOCK_SIZE (64 * 1024)
+#define FRAME_ARENA_ALIGN(m_size) (((m_size) + PAD_ALIGN - 1) & ~size_t(PAD_ALIGN - 1))
+
+static SafeNumeric<uint64_t> frame_arena_reserved;
+static SafeNumeric<uint64_t> frame_arena_max_usage;
+
+struct FrameArenaBlock {
+	FrameArenaBlock *next = nullptr;
+	size_t capacity = 0;
+
+	_FORCE_INLINE_ uint8_t *data() { return (uint8_t *)this + PAD_ALIGN; }
+};
+
+static_assert(sizeof(FrameArenaBlock) <= PAD_ALIGN);
+
+struct FrameArena {
+	FrameArenaBlock *first = nullptr;
+	FrameArenaBlock *current = nullptr;
+	size_t offset = 0; // Within the current block.
+	size_t used = 0; // Within all blocks, including the space skipped at their ends.
+	size_t peak = 0;
+	uint8_t *last = nullptr; // Most recent allocation, can be grown or released in place.
+	uint32_t live = 0;
+
+	_FORCE_INLINE_ void rewind() {
+		current = first;
+		offset = 0;
+		used = 0;
+		last = nullptr;
+	}
+
+	~FrameArena() {
+		while (first) {
+			FrameArenaBlock *next = first->next;
+			frame_arena_reserved.sub(first->capacity);
+			free(first);
+			first = next;
+		}
+	}
+};
+
+static thread_local FrameArena frame_arena;
+
+void *Memory::alloc_frame(size_t p_bytes) {
+	FrameArena &arena = frame_arena;
+	size_t size = MAX(FRAME_ARENA_ALIGN(p_bytes), size_t(PAD_ALIGN));
+
+	while (!arena.current || arena.offset + size > arena.current->capacity) {
+		if (arena.current) {
+			arena.used += arena.current->capacity - arena.offset;
+		}
+		FrameArenaBlock *next = arena.current ? arena.current->next : arena.first;
+		if (!next) {
+			size_t capacity = MAX(size_t(FRAME_ARENA_BLOCK_SIZE), size);
+			next = (FrameArenaBlock *)malloc(PAD_ALIGN + capacity);
+			ERR_FAIL_NULL_V(next, nullptr);
+			next->next = nullptr;
+			next->capacity = capacity;
+			if (arena.current) {
+				arena.current->next = next;
+			} else {
+				arena.first = next;
+			}
+			frame_arena_reserved.add(capacity);
+		}
+		arena.current = next;
+		arena.offset = 0;
+	}
+
+	uint8_t *mem = arena.current->data() + arena.offset;
+	arena.offset += size;
+	arena.used += size;
+	arena.last = mem;
+	arena.live++;
+
+	if (arena.used > arena.peak) {
+		arena.peak = arena.used;
+		frame_arena_max_usage.exchange_if_greater(arena.used);
+	}
+
+	return mem;
+}
+
+void *Memory::realloc_frame(void *p_memory, size_t p_old_bytes, size_t p_bytes) {
+	if (p_memory == nullptr) {
+		return alloc_frame(p_bytes);
+	}
+	if (p_bytes == 0) {
+		free_frame(p_memory);
+		return nullptr;
+	}
+
+	FrameArena &arena = frame_arena;
+	uint8_t *mem = (uint8_t *)p_memory;
+
+	if (mem == arena.last) {
+		// Resize in place, if it still fits in its block.
+		size_t start = mem - arena.current->data();
+		size_t size = MAX(FRAME_ARENA_ALIGN(p_bytes), size_t(PAD_ALIGN));
+		if (start + size <= arena.current->capacity) {
+			arena.used = arena.used - (arena.offset - start) + size;
+			arena.offset = start + size;
+			if (arena.used > arena.peak) {
+				arena.peak = arena.used;
+				frame_arena_max_usage.exchange_if_greater(arena.used);
+			}
+			return mem;
+		}
+	}
+
+	if (p_bytes <= p_old_bytes) {
+		return mem;
+	}
+
+	void *new_mem = alloc_frame(p_bytes);
+	ERR_FAIL_NULL_V(new_mem, nullptr);
+	memcpy(new_mem, mem, p_old_bytes);
+	free_frame(mem);
+	return new_mem;
+}
+
+void Memory::free_frame(void *p_ptr) {
+	ERR_FAIL_NULL(p_ptr);
+
+	FrameArena &arena = frame_arena;
+	ERR_FAIL_COND_MSG(arena.live == 0, "Freeing frame memory that wasn't allocated by this thread.");
+
+	arena.live--;
+	if (arena.live == 0) {
+		arena.rewind();
+	} else if ((uint8_t *)p_ptr == arena.last) {
+		// Release the most recent allocation right away, so LIFO usage doesn't grow the arena.
+		size_t start = arena.last - arena.current->data();
+		arena.used -= arena.offset - start;
+		arena.offset = start;
+		arena.last = nullptr;
+	}
+}
+
+uint64_t Memory::get_frame_arena_reserved() {
+	return frame_arena_reserved.get();
+}
+
+uint64_t Memory::get_frame_arena_max_usage() {
+	return frame_arena_max_usage.get();
+}
+
+Memory::Tag Memory::register_tag(const char *p_name) {
+#ifdef DEBUG_ENABLED
+	tag_register_lock.lock();
+	if (!tag_stats[TAG_UNTAGGED].name) {
+		tag_stats[TAG_UNTAGGED].name = "Untagged";
+		tag_count.set(1);
+	}
+	uint32_t count = tag_count.get();
+	for (uint32_t i = 0; i < count; i++) {
+		if (strcmp(tag_stats[i].name, p_name) == 0) {
+			tag_register_lock.unlock();
+			return i;
+		}
+	}
+	if (count == MAX_TAGS) {
+		tag_register_lock.unlock();
+		ERR_FAIL_V_MSG(TAG_UNTAGGED, "Too many memory tags, the allocations of the new ones are counted as untagged.");
+	}
+	tag_stats[count].name = p_name;
+	tag_count.set(count + 1);
+	tag_register_lock.unlock();
+	return count;
+#else
+	return TAG_UNTAGGED;
+#endif
+}
+
+uint32_t Memory::get_tag_count() {
+#ifdef DEBUG_ENABLED
+	return MAX(tag_count.get(), 1u);
+#else
+	return 0;
+#endif
+}
+
+const char *Memory::get_tag_name(Tag p_tag) {
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_INDEX_V(p_tag, get_tag_count(), "");
+	return p_tag == TAG_UNTAGGED ? "Untagged" : tag_stats[p_tag].name;
+#else
+	return "";
+#endif
+}
+
+uint64_t Memory::get_tag_usage(Tag p_tag) {
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_INDEX_V(p_tag, MAX_TAGS, 0);
+	return tag_stats[p_tag].usage.get();
+#else
+	return 0;
+#endif
+}
+
+uint64_t Memory::get_tag_max_usage(Tag p_tag) {
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_INDEX_V(p_tag, MAX_TAGS, 0);
+	return tag_stats[p_tag].max_usage.get();
+#else
+	return 0;
+#endif
+}
+
+uint64_t Memory::get_tag_allocations(Tag p_tag) {
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_INDEX_V(p_tag, MAX_TAGS, 0);
+	return tag_stats[p_tag].allocations.get();
+#else
+	return 0;
+#endif
+}
+
+#ifdef DEBUG_ENABLED
+Memory::Tag Memory::get_current_tag() {
+	return current_tag;
+}
+
+void Memory::set_current_tag(Tag p_tag) {
+	current_tag = p_tag;
+}
+#endif
+
 uint64_t Memory::get_mem_available() {
 	return -1; // 0xFFFF...
 }
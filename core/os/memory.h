@@ -43,9 +43,29 @@
 #endif
 
 class Memory {
+public:
+	// Allocations are attributed to the tag of the innermost MemoryTagScope of their thread, see MEMORY_TAG_SCOPE().
+	// Only tracked in debug builds, where every allocation has a header.
+	typedef uint8_t Tag;
+	enum {
+		TAG_UNTAGGED = 0,
+		MAX_TAGS = 64,
+	};
+
+private:
 #ifdef DEBUG_ENABLED
 	static SafeNumeric<uint64_t> mem_usage;
 	static SafeNumeric<uint64_t> max_usage;
+
+	struct TagStats {
+		const char *name = nullptr;
+		SafeNumeric<uint64_t> usage;
+		SafeNumeric<uint64_t> max_usage;
+		SafeNumeric<uint64_t> allocations;
+	};
+	static TagStats tag_stats[MAX_TAGS];
+	static SafeNumeric<uint32_t> tag_count;
+	static thread_local Tag current_tag;
 #endif
 
 	static SafeNumeric<uint64_t> alloc_count;
@@ -55,17 +75,72 @@ public:
 	static void *realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align = false);
 	static void free_static(void *p_ptr, bool p_pad_align = false);
 
+	// Per-thread linear arena for temporaries that don't outlive the current frame.
+	// Allocating is a pointer bump and the arena is rewound as soon as everything
+	// taken from it has been freed. Memory must be freed by the thread that allocated it.
+	static void *alloc_frame(size_t p_bytes);
+	static void *realloc_frame(void *p_memory, size_t p_old_bytes, size_t p_bytes);
+	static void free_frame(void *p_ptr);
+
 	static uint64_t get_mem_available();
 	static uint64_t get_mem_usage();
 	static uint64_t get_mem_max_usage();
+
+	static uint64_t get_frame_arena_reserved(); // Bytes held by the arenas of all threads.
+	static uint64_t get_frame_arena_max_usage(); // Most bytes a single thread had in use at once.
+
+	static Tag register_tag(const char *p_name); // Registering an existing name returns its tag. The name must outlive the engine.
+	static uint32_t get_tag_count();
+	static const char *get_tag_name(Tag p_tag);
+	static uint64_t get_tag_usage(Tag p_tag); // Live bytes.
+	static uint64_t get_tag_max_usage(Tag p_tag);
+	static uint64_t get_tag_allocations(Tag p_tag); // Allocations made so far, including freed ones.
+
+#ifdef DEBUG_ENABLED
+	static Tag get_current_tag();
+	static void set_current_tag(Tag p_tag);
+#else
+	_FORCE_INLINE_ static Tag get_current_tag() { return TAG_UNTAGGED; }
+	_FORCE_INLINE_ static void set_current_tag(Tag p_tag) {}
+#endif
+};
+
+class MemoryTagScope {
+	Memory::Tag previous;
+
+public:
+	_FORCE_INLINE_ MemoryTagScope(Memory::Tag p_tag) {
+		previous = Memory::get_current_tag();
+		Memory::set_current_tag(p_tag);
+	}
+	_FORCE_INLINE_ ~MemoryTagScope() {
+		Memory::set_current_tag(previous);
+	}
 };
 
+#ifdef DEBUG_ENABLED
+#define MEMORY_TAG_SCOPE(m_name)                                     \
+	static const Memory::Tag _memory_tag = Memory::register_tag(m_name); \
+	MemoryTagScope _memory_tag_scope(_memory_tag)
+#else
+#define MEMORY_TAG_SCOPE(m_name)
+#endif
+
 class DefaultAllocator {
 public:
 	_FORCE_INLINE_ static void *alloc(size_t p_memory) { return Memory::alloc_static(p_memory, false); }
+	_FORCE_INLINE_ static void *realloc(void *p_ptr, size_t p_old_memory, size_t p_memory) { return Memory::realloc_static(p_ptr, p_memory, false); }
 	_FORCE_INLINE_ static void free(void *p_ptr) { Memory::free_static(p_ptr, false); }
 };
 
+// Allocations only valid until the end of the frame, see Memory::alloc_frame().
+class FrameAllocator {
+public:
+	_FORCE_INLINE_ static void *alloc(size_t p_memory) { return Memory::alloc_frame(p_memory); }
+	_FORCE_INLINE_ static void *realloc(void *p_ptr, size_t p_old_memory, size_t p_memory) { return Memory::realloc_frame(p_ptr, p_old_memory, p_memory); }
+	_FORCE_INLINE_ static void free(void *p_ptr) { Memory::free_frame(p_ptr); }
+};
+
 void *operator new(size_t p_size, const char *p_description); ///< operator new that takes a description and uses MemoryStaticPool
 void *operator new(size_t p_size, void *(*p_allocfunc)(size_t p_size)); ///< operator new that takes a description and uses MemoryStaticPool
 
@@ -160,6 +160,14 @@ bool OS::is_delta_smoothing_enabled() const {
 	return _delta_smoothing_enabled;
 }
 
+void OS::set_frame_pacing_spin_usec(int p_usec) {
+	frame_pacing_spin_usec = MAX(p_usec, 0);
+}
+
+int OS::get_frame_pacing_spin_usec() const {
+	return frame_pacing_spin_usec;
+}
+
 String OS::get_executable_path() const {
 	return _execpath;
 }
@@ -560,8 +568,10 @@ void OS::add_frame_delay(bool p_can_draw) {
 	// Add a dynamic frame delay to decrease CPU/GPU usage. This takes the
 	// previous frame time into account for a smoother result.
 	uint64_t dynamic_delay = 0;
+	bool power_saving = false;
 	if (is_in_low_processor_usage_mode() || !p_can_draw) {
 		dynamic_delay = get_low_processor_usage_mode_sleep_usec();
+		power_saving = true;
 	}
 	const int max_fps = Engine::get_singleton()->get_max_fps();
 	if (max_fps > 0 && !Engine::get_singleton()->is_editor_hint()) {
@@ -574,7 +584,15 @@ void OS::add_frame_delay(bool p_can_draw) {
 		uint64_t current_ticks = get_ticks_usec();
 
 		if (current_ticks < target_ticks) {
-			delay_usec(target_ticks - current_ticks);
+			// Sleeps can overshoot by a scheduler tick, so for the FPS limiter sleep until
+			// shortly before the target and spin for the rest to keep frame times even.
+			const uint64_t spin_usec = power_saving ? 0 : frame_pacing_spin_usec;
+			if (target_ticks - current_ticks > spin_usec) {
+				delay_usec(target_ticks - current_ticks - spin_usec);
+			}
+			while (get_ticks_usec() < target_ticks) {
+				yield();
+			}
 		}
 
 		current_ticks = get_ticks_usec();
@@ -33,6 +33,7 @@
 
 #include "thread.h"
 
+#include "core/object/message_queue.h"
 #include "core/object/script_language.h"
 #include "core/templates/safe_refcount.h"
 
@@ -61,6 +62,7 @@ void Thread::callback(ID p_caller_id, const Settings &p_settings, Callback p_cal
 		p_callback(p_userdata);
 	}
 	ScriptServer::thread_exit();
+	MessageQueue::thread_exit();
 	if (platform_functions.term) {
 		platform_functions.term();
 	}
@@ -39,7 +39,12 @@ StaticCString StaticCString::create(const char *p_ptr) {
 	return scs;
 }
 
-StringName::_Data *StringName::_table[STRING_TABLE_LEN];
+StringName::_Data **StringName::_table = nullptr;
+uint32_t StringName::_table_mask = 0;
+SafeNumeric<uint32_t> StringName::_table_count;
+SafeNumeric<uint32_t> StringName::_table_grow_threshold;
+SafeNumeric<uint64_t> StringName::_table_contention;
+BinaryMutex StringName::_table_shards[STRING_TABLE_SHARDS];
 
 StringName _scs_create(const char *p_chr, bool p_static) {
 	return (p_chr[0] ? StringName(StaticCString::create(p_chr), p_static) : StringName());
@@ -54,19 +59,80 @@ bool StringName::debug_stringname = false;
 
 void StringName::setup() {
 	ERR_FAIL_COND(configured);
+	_table = (_Data **)memalloc(sizeof(_Data *) * STRING_TABLE_LEN);
 	for (int i = 0; i < STRING_TABLE_LEN; i++) {
 		_table[i] = nullptr;
 	}
+	_table_mask = STRING_TABLE_LEN - 1;
+	_table_grow_threshold.set(STRING_TABLE_LEN * STRING_TABLE_MAX_LOAD);
 	configured = true;
 }
 
+void StringName::_insert(_Data *p_data) {
+	// Must be called with the shard of p_data locked.
+	uint32_t idx = p_data->hash & _table_mask;
+	p_data->idx = idx;
+	p_data->prev = nullptr;
+	p_data->next = _table[idx];
+	if (_table[idx]) {
+		_table[idx]->prev = p_data;
+	}
+	_table[idx] = p_data;
+	_table_count.increment();
+}
+
+void StringName::_grow_table() {
+	// Locking all the shards (always in the same order) gives exclusive access to the whole table.
+	for (int i = 0; i < STRING_TABLE_SHARDS; i++) {
+		_table_shards[i].lock();
+	}
+
+	// Another thread may have grown it while this one was waiting.
+	if (_table_count.get() > _table_grow_threshold.get()) {
+		uint32_t old_len = _table_mask + 1;
+		uint32_t new_len = old_len << 1;
+		_Data **old_table = _table;
+
+		_table = (_Data **)memalloc(sizeof(_Data *) * new_len);
+		for (uint32_t i = 0; i < new_len; i++) {
+			_table[i] = nullptr;
+		}
+		_table_mask = new_len - 1;
+
+		for (uint32_t i = 0; i < old_len; i++) {
+			_Data *d = old_table[i];
+			while (d) {
+				_Data *next = d->next;
+				uint32_t idx = d->hash & _table_mask;
+				d->idx = idx;
+				d->prev = nullptr;
+				d->next = _table[idx];
+				if (_table[idx]) {
+					_table[idx]->prev = d;
+				}
+				_table[idx] = d;
+				d = next;
+			}
+		}
+		memfree(old_table);
+
+		_table_grow_threshold.set(new_len * STRING_TABLE_MAX_LOAD);
+	}
+
+	for (int i = STRING_TABLE_SHARDS - 1; i >= 0; i--) {
+		_table_shards[i].unlock();
+	}
+}
+
 void StringName::cleanup() {
 	MutexLock lock(mutex);
 
+	const uint32_t table_len = _table_mask + 1;
+
 #ifdef DEBUG_ENABLED
 	if (unlikely(debug_stringname)) {
 		Vector<_Data *> data;
-		for (int i = 0; i < STRING_TABLE_LEN; i++) {
+		for (uint32_t i = 0; i < table_len; i++) {
 			_Data *d = _table[i];
 			while (d) {
 				data.push_back(d);
@@ -93,7 +159,7 @@ void StringName::cleanup() {
 	}
 #endif
 	int lost_strings = 0;
-	for (int i = 0; i < STRING_TABLE_LEN; i++) {
+	for (uint32_t i = 0; i < table_len; i++) {
 		while (_table[i]) {
 			_Data *d = _table[i];
 			if (d->static_count.get() != d->refcount.get()) {
@@ -115,6 +181,9 @@ void StringName::cleanup() {
 	if (lost_strings) {
 		print_verbose("StringName: " + itos(lost_strings) + " unclaimed string names at exit.");
 	}
+	memfree(_table);
+	_table = nullptr;
+	_table_count.set(0);
 	configured = false;
 }
 
@@ -122,7 +191,7 @@ void StringName::unref() {
 	ERR_FAIL_COND(!configured);
 
 	if (_data && _data->refcount.unref()) {
-		MutexLock lock(mutex);
+		ShardLock lock(_data->hash);
 
 		if (_data->static_count.get() > 0) {
 			if (_data->cname) {
@@ -143,6 +212,7 @@ void StringName::unref() {
 		if (_data->next) {
 			_data->next->prev = _data->prev;
 		}
+		_table_count.decrement();
 		memdelete(_data);
 	}
 
@@ -218,11 +288,14 @@ StringName::StringName(const char *p_name, bool p_static) {
 		return; //empty, ignore
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
 
-	uint32_t idx = hash & STRING_TABLE_MASK;
+	if (unlikely(_table_count.get() > _table_grow_threshold.get())) {
+		_grow_table();
+	}
+
+	ShardLock lock(hash);
+	uint32_t idx = hash & _table_mask;
 
 	_data = _table[idx];
 
@@ -252,10 +325,7 @@ StringName::StringName(const char *p_name, bool p_static) {
 	_data->refcount.init();
 	_data->static_count.set(p_static ? 1 : 0);
 	_data->hash = hash;
-	_data->idx = idx;
 	_data->cname = nullptr;
-	_data->next = _table[idx];
-	_data->prev = nullptr;
 
 #ifdef DEBUG_ENABLED
 	if (unlikely(debug_stringname)) {
@@ -264,10 +334,7 @@ StringName::StringName(const char *p_name, bool p_static) {
 		_data->static_count.increment();
 	}
 #endif
-	if (_table[idx]) {
-		_table[idx]->prev = _data;
-	}
-	_table[idx] = _data;
+	_insert(_data);
 }
 
 StringName::StringName(const StaticCString &p_static_string, bool p_static) {
@@ -277,11 +344,14 @@ StringName::StringName(const StaticCString &p_static_string, bool p_static) {
 
 	ERR_FAIL_COND(!p_static_string.ptr || !p_static_string.ptr[0]);
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_static_string.ptr);
 
-	uint32_t idx = hash & STRING_TABLE_MASK;
+	if (unlikely(_table_count.get() > _table_grow_threshold.get())) {
+		_grow_table();
+	}
+
+	ShardLock lock(hash);
+	uint32_t idx = hash & _table_mask;
 
 	_data = _table[idx];
 
@@ -311,10 +381,7 @@ StringName::StringName(const StaticCString &p_static_string, bool p_static) {
 	_data->refcount.init();
 	_data->static_count.set(p_static ? 1 : 0);
 	_data->hash = hash;
-	_data->idx = idx;
 	_data->cname = p_static_string.ptr;
-	_data->next = _table[idx];
-	_data->prev = nullptr;
 #ifdef DEBUG_ENABLED
 	if (unlikely(debug_stringname)) {
 		// Keep in memory, force static.
@@ -322,10 +389,7 @@ StringName::StringName(const StaticCString &p_static_string, bool p_static) {
 		_data->static_count.increment();
 	}
 #endif
-	if (_table[idx]) {
-		_table[idx]->prev = _data;
-	}
-	_table[idx] = _data;
+	_insert(_data);
 }
 
 StringName::StringName(const String &p_name, bool p_static) {
@@ -337,10 +401,14 @@ StringName::StringName(const String &p_name, bool p_static) {
 		return;
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = p_name.hash();
-	uint32_t idx = hash & STRING_TABLE_MASK;
+
+	if (unlikely(_table_count.get() > _table_grow_threshold.get())) {
+		_grow_table();
+	}
+
+	ShardLock lock(hash);
+	uint32_t idx = hash & _table_mask;
 
 	_data = _table[idx];
 
@@ -369,10 +437,7 @@ StringName::StringName(const String &p_name, bool p_static) {
 	_data->refcount.init();
 	_data->static_count.set(p_static ? 1 : 0);
 	_data->hash = hash;
-	_data->idx = idx;
 	_data->cname = nullptr;
-	_data->next = _table[idx];
-	_data->prev = nullptr;
 #ifdef DEBUG_ENABLED
 	if (unlikely(debug_stringname)) {
 		// Keep in memory, force static.
@@ -380,11 +445,7 @@ StringName::StringName(const String &p_name, bool p_static) {
 		_data->static_count.increment();
 	}
 #endif
-
-	if (_table[idx]) {
-		_table[idx]->prev = _data;
-	}
-	_table[idx] = _data;
+	_insert(_data);
 }
 
 StringName StringName::search(const char *p_name) {
@@ -395,10 +456,10 @@ StringName StringName::search(const char *p_name) {
 		return StringName();
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
-	uint32_t idx = hash & STRING_TABLE_MASK;
+
+	ShardLock lock(hash);
+	uint32_t idx = hash & _table_mask;
 
 	_Data *_data = _table[idx];
 
@@ -431,11 +492,10 @@ StringName StringName::search(const char32_t *p_name) {
 		return StringName();
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
 
-	uint32_t idx = hash & STRING_TABLE_MASK;
+	ShardLock lock(hash);
+	uint32_t idx = hash & _table_mask;
 
 	_Data *_data = _table[idx];
 
@@ -457,11 +517,10 @@ StringName StringName::search(const char32_t *p_name) {
 StringName StringName::search(const String &p_name) {
 	ERR_FAIL_COND_V(p_name.is_empty(), StringName());
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = p_name.hash();
 
-	uint32_t idx = hash & STRING_TABLE_MASK;
+	ShardLock lock(hash);
+	uint32_t idx = hash & _table_mask;
 
 	_Data *_data = _table[idx];
 
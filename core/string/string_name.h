@@ -46,9 +46,14 @@ struct StaticCString {
 
 class StringName {
 	enum {
-		STRING_TABLE_BITS = 16,
+		STRING_TABLE_BITS = 16, // Initial size, grown as names are added.
 		STRING_TABLE_LEN = 1 << STRING_TABLE_BITS,
-		STRING_TABLE_MASK = STRING_TABLE_LEN - 1
+		STRING_TABLE_MAX_LOAD = 2, // Average chain length that triggers growing the table.
+		// The table is split in shards, each with its own lock, so threads interning different names rarely contend.
+		// The shard is taken from the lowest bits of the hash, so it doesn't change when the table grows.
+		STRING_TABLE_SHARD_BITS = 6,
+		STRING_TABLE_SHARDS = 1 << STRING_TABLE_SHARD_BITS,
+		STRING_TABLE_SHARD_MASK = STRING_TABLE_SHARDS - 1,
 	};
 
 	struct _Data {
@@ -67,7 +72,31 @@ class StringName {
 		_Data() {}
 	};
 
-	static _Data *_table[STRING_TABLE_LEN];
+	static _Data **_table;
+	static uint32_t _table_mask;
+	static SafeNumeric<uint32_t> _table_count;
+	static SafeNumeric<uint32_t> _table_grow_threshold;
+	static SafeNumeric<uint64_t> _table_contention;
+	static BinaryMutex _table_shards[STRING_TABLE_SHARDS];
+
+	class ShardLock {
+		const BinaryMutex &mutex;
+
+	public:
+		_FORCE_INLINE_ explicit ShardLock(uint32_t p_hash) :
+				mutex(_table_shards[p_hash & STRING_TABLE_SHARD_MASK]) {
+			if (!mutex.try_lock()) {
+				_table_contention.increment();
+				mutex.lock();
+			}
+		}
+		_FORCE_INLINE_ ~ShardLock() {
+			mutex.unlock();
+		}
+	};
+
+	static void _insert(_Data *p_data);
+	static void _grow_table();
 
 	_Data *_data = nullptr;
 
@@ -155,6 +184,9 @@ public:
 		return String();
 	}
 
+	static uint32_t get_interned_count() { return _table_count.get(); }
+	static uint64_t get_lock_contention_count() { return _table_contention.get(); }
+
 	static StringName search(const char *p_name);
 	static StringName search(const char32_t *p_name);
 	static StringName search(const String &p_name);
@@ -474,8 +474,22 @@ void String::operator=(const wchar_t *p_str) {
 }
 
 String String::operator+(const String &p_str) const {
-	String res = *this;
-	res += p_str;
+	const int lhs_len = length();
+	if (lhs_len == 0) {
+		return p_str;
+	}
+	const int rhs_len = p_str.length();
+	if (rhs_len == 0) {
+		return *this;
+	}
+
+	// Build the result in a single allocation, without sharing and then copying this string's buffer.
+	String res;
+	res.resize(lhs_len + rhs_len + 1);
+	char32_t *dst = res.ptrw();
+	memcpy(dst, ptr(), lhs_len * sizeof(char32_t));
+	memcpy(dst + lhs_len, p_str.ptr(), rhs_len * sizeof(char32_t));
+	dst[lhs_len + rhs_len] = _null;
 	return res;
 }
 
@@ -1474,6 +1488,19 @@ String String::to_lower() const {
 }
 
 String String::chr(char32_t p_char) {
+	if (p_char < 128) {
+		// Single ASCII characters are common enough (tokenizers, indexing) to share one buffer each instead of allocating.
+		static const struct AsciiTable {
+			String chars[128];
+			AsciiTable() {
+				for (char32_t i = 1; i < 128; i++) {
+					char32_t c[2] = { i, 0 };
+					chars[i] = String(c);
+				}
+			}
+		} ascii;
+		return ascii.chars[p_char];
+	}
 	char32_t c[2] = { p_char, 0 };
 	return String(c);
 }
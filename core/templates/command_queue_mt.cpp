@@ -70,13 +70,223 @@ CommandQueueMT::SyncSemaphore *CommandQueueMT::_alloc_sync_sem() {
 	return &sync_sems[idx];
 }
 
+SafeNumeric<uint64_t> CommandQueueMT::last_queue_id;
+thread_local CommandQueueMT::ProducerCache CommandQueueMT::producer_cache[PRODUCER_CACHE_SIZE];
+thread_local uint32_t CommandQueueMT::producer_cache_next = 0;
+thread_local CommandQueueMT::ProducerThreadOwner CommandQueueMT::producer_thread;
+
+CommandQueueMT::ProducerThreadOwner::~ProducerThreadOwner() {
+	if (thread) {
+		thread->exited.set();
+		if (thread->refcount.unref()) {
+			memdelete(thread);
+		}
+	}
+}
+
+void CommandQueueMT::_add_block(Producer *p_producer, uint32_t p_min_size) {
+	Block *block = nullptr;
+	if (p_min_size <= BLOCK_SIZE) {
+		block = p_producer->spare.exchange(nullptr, std::memory_order_acq_rel);
+	}
+	if (!block) {
+		uint32_t capacity = MAX((uint32_t)BLOCK_SIZE, p_min_size);
+		uint8_t *mem = (uint8_t *)memalloc(BLOCK_DATA_OFFSET + capacity);
+		block = memnew_placement(mem, Block);
+		block->capacity = capacity;
+	}
+
+	if (p_producer->tail) {
+		// Everything in the current tail was committed already, so the consumer can move past it.
+		p_producer->tail->next.store(block, std::memory_order_release);
+	}
+	p_producer->tail = block;
+	p_producer->tail_used = 0;
+}
+
+CommandQueueMT::Producer *CommandQueueMT::_register_producer() {
+	if (!producer_thread.thread) {
+		producer_thread.thread = memnew(ProducerThread);
+		producer_thread.thread->refcount.init();
+	}
+	ProducerThread *thread = producer_thread.thread;
+
+	MutexLock mutex_lock(mutex);
+	Producer *producer = producers.load(std::memory_order_acquire);
+	while (producer && producer->thread != thread) {
+		producer = producer->next;
+	}
+
+	if (!producer) {
+		producer = memnew(Producer);
+		producer->thread = thread;
+		thread->refcount.ref();
+		_add_block(producer, 0);
+		producer->head = producer->tail;
+		producer->next = producers.load(std::memory_order_relaxed);
+		producers.store(producer, std::memory_order_release);
+	}
+
+	ProducerCache &cache = producer_cache[producer_cache_next++ % PRODUCER_CACHE_SIZE];
+	cache.queue_id = queue_id;
+	cache.producer = producer;
+	return producer;
+}
+
+void CommandQueueMT::_free_producer(Producer *p_producer) {
+	Block *block = p_producer->head;
+	while (block) {
+		Block *next = block->next.load(std::memory_order_relaxed);
+		block->~Block();
+		memfree(block);
+		block = next;
+	}
+	Block *spare = p_producer->spare.load(std::memory_order_relaxed);
+	if (spare) {
+		spare->~Block();
+		memfree(spare);
+	}
+
+	if (p_producer->thread->refcount.unref()) {
+		memdelete(p_producer->thread);
+	}
+	memdelete(p_producer);
+}
+
+void CommandQueueMT::_reclaim_producers() {
+	bool exited = false;
+	for (Producer *producer = producers.load(std::memory_order_acquire); producer; producer = producer->next) {
+		if (producer->thread->exited.is_set()) {
+			exited = true;
+			break;
+		}
+	}
+	if (!exited) {
+		return;
+	}
+
+	// The thread can't push anymore, so once its commands ran nothing refers to its queue.
+	MutexLock mutex_lock(mutex);
+	Producer *prev = nullptr;
+	Producer *producer = producers.load(std::memory_order_relaxed);
+	while (producer) {
+		Producer *next = producer->next;
+		if (producer->thread->exited.is_set() && !_peek(producer)) {
+			if (prev) {
+				prev->next = next;
+			} else {
+				producers.store(next, std::memory_order_release);
+			}
+			_free_producer(producer);
+		} else {
+			prev = producer;
+		}
+		producer = next;
+	}
+}
+
+CommandQueueMT::CommandHeader *CommandQueueMT::_peek(Producer *p_producer) {
+	Block *block = p_producer->head;
+	while (true) {
+		if (block->read < block->committed.load(std::memory_order_acquire)) {
+			return reinterpret_cast<CommandHeader *>(block->data() + block->read);
+		}
+
+		Block *next = block->next.load(std::memory_order_acquire);
+		if (!next) {
+			return nullptr;
+		}
+		if (block->read < block->committed.load(std::memory_order_acquire)) {
+			continue; // Committed right before the producer moved to the next block.
+		}
+
+		// Done with this block, hand it back to the producer for reuse.
+		p_producer->head = next;
+		if (block->capacity == BLOCK_SIZE) {
+			block->committed.store(0, std::memory_order_relaxed);
+			block->read = 0;
+			block->next.store(nullptr, std::memory_order_relaxed);
+			block = p_producer->spare.exchange(block, std::memory_order_acq_rel);
+		}
+		if (block) {
+			block->~Block();
+			memfree(block);
+		}
+		block = next;
+	}
+}
+
+void CommandQueueMT::_consume(Producer *p_producer, CommandHeader *p_header) {
+	CommandBase *cmd = reinterpret_cast<CommandBase *>(p_header + 1);
+
+	cmd->call(); //execute the function
+	cmd->post(); //release in case it needs sync/ret
+	cmd->~CommandBase(); //should be done, so erase the command
+
+	p_producer->head->read += sizeof(CommandHeader) + p_header->size;
+}
+
+void CommandQueueMT::_flush() {
+	MutexLock flush_lock(flush_mutex);
+
+	// Commands pushed while flushing wait for the next flush.
+	const uint64_t limit = next_sequence.get();
+	uint64_t flushed = 0;
+
+	while (true) {
+		// Find the queue with the oldest command, and the oldest command among the other queues.
+		Producer *best = nullptr;
+		CommandHeader *best_header = nullptr;
+		uint64_t other_sequence = limit;
+		for (Producer *producer = producers.load(std::memory_order_acquire); producer; producer = producer->next) {
+			CommandHeader *header = _peek(producer);
+			if (!header || header->sequence >= limit) {
+				continue;
+			}
+			if (!best || header->sequence < best_header->sequence) {
+				if (best) {
+					other_sequence = MIN(other_sequence, best_header->sequence);
+				}
+				best = producer;
+				best_header = header;
+			} else {
+				other_sequence = MIN(other_sequence, header->sequence);
+			}
+		}
+
+		if (!best) {
+			break;
+		}
+
+		// Run commands from that queue in bulk, until another queue has an older one.
+		do {
+			_consume(best, best_header);
+			flushed++;
+			best_header = _peek(best);
+		} while (best_header && best_header->sequence < other_sequence);
+	}
+
+	flushed_count.add(flushed);
+
+	// Threads that push once and exit (e.g. low priority pool tasks) would otherwise keep their blocks forever.
+	_reclaim_producers();
+}
+
 CommandQueueMT::CommandQueueMT(bool p_sync) {
+	queue_id = last_queue_id.increment();
 	if (p_sync) {
 		sync = memnew(Semaphore);
 	}
 }
 
 CommandQueueMT::~CommandQueueMT() {
+	Producer *producer = producers.load(std::memory_order_acquire);
+	while (producer) {
+		Producer *next = producer->next;
+		_free_producer(producer);
+		producer = next;
+	}
+
 	if (sync) {
 		memdelete(sync);
 	}
@@ -34,11 +34,15 @@
 #include "core/os/memory.h"
 #include "core/os/mutex.h"
 #include "core/os/semaphore.h"
+#include "core/os/thread.h"
 #include "core/string/print_string.h"
 #include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 #include "core/templates/simple_type.h"
 #include "core/typedefs.h"
 
+#include <atomic>
+
 #define COMMA(N) _COMMA_##N
 #define _COMMA_0
 #define _COMMA_1 ,
@@ -250,11 +254,12 @@
 #define DECL_PUSH(N)                                                         \
 	template <class T, class M COMMA(N) COMMA_SEP_LIST(TYPE_PARAM, N)>       \
 	void push(T *p_instance, M p_method COMMA(N) COMMA_SEP_LIST(PARAM, N)) { \
-		CMD_TYPE(N) *cmd = allocate_and_lock<CMD_TYPE(N)>();                 \
+		Producer *producer = _get_producer();                                \
+		CMD_TYPE(N) *cmd = allocate<CMD_TYPE(N)>(producer);                  \
 		cmd->instance = p_instance;                                          \
 		cmd->method = p_method;                                              \
 		SEMIC_SEP_LIST(CMD_ASSIGN_PARAM, N);                                 \
-		unlock();                                                            \
+		commit(producer);                                                    \
 		if (sync)                                                            \
 			sync->post();                                                    \
 	}
@@ -265,13 +270,14 @@
 	template <class T, class M, COMMA_SEP_LIST(TYPE_PARAM, N) COMMA(N) class R>                \
 	void push_and_ret(T *p_instance, M p_method, COMMA_SEP_LIST(PARAM, N) COMMA(N) R *r_ret) { \
 		SyncSemaphore *ss = _alloc_sync_sem();                                                 \
-		CMD_RET_TYPE(N) *cmd = allocate_and_lock<CMD_RET_TYPE(N)>();                           \
+		Producer *producer = _get_producer();                                                  \
+		CMD_RET_TYPE(N) *cmd = allocate<CMD_RET_TYPE(N)>(producer);                            \
 		cmd->instance = p_instance;                                                            \
 		cmd->method = p_method;                                                                \
 		SEMIC_SEP_LIST(CMD_ASSIGN_PARAM, N);                                                   \
 		cmd->ret = r_ret;                                                                      \
 		cmd->sync_sem = ss;                                                                    \
-		unlock();                                                                              \
+		commit(producer);                                                                      \
 		if (sync)                                                                              \
 			sync->post();                                                                      \
 		ss->sem.wait();                                                                        \
@@ -284,12 +290,13 @@
 	template <class T, class M COMMA(N) COMMA_SEP_LIST(TYPE_PARAM, N)>                \
 	void push_and_sync(T *p_instance, M p_method COMMA(N) COMMA_SEP_LIST(PARAM, N)) { \
 		SyncSemaphore *ss = _alloc_sync_sem();                                        \
-		CMD_SYNC_TYPE(N) *cmd = allocate_and_lock<CMD_SYNC_TYPE(N)>();                \
+		Producer *producer = _get_producer();                                         \
+		CMD_SYNC_TYPE(N) *cmd = allocate<CMD_SYNC_TYPE(N)>(producer);                 \
 		cmd->instance = p_instance;                                                   \
 		cmd->method = p_method;                                                       \
 		SEMIC_SEP_LIST(CMD_ASSIGN_PARAM, N);                                          \
 		cmd->sync_sem = ss;                                                           \
-		unlock();                                                                     \
+		commit(producer);                                                             \
 		if (sync)                                                                     \
 			sync->post();                                                             \
 		ss->sem.wait();                                                               \
@@ -331,56 +338,113 @@ class CommandQueueMT {
 
 	/***** BASE *******/
 
+	// Every thread pushing commands gets its own single-producer queue, made of a list
+	// of blocks, so pushing doesn't need any lock. Commands carry a global sequence
+	// number, and flushing merges the queues in that order, so commands run in the same
+	// order as they would with a single queue (e.g. a RID initialized by one thread is
+	// ready by the time a command pushed later by another thread uses it).
+
 	enum {
-		DEFAULT_COMMAND_MEM_SIZE_KB = 256,
-		SYNC_SEMAPHORES = 8
+		BLOCK_SIZE = 64 * 1024,
+		SYNC_SEMAPHORES = 8,
+		PRODUCER_CACHE_SIZE = 4,
 	};
 
-	LocalVector<uint8_t> command_mem;
-	SyncSemaphore sync_sems[SYNC_SEMAPHORES];
-	Mutex mutex;
-	Semaphore *sync = nullptr;
+	struct CommandHeader {
+		uint64_t sequence = 0;
+		uint64_t size = 0; // Of the command, after the header.
+	};
 
-	template <class T>
-	T *allocate() {
-		// alloc size is size+T+safeguard
-		uint32_t alloc_size = ((sizeof(T) + 8 - 1) & ~(8 - 1));
-		uint64_t size = command_mem.size();
-		command_mem.resize(size + alloc_size + 8);
-		*(uint64_t *)&command_mem[size] = alloc_size;
-		T *cmd = memnew_placement(&command_mem[size + 8], T);
-		return cmd;
-	}
+	struct Block {
+		std::atomic<uint32_t> committed = { 0 }; // Written by the producer.
+		uint32_t read = 0; // Only used by the consumer.
+		uint32_t capacity = 0;
+		std::atomic<Block *> next = { nullptr };
 
-	template <class T>
-	T *allocate_and_lock() {
-		lock();
-		T *ret = allocate<T>();
-		return ret;
-	}
+		_FORCE_INLINE_ uint8_t *data() { return reinterpret_cast<uint8_t *>(this) + BLOCK_DATA_OFFSET; }
+	};
 
-	void _flush() {
-		lock();
+	static constexpr uint32_t BLOCK_DATA_OFFSET = (sizeof(Block) + 15) & ~15;
 
-		uint64_t read_ptr = 0;
-		uint64_t limit = command_mem.size();
+	// Shared by the queues a thread pushes to, so they can free its producers once it exits.
+	struct ProducerThread {
+		SafeRefCount refcount;
+		SafeFlag exited;
+	};
 
-		while (read_ptr < limit) {
-			uint64_t size = *(uint64_t *)&command_mem[read_ptr];
-			read_ptr += 8;
-			CommandBase *cmd = reinterpret_cast<CommandBase *>(&command_mem[read_ptr]);
+	struct ProducerThreadOwner {
+		ProducerThread *thread = nullptr;
+		~ProducerThreadOwner();
+	};
 
-			cmd->call(); //execute the function
-			cmd->post(); //release in case it needs sync/ret
-			cmd->~CommandBase(); //should be done, so erase the command
+	struct Producer {
+		Block *tail = nullptr; // Only used by the producer.
+		uint32_t tail_used = 0;
+		Block *head = nullptr; // Only used by the consumer.
+		std::atomic<Block *> spare = { nullptr }; // A consumed block, handed back to the producer.
+		ProducerThread *thread = nullptr;
+		Producer *next = nullptr;
+	};
 
-			read_ptr += size;
+	struct ProducerCache {
+		uint64_t queue_id = 0;
+		Producer *producer = nullptr;
+	};
+
+	static SafeNumeric<uint64_t> last_queue_id;
+	static thread_local ProducerCache producer_cache[PRODUCER_CACHE_SIZE];
+	static thread_local uint32_t producer_cache_next;
+	static thread_local ProducerThreadOwner producer_thread;
+
+	uint64_t queue_id = 0;
+	std::atomic<Producer *> producers = { nullptr };
+	SafeNumeric<uint64_t> next_sequence;
+	SafeNumeric<uint64_t> flushed_count;
+	SyncSemaphore sync_sems[SYNC_SEMAPHORES];
+	Mutex mutex;
+	Mutex flush_mutex;
+	Semaphore *sync = nullptr;
+
+	_FORCE_INLINE_ Producer *_get_producer() {
+		for (uint32_t i = 0; i < PRODUCER_CACHE_SIZE; i++) {
+			if (producer_cache[i].queue_id == queue_id) {
+				return producer_cache[i].producer;
+			}
 		}
+		return _register_producer();
+	}
 
-		command_mem.clear();
-		unlock();
+	template <class T>
+	T *allocate(Producer *p_producer) {
+		// alloc size is header+T, 8 aligned
+		uint32_t cmd_size = ((sizeof(T) + 8 - 1) & ~(8 - 1));
+		uint32_t alloc_size = sizeof(CommandHeader) + cmd_size;
+		if (unlikely(!p_producer->tail || p_producer->tail_used + alloc_size > p_producer->tail->capacity)) {
+			_add_block(p_producer, alloc_size);
+		}
+		uint8_t *mem = p_producer->tail->data() + p_producer->tail_used;
+		p_producer->tail_used += alloc_size;
+		reinterpret_cast<CommandHeader *>(mem)->size = cmd_size;
+		T *cmd = memnew_placement(mem + sizeof(CommandHeader), T);
+		return cmd;
 	}
 
+	_FORCE_INLINE_ void commit(Producer *p_producer) {
+		// The command just allocated is the last one in the tail block.
+		Block *block = p_producer->tail;
+		uint32_t cmd_pos = block->committed.load(std::memory_order_relaxed);
+		reinterpret_cast<CommandHeader *>(block->data() + cmd_pos)->sequence = next_sequence.postincrement();
+		block->committed.store(p_producer->tail_used, std::memory_order_release);
+	}
+
+	CommandHeader *_peek(Producer *p_producer);
+	void _consume(Producer *p_producer, CommandHeader *p_header);
+	void _add_block(Producer *p_producer, uint32_t p_min_size);
+	Producer *_register_producer();
+	void _free_producer(Producer *p_producer);
+	void _reclaim_producers();
+	void _flush();
+
 	void lock();
 	void unlock();
 	void wait_for_flush();
@@ -400,7 +464,7 @@ public:
 	SPACE_SEP_LIST(DECL_PUSH_AND_SYNC, 15)
 
 	_FORCE_INLINE_ void flush_if_pending() {
-		if (unlikely(command_mem.size() > 0)) {
+		if (unlikely(flushed_count.get() != next_sequence.get())) {
 			_flush();
 		}
 	}
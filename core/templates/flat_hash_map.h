@@ -0,0 +1,548 @@
+/**************************************************************************/
+/*  flat_hash_map.h                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef FLAT_HASH_MAP_H
+#define FLAT_HASH_MAP_H
+
+#include "core/os/memory.h"
+#include "core/templates/hashfuncs.h"
+#include "core/templates/pair.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FLAT_HASH_MAP_SSE2
+#include <emmintrin.h>
+#endif
+
+#include <string.h>
+#include <type_traits>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+// Both only called with non-zero values.
+static _FORCE_INLINE_ uint32_t _flat_hash_map_ctz(uint64_t p_value) {
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_ctzll(p_value);
+#elif defined(_MSC_VER) && defined(_WIN64)
+	unsigned long index;
+	_BitScanForward64(&index, p_value);
+	return index;
+#else
+	uint32_t count = 0;
+	while (!(p_value & 1)) {
+		p_value >>= 1;
+		count++;
+	}
+	return count;
+#endif
+}
+
+static _FORCE_INLINE_ uint32_t _flat_hash_map_clz(uint64_t p_value) {
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_clzll(p_value);
+#elif defined(_MSC_VER) && defined(_WIN64)
+	unsigned long index;
+	_BitScanReverse64(&index, p_value);
+	return 63 - index;
+#else
+	uint32_t count = 0;
+	while (!(p_value & (uint64_t(1) << 63))) {
+		p_value <<= 1;
+		count++;
+	}
+	return count;
+#endif
+}
+
+/**
+ * A HashMap implementation in the style of Swiss tables. The table only holds
+ * one control byte (7 bits of the hash, or a marker for empty and deleted slots)
+ * and one index per slot, and a whole group of control bytes is matched at once
+ * (with SSE2 when available), so most lookups touch a single key.
+ *
+ * Keys and values are stored densely in a separate array, which makes iteration
+ * as fast as iterating a LocalVector. In exchange, there's no insertion order:
+ * erasing moves the last pair into the erased one's place. Erasing or inserting
+ * invalidates iterators and pointers to values, like with LocalVector.
+ *
+ * Pairs are relocated with memrealloc() when growing, so like LocalVector it
+ * requires TKey and TValue to be trivially relocatable, which all engine types are.
+ *
+ * Use it instead of HashMap for engine-internal maps that are looked up and
+ * iterated a lot, but whose iteration order doesn't matter.
+ */
+
+#ifdef FLAT_HASH_MAP_SSE2
+struct FlatHashMapGroup {
+	static constexpr uint32_t WIDTH = 16;
+
+	__m128i ctrl;
+
+	// Bit N of the masks means the Nth slot of the group matches.
+	_FORCE_INLINE_ uint32_t match(int8_t p_h2) const {
+		return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(p_h2), ctrl));
+	}
+	_FORCE_INLINE_ uint32_t match_empty() const {
+		return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(-128), ctrl));
+	}
+	_FORCE_INLINE_ uint32_t match_empty_or_deleted() const {
+		return _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), ctrl));
+	}
+	static _FORCE_INLINE_ uint32_t next_match(uint32_t &r_mask) {
+		uint32_t index = _flat_hash_map_ctz(r_mask);
+		r_mask &= r_mask - 1;
+		return index;
+	}
+	// Number of slots before the first match, and after the last one.
+	static _FORCE_INLINE_ uint32_t leading_unmatched(uint32_t p_mask) { return _flat_hash_map_ctz(p_mask); }
+	static _FORCE_INLINE_ uint32_t trailing_unmatched(uint32_t p_mask) { return _flat_hash_map_clz(p_mask) - (64 - WIDTH); }
+
+	_FORCE_INLINE_ explicit FlatHashMapGroup(const int8_t *p_ctrl) {
+		ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p_ctrl));
+	}
+};
+#else
+// Portable fallback, matching 8 control bytes packed in an integer.
+struct FlatHashMapGroup {
+	static constexpr uint32_t WIDTH = 8;
+	static constexpr uint64_t LSBS = 0x0101010101010101ULL;
+	static constexpr uint64_t MSBS = 0x8080808080808080ULL;
+
+	uint64_t ctrl = 0;
+
+	// The high bit of the Nth byte of the masks means the Nth slot of the group matches.
+	// match() may report false positives, which are discarded after comparing the keys.
+	_FORCE_INLINE_ uint64_t match(int8_t p_h2) const {
+		uint64_t x = ctrl ^ (LSBS * uint8_t(p_h2));
+		return (x - LSBS) & ~x & MSBS;
+	}
+	_FORCE_INLINE_ uint64_t match_empty() const {
+		return (ctrl & ~(ctrl << 6)) & MSBS;
+	}
+	_FORCE_INLINE_ uint64_t match_empty_or_deleted() const {
+		return (ctrl & ~(ctrl << 7)) & MSBS;
+	}
+	static _FORCE_INLINE_ uint32_t next_match(uint64_t &r_mask) {
+		uint32_t index = _flat_hash_map_ctz(r_mask) >> 3;
+		r_mask &= r_mask - 1;
+		return index;
+	}
+	// Number of slots before the first match, and after the last one.
+	static _FORCE_INLINE_ uint32_t leading_unmatched(uint64_t p_mask) { return _flat_hash_map_ctz(p_mask) >> 3; }
+	static _FORCE_INLINE_ uint32_t trailing_unmatched(uint64_t p_mask) { return _flat_hash_map_clz(p_mask) >> 3; }
+
+	_FORCE_INLINE_ explicit FlatHashMapGroup(const int8_t *p_ctrl) {
+		for (uint32_t i = 0; i < WIDTH; i++) {
+			ctrl |= uint64_t(uint8_t(p_ctrl[i])) << (i * 8);
+		}
+	}
+};
+#endif
+
+template <class TKey, class TValue,
+		class Hasher = HashMapHasherDefault,
+		class Comparator = HashMapComparatorDefault<TKey>>
+class FlatHashMap {
+public:
+	static constexpr uint32_t MIN_CAPACITY = FlatHashMapGroup::WIDTH * 2;
+
+private:
+	static constexpr int8_t CTRL_EMPTY = -128;
+	static constexpr int8_t CTRL_DELETED = -2;
+
+	int8_t *ctrl = nullptr; // capacity + WIDTH bytes, the last group mirrors the first one.
+	uint32_t *slot_pairs = nullptr; // Index in pairs of each full slot.
+	KeyValue<TKey, TValue> *pairs = nullptr;
+	uint32_t *pair_slots = nullptr; // Slot of each pair.
+
+	uint32_t capacity = 0; // Always a power of 2.
+	uint32_t num_elements = 0;
+	uint32_t num_deleted = 0;
+
+	static _FORCE_INLINE_ uint32_t _h1(uint32_t p_hash) { return p_hash >> 7; }
+	static _FORCE_INLINE_ int8_t _h2(uint32_t p_hash) { return p_hash & 0x7F; }
+
+	// No more than 7/8 of the slots can be used (including deleted ones),
+	// so every probe sequence finds an empty slot.
+	static _FORCE_INLINE_ uint32_t _get_max_elements(uint32_t p_capacity) { return p_capacity - p_capacity / 8; }
+
+	_FORCE_INLINE_ void _set_ctrl(uint32_t p_slot, int8_t p_value) {
+		ctrl[p_slot] = p_value;
+		ctrl[((p_slot - FlatHashMapGroup::WIDTH) & (capacity - 1)) + FlatHashMapGroup::WIDTH] = p_value;
+	}
+
+	bool _lookup_slot(const TKey &p_key, uint32_t &r_slot) const {
+		if (num_elements == 0) {
+			return false;
+		}
+
+		const uint32_t hash = Hasher::hash(p_key);
+		const int8_t h2 = _h2(hash);
+		const uint32_t mask = capacity - 1;
+		uint32_t pos = _h1(hash) & mask;
+		uint32_t stride = 0;
+
+		while (true) {
+			FlatHashMapGroup group(ctrl + pos);
+			auto matches = group.match(h2);
+			while (matches) {
+				uint32_t slot = (pos + FlatHashMapGroup::next_match(matches)) & mask;
+				if (Comparator::compare(pairs[slot_pairs[slot]].key, p_key)) {
+					r_slot = slot;
+					return true;
+				}
+			}
+			if (group.match_empty()) {
+				return false;
+			}
+			stride += FlatHashMapGroup::WIDTH;
+			pos = (pos + stride) & mask;
+		}
+	}
+
+	uint32_t _find_free_slot(uint32_t p_hash) const {
+		const uint32_t mask = capacity - 1;
+		uint32_t pos = _h1(p_hash) & mask;
+		uint32_t stride = 0;
+
+		while (true) {
+			auto matches = FlatHashMapGroup(ctrl + pos).match_empty_or_deleted();
+			if (matches) {
+				return (pos + FlatHashMapGroup::next_match(matches)) & mask;
+			}
+			stride += FlatHashMapGroup::WIDTH;
+			pos = (pos + stride) & mask;
+		}
+	}
+
+	void _resize_and_rehash(uint32_t p_new_capacity) {
+		uint32_t max_elements = _get_max_elements(p_new_capacity);
+		if (p_new_capacity != capacity) {
+			pairs = reinterpret_cast<KeyValue<TKey, TValue> *>(Memory::realloc_static(pairs, sizeof(KeyValue<TKey, TValue>) * max_elements));
+			pair_slots = reinterpret_cast<uint32_t *>(Memory::realloc_static(pair_slots, sizeof(uint32_t) * max_elements));
+			if (ctrl) {
+				Memory::free_static(ctrl);
+				Memory::free_static(slot_pairs);
+			}
+			capacity = p_new_capacity;
+			ctrl = reinterpret_cast<int8_t *>(Memory::alloc_static(capacity + FlatHashMapGroup::WIDTH));
+			slot_pairs = reinterpret_cast<uint32_t *>(Memory::alloc_static(sizeof(uint32_t) * capacity));
+		}
+
+		memset(ctrl, CTRL_EMPTY, capacity + FlatHashMapGroup::WIDTH);
+		num_deleted = 0;
+
+		for (uint32_t i = 0; i < num_elements; i++) {
+			uint32_t hash = Hasher::hash(pairs[i].key);
+			uint32_t slot = _find_free_slot(hash);
+			_set_ctrl(slot, _h2(hash));
+			slot_pairs[slot] = i;
+			pair_slots[i] = slot;
+		}
+	}
+
+	KeyValue<TKey, TValue> *_insert(const TKey &p_key, const TValue &p_value) {
+		uint32_t slot = 0;
+		if (_lookup_slot(p_key, slot)) {
+			KeyValue<TKey, TValue> *pair = &pairs[slot_pairs[slot]];
+			pair->value = p_value;
+			return pair;
+		}
+
+		if (num_elements + num_deleted + 1 > _get_max_elements(capacity)) {
+			// Grow, unless rehashing is enough to clean up deleted slots.
+			uint32_t new_capacity = MAX(MIN_CAPACITY, capacity);
+			if (num_elements + 1 > _get_max_elements(new_capacity) / 2) {
+				ERR_FAIL_COND_V_MSG(new_capacity > (1u << 30), nullptr, "Hash table maximum capacity reached, aborting insertion.");
+				new_capacity *= 2;
+			}
+			_resize_and_rehash(new_capacity);
+		}
+
+		uint32_t hash = Hasher::hash(p_key);
+		slot = _find_free_slot(hash);
+		if (ctrl[slot] == CTRL_DELETED) {
+			num_deleted--;
+		}
+		_set_ctrl(slot, _h2(hash));
+
+		uint32_t index = num_elements++;
+		new (&pairs[index]) KeyValue<TKey, TValue>(p_key, p_value);
+		slot_pairs[slot] = index;
+		pair_slots[index] = slot;
+		return &pairs[index];
+	}
+
+public:
+	struct Iterator {
+		_FORCE_INLINE_ KeyValue<TKey, TValue> &operator*() const { return *E; }
+		_FORCE_INLINE_ KeyValue<TKey, TValue> *operator->() const { return E; }
+		_FORCE_INLINE_ Iterator &operator++() {
+			if (E) {
+				E++;
+				if (E == end) {
+					E = nullptr;
+				}
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return E == b.E; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return E != b.E; }
+
+		_FORCE_INLINE_ explicit operator bool() const { return E != nullptr; }
+
+		_FORCE_INLINE_ Iterator(KeyValue<TKey, TValue> *p_E, KeyValue<TKey, TValue> *p_end) :
+				E(p_E), end(p_end) {}
+		_FORCE_INLINE_ Iterator() {}
+
+	private:
+		KeyValue<TKey, TValue> *E = nullptr;
+		KeyValue<TKey, TValue> *end = nullptr;
+	};
+
+	struct ConstIterator {
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> &operator*() const { return *E; }
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> *operator->() const { return E; }
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			if (E) {
+				E++;
+				if (E == end) {
+					E = nullptr;
+				}
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const ConstIterator &b) const { return E == b.E; }
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &b) const { return E != b.E; }
+
+		_FORCE_INLINE_ explicit operator bool() const { return E != nullptr; }
+
+		_FORCE_INLINE_ ConstIterator(const KeyValue<TKey, TValue> *p_E, const KeyValue<TKey, TValue> *p_end) :
+				E(p_E), end(p_end) {}
+		_FORCE_INLINE_ ConstIterator() {}
+
+	private:
+		const KeyValue<TKey, TValue> *E = nullptr;
+		const KeyValue<TKey, TValue> *end = nullptr;
+	};
+
+	_FORCE_INLINE_ uint32_t get_capacity() const { return capacity; }
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+	_FORCE_INLINE_ bool is_empty() const { return num_elements == 0; }
+
+	void clear() {
+		if (num_elements == 0 && num_deleted == 0) {
+			return;
+		}
+		if constexpr (!std::is_trivially_destructible<KeyValue<TKey, TValue>>::value) {
+			for (uint32_t i = 0; i < num_elements; i++) {
+				pairs[i].~KeyValue<TKey, TValue>();
+			}
+		}
+		memset(ctrl, CTRL_EMPTY, capacity + FlatHashMapGroup::WIDTH);
+		num_elements = 0;
+		num_deleted = 0;
+	}
+
+	TValue &get(const TKey &p_key) {
+		uint32_t slot = 0;
+		bool exists = _lookup_slot(p_key, slot);
+		CRASH_COND_MSG(!exists, "FlatHashMap key not found.");
+		return pairs[slot_pairs[slot]].value;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		uint32_t slot = 0;
+		bool exists = _lookup_slot(p_key, slot);
+		CRASH_COND_MSG(!exists, "FlatHashMap key not found.");
+		return pairs[slot_pairs[slot]].value;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		uint32_t slot = 0;
+		if (_lookup_slot(p_key, slot)) {
+			return &pairs[slot_pairs[slot]].value;
+		}
+		return nullptr;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		uint32_t slot = 0;
+		if (_lookup_slot(p_key, slot)) {
+			return &pairs[slot_pairs[slot]].value;
+		}
+		return nullptr;
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key) const {
+		uint32_t _slot = 0;
+		return _lookup_slot(p_key, _slot);
+	}
+
+	bool erase(const TKey &p_key) {
+		uint32_t slot = 0;
+		if (!_lookup_slot(p_key, slot)) {
+			return false;
+		}
+
+		// If the slot was never inside a full group, no probe continued past it and it can be made empty again.
+		const uint32_t before = (slot - FlatHashMapGroup::WIDTH) & (capacity - 1);
+		auto empty_before = FlatHashMapGroup(ctrl + before).match_empty();
+		auto empty_after = FlatHashMapGroup(ctrl + slot).match_empty();
+		if (empty_before && empty_after && FlatHashMapGroup::trailing_unmatched(empty_before) + FlatHashMapGroup::leading_unmatched(empty_after) < FlatHashMapGroup::WIDTH) {
+			_set_ctrl(slot, CTRL_EMPTY);
+		} else {
+			_set_ctrl(slot, CTRL_DELETED);
+			num_deleted++;
+		}
+
+		// Keep the pairs dense by moving the last one into the hole.
+		uint32_t index = slot_pairs[slot];
+		uint32_t last = num_elements - 1;
+		pairs[index].~KeyValue<TKey, TValue>();
+		if (index != last) {
+			memcpy((void *)&pairs[index], (const void *)&pairs[last], sizeof(KeyValue<TKey, TValue>));
+			pair_slots[index] = pair_slots[last];
+			slot_pairs[pair_slots[index]] = index;
+		}
+		num_elements--;
+		return true;
+	}
+
+	// Reserves space for a number of elements, useful to avoid many resizes and rehashes.
+	void reserve(uint32_t p_new_size) {
+		if (p_new_size <= _get_max_elements(capacity)) {
+			return;
+		}
+		uint32_t new_capacity = MAX(MIN_CAPACITY, capacity);
+		while (_get_max_elements(new_capacity) < p_new_size) {
+			ERR_FAIL_COND_MSG(new_capacity > (1u << 30), "Hash table maximum capacity reached.");
+			new_capacity *= 2;
+		}
+		if (new_capacity != capacity) {
+			_resize_and_rehash(new_capacity);
+		}
+	}
+
+	/** Iterator API **/
+
+	_FORCE_INLINE_ Iterator begin() {
+		return num_elements ? Iterator(pairs, pairs + num_elements) : end();
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator(nullptr, nullptr);
+	}
+	_FORCE_INLINE_ ConstIterator begin() const {
+		return num_elements ? ConstIterator(pairs, pairs + num_elements) : end();
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator(nullptr, nullptr);
+	}
+
+	Iterator find(const TKey &p_key) {
+		uint32_t slot = 0;
+		if (!_lookup_slot(p_key, slot)) {
+			return end();
+		}
+		return Iterator(&pairs[slot_pairs[slot]], pairs + num_elements);
+	}
+
+	ConstIterator find(const TKey &p_key) const {
+		uint32_t slot = 0;
+		if (!_lookup_slot(p_key, slot)) {
+			return end();
+		}
+		return ConstIterator(&pairs[slot_pairs[slot]], pairs + num_elements);
+	}
+
+	/* Indexing */
+
+	const TValue &operator[](const TKey &p_key) const {
+		uint32_t slot = 0;
+		bool exists = _lookup_slot(p_key, slot);
+		CRASH_COND(!exists);
+		return pairs[slot_pairs[slot]].value;
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		uint32_t slot = 0;
+		if (_lookup_slot(p_key, slot)) {
+			return pairs[slot_pairs[slot]].value;
+		}
+		return _insert(p_key, TValue())->value;
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value) {
+		KeyValue<TKey, TValue> *pair = _insert(p_key, p_value);
+		return pair ? Iterator(pair, pairs + num_elements) : end();
+	}
+
+	/* Constructors */
+
+	FlatHashMap(const FlatHashMap &p_other) {
+		reserve(p_other.num_elements);
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			insert(E.key, E.value);
+		}
+	}
+
+	void operator=(const FlatHashMap &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+		clear();
+		reserve(p_other.num_elements);
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			insert(E.key, E.value);
+		}
+	}
+
+	FlatHashMap(uint32_t p_initial_size) {
+		reserve(p_initial_size);
+	}
+	FlatHashMap() {}
+
+	~FlatHashMap() {
+		clear();
+		if (ctrl) {
+			Memory::free_static(ctrl);
+			Memory::free_static(slot_pairs);
+			Memory::free_static(pairs);
+			Memory::free_static(pair_slots);
+		}
+	}
+};
+
+#endif // FLAT_HASH_MAP_H
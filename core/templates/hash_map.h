@@ -49,6 +49,11 @@
  * using a paged allocator if required.
  *
  * The assignment operator copy the pairs from one map to the other.
+ *
+ * If INLINE_ELEMENTS is not zero, the hash table and the first elements are
+ * stored inside the map itself, so small maps don't need any heap allocation.
+ * Such maps point into themselves and must not be relocated bitwise, so don't
+ * store them in Vector or LocalVector.
  */
 
 template <class TKey, class TValue>
@@ -61,17 +66,56 @@ struct HashMapElement {
 			data(p_key, p_value) {}
 };
 
+template <class TElement, uint32_t INLINE_ELEMENTS>
+struct HashMapInlineStorage {
+	static_assert(INLINE_ELEMENTS <= 9, "Too many inline elements, they wouldn't fit in the inline table.");
+
+	// Smallest capacities in hash_table_size_primes holding the elements below the maximum occupancy.
+	static constexpr uint32_t TABLE_CAPACITY_INDEX = INLINE_ELEMENTS <= 3 ? 0 : 1;
+	static constexpr uint32_t TABLE_CAPACITY = INLINE_ELEMENTS <= 3 ? 5 : 13;
+
+	uint32_t inline_hashes[TABLE_CAPACITY];
+	TElement *inline_elements[TABLE_CAPACITY];
+	alignas(TElement) uint8_t inline_nodes[sizeof(TElement) * INLINE_ELEMENTS];
+	uint32_t inline_nodes_used = 0;
+
+	_FORCE_INLINE_ TElement *alloc_inline_node() {
+		for (uint32_t i = 0; i < INLINE_ELEMENTS; i++) {
+			if (!(inline_nodes_used & (1 << i))) {
+				inline_nodes_used |= 1 << i;
+				return reinterpret_cast<TElement *>(&inline_nodes[sizeof(TElement) * i]);
+			}
+		}
+		return nullptr;
+	}
+
+	_FORCE_INLINE_ bool free_inline_node(TElement *p_node) {
+		uint8_t *node = reinterpret_cast<uint8_t *>(p_node);
+		if (node < inline_nodes || node >= inline_nodes + sizeof(inline_nodes)) {
+			return false;
+		}
+		inline_nodes_used &= ~(1 << ((node - inline_nodes) / sizeof(TElement)));
+		return true;
+	}
+};
+
+template <class TElement>
+struct HashMapInlineStorage<TElement, 0> {};
+
 template <class TKey, class TValue,
 		class Hasher = HashMapHasherDefault,
 		class Comparator = HashMapComparatorDefault<TKey>,
-		class Allocator = DefaultTypedAllocator<HashMapElement<TKey, TValue>>>
-class HashMap {
+		class Allocator = DefaultTypedAllocator<HashMapElement<TKey, TValue>>,
+		uint32_t INLINE_ELEMENTS = 0>
+class HashMap : private HashMapInlineStorage<HashMapElement<TKey, TValue>, INLINE_ELEMENTS> {
 public:
 	static constexpr uint32_t MIN_CAPACITY_INDEX = 2; // Use a prime.
 	static constexpr float MAX_OCCUPANCY = 0.75;
 	static constexpr uint32_t EMPTY_HASH = 0;
 
 private:
+	typedef HashMapInlineStorage<HashMapElement<TKey, TValue>, INLINE_ELEMENTS> InlineStorage;
+
 	Allocator element_alloc;
 	HashMapElement<TKey, TValue> **elements = nullptr;
 	uint32_t *hashes = nullptr;
@@ -157,6 +201,48 @@ private:
 		}
 	}
 
+	_FORCE_INLINE_ void _allocate_table(uint32_t p_capacity) {
+		if constexpr (INLINE_ELEMENTS > 0) {
+			if (p_capacity <= InlineStorage::TABLE_CAPACITY) {
+				hashes = this->inline_hashes;
+				elements = this->inline_elements;
+				return;
+			}
+		}
+		hashes = reinterpret_cast<uint32_t *>(Memory::alloc_static(sizeof(uint32_t) * p_capacity));
+		elements = reinterpret_cast<HashMapElement<TKey, TValue> **>(Memory::alloc_static(sizeof(HashMapElement<TKey, TValue> *) * p_capacity));
+	}
+
+	_FORCE_INLINE_ void _free_table(uint32_t *p_hashes, HashMapElement<TKey, TValue> **p_elements) {
+		if constexpr (INLINE_ELEMENTS > 0) {
+			if (p_hashes == this->inline_hashes) {
+				return;
+			}
+		}
+		Memory::free_static(p_elements);
+		Memory::free_static(p_hashes);
+	}
+
+	_FORCE_INLINE_ HashMapElement<TKey, TValue> *_new_element(const TKey &p_key, const TValue &p_value) {
+		if constexpr (INLINE_ELEMENTS > 0) {
+			HashMapElement<TKey, TValue> *node = this->alloc_inline_node();
+			if (node) {
+				return new (node) HashMapElement<TKey, TValue>(p_key, p_value);
+			}
+		}
+		return element_alloc.new_allocation(HashMapElement<TKey, TValue>(p_key, p_value));
+	}
+
+	_FORCE_INLINE_ void _delete_element(HashMapElement<TKey, TValue> *p_element) {
+		if constexpr (INLINE_ELEMENTS > 0) {
+			if (this->free_inline_node(p_element)) {
+				p_element->~HashMapElement<TKey, TValue>();
+				return;
+			}
+		}
+		element_alloc.delete_allocation(p_element);
+	}
+
 	void _resize_and_rehash(uint32_t p_new_capacity_index) {
 		uint32_t old_capacity = hash_table_size_primes[capacity_index];
 
@@ -169,8 +255,7 @@ private:
 		uint32_t *old_hashes = hashes;
 
 		num_elements = 0;
-		hashes = reinterpret_cast<uint32_t *>(Memory::alloc_static(sizeof(uint32_t) * capacity));
-		elements = reinterpret_cast<HashMapElement<TKey, TValue> **>(Memory::alloc_static(sizeof(HashMapElement<TKey, TValue> *) * capacity));
+		_allocate_table(capacity);
 
 		for (uint32_t i = 0; i < capacity; i++) {
 			hashes[i] = 0;
@@ -190,17 +275,19 @@ private:
 			_insert_with_hash(old_hashes[i], old_elements[i]);
 		}
 
-		Memory::free_static(old_elements);
-		Memory::free_static(old_hashes);
+		_free_table(old_hashes, old_elements);
 	}
 
 	_FORCE_INLINE_ HashMapElement<TKey, TValue> *_insert(const TKey &p_key, const TValue &p_value, bool p_front_insert = false) {
+		if constexpr (INLINE_ELEMENTS > 0) {
+			if (elements == nullptr && capacity_index < InlineStorage::TABLE_CAPACITY_INDEX) {
+				capacity_index = InlineStorage::TABLE_CAPACITY_INDEX; // Use the whole inline table.
+			}
+		}
 		uint32_t capacity = hash_table_size_primes[capacity_index];
 		if (unlikely(elements == nullptr)) {
 			// Allocate on demand to save memory.
-
-			hashes = reinterpret_cast<uint32_t *>(Memory::alloc_static(sizeof(uint32_t) * capacity));
-			elements = reinterpret_cast<HashMapElement<TKey, TValue> **>(Memory::alloc_static(sizeof(HashMapElement<TKey, TValue> *) * capacity));
+			_allocate_table(capacity);
 
 			for (uint32_t i = 0; i < capacity; i++) {
 				hashes[i] = EMPTY_HASH;
@@ -220,7 +307,7 @@ private:
 				_resize_and_rehash(capacity_index + 1);
 			}
 
-			HashMapElement<TKey, TValue> *elem = element_alloc.new_allocation(HashMapElement<TKey, TValue>(p_key, p_value));
+			HashMapElement<TKey, TValue> *elem = _new_element(p_key, p_value);
 
 			if (tail_element == nullptr) {
 				head_element = elem;
@@ -262,7 +349,7 @@ public:
 			}
 
 			hashes[i] = EMPTY_HASH;
-			element_alloc.delete_allocation(elements[i]);
+			_delete_element(elements[i]);
 			elements[i] = nullptr;
 		}
 
@@ -346,7 +433,7 @@ public:
 			elements[pos]->next->prev = elements[pos]->prev;
 		}
 
-		element_alloc.delete_allocation(elements[pos]);
+		_delete_element(elements[pos]);
 		elements[pos] = nullptr;
 
 		num_elements--;
@@ -594,7 +681,11 @@ public:
 		reserve(p_initial_capacity);
 	}
 	HashMap() {
-		capacity_index = MIN_CAPACITY_INDEX;
+		if constexpr (INLINE_ELEMENTS > 0) {
+			capacity_index = InlineStorage::TABLE_CAPACITY_INDEX;
+		} else {
+			capacity_index = MIN_CAPACITY_INDEX;
+		}
 	}
 
 	uint32_t debug_get_hash(uint32_t p_index) {
@@ -616,8 +707,7 @@ public:
 		clear();
 
 		if (elements != nullptr) {
-			Memory::free_static(elements);
-			Memory::free_static(hashes);
+			_free_table(hashes, elements);
 		}
 	}
 };
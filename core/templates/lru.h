@@ -80,6 +80,27 @@ public:
 		_list.clear();
 	}
 
+	bool erase(const TKey &p_key) {
+		Element *e = _map.getptr(p_key);
+		if (!e) {
+			return false;
+		}
+		_list.erase(*e);
+		_map.erase(p_key);
+		return true;
+	}
+
+	const TData &get_least_recent() const {
+		CRASH_COND(_list.is_empty());
+		return _list.back()->get().data;
+	}
+
+	void erase_least_recent() {
+		CRASH_COND(_list.is_empty());
+		_map.erase(_list.back()->get().key);
+		_list.pop_back();
+	}
+
 	bool has(const TKey &p_key) const {
 		return _map.getptr(p_key);
 	}
@@ -99,6 +99,11 @@ public:
 		}
 	}
 
+	// Same interface as DefaultTypedAllocator, so it can be used as a HashMap element allocator.
+	template <class... Args>
+	_FORCE_INLINE_ T *new_allocation(const Args &&...p_args) { return alloc(static_cast<const Args &&>(p_args)...); }
+	_FORCE_INLINE_ void delete_allocation(T *p_mem) { free(p_mem); }
+
 private:
 	void _reset(bool p_allow_unfreed) {
 		if (!p_allow_unfreed || !std::is_trivially_destructible<T>::value) {
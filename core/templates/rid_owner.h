@@ -36,6 +36,7 @@
 #include "core/string/print_string.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/oa_hash_map.h"
 #include "core/templates/rid.h"
 #include "core/templates/safe_refcount.h"
@@ -71,17 +72,43 @@ template <class T, bool THREAD_SAFE = false>
 class RID_Alloc : public RID_AllocBase {
 	T **chunks = nullptr;
 	uint32_t **free_list_chunks = nullptr;
-	uint32_t **validator_chunks = nullptr;
+	std::atomic<uint32_t> **validator_chunks = nullptr; // Atomic, as thread safe allocators read them without the lock.
 
 	uint32_t elements_in_chunk;
 	uint32_t max_alloc = 0;
 	uint32_t alloc_count = 0;
+	uint32_t chunk_capacity = 0;
 
 	const char *description = nullptr;
 
 	mutable SpinLock spin_lock;
 
-	_FORCE_INLINE_ RID _allocate_rid() {
+	// Thread safe allocators publish their chunk tables here, so lookups can validate RIDs without taking the lock.
+	// Outgrown tables are kept alive until destruction, as a concurrent lookup may still be reading from them.
+	std::atomic<T **> shared_chunks = { nullptr };
+	std::atomic<std::atomic<uint32_t> **> shared_validator_chunks = { nullptr };
+	std::atomic<uint32_t> shared_max_alloc = { 0 };
+	LocalVector<void *> retired_tables;
+
+	template <class P>
+	_FORCE_INLINE_ P *_grow_table(P *p_table, uint32_t p_count, uint32_t p_capacity) {
+		if (!THREAD_SAFE) {
+			return (P *)memrealloc(p_table, sizeof(P) * p_capacity);
+		}
+		P *table = (P *)memalloc(sizeof(P) * p_capacity);
+		if (p_table) {
+			memcpy(table, p_table, sizeof(P) * p_count);
+			retired_tables.push_back(p_table);
+		}
+		return table;
+	}
+
+	_FORCE_INLINE_ std::atomic<uint32_t> *_get_validator(uint32_t p_index) const {
+		std::atomic<uint32_t> **table = THREAD_SAFE ? shared_validator_chunks.load(std::memory_order_acquire) : validator_chunks;
+		return &table[p_index / elements_in_chunk][p_index % elements_in_chunk];
+	}
+
+	_FORCE_INLINE_ T *_allocate(RID &r_rid, std::atomic<uint32_t> **r_validator) {
 		if (THREAD_SAFE) {
 			spin_lock.lock();
 		}
@@ -90,25 +117,36 @@ class RID_Alloc : public RID_AllocBase {
 			//allocate a new chunk
 			uint32_t chunk_count = alloc_count == 0 ? 0 : (max_alloc / elements_in_chunk);
 
+			if (chunk_count == chunk_capacity) {
+				// Grow the tables geometrically, so few of them have to be retired by thread safe allocators.
+				chunk_capacity = MAX(4u, chunk_capacity * 2);
+				chunks = _grow_table(chunks, chunk_count, chunk_capacity);
+				validator_chunks = _grow_table(validator_chunks, chunk_count, chunk_capacity);
+				free_list_chunks = (uint32_t **)memrealloc(free_list_chunks, sizeof(uint32_t *) * chunk_capacity); // Only accessed with the lock held.
+			}
+
 			//grow chunks
-			chunks = (T **)memrealloc(chunks, sizeof(T *) * (chunk_count + 1));
 			chunks[chunk_count] = (T *)memalloc(sizeof(T) * elements_in_chunk); //but don't initialize
 
 			//grow validators
-			validator_chunks = (uint32_t **)memrealloc(validator_chunks, sizeof(uint32_t *) * (chunk_count + 1));
-			validator_chunks[chunk_count] = (uint32_t *)memalloc(sizeof(uint32_t) * elements_in_chunk);
+			validator_chunks[chunk_count] = (std::atomic<uint32_t> *)memalloc(sizeof(std::atomic<uint32_t>) * elements_in_chunk);
 			//grow free lists
-			free_list_chunks = (uint32_t **)memrealloc(free_list_chunks, sizeof(uint32_t *) * (chunk_count + 1));
 			free_list_chunks[chunk_count] = (uint32_t *)memalloc(sizeof(uint32_t) * elements_in_chunk);
 
 			//initialize
 			for (uint32_t i = 0; i < elements_in_chunk; i++) {
 				// Don't initialize chunk.
-				validator_chunks[chunk_count][i] = 0xFFFFFFFF;
+				memnew_placement(&validator_chunks[chunk_count][i], std::atomic<uint32_t>(0xFFFFFFFF));
 				free_list_chunks[chunk_count][i] = alloc_count + i;
 			}
 
 			max_alloc += elements_in_chunk;
+
+			if (THREAD_SAFE) {
+				shared_chunks.store(chunks, std::memory_order_release);
+				shared_validator_chunks.store(validator_chunks, std::memory_order_release);
+				shared_max_alloc.store(max_alloc, std::memory_order_release); // Last, so the tables are visible to whoever sees the new size.
+			}
 		}
 
 		uint32_t free_index = free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk];
@@ -122,28 +160,50 @@ class RID_Alloc : public RID_AllocBase {
 		id <<= 32;
 		id |= free_index;
 
-		validator_chunks[free_chunk][free_element] = validator;
-
-		validator_chunks[free_chunk][free_element] |= 0x80000000; //mark uninitialized bit
+		validator_chunks[free_chunk][free_element].store(validator | 0x80000000, std::memory_order_release); //mark uninitialized bit
 
 		alloc_count++;
 
+		// Validator chunks never move once allocated, so this can be written without the lock.
+		*r_validator = &validator_chunks[free_chunk][free_element];
+
 		if (THREAD_SAFE) {
 			spin_lock.unlock();
 		}
 
-		return _make_from_id(id);
+		r_rid = _make_from_id(id);
+		return &chunks[free_chunk][free_element];
+	}
+
+	_FORCE_INLINE_ RID _allocate_rid() {
+		RID rid;
+		std::atomic<uint32_t> *validator;
+		_allocate(rid, &validator);
+		return rid;
+	}
+
+	_FORCE_INLINE_ void _mark_initialized(std::atomic<uint32_t> *p_validator) {
+		// Release, so lock-free lookups only see the RID as valid once the element is constructed.
+		// Nothing else writes the validator until the RID is initialized, so this needs no lock.
+		p_validator->store(p_validator->load(std::memory_order_relaxed) & 0x7FFFFFFF, std::memory_order_release); //initialized
 	}
 
 public:
 	RID make_rid() {
-		RID rid = _allocate_rid();
-		initialize_rid(rid);
+		// Allocate and initialize in one go, instead of taking the lock again in initialize_rid().
+		RID rid;
+		std::atomic<uint32_t> *validator;
+		T *mem = _allocate(rid, &validator);
+		memnew_placement(mem, T);
+		_mark_initialized(validator);
 		return rid;
 	}
 	RID make_rid(const T &p_value) {
-		RID rid = _allocate_rid();
-		initialize_rid(rid, p_value);
+		RID rid;
+		std::atomic<uint32_t> *validator;
+		T *mem = _allocate(rid, &validator);
+		memnew_placement(mem, T(p_value));
+		_mark_initialized(validator);
 		return rid;
 	}
 
@@ -156,6 +216,30 @@ public:
 		if (p_rid == RID()) {
 			return nullptr;
 		}
+
+		if (THREAD_SAFE && !p_initialize) {
+			// Lock-free path for lookups, which vastly outnumber allocations.
+			uint64_t id = p_rid.get_id();
+			uint32_t idx = uint32_t(id & 0xFFFFFFFF);
+			if (unlikely(idx >= shared_max_alloc.load(std::memory_order_acquire))) {
+				return nullptr;
+			}
+
+			uint32_t idx_chunk = idx / elements_in_chunk;
+			uint32_t idx_element = idx % elements_in_chunk;
+
+			uint32_t validator = uint32_t(id >> 32);
+			uint32_t current_validator = shared_validator_chunks.load(std::memory_order_acquire)[idx_chunk][idx_element].load(std::memory_order_acquire);
+			if (unlikely(current_validator != validator)) {
+				if ((current_validator & 0x80000000) && current_validator != 0xFFFFFFFF) {
+					ERR_FAIL_V_MSG(nullptr, "Attempting to use an uninitialized RID");
+				}
+				return nullptr;
+			}
+
+			return &shared_chunks.load(std::memory_order_acquire)[idx_chunk][idx_element];
+		}
+
 		if (THREAD_SAFE) {
 			spin_lock.lock();
 		}
@@ -173,29 +257,29 @@ public:
 		uint32_t idx_element = idx % elements_in_chunk;
 
 		uint32_t validator = uint32_t(id >> 32);
+		uint32_t current_validator = validator_chunks[idx_chunk][idx_element].load(std::memory_order_relaxed);
 
 		if (unlikely(p_initialize)) {
-			if (unlikely(!(validator_chunks[idx_chunk][idx_element] & 0x80000000))) {
+			// Only validated here, initialize_rid() marks it initialized once the element is constructed.
+			if (unlikely(!(current_validator & 0x80000000))) {
 				if (THREAD_SAFE) {
 					spin_lock.unlock();
 				}
 				ERR_FAIL_V_MSG(nullptr, "Initializing already initialized RID");
 			}
 
-			if (unlikely((validator_chunks[idx_chunk][idx_element] & 0x7FFFFFFF) != validator)) {
+			if (unlikely((current_validator & 0x7FFFFFFF) != validator)) {
 				if (THREAD_SAFE) {
 					spin_lock.unlock();
 				}
 				ERR_FAIL_V_MSG(nullptr, "Attempting to initialize the wrong RID");
 			}
 
-			validator_chunks[idx_chunk][idx_element] &= 0x7FFFFFFF; //initialized
-
-		} else if (unlikely(validator_chunks[idx_chunk][idx_element] != validator)) {
+		} else if (unlikely(current_validator != validator)) {
 			if (THREAD_SAFE) {
 				spin_lock.unlock();
 			}
-			if ((validator_chunks[idx_chunk][idx_element] & 0x80000000) && validator_chunks[idx_chunk][idx_element] != 0xFFFFFFFF) {
+			if ((current_validator & 0x80000000) && current_validator != 0xFFFFFFFF) {
 				ERR_FAIL_V_MSG(nullptr, "Attempting to use an uninitialized RID");
 			}
 			return nullptr;
@@ -213,39 +297,36 @@ public:
 		T *mem = get_or_null(p_rid, true);
 		ERR_FAIL_NULL(mem);
 		memnew_placement(mem, T);
+		_mark_initialized(_get_validator(uint32_t(p_rid.get_id() & 0xFFFFFFFF)));
 	}
 	void initialize_rid(RID p_rid, const T &p_value) {
 		T *mem = get_or_null(p_rid, true);
 		ERR_FAIL_NULL(mem);
 		memnew_placement(mem, T(p_value));
+		_mark_initialized(_get_validator(uint32_t(p_rid.get_id() & 0xFFFFFFFF)));
 	}
 
 	_FORCE_INLINE_ bool owns(const RID &p_rid) const {
-		if (THREAD_SAFE) {
-			spin_lock.lock();
-		}
-
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
-			if (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
-			return false;
-		}
+		uint32_t validator = uint32_t(id >> 32);
 
 		uint32_t idx_chunk = idx / elements_in_chunk;
 		uint32_t idx_element = idx % elements_in_chunk;
 
-		uint32_t validator = uint32_t(id >> 32);
-
-		bool owned = (validator != 0x7FFFFFFF) && (validator_chunks[idx_chunk][idx_element] & 0x7FFFFFFF) == validator;
-
 		if (THREAD_SAFE) {
-			spin_lock.unlock();
+			// Lock-free, see get_or_null().
+			if (unlikely(idx >= shared_max_alloc.load(std::memory_order_acquire))) {
+				return false;
+			}
+			return (validator != 0x7FFFFFFF) && (shared_validator_chunks.load(std::memory_order_acquire)[idx_chunk][idx_element].load(std::memory_order_acquire) & 0x7FFFFFFF) == validator;
 		}
 
-		return owned;
+		if (unlikely(idx >= max_alloc)) {
+			return false;
+		}
+
+		return (validator != 0x7FFFFFFF) && (validator_chunks[idx_chunk][idx_element].load(std::memory_order_relaxed) & 0x7FFFFFFF) == validator;
 	}
 
 	_FORCE_INLINE_ void free(const RID &p_rid) {
@@ -266,20 +347,22 @@ public:
 		uint32_t idx_element = idx % elements_in_chunk;
 
 		uint32_t validator = uint32_t(id >> 32);
-		if (unlikely(validator_chunks[idx_chunk][idx_element] & 0x80000000)) {
+		uint32_t current_validator = validator_chunks[idx_chunk][idx_element].load(std::memory_order_relaxed);
+		if (unlikely(current_validator & 0x80000000)) {
 			if (THREAD_SAFE) {
 				spin_lock.unlock();
 			}
 			ERR_FAIL_MSG("Attempted to free an uninitialized or invalid RID");
-		} else if (unlikely(validator_chunks[idx_chunk][idx_element] != validator)) {
+		} else if (unlikely(current_validator != validator)) {
 			if (THREAD_SAFE) {
 				spin_lock.unlock();
 			}
 			ERR_FAIL();
 		}
 
+		// Invalidate before destroying, so lock-free lookups starting from now reject the RID.
+		validator_chunks[idx_chunk][idx_element].store(0xFFFFFFFF, std::memory_order_release); // go invalid
 		chunks[idx_chunk][idx_element].~T();
-		validator_chunks[idx_chunk][idx_element] = 0xFFFFFFFF; // go invalid
 
 		alloc_count--;
 		free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk] = idx;
@@ -297,7 +380,7 @@ public:
 			spin_lock.lock();
 		}
 		for (size_t i = 0; i < max_alloc; i++) {
-			uint64_t validator = validator_chunks[i / elements_in_chunk][i % elements_in_chunk];
+			uint64_t validator = validator_chunks[i / elements_in_chunk][i % elements_in_chunk].load(std::memory_order_relaxed);
 			if (validator != 0xFFFFFFFF) {
 				p_owned->push_back(_make_from_id((validator << 32) | i));
 			}
@@ -314,7 +397,7 @@ public:
 		}
 		uint32_t idx = 0;
 		for (size_t i = 0; i < max_alloc; i++) {
-			uint64_t validator = validator_chunks[i / elements_in_chunk][i % elements_in_chunk];
+			uint64_t validator = validator_chunks[i / elements_in_chunk][i % elements_in_chunk].load(std::memory_order_relaxed);
 			if (validator != 0xFFFFFFFF) {
 				p_rid_buffer[idx] = _make_from_id((validator << 32) | i);
 				idx++;
@@ -339,7 +422,7 @@ public:
 					alloc_count, description ? description : typeid(T).name()));
 
 			for (size_t i = 0; i < max_alloc; i++) {
-				uint64_t validator = validator_chunks[i / elements_in_chunk][i % elements_in_chunk];
+				uint64_t validator = validator_chunks[i / elements_in_chunk][i % elements_in_chunk].load(std::memory_order_relaxed);
 				if (validator & 0x80000000) {
 					continue; //uninitialized
 				}
@@ -361,6 +444,10 @@ public:
 			memfree(free_list_chunks);
 			memfree(validator_chunks);
 		}
+
+		for (void *table : retired_tables) {
+			memfree(table);
+		}
 	}
 };
 
@@ -658,6 +658,25 @@ static _FORCE_INLINE_ void vc_ptrcall(void (*method)(T *, P...), void *p_base, c
 		}                                                                                                                                                         \
 	};
 
+// Component and accumulator types for the bulk math methods of packed arrays.
+template <class T>
+struct PackedMath {
+	typedef T Scalar;
+	typedef double Sum;
+};
+
+template <>
+struct PackedMath<Vector2> {
+	typedef real_t Scalar;
+	typedef Vector2 Sum;
+};
+
+template <>
+struct PackedMath<Vector3> {
+	typedef real_t Scalar;
+	typedef Vector3 Sum;
+};
+
 struct _VariantCall {
 	static String func_PackedByteArray_get_string_from_ascii(PackedByteArray *p_instance) {
 		String s;
@@ -1019,6 +1038,164 @@ struct _VariantCall {
 		return len;
 	}
 
+	// Bulk math on packed arrays, written as plain loops over the raw data so the compiler can vectorize them.
+	template <class T>
+	static Vector<T> func_Packed_add(Vector<T> *p_instance, const Vector<T> &p_other) {
+		int64_t size = p_instance->size();
+		ERR_FAIL_COND_V_MSG(p_other.size() != size, Vector<T>(), "Both arrays must have the same size.");
+		Vector<T> dest;
+		dest.resize(size);
+		const T *a = p_instance->ptr();
+		const T *b = p_other.ptr();
+		T *w = dest.ptrw();
+		for (int64_t i = 0; i < size; i++) {
+			w[i] = a[i] + b[i];
+		}
+		return dest;
+	}
+
+	template <class T>
+	static Vector<T> func_Packed_multiply(Vector<T> *p_instance, const Vector<T> &p_other) {
+		int64_t size = p_instance->size();
+		ERR_FAIL_COND_V_MSG(p_other.size() != size, Vector<T>(), "Both arrays must have the same size.");
+		Vector<T> dest;
+		dest.resize(size);
+		const T *a = p_instance->ptr();
+		const T *b = p_other.ptr();
+		T *w = dest.ptrw();
+		for (int64_t i = 0; i < size; i++) {
+			w[i] = a[i] * b[i];
+		}
+		return dest;
+	}
+
+	template <class T>
+	static Vector<T> func_Packed_scale(Vector<T> *p_instance, double p_factor) {
+		int64_t size = p_instance->size();
+		const typename PackedMath<T>::Scalar factor = p_factor;
+		Vector<T> dest;
+		dest.resize(size);
+		const T *a = p_instance->ptr();
+		T *w = dest.ptrw();
+		for (int64_t i = 0; i < size; i++) {
+			w[i] = a[i] * factor;
+		}
+		return dest;
+	}
+
+	template <class T>
+	static Vector<T> func_Packed_lerp(Vector<T> *p_instance, const Vector<T> &p_to, double p_weight) {
+		int64_t size = p_instance->size();
+		ERR_FAIL_COND_V_MSG(p_to.size() != size, Vector<T>(), "Both arrays must have the same size.");
+		const typename PackedMath<T>::Scalar weight = p_weight;
+		Vector<T> dest;
+		dest.resize(size);
+		const T *a = p_instance->ptr();
+		const T *b = p_to.ptr();
+		T *w = dest.ptrw();
+		for (int64_t i = 0; i < size; i++) {
+			w[i] = a[i] + (b[i] - a[i]) * weight;
+		}
+		return dest;
+	}
+
+	template <class T>
+	static typename PackedMath<T>::Sum func_Packed_sum(Vector<T> *p_instance) {
+		int64_t size = p_instance->size();
+		const T *a = p_instance->ptr();
+		typename PackedMath<T>::Sum sum = typename PackedMath<T>::Sum();
+		for (int64_t i = 0; i < size; i++) {
+			sum += a[i];
+		}
+		return sum;
+	}
+
+	template <class T>
+	static T func_Packed_min(Vector<T> *p_instance) {
+		int64_t size = p_instance->size();
+		if (size == 0) {
+			return T();
+		}
+		const T *a = p_instance->ptr();
+		T result = a[0];
+		for (int64_t i = 1; i < size; i++) {
+			result = MIN(result, a[i]);
+		}
+		return result;
+	}
+
+	template <class T>
+	static T func_Packed_max(Vector<T> *p_instance) {
+		int64_t size = p_instance->size();
+		if (size == 0) {
+			return T();
+		}
+		const T *a = p_instance->ptr();
+		T result = a[0];
+		for (int64_t i = 1; i < size; i++) {
+			result = MAX(result, a[i]);
+		}
+		return result;
+	}
+
+	template <class T>
+	static PackedFloat32Array func_Packed_dot(Vector<T> *p_instance, const Vector<T> &p_other) {
+		int64_t size = p_instance->size();
+		ERR_FAIL_COND_V_MSG(p_other.size() != size, PackedFloat32Array(), "Both arrays must have the same size.");
+		PackedFloat32Array dest;
+		dest.resize(size);
+		const T *a = p_instance->ptr();
+		const T *b = p_other.ptr();
+		float *w = dest.ptrw();
+		for (int64_t i = 0; i < size; i++) {
+			w[i] = a[i].dot(b[i]);
+		}
+		return dest;
+	}
+
+	template <class T>
+	static PackedFloat32Array func_Packed_lengths(Vector<T> *p_instance) {
+		int64_t size = p_instance->size();
+		PackedFloat32Array dest;
+		dest.resize(size);
+		const T *a = p_instance->ptr();
+		float *w = dest.ptrw();
+		for (int64_t i = 0; i < size; i++) {
+			w[i] = a[i].length();
+		}
+		return dest;
+	}
+
+	template <class T>
+	static Vector<T> func_Packed_gather(Vector<T> *p_instance, const PackedInt32Array &p_indices) {
+		int64_t size = p_instance->size();
+		int64_t count = p_indices.size();
+		Vector<T> dest;
+		dest.resize(count);
+		const T *a = p_instance->ptr();
+		const int32_t *indices = p_indices.ptr();
+		T *w = dest.ptrw();
+		for (int64_t i = 0; i < count; i++) {
+			ERR_FAIL_INDEX_V(indices[i], size, Vector<T>());
+			w[i] = a[indices[i]];
+		}
+		return dest;
+	}
+
+	template <class T>
+	static void func_Packed_scatter(Vector<T> *p_instance, const PackedInt32Array &p_indices, const Vector<T> &p_values) {
+		int64_t count = p_indices.size();
+		ERR_FAIL_COND_MSG(p_values.size() != count, "There must be as many values as indices.");
+		int64_t size = p_instance->size();
+		const int32_t *indices = p_indices.ptr();
+		const T *values = p_values.ptr();
+		T *w = p_instance->ptrw();
+		for (int64_t i = 0; i < count; i++) {
+			ERR_FAIL_INDEX(indices[i], size);
+			w[indices[i]] = values[i];
+		}
+	}
+
 	static void func_Callable_call(Variant *v, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error) {
 		Callable *callable = VariantGetInternalPtr<Callable>::get_ptr(v);
 		callable->callp(p_args, p_argcount, r_ret, r_error);
@@ -2383,6 +2560,15 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedFloat32Array, find, sarray("value", "from"), varray(0));
 	bind_method(PackedFloat32Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedFloat32Array, count, sarray("value"), varray());
+	bind_function(PackedFloat32Array, add, _VariantCall::func_Packed_add<float>, sarray("array"), varray());
+	bind_function(PackedFloat32Array, gather, _VariantCall::func_Packed_gather<float>, sarray("indices"), varray());
+	bind_function(PackedFloat32Array, lerp, _VariantCall::func_Packed_lerp<float>, sarray("to", "weight"), varray());
+	bind_function(PackedFloat32Array, max, _VariantCall::func_Packed_max<float>, sarray(), varray());
+	bind_function(PackedFloat32Array, min, _VariantCall::func_Packed_min<float>, sarray(), varray());
+	bind_function(PackedFloat32Array, multiply, _VariantCall::func_Packed_multiply<float>, sarray("array"), varray());
+	bind_function(PackedFloat32Array, scale, _VariantCall::func_Packed_scale<float>, sarray("factor"), varray());
+	bind_functionnc(PackedFloat32Array, scatter, _VariantCall::func_Packed_scatter<float>, sarray("indices", "values"), varray());
+	bind_function(PackedFloat32Array, sum, _VariantCall::func_Packed_sum<float>, sarray(), varray());
 
 	/* Float64 Array */
 
@@ -2407,6 +2593,15 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedFloat64Array, find, sarray("value", "from"), varray(0));
 	bind_method(PackedFloat64Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedFloat64Array, count, sarray("value"), varray());
+	bind_function(PackedFloat64Array, add, _VariantCall::func_Packed_add<double>, sarray("array"), varray());
+	bind_function(PackedFloat64Array, gather, _VariantCall::func_Packed_gather<double>, sarray("indices"), varray());
+	bind_function(PackedFloat64Array, lerp, _VariantCall::func_Packed_lerp<double>, sarray("to", "weight"), varray());
+	bind_function(PackedFloat64Array, max, _VariantCall::func_Packed_max<double>, sarray(), varray());
+	bind_function(PackedFloat64Array, min, _VariantCall::func_Packed_min<double>, sarray(), varray());
+	bind_function(PackedFloat64Array, multiply, _VariantCall::func_Packed_multiply<double>, sarray("array"), varray());
+	bind_function(PackedFloat64Array, scale, _VariantCall::func_Packed_scale<double>, sarray("factor"), varray());
+	bind_functionnc(PackedFloat64Array, scatter, _VariantCall::func_Packed_scatter<double>, sarray("indices", "values"), varray());
+	bind_function(PackedFloat64Array, sum, _VariantCall::func_Packed_sum<double>, sarray(), varray());
 
 	/* String Array */
 
@@ -2455,6 +2650,15 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedVector2Array, find, sarray("value", "from"), varray(0));
 	bind_method(PackedVector2Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedVector2Array, count, sarray("value"), varray());
+	bind_function(PackedVector2Array, add, _VariantCall::func_Packed_add<Vector2>, sarray("array"), varray());
+	bind_function(PackedVector2Array, dot, _VariantCall::func_Packed_dot<Vector2>, sarray("array"), varray());
+	bind_function(PackedVector2Array, gather, _VariantCall::func_Packed_gather<Vector2>, sarray("indices"), varray());
+	bind_function(PackedVector2Array, lengths, _VariantCall::func_Packed_lengths<Vector2>, sarray(), varray());
+	bind_function(PackedVector2Array, lerp, _VariantCall::func_Packed_lerp<Vector2>, sarray("to", "weight"), varray());
+	bind_function(PackedVector2Array, multiply, _VariantCall::func_Packed_multiply<Vector2>, sarray("array"), varray());
+	bind_function(PackedVector2Array, scale, _VariantCall::func_Packed_scale<Vector2>, sarray("factor"), varray());
+	bind_functionnc(PackedVector2Array, scatter, _VariantCall::func_Packed_scatter<Vector2>, sarray("indices", "values"), varray());
+	bind_function(PackedVector2Array, sum, _VariantCall::func_Packed_sum<Vector2>, sarray(), varray());
 
 	/* Vector3 Array */
 
@@ -2479,6 +2683,15 @@ static void _register_variant_builtin_methods() {
 	bind_method(PackedVector3Array, find, sarray("value", "from"), varray(0));
 	bind_method(PackedVector3Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedVector3Array, count, sarray("value"), varray());
+	bind_function(PackedVector3Array, add, _VariantCall::func_Packed_add<Vector3>, sarray("array"), varray());
+	bind_function(PackedVector3Array, dot, _VariantCall::func_Packed_dot<Vector3>, sarray("array"), varray());
+	bind_function(PackedVector3Array, gather, _VariantCall::func_Packed_gather<Vector3>, sarray("indices"), varray());
+	bind_function(PackedVector3Array, lengths, _VariantCall::func_Packed_lengths<Vector3>, sarray(), varray());
+	bind_function(PackedVector3Array, lerp, _VariantCall::func_Packed_lerp<Vector3>, sarray("to", "weight"), varray());
+	bind_function(PackedVector3Array, multiply, _VariantCall::func_Packed_multiply<Vector3>, sarray("array"), varray());
+	bind_function(PackedVector3Array, scale, _VariantCall::func_Packed_scale<Vector3>, sarray("factor"), varray());
+	bind_functionnc(PackedVector3Array, scatter, _VariantCall::func_Packed_scatter<Vector3>, sarray("indices", "values"), varray());
+	bind_function(PackedVector3Array, sum, _VariantCall::func_Packed_sum<Vector3>, sarray(), varray());
 
 	/* Color Array */
 
@@ -334,6 +334,11 @@ public:
 		v->_get_obj().id = ObjectID();
 	}
 
+	// Only valid when both hold the same type, and it's one stored inline that doesn't need deinit.
+	_FORCE_INLINE_ static void copy_inline_value(Variant *v, const Variant *p_from) {
+		memcpy(v->_data._mem, p_from->_data._mem, sizeof(v->_data._mem));
+	}
+
 	static void update_object_id(Variant *v) {
 		const Object *o = v->_get_obj().obj;
 		if (o) {
@@ -50,10 +50,21 @@ public:
 		virtual uint32_t _read_buffer(char32_t *p_buffer, uint32_t p_num_chars) = 0;
 		virtual bool _is_eof() const = 0;
 
+		char32_t _get_char_refill();
+
+		// Characters already read from the source, but not returned by get_char() yet.
+		_FORCE_INLINE_ uint32_t _get_readahead_pending() const { return readahead_pointer < readahead_filled ? readahead_filled - readahead_pointer : 0; }
+
 	public:
 		char32_t saved = 0;
 
-		char32_t get_char();
+		_FORCE_INLINE_ char32_t get_char() {
+			// Is within buffer? Kept inline, as the tokenizer calls this for every character.
+			if (readahead_pointer < readahead_filled) {
+				return readahead_buffer[readahead_pointer++];
+			}
+			return _get_char_refill();
+		}
 		virtual bool is_utf8() const = 0;
 		bool is_eof() const;
 
@@ -71,6 +82,9 @@ public:
 
 		virtual bool is_utf8() const override;
 
+		// Position in the file of the next character get_char() returns.
+		uint64_t get_position() const { return f->get_position() - _get_readahead_pending(); }
+
 		StreamFile(bool p_readahead_enabled = true) { readahead_enabled = p_readahead_enabled; }
 	};
 
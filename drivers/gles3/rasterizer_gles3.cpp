@@ -282,6 +282,7 @@ RasterizerGLES3::RasterizerGLES3() {
 
 				if (!shader_cache_dir.is_empty()) {
 					ShaderGLES3::set_shader_cache_dir(shader_cache_dir);
+					ShaderCompiler::set_cache_dir(shader_cache_dir.path_join("shader_compiler"));
 				}
 			}
 		}
@@ -303,6 +304,7 @@ RasterizerGLES3::RasterizerGLES3() {
 }
 
 RasterizerGLES3::~RasterizerGLES3() {
+	ShaderCompiler::set_cache_dir(String());
 }
 
 void RasterizerGLES3::prepare_for_blitting_render_targets() {
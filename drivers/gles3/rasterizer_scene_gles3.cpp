@@ -1128,6 +1128,10 @@ void RasterizerSceneGLES3::positional_soft_shadow_filter_set_quality(RS::ShadowQ
 void RasterizerSceneGLES3::directional_soft_shadow_filter_set_quality(RS::ShadowQuality p_quality) {
 }
 
+bool RasterizerSceneGLES3::is_static_shadow_cache_supported() const {
+	return false;
+}
+
 RID RasterizerSceneGLES3::fog_volume_instance_create(RID p_fog_volume) {
 	return RID();
 }
@@ -2063,6 +2067,54 @@ void RasterizerSceneGLES3::render_scene(const Ref<RenderSceneBuffers> &p_render_
 	texture_storage->render_target_disable_clear_request(rb->render_target);
 }
 
+uint32_t RasterizerSceneGLES3::_stream_instance_data(GeometryInstanceSurface **p_elements, uint32_t p_count) {
+	scene_state.instance_stream_data.resize(p_count);
+	for (uint32_t i = 0; i < p_count; i++) {
+		const GeometryInstanceGLES3 *inst = p_elements[i]->owner;
+		Transform3D transform;
+		if (inst->store_transform_cache) {
+			transform = inst->transform;
+		}
+
+		SceneState::InstanceStreamData &data = scene_state.instance_stream_data[i];
+		for (int j = 0; j < 3; j++) {
+			data.transform[j * 4 + 0] = transform.basis.rows[j][0];
+			data.transform[j * 4 + 1] = transform.basis.rows[j][1];
+			data.transform[j * 4 + 2] = transform.basis.rows[j][2];
+			data.transform[j * 4 + 3] = transform.origin[j];
+		}
+		// White color and zero custom data, as half floats.
+		data.color_custom[0] = 0x3C003C00;
+		data.color_custom[1] = 0x3C003C00;
+		data.color_custom[2] = 0;
+		data.color_custom[3] = 0;
+	}
+
+	if (p_count > scene_state.instance_stream_size) {
+		if (scene_state.instance_stream_buffer != 0) {
+			GLES3::Utilities::get_singleton()->buffer_free_data(scene_state.instance_stream_buffer);
+		}
+		scene_state.instance_stream_size = MAX(next_power_of_2(p_count), INSTANCE_STREAM_MIN_SIZE);
+		glGenBuffers(1, &scene_state.instance_stream_buffer);
+		glBindBuffer(GL_ARRAY_BUFFER, scene_state.instance_stream_buffer);
+		GLES3::Utilities::get_singleton()->buffer_allocate_data(GL_ARRAY_BUFFER, scene_state.instance_stream_buffer, scene_state.instance_stream_size * sizeof(SceneState::InstanceStreamData), nullptr, GL_STREAM_DRAW, "Scene instance stream buffer");
+		scene_state.instance_stream_offset = 0;
+	} else {
+		glBindBuffer(GL_ARRAY_BUFFER, scene_state.instance_stream_buffer);
+		if (scene_state.instance_stream_offset + p_count > scene_state.instance_stream_size) {
+			// Orphan the buffer instead of waiting for the draws still reading it.
+			glBufferData(GL_ARRAY_BUFFER, scene_state.instance_stream_size * sizeof(SceneState::InstanceStreamData), nullptr, GL_STREAM_DRAW);
+			scene_state.instance_stream_offset = 0;
+		}
+	}
+
+	uint32_t offset = scene_state.instance_stream_offset * sizeof(SceneState::InstanceStreamData);
+	glBufferSubData(GL_ARRAY_BUFFER, offset, p_count * sizeof(SceneState::InstanceStreamData), scene_state.instance_stream_data.ptr());
+	scene_state.instance_stream_offset += p_count;
+
+	return offset;
+}
+
 template <PassMode p_pass_mode>
 void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params, const RenderDataGLES3 *p_render_data, uint32_t p_from_element, uint32_t p_to_element, bool p_alpha_pass) {
 	GLES3::MeshStorage *mesh_storage = GLES3::MeshStorage::get_singleton();
@@ -2152,6 +2204,16 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 			continue;
 		}
 
+		// Following meshes that only differ by their transform are drawn as instances of this one.
+		uint32_t batch_from = i;
+		uint32_t batch_count = 1;
+		if (inst->instance_count < 0 && !inst->mesh_instance.is_valid() && !shader->uses_model_matrix && !shader->uses_instance_id) {
+			while (i + batch_count < p_to_element && _can_instance_surfaces(surf, p_params->elements[i + batch_count], p_pass_mode == PASS_MODE_SHADOW, p_pass_mode == PASS_MODE_COLOR)) {
+				batch_count++;
+			}
+			i += batch_count - 1;
+		}
+
 		//request a redraw if one of the shaders uses TIME
 		if (shader->uses_time) {
 			should_request_redraw = true;
@@ -2301,7 +2363,7 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 		}
 
 		Transform3D world_transform;
-		if (inst->store_transform_cache) {
+		if (inst->store_transform_cache && batch_count == 1) {
 			world_transform = inst->transform;
 		}
 
@@ -2311,8 +2373,8 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 		}
 
 		SceneShaderGLES3::ShaderVariant instance_variant = shader_variant;
-		if (inst->instance_count > 0) {
-			// Will need to use instancing to draw (either MultiMesh or Particles).
+		if (inst->instance_count > 0 || batch_count > 1) {
+			// Will need to use instancing to draw (either MultiMesh, Particles or batched meshes).
 			instance_variant = SceneShaderGLES3::ShaderVariant(1 + int(shader_variant));
 		}
 
@@ -2422,6 +2484,29 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 			} else {
 				glDrawArraysInstanced(primitive_gl, 0, count, inst->instance_count);
 			}
+		} else if (batch_count > 1) {
+			// Using regular Meshes drawn as instances.
+			uint32_t offset = _stream_instance_data(p_params->elements + batch_from, batch_count);
+			uint32_t stride = sizeof(SceneState::InstanceStreamData);
+
+			glEnableVertexAttribArray(12);
+			glVertexAttribPointer(12, 4, GL_FLOAT, GL_FALSE, stride, CAST_INT_TO_UCHAR_PTR(offset));
+			glVertexAttribDivisor(12, 1);
+			glEnableVertexAttribArray(13);
+			glVertexAttribPointer(13, 4, GL_FLOAT, GL_FALSE, stride, CAST_INT_TO_UCHAR_PTR(offset + sizeof(float) * 4));
+			glVertexAttribDivisor(13, 1);
+			glEnableVertexAttribArray(14);
+			glVertexAttribPointer(14, 4, GL_FLOAT, GL_FALSE, stride, CAST_INT_TO_UCHAR_PTR(offset + sizeof(float) * 8));
+			glVertexAttribDivisor(14, 1);
+			glEnableVertexAttribArray(15);
+			glVertexAttribIPointer(15, 4, GL_UNSIGNED_INT, stride, CAST_INT_TO_UCHAR_PTR(offset + sizeof(float) * 12));
+			glVertexAttribDivisor(15, 1);
+
+			if (use_index_buffer) {
+				glDrawElementsInstanced(primitive_gl, count, mesh_storage->mesh_surface_get_index_type(mesh_surface), 0, batch_count);
+			} else {
+				glDrawArraysInstanced(primitive_gl, 0, count, batch_count);
+			}
 		} else {
 			// Using regular Mesh.
 			if (use_index_buffer) {
@@ -2430,7 +2515,7 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 				glDrawArrays(primitive_gl, 0, count);
 			}
 		}
-		if (inst->instance_count > 0) {
+		if (inst->instance_count > 0 || batch_count > 1) {
 			glDisableVertexAttribArray(12);
 			glDisableVertexAttribArray(13);
 			glDisableVertexAttribArray(14);
@@ -2447,7 +2532,7 @@ void RasterizerSceneGLES3::_render_list_template(RenderListParameters *p_params,
 void RasterizerSceneGLES3::render_material(const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, const PagedArray<RenderGeometryInstance *> &p_instances, RID p_framebuffer, const Rect2i &p_region) {
 }
 
-void RasterizerSceneGLES3::render_particle_collider_heightfield(RID p_collider, const Transform3D &p_transform, const PagedArray<RenderGeometryInstance *> &p_instances) {
+void RasterizerSceneGLES3::render_particle_collider_heightfield(RID p_collider, const Transform3D &p_transform, const PagedArray<RenderGeometryInstance *> &p_instances, const AABB &p_region) {
 	GLES3::ParticlesStorage *particles_storage = GLES3::ParticlesStorage::get_singleton();
 
 	ERR_FAIL_COND(!particles_storage->particles_collision_is_heightfield(p_collider));
@@ -2828,6 +2913,10 @@ RasterizerSceneGLES3::~RasterizerSceneGLES3() {
 		GLES3::Utilities::get_singleton()->buffer_free_data(scene_state.tonemap_buffer);
 	}
 
+	if (scene_state.instance_stream_buffer != 0) {
+		GLES3::Utilities::get_singleton()->buffer_free_data(scene_state.instance_stream_buffer);
+	}
+
 	singleton = nullptr;
 }
 
@@ -388,8 +388,23 @@ private:
 
 		DirectionalLightData *directional_lights = nullptr;
 		GLuint directional_light_buffer = 0;
+
+		// Per-instance data of consecutive meshes drawn as instances, in the layout of the particles instance buffer.
+		struct InstanceStreamData {
+			float transform[12];
+			uint32_t color_custom[4];
+		};
+		static_assert(sizeof(InstanceStreamData) == 16 * sizeof(float), "Instance stream data must match the particles instance stride");
+
+		LocalVector<InstanceStreamData> instance_stream_data;
+		GLuint instance_stream_buffer = 0;
+		uint32_t instance_stream_size = 0; // In instances.
+		uint32_t instance_stream_offset = 0; // In instances, restarts when the buffer is orphaned.
 	} scene_state;
 
+	// Initial size of the instance stream buffer, in instances.
+	static constexpr uint32_t INSTANCE_STREAM_MIN_SIZE = 1024;
+
 	struct RenderListParameters {
 		GeometryInstanceSurface **elements = nullptr;
 		int element_count = 0;
@@ -466,6 +481,45 @@ private:
 	void _setup_environment(const RenderDataGLES3 *p_render_data, bool p_no_fog, const Size2i &p_screen_size, bool p_flip_y, const Color &p_default_bg_color, bool p_pancake_shadows);
 	void _fill_render_list(RenderListType p_render_list, const RenderDataGLES3 *p_render_data, PassMode p_pass_mode, bool p_append = false);
 
+	_FORCE_INLINE_ bool _can_instance_surfaces(const GeometryInstanceSurface *p_surface, const GeometryInstanceSurface *p_next, bool p_shadow_pass, bool p_opaque_pass) const {
+		const GeometryInstanceGLES3 *inst = p_surface->owner;
+		const GeometryInstanceGLES3 *next = p_next->owner;
+
+		if (next->instance_count >= 0 || next->mesh_instance.is_valid() || next->mirror != inst->mirror) {
+			return false;
+		}
+		if (p_opaque_pass && !(p_next->flags & GeometryInstanceSurface::FLAG_PASS_OPAQUE)) {
+			return false;
+		}
+		if ((p_next->flags & GeometryInstanceSurface::FLAG_USES_DOUBLE_SIDED_SHADOWS) != (p_surface->flags & GeometryInstanceSurface::FLAG_USES_DOUBLE_SIDED_SHADOWS) || p_next->lod_index != p_surface->lod_index) {
+			return false;
+		}
+		if (p_shadow_pass) {
+			if (p_next->surface_shadow != p_surface->surface_shadow || p_next->shader_shadow != p_surface->shader_shadow || p_next->material_shadow != p_surface->material_shadow) {
+				return false;
+			}
+		} else if (p_next->surface != p_surface->surface || p_next->shader != p_surface->shader || p_next->material != p_surface->material) {
+			return false;
+		}
+
+		if (next->omni_light_count != inst->omni_light_count || next->spot_light_count != inst->spot_light_count) {
+			return false;
+		}
+		for (uint32_t i = 0; i < inst->omni_light_count; i++) {
+			if (next->omni_light_gl_cache[i] != inst->omni_light_gl_cache[i]) {
+				return false;
+			}
+		}
+		for (uint32_t i = 0; i < inst->spot_light_count; i++) {
+			if (next->spot_light_gl_cache[i] != inst->spot_light_gl_cache[i]) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	uint32_t _stream_instance_data(GeometryInstanceSurface **p_elements, uint32_t p_count);
+
 	template <PassMode p_pass_mode>
 	_FORCE_INLINE_ void _render_list_template(RenderListParameters *p_params, const RenderDataGLES3 *p_render_data, uint32_t p_from_element, uint32_t p_to_element, bool p_alpha_pass = false);
 
@@ -633,6 +687,7 @@ public:
 
 	void positional_soft_shadow_filter_set_quality(RS::ShadowQuality p_quality) override;
 	void directional_soft_shadow_filter_set_quality(RS::ShadowQuality p_quality) override;
+	bool is_static_shadow_cache_supported() const override;
 
 	RID fog_volume_instance_create(RID p_fog_volume) override;
 	void fog_volume_instance_set_transform(RID p_fog_volume_instance, const Transform3D &p_transform) override;
@@ -649,7 +704,8 @@ public:
 
 	void render_scene(const Ref<RenderSceneBuffers> &p_render_buffers, const CameraData *p_camera_data, const CameraData *p_prev_camera_data, const PagedArray<RenderGeometryInstance *> &p_instances, const PagedArray<RID> &p_lights, const PagedArray<RID> &p_reflection_probes, const PagedArray<RID> &p_voxel_gi_instances, const PagedArray<RID> &p_decals, const PagedArray<RID> &p_lightmaps, const PagedArray<RID> &p_fog_volumes, RID p_environment, RID p_camera_attributes, RID p_shadow_atlas, RID p_occluder_debug_tex, RID p_reflection_atlas, RID p_reflection_probe, int p_reflection_probe_pass, float p_screen_mesh_lod_threshold, const RenderShadowData *p_render_shadows, int p_render_shadow_count, const RenderSDFGIData *p_render_sdfgi_regions, int p_render_sdfgi_region_count, const RenderSDFGIUpdateData *p_sdfgi_update_data = nullptr, RenderingMethod::RenderInfo *r_render_info = nullptr) override;
 	void render_material(const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, const PagedArray<RenderGeometryInstance *> &p_instances, RID p_framebuffer, const Rect2i &p_region) override;
-	void render_particle_collider_heightfield(RID p_collider, const Transform3D &p_transform, const PagedArray<RenderGeometryInstance *> &p_instances) override;
+	bool particle_collider_heightfield_scroll(RID p_collider, const Transform3D &p_transform, Vector<AABB> &r_dirty_regions) override { return false; }
+	void render_particle_collider_heightfield(RID p_collider, const Transform3D &p_transform, const PagedArray<RenderGeometryInstance *> &p_instances, const AABB &p_region = AABB()) override;
 
 	void set_scene_pass(uint64_t p_pass) override {
 		scene_pass = p_pass;
@@ -404,6 +404,18 @@ void ShaderGLES3::_compile_specialization(Version::Specialization &spec, uint32_
 		}
 	}
 
+#ifndef WEB_ENABLED
+	if (shader_cache_dir_valid) {
+		// Without this hint, some drivers don't keep the binary around for glGetProgramBinary.
+#ifdef GLES_OVER_GL
+		if (glProgramParameteri != NULL)
+#endif
+		{
+			glProgramParameteri(spec.id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+		}
+	}
+#endif
+
 	glLinkProgram(spec.id);
 
 	glGetProgramiv(spec.id, GL_LINK_STATUS, &status);
@@ -574,6 +586,16 @@ bool ShaderGLES3::_load_from_cache(Version *p_version) {
 			GLint link_status = 0;
 			glGetProgramiv(specialization.id, GL_LINK_STATUS, &link_status);
 			if (link_status != GL_TRUE) {
+				// Don't leak the programs loaded so far, everything will be compiled from source instead.
+				glDeleteProgram(specialization.id);
+				for (OAHashMap<uint64_t, Version::Specialization>::Iterator it = variant.iter(); it.valid; it = variant.next_iter(it)) {
+					glDeleteProgram(it.value->id);
+				}
+				for (uint32_t k = 0; k < variants.size(); k++) {
+					for (OAHashMap<uint64_t, Version::Specialization>::Iterator it = variants[k].iter(); it.valid; it = variants[k].next_iter(it)) {
+						glDeleteProgram(it.value->id);
+					}
+				}
 				WARN_PRINT_ONCE("Failed to load cached shader, recompiling.");
 				return false;
 			}
@@ -741,6 +763,11 @@ void ShaderGLES3::initialize(const String &p_general_defines, int p_base_texture
 
 		hash_build.append("[base_hash]");
 		hash_build.append(base_sha256);
+		// Program binaries are only valid for the driver they were retrieved from.
+		hash_build.append("[driver]");
+		hash_build.append(String((const char *)glGetString(GL_VENDOR)));
+		hash_build.append(String((const char *)glGetString(GL_RENDERER)));
+		hash_build.append(String((const char *)glGetString(GL_VERSION)));
 		hash_build.append("[general_defines]");
 		hash_build.append(general_defines.get_data());
 		for (int i = 0; i < variant_count; i++) {
@@ -766,7 +793,13 @@ void ShaderGLES3::initialize(const String &p_general_defines, int p_base_texture
 			Error err = d->make_dir(base_sha256);
 			ERR_FAIL_COND(err != OK);
 		}
-		shader_cache_dir_valid = true;
+
+#ifndef WEB_ENABLED
+		// Drivers are allowed to support no binary formats at all, in which case programs can't be saved.
+		GLint binary_format_count = 0;
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binary_format_count);
+		shader_cache_dir_valid = binary_format_count > 0;
+#endif
 
 		print_verbose("Shader '" + name + "' SHA256: " + base_sha256);
 	}
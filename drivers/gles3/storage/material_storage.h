@@ -315,6 +315,8 @@ struct SceneShaderData : public ShaderData {
 	bool uses_custom3;
 	bool uses_bones;
 	bool uses_weights;
+	bool uses_model_matrix;
+	bool uses_instance_id;
 
 	uint32_t vertex_input_mask = 0;
 
@@ -607,6 +609,7 @@ public:
 	virtual bool material_casts_shadows(RID p_material) override;
 
 	virtual void material_get_instance_shader_parameters(RID p_material, List<InstanceShaderParam> *r_parameters) override;
+	virtual void material_get_textures(RID p_material, LocalVector<RID> &r_textures) override {} // Only used for texture streaming, which isn't supported here.
 
 	virtual void material_update_dependency(RID p_material, DependencyTracker *p_instance) override;
 
@@ -107,6 +107,9 @@ void MeshStorage::mesh_add_surface(RID p_mesh, const RS::SurfaceData &p_surface)
 	Mesh *mesh = mesh_owner.get_or_null(p_mesh);
 	ERR_FAIL_COND(!mesh);
 
+	// May be called from a loader thread when the upload context is available.
+	GLES3::Utilities::UploadScope upload_scope;
+
 	ERR_FAIL_COND(mesh->surface_count == RS::MAX_MESH_SURFACES);
 
 #ifdef DEBUG_ENABLED
@@ -250,76 +253,23 @@ void MeshStorage::mesh_add_surface(RID p_mesh, const RS::SurfaceData &p_surface)
 	s->bone_aabbs = p_surface.bone_aabbs; //only really useful for returning them.
 
 	if (p_surface.skin_data.size() || mesh->blend_shape_count > 0) {
-		// Size must match the size of the vertex array.
-		int size = p_surface.vertex_data.size();
-		int vertex_size = 0;
-		int stride = 0;
-		int normal_offset = 0;
-		int tangent_offset = 0;
-		if ((p_surface.format & (1 << RS::ARRAY_VERTEX))) {
-			if (p_surface.format & RS::ARRAY_FLAG_USE_2D_VERTICES) {
-				vertex_size = 2;
-			} else {
-				vertex_size = 3;
-			}
-			stride = sizeof(float) * vertex_size;
-		}
-		if ((p_surface.format & (1 << RS::ARRAY_NORMAL))) {
-			normal_offset = stride;
-			stride += sizeof(uint16_t) * 2;
-		}
-		if ((p_surface.format & (1 << RS::ARRAY_TANGENT))) {
-			tangent_offset = stride;
-			stride += sizeof(uint16_t) * 2;
-		}
-
 		if (mesh->blend_shape_count > 0) {
+			// Size must match the size of the vertex array.
+			int size = p_surface.vertex_data.size();
+
 			// Blend shapes are passed as one large array, for OpenGL, we need to split each of them into their own buffer
 			s->blend_shapes = memnew_arr(Mesh::Surface::BlendShape, mesh->blend_shape_count);
 
 			for (uint32_t i = 0; i < mesh->blend_shape_count; i++) {
-				glGenVertexArrays(1, &s->blend_shapes[i].vertex_array);
-				glBindVertexArray(s->blend_shapes[i].vertex_array);
 				glGenBuffers(1, &s->blend_shapes[i].vertex_buffer);
 				glBindBuffer(GL_ARRAY_BUFFER, s->blend_shapes[i].vertex_buffer);
 				GLES3::Utilities::get_singleton()->buffer_allocate_data(GL_ARRAY_BUFFER, s->blend_shapes[i].vertex_buffer, size, p_surface.blend_shape_data.ptr() + i * size, (s->format & RS::ARRAY_FLAG_USE_DYNAMIC_UPDATE) ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW, "Mesh blend shape buffer");
-
-				if ((p_surface.format & (1 << RS::ARRAY_VERTEX))) {
-					glEnableVertexAttribArray(RS::ARRAY_VERTEX + 3);
-					glVertexAttribPointer(RS::ARRAY_VERTEX + 3, vertex_size, GL_FLOAT, GL_FALSE, stride, CAST_INT_TO_UCHAR_PTR(0));
-				}
-				if ((p_surface.format & (1 << RS::ARRAY_NORMAL))) {
-					glEnableVertexAttribArray(RS::ARRAY_NORMAL + 3);
-					glVertexAttribPointer(RS::ARRAY_NORMAL + 3, 2, GL_UNSIGNED_SHORT, GL_TRUE, stride, CAST_INT_TO_UCHAR_PTR(normal_offset));
-				}
-				if ((p_surface.format & (1 << RS::ARRAY_TANGENT))) {
-					glEnableVertexAttribArray(RS::ARRAY_TANGENT + 3);
-					glVertexAttribPointer(RS::ARRAY_TANGENT + 3, 2, GL_UNSIGNED_SHORT, GL_TRUE, stride, CAST_INT_TO_UCHAR_PTR(tangent_offset));
-				}
 			}
-			glBindVertexArray(0);
 			glBindBuffer(GL_ARRAY_BUFFER, 0);
 		}
 
-		// Create a vertex array to use for skeleton/blend shapes.
-		glGenVertexArrays(1, &s->skeleton_vertex_array);
-		glBindVertexArray(s->skeleton_vertex_array);
-		glBindBuffer(GL_ARRAY_BUFFER, s->vertex_buffer);
-
-		if ((p_surface.format & (1 << RS::ARRAY_VERTEX))) {
-			glEnableVertexAttribArray(RS::ARRAY_VERTEX);
-			glVertexAttribPointer(RS::ARRAY_VERTEX, vertex_size, GL_FLOAT, GL_FALSE, stride, CAST_INT_TO_UCHAR_PTR(0));
-		}
-		if ((p_surface.format & (1 << RS::ARRAY_NORMAL))) {
-			glEnableVertexAttribArray(RS::ARRAY_NORMAL);
-			glVertexAttribPointer(RS::ARRAY_NORMAL, 2, GL_UNSIGNED_SHORT, GL_TRUE, stride, CAST_INT_TO_UCHAR_PTR(normal_offset));
-		}
-		if ((p_surface.format & (1 << RS::ARRAY_TANGENT))) {
-			glEnableVertexAttribArray(RS::ARRAY_TANGENT);
-			glVertexAttribPointer(RS::ARRAY_TANGENT, 2, GL_UNSIGNED_SHORT, GL_TRUE, stride, CAST_INT_TO_UCHAR_PTR(tangent_offset));
-		}
-		glBindVertexArray(0);
-		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		// Vertex arrays are not shared between contexts, so these are created on the render thread when first used.
+		s->needs_skeleton_vertex_array = true;
 	}
 
 	if (mesh->surface_count == 0) {
@@ -1069,6 +1019,68 @@ void MeshStorage::_compute_skeleton(MeshInstance *p_mi, Skeleton *p_sk, uint32_t
 	glBindBuffer(GL_TRANSFORM_FEEDBACK_BUFFER, 0);
 }
 
+void MeshStorage::_mesh_surface_generate_skeleton_vertex_arrays(Mesh *p_mesh, Mesh::Surface *s) {
+	int vertex_size = 0;
+	int stride = 0;
+	int normal_offset = 0;
+	int tangent_offset = 0;
+	if ((s->format & (1 << RS::ARRAY_VERTEX))) {
+		if (s->format & RS::ARRAY_FLAG_USE_2D_VERTICES) {
+			vertex_size = 2;
+		} else {
+			vertex_size = 3;
+		}
+		stride = sizeof(float) * vertex_size;
+	}
+	if ((s->format & (1 << RS::ARRAY_NORMAL))) {
+		normal_offset = stride;
+		stride += sizeof(uint16_t) * 2;
+	}
+	if ((s->format & (1 << RS::ARRAY_TANGENT))) {
+		tangent_offset = stride;
+		stride += sizeof(uint16_t) * 2;
+	}
+
+	for (uint32_t i = 0; i < p_mesh->blend_shape_count; i++) {
+		glGenVertexArrays(1, &s->blend_shapes[i].vertex_array);
+		glBindVertexArray(s->blend_shapes[i].vertex_array);
+		glBindBuffer(GL_ARRAY_BUFFER, s->blend_shapes[i].vertex_buffer);
+
+		if ((s->format & (1 << RS::ARRAY_VERTEX))) {
+			glEnableVertexAttribArray(RS::ARRAY_VERTEX + 3);
+			glVertexAttribPointer(RS::ARRAY_VERTEX + 3, vertex_size, GL_FLOAT, GL_FALSE, stride, CAST_INT_TO_UCHAR_PTR(0));
+		}
+		if ((s->format & (1 << RS::ARRAY_NORMAL))) {
+			glEnableVertexAttribArray(RS::ARRAY_NORMAL + 3);
+			glVertexAttribPointer(RS::ARRAY_NORMAL + 3, 2, GL_UNSIGNED_SHORT, GL_TRUE, stride, CAST_INT_TO_UCHAR_PTR(normal_offset));
+		}
+		if ((s->format & (1 << RS::ARRAY_TANGENT))) {
+			glEnableVertexAttribArray(RS::ARRAY_TANGENT + 3);
+			glVertexAttribPointer(RS::ARRAY_TANGENT + 3, 2, GL_UNSIGNED_SHORT, GL_TRUE, stride, CAST_INT_TO_UCHAR_PTR(tangent_offset));
+		}
+	}
+
+	// Create a vertex array to use for skeleton/blend shapes.
+	glGenVertexArrays(1, &s->skeleton_vertex_array);
+	glBindVertexArray(s->skeleton_vertex_array);
+	glBindBuffer(GL_ARRAY_BUFFER, s->vertex_buffer);
+
+	if ((s->format & (1 << RS::ARRAY_VERTEX))) {
+		glEnableVertexAttribArray(RS::ARRAY_VERTEX);
+		glVertexAttribPointer(RS::ARRAY_VERTEX, vertex_size, GL_FLOAT, GL_FALSE, stride, CAST_INT_TO_UCHAR_PTR(0));
+	}
+	if ((s->format & (1 << RS::ARRAY_NORMAL))) {
+		glEnableVertexAttribArray(RS::ARRAY_NORMAL);
+		glVertexAttribPointer(RS::ARRAY_NORMAL, 2, GL_UNSIGNED_SHORT, GL_TRUE, stride, CAST_INT_TO_UCHAR_PTR(normal_offset));
+	}
+	if ((s->format & (1 << RS::ARRAY_TANGENT))) {
+		glEnableVertexAttribArray(RS::ARRAY_TANGENT);
+		glVertexAttribPointer(RS::ARRAY_TANGENT, 2, GL_UNSIGNED_SHORT, GL_TRUE, stride, CAST_INT_TO_UCHAR_PTR(tangent_offset));
+	}
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
 void MeshStorage::update_mesh_instances() {
 	if (dirty_mesh_instance_arrays.first() == nullptr) {
 		return; //nothing to do
@@ -1091,6 +1103,9 @@ void MeshStorage::update_mesh_instances() {
 		}
 
 		for (uint32_t i = 0; i < mi->surfaces.size(); i++) {
+			if (mi->mesh->surfaces[i]->needs_skeleton_vertex_array && mi->mesh->surfaces[i]->skeleton_vertex_array == 0) {
+				_mesh_surface_generate_skeleton_vertex_arrays(mi->mesh, mi->mesh->surfaces[i]);
+			}
 			if (mi->surfaces[i].vertex_buffer == 0 || mi->mesh->surfaces[i]->skeleton_vertex_array == 0) {
 				continue;
 			}
@@ -1767,6 +1782,28 @@ void MeshStorage::multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_b
 	}
 }
 
+void MeshStorage::multimesh_set_buffer_range(RID p_multimesh, int p_from_instance, const Vector<float> &p_buffer) {
+	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_COND(!multimesh);
+
+	uint32_t stride = multimesh->xform_format == RS::MULTIMESH_TRANSFORM_2D ? 8 : 12;
+	stride += multimesh->uses_colors ? 4 : 0;
+	stride += multimesh->uses_custom_data ? 4 : 0;
+	ERR_FAIL_COND_MSG(p_buffer.size() % (int)stride != 0, "Buffer size must be a multiple of the per-instance data size.");
+	int instance_count = p_buffer.size() / (int)stride;
+	ERR_FAIL_COND(p_from_instance < 0 || p_from_instance + instance_count > multimesh->instances);
+
+	if (instance_count == 0) {
+		return;
+	}
+
+	// Colors and custom data are packed when uploading, so patch the unpacked buffer and set it whole.
+	Vector<float> buffer = multimesh_get_buffer(p_multimesh);
+	ERR_FAIL_COND(buffer.size() != multimesh->instances * (int)stride);
+	memcpy(buffer.ptrw() + p_from_instance * stride, p_buffer.ptr(), p_buffer.size() * sizeof(float));
+	multimesh_set_buffer(p_multimesh, buffer);
+}
+
 Vector<float> MeshStorage::multimesh_get_buffer(RID p_multimesh) const {
 	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
 	ERR_FAIL_COND_V(!multimesh, Vector<float>());
@@ -2034,6 +2071,19 @@ void MeshStorage::skeleton_bone_set_transform(RID p_skeleton, int p_bone, const
 	_skeleton_make_dirty(skeleton);
 }
 
+void MeshStorage::skeleton_set_bone_transforms(RID p_skeleton, const Vector<float> &p_data) {
+	Skeleton *skeleton = skeleton_owner.get_or_null(p_skeleton);
+
+	ERR_FAIL_COND(!skeleton);
+	ERR_FAIL_COND(skeleton->use_2d);
+	ERR_FAIL_COND(p_data.size() != skeleton->size * 12);
+
+	// Same layout as skeleton_bone_set_transform, so it can be copied as is.
+	memcpy(skeleton->data.ptrw(), p_data.ptr(), p_data.size() * sizeof(float));
+
+	_skeleton_make_dirty(skeleton);
+}
+
 Transform3D MeshStorage::skeleton_bone_get_transform(RID p_skeleton, int p_bone) const {
 	Skeleton *skeleton = skeleton_owner.get_or_null(p_skeleton);
 
@@ -110,6 +110,7 @@ struct Mesh {
 
 		BlendShape *blend_shapes = nullptr;
 		GLuint skeleton_vertex_array = 0;
+		bool needs_skeleton_vertex_array = false; // Skeleton and blend shape vertex arrays are created on first use.
 
 		RID material;
 	};
@@ -226,6 +227,7 @@ private:
 
 	mutable RID_Owner<Mesh, true> mesh_owner;
 
+	void _mesh_surface_generate_skeleton_vertex_arrays(Mesh *p_mesh, Mesh::Surface *s);
 	void _mesh_surface_generate_version_for_input_mask(Mesh::Surface::Version &v, Mesh::Surface *s, uint32_t p_input_mask, MeshInstance::Surface *mis = nullptr);
 
 	/* Mesh Instance API */
@@ -488,6 +490,7 @@ public:
 	virtual Color multimesh_instance_get_color(RID p_multimesh, int p_index) const override;
 	virtual Color multimesh_instance_get_custom_data(RID p_multimesh, int p_index) const override;
 	virtual void multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_buffer) override;
+	virtual void multimesh_set_buffer_range(RID p_multimesh, int p_from_instance, const Vector<float> &p_buffer) override;
 	virtual Vector<float> multimesh_get_buffer(RID p_multimesh) const override;
 
 	virtual void multimesh_set_visible_instances(RID p_multimesh, int p_visible) override;
@@ -551,6 +554,7 @@ public:
 	virtual void skeleton_set_base_transform_2d(RID p_skeleton, const Transform2D &p_base_transform) override;
 	virtual int skeleton_get_bone_count(RID p_skeleton) const override;
 	virtual void skeleton_bone_set_transform(RID p_skeleton, int p_bone, const Transform3D &p_transform) override;
+	virtual void skeleton_set_bone_transforms(RID p_skeleton, const Vector<float> &p_data) override;
 	virtual Transform3D skeleton_bone_get_transform(RID p_skeleton, int p_bone) const override;
 	virtual void skeleton_bone_set_transform_2d(RID p_skeleton, int p_bone, const Transform2D &p_transform) override;
 	virtual Transform2D skeleton_bone_get_transform_2d(RID p_skeleton, int p_bone) const override;
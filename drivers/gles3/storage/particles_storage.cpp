@@ -1362,6 +1362,11 @@ bool ParticlesStorage::particles_collision_is_heightfield(RID p_particles_collis
 	return particles_collision->type == RS::PARTICLES_COLLISION_TYPE_HEIGHTFIELD_COLLIDE;
 }
 
+Vector<uint8_t> ParticlesStorage::particles_collision_bake_sdf(const Vector<Vector3> &p_faces, const AABB &p_aabb, const Vector3i &p_size, float p_thickness) {
+	// No compute shaders, the SDF is baked on the CPU.
+	return Vector<uint8_t>();
+}
+
 Dependency *ParticlesStorage::particles_collision_get_dependency(RID p_particles_collision) const {
 	ParticlesCollision *pc = particles_collision_owner.get_or_null(p_particles_collision);
 	ERR_FAIL_NULL_V(pc, nullptr);
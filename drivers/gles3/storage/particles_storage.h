@@ -423,6 +423,7 @@ public:
 	virtual AABB particles_collision_get_aabb(RID p_particles_collision) const override;
 	Vector3 particles_collision_get_extents(RID p_particles_collision) const;
 	virtual bool particles_collision_is_heightfield(RID p_particles_collision) const override;
+	virtual Vector<uint8_t> particles_collision_bake_sdf(const Vector<Vector3> &p_faces, const AABB &p_aabb, const Vector3i &p_size, float p_thickness) override;
 	GLuint particles_collision_get_heightfield_framebuffer(RID p_particles_collision) const;
 
 	_FORCE_INLINE_ Size2i particles_collision_get_heightfield_size(RID p_particles_collision) const {
@@ -237,7 +237,7 @@ TextureStorage::~TextureStorage() {
 
 //TODO, move back to storage
 bool TextureStorage::can_create_resources_async() const {
-	return false;
+	return GLES3::Utilities::get_singleton()->is_upload_context_available();
 }
 
 /* Canvas Texture API */
@@ -738,6 +738,8 @@ void TextureStorage::texture_free(RID p_texture) {
 void TextureStorage::texture_2d_initialize(RID p_texture, const Ref<Image> &p_image) {
 	ERR_FAIL_COND(p_image.is_null());
 
+	GLES3::Utilities::UploadScope upload_scope;
+
 	Texture texture;
 	texture.width = p_image->get_width();
 	texture.height = p_image->get_height();
@@ -762,6 +764,8 @@ void TextureStorage::texture_2d_layered_initialize(RID p_texture, const Vector<R
 	ERR_FAIL_COND(p_layered_type == RS::TEXTURE_LAYERED_CUBEMAP && p_layers.size() != 6);
 	ERR_FAIL_COND_MSG(p_layered_type == RS::TEXTURE_LAYERED_CUBEMAP_ARRAY, "Cubemap Arrays are not supported in the GL Compatibility backend.");
 
+	GLES3::Utilities::UploadScope upload_scope;
+
 	Ref<Image> image = p_layers[0];
 	{
 		int valid_width = 0;
@@ -1154,6 +1158,16 @@ void TextureStorage::texture_set_detect_roughness_callback(RID p_texture, RS::Te
 	texture->detect_roughness_callback_ud = p_userdata;
 }
 
+void TextureStorage::texture_set_stream_callback(RID p_texture, RS::TextureStreamCallback p_callback, void *p_userdata) {
+	Texture *texture = texture_owner.get_or_null(p_texture);
+	ERR_FAIL_COND(!texture);
+
+	// Texture streaming isn't supported here, ask for the full size right away.
+	if (p_callback) {
+		p_callback(p_userdata, 0);
+	}
+}
+
 void TextureStorage::texture_debug_usage(List<RS::TextureInfo> *r_info) {
 	List<RID> textures;
 	texture_owner.get_owned_list(&textures);
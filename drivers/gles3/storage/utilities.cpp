@@ -38,14 +38,57 @@
 #include "particles_storage.h"
 #include "texture_storage.h"
 
+#include "servers/display_server.h"
 #include "servers/rendering/rendering_server_globals.h"
 
 using namespace GLES3;
 
 Utilities *Utilities::singleton = nullptr;
 
+static thread_local uint32_t upload_scope_depth = 0;
+
+Utilities::UploadScope::UploadScope() {
+	Utilities *utilities = Utilities::get_singleton();
+	if (!utilities->upload_context_available || Thread::get_caller_id() == utilities->render_thread_id) {
+		return;
+	}
+
+	active = true;
+	upload_scope_depth++;
+	if (upload_scope_depth > 1) {
+		return;
+	}
+
+	utilities->upload_mutex.lock();
+	DisplayServer::get_singleton()->gl_upload_context_make_current(true);
+}
+
+Utilities::UploadScope::~UploadScope() {
+	if (!active) {
+		return;
+	}
+
+	upload_scope_depth--;
+	if (upload_scope_depth > 0) {
+		return;
+	}
+
+	// The render thread may use the objects as soon as their RID is returned, so wait for the data to land.
+	GLsync sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	GLenum status = GL_TIMEOUT_EXPIRED;
+	while (status == GL_TIMEOUT_EXPIRED) {
+		status = glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000); // 1ms
+	}
+	glDeleteSync(sync);
+
+	DisplayServer::get_singleton()->gl_upload_context_make_current(false);
+	Utilities::get_singleton()->upload_mutex.unlock();
+}
+
 Utilities::Utilities() {
 	singleton = this;
+	render_thread_id = Thread::get_caller_id();
+	upload_context_available = DisplayServer::get_singleton()->gl_upload_context_is_available();
 	frame = 0;
 	for (int i = 0; i < FRAME_COUNT; i++) {
 		frames[i].index = 0;
@@ -385,6 +428,19 @@ String Utilities::get_video_adapter_api_version() const {
 	return (const char *)glGetString(GL_VERSION);
 }
 
+Error Utilities::pipeline_bundle_save(const String &p_path) {
+	// OpenGL drivers manage their own program caches.
+	return ERR_UNAVAILABLE;
+}
+
+Error Utilities::pipeline_bundle_precompile(const String &p_path) {
+	return ERR_UNAVAILABLE;
+}
+
+float Utilities::pipeline_bundle_get_precompile_progress() const {
+	return 1.0;
+}
+
 Size2i Utilities::get_maximum_viewport_size() const {
 	Config *config = Config::get_singleton();
 	if (!config) {
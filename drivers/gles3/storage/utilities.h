@@ -33,6 +33,8 @@
 
 #ifdef GLES3_ENABLED
 
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
 #include "servers/rendering/storage/utilities.h"
 
 #include "platform_config.h"
@@ -60,18 +62,39 @@ private:
 	uint64_t buffer_mem_cache = 0;
 	uint64_t texture_mem_cache = 0;
 
+	// Allocations may also be recorded from loader threads when the upload context is in use.
+	Mutex resource_allocs_mutex;
+
+	Thread::ID render_thread_id;
+	bool upload_context_available = false;
+	Mutex upload_mutex; // Only one thread can have the upload context current at a time.
+
 public:
 	static Utilities *get_singleton() { return singleton; }
 
 	Utilities();
 	~Utilities();
 
+	// True if resources can be created from threads other than the render thread, using the shared upload context.
+	bool is_upload_context_available() const { return upload_context_available; }
+
+	// Wraps GL resource creation. Outside the render thread, makes the upload context current and, on exit,
+	// waits for the uploaded data to be complete so the render thread can use it right away. Nested scopes do nothing.
+	class UploadScope {
+		bool active = false;
+
+	public:
+		UploadScope();
+		~UploadScope();
+	};
+
 	// Buffer size is specified in bytes
 	static Vector<uint8_t> buffer_get_data(GLenum p_target, GLuint p_buffer, uint32_t p_buffer_size);
 
 	// Allocate memory with glBufferData. Does not handle resizing.
 	_FORCE_INLINE_ void buffer_allocate_data(GLenum p_target, GLuint p_id, uint32_t p_size, const void *p_data, GLenum p_usage, String p_name = "") {
 		glBufferData(p_target, p_size, p_data, p_usage);
+		MutexLock lock(resource_allocs_mutex);
 		buffer_mem_cache += p_size;
 
 #ifdef DEV_ENABLED
@@ -87,6 +110,7 @@ public:
 	}
 
 	_FORCE_INLINE_ void buffer_free_data(GLuint p_id) {
+		MutexLock lock(resource_allocs_mutex);
 		ERR_FAIL_COND(!buffer_allocs_cache.has(p_id));
 		glDeleteBuffers(1, &p_id);
 		buffer_mem_cache -= buffer_allocs_cache[p_id].size;
@@ -95,6 +119,7 @@ public:
 
 	// Records that data was allocated for state tracking purposes.
 	_FORCE_INLINE_ void texture_allocated_data(GLuint p_id, uint32_t p_size, String p_name = "") {
+		MutexLock lock(resource_allocs_mutex);
 		texture_mem_cache += p_size;
 #ifdef DEV_ENABLED
 		ERR_FAIL_COND_MSG(texture_allocs_cache.has(p_id), "trying to allocate texture with name " + p_name + " but ID already used by " + texture_allocs_cache[p_id].name);
@@ -108,6 +133,7 @@ public:
 	}
 
 	_FORCE_INLINE_ void texture_free_data(GLuint p_id) {
+		MutexLock lock(resource_allocs_mutex);
 		ERR_FAIL_COND(!texture_allocs_cache.has(p_id));
 		glDeleteTextures(1, &p_id);
 		texture_mem_cache -= texture_allocs_cache[p_id].size;
@@ -115,6 +141,7 @@ public:
 	}
 
 	_FORCE_INLINE_ void texture_resize_data(GLuint p_id, uint32_t p_size) {
+		MutexLock lock(resource_allocs_mutex);
 		ERR_FAIL_COND(!texture_allocs_cache.has(p_id));
 		texture_mem_cache -= texture_allocs_cache[p_id].size;
 		texture_mem_cache += p_size;
@@ -188,6 +215,10 @@ public:
 	virtual RenderingDevice::DeviceType get_video_adapter_type() const override;
 	virtual String get_video_adapter_api_version() const override;
 
+	virtual Error pipeline_bundle_save(const String &p_path) override;
+	virtual Error pipeline_bundle_precompile(const String &p_path) override;
+	virtual float pipeline_bundle_get_precompile_progress() const override;
+
 	virtual Size2i get_maximum_viewport_size() const override;
 };
 
@@ -41,6 +41,7 @@
 #include <sys/types.h>
 
 #if defined(UNIX_ENABLED)
+#include <sys/mman.h>
 #include <unistd.h>
 #endif
 
@@ -153,6 +154,13 @@ void FileAccessUnix::_close() {
 		return;
 	}
 
+	if (map_data) {
+		munmap(map_data, map_size);
+		map_data = nullptr;
+		map_size = 0;
+	}
+	map_tried = false;
+
 	fclose(f);
 	f = nullptr;
 
@@ -248,6 +256,59 @@ uint64_t FileAccessUnix::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+uint64_t FileAccessUnix::get_buffer_at(uint64_t p_position, uint8_t *p_dst, uint64_t p_length) const {
+	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
+	ERR_FAIL_COND_V_MSG(!f, -1, "File must be opened before use.");
+
+	if (flags != READ) {
+		return FileAccess::get_buffer_at(p_position, p_dst, p_length); // Buffered writes may not be in the file yet.
+	}
+
+	// Reads the descriptor directly, so neither the cursor nor the stdio buffer are touched.
+	uint64_t read = 0;
+	while (read < p_length) {
+		ssize_t r = pread(fileno(f), p_dst + read, p_length - read, p_position + read);
+		if (r < 0 && errno == EINTR) {
+			continue;
+		}
+		if (r <= 0) {
+			break;
+		}
+		read += r;
+	}
+	return read;
+}
+
+const uint8_t *FileAccessUnix::map_range(uint64_t p_length) const {
+	ERR_FAIL_COND_V_MSG(!f, nullptr, "File must be opened before use.");
+
+	if (!map_tried) {
+		// Map the whole file once, only for plain reads so the contents can't change under the mapping.
+		map_tried = true;
+		struct stat st = {};
+		if (flags == READ && fstat(fileno(f), &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+			void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+			if (data != MAP_FAILED) {
+				map_data = (uint8_t *)data;
+				map_size = st.st_size;
+			}
+		}
+	}
+	if (!map_data) {
+		return nullptr;
+	}
+
+	int64_t pos = ftello(f);
+	if (pos < 0 || (uint64_t)pos + p_length > map_size) {
+		return nullptr;
+	}
+	if (fseeko(f, pos + p_length, SEEK_SET)) {
+		check_errors();
+		return nullptr;
+	}
+	return map_data + pos;
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
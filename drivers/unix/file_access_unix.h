@@ -49,6 +49,10 @@ class FileAccessUnix : public FileAccess {
 	String path;
 	String path_src;
 
+	mutable uint8_t *map_data = nullptr;
+	mutable uint64_t map_size = 0;
+	mutable bool map_tried = false;
+
 	void _close();
 
 public:
@@ -69,6 +73,8 @@ public:
 
 	virtual uint8_t get_8() const override; ///< get a byte
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual const uint8_t *map_range(uint64_t p_length) const override;
+	virtual uint64_t get_buffer_at(uint64_t p_position, uint8_t *p_dst, uint64_t p_length) const override;
 
 	virtual Error get_error() const override; ///< get last error
 
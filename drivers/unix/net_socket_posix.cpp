@@ -54,6 +54,12 @@
 #include <arpa/inet.h>
 #endif
 
+#if defined(__linux__) && !defined(WEB_ENABLED)
+// Receive several datagrams per syscall.
+#define SOCK_RECVMMSG_ENABLED
+#define SOCK_RECVMMSG_MAX 64
+#endif
+
 // BSD calls this flag IPV6_JOIN_GROUP
 #if !defined(IPV6_ADD_MEMBERSHIP) && defined(IPV6_JOIN_GROUP)
 #define IPV6_ADD_MEMBERSHIP IPV6_JOIN_GROUP
@@ -604,6 +610,56 @@ Error NetSocketPosix::recvfrom(uint8_t *p_buffer, int p_len, int &r_read, IPAddr
 	return OK;
 }
 
+Error NetSocketPosix::recvfrom_batch(uint8_t *p_buffer, int p_len, int p_count, int *r_read, IPAddress *r_ip, uint16_t *r_port, int &r_received) {
+#ifdef SOCK_RECVMMSG_ENABLED
+	ERR_FAIL_COND_V(!is_open(), ERR_UNCONFIGURED);
+	ERR_FAIL_COND_V(p_count <= 0, ERR_INVALID_PARAMETER);
+
+	r_received = 0;
+	const int count = MIN(p_count, SOCK_RECVMMSG_MAX);
+	struct mmsghdr msgs[SOCK_RECVMMSG_MAX];
+	struct iovec iovs[SOCK_RECVMMSG_MAX];
+	struct sockaddr_storage from[SOCK_RECVMMSG_MAX];
+	memset(msgs, 0, sizeof(struct mmsghdr) * count);
+	memset(from, 0, sizeof(struct sockaddr_storage) * count);
+	for (int i = 0; i < count; i++) {
+		iovs[i].iov_base = p_buffer + i * p_len;
+		iovs[i].iov_len = p_len;
+		msgs[i].msg_hdr.msg_name = &from[i];
+		msgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_storage);
+		msgs[i].msg_hdr.msg_iov = &iovs[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	int ret = ::recvmmsg(_sock, msgs, count, 0, nullptr);
+	if (ret < 0) {
+		NetError err = _get_socket_error();
+		if (err == ERR_NET_WOULD_BLOCK) {
+			return ERR_BUSY;
+		}
+
+		if (err == ERR_NET_BUFFER_TOO_SMALL) {
+			return ERR_OUT_OF_MEMORY;
+		}
+
+		return FAILED;
+	}
+	if (ret == 0) {
+		return ERR_BUSY;
+	}
+
+	for (int i = 0; i < ret; i++) {
+		ERR_FAIL_COND_V(from[i].ss_family != AF_INET && from[i].ss_family != AF_INET6, FAILED);
+		r_read[i] = msgs[i].msg_len;
+		_set_ip_port(&from[i], &r_ip[i], &r_port[i]);
+	}
+	r_received = ret;
+	return OK;
+#else
+	return NetSocket::recvfrom_batch(p_buffer, p_len, p_count, r_read, r_ip, r_port, r_received);
+#endif
+}
+
 Error NetSocketPosix::send(const uint8_t *p_buffer, int p_len, int &r_sent) {
 	ERR_FAIL_COND_V(!is_open(), ERR_UNCONFIGURED);
 
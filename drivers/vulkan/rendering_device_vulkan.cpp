@@ -1346,7 +1346,7 @@ const VkImageType RenderingDeviceVulkan::vulkan_image_type[RenderingDevice::TEXT
 /**** BUFFER MANAGEMENT ****/
 /***************************/
 
-Error RenderingDeviceVulkan::_buffer_allocate(Buffer *p_buffer, uint32_t p_size, uint32_t p_usage, VmaMemoryUsage p_mem_usage, VmaAllocationCreateFlags p_mem_flags) {
+Error RenderingDeviceVulkan::_buffer_allocate(Buffer *p_buffer, uint32_t p_size, uint32_t p_usage, VmaMemoryUsage p_mem_usage, VmaAllocationCreateFlags p_mem_flags, bool p_movable) {
 	VkBufferCreateInfo bufferInfo;
 	bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
 	bufferInfo.pNext = nullptr;
@@ -1369,6 +1369,10 @@ Error RenderingDeviceVulkan::_buffer_allocate(Buffer *p_buffer, uint32_t p_size,
 		uint32_t mem_type_index = 0;
 		vmaFindMemoryTypeIndexForBufferInfo(allocator, &bufferInfo, &allocInfo, &mem_type_index);
 		allocInfo.pool = _find_or_create_small_allocs_pool(mem_type_index);
+	} else if (p_movable && defragmentation.enabled) {
+		uint32_t mem_type_index = 0;
+		vmaFindMemoryTypeIndexForBufferInfo(allocator, &bufferInfo, &allocInfo, &mem_type_index);
+		allocInfo.pool = _find_or_create_movable_buffer_pool(mem_type_index);
 	}
 
 	VkResult err = vmaCreateBuffer(allocator, &bufferInfo, &allocInfo, &p_buffer->buffer, &p_buffer->allocation, nullptr);
@@ -1388,7 +1392,11 @@ Error RenderingDeviceVulkan::_buffer_free(Buffer *p_buffer) {
 	ERR_FAIL_COND_V(p_buffer->size == 0, ERR_INVALID_PARAMETER);
 
 	buffer_memory -= p_buffer->size;
-	vmaDestroyBuffer(allocator, p_buffer->buffer, p_buffer->allocation);
+	if (defragmentation.pass_active && defragmentation.moving.has(p_buffer->allocation)) {
+		defragmentation.deferred_frees.push_back(Pair<VkBuffer, VmaAllocation>(p_buffer->buffer, p_buffer->allocation));
+	} else {
+		vmaDestroyBuffer(allocator, p_buffer->buffer, p_buffer->allocation);
+	}
 	p_buffer->buffer = VK_NULL_HANDLE;
 	p_buffer->allocation = nullptr;
 	p_buffer->size = 0;
@@ -1408,7 +1416,8 @@ Error RenderingDeviceVulkan::_insert_staging_block() {
 	bufferInfo.pQueueFamilyIndices = nullptr;
 
 	VmaAllocationCreateInfo allocInfo;
-	allocInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT;
+	// Blocks stay mapped for their whole lifetime, so writing to them never goes through the driver.
+	allocInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
 	allocInfo.usage = VMA_MEMORY_USAGE_AUTO_PREFER_HOST;
 	allocInfo.requiredFlags = 0;
 	allocInfo.preferredFlags = 0;
@@ -1418,9 +1427,11 @@ Error RenderingDeviceVulkan::_insert_staging_block() {
 
 	StagingBufferBlock block;
 
-	VkResult err = vmaCreateBuffer(allocator, &bufferInfo, &allocInfo, &block.buffer, &block.allocation, nullptr);
+	VmaAllocationInfo alloc_info;
+	VkResult err = vmaCreateBuffer(allocator, &bufferInfo, &allocInfo, &block.buffer, &block.allocation, &alloc_info);
 	ERR_FAIL_COND_V_MSG(err, ERR_CANT_CREATE, "vmaCreateBuffer failed with error " + itos(err) + ".");
 
+	block.mapped_data = (uint8_t *)alloc_info.pMappedData;
 	block.frame_used = 0;
 	block.fill_amount = 0;
 
@@ -1428,7 +1439,7 @@ Error RenderingDeviceVulkan::_insert_staging_block() {
 	return OK;
 }
 
-Error RenderingDeviceVulkan::_staging_buffer_allocate(uint32_t p_amount, uint32_t p_required_align, uint32_t &r_alloc_offset, uint32_t &r_alloc_size, bool p_can_segment) {
+Error RenderingDeviceVulkan::_staging_buffer_allocate(uint32_t p_amount, uint32_t p_required_align, uint32_t &r_alloc_offset, uint32_t &r_alloc_size, bool p_can_segment, bool p_blocking) {
 	// Determine a block to use.
 
 	r_alloc_size = p_amount;
@@ -1488,6 +1499,9 @@ Error RenderingDeviceVulkan::_staging_buffer_allocate(uint32_t p_amount, uint32_
 
 							//block_until_next_frame()
 							continue;
+						} else if (!p_blocking) {
+							// Let the caller retry once the GPU has caught up instead of stalling.
+							return ERR_BUSY;
 						} else {
 							// Flush EVERYTHING including setup commands. IF not immediate, also need to flush the draw commands.
 							_flush(true);
@@ -1532,6 +1546,8 @@ Error RenderingDeviceVulkan::_staging_buffer_allocate(uint32_t p_amount, uint32_
 					// Separate thread from render.
 					//block_until_next_frame()
 					continue; // And try again.
+				} else if (!p_blocking) {
+					return ERR_BUSY;
 				} else {
 					_flush(false);
 
@@ -1561,7 +1577,7 @@ Error RenderingDeviceVulkan::_staging_buffer_allocate(uint32_t p_amount, uint32_
 	return OK;
 }
 
-Error RenderingDeviceVulkan::_buffer_update(Buffer *p_buffer, size_t p_offset, const uint8_t *p_data, size_t p_data_size, bool p_use_draw_command_buffer, uint32_t p_required_align) {
+Error RenderingDeviceVulkan::_buffer_update(Buffer *p_buffer, size_t p_offset, const uint8_t *p_data, size_t p_data_size, bool p_use_draw_command_buffer, uint32_t p_required_align, bool p_blocking) {
 	// Submitting may get chunked for various reasons, so convert this to a task.
 	size_t to_submit = p_data_size;
 	size_t submit_from = 0;
@@ -1570,24 +1586,15 @@ Error RenderingDeviceVulkan::_buffer_update(Buffer *p_buffer, size_t p_offset, c
 		uint32_t block_write_offset;
 		uint32_t block_write_amount;
 
-		Error err = _staging_buffer_allocate(MIN(to_submit, staging_buffer_block_size), p_required_align, block_write_offset, block_write_amount);
+		// Without blocking, the data is not segmented so a failure can't leave the buffer partially updated.
+		Error err = _staging_buffer_allocate(MIN(to_submit, staging_buffer_block_size), p_required_align, block_write_offset, block_write_amount, p_blocking, p_blocking);
 		if (err) {
 			return err;
 		}
 
-		// Map staging buffer (It's CPU and coherent).
-
-		void *data_ptr = nullptr;
-		{
-			VkResult vkerr = vmaMapMemory(allocator, staging_buffer_blocks[staging_buffer_current].allocation, &data_ptr);
-			ERR_FAIL_COND_V_MSG(vkerr, ERR_CANT_CREATE, "vmaMapMemory failed with error " + itos(vkerr) + ".");
-		}
-
-		// Copy to staging buffer.
-		memcpy(((uint8_t *)data_ptr) + block_write_offset, p_data + submit_from, block_write_amount);
+		// Copy to staging buffer (it's persistently mapped, CPU and coherent).
+		memcpy(staging_buffer_blocks[staging_buffer_current].mapped_data + block_write_offset, p_data + submit_from, block_write_amount);
 
-		// Unmap.
-		vmaUnmapMemory(allocator, staging_buffer_blocks[staging_buffer_current].allocation);
 		// Insert a command to copy this.
 
 		VkBufferCopy region;
@@ -1595,7 +1602,11 @@ Error RenderingDeviceVulkan::_buffer_update(Buffer *p_buffer, size_t p_offset, c
 		region.dstOffset = submit_from + p_offset;
 		region.size = block_write_amount;
 
-		vkCmdCopyBuffer(p_use_draw_command_buffer ? frames[frame].draw_command_buffer : frames[frame].setup_command_buffer, staging_buffer_blocks[staging_buffer_current].buffer, p_buffer->buffer, 1, &region);
+		if (p_use_draw_command_buffer) {
+			_queue_buffer_upload(p_buffer, staging_buffer_blocks[staging_buffer_current].buffer, region);
+		} else {
+			vkCmdCopyBuffer(frames[frame].setup_command_buffer, staging_buffer_blocks[staging_buffer_current].buffer, p_buffer->buffer, 1, &region);
+		}
 
 		staging_buffer_blocks.write[staging_buffer_current].fill_amount = block_write_offset + block_write_amount;
 
@@ -1606,6 +1617,58 @@ Error RenderingDeviceVulkan::_buffer_update(Buffer *p_buffer, size_t p_offset, c
 	return OK;
 }
 
+void RenderingDeviceVulkan::_queue_buffer_upload(Buffer *p_buffer, VkBuffer p_staging_buffer, const VkBufferCopy &p_region) {
+	if (p_buffer->pending_upload != UINT32_MAX) {
+		PendingBufferUpload &upload = pending_buffer_uploads[p_buffer->pending_upload];
+		bool overlaps = upload.staging_buffer != p_staging_buffer;
+		for (uint32_t i = 0; i < upload.regions.size() && !overlaps; i++) {
+			const VkBufferCopy &region = upload.regions[i];
+			overlaps = p_region.dstOffset < region.dstOffset + region.size && region.dstOffset < p_region.dstOffset + p_region.size;
+		}
+
+		if (!overlaps) {
+			VkBufferCopy &last = upload.regions[upload.regions.size() - 1];
+			if (last.srcOffset + last.size == p_region.srcOffset && last.dstOffset + last.size == p_region.dstOffset) {
+				// Contiguous with the previous update, both in the staging block and in the buffer.
+				last.size += p_region.size;
+			} else {
+				upload.regions.push_back(p_region);
+			}
+			return;
+		}
+
+		// Regions of a single copy command are unordered, so the queued copies must be recorded (and finished) first.
+		pending_buffer_upload_dst_stages |= VK_PIPELINE_STAGE_TRANSFER_BIT;
+		pending_buffer_upload_dst_access |= VK_ACCESS_TRANSFER_WRITE_BIT;
+		_flush_pending_buffer_uploads();
+	}
+
+	p_buffer->pending_upload = pending_buffer_uploads.size();
+
+	PendingBufferUpload upload;
+	upload.buffer = p_buffer;
+	upload.staging_buffer = p_staging_buffer;
+	upload.regions.push_back(p_region);
+	pending_buffer_uploads.push_back(upload);
+}
+
+void RenderingDeviceVulkan::_flush_pending_buffer_uploads() {
+	if (pending_buffer_uploads.is_empty()) {
+		return;
+	}
+
+	for (PendingBufferUpload &upload : pending_buffer_uploads) {
+		vkCmdCopyBuffer(frames[frame].draw_command_buffer, upload.staging_buffer, upload.buffer->buffer, upload.regions.size(), upload.regions.ptr());
+		upload.buffer->pending_upload = UINT32_MAX;
+	}
+	pending_buffer_uploads.clear();
+
+	// A single barrier covers every copy, with the union of what the updates asked to protect.
+	_memory_barrier(VK_PIPELINE_STAGE_TRANSFER_BIT, pending_buffer_upload_dst_stages, VK_ACCESS_TRANSFER_WRITE_BIT, pending_buffer_upload_dst_access, true);
+	pending_buffer_upload_dst_stages = 0;
+	pending_buffer_upload_dst_access = 0;
+}
+
 void RenderingDeviceVulkan::_memory_barrier(VkPipelineStageFlags p_src_stage_mask, VkPipelineStageFlags p_dst_stage_mask, VkAccessFlags p_src_access, VkAccessFlags p_dst_access, bool p_sync_with_draw) {
 	VkMemoryBarrier mem_barrier;
 	mem_barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
@@ -1655,6 +1718,46 @@ void RenderingDeviceVulkan::_full_barrier(bool p_sync_with_draw) {
 			p_sync_with_draw);
 }
 
+void RenderingDeviceVulkan::_flush_pending_compute_barrier(BitField<BarrierMask> p_for_mask) {
+	if (pending_compute_barrier.is_empty()) {
+		_flush_pending_buffer_uploads();
+		return;
+	}
+
+	uint32_t barrier_flags = 0;
+	uint32_t access_flags = 0;
+	if (pending_compute_barrier.has_flag(BARRIER_MASK_COMPUTE) && p_for_mask.has_flag(BARRIER_MASK_COMPUTE)) {
+		barrier_flags |= VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT;
+		access_flags |= VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+		pending_compute_barrier.clear_flag(BARRIER_MASK_COMPUTE);
+	}
+	if (pending_compute_barrier.has_flag(BARRIER_MASK_VERTEX) && p_for_mask.has_flag(BARRIER_MASK_VERTEX)) {
+		barrier_flags |= VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT;
+		access_flags |= VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_INDEX_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+		pending_compute_barrier.clear_flag(BARRIER_MASK_VERTEX);
+	}
+	if (pending_compute_barrier.has_flag(BARRIER_MASK_FRAGMENT) && p_for_mask.has_flag(BARRIER_MASK_FRAGMENT)) {
+		barrier_flags |= VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT;
+		access_flags |= VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+		pending_compute_barrier.clear_flag(BARRIER_MASK_FRAGMENT);
+	}
+	if (pending_compute_barrier.has_flag(BARRIER_MASK_TRANSFER) && p_for_mask.has_flag(BARRIER_MASK_TRANSFER)) {
+		barrier_flags |= VK_PIPELINE_STAGE_TRANSFER_BIT;
+		access_flags |= VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_TRANSFER_READ_BIT;
+		pending_compute_barrier.clear_flag(BARRIER_MASK_TRANSFER);
+	}
+
+	if (!(pending_compute_barrier & (BARRIER_MASK_COMPUTE | BARRIER_MASK_VERTEX | BARRIER_MASK_FRAGMENT | BARRIER_MASK_TRANSFER))) {
+		pending_compute_barrier.clear();
+	}
+
+	// The source scope covers every compute dispatch recorded so far, so stages still pending stay correctly ordered after a partial flush.
+	_memory_barrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, barrier_flags, VK_ACCESS_SHADER_WRITE_BIT, access_flags, true);
+
+	// Uploads are always queued after the compute barrier was, see buffer_update().
+	_flush_pending_buffer_uploads();
+}
+
 void RenderingDeviceVulkan::_buffer_memory_barrier(VkBuffer buffer, uint64_t p_from, uint64_t p_size, VkPipelineStageFlags p_src_stage_mask, VkPipelineStageFlags p_dst_stage_mask, VkAccessFlags p_src_access, VkAccessFlags p_dst_access, bool p_sync_with_draw) {
 	VkBufferMemoryBarrier buffer_mem_barrier;
 	buffer_mem_barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
@@ -1892,6 +1995,9 @@ RID RenderingDeviceVulkan::texture_create(const TextureFormat &p_format, const T
 	VkResult err = vmaCreateImage(allocator, &image_create_info, &allocInfo, &texture.image, &texture.allocation, &texture.allocation_info);
 	ERR_FAIL_COND_V_MSG(err, RID(), "vmaCreateImage failed with error " + itos(err) + ".");
 	image_memory += texture.allocation_info.size;
+	if (p_format.usage_bits & (TEXTURE_USAGE_COLOR_ATTACHMENT_BIT | TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT)) {
+		render_target_memory += texture.allocation_info.size;
+	}
 	texture.type = p_format.texture_type;
 	texture.format = p_format.format;
 	texture.width = image_create_info.extent.width;
@@ -2465,6 +2571,8 @@ static _ALWAYS_INLINE_ void _copy_region(uint8_t const *__restrict p_src, uint8_
 Error RenderingDeviceVulkan::_texture_update(RID p_texture, uint32_t p_layer, const Vector<uint8_t> &p_data, BitField<BarrierMask> p_post_barrier, bool p_use_setup_queue) {
 	_THREAD_SAFE_METHOD_
 
+	_flush_pending_compute_barrier();
+
 	ERR_FAIL_COND_V_MSG((draw_list || compute_list) && !p_use_setup_queue, ERR_INVALID_PARAMETER,
 			"Updating textures is forbidden during creation of a draw or compute list");
 
@@ -2565,13 +2673,7 @@ Error RenderingDeviceVulkan::_texture_update(RID p_texture, uint32_t p_layer, co
 
 					uint8_t *write_ptr;
 
-					{ // Map.
-						void *data_ptr = nullptr;
-						VkResult vkerr = vmaMapMemory(allocator, staging_buffer_blocks[staging_buffer_current].allocation, &data_ptr);
-						ERR_FAIL_COND_V_MSG(vkerr, ERR_CANT_CREATE, "vmaMapMemory failed with error " + itos(vkerr) + ".");
-						write_ptr = (uint8_t *)data_ptr;
-						write_ptr += alloc_offset;
-					}
+					write_ptr = staging_buffer_blocks[staging_buffer_current].mapped_data + alloc_offset;
 
 					uint32_t block_w, block_h;
 					get_compressed_image_format_block_dimensions(texture->format, block_w, block_h);
@@ -2598,10 +2700,6 @@ Error RenderingDeviceVulkan::_texture_update(RID p_texture, uint32_t p_layer, co
 						_copy_region(read_ptr, write_ptr, x, y, region_w, region_h, width, pixel_size);
 					}
 
-					{ // Unmap.
-						vmaUnmapMemory(allocator, staging_buffer_blocks[staging_buffer_current].allocation);
-					}
-
 					VkBufferImageCopy buffer_image_copy;
 					buffer_image_copy.bufferOffset = alloc_offset;
 					buffer_image_copy.bufferRowLength = 0; // Tightly packed.
@@ -2754,6 +2852,8 @@ Vector<uint8_t> RenderingDeviceVulkan::_texture_get_data_from_image(Texture *tex
 Vector<uint8_t> RenderingDeviceVulkan::texture_get_data(RID p_texture, uint32_t p_layer) {
 	_THREAD_SAFE_METHOD_
 
+	_flush_pending_compute_barrier();
+
 	Texture *tex = texture_owner.get_or_null(p_texture);
 	ERR_FAIL_COND_V(!tex, Vector<uint8_t>());
 
@@ -2936,6 +3036,8 @@ uint64_t RenderingDeviceVulkan::texture_get_native_handle(RID p_texture) {
 Error RenderingDeviceVulkan::texture_copy(RID p_from_texture, RID p_to_texture, const Vector3 &p_from, const Vector3 &p_to, const Vector3 &p_size, uint32_t p_src_mipmap, uint32_t p_dst_mipmap, uint32_t p_src_layer, uint32_t p_dst_layer, BitField<BarrierMask> p_post_barrier) {
 	_THREAD_SAFE_METHOD_
 
+	_flush_pending_compute_barrier();
+
 	Texture *src_tex = texture_owner.get_or_null(p_from_texture);
 	ERR_FAIL_COND_V(!src_tex, ERR_INVALID_PARAMETER);
 
@@ -3135,6 +3237,8 @@ Error RenderingDeviceVulkan::texture_copy(RID p_from_texture, RID p_to_texture,
 Error RenderingDeviceVulkan::texture_resolve_multisample(RID p_from_texture, RID p_to_texture, BitField<BarrierMask> p_post_barrier) {
 	_THREAD_SAFE_METHOD_
 
+	_flush_pending_compute_barrier();
+
 	Texture *src_tex = texture_owner.get_or_null(p_from_texture);
 	ERR_FAIL_COND_V(!src_tex, ERR_INVALID_PARAMETER);
 
@@ -3310,6 +3414,8 @@ Error RenderingDeviceVulkan::texture_resolve_multisample(RID p_from_texture, RID
 Error RenderingDeviceVulkan::texture_clear(RID p_texture, const Color &p_color, uint32_t p_base_mipmap, uint32_t p_mipmaps, uint32_t p_base_layer, uint32_t p_layers, BitField<BarrierMask> p_post_barrier) {
 	_THREAD_SAFE_METHOD_
 
+	_flush_pending_compute_barrier();
+
 	Texture *src_tex = texture_owner.get_or_null(p_texture);
 	ERR_FAIL_COND_V(!src_tex, ERR_INVALID_PARAMETER);
 
@@ -4395,15 +4501,20 @@ RID RenderingDeviceVulkan::vertex_buffer_create(uint32_t p_size_bytes, const Vec
 		usage |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
 	}
 	Buffer buffer;
-	_buffer_allocate(&buffer, p_size_bytes, usage, VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE, 0);
+	// Storage buffers end up in uniform sets, which can't be patched once written.
+	_buffer_allocate(&buffer, p_size_bytes, usage, VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE, 0, !p_use_as_storage);
 	if (p_data.size()) {
 		uint64_t data_size = p_data.size();
 		const uint8_t *r = p_data.ptr();
 		_buffer_update(&buffer, 0, r, data_size);
 		_buffer_memory_barrier(buffer.buffer, 0, data_size, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT, false);
 	}
+	mesh_memory += buffer.size;
 
 	RID id = vertex_buffer_owner.make_rid(buffer);
+	if (defragmentation.enabled && !p_use_as_storage) {
+		defragmentation.movable_buffers[buffer.allocation] = id;
+	}
 #ifdef DEV_ENABLED
 	set_resource_name(id, "RID:" + itos(id.get_id()));
 #endif
@@ -4563,14 +4674,18 @@ RID RenderingDeviceVulkan::index_buffer_create(uint32_t p_index_count, IndexBuff
 #else
 	index_buffer.max_index = 0xFFFFFFFF;
 #endif
-	_buffer_allocate(&index_buffer, size_bytes, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE, 0);
+	_buffer_allocate(&index_buffer, size_bytes, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE, 0, true);
 	if (p_data.size()) {
 		uint64_t data_size = p_data.size();
 		const uint8_t *r = p_data.ptr();
 		_buffer_update(&index_buffer, 0, r, data_size);
 		_buffer_memory_barrier(index_buffer.buffer, 0, data_size, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_INDEX_READ_BIT, false);
 	}
+	mesh_memory += index_buffer.size;
 	RID id = index_buffer_owner.make_rid(index_buffer);
+	if (defragmentation.enabled) {
+		defragmentation.movable_buffers[index_buffer.allocation] = id;
+	}
 #ifdef DEV_ENABLED
 	set_resource_name(id, "RID:" + itos(id.get_id()));
 #endif
@@ -5197,6 +5312,14 @@ RID RenderingDeviceVulkan::shader_create_from_bytecode(const Vector<uint8_t> &p_
 		ERR_FAIL_V_MSG(RID(), error_text);
 	}
 
+	if (pipeline_bundle.recording) {
+		HashMap<Vector<uint8_t>, uint32_t, PipelineBundleBlobHasher>::Iterator E = pipeline_bundle.shaders.find(p_shader_binary);
+		if (!E) {
+			E = pipeline_bundle.shaders.insert(p_shader_binary, pipeline_bundle.shaders.size());
+		}
+		pipeline_bundle.shader_indices[id] = E->value;
+	}
+
 #ifdef DEV_ENABLED
 	set_resource_name(id, "RID:" + itos(id.get_id()));
 #endif
@@ -5911,6 +6034,8 @@ void RenderingDeviceVulkan::uniform_set_set_invalidation_callback(RID p_uniform_
 Error RenderingDeviceVulkan::buffer_copy(RID p_src_buffer, RID p_dst_buffer, uint32_t p_src_offset, uint32_t p_dst_offset, uint32_t p_size, BitField<BarrierMask> p_post_barrier) {
 	_THREAD_SAFE_METHOD_
 
+	_flush_pending_compute_barrier();
+
 	ERR_FAIL_COND_V_MSG(draw_list, ERR_INVALID_PARAMETER,
 			"Copying buffers is forbidden during creation of a draw list");
 	ERR_FAIL_COND_V_MSG(compute_list, ERR_INVALID_PARAMETER,
@@ -5969,6 +6094,82 @@ Error RenderingDeviceVulkan::buffer_copy(RID p_src_buffer, RID p_dst_buffer, uin
 Error RenderingDeviceVulkan::buffer_update(RID p_buffer, uint32_t p_offset, uint32_t p_size, const void *p_data, BitField<BarrierMask> p_post_barrier) {
 	_THREAD_SAFE_METHOD_
 
+	return _buffer_update_queued(p_buffer, p_offset, p_size, p_data, p_post_barrier, true);
+}
+
+uint64_t RenderingDeviceVulkan::buffer_update_async(RID p_buffer, uint32_t p_offset, uint32_t p_size, const void *p_data, BitField<BarrierMask> p_post_barrier) {
+	_THREAD_SAFE_METHOD_
+
+	ERR_FAIL_COND_V_MSG(p_size > staging_buffer_block_size, 0,
+			"Asynchronous updates must fit in a staging block (" + itos(staging_buffer_block_size) + " bytes), use buffer_update() for larger ones.");
+	ERR_FAIL_COND_V_MSG(p_post_barrier == RD::BARRIER_MASK_NO_BARRIER, 0,
+			"Asynchronous updates are recorded with the frame's commands and need a post barrier.");
+
+	Error err = _buffer_update_queued(p_buffer, p_offset, p_size, p_data, p_post_barrier, false);
+	if (err) {
+		return 0;
+	}
+
+	// The copy is part of this frame's commands, so it's done once the frame is.
+	return frames_drawn;
+}
+
+bool RenderingDeviceVulkan::upload_fence_is_signaled(uint64_t p_fence) const {
+	// Same rule as for reusing staging blocks, frames this old have been waited on.
+	return p_fence <= frames_drawn - frame_count;
+}
+
+uint64_t RenderingDeviceVulkan::buffer_update_late_latched(RID p_buffer, uint32_t p_offset, uint32_t p_size, const void *p_data, BitField<BarrierMask> p_post_barrier) {
+	_THREAD_SAFE_METHOD_
+
+	ERR_FAIL_COND_V_MSG(p_size > staging_buffer_block_size, 0,
+			"Late latched updates must fit in a staging block (" + itos(staging_buffer_block_size) + " bytes).");
+	ERR_FAIL_COND_V_MSG(p_post_barrier == RD::BARRIER_MASK_NO_BARRIER, 0,
+			"Late latched updates are recorded with the frame's commands and need a post barrier.");
+
+	Error err = _buffer_update_queued(p_buffer, p_offset, p_size, p_data, p_post_barrier, false);
+	if (err) {
+		return 0;
+	}
+
+	// Not segmented, so the data is the last thing written to the current block.
+	const StagingBufferBlock &block = staging_buffer_blocks[staging_buffer_current];
+	LateLatch latch;
+	latch.data = block.mapped_data + block.fill_amount - p_size;
+	latch.size = p_size;
+	late_latches.push_back(latch);
+
+	return late_latch_first + late_latches.size() - 1;
+}
+
+bool RenderingDeviceVulkan::buffer_late_latch_is_valid(uint64_t p_latch) const {
+	return p_latch >= late_latch_first && p_latch - late_latch_first < late_latches.size();
+}
+
+bool RenderingDeviceVulkan::buffer_late_latch_write(uint64_t p_latch, const void *p_data) {
+	_THREAD_SAFE_METHOD_
+
+	if (!buffer_late_latch_is_valid(p_latch)) {
+		return false;
+	}
+
+	// The staging memory is coherent, and host writes are made visible by the submission.
+	const LateLatch &latch = late_latches[p_latch - late_latch_first];
+	memcpy(latch.data, p_data, latch.size);
+	return true;
+}
+
+void RenderingDeviceVulkan::_release_late_latches() {
+	late_latch_first += late_latches.size();
+	late_latches.clear();
+}
+
+Error RenderingDeviceVulkan::_buffer_update_queued(RID p_buffer, uint32_t p_offset, uint32_t p_size, const void *p_data, BitField<BarrierMask> p_post_barrier, bool p_blocking) {
+	// Queued uploads never coexist with a deferred compute barrier, so this leaves them pending to be recorded together.
+	if (!pending_compute_barrier.is_empty()) {
+		_flush_pending_compute_barrier();
+	}
+
 	ERR_FAIL_COND_V_MSG(draw_list, ERR_INVALID_PARAMETER,
 			"Updating buffers is forbidden during creation of a draw list");
 	ERR_FAIL_COND_V_MSG(compute_list, ERR_INVALID_PARAMETER,
@@ -5992,12 +6193,13 @@ Error RenderingDeviceVulkan::buffer_update(RID p_buffer, uint32_t p_offset, uint
 	// No barrier should be needed here.
 	// _buffer_memory_barrier(buffer->buffer, p_offset, p_size, dst_stage_mask, VK_PIPELINE_STAGE_TRANSFER_BIT, dst_access, VK_ACCESS_TRANSFER_WRITE_BIT, true);
 
-	Error err = _buffer_update(buffer, p_offset, (uint8_t *)p_data, p_size, p_post_barrier);
+	Error err = _buffer_update(buffer, p_offset, (uint8_t *)p_data, p_size, p_post_barrier, 32, p_blocking);
 	if (err) {
 		return err;
 	}
 
 #ifdef FORCE_FULL_BARRIER
+	_flush_pending_buffer_uploads();
 	_full_barrier(true);
 #else
 	if (dst_stage_mask == 0) {
@@ -6005,7 +6207,9 @@ Error RenderingDeviceVulkan::buffer_update(RID p_buffer, uint32_t p_offset, uint
 	}
 
 	if (p_post_barrier != RD::BARRIER_MASK_NO_BARRIER) {
-		_buffer_memory_barrier(buffer->buffer, p_offset, p_size, VK_PIPELINE_STAGE_TRANSFER_BIT, dst_stage_mask, VK_ACCESS_TRANSFER_WRITE_BIT, dst_access, true);
+		// Recorded along with the copy, when the queued uploads are flushed.
+		pending_buffer_upload_dst_stages |= dst_stage_mask;
+		pending_buffer_upload_dst_access |= dst_access;
 	}
 
 #endif
@@ -6015,6 +6219,8 @@ Error RenderingDeviceVulkan::buffer_update(RID p_buffer, uint32_t p_offset, uint
 Error RenderingDeviceVulkan::buffer_clear(RID p_buffer, uint32_t p_offset, uint32_t p_size, BitField<BarrierMask> p_post_barrier) {
 	_THREAD_SAFE_METHOD_
 
+	_flush_pending_compute_barrier();
+
 	ERR_FAIL_COND_V_MSG((p_size % 4) != 0, ERR_INVALID_PARAMETER,
 			"Size must be a multiple of four");
 	ERR_FAIL_COND_V_MSG(draw_list, ERR_INVALID_PARAMETER,
@@ -6059,6 +6265,8 @@ Error RenderingDeviceVulkan::buffer_clear(RID p_buffer, uint32_t p_offset, uint3
 Vector<uint8_t> RenderingDeviceVulkan::buffer_get_data(RID p_buffer, uint32_t p_offset, uint32_t p_size) {
 	_THREAD_SAFE_METHOD_
 
+	_flush_pending_compute_barrier();
+
 	// It could be this buffer was just created.
 	VkPipelineShaderStageCreateFlags src_stage_mask = VK_PIPELINE_STAGE_TRANSFER_BIT;
 	VkAccessFlags src_access_mask = VK_ACCESS_TRANSFER_WRITE_BIT;
@@ -6109,6 +6317,54 @@ Vector<uint8_t> RenderingDeviceVulkan::buffer_get_data(RID p_buffer, uint32_t p_
 	return buffer_data;
 }
 
+Error RenderingDeviceVulkan::buffer_get_data_async(RID p_buffer, const Callable &p_callback, uint32_t p_offset, uint32_t p_size) {
+	_THREAD_SAFE_METHOD_
+
+	_flush_pending_compute_barrier();
+
+	ERR_FAIL_COND_V_MSG(draw_list, ERR_INVALID_PARAMETER,
+			"Copying buffers is forbidden during creation of a draw list");
+	ERR_FAIL_COND_V_MSG(compute_list, ERR_INVALID_PARAMETER,
+			"Copying buffers is forbidden during creation of a compute list");
+	ERR_FAIL_COND_V(!p_callback.is_valid(), ERR_INVALID_PARAMETER);
+
+	// It could be this buffer was just created.
+	VkPipelineShaderStageCreateFlags src_stage_mask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+	VkAccessFlags src_access_mask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	// Get the vulkan buffer and the potential stage/access possible.
+	Buffer *buffer = _get_buffer_from_owner(p_buffer, src_stage_mask, src_access_mask, BARRIER_MASK_ALL_BARRIERS);
+	if (!buffer) {
+		ERR_FAIL_V_MSG(ERR_INVALID_PARAMETER, "Buffer is either invalid or this type of buffer can't be retrieved. Only Vertex, Index, Uniform, Texture and Storage buffers allow retrieving.");
+	}
+
+	// Size of buffer to retrieve.
+	if (!p_size) {
+		p_size = buffer->size;
+	} else {
+		ERR_FAIL_COND_V_MSG(p_size + p_offset > buffer->size, ERR_INVALID_PARAMETER,
+				"Size is larger than the buffer.");
+	}
+
+	// Wait for previous writes, the copy lands in the same command buffer as the frame's work.
+	_buffer_memory_barrier(buffer->buffer, 0, buffer->size, src_stage_mask, VK_PIPELINE_STAGE_TRANSFER_BIT, src_access_mask, VK_ACCESS_TRANSFER_READ_BIT, true);
+
+	Frame::BufferDownload download;
+	download.callback = p_callback;
+	Error err = _buffer_allocate(&download.buffer, p_size, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VMA_MEMORY_USAGE_AUTO_PREFER_HOST, VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT);
+	ERR_FAIL_COND_V(err, err);
+
+	VkBufferCopy region;
+	region.srcOffset = p_offset;
+	region.dstOffset = 0;
+	region.size = p_size;
+	vkCmdCopyBuffer(frames[frame].draw_command_buffer, buffer->buffer, download.buffer.buffer, 1, &region);
+
+	// Read back when this frame comes around again, at which point the GPU is done with it.
+	frames[frame].buffer_downloads.push_back(download);
+
+	return OK;
+}
+
 /*************************/
 /**** RENDER PIPELINE ****/
 /*************************/
@@ -6527,13 +6783,33 @@ RID RenderingDeviceVulkan::render_pipeline_create(RID p_shader, FramebufferForma
 	graphics_pipeline_create_info.basePipelineIndex = 0;
 
 	RenderPipeline pipeline;
+
+	// This can take a long time, so let other threads use the device meanwhile.
+	// The pipeline cache object is internally synchronized.
+	unlocked_pipeline_creations.increment();
+	_THREAD_SAFE_UNLOCK_
 	VkResult err = vkCreateGraphicsPipelines(device, pipelines_cache.cache_object, 1, &graphics_pipeline_create_info, nullptr, &pipeline.pipeline);
+	_THREAD_SAFE_LOCK_
+	unlocked_pipeline_creations.decrement();
+
+	// The shader may have been freed in the meantime.
+	shader = shader_owner.get_or_null(p_shader);
+	if (!shader) {
+		if (err == VK_SUCCESS) {
+			vkDestroyPipeline(device, pipeline.pipeline, nullptr);
+		}
+		return RID();
+	}
 	ERR_FAIL_COND_V_MSG(err, RID(), "vkCreateGraphicsPipelines failed with error " + itos(err) + " for shader '" + shader->name + "'.");
 
 	if (pipelines_cache.cache_object != VK_NULL_HANDLE) {
 		_update_pipeline_cache();
 	}
 
+	if (pipeline_bundle.recording) {
+		_pipeline_bundle_record(p_shader, p_framebuffer_format, p_vertex_format, p_render_primitive, p_rasterization_state, p_multisample_state, p_depth_stencil_state, p_blend_state, p_dynamic_state_flags, p_for_render_pass, p_specialization_constants);
+	}
+
 	pipeline.set_formats = shader->set_formats;
 	pipeline.push_constant_stages_mask = shader->push_constant.vk_stages_mask;
 	pipeline.pipeline_layout = shader->pipeline_layout;
@@ -6724,10 +7000,14 @@ RenderingDevice::FramebufferFormatID RenderingDeviceVulkan::screen_get_framebuff
 
 RenderingDevice::DrawListID RenderingDeviceVulkan::draw_list_begin_for_screen(DisplayServer::WindowID p_screen, const Color &p_clear_color) {
 	_THREAD_SAFE_METHOD_
+
+	_flush_pending_compute_barrier();
+
 	ERR_FAIL_COND_V_MSG(local_device.is_valid(), INVALID_ID, "Local devices have no screen");
 
 	ERR_FAIL_COND_V_MSG(draw_list != nullptr, INVALID_ID, "Only one draw list can be active at the same time.");
 	ERR_FAIL_COND_V_MSG(compute_list != nullptr, INVALID_ID, "Only one draw/compute list can be active at the same time.");
+	ERR_FAIL_COND_V_MSG(async_compute_recording, INVALID_ID, "Draw lists can't be recorded in an async compute batch.");
 
 	VkCommandBuffer command_buffer = frames[frame].draw_command_buffer;
 
@@ -7000,8 +7280,11 @@ void RenderingDeviceVulkan::_draw_list_insert_clear_region(DrawList *p_draw_list
 RenderingDevice::DrawListID RenderingDeviceVulkan::draw_list_begin(RID p_framebuffer, InitialAction p_initial_color_action, FinalAction p_final_color_action, InitialAction p_initial_depth_action, FinalAction p_final_depth_action, const Vector<Color> &p_clear_color_values, float p_clear_depth, uint32_t p_clear_stencil, const Rect2 &p_region, const Vector<RID> &p_storage_textures) {
 	_THREAD_SAFE_METHOD_
 
+	_flush_pending_compute_barrier();
+
 	ERR_FAIL_COND_V_MSG(draw_list != nullptr, INVALID_ID, "Only one draw list can be active at the same time.");
 	ERR_FAIL_COND_V_MSG(compute_list != nullptr && !compute_list->state.allow_draw_overlap, INVALID_ID, "Only one draw/compute list can be active at the same time.");
+	ERR_FAIL_COND_V_MSG(async_compute_recording, INVALID_ID, "Draw lists can't be recorded in an async compute batch.");
 
 	Framebuffer *framebuffer = framebuffer_owner.get_or_null(p_framebuffer);
 	ERR_FAIL_COND_V(!framebuffer, INVALID_ID);
@@ -7106,8 +7389,11 @@ RenderingDevice::DrawListID RenderingDeviceVulkan::draw_list_begin(RID p_framebu
 Error RenderingDeviceVulkan::draw_list_begin_split(RID p_framebuffer, uint32_t p_splits, DrawListID *r_split_ids, InitialAction p_initial_color_action, FinalAction p_final_color_action, InitialAction p_initial_depth_action, FinalAction p_final_depth_action, const Vector<Color> &p_clear_color_values, float p_clear_depth, uint32_t p_clear_stencil, const Rect2 &p_region, const Vector<RID> &p_storage_textures) {
 	_THREAD_SAFE_METHOD_
 
+	_flush_pending_compute_barrier();
+
 	ERR_FAIL_COND_V_MSG(draw_list != nullptr, ERR_BUSY, "Only one draw list can be active at the same time.");
 	ERR_FAIL_COND_V_MSG(compute_list != nullptr && !compute_list->state.allow_draw_overlap, ERR_BUSY, "Only one draw/compute list can be active at the same time.");
+	ERR_FAIL_COND_V_MSG(async_compute_recording, ERR_BUSY, "Draw lists can't be recorded in an async compute batch.");
 
 	ERR_FAIL_COND_V(p_splits < 1, ERR_INVALID_DECLARATION);
 
@@ -7554,6 +7840,95 @@ void RenderingDeviceVulkan::draw_list_draw(DrawListID p_list, bool p_use_indices
 	}
 }
 
+void RenderingDeviceVulkan::draw_list_draw_indirect(DrawListID p_list, bool p_use_indices, RID p_buffer, uint32_t p_offset, uint32_t p_draw_count, uint32_t p_stride) {
+	DrawList *dl = _get_draw_list_ptr(p_list);
+	ERR_FAIL_COND(!dl);
+
+	Buffer *buffer = storage_buffer_owner.get_or_null(p_buffer);
+	ERR_FAIL_COND(!buffer);
+
+	ERR_FAIL_COND_MSG(!(buffer->usage & VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT), "Buffer provided was not created to do indirect draws.");
+
+	// The command size is 20 bytes for indexed draws, 16 bytes otherwise.
+	uint32_t command_size = p_use_indices ? sizeof(VkDrawIndexedIndirectCommand) : sizeof(VkDrawIndirectCommand);
+	if (p_stride == 0) {
+		p_stride = command_size;
+	}
+
+	ERR_FAIL_COND_MSG(p_draw_count == 0, "At least one draw must be requested.");
+	ERR_FAIL_COND_MSG(p_offset % 4 != 0, "Offset provided must be a multiple of 4.");
+	ERR_FAIL_COND_MSG(p_draw_count > 1 && (p_stride % 4 != 0 || p_stride < command_size), "Stride provided must be a multiple of 4 and not smaller than the indirect command (" + itos(command_size) + " bytes).");
+	ERR_FAIL_COND_MSG(p_offset + (p_draw_count - 1) * p_stride + command_size > buffer->size, "Offset provided (+" + itos((p_draw_count - 1) * p_stride + command_size) + ") is past the end of buffer.");
+	ERR_FAIL_COND_MSG(p_draw_count > 1 && !context->get_physical_device_features().multiDrawIndirect, "Multiple indirect draws were requested, but the device does not support multi-draw indirect.");
+
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_COND_MSG(!dl->validation.active, "Submitted Draw Lists can no longer be modified.");
+#endif
+
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_COND_MSG(!dl->validation.pipeline_active,
+			"No render pipeline was set before attempting to draw.");
+	if (dl->validation.pipeline_vertex_format != INVALID_ID) {
+		// Pipeline uses vertices, validate format.
+		ERR_FAIL_COND_MSG(dl->validation.vertex_format == INVALID_ID,
+				"No vertex array was bound, and render pipeline expects vertices.");
+		// Make sure format is right.
+		ERR_FAIL_COND_MSG(dl->validation.pipeline_vertex_format != dl->validation.vertex_format,
+				"The vertex format used to create the pipeline does not match the vertex format bound.");
+	}
+
+	if (dl->validation.pipeline_push_constant_size > 0) {
+		// Using push constants, check that they were supplied.
+		ERR_FAIL_COND_MSG(!dl->validation.pipeline_push_constant_supplied,
+				"The shader in this pipeline requires a push constant to be set before drawing, but it's not present.");
+	}
+
+#endif
+
+	// Bind descriptor sets.
+
+	for (uint32_t i = 0; i < dl->state.set_count; i++) {
+		if (dl->state.sets[i].pipeline_expected_format == 0) {
+			continue; // Nothing expected by this pipeline.
+		}
+#ifdef DEBUG_ENABLED
+		if (dl->state.sets[i].pipeline_expected_format != dl->state.sets[i].uniform_set_format) {
+			if (dl->state.sets[i].uniform_set_format == 0) {
+				ERR_FAIL_MSG("Uniforms were never supplied for set (" + itos(i) + ") at the time of drawing, which are required by the pipeline");
+			} else if (uniform_set_owner.owns(dl->state.sets[i].uniform_set)) {
+				UniformSet *us = uniform_set_owner.get_or_null(dl->state.sets[i].uniform_set);
+				ERR_FAIL_MSG("Uniforms supplied for set (" + itos(i) + "):\n" + _shader_uniform_debug(us->shader_id, us->shader_set) + "\nare not the same format as required by the pipeline shader. Pipeline shader requires the following bindings:\n" + _shader_uniform_debug(dl->state.pipeline_shader));
+			} else {
+				ERR_FAIL_MSG("Uniforms supplied for set (" + itos(i) + ", which was was just freed) are not the same format as required by the pipeline shader. Pipeline shader requires the following bindings:\n" + _shader_uniform_debug(dl->state.pipeline_shader));
+			}
+		}
+#endif
+		if (!dl->state.sets[i].bound) {
+			// All good, see if this requires re-binding.
+			vkCmdBindDescriptorSets(dl->command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, dl->state.pipeline_layout, i, 1, &dl->state.sets[i].descriptor_set, 0, nullptr);
+			dl->state.sets[i].bound = true;
+		}
+	}
+
+	// Element counts come from the buffer, so only the bindings can be validated here.
+	if (p_use_indices) {
+#ifdef DEBUG_ENABLED
+		ERR_FAIL_COND_MSG(!dl->validation.index_array_size,
+				"Draw command requested indices, but no index buffer was set.");
+
+		ERR_FAIL_COND_MSG(dl->validation.pipeline_uses_restart_indices != dl->validation.index_buffer_uses_restart_indices,
+				"The usage of restart indices in index buffer does not match the render primitive in the pipeline.");
+#endif
+		vkCmdDrawIndexedIndirect(dl->command_buffer, buffer->buffer, p_offset, p_draw_count, p_stride);
+	} else {
+#ifdef DEBUG_ENABLED
+		ERR_FAIL_COND_MSG(dl->validation.pipeline_vertex_format == INVALID_ID,
+				"Draw command lacks indices, but pipeline format does not use vertices.");
+#endif
+		vkCmdDrawIndirect(dl->command_buffer, buffer->buffer, p_offset, p_draw_count, p_stride);
+	}
+}
+
 void RenderingDeviceVulkan::draw_list_enable_scissor(DrawListID p_list, const Rect2 &p_rect) {
 	DrawList *dl = _get_draw_list_ptr(p_list);
 
@@ -7636,7 +8011,12 @@ Error RenderingDeviceVulkan::draw_list_switch_to_next_pass_split(uint32_t p_spli
 
 Error RenderingDeviceVulkan::_draw_list_allocate(const Rect2i &p_viewport, uint32_t p_splits, uint32_t p_subpass) {
 	// Lock while draw_list is active.
-	_THREAD_SAFE_LOCK_
+	// Split draw lists are recorded by worker threads, which may have to create resources on first use
+	// (pipelines, vertex arrays), so the lock is not kept for them. Anything that would record into the
+	// frame command buffers already refuses to run while a draw list is active.
+	if (p_splits == 0) {
+		_THREAD_SAFE_LOCK_
+	}
 
 	if (p_splits == 0) {
 		draw_list = memnew(DrawList);
@@ -7750,7 +8130,9 @@ void RenderingDeviceVulkan::_draw_list_free(Rect2i *r_last_viewport) {
 	}
 
 	// Draw_list is no longer active.
-	_THREAD_SAFE_UNLOCK_
+	if (!draw_list_split) {
+		_THREAD_SAFE_UNLOCK_
+	}
 }
 
 void RenderingDeviceVulkan::draw_list_end(BitField<BarrierMask> p_post_barrier) {
@@ -7873,6 +8255,11 @@ RenderingDevice::ComputeListID RenderingDeviceVulkan::compute_list_begin(bool p_
 	// Lock while compute_list is active.
 	_THREAD_SAFE_LOCK_
 
+	if (draw_list == nullptr) {
+		// Only the compute part of a deferred barrier is needed to start dispatching.
+		_flush_pending_compute_barrier(BARRIER_MASK_COMPUTE);
+	}
+
 	compute_list = memnew(ComputeList);
 	compute_list->command_buffer = frames[frame].draw_command_buffer;
 	compute_list->state.allow_draw_overlap = p_allow_draw_overlap;
@@ -8355,7 +8742,21 @@ void RenderingDeviceVulkan::compute_list_end(BitField<BarrierMask> p_post_barrie
 		barrier_flags |= VK_PIPELINE_STAGE_TRANSFER_BIT;
 		access_flags |= VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_TRANSFER_READ_BIT;
 	}
-	_compute_list_add_barrier(p_post_barrier, barrier_flags, access_flags);
+
+	bool transitions_images = false;
+	for (const Texture *E : compute_list->state.textures_to_sampled_layout) {
+		if (E->layout != VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) {
+			transitions_images = true;
+			break;
+		}
+	}
+
+	if (barrier_flags && !transitions_images && draw_list == nullptr) {
+		pending_compute_barrier = (int64_t)pending_compute_barrier | ((int64_t)p_post_barrier & (BARRIER_MASK_COMPUTE | BARRIER_MASK_VERTEX | BARRIER_MASK_FRAGMENT | BARRIER_MASK_TRANSFER));
+		_compute_list_add_barrier(p_post_barrier, 0, 0);
+	} else {
+		_compute_list_add_barrier(p_post_barrier, barrier_flags, access_flags);
+	}
 
 	memdelete(compute_list);
 	compute_list = nullptr;
@@ -8364,24 +8765,174 @@ void RenderingDeviceVulkan::compute_list_end(BitField<BarrierMask> p_post_barrie
 	_THREAD_SAFE_UNLOCK_
 }
 
-void RenderingDeviceVulkan::barrier(BitField<BarrierMask> p_from, BitField<BarrierMask> p_to) {
-	uint32_t src_barrier_flags = 0;
-	uint32_t src_access_flags = 0;
+VkCommandBuffer RenderingDeviceVulkan::_async_compute_begin_command_buffer() {
+	Frame &f = frames[frame];
+	if (f.async_compute_command_buffers_used == f.async_compute_command_buffers.size()) {
+		VkCommandBufferAllocateInfo cmdbuf;
+		cmdbuf.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+		cmdbuf.pNext = nullptr;
+		cmdbuf.commandPool = f.command_pool;
+		cmdbuf.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+		cmdbuf.commandBufferCount = 1;
 
-	if (p_from == 0) {
-		src_barrier_flags = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-	} else {
-		if (p_from.has_flag(BARRIER_MASK_COMPUTE)) {
-			src_barrier_flags |= VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
-			src_access_flags |= VK_ACCESS_SHADER_WRITE_BIT;
-		}
-		if (p_from.has_flag(BARRIER_MASK_FRAGMENT)) {
-			src_barrier_flags |= VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
-					VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT |
-					VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
-			src_access_flags |=
-					VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
-		}
+		VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+		VkResult err = vkAllocateCommandBuffers(device, &cmdbuf, &command_buffer);
+		ERR_FAIL_COND_V_MSG(err, VK_NULL_HANDLE, "vkAllocateCommandBuffers failed with error " + itos(err) + ".");
+		f.async_compute_command_buffers.push_back(command_buffer);
+	}
+
+	VkCommandBuffer command_buffer = f.async_compute_command_buffers[f.async_compute_command_buffers_used++];
+
+	VkCommandBufferBeginInfo cmdbuf_begin;
+	cmdbuf_begin.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	cmdbuf_begin.pNext = nullptr;
+	cmdbuf_begin.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+	cmdbuf_begin.pInheritanceInfo = nullptr;
+
+	VkResult err = vkBeginCommandBuffer(command_buffer, &cmdbuf_begin);
+	ERR_FAIL_COND_V_MSG(err, VK_NULL_HANDLE, "vkBeginCommandBuffer failed with error " + itos(err) + ".");
+
+	return command_buffer;
+}
+
+VkSemaphore RenderingDeviceVulkan::_async_compute_get_semaphore() {
+	Frame &f = frames[frame];
+	if (f.async_compute_semaphores_used == f.async_compute_semaphores.size()) {
+		VkSemaphoreCreateInfo semaphore_create_info;
+		semaphore_create_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+		semaphore_create_info.pNext = nullptr;
+		semaphore_create_info.flags = 0;
+
+		VkSemaphore semaphore = VK_NULL_HANDLE;
+		VkResult err = vkCreateSemaphore(device, &semaphore_create_info, nullptr, &semaphore);
+		ERR_FAIL_COND_V_MSG(err, VK_NULL_HANDLE, "vkCreateSemaphore failed with error " + itos(err) + ".");
+		f.async_compute_semaphores.push_back(semaphore);
+	}
+
+	return f.async_compute_semaphores[f.async_compute_semaphores_used++];
+}
+
+void RenderingDeviceVulkan::_async_compute_begin() {
+	async_compute_recording = true;
+	if (!async_compute_supported) {
+		return;
+	}
+
+	// Everything the batch and the commands after it need is reserved first. If any of it fails, the errors
+	// were printed and the batch is recorded in the graphics queue instead, like without async compute.
+	VkSemaphore wait_semaphore = _async_compute_get_semaphore();
+	VkSemaphore signal_semaphore = _async_compute_get_semaphore();
+	if (wait_semaphore == VK_NULL_HANDLE || signal_semaphore == VK_NULL_HANDLE) {
+		return;
+	}
+
+	VkCommandBuffer command_buffers[3] = {};
+	uint32_t command_buffer_count = async_compute_sync_command_buffer == VK_NULL_HANDLE ? 3 : 2;
+	for (uint32_t i = 0; i < command_buffer_count; i++) {
+		command_buffers[i] = _async_compute_begin_command_buffer();
+		if (command_buffers[i] == VK_NULL_HANDLE) {
+			for (uint32_t j = 0; j < i; j++) {
+				vkEndCommandBuffer(command_buffers[j]); // Never submitted, but must not be left recording.
+			}
+			return;
+		}
+	}
+	async_compute_resume_command_buffer = command_buffers[1];
+	if (command_buffer_count == 3) {
+		async_compute_sync_command_buffer = command_buffers[2];
+	}
+
+	// Everything recorded so far is submitted before the batch, which waits on it.
+	_flush_pending_compute_barrier();
+	vkEndCommandBuffer(frames[frame].draw_command_buffer);
+
+	context->append_async_compute_command_buffer(command_buffers[0], wait_semaphore, signal_semaphore);
+	async_compute_pending_semaphores.push_back(signal_semaphore);
+
+	frames[frame].draw_command_buffer = command_buffers[0];
+}
+
+void RenderingDeviceVulkan::_async_compute_end() {
+	async_compute_recording = false;
+	if (async_compute_resume_command_buffer == VK_NULL_HANDLE) {
+		return; // Not supported, or the batch was recorded in the graphics queue.
+	}
+
+	_flush_pending_compute_barrier();
+	vkEndCommandBuffer(frames[frame].draw_command_buffer);
+
+	// Draw commands recorded from now on run concurrently with the batch.
+	context->append_command_buffer(async_compute_resume_command_buffer);
+	frames[frame].draw_command_buffer = async_compute_resume_command_buffer;
+	async_compute_resume_command_buffer = VK_NULL_HANDLE;
+}
+
+void RenderingDeviceVulkan::_async_compute_sync() {
+	if (async_compute_pending_semaphores.is_empty()) {
+		return;
+	}
+
+	vkEndCommandBuffer(frames[frame].draw_command_buffer);
+
+	for (VkSemaphore semaphore : async_compute_pending_semaphores) {
+		context->append_async_compute_wait(semaphore);
+	}
+	async_compute_pending_semaphores.clear();
+
+	context->append_command_buffer(async_compute_sync_command_buffer);
+	frames[frame].draw_command_buffer = async_compute_sync_command_buffer;
+	async_compute_sync_command_buffer = VK_NULL_HANDLE;
+}
+
+void RenderingDeviceVulkan::async_compute_begin() {
+	_THREAD_SAFE_METHOD_
+
+	ERR_FAIL_COND_MSG(draw_list != nullptr, "Async compute can't begin while a draw list is active.");
+	ERR_FAIL_COND_MSG(compute_list != nullptr, "Async compute can't begin while a compute list is active.");
+	ERR_FAIL_COND_MSG(async_compute_recording, "An async compute batch is already being recorded, end it first with async_compute_end().");
+
+	_async_compute_begin();
+}
+
+void RenderingDeviceVulkan::async_compute_end() {
+	_THREAD_SAFE_METHOD_
+
+	ERR_FAIL_COND_MSG(compute_list != nullptr, "Async compute can't end while a compute list is active.");
+	ERR_FAIL_COND_MSG(!async_compute_recording, "No async compute batch is being recorded, begin one with async_compute_begin().");
+
+	_async_compute_end();
+}
+
+void RenderingDeviceVulkan::async_compute_sync() {
+	_THREAD_SAFE_METHOD_
+
+	ERR_FAIL_COND_MSG(draw_list != nullptr, "Async compute can't be synchronized while a draw list is active.");
+	ERR_FAIL_COND_MSG(compute_list != nullptr, "Async compute can't be synchronized while a compute list is active.");
+	ERR_FAIL_COND_MSG(async_compute_recording, "Async compute can't be synchronized while a batch is being recorded.");
+
+	_async_compute_sync();
+}
+
+void RenderingDeviceVulkan::barrier(BitField<BarrierMask> p_from, BitField<BarrierMask> p_to) {
+	_flush_pending_compute_barrier();
+
+	uint32_t src_barrier_flags = 0;
+	uint32_t src_access_flags = 0;
+
+	if (p_from == 0) {
+		src_barrier_flags = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+	} else {
+		if (p_from.has_flag(BARRIER_MASK_COMPUTE)) {
+			src_barrier_flags |= VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+			src_access_flags |= VK_ACCESS_SHADER_WRITE_BIT;
+		}
+		if (p_from.has_flag(BARRIER_MASK_FRAGMENT)) {
+			src_barrier_flags |= VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
+					VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT |
+					VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+			src_access_flags |=
+					VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+		}
 		if (p_from.has_flag(BARRIER_MASK_TRANSFER)) {
 			src_barrier_flags |= VK_PIPELINE_STAGE_TRANSFER_BIT;
 			src_access_flags |= VK_ACCESS_TRANSFER_WRITE_BIT;
@@ -8487,6 +9038,9 @@ void RenderingDeviceVulkan::_free_internal(RID p_id) {
 	}
 #endif
 
+	// Queued uploads may point to the buffer being freed.
+	_flush_pending_buffer_uploads();
+
 	// Push everything so it's disposed of next time this frame index is processed (means, it's safe to do it).
 	if (texture_owner.owns(p_id)) {
 		Texture *texture = texture_owner.get_or_null(p_id);
@@ -8507,12 +9061,16 @@ void RenderingDeviceVulkan::_free_internal(RID p_id) {
 		sampler_owner.free(p_id);
 	} else if (vertex_buffer_owner.owns(p_id)) {
 		Buffer *vertex_buffer = vertex_buffer_owner.get_or_null(p_id);
+		mesh_memory -= vertex_buffer->size;
+		defragmentation.movable_buffers.erase(vertex_buffer->allocation);
 		frames[frame].buffers_to_dispose_of.push_back(*vertex_buffer);
 		vertex_buffer_owner.free(p_id);
 	} else if (vertex_array_owner.owns(p_id)) {
 		vertex_array_owner.free(p_id);
 	} else if (index_buffer_owner.owns(p_id)) {
 		IndexBuffer *index_buffer = index_buffer_owner.get_or_null(p_id);
+		mesh_memory -= index_buffer->size;
+		defragmentation.movable_buffers.erase(index_buffer->allocation);
 		Buffer b;
 		b.allocation = index_buffer->allocation;
 		b.buffer = index_buffer->buffer;
@@ -8526,6 +9084,7 @@ void RenderingDeviceVulkan::_free_internal(RID p_id) {
 		Shader *shader = shader_owner.get_or_null(p_id);
 		frames[frame].shaders_to_dispose_of.push_back(*shader);
 		shader_owner.free(p_id);
+		pipeline_bundle.shader_indices.erase(p_id);
 	} else if (uniform_buffer_owner.owns(p_id)) {
 		Buffer *uniform_buffer = uniform_buffer_owner.get_or_null(p_id);
 		frames[frame].buffers_to_dispose_of.push_back(*uniform_buffer);
@@ -8673,18 +9232,41 @@ void RenderingDeviceVulkan::_finalize_command_bufers() {
 		ERR_PRINT("Found open compute list at the end of the frame, this should never happen (further compute will likely not work).");
 	}
 
+	_flush_pending_compute_barrier();
+
+	if (async_compute_recording) {
+		ERR_PRINT("Found open async compute batch at the end of the frame, this should never happen.");
+		_async_compute_end();
+	}
+	// The frame fence is only signaled by the graphics queue, so it must wait on every async batch.
+	_async_compute_sync();
+
 	{ // Complete the setup buffer (that needs to be processed before anything else).
 		vkEndCommandBuffer(frames[frame].setup_command_buffer);
 		vkEndCommandBuffer(frames[frame].draw_command_buffer);
 	}
+
+	_release_late_latches();
 }
 
 void RenderingDeviceVulkan::_begin_frame() {
+	if (defragmentation.pass_active && defragmentation.pass_frame == frame) {
+		// Must end before freeing, buffers being moved are still referenced by VMA until then.
+		_defragmentation_end_pass();
+	}
+
 	// Erase pending resources.
 	_free_pending_resources(frame);
 
+	// Hand out buffers read back during this frame's previous use.
+	_process_buffer_downloads(frame);
+
 	// Create setup command buffer and set as the setup buffer.
 
+	frames[frame].draw_command_buffer = frames[frame].first_draw_command_buffer;
+	frames[frame].async_compute_command_buffers_used = 0;
+	frames[frame].async_compute_semaphores_used = 0;
+
 	{
 		VkCommandBufferBeginInfo cmdbuf_begin;
 		cmdbuf_begin.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
@@ -8724,6 +9306,13 @@ void RenderingDeviceVulkan::_begin_frame() {
 	frames[frame].timestamp_result_count = frames[frame].timestamp_count;
 	frames[frame].timestamp_count = 0;
 	frames[frame].index = Engine::get_singleton()->get_frames_drawn();
+
+	// Also refreshes the memory budget.
+	vmaSetCurrentFrameIndex(allocator, frames_drawn);
+
+	if (defragmentation.enabled && !defragmentation.pass_active && frames_drawn >= defragmentation.restart_frame) {
+		_defragmentation_begin_pass();
+	}
 }
 
 VkSampleCountFlagBits RenderingDeviceVulkan::_ensure_supported_sample_count(TextureSamples p_requested_sample_count) const {
@@ -8750,6 +9339,7 @@ void RenderingDeviceVulkan::swap_buffers() {
 	_THREAD_SAFE_METHOD_
 
 	_finalize_command_bufers();
+	_pipeline_bundle_finish_precompile(false);
 
 	screen_prepared = false;
 	// Swap buffers.
@@ -8808,6 +9398,246 @@ VmaPool RenderingDeviceVulkan::_find_or_create_small_allocs_pool(uint32_t p_mem_
 	return pool;
 }
 
+VmaPool RenderingDeviceVulkan::_find_or_create_movable_buffer_pool(uint32_t p_mem_type_index) {
+	if (movable_buffer_pools.has(p_mem_type_index)) {
+		return movable_buffer_pools[p_mem_type_index];
+	}
+
+	print_verbose("Creating VMA movable buffers pool for memory type index " + itos(p_mem_type_index));
+
+	VmaPoolCreateInfo pci;
+	pci.memoryTypeIndex = p_mem_type_index;
+	pci.flags = 0;
+	pci.blockSize = 0;
+	pci.minBlockCount = 0;
+	pci.maxBlockCount = SIZE_MAX;
+	pci.priority = 0.5f;
+	pci.minAllocationAlignment = 0;
+	pci.pMemoryAllocateNext = nullptr;
+	VmaPool pool = VK_NULL_HANDLE;
+	VkResult res = vmaCreatePool(allocator, &pci, &pool);
+	movable_buffer_pools[p_mem_type_index] = pool; // Don't try to create it again if failed the first time.
+	ERR_FAIL_COND_V_MSG(res, pool, "vmaCreatePool failed with error " + itos(res) + ".");
+
+	return pool;
+}
+
+RenderingDeviceVulkan::Buffer *RenderingDeviceVulkan::_get_movable_buffer(VmaAllocation p_allocation, RID &r_id) {
+	RID *id = defragmentation.movable_buffers.getptr(p_allocation);
+	if (!id) {
+		return nullptr;
+	}
+
+	Buffer *buffer = vertex_buffer_owner.get_or_null(*id);
+	if (!buffer) {
+		buffer = index_buffer_owner.get_or_null(*id);
+	}
+	if (!buffer) {
+		return nullptr;
+	}
+
+	// Only vertex and index arrays can be patched to point to the new buffer.
+	HashMap<RID, HashSet<RID>>::Iterator E = dependency_map.find(*id);
+	if (E) {
+		for (const RID &dependent : E->value) {
+			if (!vertex_array_owner.owns(dependent) && !index_array_owner.owns(dependent)) {
+				return nullptr;
+			}
+		}
+	}
+
+	r_id = *id;
+	return buffer;
+}
+
+void RenderingDeviceVulkan::_defragmentation_begin_pass() {
+	if (!defragmentation.context) {
+		if (movable_buffer_pools.is_empty()) {
+			return;
+		}
+
+		// One pool at a time, each one needs its own context.
+		VmaPool pool = VK_NULL_HANDLE;
+		uint32_t pool_index = 0;
+		for (const KeyValue<uint32_t, VmaPool> &E : movable_buffer_pools) {
+			if (pool_index++ == defragmentation.pool_index) {
+				pool = E.value;
+				break;
+			}
+		}
+		if (pool == VK_NULL_HANDLE) {
+			_defragmentation_finish();
+			return;
+		}
+
+		VmaDefragmentationInfo defrag_info = {};
+		defrag_info.pool = pool;
+		defrag_info.maxBytesPerPass = DEFRAGMENTATION_MAX_BYTES_PER_PASS;
+		VkResult err = vmaBeginDefragmentation(allocator, &defrag_info, &defragmentation.context);
+		if (err) {
+			defragmentation.enabled = false;
+			defragmentation.context = nullptr;
+			ERR_FAIL_MSG("vmaBeginDefragmentation failed with error " + itos(err) + ", disabling defragmentation.");
+		}
+	}
+
+	VkResult res = vmaBeginDefragmentationPass(allocator, defragmentation.context, &defragmentation.pass);
+	if (res != VK_INCOMPLETE) {
+		// Either nothing is left to move, or the pass failed.
+		_defragmentation_finish();
+		ERR_FAIL_COND_MSG(res != VK_SUCCESS, "vmaBeginDefragmentationPass failed with error " + itos(res) + ".");
+		return;
+	}
+
+	bool copied = false;
+	for (uint32_t i = 0; i < defragmentation.pass.moveCount; i++) {
+		VmaDefragmentationMove &move = defragmentation.pass.pMoves[i];
+		defragmentation.moving.insert(move.srcAllocation);
+
+		RID id;
+		Buffer *buffer = _get_movable_buffer(move.srcAllocation, id);
+		if (!buffer) {
+			move.operation = VMA_DEFRAGMENTATION_MOVE_OPERATION_IGNORE;
+			continue;
+		}
+
+		VkBufferCreateInfo buffer_info;
+		buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+		buffer_info.pNext = nullptr;
+		buffer_info.flags = 0;
+		buffer_info.size = buffer->size;
+		buffer_info.usage = buffer->usage;
+		buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		buffer_info.queueFamilyIndexCount = 0;
+		buffer_info.pQueueFamilyIndices = nullptr;
+
+		VkBuffer new_buffer = VK_NULL_HANDLE;
+		VkResult err = vkCreateBuffer(device, &buffer_info, nullptr, &new_buffer);
+		if (err) {
+			ERR_PRINT("vkCreateBuffer failed with error " + itos(err) + ".");
+			move.operation = VMA_DEFRAGMENTATION_MOVE_OPERATION_IGNORE;
+			continue;
+		}
+		err = vmaBindBufferMemory(allocator, move.dstTmpAllocation, new_buffer);
+		if (err) {
+			ERR_PRINT("vmaBindBufferMemory failed with error " + itos(err) + ".");
+			vkDestroyBuffer(device, new_buffer, nullptr);
+			move.operation = VMA_DEFRAGMENTATION_MOVE_OPERATION_IGNORE;
+			continue;
+		}
+
+		if (!copied) {
+			// Wait for everything previous frames wrote to the buffers.
+			_memory_barrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT, false);
+			copied = true;
+		}
+
+		VkBufferCopy region;
+		region.srcOffset = 0;
+		region.dstOffset = 0;
+		region.size = buffer->size;
+		vkCmdCopyBuffer(frames[frame].setup_command_buffer, buffer->buffer, new_buffer, 1, &region);
+
+		HashMap<RID, HashSet<RID>>::Iterator E = dependency_map.find(id);
+		if (E) {
+			for (const RID &dependent : E->value) {
+				VertexArray *vertex_array = vertex_array_owner.get_or_null(dependent);
+				if (vertex_array) {
+					for (int j = 0; j < vertex_array->buffers.size(); j++) {
+						if (vertex_array->buffers[j] == buffer->buffer) {
+							vertex_array->buffers.write[j] = new_buffer;
+						}
+					}
+				} else {
+					IndexArray *index_array = index_array_owner.get_or_null(dependent);
+					if (index_array && index_array->buffer == buffer->buffer) {
+						index_array->buffer = new_buffer;
+					}
+				}
+			}
+		}
+
+		// The old buffer stays alive (and its memory untouched) until the frames using it are done.
+		defragmentation.old_buffers.push_back(buffer->buffer);
+		buffer->buffer = new_buffer;
+		buffer->buffer_info.buffer = new_buffer;
+	}
+
+	if (copied) {
+		_memory_barrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT | VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT, false);
+	}
+
+	defragmentation.pass_active = true;
+	defragmentation.pass_frame = frame;
+}
+
+void RenderingDeviceVulkan::_defragmentation_end_pass() {
+	for (VkBuffer buffer : defragmentation.old_buffers) {
+		vkDestroyBuffer(device, buffer, nullptr);
+	}
+	defragmentation.old_buffers.clear();
+
+	// Moved allocations now point to the new memory, the old one is released.
+	VkResult res = vmaEndDefragmentationPass(allocator, defragmentation.context, &defragmentation.pass);
+	defragmentation.pass_active = false;
+	defragmentation.moving.clear();
+
+	for (const Pair<VkBuffer, VmaAllocation> &E : defragmentation.deferred_frees) {
+		vmaDestroyBuffer(allocator, E.first, E.second);
+	}
+	defragmentation.deferred_frees.clear();
+
+	if (res != VK_INCOMPLETE) {
+		_defragmentation_finish();
+	}
+}
+
+void RenderingDeviceVulkan::_defragmentation_finish() {
+	if (defragmentation.context) {
+		vmaEndDefragmentation(allocator, defragmentation.context, nullptr);
+		defragmentation.context = nullptr;
+	}
+
+	defragmentation.pool_index++;
+	if (defragmentation.pool_index >= (uint32_t)movable_buffer_pools.size()) {
+		// Every pool is done, fragmentation takes a while to build up again.
+		defragmentation.pool_index = 0;
+		defragmentation.restart_frame = frames_drawn + DEFRAGMENTATION_RESTART_FRAMES;
+	}
+}
+
+void RenderingDeviceVulkan::_process_buffer_downloads(int p_frame) {
+	while (frames[p_frame].buffer_downloads.front()) {
+		Frame::BufferDownload *download = &frames[p_frame].buffer_downloads.front()->get();
+
+		Vector<uint8_t> buffer_data;
+		void *buffer_mem;
+		VkResult vkerr = vmaMapMemory(allocator, download->buffer.allocation, &buffer_mem);
+		if (vkerr) {
+			ERR_PRINT("vmaMapMemory failed with error " + itos(vkerr) + ".");
+		} else {
+			buffer_data.resize(download->buffer.size);
+			memcpy(buffer_data.ptrw(), buffer_mem, download->buffer.size);
+			vmaUnmapMemory(allocator, download->buffer.allocation);
+		}
+
+		_buffer_free(&download->buffer);
+		Callable callback = download->callback;
+		frames[p_frame].buffer_downloads.pop_front();
+
+		if (!buffer_data.is_empty()) {
+			Variant data = buffer_data;
+			const Variant *args[1] = { &data };
+			Variant ret;
+			Callable::CallError ce;
+			callback.callp(args, 1, ret, ce);
+			if (ce.error != Callable::CallError::CALL_OK) {
+				ERR_PRINT("Error calling buffer download callback: " + Variant::get_callable_error_text(callback, args, 1, ce) + ".");
+			}
+		}
+	}
+}
+
 void RenderingDeviceVulkan::_free_pending_resources(int p_frame) {
 	// Free in dependency usage order, so nothing weird happens.
 	// Pipelines.
@@ -8847,7 +9677,8 @@ void RenderingDeviceVulkan::_free_pending_resources(int p_frame) {
 	}
 
 	// Shaders.
-	while (frames[p_frame].shaders_to_dispose_of.front()) {
+	// Pipelines being created outside of the lock may still use them, so retry the next time this frame is flushed.
+	while (unlocked_pipeline_creations.get() == 0 && frames[p_frame].shaders_to_dispose_of.front()) {
 		Shader *shader = &frames[p_frame].shaders_to_dispose_of.front()->get();
 
 		// Descriptor set layout for each set.
@@ -8899,6 +9730,9 @@ void RenderingDeviceVulkan::_free_pending_resources(int p_frame) {
 		if (texture->owner.is_null()) {
 			// Actually owns the image and the allocation too.
 			image_memory -= texture->allocation_info.size;
+			if (texture->usage_flags & (TEXTURE_USAGE_COLOR_ATTACHMENT_BIT | TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT)) {
+				render_target_memory -= texture->allocation_info.size;
+			}
 			vmaDestroyImage(allocator, texture->image, texture->allocation);
 		}
 		frames[p_frame].textures_to_dispose_of.pop_front();
@@ -8927,6 +9761,25 @@ uint64_t RenderingDeviceVulkan::get_memory_usage(MemoryType p_type) const {
 		return buffer_memory;
 	} else if (p_type == MEMORY_TEXTURES) {
 		return image_memory;
+	} else if (p_type == MEMORY_RENDER_TARGETS) {
+		return render_target_memory;
+	} else if (p_type == MEMORY_MESHES) {
+		return mesh_memory;
+	} else if (p_type == MEMORY_STAGING) {
+		return (uint64_t)staging_buffer_blocks.size() * staging_buffer_block_size;
+	} else if (p_type == MEMORY_DEVICE_LOCAL) {
+		const VkPhysicalDeviceMemoryProperties *memory_properties = nullptr;
+		vmaGetMemoryProperties(allocator, &memory_properties);
+		VmaBudget budgets[VK_MAX_MEMORY_HEAPS];
+		vmaGetHeapBudgets(allocator, budgets);
+
+		uint64_t usage = 0;
+		for (uint32_t i = 0; i < memory_properties->memoryHeapCount; i++) {
+			if (memory_properties->memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) {
+				usage += budgets[i].usage;
+			}
+		}
+		return usage;
 	} else {
 		VmaTotalStatistics stats;
 		vmaCalculateStatistics(allocator, &stats);
@@ -8934,14 +9787,39 @@ uint64_t RenderingDeviceVulkan::get_memory_usage(MemoryType p_type) const {
 	}
 }
 
+uint64_t RenderingDeviceVulkan::get_memory_budget() const {
+	// Without VK_EXT_memory_budget, VMA estimates the budget from the heap sizes.
+	const VkPhysicalDeviceMemoryProperties *memory_properties = nullptr;
+	vmaGetMemoryProperties(allocator, &memory_properties);
+	VmaBudget budgets[VK_MAX_MEMORY_HEAPS];
+	vmaGetHeapBudgets(allocator, budgets);
+
+	uint64_t budget = 0;
+	for (uint32_t i = 0; i < memory_properties->memoryHeapCount; i++) {
+		if (memory_properties->memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) {
+			budget += budgets[i].budget;
+		}
+	}
+	return budget;
+}
+
 void RenderingDeviceVulkan::_flush(bool p_current_frame) {
 	if (local_device.is_valid() && !p_current_frame) {
 		return; // Flushing previous frames has no effect with local device.
 	}
+	// An open async compute batch is submitted and waited on with the rest, then resumed.
+	bool resume_async_compute = p_current_frame && async_compute_recording;
+	if (resume_async_compute) {
+		_async_compute_end();
+	}
+
 	// Not doing this crashes RADV (undefined behavior).
 	if (p_current_frame) {
+		_flush_pending_compute_barrier();
+		_async_compute_sync();
 		vkEndCommandBuffer(frames[frame].setup_command_buffer);
 		vkEndCommandBuffer(frames[frame].draw_command_buffer);
+		_release_late_latches();
 	}
 
 	if (local_device.is_valid()) {
@@ -8987,6 +9865,10 @@ void RenderingDeviceVulkan::_flush(bool p_current_frame) {
 			context->append_command_buffer(frames[frame].draw_command_buffer);
 		}
 	}
+
+	if (resume_async_compute) {
+		_async_compute_begin();
+	}
 }
 
 void RenderingDeviceVulkan::initialize(VulkanContext *p_context, bool p_local_device) {
@@ -9015,9 +9897,15 @@ void RenderingDeviceVulkan::initialize(VulkanContext *p_context, bool p_local_de
 		allocatorInfo.physicalDevice = p_context->get_physical_device();
 		allocatorInfo.device = device;
 		allocatorInfo.instance = p_context->get_instance();
+		if (p_context->is_device_extension_enabled(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME) && p_context->is_instance_extension_enabled(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME)) {
+			allocatorInfo.flags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
+		}
 		vmaCreateAllocator(&allocatorInfo, &allocator);
 	}
 
+	// Buffers only become movable when allocated in their own pools, so this can't change at runtime.
+	defragmentation.enabled = !p_local_device && GLOBAL_GET("rendering/rendering_device/vulkan/defragment_mesh_buffers");
+
 	frames.resize(frame_count);
 	frame = 0;
 	// Create setup and frame buffers.
@@ -9050,6 +9938,7 @@ void RenderingDeviceVulkan::initialize(VulkanContext *p_context, bool p_local_de
 
 			err = vkAllocateCommandBuffers(device, &cmdbuf, &frames[i].draw_command_buffer);
 			ERR_CONTINUE_MSG(err, "vkAllocateCommandBuffers failed with error " + itos(err) + ".");
+			frames[i].first_draw_command_buffer = frames[i].draw_command_buffer;
 		}
 
 		{
@@ -9126,6 +10015,8 @@ void RenderingDeviceVulkan::initialize(VulkanContext *p_context, bool p_local_de
 	}
 
 	max_descriptors_per_pool = GLOBAL_GET("rendering/rendering_device/vulkan/max_descriptors_per_pool");
+	async_compute_supported = !p_local_device && p_context->has_separate_compute_queue();
+	pipeline_bundle.recording = !p_local_device && GLOBAL_GET("rendering/rendering_device/pipeline_cache/record_bundle");
 
 	// Check to make sure DescriptorPoolKey is good.
 	static_assert(sizeof(uint64_t) * 3 >= UNIFORM_TYPE_MAX * sizeof(uint16_t));
@@ -9274,6 +10165,443 @@ void RenderingDeviceVulkan::_save_pipeline_cache(void *p_data) {
 	}
 }
 
+// Pipeline bundles are little-endian streams of 32-bit words; floats are stored by their bits.
+
+#define PIPELINE_BUNDLE_MAGIC "GPBD"
+#define PIPELINE_BUNDLE_VERSION 1
+
+class PipelineBundleWriter {
+	LocalVector<uint32_t> words;
+
+public:
+	void put(uint32_t p_value) { words.push_back(p_value); }
+	void put_float(float p_value) {
+		MarshallFloat mf;
+		mf.f = p_value;
+		words.push_back(mf.i);
+	}
+
+	Vector<uint8_t> get_blob() const {
+		Vector<uint8_t> blob;
+		blob.resize(words.size() * sizeof(uint32_t));
+		uint8_t *w = blob.ptrw();
+		for (uint32_t i = 0; i < words.size(); i++) {
+			encode_uint32(words[i], w + i * sizeof(uint32_t));
+		}
+		return blob;
+	}
+};
+
+class PipelineBundleReader {
+	const uint8_t *data = nullptr;
+	uint32_t size = 0;
+	uint32_t offset = 0;
+	bool valid = true;
+
+public:
+	uint32_t get() {
+		if (offset + sizeof(uint32_t) > size) {
+			valid = false;
+			return 0;
+		}
+		uint32_t value = decode_uint32(data + offset);
+		offset += sizeof(uint32_t);
+		return value;
+	}
+	uint32_t get_enum(uint32_t p_max) {
+		uint32_t value = get();
+		if (value >= p_max) {
+			valid = false;
+			return 0;
+		}
+		return value;
+	}
+	float get_float() {
+		MarshallFloat mf;
+		mf.i = get();
+		return mf.f;
+	}
+	// Element counts are bounded by the remaining data, so corrupt bundles can't trigger huge allocations.
+	uint32_t get_count(uint32_t p_words_per_element) {
+		uint32_t count = get();
+		if (uint64_t(count) * p_words_per_element * sizeof(uint32_t) > size - offset) {
+			valid = false;
+			return 0;
+		}
+		return count;
+	}
+	bool is_valid() const { return valid && offset == size; }
+
+	PipelineBundleReader(const Vector<uint8_t> &p_blob) {
+		data = p_blob.ptr();
+		size = p_blob.size();
+	}
+};
+
+void RenderingDeviceVulkan::_pipeline_bundle_record(RID p_shader, FramebufferFormatID p_framebuffer_format, VertexFormatID p_vertex_format, RenderPrimitive p_render_primitive, const PipelineRasterizationState &p_rasterization_state, const PipelineMultisampleState &p_multisample_state, const PipelineDepthStencilState &p_depth_stencil_state, const PipelineColorBlendState &p_blend_state, BitField<PipelineDynamicStateFlags> p_dynamic_state_flags, uint32_t p_for_render_pass, const Vector<PipelineSpecializationConstant> &p_specialization_constants) {
+	HashMap<RID, uint32_t>::Iterator shader_index = pipeline_bundle.shader_indices.find(p_shader);
+	if (!shader_index) {
+		return; // Shader was not created from a binary (or was created before recording started).
+	}
+
+	PipelineBundleWriter w;
+	w.put(shader_index->value);
+
+	const FramebufferFormatKey &fb_key = framebuffer_formats[p_framebuffer_format].E->key();
+	w.put(fb_key.view_count);
+	w.put(fb_key.attachments.size());
+	for (const AttachmentFormat &attachment : fb_key.attachments) {
+		w.put(attachment.format);
+		w.put(attachment.samples);
+		w.put(attachment.usage_flags);
+	}
+	w.put(fb_key.passes.size());
+	for (const FramebufferPass &pass : fb_key.passes) {
+		const Vector<int32_t> *lists[4] = { &pass.color_attachments, &pass.input_attachments, &pass.resolve_attachments, &pass.preserve_attachments };
+		for (const Vector<int32_t> *list : lists) {
+			w.put(list->size());
+			for (int32_t attachment : *list) {
+				w.put(attachment);
+			}
+		}
+		w.put(pass.depth_attachment);
+		w.put(pass.vrs_attachment);
+	}
+
+	if (p_vertex_format == INVALID_ID) {
+		w.put(0);
+	} else {
+		const Vector<VertexAttribute> &attributes = vertex_formats[p_vertex_format].vertex_formats;
+		w.put(1);
+		w.put(attributes.size());
+		for (const VertexAttribute &attribute : attributes) {
+			w.put(attribute.location);
+			w.put(attribute.offset);
+			w.put(attribute.format);
+			w.put(attribute.stride);
+			w.put(attribute.frequency);
+		}
+	}
+
+	w.put(p_render_primitive);
+
+	w.put(p_rasterization_state.enable_depth_clamp);
+	w.put(p_rasterization_state.discard_primitives);
+	w.put(p_rasterization_state.wireframe);
+	w.put(p_rasterization_state.cull_mode);
+	w.put(p_rasterization_state.front_face);
+	w.put(p_rasterization_state.depth_bias_enabled);
+	w.put_float(p_rasterization_state.depth_bias_constant_factor);
+	w.put_float(p_rasterization_state.depth_bias_clamp);
+	w.put_float(p_rasterization_state.depth_bias_slope_factor);
+	w.put_float(p_rasterization_state.line_width);
+	w.put(p_rasterization_state.patch_control_points);
+
+	w.put(p_multisample_state.sample_count);
+	w.put(p_multisample_state.enable_sample_shading);
+	w.put_float(p_multisample_state.min_sample_shading);
+	w.put(p_multisample_state.sample_mask.size());
+	for (uint32_t mask : p_multisample_state.sample_mask) {
+		w.put(mask);
+	}
+	w.put(p_multisample_state.enable_alpha_to_coverage);
+	w.put(p_multisample_state.enable_alpha_to_one);
+
+	w.put(p_depth_stencil_state.enable_depth_test);
+	w.put(p_depth_stencil_state.enable_depth_write);
+	w.put(p_depth_stencil_state.depth_compare_operator);
+	w.put(p_depth_stencil_state.enable_depth_range);
+	w.put_float(p_depth_stencil_state.depth_range_min);
+	w.put_float(p_depth_stencil_state.depth_range_max);
+	w.put(p_depth_stencil_state.enable_stencil);
+	const PipelineDepthStencilState::StencilOperationState *stencil_ops[2] = { &p_depth_stencil_state.front_op, &p_depth_stencil_state.back_op };
+	for (const PipelineDepthStencilState::StencilOperationState *op : stencil_ops) {
+		w.put(op->fail);
+		w.put(op->pass);
+		w.put(op->depth_fail);
+		w.put(op->compare);
+		w.put(op->compare_mask);
+		w.put(op->write_mask);
+		w.put(op->reference);
+	}
+
+	w.put(p_blend_state.enable_logic_op);
+	w.put(p_blend_state.logic_op);
+	w.put(p_blend_state.attachments.size());
+	for (const PipelineColorBlendState::Attachment &attachment : p_blend_state.attachments) {
+		w.put(attachment.enable_blend);
+		w.put(attachment.src_color_blend_factor);
+		w.put(attachment.dst_color_blend_factor);
+		w.put(attachment.color_blend_op);
+		w.put(attachment.src_alpha_blend_factor);
+		w.put(attachment.dst_alpha_blend_factor);
+		w.put(attachment.alpha_blend_op);
+		w.put(attachment.write_r);
+		w.put(attachment.write_g);
+		w.put(attachment.write_b);
+		w.put(attachment.write_a);
+	}
+	for (int i = 0; i < 4; i++) {
+		w.put_float(p_blend_state.blend_constant.components[i]);
+	}
+
+	w.put((int64_t)p_dynamic_state_flags);
+	w.put(p_for_render_pass);
+
+	w.put(p_specialization_constants.size());
+	for (const PipelineSpecializationConstant &sc : p_specialization_constants) {
+		w.put(sc.type);
+		w.put(sc.constant_id);
+		w.put(sc.int_value);
+	}
+
+	pipeline_bundle.pipelines.insert(w.get_blob());
+}
+
+Error RenderingDeviceVulkan::pipeline_bundle_save(const String &p_path) {
+	_THREAD_SAFE_METHOD_
+
+	ERR_FAIL_COND_V_MSG(!pipeline_bundle.recording, ERR_UNCONFIGURED, "Pipelines are not being recorded. Enable the 'rendering/rendering_device/pipeline_cache/record_bundle' project setting first.");
+
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(f.is_null(), err, "Can't open pipeline bundle for writing at: " + p_path);
+
+	f->store_buffer((const uint8_t *)PIPELINE_BUNDLE_MAGIC, 4);
+	f->store_32(PIPELINE_BUNDLE_VERSION);
+	f->store_pascal_string(shader_get_binary_cache_key());
+
+	f->store_32(pipeline_bundle.shaders.size());
+	for (const KeyValue<Vector<uint8_t>, uint32_t> &E : pipeline_bundle.shaders) {
+		f->store_32(E.key.size());
+		f->store_buffer(E.key.ptr(), E.key.size());
+	}
+
+	f->store_32(pipeline_bundle.pipelines.size());
+	for (const Vector<uint8_t> &pipeline : pipeline_bundle.pipelines) {
+		f->store_32(pipeline.size());
+		f->store_buffer(pipeline.ptr(), pipeline.size());
+	}
+
+	print_verbose(vformat("Saved pipeline bundle with %d shaders and %d pipelines to: %s", pipeline_bundle.shaders.size(), pipeline_bundle.pipelines.size(), p_path));
+	return OK;
+}
+
+Error RenderingDeviceVulkan::pipeline_bundle_precompile(const String &p_path) {
+	_THREAD_SAFE_METHOD_
+
+	ERR_FAIL_COND_V_MSG(pipeline_precompile.group_task != -1, ERR_BUSY, "A pipeline bundle is already being precompiled.");
+
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
+	ERR_FAIL_COND_V_MSG(f.is_null(), err, "Can't open pipeline bundle at: " + p_path);
+
+	uint8_t magic[4] = {};
+	f->get_buffer(magic, 4);
+	uint32_t version = f->get_32();
+	ERR_FAIL_COND_V_MSG(memcmp(magic, PIPELINE_BUNDLE_MAGIC, 4) != 0 || version != PIPELINE_BUNDLE_VERSION, ERR_FILE_UNRECOGNIZED, "Invalid pipeline bundle: " + p_path);
+	if (f->get_pascal_string() != shader_get_binary_cache_key()) {
+		// Shader binaries from another engine or driver build can't be used; not an error, just nothing to do.
+		print_verbose("Pipeline bundle was recorded with a different shader binary format, skipping: " + p_path);
+		return ERR_FILE_UNRECOGNIZED;
+	}
+
+	uint32_t shader_count = f->get_32();
+	for (uint32_t i = 0; i < shader_count && !f->eof_reached(); i++) {
+		Vector<uint8_t> binary;
+		binary.resize(f->get_32());
+		if (f->get_buffer(binary.ptrw(), binary.size()) != uint64_t(binary.size())) {
+			break;
+		}
+		// May be invalid; pipelines using it are skipped then.
+		pipeline_precompile.shaders.push_back(shader_create_from_bytecode(binary));
+	}
+
+	uint32_t pipeline_count = f->get_32();
+	for (uint32_t i = 0; i < pipeline_count && !f->eof_reached(); i++) {
+		Vector<uint8_t> blob;
+		blob.resize(f->get_32());
+		if (f->get_buffer(blob.ptrw(), blob.size()) != uint64_t(blob.size())) {
+			break;
+		}
+
+		PipelineBundleReader r(blob);
+		PipelineBundleEntry entry;
+		entry.shader = r.get();
+
+		uint32_t view_count = r.get();
+		Vector<AttachmentFormat> attachments;
+		attachments.resize(r.get_count(3));
+		for (AttachmentFormat &attachment : attachments) {
+			attachment.format = DataFormat(r.get_enum(DATA_FORMAT_MAX));
+			attachment.samples = TextureSamples(r.get_enum(TEXTURE_SAMPLES_MAX));
+			attachment.usage_flags = r.get();
+		}
+		Vector<FramebufferPass> passes;
+		passes.resize(r.get_count(6));
+		for (FramebufferPass &pass : passes) {
+			Vector<int32_t> *lists[4] = { &pass.color_attachments, &pass.input_attachments, &pass.resolve_attachments, &pass.preserve_attachments };
+			for (Vector<int32_t> *list : lists) {
+				list->resize(r.get_count(1));
+				for (int32_t &attachment : *list) {
+					attachment = r.get();
+				}
+			}
+			pass.depth_attachment = r.get();
+			pass.vrs_attachment = r.get();
+		}
+
+		bool has_vertex_format = r.get() != 0;
+		Vector<VertexAttribute> vertex_attributes;
+		if (has_vertex_format) {
+			vertex_attributes.resize(r.get_count(5));
+			for (VertexAttribute &attribute : vertex_attributes) {
+				attribute.location = r.get();
+				attribute.offset = r.get();
+				attribute.format = DataFormat(r.get_enum(DATA_FORMAT_MAX));
+				attribute.stride = r.get();
+				attribute.frequency = VertexFrequency(r.get_enum(VERTEX_FREQUENCY_INSTANCE + 1));
+			}
+		}
+
+		entry.render_primitive = RenderPrimitive(r.get_enum(RENDER_PRIMITIVE_MAX));
+
+		entry.rasterization_state.enable_depth_clamp = r.get();
+		entry.rasterization_state.discard_primitives = r.get();
+		entry.rasterization_state.wireframe = r.get();
+		entry.rasterization_state.cull_mode = PolygonCullMode(r.get_enum(POLYGON_CULL_BACK + 1));
+		entry.rasterization_state.front_face = PolygonFrontFace(r.get_enum(POLYGON_FRONT_FACE_COUNTER_CLOCKWISE + 1));
+		entry.rasterization_state.depth_bias_enabled = r.get();
+		entry.rasterization_state.depth_bias_constant_factor = r.get_float();
+		entry.rasterization_state.depth_bias_clamp = r.get_float();
+		entry.rasterization_state.depth_bias_slope_factor = r.get_float();
+		entry.rasterization_state.line_width = r.get_float();
+		entry.rasterization_state.patch_control_points = r.get();
+
+		entry.multisample_state.sample_count = TextureSamples(r.get_enum(TEXTURE_SAMPLES_MAX));
+		entry.multisample_state.enable_sample_shading = r.get();
+		entry.multisample_state.min_sample_shading = r.get_float();
+		entry.multisample_state.sample_mask.resize(r.get_count(1));
+		for (uint32_t &mask : entry.multisample_state.sample_mask) {
+			mask = r.get();
+		}
+		entry.multisample_state.enable_alpha_to_coverage = r.get();
+		entry.multisample_state.enable_alpha_to_one = r.get();
+
+		entry.depth_stencil_state.enable_depth_test = r.get();
+		entry.depth_stencil_state.enable_depth_write = r.get();
+		entry.depth_stencil_state.depth_compare_operator = CompareOperator(r.get_enum(COMPARE_OP_MAX));
+		entry.depth_stencil_state.enable_depth_range = r.get();
+		entry.depth_stencil_state.depth_range_min = r.get_float();
+		entry.depth_stencil_state.depth_range_max = r.get_float();
+		entry.depth_stencil_state.enable_stencil = r.get();
+		PipelineDepthStencilState::StencilOperationState *stencil_ops[2] = { &entry.depth_stencil_state.front_op, &entry.depth_stencil_state.back_op };
+		for (PipelineDepthStencilState::StencilOperationState *op : stencil_ops) {
+			op->fail = StencilOperation(r.get_enum(STENCIL_OP_MAX));
+			op->pass = StencilOperation(r.get_enum(STENCIL_OP_MAX));
+			op->depth_fail = StencilOperation(r.get_enum(STENCIL_OP_MAX));
+			op->compare = CompareOperator(r.get_enum(COMPARE_OP_MAX));
+			op->compare_mask = r.get();
+			op->write_mask = r.get();
+			op->reference = r.get();
+		}
+
+		entry.blend_state.enable_logic_op = r.get();
+		entry.blend_state.logic_op = LogicOperation(r.get_enum(LOGIC_OP_MAX));
+		entry.blend_state.attachments.resize(r.get_count(11));
+		for (PipelineColorBlendState::Attachment &attachment : entry.blend_state.attachments) {
+			attachment.enable_blend = r.get();
+			attachment.src_color_blend_factor = BlendFactor(r.get_enum(BLEND_FACTOR_MAX));
+			attachment.dst_color_blend_factor = BlendFactor(r.get_enum(BLEND_FACTOR_MAX));
+			attachment.color_blend_op = BlendOperation(r.get_enum(BLEND_OP_MAX));
+			attachment.src_alpha_blend_factor = BlendFactor(r.get_enum(BLEND_FACTOR_MAX));
+			attachment.dst_alpha_blend_factor = BlendFactor(r.get_enum(BLEND_FACTOR_MAX));
+			attachment.alpha_blend_op = BlendOperation(r.get_enum(BLEND_OP_MAX));
+			attachment.write_r = r.get();
+			attachment.write_g = r.get();
+			attachment.write_b = r.get();
+			attachment.write_a = r.get();
+		}
+		for (int j = 0; j < 4; j++) {
+			entry.blend_state.blend_constant.components[j] = r.get_float();
+		}
+
+		entry.dynamic_state_flags = r.get();
+		entry.for_render_pass = r.get();
+
+		entry.specialization_constants.resize(r.get_count(3));
+		for (PipelineSpecializationConstant &sc : entry.specialization_constants) {
+			sc.type = PipelineSpecializationConstantType(r.get_enum(PIPELINE_SPECIALIZATION_CONSTANT_TYPE_FLOAT + 1));
+			sc.constant_id = r.get();
+			sc.int_value = r.get();
+		}
+
+		ERR_CONTINUE_MSG(!r.is_valid() || entry.shader >= uint32_t(pipeline_precompile.shaders.size()), "Skipping corrupt pipeline bundle entry in: " + p_path);
+		if (pipeline_precompile.shaders[entry.shader].is_null()) {
+			continue;
+		}
+
+		// Formats are cached and never freed, so creating them here is the same as looking them up.
+		entry.framebuffer_format = framebuffer_format_create_multipass(attachments, passes, view_count);
+		ERR_CONTINUE(entry.framebuffer_format == INVALID_ID);
+		if (has_vertex_format) {
+			entry.vertex_format = vertex_format_create(vertex_attributes);
+			ERR_CONTINUE(entry.vertex_format == INVALID_ID);
+		}
+
+		pipeline_precompile.entries.push_back(entry);
+	}
+
+	print_verbose(vformat("Precompiling %d pipelines from bundle: %s", pipeline_precompile.entries.size(), p_path));
+
+	pipeline_precompile.completed.set(0);
+	if (pipeline_precompile.entries.is_empty()) {
+		_pipeline_bundle_finish_precompile(true);
+		return OK;
+	}
+
+	// Pipeline creation releases the device lock while compiling, so entries really build in parallel.
+	pipeline_precompile.group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RenderingDeviceVulkan::_pipeline_bundle_precompile_entry, nullptr, pipeline_precompile.entries.size(), -1, false, SNAME("PipelineBundlePrecompile"));
+	return OK;
+}
+
+void RenderingDeviceVulkan::_pipeline_bundle_precompile_entry(uint32_t p_index, void *p_userdata) {
+	const PipelineBundleEntry &entry = pipeline_precompile.entries[p_index];
+
+	// Only the pipeline cache is of interest, the pipeline itself is thrown away.
+	RID pipeline = render_pipeline_create(pipeline_precompile.shaders[entry.shader], entry.framebuffer_format, entry.vertex_format, entry.render_primitive, entry.rasterization_state, entry.multisample_state, entry.depth_stencil_state, entry.blend_state, entry.dynamic_state_flags, entry.for_render_pass, entry.specialization_constants);
+	if (pipeline.is_valid()) {
+		free(pipeline);
+	}
+
+	pipeline_precompile.completed.increment();
+}
+
+void RenderingDeviceVulkan::_pipeline_bundle_finish_precompile(bool p_wait) {
+	if (pipeline_precompile.group_task != -1) {
+		if (!p_wait && !WorkerThreadPool::get_singleton()->is_group_task_completed(pipeline_precompile.group_task)) {
+			return;
+		}
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(pipeline_precompile.group_task);
+		pipeline_precompile.group_task = -1;
+	}
+
+	for (const RID &shader : pipeline_precompile.shaders) {
+		if (shader.is_valid()) {
+			free(shader);
+		}
+	}
+	pipeline_precompile.shaders.clear();
+	pipeline_precompile.entries.clear();
+}
+
+float RenderingDeviceVulkan::pipeline_bundle_get_precompile_progress() const {
+	if (pipeline_precompile.group_task == -1) {
+		return 1.0;
+	}
+	return MIN(float(pipeline_precompile.completed.get()) / pipeline_precompile.entries.size(), 1.0f);
+}
+
 template <class T>
 void RenderingDeviceVulkan::_free_rids(T &p_owner, const char *p_type) {
 	List<RID> owned;
@@ -9587,10 +10915,20 @@ uint64_t RenderingDeviceVulkan::limit_get(Limit p_limit) const {
 }
 
 void RenderingDeviceVulkan::finalize() {
+	_pipeline_bundle_finish_precompile(true);
+
 	// Free all resources.
 
 	_flush(false);
 
+	if (defragmentation.pass_active) {
+		_defragmentation_end_pass(); // The device is idle after flushing.
+	}
+	if (defragmentation.context) {
+		vmaEndDefragmentation(allocator, defragmentation.context, nullptr);
+		defragmentation.context = nullptr;
+	}
+
 	_free_rids(render_pipeline_owner, "Pipeline");
 	_free_rids(compute_pipeline_owner, "Compute");
 	_free_rids(uniform_set_owner, "UniformSet");
@@ -9644,6 +10982,13 @@ void RenderingDeviceVulkan::finalize() {
 	for (int i = 0; i < frame_count; i++) {
 		int f = (frame + i) % frame_count;
 		_free_pending_resources(f);
+		while (frames[f].buffer_downloads.front()) {
+			_buffer_free(&frames[f].buffer_downloads.front()->get().buffer);
+			frames[f].buffer_downloads.pop_front();
+		}
+		for (VkSemaphore semaphore : frames[i].async_compute_semaphores) {
+			vkDestroySemaphore(device, semaphore, nullptr);
+		}
 		vkDestroyCommandPool(device, frames[i].command_pool, nullptr);
 		vkDestroyQueryPool(device, frames[i].timestamp_pool, nullptr);
 	}
@@ -9665,6 +11010,11 @@ void RenderingDeviceVulkan::finalize() {
 		vmaDestroyPool(allocator, E->value);
 		small_allocs_pools.remove(E);
 	}
+	while (movable_buffer_pools.size()) {
+		HashMap<uint32_t, VmaPool>::Iterator E = movable_buffer_pools.begin();
+		vmaDestroyPool(allocator, E->value);
+		movable_buffer_pools.remove(E);
+	}
 	vmaDestroyAllocator(allocator);
 
 	while (vertex_formats.size()) {
@@ -9707,6 +11057,9 @@ bool RenderingDeviceVulkan::has_feature(const Features p_feature) const {
 		case SUPPORTS_FRAGMENT_SHADER_WITH_ONLY_SIDE_EFFECTS: {
 			return true;
 		} break;
+		case SUPPORTS_ASYNC_COMPUTE: {
+			return async_compute_supported;
+		} break;
 		default: {
 			return false;
 		}
@@ -33,9 +33,12 @@
 
 #include "core/object/worker_thread_pool.h"
 #include "core/os/thread_safe.h"
+#include "core/templates/hash_set.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/oa_hash_map.h"
+#include "core/templates/pair.h"
 #include "core/templates/rid_owner.h"
+#include "core/templates/safe_refcount.h"
 #include "servers/rendering/rendering_device.h"
 
 #ifdef DEBUG_ENABLED
@@ -199,6 +202,7 @@ class RenderingDeviceVulkan : public RenderingDevice {
 	struct StagingBufferBlock {
 		VkBuffer buffer = VK_NULL_HANDLE;
 		VmaAllocation allocation = nullptr;
+		uint8_t *mapped_data = nullptr;
 		uint64_t frame_used = 0;
 		uint32_t fill_amount = 0;
 	};
@@ -209,7 +213,7 @@ class RenderingDeviceVulkan : public RenderingDevice {
 	uint64_t staging_buffer_max_size = 0;
 	bool staging_buffer_used = false;
 
-	Error _staging_buffer_allocate(uint32_t p_amount, uint32_t p_required_align, uint32_t &r_alloc_offset, uint32_t &r_alloc_size, bool p_can_segment = true);
+	Error _staging_buffer_allocate(uint32_t p_amount, uint32_t p_required_align, uint32_t &r_alloc_offset, uint32_t &r_alloc_size, bool p_can_segment = true, bool p_blocking = true);
 	Error _insert_staging_block();
 
 	struct Buffer {
@@ -218,18 +222,53 @@ class RenderingDeviceVulkan : public RenderingDevice {
 		VkBuffer buffer = VK_NULL_HANDLE;
 		VmaAllocation allocation = nullptr;
 		VkDescriptorBufferInfo buffer_info; // Used for binding.
+		uint32_t pending_upload = UINT32_MAX; // Index in pending_buffer_uploads, if copies to it are queued.
 		Buffer() {
 		}
 	};
 
-	Error _buffer_allocate(Buffer *p_buffer, uint32_t p_size, uint32_t p_usage, VmaMemoryUsage p_mem_usage, VmaAllocationCreateFlags p_mem_flags);
+	Error _buffer_allocate(Buffer *p_buffer, uint32_t p_size, uint32_t p_usage, VmaMemoryUsage p_mem_usage, VmaAllocationCreateFlags p_mem_flags, bool p_movable = false);
 	Error _buffer_free(Buffer *p_buffer);
-	Error _buffer_update(Buffer *p_buffer, size_t p_offset, const uint8_t *p_data, size_t p_data_size, bool p_use_draw_command_buffer = false, uint32_t p_required_align = 32);
+	Error _buffer_update(Buffer *p_buffer, size_t p_offset, const uint8_t *p_data, size_t p_data_size, bool p_use_draw_command_buffer = false, uint32_t p_required_align = 32, bool p_blocking = true);
+	Error _buffer_update_queued(RID p_buffer, uint32_t p_offset, uint32_t p_size, const void *p_data, BitField<BarrierMask> p_post_barrier, bool p_blocking);
+
+	// Copies recorded into the draw command buffer by buffer_update() are queued, and
+	// recorded together with a single barrier before the next command that may depend
+	// on them. Contiguous updates to the same buffer are merged into one region.
+	struct PendingBufferUpload {
+		Buffer *buffer = nullptr;
+		VkBuffer staging_buffer = VK_NULL_HANDLE;
+		LocalVector<VkBufferCopy> regions;
+	};
+
+	LocalVector<PendingBufferUpload> pending_buffer_uploads;
+	VkPipelineStageFlags pending_buffer_upload_dst_stages = 0;
+	VkAccessFlags pending_buffer_upload_dst_access = 0;
+
+	void _queue_buffer_upload(Buffer *p_buffer, VkBuffer p_staging_buffer, const VkBufferCopy &p_region);
+	void _flush_pending_buffer_uploads();
+
+	// Staging memory of late latched updates. The copies read it when they execute,
+	// so it can be rewritten until the frame's commands are submitted.
+	struct LateLatch {
+		uint8_t *data = nullptr;
+		uint32_t size = 0;
+	};
+
+	LocalVector<LateLatch> late_latches;
+	uint64_t late_latch_first = 1; // ID of late_latches[0], 0 is never a valid ID.
+
+	void _release_late_latches();
 
 	void _full_barrier(bool p_sync_with_draw);
 	void _memory_barrier(VkPipelineStageFlags p_src_stage_mask, VkPipelineStageFlags p_dst_stage_mask, VkAccessFlags p_src_access, VkAccessFlags p_dst_access, bool p_sync_with_draw);
 	void _buffer_memory_barrier(VkBuffer buffer, uint64_t p_from, uint64_t p_size, VkPipelineStageFlags p_src_stage_mask, VkPipelineStageFlags p_dst_stage_mask, VkAccessFlags p_src_access, VkAccessFlags p_dst_access, bool p_sync_with_draw);
 
+	// Post barriers of compute lists that don't transition images are deferred until a command that may depend on them is recorded.
+	// Consecutive compute lists then only wait on each other, and the other stages wait once, when they are actually reached.
+	BitField<BarrierMask> pending_compute_barrier;
+	void _flush_pending_compute_barrier(BitField<BarrierMask> p_for_mask = BARRIER_MASK_ALL_BARRIERS);
+
 	/*********************/
 	/**** FRAMEBUFFER ****/
 	/*********************/
@@ -816,10 +855,58 @@ class RenderingDeviceVulkan : public RenderingDevice {
 
 	WorkerThreadPool::TaskID pipelines_cache_save_task = WorkerThreadPool::INVALID_TASK_ID;
 
+	// Render pipelines are created without holding the device lock, so they can be compiled on worker threads.
+	// Shaders are not disposed of while any of these are running, as they may still use their modules and layout.
+	SafeNumeric<uint32_t> unlocked_pipeline_creations;
+
 	void _load_pipeline_cache();
 	void _update_pipeline_cache(bool p_closing = false);
 	static void _save_pipeline_cache(void *p_data);
 
+	// Pipeline bundles list the render pipelines created during a run, together with the shaders they
+	// use, so a later run (possibly on another machine) can create them all ahead of time and have
+	// the pipeline cache populated before they are first drawn.
+	struct PipelineBundleBlobHasher {
+		static _FORCE_INLINE_ uint32_t hash(const Vector<uint8_t> &p_blob) { return hash_murmur3_buffer(p_blob.ptr(), p_blob.size()); }
+	};
+
+	struct PipelineBundleEntry {
+		uint32_t shader = 0;
+		FramebufferFormatID framebuffer_format = INVALID_ID;
+		VertexFormatID vertex_format = INVALID_ID;
+		RenderPrimitive render_primitive = RENDER_PRIMITIVE_POINTS;
+		PipelineRasterizationState rasterization_state;
+		PipelineMultisampleState multisample_state;
+		PipelineDepthStencilState depth_stencil_state;
+		PipelineColorBlendState blend_state;
+		BitField<PipelineDynamicStateFlags> dynamic_state_flags;
+		uint32_t for_render_pass = 0;
+		Vector<PipelineSpecializationConstant> specialization_constants;
+	};
+
+	struct PipelineBundle {
+		bool recording = false;
+		// Keys are shader binaries, values their index in the bundle (insertion order is kept).
+		HashMap<Vector<uint8_t>, uint32_t, PipelineBundleBlobHasher> shaders;
+		HashMap<RID, uint32_t> shader_indices;
+		HashSet<Vector<uint8_t>, PipelineBundleBlobHasher> pipelines;
+	};
+
+	PipelineBundle pipeline_bundle;
+
+	struct PipelineBundlePrecompile {
+		Vector<RID> shaders;
+		Vector<PipelineBundleEntry> entries;
+		WorkerThreadPool::GroupID group_task = -1;
+		SafeNumeric<uint32_t> completed;
+	};
+
+	PipelineBundlePrecompile pipeline_precompile;
+
+	void _pipeline_bundle_record(RID p_shader, FramebufferFormatID p_framebuffer_format, VertexFormatID p_vertex_format, RenderPrimitive p_render_primitive, const PipelineRasterizationState &p_rasterization_state, const PipelineMultisampleState &p_multisample_state, const PipelineDepthStencilState &p_depth_stencil_state, const PipelineColorBlendState &p_blend_state, BitField<PipelineDynamicStateFlags> p_dynamic_state_flags, uint32_t p_for_render_pass, const Vector<PipelineSpecializationConstant> &p_specialization_constants);
+	void _pipeline_bundle_precompile_entry(uint32_t p_index, void *p_userdata);
+	void _pipeline_bundle_finish_precompile(bool p_wait);
+
 	struct ComputePipeline {
 		RID shader;
 		Vector<uint32_t> set_formats;
@@ -984,6 +1071,25 @@ class RenderingDeviceVulkan : public RenderingDevice {
 
 	void _compute_list_add_barrier(BitField<BarrierMask> p_post_barrier, uint32_t p_barrier_flags, uint32_t p_access_flags);
 
+	/***********************/
+	/**** ASYNC COMPUTE ****/
+	/***********************/
+
+	// While an async compute batch is recorded, draw_command_buffer points to a command buffer for the compute queue.
+	// The batch waits on the draw commands recorded before it, and the ones recorded after a sync wait on it.
+	bool async_compute_supported = false;
+	bool async_compute_recording = false;
+	LocalVector<VkSemaphore> async_compute_pending_semaphores; // Signaled by batches nothing waits on yet.
+	// Begun when the batch begins, so ending and synchronizing it can't fail.
+	VkCommandBuffer async_compute_resume_command_buffer = VK_NULL_HANDLE;
+	VkCommandBuffer async_compute_sync_command_buffer = VK_NULL_HANDLE;
+
+	VkCommandBuffer _async_compute_begin_command_buffer();
+	VkSemaphore _async_compute_get_semaphore();
+	void _async_compute_begin();
+	void _async_compute_end();
+	void _async_compute_sync();
+
 	/**************************/
 	/**** FRAME MANAGEMENT ****/
 	/**************************/
@@ -1014,9 +1120,22 @@ class RenderingDeviceVulkan : public RenderingDevice {
 		List<RenderPipeline> render_pipelines_to_dispose_of;
 		List<ComputePipeline> compute_pipelines_to_dispose_of;
 
+		struct BufferDownload {
+			Buffer buffer; // Host visible copy, read and freed once the frame is done.
+			Callable callback;
+		};
+
+		List<BufferDownload> buffer_downloads;
+
 		VkCommandPool command_pool = VK_NULL_HANDLE;
 		VkCommandBuffer setup_command_buffer = VK_NULL_HANDLE; // Used at the beginning of every frame for set-up.
 		VkCommandBuffer draw_command_buffer = VK_NULL_HANDLE; // Used at the beginning of every frame for set-up.
+		VkCommandBuffer first_draw_command_buffer = VK_NULL_HANDLE; // Async compute batches switch draw_command_buffer to new ones.
+
+		LocalVector<VkCommandBuffer> async_compute_command_buffers;
+		LocalVector<VkSemaphore> async_compute_semaphores;
+		uint32_t async_compute_command_buffers_used = 0;
+		uint32_t async_compute_semaphores_used = 0;
 
 		struct Timestamp {
 			String description;
@@ -1045,15 +1164,49 @@ class RenderingDeviceVulkan : public RenderingDevice {
 	bool local_device_processing = false;
 
 	void _free_pending_resources(int p_frame);
+	void _process_buffer_downloads(int p_frame);
 
 	VmaAllocator allocator = nullptr;
 	HashMap<uint32_t, VmaPool> small_allocs_pools;
 	VmaPool _find_or_create_small_allocs_pool(uint32_t p_mem_type_index);
 
+	// Vertex and index buffers that are only referenced by vertex and index arrays can be moved
+	// by VMA's incremental defragmentation, so they are kept in their own pools. A pass starts at
+	// the beginning of a frame: the moved buffers are copied to their new place in the setup
+	// command buffer and the arrays are patched right away. The pass ends when the frame comes
+	// around again, at which point the GPU is done with the old buffers.
+	enum {
+		DEFRAGMENTATION_MAX_BYTES_PER_PASS = 16 * 1024 * 1024,
+		DEFRAGMENTATION_RESTART_FRAMES = 3600, // Frames to wait before looking for fragmentation again once every pool is done.
+	};
+
+	struct Defragmentation {
+		bool enabled = false;
+		VmaDefragmentationContext context = nullptr;
+		VmaDefragmentationPassMoveInfo pass = {};
+		bool pass_active = false;
+		int pass_frame = 0; // Frame slot that recorded the copies.
+		uint32_t pool_index = 0;
+		uint64_t restart_frame = 0;
+		HashMap<VmaAllocation, RID> movable_buffers;
+		HashSet<VmaAllocation> moving; // VMA references these until the pass ends, so they can't be freed before.
+		LocalVector<VkBuffer> old_buffers;
+		LocalVector<Pair<VkBuffer, VmaAllocation>> deferred_frees;
+	} defragmentation;
+
+	HashMap<uint32_t, VmaPool> movable_buffer_pools;
+	VmaPool _find_or_create_movable_buffer_pool(uint32_t p_mem_type_index);
+	Buffer *_get_movable_buffer(VmaAllocation p_allocation, RID &r_id);
+	void _defragmentation_begin_pass();
+	void _defragmentation_end_pass();
+	void _defragmentation_finish();
+
 	VulkanContext *context = nullptr;
 
 	uint64_t image_memory = 0;
 	uint64_t buffer_memory = 0;
+	uint64_t render_target_memory = 0;
+	uint64_t mesh_memory = 0;
 
 	void _free_internal(RID p_id);
 	void _flush(bool p_current_frame);
@@ -1158,6 +1311,12 @@ public:
 	virtual Error buffer_update(RID p_buffer, uint32_t p_offset, uint32_t p_size, const void *p_data, BitField<BarrierMask> p_post_barrier = BARRIER_MASK_ALL_BARRIERS); // Works for any buffer.
 	virtual Error buffer_clear(RID p_buffer, uint32_t p_offset, uint32_t p_size, BitField<BarrierMask> p_post_barrier = BARRIER_MASK_ALL_BARRIERS);
 	virtual Vector<uint8_t> buffer_get_data(RID p_buffer, uint32_t p_offset = 0, uint32_t p_size = 0);
+	virtual Error buffer_get_data_async(RID p_buffer, const Callable &p_callback, uint32_t p_offset = 0, uint32_t p_size = 0);
+	virtual uint64_t buffer_update_async(RID p_buffer, uint32_t p_offset, uint32_t p_size, const void *p_data, BitField<BarrierMask> p_post_barrier = BARRIER_MASK_ALL_BARRIERS);
+	virtual bool upload_fence_is_signaled(uint64_t p_fence) const;
+	virtual uint64_t buffer_update_late_latched(RID p_buffer, uint32_t p_offset, uint32_t p_size, const void *p_data, BitField<BarrierMask> p_post_barrier = BARRIER_MASK_ALL_BARRIERS);
+	virtual bool buffer_late_latch_is_valid(uint64_t p_latch) const;
+	virtual bool buffer_late_latch_write(uint64_t p_latch, const void *p_data);
 
 	/*************************/
 	/**** RENDER PIPELINE ****/
@@ -1199,6 +1358,7 @@ public:
 	virtual void draw_list_set_push_constant(DrawListID p_list, const void *p_data, uint32_t p_data_size);
 
 	virtual void draw_list_draw(DrawListID p_list, bool p_use_indices, uint32_t p_instances = 1, uint32_t p_procedural_vertices = 0);
+	virtual void draw_list_draw_indirect(DrawListID p_list, bool p_use_indices, RID p_buffer, uint32_t p_offset = 0, uint32_t p_draw_count = 1, uint32_t p_stride = 0);
 
 	virtual void draw_list_enable_scissor(DrawListID p_list, const Rect2 &p_rect);
 	virtual void draw_list_disable_scissor(DrawListID p_list);
@@ -1224,6 +1384,10 @@ public:
 	virtual void compute_list_dispatch_indirect(ComputeListID p_list, RID p_buffer, uint32_t p_offset);
 	virtual void compute_list_end(BitField<BarrierMask> p_post_barrier = BARRIER_MASK_ALL_BARRIERS);
 
+	virtual void async_compute_begin();
+	virtual void async_compute_end();
+	virtual void async_compute_sync();
+
 	virtual void barrier(BitField<BarrierMask> p_from = BARRIER_MASK_ALL_BARRIERS, BitField<BarrierMask> p_to = BARRIER_MASK_ALL_BARRIERS);
 	virtual void full_barrier();
 
@@ -1264,6 +1428,7 @@ public:
 	virtual RenderingDevice *create_local_device();
 
 	virtual uint64_t get_memory_usage(MemoryType p_type) const;
+	virtual uint64_t get_memory_budget() const;
 
 	virtual void set_resource_name(RID p_id, const String p_name);
 
@@ -1277,6 +1442,10 @@ public:
 	virtual String get_device_api_version() const;
 	virtual String get_device_pipeline_cache_uuid() const;
 
+	virtual Error pipeline_bundle_save(const String &p_path);
+	virtual Error pipeline_bundle_precompile(const String &p_path);
+	virtual float pipeline_bundle_get_precompile_progress() const;
+
 	virtual uint64_t get_driver_resource(DriverResource p_resource, RID p_rid = RID(), uint64_t p_index = 0);
 
 	virtual bool has_feature(const Features p_feature) const;
@@ -504,6 +504,9 @@ Error VulkanContext::_initialize_device_extensions() {
 	register_requested_device_extension(VK_KHR_IMAGE_FORMAT_LIST_EXTENSION_NAME, false);
 	register_requested_device_extension(VK_KHR_MAINTENANCE_2_EXTENSION_NAME, false);
 	register_requested_device_extension(VK_EXT_PIPELINE_CREATION_CACHE_CONTROL_EXTENSION_NAME, false);
+	register_requested_device_extension(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME, false);
+	register_requested_device_extension(VK_KHR_PRESENT_ID_EXTENSION_NAME, false);
+	register_requested_device_extension(VK_KHR_PRESENT_WAIT_EXTENSION_NAME, false);
 
 	if (Engine::get_singleton()->is_generate_spirv_debug_info_enabled()) {
 		register_requested_device_extension(VK_KHR_SHADER_NON_SEMANTIC_INFO_EXTENSION_NAME, true);
@@ -769,6 +772,8 @@ Error VulkanContext::_check_capabilities() {
 			VkPhysicalDeviceFragmentShadingRateFeaturesKHR vrs_features = {};
 			VkPhysicalDevice16BitStorageFeaturesKHR storage_feature = {};
 			VkPhysicalDeviceMultiviewFeatures multiview_features = {};
+			VkPhysicalDevicePresentIdFeaturesKHR present_id_features = {};
+			VkPhysicalDevicePresentWaitFeaturesKHR present_wait_features = {};
 
 			if (device_api_version >= VK_API_VERSION_1_2) {
 				device_features_vk12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
@@ -820,6 +825,14 @@ Error VulkanContext::_check_capabilities() {
 				next = &multiview_features;
 			}
 
+			if (is_device_extension_enabled(VK_KHR_PRESENT_ID_EXTENSION_NAME) && is_device_extension_enabled(VK_KHR_PRESENT_WAIT_EXTENSION_NAME)) {
+				present_id_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR;
+				present_id_features.pNext = next;
+				present_wait_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR;
+				present_wait_features.pNext = &present_id_features;
+				next = &present_wait_features;
+			}
+
 			VkPhysicalDeviceFeatures2 device_features;
 			device_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
 			device_features.pNext = next;
@@ -860,6 +873,10 @@ Error VulkanContext::_check_capabilities() {
 				storage_buffer_capabilities.storage_push_constant_16_is_supported = storage_feature.storagePushConstant16;
 				storage_buffer_capabilities.storage_input_output_16 = storage_feature.storageInputOutput16;
 			}
+
+			if (is_device_extension_enabled(VK_KHR_PRESENT_ID_EXTENSION_NAME) && is_device_extension_enabled(VK_KHR_PRESENT_WAIT_EXTENSION_NAME)) {
+				present_wait_supported = present_id_features.presentId && present_wait_features.presentWait;
+			}
 		}
 
 		// Check extended properties.
@@ -1390,7 +1407,7 @@ Error VulkanContext::_create_physical_device(VkSurfaceKHR p_surface) {
 
 Error VulkanContext::_create_device() {
 	VkResult err;
-	float queue_priorities[1] = { 0.0 };
+	float queue_priorities[2] = { 0.0, 0.0 };
 	VkDeviceQueueCreateInfo queues[2];
 	queues[0].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
 	queues[0].pNext = nullptr;
@@ -1399,6 +1416,12 @@ Error VulkanContext::_create_device() {
 	queues[0].pQueuePriorities = queue_priorities;
 	queues[0].flags = 0;
 
+	// Async compute needs a second queue in the graphics family, queues of other families would need ownership transfers for every shared resource.
+	separate_compute_queue = GLOBAL_GET("rendering/rendering_device/vulkan/async_compute") && queue_props[graphics_queue_family_index].queueCount > 1;
+	if (separate_compute_queue) {
+		queues[0].queueCount = 2;
+	}
+
 	// Before we retrieved what is supported, here we tell Vulkan we want to enable these features using the same structs.
 	void *nextptr = nullptr;
 
@@ -1463,6 +1486,19 @@ Error VulkanContext::_create_device() {
 		}
 	}
 
+	VkPhysicalDevicePresentIdFeaturesKHR present_id_features = {};
+	VkPhysicalDevicePresentWaitFeaturesKHR present_wait_features = {};
+	present_wait_enabled = present_wait_supported && GLOBAL_GET("rendering/rendering_device/vulkan/present_wait");
+	if (present_wait_enabled) {
+		present_id_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR;
+		present_id_features.pNext = nextptr;
+		present_id_features.presentId = VK_TRUE;
+		present_wait_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR;
+		present_wait_features.pNext = &present_id_features;
+		present_wait_features.presentWait = VK_TRUE;
+		nextptr = &present_wait_features;
+	}
+
 	uint32_t enabled_extension_count = 0;
 	const char *enabled_extension_names[MAX_EXTENSIONS];
 	ERR_FAIL_COND_V(enabled_device_extension_names.size() > MAX_EXTENSIONS, ERR_CANT_CREATE);
@@ -1571,9 +1607,19 @@ Error VulkanContext::_initialize_queues(VkSurfaceKHR p_surface) {
 		GET_DEVICE_PROC_ADDR(device, GetRefreshCycleDurationGOOGLE);
 		GET_DEVICE_PROC_ADDR(device, GetPastPresentationTimingGOOGLE);
 	}
+	if (present_wait_enabled) {
+		GET_DEVICE_PROC_ADDR(device, WaitForPresentKHR);
+	}
 
 	vkGetDeviceQueue(device, graphics_queue_family_index, 0, &graphics_queue);
 
+	if (separate_compute_queue) {
+		vkGetDeviceQueue(device, graphics_queue_family_index, 1, &compute_queue);
+		print_verbose("Vulkan: Using a separate queue for async compute.");
+	} else {
+		compute_queue = graphics_queue;
+	}
+
 	if (!separate_present_queue) {
 		present_queue = graphics_queue;
 	} else {
@@ -2001,6 +2047,7 @@ Error VulkanContext::_update_swap_chain(Window *window) {
 	};
 
 	err = fpCreateSwapchainKHR(device, &swapchain_ci, nullptr, &window->swapchain);
+	window->present_id = 0;
 	ERR_FAIL_COND_V(err, ERR_CANT_CREATE);
 
 	uint32_t sp_image_count;
@@ -2236,6 +2283,89 @@ void VulkanContext::append_command_buffer(VkCommandBuffer p_command_buffer) {
 	command_buffer_count++;
 }
 
+void VulkanContext::append_async_compute_command_buffer(VkCommandBuffer p_command_buffer, VkSemaphore p_wait_semaphore, VkSemaphore p_signal_semaphore) {
+	AsyncComputeSubmit submit;
+	submit.position = command_buffer_count;
+	submit.command_buffer = p_command_buffer;
+	submit.wait_semaphore = p_wait_semaphore;
+	submit.semaphore = p_signal_semaphore;
+	async_compute_submits.push_back(submit);
+}
+
+void VulkanContext::append_async_compute_wait(VkSemaphore p_semaphore) {
+	AsyncComputeSubmit submit;
+	submit.position = command_buffer_count;
+	submit.semaphore = p_semaphore;
+	async_compute_submits.push_back(submit);
+}
+
+Error VulkanContext::_submit_command_buffers(int p_from, uint32_t p_wait_count, const VkSemaphore *p_wait_semaphores, const VkPipelineStageFlags *p_wait_stages, VkSemaphore p_signal_semaphore, VkFence p_fence) {
+	LocalVector<VkSemaphore> wait_semaphores;
+	LocalVector<VkPipelineStageFlags> wait_stages;
+	for (uint32_t i = 0; i < p_wait_count; i++) {
+		wait_semaphores.push_back(p_wait_semaphores[i]);
+		wait_stages.push_back(p_wait_stages[i]);
+	}
+
+	VkSubmitInfo submit_info;
+	submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	submit_info.pNext = nullptr;
+
+	// Every async compute batch ends the graphics submission recorded before it and is submitted right after, so its semaphores are always signaled in submission order.
+	int from = p_from;
+	for (const AsyncComputeSubmit &async_submit : async_compute_submits) {
+		int to = MAX(from, async_submit.position);
+
+		// Waits only hold back the commands of their own submission, so consecutive waits are merged into the next one.
+		if (async_submit.command_buffer || to > from) {
+			submit_info.waitSemaphoreCount = wait_semaphores.size();
+			submit_info.pWaitSemaphores = wait_semaphores.ptr();
+			submit_info.pWaitDstStageMask = wait_stages.ptr();
+			submit_info.commandBufferCount = to - from;
+			submit_info.pCommandBuffers = command_buffer_queue.ptr() + from;
+			submit_info.signalSemaphoreCount = async_submit.command_buffer ? 1 : 0;
+			submit_info.pSignalSemaphores = &async_submit.wait_semaphore;
+			VkResult err = vkQueueSubmit(graphics_queue, 1, &submit_info, VK_NULL_HANDLE);
+			ERR_FAIL_COND_V_MSG(err, ERR_CANT_CREATE, "Vulkan: Cannot submit graphics queue. Error code: " + String(string_VkResult(err)));
+
+			wait_semaphores.clear();
+			wait_stages.clear();
+		}
+
+		if (async_submit.command_buffer) {
+			VkPipelineStageFlags wait_stage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+			submit_info.waitSemaphoreCount = 1;
+			submit_info.pWaitSemaphores = &async_submit.wait_semaphore;
+			submit_info.pWaitDstStageMask = &wait_stage;
+			submit_info.commandBufferCount = 1;
+			submit_info.pCommandBuffers = &async_submit.command_buffer;
+			submit_info.signalSemaphoreCount = 1;
+			submit_info.pSignalSemaphores = &async_submit.semaphore;
+			VkResult err = vkQueueSubmit(compute_queue, 1, &submit_info, VK_NULL_HANDLE);
+			ERR_FAIL_COND_V_MSG(err, ERR_CANT_CREATE, "Vulkan: Cannot submit async compute queue. Error code: " + String(string_VkResult(err)));
+		} else {
+			wait_semaphores.push_back(async_submit.semaphore);
+			wait_stages.push_back(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+		}
+
+		from = to;
+	}
+
+	async_compute_submits.clear();
+
+	submit_info.waitSemaphoreCount = wait_semaphores.size();
+	submit_info.pWaitSemaphores = wait_semaphores.ptr();
+	submit_info.pWaitDstStageMask = wait_stages.ptr();
+	submit_info.commandBufferCount = command_buffer_count - from;
+	submit_info.pCommandBuffers = command_buffer_queue.ptr() + from;
+	submit_info.signalSemaphoreCount = p_signal_semaphore ? 1 : 0;
+	submit_info.pSignalSemaphores = &p_signal_semaphore;
+	VkResult err = vkQueueSubmit(graphics_queue, 1, &submit_info, p_fence);
+	ERR_FAIL_COND_V_MSG(err, ERR_CANT_CREATE, "Vulkan: Cannot submit graphics queue. Error code: " + String(string_VkResult(err)));
+
+	return OK;
+}
+
 void VulkanContext::flush(bool p_flush_setup, bool p_flush_pending) {
 	// Ensure everything else pending is executed.
 	vkDeviceWaitIdle(device);
@@ -2265,20 +2395,10 @@ void VulkanContext::flush(bool p_flush_setup, bool p_flush_pending) {
 	if (pending_flushable) {
 		// Use a fence to wait for everything to finish.
 
-		VkSubmitInfo submit_info;
-		submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-		submit_info.pNext = nullptr;
 		VkPipelineStageFlags wait_stage_mask = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-		submit_info.pWaitDstStageMask = setup_flushable ? &wait_stage_mask : nullptr;
-		submit_info.waitSemaphoreCount = setup_flushable ? 1 : 0;
-		submit_info.pWaitSemaphores = setup_flushable ? &draw_complete_semaphores[frame_index] : nullptr;
-		submit_info.commandBufferCount = command_buffer_count - 1;
-		submit_info.pCommandBuffers = command_buffer_queue.ptr() + 1;
-		submit_info.signalSemaphoreCount = 0;
-		submit_info.pSignalSemaphores = nullptr;
-		VkResult err = vkQueueSubmit(graphics_queue, 1, &submit_info, VK_NULL_HANDLE);
+		Error err = _submit_command_buffers(1, setup_flushable ? 1 : 0, &draw_complete_semaphores[frame_index], &wait_stage_mask, VK_NULL_HANDLE, VK_NULL_HANDLE);
 		command_buffer_count = 1;
-		ERR_FAIL_COND(err);
+		ERR_FAIL_COND(err != OK);
 	}
 
 	vkDeviceWaitIdle(device);
@@ -2363,19 +2483,8 @@ Error VulkanContext::swap_buffers() {
 	// engine has fully released ownership to the application, and it is
 	// okay to render to the image.
 
-	const VkCommandBuffer *commands_ptr = nullptr;
-	uint32_t commands_to_submit = 0;
-
-	if (command_buffer_queue[0] == nullptr) {
-		// No setup command, but commands to submit, submit from the first and skip command.
-		if (command_buffer_count > 1) {
-			commands_ptr = command_buffer_queue.ptr() + 1;
-			commands_to_submit = command_buffer_count - 1;
-		}
-	} else {
-		commands_ptr = command_buffer_queue.ptr();
-		commands_to_submit = command_buffer_count;
-	}
+	// No setup command, submit from the first command and skip it.
+	int commands_from = command_buffer_queue[0] == nullptr ? 1 : 0;
 
 	VkSemaphore *semaphores_to_acquire = (VkSemaphore *)alloca(windows.size() * sizeof(VkSemaphore));
 	VkPipelineStageFlags *pipe_stage_flags = (VkPipelineStageFlags *)alloca(windows.size() * sizeof(VkPipelineStageFlags));
@@ -2391,18 +2500,8 @@ Error VulkanContext::swap_buffers() {
 		}
 	}
 
-	VkSubmitInfo submit_info;
-	submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-	submit_info.pNext = nullptr;
-	submit_info.waitSemaphoreCount = semaphores_to_acquire_count;
-	submit_info.pWaitSemaphores = semaphores_to_acquire;
-	submit_info.pWaitDstStageMask = pipe_stage_flags;
-	submit_info.commandBufferCount = commands_to_submit;
-	submit_info.pCommandBuffers = commands_ptr;
-	submit_info.signalSemaphoreCount = 1;
-	submit_info.pSignalSemaphores = &draw_complete_semaphores[frame_index];
-	err = vkQueueSubmit(graphics_queue, 1, &submit_info, fences[frame_index]);
-	ERR_FAIL_COND_V_MSG(err, ERR_CANT_CREATE, "Vulkan: Cannot submit graphics queue. Error code: " + String(string_VkResult(err)));
+	Error submit_err = _submit_command_buffers(commands_from, semaphores_to_acquire_count, semaphores_to_acquire, pipe_stage_flags, draw_complete_semaphores[frame_index], fences[frame_index]);
+	ERR_FAIL_COND_V(submit_err != OK, ERR_CANT_CREATE);
 
 	command_buffer_queue.write[0] = nullptr;
 	command_buffer_count = 1;
@@ -2413,6 +2512,10 @@ Error VulkanContext::swap_buffers() {
 		// semaphore and signaling the ownership released semaphore when finished.
 		VkFence nullFence = VK_NULL_HANDLE;
 		pipe_stage_flags[0] = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+		VkSubmitInfo submit_info;
+		submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+		submit_info.pNext = nullptr;
+		submit_info.pWaitDstStageMask = pipe_stage_flags;
 		submit_info.waitSemaphoreCount = 1;
 		submit_info.pWaitSemaphores = &draw_complete_semaphores[frame_index];
 		submit_info.commandBufferCount = 0;
@@ -2533,9 +2636,42 @@ Error VulkanContext::swap_buffers() {
 		}
 	}
 #endif
+	uint64_t *present_ids = nullptr;
+	VkPresentIdKHR present_id_info = {};
+	if (present_wait_enabled) {
+		present_ids = (uint64_t *)alloca(sizeof(uint64_t) * windows.size());
+		uint32_t present_id_count = 0;
+		for (KeyValue<int, Window> &E : windows) {
+			Window *w = &E.value;
+			if (w->swapchain == VK_NULL_HANDLE) {
+				continue;
+			}
+			w->present_id++;
+			present_ids[present_id_count++] = w->present_id;
+		}
+
+		present_id_info.sType = VK_STRUCTURE_TYPE_PRESENT_ID_KHR;
+		present_id_info.pNext = present.pNext;
+		present_id_info.swapchainCount = present.swapchainCount;
+		present_id_info.pPresentIds = present_ids;
+		present.pNext = &present_id_info;
+	}
+
 	//	print_line("current buffer:  " + itos(current_buffer));
 	err = fpQueuePresentKHR(present_queue, &present);
 
+	if (present_wait_enabled && err == VK_SUCCESS) {
+		// Block until the previous frame is on screen, so the next one samples its input as late as possible
+		// instead of queuing behind it. The timeout keeps minimized or occluded windows from stalling.
+		for (KeyValue<int, Window> &E : windows) {
+			Window *w = &E.value;
+			if (w->swapchain == VK_NULL_HANDLE || w->present_id < 2) {
+				continue;
+			}
+			fpWaitForPresentKHR(device, w->swapchain, w->present_id - 1, 100000000);
+		}
+	}
+
 	frame_index += 1;
 	frame_index %= FRAME_LAG;
 
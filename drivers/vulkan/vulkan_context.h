@@ -35,6 +35,7 @@
 #include "core/os/mutex.h"
 #include "core/string/ustring.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rb_map.h"
 #include "core/templates/rid_owner.h"
 #include "servers/display_server.h"
@@ -132,6 +133,12 @@ private:
 	bool separate_present_queue = false;
 	VkQueue graphics_queue = VK_NULL_HANDLE;
 	VkQueue present_queue = VK_NULL_HANDLE;
+	// Async compute uses a second queue of the graphics family, so resources need no ownership transfers between queues.
+	bool separate_compute_queue = false;
+	VkQueue compute_queue = VK_NULL_HANDLE;
+	// With VK_KHR_present_wait, swap_buffers() waits for the previous frame to be displayed, so at most one frame is queued for presentation.
+	bool present_wait_supported = false;
+	bool present_wait_enabled = false;
 	VkColorSpaceKHR color_space;
 	VkFormat format;
 	VkSemaphore draw_complete_semaphores[FRAME_LAG];
@@ -161,6 +168,7 @@ private:
 		DisplayServer::VSyncMode vsync_mode = DisplayServer::VSYNC_ENABLED;
 		VkCommandPool present_cmd_pool = VK_NULL_HANDLE; // For separate present queue.
 		VkRenderPass render_pass = VK_NULL_HANDLE;
+		uint64_t present_id = 0; // Last present ID for VK_KHR_present_id, restarts with each swapchain.
 	};
 
 	struct LocalDevice {
@@ -181,6 +189,16 @@ private:
 	Vector<VkCommandBuffer> command_buffer_queue;
 	int command_buffer_count = 1;
 
+	// Splits the queued command buffers into several graphics submissions, chained with the async compute ones.
+	struct AsyncComputeSubmit {
+		int position = 0; // Graphics command buffers queued before this are submitted first.
+		VkCommandBuffer command_buffer = VK_NULL_HANDLE; // If null, the graphics command buffers after position wait on semaphore.
+		VkSemaphore wait_semaphore = VK_NULL_HANDLE; // Signaled by the graphics submission before position.
+		VkSemaphore semaphore = VK_NULL_HANDLE;
+	};
+
+	LocalVector<AsyncComputeSubmit> async_compute_submits;
+
 	// Extensions.
 	static bool instance_extensions_initialized;
 	static HashMap<CharString, bool> requested_instance_extensions;
@@ -213,6 +231,7 @@ private:
 	PFN_vkQueuePresentKHR fpQueuePresentKHR = nullptr;
 	PFN_vkGetRefreshCycleDurationGOOGLE fpGetRefreshCycleDurationGOOGLE = nullptr;
 	PFN_vkGetPastPresentationTimingGOOGLE fpGetPastPresentationTimingGOOGLE = nullptr;
+	PFN_vkWaitForPresentKHR fpWaitForPresentKHR = nullptr;
 	PFN_vkCreateRenderPass2KHR fpCreateRenderPass2KHR = nullptr;
 
 	VkDebugUtilsMessengerEXT dbg_messenger = VK_NULL_HANDLE;
@@ -255,6 +274,8 @@ private:
 	Error _create_swap_chain();
 	Error _create_semaphores();
 
+	Error _submit_command_buffers(int p_from, uint32_t p_wait_count, const VkSemaphore *p_wait_semaphores, const VkPipelineStageFlags *p_wait_stages, VkSemaphore p_signal_semaphore, VkFence p_fence);
+
 	Vector<VkAttachmentReference> _convert_VkAttachmentReference2(uint32_t p_count, const VkAttachmentReference2 *p_refs);
 
 protected:
@@ -288,6 +309,7 @@ public:
 	int get_swapchain_image_count() const;
 	VkQueue get_graphics_queue() const;
 	uint32_t get_graphics_queue_family_index() const;
+	bool has_separate_compute_queue() const { return separate_compute_queue; }
 
 	static void set_vulkan_hooks(VulkanHooks *p_vulkan_hooks) { vulkan_hooks = p_vulkan_hooks; };
 
@@ -320,6 +342,8 @@ public:
 
 	void set_setup_buffer(VkCommandBuffer p_command_buffer);
 	void append_command_buffer(VkCommandBuffer p_command_buffer);
+	void append_async_compute_command_buffer(VkCommandBuffer p_command_buffer, VkSemaphore p_wait_semaphore, VkSemaphore p_signal_semaphore);
+	void append_async_compute_wait(VkSemaphore p_semaphore);
 	void resize_notify();
 	void flush(bool p_flush_setup = false, bool p_flush_pending = false);
 	Error prepare_buffers();
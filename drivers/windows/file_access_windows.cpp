@@ -40,6 +40,7 @@
 #include <windows.h>
 
 #include <errno.h>
+#include <io.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <tchar.h>
@@ -171,6 +172,15 @@ void FileAccessWindows::_close() {
 		return;
 	}
 
+	if (map_data) {
+		UnmapViewOfFile(map_data);
+		CloseHandle((HANDLE)map_handle);
+		map_data = nullptr;
+		map_handle = nullptr;
+		map_size = 0;
+	}
+	map_tried = false;
+
 	fclose(f);
 	f = nullptr;
 
@@ -298,6 +308,43 @@ uint64_t FileAccessWindows::get_buffer(uint8_t *p_dst, uint64_t p_length) const
 	return read;
 }
 
+const uint8_t *FileAccessWindows::map_range(uint64_t p_length) const {
+	ERR_FAIL_COND_V(!f, nullptr);
+
+	if (!map_tried) {
+		// Map the whole file once, only for plain reads so the contents can't change under the mapping.
+		map_tried = true;
+		HANDLE file = (HANDLE)_get_osfhandle(_fileno(f));
+		LARGE_INTEGER size;
+		if (flags == READ && file != INVALID_HANDLE_VALUE && GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+			HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (mapping) {
+				const uint8_t *data = (const uint8_t *)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+				if (data) {
+					map_handle = mapping;
+					map_data = data;
+					map_size = size.QuadPart;
+				} else {
+					CloseHandle(mapping);
+				}
+			}
+		}
+	}
+	if (!map_data) {
+		return nullptr;
+	}
+
+	int64_t pos = _ftelli64(f);
+	if (pos < 0 || (uint64_t)pos + p_length > map_size) {
+		return nullptr;
+	}
+	if (_fseeki64(f, pos + p_length, SEEK_SET)) {
+		check_errors();
+		return nullptr;
+	}
+	return map_data + pos;
+}
+
 Error FileAccessWindows::get_error() const {
 	return last_error;
 }
@@ -48,6 +48,11 @@ class FileAccessWindows : public FileAccess {
 	String path_src;
 	String save_path;
 
+	mutable void *map_handle = nullptr;
+	mutable const uint8_t *map_data = nullptr;
+	mutable uint64_t map_size = 0;
+	mutable bool map_tried = false;
+
 	void _close();
 
 	static bool is_path_invalid(const String &p_path);
@@ -70,6 +75,7 @@ public:
 
 	virtual uint8_t get_8() const override; ///< get a byte
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual const uint8_t *map_range(uint64_t p_length) const override;
 
 	virtual Error get_error() const override; ///< get last error
 
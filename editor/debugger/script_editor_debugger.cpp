@@ -34,6 +34,7 @@
 #include "core/debugger/debugger_marshalls.h"
 #include "core/debugger/remote_debugger.h"
 #include "core/io/marshalls.h"
+#include "core/os/time.h"
 #include "core/string/ustring.h"
 #include "core/version.h"
 #include "editor/debugger/debug_adapter/debug_adapter_protocol.h"
@@ -288,6 +289,15 @@ void ScriptEditorDebugger::_video_mem_request() {
 	_put_msg("servers:memory", Array());
 }
 
+void ScriptEditorDebugger::_memory_tags_request() {
+	_put_msg("servers:memory_tags", Array());
+}
+
+void ScriptEditorDebugger::_memory_tags_take_snapshot() {
+	mem_tags_snapshot_requested = true;
+	_memory_tags_request();
+}
+
 void ScriptEditorDebugger::_video_mem_export() {
 	file_dialog->set_file_mode(EditorFileDialog::FILE_MODE_SAVE_FILE);
 	file_dialog->set_access(EditorFileDialog::ACCESS_FILESYSTEM);
@@ -428,6 +438,60 @@ void ScriptEditorDebugger::_parse_message(const String &p_msg, uint64_t p_thread
 
 		vmem_total->set_tooltip_text(TTR("Bytes:") + " " + itos(total));
 		vmem_total->set_text(String::humanize_size(total));
+	} else if (p_msg == "servers:memory_tag_usage") {
+		ServersDebugger::MemoryTagUsage usage;
+		usage.deserialize(p_data);
+		usage.tags.sort_custom<ServersDebugger::MemoryTagInfo::CompareUsage>();
+
+		if (mem_tags_snapshot_requested) {
+			mem_tags_snapshot_requested = false;
+			mem_tags_has_snapshot = true;
+			mem_tags_snapshot_data.clear();
+			for (const ServersDebugger::MemoryTagInfo &E : usage.tags) {
+				mem_tags_snapshot_data[E.name] = { E.usage, E.allocations };
+			}
+			mem_tags_snapshot_label->set_text(vformat(TTR("Snapshot taken at %s."), Time::get_singleton()->get_time_string_from_system()));
+		}
+
+		// Differences are signed, unlike what humanize_size() expects.
+		auto format_diff = [](int64_t p_diff, bool p_bytes) {
+			String sign = p_diff > 0 ? "+" : (p_diff < 0 ? "-" : "");
+			uint64_t value = ABS(p_diff);
+			return sign + (p_bytes ? String::humanize_size(value) : itos(value));
+		};
+
+		double elapsed = mem_tags_last_ticks != 0 && usage.ticks_usec > mem_tags_last_ticks ? (usage.ticks_usec - mem_tags_last_ticks) / 1000000.0 : 0.0;
+
+		mem_tags_tree->clear();
+		TreeItem *root = mem_tags_tree->create_item();
+		HashMap<String, MemoryTagSample> samples;
+		for (const ServersDebugger::MemoryTagInfo &E : usage.tags) {
+			TreeItem *it = mem_tags_tree->create_item(root);
+			it->set_text(0, E.name);
+			it->set_text(1, String::humanize_size(E.usage));
+			it->set_tooltip_text(1, TTR("Bytes:") + " " + itos(E.usage));
+			it->set_text(2, String::humanize_size(E.max_usage));
+			it->set_text(3, itos(E.allocations));
+
+			HashMap<String, MemoryTagSample>::ConstIterator last = mem_tags_last.find(E.name);
+			if (last && elapsed > 0.0) {
+				it->set_text(4, rtos(Math::snapped((E.allocations - last->value.allocations) / elapsed, 0.1)));
+			}
+
+			if (mem_tags_has_snapshot) {
+				MemoryTagSample snapshot;
+				HashMap<String, MemoryTagSample>::ConstIterator F = mem_tags_snapshot_data.find(E.name);
+				if (F) {
+					snapshot = F->value;
+				}
+				it->set_text(5, format_diff(int64_t(E.usage) - int64_t(snapshot.usage), true));
+				it->set_text(6, format_diff(int64_t(E.allocations) - int64_t(snapshot.allocations), false));
+			}
+
+			samples[E.name] = { E.usage, E.allocations };
+		}
+		mem_tags_last = samples;
+		mem_tags_last_ticks = usage.ticks_usec;
 	} else if (p_msg == "servers:drawn") {
 		can_request_idle_draw = true;
 	} else if (p_msg == "stack_dump") {
@@ -864,6 +928,7 @@ void ScriptEditorDebugger::_notification(int p_what) {
 			docontinue->set_icon(get_editor_theme_icon(SNAME("DebugContinue")));
 			vmem_refresh->set_icon(get_editor_theme_icon(SNAME("Reload")));
 			vmem_export->set_icon(get_editor_theme_icon(SNAME("Save")));
+			mem_tags_refresh->set_icon(get_editor_theme_icon(SNAME("Reload")));
 			search->set_right_icon(get_editor_theme_icon(SNAME("Search")));
 
 			reason->add_theme_color_override("font_color", get_theme_color(SNAME("error_color"), EditorStringName(Editor)));
@@ -1016,6 +1081,8 @@ void ScriptEditorDebugger::_update_buttons_state() {
 	const bool active = is_session_active();
 	const bool has_editor_tree = active && editor_remote_tree && editor_remote_tree->get_selected();
 	vmem_refresh->set_disabled(!active);
+	mem_tags_refresh->set_disabled(!active);
+	mem_tags_snapshot->set_disabled(!active);
 	step->set_disabled(!active || !is_breaked() || !is_debuggable());
 	next->set_disabled(!active || !is_breaked() || !is_debuggable());
 	copy->set_disabled(!active || !is_breaked());
@@ -1722,6 +1789,8 @@ void ScriptEditorDebugger::_tab_changed(int p_tab) {
 	if (tabs->get_tab_title(p_tab) == TTR("Video RAM")) {
 		// "Video RAM" tab was clicked, refresh the data it's displaying when entering the tab.
 		_video_mem_request();
+	} else if (tabs->get_tab_title(p_tab) == TTR("Memory Tags")) {
+		_memory_tags_request();
 	}
 }
 
@@ -2065,6 +2134,45 @@ ScriptEditorDebugger::ScriptEditorDebugger() {
 		tabs->add_child(vmem_vb);
 	}
 
+	{ // Static memory by tag.
+		VBoxContainer *mem_tags_vb = memnew(VBoxContainer);
+		mem_tags_vb->set_name(TTR("Memory Tags"));
+
+		HBoxContainer *mem_tags_hb = memnew(HBoxContainer);
+		Label *mtlb = memnew(Label(TTR("Static Memory Usage by Tag (debug builds only):") + " "));
+		mtlb->set_theme_type_variation("HeaderSmall");
+		mtlb->set_h_size_flags(SIZE_EXPAND_FILL);
+		mem_tags_hb->add_child(mtlb);
+		mem_tags_snapshot_label = memnew(Label);
+		mem_tags_hb->add_child(mem_tags_snapshot_label);
+		mem_tags_snapshot = memnew(Button(TTR("Take Snapshot")));
+		mem_tags_snapshot->set_tooltip_text(TTR("Compare the next refreshes against the current usage."));
+		mem_tags_snapshot->connect("pressed", callable_mp(this, &ScriptEditorDebugger::_memory_tags_take_snapshot));
+		mem_tags_hb->add_child(mem_tags_snapshot);
+		mem_tags_refresh = memnew(Button);
+		mem_tags_refresh->set_flat(true);
+		mem_tags_refresh->connect("pressed", callable_mp(this, &ScriptEditorDebugger::_memory_tags_request));
+		mem_tags_hb->add_child(mem_tags_refresh);
+		mem_tags_vb->add_child(mem_tags_hb);
+
+		mem_tags_tree = memnew(Tree);
+		mem_tags_tree->set_v_size_flags(SIZE_EXPAND_FILL);
+		mem_tags_tree->set_columns(7);
+		mem_tags_tree->set_column_titles_visible(true);
+		mem_tags_tree->set_column_title(0, TTR("Tag"));
+		mem_tags_tree->set_column_expand(0, true);
+		const char *titles[] = { TTRC("Usage"), TTRC("Peak"), TTRC("Allocations"), TTRC("Allocations/s"), TTRC("Usage Since Snapshot"), TTRC("Allocations Since Snapshot") };
+		for (int i = 1; i < 7; i++) {
+			mem_tags_tree->set_column_title(i, TTRGET(titles[i - 1]));
+			mem_tags_tree->set_column_expand(i, false);
+			mem_tags_tree->set_column_custom_minimum_width(i, (i < 5 ? 100 : 170) * EDSCALE);
+		}
+		mem_tags_tree->set_hide_root(true);
+		mem_tags_vb->add_child(mem_tags_tree);
+
+		tabs->add_child(mem_tags_vb);
+	}
+
 	{ // misc
 		VBoxContainer *misc = memnew(VBoxContainer);
 		misc->set_name(TTR("Misc"));
@@ -137,6 +137,21 @@ private:
 	Button *vmem_export = nullptr;
 	LineEdit *vmem_total = nullptr;
 
+	struct MemoryTagSample {
+		uint64_t usage = 0;
+		uint64_t allocations = 0;
+	};
+
+	Tree *mem_tags_tree = nullptr;
+	Button *mem_tags_refresh = nullptr;
+	Button *mem_tags_snapshot = nullptr;
+	Label *mem_tags_snapshot_label = nullptr;
+	HashMap<String, MemoryTagSample> mem_tags_last;
+	uint64_t mem_tags_last_ticks = 0;
+	HashMap<String, MemoryTagSample> mem_tags_snapshot_data;
+	bool mem_tags_has_snapshot = false;
+	bool mem_tags_snapshot_requested = false;
+
 	Tree *stack_dump = nullptr;
 	LineEdit *search = nullptr;
 	OptionButton *threads = nullptr;
@@ -195,6 +210,8 @@ private:
 
 	void _video_mem_request();
 	void _video_mem_export();
+	void _memory_tags_request();
+	void _memory_tags_take_snapshot();
 
 	int _get_node_path_cache(const NodePath &p_path);
 
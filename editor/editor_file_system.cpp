@@ -44,6 +44,7 @@
 #include "editor/editor_paths.h"
 #include "editor/editor_resource_preview.h"
 #include "editor/editor_settings.h"
+#include "servers/rendering_server.h"
 
 EditorFileSystem *EditorFileSystem::singleton = nullptr;
 //the name is the version, to keep compatibility with different versions of Godot
@@ -762,6 +763,49 @@ EditorFileSystem::ScanProgress EditorFileSystem::ScanProgress::get_sub(int p_cur
 }
 
 void EditorFileSystem::_scan_new_dir(EditorFileSystemDirectory *p_dir, Ref<DirAccess> &da, const ScanProgress &p_progress) {
+	LocalVector<ScannedFile> files;
+	_scan_new_dir_tree(p_dir, da, p_progress.get_sub(0, 2), files);
+
+	if (files.is_empty()) {
+		return;
+	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &EditorFileSystem::_scan_new_file, files.ptr(), files.size(), -1, false, SNAME("ScanFSFiles"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	ScanProgress files_progress = p_progress.get_sub(1, 2);
+	for (uint32_t i = 0; i < files.size(); i++) {
+		ScannedFile &sf = files[i];
+		EditorFileSystemDirectory::FileInfo *fi = sf.file;
+
+		if (sf.update_global_class) {
+			fi->script_class_name = _get_global_script_class(fi->type, sf.path, &fi->script_class_extends, &fi->script_class_icon_path);
+		}
+		if (sf.update_script_class && ClassDB::is_parent_class(fi->type, SNAME("Script"))) {
+			_queue_update_script_class(sf.path);
+		}
+
+		if (sf.test_reimport) {
+			ItemAction ia;
+			ia.action = ItemAction::ACTION_FILE_TEST_REIMPORT;
+			ia.dir = sf.dir;
+			ia.file = fi->file;
+			scan_actions.push_back(ia);
+		}
+
+		if (fi->uid != ResourceUID::INVALID_ID) {
+			if (ResourceUID::get_singleton()->has_id(fi->uid)) {
+				ResourceUID::get_singleton()->set_id(fi->uid, sf.path);
+			} else {
+				ResourceUID::get_singleton()->add_id(fi->uid, sf.path);
+			}
+		}
+
+		files_progress.update(i, files.size());
+	}
+}
+
+void EditorFileSystem::_scan_new_dir_tree(EditorFileSystemDirectory *p_dir, Ref<DirAccess> &da, const ScanProgress &p_progress, LocalVector<ScannedFile> &r_files) {
 	List<String> dirs;
 	List<String> files;
 
@@ -801,7 +845,7 @@ void EditorFileSystem::_scan_new_dir(EditorFileSystemDirectory *p_dir, Ref<DirAc
 	dirs.sort_custom<NaturalNoCaseComparator>();
 	files.sort_custom<NaturalNoCaseComparator>();
 
-	int total = dirs.size() + files.size();
+	int total = dirs.size();
 	int idx = 0;
 
 	for (List<String>::Element *E = dirs.front(); E; E = E->next(), idx++) {
@@ -816,7 +860,7 @@ void EditorFileSystem::_scan_new_dir(EditorFileSystemDirectory *p_dir, Ref<DirAc
 				efd->parent = p_dir;
 				efd->name = E->get();
 
-				_scan_new_dir(efd, da, p_progress.get_sub(idx, total));
+				_scan_new_dir_tree(efd, da, p_progress.get_sub(idx, total), r_files);
 
 				int idx2 = 0;
 				for (int i = 0; i < p_dir->subdirs.size(); i++) {
@@ -840,124 +884,157 @@ void EditorFileSystem::_scan_new_dir(EditorFileSystemDirectory *p_dir, Ref<DirAc
 		p_progress.update(idx, total);
 	}
 
-	for (List<String>::Element *E = files.front(); E; E = E->next(), idx++) {
-		String ext = E->get().get_extension().to_lower();
+	for (const String &E : files) {
+		String ext = E.get_extension().to_lower();
 		if (!valid_extensions.has(ext)) {
 			continue; //invalid
 		}
 
 		EditorFileSystemDirectory::FileInfo *fi = memnew(EditorFileSystemDirectory::FileInfo);
-		fi->file = E->get();
+		fi->file = E;
+		p_dir->files.push_back(fi);
 
-		String path = cd.path_join(fi->file);
+		ScannedFile sf;
+		sf.dir = p_dir;
+		sf.file = fi;
+		sf.path = cd.path_join(E);
+		r_files.push_back(sf);
+	}
+}
 
-		FileCache *fc = file_cache.getptr(path);
-		uint64_t mt = FileAccess::get_modified_time(path);
+void EditorFileSystem::_scan_new_file(uint32_t p_index, ScannedFile *p_files) {
+	ScannedFile &sf = p_files[p_index];
+	EditorFileSystemDirectory::FileInfo *fi = sf.file;
+	const String &path = sf.path;
+	String ext = fi->file.get_extension().to_lower();
 
-		if (import_extensions.has(ext)) {
-			//is imported
-			uint64_t import_mt = 0;
-			if (FileAccess::exists(path + ".import")) {
-				import_mt = FileAccess::get_modified_time(path + ".import");
-			}
+	const FileCache *fc = file_cache.getptr(path);
+	uint64_t mt = FileAccess::get_modified_time(path);
 
-			if (fc && fc->modification_time == mt && fc->import_modification_time == import_mt && !_test_for_reimport(path, true)) {
-				fi->type = fc->type;
-				fi->resource_script_class = fc->resource_script_class;
-				fi->uid = fc->uid;
-				fi->deps = fc->deps;
-				fi->modified_time = fc->modification_time;
-				fi->import_modified_time = fc->import_modification_time;
-
-				fi->import_valid = fc->import_valid;
-				fi->script_class_name = fc->script_class_name;
-				fi->import_group_file = fc->import_group_file;
-				fi->script_class_extends = fc->script_class_extends;
-				fi->script_class_icon_path = fc->script_class_icon_path;
-
-				if (revalidate_import_files && !ResourceFormatImporter::get_singleton()->are_import_settings_valid(path)) {
-					ItemAction ia;
-					ia.action = ItemAction::ACTION_FILE_TEST_REIMPORT;
-					ia.dir = p_dir;
-					ia.file = E->get();
-					scan_actions.push_back(ia);
-				}
-
-				if (fc->type.is_empty()) {
-					fi->type = ResourceLoader::get_resource_type(path);
-					fi->resource_script_class = ResourceLoader::get_resource_script_class(path);
-					fi->import_group_file = ResourceLoader::get_import_group_file(path);
-					//there is also the chance that file type changed due to reimport, must probably check this somehow here (or kind of note it for next time in another file?)
-					//note: I think this should not happen any longer..
-				}
+	if (import_extensions.has(ext)) {
+		//is imported
+		uint64_t import_mt = 0;
+		if (FileAccess::exists(path + ".import")) {
+			import_mt = FileAccess::get_modified_time(path + ".import");
+		}
 
-				if (fc->uid == ResourceUID::INVALID_ID) {
-					// imported files should always have a UID, so attempt to fetch it.
-					fi->uid = ResourceLoader::get_resource_uid(path);
-				}
+		if (fc && fc->modification_time == mt && fc->import_modification_time == import_mt && !_test_for_reimport(path, true)) {
+			fi->type = fc->type;
+			fi->resource_script_class = fc->resource_script_class;
+			fi->uid = fc->uid;
+			fi->deps = fc->deps;
+			fi->modified_time = fc->modification_time;
+			fi->import_modified_time = fc->import_modification_time;
 
-			} else {
-				fi->type = ResourceFormatImporter::get_singleton()->get_resource_type(path);
-				fi->uid = ResourceFormatImporter::get_singleton()->get_resource_uid(path);
-				fi->import_group_file = ResourceFormatImporter::get_singleton()->get_import_group_file(path);
-				fi->script_class_name = _get_global_script_class(fi->type, path, &fi->script_class_extends, &fi->script_class_icon_path);
-				fi->modified_time = 0;
-				fi->import_modified_time = 0;
-				fi->import_valid = fi->type == "TextFile" ? true : ResourceLoader::is_import_valid(path);
+			fi->import_valid = fc->import_valid;
+			fi->script_class_name = fc->script_class_name;
+			fi->import_group_file = fc->import_group_file;
+			fi->script_class_extends = fc->script_class_extends;
+			fi->script_class_icon_path = fc->script_class_icon_path;
 
-				ItemAction ia;
-				ia.action = ItemAction::ACTION_FILE_TEST_REIMPORT;
-				ia.dir = p_dir;
-				ia.file = E->get();
-				scan_actions.push_back(ia);
+			if (revalidate_import_files && !ResourceFormatImporter::get_singleton()->are_import_settings_valid(path)) {
+				sf.test_reimport = true;
 			}
-		} else {
-			if (fc && fc->modification_time == mt) {
-				//not imported, so just update type if changed
-				fi->type = fc->type;
-				fi->resource_script_class = fc->resource_script_class;
-				fi->uid = fc->uid;
-				fi->modified_time = fc->modification_time;
-				fi->deps = fc->deps;
-				fi->import_modified_time = 0;
-				fi->import_valid = true;
-				fi->script_class_name = fc->script_class_name;
-				fi->script_class_extends = fc->script_class_extends;
-				fi->script_class_icon_path = fc->script_class_icon_path;
-			} else {
-				//new or modified time
+
+			if (fc->type.is_empty()) {
 				fi->type = ResourceLoader::get_resource_type(path);
 				fi->resource_script_class = ResourceLoader::get_resource_script_class(path);
-				if (fi->type == "" && textfile_extensions.has(ext)) {
-					fi->type = "TextFile";
-				}
-				fi->uid = ResourceLoader::get_resource_uid(path);
-				fi->script_class_name = _get_global_script_class(fi->type, path, &fi->script_class_extends, &fi->script_class_icon_path);
-				fi->deps = _get_dependencies(path);
-				fi->modified_time = mt;
-				fi->import_modified_time = 0;
-				fi->import_valid = true;
-
-				if (ClassDB::is_parent_class(fi->type, SNAME("Script"))) {
-					_queue_update_script_class(path);
-				}
+				fi->import_group_file = ResourceLoader::get_import_group_file(path);
+				//there is also the chance that file type changed due to reimport, must probably check this somehow here (or kind of note it for next time in another file?)
+				//note: I think this should not happen any longer..
 			}
-		}
 
-		if (fi->uid != ResourceUID::INVALID_ID) {
-			if (ResourceUID::get_singleton()->has_id(fi->uid)) {
-				ResourceUID::get_singleton()->set_id(fi->uid, path);
-			} else {
-				ResourceUID::get_singleton()->add_id(fi->uid, path);
+			if (fc->uid == ResourceUID::INVALID_ID) {
+				// imported files should always have a UID, so attempt to fetch it.
+				fi->uid = ResourceLoader::get_resource_uid(path);
 			}
+
+		} else {
+			fi->type = ResourceFormatImporter::get_singleton()->get_resource_type(path);
+			fi->uid = ResourceFormatImporter::get_singleton()->get_resource_uid(path);
+			fi->import_group_file = ResourceFormatImporter::get_singleton()->get_import_group_file(path);
+			fi->modified_time = 0;
+			fi->import_modified_time = 0;
+			fi->import_valid = fi->type == "TextFile" ? true : ResourceLoader::is_import_valid(path);
+
+			sf.update_global_class = true;
+			sf.test_reimport = true;
 		}
+	} else {
+		if (fc && fc->modification_time == mt) {
+			//not imported, so just update type if changed
+			fi->type = fc->type;
+			fi->resource_script_class = fc->resource_script_class;
+			fi->uid = fc->uid;
+			fi->modified_time = fc->modification_time;
+			fi->deps = fc->deps;
+			fi->import_modified_time = 0;
+			fi->import_valid = true;
+			fi->script_class_name = fc->script_class_name;
+			fi->script_class_extends = fc->script_class_extends;
+			fi->script_class_icon_path = fc->script_class_icon_path;
+		} else {
+			//new or modified time
+			fi->type = ResourceLoader::get_resource_type(path);
+			fi->resource_script_class = ResourceLoader::get_resource_script_class(path);
+			if (fi->type == "" && textfile_extensions.has(ext)) {
+				fi->type = "TextFile";
+			}
+			fi->uid = ResourceLoader::get_resource_uid(path);
+			fi->deps = _get_dependencies(path);
+			fi->modified_time = mt;
+			fi->import_modified_time = 0;
+			fi->import_valid = true;
 
-		p_dir->files.push_back(fi);
-		p_progress.update(idx, total);
+			sf.update_global_class = true;
+			sf.update_script_class = true;
+		}
 	}
 }
 
 void EditorFileSystem::_scan_fs_changes(EditorFileSystemDirectory *p_dir, const ScanProgress &p_progress) {
+	LocalVector<ScannedFile> imported_files;
+	_scan_fs_changes_dir(p_dir, p_progress, imported_files);
+
+	if (imported_files.is_empty()) {
+		return;
+	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &EditorFileSystem::_scan_fs_changed_file, imported_files.ptr(), imported_files.size(), -1, false, SNAME("ScanFSChangedFiles"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	for (const ScannedFile &sf : imported_files) {
+		if (sf.test_reimport) {
+			ItemAction ia;
+			ia.action = ItemAction::ACTION_FILE_TEST_REIMPORT;
+			ia.dir = sf.dir;
+			ia.file = sf.file->file;
+			scan_actions.push_back(ia);
+		}
+	}
+}
+
+void EditorFileSystem::_scan_fs_changed_file(uint32_t p_index, ScannedFile *p_files) {
+	ScannedFile &sf = p_files[p_index];
+	const String &path = sf.path;
+
+	uint64_t mt = FileAccess::get_modified_time(path);
+
+	if (mt != sf.file->modified_time) {
+		sf.test_reimport = true; //it was modified, must be reimported.
+	} else if (!FileAccess::exists(path + ".import")) {
+		sf.test_reimport = true; //no .import file, obviously reimport
+	} else {
+		uint64_t import_mt = FileAccess::get_modified_time(path + ".import");
+		if (import_mt != sf.file->import_modified_time) {
+			sf.test_reimport = true;
+		} else if (_test_for_reimport(path, true)) {
+			sf.test_reimport = true;
+		}
+	}
+}
+
+void EditorFileSystem::_scan_fs_changes_dir(EditorFileSystemDirectory *p_dir, const ScanProgress &p_progress, LocalVector<ScannedFile> &r_imported_files) {
 	uint64_t current_mtime = FileAccess::get_modified_time(p_dir->get_path());
 
 	bool updated_dir = false;
@@ -1091,32 +1168,12 @@ void EditorFileSystem::_scan_fs_changes(EditorFileSystemDirectory *p_dir, const
 		String path = cd.path_join(p_dir->files[i]->file);
 
 		if (import_extensions.has(p_dir->files[i]->file.get_extension().to_lower())) {
-			//check here if file must be imported or not
-
-			uint64_t mt = FileAccess::get_modified_time(path);
-
-			bool reimport = false;
-
-			if (mt != p_dir->files[i]->modified_time) {
-				reimport = true; //it was modified, must be reimported.
-			} else if (!FileAccess::exists(path + ".import")) {
-				reimport = true; //no .import file, obviously reimport
-			} else {
-				uint64_t import_mt = FileAccess::get_modified_time(path + ".import");
-				if (import_mt != p_dir->files[i]->import_modified_time) {
-					reimport = true;
-				} else if (_test_for_reimport(path, true)) {
-					reimport = true;
-				}
-			}
-
-			if (reimport) {
-				ItemAction ia;
-				ia.action = ItemAction::ACTION_FILE_TEST_REIMPORT;
-				ia.dir = p_dir;
-				ia.file = p_dir->files[i]->file;
-				scan_actions.push_back(ia);
-			}
+			//check here if file must be imported or not, on worker threads once all directories are listed
+			ScannedFile sf;
+			sf.dir = p_dir;
+			sf.file = p_dir->files[i];
+			sf.path = path;
+			r_imported_files.push_back(sf);
 		} else if (ResourceCache::has(path)) { //test for potential reload
 
 			uint64_t mt = FileAccess::get_modified_time(path);
@@ -1142,7 +1199,7 @@ void EditorFileSystem::_scan_fs_changes(EditorFileSystemDirectory *p_dir, const
 			scan_actions.push_back(ia);
 			continue;
 		}
-		_scan_fs_changes(p_dir->get_subdir(i), p_progress);
+		_scan_fs_changes_dir(p_dir->get_subdir(i), p_progress, r_imported_files);
 	}
 }
 
@@ -2209,6 +2266,62 @@ void EditorFileSystem::_reimport_thread(uint32_t p_index, ImportThreadData *p_im
 	_reimport_file(p_import_data->reimport_files[p_import_data->reimport_from + p_index].path);
 }
 
+// Project paths written in the .import file, the paths of imported files are unique and skipped.
+static void _get_import_referenced_paths(const String &p_path, Vector<String> &r_paths) {
+	String text = FileAccess::get_file_as_string(p_path + ".import");
+	int pos = text.find("\"res://");
+	while (pos != -1) {
+		int end = text.find("\"", pos + 1);
+		if (end == -1) {
+			break;
+		}
+		String path = text.substr(pos + 1, end - pos - 1);
+		if (!path.begins_with("res://.godot/")) {
+			r_paths.push_back(path);
+		}
+		pos = text.find("\"res://", end + 1);
+	}
+}
+
+int EditorFileSystem::_split_dependent_imports(Vector<ImportFile> &r_files, int p_from, int p_to) const {
+	// Files of the batch that use another one, or write to the same path (such as meshes or animations saved
+	// to external files), can't be imported at the same time. Move them to the front to import them serially.
+	HashMap<String, int> path_files;
+	HashSet<int> dependent;
+	for (int i = p_from; i <= p_to; i++) {
+		Vector<String> paths;
+		_get_import_referenced_paths(r_files[i].path, paths);
+		paths.push_back(r_files[i].path);
+		for (const String &path : paths) {
+			HashMap<String, int>::Iterator E = path_files.find(path);
+			if (!E) {
+				path_files.insert(path, i);
+			} else if (E->value != i) {
+				dependent.insert(E->value);
+				dependent.insert(i);
+			}
+		}
+	}
+
+	if (dependent.is_empty()) {
+		return 0;
+	}
+
+	Vector<ImportFile> parallel;
+	int serial_count = 0;
+	for (int i = p_from; i <= p_to; i++) {
+		if (dependent.has(i)) {
+			r_files.write[p_from + serial_count++] = r_files[i];
+		} else {
+			parallel.push_back(r_files[i]);
+		}
+	}
+	for (int i = 0; i < parallel.size(); i++) {
+		r_files.write[p_from + serial_count + i] = parallel[i];
+	}
+	return serial_count;
+}
+
 void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 	ERR_FAIL_COND_MSG(importing, "Attempted to call reimport_files() recursively, this is not allowed.");
 	importing = true;
@@ -2263,6 +2376,9 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 
 	bool use_multiple_threads = GLOBAL_GET("editor/import/use_multiple_threads");
 
+	HashMap<String, ImportTimings> import_timings;
+	uint64_t reimport_begin = OS::get_singleton()->get_ticks_usec();
+
 	int from = 0;
 	for (int i = 0; i < reimport_files.size(); i++) {
 		if (groups_to_reimport.has(reimport_files[i].path)) {
@@ -2271,11 +2387,19 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 
 		if (use_multiple_threads && reimport_files[i].threaded) {
 			if (i + 1 == reimport_files.size() || reimport_files[i + 1].importer != reimport_files[from].importer) {
-				if (from - i == 0) {
-					// Single file, do not use threads.
-					pr.step(reimport_files[i].path.get_file(), i);
-					_reimport_file(reimport_files[i].path);
-				} else {
+				ImportTimings &timings = import_timings[reimport_files[from].importer];
+				timings.files += i - from + 1;
+				uint64_t batch_begin = OS::get_singleton()->get_ticks_usec();
+
+				// A single file does not use threads.
+				int serial_count = from == i ? 1 : _split_dependent_imports(reimport_files, from, i);
+				for (int j = from; j < from + serial_count; j++) {
+					pr.step(reimport_files[j].path.get_file(), j);
+					_reimport_file(reimport_files[j].path);
+				}
+				from += serial_count;
+
+				if (from <= i) {
 					Ref<ResourceImporter> importer = ResourceFormatImporter::get_singleton()->get_importer_by_name(reimport_files[from].importer);
 					ERR_CONTINUE(!importer.is_valid());
 
@@ -2293,6 +2417,8 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 							current_index = tdata.max_index;
 							pr.step(reimport_files[current_index].path.get_file(), current_index);
 						}
+						// Scene imports create meshes and textures, run what they queue on the rendering server.
+						RenderingServer::get_singleton()->sync();
 						OS::get_singleton()->delay_usec(1);
 					} while (!WorkerThreadPool::get_singleton()->is_group_task_completed(group_task));
 
@@ -2301,12 +2427,18 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 					importer->import_threaded_end();
 				}
 
+				timings.usec += OS::get_singleton()->get_ticks_usec() - batch_begin;
 				from = i + 1;
 			}
 
 		} else {
+			ImportTimings &timings = import_timings[reimport_files[i].importer];
+			uint64_t file_begin = OS::get_singleton()->get_ticks_usec();
 			pr.step(reimport_files[i].path.get_file(), i);
 			_reimport_file(reimport_files[i].path);
+			timings.files++;
+			timings.usec += OS::get_singleton()->get_ticks_usec() - file_begin;
+			from = i + 1;
 		}
 	}
 
@@ -2330,6 +2462,14 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 
 	ResourceUID::get_singleton()->update_cache(); // After reimporting, update the cache.
 
+	if (reimport_files.size() > 1) {
+		print_line(vformat("Reimported %d files in %.2f seconds.", reimport_files.size(), (OS::get_singleton()->get_ticks_usec() - reimport_begin) / 1000000.0));
+		for (const KeyValue<String, ImportTimings> &E : import_timings) {
+			double seconds = E.value.usec / 1000000.0;
+			print_line(vformat("    %s: %d files in %.2f seconds (%.1f files/s).", E.key, E.value.files, seconds, seconds > 0.0 ? E.value.files / seconds : 0.0));
+		}
+	}
+
 	_save_filesystem_cache();
 	_update_pending_script_classes();
 	importing = false;
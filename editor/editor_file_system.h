@@ -35,6 +35,7 @@
 #include "core/os/thread.h"
 #include "core/os/thread_safe.h"
 #include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/safe_refcount.h"
 #include "scene/main/node.h"
 
@@ -227,7 +228,22 @@ class EditorFileSystem : public Node {
 	HashSet<String> valid_extensions;
 	HashSet<String> import_extensions;
 
+	// Directories are listed on the scanning thread, the files found are then checked on worker threads.
+	// Checks only fill their own entry, actions and script classes are queued afterwards in scan order.
+	struct ScannedFile {
+		EditorFileSystemDirectory *dir = nullptr;
+		EditorFileSystemDirectory::FileInfo *file = nullptr;
+		String path;
+		bool test_reimport = false;
+		bool update_global_class = false; // Script languages are queried on the scanning thread.
+		bool update_script_class = false;
+	};
+
 	void _scan_new_dir(EditorFileSystemDirectory *p_dir, Ref<DirAccess> &da, const ScanProgress &p_progress);
+	void _scan_new_dir_tree(EditorFileSystemDirectory *p_dir, Ref<DirAccess> &da, const ScanProgress &p_progress, LocalVector<ScannedFile> &r_files);
+	void _scan_new_file(uint32_t p_index, ScannedFile *p_files);
+	void _scan_fs_changes_dir(EditorFileSystemDirectory *p_dir, const ScanProgress &p_progress, LocalVector<ScannedFile> &r_imported_files);
+	void _scan_fs_changed_file(uint32_t p_index, ScannedFile *p_files);
 
 	Thread thread_sources;
 	bool scanning_changes = false;
@@ -286,6 +302,12 @@ class EditorFileSystem : public Node {
 	};
 
 	void _reimport_thread(uint32_t p_index, ImportThreadData *p_import_data);
+	int _split_dependent_imports(Vector<ImportFile> &r_files, int p_from, int p_to) const;
+
+	struct ImportTimings {
+		int files = 0;
+		uint64_t usec = 0;
+	};
 
 	static ResourceUID::ID _resource_saver_get_resource_id_for_path(const String &p_path, bool p_generate);
 
@@ -4127,14 +4127,22 @@ void EditorNode::notify_all_debug_sessions_exited() {
 }
 
 void EditorNode::add_io_error(const String &p_error) {
-	DEV_ASSERT(Thread::get_caller_id() == Thread::get_main_id());
+	if (!Thread::is_main_thread()) {
+		// Reported by an import running on a worker thread.
+		callable_mp_static(&EditorNode::add_io_error).bind(p_error).call_deferred();
+		return;
+	}
 	singleton->load_errors->add_image(singleton->theme->get_icon(SNAME("Error"), EditorStringName(EditorIcons)));
 	singleton->load_errors->add_text(p_error + "\n");
 	EditorInterface::get_singleton()->popup_dialog_centered_ratio(singleton->load_error_dialog, 0.5);
 }
 
 void EditorNode::add_io_warning(const String &p_warning) {
-	DEV_ASSERT(Thread::get_caller_id() == Thread::get_main_id());
+	if (!Thread::is_main_thread()) {
+		// Reported by an import running on a worker thread.
+		callable_mp_static(&EditorNode::add_io_warning).bind(p_warning).call_deferred();
+		return;
+	}
 	singleton->load_errors->add_image(singleton->theme->get_icon(SNAME("Warning"), EditorStringName(EditorIcons)));
 	singleton->load_errors->add_text(p_warning + "\n");
 	EditorInterface::get_singleton()->popup_dialog_centered_ratio(singleton->load_error_dialog, 0.5);
@@ -4366,7 +4374,7 @@ bool EditorNode::is_object_of_custom_type(const Object *p_object, const StringNa
 void EditorNode::progress_add_task(const String &p_task, const String &p_label, int p_steps, bool p_can_cancel) {
 	if (singleton->cmdline_export_mode) {
 		print_line(p_task + ": begin: " + p_label + " steps: " + itos(p_steps));
-	} else if (singleton->progress_dialog) {
+	} else if (singleton->progress_dialog && Thread::is_main_thread()) {
 		singleton->progress_dialog->add_task(p_task, p_label, p_steps, p_can_cancel);
 	}
 }
@@ -4375,7 +4383,7 @@ bool EditorNode::progress_task_step(const String &p_task, const String &p_state,
 	if (singleton->cmdline_export_mode) {
 		print_line("\t" + p_task + ": step " + itos(p_step) + ": " + p_state);
 		return false;
-	} else if (singleton->progress_dialog) {
+	} else if (singleton->progress_dialog && Thread::is_main_thread()) {
 		return singleton->progress_dialog->task_step(p_task, p_state, p_step, p_force_refresh);
 	} else {
 		return false;
@@ -4385,7 +4393,7 @@ bool EditorNode::progress_task_step(const String &p_task, const String &p_state,
 void EditorNode::progress_end_task(const String &p_task) {
 	if (singleton->cmdline_export_mode) {
 		print_line(p_task + ": end");
-	} else if (singleton->progress_dialog) {
+	} else if (singleton->progress_dialog && Thread::is_main_thread()) {
 		singleton->progress_dialog->end_task(p_task);
 	}
 }
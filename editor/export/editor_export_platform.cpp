@@ -36,6 +36,7 @@
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
 #include "core/io/zip_io.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/version.h"
 #include "editor/editor_file_system.h"
 #include "editor/editor_node.h"
@@ -190,6 +191,75 @@ void EditorExportPlatform::gen_debug_flags(Vector<String> &r_flags, int p_flags)
 	}
 }
 
+void EditorExportPlatform::_compress_pending_file(void *p_userdata, uint32_t p_index) {
+	PackData *pd = (PackData *)p_userdata;
+	PackData::PendingFile &pf = pd->pending[p_index];
+	if (pf.data.size() > PACK_COMPRESSION_BLOCK_SIZE) {
+		return; // Split in blocks compressed on several threads already, done when storing it.
+	}
+	pf.compressed = PackedData::compress_file(pf.data.ptr(), pf.data.size(), Compression::Mode(pd->compression));
+}
+
+Error EditorExportPlatform::_flush_pending_pack_files(PackData *p_pd) {
+	if (p_pd->pending.is_empty()) {
+		return OK;
+	}
+
+	if (p_pd->compression >= 0) {
+		if (p_pd->pending.size() > 1) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&EditorExportPlatform::_compress_pending_file, p_pd, p_pd->pending.size(), -1, true, SNAME("ExportCompressFiles"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			_compress_pending_file(p_pd, 0);
+		}
+	}
+
+	Error err = OK;
+	for (PackData::PendingFile &pf : p_pd->pending) {
+		if (p_pd->compression >= 0 && pf.data.size() > PACK_COMPRESSION_BLOCK_SIZE) {
+			pf.compressed = PackedData::compress_file(pf.data.ptr(), pf.data.size(), Compression::Mode(p_pd->compression));
+		}
+
+		SavedData &sd = p_pd->file_ofs.write[pf.index];
+		sd.ofs = p_pd->f->get_position();
+		sd.compressed = !pf.compressed.is_empty();
+
+		Ref<FileAccessEncrypted> fae;
+		Ref<FileAccess> ftmp = p_pd->f;
+
+		if (sd.encrypted) {
+			fae.instantiate();
+			ERR_FAIL_COND_V(fae.is_null(), ERR_SKIP);
+
+			err = fae->open_and_parse(ftmp, p_pd->key, FileAccessEncrypted::MODE_WRITE_AES256, false);
+			ERR_FAIL_COND_V(err != OK, ERR_SKIP);
+			ftmp = fae;
+		}
+
+		// Store file content.
+		if (sd.compressed) {
+			ftmp->store_buffer(pf.compressed.ptr(), pf.compressed.size());
+		} else {
+			ftmp->store_buffer(pf.data.ptr(), pf.data.size());
+		}
+
+		if (fae.is_valid()) {
+			ftmp.unref();
+			fae.unref();
+		}
+
+		int pad = _get_pad(PCK_PADDING, p_pd->f->get_position());
+		for (int i = 0; i < pad; i++) {
+			p_pd->f->store_8(0);
+		}
+	}
+
+	p_pd->pending.clear();
+	p_pd->pending_size = 0;
+
+	return err;
+}
+
 Error EditorExportPlatform::_save_pack_file(void *p_userdata, const String &p_path, const Vector<uint8_t> &p_data, int p_file, int p_total, const Vector<String> &p_enc_in_filters, const Vector<String> &p_enc_ex_filters, const Vector<uint8_t> &p_key) {
 	ERR_FAIL_COND_V_MSG(p_total < 1, ERR_PARAMETER_RANGE_ERROR, "Must select at least one file to export.");
 
@@ -197,7 +267,6 @@ Error EditorExportPlatform::_save_pack_file(void *p_userdata, const String &p_pa
 
 	SavedData sd;
 	sd.path_utf8 = p_path.utf8();
-	sd.ofs = pd->f->get_position();
 	sd.size = p_data.size();
 	sd.encrypted = false;
 
@@ -215,31 +284,6 @@ Error EditorExportPlatform::_save_pack_file(void *p_userdata, const String &p_pa
 		}
 	}
 
-	Ref<FileAccessEncrypted> fae;
-	Ref<FileAccess> ftmp = pd->f;
-
-	if (sd.encrypted) {
-		fae.instantiate();
-		ERR_FAIL_COND_V(fae.is_null(), ERR_SKIP);
-
-		Error err = fae->open_and_parse(ftmp, p_key, FileAccessEncrypted::MODE_WRITE_AES256, false);
-		ERR_FAIL_COND_V(err != OK, ERR_SKIP);
-		ftmp = fae;
-	}
-
-	// Store file content.
-	ftmp->store_buffer(p_data.ptr(), p_data.size());
-
-	if (fae.is_valid()) {
-		ftmp.unref();
-		fae.unref();
-	}
-
-	int pad = _get_pad(PCK_PADDING, pd->f->get_position());
-	for (int i = 0; i < pad; i++) {
-		pd->f->store_8(0);
-	}
-
 	// Store MD5 of original file.
 	{
 		unsigned char hash[16];
@@ -250,7 +294,33 @@ Error EditorExportPlatform::_save_pack_file(void *p_userdata, const String &p_pa
 		}
 	}
 
-	pd->file_ofs.push_back(sd);
+	// Identical files share the data stored for the first one, the directory points both at it.
+	String content_key = String::hex_encode_buffer(sd.md5.ptr(), 16) + itos(sd.size) + (sd.encrypted ? "e" : "");
+	HashMap<String, int>::Iterator E = pd->stored_content.find(content_key);
+	if (E) {
+		sd.duplicate_of = E->value;
+		pd->file_ofs.push_back(sd);
+	} else {
+		pd->stored_content.insert(content_key, pd->file_ofs.size());
+
+		PackData::PendingFile pf;
+		pf.index = pd->file_ofs.size();
+		pf.data = p_data;
+		pd->file_ofs.push_back(sd);
+		pd->pending.push_back(pf);
+		pd->pending_size += p_data.size();
+		pd->key = p_key;
+
+		// Bound the memory held by the batch, and flush right away when there is nothing to parallelize.
+		const uint32_t max_pending_files = MAX(1, WorkerThreadPool::get_singleton()->get_thread_count()) * 4;
+		const uint64_t max_pending_size = 64 * 1024 * 1024;
+		if (pd->compression < 0 || pd->pending.size() >= max_pending_files || pd->pending_size >= max_pending_size) {
+			Error err = _flush_pending_pack_files(pd);
+			if (err != OK) {
+				return err;
+			}
+		}
+	}
 
 	// TRANSLATORS: This is an editor progress label describing the storing of a file.
 	if (pd->ep->step(vformat(TTR("Storing File: %s"), p_path), 2 + p_file * 100 / p_total, false)) {
@@ -1512,8 +1582,12 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, b
 	pd.ep = &ep;
 	pd.f = ftmp;
 	pd.so_files = p_so_files;
+	pd.compression = GLOBAL_GET("editor/export/pck_compression");
 
 	Error err = export_project_files(p_preset, p_debug, _save_pack_file, &pd, _add_shared_object);
+	if (err == OK) {
+		err = _flush_pending_pack_files(&pd);
+	}
 
 	// Close temp file.
 	pd.f.unref();
@@ -1525,6 +1599,15 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, b
 		return err;
 	}
 
+	for (int i = 0; i < pd.file_ofs.size(); i++) {
+		SavedData &sd = pd.file_ofs.write[i];
+		if (sd.duplicate_of >= 0) {
+			const SavedData &stored = pd.file_ofs[sd.duplicate_of];
+			sd.ofs = stored.ofs;
+			sd.compressed = stored.compressed;
+		}
+	}
+
 	pd.file_ofs.sort(); //do sort, so we can do binary search later
 
 	Ref<FileAccess> f;
@@ -1650,6 +1733,9 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, b
 		if (pd.file_ofs[i].encrypted) {
 			flags |= PACK_FILE_ENCRYPTED;
 		}
+		if (pd.file_ofs[i].compressed) {
+			flags |= PACK_FILE_COMPRESSED;
+		}
 		fhead->store_32(flags);
 	}
 
@@ -74,8 +74,10 @@ private:
 		uint64_t ofs = 0;
 		uint64_t size = 0;
 		bool encrypted = false;
+		bool compressed = false;
 		Vector<uint8_t> md5;
 		CharString path_utf8;
+		int duplicate_of = -1; // Index of the entry whose stored data is shared, for identical files.
 
 		bool operator<(const SavedData &p_data) const {
 			return path_utf8 < p_data.path_utf8;
@@ -83,10 +85,23 @@ private:
 	};
 
 	struct PackData {
+		struct PendingFile {
+			int index = 0; // In file_ofs.
+			Vector<uint8_t> data;
+			Vector<uint8_t> compressed;
+		};
+
 		Ref<FileAccess> f;
 		Vector<SavedData> file_ofs;
+		int compression = -1; // Compression::Mode of the stored files, -1 to store them as is.
 		EditorProgress *ep = nullptr;
 		Vector<SharedObject> *so_files = nullptr;
+
+		// Small files are compressed in parallel batches, then all are stored in export order.
+		LocalVector<PendingFile> pending;
+		uint64_t pending_size = 0;
+		Vector<uint8_t> key;
+		HashMap<String, int> stored_content; // MD5 and encryption of each stored file, to index in file_ofs.
 	};
 
 	struct ZipData {
@@ -100,6 +115,8 @@ private:
 	void _export_find_customized_resources(const Ref<EditorExportPreset> &p_preset, EditorFileSystemDirectory *p_dir, EditorExportPreset::FileExportMode p_mode, HashSet<String> &p_paths);
 	void _export_find_dependencies(const String &p_path, HashSet<String> &p_paths);
 
+	static void _compress_pending_file(void *p_userdata, uint32_t p_index);
+	static Error _flush_pending_pack_files(PackData *p_pd);
 	static Error _save_pack_file(void *p_userdata, const String &p_path, const Vector<uint8_t> &p_data, int p_file, int p_total, const Vector<String> &p_enc_in_filters, const Vector<String> &p_enc_ex_filters, const Vector<uint8_t> &p_key);
 	static Error _save_zip_file(void *p_userdata, const String &p_path, const Vector<uint8_t> &p_data, int p_file, int p_total, const Vector<String> &p_enc_in_filters, const Vector<String> &p_enc_ex_filters, const Vector<uint8_t> &p_key);
 
@@ -206,10 +206,16 @@ Error ResourceImporterDynamicFont::import(const String &p_source_file, const Str
 
 		RID conf_rid = font->find_variation(variation, face_index, embolden, transform);
 
-		Array chars = preload_config["chars"];
-		for (int j = 0; j < chars.size(); j++) {
-			char32_t c = chars[j].operator int();
-			TS->font_render_range(conf_rid, size, c, c);
+		// Render consecutive characters as one range, so MSDF glyphs of a range are generated together on worker threads.
+		Array chars = preload_config["chars"].duplicate();
+		chars.sort();
+		for (int j = 0; j < chars.size();) {
+			char32_t start = chars[j].operator int();
+			char32_t end = start;
+			for (j++; j < chars.size() && chars[j].operator int() <= (int)end + 1; j++) {
+				end = chars[j].operator int();
+			}
+			TS->font_render_range(conf_rid, size, start, end);
 		}
 
 		Array glyphs = preload_config["glyphs"];
@@ -30,6 +30,7 @@
 
 #include "resource_importer_scene.h"
 
+#include "core/config/project_settings.h"
 #include "core/error/error_macros.h"
 #include "core/io/resource_saver.h"
 #include "core/object/script_language.h"
@@ -2380,7 +2381,14 @@ Error ResourceImporterScene::import(const String &p_source_file, const String &p
 
 	Error err = OK;
 	List<String> missing_deps; // for now, not much will be done with this
+	bool serial_import = importing_threaded && !importer->can_import_threaded();
+	if (serial_import) {
+		serial_import_mutex.lock();
+	}
 	Node *scene = importer->import_scene(src_path, import_flags, p_options, &missing_deps, &err);
+	if (serial_import) {
+		serial_import_mutex.unlock();
+	}
 	if (!scene || err != OK) {
 		return err;
 	}
@@ -2521,6 +2529,9 @@ Error ResourceImporterScene::import(const String &p_source_file, const String &p
 	Ref<EditorScenePostImport> post_import_script;
 
 	if (!post_import_script_path.is_empty()) {
+		if (importing_threaded) {
+			serial_import_mutex.lock();
+		}
 		Ref<Script> scr = ResourceLoader::load(post_import_script_path);
 		if (!scr.is_valid()) {
 			EditorNode::add_io_error(TTR("Couldn't load post-import script:") + " " + post_import_script_path);
@@ -2530,6 +2541,9 @@ Error ResourceImporterScene::import(const String &p_source_file, const String &p
 			if (!post_import_script->get_script_instance()) {
 				EditorNode::add_io_error(TTR("Invalid/broken script for post-import (check console):") + " " + post_import_script_path);
 				post_import_script.unref();
+				if (importing_threaded) {
+					serial_import_mutex.unlock();
+				}
 				return ERR_CANT_CREATE;
 			}
 		}
@@ -2538,6 +2552,13 @@ Error ResourceImporterScene::import(const String &p_source_file, const String &p
 	if (post_import_script.is_valid()) {
 		post_import_script->init(p_source_file);
 		scene = post_import_script->post_import(scene);
+	}
+
+	if (!post_import_script_path.is_empty() && importing_threaded) {
+		serial_import_mutex.unlock();
+	}
+
+	if (post_import_script.is_valid()) {
 		if (!scene) {
 			EditorNode::add_io_error(
 					TTR("Error running post-import script:") + " " + post_import_script_path + "\n" +
@@ -2598,9 +2619,15 @@ Error ResourceImporterScene::import(const String &p_source_file, const String &p
 ResourceImporterScene *ResourceImporterScene::scene_singleton = nullptr;
 ResourceImporterScene *ResourceImporterScene::animation_singleton = nullptr;
 
+Mutex ResourceImporterScene::serial_import_mutex;
+
 Vector<Ref<EditorSceneFormatImporter>> ResourceImporterScene::importers;
 Vector<Ref<EditorScenePostImportPlugin>> ResourceImporterScene::post_importer_plugins;
 
+bool ResourceImporterScene::can_import_threaded() const {
+	return GLOBAL_GET("editor/import/use_multiple_threads_for_scenes");
+}
+
 bool ResourceImporterScene::ResourceImporterScene::has_advanced_options() const {
 	return true;
 }
@@ -78,6 +78,8 @@ public:
 	virtual Node *import_scene(const String &p_path, uint32_t p_flags, const HashMap<StringName, Variant> &p_options, List<String> *r_missing_deps, Error *r_err = nullptr);
 	virtual void get_import_options(const String &p_path, List<ResourceImporter::ImportOption> *r_options);
 	virtual Variant get_option_visibility(const String &p_path, bool p_for_animation, const String &p_option, const HashMap<StringName, Variant> &p_options);
+	// Script importers are never run concurrently.
+	virtual bool can_import_threaded() const { return false; }
 
 	EditorSceneFormatImporter() {}
 };
@@ -233,6 +235,10 @@ class ResourceImporterScene : public ResourceImporter {
 	void _optimize_track_usage(AnimationPlayer *p_player, AnimationImportTracks *p_track_actions);
 
 	bool animation_importer = false;
+	bool importing_threaded = false;
+
+	// Serializes format importers and post-import scripts that can't run on several threads.
+	static Mutex serial_import_mutex;
 
 public:
 	static ResourceImporterScene *get_scene_singleton() { return scene_singleton; }
@@ -294,7 +300,9 @@ public:
 	virtual bool has_advanced_options() const override;
 	virtual void show_advanced_options(const String &p_path) override;
 
-	virtual bool can_import_threaded() const override { return false; }
+	virtual bool can_import_threaded() const override;
+	virtual void import_threaded_begin() override { importing_threaded = true; }
+	virtual void import_threaded_end() override { importing_threaded = false; }
 
 	ResourceImporterScene(bool p_animation_import = false, bool p_singleton = false);
 	~ResourceImporterScene();
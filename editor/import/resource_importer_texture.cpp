@@ -379,6 +379,8 @@ void ResourceImporterTexture::_save_ctex(const Ref<Image> &p_image, const String
 		p_compress_mode = COMPRESS_VRAM_UNCOMPRESSED; //these can't go as lossy
 	}
 
+	uint64_t mipmaps_begin = OS::get_singleton()->get_ticks_usec();
+
 	Ref<Image> image = p_image->duplicate();
 
 	if (p_force_po2_for_compressed && p_mipmaps && ((p_compress_mode == COMPRESS_BASIS_UNIVERSAL) || (p_compress_mode == COMPRESS_VRAM_COMPRESSED))) {
@@ -406,7 +408,11 @@ void ResourceImporterTexture::_save_ctex(const Ref<Image> &p_image, const String
 
 	Image::UsedChannels used_channels = image->detect_used_channels(csource);
 
+	uint64_t compress_begin = OS::get_singleton()->get_ticks_usec();
 	save_to_ctex_format(f, image, p_compress_mode, used_channels, p_vram_compression, p_lossy_quality);
+	uint64_t compress_end = OS::get_singleton()->get_ticks_usec();
+
+	print_verbose(vformat("%s: %dx%d with %d mipmaps, mipmaps took %.1f ms, compression took %.1f ms, %d bytes.", p_to_path, image->get_width(), image->get_height(), image->get_mipmap_count(), (compress_begin - mipmaps_begin) / 1000.0, (compress_end - compress_begin) / 1000.0, f->get_position()));
 }
 
 void ResourceImporterTexture::_save_editor_meta(const Dictionary &p_metadata, const String &p_to_path) {
@@ -271,8 +271,10 @@ void register_editor_types() {
 
 	GLOBAL_DEF("editor/import/reimport_missing_imported_files", true);
 	GLOBAL_DEF("editor/import/use_multiple_threads", true);
+	GLOBAL_DEF("editor/import/use_multiple_threads_for_scenes", false);
 
 	GLOBAL_DEF("editor/export/convert_text_resources_to_binary", true);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "editor/export/pck_compression", PROPERTY_HINT_ENUM, "Disabled:-1,FastLZ:0,Zstandard:2"), -1);
 
 	GLOBAL_DEF("editor/version_control/plugin_name", "");
 	GLOBAL_DEF("editor/version_control/autoload_on_startup", false);
@@ -35,6 +35,7 @@
 #include "core/core_string_names.h"
 #include "core/crypto/crypto.h"
 #include "core/debugger/engine_debugger.h"
+#include "core/debugger/trace_recorder.h"
 #include "core/extension/extension_api_dump.h"
 #include "core/extension/gdextension_interface_dump.gen.h"
 #include "core/extension/gdextension_manager.h"
@@ -47,6 +48,7 @@
 #include "core/io/ip.h"
 #include "core/io/resource_loader.h"
 #include "core/object/message_queue.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/os/time.h"
 #include "core/register_core_types.h"
@@ -75,6 +77,7 @@
 #include "servers/physics_server_2d.h"
 #include "servers/physics_server_3d.h"
 #include "servers/register_server_types.h"
+#include "servers/rendering/renderer_compositor.h"
 #include "servers/rendering/rendering_server_default.h"
 #include "servers/text/text_server_dummy.h"
 #include "servers/text_server.h"
@@ -160,6 +163,7 @@ String rendering_method = "";
 static int text_driver_idx = -1;
 static int display_driver_idx = -1;
 static int audio_driver_idx = -1;
+static WorkerThreadPool::TaskID text_data_task = WorkerThreadPool::INVALID_TASK_ID;
 
 // Engine config/tools
 
@@ -510,8 +514,12 @@ void Main::print_help(const char *p_binary) {
 	OS::get_singleton()->print("  --validate-extension-api <path>   Validate an extension API file dumped (with the option above) from a previous version of the engine to ensure API compatibility. If incompatibilities or errors are detected, the return code will be non zero.\n");
 	OS::get_singleton()->print("  --benchmark                       Benchmark the run time and print it to console.\n");
 	OS::get_singleton()->print("  --benchmark-file <path>           Benchmark the run time and save it to a given file in JSON format. The path should be absolute.\n");
+	OS::get_singleton()->print("  --trace-file <path>               Record the duration of engine zones on every thread and save them to a given file in the Chrome trace format, which can be opened in Perfetto. The path should be absolute.\n");
 #ifdef TESTS_ENABLED
 	OS::get_singleton()->print("  --test [--help]                   Run unit tests. Use --test --help for more information.\n");
+#ifdef BENCHMARKS_ENABLED
+	OS::get_singleton()->print("  --test --benchmarks               Run the micro-benchmarks instead of the unit tests. Use --benchmark-output=<path> to also save the results in JSON format.\n");
+#endif
 #endif
 #endif
 	OS::get_singleton()->print("\n");
@@ -625,6 +633,7 @@ Error Main::test_setup() {
 	}
 
 	ClassDB::set_current_api(ClassDB::API_NONE);
+	ClassDB::build_lookup_tables();
 
 	_start_success = true;
 
@@ -1504,6 +1513,14 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 				OS::get_singleton()->print("Missing <path> argument for --benchmark-file <path>.\n");
 				goto error;
 			}
+		} else if (I->get() == "--trace-file") {
+			if (I->next()) {
+				TraceRecorder::start(I->next()->get());
+				N = I->next()->next();
+			} else {
+				OS::get_singleton()->print("Missing <path> argument for --trace-file <path>.\n");
+				goto error;
+			}
 
 		} else if (I->get() == "--" || I->get() == "++") {
 			adding_user_args = true;
@@ -1561,11 +1578,12 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 		int worker_threads = GLOBAL_GET("threading/worker_pool/max_threads");
 		bool low_priority_use_system_threads = GLOBAL_GET("threading/worker_pool/use_system_threads_for_low_priority_tasks");
 		float low_property_ratio = GLOBAL_GET("threading/worker_pool/low_priority_thread_ratio");
+		bool use_work_stealing = GLOBAL_GET("threading/worker_pool/use_work_stealing");
 
 		if (editor || project_manager) {
 			WorkerThreadPool::get_singleton()->init();
 		} else {
-			WorkerThreadPool::get_singleton()->init(worker_threads, low_priority_use_system_threads, low_property_ratio);
+			WorkerThreadPool::get_singleton()->init(worker_threads, low_priority_use_system_threads, low_property_ratio, use_work_stealing);
 		}
 	}
 
@@ -1704,6 +1722,7 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 		GLOBAL_DEF(PropertyInfo(Variant::STRING, "rendering/gl_compatibility/driver.ios", PROPERTY_HINT_ENUM, driver_hints), default_driver);
 		GLOBAL_DEF(PropertyInfo(Variant::STRING, "rendering/gl_compatibility/driver.macos", PROPERTY_HINT_ENUM, driver_hints), default_driver);
 		GLOBAL_DEF_RST("rendering/gl_compatibility/nvidia_disable_threaded_optimization", true);
+		GLOBAL_DEF_RST("rendering/gl_compatibility/threaded_resource_upload", false);
 	}
 
 	// Start with RenderingDevice-based backends. Should be included if any RD driver present.
@@ -2008,6 +2027,12 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 	GLOBAL_DEF("debug/settings/stdout/print_gpu_profile", false);
 	GLOBAL_DEF("debug/settings/stdout/verbose_stdout", false);
 
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "debug/settings/metrics/histogram_window_seconds", PROPERTY_HINT_RANGE, "1,600,1,suffix:s"), 60);
+	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "debug/settings/metrics/hitch_threshold_msec", PROPERTY_HINT_RANGE, "0,1000,0.1,suffix:ms"), 50.0);
+	GLOBAL_DEF("debug/settings/metrics/statsd_address", "");
+	GLOBAL_DEF("debug/settings/metrics/statsd_prefix", "godot");
+	performance->setup_metrics();
+
 	if (!OS::get_singleton()->_verbose_stdout) { // Not manually overridden.
 		OS::get_singleton()->_verbose_stdout = GLOBAL_GET("debug/settings/stdout/verbose_stdout");
 	}
@@ -2031,6 +2056,14 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 	OS::get_singleton()->set_low_processor_usage_mode(GLOBAL_DEF("application/run/low_processor_mode", false));
 	OS::get_singleton()->set_low_processor_usage_mode_sleep_usec(
 			GLOBAL_DEF(PropertyInfo(Variant::INT, "application/run/low_processor_mode_sleep_usec", PROPERTY_HINT_RANGE, "0,33200,1,or_greater"), 6900)); // Roughly 144 FPS
+	OS::get_singleton()->set_frame_pacing_spin_usec(
+			GLOBAL_DEF(PropertyInfo(Variant::INT, "application/run/frame_pacing_spin_usec", PROPERTY_HINT_RANGE, "0,5000,1"), 1000));
+
+	GLOBAL_DEF("display/window/handheld/adaptive_performance/enabled", false);
+	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "display/window/handheld/adaptive_performance/min_scaling_3d_scale", PROPERTY_HINT_RANGE, "0.25,1.0,0.01"), 0.5);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "display/window/handheld/adaptive_performance/min_fps", PROPERTY_HINT_RANGE, "1,1000,1"), 30);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "display/window/handheld/adaptive_performance/min_physics_ticks_per_second", PROPERTY_HINT_RANGE, "1,1000,1"), 30);
+	GLOBAL_DEF("display/window/handheld/adaptive_performance/use_performance_hint", true);
 
 	GLOBAL_DEF("application/run/delta_smoothing", true);
 	if (!delta_smoothing_override) {
@@ -2051,6 +2084,7 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 	GLOBAL_DEF_BASIC(PropertyInfo(Variant::INT, "xr/openxr/environment_blend_mode", PROPERTY_HINT_ENUM, "Opaque,Additive,Alpha"), "0");
 
 	GLOBAL_DEF_BASIC("xr/openxr/submit_depth_buffer", false);
+	GLOBAL_DEF_BASIC("xr/openxr/late_latching", false);
 	GLOBAL_DEF_BASIC("xr/openxr/startup_alert", true);
 
 #ifdef TOOLS_ENABLED
@@ -2153,6 +2187,22 @@ Error _parse_resource_dummy(void *p_data, VariantParser::Stream *p_stream, Ref<R
 	return OK;
 }
 
+// Finer startup phases, measured both for --benchmark and as zones for --trace-file.
+static void _begin_startup_phase(const char *p_name) {
+	OS::get_singleton()->benchmark_begin_measure(p_name);
+	TraceRecorder::begin_zone(p_name);
+}
+
+static void _end_startup_phase(const char *p_name) {
+	TraceRecorder::end_zone();
+	OS::get_singleton()->benchmark_end_measure(p_name);
+}
+
+static void _load_text_server_support_data(void *p_userdata) {
+	Ref<TextServer> ts = TextServerManager::get_singleton()->get_primary_interface();
+	ts->load_support_data("res://" + ts->get_support_data_filename());
+}
+
 Error Main::setup2() {
 	Thread::make_main_thread(); // Make whatever thread call this the main thread.
 	set_current_thread_safe_for_nodes(true);
@@ -2173,9 +2223,81 @@ Error Main::setup2() {
 	physics_server_3d_manager = memnew(PhysicsServer3DManager);
 	physics_server_2d_manager = memnew(PhysicsServer2DManager);
 
+	_begin_startup_phase("servers/register_server_types");
 	register_server_types();
 	initialize_modules(MODULE_INITIALIZATION_LEVEL_SERVERS);
 	GDExtensionManager::get_singleton()->initialize_extensions(GDExtension::INITIALIZATION_LEVEL_SERVERS);
+	_end_startup_phase("servers/register_server_types");
+
+	// Independent subsystems are started on other threads while the display and rendering servers are created.
+	bool parallel_startup = GLOBAL_DEF_RST("application/run/parallel_startup", true);
+
+	MAIN_PRINT("Main: Load TextServer");
+
+	/* Enum text drivers */
+	GLOBAL_DEF_RST("internationalization/rendering/text_driver", "");
+	String text_driver_options;
+	for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
+		const String driver_name = TextServerManager::get_singleton()->get_interface(i)->get_name();
+		if (driver_name == "Dummy") {
+			// Dummy text driver cannot draw any text, making the editor unusable if selected.
+			continue;
+		}
+		if (!text_driver_options.is_empty() && text_driver_options.find(",") == -1) {
+			// Not the first option; add a comma before it as a separator for the property hint.
+			text_driver_options += ",";
+		}
+		text_driver_options += driver_name;
+	}
+	ProjectSettings::get_singleton()->set_custom_property_info(PropertyInfo(Variant::STRING, "internationalization/rendering/text_driver", PROPERTY_HINT_ENUM, text_driver_options));
+
+	/* Determine text driver */
+	if (text_driver.is_empty()) {
+		text_driver = GLOBAL_GET("internationalization/rendering/text_driver");
+	}
+
+	if (!text_driver.is_empty()) {
+		/* Load user selected text server. */
+		for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
+			if (TextServerManager::get_singleton()->get_interface(i)->get_name() == text_driver) {
+				text_driver_idx = i;
+				break;
+			}
+		}
+	}
+
+	if (text_driver_idx < 0) {
+		/* If not selected, use one with the most features available. */
+		int max_features = 0;
+		for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
+			uint32_t features = TextServerManager::get_singleton()->get_interface(i)->get_features();
+			int feature_number = 0;
+			while (features) {
+				feature_number += features & 1;
+				features >>= 1;
+			}
+			if (feature_number >= max_features) {
+				max_features = feature_number;
+				text_driver_idx = i;
+			}
+		}
+	}
+	if (text_driver_idx >= 0) {
+		Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(text_driver_idx);
+		TextServerManager::get_singleton()->set_primary_interface(ts);
+		if (ts->has_feature(TextServer::FEATURE_USE_SUPPORT_DATA)) {
+			if (parallel_startup) {
+				// Nothing uses text before the scene types, load it while the display and rendering servers are created.
+				text_data_task = WorkerThreadPool::get_singleton()->add_native_task(&_load_text_server_support_data, nullptr, true, "Load TextServer support data");
+			} else {
+				_load_text_server_support_data(nullptr);
+			}
+		}
+	} else {
+		ERR_FAIL_V_MSG(ERR_CANT_CREATE, "TextServer: Unable to create TextServer interface.");
+	}
+
+	bool audio_initializing = parallel_startup && AudioDriverManager::initialize_threaded(audio_driver_idx);
 
 #ifdef TOOLS_ENABLED
 	if (editor || project_manager || cmdline_tool) {
@@ -2247,6 +2369,7 @@ Error Main::setup2() {
 
 	/* Initialize Display Server */
 
+	_begin_startup_phase("servers/display_server");
 	{
 		String display_driver = DisplayServer::get_create_function_name(display_driver_idx);
 
@@ -2282,6 +2405,7 @@ Error Main::setup2() {
 			return err;
 		}
 	}
+	_end_startup_phase("servers/display_server");
 
 	if (display_server->has_feature(DisplayServer::FEATURE_ORIENTATION)) {
 		display_server->screen_set_orientation(window_orientation);
@@ -2338,9 +2462,18 @@ Error Main::setup2() {
 
 	/* Initialize Rendering Server */
 
-	rendering_server = memnew(RenderingServerDefault(OS::get_singleton()->get_render_thread_mode() == OS::RENDER_SEPARATE_THREAD));
+	// With the dummy rasterizer nothing is drawn, so unless the editor needs the regular behavior
+	// (e.g. for importing), let nodes skip visual-only work and call the server directly.
+	bool server_mode = GLOBAL_DEF_RST("rendering/headless/server_mode", true) && RendererCompositor::is_dummy() && !editor && !project_manager;
+	if (server_mode) {
+		print_verbose("Using the dummy renderer, visual-only processing is skipped (server mode).");
+	}
+
+	_begin_startup_phase("servers/rendering_server");
+	rendering_server = memnew(RenderingServerDefault(!server_mode && OS::get_singleton()->get_render_thread_mode() == OS::RENDER_SEPARATE_THREAD, server_mode));
 
 	rendering_server->init();
+	_end_startup_phase("servers/rendering_server");
 	//rendering_server->call_set_use_vsync(OS::get_singleton()->_use_vsync);
 	rendering_server->set_render_loop_enabled(!disable_render_loop);
 
@@ -2367,7 +2500,12 @@ Error Main::setup2() {
 
 	/* Initialize Audio Driver */
 
-	AudioDriverManager::initialize(audio_driver_idx);
+	_begin_startup_phase("servers/audio");
+	if (audio_initializing) {
+		AudioDriverManager::wait_for_initialization();
+	} else {
+		AudioDriverManager::initialize(audio_driver_idx);
+	}
 
 	print_line(" "); //add a blank line for readability
 
@@ -2375,6 +2513,7 @@ Error Main::setup2() {
 
 	audio_server = memnew(AudioServer);
 	audio_server->init();
+	_end_startup_phase("servers/audio");
 
 	// also init our xr_server from here
 	xr_server = memnew(XRServer);
@@ -2476,6 +2615,7 @@ Error Main::setup2() {
 	Input *id = Input::get_singleton();
 	if (id) {
 		agile_input_event_flushing = GLOBAL_DEF("input_devices/buffering/agile_event_flushing", false);
+		late_input_sampling = GLOBAL_DEF("input_devices/buffering/late_input_sampling", false);
 
 		if (bool(GLOBAL_DEF_BASIC("input_devices/pointing/emulate_touch_from_mouse", false)) &&
 				!(editor || project_manager)) {
@@ -2499,64 +2639,11 @@ Error Main::setup2() {
 
 	ResourceLoader::load_path_remaps();
 
-	MAIN_PRINT("Main: Load TextServer");
-
-	/* Enum text drivers */
-	GLOBAL_DEF_RST("internationalization/rendering/text_driver", "");
-	String text_driver_options;
-	for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
-		const String driver_name = TextServerManager::get_singleton()->get_interface(i)->get_name();
-		if (driver_name == "Dummy") {
-			// Dummy text driver cannot draw any text, making the editor unusable if selected.
-			continue;
-		}
-		if (!text_driver_options.is_empty() && text_driver_options.find(",") == -1) {
-			// Not the first option; add a comma before it as a separator for the property hint.
-			text_driver_options += ",";
-		}
-		text_driver_options += driver_name;
-	}
-	ProjectSettings::get_singleton()->set_custom_property_info(PropertyInfo(Variant::STRING, "internationalization/rendering/text_driver", PROPERTY_HINT_ENUM, text_driver_options));
-
-	/* Determine text driver */
-	if (text_driver.is_empty()) {
-		text_driver = GLOBAL_GET("internationalization/rendering/text_driver");
-	}
-
-	if (!text_driver.is_empty()) {
-		/* Load user selected text server. */
-		for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
-			if (TextServerManager::get_singleton()->get_interface(i)->get_name() == text_driver) {
-				text_driver_idx = i;
-				break;
-			}
-		}
-	}
-
-	if (text_driver_idx < 0) {
-		/* If not selected, use one with the most features available. */
-		int max_features = 0;
-		for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
-			uint32_t features = TextServerManager::get_singleton()->get_interface(i)->get_features();
-			int feature_number = 0;
-			while (features) {
-				feature_number += features & 1;
-				features >>= 1;
-			}
-			if (feature_number >= max_features) {
-				max_features = feature_number;
-				text_driver_idx = i;
-			}
-		}
-	}
-	if (text_driver_idx >= 0) {
-		Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(text_driver_idx);
-		TextServerManager::get_singleton()->set_primary_interface(ts);
-		if (ts->has_feature(TextServer::FEATURE_USE_SUPPORT_DATA)) {
-			ts->load_support_data("res://" + ts->get_support_data_filename());
-		}
-	} else {
-		ERR_FAIL_V_MSG(ERR_CANT_CREATE, "TextServer: Unable to create TextServer interface.");
+	if (text_data_task != WorkerThreadPool::INVALID_TASK_ID) {
+		_begin_startup_phase("servers/text_server_wait");
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(text_data_task);
+		text_data_task = WorkerThreadPool::INVALID_TASK_ID;
+		_end_startup_phase("servers/text_server_wait");
 	}
 
 	OS::get_singleton()->benchmark_end_measure("servers");
@@ -2569,11 +2656,14 @@ Error Main::setup2() {
 	// Default theme will be initialized later, after modules and ScriptServer are ready.
 	initialize_theme_db();
 
+	_begin_startup_phase("scene/register_scene_types");
 	register_scene_types();
 	register_driver_types();
 
 	register_scene_singletons();
+	_end_startup_phase("scene/register_scene_types");
 
+	_begin_startup_phase("scene/modules");
 	initialize_modules(MODULE_INITIALIZATION_LEVEL_SCENE);
 	GDExtensionManager::get_singleton()->initialize_extensions(GDExtension::INITIALIZATION_LEVEL_SCENE);
 
@@ -2585,7 +2675,10 @@ Error Main::setup2() {
 
 	ClassDB::set_current_api(ClassDB::API_CORE);
 
+	// The editor and the documentation tools walk the class list directly, so bind everything now.
+	ClassDB::initialize_lazy_classes();
 #endif
+	_end_startup_phase("scene/modules");
 
 	MAIN_PRINT("Main: Load Modules");
 
@@ -2608,14 +2701,18 @@ Error Main::setup2() {
 
 	MAIN_PRINT("Main: Load Physics");
 
+	_begin_startup_phase("scene/physics_navigation");
 	initialize_physics();
 	initialize_navigation_server();
+	_end_startup_phase("scene/physics_navigation");
 	register_server_singletons();
 
 	// This loads global classes, so it must happen before custom loaders and savers are registered
 	ScriptServer::init_languages();
 
+	_begin_startup_phase("scene/theme");
 	theme_db->initialize_theme();
+	_end_startup_phase("scene/theme");
 	audio_server->load_default_bus_layout();
 
 #if defined(MODULE_MONO_ENABLED) && defined(TOOLS_ENABLED)
@@ -2644,6 +2741,7 @@ Error Main::setup2() {
 	_start_success = true;
 
 	ClassDB::set_current_api(ClassDB::API_NONE); //no more APIs are registered at this point
+	ClassDB::build_lookup_tables();
 
 	print_verbose("CORE API HASH: " + uitos(ClassDB::get_api_hash(ClassDB::API_CORE)));
 	print_verbose("EDITOR API HASH: " + uitos(ClassDB::get_api_hash(ClassDB::API_EDITOR)));
@@ -3396,6 +3494,7 @@ uint32_t Main::frame = 0;
 bool Main::force_redraw_requested = false;
 int Main::iterating = 0;
 bool Main::agile_input_event_flushing = false;
+bool Main::late_input_sampling = false;
 
 bool Main::is_iterating() {
 	return iterating > 0;
@@ -3412,6 +3511,8 @@ bool Main::iteration() {
 
 	iterating++;
 
+	TRACE_ZONE("Main::iteration");
+
 	const uint64_t ticks = OS::get_singleton()->get_ticks_usec();
 	Engine::get_singleton()->_frame_ticks = ticks;
 	main_timer_sync.set_cpu_ticks_usec(ticks);
@@ -3451,6 +3552,8 @@ bool Main::iteration() {
 	XRServer::get_singleton()->_process();
 
 	for (int iters = 0; iters < advance.physics_steps; ++iters) {
+		TRACE_ZONE("Physics frame");
+
 		if (Input::get_singleton()->is_using_input_buffering() && agile_input_event_flushing) {
 			Input::get_singleton()->flush_buffered_events();
 		}
@@ -3475,7 +3578,9 @@ bool Main::iteration() {
 
 		uint64_t navigation_begin = OS::get_singleton()->get_ticks_usec();
 
+		TraceRecorder::begin_zone("NavigationServer3D::process");
 		NavigationServer3D::get_singleton()->process(physics_step * time_scale);
+		TraceRecorder::end_zone();
 
 		navigation_process_ticks = MAX(navigation_process_ticks, OS::get_singleton()->get_ticks_usec() - navigation_begin); // keep the largest one for reference
 		navigation_process_max = MAX(OS::get_singleton()->get_ticks_usec() - navigation_begin, navigation_process_max);
@@ -3483,13 +3588,18 @@ bool Main::iteration() {
 		message_queue->flush();
 
 		PhysicsServer3D::get_singleton()->end_sync();
+		TraceRecorder::begin_zone("PhysicsServer3D::step");
 		PhysicsServer3D::get_singleton()->step(physics_step * time_scale);
+		TraceRecorder::end_zone();
 
 		PhysicsServer2D::get_singleton()->end_sync();
+		TraceRecorder::begin_zone("PhysicsServer2D::step");
 		PhysicsServer2D::get_singleton()->step(physics_step * time_scale);
+		TraceRecorder::end_zone();
 
 		message_queue->flush();
 
+		performance->record_histogram_value(Performance::HISTOGRAM_PHYSICS_PROCESS_TIME, USEC_TO_SEC(OS::get_singleton()->get_ticks_usec() - physics_begin));
 		physics_process_ticks = MAX(physics_process_ticks, OS::get_singleton()->get_ticks_usec() - physics_begin); // keep the largest one for reference
 		physics_process_max = MAX(OS::get_singleton()->get_ticks_usec() - physics_begin, physics_process_max);
 		Engine::get_singleton()->_physics_frames++;
@@ -3503,21 +3613,39 @@ bool Main::iteration() {
 
 	uint64_t process_begin = OS::get_singleton()->get_ticks_usec();
 
+	TraceRecorder::begin_zone("MainLoop::process");
 	if (OS::get_singleton()->get_main_loop()->process(process_step * time_scale)) {
 		exit = true;
 	}
 	message_queue->flush();
+	TraceRecorder::end_zone();
+
+	if (late_input_sampling && !exit) {
+		// Poll again right before drawing, so input handlers that move cameras or cursors
+		// are reflected in this frame instead of the next one.
+		TraceRecorder::begin_zone("Late input sampling");
+		DisplayServer::get_singleton()->process_events();
+		if (Input::get_singleton()->is_using_input_buffering()) {
+			Input::get_singleton()->flush_buffered_events();
+		}
+		message_queue->flush();
+		TraceRecorder::end_zone();
+	}
 
+	TraceRecorder::begin_zone("RenderingServer::sync");
 	RenderingServer::get_singleton()->sync(); //sync if still drawing from previous frames.
+	TraceRecorder::end_zone();
 
 	if (DisplayServer::get_singleton()->can_any_window_draw() &&
 			RenderingServer::get_singleton()->is_render_loop_enabled()) {
 		if ((!force_redraw_requested) && OS::get_singleton()->is_in_low_processor_usage_mode()) {
 			if (RenderingServer::get_singleton()->has_changed()) {
+				TRACE_ZONE("RenderingServer::draw");
 				RenderingServer::get_singleton()->draw(true, scaled_step); // flush visual commands
 				Engine::get_singleton()->frames_drawn++;
 			}
 		} else {
+			TRACE_ZONE("RenderingServer::draw");
 			RenderingServer::get_singleton()->draw(true, scaled_step); // flush visual commands
 			Engine::get_singleton()->frames_drawn++;
 			force_redraw_requested = false;
@@ -3526,6 +3654,8 @@ bool Main::iteration() {
 
 	process_ticks = OS::get_singleton()->get_ticks_usec() - process_begin;
 	process_max = MAX(process_ticks, process_max);
+	performance->record_histogram_value(Performance::HISTOGRAM_PROCESS_TIME, USEC_TO_SEC(process_ticks));
+	performance->record_histogram_value(Performance::HISTOGRAM_FRAME_TIME, USEC_TO_SEC(ticks_elapsed));
 	uint64_t frame_time = OS::get_singleton()->get_ticks_usec() - ticks;
 
 	for (int i = 0; i < ScriptServer::get_language_count(); i++) {
@@ -3559,6 +3689,9 @@ bool Main::iteration() {
 		performance->set_process_time(USEC_TO_SEC(process_max));
 		performance->set_physics_process_time(USEC_TO_SEC(physics_process_max));
 		performance->set_navigation_process_time(USEC_TO_SEC(navigation_process_max));
+		performance->update_memory_tag_rates();
+		performance->update_histograms();
+		performance->send_metrics();
 		process_max = 0;
 		physics_process_max = 0;
 		navigation_process_max = 0;
@@ -3620,6 +3753,14 @@ void Main::force_redraw() {
  */
 void Main::cleanup(bool p_force) {
 	OS::get_singleton()->benchmark_begin_measure("Main::cleanup");
+	TraceRecorder::stop();
+
+	// In case setup2() failed while they were still running.
+	if (text_data_task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(text_data_task);
+		text_data_task = WorkerThreadPool::INVALID_TASK_ID;
+	}
+	AudioDriverManager::wait_for_initialization();
 	if (!p_force) {
 		ERR_FAIL_COND(!_start_success);
 	}
@@ -3642,6 +3783,8 @@ void Main::cleanup(bool p_force) {
 
 	OS::get_singleton()->delete_main_loop();
 
+	ResourceCache::clear_retained();
+
 	OS::get_singleton()->_cmdline.clear();
 	OS::get_singleton()->_user_args.clear();
 	OS::get_singleton()->_execpath = "";
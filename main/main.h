@@ -47,6 +47,7 @@ class Main {
 	static bool force_redraw_requested;
 	static int iterating;
 	static bool agile_input_event_flushing;
+	static bool late_input_sampling;
 
 public:
 	static bool is_cmdline_tool();
@@ -30,6 +30,8 @@
 
 #include "performance.h"
 
+#include "core/config/project_settings.h"
+#include "core/io/ip.h"
 #include "core/object/message_queue.h"
 #include "core/os/os.h"
 #include "core/variant/typed_array.h"
@@ -51,6 +53,16 @@ void Performance::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_custom_monitor", "id"), &Performance::get_custom_monitor);
 	ClassDB::bind_method(D_METHOD("get_monitor_modification_time"), &Performance::get_monitor_modification_time);
 	ClassDB::bind_method(D_METHOD("get_custom_monitor_names"), &Performance::get_custom_monitor_names);
+	ClassDB::bind_method(D_METHOD("add_custom_histogram", "id", "hitch_threshold"), &Performance::add_custom_histogram, DEFVAL(0.0));
+	ClassDB::bind_method(D_METHOD("remove_custom_histogram", "histogram"), &Performance::remove_custom_histogram);
+	ClassDB::bind_method(D_METHOD("find_histogram", "id"), &Performance::find_histogram);
+	ClassDB::bind_method(D_METHOD("record_histogram_value", "histogram", "value"), &Performance::record_histogram_value);
+	ClassDB::bind_method(D_METHOD("get_histogram_percentile", "histogram", "percentile"), &Performance::get_histogram_percentile);
+	ClassDB::bind_method(D_METHOD("get_histogram_statistics", "histogram"), &Performance::get_histogram_statistics);
+	ClassDB::bind_method(D_METHOD("get_memory_tag_names"), &Performance::get_memory_tag_names);
+	ClassDB::bind_method(D_METHOD("get_memory_tag_usage", "tag"), &Performance::get_memory_tag_usage);
+	ClassDB::bind_method(D_METHOD("get_memory_tag_max_usage", "tag"), &Performance::get_memory_tag_max_usage);
+	ClassDB::bind_method(D_METHOD("get_memory_tag_allocation_rate", "tag"), &Performance::get_memory_tag_allocation_rate);
 
 	BIND_ENUM_CONSTANT(TIME_FPS);
 	BIND_ENUM_CONSTANT(TIME_PROCESS);
@@ -85,7 +97,17 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(NAVIGATION_EDGE_MERGE_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_EDGE_CONNECTION_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_EDGE_FREE_COUNT);
+	BIND_ENUM_CONSTANT(OBJECT_STRING_NAME_COUNT);
+	BIND_ENUM_CONSTANT(OBJECT_STRING_NAME_CONTENTION);
+	BIND_ENUM_CONSTANT(OBJECT_MESSAGE_QUEUE_FLUSHED);
+	BIND_ENUM_CONSTANT(TIME_MESSAGE_QUEUE_FLUSH);
+	BIND_ENUM_CONSTANT(TIME_GPU_FRAME);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
+
+	BIND_ENUM_CONSTANT(HISTOGRAM_FRAME_TIME);
+	BIND_ENUM_CONSTANT(HISTOGRAM_PROCESS_TIME);
+	BIND_ENUM_CONSTANT(HISTOGRAM_PHYSICS_PROCESS_TIME);
+	BIND_ENUM_CONSTANT(HISTOGRAM_BUILTIN_MAX);
 }
 
 int Performance::_get_node_count() const {
@@ -133,6 +155,11 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		"navigation/edges_merged",
 		"navigation/edges_connected",
 		"navigation/edges_free",
+		"object/string_names",
+		"object/string_name_contention",
+		"object/message_queue_flushed",
+		"time/message_queue_flush",
+		"time/gpu_frame",
 
 	};
 
@@ -207,6 +234,16 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_EDGE_CONNECTION_COUNT);
 		case NAVIGATION_EDGE_FREE_COUNT:
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_EDGE_FREE_COUNT);
+		case OBJECT_STRING_NAME_COUNT:
+			return StringName::get_interned_count();
+		case OBJECT_STRING_NAME_CONTENTION:
+			return StringName::get_lock_contention_count();
+		case OBJECT_MESSAGE_QUEUE_FLUSHED:
+			return MessageQueue::get_last_frame_flushed_messages();
+		case TIME_MESSAGE_QUEUE_FLUSH:
+			return MessageQueue::get_last_frame_flush_usec() / 1000000.0;
+		case TIME_GPU_FRAME:
+			return RS::get_singleton()->get_frame_profile_gpu_time(true) / 1000.0;
 
 		default: {
 		}
@@ -252,6 +289,11 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
 
 	};
 
@@ -270,6 +312,55 @@ void Performance::set_navigation_process_time(double p_pt) {
 	_navigation_process_time = p_pt;
 }
 
+// Called about once per second.
+void Performance::update_memory_tag_rates() {
+	uint64_t ticks = OS::get_singleton()->get_ticks_usec();
+	double elapsed = USEC_TO_SEC(ticks - _memory_tag_rate_ticks);
+	for (uint32_t i = 0; i < Memory::get_tag_count(); i++) {
+		uint64_t allocations = Memory::get_tag_allocations(i);
+		if (_memory_tag_rate_ticks != 0 && elapsed > 0.0) {
+			_memory_tag_allocation_rates[i] = (allocations - _memory_tag_allocations[i]) / elapsed;
+		}
+		_memory_tag_allocations[i] = allocations;
+	}
+	_memory_tag_rate_ticks = ticks;
+}
+
+int Performance::_find_memory_tag(const String &p_tag) const {
+	for (uint32_t i = 0; i < Memory::get_tag_count(); i++) {
+		if (p_tag == Memory::get_tag_name(i)) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+PackedStringArray Performance::get_memory_tag_names() const {
+	PackedStringArray names;
+	for (uint32_t i = 0; i < Memory::get_tag_count(); i++) {
+		names.push_back(Memory::get_tag_name(i));
+	}
+	return names;
+}
+
+uint64_t Performance::get_memory_tag_usage(const String &p_tag) const {
+	int tag = _find_memory_tag(p_tag);
+	ERR_FAIL_COND_V_MSG(tag == -1, 0, "Memory tag not found: " + p_tag + ".");
+	return Memory::get_tag_usage(tag);
+}
+
+uint64_t Performance::get_memory_tag_max_usage(const String &p_tag) const {
+	int tag = _find_memory_tag(p_tag);
+	ERR_FAIL_COND_V_MSG(tag == -1, 0, "Memory tag not found: " + p_tag + ".");
+	return Memory::get_tag_max_usage(tag);
+}
+
+double Performance::get_memory_tag_allocation_rate(const String &p_tag) const {
+	int tag = _find_memory_tag(p_tag);
+	ERR_FAIL_COND_V_MSG(tag == -1, 0, "Memory tag not found: " + p_tag + ".");
+	return _memory_tag_allocation_rates[tag];
+}
+
 void Performance::add_custom_monitor(const StringName &p_id, const Callable &p_callable, const Vector<Variant> &p_args) {
 	ERR_FAIL_COND_MSG(has_custom_monitor(p_id), "Custom monitor with id '" + String(p_id) + "' already exists.");
 	_monitor_map.insert(p_id, MonitorCall(p_callable, p_args));
@@ -321,6 +412,264 @@ Performance::Performance() {
 	singleton = this;
 }
 
+Performance::~Performance() {
+	for (int i = 0; i < MAX_HISTOGRAMS; i++) {
+		if (_histograms[i]) {
+			memdelete(_histograms[i]);
+		}
+	}
+}
+
+uint32_t Performance::HistogramRecorder::get_bucket(double p_value) {
+	if (!(p_value >= Math::pow(2.0, (double)MIN_EXPONENT))) {
+		return 0;
+	}
+	int exponent;
+	double mantissa = frexp(p_value, &exponent); // In [0.5, 1).
+	int octave = exponent - 1 - MIN_EXPONENT;
+	if (octave >= OCTAVES) {
+		return BUCKET_COUNT - 1;
+	}
+	uint32_t sub_bucket = MIN(uint32_t((mantissa * 2.0 - 1.0) * SUB_BUCKETS), uint32_t(SUB_BUCKETS - 1));
+	return 1 + octave * SUB_BUCKETS + sub_bucket;
+}
+
+double Performance::HistogramRecorder::get_bucket_value(uint32_t p_bucket) {
+	if (p_bucket == 0) {
+		return 0.0;
+	}
+	uint32_t octave = (p_bucket - 1) / SUB_BUCKETS;
+	uint32_t sub_bucket = (p_bucket - 1) % SUB_BUCKETS;
+	double octave_start = Math::pow(2.0, double(int(octave) + MIN_EXPONENT));
+	// Middle of the bucket.
+	return octave_start * (1.0 + (sub_bucket + 0.5) / SUB_BUCKETS);
+}
+
+void Performance::HistogramRecorder::reset(uint32_t p_window_seconds) {
+	for (uint32_t i = 0; i < BUCKET_COUNT; i++) {
+		current[i].set(0);
+	}
+	current_hitches.set(0);
+	window.resize(p_window_seconds * BUCKET_COUNT);
+	memset(window.ptr(), 0, window.size() * sizeof(uint32_t));
+	window_hitches.resize(p_window_seconds);
+	memset(window_hitches.ptr(), 0, window_hitches.size() * sizeof(uint32_t));
+	window_index = 0;
+}
+
+void Performance::HistogramRecorder::record(double p_value) {
+	current[get_bucket(p_value)].increment();
+	if (hitch_threshold > 0.0 && p_value > hitch_threshold) {
+		current_hitches.increment();
+	}
+}
+
+// Moves the current second into the window, replacing the oldest one. Values recorded meanwhile land in either.
+void Performance::HistogramRecorder::rotate() {
+	uint32_t *slot = &window[window_index * BUCKET_COUNT];
+	for (uint32_t i = 0; i < BUCKET_COUNT; i++) {
+		slot[i] = current[i].bit_and(0); // Takes the count and clears it atomically.
+	}
+	window_hitches[window_index] = current_hitches.bit_and(0);
+	window_index = (window_index + 1) % window_hitches.size();
+}
+
+void Performance::HistogramRecorder::get_counts(uint32_t *r_counts, uint64_t &r_total, uint64_t &r_hitches) const {
+	r_total = 0;
+	r_hitches = 0;
+	for (uint32_t i = 0; i < BUCKET_COUNT; i++) {
+		r_counts[i] = 0;
+	}
+	for (uint32_t s = 0; s < window_hitches.size(); s++) {
+		const uint32_t *slot = &window[s * BUCKET_COUNT];
+		for (uint32_t i = 0; i < BUCKET_COUNT; i++) {
+			r_counts[i] += slot[i];
+		}
+		r_hitches += window_hitches[s];
+	}
+	for (uint32_t i = 0; i < BUCKET_COUNT; i++) {
+		r_total += r_counts[i];
+	}
+}
+
+int Performance::_add_histogram(const StringName &p_id, double p_hitch_threshold) {
+	MutexLock lock(_histogram_mutex);
+	for (int i = 0; i < MAX_HISTOGRAMS; i++) {
+		ERR_FAIL_COND_V_MSG(_histogram_in_use[i].is_set() && _histograms[i]->id == p_id, -1, "Histogram with id '" + String(p_id) + "' already exists.");
+	}
+	for (int i = 0; i < MAX_HISTOGRAMS; i++) {
+		if (_histogram_in_use[i].is_set()) {
+			continue;
+		}
+		// Removed histograms are reused instead of freed, recording from another thread may still be using them.
+		if (!_histograms[i]) {
+			_histograms[i] = memnew(HistogramRecorder);
+		}
+		_histograms[i]->id = p_id;
+		_histograms[i]->hitch_threshold = p_hitch_threshold;
+		_histograms[i]->reset(_histogram_window_seconds);
+		_histogram_in_use[i].set();
+		return i;
+	}
+	ERR_FAIL_V_MSG(-1, vformat("Can't add histogram '%s', the maximum of %d histograms was reached.", p_id, MAX_HISTOGRAMS));
+}
+
+void Performance::setup_metrics() {
+	_histogram_window_seconds = MAX(1, (int)GLOBAL_GET("debug/settings/metrics/histogram_window_seconds"));
+	double hitch_threshold = double(GLOBAL_GET("debug/settings/metrics/hitch_threshold_msec")) / 1000.0;
+
+	// Built-in histograms always take the first slots, to match the Histogram enum.
+	_add_histogram(SNAME("time/frame"), hitch_threshold);
+	_add_histogram(SNAME("time/process"), hitch_threshold);
+	_add_histogram(SNAME("time/physics_process"), hitch_threshold);
+
+	String address = GLOBAL_GET("debug/settings/metrics/statsd_address");
+	if (address.is_empty()) {
+		return;
+	}
+	String host = address.get_slice(":", 0);
+	int port = address.contains(":") ? address.get_slice(":", 1).to_int() : 8125;
+	IPAddress ip = host.is_valid_ip_address() ? IPAddress(host) : IP::get_singleton()->resolve_hostname(host);
+	ERR_FAIL_COND_MSG(!ip.is_valid(), "Can't resolve the metrics address: " + address + ".");
+
+	_metrics_peer.instantiate();
+	Error err = _metrics_peer->connect_to_host(ip, port);
+	if (err != OK) {
+		_metrics_peer.unref();
+		ERR_FAIL_MSG("Can't send metrics to: " + address + ".");
+	}
+	_metrics_prefix = GLOBAL_GET("debug/settings/metrics/statsd_prefix");
+	print_verbose("Sending metrics to: " + address);
+}
+
+void Performance::update_histograms() {
+	for (int i = 0; i < MAX_HISTOGRAMS; i++) {
+		if (_histogram_in_use[i].is_set()) {
+			_histograms[i]->rotate();
+		}
+	}
+}
+
+int Performance::add_custom_histogram(const StringName &p_id, double p_hitch_threshold) {
+	return _add_histogram(p_id, p_hitch_threshold);
+}
+
+void Performance::remove_custom_histogram(int p_histogram) {
+	ERR_FAIL_COND_MSG(p_histogram < HISTOGRAM_BUILTIN_MAX, "Built-in histograms can't be removed.");
+	ERR_FAIL_COND(!_is_histogram_valid(p_histogram));
+	MutexLock lock(_histogram_mutex);
+	_histogram_in_use[p_histogram].clear();
+}
+
+int Performance::find_histogram(const StringName &p_id) {
+	MutexLock lock(_histogram_mutex);
+	for (int i = 0; i < MAX_HISTOGRAMS; i++) {
+		if (_histogram_in_use[i].is_set() && _histograms[i]->id == p_id) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+double Performance::get_histogram_percentile(int p_histogram, double p_percentile) const {
+	ERR_FAIL_COND_V(!_is_histogram_valid(p_histogram), 0.0);
+	ERR_FAIL_COND_V(p_percentile < 0.0 || p_percentile > 100.0, 0.0);
+
+	uint32_t counts[HistogramRecorder::BUCKET_COUNT];
+	uint64_t total;
+	uint64_t hitches;
+	_histograms[p_histogram]->get_counts(counts, total, hitches);
+	if (total == 0) {
+		return 0.0;
+	}
+
+	uint64_t rank = MAX(uint64_t(1), uint64_t(Math::ceil(p_percentile / 100.0 * total)));
+	uint64_t accumulated = 0;
+	for (uint32_t i = 0; i < HistogramRecorder::BUCKET_COUNT; i++) {
+		accumulated += counts[i];
+		if (accumulated >= rank) {
+			return HistogramRecorder::get_bucket_value(i);
+		}
+	}
+	return 0.0;
+}
+
+Dictionary Performance::get_histogram_statistics(int p_histogram) const {
+	ERR_FAIL_COND_V(!_is_histogram_valid(p_histogram), Dictionary());
+
+	uint32_t counts[HistogramRecorder::BUCKET_COUNT];
+	uint64_t total;
+	uint64_t hitches;
+	_histograms[p_histogram]->get_counts(counts, total, hitches);
+
+	const double percentiles[] = { 50.0, 95.0, 99.0, 100.0 };
+	const char *names[] = { "p50", "p95", "p99", "max" };
+	double values[] = { 0.0, 0.0, 0.0, 0.0 };
+	uint64_t accumulated = 0;
+	int next = 0;
+	for (uint32_t i = 0; i < HistogramRecorder::BUCKET_COUNT && next < 4 && total > 0; i++) {
+		accumulated += counts[i];
+		while (next < 4 && accumulated >= MAX(uint64_t(1), uint64_t(Math::ceil(percentiles[next] / 100.0 * total)))) {
+			values[next++] = HistogramRecorder::get_bucket_value(i);
+		}
+	}
+
+	Dictionary stats;
+	stats["count"] = total;
+	stats["hitches"] = hitches;
+	for (int i = 0; i < 4; i++) {
+		stats[names[i]] = values[i];
+	}
+	return stats;
+}
+
+void Performance::_send_metric(String &r_packet, const String &p_name, double p_value) {
+	String line = _metrics_prefix + "." + p_name.replace("/", ".").replace(" ", "_") + ":" + String::num(p_value) + "|g\n";
+	if (r_packet.length() + line.length() > METRICS_PACKET_SIZE && !r_packet.is_empty()) {
+		CharString utf8 = r_packet.utf8();
+		_metrics_peer->put_packet((const uint8_t *)utf8.get_data(), utf8.length());
+		r_packet = String();
+	}
+	r_packet += line;
+}
+
+// Sends every monitor and the statistics of every histogram as StatsD gauges, if an address is set.
+void Performance::send_metrics() {
+	if (_metrics_peer.is_null()) {
+		return;
+	}
+
+	String packet;
+	for (int i = 0; i < MONITOR_MAX; i++) {
+		_send_metric(packet, get_monitor_name(Monitor(i)), get_monitor(Monitor(i)));
+	}
+
+	for (KeyValue<StringName, MonitorCall> &E : _monitor_map) {
+		bool error;
+		String error_message;
+		Variant value = E.value.call(error, error_message);
+		if (!error && (value.get_type() == Variant::INT || value.get_type() == Variant::FLOAT)) {
+			_send_metric(packet, E.key, value);
+		}
+	}
+
+	for (int i = 0; i < MAX_HISTOGRAMS; i++) {
+		if (!_histogram_in_use[i].is_set()) {
+			continue;
+		}
+		Dictionary stats = get_histogram_statistics(i);
+		String name = String(_histograms[i]->id) + ".";
+		for (const Variant *key = stats.next(); key; key = stats.next(key)) {
+			_send_metric(packet, name + String(*key), stats[*key]);
+		}
+	}
+
+	if (!packet.is_empty()) {
+		CharString utf8 = packet.utf8();
+		_metrics_peer->put_packet((const uint8_t *)utf8.get_data(), utf8.length());
+	}
+}
+
 Performance::MonitorCall::MonitorCall(Callable p_callable, Vector<Variant> p_arguments) {
 	_callable = p_callable;
 	_arguments = p_arguments;
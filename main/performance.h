@@ -31,8 +31,10 @@
 #ifndef PERFORMANCE_H
 #define PERFORMANCE_H
 
+#include "core/io/packet_peer_udp.h"
 #include "core/object/class_db.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 
 #define PERF_WARN_OFFLINE_FUNCTION
 #define PERF_WARN_PROCESS_SYNC
@@ -52,6 +54,61 @@ class Performance : public Object {
 	double _physics_process_time;
 	double _navigation_process_time;
 
+	uint64_t _memory_tag_rate_ticks = 0;
+	uint64_t _memory_tag_allocations[Memory::MAX_TAGS] = {};
+	double _memory_tag_allocation_rates[Memory::MAX_TAGS] = {};
+
+	int _find_memory_tag(const String &p_tag) const;
+
+	// Log-scale histogram over a rolling window of whole seconds. Values are recorded into
+	// the current second with atomic increments only, so any thread can record without locking.
+	class HistogramRecorder {
+	public:
+		enum {
+			SUB_BUCKETS = 8, // About 6% precision.
+			MIN_EXPONENT = -20, // Smaller values, including zero and negative ones, go to the first bucket.
+			OCTAVES = 40,
+			BUCKET_COUNT = 1 + SUB_BUCKETS * OCTAVES,
+		};
+
+		StringName id;
+		double hitch_threshold = 0.0; // Values above it count as hitches, if not zero.
+
+		SafeNumeric<uint32_t> current[BUCKET_COUNT];
+		SafeNumeric<uint32_t> current_hitches;
+
+		// Completed seconds, oldest first from window_index.
+		LocalVector<uint32_t> window;
+		LocalVector<uint32_t> window_hitches;
+		uint32_t window_index = 0;
+
+		static uint32_t get_bucket(double p_value);
+		static double get_bucket_value(uint32_t p_bucket);
+
+		void reset(uint32_t p_window_seconds);
+		void record(double p_value);
+		void rotate();
+		void get_counts(uint32_t *r_counts, uint64_t &r_total, uint64_t &r_hitches) const;
+	};
+
+	enum {
+		MAX_HISTOGRAMS = 64,
+		METRICS_PACKET_SIZE = 1400, // Stays below the usual MTU.
+	};
+
+	HistogramRecorder *_histograms[MAX_HISTOGRAMS] = {};
+	SafeFlag _histogram_in_use[MAX_HISTOGRAMS];
+	uint32_t _histogram_window_seconds = 60;
+	Mutex _histogram_mutex; // For adding and removing, not for recording.
+
+	_FORCE_INLINE_ bool _is_histogram_valid(int p_histogram) const { return p_histogram >= 0 && p_histogram < MAX_HISTOGRAMS && _histogram_in_use[p_histogram].is_set(); }
+	int _add_histogram(const StringName &p_id, double p_hitch_threshold);
+
+	Ref<PacketPeerUDP> _metrics_peer;
+	String _metrics_prefix;
+
+	void _send_metric(String &r_packet, const String &p_name, double p_value);
+
 	class MonitorCall {
 		Callable _callable;
 		Vector<Variant> _arguments;
@@ -100,9 +157,21 @@ public:
 		NAVIGATION_EDGE_MERGE_COUNT,
 		NAVIGATION_EDGE_CONNECTION_COUNT,
 		NAVIGATION_EDGE_FREE_COUNT,
+		OBJECT_STRING_NAME_COUNT,
+		OBJECT_STRING_NAME_CONTENTION,
+		OBJECT_MESSAGE_QUEUE_FLUSHED,
+		TIME_MESSAGE_QUEUE_FLUSH,
+		TIME_GPU_FRAME,
 		MONITOR_MAX
 	};
 
+	enum Histogram {
+		HISTOGRAM_FRAME_TIME,
+		HISTOGRAM_PROCESS_TIME,
+		HISTOGRAM_PHYSICS_PROCESS_TIME,
+		HISTOGRAM_BUILTIN_MAX
+	};
+
 	enum MonitorType {
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_MEMORY,
@@ -117,6 +186,26 @@ public:
 	void set_process_time(double p_pt);
 	void set_physics_process_time(double p_pt);
 	void set_navigation_process_time(double p_pt);
+	void update_memory_tag_rates();
+
+	void setup_metrics();
+	void update_histograms(); // Called once per second.
+	void send_metrics();
+
+	int add_custom_histogram(const StringName &p_id, double p_hitch_threshold = 0.0);
+	void remove_custom_histogram(int p_histogram);
+	int find_histogram(const StringName &p_id);
+	_FORCE_INLINE_ void record_histogram_value(int p_histogram, double p_value) {
+		ERR_FAIL_COND(!_is_histogram_valid(p_histogram));
+		_histograms[p_histogram]->record(p_value);
+	}
+	double get_histogram_percentile(int p_histogram, double p_percentile) const;
+	Dictionary get_histogram_statistics(int p_histogram) const;
+
+	PackedStringArray get_memory_tag_names() const;
+	uint64_t get_memory_tag_usage(const String &p_tag) const;
+	uint64_t get_memory_tag_max_usage(const String &p_tag) const;
+	double get_memory_tag_allocation_rate(const String &p_tag) const;
 
 	void add_custom_monitor(const StringName &p_id, const Callable &p_callable, const Vector<Variant> &p_args);
 	void remove_custom_monitor(const StringName &p_id);
@@ -129,8 +218,10 @@ public:
 	static Performance *get_singleton() { return singleton; }
 
 	Performance();
+	~Performance();
 };
 
 VARIANT_ENUM_CAST(Performance::Monitor);
+VARIANT_ENUM_CAST(Performance::Histogram);
 
 #endif // PERFORMANCE_H
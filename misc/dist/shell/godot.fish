@@ -113,4 +113,5 @@ complete -c godot -l dump-gdextension-interface -d "Generate GDExtension header
 complete -c godot -l dump-extension-api -d "Generate JSON dump of the Godot API for GDExtension bindings named 'extension_api.json' in the current folder"
 complete -c godot -l benchmark -d "Benchmark the run time and print it to console"
 complete -c godot -l benchmark-file -d "Benchmark the run time and save it to a given file in JSON format" -x
+complete -c godot -l trace-file -d "Record engine zones on every thread and save them to a given file in the Chrome trace format" -x
 complete -c godot -l test -d "Run all unit tests; run with '--test --help' for more information" -x
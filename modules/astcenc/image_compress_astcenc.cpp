@@ -30,11 +30,34 @@
 
 #include "image_compress_astcenc.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/string/print_string.h"
+#include "core/templates/safe_refcount.h"
 
 #include <astcenc.h>
 
+// Mipmaps with fewer blocks are compressed on the calling thread.
+static const unsigned int ASTC_THREADED_MIN_BLOCKS = 1024;
+
+struct ASTCCompressionJob {
+	astcenc_context *context = nullptr;
+	astcenc_image *image = nullptr;
+	const astcenc_swizzle *swizzle = nullptr;
+	uint8_t *dest = nullptr;
+	size_t dest_len = 0;
+	SafeNumeric<int> status;
+};
+
+static void _compress_astc_task(void *p_job, uint32_t p_index) {
+	ASTCCompressionJob *job = static_cast<ASTCCompressionJob *>(p_job);
+	// Every thread index takes blocks until the image is done, an index that starts late finds no work left.
+	astcenc_error status = astcenc_compress_image(job->context, job->image, job->swizzle, job->dest, job->dest_len, p_index);
+	if (status != ASTCENC_SUCCESS) {
+		job->status.set(status);
+	}
+}
+
 void _compress_astc(Image *r_img, Image::ASTCFormat p_format) {
 	uint64_t start_time = OS::get_singleton()->get_ticks_msec();
 
@@ -115,7 +138,8 @@ void _compress_astc(Image *r_img, Image::ASTCFormat p_format) {
 	// Context allocation.
 
 	astcenc_context *context;
-	const unsigned int thread_count = 1; // Godot compresses multiple images each on a thread, which is more efficient for large amount of images imported.
+	// Blocks of one image are split over the worker threads, so a single large texture doesn't compress on one core.
+	const unsigned int thread_count = MAX(1, WorkerThreadPool::get_singleton()->get_thread_count());
 	status = astcenc_context_alloc(&config, thread_count, &context);
 	ERR_FAIL_COND_MSG(status != ASTCENC_SUCCESS,
 			vformat("astcenc: Context allocation failed: %s.", astcenc_get_error_string(status)));
@@ -156,7 +180,21 @@ void _compress_astc(Image *r_img, Image::ASTCFormat p_format) {
 			ASTCENC_SWZ_R, ASTCENC_SWZ_G, ASTCENC_SWZ_B, ASTCENC_SWZ_A
 		};
 
-		status = astcenc_compress_image(context, &image, &swizzle, dest_mip_write, comp_len, 0);
+		ASTCCompressionJob job;
+		job.context = context;
+		job.image = &image;
+		job.swizzle = &swizzle;
+		job.dest = dest_mip_write;
+		job.dest_len = comp_len;
+		job.status.set(ASTCENC_SUCCESS);
+
+		if (thread_count > 1 && block_count_x * block_count_y >= ASTC_THREADED_MIN_BLOCKS) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&_compress_astc_task, &job, thread_count, -1, true, SNAME("astcenc Compress"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			_compress_astc_task(&job, 0);
+		}
+		status = astcenc_error(job.status.get());
 
 		ERR_BREAK_MSG(status != ASTCENC_SUCCESS,
 				vformat("astcenc: ASTC image compression failed: %s.", astcenc_get_error_string(status)));
@@ -31,6 +31,7 @@
 #include "csg_shape.h"
 
 #include "core/math/geometry_2d.h"
+#include "core/object/worker_thread_pool.h"
 
 void CSGShape3D::set_use_collision(bool p_enable) {
 	if (use_collision == p_enable) {
@@ -149,12 +150,18 @@ float CSGShape3D::get_snap() const {
 }
 
 void CSGShape3D::_make_dirty(bool p_parent_removing) {
+	primitive_dirty = true;
+	_make_merge_dirty(p_parent_removing);
+}
+
+// Only the result needs merging again, this shape's own brush is unchanged.
+void CSGShape3D::_make_merge_dirty(bool p_parent_removing) {
 	if ((p_parent_removing || is_root_shape()) && !dirty) {
 		call_deferred(SNAME("_update_shape")); // Must be deferred; otherwise, is_root_shape() will use the previous parent
 	}
 
 	if (!is_root_shape()) {
-		parent_shape->_make_dirty();
+		parent_shape->_make_merge_dirty();
 	} else if (!dirty) {
 		call_deferred(SNAME("_update_shape"));
 	}
@@ -162,76 +169,135 @@ void CSGShape3D::_make_dirty(bool p_parent_removing) {
 	dirty = true;
 }
 
-CSGBrush *CSGShape3D::_get_brush() {
-	if (dirty) {
-		if (brush) {
-			memdelete(brush);
+// Builds the brushes of the dirty shapes in this subtree, and groups them by depth so every level can be merged in parallel.
+// Runs on the main thread, as it accesses the scene tree.
+void CSGShape3D::_collect_dirty_shapes(LocalVector<LocalVector<CSGShape3D *>> &r_levels, uint32_t p_depth) {
+	if (brush) {
+		memdelete(brush);
+	}
+	brush = nullptr;
+
+	if (primitive_dirty || !primitive_brush) {
+		if (primitive_brush) {
+			memdelete(primitive_brush);
+		}
+		primitive_brush = _build_brush();
+		primitive_dirty = false;
+	}
+
+	merge_children.clear();
+	for (int i = 0; i < get_child_count(); i++) {
+		CSGShape3D *child = Object::cast_to<CSGShape3D>(get_child(i));
+		if (!child) {
+			continue;
+		}
+		if (!child->is_visible()) {
+			continue;
 		}
-		brush = nullptr;
 
-		CSGBrush *n = _build_brush();
+		if (child->dirty) {
+			child->_collect_dirty_shapes(r_levels, p_depth + 1);
+		}
 
-		for (int i = 0; i < get_child_count(); i++) {
-			CSGShape3D *child = Object::cast_to<CSGShape3D>(get_child(i));
-			if (!child) {
-				continue;
-			}
-			if (!child->is_visible()) {
-				continue;
-			}
+		MergeChild merge_child;
+		merge_child.shape = child;
+		merge_child.transform = child->get_transform();
+		merge_child.operation = child->get_operation();
+		merge_children.push_back(merge_child);
+	}
 
-			CSGBrush *n2 = child->_get_brush();
-			if (!n2) {
-				continue;
-			}
-			if (!n) {
-				n = memnew(CSGBrush);
+	if (r_levels.size() <= p_depth) {
+		r_levels.resize(p_depth + 1);
+	}
+	r_levels[p_depth].push_back(this);
+}
+
+void CSGShape3D::_merge_child_brushes() {
+	CSGBrush *n = nullptr;
+	if (merge_children.is_empty()) {
+		// Nothing to merge, the result is this shape's own brush.
+		n = primitive_brush;
+		primitive_brush = nullptr;
+	} else if (primitive_brush) {
+		n = memnew(CSGBrush);
+		n->copy_from(*primitive_brush, Transform3D());
+	}
 
-				n->copy_from(*n2, child->get_transform());
+	for (const MergeChild &merge_child : merge_children) {
+		CSGBrush *n2 = merge_child.shape->brush;
+		if (!n2) {
+			continue;
+		}
+		if (!n) {
+			n = memnew(CSGBrush);
 
-			} else {
-				CSGBrush *nn = memnew(CSGBrush);
-				CSGBrush *nn2 = memnew(CSGBrush);
-				nn2->copy_from(*n2, child->get_transform());
-
-				CSGBrushOperation bop;
-
-				switch (child->get_operation()) {
-					case CSGShape3D::OPERATION_UNION:
-						bop.merge_brushes(CSGBrushOperation::OPERATION_UNION, *n, *nn2, *nn, snap);
-						break;
-					case CSGShape3D::OPERATION_INTERSECTION:
-						bop.merge_brushes(CSGBrushOperation::OPERATION_INTERSECTION, *n, *nn2, *nn, snap);
-						break;
-					case CSGShape3D::OPERATION_SUBTRACTION:
-						bop.merge_brushes(CSGBrushOperation::OPERATION_SUBTRACTION, *n, *nn2, *nn, snap);
-						break;
-				}
-				memdelete(n);
-				memdelete(nn2);
-				n = nn;
+			n->copy_from(*n2, merge_child.transform);
+
+		} else {
+			CSGBrush *nn = memnew(CSGBrush);
+			CSGBrush *nn2 = memnew(CSGBrush);
+			nn2->copy_from(*n2, merge_child.transform);
+
+			CSGBrushOperation bop;
+
+			switch (merge_child.operation) {
+				case CSGShape3D::OPERATION_UNION:
+					bop.merge_brushes(CSGBrushOperation::OPERATION_UNION, *n, *nn2, *nn, snap);
+					break;
+				case CSGShape3D::OPERATION_INTERSECTION:
+					bop.merge_brushes(CSGBrushOperation::OPERATION_INTERSECTION, *n, *nn2, *nn, snap);
+					break;
+				case CSGShape3D::OPERATION_SUBTRACTION:
+					bop.merge_brushes(CSGBrushOperation::OPERATION_SUBTRACTION, *n, *nn2, *nn, snap);
+					break;
 			}
+			memdelete(n);
+			memdelete(nn2);
+			n = nn;
 		}
+	}
+	merge_children.clear();
 
-		if (n) {
-			AABB aabb;
-			for (int i = 0; i < n->faces.size(); i++) {
-				for (int j = 0; j < 3; j++) {
-					if (i == 0 && j == 0) {
-						aabb.position = n->faces[i].vertices[j];
-					} else {
-						aabb.expand_to(n->faces[i].vertices[j]);
-					}
+	if (n) {
+		AABB aabb;
+		for (int i = 0; i < n->faces.size(); i++) {
+			for (int j = 0; j < 3; j++) {
+				if (i == 0 && j == 0) {
+					aabb.position = n->faces[i].vertices[j];
+				} else {
+					aabb.expand_to(n->faces[i].vertices[j]);
 				}
 			}
-			node_aabb = aabb;
-		} else {
-			node_aabb = AABB();
 		}
+		node_aabb = aabb;
+	} else {
+		node_aabb = AABB();
+	}
+
+	brush = n;
 
-		brush = n;
+	dirty = false;
+}
+
+void CSGShape3D::_merge_child_brushes_task(void *p_userdata, uint32_t p_index) {
+	LocalVector<CSGShape3D *> *level = (LocalVector<CSGShape3D *> *)p_userdata;
+	(*level)[p_index]->_merge_child_brushes();
+}
 
-		dirty = false;
+CSGBrush *CSGShape3D::_get_brush() {
+	if (dirty) {
+		LocalVector<LocalVector<CSGShape3D *>> levels;
+		_collect_dirty_shapes(levels, 0);
+
+		// Deepest shapes first, siblings and cousins don't depend on each other.
+		for (int i = levels.size() - 1; i >= 0; i--) {
+			if (levels[i].size() > 1) {
+				WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&CSGShape3D::_merge_child_brushes_task, &levels[i], levels[i].size(), -1, true, SNAME("CSGMergeBrushes"));
+				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			} else {
+				levels[i][0]->_merge_child_brushes();
+			}
+		}
 	}
 
 	return brush;
@@ -571,7 +637,7 @@ void CSGShape3D::_notification(int p_what) {
 		case NOTIFICATION_VISIBILITY_CHANGED: {
 			if (!is_root_shape() && last_visible != is_visible()) {
 				// Update this node's parent only if its own visibility has changed, not the visibility of parent nodes
-				parent_shape->_make_dirty();
+				parent_shape->_make_merge_dirty();
 			}
 			last_visible = is_visible();
 		} break;
@@ -579,7 +645,7 @@ void CSGShape3D::_notification(int p_what) {
 		case NOTIFICATION_LOCAL_TRANSFORM_CHANGED: {
 			if (!is_root_shape()) {
 				// Update this node's parent only if its own transformation has changed, not the transformation of parent nodes
-				parent_shape->_make_dirty();
+				parent_shape->_make_merge_dirty();
 			}
 		} break;
 
@@ -716,6 +782,10 @@ CSGShape3D::~CSGShape3D() {
 		memdelete(brush);
 		brush = nullptr;
 	}
+	if (primitive_brush) {
+		memdelete(primitive_brush);
+		primitive_brush = nullptr;
+	}
 }
 
 //////////////////////////////////
@@ -33,6 +33,7 @@
 
 #include "csg.h"
 
+#include "core/templates/local_vector.h"
 #include "scene/3d/path_3d.h"
 #include "scene/3d/visual_instance_3d.h"
 #include "scene/resources/concave_polygon_shape_3d.h"
@@ -55,10 +56,20 @@ private:
 	CSGShape3D *parent_shape = nullptr;
 
 	CSGBrush *brush = nullptr;
+	// This shape's own brush, kept while it has CSG children so only they need updating when they change.
+	CSGBrush *primitive_brush = nullptr;
+
+	struct MergeChild {
+		CSGShape3D *shape = nullptr;
+		Transform3D transform;
+		Operation operation = OPERATION_UNION;
+	};
+	LocalVector<MergeChild> merge_children;
 
 	AABB node_aabb;
 
 	bool dirty = false;
+	bool primitive_dirty = true;
 	bool last_visible = false;
 	float snap = 0.001;
 
@@ -107,6 +118,11 @@ private:
 	static void mikktSetTSpaceDefault(const SMikkTSpaceContext *pContext, const float fvTangent[], const float fvBiTangent[], const float fMagS, const float fMagT,
 			const tbool bIsOrientationPreserving, const int iFace, const int iVert);
 
+	void _collect_dirty_shapes(LocalVector<LocalVector<CSGShape3D *>> &r_levels, uint32_t p_depth);
+	void _merge_child_brushes();
+	static void _merge_child_brushes_task(void *p_userdata, uint32_t p_index);
+	void _make_merge_dirty(bool p_parent_removing = false);
+
 	void _update_shape();
 	void _update_collision_faces();
 	bool _is_debug_collision_shape_visible();
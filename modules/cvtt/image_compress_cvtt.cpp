@@ -130,15 +130,9 @@ static void _digest_row_task(const CVTTCompressionJobParams &p_job_params, const
 }
 
 static void _digest_job_queue(void *p_job_queue, uint32_t p_index) {
+	// One row of blocks per index, rows of the smaller mipmaps are cheaper so they are handed out as threads free up.
 	CVTTCompressionJobQueue *job_queue = static_cast<CVTTCompressionJobQueue *>(p_job_queue);
-	uint32_t num_tasks = job_queue->num_tasks;
-	uint32_t total_threads = WorkerThreadPool::get_singleton()->get_thread_count();
-	uint32_t start = p_index * num_tasks / total_threads;
-	uint32_t end = (p_index + 1 == total_threads) ? num_tasks : ((p_index + 1) * num_tasks / total_threads);
-
-	for (uint32_t i = start; i < end; i++) {
-		_digest_row_task(job_queue->job_params, job_queue->job_tasks[i]);
-	}
+	_digest_row_task(job_queue->job_params, job_queue->job_tasks[p_index]);
 }
 
 void image_compress_cvtt(Image *p_image, Image::UsedChannels p_channels) {
@@ -246,7 +240,7 @@ void image_compress_cvtt(Image *p_image, Image::UsedChannels p_channels) {
 
 	job_queue.job_tasks = &tasks_rb[0];
 	job_queue.num_tasks = static_cast<uint32_t>(tasks.size());
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&_digest_job_queue, &job_queue, WorkerThreadPool::get_singleton()->get_thread_count(), -1, true, SNAME("CVTT Compress"));
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&_digest_job_queue, &job_queue, job_queue.num_tasks, -1, true, SNAME("CVTT Compress"));
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	p_image->set_data(p_image->get_width(), p_image->get_height(), p_image->has_mipmaps(), target_format, data);
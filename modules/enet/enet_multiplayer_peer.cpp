@@ -75,6 +75,7 @@ Error ENetMultiplayerPeer::create_server(int p_port, int p_max_clients, int p_ma
 	unique_id = 1;
 	connection_status = CONNECTION_CONNECTED;
 	hosts[0] = host;
+	_start_service_thread();
 	return OK;
 }
 
@@ -106,6 +107,7 @@ Error ENetMultiplayerPeer::create_client(const String &p_address, int p_port, in
 	active_mode = MODE_CLIENT;
 	peers[1] = peer;
 	hosts[0] = host;
+	_start_service_thread();
 
 	return OK;
 }
@@ -116,6 +118,7 @@ Error ENetMultiplayerPeer::create_mesh(int p_id) {
 	active_mode = MODE_MESH;
 	unique_id = p_id;
 	connection_status = CONNECTION_CONNECTED;
+	_start_service_thread();
 	return OK;
 }
 
@@ -125,7 +128,10 @@ Error ENetMultiplayerPeer::add_mesh_peer(int p_id, Ref<ENetConnection> p_host) {
 	List<Ref<ENetPacketPeer>> host_peers;
 	p_host->get_peers(host_peers);
 	ERR_FAIL_COND_V_MSG(host_peers.size() != 1 || host_peers[0]->get_state() != ENetPacketPeer::STATE_CONNECTED, ERR_INVALID_PARAMETER, "The provided host must have exactly one peer in the connected state.");
-	hosts[p_id] = p_host;
+	{
+		MutexLock lock(service_mutex);
+		hosts[p_id] = p_host;
+	}
 	peers[p_id] = host_peers[0];
 	emit_signal(SNAME("peer_connected"), p_id);
 	return OK;
@@ -149,6 +155,7 @@ void ENetMultiplayerPeer::_store_packet(int32_t p_source, ENetConnection::Event
 
 void ENetMultiplayerPeer::_disconnect_inactive_peers() {
 	HashSet<int> to_drop;
+	service_mutex.lock();
 	for (const KeyValue<int, Ref<ENetPacketPeer>> &E : peers) {
 		if (E.value->is_active()) {
 			continue;
@@ -160,11 +167,71 @@ void ENetMultiplayerPeer::_disconnect_inactive_peers() {
 		if (hosts.has(P)) {
 			hosts.erase(P);
 		}
+	}
+	service_mutex.unlock();
+	for (const int &P : to_drop) {
 		ERR_CONTINUE(active_mode == MODE_CLIENT && P != TARGET_PEER_SERVER);
 		emit_signal(SNAME("peer_disconnected"), P);
 	}
 }
 
+void ENetMultiplayerPeer::_service_thread_func(void *p_userdata) {
+	ENetMultiplayerPeer *peer = (ENetMultiplayerPeer *)p_userdata;
+	while (!peer->service_thread_exit.is_set()) {
+		{
+			MutexLock lock(peer->service_mutex);
+			peer->_service_hosts(peer->service_events);
+		}
+		OS::get_singleton()->delay_usec(SERVICE_THREAD_INTERVAL_USEC);
+	}
+}
+
+void ENetMultiplayerPeer::_start_service_thread() {
+	if (!threaded_service) {
+		return;
+	}
+	service_thread_exit.clear();
+	service_thread.start(_service_thread_func, this);
+}
+
+void ENetMultiplayerPeer::_stop_service_thread() {
+	if (!service_thread.is_started()) {
+		return;
+	}
+	service_thread_exit.set();
+	service_thread.wait_to_finish();
+	_clear_events(service_events);
+}
+
+void ENetMultiplayerPeer::_service_hosts(LocalVector<ServiceEvent> &r_events) {
+	for (KeyValue<int, Ref<ENetConnection>> &E : hosts) {
+		ServiceEvent ev;
+		ev.host = E.key;
+		ev.type = E.value->service(0, ev.event);
+		while (ev.type != ENetConnection::EVENT_NONE) {
+			const ENetConnection::EventType type = ev.type;
+			r_events.push_back(ev);
+			if (type == ENetConnection::EVENT_ERROR || (active_mode == MODE_MESH && type == ENetConnection::EVENT_DISCONNECT)) {
+				break; // Keep polling the others.
+			}
+			ev.event = ENetConnection::Event();
+			if (E.value->check_events(ev.type, ev.event) <= 0) {
+				break;
+			}
+		}
+	}
+}
+
+void ENetMultiplayerPeer::_clear_events(LocalVector<ServiceEvent> &r_events) {
+	// Packets that were never stored are owned by us.
+	for (ServiceEvent &E : r_events) {
+		if (E.type == ENetConnection::EVENT_RECEIVE && E.event.packet) {
+			_destroy_unused(E.event.packet);
+		}
+	}
+	r_events.clear();
+}
+
 void ENetMultiplayerPeer::poll() {
 	ERR_FAIL_COND_MSG(!_is_active(), "The multiplayer instance isn't currently active.");
 
@@ -172,15 +239,26 @@ void ENetMultiplayerPeer::poll() {
 
 	_disconnect_inactive_peers();
 
-	switch (active_mode) {
-		case MODE_CLIENT: {
-			if (!peers.has(1)) {
-				close();
-				return;
-			}
-			ENetConnection::Event event;
-			ENetConnection::EventType ret = hosts[0]->service(0, event);
-			do {
+	if (active_mode == MODE_CLIENT && !peers.has(1)) {
+		close();
+		return;
+	}
+
+	{
+		MutexLock lock(service_mutex);
+		if (service_thread.is_started()) {
+			SWAP(pending_events, service_events);
+		} else {
+			_service_hosts(pending_events);
+		}
+	}
+
+	HashSet<int> to_drop;
+	for (uint32_t i = 0; i < pending_events.size() && _is_active(); i++) {
+		const ENetConnection::EventType ret = pending_events[i].type;
+		ENetConnection::Event &event = pending_events[i].event;
+		switch (active_mode) {
+			case MODE_CLIENT: {
 				if (ret == ENetConnection::EVENT_CONNECT) {
 					connection_status = CONNECTION_CONNECTED;
 					emit_signal(SNAME("peer_connected"), 1);
@@ -192,22 +270,20 @@ void ENetMultiplayerPeer::poll() {
 					close();
 				} else if (ret == ENetConnection::EVENT_RECEIVE) {
 					_store_packet(1, event);
-				} else if (ret != ENetConnection::EVENT_NONE) {
+				} else {
 					close(); // Error.
 				}
-			} while (hosts.has(0) && hosts[0]->check_events(ret, event) > 0);
-		} break;
-		case MODE_SERVER: {
-			ENetConnection::Event event;
-			ENetConnection::EventType ret = hosts[0]->service(0, event);
-			do {
+			} break;
+			case MODE_SERVER: {
 				if (ret == ENetConnection::EVENT_CONNECT) {
 					if (is_refusing_new_connections()) {
+						MutexLock lock(service_mutex);
 						event.peer->reset();
 						continue;
 					}
 					// Client joined with invalid ID, probably trying to exploit us.
 					if (event.data < 2 || peers.has((int)event.data)) {
+						MutexLock lock(service_mutex);
 						event.peer->reset();
 						continue;
 					}
@@ -226,39 +302,37 @@ void ENetMultiplayerPeer::poll() {
 				} else if (ret == ENetConnection::EVENT_RECEIVE) {
 					int32_t source = event.peer->get_meta(SNAME("_net_id"));
 					_store_packet(source, event);
-				} else if (ret != ENetConnection::EVENT_NONE) {
+				} else {
 					close(); // Error
 				}
-			} while (hosts.has(0) && hosts[0]->check_events(ret, event) > 0);
-		} break;
-		case MODE_MESH: {
-			HashSet<int> to_drop;
-			for (KeyValue<int, Ref<ENetConnection>> &E : hosts) {
-				ENetConnection::Event event;
-				ENetConnection::EventType ret = E.value->service(0, event);
-				do {
-					if (ret == ENetConnection::EVENT_CONNECT) {
-						event.peer->reset();
-					} else if (ret == ENetConnection::EVENT_RECEIVE) {
-						_store_packet(E.key, event);
-					} else if (ret == ENetConnection::EVENT_NONE) {
-						break; // Keep polling the others.
-					} else {
-						to_drop.insert(E.key); // Error or disconnect.
-						break; // Keep polling the others.
-					}
-				} while (E.value->check_events(ret, event) > 0);
-			}
-			for (const int &P : to_drop) {
-				if (peers.has(P)) {
-					emit_signal(SNAME("peer_disconnected"), P);
-					peers.erase(P);
+			} break;
+			case MODE_MESH: {
+				const int host = pending_events[i].host;
+				if (ret == ENetConnection::EVENT_CONNECT) {
+					MutexLock lock(service_mutex);
+					event.peer->reset();
+				} else if (ret == ENetConnection::EVENT_RECEIVE) {
+					_store_packet(host, event);
+				} else {
+					to_drop.insert(host); // Error or disconnect.
 				}
-				hosts.erase(P);
-			}
-		} break;
-		default:
-			return;
+			} break;
+			default:
+				break;
+		}
+		if (ret == ENetConnection::EVENT_RECEIVE) {
+			event.packet = nullptr; // Stored.
+		}
+	}
+	_clear_events(pending_events);
+
+	for (const int &P : to_drop) {
+		if (peers.has(P)) {
+			emit_signal(SNAME("peer_disconnected"), P);
+			peers.erase(P);
+		}
+		MutexLock lock(service_mutex);
+		hosts.erase(P);
 	}
 }
 
@@ -272,23 +346,29 @@ bool ENetMultiplayerPeer::is_server_relay_supported() const {
 
 void ENetMultiplayerPeer::disconnect_peer(int p_peer, bool p_force) {
 	ERR_FAIL_COND(!_is_active() || !peers.has(p_peer));
-	peers[p_peer]->peer_disconnect(0); // Will be removed during next poll.
-	if (active_mode == MODE_CLIENT || active_mode == MODE_SERVER) {
-		hosts[0]->flush();
-	} else {
-		ERR_FAIL_COND(!hosts.has(p_peer));
-		hosts[p_peer]->flush();
-	}
-	if (p_force) {
+	{
+		MutexLock lock(service_mutex);
+		peers[p_peer]->peer_disconnect(0); // Will be removed during next poll.
+		if (active_mode == MODE_CLIENT || active_mode == MODE_SERVER) {
+			hosts[0]->flush();
+		} else {
+			ERR_FAIL_COND(!hosts.has(p_peer));
+			hosts[p_peer]->flush();
+		}
+		if (!p_force) {
+			return;
+		}
 		peers.erase(p_peer);
 		if (hosts.has(p_peer)) {
 			hosts.erase(p_peer);
 		}
 		if (active_mode == MODE_CLIENT) {
 			hosts.clear(); // Avoid flushing again.
-			close();
 		}
 	}
+	if (active_mode == MODE_CLIENT) {
+		close();
+	}
 }
 
 void ENetMultiplayerPeer::close() {
@@ -296,6 +376,7 @@ void ENetMultiplayerPeer::close() {
 		return;
 	}
 
+	_stop_service_thread();
 	_pop_current_packet();
 
 	for (KeyValue<int, Ref<ENetPacketPeer>> &E : peers) {
@@ -370,6 +451,8 @@ Error ENetMultiplayerPeer::put_packet(const uint8_t *p_buffer, int p_buffer_size
 	ENetPacket *packet = enet_packet_create(nullptr, p_buffer_size, packet_flags);
 	memcpy(&packet->data[0], p_buffer, p_buffer_size);
 
+	MutexLock lock(service_mutex);
+
 	if (is_server()) {
 		if (target_peer == 0) {
 			hosts[0]->broadcast(channel, packet);
@@ -443,6 +526,7 @@ int ENetMultiplayerPeer::get_unique_id() const {
 void ENetMultiplayerPeer::set_refuse_new_connections(bool p_enabled) {
 #ifdef GODOT_ENET
 	if (_is_active()) {
+		MutexLock lock(service_mutex);
 		for (KeyValue<int, Ref<ENetConnection>> &E : hosts) {
 			E.value->refuse_new_connections(p_enabled);
 		}
@@ -480,7 +564,11 @@ void ENetMultiplayerPeer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_host"), &ENetMultiplayerPeer::get_host);
 	ClassDB::bind_method(D_METHOD("get_peer", "id"), &ENetMultiplayerPeer::get_peer);
 
+	ClassDB::bind_method(D_METHOD("set_threaded_service", "enabled"), &ENetMultiplayerPeer::set_threaded_service);
+	ClassDB::bind_method(D_METHOD("is_threaded_service"), &ENetMultiplayerPeer::is_threaded_service);
+
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "host", PROPERTY_HINT_RESOURCE_TYPE, "ENetConnection", PROPERTY_USAGE_NONE), "", "get_host");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "threaded_service"), "set_threaded_service", "is_threaded_service");
 }
 
 ENetMultiplayerPeer::ENetMultiplayerPeer() {
@@ -500,3 +588,12 @@ void ENetMultiplayerPeer::set_bind_ip(const IPAddress &p_ip) {
 
 	bind_ip = p_ip;
 }
+
+void ENetMultiplayerPeer::set_threaded_service(bool p_enabled) {
+	ERR_FAIL_COND_MSG(_is_active(), "The threaded service can only be changed while the multiplayer instance isn't active.");
+	threaded_service = p_enabled;
+}
+
+bool ENetMultiplayerPeer::is_threaded_service() const {
+	return threaded_service;
+}
@@ -34,6 +34,9 @@
 #include "enet_connection.h"
 
 #include "core/crypto/crypto.h"
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
+#include "core/templates/safe_refcount.h"
 #include "scene/main/multiplayer_peer.h"
 
 #include <enet/enet.h>
@@ -53,6 +56,10 @@ private:
 		SYSCH_MAX = 2
 	};
 
+	enum {
+		SERVICE_THREAD_INTERVAL_USEC = 1000,
+	};
+
 	enum Mode {
 		MODE_NONE,
 		MODE_SERVER,
@@ -82,6 +89,27 @@ private:
 
 	Packet current_packet;
 
+	struct ServiceEvent {
+		int host = 0;
+		ENetConnection::EventType type = ENetConnection::EVENT_NONE;
+		ENetConnection::Event event;
+	};
+
+	// When threaded, the hosts are serviced by `service_thread`, which queues the events for the next poll.
+	// Any access to the hosts and peers from the main thread must hold `service_mutex`.
+	bool threaded_service = false;
+	Thread service_thread;
+	SafeFlag service_thread_exit;
+	Mutex service_mutex;
+	LocalVector<ServiceEvent> service_events;
+	LocalVector<ServiceEvent> pending_events;
+
+	static void _service_thread_func(void *p_userdata);
+	void _start_service_thread();
+	void _stop_service_thread();
+	void _service_hosts(LocalVector<ServiceEvent> &r_events);
+	void _clear_events(LocalVector<ServiceEvent> &r_events);
+
 	void _store_packet(int32_t p_source, ENetConnection::Event &p_event);
 	void _pop_current_packet();
 	void _disconnect_inactive_peers();
@@ -126,6 +154,9 @@ public:
 
 	void set_bind_ip(const IPAddress &p_ip);
 
+	void set_threaded_service(bool p_enabled);
+	bool is_threaded_service() const;
+
 	Ref<ENetConnection> get_host() const;
 	Ref<ENetPacketPeer> get_peer(int p_id) const;
 
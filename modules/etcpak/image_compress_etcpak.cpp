@@ -30,12 +30,53 @@
 
 #include "image_compress_etcpak.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/string/print_string.h"
 
 #include <ProcessDxtc.hpp>
 #include <ProcessRGB.hpp>
 
+// Block rows compressed by each task, mipmaps are split the same way so all of them are compressed at once.
+static const int ETCPAK_TASK_BLOCK_ROWS = 16;
+
+struct EtcpakCompressionTask {
+	const uint32_t *src = nullptr;
+	uint64_t *dest = nullptr;
+	uint32_t blocks = 0;
+	int width = 0;
+};
+
+struct EtcpakCompressionJob {
+	EtcpakType type = EtcpakType::ETCPAK_TYPE_ETC1;
+	const EtcpakCompressionTask *tasks = nullptr;
+};
+
+static void _compress_etcpak_task(void *p_job, uint32_t p_index) {
+	const EtcpakCompressionJob *job = static_cast<const EtcpakCompressionJob *>(p_job);
+	const EtcpakCompressionTask &task = job->tasks[p_index];
+
+	switch (job->type) {
+		case EtcpakType::ETCPAK_TYPE_ETC1: {
+			CompressEtc1RgbDither(task.src, task.dest, task.blocks, task.width);
+		} break;
+		case EtcpakType::ETCPAK_TYPE_ETC2: {
+			CompressEtc2Rgb(task.src, task.dest, task.blocks, task.width, true);
+		} break;
+		case EtcpakType::ETCPAK_TYPE_ETC2_ALPHA:
+		case EtcpakType::ETCPAK_TYPE_ETC2_RA_AS_RG: {
+			CompressEtc2Rgba(task.src, task.dest, task.blocks, task.width, true);
+		} break;
+		case EtcpakType::ETCPAK_TYPE_DXT1: {
+			CompressDxt1Dither(task.src, task.dest, task.blocks, task.width);
+		} break;
+		case EtcpakType::ETCPAK_TYPE_DXT5:
+		case EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG: {
+			CompressDxt5(task.src, task.dest, task.blocks, task.width);
+		} break;
+	}
+}
+
 EtcpakType _determine_etc_type(Image::UsedChannels p_channels) {
 	switch (p_channels) {
 		case Image::USED_CHANNELS_L:
@@ -177,7 +218,11 @@ void _compress_etcpak(EtcpakType p_compresstype, Image *r_img) {
 	uint8_t *dest_write = dest_data.ptrw();
 
 	int mip_count = mipmaps ? Image::get_image_required_mipmaps(width, height, target_format) : 0;
-	Vector<uint32_t> padded_src;
+	// Both are 4x4 blocks, formats with alpha take 16 bytes per block.
+	const int block_words = (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC1 || p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2 || p_compresstype == EtcpakType::ETCPAK_TYPE_DXT1) ? 1 : 2;
+	Vector<Vector<uint32_t>> padded_src;
+	padded_src.resize(mip_count + 1);
+	Vector<EtcpakCompressionTask> tasks;
 
 	for (int i = 0; i < mip_count + 1; i++) {
 		// Get write mip metrics for target image.
@@ -190,7 +235,6 @@ void _compress_etcpak(EtcpakType p_compresstype, Image *r_img) {
 		// Block size. Align stride to multiple of 4 (RGBA8).
 		int mip_w = (orig_mip_w + 3) & ~3;
 		int mip_h = (orig_mip_h + 3) & ~3;
-		const uint32_t blocks = mip_w * mip_h / 16;
 
 		// Get mip data from source image for reading.
 		int src_mip_ofs = r_img->get_mipmap_offset(i);
@@ -198,8 +242,8 @@ void _compress_etcpak(EtcpakType p_compresstype, Image *r_img) {
 
 		// Pad textures to nearest block by smearing.
 		if (mip_w != orig_mip_w || mip_h != orig_mip_h) {
-			padded_src.resize(mip_w * mip_h);
-			uint32_t *ptrw = padded_src.ptrw();
+			padded_src.write[i].resize(mip_w * mip_h);
+			uint32_t *ptrw = padded_src.write[i].ptrw();
 			int x = 0, y = 0;
 			for (y = 0; y < orig_mip_h; y++) {
 				for (x = 0; x < orig_mip_w; x++) {
@@ -217,23 +261,32 @@ void _compress_etcpak(EtcpakType p_compresstype, Image *r_img) {
 				}
 			}
 			// Override the src_mip_read pointer to our temporary Vector.
-			src_mip_read = padded_src.ptr();
+			src_mip_read = padded_src[i].ptr();
 		}
-		if (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC1) {
-			CompressEtc1RgbDither(src_mip_read, dest_mip_write, blocks, mip_w);
-		} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2) {
-			CompressEtc2Rgb(src_mip_read, dest_mip_write, blocks, mip_w, true);
-		} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2_ALPHA || p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2_RA_AS_RG) {
-			CompressEtc2Rgba(src_mip_read, dest_mip_write, blocks, mip_w, true);
-		} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_DXT1) {
-			CompressDxt1Dither(src_mip_read, dest_mip_write, blocks, mip_w);
-		} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_DXT5 || p_compresstype == EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG) {
-			CompressDxt5(src_mip_read, dest_mip_write, blocks, mip_w);
-		} else {
-			ERR_FAIL_MSG("etcpak: Invalid or unsupported compression format.");
+
+		// etcpak walks the blocks row by row, so each band of block rows can be compressed on its own.
+		const int block_rows = mip_h / 4;
+		const int row_blocks = mip_w / 4;
+		for (int row = 0; row < block_rows; row += ETCPAK_TASK_BLOCK_ROWS) {
+			EtcpakCompressionTask task;
+			task.src = src_mip_read + row * 4 * mip_w;
+			task.dest = dest_mip_write + row * row_blocks * block_words;
+			task.blocks = MIN(ETCPAK_TASK_BLOCK_ROWS, block_rows - row) * row_blocks;
+			task.width = mip_w;
+			tasks.push_back(task);
 		}
 	}
 
+	EtcpakCompressionJob job;
+	job.type = p_compresstype;
+	job.tasks = tasks.ptr();
+	if (tasks.size() == 1) {
+		_compress_etcpak_task(&job, 0);
+	} else {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&_compress_etcpak_task, &job, tasks.size(), -1, true, SNAME("etcpak Compress"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
 	// Replace original image with compressed one.
 	r_img->set_data(width, height, mipmaps, target_format, dest_data);
 
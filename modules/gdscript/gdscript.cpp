@@ -52,6 +52,7 @@
 #include "core/io/file_access.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/os/os.h"
+#include "main/performance.h"
 
 #ifdef TOOLS_ENABLED
 #include "editor/editor_paths.h"
@@ -417,6 +418,7 @@ void GDScript::set_source_code(const String &p_code) {
 		return;
 	}
 	source = p_code;
+	binary_tokens.clear();
 #ifdef TOOLS_ENABLED
 	source_changed_cache = true;
 #endif
@@ -488,7 +490,7 @@ bool GDScript::_update_exports(bool *r_err, bool p_recursive_call, PlaceHolderSc
 
 		GDScriptParser parser;
 		GDScriptAnalyzer analyzer(&parser);
-		Error err = parser.parse(source, path, false);
+		Error err = binary_tokens.is_empty() ? parser.parse(source, path, false) : parser.parse_binary(binary_tokens, path);
 
 		if (err == OK && analyzer.analyze() == OK) {
 			const GDScriptParser::ClassNode *c = parser.get_tree();
@@ -724,7 +726,7 @@ Error GDScript::reload(bool p_keep_state) {
 
 	valid = false;
 	GDScriptParser parser;
-	Error err = parser.parse(source, path, false);
+	Error err = binary_tokens.is_empty() ? parser.parse(source, path, false) : parser.parse_binary(binary_tokens, path);
 	if (err) {
 		if (EngineDebugger::is_active()) {
 			GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser.get_errors().front()->get().line, "Parser Error: " + parser.get_errors().front()->get().message);
@@ -1014,12 +1016,20 @@ Error GDScript::load_source_code(const String &p_path) {
 	ERR_FAIL_COND_V(r != len, ERR_CANT_OPEN);
 	w[len] = 0;
 
-	String s;
-	if (s.parse_utf8((const char *)w) != OK) {
-		ERR_FAIL_V_MSG(ERR_INVALID_DATA, "Script '" + p_path + "' contains invalid unicode (UTF-8), so it was not loaded. Please ensure that scripts are saved in valid UTF-8 unicode.");
-	}
+	if (GDScriptTokenizer::is_binary(sourcef)) {
+		// Exported script, the tokens are replayed by the parser.
+		sourcef.resize(len);
+		binary_tokens = sourcef;
+		source = String();
+	} else {
+		String s;
+		if (s.parse_utf8((const char *)w) != OK) {
+			ERR_FAIL_V_MSG(ERR_INVALID_DATA, "Script '" + p_path + "' contains invalid unicode (UTF-8), so it was not loaded. Please ensure that scripts are saved in valid UTF-8 unicode.");
+		}
 
-	source = s;
+		source = s;
+		binary_tokens.clear();
+	}
 	path = p_path;
 #ifdef TOOLS_ENABLED
 	source_changed_cache = true;
@@ -1848,30 +1858,33 @@ Variant GDScriptInstance::callp(const StringName &p_method, const Variant **p_ar
 	return Variant();
 }
 
+void GDScriptInstance::_call_notification(GDScript *p_script, const Variant **p_args, bool p_reversed) {
+	// Base scripts are reached recursively rather than by collecting the chain, as this runs for every notification.
+	if (!p_reversed && p_script->_base) {
+		_call_notification(p_script->_base, p_args, p_reversed);
+	}
+
+	HashMap<StringName, GDScriptFunction *>::Iterator E = p_script->member_functions.find(GDScriptLanguage::get_singleton()->strings._notification);
+	if (E) {
+		Callable::CallError err;
+		E->value->call(this, p_args, 1, err);
+		if (err.error != Callable::CallError::CALL_OK) {
+			//print error about notification call
+		}
+	}
+
+	if (p_reversed && p_script->_base) {
+		_call_notification(p_script->_base, p_args, p_reversed);
+	}
+}
+
 void GDScriptInstance::notification(int p_notification, bool p_reversed) {
 	//notification is not virtual, it gets called at ALL levels just like in C.
 	Variant value = p_notification;
 	const Variant *args[1] = { &value };
 
-	List<GDScript *> pl;
-	GDScript *sptr = script.ptr();
-	while (sptr) {
-		if (p_reversed) {
-			pl.push_back(sptr);
-		} else {
-			pl.push_front(sptr);
-		}
-		sptr = sptr->_base;
-	}
-	for (GDScript *sc : pl) {
-		HashMap<StringName, GDScriptFunction *>::Iterator E = sc->member_functions.find(GDScriptLanguage::get_singleton()->strings._notification);
-		if (E) {
-			Callable::CallError err;
-			E->value->call(this, args, 1, err);
-			if (err.error != Callable::CallError::CALL_OK) {
-				//print error about notification call
-			}
-		}
+	if (script.is_valid()) {
+		_call_notification(script.ptr(), args, p_reversed);
 	}
 }
 
@@ -2039,6 +2052,10 @@ void GDScriptLanguage::init() {
 		_add_global(E.name, E.ptr);
 	}
 
+	if (Performance::get_singleton()) {
+		Performance::get_singleton()->add_custom_monitor(SNAME("GDScript/Coroutines"), callable_mp_static(&GDScriptFunctionState::get_live_count), Vector<Variant>());
+	}
+
 #ifdef TESTS_ENABLED
 	GDScriptTests::GDScriptTestRunner::handle_cmdline();
 #endif
@@ -2055,6 +2072,14 @@ String GDScriptLanguage::get_extension() const {
 void GDScriptLanguage::finish() {
 	_call_stack.free();
 
+	if (sampling) {
+		profiling_stop();
+	}
+
+	if (Performance::get_singleton() && Performance::get_singleton()->has_custom_monitor(SNAME("GDScript/Coroutines"))) {
+		Performance::get_singleton()->remove_custom_monitor(SNAME("GDScript/Coroutines"));
+	}
+
 	// Clear the cache before parsing the script_list
 	GDScriptCache::clear();
 
@@ -2088,6 +2113,8 @@ void GDScriptLanguage::finish() {
 	}
 	script_list.clear();
 	function_list.clear();
+
+	GDScriptFunctionState::clear_stack_pool();
 }
 
 void GDScriptLanguage::profiling_start() {
@@ -2108,7 +2135,20 @@ void GDScriptLanguage::profiling_start() {
 		elem = elem->next();
 	}
 
-	profiling = true;
+	if (GLOBAL_GET("debug/settings/gdscript/sampling_profiler/enabled")) {
+		{
+			MutexLock stacks_lock(sampled_stacks_mutex);
+			sampled_stacks.clear();
+		}
+		if (!sampling) {
+			sampling_interval_usec = MAX(100, int(GLOBAL_GET("debug/settings/gdscript/sampling_profiler/interval_usec")));
+			sampling_active.set();
+			sampling_thread.start(_sampling_thread_func, this);
+			sampling = true;
+		}
+	} else {
+		profiling = true;
+	}
 #endif
 }
 
@@ -2117,9 +2157,90 @@ void GDScriptLanguage::profiling_stop() {
 	MutexLock lock(this->mutex);
 
 	profiling = false;
+
+	if (sampling) {
+		sampling = false;
+		sampling_active.clear();
+		sampling_thread.wait_to_finish();
+
+		String output_file = GLOBAL_GET("debug/settings/gdscript/sampling_profiler/output_file");
+		if (!output_file.is_empty()) {
+			Ref<FileAccess> f = FileAccess::open(output_file, FileAccess::WRITE);
+			ERR_FAIL_COND_MSG(f.is_null(), "Can't write GDScript samples to '" + output_file + "'.");
+			f->store_string(get_sampled_stacks());
+		}
+	}
 #endif
 }
 
+void GDScriptLanguage::_sampling_thread_func(void *p_userdata) {
+	GDScriptLanguage *lang = (GDScriptLanguage *)p_userdata;
+	while (lang->sampling_active.is_set()) {
+		OS::get_singleton()->delay_usec(lang->sampling_interval_usec);
+		lang->sample_tick.increment();
+	}
+}
+
+void GDScriptLanguage::_take_sample(uint32_t p_ticks) {
+#ifdef DEBUG_ENABLED
+	if (_call_stack.stack_pos == 0 || _call_stack.levels == nullptr) {
+		return;
+	}
+
+	// Time accumulated while away from a line opcode, such as in native calls, goes to the current stack.
+	// Capped to a second, in case the tick last seen by this thread is from a previous session.
+	p_ticks = MIN(p_ticks, MAX(1u, uint32_t(1000000 / sampling_interval_usec)));
+	uint64_t time = p_ticks * sampling_interval_usec;
+	String key;
+	for (int i = 0; i < _call_stack.stack_pos; i++) {
+		GDScriptFunction *function = _call_stack.levels[i].function;
+		if (!function) {
+			continue;
+		}
+		if (!key.is_empty()) {
+			key += ";";
+		}
+		key += function->profile.signature;
+
+		// Count recursive functions once.
+		bool counted = false;
+		for (int j = 0; j < i; j++) {
+			if (_call_stack.levels[j].function == function) {
+				counted = true;
+				break;
+			}
+		}
+		if (!counted) {
+			function->profile.total_time.add(time);
+			function->profile.frame_total_time.add(time);
+		}
+	}
+
+	GDScriptFunction *top = _call_stack.levels[_call_stack.stack_pos - 1].function;
+	if (top) {
+		top->profile.self_time.add(time);
+		top->profile.frame_self_time.add(time);
+	}
+
+	MutexLock lock(sampled_stacks_mutex);
+	uint64_t *count = sampled_stacks.getptr(key);
+	if (count) {
+		*count += p_ticks;
+	} else {
+		sampled_stacks.insert(key, p_ticks);
+	}
+#endif
+}
+
+String GDScriptLanguage::get_sampled_stacks() {
+	MutexLock lock(sampled_stacks_mutex);
+	String result;
+	for (const KeyValue<String, uint64_t> &E : sampled_stacks) {
+		result += E.key + " " + itos(E.value) + "\n";
+	}
+	return result;
+}
+
 int GDScriptLanguage::profiling_get_accumulated_data(ProfilingInfo *p_info_arr, int p_info_max) {
 	int current = 0;
 #ifdef DEBUG_ENABLED
@@ -2346,7 +2467,7 @@ void GDScriptLanguage::frame() {
 	calls = 0;
 
 #ifdef DEBUG_ENABLED
-	if (profiling) {
+	if (profiling || sampling) {
 		MutexLock lock(this->mutex);
 
 		SelfList<GDScriptFunction> *elem = function_list.first();
@@ -2455,6 +2576,16 @@ bool GDScriptLanguage::handles_global_class_type(const String &p_type) const {
 	return p_type == "GDScript";
 }
 
+// Parses either the source or the binary tokens of an exported script.
+static Error _parse_script_file(GDScriptParser &r_parser, const Vector<uint8_t> &p_contents, const String &p_path) {
+	if (GDScriptTokenizer::is_binary(p_contents)) {
+		return r_parser.parse_binary(p_contents, p_path);
+	}
+	String source;
+	source.parse_utf8((const char *)p_contents.ptr(), p_contents.size());
+	return r_parser.parse(source, p_path, false);
+}
+
 String GDScriptLanguage::get_global_class_name(const String &p_path, String *r_base_type, String *r_icon_path) const {
 	Error err;
 	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
@@ -2462,10 +2593,10 @@ String GDScriptLanguage::get_global_class_name(const String &p_path, String *r_b
 		return String();
 	}
 
-	String source = f->get_as_utf8_string();
+	Vector<uint8_t> contents = f->get_buffer(f->get_length());
 
 	GDScriptParser parser;
-	err = parser.parse(source, p_path, false);
+	err = _parse_script_file(parser, contents, p_path);
 
 	const GDScriptParser::ClassNode *c = parser.get_tree();
 	if (!c) {
@@ -2504,9 +2635,9 @@ String GDScriptLanguage::get_global_class_name(const String &p_path, String *r_b
 						if (subfile.is_null()) {
 							break;
 						}
-						String subsource = subfile->get_as_utf8_string();
+						Vector<uint8_t> subcontents = subfile->get_buffer(subfile->get_length());
 
-						if (subsource.is_empty()) {
+						if (subcontents.is_empty()) {
 							break;
 						}
 						String subpath = subclass->extends_path;
@@ -2514,7 +2645,7 @@ String GDScriptLanguage::get_global_class_name(const String &p_path, String *r_b
 							subpath = path.get_base_dir().path_join(subpath).simplify_path();
 						}
 
-						if (OK != subparser.parse(subsource, subpath, false)) {
+						if (OK != _parse_script_file(subparser, subcontents, subpath)) {
 							break;
 						}
 						path = subpath;
@@ -2560,6 +2691,7 @@ String GDScriptLanguage::get_global_class_name(const String &p_path, String *r_b
 }
 
 thread_local GDScriptLanguage::CallStack GDScriptLanguage::_call_stack;
+thread_local uint32_t GDScriptLanguage::_sample_tick_seen = 0;
 
 GDScriptLanguage::GDScriptLanguage() {
 	calls = 0;
@@ -2582,6 +2714,9 @@ GDScriptLanguage::GDScriptLanguage() {
 	script_frame_time = 0;
 
 	int dmcs = GLOBAL_DEF(PropertyInfo(Variant::INT, "debug/settings/gdscript/max_call_stack", PROPERTY_HINT_RANGE, "512," + itos(GDScriptFunction::MAX_CALL_DEPTH - 1) + ",1"), 1024);
+	GLOBAL_DEF("debug/settings/gdscript/sampling_profiler/enabled", false);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "debug/settings/gdscript/sampling_profiler/interval_usec", PROPERTY_HINT_RANGE, "100,100000,1,suffix:\u00B5s"), 1000);
+	GLOBAL_DEF("debug/settings/gdscript/sampling_profiler/output_file", "");
 
 	if (EngineDebugger::is_active()) {
 		//debugging enabled!
@@ -2591,6 +2726,8 @@ GDScriptLanguage::GDScriptLanguage() {
 		_debug_max_call_stack = 0;
 	}
 
+	GLOBAL_DEF("gdscript/compiler/eliminate_dead_code", true);
+
 #ifdef DEBUG_ENABLED
 	GLOBAL_DEF("debug/gdscript/warnings/enable", true);
 	GLOBAL_DEF("debug/gdscript/warnings/exclude_addons", true);
@@ -2684,13 +2821,13 @@ void ResourceFormatLoaderGDScript::get_dependencies(const String &p_path, List<S
 	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::READ);
 	ERR_FAIL_COND_MSG(file.is_null(), "Cannot open file '" + p_path + "'.");
 
-	String source = file->get_as_utf8_string();
-	if (source.is_empty()) {
+	Vector<uint8_t> contents = file->get_buffer(file->get_length());
+	if (contents.is_empty()) {
 		return;
 	}
 
 	GDScriptParser parser;
-	if (OK != parser.parse(source, p_path, false)) {
+	if (OK != _parse_script_file(parser, contents, p_path)) {
 		return;
 	}
 
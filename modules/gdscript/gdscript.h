@@ -83,6 +83,7 @@ class GDScript : public Script {
 
 	friend class GDScriptInstance;
 	friend class GDScriptFunction;
+	friend struct GDScriptInlineCache;
 	friend class GDScriptAnalyzer;
 	friend class GDScriptCompiler;
 	friend class GDScriptDocGen;
@@ -140,6 +141,7 @@ class GDScript : public Script {
 	bool clearing = false;
 	//exported members
 	String source;
+	Vector<uint8_t> binary_tokens; // Pre-tokenized form of exported scripts, used instead of `source` when not empty.
 	String path;
 	StringName local_name; // Inner class identifier or `class_name`.
 	StringName global_name; // `class_name`.
@@ -294,6 +296,7 @@ public:
 class GDScriptInstance : public ScriptInstance {
 	friend class GDScript;
 	friend class GDScriptFunction;
+	friend struct GDScriptInlineCache;
 	friend class GDScriptLambdaCallable;
 	friend class GDScriptLambdaSelfCallable;
 	friend class GDScriptCompiler;
@@ -311,6 +314,8 @@ class GDScriptInstance : public ScriptInstance {
 
 	SelfList<GDScriptFunctionState>::List pending_func_states;
 
+	void _call_notification(GDScript *p_script, const Variant **p_args, bool p_reversed);
+
 public:
 	virtual Object *get_owner() { return owner; }
 
@@ -400,6 +405,20 @@ class GDScriptLanguage : public ScriptLanguage {
 	bool profiling;
 	uint64_t script_frame_time;
 
+	// Sampling profiler, used instead of timing every call when `debug/settings/gdscript/sampling_profiler/enabled` is set.
+	// A thread advances the tick, and each thread running scripts records its own call stack when it sees a new one.
+	bool sampling = false;
+	uint64_t sampling_interval_usec = 1000;
+	SafeFlag sampling_active;
+	SafeNumeric<uint32_t> sample_tick;
+	static thread_local uint32_t _sample_tick_seen;
+	Thread sampling_thread;
+	Mutex sampled_stacks_mutex;
+	HashMap<String, uint64_t> sampled_stacks;
+
+	static void _sampling_thread_func(void *p_userdata);
+	void _take_sample(uint32_t p_ticks);
+
 	HashMap<String, ObjectID> orphan_subclasses;
 
 public:
@@ -417,6 +436,11 @@ public:
 			EngineDebugger::get_script_debugger()->set_depth(EngineDebugger::get_script_debugger()->get_depth() + 1);
 		}
 
+		if (_call_stack.stack_pos == 0) {
+			// Time spent outside of scripts isn't sampled.
+			_sample_tick_seen = sample_tick.get();
+		}
+
 		if (_call_stack.stack_pos >= _debug_max_call_stack) {
 			//stack overflow
 			_debug_error = vformat("Stack overflow (stack size: %s). Check for infinite recursion in your script.", _debug_max_call_stack);
@@ -446,6 +470,19 @@ public:
 		_call_stack.stack_pos--;
 	}
 
+	_FORCE_INLINE_ void sample_poll() {
+		if (unlikely(sampling)) {
+			uint32_t tick = sample_tick.get();
+			if (tick != _sample_tick_seen) {
+				_take_sample(tick - _sample_tick_seen);
+				_sample_tick_seen = tick;
+			}
+		}
+	}
+
+	// Samples per call stack since profiling started, one "root;...;leaf count" line each, as flame graph tools take them.
+	String get_sampled_stacks();
+
 	virtual Vector<StackInfo> debug_get_current_stack_info() override {
 		Vector<StackInfo> csi;
 		csi.resize(_call_stack.stack_pos);
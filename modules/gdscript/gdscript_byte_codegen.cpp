@@ -383,6 +383,14 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 		function->_methods_count = 0;
 	}
 
+	if (inline_cache_count) {
+		function->_inline_caches_ptr = memnew_arr(GDScriptInlineCache, inline_cache_count);
+		function->_inline_caches_count = inline_cache_count;
+	} else {
+		function->_inline_caches_ptr = nullptr;
+		function->_inline_caches_count = 0;
+	}
+
 	if (lambdas_map.size()) {
 		function->lambdas.resize(lambdas_map.size());
 		function->_lambdas_ptr = function->lambdas.ptrw();
@@ -582,6 +590,81 @@ void GDScriptByteCodeGenerator::write_unary_operator(const Address &p_target, Va
 	}
 }
 
+GDScriptFunction::Opcode GDScriptByteCodeGenerator::get_typed_operator_opcode(Variant::Operator p_operator, Variant::Type p_left_type, Variant::Type p_right_type) {
+	if (p_left_type == Variant::INT && p_right_type == Variant::INT) {
+		switch (p_operator) {
+			case Variant::OP_ADD:
+				return GDScriptFunction::OPCODE_OPERATOR_ADD_INT;
+			case Variant::OP_SUBTRACT:
+				return GDScriptFunction::OPCODE_OPERATOR_SUBTRACT_INT;
+			case Variant::OP_MULTIPLY:
+				return GDScriptFunction::OPCODE_OPERATOR_MULTIPLY_INT;
+			case Variant::OP_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_EQUAL_INT;
+			case Variant::OP_NOT_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_NOT_EQUAL_INT;
+			case Variant::OP_LESS:
+				return GDScriptFunction::OPCODE_OPERATOR_LESS_INT;
+			case Variant::OP_LESS_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_LESS_EQUAL_INT;
+			case Variant::OP_GREATER:
+				return GDScriptFunction::OPCODE_OPERATOR_GREATER_INT;
+			case Variant::OP_GREATER_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_GREATER_EQUAL_INT;
+			default:
+				break;
+		}
+	} else if (p_left_type == Variant::FLOAT && p_right_type == Variant::FLOAT) {
+		switch (p_operator) {
+			case Variant::OP_ADD:
+				return GDScriptFunction::OPCODE_OPERATOR_ADD_FLOAT;
+			case Variant::OP_SUBTRACT:
+				return GDScriptFunction::OPCODE_OPERATOR_SUBTRACT_FLOAT;
+			case Variant::OP_MULTIPLY:
+				return GDScriptFunction::OPCODE_OPERATOR_MULTIPLY_FLOAT;
+			case Variant::OP_DIVIDE:
+				return GDScriptFunction::OPCODE_OPERATOR_DIVIDE_FLOAT;
+			case Variant::OP_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_EQUAL_FLOAT;
+			case Variant::OP_NOT_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_NOT_EQUAL_FLOAT;
+			case Variant::OP_LESS:
+				return GDScriptFunction::OPCODE_OPERATOR_LESS_FLOAT;
+			case Variant::OP_LESS_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_LESS_EQUAL_FLOAT;
+			case Variant::OP_GREATER:
+				return GDScriptFunction::OPCODE_OPERATOR_GREATER_FLOAT;
+			case Variant::OP_GREATER_EQUAL:
+				return GDScriptFunction::OPCODE_OPERATOR_GREATER_EQUAL_FLOAT;
+			default:
+				break;
+		}
+	} else if (p_left_type == Variant::VECTOR2 && p_right_type == Variant::VECTOR2) {
+		switch (p_operator) {
+			case Variant::OP_ADD:
+				return GDScriptFunction::OPCODE_OPERATOR_ADD_VECTOR2;
+			case Variant::OP_SUBTRACT:
+				return GDScriptFunction::OPCODE_OPERATOR_SUBTRACT_VECTOR2;
+			case Variant::OP_MULTIPLY:
+				return GDScriptFunction::OPCODE_OPERATOR_MULTIPLY_VECTOR2;
+			default:
+				break;
+		}
+	} else if (p_left_type == Variant::VECTOR3 && p_right_type == Variant::VECTOR3) {
+		switch (p_operator) {
+			case Variant::OP_ADD:
+				return GDScriptFunction::OPCODE_OPERATOR_ADD_VECTOR3;
+			case Variant::OP_SUBTRACT:
+				return GDScriptFunction::OPCODE_OPERATOR_SUBTRACT_VECTOR3;
+			case Variant::OP_MULTIPLY:
+				return GDScriptFunction::OPCODE_OPERATOR_MULTIPLY_VECTOR3;
+			default:
+				break;
+		}
+	}
+	return GDScriptFunction::OPCODE_OPERATOR_VALIDATED;
+}
+
 void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, Variant::Operator p_operator, const Address &p_left_operand, const Address &p_right_operand) {
 	// Avoid validated evaluator for modulo and division when operands are int, since there's no check for division by zero.
 	if (HAS_BUILTIN_TYPE(p_left_operand) && HAS_BUILTIN_TYPE(p_right_operand) && ((p_operator != Variant::OP_DIVIDE && p_operator != Variant::OP_MODULE) || p_left_operand.type.builtin_type != Variant::INT || p_right_operand.type.builtin_type != Variant::INT)) {
@@ -596,7 +679,8 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 
-		append_opcode(GDScriptFunction::OPCODE_OPERATOR_VALIDATED);
+		// Common numeric operations are done inline, the evaluator is still referenced for the disassembler.
+		append_opcode(get_typed_operator_opcode(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type));
 		append(p_left_operand);
 		append(p_right_operand);
 		append(p_target);
@@ -830,6 +914,7 @@ void GDScriptByteCodeGenerator::write_set_named(const Address &p_target, const S
 	append(p_target);
 	append(p_source);
 	append(p_name);
+	append_inline_cache();
 }
 
 void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const StringName &p_name, const Address &p_source) {
@@ -848,6 +933,7 @@ void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const S
 	append(p_source);
 	append(p_target);
 	append(p_name);
+	append_inline_cache();
 }
 
 void GDScriptByteCodeGenerator::write_set_member(const Address &p_value, const StringName &p_name) {
@@ -1023,6 +1109,94 @@ GDScriptByteCodeGenerator::CallTarget GDScriptByteCodeGenerator::get_call_target
 	}
 }
 
+bool GDScriptByteCodeGenerator::prepare_validated_arguments(const Vector<Variant::Type> &p_types, bool p_variant_takes_any, Vector<Address> &r_arguments, int &r_temporaries) {
+	r_temporaries = 0;
+	if (p_types.size() != r_arguments.size()) {
+		return false;
+	}
+
+	// Typed integers can be converted for float parameters, as a regular call would.
+	for (int i = 0; i < r_arguments.size(); i++) {
+		if (p_types[i] == Variant::NIL && p_variant_takes_any) {
+			continue;
+		}
+		if (!IS_BUILTIN_TYPE(r_arguments[i], p_types[i]) && !(p_types[i] == Variant::FLOAT && IS_BUILTIN_TYPE(r_arguments[i], Variant::INT))) {
+			return false;
+		}
+	}
+
+	GDScriptDataType float_type;
+	float_type.has_type = true;
+	float_type.kind = GDScriptDataType::BUILTIN;
+	float_type.builtin_type = Variant::FLOAT;
+
+	for (int i = 0; i < r_arguments.size(); i++) {
+		if (p_types[i] != Variant::FLOAT || !IS_BUILTIN_TYPE(r_arguments[i], Variant::INT)) {
+			continue;
+		}
+
+		if (r_arguments[i].mode == Address::CONSTANT) {
+			// Convert at compile time, it's usually an integer literal.
+			for (const KeyValue<Variant, int> &E : constant_map) {
+				if (E.value == int(r_arguments[i].address)) {
+					r_arguments.write[i] = Address(Address::CONSTANT, add_or_get_constant(double(int64_t(E.key))), float_type);
+					break;
+				}
+			}
+		}
+		if (!IS_BUILTIN_TYPE(r_arguments[i], Variant::FLOAT)) {
+			Address converted(Address::TEMPORARY, add_temporary(float_type), float_type);
+			write_construct(converted, Variant::FLOAT, { r_arguments[i] });
+			r_arguments.write[i] = converted;
+			r_temporaries++;
+		}
+	}
+
+	return true;
+}
+
+StringName GDScriptByteCodeGenerator::get_typed_utility_function(const StringName &p_function, const Vector<Address> &p_arguments) {
+	// Utility functions taking Variant arguments, and their counterparts for float and int arguments, which return the same value.
+	static const char *typed_utilities[][3] = {
+		{ "abs", "absf", "absi" },
+		{ "sign", "signf", "signi" },
+		{ "floor", "floorf", nullptr },
+		{ "ceil", "ceilf", nullptr },
+		{ "round", "roundf", nullptr },
+		{ "snapped", "snappedf", nullptr },
+		{ "lerp", "lerpf", nullptr },
+		{ "wrap", "wrapf", "wrapi" },
+		{ "clamp", "clampf", "clampi" },
+		{ "min", "minf", "mini" },
+		{ "max", "maxf", "maxi" },
+	};
+
+	if (p_arguments.is_empty()) {
+		return StringName();
+	}
+	Variant::Type type = p_arguments[0].type.builtin_type;
+	for (int i = 0; i < p_arguments.size(); i++) {
+		if (!IS_BUILTIN_TYPE(p_arguments[i], type)) {
+			return StringName();
+		}
+	}
+	if (type != Variant::FLOAT && type != Variant::INT) {
+		return StringName();
+	}
+
+	for (const auto &typed_utility : typed_utilities) {
+		if (p_function != typed_utility[0]) {
+			continue;
+		}
+		const char *typed_function = typed_utility[type == Variant::FLOAT ? 1 : 2];
+		if (typed_function && Variant::get_utility_function_argument_count(typed_function) == p_arguments.size()) {
+			return typed_function;
+		}
+		break;
+	}
+	return StringName();
+}
+
 void GDScriptByteCodeGenerator::write_call(const Address &p_target, const Address &p_base, const StringName &p_function_name, const Vector<Address> &p_arguments) {
 	append_opcode_and_argcount(p_target.mode == Address::NIL ? GDScriptFunction::OPCODE_CALL : GDScriptFunction::OPCODE_CALL_RETURN, 2 + p_arguments.size());
 	for (int i = 0; i < p_arguments.size(); i++) {
@@ -1033,6 +1207,7 @@ void GDScriptByteCodeGenerator::write_call(const Address &p_target, const Addres
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1058,6 +1233,7 @@ void GDScriptByteCodeGenerator::write_call_async(const Address &p_target, const
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1078,38 +1254,44 @@ void GDScriptByteCodeGenerator::write_call_gdscript_utility(const Address &p_tar
 }
 
 void GDScriptByteCodeGenerator::write_call_utility(const Address &p_target, const StringName &p_function, const Vector<Address> &p_arguments) {
-	bool is_validated = true;
-	if (Variant::is_utility_function_vararg(p_function)) {
-		is_validated = false; // Vararg needs runtime checks, can't use validated call.
-	} else if (p_arguments.size() == Variant::get_utility_function_argument_count(p_function)) {
-		bool all_types_exact = true;
-		for (int i = 0; i < p_arguments.size(); i++) {
-			if (!IS_BUILTIN_TYPE(p_arguments[i], Variant::get_utility_function_argument_type(p_function, i))) {
-				all_types_exact = false;
-				break;
-			}
-		}
+	// Calls with statically typed numbers can use the typed version, which doesn't go through Variant evaluation.
+	StringName function = get_typed_utility_function(p_function, p_arguments);
+	if (function == StringName()) {
+		function = p_function;
+	}
 
-		is_validated = all_types_exact;
+	Vector<Address> arguments = p_arguments;
+	int converted_temporaries = 0;
+	bool is_validated = false;
+	if (!Variant::is_utility_function_vararg(function)) { // Vararg needs runtime checks, can't use validated call.
+		Vector<Variant::Type> types;
+		for (int i = 0; i < Variant::get_utility_function_argument_count(function); i++) {
+			types.push_back(Variant::get_utility_function_argument_type(function, i));
+		}
+		// Variant arguments may still be rejected at runtime, which only the regular call reports.
+		is_validated = prepare_validated_arguments(types, false, arguments, converted_temporaries);
 	}
 
 	if (is_validated) {
-		Variant::Type result_type = Variant::has_utility_function_return_value(p_function) ? Variant::get_utility_function_return_type(p_function) : Variant::NIL;
+		Variant::Type result_type = Variant::has_utility_function_return_value(function) ? Variant::get_utility_function_return_type(function) : Variant::NIL;
 		CallTarget ct = get_call_target(p_target, result_type);
 		Variant::Type temp_type = temporaries[ct.target.address].type;
 		if (result_type != temp_type) {
 			write_type_adjust(ct.target, result_type);
 		}
-		append_opcode_and_argcount(GDScriptFunction::OPCODE_CALL_UTILITY_VALIDATED, 1 + p_arguments.size());
-		for (int i = 0; i < p_arguments.size(); i++) {
-			append(p_arguments[i]);
+		append_opcode_and_argcount(GDScriptFunction::OPCODE_CALL_UTILITY_VALIDATED, 1 + arguments.size());
+		for (int i = 0; i < arguments.size(); i++) {
+			append(arguments[i]);
 		}
 		append(ct.target);
-		append(p_arguments.size());
-		append(Variant::get_validated_utility_function(p_function));
+		append(arguments.size());
+		append(Variant::get_validated_utility_function(function));
 		ct.cleanup();
+		for (int i = 0; i < converted_temporaries; i++) {
+			pop_temporary();
+		}
 #ifdef DEBUG_ENABLED
-		add_debug_name(utilities_names, get_utility_pos(Variant::get_validated_utility_function(p_function)), p_function);
+		add_debug_name(utilities_names, get_utility_pos(Variant::get_validated_utility_function(function)), function);
 #endif
 	} else {
 		append_opcode_and_argcount(GDScriptFunction::OPCODE_CALL_UTILITY, 1 + p_arguments.size());
@@ -1125,21 +1307,18 @@ void GDScriptByteCodeGenerator::write_call_utility(const Address &p_target, cons
 }
 
 void GDScriptByteCodeGenerator::write_call_builtin_type(const Address &p_target, const Address &p_base, Variant::Type p_type, const StringName &p_method, bool p_is_static, const Vector<Address> &p_arguments) {
+	Vector<Address> arguments = p_arguments;
+	int converted_temporaries = 0;
 	bool is_validated = false;
 
 	// Check if all types are correct.
-	if (Variant::is_builtin_method_vararg(p_type, p_method)) {
-		is_validated = false; // Vararg needs runtime checks, can't use validated call.
-	} else if (p_arguments.size() == Variant::get_builtin_method_argument_count(p_type, p_method)) {
-		bool all_types_exact = true;
-		for (int i = 0; i < p_arguments.size(); i++) {
-			if (!IS_BUILTIN_TYPE(p_arguments[i], Variant::get_builtin_method_argument_type(p_type, p_method, i))) {
-				all_types_exact = false;
-				break;
-			}
+	if (!Variant::is_builtin_method_vararg(p_type, p_method)) { // Vararg needs runtime checks, can't use validated call.
+		Vector<Variant::Type> types;
+		for (int i = 0; i < Variant::get_builtin_method_argument_count(p_type, p_method); i++) {
+			types.push_back(Variant::get_builtin_method_argument_type(p_type, p_method, i));
 		}
-
-		is_validated = all_types_exact;
+		// Builtin methods don't report errors for Variant arguments, so anything can be passed to those.
+		is_validated = prepare_validated_arguments(types, true, arguments, converted_temporaries);
 	}
 
 	if (!is_validated) {
@@ -1168,16 +1347,19 @@ void GDScriptByteCodeGenerator::write_call_builtin_type(const Address &p_target,
 		write_type_adjust(ct.target, result_type);
 	}
 
-	append_opcode_and_argcount(GDScriptFunction::OPCODE_CALL_BUILTIN_TYPE_VALIDATED, 2 + p_arguments.size());
+	append_opcode_and_argcount(GDScriptFunction::OPCODE_CALL_BUILTIN_TYPE_VALIDATED, 2 + arguments.size());
 
-	for (int i = 0; i < p_arguments.size(); i++) {
-		append(p_arguments[i]);
+	for (int i = 0; i < arguments.size(); i++) {
+		append(arguments[i]);
 	}
 	append(p_base);
 	append(ct.target);
-	append(p_arguments.size());
+	append(arguments.size());
 	append(Variant::get_validated_builtin_method(p_type, p_method));
 	ct.cleanup();
+	for (int i = 0; i < converted_temporaries; i++) {
+		pop_temporary();
+	}
 
 #ifdef DEBUG_ENABLED
 	add_debug_name(builtin_methods_names, get_builtin_method_pos(Variant::get_validated_builtin_method(p_type, p_method)), p_method);
@@ -1306,6 +1488,7 @@ void GDScriptByteCodeGenerator::write_call_self(const Address &p_target, const S
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1319,6 +1502,7 @@ void GDScriptByteCodeGenerator::write_call_self_async(const Address &p_target, c
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1332,6 +1516,7 @@ void GDScriptByteCodeGenerator::write_call_script_function(const Address &p_targ
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append_inline_cache();
 	ct.cleanup();
 }
 
@@ -1500,6 +1685,33 @@ void GDScriptByteCodeGenerator::write_for_assignment(const Address &p_list) {
 	append(p_list);
 }
 
+// Builtin types whose value is stored inside the Variant and needs no deinit.
+bool GDScriptByteCodeGenerator::_is_inline_value_type(const GDScriptDataType &p_type) {
+	if (p_type.kind != GDScriptDataType::BUILTIN) {
+		return false;
+	}
+	switch (p_type.builtin_type) {
+		case Variant::BOOL:
+		case Variant::INT:
+		case Variant::FLOAT:
+		case Variant::VECTOR2:
+		case Variant::VECTOR2I:
+		case Variant::RECT2:
+		case Variant::RECT2I:
+		case Variant::VECTOR3:
+		case Variant::VECTOR3I:
+		case Variant::VECTOR4:
+		case Variant::VECTOR4I:
+		case Variant::PLANE:
+		case Variant::QUATERNION:
+		case Variant::COLOR:
+		case Variant::RID:
+			return true;
+		default:
+			return false;
+	}
+}
+
 void GDScriptByteCodeGenerator::write_for(const Address &p_variable, bool p_use_conversion) {
 	const Address &counter = for_counter_variables.back()->get();
 	const Address &container = for_container_variables.back()->get();
@@ -1547,6 +1759,9 @@ void GDScriptByteCodeGenerator::write_for(const Address &p_variable, bool p_use_
 				case Variant::ARRAY:
 					begin_opcode = GDScriptFunction::OPCODE_ITERATE_BEGIN_ARRAY;
 					iterate_opcode = GDScriptFunction::OPCODE_ITERATE_ARRAY;
+					if (container.type.has_container_element_type() && _is_inline_value_type(container.type.get_container_element_type())) {
+						iterate_opcode = GDScriptFunction::OPCODE_ITERATE_TYPED_ARRAY;
+					}
 					break;
 				case Variant::PACKED_BYTE_ARRAY:
 					begin_opcode = GDScriptFunction::OPCODE_ITERATE_BEGIN_PACKED_BYTE_ARRAY;
@@ -121,6 +121,7 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	RBMap<GDScriptUtilityFunctions::FunctionPtr, int> gds_utilities_map;
 	RBMap<MethodBind *, int> method_bind_map;
 	RBMap<GDScriptFunction *, int> lambdas_map;
+	int inline_cache_count = 0;
 
 #if DEBUG_ENABLED
 	// Keep method and property names for pointer and validated operations.
@@ -353,6 +354,8 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	}
 
 	CallTarget get_call_target(const Address &p_target, Variant::Type p_type = Variant::NIL);
+	bool prepare_validated_arguments(const Vector<Variant::Type> &p_types, bool p_variant_takes_any, Vector<Address> &r_arguments, int &r_temporaries);
+	static StringName get_typed_utility_function(const StringName &p_function, const Vector<Address> &p_arguments);
 
 	int address_of(const Address &p_address) {
 		switch (p_address.mode) {
@@ -450,6 +453,13 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 		opcodes.push_back(get_lambda_function_pos(p_lambda_function));
 	}
 
+	static bool _is_inline_value_type(const GDScriptDataType &p_type);
+	static GDScriptFunction::Opcode get_typed_operator_opcode(Variant::Operator p_operator, Variant::Type p_left_type, Variant::Type p_right_type);
+
+	void append_inline_cache() {
+		opcodes.push_back(inline_cache_count++);
+	}
+
 	void patch_jump(int p_address) {
 		opcodes.write[p_address] = opcodes.size();
 	}
@@ -36,6 +36,7 @@
 #include "gdscript_parser.h"
 
 #include "core/io/file_access.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/vector.h"
 #include "scene/resources/packed_scene.h"
 
@@ -67,10 +68,12 @@ Error GDScriptParserRef::raise_status(Status p_new_status) {
 
 	while (p_new_status > status) {
 		switch (status) {
-			case EMPTY:
+			case EMPTY: {
 				status = PARSED;
-				result = parser->parse(GDScriptCache::get_source_code(path), path, false);
-				break;
+				Vector<uint8_t> binary_tokens;
+				String source = GDScriptCache::get_source_code(path, &binary_tokens);
+				result = binary_tokens.is_empty() ? parser->parse(source, path, false) : parser->parse_binary(binary_tokens, path);
+			} break;
 			case PARSED: {
 				status = INHERITANCE_SOLVED;
 				Error inheritance_result = get_analyzer()->resolve_inheritance();
@@ -220,7 +223,64 @@ Ref<GDScriptParserRef> GDScriptCache::get_parser(const String &p_path, GDScriptP
 	return ref;
 }
 
-String GDScriptCache::get_source_code(const String &p_path) {
+void GDScriptCache::_parse_script_task(void *p_userdata, uint32_t p_index) {
+	Ref<GDScriptParserRef> *parsers = (Ref<GDScriptParserRef> *)p_userdata;
+	parsers[p_index]->raise_status(GDScriptParserRef::PARSED);
+}
+
+// Reads and parses the scripts on the worker thread pool, then analyzes them up to `p_status` on this thread.
+// Analysis stays serial since it pulls the scripts each one depends on, in order, through `get_parser()`.
+// `r_parsers` keeps the results alive, so loading the scripts later reuses them.
+Error GDScriptCache::parse_scripts(const Vector<String> &p_paths, GDScriptParserRef::Status p_status, Vector<Ref<GDScriptParserRef>> &r_parsers) {
+	ERR_FAIL_NULL_V(singleton, ERR_UNCONFIGURED);
+
+	r_parsers.clear();
+	Vector<Ref<GDScriptParserRef>> pending;
+	{
+		MutexLock lock(singleton->mutex);
+		for (const String &path : p_paths) {
+			if (singleton->parser_map.has(path) || !FileAccess::exists(path)) {
+				continue;
+			}
+			// Not in the map until parsed, so no other thread can raise its status meanwhile.
+			Ref<GDScriptParserRef> ref;
+			ref.instantiate();
+			ref->parser = memnew(GDScriptParser);
+			ref->path = path;
+			pending.push_back(ref);
+		}
+	}
+
+	if (!pending.is_empty()) {
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(&GDScriptCache::_parse_script_task, pending.ptrw(), pending.size(), -1, true, SNAME("Parse GDScript files"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	}
+
+	MutexLock lock(singleton->mutex);
+	for (Ref<GDScriptParserRef> &ref : pending) {
+		if (singleton->parser_map.has(ref->path)) {
+			// Requested by another thread while parsing, keep that one.
+			ref->path = String();
+			continue;
+		}
+		singleton->parser_map[ref->path] = ref.ptr();
+	}
+
+	Error err = OK;
+	for (const String &path : p_paths) {
+		Error this_err = OK;
+		Ref<GDScriptParserRef> ref = get_parser(path, p_status, this_err);
+		if (ref.is_valid()) {
+			r_parsers.push_back(ref);
+		}
+		if (this_err != OK && err == OK) {
+			err = this_err;
+		}
+	}
+	return err;
+}
+
+String GDScriptCache::get_source_code(const String &p_path, Vector<uint8_t> *r_binary_tokens) {
 	Vector<uint8_t> source_file;
 	Error err;
 	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
@@ -232,6 +292,12 @@ String GDScriptCache::get_source_code(const String &p_path) {
 	ERR_FAIL_COND_V(r != len, "");
 	source_file.write[len] = 0;
 
+	if (r_binary_tokens && GDScriptTokenizer::is_binary(source_file)) {
+		source_file.resize(len);
+		*r_binary_tokens = source_file;
+		return String();
+	}
+
 	String source;
 	if (source.parse_utf8((const char *)source_file.ptr()) != OK) {
 		ERR_FAIL_V_MSG("", "Script '" + p_path + "' contains invalid unicode (UTF-8), so it was not loaded. Please ensure that scripts are saved in valid UTF-8 unicode.");
@@ -94,11 +94,14 @@ class GDScriptCache {
 
 	Mutex mutex;
 
+	static void _parse_script_task(void *p_userdata, uint32_t p_index);
+
 public:
 	static void move_script(const String &p_from, const String &p_to);
 	static void remove_script(const String &p_path);
 	static Ref<GDScriptParserRef> get_parser(const String &p_path, GDScriptParserRef::Status status, Error &r_error, const String &p_owner = String());
-	static String get_source_code(const String &p_path);
+	static Error parse_scripts(const Vector<String> &p_paths, GDScriptParserRef::Status p_status, Vector<Ref<GDScriptParserRef>> &r_parsers);
+	static String get_source_code(const String &p_path, Vector<uint8_t> *r_binary_tokens = nullptr);
 	static Ref<GDScript> get_shallow_script(const String &p_path, Error &r_error, const String &p_owner = String());
 	static Ref<GDScript> get_full_script(const String &p_path, Error &r_error, const String &p_owner = String(), bool p_update_from_disk = false);
 	static Ref<GDScript> get_cached_script(const String &p_path);
@@ -211,6 +211,34 @@ static bool _can_use_ptrcall(const MethodBind *p_method, const Vector<GDScriptCo
 	return true;
 }
 
+// Non-constant `range()` with typed int arguments, which can be iterated like a constant one instead of building an array.
+static const GDScriptParser::CallNode *_get_typed_range_call(const GDScriptParser::ExpressionNode *p_list) {
+	if (p_list->is_constant || p_list->type != GDScriptParser::Node::CALL) {
+		return nullptr;
+	}
+	const GDScriptParser::CallNode *call = static_cast<const GDScriptParser::CallNode *>(p_list);
+	if (call->is_super || call->callee == nullptr || call->callee->type != GDScriptParser::Node::IDENTIFIER || call->function_name != SNAME("range")) {
+		return nullptr;
+	}
+	if (call->arguments.size() < 1 || call->arguments.size() > 3) {
+		return nullptr;
+	}
+	for (int i = 0; i < call->arguments.size(); i++) {
+		const GDScriptParser::DataType &arg_type = call->arguments[i]->get_datatype();
+		if (!arg_type.is_hard_type() || arg_type.kind != GDScriptParser::DataType::BUILTIN || arg_type.builtin_type != Variant::INT) {
+			return nullptr;
+		}
+	}
+	if (call->arguments.size() == 3) {
+		// `range()` errors on a zero step, only take steps known not to be zero.
+		const GDScriptParser::ExpressionNode *step = call->arguments[2];
+		if (!step->is_constant || step->reduced_value.get_type() != Variant::INT || int(step->reduced_value) == 0) {
+			return nullptr;
+		}
+	}
+	return call;
+}
+
 GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &codegen, Error &r_error, const GDScriptParser::ExpressionNode *p_expression, bool p_root, bool p_initializer, const GDScriptCodeGenerator::Address &p_index_addr) {
 	if (p_expression->is_constant && !(p_expression->get_datatype().is_meta_type && p_expression->get_datatype().kind == GDScriptParser::DataType::CLASS)) {
 		return codegen.add_constant(p_expression->reduced_value);
@@ -1809,6 +1837,14 @@ void GDScriptCompiler::_clear_addresses(CodeGen &codegen, const List<GDScriptCod
 	}
 }
 
+bool GDScriptCompiler::_get_constant_condition(const GDScriptParser::ExpressionNode *p_condition, bool &r_value) {
+	if (!p_condition->is_constant || p_condition->reduced_value.get_type() == Variant::OBJECT) {
+		return false;
+	}
+	r_value = p_condition->reduced_value.booleanize();
+	return true;
+}
+
 Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::SuiteNode *p_block, bool p_add_locals, bool p_reset_locals) {
 	Error err = OK;
 	GDScriptCodeGenerator *gen = codegen.generator;
@@ -1913,6 +1949,20 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 			} break;
 			case GDScriptParser::Node::IF: {
 				const GDScriptParser::IfNode *if_n = static_cast<const GDScriptParser::IfNode *>(s);
+
+				bool constant_condition = false;
+				if (eliminate_dead_code && _get_constant_condition(if_n->condition, constant_condition)) {
+					// Only the branch that can run is compiled, without a jump.
+					const GDScriptParser::SuiteNode *branch = constant_condition ? if_n->true_block : if_n->false_block;
+					if (branch) {
+						err = _parse_block(codegen, branch);
+						if (err) {
+							return err;
+						}
+					}
+					break;
+				}
+
 				GDScriptCodeGenerator::Address condition = _parse_expression(codegen, err, if_n->condition);
 				if (err) {
 					return err;
@@ -1946,9 +1996,41 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 				codegen.start_block();
 				GDScriptCodeGenerator::Address iterator = codegen.add_local(for_n->variable->name, _gdtype_from_datatype(for_n->variable->get_datatype(), codegen.script));
 
-				gen->start_for(iterator.type, _gdtype_from_datatype(for_n->list->get_datatype(), codegen.script));
+				const GDScriptParser::CallNode *range_call = _get_typed_range_call(for_n->list);
+				GDScriptDataType list_type;
+				if (range_call) {
+					// Iterate the bounds directly, as done for constant ranges.
+					list_type.has_type = true;
+					list_type.kind = GDScriptDataType::BUILTIN;
+					list_type.builtin_type = range_call->arguments.size() == 1 ? Variant::INT : (range_call->arguments.size() == 2 ? Variant::VECTOR2I : Variant::VECTOR3I);
+				} else {
+					list_type = _gdtype_from_datatype(for_n->list->get_datatype(), codegen.script);
+				}
+
+				gen->start_for(iterator.type, list_type);
 
-				GDScriptCodeGenerator::Address list = _parse_expression(codegen, err, for_n->list);
+				GDScriptCodeGenerator::Address list;
+				if (range_call && range_call->arguments.size() == 1) {
+					list = _parse_expression(codegen, err, range_call->arguments[0]);
+				} else if (range_call) {
+					list = codegen.add_temporary(list_type);
+					Vector<GDScriptCodeGenerator::Address> bounds;
+					for (int i = 0; i < range_call->arguments.size(); i++) {
+						GDScriptCodeGenerator::Address bound = _parse_expression(codegen, err, range_call->arguments[i]);
+						if (err) {
+							return err;
+						}
+						bounds.push_back(bound);
+					}
+					gen->write_construct(list, list_type.builtin_type, bounds);
+					for (int i = 0; i < bounds.size(); i++) {
+						if (bounds[i].mode == GDScriptCodeGenerator::Address::TEMPORARY) {
+							codegen.generator->pop_temporary();
+						}
+					}
+				} else {
+					list = _parse_expression(codegen, err, for_n->list);
+				}
 				if (err) {
 					return err;
 				}
@@ -1973,6 +2055,12 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 			case GDScriptParser::Node::WHILE: {
 				const GDScriptParser::WhileNode *while_n = static_cast<const GDScriptParser::WhileNode *>(s);
 
+				bool constant_condition = false;
+				if (eliminate_dead_code && _get_constant_condition(while_n->condition, constant_condition) && !constant_condition) {
+					// The loop never runs.
+					break;
+				}
+
 				gen->start_while_condition();
 
 				GDScriptCodeGenerator::Address condition = _parse_expression(codegen, err, while_n->condition);
@@ -2121,6 +2209,11 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 		}
 
 		gen->clean_temporaries();
+
+		if (eliminate_dead_code && (s->type == GDScriptParser::Node::RETURN || s->type == GDScriptParser::Node::BREAK || s->type == GDScriptParser::Node::CONTINUE)) {
+			// The rest of the block is unreachable.
+			break;
+		}
 	}
 
 	if (p_add_locals && p_reset_locals) {
@@ -2993,18 +3086,22 @@ Error GDScriptCompiler::compile(const GDScriptParser *p_parser, GDScript *p_scri
 	const GDScriptParser::ClassNode *root = parser->get_tree();
 
 	source = p_script->get_path();
+	eliminate_dead_code = GLOBAL_GET("gdscript/compiler/eliminate_dead_code");
 
 	// Create scripts for subclasses beforehand so they can be referenced
 	make_scripts(p_script, root, p_keep_state);
 
 	main_script->_owner = nullptr;
 	Error err = _prepare_compilation(main_script, parser->get_tree(), p_keep_state);
+	// Members and functions are replaced, so inline caches resolved against the old ones must miss.
+	GDScriptInlineCache::script_epoch.increment();
 
 	if (err) {
 		return err;
 	}
 
 	err = _compile_class(main_script, root, p_keep_state);
+	GDScriptInlineCache::script_epoch.increment();
 	if (err) {
 		return err;
 	}
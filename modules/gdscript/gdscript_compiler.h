@@ -143,6 +143,9 @@ class GDScriptCompiler {
 	String error;
 	GDScriptParser::ExpressionNode *awaited_node = nullptr;
 	bool has_static_data = false;
+	bool eliminate_dead_code = true;
+
+	static bool _get_constant_condition(const GDScriptParser::ExpressionNode *p_condition, bool &r_value);
 
 public:
 	static void convert_to_initializer_type(Variant &p_variant, const GDScriptParser::VariableNode *p_node);
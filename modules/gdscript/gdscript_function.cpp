@@ -32,6 +32,12 @@
 
 #include "gdscript.h"
 
+#include "core/config/engine.h"
+#include "core/core_string_names.h"
+#include "core/os/mutex.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+
 Variant GDScriptFunction::get_constant(int p_idx) const {
 	ERR_FAIL_INDEX_V(p_idx, constants.size(), "<errconst>");
 	return constants[p_idx];
@@ -104,6 +110,215 @@ void GDScriptFunction::debug_get_stack_member_state(int p_line, List<Pair<String
 	}
 }
 
+/////////////////////
+
+SafeNumeric<uint32_t> GDScriptInlineCache::script_epoch;
+
+bool GDScriptInlineCache::_make_key(const Variant *p_base, Key &r_key) {
+	if (p_base->get_type() != Variant::OBJECT) {
+		return false;
+	}
+	r_key.object = p_base->get_validated_object();
+	if (unlikely(!r_key.object)) {
+		return false; // Let the regular path report freed instances.
+	}
+
+	ScriptInstance *script_instance = r_key.object->get_script_instance();
+	if (script_instance) {
+		if (script_instance->get_language() != GDScriptLanguage::get_singleton() || script_instance->is_placeholder()) {
+			return false;
+		}
+		r_key.instance = static_cast<GDScriptInstance *>(script_instance);
+		r_key.script = r_key.instance->script.ptr();
+		r_key.script_epoch = script_epoch.get();
+	}
+
+	r_key.native_class = &r_key.object->get_class_name();
+	r_key.class_db_id = ClassDB::get_lookup_tables_id();
+	return r_key.class_db_id != nullptr;
+}
+
+const GDScriptInlineCache::Entry *GDScriptInlineCache::_find(const Key &p_key) const {
+	for (uint32_t i = 0; i < ENTRY_COUNT; i++) {
+		const Entry &entry = entries[i];
+		if (entry.ready.is_set() && entry.native_class == p_key.native_class && entry.script == p_key.script && entry.class_db_id == p_key.class_db_id && entry.script_epoch == p_key.script_epoch) {
+			return &entry;
+		}
+	}
+	return nullptr;
+}
+
+void GDScriptInlineCache::_store(const Key &p_key, const Entry &p_entry) {
+	if (used.get() >= ENTRY_COUNT) {
+		return; // Megamorphic, keep resolving every time.
+	}
+	ClassDB::APIType api = ClassDB::get_api_type(*p_key.native_class);
+	if (api == ClassDB::API_EXTENSION || api == ClassDB::API_EDITOR_EXTENSION) {
+		return; // Extension instances can handle names before ClassDB does.
+	}
+
+	uint32_t index = used.postincrement();
+	if (index >= ENTRY_COUNT) {
+		return;
+	}
+	Entry &entry = entries[index];
+	entry.native_class = p_key.native_class;
+	entry.script = p_key.script;
+	entry.class_db_id = p_key.class_db_id;
+	entry.script_epoch = p_key.script_epoch;
+	entry.kind = p_entry.kind;
+	entry.method = p_entry.method;
+	entry.function = p_entry.function;
+	entry.member_index = p_entry.member_index;
+	entry.member_type = p_entry.member_type;
+	entry.ready.set();
+}
+
+bool GDScriptInlineCache::get(const Variant *p_base, const StringName &p_name, Variant &r_ret) {
+	Key key;
+	if (!_make_key(p_base, key)) {
+		return false;
+	}
+
+	const Entry *entry = _find(key);
+	Entry resolved;
+	if (!entry) {
+		// Same order as GDScriptInstance::get() and Object::get(), only members and native properties are cached.
+		const GDScript::MemberInfo *member = key.script ? key.script->member_indices.getptr(p_name) : nullptr;
+		if (member) {
+			if (member->getter) {
+				return false;
+			}
+			resolved.kind = KIND_MEMBER;
+			resolved.member_index = member->index;
+		} else {
+			for (const GDScript *sptr = key.script; sptr; sptr = sptr->_base) {
+				if (sptr->constants.has(p_name) || sptr->static_variables_indices.has(p_name) || sptr->_signals.has(p_name) || sptr->member_functions.has(p_name) || sptr->subclasses.has(p_name) || sptr->member_functions.has(GDScriptLanguage::get_singleton()->strings._get)) {
+					return false;
+				}
+			}
+			const ClassDB::PropertySetGet *psg = ClassDB::get_property_setget(*key.native_class, p_name);
+			if (!psg || psg->index >= 0 || !psg->_getptr) {
+				return false;
+			}
+			resolved.kind = KIND_METHOD_BIND;
+			resolved.method = psg->_getptr;
+		}
+		_store(key, resolved);
+		entry = &resolved;
+	}
+
+	if (entry->kind == KIND_MEMBER) {
+		// Copy first, r_ret may hold the last reference to the instance.
+		r_ret = Variant(key.instance->members[entry->member_index]);
+	} else {
+		Callable::CallError ce;
+		r_ret = entry->method->call(key.object, nullptr, 0, ce);
+	}
+	return true;
+}
+
+bool GDScriptInlineCache::set(const Variant *p_base, const StringName &p_name, const Variant &p_value, bool &r_valid) {
+#ifdef TOOLS_ENABLED
+	if (Engine::get_singleton()->is_editor_hint()) {
+		return false; // Object::set() also tracks edited objects.
+	}
+#endif
+
+	Key key;
+	if (!_make_key(p_base, key)) {
+		return false;
+	}
+
+	const Entry *entry = _find(key);
+	Entry resolved;
+	if (!entry) {
+		// Same order as GDScriptInstance::set() and Object::set(), only members and native properties are cached.
+		const GDScript::MemberInfo *member = key.script ? key.script->member_indices.getptr(p_name) : nullptr;
+		if (member) {
+			if (member->setter) {
+				return false;
+			}
+			resolved.kind = KIND_MEMBER;
+			resolved.member_index = member->index;
+			resolved.member_type = &member->data_type;
+		} else {
+			for (const GDScript *sptr = key.script; sptr; sptr = sptr->_base) {
+				if (sptr->static_variables_indices.has(p_name) || sptr->member_functions.has(GDScriptLanguage::get_singleton()->strings._set)) {
+					return false;
+				}
+			}
+			const ClassDB::PropertySetGet *psg = ClassDB::get_property_setget(*key.native_class, p_name);
+			if (!psg || psg->index >= 0 || !psg->_setptr) {
+				return false;
+			}
+			resolved.kind = KIND_METHOD_BIND;
+			resolved.method = psg->_setptr;
+		}
+		_store(key, resolved);
+		entry = &resolved;
+	}
+
+	if (entry->kind == KIND_MEMBER) {
+		if (entry->member_type->has_type && !entry->member_type->is_type(p_value)) {
+			return false; // Needs a conversion.
+		}
+		key.instance->members.write[entry->member_index] = p_value;
+		r_valid = true;
+	} else {
+		const Variant *args[1] = { &p_value };
+		Callable::CallError ce;
+		entry->method->call(key.object, args, 1, ce);
+		r_valid = ce.error == Callable::CallError::CALL_OK;
+	}
+	return true;
+}
+
+bool GDScriptInlineCache::call(const Variant *p_base, const StringName &p_name, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error) {
+	Key key;
+	if (!_make_key(p_base, key)) {
+		return false;
+	}
+
+	const Entry *entry = _find(key);
+	Entry resolved;
+	if (!entry) {
+		// Same order as GDScriptInstance::callp() and Object::callp().
+		if (p_name == CoreStringNames::get_singleton()->_free || (key.script && p_name == SNAME("_ready"))) {
+			return false;
+		}
+		for (const GDScript *sptr = key.script; sptr && !resolved.function; sptr = sptr->_base) {
+			HashMap<StringName, GDScriptFunction *>::ConstIterator E = sptr->member_functions.find(p_name);
+			if (E) {
+				resolved.kind = KIND_FUNCTION;
+				resolved.function = E->value;
+			}
+		}
+		if (!resolved.function) {
+			resolved.method = ClassDB::get_method(*key.native_class, p_name);
+			if (!resolved.method) {
+				return false;
+			}
+			resolved.kind = KIND_METHOD_BIND;
+		}
+		_store(key, resolved);
+		entry = &resolved;
+	}
+
+#ifdef DEBUG_ENABLED
+	_ObjectDebugLock debug_lock(key.object);
+#endif
+	r_error.error = Callable::CallError::CALL_OK;
+	if (entry->kind == KIND_FUNCTION) {
+		r_ret = entry->function->call(key.instance, p_args, p_argcount, r_error);
+	} else {
+		r_ret = entry->method->call(key.object, p_args, p_argcount, r_error);
+	}
+	return true;
+}
+
+/////////////////////
+
 GDScriptFunction::GDScriptFunction() {
 	name = "<anonymous>";
 #ifdef DEBUG_ENABLED
@@ -117,6 +332,10 @@ GDScriptFunction::GDScriptFunction() {
 GDScriptFunction::~GDScriptFunction() {
 	get_script()->member_functions.erase(name);
 
+	if (_inline_caches_ptr) {
+		memdelete_arr(_inline_caches_ptr);
+	}
+
 	for (int i = 0; i < lambdas.size(); i++) {
 		memdelete(lambdas[i]);
 	}
@@ -214,6 +433,7 @@ Variant GDScriptFunctionState::resume(const Variant &p_arg) {
 	state.result = p_arg;
 	Callable::CallError err;
 	Variant ret = function->call(nullptr, nullptr, 0, err, &state);
+	// The frame is gone now, either finished or moved to the state of the next `await`.
 
 	bool completed = true;
 
@@ -246,12 +466,14 @@ Variant GDScriptFunctionState::resume(const Variant &p_arg) {
 #endif
 	}
 
+	_release_stack();
+
 	return ret;
 }
 
 void GDScriptFunctionState::_clear_stack() {
 	if (state.stack_size) {
-		Variant *stack = (Variant *)state.stack.ptr();
+		Variant *stack = (Variant *)state.stack;
 		// The first 3 are special addresses and not copied to the state, so we skip them here.
 		for (int i = 3; i < state.stack_size; i++) {
 			stack[i].~Variant();
@@ -260,6 +482,56 @@ void GDScriptFunctionState::_clear_stack() {
 	}
 }
 
+// Stack buffers of finished coroutines by size, so the next `await` in a function with the same frame doesn't allocate.
+static Mutex stack_pool_mutex;
+static HashMap<uint32_t, LocalVector<uint8_t *>> stack_pool;
+static const uint32_t STACK_POOL_MAX_PER_SIZE = 256;
+
+SafeNumeric<uint32_t> GDScriptFunctionState::live_count;
+
+uint8_t *GDScriptFunctionState::_alloc_stack(uint32_t p_size) {
+	{
+		MutexLock lock(stack_pool_mutex);
+		LocalVector<uint8_t *> *pool = stack_pool.getptr(p_size);
+		if (pool && !pool->is_empty()) {
+			uint8_t *stack = (*pool)[pool->size() - 1];
+			pool->resize(pool->size() - 1);
+			return stack;
+		}
+	}
+	return (uint8_t *)memalloc(p_size);
+}
+
+void GDScriptFunctionState::_release_stack() {
+	if (!state.stack) {
+		return;
+	}
+	// The variants must be destroyed or moved out already.
+	{
+		MutexLock lock(stack_pool_mutex);
+		LocalVector<uint8_t *> &pool = stack_pool[state.alloca_size];
+		if (pool.size() < STACK_POOL_MAX_PER_SIZE) {
+			pool.push_back(state.stack);
+			state.stack = nullptr;
+		}
+	}
+	if (state.stack) {
+		memfree(state.stack);
+		state.stack = nullptr;
+	}
+	state.stack_size = 0;
+}
+
+void GDScriptFunctionState::clear_stack_pool() {
+	MutexLock lock(stack_pool_mutex);
+	for (KeyValue<uint32_t, LocalVector<uint8_t *>> &E : stack_pool) {
+		for (uint8_t *stack : E.value) {
+			memfree(stack);
+		}
+	}
+	stack_pool.clear();
+}
+
 void GDScriptFunctionState::_clear_connections() {
 	List<Object::Connection> conns;
 	get_signals_connected_to_this(&conns);
@@ -280,6 +552,7 @@ void GDScriptFunctionState::_bind_methods() {
 GDScriptFunctionState::GDScriptFunctionState() :
 		scripts_list(this),
 		instances_list(this) {
+	live_count.increment();
 }
 
 GDScriptFunctionState::~GDScriptFunctionState() {
@@ -288,4 +561,6 @@ GDScriptFunctionState::~GDScriptFunctionState() {
 		scripts_list.remove_from_list();
 		instances_list.remove_from_list();
 	}
+	_release_stack();
+	live_count.decrement();
 }
@@ -43,6 +43,7 @@
 
 class GDScriptInstance;
 class GDScript;
+class GDScriptFunction;
 
 class GDScriptDataType {
 private:
@@ -191,11 +192,86 @@ public:
 	}
 };
 
+// Per-instruction cache for untyped named access and calls on objects. Remembers what the name resolved to for the
+// last few classes (and scripts) seen, entries are never overwritten so threads can read them without locking.
+struct GDScriptInlineCache {
+	static constexpr uint32_t ENTRY_COUNT = 4;
+
+	enum Kind {
+		KIND_METHOD_BIND, // Native getter, setter or method.
+		KIND_MEMBER, // Member variable of the script, without getter or setter.
+		KIND_FUNCTION, // Function of the script.
+	};
+
+	struct Entry {
+		SafeFlag ready;
+		const StringName *native_class = nullptr;
+		const GDScript *script = nullptr;
+		const void *class_db_id = nullptr;
+		uint32_t script_epoch = 0;
+		Kind kind = KIND_METHOD_BIND;
+		MethodBind *method = nullptr;
+		GDScriptFunction *function = nullptr;
+		int member_index = -1;
+		const GDScriptDataType *member_type = nullptr;
+	};
+
+	// Bumped whenever a script is compiled, which invalidates the entries resolved against scripts.
+	static SafeNumeric<uint32_t> script_epoch;
+
+	SafeNumeric<uint32_t> used;
+	Entry entries[ENTRY_COUNT];
+
+	// These return false when the access can't be cached, then the regular Variant path must be used.
+	bool get(const Variant *p_base, const StringName &p_name, Variant &r_ret);
+	bool set(const Variant *p_base, const StringName &p_name, const Variant &p_value, bool &r_valid);
+	bool call(const Variant *p_base, const StringName &p_name, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error);
+
+private:
+	struct Key {
+		Object *object = nullptr;
+		GDScriptInstance *instance = nullptr;
+		const StringName *native_class = nullptr;
+		const GDScript *script = nullptr;
+		const void *class_db_id = nullptr;
+		uint32_t script_epoch = 0;
+	};
+
+	_FORCE_INLINE_ static bool _make_key(const Variant *p_base, Key &r_key);
+	_FORCE_INLINE_ const Entry *_find(const Key &p_key) const;
+	void _store(const Key &p_key, const Entry &p_entry);
+};
+
 class GDScriptFunction {
 public:
 	enum Opcode {
 		OPCODE_OPERATOR,
 		OPCODE_OPERATOR_VALIDATED,
+		OPCODE_OPERATOR_ADD_INT,
+		OPCODE_OPERATOR_SUBTRACT_INT,
+		OPCODE_OPERATOR_MULTIPLY_INT,
+		OPCODE_OPERATOR_EQUAL_INT,
+		OPCODE_OPERATOR_NOT_EQUAL_INT,
+		OPCODE_OPERATOR_LESS_INT,
+		OPCODE_OPERATOR_LESS_EQUAL_INT,
+		OPCODE_OPERATOR_GREATER_INT,
+		OPCODE_OPERATOR_GREATER_EQUAL_INT,
+		OPCODE_OPERATOR_ADD_FLOAT,
+		OPCODE_OPERATOR_SUBTRACT_FLOAT,
+		OPCODE_OPERATOR_MULTIPLY_FLOAT,
+		OPCODE_OPERATOR_DIVIDE_FLOAT,
+		OPCODE_OPERATOR_EQUAL_FLOAT,
+		OPCODE_OPERATOR_NOT_EQUAL_FLOAT,
+		OPCODE_OPERATOR_LESS_FLOAT,
+		OPCODE_OPERATOR_LESS_EQUAL_FLOAT,
+		OPCODE_OPERATOR_GREATER_FLOAT,
+		OPCODE_OPERATOR_GREATER_EQUAL_FLOAT,
+		OPCODE_OPERATOR_ADD_VECTOR2,
+		OPCODE_OPERATOR_SUBTRACT_VECTOR2,
+		OPCODE_OPERATOR_MULTIPLY_VECTOR2,
+		OPCODE_OPERATOR_ADD_VECTOR3,
+		OPCODE_OPERATOR_SUBTRACT_VECTOR3,
+		OPCODE_OPERATOR_MULTIPLY_VECTOR3,
 		OPCODE_TYPE_TEST_BUILTIN,
 		OPCODE_TYPE_TEST_ARRAY,
 		OPCODE_TYPE_TEST_NATIVE,
@@ -324,6 +400,7 @@ public:
 		OPCODE_ITERATE_STRING,
 		OPCODE_ITERATE_DICTIONARY,
 		OPCODE_ITERATE_ARRAY,
+		OPCODE_ITERATE_TYPED_ARRAY,
 		OPCODE_ITERATE_PACKED_BYTE_ARRAY,
 		OPCODE_ITERATE_PACKED_INT32_ARRAY,
 		OPCODE_ITERATE_PACKED_INT64_ARRAY,
@@ -467,6 +544,7 @@ private:
 	int _gds_utilities_count = 0;
 	int _methods_count = 0;
 	int _lambdas_count = 0;
+	int _inline_caches_count = 0;
 
 	int *_code_ptr = nullptr;
 	const int *_default_arg_ptr = nullptr;
@@ -485,6 +563,7 @@ private:
 	const GDScriptUtilityFunctions::FunctionPtr *_gds_utilities_ptr = nullptr;
 	MethodBind **_methods_ptr = nullptr;
 	GDScriptFunction **_lambdas_ptr = nullptr;
+	GDScriptInlineCache *_inline_caches_ptr = nullptr;
 
 #ifdef DEBUG_ENABLED
 	CharString func_cname;
@@ -525,7 +604,7 @@ public:
 		StringName function_name;
 		String script_path;
 #endif
-		Vector<uint8_t> stack;
+		uint8_t *stack = nullptr; // From GDScriptFunctionState::_alloc_stack().
 		int stack_size = 0;
 		uint32_t alloca_size = 0;
 		int ip = 0;
@@ -567,6 +646,11 @@ class GDScriptFunctionState : public RefCounted {
 	SelfList<GDScriptFunctionState> scripts_list;
 	SelfList<GDScriptFunctionState> instances_list;
 
+	static SafeNumeric<uint32_t> live_count;
+
+	static uint8_t *_alloc_stack(uint32_t p_size);
+	void _release_stack();
+
 protected:
 	static void _bind_methods();
 
@@ -577,6 +661,10 @@ public:
 	void _clear_stack();
 	void _clear_connections();
 
+	// Function states alive, each is a coroutine suspended at an `await` or holding the state of one that finished.
+	static uint32_t get_live_count() { return live_count.get(); }
+	static void clear_stack_pool();
+
 	GDScriptFunctionState();
 	~GDScriptFunctionState();
 };
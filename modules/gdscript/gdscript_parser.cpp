@@ -324,6 +324,28 @@ Error GDScriptParser::parse(const String &p_source_code, const String &p_script_
 	tokenizer.set_source_code(source);
 	tokenizer.set_cursor_position(cursor_line, cursor_column);
 	script_path = p_script_path;
+	return _parse_tokens();
+}
+
+Error GDScriptParser::parse_binary(const Vector<uint8_t> &p_binary, const String &p_script_path) {
+	clear();
+
+	Error err = tokenizer.set_binary_tokens(p_binary);
+	ERR_FAIL_COND_V_MSG(err != OK, err, "Invalid binary tokens in script '" + p_script_path + "'.");
+	script_path = p_script_path;
+	return _parse_tokens();
+}
+
+Vector<uint8_t> GDScriptParser::get_binary_tokens(const String &p_source_code, const String &p_script_path) {
+	GDScriptParser parser;
+	parser.tokenizer.set_recording(true);
+	if (parser.parse(p_source_code, p_script_path, false) != OK) {
+		return Vector<uint8_t>();
+	}
+	return GDScriptTokenizer::encode_tokens(parser.tokenizer.get_recorded_tokens());
+}
+
+Error GDScriptParser::_parse_tokens() {
 	current = tokenizer.scan();
 	// Avoid error or newline as the first token.
 	// The latter can mess with the parser when opening files filled exclusively with comments and newlines.
@@ -1441,6 +1441,7 @@ private:
 	void pop_multiline();
 
 	// Main blocks.
+	Error _parse_tokens();
 	void parse_program();
 	ClassNode *parse_class(bool p_is_static);
 	void parse_class_name();
@@ -1525,6 +1526,9 @@ private:
 
 public:
 	Error parse(const String &p_source_code, const String &p_script_path, bool p_for_completion);
+	Error parse_binary(const Vector<uint8_t> &p_binary, const String &p_script_path);
+	// Tokens consumed while parsing the source, in the form read by parse_binary(). Empty if the script has errors.
+	static Vector<uint8_t> get_binary_tokens(const String &p_source_code, const String &p_script_path);
 	ClassNode *get_tree() const { return head; }
 	bool is_tool() const { return _is_tool; }
 	ClassNode *find_class(const String &p_qualified_name) const;
@@ -31,6 +31,7 @@
 #include "gdscript_tokenizer.h"
 
 #include "core/error/error_macros.h"
+#include "core/io/marshalls.h"
 #include "core/string/char_utils.h"
 
 #ifdef DEBUG_ENABLED
@@ -1345,6 +1346,23 @@ void GDScriptTokenizer::_skip_whitespace() {
 }
 
 GDScriptTokenizer::Token GDScriptTokenizer::scan() {
+	if (binary_mode) {
+		// The last recorded token is the EOF, which is returned again if the parser asks for more.
+		Token token = binary_tokens[binary_position];
+		if (binary_position < binary_tokens.size() - 1) {
+			binary_position++;
+		}
+		return token;
+	}
+
+	Token token = _scan_source();
+	if (recording) {
+		recorded_tokens.push_back(token);
+	}
+	return token;
+}
+
+GDScriptTokenizer::Token GDScriptTokenizer::_scan_source() {
 	if (has_error()) {
 		return pop_error();
 	}
@@ -1409,7 +1427,7 @@ GDScriptTokenizer::Token GDScriptTokenizer::scan() {
 		_advance();
 		newline(false);
 		line_continuation = true;
-		return scan(); // Recurse to get next token.
+		return _scan_source(); // Recurse to get next token.
 	}
 
 	line_continuation = false;
@@ -1623,6 +1641,183 @@ GDScriptTokenizer::Token GDScriptTokenizer::scan() {
 	}
 }
 
+// Binary tokens start with this magic and the version, followed by the string and constant tables and then the tokens.
+static const uint8_t binary_magic[4] = { 'G', 'D', 'S', 'C' };
+
+static void _encode_varint(Vector<uint8_t> &r_data, uint32_t p_value) {
+	while (p_value >= 0x80) {
+		r_data.push_back((p_value & 0x7F) | 0x80);
+		p_value >>= 7;
+	}
+	r_data.push_back(p_value);
+}
+
+static void _encode_signed_varint(Vector<uint8_t> &r_data, int32_t p_value) {
+	_encode_varint(r_data, (uint32_t(p_value) << 1) ^ uint32_t(p_value >> 31));
+}
+
+static bool _decode_varint(const uint8_t *p_data, int p_len, int &r_pos, uint32_t &r_value) {
+	r_value = 0;
+	for (int shift = 0; shift < 35; shift += 7) {
+		if (r_pos >= p_len) {
+			return false;
+		}
+		uint8_t byte = p_data[r_pos++];
+		r_value |= uint32_t(byte & 0x7F) << shift;
+		if (!(byte & 0x80)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static bool _decode_signed_varint(const uint8_t *p_data, int p_len, int &r_pos, int32_t &r_value) {
+	uint32_t value;
+	if (!_decode_varint(p_data, p_len, r_pos, value)) {
+		return false;
+	}
+	r_value = int32_t(value >> 1) ^ -int32_t(value & 1);
+	return true;
+}
+
+bool GDScriptTokenizer::is_binary(const Vector<uint8_t> &p_data) {
+	return p_data.size() >= 4 && memcmp(p_data.ptr(), binary_magic, 4) == 0;
+}
+
+Vector<uint8_t> GDScriptTokenizer::encode_tokens(const LocalVector<Token> &p_tokens) {
+	HashMap<String, uint32_t> string_map;
+	Vector<String> strings;
+	Vector<Variant> constants;
+
+	Vector<uint8_t> token_data;
+	int previous_line = 0;
+	for (const Token &token : p_tokens) {
+		ERR_FAIL_COND_V_MSG(token.type == Token::ERROR, Vector<uint8_t>(), "Can't store the tokens of a script with errors.");
+
+		token_data.push_back(token.type);
+
+		// Literals don't need their source, only identifiers and keywords use it.
+		uint32_t string_index = 0;
+		if (token.type != Token::LITERAL && !token.source.is_empty()) {
+			HashMap<String, uint32_t>::Iterator E = string_map.find(token.source);
+			if (E) {
+				string_index = E->value;
+			} else {
+				strings.push_back(token.source);
+				string_index = strings.size();
+				string_map.insert(token.source, string_index);
+			}
+		}
+		_encode_varint(token_data, string_index);
+
+		if (token.type == Token::LITERAL) {
+			_encode_varint(token_data, constants.size());
+			constants.push_back(token.literal);
+		}
+
+		_encode_signed_varint(token_data, token.start_line - previous_line);
+		_encode_signed_varint(token_data, token.end_line - token.start_line);
+		_encode_signed_varint(token_data, token.start_column);
+		_encode_signed_varint(token_data, token.end_column);
+		previous_line = token.start_line;
+	}
+
+	Vector<uint8_t> data;
+	data.resize(4 * 5);
+	uint8_t *w = data.ptrw();
+	memcpy(w, binary_magic, 4);
+	encode_uint32(BINARY_VERSION, w + 4);
+	encode_uint32(strings.size(), w + 8);
+	encode_uint32(constants.size(), w + 12);
+	encode_uint32(p_tokens.size(), w + 16);
+
+	for (const String &E : strings) {
+		CharString utf8 = E.utf8();
+		_encode_varint(data, utf8.length());
+		int pos = data.size();
+		data.resize(pos + utf8.length());
+		memcpy(data.ptrw() + pos, utf8.get_data(), utf8.length());
+	}
+
+	int size = data.size();
+	for (const Variant &E : constants) {
+		int len;
+		Error err = encode_variant_to_buffer(E, data, size, len);
+		ERR_FAIL_COND_V(err != OK, Vector<uint8_t>());
+		size += len;
+	}
+	data.resize(size); // The encoder may leave spare capacity.
+
+	data.append_array(token_data);
+	return data;
+}
+
+Error GDScriptTokenizer::set_binary_tokens(const Vector<uint8_t> &p_data) {
+	ERR_FAIL_COND_V(!is_binary(p_data), ERR_INVALID_DATA);
+	ERR_FAIL_COND_V(p_data.size() < 4 * 5, ERR_INVALID_DATA);
+
+	const uint8_t *r = p_data.ptr();
+	int len = p_data.size();
+	ERR_FAIL_COND_V_MSG(decode_uint32(r + 4) != BINARY_VERSION, ERR_FILE_UNRECOGNIZED, "Binary tokens were exported by an incompatible version of the engine.");
+	uint32_t string_count = decode_uint32(r + 8);
+	uint32_t constant_count = decode_uint32(r + 12);
+	uint32_t token_count = decode_uint32(r + 16);
+	int pos = 4 * 5;
+
+	Vector<String> strings;
+	strings.resize(string_count);
+	for (uint32_t i = 0; i < string_count; i++) {
+		uint32_t size;
+		ERR_FAIL_COND_V(!_decode_varint(r, len, pos, size) || size > uint32_t(len - pos), ERR_INVALID_DATA);
+		strings.write[i].parse_utf8((const char *)r + pos, size);
+		pos += size;
+	}
+
+	Vector<Variant> constants;
+	constants.resize(constant_count);
+	for (uint32_t i = 0; i < constant_count; i++) {
+		int size;
+		Error err = decode_variant(constants.write[i], r + pos, len - pos, &size, false);
+		ERR_FAIL_COND_V(err != OK, ERR_INVALID_DATA);
+		pos += size;
+	}
+
+	ERR_FAIL_COND_V(token_count == 0 || token_count > uint32_t(len - pos), ERR_INVALID_DATA);
+	binary_tokens.resize(token_count);
+	int previous_line = 0;
+	for (uint32_t i = 0; i < token_count; i++) {
+		Token &token = binary_tokens[i];
+		ERR_FAIL_COND_V(pos >= len || r[pos] >= Token::TK_MAX, ERR_INVALID_DATA);
+		token.type = Token::Type(r[pos++]);
+
+		uint32_t string_index;
+		ERR_FAIL_COND_V(!_decode_varint(r, len, pos, string_index) || string_index > string_count, ERR_INVALID_DATA);
+		if (string_index > 0) {
+			token.source = strings[string_index - 1];
+		}
+
+		if (token.type == Token::LITERAL) {
+			uint32_t constant_index;
+			ERR_FAIL_COND_V(!_decode_varint(r, len, pos, constant_index) || constant_index >= constant_count, ERR_INVALID_DATA);
+			token.literal = constants[constant_index];
+		}
+
+		int32_t line_delta, line_count;
+		ERR_FAIL_COND_V(!_decode_signed_varint(r, len, pos, line_delta) || !_decode_signed_varint(r, len, pos, line_count), ERR_INVALID_DATA);
+		ERR_FAIL_COND_V(!_decode_signed_varint(r, len, pos, token.start_column) || !_decode_signed_varint(r, len, pos, token.end_column), ERR_INVALID_DATA);
+		token.start_line = previous_line + line_delta;
+		token.end_line = token.start_line + line_count;
+		token.leftmost_column = token.start_column;
+		token.rightmost_column = token.end_column;
+		previous_line = token.start_line;
+	}
+	ERR_FAIL_COND_V(binary_tokens[token_count - 1].type != Token::TK_EOF, ERR_INVALID_DATA);
+
+	binary_mode = true;
+	binary_position = 0;
+	return OK;
+}
+
 GDScriptTokenizer::GDScriptTokenizer() {
 #ifdef TOOLS_ENABLED
 	if (EditorSettings::get_singleton()) {
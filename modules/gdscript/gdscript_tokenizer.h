@@ -35,6 +35,7 @@
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
 #include "core/templates/vector.h"
+#include "core/templates/local_vector.h"
 #include "core/variant/variant.h"
 
 class GDScriptTokenizer {
@@ -234,6 +235,13 @@ private:
 	HashMap<int, CommentData> comments;
 #endif // TOOLS_ENABLED
 
+	// Binary tokens of exported scripts are replayed as they were recorded when parsing the source.
+	bool binary_mode = false;
+	LocalVector<Token> binary_tokens;
+	uint32_t binary_position = 0;
+	bool recording = false;
+	LocalVector<Token> recorded_tokens;
+
 	_FORCE_INLINE_ bool _is_at_end() { return position >= length; }
 	_FORCE_INLINE_ char32_t _peek(int p_offset = 0) { return position + p_offset >= 0 && position + p_offset < length ? _current[p_offset] : '\0'; }
 	int indent_level() const { return indent_stack.size(); }
@@ -265,6 +273,8 @@ private:
 	Token string();
 	Token annotation();
 
+	Token _scan_source();
+
 public:
 	Token scan();
 
@@ -279,6 +289,13 @@ public:
 	void push_expression_indented_block(); // For lambdas, or blocks inside expressions.
 	void pop_expression_indented_block(); // For lambdas, or blocks inside expressions.
 
+	static const uint32_t BINARY_VERSION = 1;
+	static bool is_binary(const Vector<uint8_t> &p_data);
+	static Vector<uint8_t> encode_tokens(const LocalVector<Token> &p_tokens);
+	Error set_binary_tokens(const Vector<uint8_t> &p_data);
+	void set_recording(bool p_enabled) { recording = p_enabled; }
+	const LocalVector<Token> &get_recorded_tokens() const { return recorded_tokens; }
+
 	GDScriptTokenizer();
 };
 
@@ -190,6 +190,31 @@ void (*type_init_function_table[])(Variant *) = {
 	static const void *switch_table_ops[] = {        \
 		&&OPCODE_OPERATOR,                           \
 		&&OPCODE_OPERATOR_VALIDATED,                 \
+		&&OPCODE_OPERATOR_ADD_INT,                   \
+		&&OPCODE_OPERATOR_SUBTRACT_INT,              \
+		&&OPCODE_OPERATOR_MULTIPLY_INT,              \
+		&&OPCODE_OPERATOR_EQUAL_INT,                 \
+		&&OPCODE_OPERATOR_NOT_EQUAL_INT,             \
+		&&OPCODE_OPERATOR_LESS_INT,                  \
+		&&OPCODE_OPERATOR_LESS_EQUAL_INT,            \
+		&&OPCODE_OPERATOR_GREATER_INT,               \
+		&&OPCODE_OPERATOR_GREATER_EQUAL_INT,         \
+		&&OPCODE_OPERATOR_ADD_FLOAT,                 \
+		&&OPCODE_OPERATOR_SUBTRACT_FLOAT,            \
+		&&OPCODE_OPERATOR_MULTIPLY_FLOAT,            \
+		&&OPCODE_OPERATOR_DIVIDE_FLOAT,              \
+		&&OPCODE_OPERATOR_EQUAL_FLOAT,               \
+		&&OPCODE_OPERATOR_NOT_EQUAL_FLOAT,           \
+		&&OPCODE_OPERATOR_LESS_FLOAT,                \
+		&&OPCODE_OPERATOR_LESS_EQUAL_FLOAT,          \
+		&&OPCODE_OPERATOR_GREATER_FLOAT,             \
+		&&OPCODE_OPERATOR_GREATER_EQUAL_FLOAT,       \
+		&&OPCODE_OPERATOR_ADD_VECTOR2,               \
+		&&OPCODE_OPERATOR_SUBTRACT_VECTOR2,          \
+		&&OPCODE_OPERATOR_MULTIPLY_VECTOR2,          \
+		&&OPCODE_OPERATOR_ADD_VECTOR3,               \
+		&&OPCODE_OPERATOR_SUBTRACT_VECTOR3,          \
+		&&OPCODE_OPERATOR_MULTIPLY_VECTOR3,          \
 		&&OPCODE_TYPE_TEST_BUILTIN,                  \
 		&&OPCODE_TYPE_TEST_ARRAY,                    \
 		&&OPCODE_TYPE_TEST_NATIVE,                   \
@@ -317,6 +342,7 @@ void (*type_init_function_table[])(Variant *) = {
 		&&OPCODE_ITERATE_STRING,                     \
 		&&OPCODE_ITERATE_DICTIONARY,                 \
 		&&OPCODE_ITERATE_ARRAY,                      \
+		&&OPCODE_ITERATE_TYPED_ARRAY,                \
 		&&OPCODE_ITERATE_PACKED_BYTE_ARRAY,          \
 		&&OPCODE_ITERATE_PACKED_INT32_ARRAY,         \
 		&&OPCODE_ITERATE_PACKED_INT64_ARRAY,         \
@@ -446,6 +472,8 @@ void (*type_init_function_table[])(Variant *) = {
 Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_args, int p_argcount, Callable::CallError &r_err, CallState *p_state) {
 	OPCODES_TABLE;
 
+	MEMORY_TAG_SCOPE("GDScript");
+
 	if (!_code_ptr) {
 		return _get_default_variant_for_data_type(return_type);
 	}
@@ -492,17 +520,18 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 #endif
 
 	uint32_t alloca_size = 0;
+	bool stack_moved = false;
 	GDScript *script;
 	int ip = 0;
 	int line = _initial_line;
 
 	if (p_state) {
 		//use existing (supplied) state (awaited)
-		stack = (Variant *)p_state->stack.ptr();
-		instruction_args = (Variant **)&p_state->stack.ptr()[sizeof(Variant) * p_state->stack_size]; //ptr() to avoid bounds check
+		stack = (Variant *)p_state->stack;
+		instruction_args = (Variant **)&p_state->stack[sizeof(Variant) * p_state->stack_size];
 		line = p_state->line;
 		ip = p_state->ip;
-		alloca_size = p_state->stack.size();
+		alloca_size = p_state->alloca_size;
 		script = p_state->script;
 		p_instance = p_state->instance;
 		defarg = p_state->defarg;
@@ -780,6 +809,43 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+#define OPCODE_OPERATOR_TYPED(m_op, m_type, m_get_func, m_ret_get_func, m_operator)                                         \
+	OPCODE(OPCODE_OPERATOR_##m_op##_##m_type) {                                                                             \
+		CHECK_SPACE(5);                                                                                                     \
+		GET_VARIANT_PTR(a, 0);                                                                                              \
+		GET_VARIANT_PTR(b, 1);                                                                                              \
+		GET_VARIANT_PTR(dst, 2);                                                                                            \
+		*VariantInternal::m_ret_get_func(dst) = *VariantInternal::m_get_func(a) m_operator *VariantInternal::m_get_func(b); \
+		ip += 5;                                                                                                            \
+	}                                                                                                                       \
+	DISPATCH_OPCODE
+
+			OPCODE_OPERATOR_TYPED(ADD, INT, get_int, get_int, +);
+			OPCODE_OPERATOR_TYPED(SUBTRACT, INT, get_int, get_int, -);
+			OPCODE_OPERATOR_TYPED(MULTIPLY, INT, get_int, get_int, *);
+			OPCODE_OPERATOR_TYPED(EQUAL, INT, get_int, get_bool, ==);
+			OPCODE_OPERATOR_TYPED(NOT_EQUAL, INT, get_int, get_bool, !=);
+			OPCODE_OPERATOR_TYPED(LESS, INT, get_int, get_bool, <);
+			OPCODE_OPERATOR_TYPED(LESS_EQUAL, INT, get_int, get_bool, <=);
+			OPCODE_OPERATOR_TYPED(GREATER, INT, get_int, get_bool, >);
+			OPCODE_OPERATOR_TYPED(GREATER_EQUAL, INT, get_int, get_bool, >=);
+			OPCODE_OPERATOR_TYPED(ADD, FLOAT, get_float, get_float, +);
+			OPCODE_OPERATOR_TYPED(SUBTRACT, FLOAT, get_float, get_float, -);
+			OPCODE_OPERATOR_TYPED(MULTIPLY, FLOAT, get_float, get_float, *);
+			OPCODE_OPERATOR_TYPED(DIVIDE, FLOAT, get_float, get_float, /);
+			OPCODE_OPERATOR_TYPED(EQUAL, FLOAT, get_float, get_bool, ==);
+			OPCODE_OPERATOR_TYPED(NOT_EQUAL, FLOAT, get_float, get_bool, !=);
+			OPCODE_OPERATOR_TYPED(LESS, FLOAT, get_float, get_bool, <);
+			OPCODE_OPERATOR_TYPED(LESS_EQUAL, FLOAT, get_float, get_bool, <=);
+			OPCODE_OPERATOR_TYPED(GREATER, FLOAT, get_float, get_bool, >);
+			OPCODE_OPERATOR_TYPED(GREATER_EQUAL, FLOAT, get_float, get_bool, >=);
+			OPCODE_OPERATOR_TYPED(ADD, VECTOR2, get_vector2, get_vector2, +);
+			OPCODE_OPERATOR_TYPED(SUBTRACT, VECTOR2, get_vector2, get_vector2, -);
+			OPCODE_OPERATOR_TYPED(MULTIPLY, VECTOR2, get_vector2, get_vector2, *);
+			OPCODE_OPERATOR_TYPED(ADD, VECTOR3, get_vector3, get_vector3, +);
+			OPCODE_OPERATOR_TYPED(SUBTRACT, VECTOR3, get_vector3, get_vector3, -);
+			OPCODE_OPERATOR_TYPED(MULTIPLY, VECTOR3, get_vector3, get_vector3, *);
+
 			OPCODE(OPCODE_TYPE_TEST_BUILTIN) {
 				CHECK_SPACE(4);
 
@@ -1071,7 +1137,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_SET_NAMED) {
-				CHECK_SPACE(3);
+				CHECK_SPACE(4);
 
 				GET_VARIANT_PTR(dst, 0);
 				GET_VARIANT_PTR(value, 1);
@@ -1081,8 +1147,13 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
+				int cache_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_idx < 0 || cache_idx >= _inline_caches_count);
+
 				bool valid;
-				dst->set_named(*index, *value, valid);
+				if (!_inline_caches_ptr[cache_idx].set(dst, *index, *value, valid)) {
+					dst->set_named(*index, *value, valid);
+				}
 
 #ifdef DEBUG_ENABLED
 				if (!valid) {
@@ -1099,7 +1170,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					OPCODE_BREAK;
 				}
 #endif
-				ip += 4;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1119,7 +1190,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_GET_NAMED) {
-				CHECK_SPACE(4);
+				CHECK_SPACE(5);
 
 				GET_VARIANT_PTR(src, 0);
 				GET_VARIANT_PTR(dst, 1);
@@ -1129,22 +1200,28 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
-				bool valid;
-#ifdef DEBUG_ENABLED
-				//allow better error message in cases where src and dst are the same stack position
-				Variant ret = src->get_named(*index, valid);
+				int cache_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(cache_idx < 0 || cache_idx >= _inline_caches_count);
 
-#else
-				*dst = src->get_named(*index, valid);
-#endif
 #ifdef DEBUG_ENABLED
+				//allow better error message in cases where src and dst are the same stack position
+				Variant ret;
+				bool valid = _inline_caches_ptr[cache_idx].get(src, *index, ret);
+				if (!valid) {
+					ret = src->get_named(*index, valid);
+				}
 				if (!valid) {
 					err_text = "Invalid get index '" + index->operator String() + "' (on base: '" + _get_var_type(src) + "').";
 					OPCODE_BREAK;
 				}
 				*dst = ret;
+#else
+				if (!_inline_caches_ptr[cache_idx].get(src, *index, *dst)) {
+					bool valid;
+					*dst = src->get_named(*index, valid);
+				}
 #endif
-				ip += 4;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1670,7 +1747,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				bool call_async = (_code_ptr[ip]) == OPCODE_CALL_ASYNC;
 #endif
 				LOAD_INSTRUCTION_ARGS
-				CHECK_SPACE(3 + instr_arg_count);
+				CHECK_SPACE(4 + instr_arg_count);
 
 				ip += instr_arg_count;
 
@@ -1681,6 +1758,10 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(methodname_idx < 0 || methodname_idx >= _global_names_count);
 				const StringName *methodname = &_global_names_ptr[methodname_idx];
 
+				int cache_idx = _code_ptr[ip + 3];
+				GD_ERR_BREAK(cache_idx < 0 || cache_idx >= _inline_caches_count);
+				GDScriptInlineCache *inline_cache = &_inline_caches_ptr[cache_idx];
+
 				GET_INSTRUCTION_ARG(base, argc);
 				Variant **argptrs = instruction_args;
 
@@ -1700,7 +1781,9 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					Object *base_obj = base->get_validated_object();
 					StringName base_class = base_obj ? base_obj->get_class_name() : StringName();
 #endif
-					base->callp(*methodname, (const Variant **)argptrs, argc, *ret, err);
+					if (!inline_cache->call(base, *methodname, (const Variant **)argptrs, argc, *ret, err)) {
+						base->callp(*methodname, (const Variant **)argptrs, argc, *ret, err);
+					}
 #ifdef DEBUG_ENABLED
 					if (ret->get_type() == Variant::NIL) {
 						if (base_type == Variant::OBJECT) {
@@ -1730,7 +1813,9 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 #endif
 				} else {
 					Variant ret;
-					base->callp(*methodname, (const Variant **)argptrs, argc, ret, err);
+					if (!inline_cache->call(base, *methodname, (const Variant **)argptrs, argc, ret, err)) {
+						base->callp(*methodname, (const Variant **)argptrs, argc, ret, err);
+					}
 				}
 #ifdef DEBUG_ENABLED
 				if (GDScriptLanguage::get_singleton()->profiling) {
@@ -1775,7 +1860,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 #endif
 
-				ip += 3;
+				ip += 4;
 			}
 			DISPATCH_OPCODE;
 
@@ -2401,12 +2486,12 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					Ref<GDScriptFunctionState> gdfs = memnew(GDScriptFunctionState);
 					gdfs->function = this;
 
-					gdfs->state.stack.resize(alloca_size);
+					gdfs->state.stack = GDScriptFunctionState::_alloc_stack(alloca_size);
 
 					// First 3 stack addresses are special, so we just skip them here.
-					for (int i = 3; i < _stack_size; i++) {
-						memnew_placement(&gdfs->state.stack.write[sizeof(Variant) * i], Variant(stack[i]));
-					}
+					// The rest is moved rather than copied, the frame is left when the function returns below.
+					memcpy((void *)&gdfs->state.stack[sizeof(Variant) * FIXED_ADDRESSES_MAX], (const void *)&stack[FIXED_ADDRESSES_MAX], sizeof(Variant) * (_stack_size - FIXED_ADDRESSES_MAX));
+					stack_moved = true;
 					gdfs->state.stack_size = _stack_size;
 					gdfs->state.alloca_size = alloca_size;
 					gdfs->state.ip = ip + 2;
@@ -3040,7 +3125,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 				if (!array->is_empty()) {
 					GET_VARIANT_PTR(iterator, 2);
-					*iterator = array->get(0);
+					*iterator = (*array)[0];
 
 					// Skip regular iterate.
 					ip += 5;
@@ -3379,7 +3464,36 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					ip = jumpto;
 				} else {
 					GET_VARIANT_PTR(iterator, 2);
-					*iterator = array->get(*idx);
+					*iterator = (*array)[*idx];
+
+					ip += 5; // Loop again.
+				}
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_ITERATE_TYPED_ARRAY) {
+				CHECK_SPACE(4);
+
+				GET_VARIANT_PTR(counter, 0);
+				GET_VARIANT_PTR(container, 1);
+
+				const Array *array = VariantInternal::get_array((const Variant *)container);
+				int64_t *idx = VariantInternal::get_int(counter);
+				(*idx)++;
+
+				if (*idx >= array->size()) {
+					int jumpto = _code_ptr[ip + 4];
+					GD_ERR_BREAK(jumpto < 0 || jumpto > _code_size);
+					ip = jumpto;
+				} else {
+					GET_VARIANT_PTR(iterator, 2);
+					const Variant &element = (*array)[*idx];
+					// The array is typed with a value type stored inline, so the value can be copied without going through Variant assignment.
+					if (likely(iterator->get_type() == element.get_type() && (uint32_t)element.get_type() == array->get_typed_builtin())) {
+						VariantInternal::copy_inline_value(iterator, &element);
+					} else {
+						*iterator = element;
+					}
 
 					ip += 5; // Loop again.
 				}
@@ -3612,6 +3726,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					}
 
 					EngineDebugger::get_singleton()->line_poll();
+					GDScriptLanguage::get_singleton()->sample_poll();
 				}
 			}
 			DISPATCH_OPCODE;
@@ -3692,9 +3807,11 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 		}
 #endif
 
-		// Free stack, except reserved addresses.
-		for (int i = FIXED_ADDRESSES_MAX; i < _stack_size; i++) {
-			stack[i].~Variant();
+		// Free stack, except reserved addresses and what was moved to the state of an `await`.
+		if (!stack_moved) {
+			for (int i = FIXED_ADDRESSES_MAX; i < _stack_size; i++) {
+				stack[i].~Variant();
+			}
 		}
 #ifdef DEBUG_ENABLED
 	}
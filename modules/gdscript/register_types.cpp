@@ -33,6 +33,7 @@
 #include "gdscript.h"
 #include "gdscript_analyzer.h"
 #include "gdscript_cache.h"
+#include "gdscript_parser.h"
 #include "gdscript_tokenizer.h"
 #include "gdscript_utility_functions.h"
 
@@ -82,6 +83,15 @@ class EditorExportGDScript : public EditorExportPlugin {
 	GDCLASS(EditorExportGDScript, EditorExportPlugin);
 
 public:
+	enum ScriptExportMode {
+		EXPORT_TEXT,
+		EXPORT_BINARY_TOKENS,
+	};
+
+	virtual void _get_export_options(const Ref<EditorExportPlatform> &p_export_platform, List<EditorExportPlatform::ExportOption> *r_options) const override {
+		r_options->push_back(EditorExportPlatform::ExportOption(PropertyInfo(Variant::INT, "script_export_mode", PROPERTY_HINT_ENUM, "Text,Binary Tokens"), EXPORT_BINARY_TOKENS));
+	}
+
 	virtual void _export_file(const String &p_path, const String &p_type, const HashSet<String> &p_features) override {
 		String script_key;
 
@@ -95,7 +105,18 @@ public:
 			return;
 		}
 
-		return;
+		if (int(get_option("script_export_mode")) != EXPORT_BINARY_TOKENS) {
+			return;
+		}
+
+		// Scripts with parse errors are exported as text, so the errors are still reported at runtime.
+		Vector<uint8_t> tokens = GDScriptParser::get_binary_tokens(FileAccess::get_file_as_string(p_path), p_path);
+		if (tokens.is_empty()) {
+			return;
+		}
+
+		skip();
+		add_file(p_path, tokens, false);
 	}
 
 	virtual String get_name() const override { return "GDScript"; }
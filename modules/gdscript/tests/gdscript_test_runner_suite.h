@@ -33,6 +33,9 @@
 
 #include "gdscript_test_runner.h"
 
+#include "../gdscript_cache.h"
+#include "../gdscript_parser.h"
+
 #include "tests/test_macros.h"
 
 namespace GDScriptTests {
@@ -71,6 +74,60 @@ func _init():
 	CHECK_MESSAGE(int(ref_counted->get_meta("result")) == 42, "The script should assign object metadata successfully.");
 }
 
+TEST_CASE("[Modules][GDScript] Binary tokens parse like the source") {
+	const String source = R"(
+extends RefCounted
+
+const NAMES = ["a", "b"]
+var value := 1.5
+
+func sum(a: int,
+		b: int) -> int:
+	if a > b:
+		return a - b
+	return a + (
+		b)
+)";
+
+	const Vector<uint8_t> tokens = GDScriptParser::get_binary_tokens(source, "res://test.gd");
+	REQUIRE_MESSAGE(GDScriptTokenizer::is_binary(tokens), "Valid scripts should produce binary tokens.");
+
+	GDScriptParser text_parser;
+	REQUIRE(text_parser.parse(source, "res://test.gd", false) == OK);
+	GDScriptParser binary_parser;
+	REQUIRE_MESSAGE(binary_parser.parse_binary(tokens, "res://test.gd") == OK, "Binary tokens should parse successfully.");
+
+	const GDScriptParser::ClassNode *text_tree = text_parser.get_tree();
+	const GDScriptParser::ClassNode *binary_tree = binary_parser.get_tree();
+	REQUIRE(binary_tree->members.size() == text_tree->members.size());
+	for (int i = 0; i < text_tree->members.size(); i++) {
+		CHECK(binary_tree->members[i].get_name() == text_tree->members[i].get_name());
+		CHECK(binary_tree->members[i].get_line() == text_tree->members[i].get_line());
+	}
+
+	CHECK_MESSAGE(GDScriptParser::get_binary_tokens("func broken(:\n", "res://broken.gd").is_empty(), "Scripts with errors should not produce binary tokens.");
+}
+
+TEST_CASE("[Modules][GDScript] Parse scripts in parallel") {
+	Vector<String> paths;
+	paths.push_back("modules/gdscript/tests/scripts/runtime/features/typed_range_loop.gd");
+	paths.push_back("modules/gdscript/tests/scripts/runtime/features/dead_code_elimination.gd");
+	paths.push_back("modules/gdscript/tests/scripts/runtime/features/await_keeps_locals.gd");
+
+	Vector<Ref<GDScriptParserRef>> parsers;
+	REQUIRE(GDScriptCache::parse_scripts(paths, GDScriptParserRef::PARSED, parsers) == OK);
+	REQUIRE(parsers.size() == paths.size());
+
+	for (int i = 0; i < paths.size(); i++) {
+		CHECK(parsers[i]->get_status() == GDScriptParserRef::PARSED);
+		CHECK(parsers[i]->get_parser()->get_tree() != nullptr);
+
+		Error err = OK;
+		Ref<GDScriptParserRef> cached = GDScriptCache::get_parser(paths[i], GDScriptParserRef::PARSED, err);
+		CHECK_MESSAGE(cached == parsers[i], "Later lookups should reuse the parsed script.");
+	}
+}
+
 TEST_CASE("[Modules][GDScript] Validate built-in API") {
 	GDScriptLanguage *lang = GDScriptLanguage::get_singleton();
 
@@ -0,0 +1,21 @@
+# Locals of coroutines survive being suspended and resumed several times.
+
+signal step(value)
+
+func worker(label):
+	var total = 0
+	var values = []
+	for _i in 3:
+		var value = await step
+		total += value
+		values.push_back(value)
+	print(label, " ", total, " ", values)
+
+func test():
+	worker("first")
+	step.emit(1)
+	worker("second")
+	step.emit(2)
+	step.emit(3)
+	step.emit(4)
+	print("done")
@@ -0,0 +1,36 @@
+# Branches that can't run aren't compiled, the ones that can still behave the same.
+
+const ENABLED = true
+const DISABLED = false
+
+func early_return() -> int:
+	return 1
+	print("unreachable")
+	return 2
+
+func test():
+	if ENABLED:
+		print("enabled")
+	else:
+		print("not enabled")
+
+	if DISABLED:
+		print("disabled")
+	elif ENABLED:
+		print("elif enabled")
+
+	if DISABLED:
+		print("disabled without else")
+
+	while DISABLED:
+		print("never looped")
+
+	var count := 0
+	while true:
+		count += 1
+		if count < 3:
+			continue
+		break
+	print(count)
+
+	print(early_return())
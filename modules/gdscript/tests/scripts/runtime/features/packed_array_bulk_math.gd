@@ -0,0 +1,25 @@
+func test():
+	var a := PackedFloat32Array([1.0, 2.0, 3.0, 4.0])
+	var b := PackedFloat32Array([4.0, 3.0, 2.0, 1.0])
+	print(a.add(b))
+	print(a.multiply(b))
+	print(a.scale(0.5))
+	print(a.lerp(b, 0.5))
+	print(a.sum(), " ", a.min(), " ", a.max())
+
+	var indices := PackedInt32Array([3, 0, 0])
+	print(a.gather(indices))
+	var c := PackedFloat64Array([0.0, 0.0, 0.0])
+	c.scatter(PackedInt32Array([2, 0]), PackedFloat64Array([5.0, 7.0]))
+	print(c)
+
+	var v := PackedVector2Array([Vector2(3, 4), Vector2(1, 0)])
+	var w := PackedVector2Array([Vector2(1, 1), Vector2(0, 2)])
+	print(v.add(w))
+	print(v.dot(w))
+	print(v.lengths())
+	print(v.sum())
+
+	var p := PackedVector3Array([Vector3(1, 2, 3), Vector3(-1, 0, 1)])
+	print(p.multiply(p))
+	print(p.sum())
@@ -0,0 +1,25 @@
+func test():
+	var ints: Array[int] = [1, 2, 3]
+	var int_sum := 0
+	for value in ints:
+		int_sum += value
+	print(int_sum)
+
+	var vectors: Array[Vector3] = [Vector3(1, 0, 0), Vector3(0, 2, 0), Vector3(0, 0, 3)]
+	var vector_sum := Vector3()
+	for vector: Vector3 in vectors:
+		vector_sum += vector
+	print(vector_sum)
+
+	# Changing the loop variable must not change the array.
+	for value in ints:
+		value *= 10
+	print(ints)
+
+	var names: Array[String] = ["a", "b"]
+	for text in names:
+		print(text)
+
+	ints.make_read_only()
+	for value in ints:
+		print(value)
@@ -0,0 +1,24 @@
+# Typed int and float operators have their own opcodes.
+
+func test():
+	var a: int = 7
+	var b: int = -3
+	print(a + b, " ", a - b, " ", a * b)
+	print(a == b, " ", a != b, " ", a < b, " ", a <= b, " ", a > b, " ", a >= b)
+
+	var x: float = 1.5
+	var y: float = 0.5
+	print(x + y, " ", x - y, " ", x * y, " ", x / y)
+	print(x == y, " ", x != y, " ", x < y, " ", x <= y, " ", x > y, " ", x >= y)
+
+	var total: int = 0
+	var i: int = 0
+	while i < 10:
+		total = total + i * i
+		i = i + 1
+	print(total)
+
+	var sum: float = 0.0
+	for _j in 4:
+		sum = sum + 0.25
+	print(sum == 1.0)
@@ -0,0 +1,34 @@
+# Non-constant `range()` calls with typed int arguments iterate without building an array.
+
+func test():
+	var count := 4
+	var from := 2
+	var to := 7
+	var result := []
+
+	for i in range(count):
+		result.push_back(i)
+	print(result)
+
+	result.clear()
+	for i in range(from, to):
+		result.push_back(i)
+	print(result)
+
+	result.clear()
+	for i in range(to, from, -2):
+		result.push_back(i)
+	print(result)
+
+	result.clear()
+	for i in range(to, from):
+		result.push_back(i)
+	print(result)
+
+	var a := Vector2(1.5, 2.0)
+	var b := Vector2(0.5, -1.0)
+	print(a + b, " ", a - b, " ", a * b)
+
+	var c := Vector3(1.0, 2.0, 3.0)
+	var d := Vector3(2.0, 0.5, -1.0)
+	print(c + d, " ", c - d, " ", c * d)
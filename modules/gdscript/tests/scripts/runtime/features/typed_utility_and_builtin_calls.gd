@@ -0,0 +1,28 @@
+# Statically typed calls are compiled to validated calls, these must return the same as regular ones.
+
+func test():
+	var f: float = 2.5
+	var i: int = -3
+
+	print(clamp(f, 0.0, 1.0))
+	print(clamp(i, -1, 1))
+	print(typeof(clamp(i, -1, 1)) == TYPE_INT)
+	print(lerp(f, 4.5, 0.5))
+	print(abs(i))
+	print(typeof(abs(i)) == TYPE_INT)
+	print(sign(f))
+	print(floor(f))
+	print(max(i, 7))
+	print(wrap(i, 0, 5))
+
+	# Integers passed as floats.
+	print(clampf(f, 0, 2))
+	print(lerpf(0, 10, 0.25))
+	print(lerpf(i, 1, 0.5))
+
+	var v := Vector3(3, 0, 4)
+	print(v.length())
+	var array: Array[int] = []
+	array.push_back(i)
+	array.append(7)
+	print(array)
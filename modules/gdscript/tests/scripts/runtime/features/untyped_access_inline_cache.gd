@@ -0,0 +1,68 @@
+# Each untyped access below sees more classes than its inline cache holds.
+
+class A:
+	var value = 1
+
+	func describe():
+		return "A %s" % value
+
+class B:
+	var value = "b"
+
+	func describe():
+		return "B %s" % value
+
+class C extends Resource:
+	var value = 3:
+		set(v):
+			value = v * 2
+
+	func describe():
+		return "C %s" % value
+
+class D extends A:
+	func describe():
+		return "D %s" % value
+
+class E:
+	var value: float = 0.0
+
+	func describe():
+		return "E %s" % value
+
+func read(obj):
+	@warning_ignore("unsafe_property_access")
+	var result = obj.value
+	return result
+
+func write(obj, v):
+	@warning_ignore("unsafe_property_access")
+	obj.value = v
+
+func describe(obj):
+	@warning_ignore("unsafe_method_access")
+	var result = obj.describe()
+	return result
+
+func rename(obj, v):
+	@warning_ignore("unsafe_property_access")
+	obj.resource_name = v
+	@warning_ignore("unsafe_property_access", "unsafe_method_access")
+	var result = obj.resource_name + " " + obj.get_class()
+	return result
+
+func test():
+	var objects = [A.new(), B.new(), C.new(), D.new(), E.new()]
+	for i in 2:
+		for obj in objects:
+			write(obj, read(obj))
+			print(describe(obj))
+
+	# Typed members still convert the assigned value.
+	var e = E.new()
+	write(e, 5)
+	print(typeof(read(e)) == TYPE_FLOAT)
+
+	# Native properties and methods, with and without a script.
+	for resource in [Resource.new(), C.new(), Resource.new()]:
+		print(rename(resource, "res"))
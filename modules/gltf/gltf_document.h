@@ -146,6 +146,21 @@ private:
 	Vector<Transform3D> _decode_accessor_as_xform(Ref<GLTFState> p_state,
 			const GLTFAccessorIndex p_accessor,
 			const bool p_for_vertex);
+	struct MeshParseTask {
+		Dictionary mesh;
+		String name;
+		Ref<GLTFMesh> result;
+		LocalVector<Ref<BaseMaterial3D>> vertex_color_materials;
+		Error error = OK;
+	};
+
+	struct MeshParseData {
+		Ref<GLTFState> state;
+		LocalVector<MeshParseTask> tasks;
+	};
+
+	void _parse_mesh_task(uint32_t p_index, MeshParseData *p_data);
+	Error _parse_mesh(Ref<GLTFState> p_state, GLTFMeshIndex p_index, const Dictionary &p_mesh, const String &p_name, Ref<GLTFMesh> &r_mesh, LocalVector<Ref<BaseMaterial3D>> &r_vertex_color_materials);
 	Error _parse_meshes(Ref<GLTFState> p_state);
 	Error _serialize_textures(Ref<GLTFState> p_state);
 	Error _serialize_texture_samplers(Ref<GLTFState> p_state);
@@ -153,6 +168,23 @@ private:
 	Error _serialize_lights(Ref<GLTFState> p_state);
 	Ref<Image> _parse_image_bytes_into_image(Ref<GLTFState> p_state, const Vector<uint8_t> &p_bytes, const String &p_mime_type, int p_index, String &r_file_extension);
 	void _parse_image_save_image(Ref<GLTFState> p_state, const Vector<uint8_t> &p_bytes, const String &p_file_extension, int p_index, Ref<Image> p_image);
+	struct ImageParseTask {
+		int index = -1;
+		String name;
+		String mime_type;
+		Vector<uint8_t> bytes;
+		Ref<Texture2D> texture; // Loaded directly from an external file.
+		bool decode = false; // Otherwise a placeholder, unless the texture is set.
+		Ref<Image> image;
+		String file_extension;
+	};
+
+	struct ImageParseData {
+		Ref<GLTFState> state;
+		LocalVector<ImageParseTask> tasks;
+	};
+
+	void _parse_image_task(uint32_t p_index, ImageParseData *p_data);
 	Error _parse_images(Ref<GLTFState> p_state, const String &p_base_path);
 	Error _parse_textures(Ref<GLTFState> p_state);
 	Error _parse_texture_samplers(Ref<GLTFState> p_state);
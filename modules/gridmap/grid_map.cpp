@@ -33,6 +33,7 @@
 #include "core/core_string_names.h"
 #include "core/io/marshalls.h"
 #include "core/object/message_queue.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/3d/light_3d.h"
 #include "scene/resources/mesh_library.h"
 #include "scene/resources/physics_material.h"
@@ -401,6 +402,13 @@ void GridMap::set_cell_item(const Vector3i &p_position, int p_item, int p_rot) {
 	cell_map[key] = c;
 }
 
+void GridMap::set_cells(const TypedArray<Vector3i> &p_positions, int p_item, int p_rot) {
+	// Octants are only rebuilt once, on the next update.
+	for (int i = 0; i < p_positions.size(); i++) {
+		set_cell_item(p_positions[i], p_item, p_rot);
+	}
+}
+
 int GridMap::get_cell_item(const Vector3i &p_position) const {
 	ERR_FAIL_INDEX_V(ABS(p_position.x), 1 << 20, INVALID_CELL_ITEM);
 	ERR_FAIL_INDEX_V(ABS(p_position.y), 1 << 20, INVALID_CELL_ITEM);
@@ -542,9 +550,100 @@ void GridMap::_octant_transform(const OctantKey &p_key) {
 	}
 }
 
-bool GridMap::_octant_update(const OctantKey &p_key) {
-	ERR_FAIL_COND_V(!octant_map.has(p_key), false);
-	Octant &g = *octant_map[p_key];
+// Only reads the cells and the mesh library, so octants can be baked in parallel.
+void GridMap::_octant_bake(OctantUpdate &r_update) const {
+	const Octant *const *g = octant_map.getptr(r_update.key);
+	ERR_FAIL_NULL(g);
+
+	if (!mesh_library.is_valid()) {
+		return;
+	}
+
+	/*
+	 * foreach item in this octant,
+	 * set item's multimesh's instance count to number of cells which have this item
+	 * and set said multimesh bounding box to one containing all cells which have this item
+	 */
+
+	HashMap<int, uint32_t> multimesh_indices;
+	Vector3 ofs = _get_offset();
+
+	for (const IndexKey &E : (*g)->cells) {
+		const Cell *c = cell_map.getptr(E);
+		ERR_CONTINUE(!c);
+
+		if (!mesh_library->has_item(c->item)) {
+			continue;
+		}
+
+		Vector3 cellpos = Vector3(E.x, E.y, E.z);
+
+		Transform3D xform;
+
+		xform.basis = _ortho_bases[c->rot];
+		xform.set_origin(cellpos * cell_size + ofs);
+		xform.basis.scale(Vector3(cell_scale, cell_scale, cell_scale));
+		if (baked_meshes.size() == 0) {
+			Ref<Mesh> mesh = mesh_library->get_item_mesh(c->item);
+			if (mesh.is_valid()) {
+				const uint32_t *index = multimesh_indices.getptr(c->item);
+				if (!index) {
+					index = &multimesh_indices.insert(c->item, r_update.multimeshes.size())->value;
+					OctantUpdate::Multimesh mm;
+					mm.item = c->item;
+					mm.mesh = mesh;
+					r_update.multimeshes.push_back(mm);
+				}
+				OctantUpdate::Multimesh &mm = r_update.multimeshes[*index];
+
+				// Same layout as RenderingServer::multimesh_set_buffer() uses for 3D transforms.
+				Transform3D mesh_xform = xform * mesh_library->get_item_mesh_transform(c->item);
+				for (int i = 0; i < 3; i++) {
+					mm.buffer.push_back(mesh_xform.basis.rows[i][0]);
+					mm.buffer.push_back(mesh_xform.basis.rows[i][1]);
+					mm.buffer.push_back(mesh_xform.basis.rows[i][2]);
+					mm.buffer.push_back(mesh_xform.origin[i]);
+				}
+#ifdef TOOLS_ENABLED
+				Octant::MultimeshInstance::Item it;
+				it.index = mm.items.size();
+				it.transform = mesh_xform;
+				it.key = E;
+				mm.items.push_back(it);
+#endif
+			}
+		}
+
+		Vector<MeshLibrary::ShapeData> shapes = mesh_library->get_item_shapes(c->item);
+		for (int i = 0; i < shapes.size(); i++) {
+			if (!shapes[i].shape.is_valid()) {
+				continue;
+			}
+			OctantUpdate::Shape shape;
+			shape.shape = shapes[i].shape;
+			shape.xform = xform * shapes[i].local_transform;
+			r_update.shapes.push_back(shape);
+		}
+
+		Ref<NavigationMesh> navigation_mesh = mesh_library->get_item_navigation_mesh(c->item);
+		if (navigation_mesh.is_valid()) {
+			OctantUpdate::NavigationCell nav_cell;
+			nav_cell.key = E;
+			nav_cell.navigation_mesh = navigation_mesh;
+			nav_cell.cell.xform = xform * mesh_library->get_item_navigation_mesh_transform(c->item);
+			nav_cell.cell.navigation_layers = mesh_library->get_item_navigation_layers(c->item);
+			r_update.navigation_cells.push_back(nav_cell);
+		}
+	}
+}
+
+void GridMap::_octant_bake_task(uint32_t p_index, LocalVector<OctantUpdate> *p_updates) {
+	_octant_bake((*p_updates)[p_index]);
+}
+
+bool GridMap::_octant_update(OctantUpdate &p_update) {
+	ERR_FAIL_COND_V(!octant_map.has(p_update.key), false);
+	Octant &g = *octant_map[p_update.key];
 	if (!g.dirty) {
 		return false;
 	}
@@ -570,159 +669,127 @@ bool GridMap::_octant_update(const OctantKey &p_key) {
 	}
 	g.navigation_cell_ids.clear();
 
-	//erase multimeshes
-
-	for (int i = 0; i < g.multimesh_instances.size(); i++) {
-		RS::get_singleton()->free(g.multimesh_instances[i].instance);
-		RS::get_singleton()->free(g.multimesh_instances[i].multimesh);
-	}
+	// Multimeshes are kept to be reused by the items still in this octant.
+	Vector<Octant::MultimeshInstance> old_multimesh_instances = g.multimesh_instances;
 	g.multimesh_instances.clear();
 
 	if (g.cells.size() == 0) {
+		for (int i = 0; i < old_multimesh_instances.size(); i++) {
+			RS::get_singleton()->free(old_multimesh_instances[i].instance);
+			RS::get_singleton()->free(old_multimesh_instances[i].multimesh);
+		}
+
 		//octant no longer needed
-		_octant_clean_up(p_key);
+		_octant_clean_up(p_update.key);
 		return true;
 	}
 
 	Vector<Vector3> col_debug;
 
-	/*
-	 * foreach item in this octant,
-	 * set item's multimesh's instance count to number of cells which have this item
-	 * and set said multimesh bounding box to one containing all cells which have this item
-	 */
-
-	HashMap<int, List<Pair<Transform3D, IndexKey>>> multimesh_items;
-
-	for (const IndexKey &E : g.cells) {
-		ERR_CONTINUE(!cell_map.has(E));
-		const Cell &c = cell_map[E];
-
-		if (!mesh_library.is_valid() || !mesh_library->has_item(c.item)) {
-			continue;
+	// add the items' shapes to octant's static_body
+	for (OctantUpdate::Shape &shape : p_update.shapes) {
+		PhysicsServer3D::get_singleton()->body_add_shape(g.static_body, shape.shape->get_rid(), shape.xform);
+		if (g.collision_debug.is_valid()) {
+			shape.shape->add_vertices_to_array(col_debug, shape.xform);
 		}
+	}
 
-		Vector3 cellpos = Vector3(E.x, E.y, E.z);
-		Vector3 ofs = _get_offset();
-
-		Transform3D xform;
+	// add the items' navigation_mesh to GridMap's Navigation ancestor
+	for (const OctantUpdate::NavigationCell &nav_cell : p_update.navigation_cells) {
+		Octant::NavigationCell nm = nav_cell.cell;
 
-		xform.basis = _ortho_bases[c.rot];
-		xform.set_origin(cellpos * cell_size + ofs);
-		xform.basis.scale(Vector3(cell_scale, cell_scale, cell_scale));
-		if (baked_meshes.size() == 0) {
-			if (mesh_library->get_item_mesh(c.item).is_valid()) {
-				if (!multimesh_items.has(c.item)) {
-					multimesh_items[c.item] = List<Pair<Transform3D, IndexKey>>();
+		if (bake_navigation) {
+			RID region = NavigationServer3D::get_singleton()->region_create();
+			NavigationServer3D::get_singleton()->region_set_owner_id(region, get_instance_id());
+			NavigationServer3D::get_singleton()->region_set_navigation_layers(region, nm.navigation_layers);
+			NavigationServer3D::get_singleton()->region_set_navigation_mesh(region, nav_cell.navigation_mesh);
+			NavigationServer3D::get_singleton()->region_set_transform(region, get_global_transform() * nm.xform);
+			if (is_inside_tree()) {
+				if (map_override.is_valid()) {
+					NavigationServer3D::get_singleton()->region_set_map(region, map_override);
+				} else {
+					NavigationServer3D::get_singleton()->region_set_map(region, get_world_3d()->get_navigation_map());
 				}
-
-				Pair<Transform3D, IndexKey> p;
-				p.first = xform * mesh_library->get_item_mesh_transform(c.item);
-				p.second = E;
-				multimesh_items[c.item].push_back(p);
 			}
-		}
-
-		Vector<MeshLibrary::ShapeData> shapes = mesh_library->get_item_shapes(c.item);
-		// add the item's shape at given xform to octant's static_body
-		for (int i = 0; i < shapes.size(); i++) {
-			// add the item's shape
-			if (!shapes[i].shape.is_valid()) {
-				continue;
-			}
-			PhysicsServer3D::get_singleton()->body_add_shape(g.static_body, shapes[i].shape->get_rid(), xform * shapes[i].local_transform);
-			if (g.collision_debug.is_valid()) {
-				shapes.write[i].shape->add_vertices_to_array(col_debug, xform * shapes[i].local_transform);
-			}
-		}
-
-		// add the item's navigation_mesh at given xform to GridMap's Navigation ancestor
-		Ref<NavigationMesh> navigation_mesh = mesh_library->get_item_navigation_mesh(c.item);
-		if (navigation_mesh.is_valid()) {
-			Octant::NavigationCell nm;
-			nm.xform = xform * mesh_library->get_item_navigation_mesh_transform(c.item);
-			nm.navigation_layers = mesh_library->get_item_navigation_layers(c.item);
-
-			if (bake_navigation) {
-				RID region = NavigationServer3D::get_singleton()->region_create();
-				NavigationServer3D::get_singleton()->region_set_owner_id(region, get_instance_id());
-				NavigationServer3D::get_singleton()->region_set_navigation_layers(region, nm.navigation_layers);
-				NavigationServer3D::get_singleton()->region_set_navigation_mesh(region, navigation_mesh);
-				NavigationServer3D::get_singleton()->region_set_transform(region, get_global_transform() * nm.xform);
-				if (is_inside_tree()) {
-					if (map_override.is_valid()) {
-						NavigationServer3D::get_singleton()->region_set_map(region, map_override);
-					} else {
-						NavigationServer3D::get_singleton()->region_set_map(region, get_world_3d()->get_navigation_map());
-					}
-				}
-				nm.region = region;
+			nm.region = region;
 
 #ifdef DEBUG_ENABLED
-				// add navigation debugmesh visual instances if debug is enabled
-				SceneTree *st = SceneTree::get_singleton();
-				if (st && st->is_debugging_navigation_hint()) {
-					if (!nm.navigation_mesh_debug_instance.is_valid()) {
-						RID navigation_mesh_debug_rid = navigation_mesh->get_debug_mesh()->get_rid();
-						nm.navigation_mesh_debug_instance = RS::get_singleton()->instance_create();
-						RS::get_singleton()->instance_set_base(nm.navigation_mesh_debug_instance, navigation_mesh_debug_rid);
-					}
-					if (is_inside_tree()) {
-						RS::get_singleton()->instance_set_scenario(nm.navigation_mesh_debug_instance, get_world_3d()->get_scenario());
-						RS::get_singleton()->instance_set_transform(nm.navigation_mesh_debug_instance, get_global_transform() * nm.xform);
-					}
+			// add navigation debugmesh visual instances if debug is enabled
+			SceneTree *st = SceneTree::get_singleton();
+			if (st && st->is_debugging_navigation_hint()) {
+				if (!nm.navigation_mesh_debug_instance.is_valid()) {
+					RID navigation_mesh_debug_rid = nav_cell.navigation_mesh->get_debug_mesh()->get_rid();
+					nm.navigation_mesh_debug_instance = RS::get_singleton()->instance_create();
+					RS::get_singleton()->instance_set_base(nm.navigation_mesh_debug_instance, navigation_mesh_debug_rid);
+				}
+				if (is_inside_tree()) {
+					RS::get_singleton()->instance_set_scenario(nm.navigation_mesh_debug_instance, get_world_3d()->get_scenario());
+					RS::get_singleton()->instance_set_transform(nm.navigation_mesh_debug_instance, get_global_transform() * nm.xform);
 				}
-#endif // DEBUG_ENABLED
 			}
-			g.navigation_cell_ids[E] = nm;
+#endif // DEBUG_ENABLED
 		}
+		g.navigation_cell_ids[nav_cell.key] = nm;
 	}
 
 #ifdef DEBUG_ENABLED
 	if (bake_navigation) {
-		_update_octant_navigation_debug_edge_connections_mesh(p_key);
+		_update_octant_navigation_debug_edge_connections_mesh(p_update.key);
 	}
 #endif // DEBUG_ENABLED
 
 	//update multimeshes, only if not baked
 	if (baked_meshes.size() == 0) {
-		for (const KeyValue<int, List<Pair<Transform3D, IndexKey>>> &E : multimesh_items) {
+		for (const OctantUpdate::Multimesh &E : p_update.multimeshes) {
 			Octant::MultimeshInstance mmi;
+			int instance_count = E.buffer.size() / 12;
+
+			bool reused = false;
+			for (int i = 0; i < old_multimesh_instances.size(); i++) {
+				if (old_multimesh_instances[i].item == E.item) {
+					mmi = old_multimesh_instances[i];
+					old_multimesh_instances.remove_at(i);
+					reused = true;
+					break;
+				}
+			}
 
-			RID mm = RS::get_singleton()->multimesh_create();
-			RS::get_singleton()->multimesh_allocate_data(mm, E.value.size(), RS::MULTIMESH_TRANSFORM_3D);
-			RS::get_singleton()->multimesh_set_mesh(mm, mesh_library->get_item_mesh(E.key)->get_rid());
-
-			int idx = 0;
-			for (const Pair<Transform3D, IndexKey> &F : E.value) {
-				RS::get_singleton()->multimesh_instance_set_transform(mm, idx, F.first);
-#ifdef TOOLS_ENABLED
+			if (!reused) {
+				mmi.item = E.item;
+				mmi.multimesh = RS::get_singleton()->multimesh_create();
+				mmi.instance = RS::get_singleton()->instance_create();
+				RS::get_singleton()->instance_set_base(mmi.instance, mmi.multimesh);
 
-				Octant::MultimeshInstance::Item it;
-				it.index = idx;
-				it.transform = F.first;
-				it.key = F.second;
-				mmi.items.push_back(it);
-#endif
-
-				idx++;
+				if (is_inside_tree()) {
+					RS::get_singleton()->instance_set_scenario(mmi.instance, get_world_3d()->get_scenario());
+					RS::get_singleton()->instance_set_transform(mmi.instance, get_global_transform());
+				}
 			}
 
-			RID instance = RS::get_singleton()->instance_create();
-			RS::get_singleton()->instance_set_base(instance, mm);
-
-			if (is_inside_tree()) {
-				RS::get_singleton()->instance_set_scenario(instance, get_world_3d()->get_scenario());
-				RS::get_singleton()->instance_set_transform(instance, get_global_transform());
+			if (!reused || mmi.instance_count != instance_count) {
+				RS::get_singleton()->multimesh_allocate_data(mmi.multimesh, instance_count, RS::MULTIMESH_TRANSFORM_3D);
+				mmi.instance_count = instance_count;
 			}
+			RS::get_singleton()->multimesh_set_mesh(mmi.multimesh, E.mesh->get_rid());
+
+			Vector<float> buffer;
+			buffer.resize(E.buffer.size());
+			memcpy(buffer.ptrw(), E.buffer.ptr(), E.buffer.size() * sizeof(float));
+			RS::get_singleton()->multimesh_set_buffer(mmi.multimesh, buffer);
 
-			mmi.multimesh = mm;
-			mmi.instance = instance;
+#ifdef TOOLS_ENABLED
+			mmi.items = E.items;
+#endif
 
 			g.multimesh_instances.push_back(mmi);
 		}
 	}
 
+	for (int i = 0; i < old_multimesh_instances.size(); i++) {
+		RS::get_singleton()->free(old_multimesh_instances[i].instance);
+		RS::get_singleton()->free(old_multimesh_instances[i].multimesh);
+	}
+
 	if (col_debug.size()) {
 		Array arr;
 		arr.resize(RS::ARRAY_MAX);
@@ -1017,10 +1084,25 @@ void GridMap::_update_octants_callback() {
 		return;
 	}
 
-	List<OctantKey> to_delete;
+	LocalVector<OctantUpdate> updates;
 	for (const KeyValue<OctantKey, Octant *> &E : octant_map) {
-		if (_octant_update(E.key)) {
-			to_delete.push_back(E.key);
+		if (E.value->dirty) {
+			updates.push_back(OctantUpdate());
+			updates[updates.size() - 1].key = E.key;
+		}
+	}
+
+	if (updates.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GridMap::_octant_bake_task, &updates, updates.size(), -1, true, SNAME("GridMapOctantBake"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (updates.size() == 1) {
+		_octant_bake(updates[0]);
+	}
+
+	List<OctantKey> to_delete;
+	for (OctantUpdate &update : updates) {
+		if (_octant_update(update)) {
+			to_delete.push_back(update.key);
 		}
 	}
 
@@ -1072,6 +1154,7 @@ void GridMap::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_octant_size"), &GridMap::get_octant_size);
 
 	ClassDB::bind_method(D_METHOD("set_cell_item", "position", "item", "orientation"), &GridMap::set_cell_item, DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("set_cells", "positions", "item", "orientation"), &GridMap::set_cells, DEFVAL(0));
 	ClassDB::bind_method(D_METHOD("get_cell_item", "position"), &GridMap::get_cell_item);
 	ClassDB::bind_method(D_METHOD("get_cell_item_orientation", "position"), &GridMap::get_cell_item_orientation);
 	ClassDB::bind_method(D_METHOD("get_cell_item_basis", "position"), &GridMap::get_cell_item_basis);
@@ -105,6 +105,8 @@ class GridMap : public Node3D {
 		struct MultimeshInstance {
 			RID instance;
 			RID multimesh;
+			int item = -1;
+			int instance_count = 0;
 			struct Item {
 				int index = 0;
 				Transform3D transform;
@@ -149,6 +151,34 @@ class GridMap : public Node3D {
 		OctantKey() {}
 	};
 
+	// Everything an octant update needs from the cells, computed off the main thread and applied by _octant_update().
+	struct OctantUpdate {
+		struct Multimesh {
+			int item = -1;
+			Ref<Mesh> mesh;
+			LocalVector<float> buffer;
+#ifdef TOOLS_ENABLED
+			Vector<Octant::MultimeshInstance::Item> items;
+#endif
+		};
+
+		struct Shape {
+			Ref<Shape3D> shape;
+			Transform3D xform;
+		};
+
+		struct NavigationCell {
+			IndexKey key;
+			Ref<NavigationMesh> navigation_mesh;
+			Octant::NavigationCell cell;
+		};
+
+		OctantKey key;
+		LocalVector<Multimesh> multimeshes;
+		LocalVector<Shape> shapes;
+		LocalVector<NavigationCell> navigation_cells;
+	};
+
 	uint32_t collision_layer = 1;
 	uint32_t collision_mask = 1;
 	real_t collision_priority = 1.0;
@@ -190,7 +220,9 @@ class GridMap : public Node3D {
 	void _update_physics_bodies_collision_properties();
 	void _octant_enter_world(const OctantKey &p_key);
 	void _octant_exit_world(const OctantKey &p_key);
-	bool _octant_update(const OctantKey &p_key);
+	void _octant_bake(OctantUpdate &r_update) const;
+	void _octant_bake_task(uint32_t p_index, LocalVector<OctantUpdate> *p_updates);
+	bool _octant_update(OctantUpdate &p_update);
 	void _octant_clean_up(const OctantKey &p_key);
 	void _octant_transform(const OctantKey &p_key);
 #ifdef DEBUG_ENABLED
@@ -275,6 +307,7 @@ public:
 	bool get_center_z() const;
 
 	void set_cell_item(const Vector3i &p_position, int p_item, int p_rot = 0);
+	void set_cells(const TypedArray<Vector3i> &p_positions, int p_item, int p_rot = 0);
 	int get_cell_item(const Vector3i &p_position) const;
 	int get_cell_item_orientation(const Vector3i &p_position) const;
 	Basis get_cell_item_basis(const Vector3i &p_position) const;
@@ -36,6 +36,8 @@
 
 #include "core/config/project_settings.h"
 #include "core/math/geometry_2d.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
 #include "servers/rendering/rendering_device_binds.h"
 
 //uncomment this if you want to see textures from all the process saved
@@ -610,6 +612,34 @@ void LightmapperRD::_raster_geometry(RenderingDevice *rd, Size2i atlas_size, int
 	}
 }
 
+void LightmapperRD::_denoise_slice(void *p_userdata, uint32_t p_index) {
+	DenoiseData *data = (DenoiseData *)p_userdata;
+	Vector<uint8_t> &s = data->slices[p_index];
+	if (data->cancelled.is_set()) {
+		return;
+	}
+
+	Ref<Image> img = Image::create_from_data(data->atlas_size.width, data->atlas_size.height, false, Image::FORMAT_RGBAH, s);
+	Ref<Image> denoised = data->denoiser->denoise_image(img);
+	if (denoised == img) {
+		s.clear();
+		return;
+	}
+
+	denoised->convert(Image::FORMAT_RGBAH);
+	Vector<uint8_t> ds = denoised->get_data();
+	denoised.unref(); //avoid copy on write
+	{ //restore alpha
+		uint32_t count = s.size() / 2; //uint16s
+		const uint16_t *src = (const uint16_t *)s.ptr();
+		uint16_t *dst = (uint16_t *)ds.ptrw();
+		for (uint32_t j = 0; j < count; j += 4) {
+			dst[j + 3] = src[j + 3];
+		}
+	}
+	s = ds;
+}
+
 LightmapperRD::BakeError LightmapperRD::_dilate(RenderingDevice *rd, Ref<RDShaderFile> &compute_shader, RID &compute_base_uniform_set, PushConstant &push_constant, RID &source_light_tex, RID &dest_light_tex, const Size2i &atlas_size, int atlas_slices) {
 	Vector<RD::Uniform> uniforms;
 	{
@@ -1295,7 +1325,14 @@ LightmapperRD::BakeError LightmapperRD::bake(BakeQuality p_quality, bool p_use_d
 								int total = (atlas_slices * x_regions * y_regions * ray_iterations);
 								int percent = count * 100 / total;
 								float p = float(count) / total * 0.1;
-								p_step_function(0.6 + p, vformat(RTR("Bounce %d/%d: Integrate indirect lighting %d%%"), b + 1, p_bounces, percent), p_bake_userdata, false);
+								if (p_step_function(0.6 + p, vformat(RTR("Bounce %d/%d: Integrate indirect lighting %d%%"), b + 1, p_bounces, percent), p_bake_userdata, false)) {
+									FREE_TEXTURES
+									FREE_BUFFERS
+									FREE_RASTER_RESOURCES
+									FREE_COMPUTE_RESOURCES
+									memdelete(rd);
+									return BAKE_ERROR_USER_ABORTED;
+								}
 							}
 						}
 					}
@@ -1395,7 +1432,15 @@ LightmapperRD::BakeError LightmapperRD::bake(BakeQuality p_quality, bool p_use_d
 			if (p_step_function) {
 				int percent = i * 100 / ray_iterations;
 				float p = float(i) / ray_iterations * 0.1;
-				p_step_function(0.7 + p, vformat(RTR("Integrating light probes %d%%"), percent), p_bake_userdata, false);
+				if (p_step_function(0.7 + p, vformat(RTR("Integrating light probes %d%%"), percent), p_bake_userdata, false)) {
+					rd->free(light_probe_buffer);
+					FREE_TEXTURES
+					FREE_BUFFERS
+					FREE_RASTER_RESOURCES
+					FREE_COMPUTE_RESOURCES
+					memdelete(rd);
+					return BAKE_ERROR_USER_ABORTED;
+				}
 			}
 		}
 
@@ -1432,24 +1477,50 @@ LightmapperRD::BakeError LightmapperRD::bake(BakeQuality p_quality, bool p_use_d
 
 		Ref<LightmapDenoiser> denoiser = LightmapDenoiser::create();
 		if (denoiser.is_valid()) {
-			for (int i = 0; i < atlas_slices * (p_bake_sh ? 4 : 1); i++) {
-				Vector<uint8_t> s = rd->texture_get_data(light_accum_tex, i);
-				Ref<Image> img = Image::create_from_data(atlas_size.width, atlas_size.height, false, Image::FORMAT_RGBAH, s);
-
-				Ref<Image> denoised = denoiser->denoise_image(img);
-				if (denoised != img) {
-					denoised->convert(Image::FORMAT_RGBAH);
-					Vector<uint8_t> ds = denoised->get_data();
-					denoised.unref(); //avoid copy on write
-					{ //restore alpha
-						uint32_t count = s.size() / 2; //uint16s
-						const uint16_t *src = (const uint16_t *)s.ptr();
-						uint16_t *dst = (uint16_t *)ds.ptrw();
-						for (uint32_t j = 0; j < count; j += 4) {
-							dst[j + 3] = src[j + 3];
+			// Slices are denoised in batches of one per thread, to keep the amount of read back data bounded.
+			DenoiseData denoise_data;
+			denoise_data.denoiser = denoiser;
+			denoise_data.atlas_size = atlas_size;
+
+			int slice_count = atlas_slices * (p_bake_sh ? 4 : 1);
+			int batch_size = MAX(1, WorkerThreadPool::get_singleton()->get_thread_count());
+
+			for (int from = 0; from < slice_count; from += batch_size) {
+				int to = MIN(from + batch_size, slice_count);
+				denoise_data.slices.resize(to - from);
+				for (int i = from; i < to; i++) {
+					denoise_data.slices[i - from] = rd->texture_get_data(light_accum_tex, i);
+				}
+
+				WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&LightmapperRD::_denoise_slice, &denoise_data, to - from, -1, true, SNAME("LightmapperDenoise"));
+				while (!WorkerThreadPool::get_singleton()->is_group_task_completed(group_task)) {
+					if (p_step_function) {
+						int done = from + WorkerThreadPool::get_singleton()->get_group_processed_element_count(group_task);
+						if (p_step_function(0.8 + float(done) / slice_count * 0.1, vformat(RTR("Denoising %d%%"), done * 100 / slice_count), p_bake_userdata, false)) {
+							denoise_data.cancelled.set();
 						}
 					}
-					rd->texture_update(light_accum_tex, i, ds);
+					OS::get_singleton()->delay_usec(10000);
+				}
+				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+				if (denoise_data.cancelled.is_set()) {
+					FREE_TEXTURES
+					FREE_BUFFERS
+					FREE_RASTER_RESOURCES
+					FREE_COMPUTE_RESOURCES
+					if (light_probe_buffer.is_valid()) {
+						rd->free(light_probe_buffer);
+					}
+					memdelete(rd);
+					return BAKE_ERROR_USER_ABORTED;
+				}
+
+				for (int i = from; i < to; i++) {
+					// Slices the denoiser failed on are left empty.
+					if (!denoise_data.slices[i - from].is_empty()) {
+						rd->texture_update(light_accum_tex, i, denoise_data.slices[i - from]);
+					}
 				}
 			}
 		}
@@ -32,6 +32,7 @@
 #define LIGHTMAPPER_RD_H
 
 #include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 #include "scene/3d/lightmapper.h"
 #include "scene/resources/mesh.h"
 #include "servers/rendering/rendering_device.h"
@@ -233,6 +234,15 @@ class LightmapperRD : public Lightmapper {
 	void _create_acceleration_structures(RenderingDevice *rd, Size2i atlas_size, int atlas_slices, AABB &bounds, int grid_size, Vector<Probe> &probe_positions, GenerateProbes p_generate_probes, Vector<int> &slice_triangle_count, Vector<int> &slice_seam_count, RID &vertex_buffer, RID &triangle_buffer, RID &lights_buffer, RID &triangle_cell_indices_buffer, RID &probe_positions_buffer, RID &grid_texture, RID &seams_buffer, BakeStepFunc p_step_function, void *p_bake_userdata);
 	void _raster_geometry(RenderingDevice *rd, Size2i atlas_size, int atlas_slices, int grid_size, AABB bounds, float p_bias, Vector<int> slice_triangle_count, RID position_tex, RID unocclude_tex, RID normal_tex, RID raster_depth_buffer, RID rasterize_shader, RID raster_base_uniform);
 
+	struct DenoiseData {
+		Ref<LightmapDenoiser> denoiser;
+		Size2i atlas_size;
+		LocalVector<Vector<uint8_t>> slices;
+		SafeFlag cancelled;
+	};
+
+	static void _denoise_slice(void *p_userdata, uint32_t p_index);
+
 	BakeError _dilate(RenderingDevice *rd, Ref<RDShaderFile> &compute_shader, RID &compute_base_uniform_set, PushConstant &push_constant, RID &source_light_tex, RID &dest_light_tex, const Size2i &atlas_size, int atlas_slices);
 
 public:
@@ -105,6 +105,7 @@ float AudioStreamPlaybackMP3::get_stream_sampling_rate() {
 }
 
 void AudioStreamPlaybackMP3::start(double p_from_pos) {
+	stop_decode_ahead();
 	active = true;
 	seek(p_from_pos);
 	loops = 0;
@@ -112,6 +113,7 @@ void AudioStreamPlaybackMP3::start(double p_from_pos) {
 }
 
 void AudioStreamPlaybackMP3::stop() {
+	stop_decode_ahead();
 	active = false;
 }
 
@@ -124,7 +126,7 @@ int AudioStreamPlaybackMP3::get_loop_count() const {
 }
 
 double AudioStreamPlaybackMP3::get_playback_position() const {
-	return double(frames_mixed) / mp3_stream->sample_rate;
+	return double(MAX(int64_t(frames_mixed) - get_decode_ahead_frames(), 0)) / mp3_stream->sample_rate;
 }
 
 void AudioStreamPlaybackMP3::seek(double p_time) {
@@ -145,6 +147,7 @@ void AudioStreamPlaybackMP3::tag_used_streams() {
 }
 
 AudioStreamPlaybackMP3::~AudioStreamPlaybackMP3() {
+	stop_decode_ahead();
 	if (mp3d) {
 		mp3dec_ex_close(mp3d);
 		memfree(mp3d);
@@ -56,9 +56,11 @@ private:
 	NodePath root_path = NodePath(".."); // Start with parent, like with AnimationPlayer.
 	uint64_t sync_interval_usec = 0;
 	uint64_t delta_interval_usec = 0;
+	real_t sync_priority = 1;
 	VisibilityUpdateMode visibility_update_mode = VISIBILITY_PROCESS_IDLE;
 	HashSet<Callable> visibility_filters;
 	HashSet<int> peer_visibility;
+	bool interest_management = false;
 	Vector<Watcher> watchers;
 	uint64_t last_watch_usec = 0;
 
@@ -98,6 +100,9 @@ public:
 	void set_delta_interval(double p_interval);
 	double get_delta_interval() const;
 
+	void set_sync_priority(real_t p_priority);
+	real_t get_sync_priority() const;
+
 	void set_replication_config(Ref<SceneReplicationConfig> p_config);
 	Ref<SceneReplicationConfig> get_replication_config();
 
@@ -116,6 +121,9 @@ public:
 	void remove_visibility_filter(Callable p_callback);
 	VisibilityUpdateMode get_visibility_update_mode() const;
 
+	void set_interest_management_enabled(bool p_enabled);
+	bool is_interest_management_enabled() const;
+
 	List<Variant> get_delta_state(uint64_t p_cur_usec, uint64_t p_last_usec, uint64_t &r_indexes);
 	List<NodePath> get_delta_properties(uint64_t p_indexes);
 
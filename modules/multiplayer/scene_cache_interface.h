@@ -31,6 +31,7 @@
 #ifndef SCENE_CACHE_INTERFACE_H
 #define SCENE_CACHE_INTERFACE_H
 
+#include "core/templates/flat_hash_map.h"
 #include "scene/main/multiplayer_api.h"
 
 class Node;
@@ -58,8 +59,8 @@ private:
 		HashMap<int, NodeInfo> nodes;
 	};
 
-	HashMap<NodePath, PathSentCache> path_send_cache;
-	HashMap<int, PathGetCache> path_get_cache;
+	FlatHashMap<NodePath, PathSentCache> path_send_cache;
+	FlatHashMap<int, PathGetCache> path_get_cache;
 	int last_send_cache_id = 1;
 
 protected:
@@ -633,6 +633,30 @@ int SceneMultiplayer::get_max_delta_packet_size() const {
 	return replicator->get_max_delta_packet_size();
 }
 
+void SceneMultiplayer::set_max_sync_bandwidth(int p_bytes_per_second) {
+	replicator->set_max_sync_bandwidth(p_bytes_per_second);
+}
+
+int SceneMultiplayer::get_max_sync_bandwidth() const {
+	return replicator->get_max_sync_bandwidth();
+}
+
+void SceneMultiplayer::set_peer_interest_area(int p_peer, const Vector3 &p_position, real_t p_radius) {
+	replicator->set_peer_interest_area(p_peer, p_position, p_radius);
+}
+
+void SceneMultiplayer::clear_peer_interest_area(int p_peer) {
+	replicator->clear_peer_interest_area(p_peer);
+}
+
+void SceneMultiplayer::set_interest_cell_size(real_t p_size) {
+	replicator->set_interest_cell_size(p_size);
+}
+
+real_t SceneMultiplayer::get_interest_cell_size() const {
+	return replicator->get_interest_cell_size();
+}
+
 void SceneMultiplayer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_root_path", "path"), &SceneMultiplayer::set_root_path);
 	ClassDB::bind_method(D_METHOD("get_root_path"), &SceneMultiplayer::get_root_path);
@@ -661,6 +685,12 @@ void SceneMultiplayer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_max_sync_packet_size", "size"), &SceneMultiplayer::set_max_sync_packet_size);
 	ClassDB::bind_method(D_METHOD("get_max_delta_packet_size"), &SceneMultiplayer::get_max_delta_packet_size);
 	ClassDB::bind_method(D_METHOD("set_max_delta_packet_size", "size"), &SceneMultiplayer::set_max_delta_packet_size);
+	ClassDB::bind_method(D_METHOD("get_max_sync_bandwidth"), &SceneMultiplayer::get_max_sync_bandwidth);
+	ClassDB::bind_method(D_METHOD("set_max_sync_bandwidth", "bytes_per_second"), &SceneMultiplayer::set_max_sync_bandwidth);
+	ClassDB::bind_method(D_METHOD("set_peer_interest_area", "peer", "position", "radius"), &SceneMultiplayer::set_peer_interest_area);
+	ClassDB::bind_method(D_METHOD("clear_peer_interest_area", "peer"), &SceneMultiplayer::clear_peer_interest_area);
+	ClassDB::bind_method(D_METHOD("get_interest_cell_size"), &SceneMultiplayer::get_interest_cell_size);
+	ClassDB::bind_method(D_METHOD("set_interest_cell_size", "size"), &SceneMultiplayer::set_interest_cell_size);
 
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_path"), "set_root_path", "get_root_path");
 	ADD_PROPERTY(PropertyInfo(Variant::CALLABLE, "auth_callback"), "set_auth_callback", "get_auth_callback");
@@ -670,6 +700,8 @@ void SceneMultiplayer::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "server_relay"), "set_server_relay_enabled", "is_server_relay_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_sync_packet_size"), "set_max_sync_packet_size", "get_max_sync_packet_size");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_delta_packet_size"), "set_max_delta_packet_size", "get_max_delta_packet_size");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_sync_bandwidth", PROPERTY_HINT_RANGE, "0,1000000,1,or_greater,suffix:B/s"), "set_max_sync_bandwidth", "get_max_sync_bandwidth");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "interest_cell_size", PROPERTY_HINT_RANGE, "0.01,1024,0.01,or_greater"), "set_interest_cell_size", "get_interest_cell_size");
 
 	ADD_PROPERTY_DEFAULT("refuse_new_connections", false);
 
@@ -46,11 +46,20 @@ public:
 		REPLICATION_MODE_ON_CHANGE,
 	};
 
+	enum QuantizationMode {
+		QUANTIZATION_NONE,
+		QUANTIZATION_FIXED_POINT,
+		QUANTIZATION_QUATERNION,
+	};
+
 private:
 	struct ReplicationProperty {
 		NodePath name;
 		bool spawn = true;
 		ReplicationMode mode = REPLICATION_MODE_ALWAYS;
+		QuantizationMode quantization = QUANTIZATION_NONE;
+		int quantization_bits = 16;
+		float quantization_range = 1024;
 
 		bool operator==(const ReplicationProperty &p_to) {
 			return name == p_to.name;
@@ -98,6 +107,15 @@ public:
 	ReplicationMode property_get_replication_mode(const NodePath &p_path);
 	void property_set_replication_mode(const NodePath &p_path, ReplicationMode p_mode);
 
+	QuantizationMode property_get_quantization(const NodePath &p_path);
+	void property_set_quantization(const NodePath &p_path, QuantizationMode p_mode);
+
+	int property_get_quantization_bits(const NodePath &p_path);
+	void property_set_quantization_bits(const NodePath &p_path, int p_bits);
+
+	float property_get_quantization_range(const NodePath &p_path);
+	void property_set_quantization_range(const NodePath &p_path, float p_range);
+
 	const List<NodePath> &get_spawn_properties();
 	const List<NodePath> &get_sync_properties();
 	const List<NodePath> &get_watch_properties();
@@ -106,5 +124,6 @@ public:
 };
 
 VARIANT_ENUM_CAST(SceneReplicationConfig::ReplicationMode);
+VARIANT_ENUM_CAST(SceneReplicationConfig::QuantizationMode);
 
 #endif // SCENE_REPLICATION_CONFIG_H
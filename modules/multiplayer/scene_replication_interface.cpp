@@ -34,6 +34,8 @@
 
 #include "core/debugger/engine_debugger.h"
 #include "core/io/marshalls.h"
+#include "scene/2d/node_2d.h"
+#include "scene/3d/node_3d.h"
 #include "scene/main/node.h"
 #include "scene/scene_string_names.h"
 
@@ -53,6 +55,224 @@ _FORCE_INLINE_ void SceneReplicationInterface::_profile_node_data(const String &
 }
 #endif
 
+// Quantized properties are bit packed after the regularly encoded ones, lowest bits first.
+struct StateBitWriter {
+	uint8_t *buffer = nullptr; // Only counts the bits when null.
+	uint64_t bits = 0;
+
+	void write(uint32_t p_value, int p_bits) {
+		for (int i = 0; i < p_bits; i++) {
+			if (buffer) {
+				uint8_t &byte = buffer[bits >> 3];
+				if ((bits & 7) == 0) {
+					byte = 0;
+				}
+				byte |= ((p_value >> i) & 1) << (bits & 7);
+			}
+			bits++;
+		}
+	}
+
+	int get_byte_count() const { return (bits + 7) >> 3; }
+};
+
+struct StateBitReader {
+	const uint8_t *buffer = nullptr;
+	uint64_t bits = 0;
+	uint64_t max_bits = 0;
+
+	bool read(int p_bits, uint32_t &r_value) {
+		if (bits + p_bits > max_bits) {
+			return false;
+		}
+		r_value = 0;
+		for (int i = 0; i < p_bits; i++) {
+			r_value |= uint32_t((buffer[bits >> 3] >> (bits & 7)) & 1) << i;
+			bits++;
+		}
+		return true;
+	}
+
+	int get_byte_count() const { return (bits + 7) >> 3; }
+};
+
+static uint32_t _quantize(double p_value, double p_range, int p_bits) {
+	const double steps = double((1ULL << p_bits) - 1);
+	const double t = CLAMP((p_value + p_range) / (2.0 * p_range), 0.0, 1.0);
+	return uint32_t(Math::round(t * steps));
+}
+
+static double _dequantize(uint32_t p_value, double p_range, int p_bits) {
+	const double steps = double((1ULL << p_bits) - 1);
+	return (double(p_value) / steps) * 2.0 * p_range - p_range;
+}
+
+Error SceneReplicationInterface::_encode_state(const Ref<SceneReplicationConfig> &p_config, const List<NodePath> &p_properties, const Variant **p_variants, uint8_t *p_buffer, int &r_len) {
+	LocalVector<const Variant *> regular;
+	regular.reserve(p_properties.size());
+	int i = 0;
+	for (const NodePath &prop : p_properties) {
+		if (p_config->property_get_quantization(prop) == SceneReplicationConfig::QUANTIZATION_NONE) {
+			regular.push_back(p_variants[i]);
+		}
+		i++;
+	}
+
+	Error err = MultiplayerAPI::encode_and_compress_variants(regular.ptr(), regular.size(), p_buffer, r_len);
+	ERR_FAIL_COND_V(err != OK, err);
+	if (int(regular.size()) == p_properties.size()) {
+		return OK;
+	}
+
+	StateBitWriter writer;
+	writer.buffer = p_buffer ? p_buffer + r_len : nullptr;
+	i = 0;
+	for (const NodePath &prop : p_properties) {
+		const Variant &value = *p_variants[i++];
+		const SceneReplicationConfig::QuantizationMode mode = p_config->property_get_quantization(prop);
+		const int bits = p_config->property_get_quantization_bits(prop);
+
+		if (mode == SceneReplicationConfig::QUANTIZATION_FIXED_POINT) {
+			const double range = p_config->property_get_quantization_range(prop);
+			double components[4];
+			int count = 0;
+			switch (value.get_type()) {
+				case Variant::FLOAT: {
+					components[0] = value;
+					count = 1;
+				} break;
+				case Variant::VECTOR2: {
+					const Vector2 v = value;
+					components[0] = v.x;
+					components[1] = v.y;
+					count = 2;
+				} break;
+				case Variant::VECTOR3: {
+					const Vector3 v = value;
+					components[0] = v.x;
+					components[1] = v.y;
+					components[2] = v.z;
+					count = 3;
+				} break;
+				case Variant::VECTOR4: {
+					const Vector4 v = value;
+					components[0] = v.x;
+					components[1] = v.y;
+					components[2] = v.z;
+					components[3] = v.w;
+					count = 4;
+				} break;
+				default: {
+					ERR_FAIL_V_MSG(ERR_INVALID_DATA, vformat("Property '%s' of type %s can't be quantized as fixed point.", prop, Variant::get_type_name(value.get_type())));
+				}
+			}
+			writer.write(count - 1, 2);
+			for (int j = 0; j < count; j++) {
+				writer.write(_quantize(components[j], range, bits), bits);
+			}
+		} else if (mode == SceneReplicationConfig::QUANTIZATION_QUATERNION) {
+			ERR_FAIL_COND_V_MSG(value.get_type() != Variant::QUATERNION, ERR_INVALID_DATA, vformat("Property '%s' of type %s can't be quantized as a quaternion.", prop, Variant::get_type_name(value.get_type())));
+			// Smallest three: the largest component is dropped and rebuilt from the others.
+			Quaternion q = Quaternion(value).normalized();
+			int largest = 0;
+			for (int j = 1; j < 4; j++) {
+				if (Math::abs(q.components[j]) > Math::abs(q.components[largest])) {
+					largest = j;
+				}
+			}
+			if (q.components[largest] < 0) {
+				q = -q;
+			}
+			writer.write(largest, 2);
+			for (int j = 0; j < 4; j++) {
+				if (j != largest) {
+					writer.write(_quantize(q.components[j], Math_SQRT12, bits), bits);
+				}
+			}
+		}
+	}
+	r_len += writer.get_byte_count();
+	return OK;
+}
+
+Error SceneReplicationInterface::_decode_state(const Ref<SceneReplicationConfig> &p_config, const List<NodePath> &p_properties, const uint8_t *p_buffer, int p_len, Vector<Variant> &r_variants, int &r_len) {
+	int regular_count = 0;
+	for (const NodePath &prop : p_properties) {
+		if (p_config->property_get_quantization(prop) == SceneReplicationConfig::QUANTIZATION_NONE) {
+			regular_count++;
+		}
+	}
+
+	Vector<Variant> regular;
+	regular.resize(regular_count);
+	Error err = MultiplayerAPI::decode_and_decompress_variants(regular, p_buffer, p_len, r_len);
+	ERR_FAIL_COND_V(err != OK, err);
+
+	r_variants.resize(p_properties.size());
+	if (regular_count == p_properties.size()) {
+		r_variants = regular;
+		return OK;
+	}
+
+	StateBitReader reader;
+	reader.buffer = p_buffer + r_len;
+	reader.max_bits = uint64_t(p_len - r_len) * 8;
+	int i = 0;
+	int regular_index = 0;
+	for (const NodePath &prop : p_properties) {
+		const SceneReplicationConfig::QuantizationMode mode = p_config->property_get_quantization(prop);
+		const int bits = p_config->property_get_quantization_bits(prop);
+		Variant &value = r_variants.write[i++];
+
+		if (mode == SceneReplicationConfig::QUANTIZATION_NONE) {
+			value = regular[regular_index++];
+		} else if (mode == SceneReplicationConfig::QUANTIZATION_FIXED_POINT) {
+			const double range = p_config->property_get_quantization_range(prop);
+			uint32_t count = 0;
+			ERR_FAIL_COND_V(!reader.read(2, count), ERR_INVALID_DATA);
+			count++;
+			double components[4];
+			for (uint32_t j = 0; j < count; j++) {
+				uint32_t q = 0;
+				ERR_FAIL_COND_V(!reader.read(bits, q), ERR_INVALID_DATA);
+				components[j] = _dequantize(q, range, bits);
+			}
+			switch (count) {
+				case 1:
+					value = components[0];
+					break;
+				case 2:
+					value = Vector2(components[0], components[1]);
+					break;
+				case 3:
+					value = Vector3(components[0], components[1], components[2]);
+					break;
+				default:
+					value = Vector4(components[0], components[1], components[2], components[3]);
+					break;
+			}
+		} else {
+			uint32_t largest = 0;
+			ERR_FAIL_COND_V(!reader.read(2, largest), ERR_INVALID_DATA);
+			Quaternion q;
+			real_t sum = 0;
+			for (uint32_t j = 0; j < 4; j++) {
+				if (j == largest) {
+					continue;
+				}
+				uint32_t c = 0;
+				ERR_FAIL_COND_V(!reader.read(bits, c), ERR_INVALID_DATA);
+				q.components[j] = _dequantize(c, Math_SQRT12, bits);
+				sum += q.components[j] * q.components[j];
+			}
+			q.components[largest] = Math::sqrt(MAX(0, 1 - sum));
+			value = q.normalized();
+		}
+	}
+	r_len += reader.get_byte_count();
+	return OK;
+}
+
 SceneReplicationInterface::TrackedNode &SceneReplicationInterface::_track(const ObjectID &p_id) {
 	if (!tracked_nodes.has(p_id)) {
 		tracked_nodes[p_id] = TrackedNode(p_id);
@@ -81,6 +301,207 @@ void SceneReplicationInterface::_untrack(const ObjectID &p_id) {
 	}
 }
 
+bool SceneReplicationInterface::_get_interest_position(MultiplayerSynchronizer *p_sync, Vector3 &r_position) {
+	Node *root = p_sync->get_root_node();
+	if (Node3D *node_3d = Object::cast_to<Node3D>(root)) {
+		r_position = node_3d->get_global_position();
+		return true;
+	}
+	if (Node2D *node_2d = Object::cast_to<Node2D>(root)) {
+		const Vector2 position = node_2d->get_global_position();
+		r_position = Vector3(position.x, position.y, 0);
+		return true;
+	}
+	return false;
+}
+
+bool SceneReplicationInterface::_is_in_interest(int p_peer, const ObjectID &p_sid) const {
+	if (p_peer == 0 || !interest_entries.has(p_sid)) {
+		return true;
+	}
+	const PeerInfo *info = peers_info.getptr(p_peer);
+	if (!info || !info->has_interest_area) {
+		return true;
+	}
+	return info->interest_syncs.has(p_sid);
+}
+
+void SceneReplicationInterface::_remove_interest_entry(const ObjectID &p_sid) {
+	const InterestEntry *entry = interest_entries.getptr(p_sid);
+	if (!entry) {
+		return;
+	}
+	HashSet<ObjectID> *cell = interest_grid.getptr(entry->cell);
+	if (cell) {
+		cell->erase(p_sid);
+		if (cell->is_empty()) {
+			interest_grid.erase(entry->cell);
+		}
+	}
+	interest_entries.erase(p_sid);
+	for (KeyValue<int, PeerInfo> &E : peers_info) {
+		E.value.interest_syncs.erase(p_sid);
+	}
+}
+
+void SceneReplicationInterface::_update_interest() {
+	bool has_areas = false;
+	for (const KeyValue<int, PeerInfo> &E : peers_info) {
+		if (E.value.has_interest_area || E.value.interest_area_changed) {
+			has_areas = true;
+			break;
+		}
+	}
+	if (!has_areas && interest_entries.is_empty()) {
+		return;
+	}
+
+	// Move the synchronizers to the cell of their current position, remembering the ones whose management changed.
+	LocalVector<ObjectID> changed;
+	for (const ObjectID &sid : sync_nodes) {
+		MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(sid);
+		Vector3 position;
+		if (!sync || !sync->is_multiplayer_authority() || !sync->is_interest_management_enabled() || !_get_interest_position(sync, position)) {
+			if (interest_entries.has(sid)) {
+				_remove_interest_entry(sid);
+				changed.push_back(sid);
+			}
+			continue;
+		}
+		const Vector3i cell = Vector3i((position / interest_cell_size).floor());
+		InterestEntry *entry = interest_entries.getptr(sid);
+		if (!entry) {
+			InterestEntry new_entry;
+			new_entry.cell = cell;
+			new_entry.position = position;
+			interest_entries.insert(sid, new_entry);
+			interest_grid[cell].insert(sid);
+			changed.push_back(sid);
+			continue;
+		}
+		if (entry->cell != cell) {
+			HashSet<ObjectID> &old_cell = interest_grid[entry->cell];
+			old_cell.erase(sid);
+			if (old_cell.is_empty()) {
+				interest_grid.erase(entry->cell);
+			}
+			interest_grid[cell].insert(sid);
+			entry->cell = cell;
+		}
+		entry->position = position;
+	}
+
+	for (KeyValue<int, PeerInfo> &E : peers_info) {
+		PeerInfo &info = E.value;
+		LocalVector<ObjectID> to_update;
+		if (info.interest_area_changed) {
+			// Visibility of every managed synchronizer depends on whether the peer has an area at all.
+			info.interest_area_changed = false;
+			for (const KeyValue<ObjectID, InterestEntry> &S : interest_entries) {
+				to_update.push_back(S.key);
+			}
+		}
+		if (!info.has_interest_area) {
+			info.interest_syncs.clear();
+		} else {
+			HashSet<ObjectID> in_range;
+			const real_t radius_squared = info.interest_radius * info.interest_radius;
+			const Vector3 extents = Vector3(info.interest_radius, info.interest_radius, info.interest_radius);
+			const Vector3i from = Vector3i(((info.interest_position - extents) / interest_cell_size).floor());
+			const Vector3i to = Vector3i(((info.interest_position + extents) / interest_cell_size).floor());
+			const int64_t cell_count = int64_t(to.x - from.x + 1) * (to.y - from.y + 1) * (to.z - from.z + 1);
+			if (cell_count > int64_t(interest_grid.size())) {
+				// Large areas, check the occupied cells instead.
+				for (const KeyValue<Vector3i, HashSet<ObjectID>> &C : interest_grid) {
+					if (C.key.x < from.x || C.key.y < from.y || C.key.z < from.z || C.key.x > to.x || C.key.y > to.y || C.key.z > to.z) {
+						continue;
+					}
+					for (const ObjectID &sid : C.value) {
+						if (interest_entries[sid].position.distance_squared_to(info.interest_position) <= radius_squared) {
+							in_range.insert(sid);
+						}
+					}
+				}
+			} else {
+				for (int x = from.x; x <= to.x; x++) {
+					for (int y = from.y; y <= to.y; y++) {
+						for (int z = from.z; z <= to.z; z++) {
+							const HashSet<ObjectID> *cell = interest_grid.getptr(Vector3i(x, y, z));
+							if (!cell) {
+								continue;
+							}
+							for (const ObjectID &sid : *cell) {
+								if (interest_entries[sid].position.distance_squared_to(info.interest_position) <= radius_squared) {
+									in_range.insert(sid);
+								}
+							}
+						}
+					}
+				}
+			}
+			// Only synchronizers entering or leaving the area need a visibility update.
+			for (const ObjectID &sid : info.interest_syncs) {
+				if (!in_range.has(sid)) {
+					to_update.push_back(sid);
+				}
+			}
+			for (const ObjectID &sid : in_range) {
+				if (!info.interest_syncs.has(sid)) {
+					to_update.push_back(sid);
+				}
+			}
+			info.interest_syncs = in_range;
+		}
+		if (info.has_interest_area) {
+			for (const ObjectID &sid : changed) {
+				to_update.push_back(sid);
+			}
+		}
+		for (const ObjectID &sid : to_update) {
+			MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(sid);
+			if (sync && sync->get_root_node()) {
+				_visibility_changed(E.key, sid);
+			}
+		}
+	}
+}
+
+void SceneReplicationInterface::set_peer_interest_area(int p_peer, const Vector3 &p_position, real_t p_radius) {
+	ERR_FAIL_COND_MSG(p_radius < 0, "Interest radius must be greater or equal to 0.");
+	PeerInfo *info = peers_info.getptr(p_peer);
+	ERR_FAIL_NULL_MSG(info, vformat("Unknown peer %d.", p_peer));
+	if (!info->has_interest_area) {
+		info->has_interest_area = true;
+		info->interest_area_changed = true;
+	}
+	info->interest_position = p_position;
+	info->interest_radius = p_radius;
+}
+
+void SceneReplicationInterface::clear_peer_interest_area(int p_peer) {
+	PeerInfo *info = peers_info.getptr(p_peer);
+	ERR_FAIL_NULL_MSG(info, vformat("Unknown peer %d.", p_peer));
+	if (info->has_interest_area) {
+		info->has_interest_area = false;
+		info->interest_area_changed = true;
+	}
+}
+
+void SceneReplicationInterface::set_interest_cell_size(real_t p_size) {
+	ERR_FAIL_COND_MSG(p_size <= 0, "Interest cell size must be greater than 0.");
+	interest_cell_size = p_size;
+	// Cells are rebuilt on the next update.
+	interest_grid.clear();
+	for (KeyValue<ObjectID, InterestEntry> &E : interest_entries) {
+		E.value.cell = Vector3i((E.value.position / interest_cell_size).floor());
+		interest_grid[E.value.cell].insert(E.key);
+	}
+}
+
+real_t SceneReplicationInterface::get_interest_cell_size() const {
+	return interest_cell_size;
+}
+
 void SceneReplicationInterface::_free_remotes(const PeerInfo &p_info) {
 	for (const KeyValue<uint32_t, ObjectID> &E : p_info.recv_nodes) {
 		Node *node = tracked_nodes.has(E.value) ? get_id_as<Node>(E.value) : nullptr;
@@ -138,9 +559,19 @@ void SceneReplicationInterface::on_network_process() {
 		spawn_queue.clear();
 	}
 
+	_update_interest();
+
 	// Process syncs.
 	uint64_t usec = OS::get_singleton()->get_ticks_usec();
 	for (KeyValue<int, PeerInfo> &E : peers_info) {
+		if (sync_bandwidth > 0) {
+			// Refill the budget, keeping enough room for at least a full packet.
+			PeerInfo &info = E.value;
+			const uint64_t elapsed = info.last_allowance_usec ? usec - info.last_allowance_usec : 0;
+			info.last_allowance_usec = usec;
+			const int64_t max_allowance = MAX(sync_bandwidth, sync_mtu);
+			info.sync_allowance = MIN(info.sync_allowance + int64_t(elapsed * sync_bandwidth / 1000000), max_allowance);
+		}
 		const HashSet<ObjectID> to_sync = E.value.sync_nodes;
 		if (to_sync.is_empty()) {
 			continue; // Nothing to sync
@@ -279,9 +710,11 @@ Error SceneReplicationInterface::on_replication_stop(Object *p_obj, Variant p_co
 	TrackedNode &tobj = _track(oid);
 	tobj.synchronizers.erase(sid);
 	sync_nodes.erase(sid);
+	_remove_interest_entry(sid);
 	for (KeyValue<int, PeerInfo> &E : peers_info) {
 		E.value.sync_nodes.erase(sid);
 		E.value.last_watch_usecs.erase(sid);
+		E.value.sync_priorities.erase(sid);
 		if (sync->get_net_id()) {
 			E.value.recv_sync_ids.erase(sync->get_net_id());
 		}
@@ -332,7 +765,7 @@ bool SceneReplicationInterface::is_rpc_visible(const ObjectID &p_oid, int p_peer
 			// RPC visibility is composed using OR when multiple synchronizers are present.
 			// Note that we don't really care about authority here which may lead to unexpected
 			// results when using multiple synchronizers to control the same node.
-			if (sync->is_visible_to(p_peer)) {
+			if (sync->is_visible_to(p_peer) && _is_in_interest(p_peer, sid)) {
 				return true;
 			}
 		}
@@ -347,11 +780,11 @@ Error SceneReplicationInterface::_update_sync_visibility(int p_peer, Multiplayer
 	}
 
 	const ObjectID &sid = p_sync->get_instance_id();
-	bool is_visible = p_sync->is_visible_to(p_peer);
+	bool is_visible = p_sync->is_visible_to(p_peer) && _is_in_interest(p_peer, sid);
 	if (p_peer == 0) {
 		for (KeyValue<int, PeerInfo> &E : peers_info) {
 			// Might be visible to this specific peer.
-			bool is_visible_to_peer = is_visible || p_sync->is_visible_to(E.key);
+			bool is_visible_to_peer = (is_visible || p_sync->is_visible_to(E.key)) && _is_in_interest(E.key, sid);
 			if (is_visible_to_peer == E.value.sync_nodes.has(sid)) {
 				continue;
 			}
@@ -360,6 +793,7 @@ Error SceneReplicationInterface::_update_sync_visibility(int p_peer, Multiplayer
 			} else {
 				E.value.sync_nodes.erase(sid);
 				E.value.last_watch_usecs.erase(sid);
+				E.value.sync_priorities.erase(sid);
 			}
 		}
 		return OK;
@@ -373,6 +807,7 @@ Error SceneReplicationInterface::_update_sync_visibility(int p_peer, Multiplayer
 		} else {
 			peers_info[p_peer].sync_nodes.erase(sid);
 			peers_info[p_peer].last_watch_usecs.erase(sid);
+			peers_info[p_peer].sync_priorities.erase(sid);
 		}
 		return OK;
 	}
@@ -394,7 +829,7 @@ Error SceneReplicationInterface::_update_spawn_visibility(int p_peer, const Obje
 			continue;
 		}
 		// Spawn visibility is composed using OR when multiple synchronizers are present.
-		if (sync->is_visible_to(p_peer)) {
+		if (sync->is_visible_to(p_peer) && _is_in_interest(p_peer, sid)) {
 			is_visible = true;
 			break;
 		}
@@ -416,7 +851,7 @@ Error SceneReplicationInterface::_update_spawn_visibility(int p_peer, const Obje
 	} else {
 		// Check visibility for each peers.
 		for (const KeyValue<int, PeerInfo> &E : peers_info) {
-			if (is_visible) {
+			if (is_visible && !E.value.has_interest_area) {
 				// This is fast, since the the object is visible to everyone, we don't need to check each peer.
 				if (E.value.spawn_nodes.has(p_oid)) {
 					// Already spawned.
@@ -729,8 +1164,9 @@ void SceneReplicationInterface::_send_delta(int p_peer, const HashSet<ObjectID>
 			vptr[i] = &v;
 			i++;
 		}
+		const List<NodePath> props = sync->get_delta_properties(indexes);
 		int size;
-		Error err = MultiplayerAPI::encode_and_compress_variants(vptr, varp.size(), nullptr, size);
+		Error err = _encode_state(sync->get_replication_config(), props, vptr, nullptr, size);
 		ERR_CONTINUE_MSG(err != OK, "Unable to encode delta state.");
 
 		ERR_CONTINUE_MSG(size > delta_mtu, vformat("Synchronizer delta bigger than MTU will not be sent (%d > %d): %s", size, delta_mtu, sync->get_path()));
@@ -744,13 +1180,17 @@ void SceneReplicationInterface::_send_delta(int p_peer, const HashSet<ObjectID>
 			ofs += encode_uint32(sync->get_net_id(), &ptr[ofs]);
 			ofs += encode_uint64(indexes, &ptr[ofs]);
 			ofs += encode_uint32(size, &ptr[ofs]);
-			MultiplayerAPI::encode_and_compress_variants(vptr, varp.size(), &ptr[ofs], size);
+			_encode_state(sync->get_replication_config(), props, vptr, &ptr[ofs], size);
 			ofs += size;
 		}
 #ifdef DEBUG_ENABLED
 		_profile_node_data("delta_out", oid, size);
 #endif
 		peers_info[p_peer].last_watch_usecs[oid] = p_usec;
+		if (sync_bandwidth > 0) {
+			// Deltas are reliable and always sent, they are taken from the budget of the next syncs.
+			peers_info[p_peer].sync_allowance -= 4 + 8 + 4 + size;
+		}
 	}
 	if (ofs > 1) {
 		// Got some left over to send.
@@ -777,9 +1217,8 @@ Error SceneReplicationInterface::on_delta_receive(int p_from, const uint8_t *p_b
 		List<NodePath> props = sync->get_delta_properties(indexes);
 		ERR_FAIL_COND_V(props.size() == 0, ERR_INVALID_DATA);
 		Vector<Variant> vars;
-		vars.resize(props.size());
 		int consumed = 0;
-		Error err = MultiplayerAPI::decode_and_decompress_variants(vars, p_buffer + ofs, size, consumed);
+		Error err = _decode_state(sync->get_replication_config(), props, p_buffer + ofs, size, vars, consumed);
 		ERR_FAIL_COND_V(err != OK, err);
 		ERR_FAIL_COND_V(uint32_t(consumed) != size, ERR_INVALID_DATA);
 		err = MultiplayerSynchronizer::set_state(props, node, vars);
@@ -799,14 +1238,41 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> p
 	ptr[0] = SceneMultiplayer::NETWORK_COMMAND_SYNC;
 	int ofs = 1;
 	ofs += encode_uint16(p_sync_net_time, &ptr[1]);
-	// Can only send updates for already notified nodes.
-	// This is a lazy implementation, we could optimize much more here with by grouping by replication config.
+
+	struct SyncCandidate {
+		ObjectID id;
+		real_t priority = 0;
+		bool operator<(const SyncCandidate &p_other) const { return priority > p_other.priority; }
+	};
+
+	// With a bandwidth budget, due synchronizers are sent by accumulated priority (importance times staleness).
+	PeerInfo &info = peers_info[p_peer];
+	const bool budgeted = sync_bandwidth > 0;
+	LocalVector<SyncCandidate> candidates;
 	for (const ObjectID &oid : p_synchronizers) {
 		MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(oid);
 		ERR_CONTINUE(!sync || !sync->get_replication_config().is_valid() || !sync->is_multiplayer_authority());
 		if (!sync->update_outbound_sync_time(p_usec)) {
 			continue; // nothing to sync.
 		}
+		SyncCandidate candidate;
+		candidate.id = oid;
+		if (budgeted) {
+			real_t &priority = info.sync_priorities[oid];
+			priority += sync->get_sync_priority();
+			candidate.priority = priority;
+		}
+		candidates.push_back(candidate);
+	}
+	if (budgeted) {
+		candidates.sort();
+	}
+
+	// Can only send updates for already notified nodes.
+	// This is a lazy implementation, we could optimize much more here with by grouping by replication config.
+	for (const SyncCandidate &candidate : candidates) {
+		const ObjectID &oid = candidate.id;
+		MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(oid);
 
 		Node *node = sync->get_root_node();
 		ERR_CONTINUE(!node);
@@ -821,10 +1287,17 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> p
 		const List<NodePath> props = sync->get_replication_config()->get_sync_properties();
 		Error err = MultiplayerSynchronizer::get_state(props, node, vars, varp);
 		ERR_CONTINUE_MSG(err != OK, "Unable to retrieve sync state.");
-		err = MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), nullptr, size);
+		err = _encode_state(sync->get_replication_config(), props, varp.ptrw(), nullptr, size);
 		ERR_CONTINUE_MSG(err != OK, "Unable to encode sync state.");
 		// TODO Handle single state above MTU.
 		ERR_CONTINUE_MSG(size > sync_mtu, vformat("Node states bigger than MTU will not be sent (%d > %d): %s", size, sync_mtu, node->get_path()));
+		if (budgeted) {
+			if (4 + 4 + size > info.sync_allowance) {
+				continue; // Keeps its priority, and will be more likely to fit next time.
+			}
+			info.sync_allowance -= 4 + 4 + size;
+			info.sync_priorities[oid] = 0;
+		}
 		if (ofs + 4 + 4 + size > sync_mtu) {
 			// Send what we got, and reset write.
 			_send_raw(packet_cache.ptr(), ofs, p_peer, false);
@@ -833,7 +1306,7 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> p
 		if (size) {
 			ofs += encode_uint32(sync->get_net_id(), &ptr[ofs]);
 			ofs += encode_uint32(size, &ptr[ofs]);
-			MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), &ptr[ofs], size);
+			_encode_state(sync->get_replication_config(), props, varp.ptrw(), &ptr[ofs], size);
 			ofs += size;
 		}
 #ifdef DEBUG_ENABLED
@@ -879,9 +1352,8 @@ Error SceneReplicationInterface::on_sync_receive(int p_from, const uint8_t *p_bu
 		}
 		const List<NodePath> props = sync->get_replication_config()->get_sync_properties();
 		Vector<Variant> vars;
-		vars.resize(props.size());
 		int consumed;
-		Error err = MultiplayerAPI::decode_and_decompress_variants(vars, &p_buffer[ofs], size, consumed);
+		Error err = _decode_state(sync->get_replication_config(), props, &p_buffer[ofs], size, vars, consumed);
 		ERR_FAIL_COND_V(err, err);
 		err = MultiplayerSynchronizer::set_state(props, node, vars);
 		ERR_FAIL_COND_V(err, err);
@@ -911,3 +1383,12 @@ void SceneReplicationInterface::set_max_delta_packet_size(int p_size) {
 int SceneReplicationInterface::get_max_delta_packet_size() const {
 	return delta_mtu;
 }
+
+void SceneReplicationInterface::set_max_sync_bandwidth(int p_bytes_per_second) {
+	ERR_FAIL_COND_MSG(p_bytes_per_second < 0, "Sync bandwidth must be greater or equal to 0 (where 0 means unlimited).");
+	sync_bandwidth = p_bytes_per_second;
+}
+
+int SceneReplicationInterface::get_max_sync_bandwidth() const {
+	return sync_bandwidth;
+}
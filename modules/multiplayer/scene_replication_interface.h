@@ -66,6 +66,23 @@ private:
 		HashMap<uint32_t, ObjectID> recv_sync_ids;
 		HashMap<uint32_t, ObjectID> recv_nodes;
 		uint16_t last_sent_sync = 0;
+
+		// Bandwidth budget, synchronizers that don't fit accumulate priority until they do.
+		int64_t sync_allowance = 0;
+		uint64_t last_allowance_usec = 0;
+		HashMap<ObjectID, real_t> sync_priorities;
+
+		// Area of interest, synchronizers using interest management outside of it are hidden.
+		bool has_interest_area = false;
+		bool interest_area_changed = false;
+		Vector3 interest_position;
+		real_t interest_radius = 0;
+		HashSet<ObjectID> interest_syncs;
+	};
+
+	struct InterestEntry {
+		Vector3i cell;
+		Vector3 position;
 	};
 
 	// Replication state.
@@ -75,6 +92,11 @@ private:
 	HashSet<ObjectID> spawned_nodes;
 	HashSet<ObjectID> sync_nodes;
 
+	// Uniform grid of the synchronizers using interest management.
+	real_t interest_cell_size = 64;
+	HashMap<ObjectID, InterestEntry> interest_entries;
+	HashMap<Vector3i, HashSet<ObjectID>> interest_grid;
+
 	// Pending local spawn information (handles spawning nested nodes during ready).
 	HashSet<ObjectID> spawn_queue;
 
@@ -90,6 +112,7 @@ private:
 	PackedByteArray packet_cache;
 	int sync_mtu = 1350; // Highly dependent on underlying protocol.
 	int delta_mtu = 65535;
+	int sync_bandwidth = 0; // Bytes per second for each peer, 0 is unlimited.
 
 	TrackedNode &_track(const ObjectID &p_id);
 	void _untrack(const ObjectID &p_id);
@@ -98,6 +121,9 @@ private:
 	bool _verify_synchronizer(int p_peer, MultiplayerSynchronizer *p_sync, uint32_t &r_net_id);
 	MultiplayerSynchronizer *_find_synchronizer(int p_peer, uint32_t p_net_ida);
 
+	static Error _encode_state(const Ref<SceneReplicationConfig> &p_config, const List<NodePath> &p_properties, const Variant **p_variants, uint8_t *p_buffer, int &r_len);
+	static Error _decode_state(const Ref<SceneReplicationConfig> &p_config, const List<NodePath> &p_properties, const uint8_t *p_buffer, int p_len, Vector<Variant> &r_variants, int &r_len);
+
 	void _send_sync(int p_peer, const HashSet<ObjectID> p_synchronizers, uint16_t p_sync_net_time, uint64_t p_usec);
 	void _send_delta(int p_peer, const HashSet<ObjectID> p_synchronizers, uint64_t p_usec, const HashMap<ObjectID, uint64_t> p_last_watch_usecs);
 	Error _make_spawn_packet(Node *p_node, MultiplayerSpawner *p_spawner, int &r_len);
@@ -109,6 +135,11 @@ private:
 	Error _update_spawn_visibility(int p_peer, const ObjectID &p_oid);
 	void _free_remotes(const PeerInfo &p_info);
 
+	static bool _get_interest_position(MultiplayerSynchronizer *p_sync, Vector3 &r_position);
+	bool _is_in_interest(int p_peer, const ObjectID &p_sid) const;
+	void _remove_interest_entry(const ObjectID &p_sid);
+	void _update_interest();
+
 	template <class T>
 	static T *get_id_as(const ObjectID &p_id) {
 		return p_id.is_valid() ? Object::cast_to<T>(ObjectDB::get_instance(p_id)) : nullptr;
@@ -143,6 +174,15 @@ public:
 	void set_max_delta_packet_size(int p_size);
 	int get_max_delta_packet_size() const;
 
+	void set_max_sync_bandwidth(int p_bytes_per_second);
+	int get_max_sync_bandwidth() const;
+
+	void set_peer_interest_area(int p_peer, const Vector3 &p_position, real_t p_radius);
+	void clear_peer_interest_area(int p_peer);
+
+	void set_interest_cell_size(real_t p_size);
+	real_t get_interest_cell_size() const;
+
 	SceneReplicationInterface(SceneMultiplayer *p_multiplayer) {
 		multiplayer = p_multiplayer;
 	}
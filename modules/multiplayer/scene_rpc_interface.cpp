@@ -34,6 +34,7 @@
 
 #include "core/debugger/engine_debugger.h"
 #include "core/io/marshalls.h"
+#include "core/object/script_language.h"
 #include "scene/main/multiplayer_api.h"
 #include "scene/main/node.h"
 #include "scene/main/window.h"
@@ -51,6 +52,10 @@
 #define NAME_ID_COMPRESSION_FLAG (1 << NAME_ID_COMPRESSION_SHIFT)
 #define BYTE_ONLY_OR_NO_ARGS_FLAG (1 << BYTE_ONLY_OR_NO_ARGS_SHIFT)
 
+// An argument count of 0 (never sent otherwise, since no arguments sets `byte_only_or_no_args`) marks arguments
+// encoded without type headers, following the typed signature of the method.
+#define TYPED_ARGS_MARKER 0
+
 #ifdef DEBUG_ENABLED
 _FORCE_INLINE_ void SceneRPCInterface::_profile_node_data(const String &p_what, ObjectID p_id, int p_size) {
 	if (EngineDebugger::is_profiling("multiplayer:rpc")) {
@@ -102,6 +107,285 @@ void SceneRPCInterface::_parse_rpc_config(const Variant &p_config, bool p_for_no
 	}
 }
 
+static bool _is_typed_rpc_arg(Variant::Type p_type) {
+	switch (p_type) {
+		case Variant::BOOL:
+		case Variant::INT:
+		case Variant::FLOAT:
+		case Variant::VECTOR2I:
+		case Variant::RECT2I:
+		case Variant::VECTOR3I:
+		case Variant::VECTOR4I:
+		case Variant::COLOR:
+			return true;
+#ifndef REAL_T_IS_DOUBLE
+		// Real components are always sent as 32-bit floats, so only use this path when nothing is lost.
+		case Variant::VECTOR2:
+		case Variant::RECT2:
+		case Variant::VECTOR3:
+		case Variant::VECTOR4:
+		case Variant::PLANE:
+		case Variant::QUATERNION:
+			return true;
+#endif
+		default:
+			return false;
+	}
+}
+
+// Encodes the arguments with no type headers, returns the size. Only computes the size when `r_buffer` is null.
+static int _encode_typed_rpc_args(const LocalVector<Variant::Type> &p_types, const Variant **p_arg, uint8_t *r_buffer) {
+	int len = 0;
+	for (uint32_t i = 0; i < p_types.size(); i++) {
+		const Variant &v = *p_arg[i];
+		uint8_t *buf = r_buffer ? r_buffer + len : nullptr;
+		int components = 0;
+		float reals[4];
+		int32_t ints[4];
+		switch (p_types[i]) {
+			case Variant::BOOL: {
+				if (buf) {
+					*buf = v.operator bool() ? 1 : 0;
+				}
+				len += 1;
+			} break;
+			case Variant::INT: {
+				// Zigzag varint, small values of either sign take a single byte.
+				int64_t value = v;
+				uint64_t zigzag = ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+				do {
+					uint8_t byte = zigzag & 0x7F;
+					zigzag >>= 7;
+					if (zigzag) {
+						byte |= 0x80;
+					}
+					if (buf) {
+						*(buf++) = byte;
+					}
+					len += 1;
+				} while (zigzag);
+			} break;
+			case Variant::FLOAT: {
+				if (buf) {
+					encode_double(v, buf);
+				}
+				len += 8;
+			} break;
+			case Variant::VECTOR2: {
+				Vector2 vec = v;
+				reals[0] = vec.x;
+				reals[1] = vec.y;
+				components = 2;
+			} break;
+			case Variant::RECT2: {
+				Rect2 rect = v;
+				reals[0] = rect.position.x;
+				reals[1] = rect.position.y;
+				reals[2] = rect.size.x;
+				reals[3] = rect.size.y;
+				components = 4;
+			} break;
+			case Variant::VECTOR3: {
+				Vector3 vec = v;
+				reals[0] = vec.x;
+				reals[1] = vec.y;
+				reals[2] = vec.z;
+				components = 3;
+			} break;
+			case Variant::VECTOR4: {
+				Vector4 vec = v;
+				reals[0] = vec.x;
+				reals[1] = vec.y;
+				reals[2] = vec.z;
+				reals[3] = vec.w;
+				components = 4;
+			} break;
+			case Variant::PLANE: {
+				Plane plane = v;
+				reals[0] = plane.normal.x;
+				reals[1] = plane.normal.y;
+				reals[2] = plane.normal.z;
+				reals[3] = plane.d;
+				components = 4;
+			} break;
+			case Variant::QUATERNION: {
+				Quaternion quat = v;
+				reals[0] = quat.x;
+				reals[1] = quat.y;
+				reals[2] = quat.z;
+				reals[3] = quat.w;
+				components = 4;
+			} break;
+			case Variant::COLOR: {
+				Color color = v;
+				reals[0] = color.r;
+				reals[1] = color.g;
+				reals[2] = color.b;
+				reals[3] = color.a;
+				components = 4;
+			} break;
+			case Variant::VECTOR2I: {
+				Vector2i vec = v;
+				ints[0] = vec.x;
+				ints[1] = vec.y;
+				components = -2;
+			} break;
+			case Variant::RECT2I: {
+				Rect2i rect = v;
+				ints[0] = rect.position.x;
+				ints[1] = rect.position.y;
+				ints[2] = rect.size.x;
+				ints[3] = rect.size.y;
+				components = -4;
+			} break;
+			case Variant::VECTOR3I: {
+				Vector3i vec = v;
+				ints[0] = vec.x;
+				ints[1] = vec.y;
+				ints[2] = vec.z;
+				components = -3;
+			} break;
+			case Variant::VECTOR4I: {
+				Vector4i vec = v;
+				ints[0] = vec.x;
+				ints[1] = vec.y;
+				ints[2] = vec.z;
+				ints[3] = vec.w;
+				components = -4;
+			} break;
+			default: {
+				// Unreachable, checked when parsing the signature.
+				CRASH_NOW();
+			}
+		}
+		// Negative counts are integer components.
+		for (int j = 0; j < ABS(components); j++) {
+			if (buf) {
+				if (components > 0) {
+					encode_float(reals[j], buf + j * 4);
+				} else {
+					encode_uint32(ints[j], buf + j * 4);
+				}
+			}
+		}
+		len += ABS(components) * 4;
+	}
+	return len;
+}
+
+static Error _decode_typed_rpc_args(const LocalVector<Variant::Type> &p_types, const uint8_t *p_buffer, int p_len, Vector<Variant> &r_args) {
+	r_args.resize(p_types.size());
+	int ofs = 0;
+	for (uint32_t i = 0; i < p_types.size(); i++) {
+		const Variant::Type type = p_types[i];
+		if (type == Variant::BOOL) {
+			ERR_FAIL_COND_V(ofs + 1 > p_len, ERR_INVALID_DATA);
+			r_args.write[i] = p_buffer[ofs] != 0;
+			ofs += 1;
+			continue;
+		}
+		if (type == Variant::INT) {
+			uint64_t zigzag = 0;
+			int shift = 0;
+			uint8_t byte = 0;
+			do {
+				ERR_FAIL_COND_V(ofs >= p_len || shift > 63, ERR_INVALID_DATA);
+				byte = p_buffer[ofs++];
+				zigzag |= (uint64_t)(byte & 0x7F) << shift;
+				shift += 7;
+			} while (byte & 0x80);
+			r_args.write[i] = (int64_t)(zigzag >> 1) ^ -(int64_t)(zigzag & 1);
+			continue;
+		}
+		if (type == Variant::FLOAT) {
+			ERR_FAIL_COND_V(ofs + 8 > p_len, ERR_INVALID_DATA);
+			r_args.write[i] = decode_double(p_buffer + ofs);
+			ofs += 8;
+			continue;
+		}
+
+		int components = 4;
+		if (type == Variant::VECTOR2 || type == Variant::VECTOR2I) {
+			components = 2;
+		} else if (type == Variant::VECTOR3 || type == Variant::VECTOR3I) {
+			components = 3;
+		}
+		ERR_FAIL_COND_V(ofs + components * 4 > p_len, ERR_INVALID_DATA);
+		const uint8_t *buf = p_buffer + ofs;
+		ofs += components * 4;
+		switch (type) {
+			case Variant::VECTOR2: {
+				r_args.write[i] = Vector2(decode_float(buf), decode_float(buf + 4));
+			} break;
+			case Variant::RECT2: {
+				r_args.write[i] = Rect2(decode_float(buf), decode_float(buf + 4), decode_float(buf + 8), decode_float(buf + 12));
+			} break;
+			case Variant::VECTOR3: {
+				r_args.write[i] = Vector3(decode_float(buf), decode_float(buf + 4), decode_float(buf + 8));
+			} break;
+			case Variant::VECTOR4: {
+				r_args.write[i] = Vector4(decode_float(buf), decode_float(buf + 4), decode_float(buf + 8), decode_float(buf + 12));
+			} break;
+			case Variant::PLANE: {
+				r_args.write[i] = Plane(decode_float(buf), decode_float(buf + 4), decode_float(buf + 8), decode_float(buf + 12));
+			} break;
+			case Variant::QUATERNION: {
+				r_args.write[i] = Quaternion(decode_float(buf), decode_float(buf + 4), decode_float(buf + 8), decode_float(buf + 12));
+			} break;
+			case Variant::COLOR: {
+				r_args.write[i] = Color(decode_float(buf), decode_float(buf + 4), decode_float(buf + 8), decode_float(buf + 12));
+			} break;
+			case Variant::VECTOR2I: {
+				r_args.write[i] = Vector2i((int32_t)decode_uint32(buf), (int32_t)decode_uint32(buf + 4));
+			} break;
+			case Variant::RECT2I: {
+				r_args.write[i] = Rect2i((int32_t)decode_uint32(buf), (int32_t)decode_uint32(buf + 4), (int32_t)decode_uint32(buf + 8), (int32_t)decode_uint32(buf + 12));
+			} break;
+			case Variant::VECTOR3I: {
+				r_args.write[i] = Vector3i((int32_t)decode_uint32(buf), (int32_t)decode_uint32(buf + 4), (int32_t)decode_uint32(buf + 8));
+			} break;
+			case Variant::VECTOR4I: {
+				r_args.write[i] = Vector4i((int32_t)decode_uint32(buf), (int32_t)decode_uint32(buf + 4), (int32_t)decode_uint32(buf + 8), (int32_t)decode_uint32(buf + 12));
+			} break;
+			default: {
+				ERR_FAIL_V(ERR_INVALID_DATA);
+			}
+		}
+	}
+	ERR_FAIL_COND_V(ofs != p_len, ERR_INVALID_DATA);
+	return OK;
+}
+
+void SceneRPCInterface::_parse_rpc_signature(const Node *p_node, bool p_for_node, RPCConfig &r_config) {
+	MethodInfo info;
+	bool found = false;
+	if (p_for_node) {
+		found = ClassDB::get_method_info(p_node->get_class_name(), r_config.name, &info);
+	} else {
+		Ref<Script> script = p_node->get_script_instance()->get_script();
+		while (script.is_valid()) {
+			if (script->has_method(r_config.name)) {
+				info = script->get_method_info(r_config.name);
+				found = true;
+				break;
+			}
+			script = script->get_base_script();
+		}
+	}
+	// Both peers run the same scripts, so they agree on which methods have a typed signature.
+	if (!found || info.arguments.is_empty() || info.arguments.size() > 255) {
+		return;
+	}
+	for (const PropertyInfo &arg : info.arguments) {
+		if (!_is_typed_rpc_arg(arg.type)) {
+			return;
+		}
+	}
+	for (const PropertyInfo &arg : info.arguments) {
+		r_config.typed_args.push_back(arg.type);
+	}
+}
+
 const SceneRPCInterface::RPCConfigCache &SceneRPCInterface::_get_node_config(const Node *p_node) {
 	const ObjectID oid = p_node->get_instance_id();
 	if (rpc_cache.has(oid)) {
@@ -112,6 +396,9 @@ const SceneRPCInterface::RPCConfigCache &SceneRPCInterface::_get_node_config(con
 	if (p_node->get_script_instance()) {
 		_parse_rpc_config(p_node->get_script_instance()->get_rpc_config(), false, cache);
 	}
+	for (KeyValue<uint16_t, RPCConfig> &E : cache.configs) {
+		_parse_rpc_signature(p_node, E.key & (1 << 15), E.value);
+	}
 	rpc_cache[oid] = cache;
 	return rpc_cache[oid];
 }
@@ -256,6 +543,7 @@ void SceneRPCInterface::_process_rpc(Node *p_node, const uint16_t p_rpc_method_i
 	ERR_FAIL_COND_MSG(!can_call, "RPC '" + String(config.name) + "' is not allowed on node " + p_node->get_path() + " from: " + itos(p_from) + ". Mode is " + itos((int)config.rpc_mode) + ", authority is " + itos(p_node->get_multiplayer_authority()) + ".");
 
 	int argc = 0;
+	bool typed_args = false;
 
 	const bool byte_only_or_no_args = p_packet[0] & BYTE_ONLY_OR_NO_ARGS_FLAG;
 	if (byte_only_or_no_args) {
@@ -268,6 +556,12 @@ void SceneRPCInterface::_process_rpc(Node *p_node, const uint16_t p_rpc_method_i
 		ERR_FAIL_COND_MSG(p_offset >= p_packet_len, "Invalid packet received. Size too small.");
 		argc = p_packet[p_offset];
 		p_offset += 1;
+		if (argc == TYPED_ARGS_MARKER) {
+			// The argument count and types come from the method signature.
+			ERR_FAIL_COND_MSG(config.typed_args.is_empty(), "Invalid packet received. RPC '" + String(config.name) + "' has no typed signature.");
+			typed_args = true;
+			argc = config.typed_args.size();
+		}
 	}
 
 	Vector<Variant> args;
@@ -279,8 +573,13 @@ void SceneRPCInterface::_process_rpc(Node *p_node, const uint16_t p_rpc_method_i
 	_profile_node_data("rpc_in", p_node->get_instance_id(), p_packet_len);
 #endif
 
-	int out;
-	MultiplayerAPI::decode_and_decompress_variants(args, &p_packet[p_offset], p_packet_len - p_offset, out, byte_only_or_no_args, multiplayer->is_object_decoding_allowed());
+	if (typed_args) {
+		Error err = _decode_typed_rpc_args(config.typed_args, &p_packet[p_offset], p_packet_len - p_offset, args);
+		ERR_FAIL_COND_MSG(err != OK, "Invalid packet received. Unable to decode typed RPC arguments.");
+	} else {
+		int out;
+		MultiplayerAPI::decode_and_decompress_variants(args, &p_packet[p_offset], p_packet_len - p_offset, out, byte_only_or_no_args, multiplayer->is_object_decoding_allowed());
+	}
 	for (int i = 0; i < argc; i++) {
 		argp.write[i] = &args[i];
 	}
@@ -402,19 +701,34 @@ void SceneRPCInterface::_send_rpc(Node *p_node, int p_to, uint16_t p_rpc_id, con
 		ofs += 2;
 	}
 
-	int len;
-	Error err = MultiplayerAPI::encode_and_compress_variants(p_arg, p_argcount, nullptr, len, &byte_only_or_no_args, multiplayer->is_object_decoding_allowed());
-	ERR_FAIL_COND_MSG(err != OK, "Unable to encode RPC arguments. THIS IS LIKELY A BUG IN THE ENGINE!");
-	if (byte_only_or_no_args) {
-		MAKE_ROOM(ofs + len);
-	} else {
+	// Arguments matching the typed signature exactly are sent without type headers.
+	bool typed_args = !p_config.typed_args.is_empty() && p_argcount == (int)p_config.typed_args.size();
+	for (int i = 0; typed_args && i < p_argcount; i++) {
+		typed_args = p_arg[i]->get_type() == p_config.typed_args[i];
+	}
+
+	if (typed_args) {
+		int len = _encode_typed_rpc_args(p_config.typed_args, p_arg, nullptr);
 		MAKE_ROOM(ofs + 1 + len);
-		packet_cache.write[ofs] = p_argcount;
+		packet_cache.write[ofs] = TYPED_ARGS_MARKER;
 		ofs += 1;
-	}
-	if (len) {
-		MultiplayerAPI::encode_and_compress_variants(p_arg, p_argcount, &packet_cache.write[ofs], len, &byte_only_or_no_args, multiplayer->is_object_decoding_allowed());
+		_encode_typed_rpc_args(p_config.typed_args, p_arg, &packet_cache.write[ofs]);
 		ofs += len;
+	} else {
+		int len;
+		Error err = MultiplayerAPI::encode_and_compress_variants(p_arg, p_argcount, nullptr, len, &byte_only_or_no_args, multiplayer->is_object_decoding_allowed());
+		ERR_FAIL_COND_MSG(err != OK, "Unable to encode RPC arguments. THIS IS LIKELY A BUG IN THE ENGINE!");
+		if (byte_only_or_no_args) {
+			MAKE_ROOM(ofs + len);
+		} else {
+			MAKE_ROOM(ofs + 1 + len);
+			packet_cache.write[ofs] = p_argcount;
+			ofs += 1;
+		}
+		if (len) {
+			MultiplayerAPI::encode_and_compress_variants(p_arg, p_argcount, &packet_cache.write[ofs], len, &byte_only_or_no_args, multiplayer->is_object_decoding_allowed());
+			ofs += len;
+		}
 	}
 
 	ERR_FAIL_COND(command_type > 7);
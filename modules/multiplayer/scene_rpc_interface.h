@@ -47,6 +47,8 @@ private:
 		bool call_local = false;
 		MultiplayerPeer::TransferMode transfer_mode = MultiplayerPeer::TRANSFER_MODE_RELIABLE;
 		int channel = 0;
+		// Argument types, when every argument has a fixed size type and can be sent without type headers.
+		LocalVector<Variant::Type> typed_args;
 
 		bool operator==(RPCConfig const &p_other) const {
 			return name == p_other.name;
@@ -92,6 +94,7 @@ protected:
 	Node *_process_get_node(int p_from, const uint8_t *p_packet, uint32_t p_node_target, int p_packet_len);
 
 	void _parse_rpc_config(const Variant &p_config, bool p_for_node, RPCConfigCache &r_cache);
+	void _parse_rpc_signature(const Node *p_node, bool p_for_node, RPCConfig &r_config);
 	const RPCConfigCache &_get_node_config(const Node *p_node);
 
 public:
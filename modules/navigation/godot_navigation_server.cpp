@@ -257,6 +257,13 @@ RID GodotNavigationServer::map_get_closest_point_owner(RID p_map, const Vector3
 	return map->get_closest_point_owner(p_point);
 }
 
+Vector<Vector3> GodotNavigationServer::map_get_closest_points(RID p_map, const Vector<Vector3> &p_points) const {
+	const NavMap *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_COND_V(map == nullptr, Vector<Vector3>());
+
+	return map->get_closest_points(p_points);
+}
+
 TypedArray<RID> GodotNavigationServer::map_get_links(RID p_map) const {
 	TypedArray<RID> link_rids;
 	const NavMap *map = map_owner.get_or_null(p_map);
@@ -962,6 +969,18 @@ void GodotNavigationServer::bake_from_source_geometry_data_async(const Ref<Navig
 #endif // _3D_DISABLED
 }
 
+Dictionary GodotNavigationServer::bake_tiles_from_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, real_t p_tile_size, const AABB &p_changed_aabb) {
+#ifndef _3D_DISABLED
+	ERR_FAIL_COND_V_MSG(!p_navigation_mesh.is_valid(), Dictionary(), "Invalid navigation mesh.");
+	ERR_FAIL_COND_V_MSG(!p_source_geometry_data.is_valid(), Dictionary(), "Invalid NavigationMeshSourceGeometryData3D.");
+
+	ERR_FAIL_NULL_V(NavMeshGenerator3D::get_singleton(), Dictionary());
+	return NavMeshGenerator3D::get_singleton()->bake_tiles_from_source_geometry_data(p_navigation_mesh, p_source_geometry_data, p_tile_size, p_changed_aabb);
+#else
+	return Dictionary();
+#endif // _3D_DISABLED
+}
+
 COMMAND_1(free, RID, p_object) {
 	if (map_owner.owns(p_object)) {
 		NavMap *map = map_owner.get_or_null(p_object);
@@ -1065,6 +1084,9 @@ void GodotNavigationServer::set_active(bool p_active) {
 }
 
 void GodotNavigationServer::flush_queries() {
+	// The running path queries read the maps, let them finish before any change.
+	_dispatch_async_queries();
+
 	// In c++ we can't be sure that this is performed in the main thread
 	// even with mutable functions.
 	MutexLock lock(commands_mutex);
@@ -1087,6 +1109,8 @@ void GodotNavigationServer::map_force_update(RID p_map) {
 }
 
 void GodotNavigationServer::process(real_t p_delta_time) {
+	MEMORY_TAG_SCOPE("Navigation");
+
 	flush_queries();
 
 	if (!active) {
@@ -1145,6 +1169,8 @@ void GodotNavigationServer::process(real_t p_delta_time) {
 	pm_edge_merge_count = _new_pm_edge_merge_count;
 	pm_edge_connection_count = _new_pm_edge_connection_count;
 	pm_edge_free_count = _new_pm_edge_free_count;
+
+	_start_async_queries();
 }
 
 void GodotNavigationServer::init() {
@@ -1154,6 +1180,12 @@ void GodotNavigationServer::init() {
 }
 
 void GodotNavigationServer::finish() {
+	_wait_async_queries();
+	async_queries_running.clear();
+	{
+		MutexLock lock(async_queries_mutex);
+		async_queries.clear();
+	}
 	flush_queries();
 #ifndef _3D_DISABLED
 	if (navmesh_generator_3d) {
@@ -1182,7 +1214,8 @@ PathQueryResult GodotNavigationServer::_query_path(const PathQueryParameters &p_
 					p_parameters.navigation_layers,
 					p_parameters.metadata_flags.has_flag(PathMetadataFlags::PATH_INCLUDE_TYPES) ? &r_query_result.path_types : nullptr,
 					p_parameters.metadata_flags.has_flag(PathMetadataFlags::PATH_INCLUDE_RIDS) ? &r_query_result.path_rids : nullptr,
-					p_parameters.metadata_flags.has_flag(PathMetadataFlags::PATH_INCLUDE_OWNERS) ? &r_query_result.path_owner_ids : nullptr);
+					p_parameters.metadata_flags.has_flag(PathMetadataFlags::PATH_INCLUDE_OWNERS) ? &r_query_result.path_owner_ids : nullptr,
+					p_parameters.use_hierarchical_pathfinding);
 		} else if (p_parameters.path_postprocessing == PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED) {
 			r_query_result.path = map->get_path(
 					p_parameters.start_position,
@@ -1191,7 +1224,8 @@ PathQueryResult GodotNavigationServer::_query_path(const PathQueryParameters &p_
 					p_parameters.navigation_layers,
 					p_parameters.metadata_flags.has_flag(PathMetadataFlags::PATH_INCLUDE_TYPES) ? &r_query_result.path_types : nullptr,
 					p_parameters.metadata_flags.has_flag(PathMetadataFlags::PATH_INCLUDE_RIDS) ? &r_query_result.path_rids : nullptr,
-					p_parameters.metadata_flags.has_flag(PathMetadataFlags::PATH_INCLUDE_OWNERS) ? &r_query_result.path_owner_ids : nullptr);
+					p_parameters.metadata_flags.has_flag(PathMetadataFlags::PATH_INCLUDE_OWNERS) ? &r_query_result.path_owner_ids : nullptr,
+					p_parameters.use_hierarchical_pathfinding);
 		}
 	} else {
 		return r_query_result;
@@ -1204,6 +1238,67 @@ PathQueryResult GodotNavigationServer::_query_path(const PathQueryParameters &p_
 	return r_query_result;
 }
 
+void GodotNavigationServer::query_path_async(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, const Callable &p_callback) {
+	ERR_FAIL_COND(!p_query_parameters.is_valid());
+	ERR_FAIL_COND(!p_callback.is_valid());
+
+	AsyncPathQuery query;
+	query.parameters = p_query_parameters->get_parameters();
+	query.callback = p_callback;
+
+	MutexLock lock(async_queries_mutex);
+	async_queries.push_back(query);
+}
+
+void GodotNavigationServer::_run_async_query(uint32_t p_index, AsyncPathQuery *p_queries) {
+	AsyncPathQuery &query = p_queries[p_index];
+	query.result = _query_path(query.parameters);
+}
+
+void GodotNavigationServer::_start_async_queries() {
+	ERR_FAIL_COND(async_queries_group != -1);
+	{
+		MutexLock lock(async_queries_mutex);
+		if (async_queries.is_empty()) {
+			return;
+		}
+		SWAP(async_queries, async_queries_running);
+	}
+	async_queries_group = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotNavigationServer::_run_async_query, async_queries_running.ptr(), async_queries_running.size(), -1, false, SNAME("NavigationServerPathQueries"));
+}
+
+void GodotNavigationServer::_wait_async_queries() {
+	if (async_queries_group == -1) {
+		return;
+	}
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(async_queries_group);
+	async_queries_group = -1;
+}
+
+void GodotNavigationServer::_dispatch_async_queries() {
+	_wait_async_queries();
+	if (async_queries_running.is_empty()) {
+		return;
+	}
+
+	// Callbacks may queue new queries or force a map update.
+	LocalVector<AsyncPathQuery> finished;
+	SWAP(finished, async_queries_running);
+	for (const AsyncPathQuery &query : finished) {
+		Ref<NavigationPathQueryResult3D> query_result;
+		query_result.instantiate();
+		query_result->set_path(query.result.path);
+		query_result->set_path_types(query.result.path_types);
+		query_result->set_path_rids(query.result.path_rids);
+		query_result->set_path_owner_ids(query.result.path_owner_ids);
+		Variant result_variant = query_result;
+		const Variant *args[1] = { &result_variant };
+		Variant return_value;
+		Callable::CallError call_error;
+		query.callback.callp(args, 1, return_value, call_error);
+	}
+}
+
 int GodotNavigationServer::get_process_info(ProcessInfo p_info) const {
 	switch (p_info) {
 		case INFO_ACTIVE_MAPS: {
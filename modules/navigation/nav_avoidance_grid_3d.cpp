@@ -0,0 +1,168 @@
+/**************************************************************************/
+/*  nav_avoidance_grid_3d.cpp                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "nav_avoidance_grid_3d.h"
+
+#include "nav_agent.h"
+
+void NavAvoidanceGrid3D::build(const LocalVector<NavAgent *> &p_agents) {
+	const uint32_t agent_count = p_agents.size();
+	agents.resize(agent_count);
+	positions_x.resize(agent_count);
+	positions_y.resize(agent_count);
+	positions_z.resize(agent_count);
+	avoidance_layers.resize(agent_count);
+	avoidance_priorities.resize(agent_count);
+	agent_cells.resize(agent_count);
+	cell_agents.resize(agent_count);
+
+	// Cells a bit larger than the largest neighbor distance, so a search never spans more than 3 cells per axis.
+	float max_neighbor_distance = 0.0;
+	for (uint32_t i = 0; i < agent_count; i++) {
+		const RVO3D::Agent3D *agent = p_agents[i]->get_rvo_agent_3d();
+		agents[i] = agent;
+		positions_x[i] = agent->position_.x();
+		positions_y[i] = agent->position_.y();
+		positions_z[i] = agent->position_.z();
+		avoidance_layers[i] = agent->avoidance_layers_;
+		avoidance_priorities[i] = agent->avoidance_priority_;
+		max_neighbor_distance = MAX(max_neighbor_distance, agent->neighborDist_);
+	}
+	cell_size = MAX(max_neighbor_distance * 1.01f, 0.001f);
+
+	const uint32_t table_size = next_power_of_2(MAX(agent_count * 2, 16u));
+	cell_mask = table_size - 1;
+	cell_start.resize(table_size + 1);
+	for (uint32_t &start : cell_start) {
+		start = 0;
+	}
+
+	// Counting sort of the agents by cell hash.
+	for (uint32_t i = 0; i < agent_count; i++) {
+		const uint32_t hash = _get_cell_hash(_get_cell_coord(positions_x[i]), _get_cell_coord(positions_y[i]), _get_cell_coord(positions_z[i]));
+		agent_cells[i] = hash;
+		cell_start[hash + 1]++;
+	}
+	for (uint32_t i = 0; i < table_size; i++) {
+		cell_start[i + 1] += cell_start[i];
+	}
+	for (uint32_t i = 0; i < agent_count; i++) {
+		cell_agents[cell_start[agent_cells[i]]++] = i;
+	}
+	// Filling moved every cell start to the start of the next cell, move them back.
+	for (uint32_t i = table_size; i > 0; i--) {
+		cell_start[i] = cell_start[i - 1];
+	}
+	cell_start[0] = 0;
+}
+
+void NavAvoidanceGrid3D::clear() {
+	agents.clear();
+	positions_x.clear();
+	positions_y.clear();
+	positions_z.clear();
+	avoidance_layers.clear();
+	avoidance_priorities.clear();
+	cell_start.clear();
+	cell_agents.clear();
+	agent_cells.clear();
+	cell_mask = 0;
+}
+
+void NavAvoidanceGrid3D::compute_neighbors(RVO3D::Agent3D *p_agent) const {
+	p_agent->agentNeighbors_.clear();
+	if (p_agent->maxNeighbors_ == 0 || cell_start.is_empty()) {
+		return;
+	}
+
+	const float x = p_agent->position_.x();
+	const float y = p_agent->position_.y();
+	const float z = p_agent->position_.z();
+	const uint32_t avoidance_mask = p_agent->avoidance_mask_;
+	const float avoidance_priority = p_agent->avoidance_priority_;
+	float range_sq = p_agent->neighborDist_ * p_agent->neighborDist_;
+	const float range = p_agent->neighborDist_;
+
+	// Different cells can share a hash, each hash is only visited once.
+	uint32_t visited_hashes[27];
+	uint32_t visited_count = 0;
+
+	const int32_t from_x = _get_cell_coord(x - range), to_x = _get_cell_coord(x + range);
+	const int32_t from_y = _get_cell_coord(y - range), to_y = _get_cell_coord(y + range);
+	const int32_t from_z = _get_cell_coord(z - range), to_z = _get_cell_coord(z + range);
+	for (int32_t cell_x = from_x; cell_x <= to_x; cell_x++) {
+		for (int32_t cell_y = from_y; cell_y <= to_y; cell_y++) {
+			for (int32_t cell_z = from_z; cell_z <= to_z; cell_z++) {
+				const uint32_t hash = _get_cell_hash(cell_x, cell_y, cell_z);
+				bool visited = false;
+				for (uint32_t i = 0; i < visited_count; i++) {
+					if (visited_hashes[i] == hash) {
+						visited = true;
+						break;
+					}
+				}
+				if (visited) {
+					continue;
+				}
+				DEV_ASSERT(visited_count < 27);
+				visited_hashes[visited_count++] = hash;
+
+				for (uint32_t j = cell_start[hash]; j < cell_start[hash + 1]; j++) {
+					const uint32_t other = cell_agents[j];
+					if ((avoidance_mask & avoidance_layers[other]) == 0 || avoidance_priority > avoidance_priorities[other]) {
+						continue;
+					}
+					const float dx = positions_x[other] - x;
+					const float dy = positions_y[other] - y;
+					const float dz = positions_z[other] - z;
+					const float dist_sq = dx * dx + dy * dy + dz * dz;
+					if (dist_sq >= range_sq || agents[other] == p_agent) {
+						continue;
+					}
+
+					// Sorted insertion, as RVO3D::Agent3D::insertAgentNeighbor() does.
+					std::vector<std::pair<float, const RVO3D::Agent3D *>> &neighbors = p_agent->agentNeighbors_;
+					if (neighbors.size() < p_agent->maxNeighbors_) {
+						neighbors.push_back(std::make_pair(dist_sq, agents[other]));
+					}
+					size_t i = neighbors.size() - 1;
+					while (i != 0 && dist_sq < neighbors[i - 1].first) {
+						neighbors[i] = neighbors[i - 1];
+						--i;
+					}
+					neighbors[i] = std::make_pair(dist_sq, agents[other]);
+					if (neighbors.size() == p_agent->maxNeighbors_) {
+						range_sq = neighbors.back().first;
+					}
+				}
+			}
+		}
+	}
+}
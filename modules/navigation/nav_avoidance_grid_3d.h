@@ -0,0 +1,75 @@
+/**************************************************************************/
+/*  nav_avoidance_grid_3d.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef NAV_AVOIDANCE_GRID_3D_H
+#define NAV_AVOIDANCE_GRID_3D_H
+
+#include "core/math/math_funcs.h"
+#include "core/templates/local_vector.h"
+
+#include <Agent3d.h>
+
+class NavAgent;
+
+/// Spatial hash over the 3D avoidance agents of a map, replacing the RVO kd-tree for neighbor searches.
+/// Its storage is reused between steps, so rebuilding it is a counting sort without allocations.
+class NavAvoidanceGrid3D {
+	// Agent state as separate arrays, so candidates are rejected without touching the agents.
+	LocalVector<const RVO3D::Agent3D *> agents;
+	LocalVector<float> positions_x;
+	LocalVector<float> positions_y;
+	LocalVector<float> positions_z;
+	LocalVector<uint32_t> avoidance_layers;
+	LocalVector<float> avoidance_priorities;
+
+	// Agents of the cells with hash `h` are `cell_agents[cell_start[h]]` to `cell_agents[cell_start[h + 1] - 1]`.
+	LocalVector<uint32_t> cell_start;
+	LocalVector<uint32_t> cell_agents;
+	LocalVector<uint32_t> agent_cells;
+	float cell_size = 1.0;
+	uint32_t cell_mask = 0;
+
+	_FORCE_INLINE_ int32_t _get_cell_coord(float p_value) const {
+		return int32_t(Math::floor(p_value / cell_size));
+	}
+
+	_FORCE_INLINE_ uint32_t _get_cell_hash(int32_t p_x, int32_t p_y, int32_t p_z) const {
+		return ((uint32_t(p_x) * 73856093u) ^ (uint32_t(p_y) * 19349663u) ^ (uint32_t(p_z) * 83492791u)) & cell_mask;
+	}
+
+public:
+	void build(const LocalVector<NavAgent *> &p_agents);
+	void clear();
+
+	// Same result as RVO3D::Agent3D::computeNeighbors(), from the positions the grid was built with.
+	void compute_neighbors(RVO3D::Agent3D *p_agent) const;
+};
+
+#endif // NAV_AVOIDANCE_GRID_3D_H
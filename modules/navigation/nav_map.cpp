@@ -99,7 +99,7 @@ void NavMap::set_link_connection_radius(real_t p_link_connection_radius) {
 		return;
 	}
 	link_connection_radius = p_link_connection_radius;
-	regenerate_links = true;
+	regenerate_link_polygons = true;
 }
 
 gd::PointKey NavMap::get_point_key(const Vector3 &p_pos) const {
@@ -115,7 +115,7 @@ gd::PointKey NavMap::get_point_key(const Vector3 &p_pos) const {
 	return p;
 }
 
-Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers, Vector<int32_t> *r_path_types, TypedArray<RID> *r_path_rids, Vector<int64_t> *r_path_owners) const {
+Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers, Vector<int32_t> *r_path_types, TypedArray<RID> *r_path_rids, Vector<int64_t> *r_path_owners, bool p_hierarchical) const {
 	ERR_FAIL_COND_V_MSG(map_update_id == 0, Vector<Vector3>(), "NavigationServer map query failed because it was made before first map synchronization.");
 	// Clear metadata outputs.
 	if (r_path_types) {
@@ -129,40 +129,10 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 	}
 
 	// Find the start poly and the end poly on this map.
-	const gd::Polygon *begin_poly = nullptr;
-	const gd::Polygon *end_poly = nullptr;
 	Vector3 begin_point;
 	Vector3 end_point;
-	real_t begin_d = FLT_MAX;
-	real_t end_d = FLT_MAX;
-	// Find the initial poly and the end poly on this map.
-	for (const gd::Polygon &p : polygons) {
-		// Only consider the polygon if it in a region with compatible layers.
-		if ((p_navigation_layers & p.owner->get_navigation_layers()) == 0) {
-			continue;
-		}
-
-		// For each face check the distance between the origin/destination
-		for (size_t point_id = 2; point_id < p.points.size(); point_id++) {
-			const Face3 face(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
-
-			Vector3 point = face.get_closest_point_to(p_origin);
-			real_t distance_to_point = point.distance_to(p_origin);
-			if (distance_to_point < begin_d) {
-				begin_d = distance_to_point;
-				begin_poly = &p;
-				begin_point = point;
-			}
-
-			point = face.get_closest_point_to(p_destination);
-			distance_to_point = point.distance_to(p_destination);
-			if (distance_to_point < end_d) {
-				end_d = distance_to_point;
-				end_poly = &p;
-				end_point = point;
-			}
-		}
-	}
+	const gd::Polygon *begin_poly = _get_closest_polygon(p_origin, p_navigation_layers, begin_point);
+	const gd::Polygon *end_poly = _get_closest_polygon(p_destination, p_navigation_layers, end_point);
 
 	// Check for trivial cases
 	if (!begin_poly || !end_poly) {
@@ -194,8 +164,12 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 		return path;
 	}
 
+	// When hierarchical, only search the regions and links along the coarse path between the two polygons.
+	HashSet<const NavBase *> corridor;
+	bool use_corridor = p_hierarchical && begin_poly->owner != end_poly->owner && _get_cluster_corridor(begin_poly->owner, end_poly->owner, p_navigation_layers, corridor);
+
 	// List of all reachable navigation polys.
-	LocalVector<gd::NavigationPoly> navigation_polys;
+	FrameLocalVector<gd::NavigationPoly> navigation_polys;
 	navigation_polys.reserve(polygons.size() * 0.75);
 
 	// Add the start polygon to the reachable navigation polygons.
@@ -206,8 +180,8 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 	begin_navigation_poly.back_navigation_edge_pathway_end = begin_point;
 	navigation_polys.push_back(begin_navigation_poly);
 
-	// List of polygon IDs to visit.
-	List<uint32_t> to_visit;
+	// List of polygon IDs to visit, kept in the frame arena of the calling thread like the polygons.
+	FrameLocalVector<uint32_t> to_visit;
 	to_visit.push_back(0);
 
 	// This is an implementation of the A* algorithm.
@@ -230,6 +204,9 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 				if ((p_navigation_layers & connection.polygon->owner->get_navigation_layers()) == 0) {
 					continue;
 				}
+				if (use_corridor && !corridor.has(connection.polygon->owner)) {
+					continue;
+				}
 
 				const gd::NavigationPoly &least_cost_poly = navigation_polys[least_cost_id];
 				real_t poly_enter_cost = 0.0;
@@ -276,10 +253,25 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 		}
 
 		// Removes the least cost polygon from the list of polygons to visit so we can advance.
-		to_visit.erase(least_cost_id);
+		to_visit.erase((uint32_t)least_cost_id);
 
 		// When the list of polygons to visit is empty at this point it means the End Polygon is not reachable
 		if (to_visit.size() == 0) {
+			if (use_corridor) {
+				// The regions of the corridor don't connect the two polygons, search the whole map instead.
+				use_corridor = false;
+				gd::NavigationPoly np = navigation_polys[0];
+				navigation_polys.clear();
+				navigation_polys.push_back(np);
+				to_visit.clear();
+				to_visit.push_back(0);
+				least_cost_id = 0;
+				prev_least_cost_id = -1;
+				reachable_end = nullptr;
+				reachable_d = FLT_MAX;
+				continue;
+			}
+
 			// Thus use the further reachable polygon
 			ERR_BREAK_MSG(is_reachable == false, "It's not expect to not find the most reachable polygons");
 			is_reachable = false;
@@ -290,7 +282,7 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 
 			// Set as end point the furthest reachable point.
 			end_poly = reachable_end;
-			end_d = FLT_MAX;
+			real_t end_d = FLT_MAX;
 			for (size_t point_id = 2; point_id < end_poly->points.size(); point_id++) {
 				Face3 f(end_poly->points[0].pos, end_poly->points[point_id - 1].pos, end_poly->points[point_id].pos);
 				Vector3 spoint = f.get_closest_point_to(p_destination);
@@ -358,8 +350,8 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 		// Find the polygon with the minimum cost from the list of polygons to visit.
 		least_cost_id = -1;
 		real_t least_cost = FLT_MAX;
-		for (List<uint32_t>::Element *element = to_visit.front(); element != nullptr; element = element->next()) {
-			gd::NavigationPoly *np = &navigation_polys[element->get()];
+		for (const uint32_t poly_id : to_visit) {
+			gd::NavigationPoly *np = &navigation_polys[poly_id];
 			real_t cost = np->traveled_distance;
 			cost += (np->entry.distance_to(end_point) * np->poly->owner->get_travel_cost());
 			if (cost < least_cost) {
@@ -389,7 +381,7 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 	// We did not find a route but we have both a start polygon and an end polygon at this point.
 	// Usually this happens because there was not a single external or internal connected edge, e.g. our start polygon is an isolated, single convex polygon.
 	if (!found_route) {
-		end_d = FLT_MAX;
+		real_t end_d = FLT_MAX;
 		// Search all faces of the start polygon for the closest point to our target position.
 		for (size_t point_id = 2; point_id < begin_poly->points.size(); point_id++) {
 			Face3 f(begin_poly->points[0].pos, begin_poly->points[point_id - 1].pos, begin_poly->points[point_id].pos);
@@ -577,49 +569,66 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 
 Vector3 NavMap::get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const {
 	ERR_FAIL_COND_V_MSG(map_update_id == 0, Vector3(), "NavigationServer map query failed because it was made before first map synchronization.");
-	bool use_collision = p_use_collision;
 	Vector3 closest_point;
-	real_t closest_point_d = FLT_MAX;
-
-	for (const gd::Polygon &p : polygons) {
-		// For each face check the distance to the segment
-		for (size_t point_id = 2; point_id < p.points.size(); point_id += 1) {
-			const Face3 f(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
-			Vector3 inters;
-			if (f.intersects_segment(p_from, p_to, &inters)) {
-				const real_t d = closest_point_d = p_from.distance_to(inters);
-				if (use_collision == false) {
-					closest_point = inters;
-					use_collision = true;
-					closest_point_d = d;
-				} else if (closest_point_d > d) {
-					closest_point = inters;
-					closest_point_d = d;
+	real_t closest_point_ds = FLT_MAX;
+	bool collided = false;
+
+	// Intersections with the segment come first, the one closest to its start wins.
+	polygon_tree.query(
+			closest_point_ds,
+			[&](const AABB &p_aabb) {
+				return p_aabb.intersects_segment(p_from, p_to) ? NavPolygonTree::distance_squared(p_aabb, p_from) : INFINITY;
+			},
+			[&](uint32_t p_index) {
+				const gd::Polygon &p = polygons[p_index];
+				for (size_t point_id = 2; point_id < p.points.size(); point_id += 1) {
+					const Face3 f(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
+					Vector3 inters;
+					if (f.intersects_segment(p_from, p_to, &inters)) {
+						const real_t ds = p_from.distance_squared_to(inters);
+						if (ds < closest_point_ds) {
+							closest_point = inters;
+							closest_point_ds = ds;
+							collided = true;
+						}
+					}
 				}
-			}
-		}
+				return closest_point_ds;
+			});
 
-		if (use_collision == false) {
-			for (size_t point_id = 0; point_id < p.points.size(); point_id += 1) {
-				Vector3 a, b;
-
-				Geometry3D::get_closest_points_between_segments(
-						p_from,
-						p_to,
-						p.points[point_id].pos,
-						p.points[(point_id + 1) % p.points.size()].pos,
-						a,
-						b);
-
-				const real_t d = a.distance_to(b);
-				if (d < closest_point_d) {
-					closest_point_d = d;
-					closest_point = b;
-				}
-			}
-		}
+	if (collided || p_use_collision) {
+		return closest_point;
 	}
 
+	// Otherwise the closest point of the polygon edges to the segment.
+	const AABB segment_aabb = AABB(p_from, Vector3()).expand(p_to);
+	polygon_tree.query(
+			closest_point_ds,
+			[&](const AABB &p_aabb) {
+				return NavPolygonTree::distance_squared(p_aabb, segment_aabb);
+			},
+			[&](uint32_t p_index) {
+				const gd::Polygon &p = polygons[p_index];
+				for (size_t point_id = 0; point_id < p.points.size(); point_id += 1) {
+					Vector3 a, b;
+
+					Geometry3D::get_closest_points_between_segments(
+							p_from,
+							p_to,
+							p.points[point_id].pos,
+							p.points[(point_id + 1) % p.points.size()].pos,
+							a,
+							b);
+
+					const real_t ds = a.distance_squared_to(b);
+					if (ds < closest_point_ds) {
+						closest_point_ds = ds;
+						closest_point = b;
+					}
+				}
+				return closest_point_ds;
+			});
+
 	return closest_point;
 }
 
@@ -641,28 +650,111 @@ RID NavMap::get_closest_point_owner(const Vector3 &p_point) const {
 	return cp.owner;
 }
 
+Vector<Vector3> NavMap::get_closest_points(const Vector<Vector3> &p_points) const {
+	ERR_FAIL_COND_V_MSG(map_update_id == 0, Vector<Vector3>(), "NavigationServer map query failed because it was made before first map synchronization.");
+	Vector<Vector3> closest_points;
+	closest_points.resize(p_points.size());
+	Vector3 *w = closest_points.ptrw();
+	for (int i = 0; i < p_points.size(); i++) {
+		w[i] = get_closest_point_info(p_points[i]).point;
+	}
+	return closest_points;
+}
+
 gd::ClosestPointQueryResult NavMap::get_closest_point_info(const Vector3 &p_point) const {
 	gd::ClosestPointQueryResult result;
 	real_t closest_point_ds = FLT_MAX;
-
-	for (const gd::Polygon &p : polygons) {
-		// For each face check the distance to the point
-		for (size_t point_id = 2; point_id < p.points.size(); point_id += 1) {
-			const Face3 f(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
-			const Vector3 inters = f.get_closest_point_to(p_point);
-			const real_t ds = inters.distance_squared_to(p_point);
-			if (ds < closest_point_ds) {
-				result.point = inters;
-				result.normal = f.get_plane().normal;
-				result.owner = p.owner->get_self();
-				closest_point_ds = ds;
-			}
-		}
-	}
+	uint32_t closest_index = UINT32_MAX;
+
+	polygon_tree.query(
+			closest_point_ds,
+			[&](const AABB &p_aabb) {
+				return NavPolygonTree::distance_squared(p_aabb, p_point);
+			},
+			[&](uint32_t p_index) {
+				const gd::Polygon &p = polygons[p_index];
+				// For each face check the distance to the point, ties go to the first polygon of the map.
+				for (size_t point_id = 2; point_id < p.points.size(); point_id += 1) {
+					const Face3 f(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
+					const Vector3 inters = f.get_closest_point_to(p_point);
+					const real_t ds = inters.distance_squared_to(p_point);
+					if (ds < closest_point_ds || (ds == closest_point_ds && p_index < closest_index)) {
+						result.point = inters;
+						result.normal = f.get_plane().normal;
+						result.owner = p.owner->get_self();
+						closest_point_ds = ds;
+						closest_index = p_index;
+					}
+				}
+				return closest_point_ds;
+			});
 
 	return result;
 }
 
+gd::Polygon *NavMap::_get_link_polygon(const Vector3 &p_point, Vector3 &r_closest_point) {
+	gd::Polygon *closest_polygon = nullptr;
+	// Only polygons within the search radius can be linked.
+	real_t closest_point_ds = link_connection_radius * link_connection_radius;
+	uint32_t closest_index = UINT32_MAX;
+
+	polygon_tree.query(
+			closest_point_ds,
+			[&](const AABB &p_aabb) {
+				return NavPolygonTree::distance_squared(p_aabb, p_point);
+			},
+			[&](uint32_t p_index) {
+				gd::Polygon &p = polygons[p_index];
+				for (uint32_t point_id = 2; point_id < p.points.size(); point_id += 1) {
+					const Face3 face(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
+					const Vector3 point = face.get_closest_point_to(p_point);
+					const real_t ds = point.distance_squared_to(p_point);
+					if (ds < closest_point_ds || (closest_polygon && ds == closest_point_ds && p_index < closest_index)) {
+						closest_point_ds = ds;
+						closest_index = p_index;
+						closest_polygon = &p;
+						r_closest_point = point;
+					}
+				}
+				return closest_point_ds;
+			});
+
+	return closest_polygon;
+}
+
+const gd::Polygon *NavMap::_get_closest_polygon(const Vector3 &p_point, uint32_t p_navigation_layers, Vector3 &r_closest_point) const {
+	const gd::Polygon *closest_polygon = nullptr;
+	real_t closest_point_ds = FLT_MAX;
+	uint32_t closest_index = UINT32_MAX;
+
+	polygon_tree.query(
+			closest_point_ds,
+			[&](const AABB &p_aabb) {
+				return NavPolygonTree::distance_squared(p_aabb, p_point);
+			},
+			[&](uint32_t p_index) {
+				const gd::Polygon &p = polygons[p_index];
+				// Only consider the polygon if it in a region with compatible layers.
+				if ((p_navigation_layers & p.owner->get_navigation_layers()) == 0) {
+					return closest_point_ds;
+				}
+				for (size_t point_id = 2; point_id < p.points.size(); point_id++) {
+					const Face3 face(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
+					const Vector3 point = face.get_closest_point_to(p_point);
+					const real_t ds = point.distance_squared_to(p_point);
+					if (ds < closest_point_ds || (ds == closest_point_ds && p_index < closest_index)) {
+						closest_point_ds = ds;
+						closest_index = p_index;
+						closest_polygon = &p;
+						r_closest_point = point;
+					}
+				}
+				return closest_point_ds;
+			});
+
+	return closest_polygon;
+}
+
 void NavMap::add_region(NavRegion *p_region) {
 	regions.push_back(p_region);
 	regenerate_links = true;
@@ -678,14 +770,14 @@ void NavMap::remove_region(NavRegion *p_region) {
 
 void NavMap::add_link(NavLink *p_link) {
 	links.push_back(p_link);
-	regenerate_links = true;
+	regenerate_link_polygons = true;
 }
 
 void NavMap::remove_link(NavLink *p_link) {
 	int64_t link_index = links.find(p_link);
 	if (link_index >= 0) {
 		links.remove_at_unordered(link_index);
-		regenerate_links = true;
+		regenerate_link_polygons = true;
 	}
 }
 
@@ -796,7 +888,7 @@ void NavMap::sync() {
 
 	for (NavLink *link : links) {
 		if (link->check_dirty()) {
-			regenerate_links = true;
+			regenerate_link_polygons = true;
 		}
 	}
 
@@ -837,6 +929,8 @@ void NavMap::sync() {
 
 		_new_pm_polygon_count = polygons.size();
 
+		polygon_tree.build(polygons);
+
 		// Group all edges per key.
 		HashMap<gd::EdgeKey, Vector<gd::Edge::Connection>, gd::EdgeKey> connections;
 		for (gd::Polygon &poly : polygons) {
@@ -864,7 +958,7 @@ void NavMap::sync() {
 			}
 		}
 
-		Vector<gd::Edge::Connection> free_edges;
+		LocalVector<gd::Edge::Connection> free_edges;
 		for (KeyValue<gd::EdgeKey, Vector<gd::Edge::Connection>> &E : connections) {
 			if (E.value.size() == 2) {
 				// Connect edge that are shared in different polygons.
@@ -891,16 +985,55 @@ void NavMap::sync() {
 		// connection, integration and path finding.
 		_new_pm_edge_free_count = free_edges.size();
 
-		for (int i = 0; i < free_edges.size(); i++) {
+		// Two edges can only connect if their bounds, grown by half the margin, overlap. Sweep the bounds
+		// sorted along the X axis to find those candidates instead of testing every pair.
+		LocalVector<AABB> free_edge_bounds;
+		LocalVector<uint32_t> free_edge_order;
+		free_edge_bounds.resize(free_edges.size());
+		free_edge_order.resize(free_edges.size());
+		for (uint32_t i = 0; i < free_edges.size(); i++) {
+			const gd::Edge::Connection &free_edge = free_edges[i];
+			AABB bounds(free_edge.polygon->points[free_edge.edge].pos, Vector3());
+			bounds.expand_to(free_edge.polygon->points[(free_edge.edge + 1) % free_edge.polygon->points.size()].pos);
+			free_edge_bounds[i] = bounds.grow(edge_connection_margin * 0.5);
+			free_edge_order[i] = i;
+		}
+		struct FreeEdgeSort {
+			const AABB *bounds = nullptr;
+			bool operator()(uint32_t p_a, uint32_t p_b) const {
+				return bounds[p_a].position.x < bounds[p_b].position.x;
+			}
+		};
+		SortArray<uint32_t, FreeEdgeSort> free_edge_sort;
+		free_edge_sort.compare.bounds = free_edge_bounds.ptr();
+		free_edge_sort.sort(free_edge_order.ptr(), free_edge_order.size());
+
+		LocalVector<LocalVector<uint32_t>> free_edge_candidates;
+		free_edge_candidates.resize(free_edges.size());
+		for (uint32_t a = 0; a < free_edge_order.size(); a++) {
+			const uint32_t i = free_edge_order[a];
+			const real_t max_x = free_edge_bounds[i].position.x + free_edge_bounds[i].size.x;
+			for (uint32_t b = a + 1; b < free_edge_order.size(); b++) {
+				const uint32_t j = free_edge_order[b];
+				if (free_edge_bounds[j].position.x > max_x) {
+					break;
+				}
+				if (free_edges[i].polygon->owner != free_edges[j].polygon->owner && free_edge_bounds[i].intersects_inclusive(free_edge_bounds[j])) {
+					free_edge_candidates[i].push_back(j);
+					free_edge_candidates[j].push_back(i);
+				}
+			}
+		}
+
+		for (uint32_t i = 0; i < free_edges.size(); i++) {
 			const gd::Edge::Connection &free_edge = free_edges[i];
 			Vector3 edge_p1 = free_edge.polygon->points[free_edge.edge].pos;
 			Vector3 edge_p2 = free_edge.polygon->points[(free_edge.edge + 1) % free_edge.polygon->points.size()].pos;
 
-			for (int j = 0; j < free_edges.size(); j++) {
+			// Keep the connection order of a full pairwise test.
+			free_edge_candidates[i].sort();
+			for (const uint32_t j : free_edge_candidates[i]) {
 				const gd::Edge::Connection &other_edge = free_edges[j];
-				if (i == j || free_edge.polygon->owner == other_edge.polygon->owner) {
-					continue;
-				}
 
 				Vector3 other_edge_p1 = other_edge.polygon->points[other_edge.edge].pos;
 				Vector3 other_edge_p2 = other_edge.polygon->points[(other_edge.edge + 1) % other_edge.polygon->points.size()].pos;
@@ -948,6 +1081,25 @@ void NavMap::sync() {
 			}
 		}
 
+		// The polygons that held link connections were replaced.
+		link_entry_polygons.clear();
+		regenerate_link_polygons = true;
+	}
+
+	if (regenerate_link_polygons) {
+		// Disconnect the previous link polygons from the map polygons that were kept.
+		const gd::Polygon *link_polygons_begin = link_polygons.ptr();
+		const gd::Polygon *link_polygons_end = link_polygons_begin + link_polygons.size();
+		for (gd::Polygon *poly : link_entry_polygons) {
+			Vector<gd::Edge::Connection> &connections = poly->edges[0].connections;
+			for (int64_t i = int64_t(connections.size()) - 1; i >= 0; i--) {
+				if (connections[i].polygon >= link_polygons_begin && connections[i].polygon < link_polygons_end) {
+					connections.remove_at(i);
+				}
+			}
+		}
+		link_entry_polygons.clear();
+
 		uint32_t link_poly_idx = 0;
 		link_polygons.resize(links.size());
 
@@ -956,49 +1108,11 @@ void NavMap::sync() {
 			const Vector3 start = link->get_start_position();
 			const Vector3 end = link->get_end_position();
 
-			gd::Polygon *closest_start_polygon = nullptr;
-			real_t closest_start_distance = link_connection_radius;
 			Vector3 closest_start_point;
+			gd::Polygon *closest_start_polygon = _get_link_polygon(start, closest_start_point);
 
-			gd::Polygon *closest_end_polygon = nullptr;
-			real_t closest_end_distance = link_connection_radius;
 			Vector3 closest_end_point;
-
-			// Create link to any polygons within the search radius of the start point.
-			for (uint32_t start_index = 0; start_index < polygons.size(); start_index++) {
-				gd::Polygon &start_poly = polygons[start_index];
-
-				// For each face check the distance to the start
-				for (uint32_t start_point_id = 2; start_point_id < start_poly.points.size(); start_point_id += 1) {
-					const Face3 start_face(start_poly.points[0].pos, start_poly.points[start_point_id - 1].pos, start_poly.points[start_point_id].pos);
-					const Vector3 start_point = start_face.get_closest_point_to(start);
-					const real_t start_distance = start_point.distance_to(start);
-
-					// Pick the polygon that is within our radius and is closer than anything we've seen yet.
-					if (start_distance <= link_connection_radius && start_distance < closest_start_distance) {
-						closest_start_distance = start_distance;
-						closest_start_point = start_point;
-						closest_start_polygon = &start_poly;
-					}
-				}
-			}
-
-			// Find any polygons within the search radius of the end point.
-			for (gd::Polygon &end_poly : polygons) {
-				// For each face check the distance to the end
-				for (uint32_t end_point_id = 2; end_point_id < end_poly.points.size(); end_point_id += 1) {
-					const Face3 end_face(end_poly.points[0].pos, end_poly.points[end_point_id - 1].pos, end_poly.points[end_point_id].pos);
-					const Vector3 end_point = end_face.get_closest_point_to(end);
-					const real_t end_distance = end_point.distance_to(end);
-
-					// Pick the polygon that is within our radius and is closer than anything we've seen yet.
-					if (end_distance <= link_connection_radius && end_distance < closest_end_distance) {
-						closest_end_distance = end_distance;
-						closest_end_point = end_point;
-						closest_end_polygon = &end_poly;
-					}
-				}
-			}
+			gd::Polygon *closest_end_polygon = _get_link_polygon(end, closest_end_point);
 
 			// If we have both a start and end point, then create a synthetic polygon to route through.
 			if (closest_start_polygon && closest_end_polygon) {
@@ -1031,6 +1145,7 @@ void NavMap::sync() {
 					entry_connection.pathway_start = new_polygon.points[0].pos;
 					entry_connection.pathway_end = new_polygon.points[1].pos;
 					closest_start_polygon->edges[0].connections.push_back(entry_connection);
+					link_entry_polygons.push_back(closest_start_polygon);
 
 					gd::Edge::Connection exit_connection;
 					exit_connection.polygon = closest_end_polygon;
@@ -1048,6 +1163,7 @@ void NavMap::sync() {
 					entry_connection.pathway_start = new_polygon.points[2].pos;
 					entry_connection.pathway_end = new_polygon.points[3].pos;
 					closest_end_polygon->edges[0].connections.push_back(entry_connection);
+					link_entry_polygons.push_back(closest_end_polygon);
 
 					gd::Edge::Connection exit_connection;
 					exit_connection.polygon = closest_start_polygon;
@@ -1059,6 +1175,11 @@ void NavMap::sync() {
 			}
 		}
 
+		// Drop the link polygons of links that did not connect, their owner may be gone.
+		link_polygons.resize(link_poly_idx);
+
+		_build_clusters();
+
 		// Update the update ID.
 		// Some code treats 0 as a failure case, so we avoid returning 0.
 		map_update_id = map_update_id % 9999999 + 1;
@@ -1084,6 +1205,7 @@ void NavMap::sync() {
 
 	regenerate_polygons = false;
 	regenerate_links = false;
+	regenerate_link_polygons = false;
 	obstacles_dirty = false;
 	agents_dirty = false;
 
@@ -1098,6 +1220,124 @@ void NavMap::sync() {
 	pm_edge_free_count = _new_pm_edge_free_count;
 }
 
+void NavMap::_build_clusters() {
+	clusters.clear();
+	cluster_ids.clear();
+
+	// One cluster per polygon owner, centered on the average of its polygon centers.
+	LocalVector<uint32_t> polygon_counts;
+	const LocalVector<gd::Polygon> *sources[2] = { &polygons, &link_polygons };
+	for (const LocalVector<gd::Polygon> *source : sources) {
+		for (const gd::Polygon &poly : *source) {
+			uint32_t id;
+			HashMap<const NavBase *, uint32_t>::Iterator E = cluster_ids.find(poly.owner);
+			if (E) {
+				id = E->value;
+			} else {
+				id = clusters.size();
+				cluster_ids.insert(poly.owner, id);
+				clusters.push_back(Cluster());
+				clusters[id].owner = poly.owner;
+				polygon_counts.push_back(0);
+			}
+			clusters[id].center += poly.center;
+			polygon_counts[id]++;
+		}
+	}
+	for (uint32_t i = 0; i < clusters.size(); i++) {
+		clusters[i].center /= real_t(polygon_counts[i]);
+	}
+
+	// Clusters are neighbors when a connection leaves one polygon for a polygon of another owner.
+	for (const LocalVector<gd::Polygon> *source : sources) {
+		for (const gd::Polygon &poly : *source) {
+			Cluster &cluster = clusters[cluster_ids[poly.owner]];
+			for (const gd::Edge &edge : poly.edges) {
+				for (const gd::Edge::Connection &connection : edge.connections) {
+					if (connection.polygon->owner == poly.owner) {
+						continue;
+					}
+					HashMap<const NavBase *, uint32_t>::Iterator E = cluster_ids.find(connection.polygon->owner);
+					if (E && cluster.neighbors.find(E->value) == -1) {
+						cluster.neighbors.push_back(E->value);
+					}
+				}
+			}
+		}
+	}
+}
+
+bool NavMap::_get_cluster_corridor(const NavBase *p_begin, const NavBase *p_end, uint32_t p_navigation_layers, HashSet<const NavBase *> &r_corridor) const {
+	HashMap<const NavBase *, uint32_t>::ConstIterator begin = cluster_ids.find(p_begin);
+	HashMap<const NavBase *, uint32_t>::ConstIterator end = cluster_ids.find(p_end);
+	if (!begin || !end) {
+		return false;
+	}
+	const uint32_t begin_id = begin->value;
+	const uint32_t end_id = end->value;
+	const Vector3 end_center = clusters[end_id].center;
+
+	struct SearchEntry {
+		uint32_t id = 0;
+		real_t cost = 0.0;
+	};
+	struct SortSearchEntries {
+		_FORCE_INLINE_ bool operator()(const SearchEntry &p_a, const SearchEntry &p_b) const {
+			return p_a.cost > p_b.cost; // Lowest cost first.
+		}
+	};
+	SortArray<SearchEntry, SortSearchEntries> sorter;
+
+	// A* over the clusters, with the distance between cluster centers as cost.
+	FrameLocalVector<real_t> traveled;
+	FrameLocalVector<int64_t> parents;
+	FrameLocalVector<SearchEntry> open;
+	traveled.resize(clusters.size());
+	parents.resize(clusters.size());
+	for (uint32_t i = 0; i < clusters.size(); i++) {
+		traveled[i] = FLT_MAX;
+		parents[i] = -1;
+	}
+
+	traveled[begin_id] = 0.0;
+	open.push_back({ begin_id, clusters[begin_id].center.distance_to(end_center) });
+	bool found = false;
+	while (!open.is_empty()) {
+		const SearchEntry current = open[0];
+		sorter.pop_heap(0, open.size(), open.ptr());
+		open.remove_at(open.size() - 1);
+
+		if (current.id == end_id) {
+			found = true;
+			break;
+		}
+
+		const Cluster &cluster = clusters[current.id];
+		for (const uint32_t neighbor_id : cluster.neighbors) {
+			const Cluster &neighbor = clusters[neighbor_id];
+			if ((p_navigation_layers & neighbor.owner->get_navigation_layers()) == 0) {
+				continue;
+			}
+			const real_t cost = traveled[current.id] + cluster.center.distance_to(neighbor.center) * cluster.owner->get_travel_cost();
+			if (cost >= traveled[neighbor_id]) {
+				continue;
+			}
+			traveled[neighbor_id] = cost;
+			parents[neighbor_id] = current.id;
+			open.push_back({ neighbor_id, cost + neighbor.center.distance_to(end_center) });
+			sorter.push_heap(0, open.size() - 1, 0, open[open.size() - 1], open.ptr());
+		}
+	}
+
+	if (!found) {
+		return false;
+	}
+	for (int64_t id = end_id; id != -1; id = parents[id]) {
+		r_corridor.insert(clusters[id].owner);
+	}
+	return true;
+}
+
 void NavMap::_update_rvo_obstacles_tree_2d() {
 	int obstacle_vertex_count = 0;
 	for (NavObstacle *obstacle : obstacles) {
@@ -1171,23 +1411,12 @@ void NavMap::_update_rvo_agents_tree_2d() {
 	rvo_simulation_2d.kdTree_->buildAgentTree(raw_agents);
 }
 
-void NavMap::_update_rvo_agents_tree_3d() {
-	// Cannot use LocalVector here as RVO library expects std::vector to build KdTree.
-	std::vector<RVO3D::Agent3D *> raw_agents;
-	raw_agents.reserve(active_3d_avoidance_agents.size());
-	for (NavAgent *agent : active_3d_avoidance_agents) {
-		raw_agents.push_back(agent->get_rvo_agent_3d());
-	}
-	rvo_simulation_3d.kdTree_->buildAgentTree(raw_agents);
-}
-
 void NavMap::_update_rvo_simulation() {
 	if (obstacles_dirty) {
 		_update_rvo_obstacles_tree_2d();
 	}
 	if (agents_dirty) {
 		_update_rvo_agents_tree_2d();
-		_update_rvo_agents_tree_3d();
 	}
 }
 
@@ -1199,12 +1428,24 @@ void NavMap::compute_single_avoidance_step_2d(uint32_t index, NavAgent **agent)
 }
 
 void NavMap::compute_single_avoidance_step_3d(uint32_t index, NavAgent **agent) {
-	(*(agent + index))->get_rvo_agent_3d()->computeNeighbors(&rvo_simulation_3d);
+	avoidance_grid_3d.compute_neighbors((*(agent + index))->get_rvo_agent_3d());
 	(*(agent + index))->get_rvo_agent_3d()->computeNewVelocity(&rvo_simulation_3d);
 	(*(agent + index))->get_rvo_agent_3d()->update(&rvo_simulation_3d);
 	(*(agent + index))->update();
 }
 
+void NavMap::compute_avoidance_steps_2d(uint32_t p_from, uint32_t p_to, NavAgent **p_agents) {
+	for (uint32_t index = p_from; index < p_to; index++) {
+		compute_single_avoidance_step_2d(index, p_agents);
+	}
+}
+
+void NavMap::compute_avoidance_steps_3d(uint32_t p_from, uint32_t p_to, NavAgent **p_agents) {
+	for (uint32_t index = p_from; index < p_to; index++) {
+		compute_single_avoidance_step_3d(index, p_agents);
+	}
+}
+
 void NavMap::step(real_t p_deltatime) {
 	deltatime = p_deltatime;
 
@@ -1213,7 +1454,7 @@ void NavMap::step(real_t p_deltatime) {
 
 	if (active_2d_avoidance_agents.size() > 0) {
 		if (use_threads && avoidance_use_multiple_threads) {
-			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap::compute_single_avoidance_step_2d, active_2d_avoidance_agents.ptr(), active_2d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents2D"));
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_range_group_task(this, &NavMap::compute_avoidance_steps_2d, active_2d_avoidance_agents.ptr(), active_2d_avoidance_agents.size(), 8, -1, true, SNAME("RVOAvoidanceAgents2D"));
 			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 		} else {
 			for (NavAgent *agent : active_2d_avoidance_agents) {
@@ -1226,12 +1467,15 @@ void NavMap::step(real_t p_deltatime) {
 	}
 
 	if (active_3d_avoidance_agents.size() > 0) {
+		// Agents moved during the last step, the grid is cheap enough to rebuild every step.
+		avoidance_grid_3d.build(active_3d_avoidance_agents);
+
 		if (use_threads && avoidance_use_multiple_threads) {
-			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap::compute_single_avoidance_step_3d, active_3d_avoidance_agents.ptr(), active_3d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents3D"));
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_range_group_task(this, &NavMap::compute_avoidance_steps_3d, active_3d_avoidance_agents.ptr(), active_3d_avoidance_agents.size(), 8, -1, true, SNAME("RVOAvoidanceAgents3D"));
 			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 		} else {
 			for (NavAgent *agent : active_3d_avoidance_agents) {
-				agent->get_rvo_agent_3d()->computeNeighbors(&rvo_simulation_3d);
+				avoidance_grid_3d.compute_neighbors(agent->get_rvo_agent_3d());
 				agent->get_rvo_agent_3d()->computeNewVelocity(&rvo_simulation_3d);
 				agent->get_rvo_agent_3d()->update(&rvo_simulation_3d);
 				agent->update();
@@ -1250,7 +1494,7 @@ void NavMap::dispatch_callbacks() {
 	}
 }
 
-void NavMap::clip_path(const LocalVector<gd::NavigationPoly> &p_navigation_polys, Vector<Vector3> &path, const gd::NavigationPoly *from_poly, const Vector3 &p_to_point, const gd::NavigationPoly *p_to_poly, Vector<int32_t> *r_path_types, TypedArray<RID> *r_path_rids, Vector<int64_t> *r_path_owners) const {
+void NavMap::clip_path(const FrameLocalVector<gd::NavigationPoly> &p_navigation_polys, Vector<Vector3> &path, const gd::NavigationPoly *from_poly, const Vector3 &p_to_point, const gd::NavigationPoly *p_to_poly, Vector<int32_t> *r_path_types, TypedArray<RID> *r_path_rids, Vector<int64_t> *r_path_owners) const {
 	Vector3 from = path[path.size() - 1];
 
 	if (from.is_equal_approx(p_to_point)) {
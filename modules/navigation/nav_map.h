@@ -31,11 +31,14 @@
 #ifndef NAV_MAP_H
 #define NAV_MAP_H
 
+#include "nav_avoidance_grid_3d.h"
+#include "nav_polygon_tree.h"
 #include "nav_rid.h"
 #include "nav_utils.h"
 
 #include "core/math/math_defs.h"
 #include "core/object/worker_thread_pool.h"
+#include "core/templates/hash_set.h"
 
 #include <KdTree2d.h>
 #include <KdTree3d.h>
@@ -65,6 +68,8 @@ class NavMap : public NavRid {
 
 	bool regenerate_polygons = true;
 	bool regenerate_links = true;
+	/// Only the navigation links need to be connected again, the region polygons are unchanged.
+	bool regenerate_link_polygons = true;
 
 	/// Map regions
 	LocalVector<NavRegion *> regions;
@@ -72,13 +77,26 @@ class NavMap : public NavRid {
 	/// Map links
 	LocalVector<NavLink *> links;
 	LocalVector<gd::Polygon> link_polygons;
+	/// Map polygons holding a connection into a link polygon.
+	LocalVector<gd::Polygon *> link_entry_polygons;
 
 	/// Map polygons
 	LocalVector<gd::Polygon> polygons;
+	NavPolygonTree polygon_tree;
+
+	/// Coarse graph of the map with one cluster per region or link, used by hierarchical path queries.
+	struct Cluster {
+		const NavBase *owner = nullptr;
+		Vector3 center;
+		LocalVector<uint32_t> neighbors;
+	};
+	LocalVector<Cluster> clusters;
+	HashMap<const NavBase *, uint32_t> cluster_ids;
 
 	/// RVO avoidance worlds
 	RVO2D::RVOSimulator2D rvo_simulation_2d;
 	RVO3D::RVOSimulator3D rvo_simulation_3d;
+	NavAvoidanceGrid3D avoidance_grid_3d;
 
 	/// avoidance controlled agents
 	LocalVector<NavAgent *> active_2d_avoidance_agents;
@@ -150,12 +168,13 @@ public:
 
 	gd::PointKey get_point_key(const Vector3 &p_pos) const;
 
-	Vector<Vector3> get_path(Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers, Vector<int32_t> *r_path_types, TypedArray<RID> *r_path_rids, Vector<int64_t> *r_path_owners) const;
+	Vector<Vector3> get_path(Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers, Vector<int32_t> *r_path_types, TypedArray<RID> *r_path_rids, Vector<int64_t> *r_path_owners, bool p_hierarchical = false) const;
 	Vector3 get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const;
 	Vector3 get_closest_point(const Vector3 &p_point) const;
 	Vector3 get_closest_point_normal(const Vector3 &p_point) const;
 	gd::ClosestPointQueryResult get_closest_point_info(const Vector3 &p_point) const;
 	RID get_closest_point_owner(const Vector3 &p_point) const;
+	Vector<Vector3> get_closest_points(const Vector<Vector3> &p_points) const;
 
 	void add_region(NavRegion *p_region);
 	void remove_region(NavRegion *p_region);
@@ -209,12 +228,20 @@ private:
 
 	void compute_single_avoidance_step_2d(uint32_t index, NavAgent **agent);
 	void compute_single_avoidance_step_3d(uint32_t index, NavAgent **agent);
+	void compute_avoidance_steps_2d(uint32_t p_from, uint32_t p_to, NavAgent **p_agents);
+	void compute_avoidance_steps_3d(uint32_t p_from, uint32_t p_to, NavAgent **p_agents);
+
+	const gd::Polygon *_get_closest_polygon(const Vector3 &p_point, uint32_t p_navigation_layers, Vector3 &r_closest_point) const;
+
+	gd::Polygon *_get_link_polygon(const Vector3 &p_point, Vector3 &r_closest_point);
+
+	void _build_clusters();
+	bool _get_cluster_corridor(const NavBase *p_begin, const NavBase *p_end, uint32_t p_navigation_layers, HashSet<const NavBase *> &r_corridor) const;
 
-	void clip_path(const LocalVector<gd::NavigationPoly> &p_navigation_polys, Vector<Vector3> &path, const gd::NavigationPoly *from_poly, const Vector3 &p_to_point, const gd::NavigationPoly *p_to_poly, Vector<int32_t> *r_path_types, TypedArray<RID> *r_path_rids, Vector<int64_t> *r_path_owners) const;
+	void clip_path(const FrameLocalVector<gd::NavigationPoly> &p_navigation_polys, Vector<Vector3> &path, const gd::NavigationPoly *from_poly, const Vector3 &p_to_point, const gd::NavigationPoly *p_to_poly, Vector<int32_t> *r_path_types, TypedArray<RID> *r_path_rids, Vector<int64_t> *r_path_owners) const;
 	void _update_rvo_simulation();
 	void _update_rvo_obstacles_tree_2d();
 	void _update_rvo_agents_tree_2d();
-	void _update_rvo_agents_tree_3d();
 };
 
 #endif // NAV_MAP_H
@@ -228,6 +228,90 @@ void NavMeshGenerator3D::bake_from_source_geometry_data_async(Ref<NavigationMesh
 	generator_task_mutex.unlock();
 }
 
+Dictionary NavMeshGenerator3D::bake_tiles_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, real_t p_tile_size, const AABB &p_changed_aabb) {
+	ERR_FAIL_COND_V(!p_navigation_mesh.is_valid(), Dictionary());
+	ERR_FAIL_COND_V(!p_source_geometry_data.is_valid(), Dictionary());
+	ERR_FAIL_COND_V_MSG(p_tile_size <= 0.0, Dictionary(), "Tile size needs to be greater than zero.");
+
+	Dictionary tiles;
+
+	const Vector<float> &vertices = p_source_geometry_data->get_vertices();
+	if (vertices.size() < 3) {
+		return tiles;
+	}
+
+	// Bounds of the whole bake, only the XZ plane is split in tiles.
+	AABB bake_bounds;
+	AABB baking_aabb = p_navigation_mesh->get_filter_baking_aabb();
+	if (baking_aabb.has_volume()) {
+		bake_bounds = AABB(baking_aabb.position + p_navigation_mesh->get_filter_baking_aabb_offset(), baking_aabb.size);
+	} else {
+		const float *v = vertices.ptr();
+		bake_bounds = AABB(Vector3(v[0], v[1], v[2]), Vector3());
+		for (int i = 3; i < vertices.size(); i += 3) {
+			bake_bounds.expand_to(Vector3(v[i], v[i + 1], v[i + 2]));
+		}
+	}
+
+	// Only tiles touching the changed area are baked again.
+	Vector2 from = Vector2(bake_bounds.position.x, bake_bounds.position.z);
+	Vector2 to = Vector2(bake_bounds.position.x + bake_bounds.size.x, bake_bounds.position.z + bake_bounds.size.z);
+	if (p_changed_aabb.has_volume()) {
+		from = from.max(Vector2(p_changed_aabb.position.x, p_changed_aabb.position.z));
+		to = to.min(Vector2(p_changed_aabb.position.x + p_changed_aabb.size.x, p_changed_aabb.position.z + p_changed_aabb.size.z));
+		if (from.x > to.x || from.y > to.y) {
+			return tiles;
+		}
+	}
+
+	// Tiles are aligned to the world and to the voxel grid, so their borders match between bakes.
+	const real_t cell_size = p_navigation_mesh->get_cell_size();
+	const real_t tile_size = MAX(1.0, Math::round(p_tile_size / cell_size)) * cell_size;
+	const Vector2i tile_from = Vector2i(Math::floor(from.x / tile_size), Math::floor(from.y / tile_size));
+	const Vector2i tile_to = Vector2i(Math::floor(to.x / tile_size), Math::floor(to.y / tile_size));
+
+	NavMeshGeneratorTileTask3D tile_task;
+	tile_task.source_geometry_data = p_source_geometry_data;
+	LocalVector<Vector2i> tile_coords;
+	for (int z = tile_from.y; z <= tile_to.y; z++) {
+		for (int x = tile_from.x; x <= tile_to.x; x++) {
+			Ref<NavigationMesh> tile_mesh = p_navigation_mesh->duplicate();
+			tile_mesh->clear();
+			tile_task.navigation_meshes.push_back(tile_mesh);
+			Vector2 tile_min = Vector2(x, z) * tile_size;
+			Vector2 tile_max = tile_min + Vector2(tile_size, tile_size);
+			if (baking_aabb.has_volume()) {
+				// Clip the outer tiles to the baking filter.
+				tile_min = tile_min.max(Vector2(bake_bounds.position.x, bake_bounds.position.z));
+				tile_max = tile_max.min(Vector2(bake_bounds.position.x + bake_bounds.size.x, bake_bounds.position.z + bake_bounds.size.z));
+			}
+			tile_task.tile_bounds.push_back(AABB(Vector3(tile_min.x, 0.0, tile_min.y), Vector3(tile_max.x - tile_min.x, 0.0, tile_max.y - tile_min.y)));
+			tile_coords.push_back(Vector2i(x, z));
+		}
+	}
+
+	if (use_threads && tile_coords.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&NavMeshGenerator3D::generator_thread_bake_tile, &tile_task, tile_coords.size(), -1, NavMeshGenerator3D::baking_use_high_priority_threads, SNAME("NavMeshGeneratorBakeTiles3D"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < tile_coords.size(); i++) {
+			generator_thread_bake_tile(&tile_task, i);
+		}
+	}
+
+	for (uint32_t i = 0; i < tile_coords.size(); i++) {
+		tiles[tile_coords[i]] = tile_task.navigation_meshes[i];
+	}
+	return tiles;
+}
+
+void NavMeshGenerator3D::generator_thread_bake_tile(void *p_arg, uint32_t p_index) {
+	NavMeshGeneratorTileTask3D *tile_task = static_cast<NavMeshGeneratorTileTask3D *>(p_arg);
+
+	// The settings are the same for all tiles, warn about them only once.
+	generator_bake_from_source_geometry_data(tile_task->navigation_meshes[p_index], tile_task->source_geometry_data, tile_task->tile_bounds[p_index], p_index == 0);
+}
+
 void NavMeshGenerator3D::generator_thread_bake(void *p_arg) {
 	NavMeshGeneratorTask3D *generator_task = static_cast<NavMeshGeneratorTask3D *>(p_arg);
 
@@ -608,7 +692,7 @@ void NavMeshGenerator3D::generator_parse_source_geometry_data(const Ref<Navigati
 	}
 };
 
-void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data) {
+void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const AABB &p_tile_bounds, bool p_print_warnings) {
 	if (p_navigation_mesh.is_null() || p_source_geometry_data.is_null()) {
 		return;
 	}
@@ -635,7 +719,7 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 	const float *verts = vertices.ptr();
 	const int nverts = vertices.size() / 3;
 	const int *tris = indices.ptr();
-	const int ntris = indices.size() / 3;
+	int ntris = indices.size() / 3;
 
 	float bmin[3], bmax[3];
 	rcCalcBounds(verts, nverts, bmin, bmax);
@@ -657,29 +741,31 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 	cfg.detailSampleDist = MAX(p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance(), 0.1f);
 	cfg.detailSampleMaxError = p_navigation_mesh->get_cell_height() * p_navigation_mesh->get_detail_sample_max_error();
 
-	if (!Math::is_equal_approx((float)cfg.walkableHeight * cfg.ch, p_navigation_mesh->get_agent_height())) {
-		WARN_PRINT("Property agent_height is ceiled to cell_height voxel units and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.walkableClimb * cfg.ch, p_navigation_mesh->get_agent_max_climb())) {
-		WARN_PRINT("Property agent_max_climb is floored to cell_height voxel units and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.walkableRadius * cfg.cs, p_navigation_mesh->get_agent_radius())) {
-		WARN_PRINT("Property agent_radius is ceiled to cell_size voxel units and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.maxEdgeLen * cfg.cs, p_navigation_mesh->get_edge_max_length())) {
-		WARN_PRINT("Property edge_max_length is rounded to cell_size voxel units and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.minRegionArea, p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size())) {
-		WARN_PRINT("Property region_min_size is converted to int and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.mergeRegionArea, p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size())) {
-		WARN_PRINT("Property region_merge_size is converted to int and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.maxVertsPerPoly, p_navigation_mesh->get_vertices_per_polygon())) {
-		WARN_PRINT("Property vertices_per_polygon is converted to int and loses precision.");
-	}
-	if (p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance() < 0.1f) {
-		WARN_PRINT("Property detail_sample_distance is clamped to 0.1 world units as the resulting value from multiplying with cell_size is too low.");
+	if (p_print_warnings) {
+		if (!Math::is_equal_approx((float)cfg.walkableHeight * cfg.ch, p_navigation_mesh->get_agent_height())) {
+			WARN_PRINT("Property agent_height is ceiled to cell_height voxel units and loses precision.");
+		}
+		if (!Math::is_equal_approx((float)cfg.walkableClimb * cfg.ch, p_navigation_mesh->get_agent_max_climb())) {
+			WARN_PRINT("Property agent_max_climb is floored to cell_height voxel units and loses precision.");
+		}
+		if (!Math::is_equal_approx((float)cfg.walkableRadius * cfg.cs, p_navigation_mesh->get_agent_radius())) {
+			WARN_PRINT("Property agent_radius is ceiled to cell_size voxel units and loses precision.");
+		}
+		if (!Math::is_equal_approx((float)cfg.maxEdgeLen * cfg.cs, p_navigation_mesh->get_edge_max_length())) {
+			WARN_PRINT("Property edge_max_length is rounded to cell_size voxel units and loses precision.");
+		}
+		if (!Math::is_equal_approx((float)cfg.minRegionArea, p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size())) {
+			WARN_PRINT("Property region_min_size is converted to int and loses precision.");
+		}
+		if (!Math::is_equal_approx((float)cfg.mergeRegionArea, p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size())) {
+			WARN_PRINT("Property region_merge_size is converted to int and loses precision.");
+		}
+		if (!Math::is_equal_approx((float)cfg.maxVertsPerPoly, p_navigation_mesh->get_vertices_per_polygon())) {
+			WARN_PRINT("Property vertices_per_polygon is converted to int and loses precision.");
+		}
+		if (p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance() < 0.1f) {
+			WARN_PRINT("Property detail_sample_distance is clamped to 0.1 world units as the resulting value from multiplying with cell_size is too low.");
+		}
 	}
 
 	cfg.bmin[0] = bmin[0];
@@ -700,6 +786,36 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 		cfg.bmax[2] = cfg.bmin[2] + baking_aabb.size[2];
 	}
 
+	// Tiles also voxelize a border around their bounds that is left out of the regions,
+	// so the polygons end on the tile edges and connect to the neighbor tiles.
+	Vector<int> tile_indices;
+	if (p_tile_bounds.size.x > 0.0 && p_tile_bounds.size.z > 0.0) {
+		cfg.borderSize = cfg.walkableRadius + 3;
+		cfg.bmin[0] = p_tile_bounds.position.x - cfg.borderSize * cfg.cs;
+		cfg.bmin[2] = p_tile_bounds.position.z - cfg.borderSize * cfg.cs;
+		cfg.bmax[0] = p_tile_bounds.position.x + p_tile_bounds.size.x + cfg.borderSize * cfg.cs;
+		cfg.bmax[2] = p_tile_bounds.position.z + p_tile_bounds.size.z + cfg.borderSize * cfg.cs;
+
+		for (int i = 0; i < ntris; i++) {
+			const float *a = &verts[tris[i * 3 + 0] * 3];
+			const float *b = &verts[tris[i * 3 + 1] * 3];
+			const float *c = &verts[tris[i * 3 + 2] * 3];
+			if (MAX(a[0], MAX(b[0], c[0])) < cfg.bmin[0] || MIN(a[0], MIN(b[0], c[0])) > cfg.bmax[0] ||
+					MAX(a[2], MAX(b[2], c[2])) < cfg.bmin[2] || MIN(a[2], MIN(b[2], c[2])) > cfg.bmax[2]) {
+				continue;
+			}
+			tile_indices.push_back(tris[i * 3 + 0]);
+			tile_indices.push_back(tris[i * 3 + 1]);
+			tile_indices.push_back(tris[i * 3 + 2]);
+		}
+		if (tile_indices.is_empty()) {
+			p_navigation_mesh->clear();
+			return;
+		}
+		tris = tile_indices.ptr();
+		ntris = tile_indices.size() / 3;
+	}
+
 	bake_state = "Calculating grid size..."; // step #2
 	rcCalcGridSize(cfg.bmin, cfg.bmax, cfg.cs, &cfg.width, &cfg.height);
 
@@ -758,11 +874,11 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 
 	if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_WATERSHED) {
 		ERR_FAIL_COND(!rcBuildDistanceField(&ctx, *chf));
-		ERR_FAIL_COND(!rcBuildRegions(&ctx, *chf, 0, cfg.minRegionArea, cfg.mergeRegionArea));
+		ERR_FAIL_COND(!rcBuildRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
 	} else if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_MONOTONE) {
-		ERR_FAIL_COND(!rcBuildRegionsMonotone(&ctx, *chf, 0, cfg.minRegionArea, cfg.mergeRegionArea));
+		ERR_FAIL_COND(!rcBuildRegionsMonotone(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
 	} else {
-		ERR_FAIL_COND(!rcBuildLayerRegions(&ctx, *chf, 0, cfg.minRegionArea));
+		ERR_FAIL_COND(!rcBuildLayerRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea));
 	}
 
 	bake_state = "Creating contours..."; // step #8
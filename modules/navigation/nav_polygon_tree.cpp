@@ -0,0 +1,106 @@
+/**************************************************************************/
+/*  nav_polygon_tree.cpp                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "nav_polygon_tree.h"
+
+#include "core/templates/sort_array.h"
+
+struct NavPolygonTreeCenterSort {
+	const LocalVector<AABB> *aabbs = nullptr;
+	int axis = 0;
+
+	_FORCE_INLINE_ bool operator()(uint32_t p_a, uint32_t p_b) const {
+		return (*aabbs)[p_a].get_center()[axis] < (*aabbs)[p_b].get_center()[axis];
+	}
+};
+
+void NavPolygonTree::_build_node(uint32_t p_node, uint32_t p_from, uint32_t p_to, const LocalVector<AABB> &p_aabbs) {
+	AABB aabb = p_aabbs[indices[p_from]];
+	AABB centers(aabb.get_center(), Vector3());
+	for (uint32_t i = p_from + 1; i < p_to; i++) {
+		aabb.merge_with(p_aabbs[indices[i]]);
+		centers.expand_to(p_aabbs[indices[i]].get_center());
+	}
+	nodes[p_node].aabb = aabb;
+
+	if (p_to - p_from <= LEAF_SIZE) {
+		nodes[p_node].first = p_from;
+		nodes[p_node].count = p_to - p_from;
+		return;
+	}
+
+	// Median split along the longest axis of the polygon centers, which keeps the tree balanced.
+	SortArray<uint32_t, NavPolygonTreeCenterSort> sorter;
+	sorter.compare.aabbs = &p_aabbs;
+	sorter.compare.axis = centers.get_longest_axis_index();
+	const uint32_t mid = (p_from + p_to) / 2;
+	sorter.nth_element(p_from, p_to, mid, indices.ptr());
+
+	const uint32_t first_child = nodes.size();
+	nodes[p_node].first = first_child;
+	nodes.push_back(Node());
+	nodes.push_back(Node());
+
+	_build_node(first_child, p_from, mid, p_aabbs);
+	_build_node(first_child + 1, mid, p_to, p_aabbs);
+}
+
+void NavPolygonTree::build(const LocalVector<gd::Polygon> &p_polygons) {
+	clear();
+	if (p_polygons.is_empty()) {
+		return;
+	}
+
+	LocalVector<AABB> aabbs;
+	aabbs.resize(p_polygons.size());
+	indices.resize(p_polygons.size());
+	for (uint32_t i = 0; i < p_polygons.size(); i++) {
+		const gd::Polygon &polygon = p_polygons[i];
+		AABB aabb;
+		if (polygon.points.size() > 0) {
+			aabb.position = polygon.points[0].pos;
+			for (uint32_t j = 1; j < polygon.points.size(); j++) {
+				aabb.expand_to(polygon.points[j].pos);
+			}
+		}
+		// Flat polygons get a little thickness, so rounding can't make the bounds miss their faces.
+		aabbs[i] = aabb.grow(CMP_EPSILON);
+		indices[i] = i;
+	}
+
+	nodes.reserve(2 * (p_polygons.size() / LEAF_SIZE + 1));
+	nodes.push_back(Node());
+	_build_node(0, 0, p_polygons.size(), aabbs);
+}
+
+void NavPolygonTree::clear() {
+	nodes.clear();
+	indices.clear();
+}
@@ -0,0 +1,111 @@
+/**************************************************************************/
+/*  nav_polygon_tree.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef NAV_POLYGON_TREE_H
+#define NAV_POLYGON_TREE_H
+
+#include "nav_utils.h"
+
+#include "core/math/aabb.h"
+#include "core/templates/local_vector.h"
+
+/// Static bounding volume tree over the polygons of a map, rebuilt with them, for closest point queries.
+class NavPolygonTree {
+	struct Node {
+		AABB aabb;
+		uint32_t first = 0; // First child for inner nodes, first entry of `indices` for leaves.
+		uint32_t count = 0; // Polygons in a leaf, 0 for inner nodes.
+	};
+
+	static const uint32_t LEAF_SIZE = 4;
+	static const uint32_t MAX_DEPTH = 64;
+
+	LocalVector<Node> nodes;
+	LocalVector<uint32_t> indices;
+
+	void _build_node(uint32_t p_node, uint32_t p_from, uint32_t p_to, const LocalVector<AABB> &p_aabbs);
+
+public:
+	void build(const LocalVector<gd::Polygon> &p_polygons);
+	void clear();
+
+	static _FORCE_INLINE_ real_t distance_squared(const AABB &p_aabb, const Vector3 &p_point) {
+		return p_point.clamp(p_aabb.position, p_aabb.position + p_aabb.size).distance_squared_to(p_point);
+	}
+
+	static _FORCE_INLINE_ real_t distance_squared(const AABB &p_a, const AABB &p_b) {
+		const Vector3 gap = (p_a.position - p_b.position - p_b.size).max(p_b.position - p_a.position - p_a.size).max(Vector3());
+		return gap.length_squared();
+	}
+
+	// Visits the polygons of every leaf whose bound is not above the best distance, closest leaves first.
+	// `p_bound` returns a lower bound of the distance to anything in an AABB, or INFINITY to skip it.
+	// `p_visit` is called with a polygon index and returns the new best distance.
+	template <typename B, typename V>
+	void query(real_t p_best, B p_bound, V p_visit) const {
+		if (nodes.is_empty()) {
+			return;
+		}
+
+		struct Entry {
+			uint32_t node;
+			real_t bound;
+		};
+		Entry stack[MAX_DEPTH + 1];
+		uint32_t stack_size = 0;
+		stack[stack_size++] = { 0, p_bound(nodes[0].aabb) };
+
+		while (stack_size > 0) {
+			const Entry entry = stack[--stack_size];
+			if (entry.bound > p_best) {
+				continue;
+			}
+
+			const Node &node = nodes[entry.node];
+			if (node.count > 0) {
+				for (uint32_t i = node.first; i < node.first + node.count; i++) {
+					p_best = p_visit(indices[i]);
+				}
+				continue;
+			}
+
+			// Push the farthest child first so the closest is visited next.
+			Entry a = { node.first, p_bound(nodes[node.first].aabb) };
+			Entry b = { node.first + 1, p_bound(nodes[node.first + 1].aabb) };
+			if (a.bound < b.bound) {
+				SWAP(a, b);
+			}
+			stack[stack_size++] = a;
+			stack[stack_size++] = b;
+		}
+	}
+};
+
+#endif // NAV_POLYGON_TREE_H
@@ -30,8 +30,13 @@
 
 #include "noise.h"
 
+#include "core/object/worker_thread_pool.h"
+
 #include <float.h>
 
+// Below this many values, generating on a single thread is faster than distributing the rows.
+#define NOISE_IMAGE_THREADED_MIN_VALUES (128 * 128)
+
 Vector<Ref<Image>> Noise::_get_seamless_image(int p_width, int p_height, int p_depth, bool p_invert, bool p_in_3d_space, real_t p_blend_skirt, bool p_normalize) const {
 	ERR_FAIL_COND_V(p_width <= 0 || p_height <= 0 || p_depth <= 0, Vector<Ref<Image>>());
 
@@ -77,35 +82,69 @@ uint8_t Noise::_alpha_blend<uint8_t>(uint8_t p_bg, uint8_t p_fg, int p_alpha) co
 	return (uint8_t)((alpha * p_fg + inv_alpha * p_bg) >> 8);
 }
 
+void Noise::_get_image_row(void *p_userdata, uint32_t p_row) {
+	ImageRowsData *data = (ImageRowsData *)p_userdata;
+	int y = p_row % data->height;
+	int d = p_row / data->height;
+	real_t *values = data->values + p_row * data->width;
+
+	real_t min_val = FLT_MAX;
+	real_t max_val = -FLT_MAX;
+	for (int x = 0; x < data->width; x++) {
+		values[x] = data->in_3d_space ? data->noise->get_noise_3d(x, y, d) : data->noise->get_noise_2d(x, y);
+		if (values[x] > max_val) {
+			max_val = values[x];
+		}
+		if (values[x] < min_val) {
+			min_val = values[x];
+		}
+	}
+	data->row_min[p_row] = min_val;
+	data->row_max[p_row] = max_val;
+}
+
 Vector<Ref<Image>> Noise::_get_image(int p_width, int p_height, int p_depth, bool p_invert, bool p_in_3d_space, bool p_normalize) const {
 	ERR_FAIL_COND_V(p_width <= 0 || p_height <= 0 || p_depth <= 0, Vector<Ref<Image>>());
 
 	Vector<Ref<Image>> images;
 	images.resize(p_depth);
 
-	if (p_normalize) {
-		// Get all values and identify min/max values.
-		LocalVector<real_t> values;
-		values.resize(p_width * p_height * p_depth);
+	// Get all values, the noise functions are const so rows can be computed in parallel.
+	uint32_t row_count = p_height * p_depth;
+	LocalVector<real_t> values;
+	values.resize(p_width * row_count);
+	LocalVector<real_t> row_min;
+	row_min.resize(row_count);
+	LocalVector<real_t> row_max;
+	row_max.resize(row_count);
+
+	ImageRowsData rows_data;
+	rows_data.noise = this;
+	rows_data.width = p_width;
+	rows_data.height = p_height;
+	rows_data.in_3d_space = p_in_3d_space;
+	rows_data.values = values.ptr();
+	rows_data.row_min = row_min.ptr();
+	rows_data.row_max = row_max.ptr();
+
+	if (row_count > 1 && values.size() >= NOISE_IMAGE_THREADED_MIN_VALUES) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&Noise::_get_image_row, &rows_data, row_count, -1, true, SNAME("NoiseGetImage"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < row_count; i++) {
+			_get_image_row(&rows_data, i);
+		}
+	}
 
+	if (p_normalize) {
+		// Identify min/max values.
 		real_t min_val = FLT_MAX;
 		real_t max_val = -FLT_MAX;
-		int idx = 0;
-		for (int d = 0; d < p_depth; d++) {
-			for (int y = 0; y < p_height; y++) {
-				for (int x = 0; x < p_width; x++) {
-					values[idx] = p_in_3d_space ? get_noise_3d(x, y, d) : get_noise_2d(x, y);
-					if (values[idx] > max_val) {
-						max_val = values[idx];
-					}
-					if (values[idx] < min_val) {
-						min_val = values[idx];
-					}
-					idx++;
-				}
-			}
+		for (uint32_t i = 0; i < row_count; i++) {
+			min_val = MIN(min_val, row_min[i]);
+			max_val = MAX(max_val, row_max[i]);
 		}
-		idx = 0;
+		int idx = 0;
 		// Normalize values and write to texture.
 		for (int d = 0; d < p_depth; d++) {
 			Vector<uint8_t> data;
@@ -144,9 +183,10 @@ Vector<Ref<Image>> Noise::_get_image(int p_width, int p_height, int p_depth, boo
 
 			uint8_t ivalue;
 			int idx = 0;
+			const real_t *depth_values = values.ptr() + d * p_width * p_height;
 			for (int y = 0; y < p_height; y++) {
 				for (int x = 0; x < p_width; x++) {
-					float value = (p_in_3d_space ? get_noise_3d(x, y, d) : get_noise_2d(x, y));
+					float value = depth_values[idx];
 					ivalue = static_cast<uint8_t>(CLAMP(value * 127.5f + 127.5f, 0.0f, 255.0f));
 					wd8[idx] = p_invert ? (255 - ivalue) : ivalue;
 					idx++;
@@ -275,6 +275,19 @@ class Noise : public Resource {
 		return out.l;
 	}
 
+	// Rows of noise values computed by _get_image(), one group task element per row.
+	struct ImageRowsData {
+		const Noise *noise = nullptr;
+		int width = 0;
+		int height = 0;
+		bool in_3d_space = false;
+		real_t *values = nullptr;
+		real_t *row_min = nullptr;
+		real_t *row_max = nullptr;
+	};
+
+	static void _get_image_row(void *p_userdata, uint32_t p_row);
+
 protected:
 	static void _bind_methods();
 
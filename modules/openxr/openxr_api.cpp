@@ -1782,12 +1782,8 @@ void OpenXRAPI::pre_render() {
 	// "Repeatedly calling xrLocateViews with the same time may not necessarily return the same result. Instead the prediction gets increasingly accurate as the function is called closer to the given time for which a prediction is made"
 
 	// We're calling this "relatively" early, the positioning we're obtaining here will be used to do our frustum culling,
-	// occlusion culling, etc. There is however a technique that we can investigate in the future where after our entire
-	// Vulkan command buffer is build, but right before vkSubmitQueue is called, we call xrLocateViews one more time and
-	// update the view and projection matrix once more with a slightly more accurate predication and then submit the
-	// command queues.
-
-	// That is not possible yet but worth investigating in the future.
+	// occlusion culling, etc. With late latching enabled, late_latch_views() locates the views once more after our entire
+	// Vulkan command buffer is build, right before it is submitted, and the renderer updates the view matrices with it.
 
 	XrViewLocateInfo view_locate_info = {
 		XR_TYPE_VIEW_LOCATE_INFO, // type
@@ -1836,6 +1832,49 @@ void OpenXRAPI::pre_render() {
 	}
 }
 
+bool OpenXRAPI::late_latch_views() {
+	if (!late_latching || !can_render() || frame_state.predictedDisplayTime == 0) {
+		return false;
+	}
+
+	XrViewLocateInfo view_locate_info = {
+		XR_TYPE_VIEW_LOCATE_INFO, // type
+		nullptr, // next
+		view_configuration, // viewConfigurationType
+		frame_state.predictedDisplayTime, // displayTime
+		play_space // space
+	};
+	XrViewState view_state = {
+		XR_TYPE_VIEW_STATE, // type
+		nullptr, // next
+		0 // viewStateFlags
+	};
+
+	LocalVector<XrView> late_views;
+	late_views.resize(view_count);
+	for (uint32_t i = 0; i < view_count; i++) {
+		late_views[i].type = XR_TYPE_VIEW;
+		late_views[i].next = nullptr;
+	}
+
+	uint32_t view_count_output;
+	XrResult result = xrLocateViews(session, &view_locate_info, &view_state, view_count, &view_count_output, late_views.ptr());
+	if (XR_FAILED(result) || view_count_output != view_count) {
+		return false;
+	}
+	if ((view_state.viewStateFlags & XR_VIEW_STATE_ORIENTATION_VALID_BIT) == 0 || (view_state.viewStateFlags & XR_VIEW_STATE_POSITION_VALID_BIT) == 0) {
+		return false;
+	}
+
+	// Only the pose is updated, the frame was rendered with the projection obtained earlier.
+	// end_frame() submits the new pose, so the compositor reprojects from the pose the views are corrected to.
+	for (uint32_t i = 0; i < view_count; i++) {
+		views[i].pose = late_views[i].pose;
+	}
+
+	return true;
+}
+
 bool OpenXRAPI::pre_draw_viewport(RID p_render_target) {
 	if (!can_render()) {
 		return false;
@@ -2080,6 +2119,7 @@ OpenXRAPI::OpenXRAPI() {
 		}
 
 		submit_depth_buffer = GLOBAL_GET("xr/openxr/submit_depth_buffer");
+		late_latching = GLOBAL_GET("xr/openxr/late_latching");
 	}
 
 	// reset a few things that can't be done in our class definition
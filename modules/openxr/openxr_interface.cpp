@@ -803,6 +803,35 @@ Transform3D OpenXRInterface::get_transform_for_view(uint32_t p_view, const Trans
 	return p_cam_transform * xr_server->get_reference_frame() * t;
 }
 
+bool OpenXRInterface::is_late_latching_enabled() {
+	return openxr_api && openxr_api->is_late_latching_enabled();
+}
+
+bool OpenXRInterface::get_late_latch_correction(Transform3D &r_correction) {
+	XRServer *xr_server = XRServer::get_singleton();
+	ERR_FAIL_NULL_V(xr_server, false);
+
+	if (!openxr_api || !openxr_api->late_latch_views()) {
+		return false;
+	}
+
+	// All views move together with the head, so the first one tells us how much it moved.
+	Transform3D previous = transform_for_view[0];
+	for (uint32_t i = 0; i < get_view_count(); i++) {
+		openxr_api->get_view_transform(i, transform_for_view[i]);
+	}
+	Transform3D current = transform_for_view[0];
+
+	double world_scale = xr_server->get_world_scale();
+	previous.origin *= world_scale;
+	current.origin *= world_scale;
+
+	Transform3D origin = xr_server->get_world_origin() * xr_server->get_reference_frame();
+	r_correction = origin * current * previous.affine_inverse() * origin.affine_inverse();
+
+	return true;
+}
+
 Projection OpenXRInterface::get_projection_for_view(uint32_t p_view, double p_aspect, double p_z_near, double p_z_far) {
 	Projection cm;
 	ERR_FAIL_UNSIGNED_INDEX_V_MSG(p_view, get_view_count(), cm, "View index outside bounds.");
@@ -135,6 +135,8 @@ public:
 	virtual Transform3D get_camera_transform() override;
 	virtual Transform3D get_transform_for_view(uint32_t p_view, const Transform3D &p_cam_transform) override;
 	virtual Projection get_projection_for_view(uint32_t p_view, double p_aspect, double p_z_near, double p_z_far) override;
+	virtual bool is_late_latching_enabled() override;
+	virtual bool get_late_latch_correction(Transform3D &r_correction) override;
 
 	virtual RID get_color_texture() override;
 	virtual RID get_depth_texture() override;
@@ -45,6 +45,9 @@ void initialize_raycast_module(ModuleInitializationLevel p_level) {
 	LightmapRaycasterEmbree::make_default_raycaster();
 	StaticRaycasterEmbree::make_default_raycaster();
 #endif
+	if (RendererSceneOcclusionCull::get_singleton() && RendererSceneOcclusionCull::get_singleton()->uses_depth_buffer()) {
+		return; // The renderer culls against the depth buffer instead, see rendering/occlusion_culling/method.
+	}
 	raycast_occlusion_cull = memnew(RaycastOcclusionCull);
 }
 
@@ -359,6 +359,7 @@ bool TextServerAdvanced::_has_feature(Feature p_feature) const {
 		case FEATURE_USE_SUPPORT_DATA:
 		case FEATURE_UNICODE_IDENTIFIERS:
 		case FEATURE_UNICODE_SECURITY:
+		case FEATURE_THREADED_SHAPING:
 			return true;
 		default: {
 		}
@@ -375,7 +376,7 @@ String TextServerAdvanced::_get_name() const {
 }
 
 int64_t TextServerAdvanced::_get_features() const {
-	int64_t interface_features = FEATURE_SIMPLE_LAYOUT | FEATURE_BIDI_LAYOUT | FEATURE_VERTICAL_LAYOUT | FEATURE_SHAPING | FEATURE_KASHIDA_JUSTIFICATION | FEATURE_BREAK_ITERATORS | FEATURE_FONT_BITMAP | FEATURE_FONT_VARIABLE | FEATURE_CONTEXT_SENSITIVE_CASE_CONVERSION | FEATURE_USE_SUPPORT_DATA;
+	int64_t interface_features = FEATURE_SIMPLE_LAYOUT | FEATURE_BIDI_LAYOUT | FEATURE_VERTICAL_LAYOUT | FEATURE_SHAPING | FEATURE_KASHIDA_JUSTIFICATION | FEATURE_BREAK_ITERATORS | FEATURE_FONT_BITMAP | FEATURE_FONT_VARIABLE | FEATURE_CONTEXT_SENSITIVE_CASE_CONVERSION | FEATURE_USE_SUPPORT_DATA | FEATURE_THREADED_SHAPING;
 #ifdef MODULE_FREETYPE_ENABLED
 	interface_features |= FEATURE_FONT_DYNAMIC;
 #endif
@@ -389,14 +390,17 @@ int64_t TextServerAdvanced::_get_features() const {
 void TextServerAdvanced::_free_rid(const RID &p_rid) {
 	_THREAD_SAFE_METHOD_
 	if (font_owner.owns(p_rid)) {
-		MutexLock ftlock(ft_mutex);
-
 		FontAdvanced *fd = font_owner.get_or_null(p_rid);
+		fd->render_tasks_cancel.set();
+		_font_wait_render_tasks(fd);
+
+		MutexLock ftlock(ft_mutex);
 		{
 			MutexLock lock(fd->mutex);
 			font_owner.free(p_rid);
 		}
 		memdelete(fd);
+		_shaped_run_cache_invalidate();
 	} else if (shaped_owner.owns(p_rid)) {
 		ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_rid);
 		{
@@ -941,8 +945,18 @@ void TextServerAdvanced::_generateMTSDF_threaded(void *p_td, uint32_t p_y) {
 	}
 }
 
-_FORCE_INLINE_ TextServerAdvanced::FontGlyph TextServerAdvanced::rasterize_msdf(FontAdvanced *p_font_data, FontForSizeAdvanced *p_data, int p_pixel_range, int p_rect_margin, FT_Outline *outline, const Vector2 &advance) const {
+struct TextServerAdvanced::MSDFGlyphData {
+	int32_t glyph = 0;
+	Vector2 advance;
+	int pixel_range = 0;
 	msdfgen::Shape shape;
+	msdfgen::Shape::Bounds bounds = {};
+	msdfgen::Bitmap<float, 4> image;
+	bool has_shape = false;
+};
+
+bool TextServerAdvanced::_msdf_prepare(MSDFGlyphData &r_data, FT_Outline *p_outline) {
+	msdfgen::Shape &shape = r_data.shape;
 
 	shape.contours.clear();
 	shape.inverseYAxis = false;
@@ -957,13 +971,13 @@ _FORCE_INLINE_ TextServerAdvanced::FontGlyph TextServerAdvanced::rasterize_msdf(
 	ft_functions.shift = 0;
 	ft_functions.delta = 0;
 
-	int error = FT_Outline_Decompose(outline, &ft_functions, &context);
-	ERR_FAIL_COND_V_MSG(error, FontGlyph(), "FreeType: Outline decomposition error: '" + String(FT_Error_String(error)) + "'.");
+	int error = FT_Outline_Decompose(p_outline, &ft_functions, &context);
+	ERR_FAIL_COND_V_MSG(error, false, "FreeType: Outline decomposition error: '" + String(FT_Error_String(error)) + "'.");
 	if (!shape.contours.empty() && shape.contours.back().edges.empty()) {
 		shape.contours.pop_back();
 	}
 
-	if (FT_Outline_Get_Orientation(outline) == 1) {
+	if (FT_Outline_Get_Orientation(p_outline) == 1) {
 		for (int i = 0; i < (int)shape.contours.size(); ++i) {
 			shape.contours[i].reverse();
 		}
@@ -972,13 +986,55 @@ _FORCE_INLINE_ TextServerAdvanced::FontGlyph TextServerAdvanced::rasterize_msdf(
 	shape.inverseYAxis = true;
 	shape.normalize();
 
-	msdfgen::Shape::Bounds bounds = shape.getBounds(p_pixel_range);
+	r_data.bounds = shape.getBounds(r_data.pixel_range);
+	r_data.has_shape = shape.validate() && shape.contours.size() > 0;
+	return true;
+}
 
+void TextServerAdvanced::_msdf_generate(MSDFGlyphData &r_data, bool p_threaded) {
+	int w = (r_data.bounds.r - r_data.bounds.l);
+	int h = (r_data.bounds.t - r_data.bounds.b);
+	if (!r_data.has_shape || w > 4096 || h > 4096) {
+		return; // Too large glyphs are reported when stored.
+	}
+
+	edgeColoringSimple(r_data.shape, 3.0); // Max. angle.
+	r_data.image = msdfgen::Bitmap<float, 4>(w, h); // Texture size.
+
+	DistancePixelConversion distancePixelConversion(r_data.pixel_range);
+	msdfgen::Projection projection(msdfgen::Vector2(1.0, 1.0), msdfgen::Vector2(-r_data.bounds.l, -r_data.bounds.b));
+	msdfgen::MSDFGeneratorConfig config(true, msdfgen::ErrorCorrectionConfig());
+
+	MSDFThreadData td;
+	td.output = &r_data.image;
+	td.shape = &r_data.shape;
+	td.projection = &projection;
+	td.distancePixelConversion = &distancePixelConversion;
+
+	if (p_threaded) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&TextServerAdvanced::_generateMTSDF_threaded, &td, h, -1, true, String("FontServerRasterizeMSDF"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (int i = 0; i < h; i++) {
+			_generateMTSDF_threaded(&td, i);
+		}
+	}
+
+	msdfgen::msdfErrorCorrection(r_data.image, r_data.shape, projection, r_data.pixel_range, config);
+}
+
+void TextServerAdvanced::_msdf_generate_threaded(void *p_td, uint32_t p_index) {
+	MSDFGlyphData *glyphs = static_cast<MSDFGlyphData *>(p_td);
+	_msdf_generate(glyphs[p_index], false);
+}
+
+TextServerAdvanced::FontGlyph TextServerAdvanced::_msdf_store(FontForSizeAdvanced *p_data, int p_rect_margin, const MSDFGlyphData &p_glyph) const {
 	FontGlyph chr;
 	chr.found = true;
-	chr.advance = advance;
+	chr.advance = p_glyph.advance;
 
-	if (shape.validate() && shape.contours.size() > 0) {
+	if (p_glyph.has_shape) {
+		const msdfgen::Shape::Bounds &bounds = p_glyph.bounds;
 		int w = (bounds.r - bounds.l);
 		int h = (bounds.t - bounds.b);
 
@@ -992,25 +1048,8 @@ _FORCE_INLINE_ TextServerAdvanced::FontGlyph TextServerAdvanced::rasterize_msdf(
 		ERR_FAIL_COND_V(tex_pos.index < 0, FontGlyph());
 		ShelfPackTexture &tex = p_data->textures.write[tex_pos.index];
 
-		edgeColoringSimple(shape, 3.0); // Max. angle.
-		msdfgen::Bitmap<float, 4> image(w, h); // Texture size.
-
-		DistancePixelConversion distancePixelConversion(p_pixel_range);
-		msdfgen::Projection projection(msdfgen::Vector2(1.0, 1.0), msdfgen::Vector2(-bounds.l, -bounds.b));
-		msdfgen::MSDFGeneratorConfig config(true, msdfgen::ErrorCorrectionConfig());
-
-		MSDFThreadData td;
-		td.output = &image;
-		td.shape = &shape;
-		td.projection = &projection;
-		td.distancePixelConversion = &distancePixelConversion;
-
-		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&TextServerAdvanced::_generateMTSDF_threaded, &td, h, -1, true, String("FontServerRasterizeMSDF"));
-		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
-
-		msdfgen::msdfErrorCorrection(image, shape, projection, p_pixel_range, config);
-
 		{
+			const msdfgen::Bitmap<float, 4> &image = p_glyph.image;
 			uint8_t *wr = tex.imgdata.ptrw();
 
 			for (int i = 0; i < h; i++) {
@@ -1036,6 +1075,77 @@ _FORCE_INLINE_ TextServerAdvanced::FontGlyph TextServerAdvanced::rasterize_msdf(
 	}
 	return chr;
 }
+
+_FORCE_INLINE_ TextServerAdvanced::FontGlyph TextServerAdvanced::rasterize_msdf(FontAdvanced *p_font_data, FontForSizeAdvanced *p_data, int p_pixel_range, int p_rect_margin, FT_Outline *outline, const Vector2 &advance) const {
+	MSDFGlyphData glyph;
+	glyph.pixel_range = p_pixel_range;
+	glyph.advance = advance;
+	if (!_msdf_prepare(glyph, outline)) {
+		return FontGlyph();
+	}
+	_msdf_generate(glyph, true);
+	return _msdf_store(p_data, p_rect_margin, glyph);
+}
+
+void TextServerAdvanced::_ensure_msdf_glyphs(FontAdvanced *p_font_data, const Vector2i &p_size, const LocalVector<int32_t> &p_glyphs) const {
+	FontForSizeAdvanced *fd = p_font_data->cache[p_size];
+	if (!fd->face || p_size.y > 0) {
+		// Outlines are stroked bitmaps, not distance fields.
+		for (int32_t glyph : p_glyphs) {
+			_ensure_glyph(p_font_data, p_size, glyph);
+		}
+		return;
+	}
+
+	// Loading outlines uses the face and stays on this thread, only the distance fields are generated in parallel.
+	LocalVector<MSDFGlyphData> glyphs;
+	glyphs.reserve(p_glyphs.size());
+	HashSet<int32_t> queued;
+	FT_Int32 flags = _get_glyph_load_flags(p_font_data, fd->face, false);
+	for (int32_t glyph_index : p_glyphs) {
+		if (fd->glyph_map.has(glyph_index) || queued.has(glyph_index)) {
+			continue;
+		}
+		if (glyph_index == 0) {
+			fd->glyph_map[glyph_index] = FontGlyph();
+			continue;
+		}
+
+		FT_Fixed v, h;
+		FT_Get_Advance(fd->face, glyph_index, flags, &h);
+		FT_Get_Advance(fd->face, glyph_index, flags | FT_LOAD_VERTICAL_LAYOUT, &v);
+
+		if (FT_Load_Glyph(fd->face, glyph_index, flags)) {
+			fd->glyph_map[glyph_index] = FontGlyph();
+			continue;
+		}
+		_apply_glyph_outline_transform(p_font_data, p_size, &fd->face->glyph->outline);
+
+		glyphs.push_back(MSDFGlyphData());
+		MSDFGlyphData &glyph = glyphs[glyphs.size() - 1];
+		glyph.glyph = glyph_index;
+		glyph.pixel_range = p_font_data->msdf_range;
+		glyph.advance = Vector2((h + (1 << 9)) >> 10, (v + (1 << 9)) >> 10) / 64.0;
+		if (!_msdf_prepare(glyph, &fd->face->glyph->outline)) {
+			fd->glyph_map[glyph_index] = FontGlyph();
+			glyphs.remove_at(glyphs.size() - 1);
+			continue;
+		}
+		queued.insert(glyph_index);
+	}
+
+	if (glyphs.is_empty()) {
+		return;
+	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&TextServerAdvanced::_msdf_generate_threaded, glyphs.ptr(), glyphs.size(), -1, true, String("FontServerRasterizeMSDFGlyphs"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	// Packed in the order they were requested, so the atlas doesn't depend on which task finished first.
+	for (const MSDFGlyphData &glyph : glyphs) {
+		fd->glyph_map[glyph.glyph] = _msdf_store(fd, rect_range, glyph);
+	}
+}
 #endif
 
 #ifdef MODULE_FREETYPE_ENABLED
@@ -1155,6 +1265,45 @@ _FORCE_INLINE_ TextServerAdvanced::FontGlyph TextServerAdvanced::rasterize_bitma
 /* Font Cache                                                            */
 /*************************************************************************/
 
+#ifdef MODULE_FREETYPE_ENABLED
+_FORCE_INLINE_ FT_Int32 TextServerAdvanced::_get_glyph_load_flags(FontAdvanced *p_font_data, FT_Face p_face, bool p_outline) const {
+	FT_Int32 flags = FT_LOAD_DEFAULT;
+
+	switch (p_font_data->hinting) {
+		case TextServer::HINTING_NONE:
+			flags |= FT_LOAD_NO_HINTING;
+			break;
+		case TextServer::HINTING_LIGHT:
+			flags |= FT_LOAD_TARGET_LIGHT;
+			break;
+		default:
+			flags |= FT_LOAD_TARGET_NORMAL;
+			break;
+	}
+	if (p_font_data->force_autohinter) {
+		flags |= FT_LOAD_FORCE_AUTOHINT;
+	}
+	if (p_outline) {
+		flags |= FT_LOAD_NO_BITMAP;
+	} else if (FT_HAS_COLOR(p_face)) {
+		flags |= FT_LOAD_COLOR;
+	}
+	return flags;
+}
+
+_FORCE_INLINE_ void TextServerAdvanced::_apply_glyph_outline_transform(FontAdvanced *p_font_data, const Vector2i &p_size, FT_Outline *p_outline) const {
+	if (p_font_data->embolden != 0.f) {
+		FT_Pos strength = p_font_data->embolden * p_size.x * 4; // 26.6 fractional units (1 / 64).
+		FT_Outline_Embolden(p_outline, strength);
+	}
+
+	if (p_font_data->transform != Transform2D()) {
+		FT_Matrix mat = { FT_Fixed(p_font_data->transform[0][0] * 65536), FT_Fixed(p_font_data->transform[0][1] * 65536), FT_Fixed(p_font_data->transform[1][0] * 65536), FT_Fixed(p_font_data->transform[1][1] * 65536) }; // 16.16 fractional units (1 / 65536).
+		FT_Outline_Transform(p_outline, &mat);
+	}
+}
+#endif
+
 _FORCE_INLINE_ bool TextServerAdvanced::_ensure_glyph(FontAdvanced *p_font_data, const Vector2i &p_size, int32_t p_glyph) const {
 	ERR_FAIL_COND_V(!_ensure_cache_for_size(p_font_data, p_size), false);
 
@@ -1173,28 +1322,8 @@ _FORCE_INLINE_ bool TextServerAdvanced::_ensure_glyph(FontAdvanced *p_font_data,
 #ifdef MODULE_FREETYPE_ENABLED
 	FontGlyph gl;
 	if (fd->face) {
-		FT_Int32 flags = FT_LOAD_DEFAULT;
-
 		bool outline = p_size.y > 0;
-		switch (p_font_data->hinting) {
-			case TextServer::HINTING_NONE:
-				flags |= FT_LOAD_NO_HINTING;
-				break;
-			case TextServer::HINTING_LIGHT:
-				flags |= FT_LOAD_TARGET_LIGHT;
-				break;
-			default:
-				flags |= FT_LOAD_TARGET_NORMAL;
-				break;
-		}
-		if (p_font_data->force_autohinter) {
-			flags |= FT_LOAD_FORCE_AUTOHINT;
-		}
-		if (outline) {
-			flags |= FT_LOAD_NO_BITMAP;
-		} else if (FT_HAS_COLOR(fd->face)) {
-			flags |= FT_LOAD_COLOR;
-		}
+		FT_Int32 flags = _get_glyph_load_flags(p_font_data, fd->face, outline);
 
 		FT_Fixed v, h;
 		FT_Get_Advance(fd->face, glyph_index, flags, &h);
@@ -1216,15 +1345,7 @@ _FORCE_INLINE_ bool TextServerAdvanced::_ensure_glyph(FontAdvanced *p_font_data,
 			}
 		}
 
-		if (p_font_data->embolden != 0.f) {
-			FT_Pos strength = p_font_data->embolden * p_size.x * 4; // 26.6 fractional units (1 / 64).
-			FT_Outline_Embolden(&fd->face->glyph->outline, strength);
-		}
-
-		if (p_font_data->transform != Transform2D()) {
-			FT_Matrix mat = { FT_Fixed(p_font_data->transform[0][0] * 65536), FT_Fixed(p_font_data->transform[0][1] * 65536), FT_Fixed(p_font_data->transform[1][0] * 65536), FT_Fixed(p_font_data->transform[1][1] * 65536) }; // 16.16 fractional units (1 / 65536).
-			FT_Outline_Transform(&fd->face->glyph->outline, &mat);
-		}
+		_apply_glyph_outline_transform(p_font_data, p_size, &fd->face->glyph->outline);
 
 		FT_Render_Mode aa_mode = FT_RENDER_MODE_NORMAL;
 		bool bgra = false;
@@ -1314,6 +1435,80 @@ _FORCE_INLINE_ bool TextServerAdvanced::_ensure_glyph(FontAdvanced *p_font_data,
 	return false;
 }
 
+_FORCE_INLINE_ void TextServerAdvanced::_ensure_glyph_variants(FontAdvanced *p_font_data, const Vector2i &p_size, int32_t p_index) const {
+	if (p_font_data->msdf) {
+		_ensure_glyph(p_font_data, p_size, p_index);
+		return;
+	}
+	for (int aa = 0; aa < ((p_font_data->antialiasing == FONT_ANTIALIASING_LCD) ? FONT_LCD_SUBPIXEL_LAYOUT_MAX : 1); aa++) {
+		if ((p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && p_size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE)) {
+			_ensure_glyph(p_font_data, p_size, p_index | (0 << 27) | (aa << 24));
+			_ensure_glyph(p_font_data, p_size, p_index | (1 << 27) | (aa << 24));
+			_ensure_glyph(p_font_data, p_size, p_index | (2 << 27) | (aa << 24));
+			_ensure_glyph(p_font_data, p_size, p_index | (3 << 27) | (aa << 24));
+		} else if ((p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && p_size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE)) {
+			_ensure_glyph(p_font_data, p_size, p_index | (1 << 27) | (aa << 24));
+			_ensure_glyph(p_font_data, p_size, p_index | (0 << 27) | (aa << 24));
+		} else {
+			_ensure_glyph(p_font_data, p_size, p_index | (aa << 24));
+		}
+	}
+}
+
+void TextServerAdvanced::_font_update_texture(const RID &p_font_rid, FontAdvanced *p_font_data, ShelfPackTexture &p_tex) const {
+	if (!p_tex.dirty) {
+		return;
+	}
+	if (p_tex.texture.is_valid()) {
+		// The texture RID is already known to the caller, new glyphs only need to be uploaded before the frame is drawn.
+		MutexLock lock(dirty_texture_mutex);
+		if (!dirty_texture_update_connected) {
+			RenderingServer::get_singleton()->connect("frame_pre_draw", callable_mp(const_cast<TextServerAdvanced *>(this), &TextServerAdvanced::_update_dirty_textures));
+			dirty_texture_update_connected = true;
+		}
+		dirty_texture_fonts.insert(p_font_rid);
+		return;
+	}
+
+	Ref<Image> img = Image::create_from_data(p_tex.texture_w, p_tex.texture_h, false, p_tex.format, p_tex.imgdata);
+	if (p_font_data->mipmaps) {
+		img->generate_mipmaps();
+	}
+	p_tex.texture = ImageTexture::create_from_image(img);
+	p_tex.dirty = false;
+}
+
+void TextServerAdvanced::_update_dirty_textures() {
+	HashSet<RID> fonts;
+	{
+		MutexLock lock(dirty_texture_mutex);
+		SWAP(fonts, dirty_texture_fonts);
+	}
+
+	for (const RID &E : fonts) {
+		FontAdvanced *fd = font_owner.get_or_null(E);
+		if (!fd) {
+			continue;
+		}
+
+		MutexLock lock(fd->mutex);
+		for (KeyValue<Vector2i, FontForSizeAdvanced *> &F : fd->cache) {
+			for (int i = 0; i < F.value->textures.size(); i++) {
+				ShelfPackTexture &tex = F.value->textures.write[i];
+				if (!tex.dirty || tex.texture.is_null()) {
+					continue;
+				}
+				Ref<Image> img = Image::create_from_data(tex.texture_w, tex.texture_h, false, tex.format, tex.imgdata);
+				if (fd->mipmaps) {
+					img->generate_mipmaps();
+				}
+				tex.texture->update(img);
+				tex.dirty = false;
+			}
+		}
+	}
+}
+
 _FORCE_INLINE_ bool TextServerAdvanced::_ensure_cache_for_size(FontAdvanced *p_font_data, const Vector2i &p_size) const {
 	ERR_FAIL_COND_V(p_size.x <= 0, false);
 	if (p_font_data->cache.has(p_size)) {
@@ -1797,6 +1992,7 @@ _FORCE_INLINE_ bool TextServerAdvanced::_ensure_cache_for_size(FontAdvanced *p_f
 
 _FORCE_INLINE_ void TextServerAdvanced::_font_clear_cache(FontAdvanced *p_font_data) {
 	MutexLock ftlock(ft_mutex);
+	_shaped_run_cache_invalidate();
 
 	for (const KeyValue<Vector2i, FontForSizeAdvanced *> &E : p_font_data->cache) {
 		memdelete(E.value);
@@ -2236,6 +2432,7 @@ void TextServerAdvanced::_font_set_fixed_size(const RID &p_font_rid, int64_t p_f
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	_shaped_run_cache_invalidate();
 	fd->fixed_size = p_fixed_size;
 }
 
@@ -2306,6 +2503,7 @@ void TextServerAdvanced::_font_set_subpixel_positioning(const RID &p_font_rid, T
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	_shaped_run_cache_invalidate();
 	fd->subpixel_positioning = p_subpixel;
 }
 
@@ -2433,6 +2631,7 @@ void TextServerAdvanced::_font_clear_size_cache(const RID &p_font_rid) {
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	_shaped_run_cache_invalidate();
 	MutexLock ftlock(ft_mutex);
 	for (const KeyValue<Vector2i, FontForSizeAdvanced *> &E : fd->cache) {
 		memdelete(E.value);
@@ -2445,6 +2644,7 @@ void TextServerAdvanced::_font_remove_size_cache(const RID &p_font_rid, const Ve
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	_shaped_run_cache_invalidate();
 	MutexLock ftlock(ft_mutex);
 	if (fd->cache.has(p_size)) {
 		memdelete(fd->cache[p_size]);
@@ -2457,6 +2657,7 @@ void TextServerAdvanced::_font_set_ascent(const RID &p_font_rid, int64_t p_size,
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	_shaped_run_cache_invalidate();
 	Vector2i size = _get_size(fd, p_size);
 
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
@@ -2483,6 +2684,7 @@ void TextServerAdvanced::_font_set_descent(const RID &p_font_rid, int64_t p_size
 	FontAdvanced *fd = font_owner.get_or_null(p_font_rid);
 	ERR_FAIL_COND(!fd);
 
+	_shaped_run_cache_invalidate();
 	Vector2i size = _get_size(fd, p_size);
 
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
@@ -2510,6 +2712,7 @@ void TextServerAdvanced::_font_set_underline_position(const RID &p_font_rid, int
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	_shaped_run_cache_invalidate();
 	Vector2i size = _get_size(fd, p_size);
 
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
@@ -2537,6 +2740,7 @@ void TextServerAdvanced::_font_set_underline_thickness(const RID &p_font_rid, in
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	_shaped_run_cache_invalidate();
 	Vector2i size = _get_size(fd, p_size);
 
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
@@ -2564,6 +2768,7 @@ void TextServerAdvanced::_font_set_scale(const RID &p_font_rid, int64_t p_size,
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	_shaped_run_cache_invalidate();
 	Vector2i size = _get_size(fd, p_size);
 
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
@@ -2733,6 +2938,7 @@ void TextServerAdvanced::_font_clear_glyphs(const RID &p_font_rid, const Vector2
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	_shaped_run_cache_invalidate();
 	Vector2i size = _get_size_outline(fd, p_size);
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
 
@@ -2744,6 +2950,7 @@ void TextServerAdvanced::_font_remove_glyph(const RID &p_font_rid, const Vector2
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	_shaped_run_cache_invalidate();
 	Vector2i size = _get_size_outline(fd, p_size);
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
 
@@ -2807,6 +3014,7 @@ void TextServerAdvanced::_font_set_glyph_advance(const RID &p_font_rid, int64_t
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	_shaped_run_cache_invalidate();
 	Vector2i size = _get_size(fd, p_size);
 
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
@@ -3013,19 +3221,7 @@ RID TextServerAdvanced::_font_get_glyph_texture_rid(const RID &p_font_rid, const
 
 	if (RenderingServer::get_singleton() != nullptr) {
 		if (gl[p_glyph | mod].texture_idx != -1) {
-			if (fd->cache[size]->textures[gl[p_glyph | mod].texture_idx].dirty) {
-				ShelfPackTexture &tex = fd->cache[size]->textures.write[gl[p_glyph | mod].texture_idx];
-				Ref<Image> img = Image::create_from_data(tex.texture_w, tex.texture_h, false, tex.format, tex.imgdata);
-				if (fd->mipmaps) {
-					img->generate_mipmaps();
-				}
-				if (tex.texture.is_null()) {
-					tex.texture = ImageTexture::create_from_image(img);
-				} else {
-					tex.texture->update(img);
-				}
-				tex.dirty = false;
-			}
+			_font_update_texture(p_font_rid, fd, fd->cache[size]->textures.write[gl[p_glyph | mod].texture_idx]);
 			return fd->cache[size]->textures[gl[p_glyph | mod].texture_idx].texture->get_rid();
 		}
 	}
@@ -3059,19 +3255,7 @@ Size2 TextServerAdvanced::_font_get_glyph_texture_size(const RID &p_font_rid, co
 
 	if (RenderingServer::get_singleton() != nullptr) {
 		if (gl[p_glyph | mod].texture_idx != -1) {
-			if (fd->cache[size]->textures[gl[p_glyph | mod].texture_idx].dirty) {
-				ShelfPackTexture &tex = fd->cache[size]->textures.write[gl[p_glyph | mod].texture_idx];
-				Ref<Image> img = Image::create_from_data(tex.texture_w, tex.texture_h, false, tex.format, tex.imgdata);
-				if (fd->mipmaps) {
-					img->generate_mipmaps();
-				}
-				if (tex.texture.is_null()) {
-					tex.texture = ImageTexture::create_from_image(img);
-				} else {
-					tex.texture->update(img);
-				}
-				tex.dirty = false;
-			}
+			_font_update_texture(p_font_rid, fd, fd->cache[size]->textures.write[gl[p_glyph | mod].texture_idx]);
 			return fd->cache[size]->textures[gl[p_glyph | mod].texture_idx].texture->get_size();
 		}
 	}
@@ -3150,6 +3334,7 @@ void TextServerAdvanced::_font_clear_kerning_map(const RID &p_font_rid, int64_t
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	_shaped_run_cache_invalidate();
 	Vector2i size = _get_size(fd, p_size);
 
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
@@ -3161,6 +3346,7 @@ void TextServerAdvanced::_font_remove_kerning(const RID &p_font_rid, int64_t p_s
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	_shaped_run_cache_invalidate();
 	Vector2i size = _get_size(fd, p_size);
 
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
@@ -3172,6 +3358,7 @@ void TextServerAdvanced::_font_set_kerning(const RID &p_font_rid, int64_t p_size
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	_shaped_run_cache_invalidate();
 	Vector2i size = _get_size(fd, p_size);
 
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
@@ -3330,27 +3517,22 @@ void TextServerAdvanced::_font_render_range(const RID &p_font_rid, const Vector2
 	MutexLock lock(fd->mutex);
 	Vector2i size = _get_size_outline(fd, p_size);
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
+#ifdef MODULE_MSDFGEN_ENABLED
+	if (fd->msdf && fd->cache[size]->face) {
+		// Distance fields are slow to generate, do the whole range at once.
+		LocalVector<int32_t> glyphs;
+		for (int64_t i = p_start; i <= p_end; i++) {
+			glyphs.push_back(FT_Get_Char_Index(fd->cache[size]->face, i));
+		}
+		_ensure_msdf_glyphs(fd, size, glyphs);
+		return;
+	}
+#endif
 	for (int64_t i = p_start; i <= p_end; i++) {
 #ifdef MODULE_FREETYPE_ENABLED
 		int32_t idx = FT_Get_Char_Index(fd->cache[size]->face, i);
 		if (fd->cache[size]->face) {
-			if (fd->msdf) {
-				_ensure_glyph(fd, size, (int32_t)idx);
-			} else {
-				for (int aa = 0; aa < ((fd->antialiasing == FONT_ANTIALIASING_LCD) ? FONT_LCD_SUBPIXEL_LAYOUT_MAX : 1); aa++) {
-					if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE)) {
-						_ensure_glyph(fd, size, (int32_t)idx | (0 << 27) | (aa << 24));
-						_ensure_glyph(fd, size, (int32_t)idx | (1 << 27) | (aa << 24));
-						_ensure_glyph(fd, size, (int32_t)idx | (2 << 27) | (aa << 24));
-						_ensure_glyph(fd, size, (int32_t)idx | (3 << 27) | (aa << 24));
-					} else if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE)) {
-						_ensure_glyph(fd, size, (int32_t)idx | (1 << 27) | (aa << 24));
-						_ensure_glyph(fd, size, (int32_t)idx | (0 << 27) | (aa << 24));
-					} else {
-						_ensure_glyph(fd, size, (int32_t)idx | (aa << 24));
-					}
-				}
-			}
+			_ensure_glyph_variants(fd, size, idx);
 		}
 #endif
 	}
@@ -3366,27 +3548,86 @@ void TextServerAdvanced::_font_render_glyph(const RID &p_font_rid, const Vector2
 #ifdef MODULE_FREETYPE_ENABLED
 	int32_t idx = p_index & 0xffffff; // Remove subpixel shifts.
 	if (fd->cache[size]->face) {
-		if (fd->msdf) {
-			_ensure_glyph(fd, size, (int32_t)idx);
-		} else {
-			for (int aa = 0; aa < ((fd->antialiasing == FONT_ANTIALIASING_LCD) ? FONT_LCD_SUBPIXEL_LAYOUT_MAX : 1); aa++) {
-				if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE)) {
-					_ensure_glyph(fd, size, (int32_t)idx | (0 << 27) | (aa << 24));
-					_ensure_glyph(fd, size, (int32_t)idx | (1 << 27) | (aa << 24));
-					_ensure_glyph(fd, size, (int32_t)idx | (2 << 27) | (aa << 24));
-					_ensure_glyph(fd, size, (int32_t)idx | (3 << 27) | (aa << 24));
-				} else if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE)) {
-					_ensure_glyph(fd, size, (int32_t)idx | (1 << 27) | (aa << 24));
-					_ensure_glyph(fd, size, (int32_t)idx | (0 << 27) | (aa << 24));
-				} else {
-					_ensure_glyph(fd, size, (int32_t)idx | (aa << 24));
-				}
-			}
-		}
+		_ensure_glyph_variants(fd, size, idx);
 	}
 #endif
 }
 
+void TextServerAdvanced::_font_render_characters_threaded(void *p_task) {
+	GlyphRenderTask *task = (GlyphRenderTask *)p_task;
+	FontAdvanced *fd = task->font_data;
+
+	// Lock for each character only, so drawing with the same font is not blocked for the whole set.
+	for (int i = 0; i < task->characters.length() && !fd->render_tasks_cancel.is_set(); i++) {
+		MutexLock lock(fd->mutex);
+		if (!fd->cache.has(task->size)) {
+			break; // Size cache was cleared, faces are only created on the calling thread.
+		}
+#ifdef MODULE_FREETYPE_ENABLED
+		FontForSizeAdvanced *ffsd = fd->cache[task->size];
+		if (ffsd->face) {
+			int32_t idx = FT_Get_Char_Index(ffsd->face, task->characters[i]);
+			task->ts->_ensure_glyph_variants(fd, task->size, idx);
+		}
+#endif
+	}
+	memdelete(task);
+}
+
+void TextServerAdvanced::_font_reap_render_tasks(FontAdvanced *p_font_data) const {
+	for (int i = p_font_data->render_tasks.size() - 1; i >= 0; i--) {
+		if (WorkerThreadPool::get_singleton()->is_task_completed(p_font_data->render_tasks[i])) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(p_font_data->render_tasks[i]);
+			p_font_data->render_tasks.remove_at(i);
+		}
+	}
+}
+
+void TextServerAdvanced::_font_wait_render_tasks(FontAdvanced *p_font_data) const {
+	Vector<int64_t> tasks;
+	{
+		MutexLock lock(p_font_data->mutex);
+		SWAP(tasks, p_font_data->render_tasks);
+	}
+	// Tasks lock the font for every character, wait without holding it.
+	for (int i = 0; i < tasks.size(); i++) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(tasks[i]);
+	}
+}
+
+void TextServerAdvanced::font_render_characters_threaded(const RID &p_font_rid, const Vector2i &p_size, const String &p_characters) {
+	FontAdvanced *fd = font_owner.get_or_null(p_font_rid);
+	ERR_FAIL_COND(!fd);
+
+	MutexLock lock(fd->mutex);
+	Vector2i size = _get_size_outline(fd, p_size);
+	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
+	_font_reap_render_tasks(fd);
+
+	GlyphRenderTask *task = memnew(GlyphRenderTask);
+	task->ts = this;
+	task->font_data = fd;
+	task->size = size;
+	task->characters = p_characters;
+	fd->render_tasks.push_back(WorkerThreadPool::get_singleton()->add_native_task(&TextServerAdvanced::_font_render_characters_threaded, task, false, String("FontServerRenderGlyphs")));
+}
+
+bool TextServerAdvanced::font_is_rendering_threaded(const RID &p_font_rid) const {
+	FontAdvanced *fd = font_owner.get_or_null(p_font_rid);
+	ERR_FAIL_COND_V(!fd, false);
+
+	MutexLock lock(fd->mutex);
+	_font_reap_render_tasks(fd);
+	return !fd->render_tasks.is_empty();
+}
+
+void TextServerAdvanced::font_wait_for_threaded_render(const RID &p_font_rid) {
+	FontAdvanced *fd = font_owner.get_or_null(p_font_rid);
+	ERR_FAIL_COND(!fd);
+
+	_font_wait_render_tasks(fd);
+}
+
 void TextServerAdvanced::_font_draw_glyph(const RID &p_font_rid, const RID &p_canvas, int64_t p_size, const Vector2 &p_pos, int64_t p_index, const Color &p_color) const {
 	FontAdvanced *fd = font_owner.get_or_null(p_font_rid);
 	ERR_FAIL_COND(!fd);
@@ -3435,19 +3676,7 @@ void TextServerAdvanced::_font_draw_glyph(const RID &p_font_rid, const RID &p_ca
 			}
 #endif
 			if (RenderingServer::get_singleton() != nullptr) {
-				if (fd->cache[size]->textures[gl.texture_idx].dirty) {
-					ShelfPackTexture &tex = fd->cache[size]->textures.write[gl.texture_idx];
-					Ref<Image> img = Image::create_from_data(tex.texture_w, tex.texture_h, false, tex.format, tex.imgdata);
-					if (fd->mipmaps) {
-						img->generate_mipmaps();
-					}
-					if (tex.texture.is_null()) {
-						tex.texture = ImageTexture::create_from_image(img);
-					} else {
-						tex.texture->update(img);
-					}
-					tex.dirty = false;
-				}
+				_font_update_texture(p_font_rid, fd, fd->cache[size]->textures.write[gl.texture_idx]);
 				RID texture = fd->cache[size]->textures[gl.texture_idx].texture->get_rid();
 				if (fd->msdf) {
 					Point2 cpos = p_pos;
@@ -3527,19 +3756,7 @@ void TextServerAdvanced::_font_draw_glyph_outline(const RID &p_font_rid, const R
 			}
 #endif
 			if (RenderingServer::get_singleton() != nullptr) {
-				if (fd->cache[size]->textures[gl.texture_idx].dirty) {
-					ShelfPackTexture &tex = fd->cache[size]->textures.write[gl.texture_idx];
-					Ref<Image> img = Image::create_from_data(tex.texture_w, tex.texture_h, false, tex.format, tex.imgdata);
-					if (fd->mipmaps) {
-						img->generate_mipmaps();
-					}
-					if (tex.texture.is_null()) {
-						tex.texture = ImageTexture::create_from_image(img);
-					} else {
-						tex.texture->update(img);
-					}
-					tex.dirty = false;
-				}
+				_font_update_texture(p_font_rid, fd, fd->cache[size]->textures.write[gl.texture_idx]);
 				RID texture = fd->cache[size]->textures[gl.texture_idx].texture->get_rid();
 				if (fd->msdf) {
 					Point2 cpos = p_pos;
@@ -3674,6 +3891,7 @@ void TextServerAdvanced::_font_set_opentype_feature_overrides(const RID &p_font_
 	ERR_FAIL_COND(!fd);
 
 	MutexLock lock(fd->mutex);
+	_shaped_run_cache_invalidate();
 	Vector2i size = _get_size(fd, 16);
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
 	fd->feature_overrides = p_overrides;
@@ -4253,7 +4471,6 @@ void TextServerAdvanced::_realign(ShapedTextDataAdvanced *p_sd) const {
 }
 
 RID TextServerAdvanced::_shaped_text_substr(const RID &p_shaped, int64_t p_start, int64_t p_length) const {
-	_THREAD_SAFE_METHOD_
 	const ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_COND_V(!sd, RID());
 
@@ -5429,6 +5646,7 @@ void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_star
 		// Try system fallback.
 		RID fdef = p_fonts[0];
 		if (_font_is_allow_system_fallback(fdef)) {
+			MutexLock sys_lock(system_font_mutex);
 			_update_chars(p_sd);
 
 			int64_t next = p_end;
@@ -5635,17 +5853,12 @@ void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_star
 
 	FontAdvanced *fd = font_owner.get_or_null(f);
 	ERR_FAIL_COND(!fd);
-	MutexLock lock(fd->mutex);
-
-	Vector2i fss = _get_size(fd, fs);
-	hb_font_t *hb_font = _font_get_hb_handle(f, fs);
 	double scale = _font_get_scale(f, fs);
 	double sp_sp = p_sd->extra_spacing[SPACING_SPACE] + _font_get_spacing(f, SPACING_SPACE);
 	double sp_gl = p_sd->extra_spacing[SPACING_GLYPH] + _font_get_spacing(f, SPACING_GLYPH);
 	bool last_run = (p_sd->end == p_end);
 	double ea = _get_extra_advance(f, fs);
 	bool subpos = (scale != 1.0) || (_font_get_subpixel_positioning(f) == SUBPIXEL_POSITIONING_ONE_HALF) || (_font_get_subpixel_positioning(f) == SUBPIXEL_POSITIONING_ONE_QUARTER) || (_font_get_subpixel_positioning(f) == SUBPIXEL_POSITIONING_AUTO && fs <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE);
-	ERR_FAIL_COND(hb_font == nullptr);
 
 	hb_buffer_clear_contents(p_sd->hb_buffer);
 	hb_buffer_set_direction(p_sd->hb_buffer, p_direction);
@@ -5675,12 +5888,6 @@ void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_star
 	_add_featuers(_font_get_opentype_feature_overrides(f), ftrs);
 	_add_featuers(p_sd->spans[p_span].features, ftrs);
 
-	hb_shape(hb_font, p_sd->hb_buffer, ftrs.is_empty() ? nullptr : &ftrs[0], ftrs.size());
-
-	unsigned int glyph_count = 0;
-	hb_glyph_info_t *glyph_info = hb_buffer_get_glyph_infos(p_sd->hb_buffer, &glyph_count);
-	hb_glyph_position_t *glyph_pos = hb_buffer_get_glyph_positions(p_sd->hb_buffer, &glyph_count);
-
 	int mod = 0;
 	if (fd->antialiasing == FONT_ANTIALIASING_LCD) {
 		TextServer::FontLCDSubpixelLayout layout = (TextServer::FontLCDSubpixelLayout)(int)GLOBAL_GET("gui/theme/lcd_subpixel_layout");
@@ -5689,104 +5896,122 @@ void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_star
 		}
 	}
 
-	// Process glyphs.
-	if (glyph_count > 0) {
-		Glyph *w = (Glyph *)memalloc(glyph_count * sizeof(Glyph));
-
-		int end = (p_direction == HB_DIRECTION_RTL || p_direction == HB_DIRECTION_BTT) ? p_end : 0;
-		uint32_t last_cluster_id = UINT32_MAX;
-		unsigned int last_cluster_index = 0;
-		bool last_cluster_valid = true;
-
-		for (unsigned int i = 0; i < glyph_count; i++) {
-			if ((i > 0) && (last_cluster_id != glyph_info[i].cluster)) {
-				if (p_direction == HB_DIRECTION_RTL || p_direction == HB_DIRECTION_BTT) {
-					end = w[last_cluster_index].start;
-				} else {
-					for (unsigned int j = last_cluster_index; j < i; j++) {
-						w[j].end = glyph_info[i].cluster;
+	unsigned int glyph_count = 0;
+	Glyph *w = nullptr;
+	{
+		// HarfBuzz and the glyph cache use the FT_Face of this size, which glyph queries from other threads share.
+		// The lock is released before the fallback fonts are shaped, other threads may take them in a different order.
+		MutexLock lock(fd->mutex);
+		Vector2i fss = _get_size(fd, fs);
+		hb_font_t *hb_font = _font_get_hb_handle(f, fs);
+		ERR_FAIL_COND(hb_font == nullptr);
+
+		hb_shape(hb_font, p_sd->hb_buffer, ftrs.is_empty() ? nullptr : &ftrs[0], ftrs.size());
+
+		hb_glyph_info_t *glyph_info = hb_buffer_get_glyph_infos(p_sd->hb_buffer, &glyph_count);
+		hb_glyph_position_t *glyph_pos = hb_buffer_get_glyph_positions(p_sd->hb_buffer, &glyph_count);
+
+		// Process glyphs.
+		if (glyph_count > 0) {
+			w = (Glyph *)memalloc(glyph_count * sizeof(Glyph));
+
+			int end = (p_direction == HB_DIRECTION_RTL || p_direction == HB_DIRECTION_BTT) ? p_end : 0;
+			uint32_t last_cluster_id = UINT32_MAX;
+			unsigned int last_cluster_index = 0;
+			bool last_cluster_valid = true;
+
+			for (unsigned int i = 0; i < glyph_count; i++) {
+				if ((i > 0) && (last_cluster_id != glyph_info[i].cluster)) {
+					if (p_direction == HB_DIRECTION_RTL || p_direction == HB_DIRECTION_BTT) {
+						end = w[last_cluster_index].start;
+					} else {
+						for (unsigned int j = last_cluster_index; j < i; j++) {
+							w[j].end = glyph_info[i].cluster;
+						}
 					}
+					if (p_direction == HB_DIRECTION_RTL || p_direction == HB_DIRECTION_BTT) {
+						w[last_cluster_index].flags |= GRAPHEME_IS_RTL;
+					}
+					if (last_cluster_valid) {
+						w[last_cluster_index].flags |= GRAPHEME_IS_VALID;
+					}
+					w[last_cluster_index].count = i - last_cluster_index;
+					last_cluster_index = i;
+					last_cluster_valid = true;
 				}
-				if (p_direction == HB_DIRECTION_RTL || p_direction == HB_DIRECTION_BTT) {
-					w[last_cluster_index].flags |= GRAPHEME_IS_RTL;
-				}
-				if (last_cluster_valid) {
-					w[last_cluster_index].flags |= GRAPHEME_IS_VALID;
-				}
-				w[last_cluster_index].count = i - last_cluster_index;
-				last_cluster_index = i;
-				last_cluster_valid = true;
-			}
 
-			last_cluster_id = glyph_info[i].cluster;
+				last_cluster_id = glyph_info[i].cluster;
 
-			Glyph &gl = w[i];
-			gl = Glyph();
+				Glyph &gl = w[i];
+				gl = Glyph();
 
-			gl.start = glyph_info[i].cluster;
-			gl.end = end;
-			gl.count = 0;
+				gl.start = glyph_info[i].cluster;
+				gl.end = end;
+				gl.count = 0;
 
-			gl.font_rid = f;
-			gl.font_size = fs;
+				gl.font_rid = f;
+				gl.font_size = fs;
 
-			if (glyph_info[i].mask & HB_GLYPH_FLAG_UNSAFE_TO_BREAK) {
-				gl.flags |= GRAPHEME_IS_CONNECTED;
-			}
+				if (glyph_info[i].mask & HB_GLYPH_FLAG_UNSAFE_TO_BREAK) {
+					gl.flags |= GRAPHEME_IS_CONNECTED;
+				}
 
-#if HB_VERSION_ATLEAST(5, 1, 0)
-			if (glyph_info[i].mask & HB_GLYPH_FLAG_SAFE_TO_INSERT_TATWEEL) {
-				gl.flags |= GRAPHEME_IS_SAFE_TO_INSERT_TATWEEL;
-			}
-#endif
+	#if HB_VERSION_ATLEAST(5, 1, 0)
+				if (glyph_info[i].mask & HB_GLYPH_FLAG_SAFE_TO_INSERT_TATWEEL) {
+					gl.flags |= GRAPHEME_IS_SAFE_TO_INSERT_TATWEEL;
+				}
+	#endif
 
-			gl.index = glyph_info[i].codepoint;
-			if (gl.index != 0) {
-				_ensure_glyph(fd, fss, gl.index | mod);
-				if (p_sd->orientation == ORIENTATION_HORIZONTAL) {
+				gl.index = glyph_info[i].codepoint;
+				if (gl.index != 0) {
+					_ensure_glyph(fd, fss, gl.index | mod);
+					if (p_sd->orientation == ORIENTATION_HORIZONTAL) {
+						if (subpos) {
+							gl.advance = (double)glyph_pos[i].x_advance / (64.0 / scale) + ea;
+						} else {
+							gl.advance = Math::round((double)glyph_pos[i].x_advance / (64.0 / scale) + ea);
+						}
+					} else {
+						gl.advance = -Math::round((double)glyph_pos[i].y_advance / (64.0 / scale));
+					}
 					if (subpos) {
-						gl.advance = (double)glyph_pos[i].x_advance / (64.0 / scale) + ea;
+						gl.x_off = (double)glyph_pos[i].x_offset / (64.0 / scale);
 					} else {
-						gl.advance = Math::round((double)glyph_pos[i].x_advance / (64.0 / scale) + ea);
+						gl.x_off = Math::round((double)glyph_pos[i].x_offset / (64.0 / scale));
 					}
-				} else {
-					gl.advance = -Math::round((double)glyph_pos[i].y_advance / (64.0 / scale));
+					gl.y_off = -Math::round((double)glyph_pos[i].y_offset / (64.0 / scale));
 				}
-				if (subpos) {
-					gl.x_off = (double)glyph_pos[i].x_offset / (64.0 / scale);
+				if (!last_run || i < glyph_count - 1) {
+					// Do not add extra spacing to the last glyph of the string.
+					if (sp_sp && is_whitespace(p_sd->text[glyph_info[i].cluster])) {
+						gl.advance += sp_sp;
+					} else {
+						gl.advance += sp_gl;
+					}
+				}
+
+				if (p_sd->preserve_control) {
+					last_cluster_valid = last_cluster_valid && ((glyph_info[i].codepoint != 0) || (p_sd->text[glyph_info[i].cluster] == 0x0009) || (u_isblank(p_sd->text[glyph_info[i].cluster]) && (gl.advance != 0)) || (!u_isblank(p_sd->text[glyph_info[i].cluster]) && is_linebreak(p_sd->text[glyph_info[i].cluster])));
 				} else {
-					gl.x_off = Math::round((double)glyph_pos[i].x_offset / (64.0 / scale));
+					last_cluster_valid = last_cluster_valid && ((glyph_info[i].codepoint != 0) || (p_sd->text[glyph_info[i].cluster] == 0x0009) || (u_isblank(p_sd->text[glyph_info[i].cluster]) && (gl.advance != 0)) || (!u_isblank(p_sd->text[glyph_info[i].cluster]) && !u_isgraph(p_sd->text[glyph_info[i].cluster])));
 				}
-				gl.y_off = -Math::round((double)glyph_pos[i].y_offset / (64.0 / scale));
 			}
-			if (!last_run || i < glyph_count - 1) {
-				// Do not add extra spacing to the last glyph of the string.
-				if (sp_sp && is_whitespace(p_sd->text[glyph_info[i].cluster])) {
-					gl.advance += sp_sp;
-				} else {
-					gl.advance += sp_gl;
+			if (p_direction == HB_DIRECTION_LTR || p_direction == HB_DIRECTION_TTB) {
+				for (unsigned int j = last_cluster_index; j < glyph_count; j++) {
+					w[j].end = p_end;
 				}
 			}
-
-			if (p_sd->preserve_control) {
-				last_cluster_valid = last_cluster_valid && ((glyph_info[i].codepoint != 0) || (p_sd->text[glyph_info[i].cluster] == 0x0009) || (u_isblank(p_sd->text[glyph_info[i].cluster]) && (gl.advance != 0)) || (!u_isblank(p_sd->text[glyph_info[i].cluster]) && is_linebreak(p_sd->text[glyph_info[i].cluster])));
-			} else {
-				last_cluster_valid = last_cluster_valid && ((glyph_info[i].codepoint != 0) || (p_sd->text[glyph_info[i].cluster] == 0x0009) || (u_isblank(p_sd->text[glyph_info[i].cluster]) && (gl.advance != 0)) || (!u_isblank(p_sd->text[glyph_info[i].cluster]) && !u_isgraph(p_sd->text[glyph_info[i].cluster])));
+			w[last_cluster_index].count = glyph_count - last_cluster_index;
+			if (p_direction == HB_DIRECTION_RTL || p_direction == HB_DIRECTION_BTT) {
+				w[last_cluster_index].flags |= GRAPHEME_IS_RTL;
 			}
-		}
-		if (p_direction == HB_DIRECTION_LTR || p_direction == HB_DIRECTION_TTB) {
-			for (unsigned int j = last_cluster_index; j < glyph_count; j++) {
-				w[j].end = p_end;
+			if (last_cluster_valid) {
+				w[last_cluster_index].flags |= GRAPHEME_IS_VALID;
 			}
 		}
-		w[last_cluster_index].count = glyph_count - last_cluster_index;
-		if (p_direction == HB_DIRECTION_RTL || p_direction == HB_DIRECTION_BTT) {
-			w[last_cluster_index].flags |= GRAPHEME_IS_RTL;
-		}
-		if (last_cluster_valid) {
-			w[last_cluster_index].flags |= GRAPHEME_IS_VALID;
-		}
+	}
 
+	if (glyph_count > 0) {
 		// Fallback.
 		int failed_subrun_start = p_end + 1;
 		int failed_subrun_end = p_start;
@@ -5833,8 +6058,156 @@ void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_star
 	}
 }
 
+void TextServerAdvanced::_shape_run_cached(ShapedTextDataAdvanced *p_sd, int64_t p_start, int64_t p_end, hb_script_t p_script, hb_direction_t p_direction, const Array &p_fonts, int64_t p_span) {
+	bool cached = p_end - p_start <= SHAPED_RUN_CACHE_MAX_LENGTH;
+	if (cached) {
+		MutexLock cache_lock(shaped_run_cache_mutex);
+		cached = shaped_run_cache_capacity > 0;
+	}
+	if (!cached) {
+		_shape_run(p_sd, p_start, p_end, p_script, p_direction, p_fonts, p_span, 0, 0, 0);
+		return;
+	}
+
+	const ShapedTextDataAdvanced::Span &span = p_sd->spans[p_span];
+
+	ShapedRunKey key;
+	int64_t context_start = MAX(p_start - SHAPED_RUN_CONTEXT_LENGTH, 0);
+	int64_t context_end = MIN(p_end + SHAPED_RUN_CONTEXT_LENGTH, (int64_t)p_sd->text.length());
+	key.text = p_sd->text.substr(context_start, context_end - context_start);
+	key.offset = p_start - context_start;
+	key.length = p_end - p_start;
+	key.fonts.resize(p_fonts.size());
+	for (int i = 0; i < p_fonts.size(); i++) {
+		key.fonts.write[i] = p_fonts[i];
+	}
+	key.font_size = span.font_size;
+	key.features = span.features;
+	key.language = span.language.is_empty() ? TranslationServer::get_singleton()->get_tool_locale() : span.language;
+	key.script = p_script;
+	key.direction = p_direction;
+	key.flags = ((int)p_sd->orientation) | ((int)p_sd->preserve_control << 1) | ((int)p_sd->preserve_invalid << 2) | ((int)(p_start == 0) << 3) | ((int)(p_end == p_sd->text.length()) << 4) | ((int)(p_sd->end == p_end) << 5);
+	key.extra_spacing[0] = p_sd->extra_spacing[SPACING_SPACE];
+	key.extra_spacing[1] = p_sd->extra_spacing[SPACING_GLYPH];
+
+	int64_t offset = p_start + p_sd->start;
+	uint64_t version = 0;
+	{
+		MutexLock cache_lock(shaped_run_cache_mutex);
+		version = shaped_run_cache_version.get();
+		if (shaped_run_cache_cleared_version != version) {
+			shaped_run_cache_cleared_version = version;
+			shaped_run_map.clear();
+			shaped_run_list.clear();
+		}
+
+		List<ShapedRun>::Element **E = shaped_run_map.getptr(key);
+		if (E) {
+			shaped_run_cache_hits++;
+			shaped_run_list.move_to_front(*E);
+
+			const ShapedRun &run = (*E)->get();
+			for (int i = 0; i < run.glyphs.size(); i++) {
+				Glyph gl = run.glyphs[i];
+				gl.start += offset;
+				gl.end += offset;
+				p_sd->glyphs.push_back(gl);
+			}
+			p_sd->width += run.width;
+			p_sd->ascent = MAX(p_sd->ascent, run.ascent);
+			p_sd->descent = MAX(p_sd->descent, run.descent);
+			p_sd->upos = MAX(p_sd->upos, run.upos);
+			p_sd->uthk = MAX(p_sd->uthk, run.uthk);
+			return;
+		}
+		shaped_run_cache_misses++;
+	}
+
+	// Shape from zeroed metrics to record the contribution of this run alone, the results are combined with MAX so this is equivalent.
+	int glyph_start = p_sd->glyphs.size();
+	double width = p_sd->width;
+	double ascent = p_sd->ascent;
+	double descent = p_sd->descent;
+	double upos = p_sd->upos;
+	double uthk = p_sd->uthk;
+	p_sd->ascent = 0.0;
+	p_sd->descent = 0.0;
+	p_sd->upos = 0.0;
+	p_sd->uthk = 0.0;
+
+	_shape_run(p_sd, p_start, p_end, p_script, p_direction, p_fonts, p_span, 0, 0, 0);
+
+	ShapedRun run;
+	run.key = key;
+	run.key.features = span.features.duplicate();
+	run.glyphs.resize(p_sd->glyphs.size() - glyph_start);
+	for (int i = 0; i < run.glyphs.size(); i++) {
+		Glyph gl = p_sd->glyphs[glyph_start + i];
+		gl.start -= offset;
+		gl.end -= offset;
+		run.glyphs.write[i] = gl;
+	}
+	run.width = p_sd->width - width;
+	run.ascent = p_sd->ascent;
+	run.descent = p_sd->descent;
+	run.upos = p_sd->upos;
+	run.uthk = p_sd->uthk;
+
+	p_sd->ascent = MAX(ascent, run.ascent);
+	p_sd->descent = MAX(descent, run.descent);
+	p_sd->upos = MAX(upos, run.upos);
+	p_sd->uthk = MAX(uthk, run.uthk);
+
+	MutexLock cache_lock(shaped_run_cache_mutex);
+	if (version != shaped_run_cache_version.get() || shaped_run_cache_capacity <= 0 || shaped_run_map.has(run.key)) {
+		return; // Fonts changed, the cache was disabled or another thread shaped the same run meanwhile.
+	}
+	if (shaped_run_list.size() >= shaped_run_cache_capacity) {
+		shaped_run_map.erase(shaped_run_list.back()->get().key);
+		shaped_run_list.pop_back();
+	}
+	shaped_run_list.push_front(run);
+	shaped_run_map.insert(run.key, shaped_run_list.front());
+}
+
+int64_t TextServerAdvanced::shaped_run_cache_get_hit_count() const {
+	MutexLock cache_lock(shaped_run_cache_mutex);
+	return shaped_run_cache_hits;
+}
+
+int64_t TextServerAdvanced::shaped_run_cache_get_miss_count() const {
+	MutexLock cache_lock(shaped_run_cache_mutex);
+	return shaped_run_cache_misses;
+}
+
+int64_t TextServerAdvanced::shaped_run_cache_get_size() const {
+	MutexLock cache_lock(shaped_run_cache_mutex);
+	return shaped_run_list.size();
+}
+
+void TextServerAdvanced::shaped_run_cache_set_capacity(int64_t p_capacity) {
+	MutexLock cache_lock(shaped_run_cache_mutex);
+	shaped_run_cache_capacity = p_capacity;
+	while (shaped_run_list.size() > MAX(shaped_run_cache_capacity, 0)) {
+		shaped_run_map.erase(shaped_run_list.back()->get().key);
+		shaped_run_list.pop_back();
+	}
+}
+
+int64_t TextServerAdvanced::shaped_run_cache_get_capacity() const {
+	MutexLock cache_lock(shaped_run_cache_mutex);
+	return shaped_run_cache_capacity;
+}
+
+void TextServerAdvanced::shaped_run_cache_clear() {
+	MutexLock cache_lock(shaped_run_cache_mutex);
+	shaped_run_map.clear();
+	shaped_run_list.clear();
+	shaped_run_cache_hits = 0;
+	shaped_run_cache_misses = 0;
+}
+
 bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
-	_THREAD_SAFE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_COND_V(!sd, false);
 
@@ -6037,7 +6410,7 @@ bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 							}
 							fonts.append_array(fonts_scr_only);
 							fonts.append_array(fonts_no_match);
-							_shape_run(sd, MAX(sd->spans[k].start - sd->start, script_run_start), MIN(sd->spans[k].end - sd->start, script_run_end), sd->script_iter->script_ranges[j].script, bidi_run_direction, fonts, k, 0, 0, 0);
+							_shape_run_cached(sd, MAX(sd->spans[k].start - sd->start, script_run_start), MIN(sd->spans[k].end - sd->start, script_run_end), sd->script_iter->script_ranges[j].script, bidi_run_direction, fonts, k);
 						}
 					}
 				}
@@ -6926,6 +7299,19 @@ bool TextServerAdvanced::_is_valid_identifier(const String &p_string) const {
 	return true;
 }
 
+void TextServerAdvanced::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("shaped_run_cache_get_hit_count"), &TextServerAdvanced::shaped_run_cache_get_hit_count);
+	ClassDB::bind_method(D_METHOD("shaped_run_cache_get_miss_count"), &TextServerAdvanced::shaped_run_cache_get_miss_count);
+	ClassDB::bind_method(D_METHOD("shaped_run_cache_get_size"), &TextServerAdvanced::shaped_run_cache_get_size);
+	ClassDB::bind_method(D_METHOD("shaped_run_cache_set_capacity", "capacity"), &TextServerAdvanced::shaped_run_cache_set_capacity);
+	ClassDB::bind_method(D_METHOD("shaped_run_cache_get_capacity"), &TextServerAdvanced::shaped_run_cache_get_capacity);
+	ClassDB::bind_method(D_METHOD("shaped_run_cache_clear"), &TextServerAdvanced::shaped_run_cache_clear);
+
+	ClassDB::bind_method(D_METHOD("font_render_characters_threaded", "font_rid", "size", "characters"), &TextServerAdvanced::font_render_characters_threaded);
+	ClassDB::bind_method(D_METHOD("font_is_rendering_threaded", "font_rid"), &TextServerAdvanced::font_is_rendering_threaded);
+	ClassDB::bind_method(D_METHOD("font_wait_for_threaded_render", "font_rid"), &TextServerAdvanced::font_wait_for_threaded_render);
+}
+
 TextServerAdvanced::TextServerAdvanced() {
 	_insert_num_systems_lang();
 	_insert_feature_sets();
@@ -6933,6 +7319,7 @@ TextServerAdvanced::TextServerAdvanced() {
 }
 
 void TextServerAdvanced::_cleanup() {
+	MutexLock sys_lock(system_font_mutex);
 	_THREAD_SAFE_METHOD_
 	for (const KeyValue<SystemFontKey, SystemFontCache> &E : system_fonts) {
 		const Vector<SystemFontCacheRec> &sysf_cache = E.value.var;
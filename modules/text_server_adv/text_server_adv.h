@@ -73,6 +73,7 @@
 
 #include <godot_cpp/templates/hash_map.hpp>
 #include <godot_cpp/templates/hash_set.hpp>
+#include <godot_cpp/templates/list.hpp>
 #include <godot_cpp/templates/rid_owner.hpp>
 #include <godot_cpp/templates/vector.hpp>
 
@@ -84,6 +85,7 @@ using namespace godot;
 #include "core/extension/ext_wrappers.gen.inc"
 #include "core/object/worker_thread_pool.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/list.h"
 #include "core/templates/rid_owner.h"
 #include "scene/resources/image_texture.h"
 #include "servers/text/text_server_extension.h"
@@ -335,6 +337,10 @@ class TextServerAdvanced : public TextServerExtension {
 		size_t data_size;
 		int face_index = 0;
 
+		// Threaded glyph rendering tasks, guarded by mutex.
+		Vector<int64_t> render_tasks;
+		SafeFlag render_tasks_cancel;
+
 		~FontAdvanced() {
 			for (const KeyValue<Vector2i, FontForSizeAdvanced *> &E : cache) {
 				memdelete(E.value);
@@ -345,16 +351,46 @@ class TextServerAdvanced : public TextServerExtension {
 
 	_FORCE_INLINE_ FontTexturePosition find_texture_pos_for_glyph(FontForSizeAdvanced *p_data, int p_color_size, Image::Format p_image_format, int p_width, int p_height, bool p_msdf) const;
 #ifdef MODULE_MSDFGEN_ENABLED
+	// Shape and distance field of a glyph, generated apart from the atlas so several glyphs can be generated at once.
+	struct MSDFGlyphData;
+
+	static bool _msdf_prepare(MSDFGlyphData &r_data, FT_Outline *p_outline);
+	static void _msdf_generate(MSDFGlyphData &r_data, bool p_threaded);
+	static void _msdf_generate_threaded(void *p_td, uint32_t p_index);
+	FontGlyph _msdf_store(FontForSizeAdvanced *p_data, int p_rect_margin, const MSDFGlyphData &p_glyph) const;
 	_FORCE_INLINE_ FontGlyph rasterize_msdf(FontAdvanced *p_font_data, FontForSizeAdvanced *p_data, int p_pixel_range, int p_rect_margin, FT_Outline *outline, const Vector2 &advance) const;
+	void _ensure_msdf_glyphs(FontAdvanced *p_font_data, const Vector2i &p_size, const LocalVector<int32_t> &p_glyphs) const;
 #endif
 #ifdef MODULE_FREETYPE_ENABLED
 	_FORCE_INLINE_ FontGlyph rasterize_bitmap(FontForSizeAdvanced *p_data, int p_rect_margin, FT_Bitmap bitmap, int yofs, int xofs, const Vector2 &advance, bool p_bgra) const;
+	_FORCE_INLINE_ FT_Int32 _get_glyph_load_flags(FontAdvanced *p_font_data, FT_Face p_face, bool p_outline) const;
+	_FORCE_INLINE_ void _apply_glyph_outline_transform(FontAdvanced *p_font_data, const Vector2i &p_size, FT_Outline *p_outline) const;
 #endif
 	_FORCE_INLINE_ bool _ensure_glyph(FontAdvanced *p_font_data, const Vector2i &p_size, int32_t p_glyph) const;
+	_FORCE_INLINE_ void _ensure_glyph_variants(FontAdvanced *p_font_data, const Vector2i &p_size, int32_t p_index) const;
 	_FORCE_INLINE_ bool _ensure_cache_for_size(FontAdvanced *p_font_data, const Vector2i &p_size) const;
 	_FORCE_INLINE_ void _font_clear_cache(FontAdvanced *p_font_data);
 	static void _generateMTSDF_threaded(void *p_td, uint32_t p_y);
 
+	struct GlyphRenderTask {
+		TextServerAdvanced *ts = nullptr;
+		FontAdvanced *font_data = nullptr;
+		Vector2i size;
+		String characters;
+	};
+
+	static void _font_render_characters_threaded(void *p_task);
+	void _font_reap_render_tasks(FontAdvanced *p_font_data) const;
+	void _font_wait_render_tasks(FontAdvanced *p_font_data) const;
+
+	// Font textures that changed since the last frame, uploaded once before drawing instead of after every new glyph.
+	mutable Mutex dirty_texture_mutex;
+	mutable HashSet<RID> dirty_texture_fonts;
+	mutable bool dirty_texture_update_connected = false;
+
+	void _font_update_texture(const RID &p_font_rid, FontAdvanced *p_font_data, ShelfPackTexture &p_tex) const;
+	void _update_dirty_textures();
+
 	_FORCE_INLINE_ Vector2i _get_size(const FontAdvanced *p_font_data, int p_size) const {
 		if (p_font_data->msdf) {
 			return Vector2i(p_font_data->msdf_source_size, 0);
@@ -534,8 +570,9 @@ class TextServerAdvanced : public TextServerExtension {
 	// Common data.
 
 	double oversampling = 1.0;
-	mutable RID_PtrOwner<FontAdvanced> font_owner;
-	mutable RID_PtrOwner<ShapedTextDataAdvanced> shaped_owner;
+	// Shaped texts are shaped on several threads at once, each locking its own data.
+	mutable RID_PtrOwner<FontAdvanced, true> font_owner;
+	mutable RID_PtrOwner<ShapedTextDataAdvanced, true> shaped_owner;
 
 	struct SystemFontKey {
 		String font_name;
@@ -621,6 +658,72 @@ class TextServerAdvanced : public TextServerExtension {
 	};
 	mutable HashMap<SystemFontKey, SystemFontCache, SystemFontKeyHasher> system_fonts;
 	mutable HashMap<String, PackedByteArray> system_font_data;
+	mutable Mutex system_font_mutex;
+
+	// Cache of shaped runs, shared by all shaped texts and reused across frames.
+	// Runs are keyed by their text with the surrounding shaping context, and everything _shape_run reads from the shaped text.
+	const int64_t SHAPED_RUN_CACHE_MAX_LENGTH = 256; // Longer runs rarely repeat.
+	const int64_t SHAPED_RUN_CONTEXT_LENGTH = 5; // Characters of context HarfBuzz looks at before and after a run.
+
+	struct ShapedRunKey {
+		String text; // Run with up to SHAPED_RUN_CONTEXT_LENGTH characters of context on each side.
+		int64_t offset = 0; // Start of the run in text.
+		int64_t length = 0;
+		Vector<RID> fonts;
+		int font_size = 0;
+		Dictionary features;
+		String language;
+		hb_script_t script = HB_SCRIPT_UNKNOWN;
+		hb_direction_t direction = HB_DIRECTION_INVALID;
+		int flags = 0; // Orientation, preserve and text boundary flags.
+		int extra_spacing[2] = { 0, 0 }; // Space and glyph.
+
+		bool operator==(const ShapedRunKey &p_b) const {
+			return (offset == p_b.offset) && (length == p_b.length) && (font_size == p_b.font_size) && (script == p_b.script) && (direction == p_b.direction) && (flags == p_b.flags) && (extra_spacing[0] == p_b.extra_spacing[0]) && (extra_spacing[1] == p_b.extra_spacing[1]) && (text == p_b.text) && (fonts == p_b.fonts) && (language == p_b.language) && (features == p_b.features);
+		}
+	};
+
+	struct ShapedRunKeyHasher {
+		_FORCE_INLINE_ static uint32_t hash(const ShapedRunKey &p_a) {
+			uint32_t hash = p_a.text.hash();
+			hash = hash_murmur3_one_64(p_a.offset, hash);
+			hash = hash_murmur3_one_64(p_a.length, hash);
+			for (int i = 0; i < p_a.fonts.size(); i++) {
+				hash = hash_murmur3_one_64(p_a.fonts[i].get_id(), hash);
+			}
+			hash = hash_murmur3_one_32(p_a.font_size, hash);
+			hash = hash_murmur3_one_32(p_a.features.hash(), hash);
+			hash = hash_murmur3_one_32(p_a.language.hash(), hash);
+			hash = hash_murmur3_one_32(p_a.script, hash);
+			hash = hash_murmur3_one_32(p_a.direction, hash);
+			hash = hash_murmur3_one_32(p_a.extra_spacing[0], hash);
+			hash = hash_murmur3_one_32(p_a.extra_spacing[1], hash);
+			return hash_fmix32(hash_murmur3_one_32(p_a.flags, hash));
+		}
+	};
+
+	struct ShapedRun {
+		ShapedRunKey key;
+		Vector<Glyph> glyphs; // Start and end are relative to the start of the run.
+		double width = 0.0;
+		double ascent = 0.0;
+		double descent = 0.0;
+		double upos = 0.0;
+		double uthk = 0.0;
+	};
+
+	mutable Mutex shaped_run_cache_mutex; // Guards the list, map and counters, runs are shaped without it.
+	List<ShapedRun> shaped_run_list; // Most recently used first.
+	HashMap<ShapedRunKey, List<ShapedRun>::Element *, ShapedRunKeyHasher> shaped_run_map;
+	int64_t shaped_run_cache_capacity = 2048;
+	uint64_t shaped_run_cache_hits = 0;
+	uint64_t shaped_run_cache_misses = 0;
+	// Bumped by every font change that can affect shaping, font setters only lock the font so the cache is cleared on next use.
+	SafeNumeric<uint64_t> shaped_run_cache_version;
+	uint64_t shaped_run_cache_cleared_version = 0;
+
+	_FORCE_INLINE_ void _shaped_run_cache_invalidate() { shaped_run_cache_version.increment(); }
+	void _shape_run_cached(ShapedTextDataAdvanced *p_sd, int64_t p_start, int64_t p_end, hb_script_t p_script, hb_direction_t p_direction, const Array &p_fonts, int64_t p_span);
 
 	void _update_chars(ShapedTextDataAdvanced *p_sd) const;
 	void _realign(ShapedTextDataAdvanced *p_sd) const;
@@ -678,12 +781,23 @@ class TextServerAdvanced : public TextServerExtension {
 	};
 
 protected:
-	static void _bind_methods(){};
+	static void _bind_methods();
 
 	void full_copy(ShapedTextDataAdvanced *p_shaped);
 	void invalidate(ShapedTextDataAdvanced *p_shaped, bool p_text = false);
 
 public:
+	int64_t shaped_run_cache_get_hit_count() const;
+	int64_t shaped_run_cache_get_miss_count() const;
+	int64_t shaped_run_cache_get_size() const;
+	void shaped_run_cache_set_capacity(int64_t p_capacity);
+	int64_t shaped_run_cache_get_capacity() const;
+	void shaped_run_cache_clear();
+
+	void font_render_characters_threaded(const RID &p_font_rid, const Vector2i &p_size, const String &p_characters);
+	bool font_is_rendering_threaded(const RID &p_font_rid) const;
+	void font_wait_for_threaded_render(const RID &p_font_rid);
+
 	MODBIND1RC(bool, has_feature, Feature);
 	MODBIND0RC(String, get_name);
 	MODBIND0RC(int64_t, get_features);
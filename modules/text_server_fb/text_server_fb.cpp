@@ -79,6 +79,7 @@ bool TextServerFallback::_has_feature(Feature p_feature) const {
 	switch (p_feature) {
 		case FEATURE_SIMPLE_LAYOUT:
 		case FEATURE_FONT_BITMAP:
+		case FEATURE_THREADED_SHAPING:
 #ifdef MODULE_FREETYPE_ENABLED
 		case FEATURE_FONT_DYNAMIC:
 #endif
@@ -101,7 +102,7 @@ String TextServerFallback::_get_name() const {
 }
 
 int64_t TextServerFallback::_get_features() const {
-	int64_t interface_features = FEATURE_SIMPLE_LAYOUT | FEATURE_FONT_BITMAP;
+	int64_t interface_features = FEATURE_SIMPLE_LAYOUT | FEATURE_FONT_BITMAP | FEATURE_THREADED_SHAPING;
 #ifdef MODULE_FREETYPE_ENABLED
 	interface_features |= FEATURE_FONT_DYNAMIC;
 #endif
@@ -3122,8 +3123,6 @@ void TextServerFallback::_realign(ShapedTextDataFallback *p_sd) const {
 }
 
 RID TextServerFallback::_shaped_text_substr(const RID &p_shaped, int64_t p_start, int64_t p_length) const {
-	_THREAD_SAFE_METHOD_
-
 	const ShapedTextDataFallback *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_COND_V(!sd, RID());
 
@@ -3731,6 +3730,7 @@ bool TextServerFallback::_shaped_text_shape(const RID &p_shaped) {
 					// Try system fallback.
 					RID fdef = span.fonts[0];
 					if (_font_is_allow_system_fallback(fdef)) {
+						MutexLock sys_lock(system_font_mutex);
 						String text = sd->text.substr(j, 1);
 						String font_name = _font_get_name(fdef);
 						BitField<FontStyle> font_style = _font_get_style(fdef);
@@ -4204,6 +4204,7 @@ TextServerFallback::TextServerFallback() {
 };
 
 void TextServerFallback::_cleanup() {
+	MutexLock sys_lock(system_font_mutex);
 	for (const KeyValue<SystemFontKey, SystemFontCache> &E : system_fonts) {
 		const Vector<SystemFontCacheRec> &sysf_cache = E.value.var;
 		for (const SystemFontCacheRec &F : sysf_cache) {
@@ -451,8 +451,9 @@ class TextServerFallback : public TextServerExtension {
 	// Common data.
 
 	double oversampling = 1.0;
-	mutable RID_PtrOwner<FontFallback> font_owner;
-	mutable RID_PtrOwner<ShapedTextDataFallback> shaped_owner;
+	// Shaped texts are shaped on several threads at once, each locking its own data.
+	mutable RID_PtrOwner<FontFallback, true> font_owner;
+	mutable RID_PtrOwner<ShapedTextDataFallback, true> shaped_owner;
 
 	struct SystemFontKey {
 		String font_name;
@@ -537,6 +538,7 @@ class TextServerFallback : public TextServerExtension {
 	};
 	mutable HashMap<SystemFontKey, SystemFontCache, SystemFontKeyHasher> system_fonts;
 	mutable HashMap<String, PackedByteArray> system_font_data;
+	mutable Mutex system_font_mutex;
 
 	void _realign(ShapedTextDataFallback *p_sd) const;
 
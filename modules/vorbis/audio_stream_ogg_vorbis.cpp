@@ -230,6 +230,7 @@ bool AudioStreamPlaybackOggVorbis::_alloc_vorbis() {
 
 void AudioStreamPlaybackOggVorbis::start(double p_from_pos) {
 	ERR_FAIL_COND(!ready);
+	stop_decode_ahead();
 	loop_fade_remaining = FADE_SIZE;
 	active = true;
 	seek(p_from_pos);
@@ -238,6 +239,7 @@ void AudioStreamPlaybackOggVorbis::start(double p_from_pos) {
 }
 
 void AudioStreamPlaybackOggVorbis::stop() {
+	stop_decode_ahead();
 	active = false;
 }
 
@@ -250,7 +252,7 @@ int AudioStreamPlaybackOggVorbis::get_loop_count() const {
 }
 
 double AudioStreamPlaybackOggVorbis::get_playback_position() const {
-	return double(frames_mixed) / (double)vorbis_data->get_sampling_rate();
+	return double(MAX(int64_t(frames_mixed) - get_decode_ahead_frames(), 0)) / (double)vorbis_data->get_sampling_rate();
 }
 
 void AudioStreamPlaybackOggVorbis::tag_used_streams() {
@@ -384,6 +386,7 @@ void AudioStreamPlaybackOggVorbis::seek(double p_time) {
 }
 
 AudioStreamPlaybackOggVorbis::~AudioStreamPlaybackOggVorbis() {
+	stop_decode_ahead();
 	if (block_is_allocated) {
 		vorbis_block_clear(&block);
 	}
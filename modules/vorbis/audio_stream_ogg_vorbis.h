@@ -82,6 +82,7 @@ class AudioStreamPlaybackOggVorbis : public AudioStreamPlaybackResampled {
 protected:
 	virtual int _mix_internal(AudioFrame *p_buffer, int p_frames) override;
 	virtual float get_stream_sampling_rate() override;
+	virtual bool _can_decode_ahead() const override { return true; }
 
 public:
 	virtual void start(double p_from_pos = 0.0) override;
@@ -54,6 +54,7 @@ import org.godotengine.godot.io.directory.DirectoryAccessHandler
 import org.godotengine.godot.io.file.FileAccessHandler
 import org.godotengine.godot.plugin.GodotPluginRegistry
 import org.godotengine.godot.tts.GodotTTS
+import org.godotengine.godot.utils.AdaptivePerformance
 import org.godotengine.godot.utils.GodotNetUtils
 import org.godotengine.godot.utils.PermissionsUtil
 import org.godotengine.godot.utils.PermissionsUtil.requestPermission
@@ -118,6 +119,7 @@ class Godot(private val context: Context) : SensorEventListener {
 	val directoryAccessHandler = DirectoryAccessHandler(context)
 	val fileAccessHandler = FileAccessHandler(context)
 	val netUtils = GodotNetUtils(context)
+	private val adaptivePerformance = AdaptivePerformance(context)
 
 	/**
 	 * Tracks whether [onCreate] was completed successfully.
@@ -539,6 +541,7 @@ class Godot(private val context: Context) : SensorEventListener {
 			plugin.onMainDestroy()
 		}
 		GodotLib.ondestroy()
+		adaptivePerformance.release()
 		forceQuit()
 	}
 
@@ -842,6 +845,32 @@ class Godot(private val context: Context) : SensorEventListener {
 		}
 	}
 
+	/**
+	 * Used by the native code (os_android.cpp) to adapt the quality to the device thermal state.
+	 */
+	@Keep
+	private fun getThermalStatus(): Int {
+		return adaptivePerformance.getThermalStatus()
+	}
+
+	@Keep
+	private fun getThermalHeadroom(forecastSeconds: Int): Float {
+		return adaptivePerformance.getThermalHeadroom(forecastSeconds)
+	}
+
+	@Keep
+	private fun isPowerSaveMode(): Boolean {
+		return adaptivePerformance.isPowerSaveMode()
+	}
+
+	/**
+	 * Used by the native code (os_android.cpp) to report the render thread frame work to ADPF.
+	 */
+	@Keep
+	private fun reportFrameWorkDuration(actualNanos: Long, targetNanos: Long) {
+		adaptivePerformance.reportFrameWorkDuration(actualNanos, targetNanos)
+	}
+
 	private fun getCommandLine(): MutableList<String> {
 		val original: MutableList<String> = parseCommandLine()
 		val hostCommandLine = primaryHost?.commandLine
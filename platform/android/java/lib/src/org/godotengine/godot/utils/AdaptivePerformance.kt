@@ -0,0 +1,116 @@
+/**************************************************************************/
+/*  AdaptivePerformance.kt                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+package org.godotengine.godot.utils
+
+import android.content.Context
+import android.os.Build
+import android.os.PerformanceHintManager
+import android.os.PowerManager
+import android.os.Process
+import android.util.Log
+
+/**
+ * Exposes the device thermal and power state, and reports the render thread work duration to the
+ * Android Dynamic Performance Framework (ADPF) so the CPU clocks follow the frame load.
+ */
+class AdaptivePerformance(private val context: Context) {
+	companion object {
+		private val TAG = AdaptivePerformance::class.java.simpleName
+	}
+
+	private val powerManager: PowerManager? by lazy {
+		context.getSystemService(Context.POWER_SERVICE) as PowerManager?
+	}
+
+	private var hintSession: Any? = null
+	private var hintSessionFailed = false
+	private var hintTargetNanos = 0L
+
+	/**
+	 * Returns one of the PowerManager.THERMAL_STATUS_* values, or -1 when not available (API < 29).
+	 */
+	fun getThermalStatus(): Int {
+		if (Build.VERSION.SDK_INT < Build.VERSION_CODES.Q) {
+			return -1
+		}
+		return powerManager?.currentThermalStatus ?: -1
+	}
+
+	/**
+	 * Returns the thermal headroom forecast for the next [forecastSeconds], where 1.0 means the
+	 * device starts throttling. Returns -1 when not available (API < 30 or rate limited).
+	 */
+	fun getThermalHeadroom(forecastSeconds: Int): Float {
+		if (Build.VERSION.SDK_INT < Build.VERSION_CODES.R) {
+			return -1f
+		}
+		val headroom = powerManager?.getThermalHeadroom(forecastSeconds) ?: return -1f
+		return if (headroom.isNaN()) -1f else headroom
+	}
+
+	fun isPowerSaveMode(): Boolean {
+		return powerManager?.isPowerSaveMode ?: false
+	}
+
+	/**
+	 * Reports the duration of the last frame of work. Must be called from the thread doing the work,
+	 * the hint session is created for it on the first call (API 31+).
+	 */
+	fun reportFrameWorkDuration(actualNanos: Long, targetNanos: Long) {
+		if (Build.VERSION.SDK_INT < Build.VERSION_CODES.S || hintSessionFailed || actualNanos <= 0 || targetNanos <= 0) {
+			return
+		}
+
+		var session = hintSession as PerformanceHintManager.Session?
+		if (session == null) {
+			val hintManager = context.getSystemService(Context.PERFORMANCE_HINT_SERVICE) as PerformanceHintManager?
+			session = hintManager?.createHintSession(intArrayOf(Process.myTid()), targetNanos)
+			if (session == null) {
+				Log.w(TAG, "Performance hint sessions are not supported on this device.")
+				hintSessionFailed = true
+				return
+			}
+			hintSession = session
+			hintTargetNanos = targetNanos
+		} else if (targetNanos != hintTargetNanos) {
+			session.updateTargetWorkDuration(targetNanos)
+			hintTargetNanos = targetNanos
+		}
+		session.reportActualWorkDuration(actualNanos)
+	}
+
+	fun release() {
+		if (Build.VERSION.SDK_INT >= Build.VERSION_CODES.S) {
+			(hintSession as PerformanceHintManager.Session?)?.close()
+		}
+		hintSession = null
+	}
+}
@@ -79,6 +79,10 @@ GodotJavaWrapper::GodotJavaWrapper(JNIEnv *p_env, jobject p_activity, jobject p_
 	_begin_benchmark_measure = p_env->GetMethodID(godot_class, "nativeBeginBenchmarkMeasure", "(Ljava/lang/String;)V");
 	_end_benchmark_measure = p_env->GetMethodID(godot_class, "nativeEndBenchmarkMeasure", "(Ljava/lang/String;)V");
 	_dump_benchmark = p_env->GetMethodID(godot_class, "nativeDumpBenchmark", "(Ljava/lang/String;)V");
+	_get_thermal_status = p_env->GetMethodID(godot_class, "getThermalStatus", "()I");
+	_get_thermal_headroom = p_env->GetMethodID(godot_class, "getThermalHeadroom", "(I)F");
+	_is_power_save_mode = p_env->GetMethodID(godot_class, "isPowerSaveMode", "()Z");
+	_report_frame_work_duration = p_env->GetMethodID(godot_class, "reportFrameWorkDuration", "(JJ)V");
 	_get_gdextension_list_config_file = p_env->GetMethodID(godot_class, "getGDExtensionConfigFiles", "()[Ljava/lang/String;");
 }
 
@@ -351,3 +355,41 @@ void GodotJavaWrapper::dump_benchmark(const String &benchmark_file) {
 		env->CallVoidMethod(godot_instance, _dump_benchmark, j_benchmark_file);
 	}
 }
+
+int GodotJavaWrapper::get_thermal_status() {
+	if (_get_thermal_status) {
+		JNIEnv *env = get_jni_env();
+		ERR_FAIL_NULL_V(env, -1);
+		return env->CallIntMethod(godot_instance, _get_thermal_status);
+	} else {
+		return -1;
+	}
+}
+
+float GodotJavaWrapper::get_thermal_headroom(int p_forecast_seconds) {
+	if (_get_thermal_headroom) {
+		JNIEnv *env = get_jni_env();
+		ERR_FAIL_NULL_V(env, -1.0);
+		return env->CallFloatMethod(godot_instance, _get_thermal_headroom, p_forecast_seconds);
+	} else {
+		return -1.0;
+	}
+}
+
+bool GodotJavaWrapper::is_power_save_mode() {
+	if (_is_power_save_mode) {
+		JNIEnv *env = get_jni_env();
+		ERR_FAIL_NULL_V(env, false);
+		return env->CallBooleanMethod(godot_instance, _is_power_save_mode);
+	} else {
+		return false;
+	}
+}
+
+void GodotJavaWrapper::report_frame_work_duration(int64_t p_actual_nanos, int64_t p_target_nanos) {
+	if (_report_frame_work_duration) {
+		JNIEnv *env = get_jni_env();
+		ERR_FAIL_NULL(env);
+		env->CallVoidMethod(godot_instance, _report_frame_work_duration, (jlong)p_actual_nanos, (jlong)p_target_nanos);
+	}
+}
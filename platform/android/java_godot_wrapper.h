@@ -71,6 +71,10 @@ private:
 	jmethodID _begin_benchmark_measure = nullptr;
 	jmethodID _end_benchmark_measure = nullptr;
 	jmethodID _dump_benchmark = nullptr;
+	jmethodID _get_thermal_status = nullptr;
+	jmethodID _get_thermal_headroom = nullptr;
+	jmethodID _is_power_save_mode = nullptr;
+	jmethodID _report_frame_work_duration = nullptr;
 
 public:
 	GodotJavaWrapper(JNIEnv *p_env, jobject p_activity, jobject p_godot_instance);
@@ -104,6 +108,12 @@ public:
 	void end_benchmark_measure(const String &p_label);
 	void dump_benchmark(const String &benchmark_file);
 
+	// Thermal and power state, and ADPF work reporting, used by the adaptive performance.
+	int get_thermal_status();
+	float get_thermal_headroom(int p_forecast_seconds);
+	bool is_power_save_mode();
+	void report_frame_work_duration(int64_t p_actual_nanos, int64_t p_target_nanos);
+
 	// Return the list of gdextensions config file.
 	Vector<String> get_gdextension_list_config_file() const;
 };
@@ -45,6 +45,7 @@
 #include "drivers/unix/file_access_unix.h"
 #include "main/main.h"
 #include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
 #include "servers/rendering_server.h"
 
 #include <dlfcn.h>
@@ -291,6 +292,88 @@ void OS_Android::main_loop_begin() {
 	if (main_loop) {
 		main_loop->initialize();
 	}
+
+	AdaptivePerformance &ap = adaptive_performance;
+	ap.enabled = bool(GLOBAL_GET("display/window/handheld/adaptive_performance/enabled")) && !Engine::get_singleton()->is_editor_hint();
+	if (ap.enabled) {
+		ap.use_performance_hint = GLOBAL_GET("display/window/handheld/adaptive_performance/use_performance_hint");
+		ap.min_scaling_3d_scale = GLOBAL_GET("display/window/handheld/adaptive_performance/min_scaling_3d_scale");
+		ap.min_fps = GLOBAL_GET("display/window/handheld/adaptive_performance/min_fps");
+		ap.min_physics_ticks_per_second = GLOBAL_GET("display/window/handheld/adaptive_performance/min_physics_ticks_per_second");
+
+		ap.base_scaling_3d_scale = GLOBAL_GET("rendering/scaling_3d/scale");
+		ap.base_max_fps = Engine::get_singleton()->get_max_fps();
+		ap.base_physics_ticks_per_second = Engine::get_singleton()->get_physics_ticks_per_second();
+		ap.refresh_rate = DisplayServer::get_singleton()->screen_get_refresh_rate();
+	}
+}
+
+void OS_Android::add_frame_delay(bool p_can_draw) {
+	// Tracked so the time spent waiting isn't reported as work to the performance hint session.
+	const uint64_t delay_begin = get_ticks_usec();
+	OS_Unix::add_frame_delay(p_can_draw);
+	frame_delay_usec = get_ticks_usec() - delay_begin;
+}
+
+void OS_Android::_update_adaptive_performance(uint64_t p_work_usec) {
+	AdaptivePerformance &ap = adaptive_performance;
+
+	if (ap.use_performance_hint) {
+		const int target_fps = Engine::get_singleton()->get_max_fps() > 0 ? Engine::get_singleton()->get_max_fps() : int(ap.refresh_rate);
+		godot_java->report_frame_work_duration(p_work_usec * 1000, 1000000000 / MAX(target_fps, 1));
+	}
+
+	// The thermal APIs are rate limited, the headroom returns NaN when polled more than once a second.
+	const uint64_t ticks = get_ticks_usec();
+	if (ticks - ap.last_check_usec < 2000000) {
+		return;
+	}
+	ap.last_check_usec = ticks;
+	ap.refresh_rate = DisplayServer::get_singleton()->screen_get_refresh_rate();
+
+	// PowerManager.THERMAL_STATUS_LIGHT (1) to THERMAL_STATUS_CRITICAL (4) map to a quarter each.
+	float target = 0.0;
+	const int thermal_status = godot_java->get_thermal_status();
+	if (thermal_status > 0) {
+		target = MIN(thermal_status * 0.25f, 1.0f);
+	}
+	// A headroom of 1.0 is where the device starts throttling, so back off a bit before that.
+	const float headroom = godot_java->get_thermal_headroom(10);
+	if (headroom >= 0.0f) {
+		target = MAX(target, CLAMP((headroom - 0.75f) * 4.0f, 0.0f, 1.0f));
+	}
+	if (godot_java->is_power_save_mode()) {
+		target = MAX(target, 0.5f);
+	}
+
+	// Drop quality quickly and restore it slowly, to avoid oscillating around a thermal threshold.
+	const float level = target > ap.level ? MIN(target, ap.level + 0.25f) : MAX(target, ap.level - 0.05f);
+	if (level != ap.level) {
+		ap.level = level;
+		_apply_adaptive_performance_level();
+	}
+}
+
+void OS_Android::_apply_adaptive_performance_level() {
+	const AdaptivePerformance &ap = adaptive_performance;
+
+	SceneTree *scene_tree = Object::cast_to<SceneTree>(main_loop);
+	if (scene_tree && scene_tree->get_root()) {
+		scene_tree->get_root()->set_scaling_3d_scale(Math::lerp(ap.base_scaling_3d_scale, MIN(ap.min_scaling_3d_scale, ap.base_scaling_3d_scale), ap.level));
+	}
+
+	if (ap.level > 0.0f) {
+		// An unlimited frame rate is capped by the display refresh rate anyway.
+		const int base_fps = ap.base_max_fps > 0 ? ap.base_max_fps : int(ap.refresh_rate);
+		Engine::get_singleton()->set_max_fps(int(Math::round(Math::lerp(float(base_fps), float(MIN(ap.min_fps, base_fps)), ap.level))));
+	} else {
+		Engine::get_singleton()->set_max_fps(ap.base_max_fps);
+	}
+
+	const int base_ticks = ap.base_physics_ticks_per_second;
+	Engine::get_singleton()->set_physics_ticks_per_second(MAX(1, int(Math::round(Math::lerp(float(base_ticks), float(MIN(ap.min_physics_ticks_per_second, base_ticks)), ap.level)))));
+
+	print_verbose(vformat("Adaptive performance level changed to %.2f.", ap.level));
 }
 
 bool OS_Android::main_loop_iterate(bool *r_should_swap_buffers) {
@@ -300,8 +383,15 @@ bool OS_Android::main_loop_iterate(bool *r_should_swap_buffers) {
 	DisplayServerAndroid::get_singleton()->reset_swap_buffers_flag();
 	DisplayServerAndroid::get_singleton()->process_events();
 	uint64_t current_frames_drawn = Engine::get_singleton()->get_frames_drawn();
+	const uint64_t iteration_begin = get_ticks_usec();
+	frame_delay_usec = 0;
 	bool exit = Main::iteration();
 
+	if (adaptive_performance.enabled) {
+		const uint64_t iteration_usec = get_ticks_usec() - iteration_begin;
+		_update_adaptive_performance(iteration_usec - MIN(frame_delay_usec, iteration_usec));
+	}
+
 	if (r_should_swap_buffers) {
 		*r_should_swap_buffers = !is_in_low_processor_usage_mode() ||
 				DisplayServerAndroid::get_singleton()->should_swap_buffers() ||
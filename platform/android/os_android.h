@@ -64,6 +64,28 @@ private:
 
 	MainLoop *main_loop = nullptr;
 
+	// Lowers the 3D resolution, max FPS and physics tick rate as the device heats up.
+	struct AdaptivePerformance {
+		bool enabled = false;
+		bool use_performance_hint = true;
+		float min_scaling_3d_scale = 0.5;
+		int min_fps = 30;
+		int min_physics_ticks_per_second = 30;
+
+		// Project values, restored once the device cools down.
+		float base_scaling_3d_scale = 1.0;
+		int base_max_fps = 0;
+		int base_physics_ticks_per_second = 60;
+
+		float level = 0.0; // 0 is full quality, 1 is the configured minimums.
+		float refresh_rate = 60.0;
+		uint64_t last_check_usec = 0;
+	} adaptive_performance;
+	uint64_t frame_delay_usec = 0;
+
+	void _update_adaptive_performance(uint64_t p_work_usec);
+	void _apply_adaptive_performance_level();
+
 	struct FontInfo {
 		String font_name;
 		HashSet<String> lang;
@@ -126,6 +148,8 @@ public:
 	void main_loop_focusout();
 	void main_loop_focusin();
 
+	virtual void add_frame_delay(bool p_can_draw) override;
+
 	void set_display_size(const Size2i &p_size);
 	Size2i get_display_size() const;
 
@@ -1714,6 +1714,23 @@ void DisplayServerX11::gl_window_make_current(DisplayServer::WindowID p_window_i
 #endif
 }
 
+bool DisplayServerX11::gl_upload_context_is_available() const {
+#if defined(GLES3_ENABLED)
+	if (gl_manager) {
+		return gl_manager->is_upload_context_available();
+	}
+#endif
+	return false;
+}
+
+void DisplayServerX11::gl_upload_context_make_current(bool p_current) {
+#if defined(GLES3_ENABLED)
+	if (gl_manager) {
+		gl_manager->upload_context_make_current(p_current);
+	}
+#endif
+}
+
 void DisplayServerX11::window_set_current_screen(int p_screen, WindowID p_window) {
 	_THREAD_SAFE_METHOD_
 
@@ -5811,6 +5828,7 @@ DisplayServerX11::DisplayServerX11(const String &p_rendering_driver, WindowMode
 		GLManager_X11::ContextType opengl_api_type = GLManager_X11::GLES_3_0_COMPATIBLE;
 
 		gl_manager = memnew(GLManager_X11(p_resolution, opengl_api_type));
+		gl_manager->set_use_upload_context(GLOBAL_GET("rendering/gl_compatibility/threaded_resource_upload"));
 
 		if (gl_manager->initialize(x11_display) != OK) {
 			memdelete(gl_manager);
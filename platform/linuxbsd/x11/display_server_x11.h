@@ -461,6 +461,8 @@ public:
 	virtual void window_set_max_size(const Size2i p_size, WindowID p_window = MAIN_WINDOW_ID) override;
 	virtual Size2i window_get_max_size(WindowID p_window = MAIN_WINDOW_ID) const override;
 	virtual void gl_window_make_current(DisplayServer::WindowID p_window_id) override;
+	virtual bool gl_upload_context_is_available() const override;
+	virtual void gl_upload_context_make_current(bool p_current) override;
 
 	virtual void window_set_transient(WindowID p_window, WindowID p_parent) override;
 
@@ -48,11 +48,15 @@ typedef GLXContext (*GLXCREATECONTEXTATTRIBSARBPROC)(Display *, GLXFBConfig, GLX
 
 struct GLManager_X11_Private {
 	::GLXContext glx_context;
+	::GLXContext upload_context = nullptr; // Shares objects with glx_context, only current on loader threads.
 };
 
 GLManager_X11::GLDisplay::~GLDisplay() {
 	if (context) {
 		//release_current();
+		if (context->upload_context) {
+			glXDestroyContext(x11_display, context->upload_context);
+		}
 		glXDestroyContext(x11_display, context->glx_context);
 		memdelete(context);
 		context = nullptr;
@@ -181,6 +185,16 @@ Error GLManager_X11::_create_context(GLDisplay &gl_display) {
 
 			gl_display.context->glx_context = glXCreateContextAttribsARB(x11_display, fbconfig, nullptr, true, context_attribs);
 			ERR_FAIL_COND_V(ctxErrorOccurred || !gl_display.context->glx_context, ERR_UNCONFIGURED);
+
+			if (use_upload_context) {
+				gl_display.context->upload_context = glXCreateContextAttribsARB(x11_display, fbconfig, gl_display.context->glx_context, true, context_attribs);
+				if (ctxErrorOccurred || !gl_display.context->upload_context) {
+					// Not fatal, resources are then uploaded from the render thread as usual.
+					WARN_PRINT("Could not create a shared OpenGL context for threaded resource uploads.");
+					ctxErrorOccurred = false;
+					gl_display.context->upload_context = nullptr;
+				}
+			}
 		} break;
 	}
 
@@ -388,6 +402,20 @@ void *GLManager_X11::get_glx_context(DisplayServer::WindowID p_window_id) {
 	return (void *)disp.context->glx_context;
 }
 
+bool GLManager_X11::is_upload_context_available() const {
+	return _displays.size() && _displays[0].context->upload_context;
+}
+
+void GLManager_X11::upload_context_make_current(bool p_current) {
+	ERR_FAIL_COND(!is_upload_context_available());
+	const GLDisplay &disp = _displays[0];
+
+	// The upload context never draws, so it doesn't need a drawable.
+	if (!glXMakeContextCurrent(disp.x11_display, None, None, p_current ? disp.context->upload_context : nullptr)) {
+		ERR_PRINT("glXMakeContextCurrent failed");
+	}
+}
+
 GLManager_X11::GLManager_X11(const Vector2i &p_size, ContextType p_context_type) {
 	context_type = p_context_type;
 
@@ -104,6 +104,7 @@ private:
 	bool direct_render;
 	int glx_minor, glx_major;
 	bool use_vsync;
+	bool use_upload_context = false;
 	ContextType context_type;
 
 private:
@@ -129,6 +130,11 @@ public:
 
 	void *get_glx_context(DisplayServer::WindowID p_window_id);
 
+	// Must be set before initialize().
+	void set_use_upload_context(bool p_use) { use_upload_context = p_use; }
+	bool is_upload_context_available() const;
+	void upload_context_make_current(bool p_current);
+
 	GLManager_X11(const Vector2i &p_size, ContextType p_context_type);
 	~GLManager_X11();
 };
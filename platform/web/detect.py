@@ -41,6 +41,11 @@ def get_opts():
             "dlink_enabled", "Enable WebAssembly dynamic linking (GDExtension support). Produces bigger binaries", False
         ),
         BoolVariable("use_closure_compiler", "Use closure compiler to minimize JavaScript code", False),
+        BoolVariable(
+            "proxy_to_pthread",
+            "Run the engine in a Web Worker and render to an OffscreenCanvas, keeping the browser main thread free for input and presentation",
+            False,
+        ),
     ]
 
 
@@ -201,7 +206,16 @@ def configure(env: "Environment"):
     env.Append(CPPDEFINES=["PTHREAD_NO_RENAME"])
     env.Append(CCFLAGS=["-s", "USE_PTHREADS=1"])
     env.Append(LINKFLAGS=["-s", "USE_PTHREADS=1"])
-    env.Append(LINKFLAGS=["-s", "PTHREAD_POOL_SIZE=8"])
+    if env["proxy_to_pthread"]:
+        # The main loop runs in a pthread, which takes a worker from the pool. JS library functions that need the
+        # DOM are proxied to the browser main thread, and the canvas is transferred to the engine thread.
+        env.Append(CPPDEFINES=["PROXY_TO_PTHREAD_ENABLED"])
+        env.Append(LINKFLAGS=["-s", "PROXY_TO_PTHREAD=1"])
+        env.Append(LINKFLAGS=["-s", "OFFSCREENCANVAS_SUPPORT=1"])
+        env.Append(LINKFLAGS=["-s", "PTHREAD_POOL_SIZE=9"])
+        env.extra_suffix = ".proxy" + env.extra_suffix
+    else:
+        env.Append(LINKFLAGS=["-s", "PTHREAD_POOL_SIZE=8"])
     env.Append(LINKFLAGS=["-s", "WASM_MEM_MAX=2048MB"])
 
     if env["dlink_enabled"]:
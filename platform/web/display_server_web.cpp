@@ -35,6 +35,7 @@
 #include "os_web.h"
 
 #include "core/config/project_settings.h"
+#include "core/os/thread.h"
 #include "scene/resources/atlas_texture.h"
 #include "servers/rendering/dummy/rasterizer_dummy.h"
 
@@ -58,6 +59,13 @@ DisplayServerWeb *DisplayServerWeb::get_singleton() {
 // Window (canvas)
 bool DisplayServerWeb::check_size_force_redraw() {
 	bool size_changed = godot_js_display_size_update() != 0;
+#ifdef PROXY_TO_PTHREAD_ENABLED
+	if (size_changed) {
+		// The canvas was transferred to this thread, the browser side only computes its size.
+		Size2i size = window_get_size();
+		emscripten_set_canvas_element_size(canvas_id, size.width, size.height);
+	}
+#endif
 	if (size_changed && !rect_changed_callback.is_null()) {
 		Variant size = Rect2i(Point2i(), window_get_size()); // TODO use window_get_position if implemented.
 		Variant *vp = &size;
@@ -69,6 +77,17 @@ bool DisplayServerWeb::check_size_force_redraw() {
 }
 
 void DisplayServerWeb::fullscreen_change_callback(int p_fullscreen) {
+#ifdef PROXY_TO_PTHREAD_ENABLED
+	if (!Thread::is_main_thread()) {
+		callable_mp_static(&DisplayServerWeb::_fullscreen_change_callback).call_deferred(p_fullscreen);
+		return;
+	}
+#endif
+
+	_fullscreen_change_callback(p_fullscreen);
+}
+
+void DisplayServerWeb::_fullscreen_change_callback(int p_fullscreen) {
 	DisplayServerWeb *display = get_singleton();
 	if (p_fullscreen) {
 		display->window_mode = WINDOW_MODE_FULLSCREEN;
@@ -79,6 +98,22 @@ void DisplayServerWeb::fullscreen_change_callback(int p_fullscreen) {
 
 // Drag and drop callback.
 void DisplayServerWeb::drop_files_js_callback(char **p_filev, int p_filec) {
+	Vector<String> files;
+	for (int i = 0; i < p_filec; i++) {
+		files.push_back(String::utf8(p_filev[i]));
+	}
+
+#ifdef PROXY_TO_PTHREAD_ENABLED
+	if (!Thread::is_main_thread()) {
+		callable_mp_static(&DisplayServerWeb::_drop_files_js_callback).call_deferred(files);
+		return;
+	}
+#endif
+
+	_drop_files_js_callback(files);
+}
+
+void DisplayServerWeb::_drop_files_js_callback(const Vector<String> &p_files) {
 	DisplayServerWeb *ds = get_singleton();
 	if (!ds) {
 		ERR_FAIL_MSG("Unable to drop files because the DisplayServer is not active");
@@ -86,11 +121,7 @@ void DisplayServerWeb::drop_files_js_callback(char **p_filev, int p_filec) {
 	if (ds->drop_files_callback.is_null()) {
 		return;
 	}
-	Vector<String> files;
-	for (int i = 0; i < p_filec; i++) {
-		files.push_back(String::utf8(p_filev[i]));
-	}
-	Variant v = files;
+	Variant v = p_files;
 	Variant *vp = &v;
 	Variant ret;
 	Callable::CallError ce;
@@ -99,6 +130,17 @@ void DisplayServerWeb::drop_files_js_callback(char **p_filev, int p_filec) {
 
 // Web quit request callback.
 void DisplayServerWeb::request_quit_callback() {
+#ifdef PROXY_TO_PTHREAD_ENABLED
+	if (!Thread::is_main_thread()) {
+		callable_mp_static(&DisplayServerWeb::_request_quit_callback).call_deferred();
+		return;
+	}
+#endif
+
+	_request_quit_callback();
+}
+
+void DisplayServerWeb::_request_quit_callback() {
 	DisplayServerWeb *ds = get_singleton();
 	if (ds && !ds->window_event_callback.is_null()) {
 		Variant event = int(DisplayServer::WINDOW_EVENT_CLOSE_REQUEST);
@@ -129,17 +171,35 @@ void DisplayServerWeb::dom2godot_mod(Ref<InputEventWithModifiers> ev, int p_mod,
 void DisplayServerWeb::key_callback(int p_pressed, int p_repeat, int p_modifiers) {
 	DisplayServerWeb *ds = get_singleton();
 	JSKeyEvent &key_event = ds->key_event;
+
+	// The event buffer is reused by the next event, so copy it.
+	const String code = String::utf8(key_event.code);
+	const String key = String::utf8(key_event.key);
+
+#ifdef PROXY_TO_PTHREAD_ENABLED
+	if (!Thread::is_main_thread()) {
+		callable_mp_static(&DisplayServerWeb::_key_callback).call_deferred(code, key, p_pressed, p_repeat, p_modifiers);
+		return;
+	}
+#endif
+
+	_key_callback(code, key, p_pressed, p_repeat, p_modifiers);
+}
+
+void DisplayServerWeb::_key_callback(const String &p_key_event_code, const String &p_key_event_key, int p_pressed, int p_repeat, int p_modifiers) {
 	// Resume audio context after input in case autoplay was denied.
 	OS_Web::get_singleton()->resume_audio();
 
 	char32_t c = 0x00;
-	String unicode = String::utf8(key_event.key);
+	String unicode = p_key_event_key;
 	if (unicode.length() == 1) {
 		c = unicode[0];
 	}
 
-	Key keycode = dom_code2godot_scancode(key_event.code, key_event.key, false);
-	Key scancode = dom_code2godot_scancode(key_event.code, key_event.key, true);
+	const CharString code = p_key_event_code.utf8();
+	const CharString key = p_key_event_key.utf8();
+	Key keycode = dom_code2godot_scancode(code.get_data(), key.get_data(), false);
+	Key scancode = dom_code2godot_scancode(code.get_data(), key.get_data(), true);
 
 	Ref<InputEventKey> ev;
 	ev.instantiate();
@@ -160,6 +220,17 @@ void DisplayServerWeb::key_callback(int p_pressed, int p_repeat, int p_modifiers
 // Mouse
 
 int DisplayServerWeb::mouse_button_callback(int p_pressed, int p_button, double p_x, double p_y, int p_modifiers) {
+#ifdef PROXY_TO_PTHREAD_ENABLED
+	if (!Thread::is_main_thread()) {
+		callable_mp_static(&DisplayServerWeb::_mouse_button_callback).call_deferred(p_pressed, p_button, p_x, p_y, p_modifiers);
+		return p_button >= DOM_BUTTON_LEFT && p_button <= DOM_BUTTON_XBUTTON2;
+	}
+#endif
+
+	return _mouse_button_callback(p_pressed, p_button, p_x, p_y, p_modifiers);
+}
+
+int DisplayServerWeb::_mouse_button_callback(int p_pressed, int p_button, double p_x, double p_y, int p_modifiers) {
 	DisplayServerWeb *ds = get_singleton();
 
 	Point2 pos(p_x, p_y);
@@ -236,6 +307,17 @@ int DisplayServerWeb::mouse_button_callback(int p_pressed, int p_button, double
 }
 
 void DisplayServerWeb::mouse_move_callback(double p_x, double p_y, double p_rel_x, double p_rel_y, int p_modifiers) {
+#ifdef PROXY_TO_PTHREAD_ENABLED
+	if (!Thread::is_main_thread()) {
+		callable_mp_static(&DisplayServerWeb::_mouse_move_callback).call_deferred(p_x, p_y, p_rel_x, p_rel_y, p_modifiers);
+		return;
+	}
+#endif
+
+	_mouse_move_callback(p_x, p_y, p_rel_x, p_rel_y, p_modifiers);
+}
+
+void DisplayServerWeb::_mouse_move_callback(double p_x, double p_y, double p_rel_x, double p_rel_y, int p_modifiers) {
 	BitField<MouseButtonMask> input_mask = Input::get_singleton()->get_mouse_button_mask();
 	// For motion outside the canvas, only read mouse movement if dragging
 	// started inside the canvas; imitating desktop app behavior.
@@ -344,7 +426,7 @@ void DisplayServerWeb::tts_speak(const String &p_text, const String &p_voice, in
 	CharString string = p_text.utf8();
 	utterance_ids[p_utterance_id] = string;
 
-	godot_js_tts_speak(string.get_data(), p_voice.utf8().get_data(), CLAMP(p_volume, 0, 100), CLAMP(p_pitch, 0.f, 2.f), CLAMP(p_rate, 0.1f, 10.f), p_utterance_id, DisplayServerWeb::_js_utterance_callback);
+	godot_js_tts_speak(string.get_data(), p_voice.utf8().get_data(), CLAMP(p_volume, 0, 100), CLAMP(p_pitch, 0.f, 2.f), CLAMP(p_rate, 0.1f, 10.f), p_utterance_id, DisplayServerWeb::js_utterance_callback);
 }
 
 void DisplayServerWeb::tts_pause() {
@@ -366,6 +448,17 @@ void DisplayServerWeb::tts_stop() {
 	godot_js_tts_stop();
 }
 
+void DisplayServerWeb::js_utterance_callback(int p_event, int p_id, int p_pos) {
+#ifdef PROXY_TO_PTHREAD_ENABLED
+	if (!Thread::is_main_thread()) {
+		callable_mp_static(&DisplayServerWeb::_js_utterance_callback).call_deferred(p_event, p_id, p_pos);
+		return;
+	}
+#endif
+
+	_js_utterance_callback(p_event, p_id, p_pos);
+}
+
 void DisplayServerWeb::_js_utterance_callback(int p_event, int p_id, int p_pos) {
 	DisplayServerWeb *ds = (DisplayServerWeb *)DisplayServer::get_singleton();
 	if (ds->utterance_ids.has(p_id)) {
@@ -525,6 +618,17 @@ int DisplayServerWeb::mouse_wheel_callback(double p_delta_x, double p_delta_y) {
 		}
 	}
 
+#ifdef PROXY_TO_PTHREAD_ENABLED
+	if (!Thread::is_main_thread()) {
+		callable_mp_static(&DisplayServerWeb::_mouse_wheel_callback).call_deferred(p_delta_x, p_delta_y);
+		return true;
+	}
+#endif
+
+	return _mouse_wheel_callback(p_delta_x, p_delta_y);
+}
+
+int DisplayServerWeb::_mouse_wheel_callback(double p_delta_x, double p_delta_y) {
 	Input *input = Input::get_singleton();
 	Ref<InputEventMouseButton> ev;
 	ev.instantiate();
@@ -571,14 +675,38 @@ int DisplayServerWeb::mouse_wheel_callback(double p_delta_x, double p_delta_y) {
 void DisplayServerWeb::touch_callback(int p_type, int p_count) {
 	DisplayServerWeb *ds = get_singleton();
 
+	// The event buffer is reused by the next event, so copy it.
 	const JSTouchEvent &touch_event = ds->touch_event;
+	PackedInt32Array identifiers;
+	PackedFloat64Array coords;
+	identifiers.resize(p_count);
+	coords.resize(p_count * 2);
 	for (int i = 0; i < p_count; i++) {
-		Point2 point(touch_event.coords[i * 2], touch_event.coords[i * 2 + 1]);
+		identifiers.write[i] = touch_event.identifier[i];
+		coords.write[i * 2] = touch_event.coords[i * 2];
+		coords.write[i * 2 + 1] = touch_event.coords[i * 2 + 1];
+	}
+
+#ifdef PROXY_TO_PTHREAD_ENABLED
+	if (!Thread::is_main_thread()) {
+		callable_mp_static(&DisplayServerWeb::_touch_callback).call_deferred(p_type, identifiers, coords);
+		return;
+	}
+#endif
+
+	_touch_callback(p_type, identifiers, coords);
+}
+
+void DisplayServerWeb::_touch_callback(int p_type, const PackedInt32Array &p_identifiers, const PackedFloat64Array &p_coords) {
+	DisplayServerWeb *ds = get_singleton();
+
+	for (int i = 0; i < p_identifiers.size(); i++) {
+		Point2 point(p_coords[i * 2], p_coords[i * 2 + 1]);
 		if (p_type == 2) {
 			// touchmove
 			Ref<InputEventScreenDrag> ev;
 			ev.instantiate();
-			ev->set_index(touch_event.identifier[i]);
+			ev->set_index(p_identifiers[i]);
 			ev->set_position(point);
 
 			Point2 &prev = ds->touches[i];
@@ -594,7 +722,7 @@ void DisplayServerWeb::touch_callback(int p_type, int p_count) {
 			OS_Web::get_singleton()->resume_audio();
 
 			ev.instantiate();
-			ev->set_index(touch_event.identifier[i]);
+			ev->set_index(p_identifiers[i]);
 			ev->set_position(point);
 			ev->set_pressed(p_type == 0);
 			ds->touches[i] = point;
@@ -613,12 +741,23 @@ bool DisplayServerWeb::is_touchscreen_available() const {
 
 // Virtual Keyboard
 void DisplayServerWeb::vk_input_text_callback(const char *p_text, int p_cursor) {
+#ifdef PROXY_TO_PTHREAD_ENABLED
+	if (!Thread::is_main_thread()) {
+		callable_mp_static(&DisplayServerWeb::_vk_input_text_callback).call_deferred(String::utf8(p_text), p_cursor);
+		return;
+	}
+#endif
+
+	_vk_input_text_callback(String::utf8(p_text), p_cursor);
+}
+
+void DisplayServerWeb::_vk_input_text_callback(const String &p_text, int p_cursor) {
 	DisplayServerWeb *ds = DisplayServerWeb::get_singleton();
 	if (!ds || ds->input_text_callback.is_null()) {
 		return;
 	}
 	// Call input_text
-	Variant event = String::utf8(p_text);
+	Variant event = p_text;
 	Variant *eventp = &event;
 	Variant ret;
 	Callable::CallError ce;
@@ -649,14 +788,36 @@ void DisplayServerWeb::virtual_keyboard_hide() {
 }
 
 void DisplayServerWeb::window_blur_callback() {
+#ifdef PROXY_TO_PTHREAD_ENABLED
+	if (!Thread::is_main_thread()) {
+		callable_mp_static(&DisplayServerWeb::_window_blur_callback).call_deferred();
+		return;
+	}
+#endif
+
+	_window_blur_callback();
+}
+
+void DisplayServerWeb::_window_blur_callback() {
 	Input::get_singleton()->release_pressed_events();
 }
 
 // Gamepad
 void DisplayServerWeb::gamepad_callback(int p_index, int p_connected, const char *p_id, const char *p_guid) {
+#ifdef PROXY_TO_PTHREAD_ENABLED
+	if (!Thread::is_main_thread()) {
+		callable_mp_static(&DisplayServerWeb::_gamepad_callback).call_deferred(p_index, p_connected, String::utf8(p_id), String::utf8(p_guid));
+		return;
+	}
+#endif
+
+	_gamepad_callback(p_index, p_connected, String::utf8(p_id), String::utf8(p_guid));
+}
+
+void DisplayServerWeb::_gamepad_callback(int p_index, int p_connected, const String &p_id, const String &p_guid) {
 	Input *input = Input::get_singleton();
 	if (p_connected) {
-		input->joy_connection_changed(p_index, true, String::utf8(p_id), String::utf8(p_guid));
+		input->joy_connection_changed(p_index, true, p_id, p_guid);
 	} else {
 		input->joy_connection_changed(p_index, false, "");
 	}
@@ -700,7 +861,18 @@ Vector<String> DisplayServerWeb::get_rendering_drivers_func() {
 
 // Clipboard
 void DisplayServerWeb::update_clipboard_callback(const char *p_text) {
-	get_singleton()->clipboard = String::utf8(p_text);
+#ifdef PROXY_TO_PTHREAD_ENABLED
+	if (!Thread::is_main_thread()) {
+		callable_mp_static(&DisplayServerWeb::_update_clipboard_callback).call_deferred(String::utf8(p_text));
+		return;
+	}
+#endif
+
+	_update_clipboard_callback(String::utf8(p_text));
+}
+
+void DisplayServerWeb::_update_clipboard_callback(const String &p_text) {
+	get_singleton()->clipboard = p_text;
 }
 
 void DisplayServerWeb::clipboard_set(const String &p_text) {
@@ -715,6 +887,17 @@ String DisplayServerWeb::clipboard_get() const {
 }
 
 void DisplayServerWeb::send_window_event_callback(int p_notification) {
+#ifdef PROXY_TO_PTHREAD_ENABLED
+	if (!Thread::is_main_thread()) {
+		callable_mp_static(&DisplayServerWeb::_send_window_event_callback).call_deferred(p_notification);
+		return;
+	}
+#endif
+
+	_send_window_event_callback(p_notification);
+}
+
+void DisplayServerWeb::_send_window_event_callback(int p_notification) {
 	DisplayServerWeb *ds = get_singleton();
 	if (!ds) {
 		return;
@@ -809,6 +992,10 @@ DisplayServerWeb::DisplayServerWeb(const String &p_rendering_driver, WindowMode
 		attributes.antialias = false;
 		attributes.majorVersion = 2;
 		attributes.explicitSwapControl = true;
+#ifdef PROXY_TO_PTHREAD_ENABLED
+		// Render to the transferred OffscreenCanvas, or proxy the context to the browser main thread where it's unsupported.
+		attributes.proxyContextToMainThread = EMSCRIPTEN_WEBGL_CONTEXT_PROXY_FALLBACK;
+#endif
 
 		webgl_ctx = emscripten_webgl_create_context(canvas_id, &attributes);
 		webgl2_inited = webgl_ctx && emscripten_webgl_make_context_current(webgl_ctx) == EMSCRIPTEN_RESULT_SUCCESS;
@@ -88,15 +88,25 @@ private:
 	static const char *godot2dom_cursor(DisplayServer::CursorShape p_shape);
 
 	// events
+	// With proxy_to_pthread, the JS callbacks run on the browser main thread and defer their _ counterpart to the engine thread.
 	static void fullscreen_change_callback(int p_fullscreen);
+	static void _fullscreen_change_callback(int p_fullscreen);
 	static int mouse_button_callback(int p_pressed, int p_button, double p_x, double p_y, int p_modifiers);
+	static int _mouse_button_callback(int p_pressed, int p_button, double p_x, double p_y, int p_modifiers);
 	static void mouse_move_callback(double p_x, double p_y, double p_rel_x, double p_rel_y, int p_modifiers);
+	static void _mouse_move_callback(double p_x, double p_y, double p_rel_x, double p_rel_y, int p_modifiers);
 	static int mouse_wheel_callback(double p_delta_x, double p_delta_y);
+	static int _mouse_wheel_callback(double p_delta_x, double p_delta_y);
 	static void touch_callback(int p_type, int p_count);
+	static void _touch_callback(int p_type, const PackedInt32Array &p_identifiers, const PackedFloat64Array &p_coords);
 	static void key_callback(int p_pressed, int p_repeat, int p_modifiers);
+	static void _key_callback(const String &p_key_event_code, const String &p_key_event_key, int p_pressed, int p_repeat, int p_modifiers);
 	static void vk_input_text_callback(const char *p_text, int p_cursor);
+	static void _vk_input_text_callback(const String &p_text, int p_cursor);
 	static void gamepad_callback(int p_index, int p_connected, const char *p_id, const char *p_guid);
+	static void _gamepad_callback(int p_index, int p_connected, const String &p_id, const String &p_guid);
 	void process_joypads();
+	static void js_utterance_callback(int p_event, int p_id, int p_pos);
 	static void _js_utterance_callback(int p_event, int p_id, int p_pos);
 
 	static Vector<String> get_rendering_drivers_func();
@@ -105,11 +115,16 @@ private:
 	static void _dispatch_input_event(const Ref<InputEvent> &p_event);
 
 	static void request_quit_callback();
+	static void _request_quit_callback();
 	static void window_blur_callback();
+	static void _window_blur_callback();
 	static void update_voices_callback(int p_size, const char **p_voice);
 	static void update_clipboard_callback(const char *p_text);
+	static void _update_clipboard_callback(const String &p_text);
 	static void send_window_event_callback(int p_notification);
+	static void _send_window_event_callback(int p_notification);
 	static void drop_files_js_callback(char **p_filev, int p_filec);
+	static void _drop_files_js_callback(const Vector<String> &p_files);
 
 protected:
 	int get_current_video_driver() const;
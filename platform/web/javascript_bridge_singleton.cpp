@@ -32,6 +32,8 @@
 
 #include "os_web.h"
 
+#include "core/os/thread.h"
+
 #include <emscripten.h>
 
 extern "C" {
@@ -256,6 +258,15 @@ void JavaScriptObjectImpl::_callback(void *p_ref, int p_args_id, int p_argc) {
 		int type = godot_js_wrapper_object_getvar(p_args_id, Variant::INT, &exchange);
 		arg_arr.push_back(_js2variant(type, &exchange));
 	}
+
+#ifdef PROXY_TO_PTHREAD_ENABLED
+	if (!Thread::is_main_thread()) {
+		// Called from the browser main thread while the engine runs in a worker, so no value is returned to JavaScript.
+		obj->_callable.call_deferred(arg_arr);
+		return;
+	}
+#endif
+
 	Variant arg = arg_arr;
 	const Variant *argv[1] = { &arg };
 	Callable::CallError err;
@@ -36,6 +36,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/debugger/engine_debugger.h"
+#include "core/os/thread.h"
 #include "drivers/unix/dir_access_unix.h"
 #include "drivers/unix/file_access_unix.h"
 #include "main/main.h"
@@ -207,6 +208,12 @@ void OS_Web::file_access_close_callback(const String &p_file, int p_flags) {
 }
 
 void OS_Web::update_pwa_state_callback() {
+#ifdef PROXY_TO_PTHREAD_ENABLED
+	if (!Thread::is_main_thread()) {
+		callable_mp_static(&OS_Web::update_pwa_state_callback).call_deferred();
+		return;
+	}
+#endif
 	if (OS_Web::get_singleton()) {
 		OS_Web::get_singleton()->pwa_is_waiting = true;
 	}
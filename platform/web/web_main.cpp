@@ -34,6 +34,7 @@
 
 #include "core/config/engine.h"
 #include "core/io/resource_loader.h"
+#include "core/templates/safe_refcount.h"
 #include "main/main.h"
 
 #include <emscripten/emscripten.h>
@@ -42,10 +43,10 @@
 static OS_Web *os = nullptr;
 static uint64_t target_ticks = 0;
 static bool main_started = false;
-static bool shutdown_complete = false;
+static SafeFlag shutdown_complete; // Set from the browser main thread with proxy_to_pthread.
 
 void exit_callback() {
-	if (!shutdown_complete) {
+	if (!shutdown_complete.is_set()) {
 		return; // Still waiting.
 	}
 	if (main_started) {
@@ -59,7 +60,7 @@ void exit_callback() {
 }
 
 void cleanup_after_sync() {
-	shutdown_complete = true;
+	shutdown_complete.set();
 }
 
 void main_loop_callback() {
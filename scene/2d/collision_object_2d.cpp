@@ -30,6 +30,7 @@
 
 #include "collision_object_2d.h"
 
+#include "scene/main/viewport.h"
 #include "scene/resources/world_2d.h"
 #include "scene/scene_string_names.h"
 
@@ -77,6 +78,8 @@ void CollisionObject2D::_notification(int p_what) {
 		} break;
 
 		case NOTIFICATION_TRANSFORM_CHANGED: {
+			Viewport::_physics_picking_changed();
+
 			if (only_update_transform_changes) {
 				return;
 			}
@@ -91,6 +94,8 @@ void CollisionObject2D::_notification(int p_what) {
 		} break;
 
 		case NOTIFICATION_EXIT_TREE: {
+			Viewport::_physics_picking_changed();
+
 			bool disabled = !is_enabled();
 
 			if (!disabled || (disable_mode != DISABLE_MODE_REMOVE)) {
@@ -315,6 +320,8 @@ void CollisionObject2D::remove_shape_owner(uint32_t owner) {
 void CollisionObject2D::shape_owner_set_disabled(uint32_t p_owner, bool p_disabled) {
 	ERR_FAIL_COND(!shapes.has(p_owner));
 
+	Viewport::_physics_picking_changed();
+
 	ShapeData &sd = shapes[p_owner];
 	sd.disabled = p_disabled;
 	for (int i = 0; i < sd.shapes.size(); i++) {
@@ -390,6 +397,8 @@ PackedInt32Array CollisionObject2D::_get_shape_owners() {
 void CollisionObject2D::shape_owner_set_transform(uint32_t p_owner, const Transform2D &p_transform) {
 	ERR_FAIL_COND(!shapes.has(p_owner));
 
+	Viewport::_physics_picking_changed();
+
 	ShapeData &sd = shapes[p_owner];
 
 	sd.xform = p_transform;
@@ -418,6 +427,8 @@ void CollisionObject2D::shape_owner_add_shape(uint32_t p_owner, const Ref<Shape2
 	ERR_FAIL_COND(!shapes.has(p_owner));
 	ERR_FAIL_COND(p_shape.is_null());
 
+	Viewport::_physics_picking_changed();
+
 	ShapeData &sd = shapes[p_owner];
 	ShapeData::Shape s;
 	s.index = total_subshapes;
@@ -456,6 +467,8 @@ void CollisionObject2D::shape_owner_remove_shape(uint32_t p_owner, int p_shape)
 	ERR_FAIL_COND(!shapes.has(p_owner));
 	ERR_FAIL_INDEX(p_shape, shapes[p_owner].shapes.size());
 
+	Viewport::_physics_picking_changed();
+
 	int index_to_remove = shapes[p_owner].shapes[p_shape].index;
 	if (area) {
 		PhysicsServer2D::get_singleton()->area_remove_shape(rid, index_to_remove);
@@ -574,6 +587,8 @@ void CollisionObject2D::_update_pickable() {
 		return;
 	}
 
+	Viewport::_physics_picking_changed();
+
 	bool is_pickable = pickable && is_visible_in_tree();
 	if (area) {
 		PhysicsServer2D::get_singleton()->area_set_pickable(rid, is_pickable);
@@ -111,6 +111,25 @@ private:
 	Vector<float> particle_data;
 	Vector<int> particle_order;
 
+	// What the serial emission pass left for _particles_process_group() to do with each particle.
+	struct ParticleStep {
+		double local_delta = 0.0;
+		float tv = 0.0;
+		bool process = false;
+		bool integrate = false;
+	};
+
+	struct ProcessGroup {
+		Particle *particles = nullptr;
+		const ParticleStep *steps = nullptr;
+		int count = 0;
+		Transform2D emission_xform;
+	};
+
+	static const int PROCESS_GROUP_SIZE = 256;
+
+	LocalVector<ParticleStep> particle_steps;
+
 	struct SortLifetime {
 		const Particle *particles = nullptr;
 
@@ -178,6 +197,8 @@ private:
 
 	void _update_internal();
 	void _particles_process(double p_delta);
+	void _server_mode_process(double p_delta);
+	void _particles_process_group(uint32_t p_group, ProcessGroup *p_process);
 	void _update_particle_data_buffer();
 
 	Mutex update_mutex;
@@ -33,6 +33,7 @@
 
 #include "core/core_string_names.h"
 #include "core/io/marshalls.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/resources/world_2d.h"
 #include "servers/navigation_server_2d.h"
 
@@ -270,7 +271,8 @@ void TileMapLayer::_rendering_update() {
 			}
 		}
 
-		// Update all dirty quadrants.
+		// Sort the dirty quadrants between the ones to redraw and the ones to free.
+		LocalVector<RenderingQuadrantDraw> quadrants_to_draw;
 		for (SelfList<RenderingQuadrant> *quadrant_list_element = dirty_rendering_quadrant_list.first(); quadrant_list_element;) {
 			SelfList<RenderingQuadrant> *next_quadrant_list_element = quadrant_list_element->next(); // "Hack" to clear the list while iterating.
 
@@ -287,108 +289,97 @@ void TileMapLayer::_rendering_update() {
 			}
 
 			if (has_a_tile) {
-				// Process the quadrant.
-
-				// First, clear the quadrant's canvas items.
-				for (RID &ci : rendering_quadrant->canvas_items) {
-					rs->free(ci);
+				RenderingQuadrantDraw quadrant_draw;
+				quadrant_draw.rendering_quadrant = rendering_quadrant;
+				quadrants_to_draw.push_back(quadrant_draw);
+			} else {
+				// Free the quadrant.
+				for (int i = 0; i < rendering_quadrant->canvas_items.size(); i++) {
+					const RID &ci = rendering_quadrant->canvas_items[i];
+					if (ci.is_valid()) {
+						rs->free(ci);
+					}
 				}
-				rendering_quadrant->canvas_items.clear();
-
-				// Those allow to group cell per material or z-index.
-				Ref<Material> prev_material;
-				int prev_z_index = 0;
-				RID prev_ci;
+				rendering_quadrant->cells.clear();
+				rendering_quadrant_map.erase(rendering_quadrant->quadrant_coords);
+			}
 
-				for (SelfList<CellData> *cell_data_quadrant_list_element = rendering_quadrant->cells.first(); cell_data_quadrant_list_element; cell_data_quadrant_list_element = cell_data_quadrant_list_element->next()) {
-					CellData &cell_data = *cell_data_quadrant_list_element->self();
+			quadrant_list_element = next_quadrant_list_element;
+		}
 
-					TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(*tile_set->get_source(cell_data.cell.source_id));
+		dirty_rendering_quadrant_list.clear();
 
-					// Get the tile data.
-					const TileData *tile_data;
-					if (cell_data.runtime_tile_data_cache) {
-						tile_data = cell_data.runtime_tile_data_cache;
-					} else {
-						tile_data = atlas_source->get_tile_data(cell_data.cell.get_atlas_coords(), cell_data.cell.alternative_tile);
-					}
+		// Gathering the cells only reads the TileSet, so it is spread on the WorkerThreadPool when many quadrants changed.
+		if (quadrants_to_draw.size() > 1 && Thread::is_main_thread()) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &TileMapLayer::_rendering_prepare_quadrant, quadrants_to_draw.ptr(), quadrants_to_draw.size(), -1, true, SNAME("TileMapLayerRenderingPrepare"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			for (uint32_t i = 0; i < quadrants_to_draw.size(); i++) {
+				_rendering_prepare_quadrant(i, quadrants_to_draw.ptr());
+			}
+		}
 
-					Ref<Material> mat = tile_data->get_material();
-					int tile_z_index = tile_data->get_z_index();
+		// Draw the quadrants.
+		for (const RenderingQuadrantDraw &quadrant_draw : quadrants_to_draw) {
+			const Ref<RenderingQuadrant> &rendering_quadrant = quadrant_draw.rendering_quadrant;
 
-					// Quandrant pos.
-					Vector2i quadrant_coords = _coords_to_rendering_quadrant_coords(cell_data.coords);
-					Vector2 ci_position = tile_map_node->map_to_local(quadrant_coords * get_effective_quadrant_size());
-					if (tile_map_node->is_y_sort_enabled() && y_sort_enabled) {
-						// When Y-sorting, the quandrant size is sure to be 1, we can thus offset the CanvasItem.
-						ci_position.y += y_sort_origin + tile_data->get_y_sort_origin();
-					}
+			// First, clear the quadrant's canvas items.
+			for (RID &ci : rendering_quadrant->canvas_items) {
+				rs->free(ci);
+			}
+			rendering_quadrant->canvas_items.clear();
 
-					// --- CanvasItems ---
-					RID ci;
+			// Those allow to group cell per material or z-index.
+			Ref<Material> prev_material;
+			int prev_z_index = 0;
+			RID prev_ci;
 
-					// Check if the material or the z_index changed.
-					if (prev_ci == RID() || prev_material != mat || prev_z_index != tile_z_index) {
-						// If so, create a new CanvasItem.
-						ci = rs->canvas_item_create();
-						if (mat.is_valid()) {
-							rs->canvas_item_set_material(ci, mat->get_rid());
-						}
-						rs->canvas_item_set_parent(ci, canvas_item);
-						rs->canvas_item_set_use_parent_material(ci, tile_map_node->get_use_parent_material() || tile_map_node->get_material().is_valid());
+			for (const RenderingQuadrantDraw::Cell &cell : quadrant_draw.cells) {
+				const CellData &cell_data = *cell.cell_data;
+				const TileData *tile_data = cell.tile_data;
 
-						Transform2D xform(0, ci_position);
-						rs->canvas_item_set_transform(ci, xform);
+				Ref<Material> mat = tile_data->get_material();
+				int tile_z_index = tile_data->get_z_index();
 
-						rs->canvas_item_set_light_mask(ci, tile_map_node->get_light_mask());
-						rs->canvas_item_set_z_as_relative_to_parent(ci, true);
-						rs->canvas_item_set_z_index(ci, tile_z_index);
+				// --- CanvasItems ---
+				RID ci;
 
-						rs->canvas_item_set_default_texture_filter(ci, RS::CanvasItemTextureFilter(tile_map_node->get_texture_filter_in_tree()));
-						rs->canvas_item_set_default_texture_repeat(ci, RS::CanvasItemTextureRepeat(tile_map_node->get_texture_repeat_in_tree()));
+				// Check if the material or the z_index changed.
+				if (prev_ci == RID() || prev_material != mat || prev_z_index != tile_z_index) {
+					// If so, create a new CanvasItem.
+					ci = rs->canvas_item_create();
+					if (mat.is_valid()) {
+						rs->canvas_item_set_material(ci, mat->get_rid());
+					}
+					rs->canvas_item_set_parent(ci, canvas_item);
+					rs->canvas_item_set_use_parent_material(ci, tile_map_node->get_use_parent_material() || tile_map_node->get_material().is_valid());
 
-						rendering_quadrant->canvas_items.push_back(ci);
+					Transform2D xform(0, cell.ci_position);
+					rs->canvas_item_set_transform(ci, xform);
 
-						prev_ci = ci;
-						prev_material = mat;
-						prev_z_index = tile_z_index;
+					rs->canvas_item_set_light_mask(ci, tile_map_node->get_light_mask());
+					rs->canvas_item_set_z_as_relative_to_parent(ci, true);
+					rs->canvas_item_set_z_index(ci, tile_z_index);
 
-					} else {
-						// Keep the same canvas_item to draw on.
-						ci = prev_ci;
-					}
+					rs->canvas_item_set_default_texture_filter(ci, RS::CanvasItemTextureFilter(tile_map_node->get_texture_filter_in_tree()));
+					rs->canvas_item_set_default_texture_repeat(ci, RS::CanvasItemTextureRepeat(tile_map_node->get_texture_repeat_in_tree()));
 
-					const Vector2 local_tile_pos = tile_map_node->map_to_local(cell_data.coords);
+					rendering_quadrant->canvas_items.push_back(ci);
 
-					// Random animation offset.
-					real_t random_animation_offset = 0.0;
-					if (atlas_source->get_tile_animation_mode(cell_data.cell.get_atlas_coords()) != TileSetAtlasSource::TILE_ANIMATION_MODE_DEFAULT) {
-						Array to_hash;
-						to_hash.push_back(local_tile_pos);
-						to_hash.push_back(get_instance_id()); // Use instance id as a random hash
-						random_animation_offset = RandomPCG(to_hash.hash()).randf();
-					}
+					prev_ci = ci;
+					prev_material = mat;
+					prev_z_index = tile_z_index;
 
-					// Drawing the tile in the canvas item.
-					tile_map_node->draw_tile(ci, local_tile_pos - ci_position, tile_set, cell_data.cell.source_id, cell_data.cell.get_atlas_coords(), cell_data.cell.alternative_tile, -1, tile_map_node->get_self_modulate(), tile_data, random_animation_offset);
-				}
-			} else {
-				// Free the quadrant.
-				for (int i = 0; i < rendering_quadrant->canvas_items.size(); i++) {
-					const RID &ci = rendering_quadrant->canvas_items[i];
-					if (ci.is_valid()) {
-						rs->free(ci);
-					}
+				} else {
+					// Keep the same canvas_item to draw on.
+					ci = prev_ci;
 				}
-				rendering_quadrant->cells.clear();
-				rendering_quadrant_map.erase(rendering_quadrant->quadrant_coords);
-			}
 
-			quadrant_list_element = next_quadrant_list_element;
+				// Drawing the tile in the canvas item.
+				tile_map_node->draw_tile(ci, cell.local_tile_pos - cell.ci_position, tile_set, cell_data.cell.source_id, cell_data.cell.get_atlas_coords(), cell_data.cell.alternative_tile, -1, tile_map_node->get_self_modulate(), tile_data, cell.random_animation_offset);
+			}
 		}
 
-		dirty_rendering_quadrant_list.clear();
-
 		// Reset the drawing indices.
 		{
 			int index = -(int64_t)0x80000000; // Always must be drawn below children.
@@ -463,6 +454,47 @@ void TileMapLayer::_rendering_update() {
 	_rendering_was_cleaned_up = forced_cleanup;
 }
 
+void TileMapLayer::_rendering_prepare_quadrant(uint32_t p_index, RenderingQuadrantDraw *p_quadrants) {
+	const Ref<TileSet> &tile_set = tile_map_node->get_tileset();
+	RenderingQuadrantDraw &quadrant_draw = p_quadrants[p_index];
+
+	for (SelfList<CellData> *cell_data_quadrant_list_element = quadrant_draw.rendering_quadrant->cells.first(); cell_data_quadrant_list_element; cell_data_quadrant_list_element = cell_data_quadrant_list_element->next()) {
+		const CellData &cell_data = *cell_data_quadrant_list_element->self();
+
+		TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(*tile_set->get_source(cell_data.cell.source_id));
+
+		RenderingQuadrantDraw::Cell cell;
+		cell.cell_data = &cell_data;
+
+		// Get the tile data.
+		if (cell_data.runtime_tile_data_cache) {
+			cell.tile_data = cell_data.runtime_tile_data_cache;
+		} else {
+			cell.tile_data = atlas_source->get_tile_data(cell_data.cell.get_atlas_coords(), cell_data.cell.alternative_tile);
+		}
+
+		// Quandrant pos.
+		Vector2i quadrant_coords = _coords_to_rendering_quadrant_coords(cell_data.coords);
+		cell.ci_position = tile_map_node->map_to_local(quadrant_coords * get_effective_quadrant_size());
+		if (tile_map_node->is_y_sort_enabled() && y_sort_enabled) {
+			// When Y-sorting, the quandrant size is sure to be 1, we can thus offset the CanvasItem.
+			cell.ci_position.y += y_sort_origin + cell.tile_data->get_y_sort_origin();
+		}
+
+		cell.local_tile_pos = tile_map_node->map_to_local(cell_data.coords);
+
+		// Random animation offset.
+		if (atlas_source->get_tile_animation_mode(cell_data.cell.get_atlas_coords()) != TileSetAtlasSource::TILE_ANIMATION_MODE_DEFAULT) {
+			Array to_hash;
+			to_hash.push_back(cell.local_tile_pos);
+			to_hash.push_back(get_instance_id()); // Use instance id as a random hash
+			cell.random_animation_offset = RandomPCG(to_hash.hash()).randf();
+		}
+
+		quadrant_draw.cells.push_back(cell);
+	}
+}
+
 void TileMapLayer::_rendering_quadrants_update_cell(CellData &r_cell_data, SelfList<RenderingQuadrant>::List &r_dirty_rendering_quadrant_list) {
 	const Ref<TileSet> &tile_set = tile_map_node->get_tileset();
 	Vector2i quadrant_coords = _coords_to_rendering_quadrant_coords(r_cell_data.coords);
@@ -619,22 +651,54 @@ void TileMapLayer::_physics_update() {
 
 	// Check if we should cleanup everything.
 	bool forced_cleanup = in_destructor || !enabled || !tile_map_node->is_inside_tree() || !tile_set.is_valid() || !tile_map_node->is_visible_in_tree();
+
+	// Free all quadrants if cleaning up or if their shape changed.
+	if (forced_cleanup || dirty.flags[DIRTY_FLAGS_TILE_MAP_COLLISION_QUADRANT_SIZE]) {
+		for (KeyValue<Vector2i, Ref<PhysicsQuadrant>> &kv : physics_quadrant_map) {
+			_physics_clear_quadrant(**kv.value);
+			kv.value->cells.clear();
+		}
+		physics_quadrant_map.clear();
+	}
+
 	if (forced_cleanup) {
 		// Clean everything.
 		for (KeyValue<Vector2i, CellData> &kv : tile_map) {
 			_physics_clear_cell(kv.value);
 		}
 	} else {
-		if (_physics_was_cleaned_up || dirty.flags[DIRTY_FLAGS_TILE_MAP_TILE_SET] || dirty.flags[DIRTY_FLAGS_TILE_MAP_COLLISION_ANIMATABLE]) {
+		bool use_quadrants = tile_map_node->get_collision_quadrant_size() > 1;
+		SelfList<PhysicsQuadrant>::List dirty_physics_quadrant_list;
+
+		if (_physics_was_cleaned_up || dirty.flags[DIRTY_FLAGS_TILE_MAP_TILE_SET] || dirty.flags[DIRTY_FLAGS_TILE_MAP_COLLISION_ANIMATABLE] || dirty.flags[DIRTY_FLAGS_TILE_MAP_COLLISION_QUADRANT_SIZE]) {
 			// Update all cells.
 			for (KeyValue<Vector2i, CellData> &kv : tile_map) {
 				_physics_update_cell(kv.value);
+				if (use_quadrants) {
+					_physics_quadrants_update_cell(kv.value, dirty_physics_quadrant_list);
+				}
 			}
 		} else {
 			// Update dirty cells.
 			for (SelfList<CellData> *cell_data_list_element = dirty.cell_list.first(); cell_data_list_element; cell_data_list_element = cell_data_list_element->next()) {
 				CellData &cell_data = *cell_data_list_element->self();
 				_physics_update_cell(cell_data);
+				if (use_quadrants) {
+					_physics_quadrants_update_cell(cell_data, dirty_physics_quadrant_list);
+				}
+			}
+		}
+
+		// Rebuild the bodies of the quadrants that were touched, and drop the empty ones.
+		while (SelfList<PhysicsQuadrant> *quadrant_list_element = dirty_physics_quadrant_list.first()) {
+			PhysicsQuadrant &physics_quadrant = *quadrant_list_element->self();
+			dirty_physics_quadrant_list.remove(quadrant_list_element);
+
+			if (physics_quadrant.cells.first()) {
+				_physics_update_quadrant(physics_quadrant);
+			} else {
+				_physics_clear_quadrant(physics_quadrant);
+				physics_quadrant_map.erase(physics_quadrant.quadrant_coords);
 			}
 		}
 	}
@@ -664,6 +728,13 @@ void TileMapLayer::_physics_notify_tilemap_change(TileMapLayer::DirtyFlags p_wha
 					}
 				}
 			}
+			for (KeyValue<Vector2i, Ref<PhysicsQuadrant>> &kv : physics_quadrant_map) {
+				for (RID body : kv.value->bodies) {
+					if (body.is_valid()) {
+						PhysicsServer2D::get_singleton()->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, gl_transform);
+					}
+				}
+			}
 		}
 	} else if (p_what == DIRTY_FLAGS_TILE_MAP_LOCAL_XFORM) {
 		if (tile_map_node->is_inside_tree() && tile_map_node->is_collision_animatable() && !in_editor) {
@@ -678,6 +749,13 @@ void TileMapLayer::_physics_notify_tilemap_change(TileMapLayer::DirtyFlags p_wha
 					}
 				}
 			}
+			for (KeyValue<Vector2i, Ref<PhysicsQuadrant>> &kv : physics_quadrant_map) {
+				for (RID body : kv.value->bodies) {
+					if (body.is_valid()) {
+						PhysicsServer2D::get_singleton()->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, gl_transform);
+					}
+				}
+			}
 		}
 	}
 }
@@ -734,8 +812,8 @@ void TileMapLayer::_physics_update_cell(CellData &r_cell_data) {
 					uint32_t physics_mask = tile_set->get_physics_layer_collision_mask(tile_set_physics_layer);
 
 					RID body = r_cell_data.bodies[tile_set_physics_layer];
-					if (tile_data->get_collision_polygons_count(tile_set_physics_layer) == 0) {
-						// No body needed, free it if it exists.
+					if (tile_data->get_collision_polygons_count(tile_set_physics_layer) == 0 || _physics_is_merged(tile_data, tile_set_physics_layer)) {
+						// No body needed (or the shapes go to the quadrant's body), free it if it exists.
 						if (body.is_valid()) {
 							bodies_coords.erase(body);
 							ps->free(body);
@@ -805,6 +883,162 @@ void TileMapLayer::_physics_update_cell(CellData &r_cell_data) {
 	_physics_clear_cell(r_cell_data);
 }
 
+Vector2i TileMapLayer::_coords_to_physics_quadrant_coords(const Vector2i &p_coords) const {
+	int quad_size = tile_map_node->get_collision_quadrant_size();
+
+	// Rounding down, instead of simply rounding towards zero (truncating).
+	return Vector2i(
+			p_coords.x > 0 ? p_coords.x / quad_size : (p_coords.x - (quad_size - 1)) / quad_size,
+			p_coords.y > 0 ? p_coords.y / quad_size : (p_coords.y - (quad_size - 1)) / quad_size);
+}
+
+const TileData *TileMapLayer::_physics_get_cell_tile_data(const CellData &p_cell_data) const {
+	const Ref<TileSet> &tile_set = tile_map_node->get_tileset();
+	const TileMapCell &c = p_cell_data.cell;
+
+	if (!tile_set->has_source(c.source_id)) {
+		return nullptr;
+	}
+	TileSetAtlasSource *atlas_source = Object::cast_to<TileSetAtlasSource>(*tile_set->get_source(c.source_id));
+	if (!atlas_source || !atlas_source->has_tile(c.get_atlas_coords()) || !atlas_source->has_alternative_tile(c.get_atlas_coords(), c.alternative_tile)) {
+		return nullptr;
+	}
+
+	if (p_cell_data.runtime_tile_data_cache) {
+		return p_cell_data.runtime_tile_data_cache;
+	}
+	return atlas_source->get_tile_data(c.get_atlas_coords(), c.alternative_tile);
+}
+
+bool TileMapLayer::_physics_is_merged(const TileData *p_tile_data, int p_physics_layer) const {
+	// Constant velocities are set on the body, so the tiles using them keep their own.
+	return tile_map_node->get_collision_quadrant_size() > 1 && p_tile_data->get_constant_linear_velocity(p_physics_layer) == Vector2() && p_tile_data->get_constant_angular_velocity(p_physics_layer) == 0.0;
+}
+
+void TileMapLayer::_physics_quadrants_update_cell(CellData &r_cell_data, SelfList<PhysicsQuadrant>::List &r_dirty_physics_quadrant_list) {
+	Vector2i quadrant_coords = _coords_to_physics_quadrant_coords(r_cell_data.coords);
+
+	HashMap<Vector2i, Ref<PhysicsQuadrant>>::Iterator E = physics_quadrant_map.find(quadrant_coords);
+	if (!E) {
+		if (!_physics_get_cell_tile_data(r_cell_data)) {
+			return; // Nothing to add nor remove.
+		}
+		Ref<PhysicsQuadrant> new_quadrant;
+		new_quadrant.instantiate();
+		new_quadrant->quadrant_coords = quadrant_coords;
+		E = physics_quadrant_map.insert(quadrant_coords, new_quadrant);
+	}
+	PhysicsQuadrant &physics_quadrant = **E->value;
+
+	// Add/Remove the cell to/from its quadrant.
+	bool is_valid = _physics_get_cell_tile_data(r_cell_data) != nullptr;
+	if (r_cell_data.physics_quadrant_list_element.in_list()) {
+		if (!is_valid) {
+			r_cell_data.physics_quadrant_list_element.remove_from_list();
+		}
+	} else if (is_valid) {
+		physics_quadrant.cells.add(&r_cell_data.physics_quadrant_list_element);
+	}
+
+	if (!physics_quadrant.dirty_quadrant_list_element.in_list()) {
+		r_dirty_physics_quadrant_list.add(&physics_quadrant.dirty_quadrant_list_element);
+	}
+}
+
+void TileMapLayer::_physics_clear_quadrant(PhysicsQuadrant &r_physics_quadrant) {
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+
+	for (RID body : r_physics_quadrant.bodies) {
+		if (body.is_valid()) {
+			bodies_coords.erase(body);
+			ps->free(body);
+		}
+	}
+	r_physics_quadrant.bodies.clear();
+}
+
+void TileMapLayer::_physics_update_quadrant(PhysicsQuadrant &r_physics_quadrant) {
+	const Ref<TileSet> &tile_set = tile_map_node->get_tileset();
+	Transform2D gl_transform = tile_map_node->get_global_transform();
+	RID space = tile_map_node->get_world_2d()->get_space();
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+
+	// Free unused bodies then resize the bodies array.
+	for (unsigned int i = tile_set->get_physics_layers_count(); i < r_physics_quadrant.bodies.size(); i++) {
+		RID body = r_physics_quadrant.bodies[i];
+		if (body.is_valid()) {
+			bodies_coords.erase(body);
+			ps->free(body);
+		}
+	}
+	r_physics_quadrant.bodies.resize(tile_set->get_physics_layers_count());
+
+	for (int tile_set_physics_layer = 0; tile_set_physics_layer < tile_set->get_physics_layers_count(); tile_set_physics_layer++) {
+		RID body = r_physics_quadrant.bodies[tile_set_physics_layer];
+		if (body.is_valid()) {
+			ps->body_clear_shapes(body);
+		}
+
+		// Add the shapes of every cell, placed relative to the TileMap.
+		int body_shape_index = 0;
+		for (SelfList<CellData> *cell_data_list_element = r_physics_quadrant.cells.first(); cell_data_list_element; cell_data_list_element = cell_data_list_element->next()) {
+			const CellData &cell_data = *cell_data_list_element->self();
+			const TileData *tile_data = _physics_get_cell_tile_data(cell_data);
+			if (!tile_data || !_physics_is_merged(tile_data, tile_set_physics_layer)) {
+				continue;
+			}
+
+			Transform2D shape_xform(0, tile_map_node->map_to_local(cell_data.coords));
+			for (int polygon_index = 0; polygon_index < tile_data->get_collision_polygons_count(tile_set_physics_layer); polygon_index++) {
+				bool one_way_collision = tile_data->is_collision_polygon_one_way(tile_set_physics_layer, polygon_index);
+				float one_way_collision_margin = tile_data->get_collision_polygon_one_way_margin(tile_set_physics_layer, polygon_index);
+				int shapes_count = tile_data->get_collision_polygon_shapes_count(tile_set_physics_layer, polygon_index);
+				for (int shape_index = 0; shape_index < shapes_count; shape_index++) {
+					if (!body.is_valid()) {
+						body = ps->body_create();
+					}
+					Ref<ConvexPolygonShape2D> shape = tile_data->get_collision_polygon_shape(tile_set_physics_layer, polygon_index, shape_index);
+					shape = tile_map_node->get_transformed_polygon(Ref<Resource>(shape), cell_data.cell.alternative_tile);
+					ps->body_add_shape(body, shape->get_rid(), shape_xform);
+					ps->body_set_shape_as_one_way_collision(body, body_shape_index, one_way_collision, one_way_collision_margin);
+
+					body_shape_index++;
+				}
+			}
+		}
+
+		if (body_shape_index == 0) {
+			// No shape left, free the body if it exists.
+			if (body.is_valid()) {
+				bodies_coords.erase(body);
+				ps->free(body);
+			}
+			body = RID();
+		} else {
+			Ref<PhysicsMaterial> physics_material = tile_set->get_physics_layer_physics_material(tile_set_physics_layer);
+
+			bodies_coords[body] = r_physics_quadrant.quadrant_coords * tile_map_node->get_collision_quadrant_size();
+			ps->body_set_mode(body, tile_map_node->is_collision_animatable() ? PhysicsServer2D::BODY_MODE_KINEMATIC : PhysicsServer2D::BODY_MODE_STATIC);
+			ps->body_set_space(body, space);
+			ps->body_set_state(body, PhysicsServer2D::BODY_STATE_TRANSFORM, gl_transform);
+			ps->body_attach_object_instance_id(body, tile_map_node->get_instance_id());
+			ps->body_set_collision_layer(body, tile_set->get_physics_layer_collision_layer(tile_set_physics_layer));
+			ps->body_set_collision_mask(body, tile_set->get_physics_layer_collision_mask(tile_set_physics_layer));
+			ps->body_set_pickable(body, false);
+
+			if (!physics_material.is_valid()) {
+				ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_BOUNCE, 0);
+				ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_FRICTION, 1);
+			} else {
+				ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_BOUNCE, physics_material->computed_bounce());
+				ps->body_set_param(body, PhysicsServer2D::BODY_PARAM_FRICTION, physics_material->computed_friction());
+			}
+		}
+
+		r_physics_quadrant.bodies[tile_set_physics_layer] = body;
+	}
+}
+
 #ifdef DEBUG_ENABLED
 void TileMapLayer::_physics_draw_cell_debug(const RID &p_canvas_item, const Vector2i &p_quadrant_pos, const CellData &r_cell_data) {
 	// Draw the debug collision shapes.
@@ -857,6 +1091,27 @@ void TileMapLayer::_physics_draw_cell_debug(const RID &p_canvas_item, const Vect
 			rs->canvas_item_add_set_transform(p_canvas_item, Transform2D());
 		}
 	}
+
+	// Shapes merged into the quadrant's bodies are drawn from the tile itself.
+	if (r_cell_data.physics_quadrant_list_element.in_list()) {
+		const TileData *tile_data = _physics_get_cell_tile_data(r_cell_data);
+		if (tile_data) {
+			rs->canvas_item_add_set_transform(p_canvas_item, Transform2D(0, tile_map_node->map_to_local(r_cell_data.coords) - p_quadrant_pos));
+			for (int tile_set_physics_layer = 0; tile_set_physics_layer < tile_set->get_physics_layers_count(); tile_set_physics_layer++) {
+				if (!_physics_is_merged(tile_data, tile_set_physics_layer)) {
+					continue;
+				}
+				for (int polygon_index = 0; polygon_index < tile_data->get_collision_polygons_count(tile_set_physics_layer); polygon_index++) {
+					for (int shape_index = 0; shape_index < tile_data->get_collision_polygon_shapes_count(tile_set_physics_layer, polygon_index); shape_index++) {
+						Ref<ConvexPolygonShape2D> shape = tile_data->get_collision_polygon_shape(tile_set_physics_layer, polygon_index, shape_index);
+						shape = tile_map_node->get_transformed_polygon(Ref<Resource>(shape), r_cell_data.cell.alternative_tile);
+						rs->canvas_item_add_polygon(p_canvas_item, shape->get_points(), color);
+					}
+				}
+			}
+			rs->canvas_item_add_set_transform(p_canvas_item, Transform2D());
+		}
+	}
 };
 #endif // DEBUG_ENABLED
 
@@ -3280,6 +3535,22 @@ bool TileMap::is_collision_animatable() const {
 	return collision_animatable;
 }
 
+void TileMap::set_collision_quadrant_size(int p_size) {
+	ERR_FAIL_COND_MSG(p_size < 1, "Collision quadrant size cannot be smaller than 1.");
+	if (collision_quadrant_size == p_size) {
+		return;
+	}
+	collision_quadrant_size = p_size;
+	for (Ref<TileMapLayer> &layer : layers) {
+		layer->notify_tile_map_change(TileMapLayer::DIRTY_FLAGS_TILE_MAP_COLLISION_QUADRANT_SIZE);
+	}
+	emit_signal(CoreStringNames::get_singleton()->changed);
+}
+
+int TileMap::get_collision_quadrant_size() const {
+	return collision_quadrant_size;
+}
+
 void TileMap::set_collision_visibility_mode(TileMap::VisibilityMode p_show_collision) {
 	if (collision_visibility_mode == p_show_collision) {
 		return;
@@ -4553,6 +4824,8 @@ void TileMap::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("set_collision_animatable", "enabled"), &TileMap::set_collision_animatable);
 	ClassDB::bind_method(D_METHOD("is_collision_animatable"), &TileMap::is_collision_animatable);
+	ClassDB::bind_method(D_METHOD("set_collision_quadrant_size", "size"), &TileMap::set_collision_quadrant_size);
+	ClassDB::bind_method(D_METHOD("get_collision_quadrant_size"), &TileMap::get_collision_quadrant_size);
 	ClassDB::bind_method(D_METHOD("set_collision_visibility_mode", "collision_visibility_mode"), &TileMap::set_collision_visibility_mode);
 	ClassDB::bind_method(D_METHOD("get_collision_visibility_mode"), &TileMap::get_collision_visibility_mode);
 
@@ -4600,6 +4873,7 @@ void TileMap::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "tile_set", PROPERTY_HINT_RESOURCE_TYPE, "TileSet"), "set_tileset", "get_tileset");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "rendering_quadrant_size", PROPERTY_HINT_RANGE, "1,128,1"), "set_rendering_quadrant_size", "get_rendering_quadrant_size");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "collision_animatable"), "set_collision_animatable", "is_collision_animatable");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "collision_quadrant_size", PROPERTY_HINT_RANGE, "1,128,1"), "set_collision_quadrant_size", "get_collision_quadrant_size");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "collision_visibility_mode", PROPERTY_HINT_ENUM, "Default,Force Show,Force Hide"), "set_collision_visibility_mode", "get_collision_visibility_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "navigation_visibility_mode", PROPERTY_HINT_ENUM, "Default,Force Show,Force Hide"), "set_navigation_visibility_mode", "get_navigation_visibility_mode");
 
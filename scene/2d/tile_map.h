@@ -93,6 +93,7 @@ public:
 class DebugQuadrant;
 #endif // DEBUG_ENABLED
 class RenderingQuadrant;
+class PhysicsQuadrant;
 
 struct CellData {
 	Vector2i coords;
@@ -108,6 +109,7 @@ struct CellData {
 
 	// Physics.
 	LocalVector<RID> bodies;
+	SelfList<CellData> physics_quadrant_list_element;
 
 	// Navigation.
 	LocalVector<RID> navigation_regions;
@@ -135,6 +137,7 @@ struct CellData {
 	CellData(const CellData &p_other) :
 			debug_quadrant_list_element(this),
 			rendering_quadrant_list_element(this),
+			physics_quadrant_list_element(this),
 			dirty_list_element(this) {
 		coords = p_other.coords;
 		cell = p_other.cell;
@@ -148,6 +151,7 @@ struct CellData {
 	CellData() :
 			debug_quadrant_list_element(this),
 			rendering_quadrant_list_element(this),
+			physics_quadrant_list_element(this),
 			dirty_list_element(this) {
 	}
 };
@@ -219,6 +223,33 @@ public:
 	}
 };
 
+class PhysicsQuadrant : public RefCounted {
+	GDCLASS(PhysicsQuadrant, RefCounted);
+
+public:
+	Vector2i quadrant_coords;
+	SelfList<CellData>::List cells;
+	LocalVector<RID> bodies; // One per TileSet physics layer, holding the shapes of all cells.
+
+	SelfList<PhysicsQuadrant> dirty_quadrant_list_element;
+
+	// For those, copy everything but SelfList elements.
+	PhysicsQuadrant(const PhysicsQuadrant &p_other) :
+			dirty_quadrant_list_element(this) {
+		quadrant_coords = p_other.quadrant_coords;
+		cells = p_other.cells;
+		bodies = p_other.bodies;
+	}
+
+	PhysicsQuadrant() :
+			dirty_quadrant_list_element(this) {
+	}
+
+	~PhysicsQuadrant() {
+		cells.clear();
+	}
+};
+
 class TileMapLayer : public RefCounted {
 	GDCLASS(TileMapLayer, RefCounted);
 
@@ -251,6 +282,7 @@ public:
 		DIRTY_FLAGS_TILE_MAP_TILE_SET,
 		DIRTY_FLAGS_TILE_MAP_QUADRANT_SIZE,
 		DIRTY_FLAGS_TILE_MAP_COLLISION_ANIMATABLE,
+		DIRTY_FLAGS_TILE_MAP_COLLISION_QUADRANT_SIZE,
 		DIRTY_FLAGS_TILE_MAP_COLLISION_VISIBILITY_MODE,
 		DIRTY_FLAGS_TILE_MAP_NAVIGATION_VISIBILITY_MODE,
 		DIRTY_FLAGS_TILE_MAP_Y_SORT_ENABLED,
@@ -306,6 +338,19 @@ private:
 	HashMap<Vector2i, Ref<RenderingQuadrant>> rendering_quadrant_map;
 	Vector2i _coords_to_rendering_quadrant_coords(const Vector2i &p_coords) const;
 	bool _rendering_was_cleaned_up = false;
+	// What is needed to draw the cells of a dirty quadrant, gathered before touching the RenderingServer.
+	struct RenderingQuadrantDraw {
+		struct Cell {
+			const CellData *cell_data = nullptr;
+			const TileData *tile_data = nullptr;
+			Vector2 ci_position;
+			Vector2 local_tile_pos;
+			real_t random_animation_offset = 0.0;
+		};
+		Ref<RenderingQuadrant> rendering_quadrant;
+		LocalVector<Cell> cells;
+	};
+	void _rendering_prepare_quadrant(uint32_t p_index, RenderingQuadrantDraw *p_quadrants);
 	void _rendering_update();
 	void _rendering_quadrants_update_cell(CellData &r_cell_data, SelfList<RenderingQuadrant>::List &r_dirty_rendering_quadrant_list);
 	void _rendering_occluders_clear_cell(CellData &r_cell_data);
@@ -320,6 +365,13 @@ private:
 	void _physics_notify_tilemap_change(DirtyFlags p_what);
 	void _physics_clear_cell(CellData &r_cell_data);
 	void _physics_update_cell(CellData &r_cell_data);
+	HashMap<Vector2i, Ref<PhysicsQuadrant>> physics_quadrant_map;
+	Vector2i _coords_to_physics_quadrant_coords(const Vector2i &p_coords) const;
+	const TileData *_physics_get_cell_tile_data(const CellData &p_cell_data) const;
+	bool _physics_is_merged(const TileData *p_tile_data, int p_physics_layer) const;
+	void _physics_quadrants_update_cell(CellData &r_cell_data, SelfList<PhysicsQuadrant>::List &r_dirty_physics_quadrant_list);
+	void _physics_clear_quadrant(PhysicsQuadrant &r_physics_quadrant);
+	void _physics_update_quadrant(PhysicsQuadrant &r_physics_quadrant);
 #ifdef DEBUG_ENABLED
 	void _physics_draw_cell_debug(const RID &p_canvas_item, const Vector2i &p_quadrant_pos, const CellData &r_cell_data);
 #endif // DEBUG_ENABLED
@@ -442,6 +494,7 @@ private:
 	Ref<TileSet> tile_set;
 	int rendering_quadrant_size = 16;
 	bool collision_animatable = false;
+	int collision_quadrant_size = 1;
 	VisibilityMode collision_visibility_mode = VISIBILITY_MODE_DEFAULT;
 	VisibilityMode navigation_visibility_mode = VISIBILITY_MODE_DEFAULT;
 
@@ -526,6 +579,9 @@ public:
 	void set_collision_animatable(bool p_enabled);
 	bool is_collision_animatable() const;
 
+	void set_collision_quadrant_size(int p_size);
+	int get_collision_quadrant_size() const;
+
 	// Debug visibility modes.
 	void set_collision_visibility_mode(VisibilityMode p_show_collision);
 	VisibilityMode get_collision_visibility_mode();
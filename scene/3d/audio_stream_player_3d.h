@@ -118,6 +118,7 @@ private:
 	float _get_attenuation_db(float p_distance) const;
 
 	float panning_strength = 1.0f;
+	float voice_priority = 0.0f;
 	float cached_global_panning_strength = 0.5f;
 
 protected:
@@ -189,6 +190,9 @@ public:
 	void set_panning_strength(float p_panning_strength);
 	float get_panning_strength() const;
 
+	void set_voice_priority(float p_priority);
+	float get_voice_priority() const;
+
 	bool has_stream_playback();
 	Ref<AudioStreamPlayback> get_stream_playback();
 
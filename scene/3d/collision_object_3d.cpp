@@ -30,6 +30,7 @@
 
 #include "collision_object_3d.h"
 
+#include "scene/main/viewport.h"
 #include "scene/resources/shape_3d.h"
 #include "scene/scene_string_names.h"
 
@@ -88,6 +89,8 @@ void CollisionObject3D::_notification(int p_what) {
 		} break;
 
 		case NOTIFICATION_TRANSFORM_CHANGED: {
+			Viewport::_physics_picking_changed();
+
 			if (only_update_transform_changes) {
 				return;
 			}
@@ -106,6 +109,8 @@ void CollisionObject3D::_notification(int p_what) {
 		} break;
 
 		case NOTIFICATION_EXIT_WORLD: {
+			Viewport::_physics_picking_changed();
+
 			bool disabled = !is_enabled();
 
 			if (!disabled || (disable_mode != DISABLE_MODE_REMOVE)) {
@@ -333,6 +338,8 @@ void CollisionObject3D::_update_pickable() {
 		return;
 	}
 
+	Viewport::_physics_picking_changed();
+
 	bool pickable = ray_pickable && is_visible_in_tree();
 	if (area) {
 		PhysicsServer3D::get_singleton()->area_set_ray_pickable(rid, pickable);
@@ -538,6 +545,8 @@ void CollisionObject3D::remove_shape_owner(uint32_t owner) {
 void CollisionObject3D::shape_owner_set_disabled(uint32_t p_owner, bool p_disabled) {
 	ERR_FAIL_COND(!shapes.has(p_owner));
 
+	Viewport::_physics_picking_changed();
+
 	ShapeData &sd = shapes[p_owner];
 	if (sd.disabled == p_disabled) {
 		return;
@@ -578,6 +587,8 @@ PackedInt32Array CollisionObject3D::_get_shape_owners() {
 void CollisionObject3D::shape_owner_set_transform(uint32_t p_owner, const Transform3D &p_transform) {
 	ERR_FAIL_COND(!shapes.has(p_owner));
 
+	Viewport::_physics_picking_changed();
+
 	ShapeData &sd = shapes[p_owner];
 	sd.xform = p_transform;
 	for (int i = 0; i < sd.shapes.size(); i++) {
@@ -606,6 +617,8 @@ void CollisionObject3D::shape_owner_add_shape(uint32_t p_owner, const Ref<Shape3
 	ERR_FAIL_COND(!shapes.has(p_owner));
 	ERR_FAIL_COND(p_shape.is_null());
 
+	Viewport::_physics_picking_changed();
+
 	ShapeData &sd = shapes[p_owner];
 	ShapeData::ShapeBase s;
 	s.index = total_subshapes;
@@ -648,6 +661,8 @@ void CollisionObject3D::shape_owner_remove_shape(uint32_t p_owner, int p_shape)
 	ERR_FAIL_COND(!shapes.has(p_owner));
 	ERR_FAIL_INDEX(p_shape, shapes[p_owner].shapes.size());
 
+	Viewport::_physics_picking_changed();
+
 	ShapeData::ShapeBase &s = shapes[p_owner].shapes.write[p_shape];
 	int index_to_remove = s.index;
 
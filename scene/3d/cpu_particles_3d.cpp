@@ -30,6 +30,8 @@
 
 #include "cpu_particles_3d.h"
 
+#include "core/math/batch_math.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/3d/camera_3d.h"
 #include "scene/3d/gpu_particles_3d.h"
 #include "scene/main/viewport.h"
@@ -589,6 +591,12 @@ void CPUParticles3D::_update_internal() {
 		cycle = 0;
 		return;
 	}
+
+	if (RS::get_singleton()->is_in_server_mode()) {
+		_server_mode_process(delta);
+		return;
+	}
+
 	_set_redraw(true);
 
 	bool processed = false;
@@ -640,6 +648,25 @@ void CPUParticles3D::_update_internal() {
 	}
 }
 
+void CPUParticles3D::_server_mode_process(double p_delta) {
+	// Nothing is drawn, only follow the emission cycles so one-shot emission still stops and finishes.
+	time += p_delta * speed_scale;
+	if (time > lifetime) {
+		time = Math::fmod(time, lifetime);
+		cycle++;
+		if (emitting) {
+			if (one_shot) {
+				set_emitting(false);
+				notify_property_list_changed();
+			}
+		} else if (active) {
+			// The last particles were emitted at most a lifetime ago.
+			active = false;
+			emit_signal(SceneStringNames::get_singleton()->finished);
+		}
+	}
+}
+
 void CPUParticles3D::_particles_process(double p_delta) {
 	p_delta *= speed_scale;
 
@@ -668,9 +695,17 @@ void CPUParticles3D::_particles_process(double p_delta) {
 
 	double system_phase = time / lifetime;
 
+	// Emission uses the global random generator and stays serial, the particles it
+	// leaves to process are then integrated in groups on the WorkerThreadPool.
+	particle_steps.resize(pcount);
+	ParticleStep *steps = particle_steps.ptr();
+
 	bool should_be_active = false;
 	for (int i = 0; i < pcount; i++) {
 		Particle &p = parray[i];
+		ParticleStep &step = steps[i];
+		step.process = false;
+		step.integrate = false;
 
 		if (!emitting && !p.active) {
 			continue;
@@ -884,7 +919,7 @@ void CPUParticles3D::_particles_process(double p_delta) {
 
 			if (!local_coords) {
 				p.velocity = velocity_xform.xform(p.velocity);
-				p.transform = emission_xform * p.transform;
+				p.transform = BatchMath::multiply(emission_xform, p.transform);
 			}
 
 			if (particle_flags[PARTICLE_FLAG_DISABLE_Z]) {
@@ -898,6 +933,57 @@ void CPUParticles3D::_particles_process(double p_delta) {
 			p.active = false;
 			tv = 1.0;
 		} else {
+			step.integrate = true;
+		}
+
+		step.process = true;
+		step.local_delta = local_delta;
+		step.tv = tv;
+		should_be_active = true;
+	}
+
+	ProcessGroup process_group;
+	process_group.particles = parray;
+	process_group.steps = steps;
+	process_group.count = pcount;
+	process_group.emission_xform = emission_xform;
+
+	int group_count = (pcount + PROCESS_GROUP_SIZE - 1) / PROCESS_GROUP_SIZE;
+	if (should_be_active && group_count > 1 && Thread::is_main_thread()) {
+		if (color_ramp.is_valid()) {
+			// Sorts the points if needed, so the threads only read the gradient.
+			(void)color_ramp->get_color_at_offset(0.0);
+		}
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &CPUParticles3D::_particles_process_group, &process_group, group_count, -1, true, SNAME("CPUParticles3DProcess"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (should_be_active) {
+		for (int i = 0; i < group_count; i++) {
+			_particles_process_group(i, &process_group);
+		}
+	}
+
+	if (!Math::is_equal_approx(time, 0.0) && active && !should_be_active) {
+		active = false;
+		emit_signal(SceneStringNames::get_singleton()->finished);
+	}
+}
+
+void CPUParticles3D::_particles_process_group(uint32_t p_group, ProcessGroup *p_process) {
+	const Transform3D &emission_xform = p_process->emission_xform;
+
+	int from = p_group * PROCESS_GROUP_SIZE;
+	int to = MIN(from + PROCESS_GROUP_SIZE, p_process->count);
+	for (int i = from; i < to; i++) {
+		const ParticleStep &step = p_process->steps[i];
+		if (!step.process) {
+			continue;
+		}
+
+		Particle &p = p_process->particles[i];
+		double local_delta = step.local_delta;
+		float tv = step.tv;
+
+		if (step.integrate) {
 			uint32_t alt_seed = p.seed;
 
 			p.time += local_delta;
@@ -1009,6 +1095,7 @@ void CPUParticles3D::_particles_process(double p_delta) {
 			p.custom[0] = Math::deg_to_rad(base_angle); //angle
 			p.custom[2] = tex_anim_offset * Math::lerp(parameters_min[PARAM_ANIM_OFFSET], parameters_max[PARAM_ANIM_OFFSET], p.anim_offset_rand) + tv * tex_anim_speed * Math::lerp(parameters_min[PARAM_ANIM_SPEED], parameters_max[PARAM_ANIM_SPEED], rand_from_seed(alt_seed)); //angle
 		}
+
 		//apply color
 		//apply hue rotation
 
@@ -1135,12 +1222,6 @@ void CPUParticles3D::_particles_process(double p_delta) {
 		}
 
 		p.transform.origin += p.velocity * local_delta;
-
-		should_be_active = true;
-	}
-	if (!Math::is_equal_approx(time, 0.0) && active && !should_be_active) {
-		active = false;
-		emit_signal(SceneStringNames::get_singleton()->finished);
 	}
 }
 
@@ -1195,7 +1276,7 @@ void CPUParticles3D::_update_particle_data_buffer() {
 		Transform3D t = r[idx].transform;
 
 		if (!local_coords) {
-			t = inv_emission_transform * t;
+			t = BatchMath::multiply(inv_emission_transform, t);
 		}
 
 		if (r[idx].active) {
@@ -1302,7 +1383,7 @@ void CPUParticles3D::_notification(int p_what) {
 				float *ptr = w;
 
 				for (int i = 0; i < pc; i++) {
-					Transform3D t = inv_emission_transform * r[i].transform;
+					Transform3D t = BatchMath::multiply(inv_emission_transform, r[i].transform);
 
 					if (r[i].active) {
 						ptr[0] = t.basis.rows[0][0];
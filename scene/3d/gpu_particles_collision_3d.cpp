@@ -477,17 +477,51 @@ Ref<Image> GPUParticlesCollisionSDF3D::bake() {
 		return Ref<Image>();
 	}
 
-	LocalVector<FacePos> face_pos;
+	float th = cell_size * thickness;
 
-	face_pos.resize(faces.size());
+	if (bake_step_function) {
+		bake_step_function(0, "Baking SDF");
+	}
 
-	float th = cell_size * thickness;
+	// The renderer bakes with a compute shader when it can, otherwise this is empty and the BVH is used.
+	Vector<uint8_t> cells_data;
+	{
+		Vector<Vector3> face_vertices;
+		face_vertices.resize(faces.size() * 3);
+		Vector3 *w = face_vertices.ptrw();
+		for (uint32_t i = 0; i < faces.size(); i++) {
+			for (int j = 0; j < 3; j++) {
+				w[i * 3 + j] = faces[i].vertex[j];
+			}
+		}
+		cells_data = RS::get_singleton()->particles_collision_bake_sdf(face_vertices, aabb, sdf_size, th);
+	}
+
+	if (cells_data.size() != sdf_size.z * sdf_size.y * sdf_size.x * (int)sizeof(float)) {
+		_bake_sdf_cpu(aabb, sdf_size, cell_size, faces, th, cells_data);
+	}
+
+	Ref<Image> ret = Image::create_from_data(sdf_size.x, sdf_size.y * sdf_size.z, false, Image::FORMAT_RF, cells_data);
+	ret->convert(Image::FORMAT_RH); //convert to half, save space
+	ret->set_meta("depth", sdf_size.z); //hack, make sure to add to the docs of this function
+
+	if (bake_end_function) {
+		bake_end_function();
+	}
+
+	return ret;
+}
+
+void GPUParticlesCollisionSDF3D::_bake_sdf_cpu(const AABB &p_aabb, const Vector3i &p_sdf_size, float p_cell_size, const LocalVector<Face3> &p_faces, float p_thickness, Vector<uint8_t> &r_cells_data) {
+	LocalVector<FacePos> face_pos;
+
+	face_pos.resize(p_faces.size());
 
-	for (uint32_t i = 0; i < faces.size(); i++) {
+	for (uint32_t i = 0; i < p_faces.size(); i++) {
 		face_pos[i].index = i;
-		face_pos[i].center = (faces[i].vertex[0] + faces[i].vertex[1] + faces[i].vertex[2]) / 2;
-		if (th > 0.0) {
-			face_pos[i].center -= faces[i].get_plane().normal * th * 0.5;
+		face_pos[i].center = (p_faces[i].vertex[0] + p_faces[i].vertex[1] + p_faces[i].vertex[2]) / 2;
+		if (p_thickness > 0.0) {
+			face_pos[i].center -= p_faces[i].get_plane().normal * p_thickness * 0.5;
 		}
 	}
 
@@ -497,34 +531,23 @@ Ref<Image> GPUParticlesCollisionSDF3D::bake() {
 
 	LocalVector<BVH> bvh;
 
-	_create_bvh(bvh, face_pos.ptr(), face_pos.size(), faces.ptr(), th);
+	_create_bvh(bvh, face_pos.ptr(), face_pos.size(), p_faces.ptr(), p_thickness);
 
-	Vector<uint8_t> cells_data;
-	cells_data.resize(sdf_size.z * sdf_size.y * sdf_size.x * (int)sizeof(float));
+	r_cells_data.resize(p_sdf_size.z * p_sdf_size.y * p_sdf_size.x * (int)sizeof(float));
 
 	if (bake_step_function) {
 		bake_step_function(0, "Baking SDF");
 	}
 
 	ComputeSDFParams params;
-	params.cells = (float *)cells_data.ptrw();
-	params.size = sdf_size;
-	params.cell_size = cell_size;
-	params.cell_offset = aabb.position + Vector3(cell_size * 0.5, cell_size * 0.5, cell_size * 0.5);
+	params.cells = (float *)r_cells_data.ptrw();
+	params.size = p_sdf_size;
+	params.cell_size = p_cell_size;
+	params.cell_offset = p_aabb.position + Vector3(p_cell_size * 0.5, p_cell_size * 0.5, p_cell_size * 0.5);
 	params.bvh = bvh.ptr();
-	params.triangles = faces.ptr();
-	params.thickness = th;
+	params.triangles = p_faces.ptr();
+	params.thickness = p_thickness;
 	_compute_sdf(&params);
-
-	Ref<Image> ret = Image::create_from_data(sdf_size.x, sdf_size.y * sdf_size.z, false, Image::FORMAT_RF, cells_data);
-	ret->convert(Image::FORMAT_RH); //convert to half, save space
-	ret->set_meta("depth", sdf_size.z); //hack, make sure to add to the docs of this function
-
-	if (bake_end_function) {
-		bake_end_function();
-	}
-
-	return ret;
 }
 
 PackedStringArray GPUParticlesCollisionSDF3D::get_configuration_warnings() const {
@@ -701,17 +724,13 @@ void GPUParticlesCollisionHeightField3D::_notification(int p_what) {
 						new_xform.origin -= z_axis * z_len;
 					}
 
+					// Moving the instance is enough, the renderer can then scroll the heightfield instead of redrawing all of it.
 					if (new_xform != xform) {
 						set_global_transform(new_xform);
-						RS::get_singleton()->particles_collision_height_field_update(_get_collision());
 					}
 				}
 			}
 		} break;
-
-		case NOTIFICATION_TRANSFORM_CHANGED: {
-			RS::get_singleton()->particles_collision_height_field_update(_get_collision());
-		} break;
 	}
 }
 
@@ -161,6 +161,7 @@ private:
 	void _find_closest_distance(const Vector3 &p_pos, const BVH *p_bvh, uint32_t p_bvh_cell, const Face3 *p_triangles, float p_thickness, float &r_closest_distance);
 	void _compute_sdf_z(uint32_t p_z, ComputeSDFParams *params);
 	void _compute_sdf(ComputeSDFParams *params);
+	void _bake_sdf_cpu(const AABB &p_aabb, const Vector3i &p_sdf_size, float p_cell_size, const LocalVector<Face3> &p_faces, float p_thickness, Vector<uint8_t> &r_cells_data);
 
 protected:
 	static void _bind_methods();
@@ -145,6 +145,7 @@ public:
 	enum BakeError {
 		BAKE_ERROR_LIGHTMAP_TOO_SMALL,
 		BAKE_ERROR_LIGHTMAP_CANT_PRE_BAKE_MESHES,
+		BAKE_ERROR_USER_ABORTED,
 		BAKE_OK
 	};
 
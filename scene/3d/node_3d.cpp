@@ -109,10 +109,18 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		return;
 	}
 
+	// A child this already went through during the current pass, and that is still dirty, has its whole subtree
+	// dirty and queued for notification, so moving a deep hierarchy repeatedly doesn't walk it every time.
+	// Threads don't track passes, as they only see part of the tree.
+	uint64_t pass = is_group_processing() ? 0 : get_tree()->xform_propagation_pass;
+
 	for (Node3D *&E : data.children) {
 		if (E->data.top_level) {
 			continue; //don't propagate to a top_level
 		}
+		if (pass && E->data.xform_propagation_pass == pass && E->_test_dirty_bits(DIRTY_GLOBAL_TRANSFORM)) {
+			continue;
+		}
 		E->_propagate_transform_changed(p_origin);
 	}
 #ifdef TOOLS_ENABLED
@@ -128,6 +136,27 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		}
 	}
 	_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM);
+	data.xform_propagation_pass = pass;
+}
+
+void Node3D::_invalidate_transform_propagation() {
+	if (is_inside_tree()) {
+		get_tree()->xform_propagation_pass++;
+	}
+}
+
+void Node3D::set_ignore_transform_notification(bool p_ignore) {
+	data.ignore_notification = p_ignore;
+	if (!p_ignore) {
+		// Changes propagated meanwhile didn't queue this node.
+#ifdef TOOLS_ENABLED
+		if (data.notify_transform || !data.gizmos.is_empty()) {
+#else
+		if (data.notify_transform) {
+#endif
+			_invalidate_transform_propagation();
+		}
+	}
 }
 
 void Node3D::_notification(int p_what) {
@@ -156,6 +185,7 @@ void Node3D::_notification(int p_what) {
 			}
 
 			_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM); // Global is always dirty upon entering a scene.
+			_invalidate_transform_propagation(); // Not queued by changes already propagated to its new parents.
 			_notify_dirty();
 
 			notification(NOTIFICATION_ENTER_WORLD);
@@ -602,6 +632,7 @@ void Node3D::add_gizmo(Ref<Node3DGizmo> p_gizmo) {
 		return;
 	}
 	data.gizmos.push_back(p_gizmo);
+	_invalidate_transform_propagation();
 
 	if (p_gizmo.is_valid() && is_inside_world()) {
 		p_gizmo->create();
@@ -739,6 +770,7 @@ void Node3D::set_as_top_level(bool p_enabled) {
 		}
 	}
 	data.top_level = p_enabled;
+	_invalidate_transform_propagation();
 }
 
 bool Node3D::is_set_as_top_level() const {
@@ -947,6 +979,9 @@ Vector3 Node3D::to_global(Vector3 p_local) const {
 void Node3D::set_notify_transform(bool p_enabled) {
 	ERR_THREAD_GUARD;
 	data.notify_transform = p_enabled;
+	if (p_enabled) {
+		_invalidate_transform_propagation();
+	}
 }
 
 bool Node3D::is_transform_notification_enabled() const {
@@ -971,6 +1006,7 @@ void Node3D::force_update_transform() {
 		return; //nothing to update
 	}
 	get_tree()->xform_change_list.remove(&xform_change);
+	_invalidate_transform_propagation();
 
 	notification(NOTIFICATION_TRANSFORM_CHANGED);
 }
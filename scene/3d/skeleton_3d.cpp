@@ -30,6 +30,7 @@
 
 #include "skeleton_3d.h"
 
+#include "core/math/batch_math.h"
 #include "core/object/message_queue.h"
 #include "core/variant/type_info.h"
 #include "scene/3d/physics_body_3d.h"
@@ -241,6 +242,12 @@ void Skeleton3D::_notification(int p_what) {
 			// Update bone transforms.
 			force_update_all_bone_transforms();
 
+			if (rs->is_in_server_mode()) {
+				// Skins are never drawn, only the poses matter.
+				emit_signal(SceneStringNames::get_singleton()->pose_updated);
+				break;
+			}
+
 			// Update skins.
 			for (SkinReference *E : skin_bindings) {
 				const Skin *skin = E->skin.operator->();
@@ -290,11 +297,32 @@ void Skeleton3D::_notification(int p_what) {
 					E->skeleton_version = version;
 				}
 
+				E->bone_transforms.resize(bind_count * 12);
+				float *dataptr = E->bone_transforms.ptrw();
 				for (uint32_t i = 0; i < bind_count; i++) {
 					uint32_t bone_index = E->skin_bone_indices_ptrs[i];
-					ERR_CONTINUE(bone_index >= (uint32_t)len);
-					rs->skeleton_bone_set_transform(skeleton, i, bonesptr[bone_index].pose_global * skin->get_bind_pose(i));
+					Transform3D xform;
+					if (likely(bone_index < (uint32_t)len)) {
+						xform = BatchMath::multiply(bonesptr[bone_index].pose_global, skin->get_bind_pose(i));
+					} else {
+						ERR_PRINT("Skin bind #" + itos(i) + " points to bone " + itos(bone_index) + ", which is out of range.");
+					}
+
+					float *bind_ptr = dataptr + i * 12;
+					bind_ptr[0] = xform.basis.rows[0][0];
+					bind_ptr[1] = xform.basis.rows[0][1];
+					bind_ptr[2] = xform.basis.rows[0][2];
+					bind_ptr[3] = xform.origin.x;
+					bind_ptr[4] = xform.basis.rows[1][0];
+					bind_ptr[5] = xform.basis.rows[1][1];
+					bind_ptr[6] = xform.basis.rows[1][2];
+					bind_ptr[7] = xform.origin.y;
+					bind_ptr[8] = xform.basis.rows[2][0];
+					bind_ptr[9] = xform.basis.rows[2][1];
+					bind_ptr[10] = xform.basis.rows[2][2];
+					bind_ptr[11] = xform.origin.z;
 				}
+				rs->skeleton_set_bone_transforms(skeleton, E->bone_transforms);
 			}
 			emit_signal(SceneStringNames::get_singleton()->pose_updated);
 		} break;
@@ -929,23 +957,23 @@ void Skeleton3D::force_update_bone_children_transforms(int p_bone_idx) {
 			Transform3D pose = b.pose_cache;
 
 			if (b.parent >= 0) {
-				b.pose_global = bonesptr[b.parent].pose_global * pose;
-				b.pose_global_no_override = bonesptr[b.parent].pose_global_no_override * pose;
+				b.pose_global = BatchMath::multiply(bonesptr[b.parent].pose_global, pose);
+				b.pose_global_no_override = BatchMath::multiply(bonesptr[b.parent].pose_global_no_override, pose);
 			} else {
 				b.pose_global = pose;
 				b.pose_global_no_override = pose;
 			}
 		} else {
 			if (b.parent >= 0) {
-				b.pose_global = bonesptr[b.parent].pose_global * b.rest;
-				b.pose_global_no_override = bonesptr[b.parent].pose_global_no_override * b.rest;
+				b.pose_global = BatchMath::multiply(bonesptr[b.parent].pose_global, b.rest);
+				b.pose_global_no_override = BatchMath::multiply(bonesptr[b.parent].pose_global_no_override, b.rest);
 			} else {
 				b.pose_global = b.rest;
 				b.pose_global_no_override = b.rest;
 			}
 		}
 		if (rest_dirty) {
-			b.global_rest = b.parent >= 0 ? bonesptr[b.parent].global_rest * b.rest : b.rest;
+			b.global_rest = b.parent >= 0 ? BatchMath::multiply(bonesptr[b.parent].global_rest, b.rest) : b.rest;
 		}
 
 		if (b.global_pose_override_amount >= CMP_EPSILON) {
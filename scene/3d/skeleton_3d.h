@@ -50,6 +50,7 @@ class SkinReference : public RefCounted {
 	uint64_t skeleton_version = 0;
 	Vector<uint32_t> skin_bone_indices;
 	uint32_t *skin_bone_indices_ptrs = nullptr;
+	Vector<float> bone_transforms; // 12 floats per bind, uploaded in one call.
 
 protected:
 	static void _bind_methods();
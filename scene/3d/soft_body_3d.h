@@ -62,6 +62,7 @@ public:
 	void set_vertex(int p_vertex_id, const void *p_vector3) override;
 	void set_normal(int p_vertex_id, const void *p_vector3) override;
 	void set_aabb(const AABB &p_aabb) override;
+	bool supports_threaded_writes() const override { return true; }
 };
 
 class SoftBody3D : public MeshInstance3D {
@@ -31,6 +31,7 @@
 #include "voxelizer.h"
 
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
 
 static _FORCE_INLINE_ void get_uv_and_normal(const Vector3 &p_pos, const Vector3 *p_vtx, const Vector2 *p_uv, const Vector3 *p_normal, Vector2 &r_uv, Vector3 &r_normal) {
 	if (p_pos.is_equal_approx(p_vtx[0])) {
@@ -72,7 +73,7 @@ static _FORCE_INLINE_ void get_uv_and_normal(const Vector3 &p_pos, const Vector3
 	r_normal = (p_normal[0] * u + p_normal[1] * v + p_normal[2] * w).normalized();
 }
 
-void Voxelizer::_plot_face(int p_idx, int p_level, int p_x, int p_y, int p_z, const Vector3 *p_vtx, const Vector3 *p_normal, const Vector2 *p_uv, const MaterialCache &p_material, const AABB &p_aabb) {
+void Voxelizer::_plot_face(Vector<Cell> &r_cells, int p_idx, int p_level, int p_x, int p_y, int p_z, const Vector3 *p_vtx, const Vector3 *p_normal, const Vector2 *p_uv, const MaterialCache &p_material, const AABB &p_aabb) {
 	if (p_level == cell_subdiv) {
 		//plot the face by guessing its albedo and emission value
 
@@ -219,16 +220,16 @@ void Voxelizer::_plot_face(int p_idx, int p_level, int p_x, int p_y, int p_z, co
 		}
 
 		//put this temporarily here, corrected in a later step
-		bake_cells.write[p_idx].albedo[0] += albedo_accum.r;
-		bake_cells.write[p_idx].albedo[1] += albedo_accum.g;
-		bake_cells.write[p_idx].albedo[2] += albedo_accum.b;
-		bake_cells.write[p_idx].emission[0] += emission_accum.r;
-		bake_cells.write[p_idx].emission[1] += emission_accum.g;
-		bake_cells.write[p_idx].emission[2] += emission_accum.b;
-		bake_cells.write[p_idx].normal[0] += normal_accum.x;
-		bake_cells.write[p_idx].normal[1] += normal_accum.y;
-		bake_cells.write[p_idx].normal[2] += normal_accum.z;
-		bake_cells.write[p_idx].alpha += alpha;
+		r_cells.write[p_idx].albedo[0] += albedo_accum.r;
+		r_cells.write[p_idx].albedo[1] += albedo_accum.g;
+		r_cells.write[p_idx].albedo[2] += albedo_accum.b;
+		r_cells.write[p_idx].emission[0] += emission_accum.r;
+		r_cells.write[p_idx].emission[1] += emission_accum.g;
+		r_cells.write[p_idx].emission[2] += emission_accum.b;
+		r_cells.write[p_idx].normal[0] += normal_accum.x;
+		r_cells.write[p_idx].normal[1] += normal_accum.y;
+		r_cells.write[p_idx].normal[2] += normal_accum.z;
+		r_cells.write[p_idx].alpha += alpha;
 
 	} else {
 		//go down
@@ -271,19 +272,19 @@ void Voxelizer::_plot_face(int p_idx, int p_level, int p_x, int p_y, int p_z, co
 				}
 			}
 
-			if (bake_cells[p_idx].children[i] == CHILD_EMPTY) {
+			if (r_cells[p_idx].children[i] == CHILD_EMPTY) {
 				//sub cell must be created
 
-				uint32_t child_idx = bake_cells.size();
-				bake_cells.write[p_idx].children[i] = child_idx;
-				bake_cells.resize(bake_cells.size() + 1);
-				bake_cells.write[child_idx].level = p_level + 1;
-				bake_cells.write[child_idx].x = nx / half;
-				bake_cells.write[child_idx].y = ny / half;
-				bake_cells.write[child_idx].z = nz / half;
+				uint32_t child_idx = r_cells.size();
+				r_cells.write[p_idx].children[i] = child_idx;
+				r_cells.resize(r_cells.size() + 1);
+				r_cells.write[child_idx].level = p_level + 1;
+				r_cells.write[child_idx].x = nx / half;
+				r_cells.write[child_idx].y = ny / half;
+				r_cells.write[child_idx].z = nz / half;
 			}
 
-			_plot_face(bake_cells[p_idx].children[i], p_level + 1, nx, ny, nz, p_vtx, p_normal, p_uv, p_material, aabb);
+			_plot_face(r_cells, r_cells[p_idx].children[i], p_level + 1, nx, ny, nz, p_vtx, p_normal, p_uv, p_material, aabb);
 		}
 	}
 }
@@ -397,7 +398,8 @@ void Voxelizer::plot_mesh(const Transform3D &p_xform, Ref<Mesh> &p_mesh, const V
 		} else {
 			src_material = p_mesh->surface_get_material(i);
 		}
-		MaterialCache material = _get_material_cache(src_material);
+		uint32_t material = plot_materials.size();
+		plot_materials.push_back(_get_material_cache(src_material));
 
 		Array a = p_mesh->surface_get_arrays(i);
 
@@ -422,69 +424,168 @@ void Voxelizer::plot_mesh(const Transform3D &p_xform, Ref<Mesh> &p_mesh, const V
 			const int *ir = index.ptr();
 
 			for (int j = 0; j < facecount; j++) {
-				Vector3 vtxs[3];
-				Vector2 uvs[3];
-				Vector3 normal[3];
+				PlotTriangle triangle;
+				triangle.material = material;
 
 				for (int k = 0; k < 3; k++) {
-					vtxs[k] = p_xform.xform(vr[ir[j * 3 + k]]);
+					triangle.vtx[k] = p_xform.xform(vr[ir[j * 3 + k]]);
 				}
 
 				if (uvr) {
 					for (int k = 0; k < 3; k++) {
-						uvs[k] = uvr[ir[j * 3 + k]];
+						triangle.uv[k] = uvr[ir[j * 3 + k]];
 					}
 				}
 
 				if (nr) {
 					for (int k = 0; k < 3; k++) {
-						normal[k] = nr[ir[j * 3 + k]];
+						triangle.normal[k] = nr[ir[j * 3 + k]];
 					}
 				}
 
 				//test against original bounds
-				if (!Geometry3D::triangle_box_overlap(original_bounds.get_center(), original_bounds.size * 0.5, vtxs)) {
+				if (!Geometry3D::triangle_box_overlap(original_bounds.get_center(), original_bounds.size * 0.5, triangle.vtx)) {
 					continue;
 				}
-				//plot
-				_plot_face(0, 0, 0, 0, 0, vtxs, normal, uvs, material, po2_bounds);
+				plot_triangles.push_back(triangle);
 			}
 
 		} else {
 			int facecount = vertices.size() / 3;
 
 			for (int j = 0; j < facecount; j++) {
-				Vector3 vtxs[3];
-				Vector2 uvs[3];
-				Vector3 normal[3];
+				PlotTriangle triangle;
+				triangle.material = material;
 
 				for (int k = 0; k < 3; k++) {
-					vtxs[k] = p_xform.xform(vr[j * 3 + k]);
+					triangle.vtx[k] = p_xform.xform(vr[j * 3 + k]);
 				}
 
 				if (uvr) {
 					for (int k = 0; k < 3; k++) {
-						uvs[k] = uvr[j * 3 + k];
+						triangle.uv[k] = uvr[j * 3 + k];
 					}
 				}
 
 				if (nr) {
 					for (int k = 0; k < 3; k++) {
-						normal[k] = nr[j * 3 + k];
+						triangle.normal[k] = nr[j * 3 + k];
 					}
 				}
 
 				//test against original bounds
-				if (!Geometry3D::triangle_box_overlap(original_bounds.get_center(), original_bounds.size * 0.5, vtxs)) {
+				if (!Geometry3D::triangle_box_overlap(original_bounds.get_center(), original_bounds.size * 0.5, triangle.vtx)) {
 					continue;
 				}
-				//plot face
-				_plot_face(0, 0, 0, 0, 0, vtxs, normal, uvs, material, po2_bounds);
+				plot_triangles.push_back(triangle);
+			}
+		}
+	}
+}
+
+void Voxelizer::_plot_subtree(uint32_t p_index, void *p_userdata) {
+	PlotSubtree &subtree = plot_subtrees[p_index];
+	int half = (1 << cell_subdiv) >> plot_subtree_level;
+
+	subtree.cells.resize(1);
+	subtree.cells.write[0].level = plot_subtree_level;
+	subtree.cells.write[0].x = subtree.x / half;
+	subtree.cells.write[0].y = subtree.y / half;
+	subtree.cells.write[0].z = subtree.z / half;
+
+	Vector3 qsize = subtree.aabb.size * 0.5;
+	Vector3 center = subtree.aabb.position + qsize;
+
+	for (const PlotTriangle &triangle : plot_triangles) {
+		// Same test the recursion does before entering a child.
+		if (!Geometry3D::triangle_box_overlap(center, qsize, triangle.vtx)) {
+			continue;
+		}
+		subtree.used = true;
+		_plot_face(subtree.cells, 0, plot_subtree_level, subtree.x, subtree.y, subtree.z, triangle.vtx, triangle.normal, triangle.uv, plot_materials[triangle.material], subtree.aabb);
+	}
+}
+
+void Voxelizer::_plot_triangles() {
+	// Each subtree below this level is plotted by its own task, as they never share cells.
+	plot_subtree_level = MIN(cell_subdiv, 2);
+	int count = 1 << plot_subtree_level;
+	int half = (1 << cell_subdiv) >> plot_subtree_level;
+	Vector3 size = po2_bounds.size / real_t(count);
+
+	for (int i = 0; i < count; i++) {
+		for (int j = 0; j < count; j++) {
+			for (int k = 0; k < count; k++) {
+				PlotSubtree subtree;
+				subtree.x = i * half;
+				subtree.y = j * half;
+				subtree.z = k * half;
+				//make sure to not plot beyond limits
+				if (subtree.x >= axis_cell_size[0] || subtree.y >= axis_cell_size[1] || subtree.z >= axis_cell_size[2]) {
+					continue;
+				}
+				subtree.aabb = AABB(po2_bounds.position + size * Vector3(i, j, k), size);
+				plot_subtrees.push_back(subtree);
+			}
+		}
+	}
+
+	if (!plot_triangles.is_empty()) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &Voxelizer::_plot_subtree, (void *)nullptr, plot_subtrees.size(), -1, true, SNAME("VoxelizerPlot"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
+	// Link the subtrees into the octree serially, in a fixed order so the result does not depend on scheduling.
+	for (const PlotSubtree &subtree : plot_subtrees) {
+		if (!subtree.used) {
+			continue;
+		}
+
+		if (plot_subtree_level == 0) {
+			bake_cells = subtree.cells;
+			continue;
+		}
+
+		uint32_t idx = 0;
+		for (int level = 0; level < plot_subtree_level - 1; level++) {
+			int shift = cell_subdiv - level - 1;
+			int child = ((subtree.x >> shift) & 1) | (((subtree.y >> shift) & 1) << 1) | (((subtree.z >> shift) & 1) << 2);
+
+			if (bake_cells[idx].children[child] == CHILD_EMPTY) {
+				//sub cell must be created
+				uint32_t child_idx = bake_cells.size();
+				bake_cells.write[idx].children[child] = child_idx;
+				bake_cells.resize(bake_cells.size() + 1);
+				bake_cells.write[child_idx].level = level + 1;
+				bake_cells.write[child_idx].x = subtree.x >> shift;
+				bake_cells.write[child_idx].y = subtree.y >> shift;
+				bake_cells.write[child_idx].z = subtree.z >> shift;
+			}
+			idx = bake_cells[idx].children[child];
+		}
+
+		int shift = cell_subdiv - plot_subtree_level;
+		int child = ((subtree.x >> shift) & 1) | (((subtree.y >> shift) & 1) << 1) | (((subtree.z >> shift) & 1) << 2);
+		uint32_t offset = bake_cells.size();
+		bake_cells.write[idx].children[child] = offset;
+		bake_cells.resize(offset + subtree.cells.size());
+
+		Cell *dst = bake_cells.ptrw() + offset;
+		const Cell *src = subtree.cells.ptr();
+		for (int i = 0; i < subtree.cells.size(); i++) {
+			dst[i] = src[i];
+			for (int j = 0; j < 8; j++) {
+				if (dst[i].children[j] != CHILD_EMPTY) {
+					dst[i].children[j] += offset;
+				}
 			}
 		}
 	}
 
 	max_original_cells = bake_cells.size();
+	plot_triangles.clear();
+	plot_materials.clear();
+	plot_subtrees.clear();
 }
 
 void Voxelizer::_sort() {
@@ -661,6 +762,7 @@ void Voxelizer::begin_bake(int p_subdiv, const AABB &p_bounds, float p_exposure_
 }
 
 void Voxelizer::end_bake() {
+	_plot_triangles();
 	if (!sorted) {
 		_sort();
 	}
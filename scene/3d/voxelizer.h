@@ -31,6 +31,7 @@
 #ifndef VOXELIZER_H
 #define VOXELIZER_H
 
+#include "core/templates/local_vector.h"
 #include "scene/resources/multimesh.h"
 
 class Voxelizer {
@@ -87,6 +88,29 @@ private:
 	};
 
 	HashMap<Ref<Material>, MaterialCache> material_cache;
+
+	// Triangles are gathered by plot_mesh() and plotted in parallel, one octree subtree per task, when the bake ends.
+	struct PlotTriangle {
+		Vector3 vtx[3];
+		Vector3 normal[3];
+		Vector2 uv[3];
+		uint32_t material = 0;
+	};
+
+	struct PlotSubtree {
+		AABB aabb;
+		int x = 0;
+		int y = 0;
+		int z = 0;
+		bool used = false;
+		Vector<Cell> cells;
+	};
+
+	LocalVector<PlotTriangle> plot_triangles;
+	LocalVector<MaterialCache> plot_materials;
+	LocalVector<PlotSubtree> plot_subtrees;
+	int plot_subtree_level = 0;
+
 	float exposure_normalization = 1.0;
 	AABB original_bounds;
 	AABB po2_bounds;
@@ -104,7 +128,9 @@ private:
 	Vector<Color> _get_bake_texture(Ref<Image> p_image, const Color &p_color_mul, const Color &p_color_add);
 	MaterialCache _get_material_cache(Ref<Material> p_material);
 
-	void _plot_face(int p_idx, int p_level, int p_x, int p_y, int p_z, const Vector3 *p_vtx, const Vector3 *p_normal, const Vector2 *p_uv, const MaterialCache &p_material, const AABB &p_aabb);
+	void _plot_face(Vector<Cell> &r_cells, int p_idx, int p_level, int p_x, int p_y, int p_z, const Vector3 *p_vtx, const Vector3 *p_normal, const Vector2 *p_uv, const MaterialCache &p_material, const AABB &p_aabb);
+	void _plot_subtree(uint32_t p_index, void *p_userdata);
+	void _plot_triangles();
 	void _fixup_plot(int p_idx, int p_level);
 	void _debug_mesh(int p_idx, int p_level, const AABB &p_aabb, Ref<MultiMesh> &p_multimesh, int &idx);
 
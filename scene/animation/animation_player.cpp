@@ -34,6 +34,7 @@
 #include "core/object/message_queue.h"
 #include "scene/scene_string_names.h"
 #include "servers/audio/audio_stream.h"
+#include "servers/rendering_server.h"
 
 #ifdef TOOLS_ENABLED
 #include "editor/editor_node.h"
@@ -606,8 +607,8 @@ void AnimationPlayer::_animation_process_animation(AnimationData *p_anim, double
 			} break;
 			case Animation::TYPE_BLEND_SHAPE: {
 #ifndef _3D_DISABLED
-				if (!nc->node_blend_shape) {
-					continue;
+				if (!nc->node_blend_shape || RS::get_singleton()->is_in_server_mode()) {
+					continue; // Blend shapes only affect visuals.
 				}
 
 				float blend;
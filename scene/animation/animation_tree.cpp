@@ -31,10 +31,16 @@
 #include "animation_tree.h"
 
 #include "animation_blend_tree.h"
+#include "animation_node_state_machine.h"
 #include "core/config/engine.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/thread_safe.h"
+#include "scene/2d/visible_on_screen_notifier_2d.h"
+#include "scene/3d/visible_on_screen_notifier_3d.h"
 #include "scene/resources/animation.h"
 #include "scene/scene_string_names.h"
 #include "servers/audio/audio_stream.h"
+#include "servers/rendering_server.h"
 
 void AnimationNode::get_parameter_list(List<PropertyInfo> *r_list) const {
 	Array parameters;
@@ -577,6 +583,145 @@ AnimationTree::AnimationProcessCallback AnimationTree::get_process_callback() co
 	return process_callback;
 }
 
+void AnimationTree::set_use_threaded_blending(bool p_enable) {
+	use_threaded_blending = p_enable;
+}
+
+bool AnimationTree::is_using_threaded_blending() const {
+	return use_threaded_blending;
+}
+
+void AnimationTree::set_lod_frame_interval(int p_interval) {
+	ERR_FAIL_COND(p_interval < 1);
+	lod_frame_interval = p_interval;
+}
+
+int AnimationTree::get_lod_frame_interval() const {
+	return lod_frame_interval;
+}
+
+void AnimationTree::set_lod_offscreen_frame_interval(int p_interval) {
+	ERR_FAIL_COND(p_interval < 1);
+	lod_offscreen_frame_interval = p_interval;
+}
+
+int AnimationTree::get_lod_offscreen_frame_interval() const {
+	return lod_offscreen_frame_interval;
+}
+
+void AnimationTree::set_lod_visibility_notifier(const NodePath &p_notifier) {
+	lod_visibility_notifier = p_notifier;
+}
+
+NodePath AnimationTree::get_lod_visibility_notifier() const {
+	return lod_visibility_notifier;
+}
+
+void AnimationTree::set_lod_interpolate(bool p_interpolate) {
+	lod_interpolate = p_interpolate;
+}
+
+bool AnimationTree::is_lod_interpolating() const {
+	return lod_interpolate;
+}
+
+bool AnimationTree::_lod_update(double p_delta, double &r_delta) {
+	int interval = lod_frame_interval;
+	if (!lod_visibility_notifier.is_empty()) {
+		Node *notifier = get_node_or_null(lod_visibility_notifier);
+		bool on_screen = true;
+#ifndef _3D_DISABLED
+		if (Object::cast_to<VisibleOnScreenNotifier3D>(notifier)) {
+			on_screen = Object::cast_to<VisibleOnScreenNotifier3D>(notifier)->is_on_screen();
+		}
+#endif // _3D_DISABLED
+		if (Object::cast_to<VisibleOnScreenNotifier2D>(notifier)) {
+			on_screen = Object::cast_to<VisibleOnScreenNotifier2D>(notifier)->is_on_screen();
+		}
+		if (!on_screen) {
+			interval = lod_offscreen_frame_interval;
+		}
+	}
+
+	lod_delta += p_delta;
+	if (interval > 1 && lod_frames >= 0) {
+		lod_frames++;
+		if (lod_frames < interval) {
+			// Root motion of the skipped frames is reported with the next update.
+			root_motion_position = Vector3(0, 0, 0);
+			root_motion_rotation = Quaternion(0, 0, 0, 1);
+			root_motion_scale = Vector3(0, 0, 0);
+			if (lod_interpolate) {
+				_lod_interpolate_tracks(interval - lod_frames);
+			}
+			return false;
+		}
+	}
+
+	// Spread the first updates of trees created together over the interval.
+	lod_frames = lod_frames < 0 && interval > 1 ? int(uint64_t(get_instance_id()) % (uint64_t)interval) : 0;
+	lod_current_interval = interval;
+	r_delta = lod_delta;
+	lod_delta = 0.0;
+	return true;
+}
+
+void AnimationTree::_lod_interpolate_tracks(int p_remaining_frames) {
+	real_t weight = 1.0 / p_remaining_frames;
+	for (const KeyValue<NodePath, TrackCache *> &K : track_cache) {
+		TrackCache *track = K.value;
+		switch (track->type) {
+#ifndef _3D_DISABLED
+			case Animation::TYPE_POSITION_3D: {
+				TrackCacheTransform *t = static_cast<TrackCacheTransform *>(track);
+				if (t->lod_valid && !t->root_motion) {
+					t->lod_loc = t->lod_loc.lerp(t->loc, weight);
+					t->lod_rot = t->lod_rot.slerp(t->rot, weight);
+					t->lod_scale = t->lod_scale.lerp(t->scale, weight);
+					_set_transform_track(t, t->lod_loc, t->lod_rot, t->lod_scale);
+				}
+			} break;
+			case Animation::TYPE_BLEND_SHAPE: {
+				TrackCacheBlendShape *t = static_cast<TrackCacheBlendShape *>(track);
+				if (t->lod_valid && t->mesh_3d) {
+					t->lod_value = Math::lerp(t->lod_value, t->value, (float)weight);
+					t->mesh_3d->set_blend_shape_value(t->shape_index, t->lod_value);
+				}
+			} break;
+#endif // _3D_DISABLED
+			default: {
+			} break;
+		}
+	}
+}
+
+#ifndef _3D_DISABLED
+void AnimationTree::_set_transform_track(TrackCacheTransform *p_track, const Vector3 &p_loc, const Quaternion &p_rot, const Vector3 &p_scale) {
+	if (p_track->skeleton && p_track->bone_idx >= 0) {
+		if (p_track->loc_used) {
+			p_track->skeleton->set_bone_pose_position(p_track->bone_idx, p_loc);
+		}
+		if (p_track->rot_used) {
+			p_track->skeleton->set_bone_pose_rotation(p_track->bone_idx, p_rot);
+		}
+		if (p_track->scale_used) {
+			p_track->skeleton->set_bone_pose_scale(p_track->bone_idx, p_scale);
+		}
+
+	} else if (!p_track->skeleton) {
+		if (p_track->loc_used) {
+			p_track->node_3d->set_position(p_loc);
+		}
+		if (p_track->rot_used) {
+			p_track->node_3d->set_rotation(p_rot.get_euler());
+		}
+		if (p_track->scale_used) {
+			p_track->node_3d->set_scale(p_scale);
+		}
+	}
+}
+#endif // _3D_DISABLED
+
 void AnimationTree::_node_removed(Node *p_node) {
 	cache_valid = false;
 }
@@ -930,6 +1075,8 @@ void AnimationTree::_clear_caches() {
 	}
 	track_cache.clear();
 	cache_valid = false;
+	threaded_value_sets.clear();
+	threaded_blend_valid = false; // Blended on a thread but not applied yet, the caches it blended to are gone.
 }
 
 void AnimationTree::_clear_audio_streams() {
@@ -965,6 +1112,12 @@ void AnimationTree::_call_object(Object *p_object, const StringName &p_method, c
 	}
 }
 void AnimationTree::_process_graph(double p_delta) {
+	if (_process_graph_prepare() && _process_graph_blend(p_delta)) {
+		_process_graph_apply();
+	}
+}
+
+bool AnimationTree::_process_graph_prepare() {
 	_update_properties(); //if properties need updating, update them
 
 	//check all tracks, see if they need modification
@@ -976,14 +1129,14 @@ void AnimationTree::_process_graph(double p_delta) {
 		ERR_PRINT("AnimationTree: root AnimationNode is not set, disabling playback.");
 		set_active(false);
 		cache_valid = false;
-		return;
+		return false;
 	}
 
 	if (!has_node(animation_player)) {
 		ERR_PRINT("AnimationTree: no valid AnimationPlayer path set, disabling playback");
 		set_active(false);
 		cache_valid = false;
-		return;
+		return false;
 	}
 
 	AnimationPlayer *player = Object::cast_to<AnimationPlayer>(get_node(animation_player));
@@ -1013,15 +1166,20 @@ void AnimationTree::_process_graph(double p_delta) {
 		ERR_PRINT("AnimationTree: path points to a node not an AnimationPlayer, disabling playback");
 		set_active(false);
 		cache_valid = false;
-		return;
+		return false;
 	}
 
 	if (!cache_valid) {
 		if (!_update_caches(player)) {
-			return;
+			return false;
 		}
 	}
 
+	state.player = player;
+	return true;
+}
+
+bool AnimationTree::_process_graph_blend(double p_delta) {
 	{ //setup
 
 		process_pass++;
@@ -1029,7 +1187,6 @@ void AnimationTree::_process_graph(double p_delta) {
 		state.valid = true;
 		state.invalid_reasons = "";
 		state.animation_states.clear(); //will need to be re-created
-		state.player = player;
 		state.last_pass = process_pass;
 		state.tree = this;
 
@@ -1055,7 +1212,7 @@ void AnimationTree::_process_graph(double p_delta) {
 	}
 
 	if (!state.valid) {
-		return; //state is not valid. do nothing.
+		return false; //state is not valid. do nothing.
 	}
 
 	// Init all value/transform/blend/bezier tracks that track_cache has.
@@ -1433,6 +1590,9 @@ void AnimationTree::_process_graph(double p_delta) {
 						if (Math::is_zero_approx(blend)) {
 							continue; // Nothing to blend.
 						}
+						if (RS::get_singleton()->is_in_server_mode()) {
+							continue; // Blend shapes only affect visuals.
+						}
 						TrackCacheBlendShape *t = static_cast<TrackCacheBlendShape *>(track);
 
 						float value;
@@ -1499,14 +1659,22 @@ void AnimationTree::_process_graph(double p_delta) {
 								}
 								Variant value = a->track_get_key_value(i, idx);
 								value = post_process_key_value(a, i, value, t->object);
-								t->object->set_indexed(t->subpath, value);
+								if (blending_on_thread) {
+									threaded_value_sets.push_back({ t, value });
+								} else {
+									t->object->set_indexed(t->subpath, value);
+								}
 							} else {
 								List<int> indices;
 								a->track_get_key_indices_in_range(i, time, delta, &indices, looped_flag);
 								for (int &F : indices) {
 									Variant value = a->track_get_key_value(i, F);
 									value = post_process_key_value(a, i, value, t->object);
-									t->object->set_indexed(t->subpath, value);
+									if (blending_on_thread) {
+										threaded_value_sets.push_back({ t, value });
+									} else {
+										t->object->set_indexed(t->subpath, value);
+									}
 								}
 							}
 						}
@@ -1717,6 +1885,16 @@ void AnimationTree::_process_graph(double p_delta) {
 		}
 	}
 
+	return true;
+}
+
+void AnimationTree::_process_graph_apply() {
+	// Discrete values keyed while blending on a thread, in the order they were keyed.
+	for (const ThreadedValueSet &E : threaded_value_sets) {
+		E.track->object->set_indexed(E.track->subpath, E.value);
+	}
+	threaded_value_sets.clear();
+
 	{
 		// finally, set the tracks
 		for (const KeyValue<NodePath, TrackCache *> &K : track_cache) {
@@ -1734,27 +1912,19 @@ void AnimationTree::_process_graph(double p_delta) {
 						root_motion_position_accumulator = t->loc;
 						root_motion_rotation_accumulator = t->rot;
 						root_motion_scale_accumulator = t->scale;
-					} else if (t->skeleton && t->bone_idx >= 0) {
-						if (t->loc_used) {
-							t->skeleton->set_bone_pose_position(t->bone_idx, t->loc);
-						}
-						if (t->rot_used) {
-							t->skeleton->set_bone_pose_rotation(t->bone_idx, t->rot);
-						}
-						if (t->scale_used) {
-							t->skeleton->set_bone_pose_scale(t->bone_idx, t->scale);
-						}
-
-					} else if (!t->skeleton) {
-						if (t->loc_used) {
-							t->node_3d->set_position(t->loc);
-						}
-						if (t->rot_used) {
-							t->node_3d->set_rotation(t->rot.get_euler());
-						}
-						if (t->scale_used) {
-							t->node_3d->set_scale(t->scale);
-						}
+					} else if (lod_interpolate && lod_current_interval > 1 && t->lod_valid) {
+						// Move towards the new pose over the frames until the next update.
+						real_t weight = 1.0 / lod_current_interval;
+						t->lod_loc = t->lod_loc.lerp(t->loc, weight);
+						t->lod_rot = t->lod_rot.slerp(t->rot, weight);
+						t->lod_scale = t->lod_scale.lerp(t->scale, weight);
+						_set_transform_track(t, t->lod_loc, t->lod_rot, t->lod_scale);
+					} else {
+						t->lod_valid = true;
+						t->lod_loc = t->loc;
+						t->lod_rot = t->rot;
+						t->lod_scale = t->scale;
+						_set_transform_track(t, t->loc, t->rot, t->scale);
 					}
 #endif // _3D_DISABLED
 				} break;
@@ -1762,8 +1932,14 @@ void AnimationTree::_process_graph(double p_delta) {
 #ifndef _3D_DISABLED
 					TrackCacheBlendShape *t = static_cast<TrackCacheBlendShape *>(track);
 
-					if (t->mesh_3d) {
-						t->mesh_3d->set_blend_shape_value(t->shape_index, t->value);
+					if (t->mesh_3d && !RS::get_singleton()->is_in_server_mode()) {
+						if (lod_interpolate && lod_current_interval > 1 && t->lod_valid) {
+							t->lod_value = Math::lerp(t->lod_value, t->value, 1.0f / lod_current_interval);
+						} else {
+							t->lod_valid = true;
+							t->lod_value = t->value;
+						}
+						t->mesh_3d->set_blend_shape_value(t->shape_index, t->lod_value);
 					}
 #endif // _3D_DISABLED
 				} break;
@@ -1882,6 +2058,186 @@ void AnimationTree::advance(double p_time) {
 	_process_graph(p_time);
 }
 
+LocalVector<ObjectID> AnimationTree::threaded_blend_queue;
+bool AnimationTree::threaded_blend_flush_queued = false;
+
+void AnimationTree::_queue_threaded_blend(double p_delta) {
+	if (threaded_blend_queued) {
+		threaded_blend_delta += p_delta;
+		return;
+	}
+	threaded_blend_queued = true;
+	threaded_blend_delta = p_delta;
+	threaded_blend_queue.push_back(get_instance_id());
+
+	if (!threaded_blend_flush_queued) {
+		// Flushed right after the nodes of this frame are processed.
+		threaded_blend_flush_queued = true;
+		callable_mp_static(&AnimationTree::_flush_threaded_blends).call_deferred();
+	}
+}
+
+bool AnimationTree::_is_threaded_blend_safe(LocalVector<AnimationNode *> &r_nodes) {
+	if (GDVIRTUAL_IS_OVERRIDDEN(_post_process_key_value)) {
+		return false;
+	}
+
+	// Tracks with side effects are handled while blending.
+	for (const KeyValue<NodePath, TrackCache *> &K : track_cache) {
+		if (K.value->type == Animation::TYPE_METHOD || K.value->type == Animation::TYPE_AUDIO || K.value->type == Animation::TYPE_ANIMATION) {
+			return false;
+		}
+	}
+
+	// AnimationNodes keep their blending state in the resource, so the nodes are gathered to keep trees sharing them on the same thread.
+	HashSet<AnimationNode *> visited;
+	List<AnimationNode *> pending;
+	pending.push_back(root.ptr());
+	while (!pending.is_empty()) {
+		AnimationNode *node = pending.front()->get();
+		pending.pop_front();
+		if (visited.has(node)) {
+			continue;
+		}
+		visited.insert(node);
+		r_nodes.push_back(node);
+
+		if (node->get_script_instance()) {
+			return false; // Scripted nodes may do anything, and children can only be listed by calling them.
+		}
+
+		AnimationNodeStateMachine *state_machine = Object::cast_to<AnimationNodeStateMachine>(node);
+		if (state_machine) {
+			for (int i = 0; i < state_machine->get_transition_count(); i++) {
+				if (!state_machine->get_transition(i)->get_advance_expression().is_empty()) {
+					return false; // Expressions run on the base node.
+				}
+			}
+		}
+
+		List<AnimationNode::ChildNode> children;
+		node->get_child_nodes(&children);
+		for (const AnimationNode::ChildNode &E : children) {
+			if (E.node.is_valid()) {
+				pending.push_back(E.node.ptr());
+			}
+		}
+	}
+	return true;
+}
+
+void AnimationTree::_threaded_blend_group(void *p_userdata, uint32_t p_index) {
+	const LocalVector<AnimationTree *> &trees = static_cast<LocalVector<AnimationTree *> *>(p_userdata)[p_index];
+
+	// The main thread waits for blending to finish, and each tree only touches its own nodes.
+	bool safe_for_nodes_backup = is_current_thread_safe_for_nodes();
+	set_current_thread_safe_for_nodes(true);
+	for (AnimationTree *tree : trees) {
+		tree->blending_on_thread = true;
+		tree->threaded_blend_valid = tree->_process_graph_blend(tree->threaded_blend_delta);
+		tree->blending_on_thread = false;
+	}
+	set_current_thread_safe_for_nodes(safe_for_nodes_backup);
+}
+
+void AnimationTree::_flush_threaded_blends() {
+	threaded_blend_flush_queued = false;
+
+	LocalVector<ObjectID> queue;
+	SWAP(queue, threaded_blend_queue);
+
+	LocalVector<AnimationTree *> trees;
+	LocalVector<ObjectID> sync_trees;
+	LocalVector<uint32_t> tree_sets; // Union-find of trees sharing AnimationNodes, the earliest tree is the root.
+	HashMap<AnimationNode *, uint32_t> node_trees;
+	LocalVector<AnimationNode *> nodes;
+
+	for (const ObjectID &id : queue) {
+		AnimationTree *tree = Object::cast_to<AnimationTree>(ObjectDB::get_instance(id));
+		if (!tree || !tree->threaded_blend_queued) {
+			continue;
+		}
+		tree->threaded_blend_queued = false;
+		if (!tree->active || !tree->is_inside_tree() || !tree->_process_graph_prepare()) {
+			continue;
+		}
+
+		nodes.clear();
+		if (!tree->_is_threaded_blend_safe(nodes)) {
+			sync_trees.push_back(id);
+			continue;
+		}
+
+		uint32_t index = trees.size();
+		trees.push_back(tree);
+		tree_sets.push_back(index);
+		for (AnimationNode *node : nodes) {
+			uint32_t *other = node_trees.getptr(node);
+			if (!other) {
+				node_trees.insert(node, index);
+				continue;
+			}
+			uint32_t a = *other;
+			while (tree_sets[a] != a) {
+				a = tree_sets[a];
+			}
+			uint32_t b = index;
+			while (tree_sets[b] != b) {
+				b = tree_sets[b];
+			}
+			tree_sets[MAX(a, b)] = MIN(a, b);
+		}
+	}
+
+	LocalVector<LocalVector<AnimationTree *>> groups;
+	HashMap<uint32_t, uint32_t> set_groups;
+	for (uint32_t i = 0; i < trees.size(); i++) {
+		uint32_t set = i;
+		while (tree_sets[set] != set) {
+			set = tree_sets[set];
+		}
+		uint32_t *group = set_groups.getptr(set);
+		if (group) {
+			groups[*group].push_back(trees[i]);
+		} else {
+			set_groups.insert(set, groups.size());
+			groups.resize(groups.size() + 1);
+			groups[groups.size() - 1].push_back(trees[i]);
+		}
+	}
+
+	if (groups.size() == 1) {
+		for (AnimationTree *tree : trees) {
+			tree->threaded_blend_valid = tree->_process_graph_blend(tree->threaded_blend_delta);
+		}
+	} else if (groups.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&AnimationTree::_threaded_blend_group, groups.ptr(), groups.size(), -1, true, SNAME("AnimationTree blending"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
+	// Setting the tracks may run scripts, which could free other trees.
+	LocalVector<ObjectID> blended_trees;
+	for (AnimationTree *tree : trees) {
+		if (tree->threaded_blend_valid) {
+			blended_trees.push_back(tree->get_instance_id());
+		}
+	}
+	for (const ObjectID &id : blended_trees) {
+		AnimationTree *tree = Object::cast_to<AnimationTree>(ObjectDB::get_instance(id));
+		if (tree && tree->threaded_blend_valid) {
+			tree->threaded_blend_valid = false;
+			tree->_process_graph_apply();
+		}
+	}
+
+	for (const ObjectID &id : sync_trees) {
+		AnimationTree *tree = Object::cast_to<AnimationTree>(ObjectDB::get_instance(id));
+		if (tree && tree->active && tree->is_inside_tree()) {
+			tree->_process_graph(tree->threaded_blend_delta);
+		}
+	}
+}
+
 void AnimationTree::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_ENTER_TREE: {
@@ -1905,14 +2261,24 @@ void AnimationTree::_notification(int p_what) {
 		} break;
 
 		case NOTIFICATION_INTERNAL_PROCESS: {
-			if (active && process_callback == ANIMATION_PROCESS_IDLE) {
-				_process_graph(get_process_delta_time());
+			double delta = 0.0;
+			if (active && process_callback == ANIMATION_PROCESS_IDLE && _lod_update(get_process_delta_time(), delta)) {
+				if (use_threaded_blending && Thread::is_main_thread() && !is_group_processing()) {
+					_queue_threaded_blend(delta);
+				} else {
+					_process_graph(delta);
+				}
 			}
 		} break;
 
 		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
-			if (active && process_callback == ANIMATION_PROCESS_PHYSICS) {
-				_process_graph(get_physics_process_delta_time());
+			double delta = 0.0;
+			if (active && process_callback == ANIMATION_PROCESS_PHYSICS && _lod_update(get_physics_process_delta_time(), delta)) {
+				if (use_threaded_blending && Thread::is_main_thread() && !is_group_processing()) {
+					_queue_threaded_blend(delta);
+				} else {
+					_process_graph(delta);
+				}
 			}
 		} break;
 	}
@@ -2221,6 +2587,21 @@ void AnimationTree::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_process_callback", "mode"), &AnimationTree::set_process_callback);
 	ClassDB::bind_method(D_METHOD("get_process_callback"), &AnimationTree::get_process_callback);
 
+	ClassDB::bind_method(D_METHOD("set_use_threaded_blending", "enable"), &AnimationTree::set_use_threaded_blending);
+	ClassDB::bind_method(D_METHOD("is_using_threaded_blending"), &AnimationTree::is_using_threaded_blending);
+
+	ClassDB::bind_method(D_METHOD("set_lod_frame_interval", "interval"), &AnimationTree::set_lod_frame_interval);
+	ClassDB::bind_method(D_METHOD("get_lod_frame_interval"), &AnimationTree::get_lod_frame_interval);
+
+	ClassDB::bind_method(D_METHOD("set_lod_offscreen_frame_interval", "interval"), &AnimationTree::set_lod_offscreen_frame_interval);
+	ClassDB::bind_method(D_METHOD("get_lod_offscreen_frame_interval"), &AnimationTree::get_lod_offscreen_frame_interval);
+
+	ClassDB::bind_method(D_METHOD("set_lod_visibility_notifier", "notifier"), &AnimationTree::set_lod_visibility_notifier);
+	ClassDB::bind_method(D_METHOD("get_lod_visibility_notifier"), &AnimationTree::get_lod_visibility_notifier);
+
+	ClassDB::bind_method(D_METHOD("set_lod_interpolate", "interpolate"), &AnimationTree::set_lod_interpolate);
+	ClassDB::bind_method(D_METHOD("is_lod_interpolating"), &AnimationTree::is_lod_interpolating);
+
 	ClassDB::bind_method(D_METHOD("set_animation_player", "root"), &AnimationTree::set_animation_player);
 	ClassDB::bind_method(D_METHOD("get_animation_player"), &AnimationTree::get_animation_player);
 
@@ -2252,10 +2633,16 @@ void AnimationTree::_bind_methods() {
 
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "active"), "set_active", "is_active");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_callback", PROPERTY_HINT_ENUM, "Physics,Idle,Manual"), "set_process_callback", "get_process_callback");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_threaded_blending"), "set_use_threaded_blending", "is_using_threaded_blending");
 	ADD_GROUP("Audio", "audio_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "audio_max_polyphony", PROPERTY_HINT_RANGE, "1,127,1"), "set_audio_max_polyphony", "get_audio_max_polyphony");
 	ADD_GROUP("Root Motion", "root_motion_");
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_motion_track"), "set_root_motion_track", "get_root_motion_track");
+	ADD_GROUP("LOD", "lod_");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "lod_frame_interval", PROPERTY_HINT_RANGE, "1,60,1,or_greater"), "set_lod_frame_interval", "get_lod_frame_interval");
+	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "lod_visibility_notifier", PROPERTY_HINT_NODE_PATH_VALID_TYPES, "VisibleOnScreenNotifier3D,VisibleOnScreenNotifier2D"), "set_lod_visibility_notifier", "get_lod_visibility_notifier");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "lod_offscreen_frame_interval", PROPERTY_HINT_RANGE, "1,60,1,or_greater"), "set_lod_offscreen_frame_interval", "get_lod_offscreen_frame_interval");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "lod_interpolate"), "set_lod_interpolate", "is_lod_interpolating");
 
 	BIND_ENUM_CONSTANT(ANIMATION_PROCESS_PHYSICS);
 	BIND_ENUM_CONSTANT(ANIMATION_PROCESS_IDLE);
@@ -237,6 +237,12 @@ private:
 		Quaternion rot;
 		Vector3 scale;
 
+		// Last applied values, when interpolating between LOD updates.
+		bool lod_valid = false;
+		Vector3 lod_loc;
+		Quaternion lod_rot;
+		Vector3 lod_scale;
+
 		TrackCacheTransform() {
 			type = Animation::TYPE_POSITION_3D;
 		}
@@ -253,6 +259,8 @@ private:
 		float init_value = 0;
 		float value = 0;
 		int shape_index = -1;
+		bool lod_valid = false;
+		float lod_value = 0;
 		TrackCacheBlendShape() { type = Animation::TYPE_BLEND_SHAPE; }
 	};
 
@@ -338,6 +346,46 @@ private:
 	void _clear_audio_streams();
 	bool _update_caches(AnimationPlayer *player);
 	void _process_graph(double p_delta);
+	bool _process_graph_prepare();
+	bool _process_graph_blend(double p_delta);
+	void _process_graph_apply();
+
+	// Threaded blending: the trees processed in a frame are queued, blended together on worker threads
+	// once the frame's nodes have been processed, then applied to their nodes on the main thread.
+	struct ThreadedValueSet {
+		TrackCacheValue *track = nullptr;
+		Variant value;
+	};
+
+	bool use_threaded_blending = false;
+	bool blending_on_thread = false;
+	bool threaded_blend_queued = false;
+	bool threaded_blend_valid = false;
+	double threaded_blend_delta = 0.0;
+	LocalVector<ThreadedValueSet> threaded_value_sets;
+
+	static LocalVector<ObjectID> threaded_blend_queue;
+	static bool threaded_blend_flush_queued;
+
+	void _queue_threaded_blend(double p_delta);
+	bool _is_threaded_blend_safe(LocalVector<AnimationNode *> &r_nodes);
+	static void _threaded_blend_group(void *p_userdata, uint32_t p_index);
+	static void _flush_threaded_blends();
+
+	// LOD, updates every few frames with the accumulated delta.
+	int lod_frame_interval = 1;
+	int lod_offscreen_frame_interval = 4;
+	NodePath lod_visibility_notifier;
+	bool lod_interpolate = false;
+	int lod_frames = -1; // Frames since the last update, negative before the first one.
+	int lod_current_interval = 1;
+	double lod_delta = 0.0;
+
+	bool _lod_update(double p_delta, double &r_delta);
+	void _lod_interpolate_tracks(int p_remaining_frames);
+#ifndef _3D_DISABLED
+	void _set_transform_track(TrackCacheTransform *p_track, const Vector3 &p_loc, const Quaternion &p_rot, const Vector3 &p_scale);
+#endif // _3D_DISABLED
 
 	uint64_t setup_pass = 1;
 	uint64_t process_pass = 1;
@@ -397,6 +445,21 @@ public:
 	void set_process_callback(AnimationProcessCallback p_mode);
 	AnimationProcessCallback get_process_callback() const;
 
+	void set_use_threaded_blending(bool p_enable);
+	bool is_using_threaded_blending() const;
+
+	void set_lod_frame_interval(int p_interval);
+	int get_lod_frame_interval() const;
+
+	void set_lod_offscreen_frame_interval(int p_interval);
+	int get_lod_offscreen_frame_interval() const;
+
+	void set_lod_visibility_notifier(const NodePath &p_notifier);
+	NodePath get_lod_visibility_notifier() const;
+
+	void set_lod_interpolate(bool p_interpolate);
+	bool is_lod_interpolating() const;
+
 	void set_animation_player(const NodePath &p_player);
 	NodePath get_animation_player() const;
 
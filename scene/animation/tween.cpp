@@ -185,7 +185,7 @@ bool Tween::is_valid() {
 void Tween::clear() {
 	valid = false;
 
-	for (List<Ref<Tweener>> &step : tweeners) {
+	for (LocalVector<Ref<Tweener>> &step : tweeners) {
 		for (Ref<Tweener> &tweener : step) {
 			tweener->clear_tween();
 		}
@@ -581,7 +581,9 @@ bool PropertyTweener::step(double &r_delta) {
 
 	double time = MIN(elapsed_time - delay, duration);
 	if (time < duration) {
-		target_instance->set_indexed(property, tween->interpolate_variant(initial_val, delta_val, time, duration, trans_type, ease_type));
+		if (!_set_interpolated(target_instance, time)) {
+			target_instance->set_indexed(property, tween->interpolate_variant(initial_val, delta_val, time, duration, trans_type, ease_type));
+		}
 		r_delta = 0;
 		return true;
 	} else {
@@ -593,6 +595,73 @@ bool PropertyTweener::step(double &r_delta) {
 	}
 }
 
+bool PropertyTweener::_set_interpolated(Object *p_target, double p_time) {
+	Variant::Type type = initial_val.get_type();
+	if ((type != Variant::FLOAT && type != Variant::VECTOR2 && type != Variant::COLOR) || delta_val.get_type() != type) {
+		return false;
+	}
+	if (p_target->get_script_instance()) {
+		return false; // Scripts can intercept set() before the native setter.
+	}
+
+	const void *lookup_id = ClassDB::get_lookup_tables_id();
+	if (!lookup_id) {
+		return false;
+	}
+	if (setter_lookup_id != lookup_id) {
+		setter_lookup_id = lookup_id;
+		setter = nullptr;
+
+		// Extension classes can intercept set() too, so they keep going through it.
+		StringName class_name = p_target->get_class_name();
+		ClassDB::APIType api = ClassDB::get_api_type(class_name);
+		bool is_extension = api == ClassDB::API_EXTENSION || api == ClassDB::API_EDITOR_EXTENSION;
+		const ClassDB::PropertySetGet *psg = (property.size() == 1 && !is_extension) ? ClassDB::get_property_setget(class_name, property[0]) : nullptr;
+		if (psg && psg->_setptr && !psg->_setptr->is_vararg() && psg->_setptr->get_argument_type(psg->index >= 0 ? 1 : 0) == type) {
+			setter = psg->_setptr;
+			setter_index = psg->index;
+		}
+	}
+	if (!setter) {
+		return false;
+	}
+
+	real_t weight = Tween::run_equation(trans_type, ease_type, p_time, 0.0, 1.0, duration);
+
+	// Encoded as ptrcall expects them, floats are passed as double.
+	double float_value = 0.0;
+	Vector2 vector2_value;
+	Color color_value;
+	const void *value_ptr = nullptr;
+	switch (type) {
+		case Variant::FLOAT: {
+			float_value = double(initial_val) + double(delta_val) * weight;
+			value_ptr = &float_value;
+		} break;
+		case Variant::VECTOR2: {
+			vector2_value = Vector2(initial_val) + Vector2(delta_val) * weight;
+			value_ptr = &vector2_value;
+		} break;
+		case Variant::COLOR: {
+			color_value = Color(initial_val) + Color(delta_val) * weight;
+			value_ptr = &color_value;
+		} break;
+		default: {
+			return false;
+		}
+	}
+
+	if (setter_index >= 0) {
+		int64_t index = setter_index;
+		const void *args[2] = { &index, value_ptr };
+		setter->ptrcall(p_target, args, nullptr);
+	} else {
+		const void *args[1] = { value_ptr };
+		setter->ptrcall(p_target, args, nullptr);
+	}
+	return true;
+}
+
 void PropertyTweener::set_tween(const Ref<Tween> &p_tween) {
 	tween = p_tween;
 	if (trans_type == Tween::TRANS_MAX) {
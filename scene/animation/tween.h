@@ -106,7 +106,7 @@ private:
 	EaseType default_ease = EaseType::EASE_IN_OUT;
 	ObjectID bound_node;
 
-	Vector<List<Ref<Tweener>>> tweeners;
+	Vector<LocalVector<Ref<Tweener>>> tweeners;
 	double total_time = 0;
 	int current_step = -1;
 	int loops = 1;
@@ -219,6 +219,13 @@ private:
 
 	Ref<RefCounted> ref_copy; // Makes sure that RefCounted objects are not freed too early.
 
+	// Native setter of the property, resolved once for the float, Vector2 and Color fast path.
+	const void *setter_lookup_id = nullptr;
+	MethodBind *setter = nullptr;
+	int setter_index = -1;
+
+	bool _set_interpolated(Object *p_target, double p_time);
+
 	double duration = 0;
 	Tween::TransitionType trans_type = Tween::TRANS_MAX; // This is set inside set_tween();
 	Tween::EaseType ease_type = Tween::EASE_MAX;
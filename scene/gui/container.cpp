@@ -86,6 +86,14 @@ void Container::_sort_children() {
 		return;
 	}
 
+	// A parent container waiting to sort may resize this one, which would need sorting again.
+	// Sort after it instead, so nested containers are laid out once, from the top down.
+	Container *parent_container = Object::cast_to<Container>(get_parent());
+	if (parent_container && parent_container->pending_sort && !is_set_as_top_level()) {
+		MessageQueue::get_singleton()->push_callable(callable_mp(this, &Container::_sort_children));
+		return;
+	}
+
 	notification(NOTIFICATION_PRE_SORT_CHILDREN);
 	emit_signal(SceneStringNames::get_singleton()->pre_sort_children);
 
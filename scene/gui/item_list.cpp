@@ -52,6 +52,7 @@ void ItemList::_shape_text(int p_idx) {
 	}
 	item.text_buf->set_text_overrun_behavior(text_overrun_behavior);
 	item.text_buf->set_max_lines_visible(max_text_lines);
+	item.text_measured = false;
 }
 
 int ItemList::add_item(const String &p_item, const Ref<Texture2D> &p_texture, bool p_selectable) {
@@ -300,6 +301,9 @@ Rect2 ItemList::get_item_rect(int p_idx, bool p_expand) const {
 
 	Rect2 ret = items[p_idx].rect_cache;
 	ret.position += theme_cache.panel_style->get_offset();
+	if (!items[p_idx].text_measured && !items[p_idx].text.is_empty()) {
+		ret.size.width += items[p_idx].text_buf->get_size().width;
+	}
 
 	if (p_expand && p_idx % current_columns == current_columns - 1) {
 		ret.size.width = get_size().width - ret.position.x;
@@ -1223,6 +1227,16 @@ void ItemList::_notification(int p_what) {
 					int max_len = -1;
 
 					Vector2 size2 = items[i].text_buf->get_size();
+					if (!items[i].text_measured) {
+						// Laid out with an estimated size, relayout if the text turned out taller.
+						items.write[i].text_measured = true;
+						items.write[i].rect_cache.size.x += size2.x;
+						items.write[i].min_rect_cache.size.x += size2.x;
+						if (size2.y + theme_cache.v_separation > items[i].rect_cache.size.y && !shape_changed) {
+							shape_changed = true;
+							callable_mp((CanvasItem *)this, &CanvasItem::queue_redraw).call_deferred();
+						}
+					}
 					if (fixed_column_width) {
 						max_len = fixed_column_width;
 					} else if (same_column_width) {
@@ -1323,6 +1337,11 @@ void ItemList::_check_shape_changed() {
 	Size2 size = get_size();
 	float max_column_width = 0.0;
 
+	// Rows of a single column list with icons on the left only depend on the text height, so text that is not
+	// shaped yet is laid out one line high and only measured once it is drawn.
+	bool uniform_rows = max_columns == 1 && icon_mode == ICON_MODE_LEFT && !fixed_column_width && !same_column_width;
+	int line_height = theme_cache.font->get_height(theme_cache.font_size);
+
 	//1- compute item minimum sizes
 	for (int i = 0; i < items.size(); i++) {
 		Size2 minsize;
@@ -1350,7 +1369,14 @@ void ItemList::_check_shape_changed() {
 				max_width = items[i].rect_cache.size.x;
 			}
 			items.write[i].text_buf->set_width(max_width);
-			Size2 s = items[i].text_buf->get_size();
+
+			Size2 s;
+			if (uniform_rows && !items[i].text_measured) {
+				s = Size2(0, line_height);
+			} else {
+				s = items[i].text_buf->get_size();
+				items.write[i].text_measured = true;
+			}
 
 			if (icon_mode == ICON_MODE_TOP) {
 				minsize.x = MAX(minsize.x, s.width);
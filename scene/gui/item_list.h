@@ -71,6 +71,7 @@ private:
 		Color custom_bg = Color(0.0, 0.0, 0.0, 0.0);
 
 		int column = 0;
+		bool text_measured = false; // Text has been shaped and its size taken into rect_cache.
 		Rect2 rect_cache;
 		Rect2 min_rect_cache;
 
@@ -451,6 +451,15 @@ float RichTextLabel::_shape_line(ItemFrame *p_frame, int p_line, const Ref<Font>
 	ERR_FAIL_NULL_V(p_frame, p_h);
 	ERR_FAIL_COND_V(p_line < 0 || p_line >= (int)p_frame->lines.size(), p_h);
 
+	_fill_line(p_frame, p_line, p_base_font, p_base_font_size, p_width, r_char_offset);
+
+	Line &l = p_frame->lines[p_line];
+	MutexLock lock(l.text_buf->get_mutex());
+	l.offset.y = p_h;
+	return _calculate_line_vertical_offset(l); // Shapes the paragraph.
+}
+
+void RichTextLabel::_fill_line(ItemFrame *p_frame, int p_line, const Ref<Font> &p_base_font, int p_base_font_size, int p_width, int *r_char_offset) {
 	Line &l = p_frame->lines[p_line];
 	MutexLock lock(l.text_buf->get_mutex());
 
@@ -742,9 +751,15 @@ float RichTextLabel::_shape_line(ItemFrame *p_frame, int p_line, const Ref<Font>
 	l.text_buf->set_bidi_override(structured_text_parser(_find_stt(l.from), st_args, txt));
 
 	*r_char_offset = l.char_offset + l.char_count;
+}
 
-	l.offset.y = p_h;
-	return _calculate_line_vertical_offset(l);
+void RichTextLabel::_shape_line_threaded(uint32_t p_index, int p_from) {
+	if (stop_thread.load()) {
+		return;
+	}
+	Line &l = main->lines[p_from + p_index];
+	MutexLock lock(l.text_buf->get_mutex());
+	_ALLOW_DISCARD_ l.text_buf->get_size(); // Shapes the paragraph and breaks it into lines.
 }
 
 int RichTextLabel::_draw_line(ItemFrame *p_frame, int p_line, const Vector2 &p_ofs, int p_width, const Color &p_base_color, int p_outline_size, const Color &p_outline_color, const Color &p_font_shadow_color, int p_shadow_outline_size, const Point2 &p_shadow_ofs, int &r_processed_glyphs) {
@@ -2926,8 +2941,36 @@ void RichTextLabel::_process_line_caches() {
 	}
 
 	total_height = (fi == 0) ? 0 : _calculate_line_vertical_offset(main->lines[fi - 1]);
+
+	// Fill the paragraphs here, where items and fonts are read, and shape them on worker threads.
+	// Offsets depend on the height of the previous paragraphs, so they are still set in order below.
+	bool shaped = false;
+	if ((int)main->lines.size() - fi >= PARALLEL_SHAPE_MIN_LINES && TS->has_feature(TextServer::FEATURE_THREADED_SHAPING)) {
+		int char_offset = total_chars;
+		for (int i = fi; i < (int)main->lines.size(); i++) {
+			_fill_line(main, i, theme_cache.normal_font, theme_cache.normal_font_size, text_rect.get_size().width - scroll_w, &char_offset);
+			if (stop_thread.load()) {
+				return;
+			}
+		}
+
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RichTextLabel::_shape_line_threaded, fi, (int)main->lines.size() - fi, -1, true, SNAME("RichTextLabelShapeLines"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		if (stop_thread.load()) {
+			return;
+		}
+		shaped = true;
+	}
+
 	for (int i = fi; i < (int)main->lines.size(); i++) {
-		total_height = _shape_line(main, i, theme_cache.normal_font, theme_cache.normal_font_size, text_rect.get_size().width - scroll_w, total_height, &total_chars);
+		if (shaped) {
+			Line &l = main->lines[i];
+			MutexLock lock(l.text_buf->get_mutex());
+			l.offset.y = total_height;
+			total_height = _calculate_line_vertical_offset(l);
+		} else {
+			total_height = _shape_line(main, i, theme_cache.normal_font, theme_cache.normal_font_size, text_rect.get_size().width - scroll_w, total_height, &total_chars);
+		}
 		total_height = _update_scroll_exceeds(total_height, ctrl_height, text_rect.get_size().width, i, old_scroll, text_rect.size.height);
 
 		main->first_invalid_line.store(i);
@@ -3010,6 +3053,7 @@ void RichTextLabel::add_text(const String &p_text) {
 
 		pos = end + 1;
 	}
+	_trim_paragraphs();
 	queue_redraw();
 }
 
@@ -3077,6 +3121,81 @@ void RichTextLabel::_remove_item(Item *p_item, const int p_line, const int p_sub
 	memdelete(p_item);
 }
 
+void RichTextLabel::_shift_item_offsets(Item *p_item, int p_char_delta, int p_line_delta) {
+	for (Item *E : p_item->subitems) {
+		E->char_ofs -= p_char_delta;
+		E->line -= p_line_delta;
+		if (E->type == ITEM_FRAME) {
+			// Lines of a cell are numbered within the cell, only the character offsets are global.
+			ItemFrame *frame = static_cast<ItemFrame *>(E);
+			for (uint32_t i = 0; i < frame->lines.size(); i++) {
+				frame->lines[i].char_offset -= p_char_delta;
+			}
+			_shift_item_offsets(E, p_char_delta, 0);
+		} else {
+			_shift_item_offsets(E, p_char_delta, p_line_delta);
+		}
+	}
+}
+
+void RichTextLabel::_trim_paragraphs() {
+	if (max_paragraphs <= 0 || current != main || current_frame != main) {
+		return;
+	}
+
+	while ((int)main->lines.size() > max_paragraphs) {
+		// Only drop the first paragraph if no tag spans past it, the others keep their shaping.
+		Item *to = main->lines[1].from;
+		if (!to || to->parent != main) {
+			break;
+		}
+
+		int valid_lines = MIN(main->first_invalid_line.load(), main->first_resized_line.load());
+		float delta_height = (valid_lines > 1) ? main->lines[1].offset.y : 0.0;
+		int line_char_delta = main->lines[1].char_offset;
+		int item_char_delta = to->char_ofs;
+
+		while (main->subitems.front()->get() != to) {
+			memdelete(main->subitems.front()->get());
+			main->subitems.pop_front();
+		}
+		main->lines.remove_at(0);
+		main->lines[0].from = main;
+
+		_shift_item_offsets(main, item_char_delta, 1);
+		current_char_ofs -= item_char_delta;
+		for (uint32_t i = 0; i < main->lines.size(); i++) {
+			main->lines[i].offset.y -= delta_height;
+			main->lines[i].char_offset -= line_char_delta;
+		}
+		main->lines[0].char_offset = 0;
+
+		main->first_invalid_line.store(MAX(main->first_invalid_line.load() - 1, 0));
+		main->first_invalid_font_line.store(MAX(main->first_invalid_font_line.load() - 1, 0));
+		// Resize the last line at least, to update the scroll bar.
+		main->first_resized_line.store(MAX(MIN(main->first_resized_line.load() - 1, (int)main->lines.size() - 1), 0));
+
+		if (!(scroll_follow && scroll_following)) {
+			vscroll->set_value(vscroll->get_value() - delta_height);
+		}
+
+		// Pointers and line numbers into the removed paragraph are no longer valid.
+		if (selection.active && (selection.from_frame != main || selection.to_frame != main || selection.from_line == 0)) {
+			selection.active = false;
+		} else if (selection.active) {
+			selection.from_line--;
+			selection.to_line--;
+		}
+		if (selection.click_frame != main || selection.click_line == 0) {
+			selection.click_frame = nullptr;
+			selection.click_item = nullptr;
+		} else {
+			selection.click_line--;
+		}
+		meta_hovering = nullptr;
+	}
+}
+
 void RichTextLabel::add_image(const Ref<Texture2D> &p_image, const int p_width, const int p_height, const Color &p_color, InlineAlignment p_alignment, const Rect2 &p_region) {
 	_stop_thread();
 	MutexLock data_lock(data_mutex);
@@ -3152,6 +3271,7 @@ void RichTextLabel::add_newline() {
 	_add_item(item, false);
 	current_frame->lines.resize(current_frame->lines.size() + 1);
 	_invalidate_current_line(current_frame);
+	_trim_paragraphs();
 	queue_redraw();
 }
 
@@ -3730,6 +3850,23 @@ int RichTextLabel::get_tab_size() const {
 	return tab_size;
 }
 
+void RichTextLabel::set_max_paragraphs(int p_max_paragraphs) {
+	if (max_paragraphs == p_max_paragraphs) {
+		return;
+	}
+
+	_stop_thread();
+	MutexLock data_lock(data_mutex);
+
+	max_paragraphs = p_max_paragraphs;
+	_trim_paragraphs();
+	queue_redraw();
+}
+
+int RichTextLabel::get_max_paragraphs() const {
+	return max_paragraphs;
+}
+
 void RichTextLabel::set_fit_content(bool p_enabled) {
 	if (p_enabled == fit_content) {
 		return;
@@ -4810,6 +4947,7 @@ void RichTextLabel::append_text(const String &p_bbcode) {
 			}
 		}
 	}
+	_trim_paragraphs();
 
 	Vector<ItemFX *> fx_items;
 	for (Item *E : main->subitems) {
@@ -5652,6 +5790,9 @@ void RichTextLabel::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_tab_size", "spaces"), &RichTextLabel::set_tab_size);
 	ClassDB::bind_method(D_METHOD("get_tab_size"), &RichTextLabel::get_tab_size);
 
+	ClassDB::bind_method(D_METHOD("set_max_paragraphs", "max_paragraphs"), &RichTextLabel::set_max_paragraphs);
+	ClassDB::bind_method(D_METHOD("get_max_paragraphs"), &RichTextLabel::get_max_paragraphs);
+
 	ClassDB::bind_method(D_METHOD("set_fit_content", "enabled"), &RichTextLabel::set_fit_content);
 	ClassDB::bind_method(D_METHOD("is_fit_content_enabled"), &RichTextLabel::is_fit_content_enabled);
 
@@ -5744,6 +5885,7 @@ void RichTextLabel::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "scroll_following"), "set_scroll_follow", "is_scroll_following");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "autowrap_mode", PROPERTY_HINT_ENUM, "Off,Arbitrary,Word,Word (Smart)"), "set_autowrap_mode", "get_autowrap_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "tab_size", PROPERTY_HINT_RANGE, "0,24,1"), "set_tab_size", "get_tab_size");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_paragraphs", PROPERTY_HINT_RANGE, "0,100000,1,or_greater"), "set_max_paragraphs", "get_max_paragraphs");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "context_menu_enabled"), "set_context_menu_enabled", "is_context_menu_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "shortcut_keys_enabled"), "set_shortcut_keys_enabled", "is_shortcut_keys_enabled");
 
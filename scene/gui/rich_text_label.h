@@ -396,6 +396,7 @@ private:
 	ItemFrame *current_frame = nullptr;
 
 	WorkerThreadPool::TaskID task = WorkerThreadPool::INVALID_TASK_ID;
+	const int PARALLEL_SHAPE_MIN_LINES = 16; // Fewer lines are shaped on the calling thread.
 	Mutex data_mutex;
 	bool threaded = false;
 	std::atomic<bool> stop_thread;
@@ -423,6 +424,7 @@ private:
 	int visible_line_count = 0;
 
 	int tab_size = 4;
+	int max_paragraphs = 0;
 	bool underline_meta = true;
 	bool underline_hint = true;
 	bool use_selected_font_color = false;
@@ -446,6 +448,8 @@ private:
 
 	void _add_item(Item *p_item, bool p_enter = false, bool p_ensure_newline = false);
 	void _remove_item(Item *p_item, const int p_line, const int p_subitem_line);
+	void _shift_item_offsets(Item *p_item, int p_char_delta, int p_line_delta);
+	void _trim_paragraphs();
 
 	String language;
 	TextDirection text_direction = TEXT_DIRECTION_AUTO;
@@ -498,6 +502,8 @@ private:
 	bool _search_table(ItemTable *p_table, List<Item *>::Element *p_from, const String &p_string, bool p_reverse_search);
 
 	float _shape_line(ItemFrame *p_frame, int p_line, const Ref<Font> &p_base_font, int p_base_font_size, int p_width, float p_h, int *r_char_offset);
+	void _fill_line(ItemFrame *p_frame, int p_line, const Ref<Font> &p_base_font, int p_base_font_size, int p_width, int *r_char_offset);
+	void _shape_line_threaded(uint32_t p_index, int p_from);
 	float _resize_line(ItemFrame *p_frame, int p_line, const Ref<Font> &p_base_font, int p_base_font_size, int p_width, float p_h);
 
 	void _update_line_font(ItemFrame *p_frame, int p_line, const Ref<Font> &p_base_font, int p_base_font_size);
@@ -672,6 +678,9 @@ public:
 	void set_tab_size(int p_spaces);
 	int get_tab_size() const;
 
+	void set_max_paragraphs(int p_max_paragraphs);
+	int get_max_paragraphs() const;
+
 	void set_context_menu_enabled(bool p_enabled);
 	bool is_context_menu_enabled() const;
 
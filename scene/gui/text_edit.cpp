@@ -93,7 +93,8 @@ void TextEdit::Text::set_draw_control_chars(bool p_enabled) {
 }
 
 int TextEdit::Text::get_line_width(int p_line, int p_wrap_index) const {
-	ERR_FAIL_INDEX_V(p_line, text.size(), 0);
+	ERR_FAIL_INDEX_V(p_line, (int)text.size(), 0);
+	_ensure_line_size(p_line);
 	if (p_wrap_index != -1) {
 		return text[p_line].data_buf->get_line_width(p_wrap_index);
 	}
@@ -121,14 +122,16 @@ BitField<TextServer::LineBreakFlag> TextEdit::Text::get_brk_flags() const {
 }
 
 int TextEdit::Text::get_line_wrap_amount(int p_line) const {
-	ERR_FAIL_INDEX_V(p_line, text.size(), 0);
+	ERR_FAIL_INDEX_V(p_line, (int)text.size(), 0);
+	_ensure_line_size(p_line);
 
 	return text[p_line].data_buf->get_line_count() - 1;
 }
 
 Vector<Vector2i> TextEdit::Text::get_line_wrap_ranges(int p_line) const {
 	Vector<Vector2i> ret;
-	ERR_FAIL_INDEX_V(p_line, text.size(), ret);
+	ERR_FAIL_INDEX_V(p_line, (int)text.size(), ret);
+	_ensure_line_size(p_line);
 
 	for (int i = 0; i < text[p_line].data_buf->get_line_count(); i++) {
 		ret.push_back(text[p_line].data_buf->get_line_range(i));
@@ -137,7 +140,8 @@ Vector<Vector2i> TextEdit::Text::get_line_wrap_ranges(int p_line) const {
 }
 
 const Ref<TextParagraph> TextEdit::Text::get_line_data(int p_line) const {
-	ERR_FAIL_INDEX_V(p_line, text.size(), Ref<TextParagraph>());
+	ERR_FAIL_INDEX_V(p_line, (int)text.size(), Ref<TextParagraph>());
+	_ensure_line_size(p_line);
 	return text[p_line].data_buf;
 }
 
@@ -175,39 +179,70 @@ void TextEdit::Text::_calculate_max_line_width() {
 	max_width = line_width;
 }
 
+void TextEdit::Text::_set_line_size(int p_line, int p_height, int p_width) {
+	// If this line has shrunk, this may no longer the the tallest line.
+	const int old_height = text[p_line].height;
+	text[p_line].height = p_height;
+	if (old_height == line_height && p_height < line_height) {
+		_calculate_line_height();
+	} else {
+		line_height = MAX(p_height, line_height);
+	}
+
+	// If this line has shrunk, this may no longer the the longest line.
+	const int old_width = text[p_line].width;
+	text[p_line].width = p_width;
+	if (old_width == max_width && p_width < max_width) {
+		_calculate_max_line_width();
+	} else if (!is_hidden(p_line)) {
+		max_width = MAX(p_width, max_width);
+	}
+}
+
+void TextEdit::Text::_update_line_size(int p_line) {
+	Line &l = text[p_line];
+	l.size_dirty = false;
+
+	int height = font_height;
+	for (int i = 0; i < l.data_buf->get_line_count(); i++) {
+		height = MAX(height, l.data_buf->get_line_size(i).y);
+	}
+	_set_line_size(p_line, height, l.data_buf->get_size().x);
+}
+
 void TextEdit::Text::invalidate_cache(int p_line, int p_column, bool p_text_changed, const String &p_ime_text, const Array &p_bidi_override) {
-	ERR_FAIL_INDEX(p_line, text.size());
+	ERR_FAIL_INDEX(p_line, (int)text.size());
 
 	if (font.is_null()) {
 		return; // Not in tree?
 	}
 
 	if (p_text_changed) {
-		text.write[p_line].data_buf->clear();
+		text[p_line].data_buf->clear();
 	}
 
-	text.write[p_line].data_buf->set_width(width);
-	text.write[p_line].data_buf->set_direction((TextServer::Direction)direction);
-	text.write[p_line].data_buf->set_break_flags(brk_flags);
-	text.write[p_line].data_buf->set_preserve_control(draw_control_chars);
+	text[p_line].data_buf->set_width(width);
+	text[p_line].data_buf->set_direction((TextServer::Direction)direction);
+	text[p_line].data_buf->set_break_flags(brk_flags);
+	text[p_line].data_buf->set_preserve_control(draw_control_chars);
 	if (p_ime_text.length() > 0) {
 		if (p_text_changed) {
-			text.write[p_line].data_buf->add_string(p_ime_text, font, font_size, language);
+			text[p_line].data_buf->add_string(p_ime_text, font, font_size, language);
 		}
 		if (!p_bidi_override.is_empty()) {
-			TS->shaped_text_set_bidi_override(text.write[p_line].data_buf->get_rid(), p_bidi_override);
+			TS->shaped_text_set_bidi_override(text[p_line].data_buf->get_rid(), p_bidi_override);
 		}
 	} else {
 		if (p_text_changed) {
-			text.write[p_line].data_buf->add_string(text[p_line].data, font, font_size, language);
+			text[p_line].data_buf->add_string(text[p_line].data, font, font_size, language);
 		}
 		if (!text[p_line].bidi_override.is_empty()) {
-			TS->shaped_text_set_bidi_override(text.write[p_line].data_buf->get_rid(), text[p_line].bidi_override);
+			TS->shaped_text_set_bidi_override(text[p_line].data_buf->get_rid(), text[p_line].bidi_override);
 		}
 	}
 
 	if (!p_text_changed) {
-		RID r = text.write[p_line].data_buf->get_rid();
+		RID r = text[p_line].data_buf->get_rid();
 		int spans = TS->shaped_get_span_count(r);
 		for (int i = 0; i < spans; i++) {
 			TS->shaped_set_span_update_font(r, i, font->get_rids(), font_size, font->get_opentype_features());
@@ -221,50 +256,29 @@ void TextEdit::Text::invalidate_cache(int p_line, int p_column, bool p_text_chan
 	if (tab_size > 0) {
 		Vector<float> tabs;
 		tabs.push_back(font->get_char_size(' ', font_size).width * tab_size);
-		text.write[p_line].data_buf->tab_align(tabs);
-	}
-
-	// Update height.
-	const int old_height = text.write[p_line].height;
-	const int wrap_amount = get_line_wrap_amount(p_line);
-	int height = font_height;
-	for (int i = 0; i <= wrap_amount; i++) {
-		height = MAX(height, text[p_line].data_buf->get_line_size(i).y);
+		text[p_line].data_buf->tab_align(tabs);
 	}
-	text.write[p_line].height = height;
 
-	// If this line has shrunk, this may no longer the the tallest line.
-	if (old_height == line_height && height < line_height) {
-		_calculate_line_height();
-	} else {
-		line_height = MAX(height, line_height);
-	}
-
-	// Update width.
-	const int old_width = text.write[p_line].width;
-	int line_width = get_line_width(p_line);
-	text.write[p_line].width = line_width;
-
-	// If this line has shrunk, this may no longer the the longest line.
-	if (old_width == max_width && line_width < max_width) {
-		_calculate_max_line_width();
-	} else if (!is_hidden(p_line)) {
-		max_width = MAX(line_width, max_width);
-	}
+	// Defer shaping until the line is drawn or measured, so only lines that are shown get shaped.
+	// The previous size is kept as an estimate until then.
+	text[p_line].size_dirty = true;
+	_set_line_size(p_line, MAX(text[p_line].height, font_height), text[p_line].width);
 }
 
 void TextEdit::Text::invalidate_all_lines() {
-	for (int i = 0; i < text.size(); i++) {
-		text.write[i].data_buf->set_width(width);
-		text.write[i].data_buf->set_break_flags(brk_flags);
+	for (int i = 0; i < (int)text.size(); i++) {
+		text[i].data_buf->set_width(width);
+		text[i].data_buf->set_break_flags(brk_flags);
 		if (tab_size_dirty) {
 			if (tab_size > 0) {
 				Vector<float> tabs;
 				tabs.push_back(font->get_char_size(' ', font_size).width * tab_size);
-				text.write[i].data_buf->tab_align(tabs);
+				text[i].data_buf->tab_align(tabs);
 			}
 		}
-		text.write[i].width = get_line_width(i);
+		if (!text[i].size_dirty) {
+			text[i].width = get_line_width(i);
+		}
 	}
 	tab_size_dirty = false;
 
@@ -283,7 +297,9 @@ void TextEdit::Text::invalidate_font() {
 		font_height = font->get_height(font_size);
 	}
 
-	for (int i = 0; i < text.size(); i++) {
+	for (int i = 0; i < (int)text.size(); i++) {
+		text[i].height = 0;
+		text[i].width = 0;
 		invalidate_cache(i, -1, false);
 	}
 	is_dirty = false;
@@ -301,7 +317,9 @@ void TextEdit::Text::invalidate_all() {
 		font_height = font->get_height(font_size);
 	}
 
-	for (int i = 0; i < text.size(); i++) {
+	for (int i = 0; i < (int)text.size(); i++) {
+		text[i].height = 0;
+		text[i].width = 0;
 		invalidate_cache(i, -1, true);
 	}
 	is_dirty = false;
@@ -325,10 +343,10 @@ int TextEdit::Text::get_max_width() const {
 }
 
 void TextEdit::Text::set(int p_line, const String &p_text, const Array &p_bidi_override) {
-	ERR_FAIL_INDEX(p_line, text.size());
+	ERR_FAIL_INDEX(p_line, (int)text.size());
 
-	text.write[p_line].data = p_text;
-	text.write[p_line].bidi_override = p_bidi_override;
+	text[p_line].data = p_text;
+	text[p_line].bidi_override = p_bidi_override;
 	invalidate_cache(p_line, -1, true);
 }
 
@@ -336,11 +354,11 @@ void TextEdit::Text::insert(int p_at, const Vector<String> &p_text, const Vector
 	int new_line_count = p_text.size() - 1;
 	if (new_line_count > 0) {
 		text.resize(text.size() + new_line_count);
-		for (int i = (text.size() - 1); i > p_at; i--) {
+		for (int i = ((int)text.size() - 1); i > p_at; i--) {
 			if ((i - new_line_count) <= 0) {
 				break;
 			}
-			text.write[i] = text[i - new_line_count];
+			text[i] = text[i - new_line_count];
 		}
 	}
 
@@ -353,7 +371,7 @@ void TextEdit::Text::insert(int p_at, const Vector<String> &p_text, const Vector
 		line.gutters.resize(gutter_count);
 		line.data = p_text[i];
 		line.bidi_override = p_bidi_override[i];
-		text.write[p_at + i] = line;
+		text[p_at + i] = line;
 		invalidate_cache(p_at + i, -1, true);
 	}
 }
@@ -380,8 +398,8 @@ void TextEdit::Text::remove_range(int p_from_line, int p_to_line) {
 	}
 
 	int diff = (p_to_line - p_from_line);
-	for (int i = p_to_line; i < text.size() - 1; i++) {
-		text.write[(i - diff) + 1] = text[i + 1];
+	for (int i = p_to_line; i < (int)text.size() - 1; i++) {
+		text[(i - diff) + 1] = text[i + 1];
 	}
 	text.resize(text.size() - diff);
 
@@ -395,27 +413,27 @@ void TextEdit::Text::remove_range(int p_from_line, int p_to_line) {
 }
 
 void TextEdit::Text::add_gutter(int p_at) {
-	for (int i = 0; i < text.size(); i++) {
+	for (int i = 0; i < (int)text.size(); i++) {
 		if (p_at < 0 || p_at > gutter_count) {
-			text.write[i].gutters.push_back(Gutter());
+			text[i].gutters.push_back(Gutter());
 		} else {
-			text.write[i].gutters.insert(p_at, Gutter());
+			text[i].gutters.insert(p_at, Gutter());
 		}
 	}
 	gutter_count++;
 }
 
 void TextEdit::Text::remove_gutter(int p_gutter) {
-	for (int i = 0; i < text.size(); i++) {
-		text.write[i].gutters.remove_at(p_gutter);
+	for (int i = 0; i < (int)text.size(); i++) {
+		text[i].gutters.remove_at(p_gutter);
 	}
 	gutter_count--;
 }
 
 void TextEdit::Text::move_gutters(int p_from_line, int p_to_line) {
-	text.write[p_to_line].gutters = text[p_from_line].gutters;
-	text.write[p_from_line].gutters.clear();
-	text.write[p_from_line].gutters.resize(gutter_count);
+	text[p_to_line].gutters = text[p_from_line].gutters;
+	text[p_from_line].gutters.clear();
+	text[p_from_line].gutters.resize(gutter_count);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -520,6 +538,8 @@ void TextEdit::_notification(int p_what) {
 			}
 
 			_update_scrollbars();
+			const int drawn_max_width = text.get_max_width();
+			const int drawn_line_height = text.get_line_height();
 
 			RID ci = get_canvas_item();
 			RenderingServer::get_singleton()->canvas_item_set_clip(get_canvas_item(), true);
@@ -1488,6 +1508,11 @@ void TextEdit::_notification(int p_what) {
 				}
 			}
 
+			// Lines are shaped when first drawn, which can make the content wider or the lines taller.
+			if (text.get_max_width() != drawn_max_width || text.get_line_height() != drawn_line_height) {
+				callable_mp((CanvasItem *)this, &CanvasItem::queue_redraw).call_deferred();
+			}
+
 			if (has_focus()) {
 				if (get_viewport()->get_window_id() != DisplayServer::INVALID_WINDOW_ID && DisplayServer::get_singleton()->has_feature(DisplayServer::FEATURE_IME)) {
 					DisplayServer::get_singleton()->window_set_ime_active(true, get_viewport()->get_window_id());
@@ -1732,10 +1732,17 @@ int Tree::compute_item_height(TreeItem *p_item) const {
 	int height = 0;
 
 	for (int i = 0; i < columns.size(); i++) {
-		if (p_item->cells[i].dirty) {
-			const_cast<Tree *>(this)->update_item_cell(p_item, i);
+		const TreeItem::Cell &cell = p_item->cells[i];
+		if (cell.dirty && cell.autowrap_mode == TextServer::AUTOWRAP_OFF && cell.text.find_char('\n') == -1 && cell.suffix.find_char('\n') == -1) {
+			// Single line text is one font line high, leave the shaping to draw_item in case the row is never visible.
+			const Ref<Font> &font = cell.custom_font.is_valid() ? cell.custom_font : theme_cache.font;
+			height = MAX(height, font->get_height(cell.custom_font_size > 0 ? cell.custom_font_size : theme_cache.font_size));
+		} else {
+			if (cell.dirty) {
+				const_cast<Tree *>(this)->update_item_cell(p_item, i);
+			}
+			height = MAX(height, cell.text_buf->get_size().y);
 		}
-		height = MAX(height, p_item->cells[i].text_buf->get_size().y);
 		for (int j = 0; j < p_item->cells[i].buttons.size(); j++) {
 			Size2i s; // = cache.button_pressed->get_minimum_size();
 			s += p_item->cells[i].buttons[j].texture->get_size();
@@ -2062,6 +2069,12 @@ int Tree::draw_item(const Point2i &p_pos, const Point2 &p_draw_ofs, const Size2
 				continue; // No need to draw.
 			}
 
+			if (p_item->cells[i].dirty) {
+				update_item_cell(p_item, i);
+				r_self_height = compute_item_height(p_item);
+				label_h = r_self_height + theme_cache.v_separation;
+			}
+
 			Rect2i item_rect = Rect2i(Point2i(ofs, p_pos.y) - theme_cache.offset + p_draw_ofs, Size2i(item_width, label_h));
 			Rect2i cell_rect = item_rect;
 			if (i != 0) {
@@ -394,7 +394,7 @@ void CanvasItem::queue_redraw() {
 	if (!is_inside_tree()) {
 		return;
 	}
-	if (pending_update) {
+	if (pending_update || RS::get_singleton()->is_in_server_mode()) {
 		return;
 	}
 
@@ -32,10 +32,116 @@
 #include "core/io/compression.h"
 #include "scene/main/timer.h"
 
+Mutex HTTPRequest::connection_pool_mutex;
+HashMap<String, LocalVector<HTTPRequest::PooledConnection>> HTTPRequest::connection_pool;
+
 Error HTTPRequest::_request() {
+	if (reused_connection) {
+		return OK; // Already connected, the request is sent on the next update.
+	}
 	return client->connect_to_host(url, port, use_tls ? tls_options : nullptr);
 }
 
+String HTTPRequest::_get_connection_key() const {
+	String key = (use_tls ? "https://" : "http://") + url + ":" + itos(port);
+	if (use_tls && tls_options.is_valid()) {
+		Ref<X509Certificate> ca_chain = tls_options->get_trusted_ca_chain();
+		key += "|" + itos(tls_options->get_verify_mode()) + "|" + tls_options->get_common_name() + "|" + (ca_chain.is_valid() ? itos(ca_chain->get_instance_id()) : String());
+	}
+	if (use_tls) {
+		key += "|" + https_proxy_host + ":" + itos(https_proxy_port);
+	} else {
+		key += "|" + http_proxy_host + ":" + itos(http_proxy_port);
+	}
+	return key;
+}
+
+bool HTTPRequest::_acquire_pooled_connection() {
+	Ref<HTTPClient> pooled;
+	uint64_t now = OS::get_singleton()->get_ticks_msec();
+	{
+		MutexLock lock(connection_pool_mutex);
+		HashMap<String, LocalVector<PooledConnection>>::Iterator E = connection_pool.find(_get_connection_key());
+		if (!E) {
+			return false;
+		}
+
+		// Most recently released first, it is the least likely to have been closed by the server.
+		while (!E->value.is_empty() && pooled.is_null()) {
+			PooledConnection pc = E->value[E->value.size() - 1];
+			E->value.resize(E->value.size() - 1);
+			if (now - pc.released_msec > CONNECTION_POOL_IDLE_TIMEOUT_MSEC) {
+				pc.client->close();
+				continue;
+			}
+			pc.client->poll();
+			if (pc.client->get_status() == HTTPClient::STATUS_CONNECTED) {
+				pooled = pc.client;
+			}
+		}
+		if (E->value.is_empty()) {
+			connection_pool.remove(E);
+		}
+	}
+
+	if (pooled.is_null()) {
+		return false;
+	}
+
+	pooled->set_read_chunk_size(client->get_read_chunk_size());
+	client = pooled;
+	return true;
+}
+
+void HTTPRequest::_release_connection() {
+	if (!keep_connection || client->get_status() != HTTPClient::STATUS_CONNECTED) {
+		client->close();
+		return;
+	}
+
+	PooledConnection pc;
+	pc.client = client;
+	pc.released_msec = OS::get_singleton()->get_ticks_msec();
+	{
+		MutexLock lock(connection_pool_mutex);
+		LocalVector<PooledConnection> &connections = connection_pool[_get_connection_key()];
+		if (connections.size() >= CONNECTION_POOL_MAX_PER_HOST) {
+			connections[0].client->close();
+			connections.remove_at(0);
+		}
+		connections.push_back(pc);
+	}
+
+	// The pooled client now belongs to whichever node reuses it, this node gets a new one with the same settings.
+	int read_chunk_size = client->get_read_chunk_size();
+	client = Ref<HTTPClient>(HTTPClient::create());
+	client->set_read_chunk_size(read_chunk_size);
+	client->set_http_proxy(http_proxy_host, http_proxy_port);
+	client->set_https_proxy(https_proxy_host, https_proxy_port);
+}
+
+bool HTTPRequest::_retry_stale_connection() {
+	if (!reused_connection || got_response) {
+		return false;
+	}
+
+	// The server closed the idle connection before our request reached it, connect again and resend.
+	reused_connection = false;
+	request_sent = false;
+	client->close();
+	return client->connect_to_host(url, port, use_tls ? tls_options : nullptr) == OK;
+}
+
+void HTTPRequest::clear_connection_pool() {
+	MutexLock lock(connection_pool_mutex);
+	for (KeyValue<String, LocalVector<PooledConnection>> &E : connection_pool) {
+		for (PooledConnection &pc : E.value) {
+			pc.client->close();
+		}
+	}
+	connection_pool.clear();
+}
+
 Error HTTPRequest::_parse_url(const String &p_url) {
 	use_tls = false;
 	request_string = "";
@@ -139,6 +245,8 @@ Error HTTPRequest::request_raw(const String &p_url, const Vector<String> &p_cust
 	request_data = p_request_data_raw;
 
 	requesting = true;
+	keep_connection = false;
+	reused_connection = use_connection_pool && _acquire_pooled_connection();
 
 	if (use_threads.is_set()) {
 		thread_done.clear();
@@ -197,7 +305,13 @@ void HTTPRequest::cancel_request() {
 
 	file.unref();
 	decompressor.unref();
-	client->close();
+	if (use_connection_pool) {
+		_release_connection();
+	} else {
+		client->close();
+	}
+	keep_connection = false;
+	reused_connection = false;
 	body.clear();
 	got_response = false;
 	response_code = -1;
@@ -245,6 +359,7 @@ bool HTTPRequest::_handle_response(bool *ret_value) {
 		if (!new_request.is_empty()) {
 			// Process redirect.
 			client->close();
+			reused_connection = false;
 			int new_redirs = redirections + 1; // Because _request() will clear it.
 			Error err;
 			if (new_request.begins_with("http")) {
@@ -288,6 +403,9 @@ bool HTTPRequest::_handle_response(bool *ret_value) {
 bool HTTPRequest::_update_connection() {
 	switch (client->get_status()) {
 		case HTTPClient::STATUS_DISCONNECTED: {
+			if (_retry_stale_connection()) {
+				return false;
+			}
 			_defer_done(RESULT_CANT_CONNECT, 0, PackedStringArray(), PackedByteArray());
 			return true; // End it, since it's disconnected.
 		} break;
@@ -459,6 +577,9 @@ bool HTTPRequest::_update_connection() {
 
 		} break; // Request resulted in body: break which must be read.
 		case HTTPClient::STATUS_CONNECTION_ERROR: {
+			if (_retry_stale_connection()) {
+				return false;
+			}
 			_defer_done(RESULT_CONNECTION_ERROR, 0, PackedStringArray(), PackedByteArray());
 			return true;
 		} break;
@@ -476,6 +597,8 @@ void HTTPRequest::_defer_done(int p_status, int p_code, const PackedStringArray
 }
 
 void HTTPRequest::_request_done(int p_status, int p_code, const PackedStringArray &p_headers, const PackedByteArray &p_data) {
+	// Only a fully read response leaves the connection ready for the next request.
+	keep_connection = p_status == RESULT_SUCCESS && get_header_value(p_headers, "Connection").to_lower() != "close";
 	cancel_request();
 
 	emit_signal(SNAME("request_completed"), p_status, p_code, p_headers, p_data);
@@ -518,6 +641,14 @@ bool HTTPRequest::is_accepting_gzip() const {
 	return accept_gzip;
 }
 
+void HTTPRequest::set_use_connection_pool(bool p_enable) {
+	use_connection_pool = p_enable;
+}
+
+bool HTTPRequest::is_using_connection_pool() const {
+	return use_connection_pool;
+}
+
 void HTTPRequest::set_body_size_limit(int p_bytes) {
 	ERR_FAIL_COND(get_http_client_status() != HTTPClient::STATUS_DISCONNECTED);
 
@@ -569,10 +700,14 @@ int HTTPRequest::get_body_size() const {
 }
 
 void HTTPRequest::set_http_proxy(const String &p_host, int p_port) {
+	http_proxy_host = p_host;
+	http_proxy_port = p_port;
 	client->set_http_proxy(p_host, p_port);
 }
 
 void HTTPRequest::set_https_proxy(const String &p_host, int p_port) {
+	https_proxy_host = p_host;
+	https_proxy_port = p_port;
 	client->set_https_proxy(p_host, p_port);
 }
 
@@ -609,6 +744,9 @@ void HTTPRequest::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_accept_gzip", "enable"), &HTTPRequest::set_accept_gzip);
 	ClassDB::bind_method(D_METHOD("is_accepting_gzip"), &HTTPRequest::is_accepting_gzip);
 
+	ClassDB::bind_method(D_METHOD("set_use_connection_pool", "enable"), &HTTPRequest::set_use_connection_pool);
+	ClassDB::bind_method(D_METHOD("is_using_connection_pool"), &HTTPRequest::is_using_connection_pool);
+
 	ClassDB::bind_method(D_METHOD("set_body_size_limit", "bytes"), &HTTPRequest::set_body_size_limit);
 	ClassDB::bind_method(D_METHOD("get_body_size_limit"), &HTTPRequest::get_body_size_limit);
 
@@ -636,6 +774,7 @@ void HTTPRequest::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "download_chunk_size", PROPERTY_HINT_RANGE, "256,16777216,suffix:B"), "set_download_chunk_size", "get_download_chunk_size");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_threads"), "set_use_threads", "is_using_threads");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "accept_gzip"), "set_accept_gzip", "is_accepting_gzip");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_connection_pool"), "set_use_connection_pool", "is_using_connection_pool");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "body_size_limit", PROPERTY_HINT_RANGE, "-1,2000000000,suffix:B"), "set_body_size_limit", "get_body_size_limit");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_redirects", PROPERTY_HINT_RANGE, "-1,64"), "set_max_redirects", "get_max_redirects");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "timeout", PROPERTY_HINT_RANGE, "0,3600,0.1,or_greater,suffix:s"), "set_timeout", "get_timeout");
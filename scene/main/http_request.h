@@ -33,6 +33,7 @@
 
 #include "core/io/http_client.h"
 #include "core/io/stream_peer_gzip.h"
+#include "core/os/mutex.h"
 #include "core/os/thread.h"
 #include "core/templates/safe_refcount.h"
 #include "scene/main/node.h"
@@ -95,6 +96,31 @@ private:
 
 	int redirections = 0;
 
+	String http_proxy_host;
+	int http_proxy_port = -1;
+	String https_proxy_host;
+	int https_proxy_port = -1;
+
+	// Keep-alive connections left open by finished requests, shared by all nodes and keyed by host, port, TLS options and proxies.
+	struct PooledConnection {
+		Ref<HTTPClient> client;
+		uint64_t released_msec = 0;
+	};
+
+	static const uint64_t CONNECTION_POOL_IDLE_TIMEOUT_MSEC = 30000;
+	static const uint32_t CONNECTION_POOL_MAX_PER_HOST = 8;
+	static Mutex connection_pool_mutex;
+	static HashMap<String, LocalVector<PooledConnection>> connection_pool;
+
+	bool use_connection_pool = false;
+	bool reused_connection = false;
+	bool keep_connection = false;
+
+	String _get_connection_key() const;
+	bool _acquire_pooled_connection();
+	void _release_connection();
+	bool _retry_stale_connection();
+
 	bool _update_connection();
 
 	int max_redirects = 8;
@@ -136,6 +162,9 @@ public:
 	void set_accept_gzip(bool p_gzip);
 	bool is_accepting_gzip() const;
 
+	void set_use_connection_pool(bool p_enable);
+	bool is_using_connection_pool() const;
+
 	void set_download_file(const String &p_file);
 	String get_download_file() const;
 
@@ -163,6 +192,8 @@ public:
 
 	void set_tls_options(const Ref<TLSOptions> &p_options);
 
+	static void clear_connection_pool();
+
 	HTTPRequest();
 };
 
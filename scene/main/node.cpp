@@ -360,6 +360,11 @@ void Node::_propagate_exit_tree() {
 		data.tree->tree_changed();
 	}
 
+	if (data.node_path_cache) {
+		memdelete(data.node_path_cache);
+		data.node_path_cache = nullptr;
+	}
+
 	data.inside_tree = false;
 	data.ready_notified = false;
 	data.tree = nullptr;
@@ -955,6 +960,15 @@ int Node::get_process_thread_group_order() const {
 	return data.process_thread_group_order;
 }
 
+void Node::set_process_thread_group_split(bool p_enable) {
+	ERR_THREAD_GUARD
+	data.process_thread_group_split = p_enable;
+}
+
+bool Node::is_process_thread_group_split() const {
+	return data.process_thread_group_split;
+}
+
 void Node::set_process_priority(int p_priority) {
 	ERR_THREAD_GUARD
 	if (data.process_priority == p_priority) {
@@ -1545,6 +1559,9 @@ Node *Node::_get_child_by_name(const StringName &p_name) const {
 	}
 }
 
+// Large enough for the paths a script uses every frame, the cache is cleared when full.
+static const uint32_t NODE_PATH_CACHE_MAX = 32;
+
 Node *Node::get_node_or_null(const NodePath &p_path) const {
 	ERR_THREAD_GUARD_V(nullptr);
 	if (p_path.is_empty()) {
@@ -1553,6 +1570,16 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 
 	ERR_FAIL_COND_V_MSG(!data.inside_tree && p_path.is_absolute(), nullptr, "Can't use get_node() with absolute paths from outside the active scene tree.");
 
+	// Single names are already one lookup, longer paths (such as "$Path/To/Node" in scripts) are cached
+	// until the tree changes.
+	bool use_cache = data.inside_tree && p_path.get_name_count() > 1;
+	if (use_cache && data.node_path_cache && data.node_path_cache_version == data.tree->tree_version) {
+		Node *const *cached = data.node_path_cache->getptr(p_path);
+		if (cached) {
+			return *cached;
+		}
+	}
+
 	Node *current = nullptr;
 	Node *root = nullptr;
 
@@ -1615,6 +1642,17 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 		current = next;
 	}
 
+	if (use_cache && current) {
+		if (!data.node_path_cache) {
+			data.node_path_cache = memnew((HashMap<NodePath, Node *>));
+		}
+		if (data.node_path_cache_version != data.tree->tree_version || data.node_path_cache->size() >= NODE_PATH_CACHE_MAX) {
+			data.node_path_cache->clear();
+			data.node_path_cache_version = data.tree->tree_version;
+		}
+		data.node_path_cache->insert(p_path, current);
+	}
+
 	return current;
 }
 
@@ -1846,6 +1884,13 @@ void Node::_set_owner_nocheck(Node *p_owner) {
 	owner_changed_notify();
 }
 
+void Node::_invalidate_node_path_caches() {
+	// Unique names and owners also take part in path resolution, without being tree changes.
+	if (data.tree) {
+		data.tree->tree_version++;
+	}
+}
+
 void Node::_release_unique_name_in_owner() {
 	ERR_FAIL_NULL(data.owner); // Sanity check.
 	StringName key = StringName(UNIQUE_NODE_PREFIX + data.name.operator String());
@@ -1854,6 +1899,7 @@ void Node::_release_unique_name_in_owner() {
 		return; // Ignore.
 	}
 	data.owner->data.owned_unique_nodes.erase(key);
+	_invalidate_node_path_caches();
 }
 
 void Node::_acquire_unique_name_in_owner() {
@@ -1868,6 +1914,7 @@ void Node::_acquire_unique_name_in_owner() {
 		return;
 	}
 	data.owner->data.owned_unique_nodes[key] = this;
+	_invalidate_node_path_caches();
 }
 
 void Node::set_unique_name_in_owner(bool p_enabled) {
@@ -1938,6 +1985,7 @@ void Node::_clean_up_owner() {
 	data.owner->data.owned.erase(data.OW);
 	data.owner = nullptr;
 	data.OW = nullptr;
+	_invalidate_node_path_caches();
 }
 
 Node *Node::find_common_parent_with(const Node *p_node) const {
@@ -3137,6 +3185,9 @@ void Node::_validate_property(PropertyInfo &p_property) const {
 	if ((p_property.name == "process_thread_group_order" || p_property.name == "process_thread_messages") && data.process_thread_group == PROCESS_THREAD_GROUP_INHERIT) {
 		p_property.usage = 0;
 	}
+	if (p_property.name == "process_thread_group_split" && data.process_thread_group != PROCESS_THREAD_GROUP_SUB_THREAD) {
+		p_property.usage = 0;
+	}
 }
 
 void Node::input(const Ref<InputEvent> &p_event) {
@@ -3314,6 +3365,9 @@ void Node::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_process_thread_group_order", "order"), &Node::set_process_thread_group_order);
 	ClassDB::bind_method(D_METHOD("get_process_thread_group_order"), &Node::get_process_thread_group_order);
 
+	ClassDB::bind_method(D_METHOD("set_process_thread_group_split", "enable"), &Node::set_process_thread_group_split);
+	ClassDB::bind_method(D_METHOD("is_process_thread_group_split"), &Node::is_process_thread_group_split);
+
 	ClassDB::bind_method(D_METHOD("set_display_folded", "fold"), &Node::set_display_folded);
 	ClassDB::bind_method(D_METHOD("is_displayed_folded"), &Node::is_displayed_folded);
 
@@ -3495,6 +3549,7 @@ void Node::_bind_methods() {
 	ADD_SUBGROUP("Thread Group", "process_thread");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group", PROPERTY_HINT_ENUM, "Inherit,Main Thread,Sub Thread"), "set_process_thread_group", "get_process_thread_group");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group_order"), "set_process_thread_group_order", "get_process_thread_group_order");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "process_thread_group_split"), "set_process_thread_group_split", "is_process_thread_group_split");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_messages", PROPERTY_HINT_FLAGS, "Process,Physics Process"), "set_process_thread_messages", "get_process_thread_messages");
 
 	ADD_GROUP("Editor Description", "editor_");
@@ -3531,6 +3586,9 @@ Node::Node() {
 }
 
 Node::~Node() {
+	if (data.node_path_cache) {
+		memdelete(data.node_path_cache);
+	}
 	data.grouped.clear();
 	data.owned.clear();
 	data.children.clear();
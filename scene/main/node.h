@@ -155,6 +155,10 @@ private:
 		mutable LocalVector<Node *> children_cache;
 		HashMap<StringName, Node *> owned_unique_nodes;
 		bool unique_name_in_owner = false;
+
+		// Paths resolved by get_node(), valid as long as the tree version they were resolved at.
+		mutable HashMap<NodePath, Node *> *node_path_cache = nullptr;
+		mutable uint64_t node_path_cache_version = 0;
 		InternalMode internal_mode = INTERNAL_MODE_DISABLED;
 		mutable int internal_children_front_count_cache = 0;
 		mutable int internal_children_back_count_cache = 0;
@@ -183,6 +187,7 @@ private:
 		ProcessThreadGroup process_thread_group = PROCESS_THREAD_GROUP_INHERIT;
 		Node *process_thread_group_owner = nullptr;
 		int process_thread_group_order = 0;
+		bool process_thread_group_split = false;
 		BitField<ProcessThreadMessages> process_thread_messages;
 		void *process_group = nullptr; // to avoid cyclic dependency
 
@@ -255,6 +260,7 @@ private:
 
 	void _release_unique_name_in_owner();
 	void _acquire_unique_name_in_owner();
+	void _invalidate_node_path_caches();
 
 	void _clean_up_owner();
 
@@ -524,6 +530,9 @@ public:
 	void set_process_thread_group_order(int p_order);
 	int get_process_thread_group_order() const;
 
+	void set_process_thread_group_split(bool p_enable);
+	bool is_process_thread_group_split() const;
+
 	void set_physics_process_priority(int p_priority);
 	int get_physics_process_priority() const;
 
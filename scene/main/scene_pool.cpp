@@ -0,0 +1,206 @@
+/**************************************************************************/
+/*  scene_pool.cpp                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "scene_pool.h"
+
+#include "core/core_string_names.h"
+
+void ScenePool::_gather_reset_properties(const Ref<SceneState> &p_state, const NodePath &p_base) {
+	Ref<SceneState> base_state = p_state->get_base_scene_state();
+	if (base_state.is_valid()) {
+		_gather_reset_properties(base_state, p_base);
+	}
+
+	for (int i = 0; i < p_state->get_node_count(); i++) {
+		NodePath path = p_state->get_node_path(i);
+		if (!p_base.is_empty()) {
+			path = NodePath(String(p_base).path_join(String(path)).simplify_path());
+		}
+
+		if (!p_state->is_node_instance_placeholder(i)) {
+			Ref<PackedScene> instance = p_state->get_node_instance(i);
+			if (instance.is_valid()) {
+				_gather_reset_properties(instance->get_state(), path);
+			}
+		}
+
+		Vector<String> deferred = p_state->get_node_deferred_nodepath_properties(i);
+		for (int j = 0; j < p_state->get_node_property_count(i); j++) {
+			StringName name = p_state->get_node_property_name(i, j);
+			if (name == CoreStringNames::get_singleton()->_script || deferred.has(name)) {
+				continue; // Scripts are never swapped, and node references still point inside the instance.
+			}
+
+			ResetProperty prop;
+			prop.path = path;
+			prop.name = name;
+			prop.value = p_state->get_node_property_value(i, j);
+
+			Ref<Resource> res = prop.value;
+			if (res.is_valid() && res->is_local_to_scene()) {
+				continue; // Each instance keeps its own copy.
+			}
+			reset_properties.push_back(prop);
+		}
+	}
+}
+
+bool ScenePool::_reset(Node *p_node) {
+	if (reset_properties_dirty) {
+		reset_properties.clear();
+		_gather_reset_properties(scene->get_state(), NodePath());
+		reset_properties_dirty = false;
+	}
+
+	const NodePath *last_path = nullptr;
+	Node *target = nullptr;
+	for (const ResetProperty &prop : reset_properties) {
+		if (!last_path || *last_path != prop.path) {
+			target = p_node->get_node_or_null(prop.path);
+			last_path = &prop.path;
+		}
+		if (!target) {
+			return false; // Nodes were renamed or freed, the instance can't be reused.
+		}
+		target->set(prop.name, prop.value);
+	}
+	return true;
+}
+
+void ScenePool::set_scene(const Ref<PackedScene> &p_scene) {
+	if (scene == p_scene) {
+		return;
+	}
+	clear();
+	scene = p_scene;
+	reset_properties_dirty = true;
+}
+
+Ref<PackedScene> ScenePool::get_scene() const {
+	return scene;
+}
+
+void ScenePool::set_max_size(int p_max_size) {
+	ERR_FAIL_COND(p_max_size < 0);
+	max_size = p_max_size;
+	while ((int)available.size() > max_size) {
+		Node *node = Object::cast_to<Node>(ObjectDB::get_instance(available[available.size() - 1]));
+		available.resize(available.size() - 1);
+		if (node) {
+			memdelete(node);
+		}
+	}
+}
+
+int ScenePool::get_max_size() const {
+	return max_size;
+}
+
+Node *ScenePool::acquire() {
+	ERR_FAIL_COND_V_MSG(scene.is_null(), nullptr, "No scene set in the pool.");
+
+	while (!available.is_empty()) {
+		ObjectID id = available[available.size() - 1];
+		available.resize(available.size() - 1);
+		Node *node = Object::cast_to<Node>(ObjectDB::get_instance(id));
+		if (node) {
+			acquired.insert(id);
+			return node;
+		}
+	}
+
+	Node *node = scene->instantiate();
+	ERR_FAIL_NULL_V(node, nullptr);
+	acquired.insert(node->get_instance_id());
+	return node;
+}
+
+void ScenePool::release(Node *p_node) {
+	ERR_FAIL_NULL(p_node);
+	ERR_FAIL_COND_MSG(!acquired.has(p_node->get_instance_id()), "Node was not acquired from this pool.");
+	acquired.erase(p_node->get_instance_id());
+
+	Node *parent = p_node->get_parent();
+	if (parent) {
+		parent->remove_child(p_node);
+		ERR_FAIL_COND_MSG(p_node->get_parent(), "Node could not be removed from its parent, it won't be pooled.");
+	}
+
+	if ((int)available.size() >= max_size || !_reset(p_node)) {
+		memdelete(p_node);
+		return;
+	}
+	available.push_back(p_node->get_instance_id());
+}
+
+void ScenePool::prewarm(int p_count) {
+	ERR_FAIL_COND_MSG(scene.is_null(), "No scene set in the pool.");
+	while ((int)available.size() < MIN(p_count, max_size)) {
+		Node *node = scene->instantiate();
+		ERR_FAIL_NULL(node);
+		available.push_back(node->get_instance_id());
+	}
+}
+
+int ScenePool::get_available_count() const {
+	return available.size();
+}
+
+void ScenePool::clear() {
+	for (const ObjectID &id : available) {
+		Node *node = Object::cast_to<Node>(ObjectDB::get_instance(id));
+		if (node) {
+			memdelete(node);
+		}
+	}
+	available.clear();
+	acquired.clear();
+}
+
+void ScenePool::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_scene", "scene"), &ScenePool::set_scene);
+	ClassDB::bind_method(D_METHOD("get_scene"), &ScenePool::get_scene);
+
+	ClassDB::bind_method(D_METHOD("set_max_size", "max_size"), &ScenePool::set_max_size);
+	ClassDB::bind_method(D_METHOD("get_max_size"), &ScenePool::get_max_size);
+
+	ClassDB::bind_method(D_METHOD("acquire"), &ScenePool::acquire);
+	ClassDB::bind_method(D_METHOD("release", "node"), &ScenePool::release);
+	ClassDB::bind_method(D_METHOD("prewarm", "count"), &ScenePool::prewarm);
+	ClassDB::bind_method(D_METHOD("get_available_count"), &ScenePool::get_available_count);
+	ClassDB::bind_method(D_METHOD("clear"), &ScenePool::clear);
+
+	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "scene", PROPERTY_HINT_RESOURCE_TYPE, "PackedScene"), "set_scene", "get_scene");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_size", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"), "set_max_size", "get_max_size");
+}
+
+ScenePool::~ScenePool() {
+	clear();
+}
@@ -150,9 +150,11 @@ SceneTree::Group *SceneTree::add_to_group(const StringName &p_group, Node *p_nod
 	}
 
 	ERR_FAIL_COND_V_MSG(E->value.nodes.has(p_node), &E->value, "Already in group: " + p_group + ".");
+	// Nodes usually enter the tree after the ones already in the group, in that case the order is still valid.
+	if (!E->value.changed && !E->value.nodes.is_empty() && !p_node->is_greater_than(E->value.nodes[E->value.nodes.size() - 1])) {
+		E->value.changed = true;
+	}
 	E->value.nodes.push_back(p_node);
-	//E->value.last_tree_version=0;
-	E->value.changed = true;
 	return &E->value;
 }
 
@@ -184,6 +186,7 @@ void SceneTree::flush_transform_notifications() {
 		Node *node = n->self();
 		SelfList<Node> *nx = n->next();
 		xform_change_list.remove(n);
+		xform_propagation_pass++;
 		n = nx;
 		node->notification(NOTIFICATION_TRANSFORM_CHANGED);
 	}
@@ -261,11 +264,13 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 			return;
 		}
 
-		_update_group_order(g);
+		if (!(p_call_flags & GROUP_CALL_UNORDERED)) {
+			_update_group_order(g);
+		}
 		nodes_copy = g.nodes;
 	}
 
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node *const *gr_nodes = nodes_copy.ptr(); // Read only, so the copy keeps sharing the group storage.
 	int gr_node_count = nodes_copy.size();
 
 	{
@@ -324,12 +329,14 @@ void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_gr
 			return;
 		}
 
-		_update_group_order(g);
+		if (!(p_call_flags & GROUP_CALL_UNORDERED)) {
+			_update_group_order(g);
+		}
 
 		nodes_copy = g.nodes;
 	}
 
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node *const *gr_nodes = nodes_copy.ptr();
 	int gr_node_count = nodes_copy.size();
 
 	{
@@ -387,11 +394,13 @@ void SceneTree::set_group_flags(uint32_t p_call_flags, const StringName &p_group
 			return;
 		}
 
-		_update_group_order(g);
+		if (!(p_call_flags & GROUP_CALL_UNORDERED)) {
+			_update_group_order(g);
+		}
 
 		nodes_copy = g.nodes;
 	}
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node *const *gr_nodes = nodes_copy.ptr();
 	int gr_node_count = nodes_copy.size();
 
 	{
@@ -450,6 +459,8 @@ void SceneTree::initialize() {
 }
 
 bool SceneTree::physics_process(double p_time) {
+	MEMORY_TAG_SCOPE("Scene");
+
 	root_lock++;
 
 	current_frame++;
@@ -484,6 +495,8 @@ bool SceneTree::physics_process(double p_time) {
 }
 
 bool SceneTree::process(double p_time) {
+	MEMORY_TAG_SCOPE("Scene");
+
 	root_lock++;
 
 	if (MainLoop::process(p_time)) {
@@ -592,28 +605,40 @@ void SceneTree::process_timers(double p_delta, bool p_physics_frame) {
 
 void SceneTree::process_tweens(double p_delta, bool p_physics) {
 	_THREAD_SAFE_METHOD_
-	// This methods works similarly to how SceneTreeTimers are handled.
-	List<Ref<Tween>>::Element *L = tweens.back();
-
-	for (List<Ref<Tween>>::Element *E = tweens.front(); E;) {
-		List<Ref<Tween>>::Element *N = E->next();
+	// Tweens created while processing are appended, and only processed on the next frame.
+	// Finished ones are cleared in place and compacted out afterwards.
+	uint32_t tween_count = tweens.size();
+	bool any_finished = false;
+
+	for (uint32_t i = 0; i < tween_count; i++) {
+		Ref<Tween> tween = tweens[i];
+		if (tween.is_null()) {
+			continue;
+		}
 		// Don't process if paused or process mode doesn't match.
-		if (!E->get()->can_process(paused) || (p_physics == (E->get()->get_process_mode() == Tween::TWEEN_PROCESS_IDLE))) {
-			if (E == L) {
-				break;
-			}
-			E = N;
+		if (!tween->can_process(paused) || (p_physics == (tween->get_process_mode() == Tween::TWEEN_PROCESS_IDLE))) {
 			continue;
 		}
 
-		if (!E->get()->step(p_delta)) {
-			E->get()->clear();
-			tweens.erase(E);
+		if (!tween->step(p_delta)) {
+			tween->clear();
+			tweens[i] = Ref<Tween>();
+			any_finished = true;
 		}
-		if (E == L) {
-			break;
+	}
+
+	if (any_finished) {
+		uint32_t alive = 0;
+		for (uint32_t i = 0; i < tweens.size(); i++) {
+			if (tweens[i].is_null()) {
+				continue;
+			}
+			if (alive != i) {
+				tweens[alive] = tweens[i];
+			}
+			alive++;
 		}
-		E = N;
+		tweens.resize(alive);
 	}
 }
 
@@ -643,7 +668,9 @@ void SceneTree::finalize() {
 
 	// Cleanup tweens.
 	for (Ref<Tween> &tween : tweens) {
-		tween->clear();
+		if (tween.is_valid()) {
+			tween->clear();
+		}
 	}
 	tweens.clear();
 }
@@ -892,16 +919,8 @@ bool SceneTree::is_paused() const {
 	return paused;
 }
 
-void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
-	// When reading this function, keep in mind that this code must work in a way where
-	// if any node is removed, this needs to continue working.
-
-	p_group->call_queue.flush(); // Flush messages before processing.
-
+Vector<Node *> &SceneTree::_sort_process_group(ProcessGroup *p_group, bool p_physics) {
 	Vector<Node *> &nodes = p_physics ? p_group->physics_nodes : p_group->nodes;
-	if (nodes.is_empty()) {
-		return;
-	}
 
 	if (p_physics) {
 		if (p_group->physics_node_order_dirty) {
@@ -915,13 +934,13 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 		}
 	}
 
-	// Make a copy, so if nodes are added/removed from process, this does not break
-	Vector<Node *> nodes_copy = nodes;
+	return nodes;
+}
 
-	uint32_t node_count = nodes_copy.size();
-	Node **nodes_ptr = (Node **)nodes_copy.ptr(); // Force cast, pointer will not change.
+void SceneTree::_process_group_nodes(const Vector<Node *> &p_nodes, uint32_t p_from, uint32_t p_to, bool p_physics) {
+	Node *const *nodes_ptr = p_nodes.ptr();
 
-	for (uint32_t i = 0; i < node_count; i++) {
+	for (uint32_t i = p_from; i < p_to; i++) {
 		Node *n = nodes_ptr[i];
 		if (nodes_removed_on_group_call.has(n)) {
 			// Node may have been removed during process, skip it.
@@ -949,14 +968,51 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 			}
 		}
 	}
+}
+
+void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
+	// When reading this function, keep in mind that this code must work in a way where
+	// if any node is removed, this needs to continue working.
+
+	p_group->call_queue.flush(); // Flush messages before processing.
+
+	Vector<Node *> &nodes = _sort_process_group(p_group, p_physics);
+	if (nodes.is_empty()) {
+		return;
+	}
+
+	// Make a copy, so if nodes are added/removed from process, this does not break
+	Vector<Node *> nodes_copy = nodes;
+	_process_group_nodes(nodes_copy, 0, nodes_copy.size(), p_physics);
 
 	p_group->call_queue.flush(); // Flush messages also after processing (for potential deferred calls).
 }
 
 void SceneTree::_process_groups_thread(uint32_t p_index, bool p_physics) {
-	Node::current_process_thread_group = local_process_group_cache[p_index]->owner;
-	_process_group(local_process_group_cache[p_index], p_physics);
+	ProcessGroupTask &task = local_process_group_tasks[p_index];
+	uint64_t begin_usec = process_groups_profiling ? OS::get_singleton()->get_ticks_usec() : 0;
+
+	Node::current_process_thread_group = task.group->owner;
+	if (task.split) {
+		// Messages are flushed and nodes sorted on the main thread, before and after all the chunks.
+		_process_group_nodes(task.group->split_nodes, task.from, task.to, p_physics);
+	} else {
+		_process_group(task.group, p_physics);
+	}
 	Node::current_process_thread_group = nullptr;
+
+	if (process_groups_profiling) {
+		task.time_usec = OS::get_singleton()->get_ticks_usec() - begin_usec;
+	}
+}
+
+void SceneTree::_add_process_group_profile(ProcessGroup *p_group, uint64_t p_time_usec, int p_chunk) {
+	String name = p_group->owner ? String(p_group->owner->get_path()) : String("Default");
+	if (p_chunk >= 0) {
+		name += " #" + itos(p_chunk);
+	}
+	process_groups_profile.push_back(name);
+	process_groups_profile.push_back(USEC_TO_SEC(p_time_usec));
 }
 
 void SceneTree::_process(bool p_physics) {
@@ -998,6 +1054,7 @@ void SceneTree::_process(bool p_physics) {
 	}
 
 	process_last_pass++; // Increment pass
+	process_groups_profiling = EngineDebugger::is_profiling("servers");
 	uint32_t from = 0;
 	uint32_t process_count = 0;
 	nodes_removed_on_group_call_lock++;
@@ -1015,21 +1072,70 @@ void SceneTree::_process(bool p_physics) {
 				bool using_threads = process_groups[from]->owner && process_groups[from]->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD && !node_threading_disabled;
 
 				if (using_threads) {
-					local_process_group_cache.clear();
+					local_process_group_tasks.clear();
 				}
 				for (uint32_t j = from; j < i; j++) {
-					if (process_groups[j]->last_pass == process_last_pass) {
-						if (using_threads) {
-							local_process_group_cache.push_back(process_groups[j]);
-						} else {
-							_process_group(process_groups[j], p_physics);
+					ProcessGroup *pg = process_groups[j];
+					if (pg->last_pass != process_last_pass) {
+						continue;
+					}
+
+					if (!using_threads) {
+						uint64_t begin_usec = process_groups_profiling ? OS::get_singleton()->get_ticks_usec() : 0;
+						_process_group(pg, p_physics);
+						if (process_groups_profiling) {
+							_add_process_group_profile(pg, OS::get_singleton()->get_ticks_usec() - begin_usec);
 						}
+						continue;
+					}
+
+					uint32_t chunk_count = 1;
+					if (pg->owner->data.process_thread_group_split) {
+						uint32_t node_count = (p_physics ? pg->physics_nodes : pg->nodes).size();
+						chunk_count = MIN((uint32_t)WorkerThreadPool::get_singleton()->get_thread_count(), node_count / PROCESS_GROUP_SPLIT_MIN_NODES);
+					}
+
+					ProcessGroupTask task;
+					task.group = pg;
+					if (chunk_count <= 1) {
+						local_process_group_tasks.push_back(task);
+						continue;
+					}
+
+					// The chunks can't flush messages or sort on their own, do it here instead.
+					Node::current_process_thread_group = pg->owner;
+					pg->call_queue.flush();
+					Node::current_process_thread_group = nullptr;
+					pg->split_nodes = _sort_process_group(pg, p_physics);
+
+					task.split = true;
+					uint32_t node_count = pg->split_nodes.size();
+					for (uint32_t k = 0; k < chunk_count; k++) {
+						task.from = node_count * k / chunk_count;
+						task.to = node_count * (k + 1) / chunk_count;
+						local_process_group_tasks.push_back(task);
 					}
 				}
 
-				if (using_threads) {
-					WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_process_groups_thread, p_physics, local_process_group_cache.size(), -1, true);
+				if (using_threads && local_process_group_tasks.size()) {
+					WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_process_groups_thread, p_physics, local_process_group_tasks.size(), -1, true);
 					WorkerThreadPool::get_singleton()->wait_for_group_task_completion(id);
+
+					ProcessGroup *last_split = nullptr;
+					int chunk = 0;
+					for (const ProcessGroupTask &task : local_process_group_tasks) {
+						if (process_groups_profiling) {
+							chunk = task.group == last_split ? chunk + 1 : 0;
+							_add_process_group_profile(task.group, task.time_usec, task.split ? chunk : -1);
+						}
+						if (task.split && task.group != last_split) {
+							last_split = task.group;
+							Node::current_process_thread_group = task.group->owner;
+							task.group->call_queue.flush(); // Deferred calls made by the chunks.
+							Node::current_process_thread_group = nullptr;
+							task.group->split_nodes.clear();
+						}
+					}
 				}
 			}
 
@@ -1075,6 +1181,12 @@ void SceneTree::_process(bool p_physics) {
 	if (nodes_removed_on_group_call_lock == 0) {
 		nodes_removed_on_group_call.clear();
 	}
+
+	if (process_groups_profiling && !process_groups_profile.is_empty()) {
+		process_groups_profile.push_front(p_physics ? "physics_process_groups" : "process_groups");
+		EngineDebugger::profiler_add_frame_data("servers", process_groups_profile);
+		process_groups_profile.clear();
+	}
 }
 
 bool SceneTree::ProcessGroupSort::operator()(const ProcessGroup *p_left, const ProcessGroup *p_right) const {
@@ -1167,7 +1279,7 @@ void SceneTree::_call_input_pause(const StringName &p_group, CallInputType p_cal
 	}
 
 	int gr_node_count = nodes_copy.size();
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node *const *gr_nodes = nodes_copy.ptr();
 
 	{
 		_THREAD_SAFE_METHOD_
@@ -1286,7 +1398,7 @@ TypedArray<Node> SceneTree::_get_nodes_in_group(const StringName &p_group) {
 
 	ret.resize(nc);
 
-	Node **ptr = E->value.nodes.ptrw();
+	Node *const *ptr = E->value.nodes.ptr();
 	for (int i = 0; i < nc; i++) {
 		ret[i] = ptr[i];
 	}
@@ -1294,6 +1406,29 @@ TypedArray<Node> SceneTree::_get_nodes_in_group(const StringName &p_group) {
 	return ret;
 }
 
+Vector<Node *> SceneTree::get_nodes_in_group_vector(const StringName &p_group, bool p_ordered) {
+	_THREAD_SAFE_METHOD_
+	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
+	if (!E) {
+		return Vector<Node *>();
+	}
+
+	if (p_ordered) {
+		_update_group_order(E->value);
+	}
+	return E->value.nodes;
+}
+
+int SceneTree::get_node_count_in_group(const StringName &p_group) const {
+	_THREAD_SAFE_METHOD_
+	HashMap<StringName, Group>::ConstIterator E = group_map.find(p_group);
+	if (!E) {
+		return 0;
+	}
+
+	return E->value.nodes.size();
+}
+
 bool SceneTree::has_group(const StringName &p_identifier) const {
 	_THREAD_SAFE_METHOD_
 	return group_map.has(p_identifier);
@@ -1327,7 +1462,7 @@ void SceneTree::get_nodes_in_group(const StringName &p_group, List<Node *> *p_li
 	if (nc == 0) {
 		return;
 	}
-	Node **ptr = E->value.nodes.ptrw();
+	Node *const *ptr = E->value.nodes.ptr();
 	for (int i = 0; i < nc; i++) {
 		p_list->push_back(ptr[i]);
 	}
@@ -1470,12 +1605,11 @@ Ref<Tween> SceneTree::create_tween() {
 TypedArray<Tween> SceneTree::get_processed_tweens() {
 	_THREAD_SAFE_METHOD_
 	TypedArray<Tween> ret;
-	ret.resize(tweens.size());
 
-	int i = 0;
 	for (const Ref<Tween> &tween : tweens) {
-		ret[i] = tween;
-		i++;
+		if (tween.is_valid()) {
+			ret.push_back(tween);
+		}
 	}
 
 	return ret;
@@ -1591,6 +1725,7 @@ void SceneTree::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("get_nodes_in_group", "group"), &SceneTree::_get_nodes_in_group);
 	ClassDB::bind_method(D_METHOD("get_first_node_in_group", "group"), &SceneTree::get_first_node_in_group);
+	ClassDB::bind_method(D_METHOD("get_node_count_in_group", "group"), &SceneTree::get_node_count_in_group);
 
 	ClassDB::bind_method(D_METHOD("set_current_scene", "child_node"), &SceneTree::set_current_scene);
 	ClassDB::bind_method(D_METHOD("get_current_scene"), &SceneTree::get_current_scene);
@@ -1631,6 +1766,7 @@ void SceneTree::_bind_methods() {
 	BIND_ENUM_CONSTANT(GROUP_CALL_REVERSE);
 	BIND_ENUM_CONSTANT(GROUP_CALL_DEFERRED);
 	BIND_ENUM_CONSTANT(GROUP_CALL_UNIQUE);
+	BIND_ENUM_CONSTANT(GROUP_CALL_UNORDERED);
 }
 
 SceneTree *SceneTree::singleton = nullptr;
@@ -98,6 +98,16 @@ private:
 		bool removed = false;
 		Node *owner = nullptr;
 		uint64_t last_pass = 0;
+		Vector<Node *> split_nodes; // Snapshot shared by the chunks while the group is processed split.
+	};
+
+	// One task of a threaded pass. Groups owned by a node with process_thread_group_split are divided in several.
+	struct ProcessGroupTask {
+		ProcessGroup *group = nullptr;
+		bool split = false;
+		uint32_t from = 0;
+		uint32_t to = 0;
+		uint64_t time_usec = 0;
 	};
 
 	struct ProcessGroupSort {
@@ -108,7 +118,9 @@ private:
 
 	LocalVector<ProcessGroup *> process_groups;
 	bool process_groups_dirty = true;
-	LocalVector<ProcessGroup *> local_process_group_cache; // Used when processing to group what needs to
+	LocalVector<ProcessGroupTask> local_process_group_tasks; // Used when processing to group what needs to
+	bool process_groups_profiling = false;
+	Array process_groups_profile;
 	uint64_t process_last_pass = 1;
 
 	ProcessGroup default_process_group;
@@ -193,7 +205,7 @@ private:
 	void _flush_scene_change();
 
 	List<Ref<SceneTreeTimer>> timers;
-	List<Ref<Tween>> tweens;
+	LocalVector<Ref<Tween>> tweens;
 
 	///network///
 
@@ -215,8 +227,15 @@ private:
 	void remove_from_group(const StringName &p_group, Node *p_node);
 	void make_group_changed(const StringName &p_group);
 
+	enum {
+		PROCESS_GROUP_SPLIT_MIN_NODES = 64 // Smallest chunk worth its own task.
+	};
+
+	Vector<Node *> &_sort_process_group(ProcessGroup *p_group, bool p_physics);
+	void _process_group_nodes(const Vector<Node *> &p_nodes, uint32_t p_from, uint32_t p_to, bool p_physics);
 	void _process_group(ProcessGroup *p_group, bool p_physics);
 	void _process_groups_thread(uint32_t p_index, bool p_physics);
+	void _add_process_group_profile(ProcessGroup *p_group, uint64_t p_time_usec, int p_chunk = -1);
 	void _process(bool p_physics);
 
 	void _remove_process_group(Node *p_node);
@@ -234,6 +253,8 @@ private:
 	friend class Viewport;
 
 	SelfList<Node>::List xform_change_list;
+	// Changes whenever a node may have left xform_change_list or stopped being up to date in it, see Node3D::_propagate_transform_changed().
+	uint64_t xform_propagation_pass = 1;
 
 #ifdef DEBUG_ENABLED // No live editor in release build.
 	friend class LiveEditor;
@@ -275,6 +296,7 @@ public:
 		GROUP_CALL_REVERSE = 1,
 		GROUP_CALL_DEFERRED = 2,
 		GROUP_CALL_UNIQUE = 4,
+		GROUP_CALL_UNORDERED = 8,
 	};
 
 	_FORCE_INLINE_ Window *get_root() const { return root; }
@@ -383,6 +405,9 @@ public:
 	void queue_delete(Object *p_object);
 
 	void get_nodes_in_group(const StringName &p_group, List<Node *> *p_list);
+	// Shares the storage of the group, so no copy is made unless the group changes while the result is alive.
+	Vector<Node *> get_nodes_in_group_vector(const StringName &p_group, bool p_ordered = true);
+	int get_node_count_in_group(const StringName &p_group) const;
 	Node *get_first_node_in_group(const StringName &p_group);
 	bool has_group(const StringName &p_identifier) const;
 
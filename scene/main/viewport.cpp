@@ -674,6 +674,34 @@ void Viewport::_notification(int p_what) {
 	}
 }
 
+SafeNumeric<uint64_t> Viewport::physics_picking_version;
+
+bool Viewport::_update_physics_picking_state() {
+	PhysicsPickingState state;
+	state.mouse_position = get_mouse_position();
+	state.version = physics_picking_version.get();
+	state.paused = get_tree()->is_paused();
+	for (const CanvasLayer *E : canvas_layers) {
+		state.canvas_transforms.push_back(E ? E->get_final_transform() : get_canvas_transform());
+	}
+#ifndef _3D_DISABLED
+	if (camera_3d) {
+		state.camera_transform = camera_3d->get_global_transform();
+		state.camera_id = camera_3d->get_instance_id();
+	}
+#endif // _3D_DISABLED
+
+	bool changed = state.mouse_position != physics_picking_state.mouse_position ||
+			state.version != physics_picking_state.version ||
+			state.paused != physics_picking_state.paused ||
+			state.camera_id != physics_picking_state.camera_id ||
+			state.camera_transform != physics_picking_state.camera_transform ||
+			state.canvas_transforms != physics_picking_state.canvas_transforms;
+
+	physics_picking_state = state;
+	return changed;
+}
+
 void Viewport::_process_picking() {
 	if (!is_inside_tree()) {
 		return;
@@ -692,6 +720,8 @@ void Viewport::_process_picking() {
 
 	_drop_physics_mouseover(true);
 
+	bool picking_state_changed = _update_physics_picking_state();
+
 #ifndef _3D_DISABLED
 	Vector2 last_pos(1e20, 1e20);
 	CollisionObject3D *last_object = nullptr;
@@ -719,6 +749,16 @@ void Viewport::_process_picking() {
 		}
 	}
 
+	if (create_passive_hover_event && !picking_state_changed) {
+		// Nothing moved since the last query, so the hovered objects are still the same.
+		// Bodies moved by the physics step don't notify their nodes, so only skip while none are active.
+		bool physics_active = PhysicsServer2D::get_singleton()->get_process_info(PhysicsServer2D::INFO_ACTIVE_OBJECTS) > 0;
+#ifndef _3D_DISABLED
+		physics_active = physics_active || PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_ACTIVE_OBJECTS) > 0;
+#endif // _3D_DISABLED
+		create_passive_hover_event = physics_active;
+	}
+
 	if (create_passive_hover_event) {
 		// Create a mouse motion event. This is necessary because objects or camera may have moved.
 		// While this extra event is sent, it is checked if both camera and last object and last ID did not move.
@@ -3243,7 +3283,23 @@ void Viewport::_push_unhandled_input_internal(const Ref<InputEvent> &p_event) {
 						Object::cast_to<InputEventScreenTouch>(*p_event)
 
 								)) {
-			physics_picking_events.push_back(p_event);
+			// Merge consecutive motion events, so that moving the mouse costs a single query per frame.
+			Ref<InputEventMouseMotion> mm = p_event;
+			bool merged = false;
+			if (mm.is_valid() && !physics_picking_events.is_empty()) {
+				Ref<InputEventMouseMotion> last_mm = physics_picking_events.back()->get();
+				if (last_mm.is_valid()) {
+					// The queued event may still be referenced elsewhere, so merge into a copy.
+					Ref<InputEvent> accumulated = last_mm->duplicate();
+					if (accumulated->accumulate(mm)) {
+						physics_picking_events.back()->get() = accumulated;
+						merged = true;
+					}
+				}
+			}
+			if (!merged) {
+				physics_picking_events.push_back(p_event);
+			}
 			set_input_as_handled();
 		}
 	}
@@ -4502,7 +4558,7 @@ void Viewport::_bind_methods() {
 
 #ifndef _3D_DISABLED
 	ADD_GROUP("Scaling 3D", "");
-	ADD_PROPERTY(PropertyInfo(Variant::INT, "scaling_3d_mode", PROPERTY_HINT_ENUM, "Bilinear (Fastest),FSR 1.0 (Fast)"), "set_scaling_3d_mode", "get_scaling_3d_mode");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "scaling_3d_mode", PROPERTY_HINT_ENUM, "Bilinear (Fastest),FSR 1.0 (Fast),Temporal (Average)"), "set_scaling_3d_mode", "get_scaling_3d_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "scaling_3d_scale", PROPERTY_HINT_RANGE, "0.25,2.0,0.01"), "set_scaling_3d_scale", "get_scaling_3d_scale");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "texture_mipmap_bias", PROPERTY_HINT_RANGE, "-2,2,0.001"), "set_texture_mipmap_bias", "get_texture_mipmap_bias");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "fsr_sharpness", PROPERTY_HINT_RANGE, "0,2,0.1"), "set_fsr_sharpness", "get_fsr_sharpness");
@@ -4553,6 +4609,7 @@ void Viewport::_bind_methods() {
 
 	BIND_ENUM_CONSTANT(SCALING_3D_MODE_BILINEAR);
 	BIND_ENUM_CONSTANT(SCALING_3D_MODE_FSR);
+	BIND_ENUM_CONSTANT(SCALING_3D_MODE_TEMPORAL);
 	BIND_ENUM_CONSTANT(SCALING_3D_MODE_MAX);
 
 	BIND_ENUM_CONSTANT(MSAA_DISABLED);
@@ -98,6 +98,7 @@ public:
 	enum Scaling3DMode {
 		SCALING_3D_MODE_BILINEAR,
 		SCALING_3D_MODE_FSR,
+		SCALING_3D_MODE_TEMPORAL,
 		SCALING_3D_MODE_MAX
 	};
 
@@ -261,6 +262,20 @@ private:
 	Transform3D physics_last_camera_transform;
 	ObjectID physics_last_id;
 
+	// Inputs of the last picking pass, the passive hover query is skipped while none of them change.
+	struct PhysicsPickingState {
+		Vector2 mouse_position;
+		Transform3D camera_transform;
+		ObjectID camera_id;
+		Vector<Transform2D> canvas_transforms;
+		uint64_t version = 0;
+		bool paused = false;
+	};
+	PhysicsPickingState physics_picking_state;
+	static SafeNumeric<uint64_t> physics_picking_version;
+
+	bool _update_physics_picking_state();
+
 	bool handle_input_locally = true;
 	bool local_input_handled = false;
 
@@ -492,6 +507,8 @@ protected:
 public:
 	void canvas_parent_mark_dirty(Node *p_node);
 
+	static void _physics_picking_changed() { physics_picking_version.increment(); }
+
 	uint64_t get_processed_events_count() const { return event_count; }
 
 	AudioListener2D *get_audio_listener_2d() const;
@@ -135,6 +135,7 @@
 #include "scene/main/missing_node.h"
 #include "scene/main/multiplayer_api.h"
 #include "scene/main/resource_preloader.h"
+#include "scene/main/scene_pool.h"
 #include "scene/main/scene_tree.h"
 #include "scene/main/timer.h"
 #include "scene/main/viewport.h"
@@ -604,115 +605,117 @@ void register_scene_types() {
 	GDREGISTER_CLASS(ShaderInclude);
 	GDREGISTER_ABSTRACT_CLASS(VisualShaderNode);
 	GDREGISTER_CLASS(VisualShaderNodeCustom);
-	GDREGISTER_CLASS(VisualShaderNodeInput);
+	// Most visual shader nodes are only needed when loading or editing a visual shader, so they are bound on first use.
+	// The output nodes are created directly by VisualShader, possibly on loading threads.
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeInput);
 	GDREGISTER_ABSTRACT_CLASS(VisualShaderNodeOutput);
 	GDREGISTER_ABSTRACT_CLASS(VisualShaderNodeResizableBase);
 	GDREGISTER_ABSTRACT_CLASS(VisualShaderNodeGroupBase);
 	GDREGISTER_ABSTRACT_CLASS(VisualShaderNodeConstant);
 	GDREGISTER_ABSTRACT_CLASS(VisualShaderNodeVectorBase);
-	GDREGISTER_CLASS(VisualShaderNodeComment);
-	GDREGISTER_CLASS(VisualShaderNodeFloatConstant);
-	GDREGISTER_CLASS(VisualShaderNodeIntConstant);
-	GDREGISTER_CLASS(VisualShaderNodeUIntConstant);
-	GDREGISTER_CLASS(VisualShaderNodeBooleanConstant);
-	GDREGISTER_CLASS(VisualShaderNodeColorConstant);
-	GDREGISTER_CLASS(VisualShaderNodeVec2Constant);
-	GDREGISTER_CLASS(VisualShaderNodeVec3Constant);
-	GDREGISTER_CLASS(VisualShaderNodeVec4Constant);
-	GDREGISTER_CLASS(VisualShaderNodeTransformConstant);
-	GDREGISTER_CLASS(VisualShaderNodeFloatOp);
-	GDREGISTER_CLASS(VisualShaderNodeIntOp);
-	GDREGISTER_CLASS(VisualShaderNodeUIntOp);
-	GDREGISTER_CLASS(VisualShaderNodeVectorOp);
-	GDREGISTER_CLASS(VisualShaderNodeColorOp);
-	GDREGISTER_CLASS(VisualShaderNodeTransformOp);
-	GDREGISTER_CLASS(VisualShaderNodeTransformVecMult);
-	GDREGISTER_CLASS(VisualShaderNodeFloatFunc);
-	GDREGISTER_CLASS(VisualShaderNodeIntFunc);
-	GDREGISTER_CLASS(VisualShaderNodeUIntFunc);
-	GDREGISTER_CLASS(VisualShaderNodeVectorFunc);
-	GDREGISTER_CLASS(VisualShaderNodeColorFunc);
-	GDREGISTER_CLASS(VisualShaderNodeTransformFunc);
-	GDREGISTER_CLASS(VisualShaderNodeUVFunc);
-	GDREGISTER_CLASS(VisualShaderNodeUVPolarCoord);
-	GDREGISTER_CLASS(VisualShaderNodeDotProduct);
-	GDREGISTER_CLASS(VisualShaderNodeVectorLen);
-	GDREGISTER_CLASS(VisualShaderNodeDeterminant);
-	GDREGISTER_CLASS(VisualShaderNodeDerivativeFunc);
-	GDREGISTER_CLASS(VisualShaderNodeClamp);
-	GDREGISTER_CLASS(VisualShaderNodeFaceForward);
-	GDREGISTER_CLASS(VisualShaderNodeOuterProduct);
-	GDREGISTER_CLASS(VisualShaderNodeSmoothStep);
-	GDREGISTER_CLASS(VisualShaderNodeStep);
-	GDREGISTER_CLASS(VisualShaderNodeVectorDistance);
-	GDREGISTER_CLASS(VisualShaderNodeVectorRefract);
-	GDREGISTER_CLASS(VisualShaderNodeMix);
-	GDREGISTER_CLASS(VisualShaderNodeVectorCompose);
-	GDREGISTER_CLASS(VisualShaderNodeTransformCompose);
-	GDREGISTER_CLASS(VisualShaderNodeVectorDecompose);
-	GDREGISTER_CLASS(VisualShaderNodeTransformDecompose);
-	GDREGISTER_CLASS(VisualShaderNodeTexture);
-	GDREGISTER_CLASS(VisualShaderNodeCurveTexture);
-	GDREGISTER_CLASS(VisualShaderNodeCurveXYZTexture);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeComment);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeFloatConstant);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeIntConstant);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeUIntConstant);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeBooleanConstant);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeColorConstant);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeVec2Constant);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeVec3Constant);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeVec4Constant);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeTransformConstant);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeFloatOp);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeIntOp);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeUIntOp);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeVectorOp);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeColorOp);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeTransformOp);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeTransformVecMult);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeFloatFunc);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeIntFunc);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeUIntFunc);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeVectorFunc);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeColorFunc);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeTransformFunc);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeUVFunc);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeUVPolarCoord);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeDotProduct);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeVectorLen);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeDeterminant);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeDerivativeFunc);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeClamp);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeFaceForward);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeOuterProduct);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeSmoothStep);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeStep);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeVectorDistance);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeVectorRefract);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeMix);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeVectorCompose);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeTransformCompose);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeVectorDecompose);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeTransformDecompose);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeTexture);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeCurveTexture);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeCurveXYZTexture);
 	GDREGISTER_ABSTRACT_CLASS(VisualShaderNodeSample3D);
-	GDREGISTER_CLASS(VisualShaderNodeTexture2DArray);
-	GDREGISTER_CLASS(VisualShaderNodeTexture3D);
-	GDREGISTER_CLASS(VisualShaderNodeCubemap);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeTexture2DArray);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeTexture3D);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeCubemap);
 	GDREGISTER_ABSTRACT_CLASS(VisualShaderNodeParameter);
-	GDREGISTER_CLASS(VisualShaderNodeParameterRef);
-	GDREGISTER_CLASS(VisualShaderNodeFloatParameter);
-	GDREGISTER_CLASS(VisualShaderNodeIntParameter);
-	GDREGISTER_CLASS(VisualShaderNodeUIntParameter);
-	GDREGISTER_CLASS(VisualShaderNodeBooleanParameter);
-	GDREGISTER_CLASS(VisualShaderNodeColorParameter);
-	GDREGISTER_CLASS(VisualShaderNodeVec2Parameter);
-	GDREGISTER_CLASS(VisualShaderNodeVec3Parameter);
-	GDREGISTER_CLASS(VisualShaderNodeVec4Parameter);
-	GDREGISTER_CLASS(VisualShaderNodeTransformParameter);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeParameterRef);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeFloatParameter);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeIntParameter);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeUIntParameter);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeBooleanParameter);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeColorParameter);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeVec2Parameter);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeVec3Parameter);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeVec4Parameter);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeTransformParameter);
 	GDREGISTER_ABSTRACT_CLASS(VisualShaderNodeTextureParameter);
-	GDREGISTER_CLASS(VisualShaderNodeTexture2DParameter);
-	GDREGISTER_CLASS(VisualShaderNodeTextureParameterTriplanar);
-	GDREGISTER_CLASS(VisualShaderNodeTexture2DArrayParameter);
-	GDREGISTER_CLASS(VisualShaderNodeTexture3DParameter);
-	GDREGISTER_CLASS(VisualShaderNodeCubemapParameter);
-	GDREGISTER_CLASS(VisualShaderNodeLinearSceneDepth);
-	GDREGISTER_CLASS(VisualShaderNodeWorldPositionFromDepth);
-	GDREGISTER_CLASS(VisualShaderNodeScreenNormalWorldSpace);
-	GDREGISTER_CLASS(VisualShaderNodeIf);
-	GDREGISTER_CLASS(VisualShaderNodeSwitch);
-	GDREGISTER_CLASS(VisualShaderNodeFresnel);
-	GDREGISTER_CLASS(VisualShaderNodeExpression);
-	GDREGISTER_CLASS(VisualShaderNodeGlobalExpression);
-	GDREGISTER_CLASS(VisualShaderNodeIs);
-	GDREGISTER_CLASS(VisualShaderNodeCompare);
-	GDREGISTER_CLASS(VisualShaderNodeMultiplyAdd);
-	GDREGISTER_CLASS(VisualShaderNodeBillboard);
-	GDREGISTER_CLASS(VisualShaderNodeDistanceFade);
-	GDREGISTER_CLASS(VisualShaderNodeProximityFade);
-	GDREGISTER_CLASS(VisualShaderNodeRandomRange);
-	GDREGISTER_CLASS(VisualShaderNodeRemap);
-	GDREGISTER_CLASS(VisualShaderNodeRotationByAxis);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeTexture2DParameter);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeTextureParameterTriplanar);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeTexture2DArrayParameter);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeTexture3DParameter);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeCubemapParameter);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeLinearSceneDepth);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeWorldPositionFromDepth);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeScreenNormalWorldSpace);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeIf);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeSwitch);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeFresnel);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeExpression);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeGlobalExpression);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeIs);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeCompare);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeMultiplyAdd);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeBillboard);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeDistanceFade);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeProximityFade);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeRandomRange);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeRemap);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeRotationByAxis);
 	GDREGISTER_ABSTRACT_CLASS(VisualShaderNodeVarying);
-	GDREGISTER_CLASS(VisualShaderNodeVaryingSetter);
-	GDREGISTER_CLASS(VisualShaderNodeVaryingGetter);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeVaryingSetter);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeVaryingGetter);
 
-	GDREGISTER_CLASS(VisualShaderNodeSDFToScreenUV);
-	GDREGISTER_CLASS(VisualShaderNodeScreenUVToSDF);
-	GDREGISTER_CLASS(VisualShaderNodeTextureSDF);
-	GDREGISTER_CLASS(VisualShaderNodeTextureSDFNormal);
-	GDREGISTER_CLASS(VisualShaderNodeSDFRaymarch);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeSDFToScreenUV);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeScreenUVToSDF);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeTextureSDF);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeTextureSDFNormal);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeSDFRaymarch);
 
 	GDREGISTER_CLASS(VisualShaderNodeParticleOutput);
 	GDREGISTER_ABSTRACT_CLASS(VisualShaderNodeParticleEmitter);
-	GDREGISTER_CLASS(VisualShaderNodeParticleSphereEmitter);
-	GDREGISTER_CLASS(VisualShaderNodeParticleBoxEmitter);
-	GDREGISTER_CLASS(VisualShaderNodeParticleRingEmitter);
-	GDREGISTER_CLASS(VisualShaderNodeParticleMeshEmitter);
-	GDREGISTER_CLASS(VisualShaderNodeParticleMultiplyByAxisAngle);
-	GDREGISTER_CLASS(VisualShaderNodeParticleConeVelocity);
-	GDREGISTER_CLASS(VisualShaderNodeParticleRandomness);
-	GDREGISTER_CLASS(VisualShaderNodeParticleAccelerator);
-	GDREGISTER_CLASS(VisualShaderNodeParticleEmit);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeParticleSphereEmitter);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeParticleBoxEmitter);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeParticleRingEmitter);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeParticleMeshEmitter);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeParticleMultiplyByAxisAngle);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeParticleConeVelocity);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeParticleRandomness);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeParticleAccelerator);
+	GDREGISTER_LAZY_CLASS(VisualShaderNodeParticleEmit);
 
 	GDREGISTER_VIRTUAL_CLASS(Material);
 	GDREGISTER_CLASS(PlaceholderMaterial);
@@ -967,6 +970,7 @@ void register_scene_types() {
 
 	GDREGISTER_ABSTRACT_CLASS(SceneState);
 	GDREGISTER_CLASS(PackedScene);
+	GDREGISTER_CLASS(ScenePool);
 
 	GDREGISTER_CLASS(SceneTree);
 	GDREGISTER_ABSTRACT_CLASS(SceneTreeTimer); // sorry, you can't create it
@@ -1217,10 +1221,12 @@ void unregister_scene_types() {
 	PhysicalSkyMaterial::cleanup_shader();
 	PanoramaSkyMaterial::cleanup_shader();
 	ProceduralSkyMaterial::cleanup_shader();
+	ImporterMesh::clear_lod_cache();
 #endif // _3D_DISABLED
 
 	ParticleProcessMaterial::finish_shaders();
 	CanvasItemMaterial::finish_shaders();
+	HTTPRequest::clear_connection_pool();
 	ColorPicker::finish_shaders();
 	SceneStringNames::free();
 }
@@ -5151,13 +5151,18 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 
 	double frame_to_sec = 1.0 / double(compression.fps);
 
-	int32_t page_index = -1;
-	for (uint32_t i = 0; i < compression.pages.size(); i++) {
-		if (compression.pages[i].time_offset > p_time) {
-			break;
+	// Last page starting before p_time, pages are sorted by time. This runs for every track sampled, so search instead of scanning.
+	uint32_t page_low = 0;
+	uint32_t page_high = compression.pages.size();
+	while (page_low < page_high) {
+		uint32_t middle = (page_low + page_high) / 2;
+		if (compression.pages[middle].time_offset > p_time) {
+			page_high = middle;
+		} else {
+			page_low = middle + 1;
 		}
-		page_index = i;
 	}
+	int32_t page_index = int32_t(page_low) - 1;
 
 	ERR_FAIL_COND_V(page_index == -1, false); //should not happen
 
@@ -5172,21 +5177,39 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 	double packet_time = double(time_keys[0]) * frame_to_sec + page_base_time;
 	uint32_t base_frame = time_keys[0];
 
-	for (uint32_t i = 1; i < time_key_count; i++) {
-		uint32_t f = time_keys[i * 2 + 0];
-		double frame_time = double(f) * frame_to_sec + page_base_time;
+	if (key_index) {
+		// The key index counts the keys of all the packets before, so they need to be visited anyway.
+		for (uint32_t i = 1; i < time_key_count; i++) {
+			uint32_t f = time_keys[i * 2 + 0];
+			double frame_time = double(f) * frame_to_sec + page_base_time;
 
-		if (frame_time > p_time) {
-			break;
-		}
+			if (frame_time > p_time) {
+				break;
+			}
 
-		if (key_index) {
 			(*key_index) += (time_keys[(i - 1) * 2 + 1] >> 12) + 1;
-		}
 
-		packet_idx = i;
-		packet_time = frame_time;
-		base_frame = f;
+			packet_idx = i;
+			packet_time = frame_time;
+			base_frame = f;
+		}
+	} else {
+		// Last packet starting before p_time, packets are sorted by frame.
+		uint32_t packet_low = 1;
+		uint32_t packet_high = time_key_count;
+		while (packet_low < packet_high) {
+			uint32_t middle = (packet_low + packet_high) / 2;
+			if (double(time_keys[middle * 2 + 0]) * frame_to_sec + page_base_time > p_time) {
+				packet_high = middle;
+			} else {
+				packet_low = middle + 1;
+			}
+		}
+		if (packet_low > 1) {
+			packet_idx = packet_low - 1;
+			base_frame = time_keys[packet_idx * 2 + 0];
+			packet_time = double(base_frame) * frame_to_sec + page_base_time;
+		}
 	}
 
 	const uint8_t *data_keys_base = (const uint8_t *)&page_data[indices[p_compressed_track * 3 + 2]];
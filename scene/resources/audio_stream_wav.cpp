@@ -222,8 +222,21 @@ void AudioStreamPlaybackWAV::do_resample(const Depth *p_src, AudioFrame *p_dst,
 }
 
 int AudioStreamPlaybackWAV::mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames) {
+	return _mix(p_buffer, p_rate_scale, p_frames);
+}
+
+int AudioStreamPlaybackWAV::skip(float p_rate_scale, int p_frames) {
+	if (base->format == AudioStreamWAV::FORMAT_IMA_ADPCM) {
+		// The decoder state depends on all previous samples, so it can't jump forward.
+		return AudioStreamPlayback::skip(p_rate_scale, p_frames);
+	}
+	return _mix(nullptr, p_rate_scale, p_frames);
+}
+
+// Without a buffer, only the position moves forward (this is not supported for IMA ADPCM).
+int AudioStreamPlaybackWAV::_mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames) {
 	if (!base->data || !active) {
-		for (int i = 0; i < p_frames; i++) {
+		for (int i = 0; p_buffer && i < p_frames; i++) {
 			p_buffer[i] = AudioFrame(0, 0);
 		}
 		return 0;
@@ -365,6 +378,11 @@ int AudioStreamPlaybackWAV::mix(AudioFrame *p_buffer, float p_rate_scale, int p_
 
 		todo -= target;
 
+		if (!dst_buff) {
+			offset += int64_t(increment) * target;
+			continue;
+		}
+
 		switch (base->format) {
 			case AudioStreamWAV::FORMAT_8_BITS: {
 				if (is_stereo) {
@@ -398,7 +416,7 @@ int AudioStreamPlaybackWAV::mix(AudioFrame *p_buffer, float p_rate_scale, int p_
 		int mixed_frames = p_frames - todo;
 		//bit was missing from mix
 		int todo_ofs = p_frames - todo;
-		for (int i = todo_ofs; i < p_frames; i++) {
+		for (int i = todo_ofs; p_buffer && i < p_frames; i++) {
 			p_buffer[i] = AudioFrame(0, 0);
 		}
 		return mixed_frames;
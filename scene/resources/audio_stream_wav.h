@@ -63,6 +63,8 @@ class AudioStreamPlaybackWAV : public AudioStreamPlayback {
 	template <class Depth, bool is_stereo, bool is_ima_adpcm>
 	void do_resample(const Depth *p_src, AudioFrame *p_dst, int64_t &p_offset, int32_t &p_increment, uint32_t p_amount, IMA_ADPCM_State *p_ima_adpcm);
 
+	int _mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames);
+
 public:
 	virtual void start(double p_from_pos = 0.0) override;
 	virtual void stop() override;
@@ -74,6 +76,7 @@ public:
 	virtual void seek(double p_time) override;
 
 	virtual int mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames) override;
+	virtual int skip(float p_rate_scale, int p_frames) override;
 
 	virtual void tag_used_streams() override;
 
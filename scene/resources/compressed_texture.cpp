@@ -30,9 +30,10 @@
 
 #include "compressed_texture.h"
 
+#include "core/config/project_settings.h"
 #include "scene/resources/bit_map.h"
 
-Error CompressedTexture2D::_load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit) {
+Error CompressedTexture2D::_load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, bool &r_streamable, int p_size_limit) {
 	alpha_cache.unref();
 
 	ERR_FAIL_COND_V(image.is_null(), ERR_INVALID_PARAMETER);
@@ -75,7 +76,17 @@ Error CompressedTexture2D::_load_data(const String &p_path, int &r_width, int &r
 	r_request_normal = false;
 
 #endif
-	if (!(df & FORMAT_BIT_STREAM)) {
+
+	// Peek at the image header, only mipmapped VRAM compressed data can be loaded partially.
+	uint64_t image_position = f->get_position();
+	uint32_t data_format = f->get_32();
+	f->get_32(); // Width and height.
+	uint32_t mipmaps = f->get_32();
+	Image::Format image_format = Image::Format(f->get_32());
+	f->seek(image_position);
+
+	r_streamable = (df & FORMAT_BIT_HAS_MIPMAPS) && data_format == DATA_FORMAT_IMAGE && mipmaps > 0 && image_format > Image::FORMAT_RGBE9995;
+	if (!r_streamable) {
 		p_size_limit = 0;
 	}
 
@@ -88,6 +99,52 @@ Error CompressedTexture2D::_load_data(const String &p_path, int &r_width, int &r
 	return OK;
 }
 
+void CompressedTexture2D::_update_texture_settings() {
+	// Needed again every time the texture is replaced.
+	if (w || h) {
+		RS::get_singleton()->texture_set_size_override(texture, w, h);
+	}
+
+	if (!get_path().is_empty()) {
+		RenderingServer::get_singleton()->texture_set_path(texture, get_path());
+	} else {
+		//temporarily set path if no path set for resource, helps find errors
+		RenderingServer::get_singleton()->texture_set_path(texture, path_to_file);
+	}
+
+#ifdef TOOLS_ENABLED
+
+	if (request_3d) {
+		//print_line("request detect 3D at " + p_path);
+		RS::get_singleton()->texture_set_detect_3d_callback(texture, _requested_3d, this);
+	} else {
+		//print_line("not requesting detect 3D at " + p_path);
+		RS::get_singleton()->texture_set_detect_3d_callback(texture, nullptr, nullptr);
+	}
+
+	if (request_roughness) {
+		//print_line("request detect srgb at " + p_path);
+		RS::get_singleton()->texture_set_detect_roughness_callback(texture, _requested_roughness, this);
+	} else {
+		//print_line("not requesting detect srgb at " + p_path);
+		RS::get_singleton()->texture_set_detect_roughness_callback(texture, nullptr, nullptr);
+	}
+
+	if (request_normal) {
+		//print_line("request detect srgb at " + p_path);
+		RS::get_singleton()->texture_set_detect_normal_callback(texture, _requested_normal, this);
+	} else {
+		//print_line("not requesting detect normal at " + p_path);
+		RS::get_singleton()->texture_set_detect_normal_callback(texture, nullptr, nullptr);
+	}
+
+#endif
+
+	if (streamed) {
+		RS::get_singleton()->texture_set_stream_callback(texture, _requested_stream, this);
+	}
+}
+
 void CompressedTexture2D::set_path(const String &p_path, bool p_take_over) {
 	if (texture.is_valid()) {
 		RenderingServer::get_singleton()->texture_set_path(texture, p_path);
@@ -117,6 +174,77 @@ void CompressedTexture2D::_requested_normal(void *p_ud) {
 	request_normal_callback(ctex);
 }
 
+void CompressedTexture2D::_requested_stream(void *p_ud, int p_size) {
+	// May be called from the rendering thread, loading always starts on the main thread.
+	CompressedTexture2D *ct = (CompressedTexture2D *)p_ud;
+	callable_mp(ct, &CompressedTexture2D::_stream_requested).call_deferred(p_size);
+}
+
+void CompressedTexture2D::_stream_load_task(void *p_userdata) {
+	StreamLoad *load = (StreamLoad *)p_userdata;
+
+	Ref<Image> image;
+	Ref<FileAccess> f = FileAccess::open(load->path, FileAccess::READ);
+	if (f.is_valid()) {
+		f->seek(36); // Skip the file header, it was already validated when loading.
+		image = load_image_from_file(f, load->size);
+	}
+
+	callable_mp(load->texture, &CompressedTexture2D::_stream_loaded).call_deferred(image, load->size, load->generation);
+	memdelete(load);
+}
+
+void CompressedTexture2D::_stream_wait() {
+	if (stream_task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(stream_task);
+		stream_task = WorkerThreadPool::INVALID_TASK_ID;
+	}
+}
+
+void CompressedTexture2D::_stream_requested(int p_size) {
+	if (!streamed || !texture.is_valid()) {
+		return;
+	}
+
+	if (stream_task != WorkerThreadPool::INVALID_TASK_ID) {
+		stream_pending_size = p_size; // Picked up once the current load finishes.
+		return;
+	}
+
+	if (p_size == stream_size) {
+		return;
+	}
+
+	StreamLoad *load = memnew(StreamLoad);
+	load->texture = this;
+	load->path = path_to_file;
+	load->size = p_size;
+	load->generation = stream_generation;
+	stream_task = WorkerThreadPool::get_singleton()->add_native_task(&CompressedTexture2D::_stream_load_task, load, false, "Stream texture " + path_to_file);
+}
+
+void CompressedTexture2D::_stream_loaded(const Ref<Image> &p_image, int p_size, uint32_t p_generation) {
+	if (p_generation != stream_generation) {
+		return; // Reloaded since this was requested.
+	}
+
+	_stream_wait();
+
+	if (p_image.is_valid() && !p_image->is_empty() && p_image->get_format() == format) {
+		RID new_texture = RS::get_singleton()->texture_2d_create(p_image);
+		RS::get_singleton()->texture_replace(texture, new_texture);
+		stream_size = p_size;
+		alpha_cache.unref();
+		_update_texture_settings();
+	}
+
+	if (stream_pending_size >= 0) {
+		int size = stream_pending_size;
+		stream_pending_size = -1;
+		_stream_requested(size);
+	}
+}
+
 CompressedTexture2D::TextureFormatRequestCallback CompressedTexture2D::request_3d_callback = nullptr;
 CompressedTexture2D::TextureFormatRoughnessRequestCallback CompressedTexture2D::request_roughness_callback = nullptr;
 CompressedTexture2D::TextureFormatRequestCallback CompressedTexture2D::request_normal_callback = nullptr;
@@ -130,63 +258,47 @@ Error CompressedTexture2D::load(const String &p_path) {
 	Ref<Image> image;
 	image.instantiate();
 
-	bool request_3d;
-	bool request_normal;
-	bool request_roughness;
+	bool r_3d;
+	bool r_normal;
+	bool r_roughness;
 	int mipmap_limit;
+	bool streamable;
 
-	Error err = _load_data(p_path, lw, lh, image, request_3d, request_normal, request_roughness, mipmap_limit);
+	// Streamed textures start with their smallest mips, the rest are loaded once they are seen up close.
+	int size_limit = 0;
+	if (GLOBAL_GET("rendering/textures/streaming/enabled")) {
+		size_limit = GLOBAL_GET("rendering/textures/streaming/minimum_size");
+	}
+
+	Error err = _load_data(p_path, lw, lh, image, r_3d, r_normal, r_roughness, mipmap_limit, streamable, size_limit);
 	if (err) {
 		return err;
 	}
 
+	// Results of an in-flight stream load belong to the previous data.
+	_stream_wait();
+	stream_generation++;
+	stream_pending_size = -1;
+	streamed = streamable && size_limit > 0;
+	stream_size = streamed ? size_limit : 0;
+
 	if (texture.is_valid()) {
 		RID new_texture = RS::get_singleton()->texture_2d_create(image);
 		RS::get_singleton()->texture_replace(texture, new_texture);
 	} else {
 		texture = RS::get_singleton()->texture_2d_create(image);
 	}
-	if (lw || lh) {
-		RS::get_singleton()->texture_set_size_override(texture, lw, lh);
-	}
 
 	w = lw;
 	h = lh;
 	path_to_file = p_path;
 	format = image->get_format();
+	request_3d = r_3d;
+	request_normal = r_normal;
+	request_roughness = r_roughness;
 
-	if (get_path().is_empty()) {
-		//temporarily set path if no path set for resource, helps find errors
-		RenderingServer::get_singleton()->texture_set_path(texture, p_path);
-	}
+	_update_texture_settings();
 
-#ifdef TOOLS_ENABLED
-
-	if (request_3d) {
-		//print_line("request detect 3D at " + p_path);
-		RS::get_singleton()->texture_set_detect_3d_callback(texture, _requested_3d, this);
-	} else {
-		//print_line("not requesting detect 3D at " + p_path);
-		RS::get_singleton()->texture_set_detect_3d_callback(texture, nullptr, nullptr);
-	}
-
-	if (request_roughness) {
-		//print_line("request detect srgb at " + p_path);
-		RS::get_singleton()->texture_set_detect_roughness_callback(texture, _requested_roughness, this);
-	} else {
-		//print_line("not requesting detect srgb at " + p_path);
-		RS::get_singleton()->texture_set_detect_roughness_callback(texture, nullptr, nullptr);
-	}
-
-	if (request_normal) {
-		//print_line("request detect srgb at " + p_path);
-		RS::get_singleton()->texture_set_detect_normal_callback(texture, _requested_normal, this);
-	} else {
-		//print_line("not requesting detect normal at " + p_path);
-		RS::get_singleton()->texture_set_detect_normal_callback(texture, nullptr, nullptr);
-	}
-
-#endif
 	notify_property_list_changed();
 	emit_changed();
 	return OK;
@@ -326,18 +438,29 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 				continue;
 			}
 
-			Vector<uint8_t> pv;
-			pv.resize(size);
-			{
-				uint8_t *wr = pv.ptrw();
-				f->get_buffer(wr, size);
-			}
-
 			Ref<Image> img;
-			if (data_format == DATA_FORMAT_PNG && Image::png_unpacker) {
-				img = Image::png_unpacker(pv);
-			} else if (data_format == DATA_FORMAT_WEBP && Image::webp_unpacker) {
-				img = Image::webp_unpacker(pv);
+			const uint8_t *mapped = f->map_range(size);
+			if (mapped) {
+				// Decode from the mapped file directly, the unpackers only differ by checking Godot's "PNG " prefix.
+				if (data_format == DATA_FORMAT_PNG && Image::_png_mem_loader_func) {
+					ERR_FAIL_COND_V(size < 4 || mapped[0] != 'P' || mapped[1] != 'N' || mapped[2] != 'G' || mapped[3] != ' ', Ref<Image>());
+					img = Image::_png_mem_loader_func(mapped + 4, size - 4);
+				} else if (data_format == DATA_FORMAT_WEBP && Image::_webp_mem_loader_func) {
+					img = Image::_webp_mem_loader_func(mapped, size);
+				}
+			} else {
+				Vector<uint8_t> pv;
+				pv.resize(size);
+				{
+					uint8_t *wr = pv.ptrw();
+					f->get_buffer(wr, size);
+				}
+
+				if (data_format == DATA_FORMAT_PNG && Image::png_unpacker) {
+					img = Image::png_unpacker(pv);
+				} else if (data_format == DATA_FORMAT_WEBP && Image::webp_unpacker) {
+					img = Image::webp_unpacker(pv);
+				}
 			}
 
 			if (img.is_null() || img->is_empty()) {
@@ -404,14 +527,19 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 			f->seek(f->get_position() + size);
 			return Ref<Image>();
 		}
-		Vector<uint8_t> pv;
-		pv.resize(size);
-		{
-			uint8_t *wr = pv.ptrw();
-			f->get_buffer(wr, size);
-		}
 		Ref<Image> img;
-		img = Image::basis_universal_unpacker(pv);
+		const uint8_t *mapped = f->map_range(size);
+		if (mapped) {
+			img = Image::basis_universal_unpacker_ptr(mapped, size);
+		} else {
+			Vector<uint8_t> pv;
+			pv.resize(size);
+			{
+				uint8_t *wr = pv.ptrw();
+				f->get_buffer(wr, size);
+			}
+			img = Image::basis_universal_unpacker(pv);
+		}
 		if (img.is_null() || img->is_empty()) {
 			ERR_FAIL_COND_V(img.is_null() || img->is_empty(), Ref<Image>());
 		}
@@ -421,18 +549,18 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 		return img;
 	} else if (data_format == DATA_FORMAT_IMAGE) {
 		int size = Image::get_image_data_size(w, h, format, mipmaps ? true : false);
+		uint64_t data_position = f->get_position();
 
 		for (uint32_t i = 0; i < mipmaps + 1; i++) {
 			int tw, th;
 			int ofs = Image::get_image_mipmap_offset_and_dimensions(w, h, format, i, tw, th);
 
-			if (p_size_limit > 0 && i < mipmaps && (p_size_limit > tw || p_size_limit > th)) {
-				if (ofs) {
-					f->seek(f->get_position() + ofs);
-				}
+			if (p_size_limit > 0 && i < mipmaps && (tw > p_size_limit || th > p_size_limit)) {
 				continue; //oops, size limit enforced, go to next
 			}
 
+			f->seek(data_position + ofs);
+
 			Vector<uint8_t> data;
 			data.resize(size - ofs);
 
@@ -460,6 +588,7 @@ void CompressedTexture2D::_bind_methods() {
 CompressedTexture2D::CompressedTexture2D() {}
 
 CompressedTexture2D::~CompressedTexture2D() {
+	_stream_wait();
 	if (texture.is_valid()) {
 		ERR_FAIL_NULL(RenderingServer::get_singleton());
 		RS::get_singleton()->free(texture);
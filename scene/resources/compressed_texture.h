@@ -31,6 +31,7 @@
 #ifndef COMPRESSED_TEXTURE_H
 #define COMPRESSED_TEXTURE_H
 
+#include "core/object/worker_thread_pool.h"
 #include "scene/resources/texture.h"
 
 class BitMap;
@@ -67,13 +68,38 @@ private:
 	int h = 0;
 	mutable Ref<BitMap> alpha_cache;
 
-	Error _load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit = 0);
+	bool request_3d = false;
+	bool request_normal = false;
+	bool request_roughness = false;
+
+	// Streaming, only mipmapped VRAM compressed images are streamed.
+	struct StreamLoad {
+		CompressedTexture2D *texture = nullptr;
+		String path;
+		int size = 0;
+		uint32_t generation = 0;
+	};
+
+	bool streamed = false;
+	int stream_size = 0; // Largest resident mip dimension, 0 when fully loaded.
+	int stream_pending_size = -1;
+	uint32_t stream_generation = 0;
+	WorkerThreadPool::TaskID stream_task = WorkerThreadPool::INVALID_TASK_ID;
+
+	Error _load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, bool &r_streamable, int p_size_limit = 0);
+	void _update_texture_settings();
 	virtual void reload_from_file() override;
 
 	static void _requested_3d(void *p_ud);
 	static void _requested_roughness(void *p_ud, const String &p_normal_path, RS::TextureDetectRoughnessChannel p_roughness_channel);
 	static void _requested_normal(void *p_ud);
 
+	static void _requested_stream(void *p_ud, int p_size);
+	static void _stream_load_task(void *p_userdata);
+	void _stream_wait();
+	void _stream_requested(int p_size);
+	void _stream_loaded(const Ref<Image> &p_image, int p_size, uint32_t p_generation);
+
 protected:
 	static void _bind_methods();
 	void _validate_property(PropertyInfo &p_property) const;
@@ -960,6 +960,15 @@ float Environment::get_volumetric_fog_temporal_reprojection_amount() const {
 	return volumetric_fog_temporal_reproject_amount;
 }
 
+void Environment::set_volumetric_fog_resolution(VolumetricFogResolution p_resolution) {
+	volumetric_fog_resolution = p_resolution;
+	RS::get_singleton()->environment_set_volumetric_fog_resolution(environment, RS::EnvironmentVolumetricFogResolution(p_resolution));
+}
+
+Environment::VolumetricFogResolution Environment::get_volumetric_fog_resolution() const {
+	return volumetric_fog_resolution;
+}
+
 // Adjustment
 
 void Environment::set_adjustment_enabled(bool p_enabled) {
@@ -1437,6 +1446,8 @@ void Environment::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_volumetric_fog_temporal_reprojection_enabled"), &Environment::is_volumetric_fog_temporal_reprojection_enabled);
 	ClassDB::bind_method(D_METHOD("set_volumetric_fog_temporal_reprojection_amount", "temporal_reprojection_amount"), &Environment::set_volumetric_fog_temporal_reprojection_amount);
 	ClassDB::bind_method(D_METHOD("get_volumetric_fog_temporal_reprojection_amount"), &Environment::get_volumetric_fog_temporal_reprojection_amount);
+	ClassDB::bind_method(D_METHOD("set_volumetric_fog_resolution", "resolution"), &Environment::set_volumetric_fog_resolution);
+	ClassDB::bind_method(D_METHOD("get_volumetric_fog_resolution"), &Environment::get_volumetric_fog_resolution);
 
 	ADD_GROUP("Volumetric Fog", "volumetric_fog_");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "volumetric_fog_enabled"), "set_volumetric_fog_enabled", "is_volumetric_fog_enabled");
@@ -1450,6 +1461,7 @@ void Environment::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "volumetric_fog_detail_spread", PROPERTY_HINT_EXP_EASING, "positive_only"), "set_volumetric_fog_detail_spread", "get_volumetric_fog_detail_spread");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "volumetric_fog_ambient_inject", PROPERTY_HINT_RANGE, "0.0,16,0.01,exp"), "set_volumetric_fog_ambient_inject", "get_volumetric_fog_ambient_inject");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "volumetric_fog_sky_affect", PROPERTY_HINT_RANGE, "0,1,0.001"), "set_volumetric_fog_sky_affect", "get_volumetric_fog_sky_affect");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "volumetric_fog_resolution", PROPERTY_HINT_ENUM, "Full,Half,Quarter"), "set_volumetric_fog_resolution", "get_volumetric_fog_resolution");
 	ADD_SUBGROUP("Temporal Reprojection", "volumetric_fog_temporal_reprojection_");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "volumetric_fog_temporal_reprojection_enabled"), "set_volumetric_fog_temporal_reprojection_enabled", "is_volumetric_fog_temporal_reprojection_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "volumetric_fog_temporal_reprojection_amount", PROPERTY_HINT_RANGE, "0.5,0.99,0.001"), "set_volumetric_fog_temporal_reprojection_amount", "get_volumetric_fog_temporal_reprojection_amount");
@@ -1507,6 +1519,10 @@ void Environment::_bind_methods() {
 	BIND_ENUM_CONSTANT(SDFGI_Y_SCALE_50_PERCENT);
 	BIND_ENUM_CONSTANT(SDFGI_Y_SCALE_75_PERCENT);
 	BIND_ENUM_CONSTANT(SDFGI_Y_SCALE_100_PERCENT);
+
+	BIND_ENUM_CONSTANT(VOLUMETRIC_FOG_RESOLUTION_FULL);
+	BIND_ENUM_CONSTANT(VOLUMETRIC_FOG_RESOLUTION_HALF);
+	BIND_ENUM_CONSTANT(VOLUMETRIC_FOG_RESOLUTION_QUARTER);
 }
 
 Environment::Environment() {
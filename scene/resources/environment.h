@@ -75,6 +75,12 @@ public:
 		SDFGI_Y_SCALE_100_PERCENT,
 	};
 
+	enum VolumetricFogResolution {
+		VOLUMETRIC_FOG_RESOLUTION_FULL,
+		VOLUMETRIC_FOG_RESOLUTION_HALF,
+		VOLUMETRIC_FOG_RESOLUTION_QUARTER,
+	};
+
 	enum GlowBlendMode {
 		GLOW_BLEND_MODE_ADDITIVE,
 		GLOW_BLEND_MODE_SCREEN,
@@ -197,6 +203,7 @@ private:
 	float volumetric_fog_sky_affect = 1.0;
 	bool volumetric_fog_temporal_reproject = true;
 	float volumetric_fog_temporal_reproject_amount = 0.9;
+	VolumetricFogResolution volumetric_fog_resolution = VOLUMETRIC_FOG_RESOLUTION_FULL;
 	void _update_volumetric_fog();
 
 	// Adjustment
@@ -406,6 +413,8 @@ public:
 	bool is_volumetric_fog_temporal_reprojection_enabled() const;
 	void set_volumetric_fog_temporal_reprojection_amount(float p_amount);
 	float get_volumetric_fog_temporal_reprojection_amount() const;
+	void set_volumetric_fog_resolution(VolumetricFogResolution p_resolution);
+	VolumetricFogResolution get_volumetric_fog_resolution() const;
 
 	// Adjustment
 	void set_adjustment_enabled(bool p_enabled);
@@ -428,6 +437,7 @@ VARIANT_ENUM_CAST(Environment::AmbientSource)
 VARIANT_ENUM_CAST(Environment::ReflectionSource)
 VARIANT_ENUM_CAST(Environment::ToneMapper)
 VARIANT_ENUM_CAST(Environment::SDFGIYScale)
+VARIANT_ENUM_CAST(Environment::VolumetricFogResolution)
 VARIANT_ENUM_CAST(Environment::GlowBlendMode)
 
 #endif // ENVIRONMENT_H
@@ -34,6 +34,7 @@
 #include "core/math/convex_hull.h"
 #include "core/math/random_pcg.h"
 #include "core/math/static_raycaster.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/resources/surface_tool.h"
 
 #include <cstdint>
@@ -269,6 +270,34 @@ void ImporterMesh::set_surface_material(int p_surface, const Ref<Material> &p_ma
 	}                                                                                                              \
 	write_array[vert_idx] = transformed_vert;
 
+Mutex ImporterMesh::lod_cache_mutex;
+HashMap<uint32_t, ImporterMesh::LODCacheEntry> ImporterMesh::lod_cache;
+uint64_t ImporterMesh::lod_cache_index_count = 0;
+
+void ImporterMesh::clear_lod_cache() {
+	MutexLock lock(lod_cache_mutex);
+	lod_cache.clear();
+	lod_cache_index_count = 0;
+}
+
+bool ImporterMesh::_lod_cache_entry_matches(const LODCacheEntry &p_entry, const Surface &p_surface, const LODGenerationData *p_data) {
+	if (p_entry.arrays.is_empty() || p_entry.flags != p_surface.flags || p_entry.params_hash != p_data->params_hash) {
+		return false;
+	}
+	if (p_entry.normal_merge_angle != p_data->normal_merge_angle || p_entry.normal_split_angle != p_data->normal_split_angle) {
+		return false;
+	}
+	if (p_entry.bone_transforms.size() != p_data->bone_transforms.size()) {
+		return false;
+	}
+	for (uint32_t i = 0; i < p_entry.bone_transforms.size(); i++) {
+		if (p_entry.bone_transforms[i] != p_data->bone_transforms[i]) {
+			return false;
+		}
+	}
+	return p_entry.arrays == p_surface.arrays;
+}
+
 void ImporterMesh::generate_lods(float p_normal_merge_angle, float p_normal_split_angle, Array p_bone_transform_array) {
 	if (!SurfaceTool::simplify_scale_func) {
 		return;
@@ -286,111 +315,137 @@ void ImporterMesh::generate_lods(float p_normal_merge_angle, float p_normal_spli
 		bone_transform_vector.push_back(p_bone_transform_array[i]);
 	}
 
-	for (int i = 0; i < surfaces.size(); i++) {
-		if (surfaces[i].primitive != Mesh::PRIMITIVE_TRIANGLES) {
-			continue;
-		}
-
-		surfaces.write[i].lods.clear();
-		Vector<Vector3> vertices = surfaces[i].arrays[RS::ARRAY_VERTEX];
-		PackedInt32Array indices = surfaces[i].arrays[RS::ARRAY_INDEX];
-		Vector<Vector3> normals = surfaces[i].arrays[RS::ARRAY_NORMAL];
-		Vector<Vector2> uvs = surfaces[i].arrays[RS::ARRAY_TEX_UV];
-		Vector<Vector2> uv2s = surfaces[i].arrays[RS::ARRAY_TEX_UV2];
-		Vector<int> bones = surfaces[i].arrays[RS::ARRAY_BONES];
-		Vector<float> weights = surfaces[i].arrays[RS::ARRAY_WEIGHTS];
-
-		unsigned int index_count = indices.size();
-		unsigned int vertex_count = vertices.size();
+	LODGenerationData data;
+	data.surfaces = surfaces.ptrw();
+	data.normal_merge_angle = p_normal_merge_angle;
+	data.normal_split_angle = p_normal_split_angle;
+	data.params_hash = hash_murmur3_one_float(p_normal_merge_angle);
+	data.params_hash = hash_murmur3_one_float(p_normal_split_angle, data.params_hash);
+	data.params_hash = hash_murmur3_one_32(p_bone_transform_array.hash(), data.params_hash);
+	data.bone_transforms = bone_transform_vector;
+
+	// Surfaces simplify independently, each only writes its own LODs and split normals.
+	if (surfaces.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ImporterMesh::_generate_surface_lods, &data, surfaces.size(), -1, true, SNAME("ImporterMeshLODs"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (surfaces.size() == 1) {
+		_generate_surface_lods(0, &data);
+	}
+}
 
-		if (index_count == 0) {
-			continue; //no lods if no indices
-		}
+void ImporterMesh::_generate_surface_lods(uint32_t p_index, LODGenerationData *p_data) {
+	Surface &surface = p_data->surfaces[p_index];
+	if (surface.primitive != Mesh::PRIMITIVE_TRIANGLES) {
+		return;
+	}
 
-		const Vector3 *vertices_ptr = vertices.ptr();
-		const int *indices_ptr = indices.ptr();
-
-		if (normals.is_empty()) {
-			normals.resize(index_count);
-			Vector3 *n_ptr = normals.ptrw();
-			for (unsigned int j = 0; j < index_count; j += 3) {
-				const Vector3 &v0 = vertices_ptr[indices_ptr[j + 0]];
-				const Vector3 &v1 = vertices_ptr[indices_ptr[j + 1]];
-				const Vector3 &v2 = vertices_ptr[indices_ptr[j + 2]];
-				Vector3 n = vec3_cross(v0 - v2, v0 - v1).normalized();
-				n_ptr[j + 0] = n;
-				n_ptr[j + 1] = n;
-				n_ptr[j + 2] = n;
-			}
-		}
+	surface.lods.clear();
 
-		if (bones.size() > 0 && weights.size() && bone_transform_vector.size() > 0) {
-			Vector3 *vertices_ptrw = vertices.ptrw();
+	// Keyed before split_normals() changes the arrays, so the same source mesh finds its entry on reimport.
+	uint32_t cache_key = hash_murmur3_one_32(surface.arrays.hash(), p_data->params_hash);
+	cache_key = hash_fmix32(hash_murmur3_one_32(surface.flags, cache_key));
+	LODCacheEntry cached;
+	lod_cache_mutex.lock();
+	HashMap<uint32_t, LODCacheEntry>::Iterator E = lod_cache.find(cache_key);
+	if (E) {
+		cached = E->value;
+	}
+	lod_cache_mutex.unlock();
+	if (_lod_cache_entry_matches(cached, surface, p_data)) {
+		surface.lods = cached.lods;
+		surface.split_normals(cached.split_vertex_indices, cached.split_vertex_normals);
+		return;
+	}
 
-			// Apply bone transforms to regular surface.
-			unsigned int bone_weight_length = surfaces[i].flags & Mesh::ARRAY_FLAG_USE_8_BONE_WEIGHTS ? 8 : 4;
+	Vector<Vector3> vertices = surface.arrays[RS::ARRAY_VERTEX];
+	PackedInt32Array indices = surface.arrays[RS::ARRAY_INDEX];
+	Vector<Vector3> normals = surface.arrays[RS::ARRAY_NORMAL];
+	Vector<Vector2> uvs = surface.arrays[RS::ARRAY_TEX_UV];
+	Vector<Vector2> uv2s = surface.arrays[RS::ARRAY_TEX_UV2];
+	Vector<int> bones = surface.arrays[RS::ARRAY_BONES];
+	Vector<float> weights = surface.arrays[RS::ARRAY_WEIGHTS];
 
-			const int *bo = bones.ptr();
-			const float *we = weights.ptr();
+	unsigned int index_count = indices.size();
+	unsigned int vertex_count = vertices.size();
 
-			for (unsigned int j = 0; j < vertex_count; j++) {
-				VERTEX_SKIN_FUNC(bone_weight_length, j, vertices_ptr, vertices_ptrw, bone_transform_vector, bo, we)
-			}
+	if (index_count == 0) {
+		return; //no lods if no indices
+	}
 
-			vertices_ptr = vertices.ptr();
+	const Vector3 *vertices_ptr = vertices.ptr();
+	const int *indices_ptr = indices.ptr();
+
+	if (normals.is_empty()) {
+		normals.resize(index_count);
+		Vector3 *n_ptr = normals.ptrw();
+		for (unsigned int j = 0; j < index_count; j += 3) {
+			const Vector3 &v0 = vertices_ptr[indices_ptr[j + 0]];
+			const Vector3 &v1 = vertices_ptr[indices_ptr[j + 1]];
+			const Vector3 &v2 = vertices_ptr[indices_ptr[j + 2]];
+			Vector3 n = vec3_cross(v0 - v2, v0 - v1).normalized();
+			n_ptr[j + 0] = n;
+			n_ptr[j + 1] = n;
+			n_ptr[j + 2] = n;
 		}
+	}
 
-		float normal_merge_threshold = Math::cos(Math::deg_to_rad(p_normal_merge_angle));
-		float normal_pre_split_threshold = Math::cos(Math::deg_to_rad(MIN(180.0f, p_normal_split_angle * 2.0f)));
-		float normal_split_threshold = Math::cos(Math::deg_to_rad(p_normal_split_angle));
-		const Vector3 *normals_ptr = normals.ptr();
+	if (bones.size() > 0 && weights.size() && p_data->bone_transforms.size() > 0) {
+		Vector3 *vertices_ptrw = vertices.ptrw();
 
-		HashMap<Vector3, LocalVector<Pair<int, int>>> unique_vertices;
+		// Apply bone transforms to regular surface.
+		unsigned int bone_weight_length = surface.flags & Mesh::ARRAY_FLAG_USE_8_BONE_WEIGHTS ? 8 : 4;
 
-		LocalVector<int> vertex_remap;
-		LocalVector<int> vertex_inverse_remap;
-		LocalVector<Vector3> merged_vertices;
-		LocalVector<Vector3> merged_normals;
-		LocalVector<int> merged_normals_counts;
-		const Vector2 *uvs_ptr = uvs.ptr();
-		const Vector2 *uv2s_ptr = uv2s.ptr();
+		const int *bo = bones.ptr();
+		const float *we = weights.ptr();
 
 		for (unsigned int j = 0; j < vertex_count; j++) {
-			const Vector3 &v = vertices_ptr[j];
-			const Vector3 &n = normals_ptr[j];
+			VERTEX_SKIN_FUNC(bone_weight_length, j, vertices_ptr, vertices_ptrw, p_data->bone_transforms, bo, we)
+		}
 
-			HashMap<Vector3, LocalVector<Pair<int, int>>>::Iterator E = unique_vertices.find(v);
+		vertices_ptr = vertices.ptr();
+	}
 
-			if (E) {
-				const LocalVector<Pair<int, int>> &close_verts = E->value;
-
-				bool found = false;
-				for (const Pair<int, int> &idx : close_verts) {
-					bool is_uvs_close = (!uvs_ptr || uvs_ptr[j].distance_squared_to(uvs_ptr[idx.second]) < CMP_EPSILON2);
-					bool is_uv2s_close = (!uv2s_ptr || uv2s_ptr[j].distance_squared_to(uv2s_ptr[idx.second]) < CMP_EPSILON2);
-					ERR_FAIL_INDEX(idx.second, normals.size());
-					bool is_normals_close = normals[idx.second].dot(n) > normal_merge_threshold;
-					if (is_uvs_close && is_uv2s_close && is_normals_close) {
-						vertex_remap.push_back(idx.first);
-						merged_normals[idx.first] += normals[idx.second];
-						merged_normals_counts[idx.first]++;
-						found = true;
-						break;
-					}
+	float normal_merge_threshold = Math::cos(Math::deg_to_rad(p_data->normal_merge_angle));
+	float normal_pre_split_threshold = Math::cos(Math::deg_to_rad(MIN(180.0f, p_data->normal_split_angle * 2.0f)));
+	float normal_split_threshold = Math::cos(Math::deg_to_rad(p_data->normal_split_angle));
+	const Vector3 *normals_ptr = normals.ptr();
+
+	HashMap<Vector3, LocalVector<Pair<int, int>>> unique_vertices;
+
+	LocalVector<int> vertex_remap;
+	LocalVector<int> vertex_inverse_remap;
+	LocalVector<Vector3> merged_vertices;
+	LocalVector<Vector3> merged_normals;
+	LocalVector<int> merged_normals_counts;
+	const Vector2 *uvs_ptr = uvs.ptr();
+	const Vector2 *uv2s_ptr = uv2s.ptr();
+
+	for (unsigned int j = 0; j < vertex_count; j++) {
+		const Vector3 &v = vertices_ptr[j];
+		const Vector3 &n = normals_ptr[j];
+
+		HashMap<Vector3, LocalVector<Pair<int, int>>>::Iterator E = unique_vertices.find(v);
+
+		if (E) {
+			const LocalVector<Pair<int, int>> &close_verts = E->value;
+
+			bool found = false;
+			for (const Pair<int, int> &idx : close_verts) {
+				bool is_uvs_close = (!uvs_ptr || uvs_ptr[j].distance_squared_to(uvs_ptr[idx.second]) < CMP_EPSILON2);
+				bool is_uv2s_close = (!uv2s_ptr || uv2s_ptr[j].distance_squared_to(uv2s_ptr[idx.second]) < CMP_EPSILON2);
+				ERR_FAIL_INDEX(idx.second, normals.size());
+				bool is_normals_close = normals[idx.second].dot(n) > normal_merge_threshold;
+				if (is_uvs_close && is_uv2s_close && is_normals_close) {
+					vertex_remap.push_back(idx.first);
+					merged_normals[idx.first] += normals[idx.second];
+					merged_normals_counts[idx.first]++;
+					found = true;
+					break;
 				}
+			}
 
-				if (!found) {
-					int vcount = merged_vertices.size();
-					unique_vertices[v].push_back(Pair<int, int>(vcount, j));
-					vertex_inverse_remap.push_back(j);
-					merged_vertices.push_back(v);
-					vertex_remap.push_back(vcount);
-					merged_normals.push_back(normals_ptr[j]);
-					merged_normals_counts.push_back(1);
-				}
-			} else {
+			if (!found) {
 				int vcount = merged_vertices.size();
-				unique_vertices[v] = LocalVector<Pair<int, int>>();
 				unique_vertices[v].push_back(Pair<int, int>(vcount, j));
 				vertex_inverse_remap.push_back(j);
 				merged_vertices.push_back(v);
@@ -398,273 +453,306 @@ void ImporterMesh::generate_lods(float p_normal_merge_angle, float p_normal_spli
 				merged_normals.push_back(normals_ptr[j]);
 				merged_normals_counts.push_back(1);
 			}
+		} else {
+			int vcount = merged_vertices.size();
+			unique_vertices[v] = LocalVector<Pair<int, int>>();
+			unique_vertices[v].push_back(Pair<int, int>(vcount, j));
+			vertex_inverse_remap.push_back(j);
+			merged_vertices.push_back(v);
+			vertex_remap.push_back(vcount);
+			merged_normals.push_back(normals_ptr[j]);
+			merged_normals_counts.push_back(1);
 		}
+	}
 
-		LocalVector<int> merged_indices;
-		merged_indices.resize(index_count);
-		for (unsigned int j = 0; j < index_count; j++) {
-			merged_indices[j] = vertex_remap[indices[j]];
-		}
-
-		unsigned int merged_vertex_count = merged_vertices.size();
-		const Vector3 *merged_vertices_ptr = merged_vertices.ptr();
-		const int32_t *merged_indices_ptr = merged_indices.ptr();
+	LocalVector<int> merged_indices;
+	merged_indices.resize(index_count);
+	for (unsigned int j = 0; j < index_count; j++) {
+		merged_indices[j] = vertex_remap[indices[j]];
+	}
 
-		{
-			const int *counts_ptr = merged_normals_counts.ptr();
-			Vector3 *merged_normals_ptrw = merged_normals.ptr();
-			for (unsigned int j = 0; j < merged_vertex_count; j++) {
-				merged_normals_ptrw[j] /= counts_ptr[j];
-			}
-		}
+	unsigned int merged_vertex_count = merged_vertices.size();
+	const Vector3 *merged_vertices_ptr = merged_vertices.ptr();
+	const int32_t *merged_indices_ptr = merged_indices.ptr();
 
-		LocalVector<float> normal_weights;
-		normal_weights.resize(merged_vertex_count);
+	{
+		const int *counts_ptr = merged_normals_counts.ptr();
+		Vector3 *merged_normals_ptrw = merged_normals.ptr();
 		for (unsigned int j = 0; j < merged_vertex_count; j++) {
-			normal_weights[j] = 2.0; // Give some weight to normal preservation, may be worth exposing as an import setting
+			merged_normals_ptrw[j] /= counts_ptr[j];
 		}
+	}
 
-		Vector<float> merged_vertices_f32 = vector3_to_float32_array(merged_vertices_ptr, merged_vertex_count);
-		float scale = SurfaceTool::simplify_scale_func(merged_vertices_f32.ptr(), merged_vertex_count, sizeof(float) * 3);
-
-		unsigned int index_target = 12; // Start with the smallest target, 4 triangles
-		unsigned int last_index_count = 0;
+	LocalVector<float> normal_weights;
+	normal_weights.resize(merged_vertex_count);
+	for (unsigned int j = 0; j < merged_vertex_count; j++) {
+		normal_weights[j] = 2.0; // Give some weight to normal preservation, may be worth exposing as an import setting
+	}
 
-		int split_vertex_count = vertex_count;
-		LocalVector<Vector3> split_vertex_normals;
-		LocalVector<int> split_vertex_indices;
-		split_vertex_normals.reserve(index_count / 3);
-		split_vertex_indices.reserve(index_count / 3);
+	Vector<float> merged_vertices_f32 = vector3_to_float32_array(merged_vertices_ptr, merged_vertex_count);
+	float scale = SurfaceTool::simplify_scale_func(merged_vertices_f32.ptr(), merged_vertex_count, sizeof(float) * 3);
 
-		RandomPCG pcg;
-		pcg.seed(123456789); // Keep seed constant across imports
+	unsigned int index_target = 12; // Start with the smallest target, 4 triangles
+	unsigned int last_index_count = 0;
 
-		Ref<StaticRaycaster> raycaster = StaticRaycaster::create();
-		if (raycaster.is_valid()) {
-			raycaster->add_mesh(vertices, indices, 0);
-			raycaster->commit();
-		}
+	int split_vertex_count = vertex_count;
+	LocalVector<Vector3> split_vertex_normals;
+	LocalVector<int> split_vertex_indices;
+	split_vertex_normals.reserve(index_count / 3);
+	split_vertex_indices.reserve(index_count / 3);
 
-		const float max_mesh_error = FLT_MAX; // We don't want to limit by error, just by index target
-		float mesh_error = 0.0f;
-
-		while (index_target < index_count) {
-			PackedInt32Array new_indices;
-			new_indices.resize(index_count);
-
-			Vector<float> merged_normals_f32 = vector3_to_float32_array(merged_normals.ptr(), merged_normals.size());
-			const int simplify_options = SurfaceTool::SIMPLIFY_LOCK_BORDER;
-
-			size_t new_index_count = SurfaceTool::simplify_with_attrib_func(
-					(unsigned int *)new_indices.ptrw(),
-					(const uint32_t *)merged_indices_ptr, index_count,
-					merged_vertices_f32.ptr(), merged_vertex_count,
-					sizeof(float) * 3, // Vertex stride
-					index_target,
-					max_mesh_error,
-					simplify_options,
-					&mesh_error,
-					merged_normals_f32.ptr(),
-					normal_weights.ptr(), 3);
-
-			if (new_index_count < last_index_count * 1.5f) {
-				index_target = index_target * 1.5f;
-				continue;
-			}
+	RandomPCG pcg;
+	pcg.seed(123456789); // Keep seed constant across imports
 
-			if (new_index_count == 0 || (new_index_count >= (index_count * 0.75f))) {
-				break;
-			}
+	Ref<StaticRaycaster> raycaster = StaticRaycaster::create();
+	if (raycaster.is_valid()) {
+		raycaster->add_mesh(vertices, indices, 0);
+		raycaster->commit();
+	}
 
-			new_indices.resize(new_index_count);
+	const float max_mesh_error = FLT_MAX; // We don't want to limit by error, just by index target
+	float mesh_error = 0.0f;
+
+	while (index_target < index_count) {
+		PackedInt32Array new_indices;
+		new_indices.resize(index_count);
+
+		Vector<float> merged_normals_f32 = vector3_to_float32_array(merged_normals.ptr(), merged_normals.size());
+		const int simplify_options = SurfaceTool::SIMPLIFY_LOCK_BORDER;
+
+		size_t new_index_count = SurfaceTool::simplify_with_attrib_func(
+				(unsigned int *)new_indices.ptrw(),
+				(const uint32_t *)merged_indices_ptr, index_count,
+				merged_vertices_f32.ptr(), merged_vertex_count,
+				sizeof(float) * 3, // Vertex stride
+				index_target,
+				max_mesh_error,
+				simplify_options,
+				&mesh_error,
+				merged_normals_f32.ptr(),
+				normal_weights.ptr(), 3);
+
+		if (new_index_count < last_index_count * 1.5f) {
+			index_target = index_target * 1.5f;
+			continue;
+		}
 
-			LocalVector<LocalVector<int>> vertex_corners;
-			vertex_corners.resize(vertex_count);
-			{
-				int *ptrw = new_indices.ptrw();
-				for (unsigned int j = 0; j < new_index_count; j++) {
-					const int &remapped = vertex_inverse_remap[ptrw[j]];
-					vertex_corners[remapped].push_back(j);
-					ptrw[j] = remapped;
-				}
-			}
+		if (new_index_count == 0 || (new_index_count >= (index_count * 0.75f))) {
+			break;
+		}
 
-			if (raycaster.is_valid()) {
-				float error_factor = 1.0f / (scale * MAX(mesh_error, 0.15));
-				const float ray_bias = 0.05;
-				float ray_length = ray_bias + mesh_error * scale * 3.0f;
+		new_indices.resize(new_index_count);
 
-				Vector<StaticRaycaster::Ray> rays;
-				LocalVector<Vector2> ray_uvs;
+		LocalVector<LocalVector<int>> vertex_corners;
+		vertex_corners.resize(vertex_count);
+		{
+			int *ptrw = new_indices.ptrw();
+			for (unsigned int j = 0; j < new_index_count; j++) {
+				const int &remapped = vertex_inverse_remap[ptrw[j]];
+				vertex_corners[remapped].push_back(j);
+				ptrw[j] = remapped;
+			}
+		}
 
-				int32_t *new_indices_ptr = new_indices.ptrw();
+		if (raycaster.is_valid()) {
+			float error_factor = 1.0f / (scale * MAX(mesh_error, 0.15));
+			const float ray_bias = 0.05;
+			float ray_length = ray_bias + mesh_error * scale * 3.0f;
 
-				int current_ray_count = 0;
-				for (unsigned int j = 0; j < new_index_count; j += 3) {
-					const Vector3 &v0 = vertices_ptr[new_indices_ptr[j + 0]];
-					const Vector3 &v1 = vertices_ptr[new_indices_ptr[j + 1]];
-					const Vector3 &v2 = vertices_ptr[new_indices_ptr[j + 2]];
-					Vector3 face_normal = vec3_cross(v0 - v2, v0 - v1);
-					float face_area = face_normal.length(); // Actually twice the face area, since it's the same error_factor on all faces, we don't care
+			Vector<StaticRaycaster::Ray> rays;
+			LocalVector<Vector2> ray_uvs;
 
-					Vector3 dir = face_normal / face_area;
-					int ray_count = CLAMP(5.0 * face_area * error_factor, 16, 64);
+			int32_t *new_indices_ptr = new_indices.ptrw();
 
-					rays.resize(current_ray_count + ray_count);
-					StaticRaycaster::Ray *rays_ptr = rays.ptrw();
+			int current_ray_count = 0;
+			for (unsigned int j = 0; j < new_index_count; j += 3) {
+				const Vector3 &v0 = vertices_ptr[new_indices_ptr[j + 0]];
+				const Vector3 &v1 = vertices_ptr[new_indices_ptr[j + 1]];
+				const Vector3 &v2 = vertices_ptr[new_indices_ptr[j + 2]];
+				Vector3 face_normal = vec3_cross(v0 - v2, v0 - v1);
+				float face_area = face_normal.length(); // Actually twice the face area, since it's the same error_factor on all faces, we don't care
 
-					ray_uvs.resize(current_ray_count + ray_count);
-					Vector2 *ray_uvs_ptr = ray_uvs.ptr();
+				Vector3 dir = face_normal / face_area;
+				int ray_count = CLAMP(5.0 * face_area * error_factor, 16, 64);
 
-					for (int k = 0; k < ray_count; k++) {
-						float u = pcg.randf();
-						float v = pcg.randf();
+				rays.resize(current_ray_count + ray_count);
+				StaticRaycaster::Ray *rays_ptr = rays.ptrw();
 
-						if (u + v >= 1.0f) {
-							u = 1.0f - u;
-							v = 1.0f - v;
-						}
+				ray_uvs.resize(current_ray_count + ray_count);
+				Vector2 *ray_uvs_ptr = ray_uvs.ptr();
 
-						u = 0.9f * u + 0.05f / 3.0f; // Give barycentric coordinates some padding, we don't want to sample right on the edge
-						v = 0.9f * v + 0.05f / 3.0f; // v = (v - one_third) * 0.95f + one_third;
-						float w = 1.0f - u - v;
+				for (int k = 0; k < ray_count; k++) {
+					float u = pcg.randf();
+					float v = pcg.randf();
 
-						Vector3 org = v0 * w + v1 * u + v2 * v;
-						org -= dir * ray_bias;
-						rays_ptr[current_ray_count + k] = StaticRaycaster::Ray(org, dir, 0.0f, ray_length);
-						rays_ptr[current_ray_count + k].id = j / 3;
-						ray_uvs_ptr[current_ray_count + k] = Vector2(u, v);
+					if (u + v >= 1.0f) {
+						u = 1.0f - u;
+						v = 1.0f - v;
 					}
 
-					current_ray_count += ray_count;
-				}
+					u = 0.9f * u + 0.05f / 3.0f; // Give barycentric coordinates some padding, we don't want to sample right on the edge
+					v = 0.9f * v + 0.05f / 3.0f; // v = (v - one_third) * 0.95f + one_third;
+					float w = 1.0f - u - v;
 
-				raycaster->intersect(rays);
+					Vector3 org = v0 * w + v1 * u + v2 * v;
+					org -= dir * ray_bias;
+					rays_ptr[current_ray_count + k] = StaticRaycaster::Ray(org, dir, 0.0f, ray_length);
+					rays_ptr[current_ray_count + k].id = j / 3;
+					ray_uvs_ptr[current_ray_count + k] = Vector2(u, v);
+				}
 
-				LocalVector<Vector3> ray_normals;
-				LocalVector<real_t> ray_normal_weights;
+				current_ray_count += ray_count;
+			}
 
-				ray_normals.resize(new_index_count);
-				ray_normal_weights.resize(new_index_count);
+			raycaster->intersect(rays);
 
-				for (unsigned int j = 0; j < new_index_count; j++) {
-					ray_normal_weights[j] = 0.0f;
-				}
+			LocalVector<Vector3> ray_normals;
+			LocalVector<real_t> ray_normal_weights;
 
-				const StaticRaycaster::Ray *rp = rays.ptr();
-				for (int j = 0; j < rays.size(); j++) {
-					if (rp[j].geomID != 0) { // Ray missed
-						continue;
-					}
+			ray_normals.resize(new_index_count);
+			ray_normal_weights.resize(new_index_count);
 
-					if (rp[j].normal.normalized().dot(rp[j].dir) > 0.0f) { // Hit a back face.
-						continue;
-					}
+			for (unsigned int j = 0; j < new_index_count; j++) {
+				ray_normal_weights[j] = 0.0f;
+			}
 
-					const float &u = rp[j].u;
-					const float &v = rp[j].v;
-					const float w = 1.0f - u - v;
-
-					const unsigned int &hit_tri_id = rp[j].primID;
-					const unsigned int &orig_tri_id = rp[j].id;
-
-					const Vector3 &n0 = normals_ptr[indices_ptr[hit_tri_id * 3 + 0]];
-					const Vector3 &n1 = normals_ptr[indices_ptr[hit_tri_id * 3 + 1]];
-					const Vector3 &n2 = normals_ptr[indices_ptr[hit_tri_id * 3 + 2]];
-					Vector3 normal = n0 * w + n1 * u + n2 * v;
-
-					Vector2 orig_uv = ray_uvs[j];
-					const real_t orig_bary[3] = { 1.0f - orig_uv.x - orig_uv.y, orig_uv.x, orig_uv.y };
-					for (int k = 0; k < 3; k++) {
-						int idx = orig_tri_id * 3 + k;
-						real_t weight = orig_bary[k];
-						ray_normals[idx] += normal * weight;
-						ray_normal_weights[idx] += weight;
-					}
+			const StaticRaycaster::Ray *rp = rays.ptr();
+			for (int j = 0; j < rays.size(); j++) {
+				if (rp[j].geomID != 0) { // Ray missed
+					continue;
 				}
 
-				for (unsigned int j = 0; j < new_index_count; j++) {
-					if (ray_normal_weights[j] < 1.0f) { // Not enough data, the new normal would be just a bad guess
-						ray_normals[j] = Vector3();
-					} else {
-						ray_normals[j] /= ray_normal_weights[j];
-					}
+				if (rp[j].normal.normalized().dot(rp[j].dir) > 0.0f) { // Hit a back face.
+					continue;
 				}
 
-				LocalVector<LocalVector<int>> normal_group_indices;
-				LocalVector<Vector3> normal_group_averages;
-				normal_group_indices.reserve(24);
-				normal_group_averages.reserve(24);
+				const float &u = rp[j].u;
+				const float &v = rp[j].v;
+				const float w = 1.0f - u - v;
+
+				const unsigned int &hit_tri_id = rp[j].primID;
+				const unsigned int &orig_tri_id = rp[j].id;
+
+				const Vector3 &n0 = normals_ptr[indices_ptr[hit_tri_id * 3 + 0]];
+				const Vector3 &n1 = normals_ptr[indices_ptr[hit_tri_id * 3 + 1]];
+				const Vector3 &n2 = normals_ptr[indices_ptr[hit_tri_id * 3 + 2]];
+				Vector3 normal = n0 * w + n1 * u + n2 * v;
+
+				Vector2 orig_uv = ray_uvs[j];
+				const real_t orig_bary[3] = { 1.0f - orig_uv.x - orig_uv.y, orig_uv.x, orig_uv.y };
+				for (int k = 0; k < 3; k++) {
+					int idx = orig_tri_id * 3 + k;
+					real_t weight = orig_bary[k];
+					ray_normals[idx] += normal * weight;
+					ray_normal_weights[idx] += weight;
+				}
+			}
 
-				for (unsigned int j = 0; j < vertex_count; j++) {
-					const LocalVector<int> &corners = vertex_corners[j];
-					const Vector3 &vertex_normal = normals_ptr[j];
+			for (unsigned int j = 0; j < new_index_count; j++) {
+				if (ray_normal_weights[j] < 1.0f) { // Not enough data, the new normal would be just a bad guess
+					ray_normals[j] = Vector3();
+				} else {
+					ray_normals[j] /= ray_normal_weights[j];
+				}
+			}
 
-					for (const int &corner_idx : corners) {
-						const Vector3 &ray_normal = ray_normals[corner_idx];
+			LocalVector<LocalVector<int>> normal_group_indices;
+			LocalVector<Vector3> normal_group_averages;
+			normal_group_indices.reserve(24);
+			normal_group_averages.reserve(24);
 
-						if (ray_normal.length_squared() < CMP_EPSILON2) {
-							continue;
-						}
+			for (unsigned int j = 0; j < vertex_count; j++) {
+				const LocalVector<int> &corners = vertex_corners[j];
+				const Vector3 &vertex_normal = normals_ptr[j];
 
-						bool found = false;
-						for (unsigned int l = 0; l < normal_group_indices.size(); l++) {
-							LocalVector<int> &group_indices = normal_group_indices[l];
-							Vector3 n = normal_group_averages[l] / group_indices.size();
-							if (n.dot(ray_normal) > normal_pre_split_threshold) {
-								found = true;
-								group_indices.push_back(corner_idx);
-								normal_group_averages[l] += ray_normal;
-								break;
-							}
-						}
+				for (const int &corner_idx : corners) {
+					const Vector3 &ray_normal = ray_normals[corner_idx];
 
-						if (!found) {
-							normal_group_indices.push_back({ corner_idx });
-							normal_group_averages.push_back(ray_normal);
-						}
+					if (ray_normal.length_squared() < CMP_EPSILON2) {
+						continue;
 					}
 
-					for (unsigned int k = 0; k < normal_group_indices.size(); k++) {
-						LocalVector<int> &group_indices = normal_group_indices[k];
-						Vector3 n = normal_group_averages[k] / group_indices.size();
-
-						if (vertex_normal.dot(n) < normal_split_threshold) {
-							split_vertex_indices.push_back(j);
-							split_vertex_normals.push_back(n);
-							int new_idx = split_vertex_count++;
-							for (const int &index : group_indices) {
-								new_indices_ptr[index] = new_idx;
-							}
+					bool found = false;
+					for (unsigned int l = 0; l < normal_group_indices.size(); l++) {
+						LocalVector<int> &group_indices = normal_group_indices[l];
+						Vector3 n = normal_group_averages[l] / group_indices.size();
+						if (n.dot(ray_normal) > normal_pre_split_threshold) {
+							found = true;
+							group_indices.push_back(corner_idx);
+							normal_group_averages[l] += ray_normal;
+							break;
 						}
 					}
 
-					normal_group_indices.clear();
-					normal_group_averages.clear();
+					if (!found) {
+						normal_group_indices.push_back({ corner_idx });
+						normal_group_averages.push_back(ray_normal);
+					}
 				}
-			}
 
-			Surface::LOD lod;
-			lod.distance = MAX(mesh_error * scale, CMP_EPSILON2);
-			lod.indices = new_indices;
-			surfaces.write[i].lods.push_back(lod);
-			index_target = MAX(new_index_count, index_target) * 2;
-			last_index_count = new_index_count;
+				for (unsigned int k = 0; k < normal_group_indices.size(); k++) {
+					LocalVector<int> &group_indices = normal_group_indices[k];
+					Vector3 n = normal_group_averages[k] / group_indices.size();
 
-			if (mesh_error == 0.0f) {
-				break;
+					if (vertex_normal.dot(n) < normal_split_threshold) {
+						split_vertex_indices.push_back(j);
+						split_vertex_normals.push_back(n);
+						int new_idx = split_vertex_count++;
+						for (const int &index : group_indices) {
+							new_indices_ptr[index] = new_idx;
+						}
+					}
+				}
+
+				normal_group_indices.clear();
+				normal_group_averages.clear();
 			}
 		}
 
-		surfaces.write[i].split_normals(split_vertex_indices, split_vertex_normals);
-		surfaces.write[i].lods.sort_custom<Surface::LODComparator>();
-
-		for (int j = 0; j < surfaces.write[i].lods.size(); j++) {
-			Surface::LOD &lod = surfaces.write[i].lods.write[j];
-			unsigned int *lod_indices_ptr = (unsigned int *)lod.indices.ptrw();
-			SurfaceTool::optimize_vertex_cache_func(lod_indices_ptr, lod_indices_ptr, lod.indices.size(), split_vertex_count);
+		Surface::LOD lod;
+		lod.distance = MAX(mesh_error * scale, CMP_EPSILON2);
+		lod.indices = new_indices;
+		surface.lods.push_back(lod);
+		index_target = MAX(new_index_count, index_target) * 2;
+		last_index_count = new_index_count;
+
+		if (mesh_error == 0.0f) {
+			break;
 		}
 	}
+
+	Array source_arrays = surface.arrays.duplicate();
+	surface.split_normals(split_vertex_indices, split_vertex_normals);
+	surface.lods.sort_custom<Surface::LODComparator>();
+
+	for (int j = 0; j < surface.lods.size(); j++) {
+		Surface::LOD &lod = surface.lods.write[j];
+		unsigned int *lod_indices_ptr = (unsigned int *)lod.indices.ptrw();
+		SurfaceTool::optimize_vertex_cache_func(lod_indices_ptr, lod_indices_ptr, lod.indices.size(), split_vertex_count);
+	}
+
+	MutexLock lock(lod_cache_mutex);
+	if (lod_cache_index_count + index_count > LOD_CACHE_MAX_INDICES) {
+		lod_cache.clear();
+		lod_cache_index_count = 0;
+	}
+	HashMap<uint32_t, LODCacheEntry>::Iterator previous = lod_cache.find(cache_key);
+	if (previous) {
+		// Replaced, by the same surface from another thread or by a colliding one.
+		lod_cache_index_count -= previous->value.index_count;
+	}
+	LODCacheEntry &entry = lod_cache[cache_key];
+	entry.arrays = source_arrays;
+	entry.flags = surface.flags;
+	entry.params_hash = p_data->params_hash;
+	entry.normal_merge_angle = p_data->normal_merge_angle;
+	entry.normal_split_angle = p_data->normal_split_angle;
+	entry.bone_transforms = p_data->bone_transforms;
+	entry.index_count = index_count;
+	entry.lods = surface.lods;
+	entry.split_vertex_indices = split_vertex_indices;
+	entry.split_vertex_normals = split_vertex_normals;
+	lod_cache_index_count += index_count;
 }
 
 bool ImporterMesh::has_mesh() const {
@@ -750,76 +838,98 @@ void ImporterMesh::create_shadow_mesh() {
 
 	shadow_mesh.instantiate();
 
+	// Vertices of each surface are welded on their own, the surfaces are added in order afterwards.
+	ShadowMeshData data;
+	data.surfaces = surfaces.ptr();
+	data.shadow_surfaces.resize(surfaces.size());
+	if (surfaces.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ImporterMesh::_create_shadow_surface, &data, surfaces.size(), -1, true, SNAME("ImporterMeshShadow"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (surfaces.size() == 1) {
+		_create_shadow_surface(0, &data);
+	}
+
 	for (int i = 0; i < surfaces.size(); i++) {
-		LocalVector<int> vertex_remap;
-		Vector<Vector3> new_vertices;
-		Vector<Vector3> vertices = surfaces[i].arrays[RS::ARRAY_VERTEX];
-		int vertex_count = vertices.size();
-		{
-			HashMap<Vector3, int> unique_vertices;
-			const Vector3 *vptr = vertices.ptr();
-			for (int j = 0; j < vertex_count; j++) {
-				const Vector3 &v = vptr[j];
+		const ShadowSurface &shadow_surface = data.shadow_surfaces[i];
+		if (!shadow_surface.valid) {
+			return;
+		}
+		shadow_mesh->add_surface(surfaces[i].primitive, shadow_surface.arrays, Array(), shadow_surface.lods, Ref<Material>(), surfaces[i].name, surfaces[i].flags);
+	}
+}
+
+void ImporterMesh::_create_shadow_surface(uint32_t p_index, ShadowMeshData *p_data) {
+	LocalVector<int> vertex_remap;
+	Vector<Vector3> new_vertices;
+	Vector<Vector3> vertices = p_data->surfaces[p_index].arrays[RS::ARRAY_VERTEX];
+	int vertex_count = vertices.size();
+	{
+		HashMap<Vector3, int> unique_vertices;
+		const Vector3 *vptr = vertices.ptr();
+		for (int j = 0; j < vertex_count; j++) {
+			const Vector3 &v = vptr[j];
 
-				HashMap<Vector3, int>::Iterator E = unique_vertices.find(v);
+			HashMap<Vector3, int>::Iterator E = unique_vertices.find(v);
 
-				if (E) {
-					vertex_remap.push_back(E->value);
-				} else {
-					int vcount = unique_vertices.size();
-					unique_vertices[v] = vcount;
-					vertex_remap.push_back(vcount);
-					new_vertices.push_back(v);
-				}
+			if (E) {
+				vertex_remap.push_back(E->value);
+			} else {
+				int vcount = unique_vertices.size();
+				unique_vertices[v] = vcount;
+				vertex_remap.push_back(vcount);
+				new_vertices.push_back(v);
 			}
 		}
+	}
 
-		Array new_surface;
-		new_surface.resize(RS::ARRAY_MAX);
-		Dictionary lods;
+	Array new_surface;
+	new_surface.resize(RS::ARRAY_MAX);
+	Dictionary lods;
 
-		//		print_line("original vertex count: " + itos(vertices.size()) + " new vertex count: " + itos(new_vertices.size()));
+	//		print_line("original vertex count: " + itos(vertices.size()) + " new vertex count: " + itos(new_vertices.size()));
 
-		new_surface[RS::ARRAY_VERTEX] = new_vertices;
+	new_surface[RS::ARRAY_VERTEX] = new_vertices;
 
-		Vector<int> indices = surfaces[i].arrays[RS::ARRAY_INDEX];
-		if (indices.size()) {
-			int index_count = indices.size();
-			const int *index_rptr = indices.ptr();
-			Vector<int> new_indices;
-			new_indices.resize(indices.size());
-			int *index_wptr = new_indices.ptrw();
+	Vector<int> indices = p_data->surfaces[p_index].arrays[RS::ARRAY_INDEX];
+	if (indices.size()) {
+		int index_count = indices.size();
+		const int *index_rptr = indices.ptr();
+		Vector<int> new_indices;
+		new_indices.resize(indices.size());
+		int *index_wptr = new_indices.ptrw();
 
-			for (int j = 0; j < index_count; j++) {
-				int index = index_rptr[j];
-				ERR_FAIL_INDEX(index, vertex_count);
-				index_wptr[j] = vertex_remap[index];
-			}
+		for (int j = 0; j < index_count; j++) {
+			int index = index_rptr[j];
+			ERR_FAIL_INDEX(index, vertex_count);
+			index_wptr[j] = vertex_remap[index];
+		}
 
-			new_surface[RS::ARRAY_INDEX] = new_indices;
+		new_surface[RS::ARRAY_INDEX] = new_indices;
 
-			// Make sure the same LODs as the full version are used.
-			// This makes it more coherent between rendered model and its shadows.
-			for (int j = 0; j < surfaces[i].lods.size(); j++) {
-				indices = surfaces[i].lods[j].indices;
+		// Make sure the same LODs as the full version are used.
+		// This makes it more coherent between rendered model and its shadows.
+		for (int j = 0; j < p_data->surfaces[p_index].lods.size(); j++) {
+			indices = p_data->surfaces[p_index].lods[j].indices;
 
-				index_count = indices.size();
-				index_rptr = indices.ptr();
-				new_indices.resize(indices.size());
-				index_wptr = new_indices.ptrw();
-
-				for (int k = 0; k < index_count; k++) {
-					int index = index_rptr[k];
-					ERR_FAIL_INDEX(index, vertex_count);
-					index_wptr[k] = vertex_remap[index];
-				}
+			index_count = indices.size();
+			index_rptr = indices.ptr();
+			new_indices.resize(indices.size());
+			index_wptr = new_indices.ptrw();
 
-				lods[surfaces[i].lods[j].distance] = new_indices;
+			for (int k = 0; k < index_count; k++) {
+				int index = index_rptr[k];
+				ERR_FAIL_INDEX(index, vertex_count);
+				index_wptr[k] = vertex_remap[index];
 			}
-		}
 
-		shadow_mesh->add_surface(surfaces[i].primitive, new_surface, Array(), lods, Ref<Material>(), surfaces[i].name, surfaces[i].flags);
+			lods[p_data->surfaces[p_index].lods[j].distance] = new_indices;
+		}
 	}
+
+	ShadowSurface &shadow_surface = p_data->shadow_surfaces[p_index];
+	shadow_surface.arrays = new_surface;
+	shadow_surface.lods = lods;
+	shadow_surface.valid = true;
 }
 
 Ref<ImporterMesh> ImporterMesh::get_shadow_mesh() const {
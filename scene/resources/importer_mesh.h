@@ -82,6 +82,50 @@ class ImporterMesh : public Resource {
 
 	Size2i lightmap_size_hint;
 
+	struct LODGenerationData {
+		Surface *surfaces = nullptr;
+		float normal_merge_angle = 0.0f;
+		float normal_split_angle = 0.0f;
+		LocalVector<Transform3D> bone_transforms;
+		uint32_t params_hash = 0;
+	};
+
+	// Shared by all meshes, so reimporting an unchanged mesh skips the simplifier.
+	struct LODCacheEntry {
+		// The key is only a hash, so the inputs are kept to verify a hit.
+		Array arrays;
+		uint32_t flags = 0;
+		uint32_t params_hash = 0;
+		float normal_merge_angle = 0.0f;
+		float normal_split_angle = 0.0f;
+		LocalVector<Transform3D> bone_transforms;
+		uint32_t index_count = 0;
+
+		Vector<Surface::LOD> lods;
+		LocalVector<int> split_vertex_indices;
+		LocalVector<Vector3> split_vertex_normals;
+	};
+	static const uint64_t LOD_CACHE_MAX_INDICES = 1 << 24;
+	static Mutex lod_cache_mutex;
+	static HashMap<uint32_t, LODCacheEntry> lod_cache;
+	static uint64_t lod_cache_index_count;
+
+	static bool _lod_cache_entry_matches(const LODCacheEntry &p_entry, const Surface &p_surface, const LODGenerationData *p_data);
+	void _generate_surface_lods(uint32_t p_index, LODGenerationData *p_data);
+
+	struct ShadowSurface {
+		Array arrays;
+		Dictionary lods;
+		bool valid = false;
+	};
+
+	struct ShadowMeshData {
+		const Surface *surfaces = nullptr;
+		LocalVector<ShadowSurface> shadow_surfaces;
+	};
+
+	void _create_shadow_surface(uint32_t p_index, ShadowMeshData *p_data);
+
 protected:
 	void _set_data(const Dictionary &p_data);
 	Dictionary _get_data() const;
@@ -89,6 +133,8 @@ protected:
 	static void _bind_methods();
 
 public:
+	static void clear_lod_cache();
+
 	void add_blend_shape(const String &p_name);
 	int get_blend_shape_count() const;
 	String get_blend_shape_name(int p_blend_shape) const;
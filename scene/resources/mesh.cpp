@@ -31,6 +31,7 @@
 #include "mesh.h"
 
 #include "core/math/convex_hull.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/pair.h"
 #include "scene/resources/surface_tool.h"
 
@@ -894,43 +895,94 @@ void Mesh::clear_cache() const {
 	debug_lines.clear();
 }
 
-Vector<Ref<Shape3D>> Mesh::convex_decompose(const Ref<MeshConvexDecompositionSettings> &p_settings) const {
-	ERR_FAIL_NULL_V(convex_decomposition_function, Vector<Ref<Shape3D>>());
-
+bool Mesh::_get_convex_decomposition_input(ConvexDecomposition &r_decomposition) const {
 	Ref<TriangleMesh> tm = generate_triangle_mesh();
-	ERR_FAIL_COND_V(!tm.is_valid(), Vector<Ref<Shape3D>>());
+	ERR_FAIL_COND_V(!tm.is_valid(), false);
 
 	const Vector<TriangleMesh::Triangle> &triangles = tm->get_triangles();
 	int triangle_count = triangles.size();
 
-	Vector<uint32_t> indices;
-	{
-		indices.resize(triangle_count * 3);
-		uint32_t *w = indices.ptrw();
-		for (int i = 0; i < triangle_count; i++) {
-			for (int j = 0; j < 3; j++) {
-				w[i * 3 + j] = triangles[i].indices[j];
-			}
+	r_decomposition.indices.resize(triangle_count * 3);
+	uint32_t *w = r_decomposition.indices.ptrw();
+	for (int i = 0; i < triangle_count; i++) {
+		for (int j = 0; j < 3; j++) {
+			w[i * 3 + j] = triangles[i].indices[j];
 		}
 	}
 
-	const Vector<Vector3> &vertices = tm->get_vertices();
-	int vertex_count = vertices.size();
-
-	Vector<Vector<Vector3>> decomposed = convex_decomposition_function((real_t *)vertices.ptr(), vertex_count, indices.ptr(), triangle_count, p_settings, nullptr);
+	r_decomposition.vertices = tm->get_vertices();
+	return true;
+}
 
+Vector<Ref<Shape3D>> Mesh::_create_convex_decomposition_shapes(const Vector<Vector<Vector3>> &p_hulls) {
 	Vector<Ref<Shape3D>> ret;
 
-	for (int i = 0; i < decomposed.size(); i++) {
+	for (int i = 0; i < p_hulls.size(); i++) {
 		Ref<ConvexPolygonShape3D> shape;
 		shape.instantiate();
-		shape->set_points(decomposed[i]);
+		shape->set_points(p_hulls[i]);
 		ret.push_back(shape);
 	}
 
 	return ret;
 }
 
+void Mesh::_convex_decompose_task(void *p_batch, uint32_t p_index) {
+	ConvexDecompositionBatch *batch = (ConvexDecompositionBatch *)p_batch;
+	ConvexDecomposition &decomposition = batch->decompositions[p_index];
+	if (decomposition.indices.is_empty()) {
+		return;
+	}
+	decomposition.hulls = convex_decomposition_function((real_t *)decomposition.vertices.ptr(), decomposition.vertices.size(), decomposition.indices.ptr(), decomposition.indices.size() / 3, batch->settings, nullptr);
+}
+
+Vector<Ref<Shape3D>> Mesh::convex_decompose(const Ref<MeshConvexDecompositionSettings> &p_settings) const {
+	ERR_FAIL_NULL_V(convex_decomposition_function, Vector<Ref<Shape3D>>());
+
+	ConvexDecomposition decomposition;
+	if (!_get_convex_decomposition_input(decomposition)) {
+		return Vector<Ref<Shape3D>>();
+	}
+
+	ConvexDecompositionBatch batch;
+	batch.decompositions = &decomposition;
+	batch.settings = p_settings;
+	_convex_decompose_task(&batch, 0);
+
+	return _create_convex_decomposition_shapes(decomposition.hulls);
+}
+
+Vector<Vector<Ref<Shape3D>>> Mesh::convex_decompose_meshes(const Vector<Ref<Mesh>> &p_meshes, const Ref<MeshConvexDecompositionSettings> &p_settings) {
+	Vector<Vector<Ref<Shape3D>>> ret;
+	ERR_FAIL_NULL_V(convex_decomposition_function, ret);
+
+	// Gathering the triangles and creating the shapes touch the meshes and the servers, so only the decompositions run on other threads.
+	LocalVector<ConvexDecomposition> decompositions;
+	decompositions.resize(p_meshes.size());
+	for (int i = 0; i < p_meshes.size(); i++) {
+		ERR_CONTINUE(p_meshes[i].is_null());
+		p_meshes[i]->_get_convex_decomposition_input(decompositions[i]);
+	}
+
+	ConvexDecompositionBatch batch;
+	batch.decompositions = decompositions.ptr();
+	batch.settings = p_settings;
+	if (decompositions.size() < 2) {
+		for (uint32_t i = 0; i < decompositions.size(); i++) {
+			_convex_decompose_task(&batch, i);
+		}
+	} else {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&Mesh::_convex_decompose_task, &batch, decompositions.size(), -1, true, SNAME("MeshConvexDecomposition"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
+	ret.resize(decompositions.size());
+	for (uint32_t i = 0; i < decompositions.size(); i++) {
+		ret.write[i] = _create_convex_decomposition_shapes(decompositions[i].hulls);
+	}
+	return ret;
+}
+
 int Mesh::get_builtin_bind_pose_count() const {
 	return 0;
 }
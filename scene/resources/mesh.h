@@ -52,6 +52,21 @@ class Mesh : public Resource {
 
 	Vector<Vector3> _get_faces() const;
 
+	struct ConvexDecomposition {
+		Vector<Vector3> vertices;
+		Vector<uint32_t> indices;
+		Vector<Vector<Vector3>> hulls;
+	};
+
+	struct ConvexDecompositionBatch {
+		ConvexDecomposition *decompositions = nullptr;
+		Ref<MeshConvexDecompositionSettings> settings;
+	};
+
+	bool _get_convex_decomposition_input(ConvexDecomposition &r_decomposition) const;
+	static Vector<Ref<Shape3D>> _create_convex_decomposition_shapes(const Vector<Vector<Vector3>> &p_hulls);
+	static void _convex_decompose_task(void *p_batch, uint32_t p_index);
+
 public:
 	enum PrimitiveType {
 		PRIMITIVE_POINTS = RenderingServer::PRIMITIVE_POINTS,
@@ -186,6 +201,8 @@ public:
 	static ConvexDecompositionFunc convex_decomposition_function;
 
 	Vector<Ref<Shape3D>> convex_decompose(const Ref<MeshConvexDecompositionSettings> &p_settings) const;
+	// Decomposes every mesh with the same settings, the decompositions run in parallel on the WorkerThreadPool.
+	static Vector<Vector<Ref<Shape3D>>> convex_decompose_meshes(const Vector<Ref<Mesh>> &p_meshes, const Ref<MeshConvexDecompositionSettings> &p_settings);
 	Ref<ConvexPolygonShape3D> create_convex_shape(bool p_clean = true, bool p_simplify = false) const;
 	Ref<ConcavePolygonShape3D> create_trimesh_shape() const;
 
@@ -123,6 +123,77 @@ Ref<Resource> SceneState::get_remap_resource(const Ref<Resource> &p_resource, Ha
 	return remap_resource;
 }
 
+const SceneState::InstantiationPlan *SceneState::_get_instantiation_plan() const {
+	const void *class_tables = ClassDB::get_lookup_tables_id();
+	if (!class_tables) {
+		return nullptr;
+	}
+
+	MutexLock lock(instantiation_plan_mutex);
+	if (!instantiation_plans.is_empty() && instantiation_plans[instantiation_plans.size() - 1]->class_tables == class_tables) {
+		return instantiation_plans[instantiation_plans.size() - 1];
+	}
+
+	InstantiationPlan *plan = memnew(InstantiationPlan);
+	plan->class_tables = class_tables;
+	plan->nodes.resize(nodes.size());
+
+	for (int i = 0; i < nodes.size(); i++) {
+		const NodeData &n = nodes[i];
+		if ((i == 0 && base_scene_idx >= 0) || n.instance >= 0 || n.type == TYPE_INSTANTIATED || n.type < 0 || n.type >= names.size()) {
+			continue; // Not created by this scene.
+		}
+
+		const ClassDB::ClassInfo *class_info = ClassDB::get_instantiable_class_info(names[n.type]);
+		if (!class_info || !ClassDB::is_parent_class(class_info->name, SNAME("Node"))) {
+			continue; // Let instantiate() handle the error or the placeholder.
+		}
+
+		InstantiationPlan::NodePlan &node_plan = plan->nodes[i];
+		node_plan.class_info = class_info;
+		if (class_info->gdextension) {
+			continue; // Extensions can override set(), always go through Object::set.
+		}
+
+		node_plan.setters.resize(n.properties.size());
+		for (int j = 0; j < n.properties.size(); j++) {
+			const NodeData::Property &prop = n.properties[j];
+			node_plan.setters[j] = nullptr;
+			if ((prop.name & FLAG_PATH_PROPERTY_IS_NODE) || prop.name < 0 || prop.name >= names.size() || names[prop.name] == CoreStringNames::get_singleton()->_script) {
+				continue;
+			}
+			const ClassDB::PropertySetGet *psg = ClassDB::get_property_setget(class_info->name, names[prop.name]);
+			if (psg && psg->_setptr) {
+				node_plan.setters[j] = psg;
+			}
+		}
+	}
+
+	instantiation_plans.push_back(plan);
+	return plan;
+}
+
+void SceneState::_clear_instantiation_plans() {
+	MutexLock lock(instantiation_plan_mutex);
+	for (InstantiationPlan *plan : instantiation_plans) {
+		memdelete(plan);
+	}
+	instantiation_plans.clear();
+}
+
+// Same as ClassDB::set_property, with the setter already resolved.
+static void _set_planned_property(Object *p_object, const ClassDB::PropertySetGet *p_psg, const Variant &p_value) {
+	Callable::CallError ce;
+	if (p_psg->index >= 0) {
+		Variant index = p_psg->index;
+		const Variant *arg[2] = { &index, &p_value };
+		p_psg->_setptr->call(p_object, arg, 2, ce);
+	} else {
+		const Variant *arg[1] = { &p_value };
+		p_psg->_setptr->call(p_object, arg, 1, ce);
+	}
+}
+
 Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	// Nodes where instantiation failed (because something is missing.)
 	List<Node *> stray_instances;
@@ -164,8 +235,12 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 	LocalVector<DeferredNodePathProperties> deferred_node_paths;
 
+	// The editor needs the generic paths, which also record what was set.
+	const InstantiationPlan *plan = p_edit_state == GEN_EDIT_STATE_DISABLED ? _get_instantiation_plan() : nullptr;
+
 	for (int i = 0; i < nc; i++) {
 		const NodeData &n = nd[i];
+		const InstantiationPlan::NodePlan *node_plan = plan ? &plan->nodes[i] : nullptr;
 
 		Node *parent = nullptr;
 		String old_parent_path;
@@ -234,7 +309,7 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			}
 		} else {
 			//node belongs to this scene and must be created
-			Object *obj = ClassDB::instantiate(snames[n.type]);
+			Object *obj = node_plan && node_plan->class_info ? ClassDB::instantiate_class_info(node_plan->class_info) : ClassDB::instantiate(snames[n.type]);
 
 			node = Object::cast_to<Node>(obj);
 
@@ -377,7 +452,11 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 						}
 
 						if (set_valid) {
-							node->set(snames[nprops[j].name], value, &valid);
+							if (node_plan && j < (int)node_plan->setters.size() && node_plan->setters[j] && !node->get_script_instance()) {
+								_set_planned_property(node, node_plan->setters[j], value);
+							} else {
+								node->set(snames[nprops[j].name], value, &valid);
+							}
 						}
 					}
 				}
@@ -1128,6 +1207,7 @@ void SceneState::clear() {
 	node_paths.clear();
 	editable_instances.clear();
 	base_scene_idx = -1;
+	_clear_instantiation_plans();
 }
 
 Error SceneState::copy_from(const Ref<SceneState> &p_scene_state) {
@@ -1328,6 +1408,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 	ERR_FAIL_COND(!p_dictionary.has("conns"));
 	//ERR_FAIL_COND( !p_dictionary.has("path"));
 
+	_clear_instantiation_plans();
+
 	int version = 1;
 	if (p_dictionary.has("version")) {
 		version = p_dictionary["version"];
@@ -1774,6 +1856,7 @@ Vector<NodePath> SceneState::get_editable_instances() const {
 //add
 
 int SceneState::add_name(const StringName &p_name) {
+	_clear_instantiation_plans();
 	names.push_back(p_name);
 	return names.size() - 1;
 }
@@ -1797,6 +1880,7 @@ int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int
 	nd.instance = p_instance;
 	nd.index = p_index;
 
+	_clear_instantiation_plans();
 	nodes.push_back(nd);
 
 	return nodes.size() - 1;
@@ -1813,6 +1897,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 		prop.name |= FLAG_PATH_PROPERTY_IS_NODE;
 	}
 	prop.value = p_value;
+	_clear_instantiation_plans();
 	nodes.write[p_node].properties.push_back(prop);
 }
 
@@ -1824,6 +1909,7 @@ void SceneState::add_node_group(int p_node, int p_group) {
 
 void SceneState::set_base_scene(int p_idx) {
 	ERR_FAIL_INDEX(p_idx, variants.size());
+	_clear_instantiation_plans();
 	base_scene_idx = p_idx;
 }
 
@@ -1894,6 +1980,10 @@ void SceneState::_bind_methods() {
 SceneState::SceneState() {
 }
 
+SceneState::~SceneState() {
+	_clear_instantiation_plans();
+}
+
 ////////////////
 
 void PackedScene::_set_bundled_scene(const Dictionary &p_scene) {
@@ -32,6 +32,8 @@
 #define PACKED_SCENE_H
 
 #include "core/io/resource.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
 #include "scene/main/node.h"
 
 class SceneState : public RefCounted {
@@ -89,6 +91,24 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+	// Class and setter lookups for the nodes this scene creates, resolved once and reused by instantiate().
+	struct InstantiationPlan {
+		struct NodePlan {
+			const ClassDB::ClassInfo *class_info = nullptr;
+			LocalVector<const ClassDB::PropertySetGet *> setters; // Per property, null when Object::set must be used.
+		};
+
+		const void *class_tables = nullptr;
+		LocalVector<NodePlan> nodes;
+	};
+
+	// Most recent last. Older plans are kept until the state changes, as other threads may still be using them.
+	mutable LocalVector<InstantiationPlan *> instantiation_plans;
+	mutable Mutex instantiation_plan_mutex;
+
+	const InstantiationPlan *_get_instantiation_plan() const;
+	void _clear_instantiation_plans();
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
@@ -215,6 +235,7 @@ public:
 #endif
 
 	SceneState();
+	~SceneState();
 };
 
 VARIANT_ENUM_CAST(SceneState::GenEditState)
@@ -788,7 +788,7 @@ void VisualShader::add_node(Type p_type, const Ref<VisualShaderNode> &p_node, co
 		input->shader_type = p_type;
 	}
 
-	n.node->connect_changed(callable_mp(this, &VisualShader::_queue_update));
+	n.node->connect_changed(callable_mp(this, &VisualShader::_node_changed).bind(p_type, p_id));
 
 	Ref<VisualShaderNodeCustom> custom = n.node;
 	if (custom.is_valid()) {
@@ -855,7 +855,7 @@ void VisualShader::remove_node(Type p_type, int p_id) {
 	Graph *g = &graph[p_type];
 	ERR_FAIL_COND(!g->nodes.has(p_id));
 
-	g->nodes[p_id].node->disconnect_changed(callable_mp(this, &VisualShader::_queue_update));
+	g->nodes[p_id].node->disconnect_changed(callable_mp(this, &VisualShader::_node_changed).bind(p_type, p_id));
 
 	g->nodes.erase(p_id);
 
@@ -928,8 +928,9 @@ void VisualShader::replace_node(Type p_type, int p_id, const StringName &p_new_c
 		}
 	}
 
-	vsn->connect_changed(callable_mp(this, &VisualShader::_queue_update));
+	vsn->connect_changed(callable_mp(this, &VisualShader::_node_changed).bind(p_type, p_id));
 	g->nodes[p_id].node = Ref<VisualShaderNode>(vsn);
+	g->nodes[p_id].code_dirty = true;
 
 	_queue_update();
 }
@@ -1131,6 +1132,7 @@ void VisualShader::set_mode(Mode p_mode) {
 	modes.clear();
 	flags.clear();
 	shader_mode = p_mode;
+	_clear_code_cache();
 	for (int i = 0; i < TYPE_MAX; i++) {
 		for (KeyValue<int, Node> &E : graph[i].nodes) {
 			Ref<VisualShaderNodeInput> input = E.value.node;
@@ -2003,6 +2005,31 @@ Error VisualShader::_write_node(Type type, StringBuilder *p_global_code, StringB
 		expanded_output_ports.insert(i, expanded);
 	}
 
+	const Node &node = graph[type].nodes[p_node];
+	bool use_cache = !p_for_preview && _is_node_code_cacheable(vsnode);
+	String signature;
+	if (use_cache) {
+		// Everything the local code depends on besides the node itself, which marks the cache dirty when changed.
+		for (int i = 0; i < input_count; i++) {
+			signature += (vsnode->is_input_port_connected(i) ? "1" : "0") + inputs[i] + ";";
+		}
+		for (int i = 0; i < initial_output_count; i++) {
+			signature += expanded_output_ports[i] ? "e" : "-";
+		}
+		signature += ";";
+		for (int i = 0; i < output_count; i++) {
+			signature += vsnode->is_output_port_connected(i) ? "1" : "0";
+		}
+
+		if (!node.code_dirty && node.cached_signature == signature) {
+			r_code += node.cached_code;
+			r_processed.insert(p_node);
+			return OK;
+		}
+	}
+
+	StringBuilder node_builder;
+
 	Vector<String> output_vars;
 	output_vars.resize(output_count);
 	String *outputs = output_vars.ptrw();
@@ -2060,28 +2087,28 @@ Error VisualShader::_write_node(Type type, StringBuilder *p_global_code, StringB
 			outputs[i] = "n_out" + itos(p_node) + "p" + itos(j);
 			switch (vsnode->get_output_port_type(i)) {
 				case VisualShaderNode::PORT_TYPE_SCALAR:
-					r_code += "	float " + outputs[i] + ";\n";
+					node_builder += "	float " + outputs[i] + ";\n";
 					break;
 				case VisualShaderNode::PORT_TYPE_SCALAR_INT:
-					r_code += "	int " + outputs[i] + ";\n";
+					node_builder += "	int " + outputs[i] + ";\n";
 					break;
 				case VisualShaderNode::PORT_TYPE_SCALAR_UINT:
-					r_code += "	uint " + outputs[i] + ";\n";
+					node_builder += "	uint " + outputs[i] + ";\n";
 					break;
 				case VisualShaderNode::PORT_TYPE_VECTOR_2D:
-					r_code += "	vec2 " + outputs[i] + ";\n";
+					node_builder += "	vec2 " + outputs[i] + ";\n";
 					break;
 				case VisualShaderNode::PORT_TYPE_VECTOR_3D:
-					r_code += "	vec3 " + outputs[i] + ";\n";
+					node_builder += "	vec3 " + outputs[i] + ";\n";
 					break;
 				case VisualShaderNode::PORT_TYPE_VECTOR_4D:
-					r_code += "	vec4 " + outputs[i] + ";\n";
+					node_builder += "	vec4 " + outputs[i] + ";\n";
 					break;
 				case VisualShaderNode::PORT_TYPE_BOOLEAN:
-					r_code += "	bool " + outputs[i] + ";\n";
+					node_builder += "	bool " + outputs[i] + ";\n";
 					break;
 				case VisualShaderNode::PORT_TYPE_TRANSFORM:
-					r_code += "	mat4 " + outputs[i] + ";\n";
+					node_builder += "	mat4 " + outputs[i] + ";\n";
 					break;
 				default:
 					break;
@@ -2106,8 +2133,8 @@ Error VisualShader::_write_node(Type type, StringBuilder *p_global_code, StringB
 
 	node_code += vsnode->generate_code(get_mode(), type, p_node, inputs, outputs, p_for_preview);
 	if (!node_code.is_empty()) {
-		r_code += node_name;
-		r_code += node_code;
+		node_builder += node_name;
+		node_builder += node_code;
 	}
 
 	for (int i = 0; i < output_count; i++) {
@@ -2116,13 +2143,13 @@ Error VisualShader::_write_node(Type type, StringBuilder *p_global_code, StringB
 				case VisualShaderNode::PORT_TYPE_VECTOR_2D: {
 					if (vsnode->is_output_port_connected(i + 1) || (p_for_preview && vsnode->get_output_port_for_preview() == (i + 1))) { // red-component
 						String r = "n_out" + itos(p_node) + "p" + itos(i + 1);
-						r_code += "	float " + r + " = n_out" + itos(p_node) + "p" + itos(i) + ".r;\n";
+						node_builder += "	float " + r + " = n_out" + itos(p_node) + "p" + itos(i) + ".r;\n";
 						outputs[i + 1] = r;
 					}
 
 					if (vsnode->is_output_port_connected(i + 2) || (p_for_preview && vsnode->get_output_port_for_preview() == (i + 2))) { // green-component
 						String g = "n_out" + itos(p_node) + "p" + itos(i + 2);
-						r_code += "	float " + g + " = n_out" + itos(p_node) + "p" + itos(i) + ".g;\n";
+						node_builder += "	float " + g + " = n_out" + itos(p_node) + "p" + itos(i) + ".g;\n";
 						outputs[i + 2] = g;
 					}
 
@@ -2131,19 +2158,19 @@ Error VisualShader::_write_node(Type type, StringBuilder *p_global_code, StringB
 				case VisualShaderNode::PORT_TYPE_VECTOR_3D: {
 					if (vsnode->is_output_port_connected(i + 1) || (p_for_preview && vsnode->get_output_port_for_preview() == (i + 1))) { // red-component
 						String r = "n_out" + itos(p_node) + "p" + itos(i + 1);
-						r_code += "	float " + r + " = n_out" + itos(p_node) + "p" + itos(i) + ".r;\n";
+						node_builder += "	float " + r + " = n_out" + itos(p_node) + "p" + itos(i) + ".r;\n";
 						outputs[i + 1] = r;
 					}
 
 					if (vsnode->is_output_port_connected(i + 2) || (p_for_preview && vsnode->get_output_port_for_preview() == (i + 2))) { // green-component
 						String g = "n_out" + itos(p_node) + "p" + itos(i + 2);
-						r_code += "	float " + g + " = n_out" + itos(p_node) + "p" + itos(i) + ".g;\n";
+						node_builder += "	float " + g + " = n_out" + itos(p_node) + "p" + itos(i) + ".g;\n";
 						outputs[i + 2] = g;
 					}
 
 					if (vsnode->is_output_port_connected(i + 3) || (p_for_preview && vsnode->get_output_port_for_preview() == (i + 3))) { // blue-component
 						String b = "n_out" + itos(p_node) + "p" + itos(i + 3);
-						r_code += "	float " + b + " = n_out" + itos(p_node) + "p" + itos(i) + ".b;\n";
+						node_builder += "	float " + b + " = n_out" + itos(p_node) + "p" + itos(i) + ".b;\n";
 						outputs[i + 3] = b;
 					}
 
@@ -2152,25 +2179,25 @@ Error VisualShader::_write_node(Type type, StringBuilder *p_global_code, StringB
 				case VisualShaderNode::PORT_TYPE_VECTOR_4D: {
 					if (vsnode->is_output_port_connected(i + 1) || (p_for_preview && vsnode->get_output_port_for_preview() == (i + 1))) { // red-component
 						String r = "n_out" + itos(p_node) + "p" + itos(i + 1);
-						r_code += "	float " + r + " = n_out" + itos(p_node) + "p" + itos(i) + ".r;\n";
+						node_builder += "	float " + r + " = n_out" + itos(p_node) + "p" + itos(i) + ".r;\n";
 						outputs[i + 1] = r;
 					}
 
 					if (vsnode->is_output_port_connected(i + 2) || (p_for_preview && vsnode->get_output_port_for_preview() == (i + 2))) { // green-component
 						String g = "n_out" + itos(p_node) + "p" + itos(i + 2);
-						r_code += "	float " + g + " = n_out" + itos(p_node) + "p" + itos(i) + ".g;\n";
+						node_builder += "	float " + g + " = n_out" + itos(p_node) + "p" + itos(i) + ".g;\n";
 						outputs[i + 2] = g;
 					}
 
 					if (vsnode->is_output_port_connected(i + 3) || (p_for_preview && vsnode->get_output_port_for_preview() == (i + 3))) { // blue-component
 						String b = "n_out" + itos(p_node) + "p" + itos(i + 3);
-						r_code += "	float " + b + " = n_out" + itos(p_node) + "p" + itos(i) + ".b;\n";
+						node_builder += "	float " + b + " = n_out" + itos(p_node) + "p" + itos(i) + ".b;\n";
 						outputs[i + 3] = b;
 					}
 
 					if (vsnode->is_output_port_connected(i + 4) || (p_for_preview && vsnode->get_output_port_for_preview() == (i + 4))) { // alpha-component
 						String a = "n_out" + itos(p_node) + "p" + itos(i + 4);
-						r_code += "	float " + a + " = n_out" + itos(p_node) + "p" + itos(i) + ".a;\n";
+						node_builder += "	float " + a + " = n_out" + itos(p_node) + "p" + itos(i) + ".a;\n";
 						outputs[i + 4] = a;
 					}
 
@@ -2183,7 +2210,16 @@ Error VisualShader::_write_node(Type type, StringBuilder *p_global_code, StringB
 	}
 
 	if (!node_code.is_empty()) {
-		r_code += "\n\n";
+		node_builder += "\n\n";
+	}
+
+	if (use_cache) {
+		node.cached_code = node_builder.as_string();
+		node.cached_signature = signature;
+		node.code_dirty = false;
+		r_code += node.cached_code;
+	} else {
+		r_code += node_builder.as_string();
 	}
 
 	r_processed.insert(p_node);
@@ -2647,7 +2683,28 @@ void VisualShader::_queue_update() {
 	call_deferred(SNAME("_update_shader"));
 }
 
+void VisualShader::_node_changed(Type p_type, int p_id) {
+	if (graph[p_type].nodes.has(p_id)) {
+		graph[p_type].nodes[p_id].code_dirty = true;
+	}
+	_queue_update();
+}
+
+void VisualShader::_clear_code_cache() {
+	for (int i = 0; i < TYPE_MAX; i++) {
+		for (KeyValue<int, Node> &E : graph[i].nodes) {
+			E.value.code_dirty = true;
+		}
+	}
+}
+
+bool VisualShader::_is_node_code_cacheable(const Ref<VisualShaderNode> &p_node) const {
+	// These generate code from state outside of the node (scripts, parameters and varyings of the shader).
+	return !Object::cast_to<VisualShaderNodeCustom>(p_node.ptr()) && !Object::cast_to<VisualShaderNodeParameterRef>(p_node.ptr()) && !Object::cast_to<VisualShaderNodeVarying>(p_node.ptr());
+}
+
 void VisualShader::rebuild() {
+	_clear_code_cache();
 	dirty.set();
 	_update_shader();
 }
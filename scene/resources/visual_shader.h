@@ -124,6 +124,11 @@ private:
 		Vector2 position;
 		LocalVector<int> prev_connected_nodes;
 		LocalVector<int> next_connected_nodes;
+
+		// Local code generated for this node, reused while the node is unchanged and its inputs and outputs are wired the same way.
+		mutable String cached_code;
+		mutable String cached_signature;
+		mutable bool code_dirty = true;
 	};
 
 	struct Graph {
@@ -146,6 +151,9 @@ private:
 
 	mutable SafeFlag dirty;
 	void _queue_update();
+	void _node_changed(Type p_type, int p_id);
+	void _clear_code_cache();
+	bool _is_node_code_cacheable(const Ref<VisualShaderNode> &p_node) const;
 
 	union ConnectionKey {
 		struct {
@@ -64,6 +64,7 @@ public:
 	};
 
 	virtual Error init() override;
+	virtual bool can_init_on_thread() const override { return true; }
 	virtual void start() override;
 	virtual int get_mix_rate() const override;
 	virtual SpeakerMode get_speaker_mode() const override;
@@ -0,0 +1,205 @@
+/**************************************************************************/
+/*  audio_mix.cpp                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "audio_mix.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AUDIO_MIX_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define AUDIO_MIX_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(AUDIO_MIX_SSE2) || defined(AUDIO_MIX_NEON)
+#define AUDIO_MIX_SIMD
+#endif
+
+#ifdef AUDIO_MIX_SIMD
+// Two stereo frames, laid out as l0, r0, l1, r1.
+#ifdef AUDIO_MIX_SSE2
+typedef __m128 FramePair;
+
+static _FORCE_INLINE_ FramePair _load(const AudioFrame *p_frames) { return _mm_loadu_ps(&p_frames->l); }
+static _FORCE_INLINE_ FramePair _load(const AudioFrame *p_a, const AudioFrame *p_b) {
+	return _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)&p_a->l), (const __m64 *)&p_b->l);
+}
+static _FORCE_INLINE_ void _store(AudioFrame *r_frames, FramePair p_v) { _mm_storeu_ps(&r_frames->l, p_v); }
+static _FORCE_INLINE_ FramePair _set(float p_l0, float p_r0, float p_l1, float p_r1) { return _mm_setr_ps(p_l0, p_r0, p_l1, p_r1); }
+static _FORCE_INLINE_ FramePair _splat(float p_v) { return _mm_set1_ps(p_v); }
+static _FORCE_INLINE_ FramePair _add(FramePair p_a, FramePair p_b) { return _mm_add_ps(p_a, p_b); }
+static _FORCE_INLINE_ FramePair _sub(FramePair p_a, FramePair p_b) { return _mm_sub_ps(p_a, p_b); }
+static _FORCE_INLINE_ FramePair _mul(FramePair p_a, FramePair p_b) { return _mm_mul_ps(p_a, p_b); }
+static _FORCE_INLINE_ FramePair _max(FramePair p_a, FramePair p_b) { return _mm_max_ps(p_a, p_b); }
+static _FORCE_INLINE_ FramePair _abs(FramePair p_v) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), p_v); }
+#else
+typedef float32x4_t FramePair;
+
+static _FORCE_INLINE_ FramePair _load(const AudioFrame *p_frames) { return vld1q_f32(&p_frames->l); }
+static _FORCE_INLINE_ FramePair _load(const AudioFrame *p_a, const AudioFrame *p_b) { return vcombine_f32(vld1_f32(&p_a->l), vld1_f32(&p_b->l)); }
+static _FORCE_INLINE_ void _store(AudioFrame *r_frames, FramePair p_v) { vst1q_f32(&r_frames->l, p_v); }
+static _FORCE_INLINE_ FramePair _set(float p_l0, float p_r0, float p_l1, float p_r1) {
+	const float v[4] = { p_l0, p_r0, p_l1, p_r1 };
+	return vld1q_f32(v);
+}
+static _FORCE_INLINE_ FramePair _splat(float p_v) { return vdupq_n_f32(p_v); }
+static _FORCE_INLINE_ FramePair _add(FramePair p_a, FramePair p_b) { return vaddq_f32(p_a, p_b); }
+static _FORCE_INLINE_ FramePair _sub(FramePair p_a, FramePair p_b) { return vsubq_f32(p_a, p_b); }
+static _FORCE_INLINE_ FramePair _mul(FramePair p_a, FramePair p_b) { return vmulq_f32(p_a, p_b); }
+static _FORCE_INLINE_ FramePair _max(FramePair p_a, FramePair p_b) { return vmaxq_f32(p_a, p_b); }
+static _FORCE_INLINE_ FramePair _abs(FramePair p_v) { return vabsq_f32(p_v); }
+#endif
+#endif
+
+static _FORCE_INLINE_ AudioFrame _interpolate_cubic(const AudioFrame *p_src, float p_mu) {
+	const AudioFrame &y0 = p_src[0];
+	const AudioFrame &y1 = p_src[1];
+	const AudioFrame &y2 = p_src[2];
+	const AudioFrame &y3 = p_src[3];
+
+	float mu2 = p_mu * p_mu;
+	AudioFrame a0 = 3 * y1 - 3 * y2 + y3 - y0;
+	AudioFrame a1 = 2 * y0 - 5 * y1 + 4 * y2 - y3;
+	AudioFrame a2 = y2 - y0;
+	AudioFrame a3 = 2 * y1;
+
+	return (a0 * p_mu * mu2 + a1 * mu2 + a2 * p_mu + a3) / 2;
+}
+
+void AudioMix::mix_ramp(AudioFrame *r_dst, const AudioFrame *p_src, AudioFrame p_vol_start, AudioFrame p_vol_final, uint32_t p_count) {
+	uint32_t i = 0;
+#ifdef AUDIO_MIX_SIMD
+	const float inv_count = 1.0f / p_count;
+	const FramePair vol_start = _set(p_vol_start.l, p_vol_start.r, p_vol_start.l, p_vol_start.r);
+	const FramePair vol_final = _set(p_vol_final.l, p_vol_final.r, p_vol_final.l, p_vol_final.r);
+	const FramePair one = _splat(1.0f);
+	for (; i + 1 < p_count; i += 2) {
+		const FramePair lerp = _set(i * inv_count, i * inv_count, (i + 1) * inv_count, (i + 1) * inv_count);
+		const FramePair vol = _add(_mul(vol_final, lerp), _mul(_sub(one, lerp), vol_start));
+		_store(r_dst + i, _add(_load(r_dst + i), _mul(vol, _load(p_src + i))));
+	}
+#endif
+	for (; i < p_count; i++) {
+		float lerp = (float)i / p_count;
+		r_dst[i] += (p_vol_final * lerp + (1 - lerp) * p_vol_start) * p_src[i];
+	}
+}
+
+void AudioMix::mix(AudioFrame *r_dst, const AudioFrame *p_src, uint32_t p_count) {
+	uint32_t i = 0;
+#ifdef AUDIO_MIX_SIMD
+	for (; i + 1 < p_count; i += 2) {
+		_store(r_dst + i, _add(_load(r_dst + i), _load(p_src + i)));
+	}
+#endif
+	for (; i < p_count; i++) {
+		r_dst[i] += p_src[i];
+	}
+}
+
+AudioFrame AudioMix::scale_and_get_peak(AudioFrame *p_buffer, float p_volume, uint32_t p_count) {
+	AudioFrame peak = AudioFrame(0, 0);
+	uint32_t i = 0;
+#ifdef AUDIO_MIX_SIMD
+	const FramePair volume = _splat(p_volume);
+	FramePair peak_pair = _splat(0.0f);
+	for (; i + 1 < p_count; i += 2) {
+		const FramePair v = _mul(_load(p_buffer + i), volume);
+		_store(p_buffer + i, v);
+		peak_pair = _max(peak_pair, _abs(v));
+	}
+	AudioFrame peaks[2];
+	_store(peaks, peak_pair);
+	peak = AudioFrame(MAX(peaks[0].l, peaks[1].l), MAX(peaks[0].r, peaks[1].r));
+#endif
+	for (; i < p_count; i++) {
+		p_buffer[i] *= p_volume;
+
+		float l = ABS(p_buffer[i].l);
+		if (l > peak.l) {
+			peak.l = l;
+		}
+		float r = ABS(p_buffer[i].r);
+		if (r > peak.r) {
+			peak.r = r;
+		}
+	}
+	return peak;
+}
+
+void AudioMix::interpolate_cubic(const AudioFrame *p_src, AudioFrame *r_dst, uint64_t p_offset, uint64_t p_increment, uint32_t p_fp_bits, uint32_t p_count) {
+	const uint64_t fp_mask = (uint64_t(1) << p_fp_bits) - 1;
+	const float inv_fp_len = 1.0f / float(uint64_t(1) << p_fp_bits); // A power of two, so this matches dividing.
+	uint32_t i = 0;
+#ifdef AUDIO_MIX_SIMD
+	const FramePair two = _splat(2.0f);
+	const FramePair three = _splat(3.0f);
+	const FramePair four = _splat(4.0f);
+	const FramePair five = _splat(5.0f);
+	const FramePair half = _splat(0.5f);
+	for (; i + 1 < p_count; i += 2) {
+		const uint64_t offset0 = p_offset + i * p_increment;
+		const uint64_t offset1 = offset0 + p_increment;
+		const AudioFrame *src0 = p_src + (offset0 >> p_fp_bits);
+		const AudioFrame *src1 = p_src + (offset1 >> p_fp_bits);
+		const float mu0 = (offset0 & fp_mask) * inv_fp_len;
+		const float mu1 = (offset1 & fp_mask) * inv_fp_len;
+
+		const FramePair y0 = _load(src0, src1);
+		const FramePair y1 = _load(src0 + 1, src1 + 1);
+		const FramePair y2 = _load(src0 + 2, src1 + 2);
+		const FramePair y3 = _load(src0 + 3, src1 + 3);
+
+		const FramePair mu = _set(mu0, mu0, mu1, mu1);
+		const FramePair mu2 = _mul(mu, mu);
+		const FramePair a0 = _sub(_add(_sub(_mul(three, y1), _mul(three, y2)), y3), y0);
+		const FramePair a1 = _sub(_add(_sub(_mul(two, y0), _mul(five, y1)), _mul(four, y2)), y3);
+		const FramePair a2 = _sub(y2, y0);
+		const FramePair a3 = _mul(two, y1);
+
+		const FramePair r = _add(_add(_add(_mul(_mul(a0, mu), mu2), _mul(a1, mu2)), _mul(a2, mu)), a3);
+		_store(r_dst + i, _mul(r, half));
+	}
+#endif
+	for (; i < p_count; i++) {
+		const uint64_t offset = p_offset + i * p_increment;
+		r_dst[i] = _interpolate_cubic(p_src + (offset >> p_fp_bits), (offset & fp_mask) * inv_fp_len);
+	}
+}
+
+const char *AudioMix::get_backend_name() {
+#if defined(AUDIO_MIX_SSE2)
+	return "SSE2";
+#elif defined(AUDIO_MIX_NEON)
+	return "NEON";
+#else
+	return "Scalar";
+#endif
+}
@@ -0,0 +1,52 @@
+/**************************************************************************/
+/*  audio_mix.h                                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef AUDIO_MIX_H
+#define AUDIO_MIX_H
+
+#include "core/math/audio_frame.h"
+
+// Vectorized loops for the per-voice and per-bus hot paths of the mixer, processing two frames at a time.
+// Each kernel falls back to scalar code doing the same operations in the same order.
+class AudioMix {
+public:
+	// r_dst[i] += p_src[i] * volume, the volume going linearly from p_vol_start at 0 towards p_vol_final at p_count.
+	static void mix_ramp(AudioFrame *r_dst, const AudioFrame *p_src, AudioFrame p_vol_start, AudioFrame p_vol_final, uint32_t p_count);
+	// r_dst[i] += p_src[i].
+	static void mix(AudioFrame *r_dst, const AudioFrame *p_src, uint32_t p_count);
+	// p_buffer[i] *= p_volume, returns the largest absolute value of each channel after scaling.
+	static AudioFrame scale_and_get_peak(AudioFrame *p_buffer, float p_volume, uint32_t p_count);
+	// Cubic interpolation at the fixed point positions p_offset + i * p_increment, position k reads p_src[k] to p_src[k + 3].
+	static void interpolate_cubic(const AudioFrame *p_src, AudioFrame *r_dst, uint64_t p_offset, uint64_t p_increment, uint32_t p_fp_bits, uint32_t p_count);
+
+	static const char *get_backend_name();
+};
+
+#endif // AUDIO_MIX_H
@@ -32,6 +32,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/os/os.h"
+#include "servers/audio/audio_mix.h"
 
 void AudioStreamPlayback::start(double p_from_pos) {
 	if (GDVIRTUAL_CALL(_start, p_from_pos)) {
@@ -76,6 +77,21 @@ int AudioStreamPlayback::mix(AudioFrame *p_buffer, float p_rate_scale, int p_fra
 	return ret;
 }
 
+int AudioStreamPlayback::skip(float p_rate_scale, int p_frames) {
+	// Playbacks that can't move forward any faster are mixed into a scratch buffer.
+	AudioFrame buffer[256];
+	int skipped = 0;
+	while (skipped < p_frames) {
+		int frames = MIN(p_frames - skipped, 256);
+		int mixed = mix(buffer, p_rate_scale, frames);
+		skipped += mixed;
+		if (mixed < frames) {
+			break;
+		}
+	}
+	return skipped;
+}
+
 void AudioStreamPlayback::tag_used_streams() {
 	GDVIRTUAL_CALL(_tag_used_streams);
 }
@@ -93,14 +109,78 @@ void AudioStreamPlayback::_bind_methods() {
 //////////////////////////////
 
 void AudioStreamPlaybackResampled::begin_resample() {
+	stop_decode_ahead();
+	if (_can_decode_ahead() && AudioServer::get_singleton()->is_decode_ahead_enabled()) {
+		if (decode_buffer.size() == 0) {
+			decode_buffer.resize(DECODE_AHEAD_BUFFER_POWER);
+		}
+		decode_buffer.clear();
+		decode_ended.clear();
+		decode_ahead.set();
+	}
+
 	//clear cubic interpolation history
 	internal_buffer[0] = AudioFrame(0.0, 0.0);
 	internal_buffer[1] = AudioFrame(0.0, 0.0);
 	internal_buffer[2] = AudioFrame(0.0, 0.0);
 	internal_buffer[3] = AudioFrame(0.0, 0.0);
 	//mix buffer
-	_mix_internal(internal_buffer + 4, INTERNAL_BUFFER_LEN);
+	_read_decoded(internal_buffer + 4, INTERNAL_BUFFER_LEN);
 	mix_offset = 0;
+
+	if (decode_ahead.is_set()) {
+		AudioServer::get_singleton()->add_decode_ahead_stream(this);
+	}
+}
+
+void AudioStreamPlaybackResampled::stop_decode_ahead() {
+	if (decode_ahead.is_set()) {
+		// Waits for the decode thread to be done with this stream.
+		AudioServer::get_singleton()->remove_decode_ahead_stream(this);
+		decode_ahead.clear();
+	}
+}
+
+int AudioStreamPlaybackResampled::get_decode_ahead_frames() const {
+	return decode_ahead.is_set() ? decode_buffer.data_left() : 0;
+}
+
+bool AudioStreamPlaybackResampled::decode_ahead_step() {
+	MutexLock lock(decode_mutex);
+	if (decode_ended.is_set() || decode_buffer.space_left() < DECODE_AHEAD_CHUNK) {
+		return false;
+	}
+	AudioFrame chunk[DECODE_AHEAD_CHUNK];
+	int mixed = _mix_internal(chunk, DECODE_AHEAD_CHUNK);
+	decode_buffer.write(chunk, mixed);
+	if (mixed < DECODE_AHEAD_CHUNK) {
+		decode_ended.set();
+	}
+	return true;
+}
+
+int AudioStreamPlaybackResampled::_read_decoded(AudioFrame *p_buffer, int p_frames) {
+	if (!decode_ahead.is_set()) {
+		return _mix_internal(p_buffer, p_frames);
+	}
+
+	int read = decode_buffer.read(p_buffer, p_frames);
+	if (read < p_frames) {
+		// Underrun or end of stream, decode the rest here like when decoding ahead is disabled.
+		MutexLock lock(decode_mutex);
+		read += decode_buffer.read(p_buffer + read, p_frames - read);
+		if (read < p_frames && !decode_ended.is_set()) {
+			int mixed = _mix_internal(p_buffer + read, p_frames - read);
+			if (mixed < p_frames - read) {
+				decode_ended.set();
+			}
+			read += mixed;
+		}
+		for (int i = read; i < p_frames; i++) {
+			p_buffer[i] = AudioFrame(0, 0);
+		}
+	}
+	return read;
 }
 
 int AudioStreamPlaybackResampled::_mix_internal(AudioFrame *p_buffer, int p_frames) {
@@ -129,38 +209,40 @@ int AudioStreamPlaybackResampled::mix(AudioFrame *p_buffer, float p_rate_scale,
 
 	int mixed_frames_total = -1;
 
-	int i;
-	for (i = 0; i < p_frames; i++) {
-		uint32_t idx = CUBIC_INTERP_HISTORY + uint32_t(mix_offset >> FP_BITS);
-		//standard cubic interpolation (great quality/performance ratio)
-		//this used to be moved to a LUT for greater performance, but nowadays CPU speed is generally faster than memory.
-		float mu = (mix_offset & FP_MASK) / float(FP_LEN);
-		AudioFrame y0 = internal_buffer[idx - 3];
-		AudioFrame y1 = internal_buffer[idx - 2];
-		AudioFrame y2 = internal_buffer[idx - 1];
-		AudioFrame y3 = internal_buffer[idx - 0];
-
-		if (idx >= internal_buffer_end && mixed_frames_total == -1) {
-			// The internal buffer ends somewhere in this range, and we haven't yet recorded the number of good frames we have.
-			mixed_frames_total = i;
+	int i = 0;
+	while (i < p_frames) {
+		// Frames that can be interpolated before the internal buffer has to be refilled.
+		int frames = p_frames - i;
+		if (mix_increment > 0) {
+			uint64_t buffer_left = (uint64_t(INTERNAL_BUFFER_LEN) << FP_BITS) - mix_offset;
+			frames = MIN(frames, int((buffer_left + mix_increment - 1) / mix_increment));
 		}
 
-		float mu2 = mu * mu;
-		AudioFrame a0 = 3 * y1 - 3 * y2 + y3 - y0;
-		AudioFrame a1 = 2 * y0 - 5 * y1 + 4 * y2 - y3;
-		AudioFrame a2 = y2 - y0;
-		AudioFrame a3 = 2 * y1;
-
-		p_buffer[i] = (a0 * mu * mu2 + a1 * mu2 + a2 * mu + a3) / 2;
+		if (internal_buffer_end != (unsigned int)-1 && mixed_frames_total == -1) {
+			// The internal buffer ends somewhere, record the number of good frames we have if it ends in this range.
+			uint64_t end_offset = internal_buffer_end > CUBIC_INTERP_HISTORY ? (uint64_t(internal_buffer_end - CUBIC_INTERP_HISTORY) << FP_BITS) : 0;
+			if (mix_offset >= end_offset) {
+				mixed_frames_total = i;
+			} else if (mix_increment > 0) {
+				uint64_t end_frame = (end_offset - mix_offset + mix_increment - 1) / mix_increment;
+				if (end_frame < uint64_t(frames)) {
+					mixed_frames_total = i + int(end_frame);
+				}
+			}
+		}
 
-		mix_offset += mix_increment;
+		//standard cubic interpolation (great quality/performance ratio)
+		//this used to be moved to a LUT for greater performance, but nowadays CPU speed is generally faster than memory.
+		AudioMix::interpolate_cubic(internal_buffer + CUBIC_INTERP_HISTORY - 3, p_buffer + i, mix_offset, mix_increment, FP_BITS, frames);
+		mix_offset += frames * mix_increment;
+		i += frames;
 
 		while ((mix_offset >> FP_BITS) >= INTERNAL_BUFFER_LEN) {
 			internal_buffer[0] = internal_buffer[INTERNAL_BUFFER_LEN + 0];
 			internal_buffer[1] = internal_buffer[INTERNAL_BUFFER_LEN + 1];
 			internal_buffer[2] = internal_buffer[INTERNAL_BUFFER_LEN + 2];
 			internal_buffer[3] = internal_buffer[INTERNAL_BUFFER_LEN + 3];
-			int mixed_frames = _mix_internal(internal_buffer + 4, INTERNAL_BUFFER_LEN);
+			int mixed_frames = _read_decoded(internal_buffer + 4, INTERNAL_BUFFER_LEN);
 			if (mixed_frames != INTERNAL_BUFFER_LEN) {
 				// internal_buffer[mixed_frames] is the first frame of silence.
 				internal_buffer_end = mixed_frames;
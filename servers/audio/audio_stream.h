@@ -33,6 +33,9 @@
 
 #include "core/io/image.h"
 #include "core/io/resource.h"
+#include "core/os/mutex.h"
+#include "core/templates/ring_buffer.h"
+#include "core/templates/safe_refcount.h"
 #include "servers/audio/audio_filter_sw.h"
 #include "servers/audio_server.h"
 
@@ -67,6 +70,8 @@ public:
 	virtual void tag_used_streams();
 
 	virtual int mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames);
+	// Moves the playback forward as mix() would without producing audio, used for virtual voices.
+	virtual int skip(float p_rate_scale, int p_frames);
 };
 
 class AudioStreamPlaybackResampled : public AudioStreamPlayback {
@@ -77,19 +82,36 @@ class AudioStreamPlaybackResampled : public AudioStreamPlayback {
 		FP_LEN = (1 << FP_BITS),
 		FP_MASK = FP_LEN - 1,
 		INTERNAL_BUFFER_LEN = 128, // 128 warrants 3ms positional jitter at much at 44100hz
-		CUBIC_INTERP_HISTORY = 4
+		CUBIC_INTERP_HISTORY = 4,
+		DECODE_AHEAD_BUFFER_POWER = 12, // 4096 frames, about 90ms at 44100hz
+		DECODE_AHEAD_CHUNK = 256
 	};
 
 	AudioFrame internal_buffer[INTERNAL_BUFFER_LEN + CUBIC_INTERP_HISTORY];
 	unsigned int internal_buffer_end = -1;
 	uint64_t mix_offset = 0;
 
+	// Frames decoded ahead of the mix by the AudioServer decode thread, so the audio thread only copies them.
+	RingBuffer<AudioFrame> decode_buffer;
+	Mutex decode_mutex;
+	SafeFlag decode_ahead;
+	SafeFlag decode_ended;
+
+	int _read_decoded(AudioFrame *p_buffer, int p_frames);
+
 protected:
 	void begin_resample();
 	// Returns the number of frames that were mixed.
 	virtual int _mix_internal(AudioFrame *p_buffer, int p_frames);
 	virtual float get_stream_sampling_rate();
 
+	// Streams whose _mix_internal() can run on any thread return true to be decoded ahead when enabled in the project settings.
+	virtual bool _can_decode_ahead() const { return false; }
+	// Must be called before touching the decoder state outside of _mix_internal(), and on destruction.
+	void stop_decode_ahead();
+	// Frames decoded but not resampled yet.
+	int get_decode_ahead_frames() const;
+
 	GDVIRTUAL2R(int, _mix_resampled, GDExtensionPtr<AudioFrame>, int)
 	GDVIRTUAL0RC(float, _get_stream_sampling_rate)
 
@@ -98,6 +120,9 @@ protected:
 public:
 	virtual int mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames) override;
 
+	// Called by the AudioServer decode thread, returns false when the buffer is full or the stream ended.
+	bool decode_ahead_step();
+
 	AudioStreamPlaybackResampled() { mix_offset = 0; }
 };
 
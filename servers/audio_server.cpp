@@ -32,6 +32,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/debugger/engine_debugger.h"
+#include "core/debugger/trace_recorder.h"
 #include "core/error/error_macros.h"
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
@@ -39,9 +40,12 @@
 #include "core/os/os.h"
 #include "core/string/string_name.h"
 #include "core/templates/pair.h"
+#include "core/templates/sort_array.h"
 #include "scene/resources/audio_stream_wav.h"
 #include "scene/scene_string_names.h"
 #include "servers/audio/audio_driver_dummy.h"
+#include "servers/audio/audio_mix.h"
+#include "servers/audio/audio_stream.h"
 #include "servers/audio/effects/audio_effect_compressor.h"
 
 #include <cstring>
@@ -184,6 +188,7 @@ AudioDriver *AudioDriverManager::drivers[MAX_DRIVERS] = {
 	&AudioDriverManager::dummy_driver,
 };
 int AudioDriverManager::driver_count = 1;
+Thread AudioDriverManager::init_thread;
 
 void AudioDriverManager::add_driver(AudioDriver *p_driver) {
 	ERR_FAIL_COND(driver_count >= MAX_DRIVERS);
@@ -197,11 +202,41 @@ int AudioDriverManager::get_driver_count() {
 	return driver_count;
 }
 
-void AudioDriverManager::initialize(int p_driver) {
+void AudioDriverManager::_define_settings() {
 	GLOBAL_DEF_RST("audio/driver/enable_input", false);
 	GLOBAL_DEF_RST("audio/driver/mix_rate", DEFAULT_MIX_RATE);
 	GLOBAL_DEF_RST("audio/driver/mix_rate.web", 0); // Safer default output_latency for web (use browser default).
+}
+
+void AudioDriverManager::initialize(int p_driver) {
+	_define_settings();
+	_init_driver(p_driver);
+}
+
+void AudioDriverManager::_init_thread_func(void *p_driver) {
+	_init_driver((int)(intptr_t)p_driver);
+}
+
+bool AudioDriverManager::initialize_threaded(int p_driver) {
+	// Any of them may be tried if the selected one fails.
+	for (int i = 0; i < driver_count; i++) {
+		if (!drivers[i]->can_init_on_thread()) {
+			return false;
+		}
+	}
 
+	_define_settings();
+	init_thread.start(&AudioDriverManager::_init_thread_func, (void *)(intptr_t)p_driver);
+	return true;
+}
+
+void AudioDriverManager::wait_for_initialization() {
+	if (init_thread.is_started()) {
+		init_thread.wait_to_finish();
+	}
+}
+
+void AudioDriverManager::_init_driver(int p_driver) {
 	int failed_driver = -1;
 
 	// Check if there is a selected driver
@@ -243,6 +278,9 @@ AudioDriver *AudioDriverManager::get_driver(int p_driver) {
 //////////////////////////////////////////////
 
 void AudioServer::_driver_process(int p_frames, int32_t *p_buffer) {
+	TRACE_ZONE("AudioServer::mix");
+	MEMORY_TAG_SCOPE("Audio");
+
 	mix_count++;
 	int todo = p_frames;
 
@@ -305,7 +343,7 @@ void AudioServer::_driver_process(int p_frames, int32_t *p_buffer) {
 }
 
 void AudioServer::_mix_step() {
-	bool solo_mode = false;
+	solo_mode = false;
 
 	for (int i = 0; i < buses.size(); i++) {
 		Bus *bus = buses[i];
@@ -345,13 +383,41 @@ void AudioServer::_mix_step() {
 		ci->callback(ci->userdata);
 	}
 
+	if (max_audible_voices > 0) {
+		_update_voices();
+	}
+
 	for (AudioStreamPlaybackListNode *playback : playback_list) {
 		// Paused streams are no-ops. Don't even mix audio from the stream playback.
 		if (playback->state.load() == AudioStreamPlaybackListNode::PAUSED) {
 			continue;
 		}
 
+		if (playback->virtual_voice) {
+			if (playback->state.load() != AudioStreamPlaybackListNode::PLAYING) {
+				// Already silent, so there is nothing to fade out before pausing or deleting.
+				_update_playback_state(playback);
+				continue;
+			}
+			if (!playback->audible) {
+				if (playback->stream_playback->skip(playback->pitch_scale.get(), buffer_size) != (int)buffer_size) {
+					playback->state.store(AudioStreamPlaybackListNode::AWAITING_DELETION);
+					_update_playback_state(playback);
+				}
+				continue;
+			}
+
+			// The voice came back, the previous volumes are zero so it fades in.
+			playback->virtual_voice = false;
+			for (int i = 0; i < LOOKAHEAD_BUFFER_SIZE; i++) {
+				playback->lookahead[i] = AudioFrame(0, 0);
+			}
+		}
+
 		bool fading_out = playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION || playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE;
+		// A voice becoming virtual fades out during this mix like a stopping one.
+		bool virtualizing = !playback->audible && playback->state.load() == AudioStreamPlaybackListNode::PLAYING;
+		fading_out = fading_out || virtualizing;
 
 		AudioFrame *buf = mix_buffer.ptrw();
 
@@ -458,156 +524,292 @@ void AudioServer::_mix_step() {
 			std::copy(std::begin(bus_details.volume[bus_idx]), std::end(bus_details.volume[bus_idx]), std::begin(playback->prev_bus_details->volume[bus_idx]));
 		}
 
-		switch (playback->state.load()) {
-			case AudioStreamPlaybackListNode::AWAITING_DELETION:
-			case AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION:
-				playback_list.erase(playback, [](AudioStreamPlaybackListNode *p) {
-					delete p->prev_bus_details;
-					delete p->bus_details;
-					p->stream_playback.unref();
-					delete p;
-				});
-				break;
-			case AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE: {
-				// Pause the stream.
-				AudioStreamPlaybackListNode::PlaybackState old_state, new_state;
-				do {
-					old_state = playback->state.load();
-					new_state = AudioStreamPlaybackListNode::PAUSED;
-				} while (!playback->state.compare_exchange_strong(/* expected= */ old_state, new_state));
-			} break;
-			case AudioStreamPlaybackListNode::PLAYING:
-			case AudioStreamPlaybackListNode::PAUSED:
-				// No-op!
-				break;
-		}
+		playback->virtual_voice = virtualizing;
+		_update_playback_state(playback);
 	}
 
-	for (int i = buses.size() - 1; i >= 0; i--) {
-		//go bus by bus
-		Bus *bus = buses[i];
+	if (decode_ahead_enabled) {
+		decode_semaphore.post();
+	}
 
-		for (int k = 0; k < bus->channels.size(); k++) {
-			if (bus->channels[k].active && !bus->channels[k].used) {
-				//buffer was not used, but it's still active, so it must be cleaned
-				AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+	if (bus_workers.is_empty()) {
+		for (int i = buses.size() - 1; i >= 0; i--) {
+			//go bus by bus
+			_mix_step_bus_effects(buses[i], temp_buffer);
+			_mix_step_bus_send(buses[i]);
+		}
+	} else {
+		// A bus only sends to buses with a lower index, so its depth is computed after the one of its send.
+		bus_depths.resize(buses.size());
+		int max_depth = 0;
+		for (int i = 0; i < buses.size(); i++) {
+			Bus *send = _get_bus_send(i);
+			bus_depths[i] = send ? bus_depths[send->index_cache] + 1 : 0;
+			max_depth = MAX(max_depth, bus_depths[i]);
+		}
 
-				for (uint32_t j = 0; j < buffer_size; j++) {
-					buf[j] = AudioFrame(0, 0);
+		for (int depth = max_depth; depth >= 0; depth--) {
+			bus_work.clear();
+			bool sidechain = false;
+			for (int i = buses.size() - 1; i >= 0; i--) {
+				if (bus_depths[i] == depth) {
+					bus_work.push_back(buses[i]);
+					sidechain = sidechain || _bus_has_sidechain(buses[i]);
 				}
 			}
-		}
 
-		//process effects
-		if (!bus->bypass) {
-			for (int j = 0; j < bus->effects.size(); j++) {
-				if (!bus->effects[j].enabled) {
-					continue;
+			if (sidechain || bus_work.size() == 1) {
+				// A sidechain reads another bus, which may be processed at the same time.
+				for (Bus *bus : bus_work) {
+					_mix_step_bus_effects(bus, temp_buffer);
 				}
-
-#ifdef DEBUG_ENABLED
-				uint64_t ticks = OS::get_singleton()->get_ticks_usec();
-#endif
-
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
-						continue;
-					}
-					bus->channels.write[k].effect_instances.write[j]->process(bus->channels[k].buffer.ptr(), temp_buffer.write[k].ptrw(), buffer_size);
+			} else {
+				const uint32_t worker_count = MIN(bus_workers.size(), bus_work.size() - 1);
+				bus_work_next.set(0);
+				for (uint32_t i = 0; i < worker_count; i++) {
+					bus_work_semaphore.post();
 				}
-
-				//swap buffers, so internal buffer always has the right data
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(buses[i]->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
-						continue;
-					}
-					SWAP(bus->channels.write[k].buffer, temp_buffer.write[k]);
+				_process_bus_work(temp_buffer);
+				for (uint32_t i = 0; i < worker_count; i++) {
+					bus_done_semaphore.wait();
 				}
+			}
 
-#ifdef DEBUG_ENABLED
-				bus->effects.write[j].prof_time += OS::get_singleton()->get_ticks_usec() - ticks;
-#endif
+			// Buses of the same depth may send to the same bus, so sends are not done in parallel.
+			for (Bus *bus : bus_work) {
+				_mix_step_bus_send(bus);
 			}
 		}
+	}
 
-		//process send
+	mix_frames += buffer_size;
+	to_mix = buffer_size;
+}
 
-		Bus *send = nullptr;
+void AudioServer::_update_playback_state(AudioStreamPlaybackListNode *p_playback) {
+	switch (p_playback->state.load()) {
+		case AudioStreamPlaybackListNode::AWAITING_DELETION:
+		case AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION:
+			playback_list.erase(p_playback, [](AudioStreamPlaybackListNode *p) {
+				delete p->prev_bus_details;
+				delete p->bus_details;
+				p->stream_playback.unref();
+				delete p;
+			});
+			break;
+		case AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE: {
+			// Pause the stream.
+			AudioStreamPlaybackListNode::PlaybackState old_state, new_state;
+			do {
+				old_state = p_playback->state.load();
+				new_state = AudioStreamPlaybackListNode::PAUSED;
+			} while (!p_playback->state.compare_exchange_strong(/* expected= */ old_state, new_state));
+		} break;
+		case AudioStreamPlaybackListNode::PLAYING:
+		case AudioStreamPlaybackListNode::PAUSED:
+			// No-op!
+			break;
+	}
+}
 
-		if (i > 0) {
-			//everything has a send save for master bus
-			if (!bus_map.has(bus->send)) {
-				send = buses[0];
-			} else {
-				send = bus_map[bus->send];
-				if (send->index_cache >= bus->index_cache) { //invalid, send to master
-					send = buses[0];
-				}
-			}
+void AudioServer::_update_voices() {
+	voice_candidates.clear();
+	for (AudioStreamPlaybackListNode *playback : playback_list) {
+		playback->audible = true;
+		if (playback->state.load() != AudioStreamPlaybackListNode::PLAYING) {
+			continue;
 		}
 
-		for (int k = 0; k < bus->channels.size(); k++) {
-			if (!bus->channels[k].active) {
-				bus->channels.write[k].peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
+		// The players fold distance attenuation into the bus volumes, so the loudest of them tells how audible the voice is.
+		const AudioStreamPlaybackBusDetails *bus_details = playback->bus_details.load();
+		float loudness = 0.0f;
+		for (int idx = 0; bus_details && idx < MAX_BUSES_PER_PLAYBACK; idx++) {
+			if (!bus_details->bus_active[idx]) {
 				continue;
 			}
+			for (int channel_idx = 0; channel_idx < channel_count; channel_idx++) {
+				loudness = MAX(loudness, MAX(bus_details->volume[idx][channel_idx].l, bus_details->volume[idx][channel_idx].r));
+			}
+		}
+
+		if (loudness <= Math::db_to_linear(channel_disable_threshold_db)) {
+			playback->audible = false;
+			continue;
+		}
+
+		VoiceCandidate candidate;
+		candidate.playback = playback;
+		candidate.priority = playback->priority.get();
+		candidate.loudness = loudness;
+		voice_candidates.push_back(candidate);
+	}
+
+	if (voice_candidates.size() > (uint32_t)max_audible_voices) {
+		SortArray<VoiceCandidate> sorter;
+		sorter.nth_element(0, voice_candidates.size(), max_audible_voices, voice_candidates.ptr());
+		for (uint32_t i = max_audible_voices; i < voice_candidates.size(); i++) {
+			voice_candidates[i].playback->audible = false;
+		}
+	}
+}
+
+void AudioServer::_mix_step_bus_effects(Bus *p_bus, Vector<Vector<AudioFrame>> &r_temp_buffer) {
+	Bus *bus = p_bus;
 
+	for (int k = 0; k < bus->channels.size(); k++) {
+		if (bus->channels[k].active && !bus->channels[k].used) {
+			//buffer was not used, but it's still active, so it must be cleaned
 			AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
 
-			AudioFrame peak = AudioFrame(0, 0);
+			for (uint32_t j = 0; j < buffer_size; j++) {
+				buf[j] = AudioFrame(0, 0);
+			}
+		}
+	}
 
-			float volume = Math::db_to_linear(bus->volume_db);
+	//process effects
+	if (!bus->bypass) {
+		for (int j = 0; j < bus->effects.size(); j++) {
+			if (!bus->effects[j].enabled) {
+				continue;
+			}
 
-			if (solo_mode) {
-				if (!bus->soloed) {
-					volume = 0.0;
+#ifdef DEBUG_ENABLED
+			uint64_t ticks = OS::get_singleton()->get_ticks_usec();
+#endif
+
+			for (int k = 0; k < bus->channels.size(); k++) {
+				if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
+					continue;
 				}
-			} else {
-				if (bus->mute) {
-					volume = 0.0;
+				bus->channels.write[k].effect_instances.write[j]->process(bus->channels[k].buffer.ptr(), r_temp_buffer.write[k].ptrw(), buffer_size);
+			}
+
+			//swap buffers, so internal buffer always has the right data
+			for (int k = 0; k < bus->channels.size(); k++) {
+				if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
+					continue;
 				}
+				SWAP(bus->channels.write[k].buffer, r_temp_buffer.write[k]);
 			}
 
-			//apply volume and compute peak
-			for (uint32_t j = 0; j < buffer_size; j++) {
-				buf[j] *= volume;
+#ifdef DEBUG_ENABLED
+			bus->effects.write[j].prof_time += OS::get_singleton()->get_ticks_usec() - ticks;
+#endif
+		}
+	}
 
-				float l = ABS(buf[j].l);
-				if (l > peak.l) {
-					peak.l = l;
-				}
-				float r = ABS(buf[j].r);
-				if (r > peak.r) {
-					peak.r = r;
-				}
+	for (int k = 0; k < bus->channels.size(); k++) {
+		if (!bus->channels[k].active) {
+			bus->channels.write[k].peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
+			continue;
+		}
+
+		AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+
+		float volume = Math::db_to_linear(bus->volume_db);
+
+		if (solo_mode) {
+			if (!bus->soloed) {
+				volume = 0.0;
+			}
+		} else {
+			if (bus->mute) {
+				volume = 0.0;
 			}
+		}
 
-			bus->channels.write[k].peak_volume = AudioFrame(Math::linear_to_db(peak.l + AUDIO_PEAK_OFFSET), Math::linear_to_db(peak.r + AUDIO_PEAK_OFFSET));
+		//apply volume and compute peak
+		AudioFrame peak = AudioMix::scale_and_get_peak(buf, volume, buffer_size);
 
-			if (!bus->channels[k].used) {
-				//see if any audio is contained, because channel was not used
+		bus->channels.write[k].peak_volume = AudioFrame(Math::linear_to_db(peak.l + AUDIO_PEAK_OFFSET), Math::linear_to_db(peak.r + AUDIO_PEAK_OFFSET));
 
-				if (MAX(peak.r, peak.l) > Math::db_to_linear(channel_disable_threshold_db)) {
-					bus->channels.write[k].last_mix_with_audio = mix_frames;
-				} else if (mix_frames - bus->channels[k].last_mix_with_audio > channel_disable_frames) {
-					bus->channels.write[k].active = false;
-					continue; //went inactive, don't mix.
-				}
+		if (!bus->channels[k].used) {
+			//see if any audio is contained, because channel was not used
+
+			if (MAX(peak.r, peak.l) > Math::db_to_linear(channel_disable_threshold_db)) {
+				bus->channels.write[k].last_mix_with_audio = mix_frames;
+			} else if (mix_frames - bus->channels[k].last_mix_with_audio > channel_disable_frames) {
+				bus->channels.write[k].active = false; //went inactive, don't mix.
 			}
+		}
+	}
+}
 
-			if (send) {
-				//if not master bus, send
-				AudioFrame *target_buf = thread_get_channel_mix_buffer(send->index_cache, k);
+void AudioServer::_mix_step_bus_send(Bus *p_bus) {
+	//process send
+	Bus *send = _get_bus_send(p_bus->index_cache);
+	if (!send) {
+		return;
+	}
 
-				for (uint32_t j = 0; j < buffer_size; j++) {
-					target_buf[j] += buf[j];
-				}
+	for (int k = 0; k < p_bus->channels.size(); k++) {
+		if (p_bus->channels[k].active) {
+			AudioFrame *target_buf = thread_get_channel_mix_buffer(send->index_cache, k);
+			AudioMix::mix(target_buf, p_bus->channels[k].buffer.ptr(), buffer_size);
+		}
+	}
+}
+
+AudioServer::Bus *AudioServer::_get_bus_send(int p_bus) const {
+	if (p_bus == 0) {
+		return nullptr; //everything has a send save for master bus
+	}
+
+	Bus *const *send = bus_map.getptr(buses[p_bus]->send);
+	if (!send || (*send)->index_cache >= buses[p_bus]->index_cache) { //invalid, send to master
+		return buses[0];
+	}
+	return *send;
+}
+
+bool AudioServer::_bus_has_sidechain(const Bus *p_bus) const {
+	if (p_bus->bypass) {
+		return false;
+	}
+	for (const Bus::Effect &effect : p_bus->effects) {
+		const AudioEffectCompressor *compressor = Object::cast_to<AudioEffectCompressor>(effect.effect.ptr());
+		if (effect.enabled && compressor && compressor->get_sidechain() != StringName()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void AudioServer::_bus_worker_thread(void *p_worker) {
+	BusWorker *worker = (BusWorker *)p_worker;
+	while (true) {
+		singleton->bus_work_semaphore.wait();
+		if (singleton->bus_workers_exit.is_set()) {
+			break;
+		}
+		singleton->_process_bus_work(worker->temp_buffer);
+		singleton->bus_done_semaphore.post();
+	}
+}
+
+void AudioServer::_decode_thread(void *p_userdata) {
+	while (true) {
+		singleton->decode_semaphore.wait();
+		if (singleton->decode_exit.is_set()) {
+			break;
+		}
+		// Decode one chunk of every stream per round, so a single stream can't delay the others.
+		bool decoded = true;
+		while (decoded && !singleton->decode_exit.is_set()) {
+			decoded = false;
+			MutexLock lock(singleton->decode_mutex);
+			for (AudioStreamPlaybackResampled *playback : singleton->decode_streams) {
+				decoded = playback->decode_ahead_step() || decoded;
 			}
 		}
 	}
+}
 
-	mix_frames += buffer_size;
-	to_mix = buffer_size;
+void AudioServer::_process_bus_work(Vector<Vector<AudioFrame>> &r_temp_buffer) {
+	for (uint32_t i = bus_work_next.postincrement(); i < bus_work.size(); i = bus_work_next.postincrement()) {
+		_mix_step_bus_effects(bus_work[i], r_temp_buffer);
+	}
 }
 
 void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r) {
@@ -640,11 +842,8 @@ void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_sou
 		}
 
 	} else {
-		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
-			// Make this buffer size invariant if buffer_size ever becomes a project setting.
-			float lerp_param = (float)frame_idx / buffer_size;
-			p_out_buf[frame_idx] += (p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start) * p_source_buf[frame_idx];
-		}
+		// Make this buffer size invariant if buffer_size ever becomes a project setting.
+		AudioMix::mix_ramp(p_out_buf, p_source_buf, p_vol_start, p_vol_final, buffer_size);
 	}
 }
 
@@ -1254,6 +1453,17 @@ void AudioServer::set_playback_pitch_scale(Ref<AudioStreamPlayback> p_playback,
 	playback_node->pitch_scale.set(p_pitch_scale);
 }
 
+void AudioServer::set_playback_priority(Ref<AudioStreamPlayback> p_playback, float p_priority) {
+	ERR_FAIL_COND(p_playback.is_null());
+
+	AudioStreamPlaybackListNode *playback_node = _find_playback_list_node(p_playback);
+	if (!playback_node) {
+		return;
+	}
+
+	playback_node->priority.set(p_priority);
+}
+
 void AudioServer::set_playback_paused(Ref<AudioStreamPlayback> p_playback, bool p_paused) {
 	ERR_FAIL_COND(p_playback.is_null());
 
@@ -1321,6 +1531,25 @@ bool AudioServer::is_playback_paused(Ref<AudioStreamPlayback> p_playback) {
 	return playback_node->state.load() == AudioStreamPlaybackListNode::PAUSED || playback_node->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE;
 }
 
+bool AudioServer::is_decode_ahead_enabled() const {
+	return decode_ahead_enabled;
+}
+
+void AudioServer::add_decode_ahead_stream(AudioStreamPlaybackResampled *p_playback) {
+	ERR_FAIL_NULL(p_playback);
+	MutexLock lock(decode_mutex);
+	if (decode_streams.find(p_playback) == -1) {
+		decode_streams.push_back(p_playback);
+	}
+	decode_semaphore.post();
+}
+
+void AudioServer::remove_decode_ahead_stream(AudioStreamPlaybackResampled *p_playback) {
+	// The decode thread holds the lock while decoding, so the stream is no longer in use once this returns.
+	MutexLock lock(decode_mutex);
+	decode_streams.erase(p_playback);
+}
+
 uint64_t AudioServer::get_mix_count() const {
 	return mix_count;
 }
@@ -1344,6 +1573,13 @@ void AudioServer::init_channels_and_buffers() {
 		temp_buffer.write[i].resize(buffer_size);
 	}
 
+	for (BusWorker *worker : bus_workers) {
+		worker->temp_buffer.resize(channel_count);
+		for (int i = 0; i < channel_count; i++) {
+			worker->temp_buffer.write[i].resize(buffer_size);
+		}
+	}
+
 	for (int i = 0; i < buses.size(); i++) {
 		buses[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
@@ -1357,9 +1593,27 @@ void AudioServer::init() {
 	channel_disable_threshold_db = GLOBAL_DEF_RST("audio/buses/channel_disable_threshold_db", -60.0);
 	channel_disable_frames = float(GLOBAL_DEF_RST(PropertyInfo(Variant::FLOAT, "audio/buses/channel_disable_time", PROPERTY_HINT_RANGE, "0,5,0.01,or_greater"), 2.0)) * get_mix_rate();
 	buffer_size = 512; //hardcoded for now
+	max_audible_voices = GLOBAL_DEF(PropertyInfo(Variant::INT, "audio/general/max_audible_voices", PROPERTY_HINT_RANGE, "0,1024,1,or_greater"), 0);
+
+	int bus_thread_count = GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/buses/effect_processing_threads", PROPERTY_HINT_RANGE, "0,16,1"), 0);
+	for (int i = 0; i < bus_thread_count; i++) {
+		bus_workers.push_back(memnew(BusWorker));
+	}
+
+	decode_ahead_enabled = GLOBAL_DEF_RST("audio/general/decode_streams_ahead", false);
 
 	init_channels_and_buffers();
 
+	if (decode_ahead_enabled) {
+		decode_thread.start(&AudioServer::_decode_thread, nullptr);
+	}
+
+	Thread::Settings bus_thread_settings;
+	bus_thread_settings.priority = Thread::PRIORITY_HIGH;
+	for (BusWorker *worker : bus_workers) {
+		worker->thread.start(&AudioServer::_bus_worker_thread, worker, bus_thread_settings);
+	}
+
 	mix_count = 0;
 	set_bus_count(1);
 	set_bus_name(0, "Master");
@@ -1477,6 +1731,23 @@ void AudioServer::finish() {
 		AudioDriverManager::get_driver(i)->finish();
 	}
 
+	bus_workers_exit.set();
+	for (uint32_t i = 0; i < bus_workers.size(); i++) {
+		bus_work_semaphore.post();
+	}
+	for (BusWorker *worker : bus_workers) {
+		worker->thread.wait_to_finish();
+		memdelete(worker);
+	}
+	bus_workers.clear();
+
+	if (decode_thread.is_started()) {
+		decode_exit.set();
+		decode_semaphore.post();
+		decode_thread.wait_to_finish();
+	}
+	decode_streams.clear();
+
 	for (int i = 0; i < buses.size(); i++) {
 		memdelete(buses[i]);
 	}
@@ -34,6 +34,9 @@
 #include "core/math/audio_frame.h"
 #include "core/object/class_db.h"
 #include "core/os/os.h"
+#include "core/os/semaphore.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/safe_list.h"
 #include "core/variant/variant.h"
 #include "servers/audio/audio_effect.h"
@@ -45,6 +48,7 @@ class AudioDriverDummy;
 class AudioStream;
 class AudioStreamWAV;
 class AudioStreamPlayback;
+class AudioStreamPlaybackResampled;
 
 class AudioDriver {
 	static AudioDriver *singleton;
@@ -95,6 +99,8 @@ public:
 	virtual const char *get_name() const = 0;
 
 	virtual Error init() = 0;
+	// If true, init() may run on another thread than the main one, to overlap it with the rest of the startup.
+	virtual bool can_init_on_thread() const { return false; }
 	virtual void start() = 0;
 	virtual int get_mix_rate() const = 0;
 	virtual SpeakerMode get_speaker_mode() const = 0;
@@ -143,11 +149,21 @@ class AudioDriverManager {
 
 	static AudioDriverDummy dummy_driver;
 
+	static Thread init_thread;
+
+	static void _define_settings();
+	static void _init_driver(int p_driver);
+	static void _init_thread_func(void *p_driver);
+
 public:
 	static const int DEFAULT_MIX_RATE = 44100;
 
 	static void add_driver(AudioDriver *p_driver);
 	static void initialize(int p_driver);
+	// Starts initializing on a thread if all drivers allow it, returns false otherwise.
+	// In that case call initialize(), else wait_for_initialization() before using the driver.
+	static bool initialize_threaded(int p_driver);
+	static void wait_for_initialization();
 	static int get_driver_count();
 	static AudioDriver *get_driver(int p_driver);
 };
@@ -196,6 +212,8 @@ private:
 
 	bool tag_used_audio_streams = false;
 
+	bool solo_mode = false; // A bus is soloed during the current mix step.
+
 	struct Bus {
 		StringName name;
 		bool solo = false;
@@ -261,8 +279,26 @@ private:
 		AudioStreamPlaybackBusDetails *prev_bus_details = nullptr;
 		// The next few samples are stored here so we have some time to fade audio out if it ends abruptly at the beginning of the next mix.
 		AudioFrame lookahead[LOOKAHEAD_BUFFER_SIZE];
+		// Voices with a higher priority are kept audible first when there are more than max_audible_voices.
+		SafeNumeric<float> priority;
+		// Audio thread only. Virtual voices move forward without being mixed, until they become audible again.
+		bool audible = true;
+		bool virtual_voice = false;
+	};
+
+	struct VoiceCandidate {
+		AudioStreamPlaybackListNode *playback = nullptr;
+		float priority = 0.0f;
+		float loudness = 0.0f;
+
+		bool operator<(const VoiceCandidate &p_other) const {
+			return priority != p_other.priority ? priority > p_other.priority : loudness > p_other.loudness;
+		}
 	};
 
+	int max_audible_voices = 0;
+	LocalVector<VoiceCandidate> voice_candidates;
+
 	SafeList<AudioStreamPlaybackListNode *> playback_list;
 	SafeList<AudioStreamPlaybackBusDetails *> bus_details_graveyard;
 
@@ -274,13 +310,46 @@ private:
 	Vector<Bus *> buses;
 	HashMap<StringName, Bus *> bus_map;
 
+	// Buses of the same depth (distance to the master bus) don't feed each other, so their effects
+	// can run at the same time on a fixed set of threads owned by the server.
+	struct BusWorker {
+		Thread thread;
+		Vector<Vector<AudioFrame>> temp_buffer;
+	};
+
+	LocalVector<BusWorker *> bus_workers;
+	Semaphore bus_work_semaphore;
+	Semaphore bus_done_semaphore;
+	SafeFlag bus_workers_exit;
+	SafeNumeric<uint32_t> bus_work_next;
+	LocalVector<Bus *> bus_work; // Buses of the depth being processed.
+	LocalVector<int> bus_depths;
+
+	// Compressed streams are decoded ahead of the mix on this thread, see AudioStreamPlaybackResampled.
+	bool decode_ahead_enabled = false;
+	Thread decode_thread;
+	Mutex decode_mutex;
+	Semaphore decode_semaphore;
+	SafeFlag decode_exit;
+	LocalVector<AudioStreamPlaybackResampled *> decode_streams;
+
+	static void _bus_worker_thread(void *p_worker);
+	static void _decode_thread(void *p_userdata);
+	void _process_bus_work(Vector<Vector<AudioFrame>> &r_temp_buffer);
+
 	void _update_bus_effects(int p_bus);
+	Bus *_get_bus_send(int p_bus) const;
+	bool _bus_has_sidechain(const Bus *p_bus) const;
 
 	static AudioServer *singleton;
 
 	void init_channels_and_buffers();
 
 	void _mix_step();
+	void _update_voices();
+	void _update_playback_state(AudioStreamPlaybackListNode *p_playback);
+	void _mix_step_bus_effects(Bus *p_bus, Vector<Vector<AudioFrame>> &r_temp_buffer);
+	void _mix_step_bus_send(Bus *p_bus);
 	void _mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r);
 
 	// Should only be called on the main thread.
@@ -383,11 +452,16 @@ public:
 	void set_playback_pitch_scale(Ref<AudioStreamPlayback> p_playback, float p_pitch_scale);
 	void set_playback_paused(Ref<AudioStreamPlayback> p_playback, bool p_paused);
 	void set_playback_highshelf_params(Ref<AudioStreamPlayback> p_playback, float p_gain, float p_attenuation_cutoff_hz);
+	void set_playback_priority(Ref<AudioStreamPlayback> p_playback, float p_priority);
 
 	bool is_playback_active(Ref<AudioStreamPlayback> p_playback);
 	float get_playback_position(Ref<AudioStreamPlayback> p_playback);
 	bool is_playback_paused(Ref<AudioStreamPlayback> p_playback);
 
+	bool is_decode_ahead_enabled() const;
+	void add_decode_ahead_stream(AudioStreamPlaybackResampled *p_playback);
+	void remove_decode_ahead_stream(AudioStreamPlaybackResampled *p_playback);
+
 	uint64_t get_mix_count() const;
 	uint64_t get_mixed_frames() const;
 
@@ -53,6 +53,39 @@ Array ServersDebugger::ResourceUsage::serialize() {
 	return arr;
 }
 
+Array ServersDebugger::MemoryTagUsage::serialize() {
+	Array arr;
+	arr.push_back(ticks_usec);
+	arr.push_back(tags.size() * 4);
+	for (const MemoryTagInfo &E : tags) {
+		arr.push_back(E.name);
+		arr.push_back(E.usage);
+		arr.push_back(E.max_usage);
+		arr.push_back(E.allocations);
+	}
+	return arr;
+}
+
+bool ServersDebugger::MemoryTagUsage::deserialize(const Array &p_arr) {
+	CHECK_SIZE(p_arr, 2, "MemoryTagUsage");
+	ticks_usec = p_arr[0];
+	uint32_t size = p_arr[1];
+	ERR_FAIL_COND_V(size % 4, false);
+	CHECK_SIZE(p_arr, 2 + size, "MemoryTagUsage");
+	uint32_t idx = 2;
+	while (idx < 2 + size) {
+		MemoryTagInfo info;
+		info.name = p_arr[idx];
+		info.usage = p_arr[idx + 1];
+		info.max_usage = p_arr[idx + 2];
+		info.allocations = p_arr[idx + 3];
+		tags.push_back(info);
+		idx += 4;
+	}
+	CHECK_END(p_arr, idx, "MemoryTagUsage");
+	return true;
+}
+
 bool ServersDebugger::ResourceUsage::deserialize(const Array &p_arr) {
 	CHECK_SIZE(p_arr, 1, "ResourceUsage");
 	uint32_t size = p_arr[0];
@@ -400,6 +433,8 @@ Error ServersDebugger::_capture(void *p_user, const String &p_cmd, const Array &
 	r_captured = true;
 	if (p_cmd == "memory") {
 		singleton->_send_resource_usage();
+	} else if (p_cmd == "memory_tags") {
+		singleton->_send_memory_tag_usage();
 	} else if (p_cmd == "draw") { // Forced redraw.
 		// For camera override to stay live when the game is paused from the editor.
 		double delta = 0.0;
@@ -445,6 +480,22 @@ void ServersDebugger::_send_resource_usage() {
 	EngineDebugger::get_singleton()->send_message("servers:memory_usage", usage.serialize());
 }
 
+void ServersDebugger::_send_memory_tag_usage() {
+	ServersDebugger::MemoryTagUsage usage;
+	usage.ticks_usec = OS::get_singleton()->get_ticks_usec();
+
+	for (uint32_t i = 0; i < Memory::get_tag_count(); i++) {
+		ServersDebugger::MemoryTagInfo info;
+		info.name = Memory::get_tag_name(i);
+		info.usage = Memory::get_tag_usage(i);
+		info.max_usage = Memory::get_tag_max_usage(i);
+		info.allocations = Memory::get_tag_allocations(i);
+		usage.tags.push_back(info);
+	}
+
+	EngineDebugger::get_singleton()->send_message("servers:memory_tag_usage", usage.serialize());
+}
+
 ServersDebugger::ServersDebugger() {
 	singleton = this;
 
@@ -54,6 +54,26 @@ public:
 		bool deserialize(const Array &p_arr);
 	};
 
+	// Static memory, by the tags of Memory::register_tag().
+	struct MemoryTagInfo {
+		String name;
+		uint64_t usage = 0;
+		uint64_t max_usage = 0;
+		uint64_t allocations = 0;
+
+		struct CompareUsage {
+			_FORCE_INLINE_ bool operator()(const MemoryTagInfo &p_a, const MemoryTagInfo &p_b) const { return p_a.usage > p_b.usage; }
+		};
+	};
+
+	struct MemoryTagUsage {
+		uint64_t ticks_usec = 0;
+		Vector<MemoryTagInfo> tags;
+
+		Array serialize();
+		bool deserialize(const Array &p_arr);
+	};
+
 	// Script Profiler
 	struct ScriptFunctionSignature {
 		StringName name;
@@ -119,6 +139,7 @@ private:
 	static Error _capture(void *p_user, const String &p_cmd, const Array &p_data, bool &r_captured);
 
 	void _send_resource_usage();
+	void _send_memory_tag_usage();
 
 	ServersDebugger();
 
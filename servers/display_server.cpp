@@ -447,6 +447,10 @@ void DisplayServer::gl_window_make_current(DisplayServer::WindowID p_window_id)
 	// noop except in gles
 }
 
+void DisplayServer::gl_upload_context_make_current(bool p_current) {
+	// noop except in gles
+}
+
 void DisplayServer::window_set_ime_active(const bool p_active, WindowID p_window) {
 	WARN_PRINT("IME not supported by this display server.");
 }
@@ -444,6 +444,10 @@ public:
 	// necessary for GL focus, may be able to use one of the existing functions for this, not sure yet
 	virtual void gl_window_make_current(DisplayServer::WindowID p_window_id);
 
+	// Secondary context sharing objects with the main one, so resources can be uploaded from loader threads.
+	virtual bool gl_upload_context_is_available() const { return false; }
+	virtual void gl_upload_context_make_current(bool p_current);
+
 	virtual Point2i ime_get_selection() const;
 	virtual String ime_get_text() const;
 
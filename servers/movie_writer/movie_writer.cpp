@@ -124,6 +124,8 @@ void MovieWriter::begin(const Size2i &p_movie_size, uint32_t p_fps, const String
 	audio_channels = AudioDriverDummy::get_dummy_singleton()->get_channels();
 	audio_mix_buffer.resize(mix_rate * audio_channels / fps);
 
+	max_queued_frames = CLAMP(WorkerThreadPool::get_singleton()->get_thread_count(), 2, (int)MAX_QUEUED_FRAMES);
+
 	write_begin(p_movie_size, p_fps, p_base_path);
 }
 
@@ -192,10 +194,47 @@ void MovieWriter::add_frame() {
 	gpu_time += RenderingServer::get_singleton()->viewport_get_measured_render_time_gpu(main_vp_rid);
 
 	AudioDriverDummy::get_dummy_singleton()->mix_audio(mix_rate / fps, audio_mix_buffer.ptr());
-	write_frame(vp_tex, audio_mix_buffer.ptr());
+
+	if (!has_threaded_encoder()) {
+		write_frame(vp_tex, audio_mix_buffer.ptr());
+		return;
+	}
+
+	// Only wait for encoding when too many frames are queued, so rendering the next frames overlaps with it.
+	while (queued_frames.size() >= max_queued_frames) {
+		_write_oldest_queued_frame();
+	}
+
+	QueuedFrame *frame = memnew(QueuedFrame);
+	frame->image = vp_tex;
+	frame->audio = audio_mix_buffer;
+	frame->task = WorkerThreadPool::get_singleton()->add_template_task(this, &MovieWriter::_encode_queued_frame, frame, false, SNAME("MovieWriter encode frame"));
+	queued_frames.push_back(frame);
+
+	while (!queued_frames.is_empty() && WorkerThreadPool::get_singleton()->is_task_completed(queued_frames[0]->task)) {
+		_write_oldest_queued_frame();
+	}
+}
+
+void MovieWriter::_encode_queued_frame(QueuedFrame *p_frame) {
+	p_frame->encoded = encode_frame(p_frame->image);
+	p_frame->image.unref();
+}
+
+void MovieWriter::_write_oldest_queued_frame() {
+	QueuedFrame *frame = queued_frames[0];
+	queued_frames.remove_at(0);
+
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(frame->task);
+	write_encoded_frame(frame->encoded, frame->audio.ptr());
+	memdelete(frame);
 }
 
 void MovieWriter::end() {
+	while (!queued_frames.is_empty()) {
+		_write_oldest_queued_frame();
+	}
+
 	write_end();
 
 	// Print a report with various statistics.
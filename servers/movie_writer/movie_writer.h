@@ -31,6 +31,7 @@
 #ifndef MOVIE_WRITER_H
 #define MOVIE_WRITER_H
 
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/local_vector.h"
 #include "servers/audio/audio_driver_dummy.h"
 #include "servers/audio_server.h"
@@ -49,8 +50,23 @@ class MovieWriter : public Object {
 
 	LocalVector<int32_t> audio_mix_buffer;
 
+	// Frames being encoded on the WorkerThreadPool, oldest first. They are written in order once encoded.
+	struct QueuedFrame {
+		Ref<Image> image;
+		LocalVector<int32_t> audio;
+		Vector<uint8_t> encoded;
+		WorkerThreadPool::TaskID task = WorkerThreadPool::INVALID_TASK_ID;
+	};
+
+	LocalVector<QueuedFrame *> queued_frames;
+	uint32_t max_queued_frames = 0;
+
+	void _encode_queued_frame(QueuedFrame *p_frame);
+	void _write_oldest_queued_frame();
+
 	enum {
-		MAX_WRITERS = 8
+		MAX_WRITERS = 8,
+		MAX_QUEUED_FRAMES = 8, // Bounds memory use when encoding is slower than rendering, a 4K frame is 32 MiB.
 	};
 	static MovieWriter *writers[];
 	static uint32_t writer_count;
@@ -63,6 +79,12 @@ protected:
 	virtual Error write_frame(const Ref<Image> &p_image, const int32_t *p_audio_data);
 	virtual void write_end();
 
+	// Writers that can encode a frame without touching their own state return true here. Frames are then encoded
+	// in parallel with encode_frame() on worker threads, and passed in order to write_encoded_frame() instead of write_frame().
+	virtual bool has_threaded_encoder() const { return false; }
+	virtual Vector<uint8_t> encode_frame(const Ref<Image> &p_image) const { return Vector<uint8_t>(); }
+	virtual Error write_encoded_frame(const Vector<uint8_t> &p_encoded, const int32_t *p_audio_data) { return ERR_UNAVAILABLE; }
+
 	GDVIRTUAL0RC(uint32_t, _get_audio_mix_rate)
 	GDVIRTUAL0RC(AudioServer::SpeakerMode, _get_audio_speaker_mode)
 
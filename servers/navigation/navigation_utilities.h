@@ -66,6 +66,7 @@ struct PathQueryParameters {
 	Vector3 target_position;
 	uint32_t navigation_layers = 1;
 	BitField<PathMetadataFlags> metadata_flags = PATH_INCLUDE_ALL;
+	bool use_hierarchical_pathfinding = false;
 };
 
 struct PathQueryResult {
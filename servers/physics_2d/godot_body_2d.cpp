@@ -418,6 +418,8 @@ void GodotBody2D::_update_transform_dependent() {
 }
 
 void GodotBody2D::integrate_forces(real_t p_step) {
+	shape_motion_pending = false;
+
 	if (mode == PhysicsServer2D::BODY_MODE_STATIC) {
 		return;
 	}
@@ -603,27 +605,34 @@ void GodotBody2D::integrate_forces(real_t p_step) {
 	biased_angular_velocity = 0.0;
 	biased_linear_velocity = Vector2();
 
-	if (do_motion) { //shapes temporarily extend for raycast
-		_update_shapes_with_motion(motion);
+	if (do_motion) { //shapes temporarily extend for raycast, see finish_integrate_forces()
+		pending_shape_motion = motion;
+		shape_motion_pending = true;
 	}
 
 	contact_count = 0;
 }
 
+void GodotBody2D::finish_integrate_forces() {
+	if (shape_motion_pending) {
+		shape_motion_pending = false;
+		_update_shapes_with_motion(pending_shape_motion);
+	}
+}
+
 void GodotBody2D::integrate_velocities(real_t p_step) {
+	shapes_update_pending = false;
+	deactivation_pending = false;
+
 	if (mode == PhysicsServer2D::BODY_MODE_STATIC) {
 		return;
 	}
 
-	if (fi_callback_data || body_state_callback.get_object()) {
-		get_space()->body_add_to_state_query_list(&direct_state_query_list);
-	}
-
 	if (mode == PhysicsServer2D::BODY_MODE_KINEMATIC) {
 		_set_transform(new_transform, false);
 		_set_inv_transform(new_transform.affine_inverse());
 		if (contacts.size() == 0 && linear_velocity == Vector2() && angular_velocity == 0) {
-			set_active(false); //stopped moving, deactivate
+			deactivation_pending = true; //stopped moving, deactivate
 		}
 		return;
 	}
@@ -640,16 +649,38 @@ void GodotBody2D::integrate_velocities(real_t p_step) {
 		pos += center_of_mass - center_of_mass.rotated(angle_delta);
 	}
 
-	_set_transform(Transform2D(angle, pos), continuous_cd_mode == PhysicsServer2D::CCD_MODE_DISABLED);
+	_set_transform(Transform2D(angle, pos), false);
 	_set_inv_transform(get_transform().inverse());
 
 	if (continuous_cd_mode != PhysicsServer2D::CCD_MODE_DISABLED) {
 		new_transform = get_transform();
+	} else {
+		shapes_update_pending = true;
 	}
 
 	_update_transform_dependent();
 }
 
+void GodotBody2D::finish_integrate_velocities() {
+	if (mode == PhysicsServer2D::BODY_MODE_STATIC) {
+		return;
+	}
+
+	if (fi_callback_data || body_state_callback.get_object()) {
+		get_space()->body_add_to_state_query_list(&direct_state_query_list);
+	}
+
+	if (shapes_update_pending) {
+		shapes_update_pending = false;
+		_update_shapes();
+	}
+
+	if (deactivation_pending) {
+		deactivation_pending = false;
+		set_active(false);
+	}
+}
+
 void GodotBody2D::wakeup_neighbours() {
 	for (const Pair<GodotConstraint2D *, int> &E : constraint_list) {
 		const GodotConstraint2D *c = E.first;
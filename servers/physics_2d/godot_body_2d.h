@@ -106,6 +106,12 @@ class GodotBody2D : public GodotCollisionObject2D {
 	virtual void _shapes_changed() override;
 	Transform2D new_transform;
 
+	// Broadphase and space list updates left by integrate_forces() and integrate_velocities().
+	Vector2 pending_shape_motion;
+	bool shape_motion_pending = false;
+	bool shapes_update_pending = false;
+	bool deactivation_pending = false;
+
 	List<Pair<GodotConstraint2D *, int>> constraint_list;
 
 	struct AreaCMP {
@@ -315,8 +321,12 @@ public:
 	_FORCE_INLINE_ real_t get_friction() const { return friction; }
 	_FORCE_INLINE_ real_t get_bounce() const { return bounce; }
 
+	// These only touch the body itself, so bodies can be integrated in parallel.
+	// The matching finish call must then be made for each body, serially and in the active list order.
 	void integrate_forces(real_t p_step);
+	void finish_integrate_forces();
 	void integrate_velocities(real_t p_step);
+	void finish_integrate_velocities();
 
 	_FORCE_INLINE_ Vector2 get_velocity_in_local_point(const Vector2 &rel_pos) const {
 		return linear_velocity + Vector2(-angular_velocity * rel_pos.y, angular_velocity * rel_pos.x);
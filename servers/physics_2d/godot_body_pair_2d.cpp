@@ -59,19 +59,37 @@ void GodotBodyPair2D::_contact_added_callback(const Vector2 &p_point_A, const Ve
 	contact.used = true;
 
 	// Attempt to determine if the contact will be reused.
+	// The new point takes over the closest contact kept from the previous step, along with its
+	// accumulated impulses for warm starting. A point landing on a contact already found
+	// during this step is a duplicate.
 	real_t recycle_radius_2 = space->get_contact_recycle_radius() * space->get_contact_recycle_radius();
 
+	int reused = -1;
+	real_t reused_distance = 0.0;
 	for (int i = 0; i < contact_count; i++) {
-		Contact &c = contacts[i];
-		if (c.local_A.distance_squared_to(local_A) < (recycle_radius_2) &&
-				c.local_B.distance_squared_to(local_B) < (recycle_radius_2)) {
-			contact.acc_normal_impulse = c.acc_normal_impulse;
-			contact.acc_tangent_impulse = c.acc_tangent_impulse;
-			contact.acc_bias_impulse = c.acc_bias_impulse;
-			contact.acc_bias_impulse_center_of_mass = c.acc_bias_impulse_center_of_mass;
-			c = contact;
+		const Contact &c = contacts[i];
+		real_t distance_A = c.local_A.distance_squared_to(local_A);
+		real_t distance_B = c.local_B.distance_squared_to(local_B);
+		if (distance_A >= recycle_radius_2 || distance_B >= recycle_radius_2) {
+			continue;
+		}
+		if (c.used) {
 			return;
 		}
+		if (reused == -1 || distance_A + distance_B < reused_distance) {
+			reused = i;
+			reused_distance = distance_A + distance_B;
+		}
+	}
+
+	if (reused != -1) {
+		Contact &c = contacts[reused];
+		contact.acc_normal_impulse = c.acc_normal_impulse;
+		contact.acc_tangent_impulse = c.acc_tangent_impulse;
+		contact.acc_bias_impulse = c.acc_bias_impulse;
+		contact.acc_bias_impulse_center_of_mass = c.acc_bias_impulse_center_of_mass;
+		c = contact;
+		return;
 	}
 
 	// Figure out if the contact amount must be reduced to fit the new contact.
@@ -293,21 +311,44 @@ bool GodotBodyPair2D::setup(real_t p_step) {
 
 	bool prev_collided = collided;
 
-	collided = GodotCollisionSolver2D::solve(shape_A_ptr, xform_A, motion_A, shape_B_ptr, xform_B, motion_B, _add_contact, this, &sep_axis);
-	if (!collided) {
-		oneway_disabled = false;
+	// Neither shape moved or changed since the last step, and none of the contacts were discarded.
+	// This is common for touching bodies at rest, which don't need to run collision detection again.
+	bool cache_valid = prev_collided && contact_count == cache_contact_count && motion_A == Vector2() && motion_B == Vector2() &&
+			cache_offset_A == offset_A && cache_xform_A == xform_A && cache_xform_B == xform_B &&
+			cache_shape_A == shape_A_ptr && cache_shape_B == shape_B_ptr &&
+			cache_shape_version_A == shape_A_ptr->get_version() && cache_shape_version_B == shape_B_ptr->get_version();
 
-		if (A->get_continuous_collision_detection_mode() == PhysicsServer2D::CCD_MODE_CAST_RAY && collide_A) {
-			check_ccd = true;
-			return true;
+	if (cache_valid) {
+		for (int i = 0; i < contact_count; i++) {
+			contacts[i].used = true;
 		}
+	} else {
+		collided = GodotCollisionSolver2D::solve(shape_A_ptr, xform_A, motion_A, shape_B_ptr, xform_B, motion_B, _add_contact, this, &sep_axis);
+		if (!collided) {
+			cache_contact_count = -1;
+			oneway_disabled = false;
 
-		if (B->get_continuous_collision_detection_mode() == PhysicsServer2D::CCD_MODE_CAST_RAY && collide_B) {
-			check_ccd = true;
-			return true;
+			if (A->get_continuous_collision_detection_mode() == PhysicsServer2D::CCD_MODE_CAST_RAY && collide_A) {
+				check_ccd = true;
+				return true;
+			}
+
+			if (B->get_continuous_collision_detection_mode() == PhysicsServer2D::CCD_MODE_CAST_RAY && collide_B) {
+				check_ccd = true;
+				return true;
+			}
+
+			return false;
 		}
 
-		return false;
+		cache_offset_A = offset_A;
+		cache_xform_A = xform_A;
+		cache_xform_B = xform_B;
+		cache_shape_A = shape_A_ptr;
+		cache_shape_B = shape_B_ptr;
+		cache_shape_version_A = shape_A_ptr->get_version();
+		cache_shape_version_B = shape_B_ptr->get_version();
+		cache_contact_count = contact_count;
 	}
 
 	if (oneway_disabled) {
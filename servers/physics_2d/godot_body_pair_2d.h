@@ -84,6 +84,17 @@ class GodotBodyPair2D : public GodotConstraint2D {
 	bool oneway_disabled = false;
 	bool report_contacts_only = false;
 
+	// Placement of the shapes when the contacts were last generated. While it stays the same,
+	// collision detection would only find the same points again, so it's skipped.
+	Transform2D cache_xform_A;
+	Transform2D cache_xform_B;
+	Vector2 cache_offset_A;
+	const GodotShape2D *cache_shape_A = nullptr;
+	const GodotShape2D *cache_shape_B = nullptr;
+	uint64_t cache_shape_version_A = 0;
+	uint64_t cache_shape_version_B = 0;
+	int cache_contact_count = -1;
+
 	bool _test_ccd(real_t p_step, GodotBody2D *p_A, int p_shape_A, const Transform2D &p_xform_A, GodotBody2D *p_B, int p_shape_B, const Transform2D &p_xform_B);
 	void _validate_contacts();
 	static void _add_contact(const Vector2 &p_point_A, const Vector2 &p_point_B, void *p_self);
@@ -1270,6 +1270,8 @@ void GodotPhysicsServer2D::init() {
 }
 
 void GodotPhysicsServer2D::step(real_t p_step) {
+	MEMORY_TAG_SCOPE("Physics");
+
 	if (!active) {
 		return;
 	}
@@ -48,6 +48,7 @@ class GodotShape2D {
 	Rect2 aabb;
 	bool configured = false;
 	real_t custom_bias = 0.0;
+	uint64_t version = 0; // Increased every time the shape data changes.
 
 	HashMap<GodotShapeOwner2D *, int> owners;
 
@@ -66,6 +67,7 @@ public:
 
 	_FORCE_INLINE_ Rect2 get_aabb() const { return aabb; }
 	_FORCE_INLINE_ bool is_configured() const { return configured; }
+	_FORCE_INLINE_ uint64_t get_version() const { return version; }
 
 	virtual bool allows_one_way_collision() const { return true; }
 
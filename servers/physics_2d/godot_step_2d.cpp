@@ -38,6 +38,19 @@
 #define ISLAND_COUNT_RESERVE 128
 #define ISLAND_SIZE_RESERVE 512
 #define CONSTRAINT_COUNT_RESERVE 1024
+#define INTEGRATION_MIN_GRAIN 64
+
+void GodotStep2D::_integrate_forces(uint32_t p_from, uint32_t p_to, void *p_userdata) {
+	for (uint32_t body_index = p_from; body_index < p_to; ++body_index) {
+		active_bodies[body_index]->integrate_forces(delta);
+	}
+}
+
+void GodotStep2D::_integrate_velocities(uint32_t p_from, uint32_t p_to, void *p_userdata) {
+	for (uint32_t body_index = p_from; body_index < p_to; ++body_index) {
+		active_bodies[body_index]->integrate_velocities(delta);
+	}
+}
 
 void GodotStep2D::_populate_island(GodotBody2D *p_body, LocalVector<GodotBody2D *> &p_body_island, LocalVector<GodotConstraint2D *> &p_constraint_island) {
 	p_body->set_island_step(_step);
@@ -77,6 +90,12 @@ void GodotStep2D::_setup_constraint(uint32_t p_constraint_index, void *p_userdat
 	constraint->setup(delta);
 }
 
+void GodotStep2D::_setup_constraints(uint32_t p_from, uint32_t p_to, void *p_userdata) {
+	for (uint32_t constraint_index = p_from; constraint_index < p_to; ++constraint_index) {
+		_setup_constraint(constraint_index);
+	}
+}
+
 void GodotStep2D::_pre_solve_island(LocalVector<GodotConstraint2D *> &p_constraint_island) const {
 	uint32_t constraint_count = p_constraint_island.size();
 	uint32_t valid_constraint_count = 0;
@@ -101,6 +120,12 @@ void GodotStep2D::_solve_island(uint32_t p_island_index, void *p_userdata) const
 	}
 }
 
+void GodotStep2D::_solve_islands(uint32_t p_from, uint32_t p_to, void *p_userdata) const {
+	for (uint32_t island_index = p_from; island_index < p_to; ++island_index) {
+		_solve_island(island_index);
+	}
+}
+
 void GodotStep2D::_check_suspend(LocalVector<GodotBody2D *> &p_body_island) const {
 	bool can_sleep = true;
 
@@ -142,16 +167,22 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 	uint64_t profile_begtime = OS::get_singleton()->get_ticks_usec();
 	uint64_t profile_endtime = 0;
 
-	int active_count = 0;
-
+	active_bodies.clear();
 	const SelfList<GodotBody2D> *b = body_list->first();
 	while (b) {
-		b->self()->integrate_forces(p_delta);
+		active_bodies.push_back(b->self());
 		b = b->next();
-		active_count++;
 	}
 
-	p_space->set_active_objects(active_count);
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_range_group_task(this, &GodotStep2D::_integrate_forces, nullptr, active_bodies.size(), INTEGRATION_MIN_GRAIN, -1, true, SNAME("Physics2DIntegrateForces"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	// Broadphase updates aren't thread safe.
+	for (GodotBody2D *body : active_bodies) {
+		body->finish_integrate_forces();
+	}
+
+	p_space->set_active_objects(active_bodies.size());
 
 	// Update the broadphase to register collision pairs.
 	p_space->update();
@@ -240,7 +271,7 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 	/* SETUP CONSTRAINTS / PROCESS COLLISIONS */
 
 	uint32_t total_constraint_count = all_constraints.size();
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics2DConstraintSetup"));
+	group_task = WorkerThreadPool::get_singleton()->add_template_range_group_task(this, &GodotStep2D::_setup_constraints, nullptr, total_constraint_count, 16, -1, true, SNAME("Physics2DConstraintSetup"));
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	{ //profile
@@ -260,7 +291,7 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 
 	// Warning: _solve_island modifies the constraint islands for optimization purpose,
 	// their content is not reliable after these calls and shouldn't be used anymore.
-	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_solve_island, nullptr, island_count, -1, true, SNAME("Physics2DConstraintSolveIslands"));
+	group_task = WorkerThreadPool::get_singleton()->add_template_range_group_task(this, &GodotStep2D::_solve_islands, nullptr, island_count, 1, -1, true, SNAME("Physics2DConstraintSolveIslands"));
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	{ //profile
@@ -271,11 +302,19 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 
 	/* INTEGRATE VELOCITIES */
 
+	active_bodies.clear();
 	b = body_list->first();
 	while (b) {
-		const SelfList<GodotBody2D> *n = b->next();
-		b->self()->integrate_velocities(p_delta);
-		b = n; // in case it shuts itself down
+		active_bodies.push_back(b->self());
+		b = b->next();
+	}
+
+	group_task = WorkerThreadPool::get_singleton()->add_template_range_group_task(this, &GodotStep2D::_integrate_velocities, nullptr, active_bodies.size(), INTEGRATION_MIN_GRAIN, -1, true, SNAME("Physics2DIntegrateVelocities"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	// Shape updates and deactivation (which can shut a body down) are done serially, in list order.
+	for (GodotBody2D *body : active_bodies) {
+		body->finish_integrate_velocities();
 	}
 
 	/* SLEEP / WAKE UP ISLANDS */
@@ -0,0 +1,666 @@
+/**************************************************************************/
+/*  godot_contact_solver_3d.cpp                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "godot_contact_solver_3d.h"
+
+#if !defined(REAL_T_IS_DOUBLE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define CONTACT_SOLVER_SSE2
+#include <emmintrin.h>
+#endif
+
+#define MIN_VELOCITY 0.0001
+#define MAX_BIAS_ROTATION (Math_PI / 8)
+
+namespace {
+
+// One value per contact of a batch. Without SSE2 (or with doubles), the operations are
+// plain loops over the lanes, which compilers can still vectorize.
+#ifdef CONTACT_SOLVER_SSE2
+
+struct Lanes {
+	__m128 v;
+};
+
+struct LaneMask {
+	__m128 v;
+};
+
+_FORCE_INLINE_ Lanes lanes_load(const real_t *p_src) { return { _mm_loadu_ps(p_src) }; }
+_FORCE_INLINE_ void lanes_store(const Lanes &p_value, real_t *r_dst) { _mm_storeu_ps(r_dst, p_value.v); }
+_FORCE_INLINE_ Lanes lanes_splat(real_t p_value) { return { _mm_set1_ps(p_value) }; }
+
+_FORCE_INLINE_ Lanes operator+(const Lanes &p_a, const Lanes &p_b) { return { _mm_add_ps(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Lanes operator-(const Lanes &p_a, const Lanes &p_b) { return { _mm_sub_ps(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Lanes operator*(const Lanes &p_a, const Lanes &p_b) { return { _mm_mul_ps(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Lanes operator/(const Lanes &p_a, const Lanes &p_b) { return { _mm_div_ps(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Lanes operator-(const Lanes &p_a) { return { _mm_sub_ps(_mm_setzero_ps(), p_a.v) }; }
+
+_FORCE_INLINE_ Lanes lanes_max(const Lanes &p_a, const Lanes &p_b) { return { _mm_max_ps(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ Lanes lanes_abs(const Lanes &p_a) { return { _mm_andnot_ps(_mm_set1_ps(-0.0f), p_a.v) }; }
+_FORCE_INLINE_ Lanes lanes_sqrt(const Lanes &p_a) { return { _mm_sqrt_ps(p_a.v) }; }
+
+_FORCE_INLINE_ LaneMask operator>(const Lanes &p_a, const Lanes &p_b) { return { _mm_cmpgt_ps(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ LaneMask operator&(const LaneMask &p_a, const LaneMask &p_b) { return { _mm_and_ps(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ LaneMask operator|(const LaneMask &p_a, const LaneMask &p_b) { return { _mm_or_ps(p_a.v, p_b.v) }; }
+_FORCE_INLINE_ bool lanes_any(const LaneMask &p_mask) { return _mm_movemask_ps(p_mask.v) != 0; }
+
+_FORCE_INLINE_ Lanes lanes_select(const LaneMask &p_mask, const Lanes &p_a, const Lanes &p_b) {
+	return { _mm_or_ps(_mm_and_ps(p_mask.v, p_a.v), _mm_andnot_ps(p_mask.v, p_b.v)) };
+}
+
+_FORCE_INLINE_ Lanes lanes_from_mask(const LaneMask &p_mask) { return { _mm_and_ps(p_mask.v, _mm_set1_ps(1.0f)) }; }
+
+#else
+
+struct Lanes {
+	real_t v[GodotContactSolver3D::LANES];
+};
+
+struct LaneMask {
+	bool v[GodotContactSolver3D::LANES];
+};
+
+#define LANES_FOREACH for (int l = 0; l < GodotContactSolver3D::LANES; l++)
+
+_FORCE_INLINE_ Lanes lanes_load(const real_t *p_src) {
+	Lanes r;
+	LANES_FOREACH { r.v[l] = p_src[l]; }
+	return r;
+}
+
+_FORCE_INLINE_ void lanes_store(const Lanes &p_value, real_t *r_dst) {
+	LANES_FOREACH { r_dst[l] = p_value.v[l]; }
+}
+
+_FORCE_INLINE_ Lanes lanes_splat(real_t p_value) {
+	Lanes r;
+	LANES_FOREACH { r.v[l] = p_value; }
+	return r;
+}
+
+#define LANES_OPERATOR(m_op)                                             \
+	_FORCE_INLINE_ Lanes operator m_op(const Lanes &p_a, const Lanes &p_b) { \
+		Lanes r;                                                         \
+		LANES_FOREACH { r.v[l] = p_a.v[l] m_op p_b.v[l]; }               \
+		return r;                                                        \
+	}
+
+LANES_OPERATOR(+)
+LANES_OPERATOR(-)
+LANES_OPERATOR(*)
+LANES_OPERATOR(/)
+
+#undef LANES_OPERATOR
+
+_FORCE_INLINE_ Lanes operator-(const Lanes &p_a) {
+	Lanes r;
+	LANES_FOREACH { r.v[l] = -p_a.v[l]; }
+	return r;
+}
+
+_FORCE_INLINE_ Lanes lanes_max(const Lanes &p_a, const Lanes &p_b) {
+	Lanes r;
+	LANES_FOREACH { r.v[l] = MAX(p_a.v[l], p_b.v[l]); }
+	return r;
+}
+
+_FORCE_INLINE_ Lanes lanes_abs(const Lanes &p_a) {
+	Lanes r;
+	LANES_FOREACH { r.v[l] = Math::abs(p_a.v[l]); }
+	return r;
+}
+
+_FORCE_INLINE_ Lanes lanes_sqrt(const Lanes &p_a) {
+	Lanes r;
+	LANES_FOREACH { r.v[l] = Math::sqrt(p_a.v[l]); }
+	return r;
+}
+
+_FORCE_INLINE_ LaneMask operator>(const Lanes &p_a, const Lanes &p_b) {
+	LaneMask r;
+	LANES_FOREACH { r.v[l] = p_a.v[l] > p_b.v[l]; }
+	return r;
+}
+
+_FORCE_INLINE_ LaneMask operator&(const LaneMask &p_a, const LaneMask &p_b) {
+	LaneMask r;
+	LANES_FOREACH { r.v[l] = p_a.v[l] && p_b.v[l]; }
+	return r;
+}
+
+_FORCE_INLINE_ LaneMask operator|(const LaneMask &p_a, const LaneMask &p_b) {
+	LaneMask r;
+	LANES_FOREACH { r.v[l] = p_a.v[l] || p_b.v[l]; }
+	return r;
+}
+
+_FORCE_INLINE_ bool lanes_any(const LaneMask &p_mask) {
+	bool any = false;
+	LANES_FOREACH { any |= p_mask.v[l]; }
+	return any;
+}
+
+_FORCE_INLINE_ Lanes lanes_select(const LaneMask &p_mask, const Lanes &p_a, const Lanes &p_b) {
+	Lanes r;
+	LANES_FOREACH { r.v[l] = p_mask.v[l] ? p_a.v[l] : p_b.v[l]; }
+	return r;
+}
+
+_FORCE_INLINE_ Lanes lanes_from_mask(const LaneMask &p_mask) {
+	Lanes r;
+	LANES_FOREACH { r.v[l] = p_mask.v[l] ? 1.0 : 0.0; }
+	return r;
+}
+
+#undef LANES_FOREACH
+
+#endif // CONTACT_SOLVER_SSE2
+
+struct LaneVector3 {
+	Lanes x, y, z;
+
+	_FORCE_INLINE_ LaneVector3 operator+(const LaneVector3 &p_v) const { return { x + p_v.x, y + p_v.y, z + p_v.z }; }
+	_FORCE_INLINE_ LaneVector3 operator-(const LaneVector3 &p_v) const { return { x - p_v.x, y - p_v.y, z - p_v.z }; }
+	_FORCE_INLINE_ LaneVector3 operator*(const Lanes &p_s) const { return { x * p_s, y * p_s, z * p_s }; }
+	_FORCE_INLINE_ LaneVector3 operator-() const { return { -x, -y, -z }; }
+
+	_FORCE_INLINE_ Lanes dot(const LaneVector3 &p_v) const { return x * p_v.x + y * p_v.y + z * p_v.z; }
+	_FORCE_INLINE_ Lanes length() const { return lanes_sqrt(dot(*this)); }
+
+	_FORCE_INLINE_ LaneVector3 cross(const LaneVector3 &p_v) const {
+		return { y * p_v.z - z * p_v.y, z * p_v.x - x * p_v.z, x * p_v.y - y * p_v.x };
+	}
+};
+
+_FORCE_INLINE_ LaneVector3 lanes_load3(const real_t (*p_src)[GodotContactSolver3D::LANES]) {
+	return { lanes_load(p_src[0]), lanes_load(p_src[1]), lanes_load(p_src[2]) };
+}
+
+_FORCE_INLINE_ void lanes_store3(const LaneVector3 &p_value, real_t (*r_dst)[GodotContactSolver3D::LANES]) {
+	lanes_store(p_value.x, r_dst[0]);
+	lanes_store(p_value.y, r_dst[1]);
+	lanes_store(p_value.z, r_dst[2]);
+}
+
+_FORCE_INLINE_ LaneVector3 lanes_select3(const LaneMask &p_mask, const LaneVector3 &p_a, const LaneVector3 &p_b) {
+	return { lanes_select(p_mask, p_a.x, p_b.x), lanes_select(p_mask, p_a.y, p_b.y), lanes_select(p_mask, p_a.z, p_b.z) };
+}
+
+struct LaneBasis {
+	Lanes rows[3][3];
+
+	_FORCE_INLINE_ void load(const real_t (*p_src)[GodotContactSolver3D::LANES]) {
+		for (int i = 0; i < 3; i++) {
+			for (int j = 0; j < 3; j++) {
+				rows[i][j] = lanes_load(p_src[i * 3 + j]);
+			}
+		}
+	}
+
+	_FORCE_INLINE_ LaneVector3 xform(const LaneVector3 &p_v) const {
+		return {
+			rows[0][0] * p_v.x + rows[0][1] * p_v.y + rows[0][2] * p_v.z,
+			rows[1][0] * p_v.x + rows[1][1] * p_v.y + rows[1][2] * p_v.z,
+			rows[2][0] * p_v.x + rows[2][1] * p_v.y + rows[2][2] * p_v.z
+		};
+	}
+};
+
+} // namespace
+
+uint32_t GodotContactSolver3D::_get_body_slot(GodotBody3D *p_body) {
+	const uint32_t *slot = body_slots.getptr(p_body);
+	if (slot) {
+		return *slot;
+	}
+
+	uint32_t index = bodies.size();
+	bodies.resize(index + 1);
+	BodySlot &body = bodies[index];
+	body.body = p_body;
+	body.colors = 0;
+	body.dynamic = p_body->get_mode() > PhysicsServer3D::BODY_MODE_KINEMATIC;
+	body_slots.insert(p_body, index);
+	return index;
+}
+
+bool GodotContactSolver3D::setup(LocalVector<GodotConstraint3D *> &r_constraints) {
+	pairs.clear();
+	pending.clear();
+
+	uint32_t contact_count = 0;
+	for (GodotConstraint3D *constraint : r_constraints) {
+		GodotBodyPair3D *pair = constraint->get_body_pair();
+		if (!pair) {
+			continue;
+		}
+		pairs.push_back(pair);
+		for (int i = 0; i < pair->contact_count; i++) {
+			contact_count += pair->contacts[i].active ? 1 : 0;
+		}
+	}
+	if (contact_count < (uint32_t)MIN_CONTACTS) {
+		pairs.clear();
+		return false;
+	}
+
+	// Only the other constraints are left for the caller to solve.
+	uint32_t constraint_count = 0;
+	for (GodotConstraint3D *constraint : r_constraints) {
+		if (!constraint->get_body_pair()) {
+			r_constraints[constraint_count++] = constraint;
+		}
+	}
+	r_constraints.resize(constraint_count);
+
+	bodies.clear();
+	body_slots.clear();
+	color_counts.clear();
+	color_counts.resize(MAX_COLORS + 1);
+	memset(color_counts.ptr(), 0, color_counts.size() * sizeof(uint32_t));
+
+	// Slot 0 is a static dummy body, used by the padding lanes of the batches.
+	bodies.resize(1);
+	bodies[0] = BodySlot();
+
+	// Greedy coloring: each contact takes the first color not used yet by either of its
+	// dynamic bodies. Static and kinematic bodies are never written, so they can be shared.
+	// Contacts that find no free color get color MAX_COLORS, and are batched alone.
+	pending.reserve(contact_count);
+	for (GodotBodyPair3D *pair : pairs) {
+		uint32_t slot_A = _get_body_slot(pair->A);
+		uint32_t slot_B = _get_body_slot(pair->B);
+
+		for (int i = 0; i < pair->contact_count; i++) {
+			GodotBodyPair3D::Contact &c = pair->contacts[i];
+			if (!c.active) {
+				continue;
+			}
+
+			uint64_t used = (bodies[slot_A].dynamic ? bodies[slot_A].colors : 0) | (bodies[slot_B].dynamic ? bodies[slot_B].colors : 0);
+			uint32_t color = MAX_COLORS;
+			if (used != UINT64_MAX) {
+				uint64_t free_colors = ~used;
+				color = 0;
+				while (!(free_colors & 1)) {
+					free_colors >>= 1;
+					color++;
+				}
+				bodies[slot_A].colors |= uint64_t(1) << color;
+				bodies[slot_B].colors |= uint64_t(1) << color;
+			}
+
+			PendingContact p;
+			p.pair = pair;
+			p.contact = &c;
+			p.color = color;
+			pending.push_back(p);
+			color_counts[color]++;
+		}
+	}
+
+	// Batches are laid out color by color, and a color fills up its batches in contact order.
+	uint32_t batch_count = 0;
+	color_first_batch.resize(MAX_COLORS + 1);
+	for (uint32_t color = 0; color < MAX_COLORS; color++) {
+		color_first_batch[color] = batch_count;
+		batch_count += (color_counts[color] + LANES - 1) / LANES;
+	}
+	color_first_batch[MAX_COLORS] = batch_count;
+	batch_count += color_counts[MAX_COLORS];
+
+	batches.resize(batch_count);
+	for (ContactBatch &batch : batches) {
+		batch.count = 0;
+	}
+
+	memset(color_counts.ptr(), 0, color_counts.size() * sizeof(uint32_t));
+	for (const PendingContact &p : pending) {
+		uint32_t per_batch = p.color == MAX_COLORS ? 1 : LANES;
+		uint32_t batch_index = color_first_batch[p.color] + color_counts[p.color] / per_batch;
+		color_counts[p.color]++;
+		_add_to_batch(batches[batch_index], p);
+	}
+
+	// Padding lanes point at the dummy body and never become active.
+	for (ContactBatch &batch : batches) {
+		for (uint32_t l = batch.count; l < LANES; l++) {
+			batch.body_A[l] = 0;
+			batch.body_B[l] = 0;
+			batch.contact[l] = nullptr;
+			for (int k = 0; k < 3; k++) {
+				batch.normal[k][l] = 0.0;
+				batch.r_A[k][l] = 0.0;
+				batch.r_B[k][l] = 0.0;
+				batch.acc_impulse[k][l] = 0.0;
+				batch.acc_tangent_impulse[k][l] = 0.0;
+			}
+			for (int k = 0; k < 9; k++) {
+				batch.inv_inertia_A[k][l] = 0.0;
+				batch.inv_inertia_B[k][l] = 0.0;
+			}
+			// Non zero masses keep the divisions of the idle lanes finite.
+			batch.inv_mass_A[l] = 1.0;
+			batch.inv_mass_B[l] = 1.0;
+			batch.mass_normal[l] = 0.0;
+			batch.bias[l] = 0.0;
+			batch.bounce[l] = 0.0;
+			batch.friction[l] = 0.0;
+			batch.acc_normal_impulse[l] = 0.0;
+			batch.acc_bias_impulse[l] = 0.0;
+			batch.acc_bias_impulse_center_of_mass[l] = 0.0;
+			batch.active[l] = 0.0;
+		}
+	}
+
+	return true;
+}
+
+void GodotContactSolver3D::_add_to_batch(ContactBatch &r_batch, const PendingContact &p_pending) {
+	const GodotBodyPair3D *pair = p_pending.pair;
+	const GodotBodyPair3D::Contact &c = *p_pending.contact;
+	uint32_t l = r_batch.count++;
+
+	r_batch.body_A[l] = *body_slots.getptr(pair->A);
+	r_batch.body_B[l] = *body_slots.getptr(pair->B);
+	r_batch.contact[l] = p_pending.contact;
+
+	// Same masses as GodotBodyPair3D::solve(), zero for bodies that don't respond to the pair.
+	Basis zero_basis;
+	zero_basis.set_zero();
+	const Basis &inv_inertia_A = pair->collide_A ? pair->A->get_inv_inertia_tensor() : zero_basis;
+	const Basis &inv_inertia_B = pair->collide_B ? pair->B->get_inv_inertia_tensor() : zero_basis;
+
+	for (int i = 0; i < 3; i++) {
+		r_batch.normal[i][l] = c.normal[i];
+		r_batch.r_A[i][l] = c.rA[i];
+		r_batch.r_B[i][l] = c.rB[i];
+		r_batch.acc_impulse[i][l] = c.acc_impulse[i];
+		r_batch.acc_tangent_impulse[i][l] = c.acc_tangent_impulse[i];
+		for (int j = 0; j < 3; j++) {
+			r_batch.inv_inertia_A[i * 3 + j][l] = inv_inertia_A.rows[i][j];
+			r_batch.inv_inertia_B[i * 3 + j][l] = inv_inertia_B.rows[i][j];
+		}
+	}
+
+	r_batch.inv_mass_A[l] = pair->collide_A ? pair->A->get_inv_mass() : 0.0;
+	r_batch.inv_mass_B[l] = pair->collide_B ? pair->B->get_inv_mass() : 0.0;
+	r_batch.mass_normal[l] = c.mass_normal;
+	r_batch.bias[l] = c.bias;
+	r_batch.bounce[l] = c.bounce;
+	r_batch.friction[l] = ABS(MIN(pair->A->get_friction(), pair->B->get_friction()));
+	r_batch.acc_normal_impulse[l] = c.acc_normal_impulse;
+	r_batch.acc_bias_impulse[l] = c.acc_bias_impulse;
+	r_batch.acc_bias_impulse_center_of_mass[l] = c.acc_bias_impulse_center_of_mass;
+	r_batch.active[l] = 1.0;
+}
+
+void GodotContactSolver3D::load_velocities() {
+	for (BodySlot &slot : bodies) {
+		if (!slot.body) {
+			continue;
+		}
+		slot.linear_velocity = slot.body->get_linear_velocity();
+		slot.angular_velocity = slot.body->get_angular_velocity();
+		slot.biased_linear_velocity = slot.body->get_biased_linear_velocity();
+		slot.biased_angular_velocity = slot.body->get_biased_angular_velocity();
+	}
+}
+
+void GodotContactSolver3D::store_velocities() const {
+	for (const BodySlot &slot : bodies) {
+		if (!slot.dynamic) {
+			continue;
+		}
+		slot.body->set_linear_velocity(slot.linear_velocity);
+		slot.body->set_angular_velocity(slot.angular_velocity);
+		slot.body->set_biased_linear_velocity(slot.biased_linear_velocity);
+		slot.body->set_biased_angular_velocity(slot.biased_angular_velocity);
+	}
+}
+
+// Vectorized GodotBodyPair3D::solve() for one contact per lane. Each branch of the
+// per contact solver becomes a lane mask, and masked out lanes keep their old values.
+void GodotContactSolver3D::_solve_batch(ContactBatch &r_batch, real_t p_max_bias_av) {
+	const Lanes zero = lanes_splat(0.0);
+	const Lanes one = lanes_splat(1.0);
+	const Lanes min_velocity = lanes_splat(MIN_VELOCITY);
+
+	LaneMask active = lanes_load(r_batch.active) > zero;
+	if (!lanes_any(active)) {
+		return;
+	}
+
+	// Gather the velocities of the bodies.
+	real_t gathered[12][2][LANES];
+	for (uint32_t l = 0; l < LANES; l++) {
+		const BodySlot *slots[2] = { &bodies[r_batch.body_A[l]], &bodies[r_batch.body_B[l]] };
+		for (int s = 0; s < 2; s++) {
+			for (int i = 0; i < 3; i++) {
+				gathered[i][s][l] = slots[s]->linear_velocity[i];
+				gathered[3 + i][s][l] = slots[s]->angular_velocity[i];
+				gathered[6 + i][s][l] = slots[s]->biased_linear_velocity[i];
+				gathered[9 + i][s][l] = slots[s]->biased_angular_velocity[i];
+			}
+		}
+	}
+
+	LaneVector3 lv_A = { lanes_load(gathered[0][0]), lanes_load(gathered[1][0]), lanes_load(gathered[2][0]) };
+	LaneVector3 av_A = { lanes_load(gathered[3][0]), lanes_load(gathered[4][0]), lanes_load(gathered[5][0]) };
+	LaneVector3 blv_A = { lanes_load(gathered[6][0]), lanes_load(gathered[7][0]), lanes_load(gathered[8][0]) };
+	LaneVector3 bav_A = { lanes_load(gathered[9][0]), lanes_load(gathered[10][0]), lanes_load(gathered[11][0]) };
+	LaneVector3 lv_B = { lanes_load(gathered[0][1]), lanes_load(gathered[1][1]), lanes_load(gathered[2][1]) };
+	LaneVector3 av_B = { lanes_load(gathered[3][1]), lanes_load(gathered[4][1]), lanes_load(gathered[5][1]) };
+	LaneVector3 blv_B = { lanes_load(gathered[6][1]), lanes_load(gathered[7][1]), lanes_load(gathered[8][1]) };
+	LaneVector3 bav_B = { lanes_load(gathered[9][1]), lanes_load(gathered[10][1]), lanes_load(gathered[11][1]) };
+
+	const LaneVector3 normal = lanes_load3(r_batch.normal);
+	const LaneVector3 r_A = lanes_load3(r_batch.r_A);
+	const LaneVector3 r_B = lanes_load3(r_batch.r_B);
+	const Lanes inv_mass_A = lanes_load(r_batch.inv_mass_A);
+	const Lanes inv_mass_B = lanes_load(r_batch.inv_mass_B);
+	const Lanes inv_mass_sum = inv_mass_A + inv_mass_B;
+	const Lanes bias = lanes_load(r_batch.bias);
+	LaneBasis inv_inertia_A;
+	LaneBasis inv_inertia_B;
+	inv_inertia_A.load(r_batch.inv_inertia_A);
+	inv_inertia_B.load(r_batch.inv_inertia_B);
+
+	LaneVector3 acc_impulse = lanes_load3(r_batch.acc_impulse);
+
+	// Bias impulse.
+	LaneVector3 dbv = blv_B + bav_B.cross(r_B) - blv_A - bav_A.cross(r_A);
+	Lanes vbn = dbv.dot(normal);
+
+	LaneMask bias_mask = active & (lanes_abs(bias - vbn) > min_velocity);
+	LaneMask still_active = bias_mask;
+	if (lanes_any(bias_mask)) {
+		const Lanes max_bias_av = lanes_splat(p_max_bias_av);
+
+		Lanes jbn = (bias - vbn) * lanes_load(r_batch.mass_normal);
+		Lanes jbn_old = lanes_load(r_batch.acc_bias_impulse);
+		Lanes acc_bias = lanes_select(bias_mask, lanes_max(jbn_old + jbn, zero), jbn_old);
+		lanes_store(acc_bias, r_batch.acc_bias_impulse);
+
+		LaneVector3 jb = normal * (acc_bias - jbn_old);
+
+		// Bias rotation is clamped like in GodotBody3D::apply_bias_impulse().
+		LaneVector3 delta_av_A = inv_inertia_A.xform(r_A.cross(-jb));
+		LaneVector3 delta_av_B = inv_inertia_B.xform(r_B.cross(jb));
+		Lanes len_A = delta_av_A.length();
+		Lanes len_B = delta_av_B.length();
+		LaneMask clamp_A = len_A > max_bias_av;
+		LaneMask clamp_B = len_B > max_bias_av;
+		delta_av_A = delta_av_A * lanes_select(clamp_A, max_bias_av / lanes_select(clamp_A, len_A, one), one);
+		delta_av_B = delta_av_B * lanes_select(clamp_B, max_bias_av / lanes_select(clamp_B, len_B, one), one);
+
+		blv_A = blv_A - jb * inv_mass_A;
+		bav_A = bav_A + delta_av_A;
+		blv_B = blv_B + jb * inv_mass_B;
+		bav_B = bav_B + delta_av_B;
+
+		dbv = blv_B + bav_B.cross(r_B) - blv_A - bav_A.cross(r_A);
+		vbn = dbv.dot(normal);
+
+		LaneMask com_mask = bias_mask & (lanes_abs(bias - vbn) > min_velocity);
+		Lanes jbn_com = (bias - vbn) / inv_mass_sum;
+		Lanes jbn_com_old = lanes_load(r_batch.acc_bias_impulse_center_of_mass);
+		Lanes acc_bias_com = lanes_select(com_mask, lanes_max(jbn_com_old + jbn_com, zero), jbn_com_old);
+		lanes_store(acc_bias_com, r_batch.acc_bias_impulse_center_of_mass);
+
+		LaneVector3 jb_com = normal * (acc_bias_com - jbn_com_old);
+		blv_A = blv_A - jb_com * inv_mass_A;
+		blv_B = blv_B + jb_com * inv_mass_B;
+	}
+
+	// Normal impulse.
+	LaneVector3 dv = lv_B + av_B.cross(r_B) - lv_A - av_A.cross(r_A);
+	Lanes vn = dv.dot(normal);
+
+	LaneMask normal_mask = active & (lanes_abs(vn) > min_velocity);
+	still_active = still_active | normal_mask;
+
+	Lanes jn = -(lanes_load(r_batch.bounce) + vn) * lanes_load(r_batch.mass_normal);
+	Lanes jn_old = lanes_load(r_batch.acc_normal_impulse);
+	Lanes acc_normal = lanes_select(normal_mask, lanes_max(jn_old + jn, zero), jn_old);
+	lanes_store(acc_normal, r_batch.acc_normal_impulse);
+
+	LaneVector3 j = normal * (acc_normal - jn_old);
+	lv_A = lv_A - j * inv_mass_A;
+	av_A = av_A + inv_inertia_A.xform(r_A.cross(-j));
+	lv_B = lv_B + j * inv_mass_B;
+	av_B = av_B + inv_inertia_B.xform(r_B.cross(j));
+	acc_impulse = acc_impulse - j;
+
+	// Friction impulse.
+	LaneVector3 dtv = (lv_B + av_B.cross(r_B)) - (lv_A + av_A.cross(r_A));
+	Lanes tn = normal.dot(dtv);
+	LaneVector3 tv = dtv - normal * tn;
+	Lanes tvl = tv.length();
+
+	LaneMask friction_mask = active & (tvl > min_velocity);
+	if (lanes_any(friction_mask)) {
+		still_active = still_active | friction_mask;
+
+		tv = tv * (one / lanes_select(friction_mask, tvl, one));
+
+		LaneVector3 temp_A = inv_inertia_A.xform(r_A.cross(tv));
+		LaneVector3 temp_B = inv_inertia_B.xform(r_B.cross(tv));
+		Lanes denominator = inv_mass_sum + tv.dot(temp_A.cross(r_A) + temp_B.cross(r_B));
+		Lanes t = -tvl / lanes_select(friction_mask, denominator, one);
+
+		LaneVector3 jt_old = lanes_load3(r_batch.acc_tangent_impulse);
+		LaneVector3 acc_tangent = jt_old + tv * t;
+
+		Lanes fi_len = acc_tangent.length();
+		Lanes jt_max = acc_normal * lanes_load(r_batch.friction);
+		LaneMask clamp = (fi_len > lanes_splat(CMP_EPSILON)) & (fi_len > jt_max);
+		acc_tangent = acc_tangent * lanes_select(clamp, jt_max / lanes_select(clamp, fi_len, one), one);
+		acc_tangent = lanes_select3(friction_mask, acc_tangent, jt_old);
+		lanes_store3(acc_tangent, r_batch.acc_tangent_impulse);
+
+		LaneVector3 jt = acc_tangent - jt_old;
+		lv_A = lv_A - jt * inv_mass_A;
+		av_A = av_A + inv_inertia_A.xform(r_A.cross(-jt));
+		lv_B = lv_B + jt * inv_mass_B;
+		av_B = av_B + inv_inertia_B.xform(r_B.cross(jt));
+		acc_impulse = acc_impulse - jt;
+	}
+
+	lanes_store3(acc_impulse, r_batch.acc_impulse);
+	lanes_store(lanes_from_mask(still_active), r_batch.active);
+
+	// Scatter the velocities back, the coloring guarantees no two lanes write the same body.
+	lanes_store(lv_A.x, gathered[0][0]);
+	lanes_store(lv_A.y, gathered[1][0]);
+	lanes_store(lv_A.z, gathered[2][0]);
+	lanes_store(av_A.x, gathered[3][0]);
+	lanes_store(av_A.y, gathered[4][0]);
+	lanes_store(av_A.z, gathered[5][0]);
+	lanes_store(blv_A.x, gathered[6][0]);
+	lanes_store(blv_A.y, gathered[7][0]);
+	lanes_store(blv_A.z, gathered[8][0]);
+	lanes_store(bav_A.x, gathered[9][0]);
+	lanes_store(bav_A.y, gathered[10][0]);
+	lanes_store(bav_A.z, gathered[11][0]);
+	lanes_store(lv_B.x, gathered[0][1]);
+	lanes_store(lv_B.y, gathered[1][1]);
+	lanes_store(lv_B.z, gathered[2][1]);
+	lanes_store(av_B.x, gathered[3][1]);
+	lanes_store(av_B.y, gathered[4][1]);
+	lanes_store(av_B.z, gathered[5][1]);
+	lanes_store(blv_B.x, gathered[6][1]);
+	lanes_store(blv_B.y, gathered[7][1]);
+	lanes_store(blv_B.z, gathered[8][1]);
+	lanes_store(bav_B.x, gathered[9][1]);
+	lanes_store(bav_B.y, gathered[10][1]);
+	lanes_store(bav_B.z, gathered[11][1]);
+
+	for (uint32_t l = 0; l < r_batch.count; l++) {
+		BodySlot *slots[2] = { &bodies[r_batch.body_A[l]], &bodies[r_batch.body_B[l]] };
+		for (int s = 0; s < 2; s++) {
+			if (!slots[s]->dynamic) {
+				continue;
+			}
+			for (int i = 0; i < 3; i++) {
+				slots[s]->linear_velocity[i] = gathered[i][s][l];
+				slots[s]->angular_velocity[i] = gathered[3 + i][s][l];
+				slots[s]->biased_linear_velocity[i] = gathered[6 + i][s][l];
+				slots[s]->biased_angular_velocity[i] = gathered[9 + i][s][l];
+			}
+		}
+	}
+}
+
+void GodotContactSolver3D::solve(real_t p_step) {
+	const real_t max_bias_av = MAX_BIAS_ROTATION / p_step;
+	for (ContactBatch &batch : batches) {
+		_solve_batch(batch, max_bias_av);
+	}
+}
+
+void GodotContactSolver3D::finish() {
+	for (const ContactBatch &batch : batches) {
+		for (uint32_t l = 0; l < batch.count; l++) {
+			GodotBodyPair3D::Contact &c = *batch.contact[l];
+			for (int i = 0; i < 3; i++) {
+				c.acc_impulse[i] = batch.acc_impulse[i][l];
+				c.acc_tangent_impulse[i] = batch.acc_tangent_impulse[i][l];
+			}
+			c.acc_normal_impulse = batch.acc_normal_impulse[l];
+			c.acc_bias_impulse = batch.acc_bias_impulse[l];
+			c.acc_bias_impulse_center_of_mass = batch.acc_bias_impulse_center_of_mass[l];
+			c.active = batch.active[l] > 0.0;
+		}
+	}
+	batches.clear();
+	pending.clear();
+	pairs.clear();
+}
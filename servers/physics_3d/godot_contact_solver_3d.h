@@ -0,0 +1,122 @@
+/**************************************************************************/
+/*  godot_contact_solver_3d.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_CONTACT_SOLVER_3D_H
+#define GODOT_CONTACT_SOLVER_3D_H
+
+#include "godot_body_pair_3d.h"
+
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+
+// Solves the contacts of all the body pairs in an island together, LANES contacts at a time.
+// Contacts are colored so that no two contacts of a batch move the same body, which makes
+// a batch equivalent to solving its contacts one after the other.
+class GodotContactSolver3D {
+public:
+	enum {
+		LANES = 4,
+		MIN_CONTACTS = 16, // Islands with fewer contacts are solved pair by pair.
+		MAX_COLORS = 64,
+	};
+
+private:
+	struct BodySlot {
+		GodotBody3D *body = nullptr;
+		Vector3 linear_velocity;
+		Vector3 angular_velocity;
+		Vector3 biased_linear_velocity;
+		Vector3 biased_angular_velocity;
+		uint64_t colors = 0; // Colors already used by contacts involving this (dynamic) body.
+		bool dynamic = false;
+	};
+
+	struct ContactBatch {
+		uint32_t count = 0;
+		uint32_t body_A[LANES];
+		uint32_t body_B[LANES];
+		GodotBodyPair3D::Contact *contact[LANES];
+
+		real_t normal[3][LANES];
+		real_t r_A[3][LANES];
+		real_t r_B[3][LANES];
+		real_t inv_mass_A[LANES];
+		real_t inv_mass_B[LANES];
+		real_t inv_inertia_A[9][LANES];
+		real_t inv_inertia_B[9][LANES];
+		real_t mass_normal[LANES];
+		real_t bias[LANES];
+		real_t bounce[LANES];
+		real_t friction[LANES];
+
+		real_t acc_impulse[3][LANES];
+		real_t acc_normal_impulse[LANES];
+		real_t acc_tangent_impulse[3][LANES];
+		real_t acc_bias_impulse[LANES];
+		real_t acc_bias_impulse_center_of_mass[LANES];
+		real_t active[LANES]; // 1 while the contact still needs solving, like Contact::active.
+	};
+
+	struct PendingContact {
+		GodotBodyPair3D *pair = nullptr;
+		GodotBodyPair3D::Contact *contact = nullptr;
+		uint32_t color = 0;
+	};
+
+	LocalVector<GodotBodyPair3D *> pairs;
+	LocalVector<BodySlot> bodies;
+	HashMap<GodotBody3D *, uint32_t> body_slots;
+	LocalVector<PendingContact> pending;
+	LocalVector<uint32_t> color_counts;
+	LocalVector<uint32_t> color_first_batch;
+	LocalVector<ContactBatch> batches;
+
+	uint32_t _get_body_slot(GodotBody3D *p_body);
+	void _add_to_batch(ContactBatch &r_batch, const PendingContact &p_pending);
+	void _solve_batch(ContactBatch &r_batch, real_t p_max_bias_av);
+
+public:
+	// Takes the body pairs out of r_constraints and packs their active contacts.
+	// Returns false, leaving r_constraints untouched, when there are too few contacts
+	// for batching to pay off.
+	bool setup(LocalVector<GodotConstraint3D *> &r_constraints);
+
+	// Loads and stores the velocities of the bodies referenced by the batches,
+	// so other constraints can be solved in between iterations.
+	void load_velocities();
+	void store_velocities() const;
+
+	void solve(real_t p_step);
+
+	// Stores the accumulated impulses back into the contacts, for warm starting and reporting.
+	void finish();
+};
+
+#endif // GODOT_CONTACT_SOLVER_3D_H
@@ -1631,6 +1631,8 @@ void GodotPhysicsServer3D::init() {
 void GodotPhysicsServer3D::step(real_t p_step) {
 #ifndef _3D_DISABLED
 
+	MEMORY_TAG_SCOPE("Physics");
+
 	if (!active) {
 		return;
 	}
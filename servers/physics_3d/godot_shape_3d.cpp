@@ -1769,39 +1769,38 @@ _FORCE_INLINE_ bool _heightmap_cell_cull_segment(_HeightmapSegmentCullParams &p_
 	return false;
 }
 
-_FORCE_INLINE_ bool _heightmap_chunk_cull_segment(_HeightmapSegmentCullParams &p_params, const _HeightmapGridCullState &p_state) {
-	const GodotHeightMapShape3D::Range &chunk = p_params.heightmap->_get_bounds_chunk(p_state.x, p_state.z);
-
-	Vector3 enter_pos;
-	Vector3 exit_pos;
-
-	if (p_state.length_flat > CMP_EPSILON) {
-		real_t flat_to_3d = p_state.length / p_state.length_flat;
-		real_t enter_param = p_state.prev_dist * flat_to_3d;
-		real_t exit_param = p_state.dist * flat_to_3d;
-		enter_pos = p_params.from + p_params.dir * enter_param;
-		exit_pos = p_params.from + p_params.dir * exit_param;
-	} else {
-		// Consider the ray vertical.
-		// (though we shouldn't reach this often because there is an early check up-front)
-		enter_pos = p_params.from;
-		exit_pos = p_params.to;
-	}
-
-	// Transform positions to heightmap space.
-	enter_pos *= GodotHeightMapShape3D::BOUNDS_CHUNK_SIZE;
-	exit_pos *= GodotHeightMapShape3D::BOUNDS_CHUNK_SIZE;
+// Clips a segment to the flat (XZ) projection of a box, returning the entered and exited segment parameters.
+_FORCE_INLINE_ bool _heightmap_clip_segment_flat(const Vector3 &p_begin, const Vector3 &p_delta, real_t p_min_x, real_t p_max_x, real_t p_min_z, real_t p_max_z, real_t &r_enter, real_t &r_exit) {
+	// Grow the box a little, so rays along shared edges aren't lost to rounding on both sides.
+	const real_t margin = 0.01;
+	const real_t box_min[2] = { p_min_x - margin, p_min_z - margin };
+	const real_t box_max[2] = { p_max_x + margin, p_max_z + margin };
+	const real_t begin[2] = { p_begin.x, p_begin.z };
+	const real_t delta[2] = { p_delta.x, p_delta.z };
+
+	r_enter = 0.0;
+	r_exit = 1.0;
+	for (int i = 0; i < 2; i++) {
+		if (Math::abs(delta[i]) < CMP_EPSILON) {
+			if (begin[i] < box_min[i] || begin[i] > box_max[i]) {
+				return false;
+			}
+			continue;
+		}
 
-	// We did enter the flat projection of the AABB,
-	// but we have to check if we intersect it on the vertical axis.
-	if ((enter_pos.y > chunk.max) && (exit_pos.y > chunk.max)) {
-		return false;
-	}
-	if ((enter_pos.y < chunk.min) && (exit_pos.y < chunk.min)) {
-		return false;
+		real_t t0 = (box_min[i] - begin[i]) / delta[i];
+		real_t t1 = (box_max[i] - begin[i]) / delta[i];
+		if (t0 > t1) {
+			SWAP(t0, t1);
+		}
+		r_enter = MAX(r_enter, t0);
+		r_exit = MIN(r_exit, t1);
+		if (r_enter > r_exit) {
+			return false;
+		}
 	}
 
-	return p_params.heightmap->_intersect_grid_segment(_heightmap_cell_cull_segment, enter_pos, exit_pos, p_params.heightmap->width, p_params.heightmap->depth, p_params.heightmap->local_origin, p_params.result, p_params.normal);
+	return true;
 }
 
 template <typename ProcessFunction>
@@ -1991,11 +1990,76 @@ bool GodotHeightMapShape3D::intersect_segment(const Vector3 &p_begin, const Vect
 			// Don't use chunks, the ray is too short in the plane.
 			return _intersect_grid_segment(_heightmap_cell_cull_segment, p_begin, p_end, width, depth, local_origin, r_point, r_normal);
 		} else {
-			// The ray is long, run raycast on a higher-level grid.
-			Vector3 bounds_from = p_begin / BOUNDS_CHUNK_SIZE;
-			Vector3 bounds_to = p_end / BOUNDS_CHUNK_SIZE;
-			Vector3 bounds_offset = local_origin / BOUNDS_CHUNK_SIZE;
-			return _intersect_grid_segment(_heightmap_chunk_cull_segment, bounds_from, bounds_to, bounds_grid_width, bounds_grid_depth, bounds_offset, r_point, r_normal);
+			// The ray is long, walk down the bounds pyramid to skip the regions it passes over or under.
+			return _intersect_bounds_segment(bounds_levels.size(), 0, 0, p_begin, p_end, r_point, r_normal);
+		}
+	}
+
+	return false;
+}
+
+bool GodotHeightMapShape3D::_intersect_bounds_segment(int p_level, int p_x, int p_z, const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_point, Vector3 &r_normal) const {
+	const int node_size = BOUNDS_CHUNK_SIZE << p_level;
+	const Vector3 delta = p_end - p_begin;
+	const Vector3 local_begin = p_begin + local_origin;
+
+	real_t enter = 0.0;
+	real_t exit = 0.0;
+	if (!_heightmap_clip_segment_flat(local_begin, delta, p_x * node_size, MIN((p_x + 1) * node_size, width - 1), p_z * node_size, MIN((p_z + 1) * node_size, depth - 1), enter, exit)) {
+		return false;
+	}
+
+	// We did enter the flat projection of the node,
+	// but we have to check if we intersect it on the vertical axis.
+	const Range &range = _get_bounds_node(p_level, p_x, p_z);
+	const real_t enter_y = local_begin.y + delta.y * enter;
+	const real_t exit_y = local_begin.y + delta.y * exit;
+	if ((enter_y > range.max) && (exit_y > range.max)) {
+		return false;
+	}
+	if ((enter_y < range.min) && (exit_y < range.min)) {
+		return false;
+	}
+
+	if (p_level == 0) {
+		return _intersect_grid_segment(_heightmap_cell_cull_segment, p_begin + delta * enter, p_begin + delta * exit, width, depth, local_origin, r_point, r_normal);
+	}
+
+	// Visit the children front to back, so the first hit found is the closest one.
+	const int child_level = p_level - 1;
+	const int child_size = node_size / 2;
+	const int child_level_width = (child_level == 0) ? bounds_grid_width : bounds_levels[child_level - 1].width;
+	const int child_level_depth = (child_level == 0) ? bounds_grid_depth : bounds_levels[child_level - 1].depth;
+
+	struct Child {
+		real_t enter = 0.0;
+		int x = 0;
+		int z = 0;
+	};
+	Child children[4];
+	int child_count = 0;
+
+	for (int z = p_z * 2; z < MIN(p_z * 2 + 2, child_level_depth); z++) {
+		for (int x = p_x * 2; x < MIN(p_x * 2 + 2, child_level_width); x++) {
+			real_t child_enter = 0.0;
+			real_t child_exit = 0.0;
+			if (!_heightmap_clip_segment_flat(local_begin, delta, x * child_size, MIN((x + 1) * child_size, width - 1), z * child_size, MIN((z + 1) * child_size, depth - 1), child_enter, child_exit)) {
+				continue;
+			}
+
+			int i = child_count++;
+			for (; i > 0 && children[i - 1].enter > child_enter; i--) {
+				children[i] = children[i - 1];
+			}
+			children[i].enter = child_enter;
+			children[i].x = x;
+			children[i].z = z;
+		}
+	}
+
+	for (int i = 0; i < child_count; i++) {
+		if (_intersect_bounds_segment(child_level, children[i].x, children[i].z, p_begin, p_end, r_point, r_normal)) {
+			return true;
 		}
 	}
 
@@ -2051,32 +2115,93 @@ void GodotHeightMapShape3D::cull(const AABB &p_local_aabb, QueryCallback p_callb
 	int start_z = MAX(0, aabb_min[2]);
 	int end_z = MIN(depth - 1, aabb_max[2]);
 
+	// Triangles entirely above or below the AABB can't touch it, skip them.
+	const real_t min_y = local_aabb.position.y;
+	const real_t max_y = local_aabb.position.y + local_aabb.size.y;
+
+	if (!bounds_grid.is_empty() && !_bounds_overlap(bounds_levels.size(), 0, 0, start_x, end_x, start_z, end_z, min_y, max_y)) {
+		return;
+	}
+
 	GodotFaceShape3D face;
 	face.backface_collision = !p_invert_backface_collision;
 	face.invert_backface_collision = p_invert_backface_collision;
 
 	for (int z = start_z; z < end_z; z++) {
 		for (int x = start_x; x < end_x; x++) {
+			if (!bounds_grid.is_empty()) {
+				const Range &chunk = _get_bounds_chunk(x / BOUNDS_CHUNK_SIZE, z / BOUNDS_CHUNK_SIZE);
+				if ((chunk.min > max_y) || (chunk.max < min_y)) {
+					// Skip the rest of this chunk's row.
+					x = MIN(end_x, (x / BOUNDS_CHUNK_SIZE + 1) * BOUNDS_CHUNK_SIZE) - 1;
+					continue;
+				}
+			}
+
+			Vector3 p00, p10, p01, p11;
+			_get_point(x, z, p00);
+			_get_point(x + 1, z, p10);
+			_get_point(x, z + 1, p01);
+			_get_point(x + 1, z + 1, p11);
+
 			// First triangle.
-			_get_point(x, z, face.vertex[0]);
-			_get_point(x + 1, z, face.vertex[1]);
-			_get_point(x, z + 1, face.vertex[2]);
-			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
-			if (p_callback(p_userdata, &face)) {
-				return;
+			if (!((p00.y > max_y && p10.y > max_y && p01.y > max_y) || (p00.y < min_y && p10.y < min_y && p01.y < min_y))) {
+				face.vertex[0] = p00;
+				face.vertex[1] = p10;
+				face.vertex[2] = p01;
+				face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
+				if (p_callback(p_userdata, &face)) {
+					return;
+				}
 			}
 
 			// Second triangle.
-			face.vertex[0] = face.vertex[1];
-			_get_point(x + 1, z + 1, face.vertex[1]);
-			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
-			if (p_callback(p_userdata, &face)) {
-				return;
+			if (!((p10.y > max_y && p11.y > max_y && p01.y > max_y) || (p10.y < min_y && p11.y < min_y && p01.y < min_y))) {
+				face.vertex[0] = p10;
+				face.vertex[1] = p11;
+				face.vertex[2] = p01;
+				face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
+				if (p_callback(p_userdata, &face)) {
+					return;
+				}
 			}
 		}
 	}
 }
 
+bool GodotHeightMapShape3D::_bounds_overlap(int p_level, int p_x, int p_z, int p_start_x, int p_end_x, int p_start_z, int p_end_z, real_t p_min_y, real_t p_max_y) const {
+	// Cells covered by the node, against the [start, end) cell range of the query.
+	const int node_size = BOUNDS_CHUNK_SIZE << p_level;
+	if ((p_x * node_size >= p_end_x) || ((p_x + 1) * node_size <= p_start_x)) {
+		return false;
+	}
+	if ((p_z * node_size >= p_end_z) || ((p_z + 1) * node_size <= p_start_z)) {
+		return false;
+	}
+
+	const Range &range = _get_bounds_node(p_level, p_x, p_z);
+	if ((range.min > p_max_y) || (range.max < p_min_y)) {
+		return false;
+	}
+
+	if (p_level == 0) {
+		return true;
+	}
+
+	const int child_level = p_level - 1;
+	const int child_level_width = (child_level == 0) ? bounds_grid_width : bounds_levels[child_level - 1].width;
+	const int child_level_depth = (child_level == 0) ? bounds_grid_depth : bounds_levels[child_level - 1].depth;
+	for (int z = p_z * 2; z < MIN(p_z * 2 + 2, child_level_depth); z++) {
+		for (int x = p_x * 2; x < MIN(p_x * 2 + 2, child_level_width); x++) {
+			if (_bounds_overlap(child_level, x, z, p_start_x, p_end_x, p_start_z, p_end_z, p_min_y, p_max_y)) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
 Vector3 GodotHeightMapShape3D::get_moment_of_inertia(real_t p_mass) const {
 	// use bad AABB approximation
 	Vector3 extents = get_aabb().size * 0.5;
@@ -2089,6 +2214,7 @@ Vector3 GodotHeightMapShape3D::get_moment_of_inertia(real_t p_mass) const {
 
 void GodotHeightMapShape3D::_build_accelerator() {
 	bounds_grid.clear();
+	bounds_levels.clear();
 
 	bounds_grid_width = width / BOUNDS_CHUNK_SIZE;
 	bounds_grid_depth = depth / BOUNDS_CHUNK_SIZE;
@@ -2154,6 +2280,36 @@ void GodotHeightMapShape3D::_build_accelerator() {
 			bounds_grid[cx + cz * bounds_grid_width] = r;
 		}
 	}
+
+	// Build the pyramid by merging 2x2 nodes of the level below, until a single node is left.
+	int level_width = bounds_grid_width;
+	int level_depth = bounds_grid_depth;
+	while ((level_width > 1) || (level_depth > 1)) {
+		const int child_level = bounds_levels.size();
+		bounds_levels.resize(child_level + 1);
+
+		BoundsLevel &level = bounds_levels[child_level];
+		level.width = (level_width + 1) / 2;
+		level.depth = (level_depth + 1) / 2;
+		level.ranges.resize(level.width * level.depth);
+
+		for (int z = 0; z < level.depth; ++z) {
+			for (int x = 0; x < level.width; ++x) {
+				Range r = _get_bounds_node(child_level, x * 2, z * 2);
+				for (int cz = z * 2; cz < MIN(z * 2 + 2, level_depth); ++cz) {
+					for (int cx = x * 2; cx < MIN(x * 2 + 2, level_width); ++cx) {
+						const Range &child = _get_bounds_node(child_level, cx, cz);
+						r.min = MIN(r.min, child.min);
+						r.max = MAX(r.max, child.max);
+					}
+				}
+				level.ranges[x + z * level.width] = r;
+			}
+		}
+
+		level_width = level.width;
+		level_depth = level.depth;
+	}
 }
 
 void GodotHeightMapShape3D::_setup(const Vector<real_t> &p_heights, int p_width, int p_depth, real_t p_min_height, real_t p_max_height) {
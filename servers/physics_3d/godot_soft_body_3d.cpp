@@ -33,6 +33,7 @@
 #include "godot_space_3d.h"
 
 #include "core/math/geometry_3d.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/rb_map.h"
 #include "servers/rendering_server.h"
 
@@ -152,7 +153,18 @@ void GodotSoftBody3D::update_rendering_server(PhysicsServer3DRenderingServerHand
 	}
 
 	const uint32_t vertex_count = map_visual_to_physics.size();
-	for (uint32_t i = 0; i < vertex_count; ++i) {
+	if (is_using_threaded_mesh_update() && p_rendering_server_handler->supports_threaded_writes()) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_range_group_task(this, &GodotSoftBody3D::_update_rendering_server_task, p_rendering_server_handler, vertex_count, THREADED_MESH_UPDATE_GRAIN, -1, true, SNAME("Physics3DSoftBodyRenderingUpdate"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		_update_rendering_server_task(0, vertex_count, p_rendering_server_handler);
+	}
+
+	p_rendering_server_handler->set_aabb(bounds);
+}
+
+void GodotSoftBody3D::_update_rendering_server_task(uint32_t p_from, uint32_t p_to, PhysicsServer3DRenderingServerHandler *p_rendering_server_handler) {
+	for (uint32_t i = p_from; i < p_to; ++i) {
 		const uint32_t node_index = map_visual_to_physics[i];
 		const Node &node = nodes[node_index];
 		const Vector3 &vertex_position = node.x;
@@ -161,8 +173,6 @@ void GodotSoftBody3D::update_rendering_server(PhysicsServer3DRenderingServerHand
 		p_rendering_server_handler->set_vertex(i, &vertex_position);
 		p_rendering_server_handler->set_normal(i, &vertex_normal);
 	}
-
-	p_rendering_server_handler->set_aabb(bounds);
 }
 
 void GodotSoftBody3D::update_normals_and_centroids() {
@@ -188,6 +198,70 @@ void GodotSoftBody3D::update_normals_and_centroids() {
 	}
 }
 
+bool GodotSoftBody3D::is_using_threaded_mesh_update() const {
+	return faces.size() >= THREADED_MESH_UPDATE_MIN_FACES && get_space() && get_space()->is_using_threaded_soft_body_mesh_update();
+}
+
+void GodotSoftBody3D::update_normals_and_centroids_threaded() {
+	// Elements below the face count are faces, the rest are nodes. Both only read node positions,
+	// so they can all run at once.
+	const uint32_t element_count = faces.size() + nodes.size();
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_range_group_task(this, &GodotSoftBody3D::_update_normals_task, nullptr, element_count, THREADED_MESH_UPDATE_GRAIN, -1, true, SNAME("Physics3DSoftBodyNormals"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
+void GodotSoftBody3D::_update_normals_task(uint32_t p_from, uint32_t p_to, void *p_userdata) {
+	const uint32_t face_count = faces.size();
+	for (uint32_t i = p_from; i < p_to; ++i) {
+		if (i < face_count) {
+			Face &face = faces[i];
+			face.normal = vec3_cross(face.n[0]->x - face.n[2]->x, face.n[0]->x - face.n[1]->x);
+			face.normal.normalize();
+			face.centroid = 0.33333333333 * (face.n[0]->x + face.n[1]->x + face.n[2]->x);
+			continue;
+		}
+
+		// Sum up the unnormalized face normals in face order, as update_normals_and_centroids() does.
+		const uint32_t node_index = i - face_count;
+		Node &node = nodes[node_index];
+		node.n = Vector3();
+		for (uint32_t j = node_face_offsets[node_index]; j < node_face_offsets[node_index + 1]; ++j) {
+			const Face &face = faces[node_faces[j]];
+			node.n += vec3_cross(face.n[0]->x - face.n[2]->x, face.n[0]->x - face.n[1]->x);
+		}
+		real_t len = node.n.length();
+		if (len > CMP_EPSILON) {
+			node.n /= len;
+		}
+	}
+}
+
+void GodotSoftBody3D::_update_node_faces() {
+	const uint32_t node_count = nodes.size();
+	node_face_offsets.resize(node_count + 1);
+	memset(node_face_offsets.ptr(), 0, node_face_offsets.size() * sizeof(uint32_t));
+
+	for (const Face &face : faces) {
+		for (int i = 0; i < 3; ++i) {
+			node_face_offsets[face.n[i]->index + 1]++;
+		}
+	}
+	for (uint32_t i = 0; i < node_count; ++i) {
+		node_face_offsets[i + 1] += node_face_offsets[i];
+	}
+
+	LocalVector<uint32_t> fill;
+	fill.resize(node_count);
+	memcpy(fill.ptr(), node_face_offsets.ptr(), node_count * sizeof(uint32_t));
+
+	node_faces.resize(node_face_offsets[node_count]);
+	for (const Face &face : faces) {
+		for (int i = 0; i < 3; ++i) {
+			node_faces[fill[face.n[i]->index]++] = face.index;
+		}
+	}
+}
+
 void GodotSoftBody3D::update_bounds() {
 	AABB prev_bounds = bounds;
 	prev_bounds.grow_by(collision_margin);
@@ -579,6 +653,7 @@ bool GodotSoftBody3D::create_from_trimesh(const Vector<int> &p_indices, const Ve
 
 	generate_bending_constraints(2);
 	reoptimize_link_order();
+	_update_node_faces();
 
 	update_constants();
 	update_normals_and_centroids();
@@ -1042,9 +1117,6 @@ void GodotSoftBody3D::predict_motion(real_t p_delta) {
 		node.f = Vector3();
 	}
 
-	// Bounds and tree update.
-	update_bounds();
-
 	// Node tree update.
 	for (const Node &node : nodes) {
 		AABB node_aabb(node.x, Vector3());
@@ -1092,7 +1164,9 @@ void GodotSoftBody3D::solve_constraints(real_t p_delta) {
 		node.q = node.x;
 	}
 
-	update_normals_and_centroids();
+	if (!is_using_threaded_mesh_update()) {
+		update_normals_and_centroids();
+	}
 }
 
 void GodotSoftBody3D::solve_links(real_t kst, real_t ti) {
@@ -1219,6 +1293,8 @@ void GodotSoftBody3D::destroy() {
 	nodes.clear();
 	links.clear();
 	faces.clear();
+	node_face_offsets.clear();
+	node_faces.clear();
 
 	bounds = AABB();
 	deinitialize_shape();
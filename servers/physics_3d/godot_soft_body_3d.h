@@ -82,6 +82,11 @@ class GodotSoftBody3D : public GodotCollisionObject3D {
 	LocalVector<Link> links;
 	LocalVector<Face> faces;
 
+	// Indices of the faces using each node, so node normals can be gathered in parallel.
+	// The faces of node i are node_faces[node_face_offsets[i]] to node_faces[node_face_offsets[i + 1]].
+	LocalVector<uint32_t> node_face_offsets;
+	LocalVector<uint32_t> node_faces;
+
 	DynamicBVH node_tree;
 	DynamicBVH face_tree;
 
@@ -114,6 +119,11 @@ class GodotSoftBody3D : public GodotCollisionObject3D {
 	_FORCE_INLINE_ Vector3 _compute_area_windforce(const GodotArea3D *p_area, const Face *p_face);
 
 public:
+	// Meshes with at least this many faces can have their normals and rendering data
+	// updated on worker threads, see is_using_threaded_mesh_update().
+	static const uint32_t THREADED_MESH_UPDATE_MIN_FACES = 2048;
+	static const uint32_t THREADED_MESH_UPDATE_GRAIN = 256;
+
 	GodotSoftBody3D();
 
 	const AABB &get_bounds() const { return bounds; }
@@ -201,9 +211,17 @@ public:
 	void set_drag_coefficient(real_t p_val);
 	_FORCE_INLINE_ real_t get_drag_coefficient() const { return drag_coefficient; }
 
+	// predict_motion() and solve_constraints() only touch this soft body, so different soft bodies
+	// can run them on different threads. update_bounds() can change the broadphase and can't.
 	void predict_motion(real_t p_delta);
+	void update_bounds();
 	void solve_constraints(real_t p_delta);
 
+	// When true, solve_constraints() leaves the normals to update_normals_and_centroids_threaded(),
+	// which must then be called from outside any worker thread task.
+	bool is_using_threaded_mesh_update() const;
+	void update_normals_and_centroids_threaded();
+
 	_FORCE_INLINE_ uint32_t get_node_index(void *p_node) const { return static_cast<Node *>(p_node)->index; }
 	_FORCE_INLINE_ uint32_t get_face_index(void *p_face) const { return static_cast<Face *>(p_face)->index; }
 
@@ -219,7 +237,9 @@ protected:
 
 private:
 	void update_normals_and_centroids();
-	void update_bounds();
+	void _update_node_faces();
+	void _update_normals_task(uint32_t p_from, uint32_t p_to, void *p_userdata);
+	void _update_rendering_server_task(uint32_t p_from, uint32_t p_to, PhysicsServer3DRenderingServerHandler *p_rendering_server_handler);
 	void update_constants();
 	void update_area();
 	void reset_link_rest_lengths();
@@ -34,6 +34,7 @@
 #include "godot_physics_server_3d.h"
 
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
 
 #define TEST_MOTION_MARGIN_MIN_VALUE 0.0001
 #define TEST_MOTION_MIN_CONTACT_DEPTH_FACTOR 0.05
@@ -108,14 +109,18 @@ int GodotPhysicsDirectSpaceState3D::intersect_point(const PointParameters &p_par
 bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
 	ERR_FAIL_COND_V(space->locked, false);
 
+	int amount = space->broadphase->cull_segment(p_parameters.from, p_parameters.to, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+
+	return _intersect_ray_candidates(p_parameters, p_parameters.from, p_parameters.to, space->intersection_query_results, space->intersection_query_subindex_results, amount, r_result);
+}
+
+bool GodotPhysicsDirectSpaceState3D::_intersect_ray_candidates(const RayParameters &p_parameters, const Vector3 &p_from, const Vector3 &p_to, GodotCollisionObject3D *const *p_objects, const int *p_subindices, int p_amount, RayResult &r_result) {
 	Vector3 begin, end;
 	Vector3 normal;
-	begin = p_parameters.from;
-	end = p_parameters.to;
+	begin = p_from;
+	end = p_to;
 	normal = (end - begin).normalized();
 
-	int amount = space->broadphase->cull_segment(begin, end, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
-
 	//todo, create another array that references results, compute AABBs and check closest point to ray origin, sort, and stop evaluating results when beyond first collision
 
 	bool collided = false;
@@ -125,22 +130,22 @@ bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parame
 	const GodotCollisionObject3D *res_obj = nullptr;
 	real_t min_d = 1e10;
 
-	for (int i = 0; i < amount; i++) {
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+	for (int i = 0; i < p_amount; i++) {
+		if (!_can_collide_with(p_objects[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
-		if (p_parameters.pick_ray && !(space->intersection_query_results[i]->is_ray_pickable())) {
+		if (p_parameters.pick_ray && !(p_objects[i]->is_ray_pickable())) {
 			continue;
 		}
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(p_objects[i]->get_self())) {
 			continue;
 		}
 
-		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
+		const GodotCollisionObject3D *col_obj = p_objects[i];
 
-		int shape_idx = space->intersection_query_subindex_results[i];
+		int shape_idx = p_subindices[i];
 		Transform3D inv_xform = col_obj->get_shape_inv_transform(shape_idx) * col_obj->get_inv_transform();
 
 		Vector3 local_from = inv_xform.xform(begin);
@@ -264,51 +269,61 @@ bool GodotPhysicsDirectSpaceState3D::cast_motion(const ShapeParameters &p_parame
 	GodotShape3D *shape = GodotPhysicsServer3D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
 	ERR_FAIL_COND_V(!shape, false);
 
-	AABB aabb = p_parameters.transform.xform(shape->get_aabb());
-	aabb = aabb.merge(AABB(aabb.position + p_parameters.motion, aabb.size)); //motion
-	aabb = aabb.grow(p_parameters.margin);
+	AABB aabb = _get_cast_motion_aabb(shape, p_parameters.transform, p_parameters.motion, p_parameters.margin);
 
 	int amount = space->broadphase->cull_aabb(aabb, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
 
+	_cast_motion_candidates(p_parameters, shape, p_parameters.transform, p_parameters.motion, aabb, space->intersection_query_results, space->intersection_query_subindex_results, amount, p_closest_safe, p_closest_unsafe, r_info);
+
+	return true;
+}
+
+AABB GodotPhysicsDirectSpaceState3D::_get_cast_motion_aabb(const GodotShape3D *p_shape, const Transform3D &p_transform, const Vector3 &p_motion, real_t p_margin) {
+	AABB aabb = p_transform.xform(p_shape->get_aabb());
+	aabb = aabb.merge(AABB(aabb.position + p_motion, aabb.size)); //motion
+	return aabb.grow(p_margin);
+}
+
+void GodotPhysicsDirectSpaceState3D::_cast_motion_candidates(const ShapeParameters &p_parameters, GodotShape3D *p_shape, const Transform3D &p_transform, const Vector3 &p_motion, const AABB &p_aabb, GodotCollisionObject3D *const *p_objects, const int *p_subindices, int p_amount, real_t &r_closest_safe, real_t &r_closest_unsafe, ShapeRestInfo *r_info) {
 	real_t best_safe = 1;
 	real_t best_unsafe = 1;
 
-	Transform3D xform_inv = p_parameters.transform.affine_inverse();
+	Transform3D xform_inv = p_transform.affine_inverse();
 	GodotMotionShape3D mshape;
-	mshape.shape = shape;
-	mshape.motion = xform_inv.basis.xform(p_parameters.motion);
+	mshape.shape = p_shape;
+	mshape.motion = xform_inv.basis.xform(p_motion);
 
 	bool best_first = true;
 
-	Vector3 motion_normal = p_parameters.motion.normalized();
+	Vector3 motion_normal = p_motion.normalized();
 
 	Vector3 closest_A, closest_B;
 
-	for (int i = 0; i < amount; i++) {
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+	for (int i = 0; i < p_amount; i++) {
+		if (!_can_collide_with(p_objects[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(p_objects[i]->get_self())) {
 			continue; //ignore excluded
 		}
 
-		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
-		int shape_idx = space->intersection_query_subindex_results[i];
+		const GodotCollisionObject3D *col_obj = p_objects[i];
+		int shape_idx = p_subindices[i];
 
 		Vector3 point_A, point_B;
 		Vector3 sep_axis = motion_normal;
 
 		Transform3D col_obj_xform = col_obj->get_transform() * col_obj->get_shape_transform(shape_idx);
 		//test initial overlap, does it collide if going all the way?
-		if (GodotCollisionSolver3D::solve_distance(&mshape, p_parameters.transform, col_obj->get_shape(shape_idx), col_obj_xform, point_A, point_B, aabb, &sep_axis)) {
+		if (GodotCollisionSolver3D::solve_distance(&mshape, p_transform, col_obj->get_shape(shape_idx), col_obj_xform, point_A, point_B, p_aabb, &sep_axis)) {
 			continue;
 		}
 
 		//test initial overlap, ignore objects it's inside of.
 		sep_axis = motion_normal;
 
-		if (!GodotCollisionSolver3D::solve_distance(shape, p_parameters.transform, col_obj->get_shape(shape_idx), col_obj_xform, point_A, point_B, aabb, &sep_axis)) {
+		if (!GodotCollisionSolver3D::solve_distance(p_shape, p_transform, col_obj->get_shape(shape_idx), col_obj_xform, point_A, point_B, p_aabb, &sep_axis)) {
 			continue;
 		}
 
@@ -319,11 +334,11 @@ bool GodotPhysicsDirectSpaceState3D::cast_motion(const ShapeParameters &p_parame
 		for (int j = 0; j < 8; j++) { //steps should be customizable..
 			real_t fraction = low + (hi - low) * fraction_coeff;
 
-			mshape.motion = xform_inv.basis.xform(p_parameters.motion * fraction);
+			mshape.motion = xform_inv.basis.xform(p_motion * fraction);
 
 			Vector3 lA, lB;
 			Vector3 sep = motion_normal; //important optimization for this to work fast enough
-			bool collided = !GodotCollisionSolver3D::solve_distance(&mshape, p_parameters.transform, col_obj->get_shape(shape_idx), col_obj_xform, lA, lB, aabb, &sep);
+			bool collided = !GodotCollisionSolver3D::solve_distance(&mshape, p_transform, col_obj->get_shape(shape_idx), col_obj_xform, lA, lB, p_aabb, &sep);
 
 			if (collided) {
 				hi = fraction;
@@ -373,8 +388,104 @@ bool GodotPhysicsDirectSpaceState3D::cast_motion(const ShapeParameters &p_parame
 		}
 	}
 
-	p_closest_safe = best_safe;
-	p_closest_unsafe = best_unsafe;
+	r_closest_safe = best_safe;
+	r_closest_unsafe = best_unsafe;
+}
+
+void GodotPhysicsDirectSpaceState3D::_intersect_rays_task(uint32_t p_from, uint32_t p_to, BatchRayQuery *p_query) {
+	LocalVector<GodotCollisionObject3D *> objects;
+	LocalVector<int> subindices;
+	objects.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+	subindices.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+	GodotBroadPhase3D::CullBuffer cull_buffer;
+
+	uint32_t hits = 0;
+	for (uint32_t i = p_from; i < p_to; i++) {
+		int amount = space->broadphase->cull_segment_concurrent(p_query->from[i], p_query->to[i], objects.ptr(), GodotSpace3D::INTERSECTION_QUERY_MAX, cull_buffer, subindices.ptr());
+
+		RayResult &result = p_query->results[i];
+		result = RayResult();
+		if (_intersect_ray_candidates(*p_query->parameters, p_query->from[i], p_query->to[i], objects.ptr(), subindices.ptr(), amount, result)) {
+			hits++;
+		}
+	}
+	p_query->hit_count.add(hits);
+}
+
+int GodotPhysicsDirectSpaceState3D::intersect_rays(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results) {
+	ERR_FAIL_COND_V(space->locked, 0);
+	if (p_count <= 0) {
+		return 0;
+	}
+
+	BatchRayQuery query;
+	query.parameters = &p_parameters;
+	query.from = p_from;
+	query.to = p_to;
+	query.results = r_results;
+
+	space->broadphase->begin_concurrent_culls();
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	if (pool && p_count > BATCH_QUERY_MIN_GRAIN) {
+		WorkerThreadPool::GroupID group_task = pool->add_template_range_group_task(this, &GodotPhysicsDirectSpaceState3D::_intersect_rays_task, &query, p_count, BATCH_QUERY_MIN_GRAIN, -1, true, SNAME("Physics3DIntersectRays"));
+		pool->wait_for_group_task_completion(group_task);
+	} else {
+		_intersect_rays_task(0, p_count, &query);
+	}
+
+	space->broadphase->end_concurrent_culls();
+
+	return query.hit_count.get();
+}
+
+void GodotPhysicsDirectSpaceState3D::_cast_motions_task(uint32_t p_from, uint32_t p_to, BatchMotionQuery *p_query) {
+	LocalVector<GodotCollisionObject3D *> objects;
+	LocalVector<int> subindices;
+	objects.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+	subindices.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+	GodotBroadPhase3D::CullBuffer cull_buffer;
+
+	const ShapeParameters &parameters = *p_query->parameters;
+	Transform3D transform = parameters.transform;
+
+	for (uint32_t i = p_from; i < p_to; i++) {
+		transform.origin = p_query->origins[i];
+		const Vector3 &motion = p_query->motions[i];
+
+		AABB aabb = _get_cast_motion_aabb(p_query->shape, transform, motion, parameters.margin);
+		int amount = space->broadphase->cull_aabb_concurrent(aabb, objects.ptr(), GodotSpace3D::INTERSECTION_QUERY_MAX, cull_buffer, subindices.ptr());
+
+		_cast_motion_candidates(parameters, p_query->shape, transform, motion, aabb, objects.ptr(), subindices.ptr(), amount, p_query->closest_safe[i], p_query->closest_unsafe[i], nullptr);
+	}
+}
+
+bool GodotPhysicsDirectSpaceState3D::cast_motions(const ShapeParameters &p_parameters, const Vector3 *p_origins, const Vector3 *p_motions, int p_count, real_t *r_closest_safe, real_t *r_closest_unsafe) {
+	GodotShape3D *shape = GodotPhysicsServer3D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
+	ERR_FAIL_COND_V(!shape, false);
+	if (p_count <= 0) {
+		return true;
+	}
+
+	BatchMotionQuery query;
+	query.parameters = &p_parameters;
+	query.shape = shape;
+	query.origins = p_origins;
+	query.motions = p_motions;
+	query.closest_safe = r_closest_safe;
+	query.closest_unsafe = r_closest_unsafe;
+
+	space->broadphase->begin_concurrent_culls();
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	if (pool && p_count > BATCH_QUERY_MIN_GRAIN) {
+		WorkerThreadPool::GroupID group_task = pool->add_template_range_group_task(this, &GodotPhysicsDirectSpaceState3D::_cast_motions_task, &query, p_count, BATCH_QUERY_MIN_GRAIN, -1, true, SNAME("Physics3DCastMotions"));
+		pool->wait_for_group_task_completion(group_task);
+	} else {
+		_cast_motions_task(0, p_count, &query);
+	}
+
+	space->broadphase->end_concurrent_culls();
 
 	return true;
 }
@@ -1258,6 +1369,8 @@ GodotSpace3D::GodotSpace3D() {
 	body_angular_velocity_sleep_threshold = GLOBAL_GET("physics/3d/sleep_threshold_angular");
 	body_time_to_sleep = GLOBAL_GET("physics/3d/time_before_sleep");
 	solver_iterations = GLOBAL_GET("physics/3d/solver/solver_iterations");
+	use_batched_contact_solver = GLOBAL_GET("physics/3d/solver/use_batched_contact_solver");
+	use_threaded_soft_body_mesh_update = GLOBAL_GET("physics/3d/solver/use_threaded_soft_body_mesh_update");
 	contact_recycle_radius = GLOBAL_GET("physics/3d/solver/contact_recycle_radius");
 	contact_max_separation = GLOBAL_GET("physics/3d/solver/contact_max_separation");
 	contact_max_allowed_penetration = GLOBAL_GET("physics/3d/solver/contact_max_allowed_penetration");
@@ -117,6 +117,12 @@ void GodotStep3D::_setup_constraint(uint32_t p_constraint_index, void *p_userdat
 	constraint->setup(delta);
 }
 
+void GodotStep3D::_setup_constraints(uint32_t p_from, uint32_t p_to, void *p_userdata) {
+	for (uint32_t constraint_index = p_from; constraint_index < p_to; ++constraint_index) {
+		_setup_constraint(constraint_index);
+	}
+}
+
 void GodotStep3D::_pre_solve_island(LocalVector<GodotConstraint3D *> &p_constraint_island) const {
 	uint32_t constraint_count = p_constraint_island.size();
 	uint32_t valid_constraint_count = 0;
@@ -135,13 +141,38 @@ void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
 
 	int current_priority = 1;
 
+	// The contacts of the body pairs can be solved in batches, which takes the pairs out of the island.
+	// It only runs with the first priority, as body pairs don't have a higher one.
+	GodotContactSolver3D *contact_solver = nullptr;
+	if (use_batched_contact_solver && contact_solvers[p_island_index].setup(constraint_island)) {
+		contact_solver = &contact_solvers[p_island_index];
+		contact_solver->load_velocities();
+	}
+
 	uint32_t constraint_count = constraint_island.size();
-	while (constraint_count > 0) {
+	while (constraint_count > 0 || contact_solver) {
 		for (int i = 0; i < iterations; i++) {
+			if (contact_solver) {
+				contact_solver->solve(delta);
+				if (constraint_count > 0) {
+					contact_solver->store_velocities();
+				}
+			}
+
 			// Go through all iterations.
 			for (uint32_t constraint_index = 0; constraint_index < constraint_count; ++constraint_index) {
 				constraint_island[constraint_index]->solve(delta);
 			}
+
+			if (contact_solver && constraint_count > 0) {
+				contact_solver->load_velocities();
+			}
+		}
+
+		if (contact_solver) {
+			contact_solver->store_velocities();
+			contact_solver->finish();
+			contact_solver = nullptr;
 		}
 
 		// Check priority to keep only higher priority constraints.
@@ -158,6 +189,12 @@ void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
 	}
 }
 
+void GodotStep3D::_solve_islands(uint32_t p_from, uint32_t p_to, void *p_userdata) {
+	for (uint32_t island_index = p_from; island_index < p_to; ++island_index) {
+		_solve_island(island_index);
+	}
+}
+
 void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const {
 	bool can_sleep = true;
 
@@ -182,6 +219,18 @@ void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island
 	}
 }
 
+void GodotStep3D::_predict_soft_body_motions(uint32_t p_from, uint32_t p_to, void *p_userdata) {
+	for (uint32_t i = p_from; i < p_to; i++) {
+		active_soft_bodies[i]->predict_motion(delta);
+	}
+}
+
+void GodotStep3D::_solve_soft_body_constraints(uint32_t p_from, uint32_t p_to, void *p_userdata) {
+	for (uint32_t i = p_from; i < p_to; i++) {
+		active_soft_bodies[i]->solve_constraints(delta);
+	}
+}
+
 void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	p_space->lock(); // can't access space during this
 
@@ -190,6 +239,7 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	p_space->set_last_step(p_delta);
 
 	iterations = p_space->get_solver_iterations();
+	use_batched_contact_solver = p_space->is_using_batched_contact_solver();
 	delta = p_delta;
 
 	const SelfList<GodotBody3D>::List *body_list = &p_space->get_active_body_list();
@@ -212,13 +262,22 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* UPDATE SOFT BODY MOTION */
 
+	active_soft_bodies.clear();
 	const SelfList<GodotSoftBody3D> *sb = soft_body_list->first();
 	while (sb) {
-		sb->self()->predict_motion(p_delta);
+		active_soft_bodies.push_back(sb->self());
 		sb = sb->next();
 		active_count++;
 	}
 
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_range_group_task(this, &GodotStep3D::_predict_soft_body_motions, nullptr, active_soft_bodies.size(), 1, -1, true, SNAME("Physics3DSoftBodyPredictMotion"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	// Updating the bounds can change the broadphase, so this part runs here.
+	for (GodotSoftBody3D *soft_body : active_soft_bodies) {
+		soft_body->update_bounds();
+	}
+
 	p_space->set_active_objects(active_count);
 
 	// Update the broadphase to register collision pairs.
@@ -344,7 +403,7 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	/* SETUP CONSTRAINTS / PROCESS COLLISIONS */
 
 	uint32_t total_constraint_count = all_constraints.size();
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics3DConstraintSetup"));
+	group_task = WorkerThreadPool::get_singleton()->add_template_range_group_task(this, &GodotStep3D::_setup_constraints, nullptr, total_constraint_count, 16, -1, true, SNAME("Physics3DConstraintSetup"));
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	{ //profile
@@ -362,9 +421,13 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* SOLVE CONSTRAINT ISLANDS */
 
+	if (use_batched_contact_solver && contact_solvers.size() < island_count) {
+		contact_solvers.resize(island_count);
+	}
+
 	// Warning: _solve_island modifies the constraint islands for optimization purpose,
 	// their content is not reliable after these calls and shouldn't be used anymore.
-	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_island, nullptr, island_count, -1, true, SNAME("Physics3DConstraintSolveIslands"));
+	group_task = WorkerThreadPool::get_singleton()->add_template_range_group_task(this, &GodotStep3D::_solve_islands, nullptr, island_count, 1, -1, true, SNAME("Physics3DConstraintSolveIslands"));
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	{ //profile
@@ -390,10 +453,15 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* UPDATE SOFT BODY CONSTRAINTS */
 
-	sb = soft_body_list->first();
-	while (sb) {
-		sb->self()->solve_constraints(p_delta);
-		sb = sb->next();
+	group_task = WorkerThreadPool::get_singleton()->add_template_range_group_task(this, &GodotStep3D::_solve_soft_body_constraints, nullptr, active_soft_bodies.size(), 1, -1, true, SNAME("Physics3DSoftBodySolveConstraints"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	// Large meshes split their normals over the worker threads themselves, so they can't do it
+	// from within the task above.
+	for (GodotSoftBody3D *soft_body : active_soft_bodies) {
+		if (soft_body->is_using_threaded_mesh_update()) {
+			soft_body->update_normals_and_centroids_threaded();
+		}
 	}
 
 	{ //profile
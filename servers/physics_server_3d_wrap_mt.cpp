@@ -32,15 +32,341 @@
 
 #include "core/os/os.h"
 
+void PhysicsDirectBodyState3DSnapshot::Data::capture(PhysicsDirectBodyState3D *p_state) {
+	transform = p_state->get_transform();
+	linear_velocity = p_state->get_linear_velocity();
+	angular_velocity = p_state->get_angular_velocity();
+	total_gravity = p_state->get_total_gravity();
+	center_of_mass = p_state->get_center_of_mass();
+	center_of_mass_local = p_state->get_center_of_mass_local();
+	inverse_inertia = p_state->get_inverse_inertia();
+	constant_force = p_state->get_constant_force();
+	constant_torque = p_state->get_constant_torque();
+	principal_inertia_axes = p_state->get_principal_inertia_axes();
+	inverse_inertia_tensor = p_state->get_inverse_inertia_tensor();
+	total_angular_damp = p_state->get_total_angular_damp();
+	total_linear_damp = p_state->get_total_linear_damp();
+	inverse_mass = p_state->get_inverse_mass();
+	step = p_state->get_step();
+	sleeping = p_state->is_sleeping();
+
+	contacts.resize(p_state->get_contact_count());
+	for (uint32_t i = 0; i < contacts.size(); i++) {
+		Contact &contact = contacts[i];
+		contact.local_position = p_state->get_contact_local_position(i);
+		contact.local_normal = p_state->get_contact_local_normal(i);
+		contact.impulse = p_state->get_contact_impulse(i);
+		contact.local_velocity = p_state->get_contact_local_velocity_at_position(i);
+		contact.collider_position = p_state->get_contact_collider_position(i);
+		contact.collider_velocity = p_state->get_contact_collider_velocity_at_position(i);
+		contact.collider = p_state->get_contact_collider(i);
+		contact.collider_id = p_state->get_contact_collider_id(i);
+		contact.local_shape = p_state->get_contact_local_shape(i);
+		contact.collider_shape = p_state->get_contact_collider_shape(i);
+	}
+}
+
+const PhysicsDirectBodyState3DSnapshot::Data &PhysicsDirectBodyState3DSnapshot::_get_data() const {
+	static const Data empty_data;
+	const Data *data = server->body_snapshots[server->front_snapshot].getptr(body);
+	return data ? *data : empty_data;
+}
+
+PhysicsDirectBodyState3DSnapshot::Data *PhysicsDirectBodyState3DSnapshot::_get_data_for_write() {
+	return server->body_snapshots[server->front_snapshot].getptr(body);
+}
+
+Vector3 PhysicsDirectBodyState3DSnapshot::get_total_gravity() const {
+	return _get_data().total_gravity;
+}
+
+real_t PhysicsDirectBodyState3DSnapshot::get_total_angular_damp() const {
+	return _get_data().total_angular_damp;
+}
+
+real_t PhysicsDirectBodyState3DSnapshot::get_total_linear_damp() const {
+	return _get_data().total_linear_damp;
+}
+
+Vector3 PhysicsDirectBodyState3DSnapshot::get_center_of_mass() const {
+	return _get_data().center_of_mass;
+}
+
+Vector3 PhysicsDirectBodyState3DSnapshot::get_center_of_mass_local() const {
+	return _get_data().center_of_mass_local;
+}
+
+Basis PhysicsDirectBodyState3DSnapshot::get_principal_inertia_axes() const {
+	return _get_data().principal_inertia_axes;
+}
+
+real_t PhysicsDirectBodyState3DSnapshot::get_inverse_mass() const {
+	return _get_data().inverse_mass;
+}
+
+Vector3 PhysicsDirectBodyState3DSnapshot::get_inverse_inertia() const {
+	return _get_data().inverse_inertia;
+}
+
+Basis PhysicsDirectBodyState3DSnapshot::get_inverse_inertia_tensor() const {
+	return _get_data().inverse_inertia_tensor;
+}
+
+void PhysicsDirectBodyState3DSnapshot::set_linear_velocity(const Vector3 &p_velocity) {
+	server->body_set_state(body, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY, p_velocity);
+	Data *data = _get_data_for_write();
+	if (data) {
+		data->linear_velocity = p_velocity;
+	}
+}
+
+Vector3 PhysicsDirectBodyState3DSnapshot::get_linear_velocity() const {
+	return _get_data().linear_velocity;
+}
+
+void PhysicsDirectBodyState3DSnapshot::set_angular_velocity(const Vector3 &p_velocity) {
+	server->body_set_state(body, PhysicsServer3D::BODY_STATE_ANGULAR_VELOCITY, p_velocity);
+	Data *data = _get_data_for_write();
+	if (data) {
+		data->angular_velocity = p_velocity;
+	}
+}
+
+Vector3 PhysicsDirectBodyState3DSnapshot::get_angular_velocity() const {
+	return _get_data().angular_velocity;
+}
+
+void PhysicsDirectBodyState3DSnapshot::set_transform(const Transform3D &p_transform) {
+	server->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, p_transform);
+	Data *data = _get_data_for_write();
+	if (data) {
+		data->transform = p_transform;
+	}
+}
+
+Transform3D PhysicsDirectBodyState3DSnapshot::get_transform() const {
+	return _get_data().transform;
+}
+
+Vector3 PhysicsDirectBodyState3DSnapshot::get_velocity_at_local_position(const Vector3 &p_position) const {
+	const Data &data = _get_data();
+	return data.linear_velocity + data.angular_velocity.cross(p_position - data.center_of_mass);
+}
+
+void PhysicsDirectBodyState3DSnapshot::apply_central_impulse(const Vector3 &p_impulse) {
+	server->body_apply_central_impulse(body, p_impulse);
+}
+
+void PhysicsDirectBodyState3DSnapshot::apply_impulse(const Vector3 &p_impulse, const Vector3 &p_position) {
+	server->body_apply_impulse(body, p_impulse, p_position);
+}
+
+void PhysicsDirectBodyState3DSnapshot::apply_torque_impulse(const Vector3 &p_impulse) {
+	server->body_apply_torque_impulse(body, p_impulse);
+}
+
+void PhysicsDirectBodyState3DSnapshot::apply_central_force(const Vector3 &p_force) {
+	server->body_apply_central_force(body, p_force);
+}
+
+void PhysicsDirectBodyState3DSnapshot::apply_force(const Vector3 &p_force, const Vector3 &p_position) {
+	server->body_apply_force(body, p_force, p_position);
+}
+
+void PhysicsDirectBodyState3DSnapshot::apply_torque(const Vector3 &p_torque) {
+	server->body_apply_torque(body, p_torque);
+}
+
+void PhysicsDirectBodyState3DSnapshot::add_constant_central_force(const Vector3 &p_force) {
+	server->body_add_constant_central_force(body, p_force);
+	Data *data = _get_data_for_write();
+	if (data) {
+		data->constant_force += p_force;
+	}
+}
+
+void PhysicsDirectBodyState3DSnapshot::add_constant_force(const Vector3 &p_force, const Vector3 &p_position) {
+	server->body_add_constant_force(body, p_force, p_position);
+	Data *data = _get_data_for_write();
+	if (data) {
+		data->constant_force += p_force;
+		data->constant_torque += (p_position - data->center_of_mass).cross(p_force);
+	}
+}
+
+void PhysicsDirectBodyState3DSnapshot::add_constant_torque(const Vector3 &p_torque) {
+	server->body_add_constant_torque(body, p_torque);
+	Data *data = _get_data_for_write();
+	if (data) {
+		data->constant_torque += p_torque;
+	}
+}
+
+void PhysicsDirectBodyState3DSnapshot::set_constant_force(const Vector3 &p_force) {
+	server->body_set_constant_force(body, p_force);
+	Data *data = _get_data_for_write();
+	if (data) {
+		data->constant_force = p_force;
+	}
+}
+
+Vector3 PhysicsDirectBodyState3DSnapshot::get_constant_force() const {
+	return _get_data().constant_force;
+}
+
+void PhysicsDirectBodyState3DSnapshot::set_constant_torque(const Vector3 &p_torque) {
+	server->body_set_constant_torque(body, p_torque);
+	Data *data = _get_data_for_write();
+	if (data) {
+		data->constant_torque = p_torque;
+	}
+}
+
+Vector3 PhysicsDirectBodyState3DSnapshot::get_constant_torque() const {
+	return _get_data().constant_torque;
+}
+
+void PhysicsDirectBodyState3DSnapshot::set_sleep_state(bool p_sleep) {
+	server->body_set_state(body, PhysicsServer3D::BODY_STATE_SLEEPING, p_sleep);
+	Data *data = _get_data_for_write();
+	if (data) {
+		data->sleeping = p_sleep;
+	}
+}
+
+bool PhysicsDirectBodyState3DSnapshot::is_sleeping() const {
+	return _get_data().sleeping;
+}
+
+int PhysicsDirectBodyState3DSnapshot::get_contact_count() const {
+	return _get_data().contacts.size();
+}
+
+Vector3 PhysicsDirectBodyState3DSnapshot::get_contact_local_position(int p_contact_idx) const {
+	const Data &data = _get_data();
+	ERR_FAIL_UNSIGNED_INDEX_V((uint32_t)p_contact_idx, data.contacts.size(), Vector3());
+	return data.contacts[p_contact_idx].local_position;
+}
+
+Vector3 PhysicsDirectBodyState3DSnapshot::get_contact_local_normal(int p_contact_idx) const {
+	const Data &data = _get_data();
+	ERR_FAIL_UNSIGNED_INDEX_V((uint32_t)p_contact_idx, data.contacts.size(), Vector3());
+	return data.contacts[p_contact_idx].local_normal;
+}
+
+Vector3 PhysicsDirectBodyState3DSnapshot::get_contact_impulse(int p_contact_idx) const {
+	const Data &data = _get_data();
+	ERR_FAIL_UNSIGNED_INDEX_V((uint32_t)p_contact_idx, data.contacts.size(), Vector3());
+	return data.contacts[p_contact_idx].impulse;
+}
+
+int PhysicsDirectBodyState3DSnapshot::get_contact_local_shape(int p_contact_idx) const {
+	const Data &data = _get_data();
+	ERR_FAIL_UNSIGNED_INDEX_V((uint32_t)p_contact_idx, data.contacts.size(), -1);
+	return data.contacts[p_contact_idx].local_shape;
+}
+
+Vector3 PhysicsDirectBodyState3DSnapshot::get_contact_local_velocity_at_position(int p_contact_idx) const {
+	const Data &data = _get_data();
+	ERR_FAIL_UNSIGNED_INDEX_V((uint32_t)p_contact_idx, data.contacts.size(), Vector3());
+	return data.contacts[p_contact_idx].local_velocity;
+}
+
+RID PhysicsDirectBodyState3DSnapshot::get_contact_collider(int p_contact_idx) const {
+	const Data &data = _get_data();
+	ERR_FAIL_UNSIGNED_INDEX_V((uint32_t)p_contact_idx, data.contacts.size(), RID());
+	return data.contacts[p_contact_idx].collider;
+}
+
+Vector3 PhysicsDirectBodyState3DSnapshot::get_contact_collider_position(int p_contact_idx) const {
+	const Data &data = _get_data();
+	ERR_FAIL_UNSIGNED_INDEX_V((uint32_t)p_contact_idx, data.contacts.size(), Vector3());
+	return data.contacts[p_contact_idx].collider_position;
+}
+
+ObjectID PhysicsDirectBodyState3DSnapshot::get_contact_collider_id(int p_contact_idx) const {
+	const Data &data = _get_data();
+	ERR_FAIL_UNSIGNED_INDEX_V((uint32_t)p_contact_idx, data.contacts.size(), ObjectID());
+	return data.contacts[p_contact_idx].collider_id;
+}
+
+int PhysicsDirectBodyState3DSnapshot::get_contact_collider_shape(int p_contact_idx) const {
+	const Data &data = _get_data();
+	ERR_FAIL_UNSIGNED_INDEX_V((uint32_t)p_contact_idx, data.contacts.size(), 0);
+	return data.contacts[p_contact_idx].collider_shape;
+}
+
+Vector3 PhysicsDirectBodyState3DSnapshot::get_contact_collider_velocity_at_position(int p_contact_idx) const {
+	const Data &data = _get_data();
+	ERR_FAIL_UNSIGNED_INDEX_V((uint32_t)p_contact_idx, data.contacts.size(), Vector3());
+	return data.contacts[p_contact_idx].collider_velocity;
+}
+
+PhysicsDirectSpaceState3D *PhysicsDirectBodyState3DSnapshot::get_space_state() {
+	// Space queries still need the server to be synced, so this errors outside of physics process.
+	return server->space_get_direct_state(_get_data().space);
+}
+
+real_t PhysicsDirectBodyState3DSnapshot::get_step() const {
+	return _get_data().step;
+}
+
+PhysicsDirectBodyState3DSnapshot::PhysicsDirectBodyState3DSnapshot(PhysicsServer3DWrapMT *p_server, RID p_body) {
+	server = p_server;
+	body = p_body;
+}
+
 void PhysicsServer3DWrapMT::thread_exit() {
 	exit = true;
 }
 
 void PhysicsServer3DWrapMT::thread_step(real_t p_delta) {
 	physics_server_3d->step(p_delta);
+	if (pipelined) {
+		_capture_body_snapshots();
+	}
 	step_sem.post();
 }
 
+void PhysicsServer3DWrapMT::thread_track_body(RID p_body) {
+	tracked_bodies.insert(p_body);
+}
+
+void PhysicsServer3DWrapMT::thread_untrack_body(RID p_body) {
+	tracked_bodies.erase(p_body);
+}
+
+void PhysicsServer3DWrapMT::_capture_body_snapshots() {
+	if (tracked_bodies.is_empty()) {
+		return;
+	}
+
+	// The main thread only reads the front buffer until the next sync().
+	HashMap<RID, PhysicsDirectBodyState3DSnapshot::Data> &back = body_snapshots[1 - front_snapshot];
+
+	// Direct states are only accessible while synced.
+	physics_server_3d->sync();
+	for (const RID &E : tracked_bodies) {
+		PhysicsDirectBodyState3D *state = physics_server_3d->body_get_direct_state(E);
+		if (!state) {
+			back.erase(E);
+			continue;
+		}
+		PhysicsDirectBodyState3DSnapshot::Data &data = back[E];
+		data.capture(state);
+		data.space = physics_server_3d->body_get_space(E);
+	}
+	physics_server_3d->end_sync();
+}
+
+void PhysicsServer3DWrapMT::_track_body(RID p_body) {
+	if (snapshot_bodies.has(p_body)) {
+		return;
+	}
+	snapshot_bodies.insert(p_body);
+	command_queue.push(this, &PhysicsServer3DWrapMT::thread_track_body, p_body);
+}
+
 void PhysicsServer3DWrapMT::_thread_callback(void *_instance) {
 	PhysicsServer3DWrapMT *vsmt = reinterpret_cast<PhysicsServer3DWrapMT *>(_instance);
 
@@ -83,6 +409,15 @@ void PhysicsServer3DWrapMT::sync() {
 			step_sem.wait(); //must not wait if a step was not issued
 		}
 	}
+	if (pipelined) {
+		front_snapshot = 1 - front_snapshot;
+		// Bodies freed while the last step was running may have been captured by it.
+		for (const RID &E : freed_snapshots) {
+			body_snapshots[front_snapshot].erase(E);
+		}
+		freed_snapshots.clear();
+	}
+	in_sync = true;
 	physics_server_3d->sync();
 }
 
@@ -91,9 +426,97 @@ void PhysicsServer3DWrapMT::flush_queries() {
 }
 
 void PhysicsServer3DWrapMT::end_sync() {
+	in_sync = false;
 	physics_server_3d->end_sync();
 }
 
+Variant PhysicsServer3DWrapMT::body_get_state(RID p_body, BodyState p_state) const {
+	if (_is_reading_snapshots()) {
+		const PhysicsDirectBodyState3DSnapshot::Data *data = body_snapshots[front_snapshot].getptr(p_body);
+		if (data) {
+			switch (p_state) {
+				case BODY_STATE_TRANSFORM:
+					return data->transform;
+				case BODY_STATE_LINEAR_VELOCITY:
+					return data->linear_velocity;
+				case BODY_STATE_ANGULAR_VELOCITY:
+					return data->angular_velocity;
+				case BODY_STATE_SLEEPING:
+					return data->sleeping;
+				default:
+					break;
+			}
+		}
+	}
+
+	if (Thread::get_caller_id() != server_thread) {
+		Variant ret;
+		command_queue.push_and_ret(physics_server_3d, &PhysicsServer3D::body_get_state, p_body, p_state, &ret);
+		return ret;
+	} else {
+		command_queue.flush_if_pending();
+		return physics_server_3d->body_get_state(p_body, p_state);
+	}
+}
+
+void PhysicsServer3DWrapMT::body_set_state_sync_callback(RID p_body, const Callable &p_callable) {
+	if (Thread::get_caller_id() != server_thread) {
+		command_queue.push(physics_server_3d, &PhysicsServer3D::body_set_state_sync_callback, p_body, p_callable);
+	} else {
+		command_queue.flush_if_pending();
+		physics_server_3d->body_set_state_sync_callback(p_body, p_callable);
+	}
+
+	// Bodies synced to nodes are the ones most likely to be read during idle processing.
+	if (pipelined && p_callable.is_valid() && Thread::get_caller_id() == main_thread) {
+		_track_body(p_body);
+	}
+}
+
+PhysicsDirectBodyState3D *PhysicsServer3DWrapMT::body_get_direct_state(RID p_body) {
+	ERR_FAIL_COND_V(main_thread != Thread::get_caller_id(), nullptr);
+	if (!_is_reading_snapshots()) {
+		return physics_server_3d->body_get_direct_state(p_body);
+	}
+
+	if (!body_snapshots[front_snapshot].has(p_body)) {
+		// Snapshots are available from the next completed step on.
+		_track_body(p_body);
+		return nullptr;
+	}
+
+	PhysicsDirectBodyState3DSnapshot **state = snapshot_states.getptr(p_body);
+	if (state) {
+		return *state;
+	}
+
+	PhysicsDirectBodyState3DSnapshot *snapshot = memnew(PhysicsDirectBodyState3DSnapshot(this, p_body));
+	snapshot_states.insert(p_body, snapshot);
+	return snapshot;
+}
+
+void PhysicsServer3DWrapMT::free(RID p_rid) {
+	if (pipelined && Thread::get_caller_id() == main_thread && snapshot_bodies.has(p_rid)) {
+		snapshot_bodies.erase(p_rid);
+		command_queue.push(this, &PhysicsServer3DWrapMT::thread_untrack_body, p_rid);
+		body_snapshots[front_snapshot].erase(p_rid);
+		freed_snapshots.push_back(p_rid);
+
+		PhysicsDirectBodyState3DSnapshot **state = snapshot_states.getptr(p_rid);
+		if (state) {
+			memdelete(*state);
+			snapshot_states.erase(p_rid);
+		}
+	}
+
+	if (Thread::get_caller_id() != server_thread) {
+		command_queue.push(physics_server_3d, &PhysicsServer3D::free, p_rid);
+	} else {
+		command_queue.flush_if_pending();
+		physics_server_3d->free(p_rid);
+	}
+}
+
 void PhysicsServer3DWrapMT::init() {
 	if (create_thread) {
 		//OS::get_singleton()->release_rendering_thread();
@@ -121,6 +544,7 @@ PhysicsServer3DWrapMT::PhysicsServer3DWrapMT(PhysicsServer3D *p_contained, bool
 	create_thread = p_create_thread;
 
 	pool_max_size = GLOBAL_GET("memory/limits/multithreaded_server/rid_pool_prealloc");
+	pipelined = p_create_thread && bool(GLOBAL_GET("physics/3d/pipeline_body_states"));
 
 	if (!p_create_thread) {
 		server_thread = Thread::get_caller_id();
@@ -132,6 +556,9 @@ PhysicsServer3DWrapMT::PhysicsServer3DWrapMT(PhysicsServer3D *p_contained, bool
 }
 
 PhysicsServer3DWrapMT::~PhysicsServer3DWrapMT() {
+	for (const KeyValue<RID, PhysicsDirectBodyState3DSnapshot *> &E : snapshot_states) {
+		memdelete(E.value);
+	}
 	memdelete(physics_server_3d);
 	//finish();
 }
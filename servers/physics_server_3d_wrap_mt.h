@@ -34,6 +34,9 @@
 #include "core/config/project_settings.h"
 #include "core/os/thread.h"
 #include "core/templates/command_queue_mt.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
 #include "servers/physics_server_3d.h"
 
 #ifdef DEBUG_SYNC
@@ -42,7 +45,125 @@
 #define SYNC_DEBUG
 #endif
 
+class PhysicsServer3DWrapMT;
+
+// Read-only view of a body as of the last completed step, handed out while the
+// server thread is still stepping. Writes are queued to the server thread.
+class PhysicsDirectBodyState3DSnapshot : public PhysicsDirectBodyState3D {
+	GDCLASS(PhysicsDirectBodyState3DSnapshot, PhysicsDirectBodyState3D);
+
+public:
+	struct Contact {
+		Vector3 local_position;
+		Vector3 local_normal;
+		Vector3 impulse;
+		Vector3 local_velocity;
+		Vector3 collider_position;
+		Vector3 collider_velocity;
+		RID collider;
+		ObjectID collider_id;
+		int local_shape = 0;
+		int collider_shape = 0;
+	};
+
+	struct Data {
+		Transform3D transform;
+		Vector3 linear_velocity;
+		Vector3 angular_velocity;
+		Vector3 total_gravity;
+		Vector3 center_of_mass;
+		Vector3 center_of_mass_local;
+		Vector3 inverse_inertia;
+		Vector3 constant_force;
+		Vector3 constant_torque;
+		Basis principal_inertia_axes;
+		Basis inverse_inertia_tensor;
+		real_t total_angular_damp = 0.0;
+		real_t total_linear_damp = 0.0;
+		real_t inverse_mass = 0.0;
+		real_t step = 0.0;
+		bool sleeping = false;
+		RID space;
+		LocalVector<Contact> contacts;
+
+		void capture(PhysicsDirectBodyState3D *p_state);
+	};
+
+private:
+	PhysicsServer3DWrapMT *server = nullptr;
+	RID body;
+
+	const Data &_get_data() const;
+	Data *_get_data_for_write();
+
+public:
+	virtual Vector3 get_total_gravity() const override;
+	virtual real_t get_total_angular_damp() const override;
+	virtual real_t get_total_linear_damp() const override;
+
+	virtual Vector3 get_center_of_mass() const override;
+	virtual Vector3 get_center_of_mass_local() const override;
+	virtual Basis get_principal_inertia_axes() const override;
+	virtual real_t get_inverse_mass() const override;
+	virtual Vector3 get_inverse_inertia() const override;
+	virtual Basis get_inverse_inertia_tensor() const override;
+
+	virtual void set_linear_velocity(const Vector3 &p_velocity) override;
+	virtual Vector3 get_linear_velocity() const override;
+
+	virtual void set_angular_velocity(const Vector3 &p_velocity) override;
+	virtual Vector3 get_angular_velocity() const override;
+
+	virtual void set_transform(const Transform3D &p_transform) override;
+	virtual Transform3D get_transform() const override;
+
+	virtual Vector3 get_velocity_at_local_position(const Vector3 &p_position) const override;
+
+	virtual void apply_central_impulse(const Vector3 &p_impulse) override;
+	virtual void apply_impulse(const Vector3 &p_impulse, const Vector3 &p_position = Vector3()) override;
+	virtual void apply_torque_impulse(const Vector3 &p_impulse) override;
+
+	virtual void apply_central_force(const Vector3 &p_force) override;
+	virtual void apply_force(const Vector3 &p_force, const Vector3 &p_position = Vector3()) override;
+	virtual void apply_torque(const Vector3 &p_torque) override;
+
+	virtual void add_constant_central_force(const Vector3 &p_force) override;
+	virtual void add_constant_force(const Vector3 &p_force, const Vector3 &p_position = Vector3()) override;
+	virtual void add_constant_torque(const Vector3 &p_torque) override;
+
+	virtual void set_constant_force(const Vector3 &p_force) override;
+	virtual Vector3 get_constant_force() const override;
+
+	virtual void set_constant_torque(const Vector3 &p_torque) override;
+	virtual Vector3 get_constant_torque() const override;
+
+	virtual void set_sleep_state(bool p_sleep) override;
+	virtual bool is_sleeping() const override;
+
+	virtual int get_contact_count() const override;
+
+	virtual Vector3 get_contact_local_position(int p_contact_idx) const override;
+	virtual Vector3 get_contact_local_normal(int p_contact_idx) const override;
+	virtual Vector3 get_contact_impulse(int p_contact_idx) const override;
+	virtual int get_contact_local_shape(int p_contact_idx) const override;
+	virtual Vector3 get_contact_local_velocity_at_position(int p_contact_idx) const override;
+
+	virtual RID get_contact_collider(int p_contact_idx) const override;
+	virtual Vector3 get_contact_collider_position(int p_contact_idx) const override;
+	virtual ObjectID get_contact_collider_id(int p_contact_idx) const override;
+	virtual int get_contact_collider_shape(int p_contact_idx) const override;
+	virtual Vector3 get_contact_collider_velocity_at_position(int p_contact_idx) const override;
+
+	virtual PhysicsDirectSpaceState3D *get_space_state() override;
+
+	virtual real_t get_step() const override;
+
+	PhysicsDirectBodyState3DSnapshot(PhysicsServer3DWrapMT *p_server, RID p_body);
+};
+
 class PhysicsServer3DWrapMT : public PhysicsServer3D {
+	friend class PhysicsDirectBodyState3DSnapshot;
+
 	mutable PhysicsServer3D *physics_server_3d;
 
 	mutable CommandQueueMT command_queue;
@@ -67,6 +188,26 @@ class PhysicsServer3DWrapMT : public PhysicsServer3D {
 	Mutex alloc_mutex;
 	int pool_max_size = 0;
 
+	// Pipelined body states: the server thread captures the tracked bodies into the
+	// back buffer at the end of each step, and sync() swaps it to the front so the
+	// main thread can keep reading the last completed step while the next one runs.
+	bool pipelined = false;
+	bool in_sync = false;
+	HashSet<RID> tracked_bodies; // Server thread only.
+	HashMap<RID, PhysicsDirectBodyState3DSnapshot::Data> body_snapshots[2];
+	int front_snapshot = 0;
+	HashSet<RID> snapshot_bodies; // Main thread only.
+	HashMap<RID, PhysicsDirectBodyState3DSnapshot *> snapshot_states; // Main thread only.
+	LocalVector<RID> freed_snapshots; // Main thread only, erased again after the next swap.
+
+	void thread_track_body(RID p_body);
+	void thread_untrack_body(RID p_body);
+	void _capture_body_snapshots();
+	void _track_body(RID p_body);
+	_FORCE_INLINE_ bool _is_reading_snapshots() const {
+		return pipelined && !in_sync && Thread::get_caller_id() == main_thread;
+	}
+
 public:
 #define ServerName PhysicsServer3D
 #define ServerNameWrapMT PhysicsServer3DWrapMT
@@ -217,7 +358,7 @@ public:
 	FUNC1(body_reset_mass_properties, RID);
 
 	FUNC3(body_set_state, RID, BodyState, const Variant &);
-	FUNC2RC(Variant, body_get_state, RID, BodyState);
+	virtual Variant body_get_state(RID p_body, BodyState p_state) const override;
 
 	FUNC2(body_apply_torque_impulse, RID, const Vector3 &);
 	FUNC2(body_apply_central_impulse, RID, const Vector3 &);
@@ -255,7 +396,7 @@ public:
 	FUNC2(body_set_omit_force_integration, RID, bool);
 	FUNC1RC(bool, body_is_omitting_force_integration, RID);
 
-	FUNC2(body_set_state_sync_callback, RID, const Callable &);
+	virtual void body_set_state_sync_callback(RID p_body, const Callable &p_callable) override;
 	FUNC3(body_set_force_integration_callback, RID, const Callable &, const Variant &);
 
 	FUNC2(body_set_ray_pickable, RID, bool);
@@ -266,10 +407,8 @@ public:
 	}
 
 	// this function only works on physics process, errors and returns null otherwise
-	PhysicsDirectBodyState3D *body_get_direct_state(RID p_body) override {
-		ERR_FAIL_COND_V(main_thread != Thread::get_caller_id(), nullptr);
-		return physics_server_3d->body_get_direct_state(p_body);
-	}
+	// (when pipelined, it returns a snapshot of the last completed step outside of it)
+	PhysicsDirectBodyState3D *body_get_direct_state(RID p_body) override;
 
 	/* SOFT BODY API */
 
@@ -380,7 +519,7 @@ public:
 
 	/* MISC */
 
-	FUNC1(free, RID);
+	virtual void free(RID p_rid) override;
 	FUNC1(set_active, bool);
 
 	virtual void init() override;
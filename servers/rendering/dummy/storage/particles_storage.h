@@ -109,6 +109,7 @@ public:
 	virtual void particles_collision_set_height_field_resolution(RID p_particles_collision, RS::ParticlesCollisionHeightfieldResolution p_resolution) override {}
 	virtual AABB particles_collision_get_aabb(RID p_particles_collision) const override { return AABB(); }
 	virtual bool particles_collision_is_heightfield(RID p_particles_collision) const override { return false; }
+	virtual Vector<uint8_t> particles_collision_bake_sdf(const Vector<Vector3> &p_faces, const AABB &p_aabb, const Vector3i &p_size, float p_thickness) override { return Vector<uint8_t>(); }
 
 	virtual RID particles_collision_instance_create(RID p_collision) override { return RID(); }
 	virtual void particles_collision_instance_free(RID p_rid) override {}
@@ -123,6 +123,9 @@ public:
 	virtual void texture_set_detect_normal_callback(RID p_texture, RS::TextureDetectCallback p_callback, void *p_userdata) override{};
 	virtual void texture_set_detect_roughness_callback(RID p_texture, RS::TextureDetectRoughnessCallback p_callback, void *p_userdata) override{};
 
+	virtual void texture_set_stream_callback(RID p_texture, RS::TextureStreamCallback p_callback, void *p_userdata) override{};
+	virtual void texture_stream_request(RID p_texture, int p_size) override{};
+
 	virtual void texture_debug_usage(List<RS::TextureInfo> *r_info) override{};
 
 	virtual void texture_set_force_redraw_if_visible(RID p_texture, bool p_enable) override{};
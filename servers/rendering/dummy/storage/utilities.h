@@ -110,6 +110,10 @@ public:
 	virtual RenderingDevice::DeviceType get_video_adapter_type() const override { return RenderingDevice::DeviceType::DEVICE_TYPE_OTHER; }
 	virtual String get_video_adapter_api_version() const override { return String(); }
 
+	virtual Error pipeline_bundle_save(const String &p_path) override { return ERR_UNAVAILABLE; }
+	virtual Error pipeline_bundle_precompile(const String &p_path) override { return ERR_UNAVAILABLE; }
+	virtual float pipeline_bundle_get_precompile_progress() const override { return 1.0; }
+
 	virtual Size2i get_maximum_viewport_size() const override { return Size2i(); };
 };
 
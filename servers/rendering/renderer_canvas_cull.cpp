@@ -30,6 +30,7 @@
 
 #include "renderer_canvas_cull.h"
 
+#include "core/config/project_settings.h"
 #include "core/math/geometry_2d.h"
 #include "renderer_viewport.h"
 #include "rendering_server_default.h"
@@ -222,6 +223,127 @@ void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *
 	}
 }
 
+void RendererCanvasCull::_index_add_child(Item::ChildIndex *p_index, Item *p_child) {
+	p_child->parent_index = p_index;
+	p_child->index_bounds_changed();
+}
+
+void RendererCanvasCull::_index_remove_child(Item *p_child) {
+	Item::ChildIndex *index = p_child->parent_index;
+	if (!index) {
+		return;
+	}
+
+	if (p_child->index_id.is_valid()) {
+		index->bvh.remove(p_child->index_id);
+		p_child->index_id = DynamicBVH::ID();
+	}
+	if (p_child->index_unbounded) {
+		index->unbounded_items.remove_at_unordered(index->unbounded_items.find(p_child));
+		p_child->index_unbounded = false;
+	}
+	if (p_child->index_dirty) {
+		index->dirty_items.remove_at_unordered(index->dirty_items.find(p_child));
+		p_child->index_dirty = false;
+	}
+	p_child->parent_index = nullptr;
+}
+
+void RendererCanvasCull::_free_child_index(Item *p_item) {
+	if (!p_item->child_index) {
+		return;
+	}
+
+	for (int i = 0; i < p_item->child_items.size(); i++) {
+		Item *child = p_item->child_items[i];
+		child->parent_index = nullptr;
+		child->index_id = DynamicBVH::ID();
+		child->index_unbounded = false;
+		child->index_dirty = false;
+	}
+
+	memdelete(p_item->child_index);
+	p_item->child_index = nullptr;
+}
+
+RendererCanvasCull::Item **RendererCanvasCull::_cull_child_index(Item *p_item, const Transform2D &p_view_xform, const Rect2 &p_view_rect, int &r_child_count) {
+	Item::ChildIndex *index = p_item->child_index;
+	if (!index) {
+		index = memnew(Item::ChildIndex);
+		p_item->child_index = index;
+		for (int i = 0; i < p_item->child_items.size(); i++) {
+			_index_add_child(index, p_item->child_items[i]);
+		}
+	}
+
+	if (index->order_dirty) {
+		for (int i = 0; i < p_item->child_items.size(); i++) {
+			p_item->child_items[i]->index_position = i;
+		}
+		index->order_dirty = false;
+	}
+
+	for (Item *child : index->dirty_items) {
+		child->index_dirty = false;
+
+		// Items drawing other items or with bounds that change without new commands can't be placed in the tree.
+		bool unbounded = child->child_items.size() || child->sort_y || child->canvas_group || child->copy_back_buffer || child->vp_render || child->skeleton.is_valid() || child->update_when_visible;
+		if (unbounded) {
+			if (child->index_id.is_valid()) {
+				index->bvh.remove(child->index_id);
+				child->index_id = DynamicBVH::ID();
+			}
+			if (!child->index_unbounded) {
+				index->unbounded_items.push_back(child);
+				child->index_unbounded = true;
+			}
+			continue;
+		}
+
+		if (child->index_unbounded) {
+			index->unbounded_items.remove_at_unordered(index->unbounded_items.find(child));
+			child->index_unbounded = false;
+		}
+
+		Rect2 rect = child->get_rect();
+		if (child->visibility_notifier && child->visibility_notifier->area.size != Vector2()) {
+			rect = rect.merge(child->visibility_notifier->area);
+		}
+		// Grown to cover the origin moving when snapping transforms to pixels.
+		rect = child->xform.xform(rect).grow(1.0);
+
+		AABB aabb(Vector3(rect.position.x, rect.position.y, 0), Vector3(rect.size.x, rect.size.y, 0));
+		if (child->index_id.is_valid()) {
+			index->bvh.update(child->index_id, aabb);
+		} else {
+			child->index_id = index->bvh.insert(aabb, child);
+		}
+	}
+	index->dirty_items.clear();
+
+	// View rectangle in the space of the children.
+	Rect2 view_rect = p_view_xform.affine_inverse().xform(Rect2(Point2(), p_view_rect.size));
+
+	struct CullResult {
+		LocalVector<Item *> *result = nullptr;
+		_FORCE_INLINE_ bool operator()(void *p_data) {
+			result->push_back((Item *)p_data);
+			return false;
+		}
+	};
+
+	index->cull_result = index->unbounded_items;
+	CullResult cull_result;
+	cull_result.result = &index->cull_result;
+	index->bvh.aabb_query(AABB(Vector3(view_rect.position.x, view_rect.position.y, 0), Vector3(view_rect.size.x, view_rect.size.y, 0)), cull_result);
+
+	SortArray<Item *, ItemIndexPositionSort> sorter;
+	sorter.sort(index->cull_result.ptr(), index->cull_result.size());
+
+	r_child_count = index->cull_result.size();
+	return index->cull_result.ptr();
+}
+
 void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2D &p_transform, const Rect2 &p_clip_rect, const Color &p_modulate, int p_z, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list, Item *p_canvas_clip, Item *p_material_owner, bool allow_y_sort, uint32_t canvas_cull_mask) {
 	Item *ci = p_canvas_item;
 
@@ -236,6 +358,9 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 	if (ci->children_order_dirty) {
 		ci->child_items.sort_custom<ItemIndexSort>();
 		ci->children_order_dirty = false;
+		if (ci->child_index) {
+			ci->child_index->order_dirty = true;
+		}
 	}
 
 	Rect2 rect = ci->get_rect();
@@ -337,6 +462,10 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 			canvas_group_from = r_z_last_list[zidx];
 		}
 
+		if (use_spatial_index && (ci->child_index || child_item_count >= SPATIAL_INDEX_MIN_CHILDREN) && xform.determinant() != 0) {
+			child_items = _cull_child_index(ci, xform, p_clip_rect, child_item_count);
+		}
+
 		for (int i = 0; i < child_item_count; i++) {
 			if (!child_items[i]->behind && !use_canvas_group) {
 				continue;
@@ -358,6 +487,7 @@ void RendererCanvasCull::render_canvas(RID p_render_target, Canvas *p_canvas, co
 
 	sdf_used = false;
 	snapping_2d_transforms_to_pixel = p_snap_2d_transforms_to_pixel;
+	use_spatial_index = GLOBAL_GET("rendering/2d/culling/use_spatial_index");
 
 	if (p_canvas->children_order_dirty) {
 		p_canvas->child_items.sort();
@@ -461,6 +591,8 @@ void RendererCanvasCull::canvas_item_set_parent(RID p_item, RID p_parent) {
 		} else if (canvas_item_owner.owns(canvas_item->parent)) {
 			Item *item_owner = canvas_item_owner.get_or_null(canvas_item->parent);
 			item_owner->child_items.erase(canvas_item);
+			_index_remove_child(canvas_item);
+			item_owner->index_bounds_changed();
 
 			if (item_owner->sort_y) {
 				_mark_ysort_dirty(item_owner, canvas_item_owner);
@@ -481,6 +613,10 @@ void RendererCanvasCull::canvas_item_set_parent(RID p_item, RID p_parent) {
 			Item *item_owner = canvas_item_owner.get_or_null(p_parent);
 			item_owner->child_items.push_back(canvas_item);
 			item_owner->children_order_dirty = true;
+			if (item_owner->child_index) {
+				_index_add_child(item_owner->child_index, canvas_item);
+			}
+			item_owner->index_bounds_changed();
 
 			if (item_owner->sort_y) {
 				_mark_ysort_dirty(item_owner, canvas_item_owner);
@@ -515,6 +651,7 @@ void RendererCanvasCull::canvas_item_set_transform(RID p_item, const Transform2D
 	ERR_FAIL_COND(!canvas_item);
 
 	canvas_item->xform = p_transform;
+	canvas_item->index_bounds_changed();
 }
 
 void RendererCanvasCull::canvas_item_set_visibility_layer(RID p_item, uint32_t p_visibility_layer) {
@@ -551,6 +688,7 @@ void RendererCanvasCull::canvas_item_set_custom_rect(RID p_item, bool p_custom_r
 
 	canvas_item->custom_rect = p_custom_rect;
 	canvas_item->rect = p_rect;
+	canvas_item->index_bounds_changed();
 }
 
 void RendererCanvasCull::canvas_item_set_modulate(RID p_item, const Color &p_color) {
@@ -579,6 +717,7 @@ void RendererCanvasCull::canvas_item_set_update_when_visible(RID p_item, bool p_
 	ERR_FAIL_COND(!canvas_item);
 
 	canvas_item->update_when_visible = p_update;
+	canvas_item->index_bounds_changed();
 }
 
 void RendererCanvasCull::canvas_item_add_line(RID p_item, const Point2 &p_from, const Point2 &p_to, const Color &p_color, float p_width, bool p_antialiased) {
@@ -1486,6 +1625,7 @@ void RendererCanvasCull::canvas_item_set_sort_children_by_y(RID p_item, bool p_e
 	ERR_FAIL_COND(!canvas_item);
 
 	canvas_item->sort_y = p_enable;
+	canvas_item->index_bounds_changed();
 
 	_mark_ysort_dirty(canvas_item, canvas_item_owner);
 }
@@ -1513,6 +1653,7 @@ void RendererCanvasCull::canvas_item_attach_skeleton(RID p_item, RID p_skeleton)
 		return;
 	}
 	canvas_item->skeleton = p_skeleton;
+	canvas_item->index_bounds_changed();
 
 	Item::Command *c = canvas_item->commands;
 
@@ -1550,6 +1691,7 @@ void RendererCanvasCull::canvas_item_set_copy_to_backbuffer(RID p_item, bool p_e
 		canvas_item->copy_back_buffer->rect = p_rect;
 		canvas_item->copy_back_buffer->full = p_rect == Rect2();
 	}
+	canvas_item->index_bounds_changed();
 }
 
 void RendererCanvasCull::canvas_item_clear(RID p_item) {
@@ -1610,6 +1752,7 @@ void RendererCanvasCull::canvas_item_set_visibility_notifier(RID p_item, bool p_
 			canvas_item->visibility_notifier = nullptr;
 		}
 	}
+	canvas_item->index_bounds_changed();
 }
 
 void RendererCanvasCull::canvas_item_set_canvas_group_mode(RID p_item, RS::CanvasGroupMode p_mode, float p_clear_margin, bool p_fit_empty, float p_fit_margin, bool p_blur_mipmaps) {
@@ -1631,6 +1774,7 @@ void RendererCanvasCull::canvas_item_set_canvas_group_mode(RID p_item, RS::Canva
 		canvas_item->canvas_group->blur_mipmaps = p_blur_mipmaps;
 		canvas_item->canvas_group->clear_margin = p_clear_margin;
 	}
+	canvas_item->index_bounds_changed();
 }
 
 RID RendererCanvasCull::canvas_light_allocate() {
@@ -2071,6 +2215,8 @@ bool RendererCanvasCull::free(RID p_rid) {
 			} else if (canvas_item_owner.owns(canvas_item->parent)) {
 				Item *item_owner = canvas_item_owner.get_or_null(canvas_item->parent);
 				item_owner->child_items.erase(canvas_item);
+				_index_remove_child(canvas_item);
+				item_owner->index_bounds_changed();
 
 				if (item_owner->sort_y) {
 					_mark_ysort_dirty(item_owner, canvas_item_owner);
@@ -2078,6 +2224,8 @@ bool RendererCanvasCull::free(RID p_rid) {
 			}
 		}
 
+		_free_child_index(canvas_item);
+
 		for (int i = 0; i < canvas_item->child_items.size(); i++) {
 			canvas_item->child_items[i]->parent = RID();
 		}
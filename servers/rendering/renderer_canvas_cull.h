@@ -31,6 +31,7 @@
 #ifndef RENDERER_CANVAS_CULL_H
 #define RENDERER_CANVAS_CULL_H
 
+#include "core/math/dynamic_bvh.h"
 #include "core/templates/paged_allocator.h"
 #include "renderer_compositor.h"
 #include "renderer_viewport.h"
@@ -72,6 +73,40 @@ public:
 
 		VisibilityNotifierData *visibility_notifier = nullptr;
 
+		// Spatial index of the children, so culling only visits the ones near the view.
+		struct ChildIndex {
+			DynamicBVH bvh;
+			LocalVector<Item *> dirty_items; // Bounds must be refreshed before the next query.
+			LocalVector<Item *> unbounded_items; // Bounds depend on more than their own commands, always culled.
+			LocalVector<Item *> cull_result;
+			bool order_dirty = true;
+		};
+
+		ChildIndex *child_index = nullptr;
+		ChildIndex *parent_index = nullptr; // Index of the parent this item is part of.
+		DynamicBVH::ID index_id;
+		uint32_t index_position = 0; // Position in the child list of the parent, to keep the draw order of query results.
+		bool index_unbounded = false;
+		bool index_dirty = false;
+
+		_FORCE_INLINE_ void index_bounds_changed() {
+			if (parent_index && !index_dirty) {
+				index_dirty = true;
+				parent_index->dirty_items.push_back(this);
+			}
+		}
+
+		template <class T>
+		T *alloc_command() {
+			index_bounds_changed();
+			return RendererCanvasRender::Item::alloc_command<T>();
+		}
+
+		void clear() {
+			index_bounds_changed();
+			RendererCanvasRender::Item::clear();
+		}
+
 		Item() {
 			children_order_dirty = true;
 			E = nullptr;
@@ -96,6 +131,12 @@ public:
 		}
 	};
 
+	struct ItemIndexPositionSort {
+		_FORCE_INLINE_ bool operator()(const Item *p_left, const Item *p_right) const {
+			return p_left->index_position < p_right->index_position;
+		}
+	};
+
 	struct ItemPtrSort {
 		_FORCE_INLINE_ bool operator()(const Item *p_left, const Item *p_right) const {
 			if (Math::is_equal_approx(p_left->ysort_pos.y, p_right->ysort_pos.y)) {
@@ -173,6 +214,10 @@ public:
 	bool disable_scale;
 	bool sdf_used = false;
 	bool snapping_2d_transforms_to_pixel = false;
+	bool use_spatial_index = false;
+
+	// Children below this count are cheaper to cull one by one.
+	static constexpr int SPATIAL_INDEX_MIN_CHILDREN = 64;
 
 	PagedAllocator<Item::VisibilityNotifierData> visibility_notifier_allocator;
 	SelfList<Item::VisibilityNotifierData>::List visibility_notifier_list;
@@ -183,6 +228,11 @@ private:
 	void _render_canvas_item_tree(RID p_to_render_target, Canvas::ChildItem *p_child_items, int p_child_item_count, Item *p_canvas_item, const Transform2D &p_transform, const Rect2 &p_clip_rect, const Color &p_modulate, RendererCanvasRender::Light *p_lights, RendererCanvasRender::Light *p_directional_lights, RS::CanvasItemTextureFilter p_default_filter, RS::CanvasItemTextureRepeat p_default_repeat, bool p_snap_2d_vertices_to_pixel, uint32_t canvas_cull_mask);
 	void _cull_canvas_item(Item *p_canvas_item, const Transform2D &p_transform, const Rect2 &p_clip_rect, const Color &p_modulate, int p_z, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list, Item *p_canvas_clip, Item *p_material_owner, bool allow_y_sort, uint32_t canvas_cull_mask);
 
+	void _index_add_child(Item::ChildIndex *p_index, Item *p_child);
+	void _index_remove_child(Item *p_child);
+	void _free_child_index(Item *p_item);
+	Item **_cull_child_index(Item *p_item, const Transform2D &p_view_xform, const Rect2 &p_view_rect, int &r_child_count);
+
 	static constexpr int z_range = RS::CANVAS_ITEM_Z_MAX - RS::CANVAS_ITEM_Z_MIN + 1;
 
 	RendererCanvasRender::Item **z_list;
@@ -39,6 +39,7 @@ RendererCompositor *RendererCompositor::singleton = nullptr;
 
 RendererCompositor *(*RendererCompositor::_create_func)() = nullptr;
 bool RendererCompositor::low_end = false;
+bool RendererCompositor::dummy = false;
 
 RendererCompositor *RendererCompositor::create() {
 	return _create_func();
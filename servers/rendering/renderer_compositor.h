@@ -76,6 +76,7 @@ protected:
 	static RendererCompositor *(*_create_func)();
 	bool back_end = false;
 	static bool low_end;
+	static bool dummy;
 
 public:
 	static RendererCompositor *create();
@@ -106,6 +107,7 @@ public:
 	virtual double get_total_time() const = 0;
 
 	static bool is_low_end() { return low_end; };
+	static bool is_dummy() { return dummy; }
 	virtual bool is_xr_enabled() const;
 
 	static RendererCompositor *get_singleton() { return singleton; }
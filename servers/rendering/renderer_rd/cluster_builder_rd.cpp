@@ -72,6 +72,14 @@ ClusterBuilderSharedDataRD::ClusterBuilderSharedDataRD() {
 		ms.sample_count = RD::TEXTURE_SAMPLES_4;
 		cluster_render.shader_pipelines[ClusterRender::PIPELINE_MSAA] = RD::get_singleton()->render_pipeline_create(cluster_render.shader, fb_format, vertex_format, RD::RENDER_PRIMITIVE_TRIANGLES, RD::PipelineRasterizationState(), ms, RD::PipelineDepthStencilState(), blend_state, 0);
 	}
+	{
+		Vector<String> versions;
+		versions.push_back("");
+		cluster_bin.cluster_bin_shader.initialize(versions);
+		cluster_bin.shader_version = cluster_bin.cluster_bin_shader.version_create();
+		cluster_bin.shader = cluster_bin.cluster_bin_shader.version_get_shader(cluster_bin.shader_version, 0);
+		cluster_bin.shader_pipeline = RD::get_singleton()->compute_pipeline_create(cluster_bin.shader);
+	}
 	{
 		Vector<String> versions;
 		versions.push_back("");
@@ -226,6 +234,7 @@ ClusterBuilderSharedDataRD::~ClusterBuilderSharedDataRD() {
 	RD::get_singleton()->free(box_index_buffer);
 
 	cluster_render.cluster_render_shader.version_free(cluster_render.shader_version);
+	cluster_bin.cluster_bin_shader.version_free(cluster_bin.shader_version);
 	cluster_store.cluster_store_shader.version_free(cluster_store.shader_version);
 	cluster_debug.cluster_debug_shader.version_free(cluster_debug.shader_version);
 }
@@ -254,6 +263,7 @@ void ClusterBuilderRD::_clear() {
 	framebuffer = RID();
 
 	cluster_render_uniform_set = RID();
+	cluster_bin_uniform_set = RID();
 	cluster_store_uniform_set = RID();
 }
 
@@ -323,6 +333,7 @@ void ClusterBuilderRD::setup(Size2i p_screen_size, uint32_t p_max_elements, RID
 		}
 
 		cluster_render_uniform_set = RD::get_singleton()->uniform_set_create(uniforms, shared->cluster_render.shader, 0);
+		cluster_bin_uniform_set = RD::get_singleton()->uniform_set_create(uniforms, shared->cluster_bin.shader, 0);
 	}
 
 	{
@@ -414,6 +425,10 @@ void ClusterBuilderRD::begin(const Transform3D &p_view_transform, const Projecti
 	}
 }
 
+void ClusterBuilderRD::set_use_compute_binning(bool p_enable) {
+	use_compute_binning = p_enable;
+}
+
 void ClusterBuilderRD::bake_cluster() {
 	RENDER_TIMESTAMP("> Bake 3D Cluster");
 
@@ -424,7 +439,7 @@ void ClusterBuilderRD::bake_cluster() {
 
 	if (render_element_count > 0) {
 		// Clear render buffer.
-		RD::get_singleton()->buffer_clear(cluster_render_buffer, 0, cluster_render_buffer_size, RD::BARRIER_MASK_RASTER);
+		RD::get_singleton()->buffer_clear(cluster_render_buffer, 0, cluster_render_buffer_size, use_compute_binning ? RD::BARRIER_MASK_COMPUTE : RD::BARRIER_MASK_RASTER);
 
 		{ // Fill state uniform.
 
@@ -446,10 +461,33 @@ void ClusterBuilderRD::bake_cluster() {
 
 		RD::get_singleton()->buffer_update(element_buffer, 0, sizeof(RenderElementData) * render_element_count, render_elements, RD::BARRIER_MASK_RASTER | RD::BARRIER_MASK_COMPUTE);
 
-		RENDER_TIMESTAMP("Render 3D Cluster Elements");
+		if (use_compute_binning) {
+			RENDER_TIMESTAMP("Bin 3D Cluster Elements");
 
-		// Render elements.
-		{
+			RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
+			RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, shared->cluster_bin.shader_pipeline);
+			RD::get_singleton()->compute_list_bind_uniform_set(compute_list, cluster_bin_uniform_set, 0);
+
+			ClusterBuilderSharedDataRD::ClusterBin::PushConstant push_constant;
+			push_constant.cluster_screen_size[0] = cluster_screen_size.x;
+			push_constant.cluster_screen_size[1] = cluster_screen_size.y;
+			push_constant.render_element_count = render_element_count;
+			push_constant.cluster_size = cluster_size;
+			push_constant.screen_size[0] = screen_size.x;
+			push_constant.screen_size[1] = screen_size.y;
+			push_constant.pad0 = 0;
+			push_constant.pad1 = 0;
+
+			RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(ClusterBuilderSharedDataRD::ClusterBin::PushConstant));
+
+			// One row of elements per cluster tile.
+			RD::get_singleton()->compute_list_dispatch_threads(compute_list, render_element_count, cluster_screen_size.x, cluster_screen_size.y);
+
+			RD::get_singleton()->compute_list_end(RD::BARRIER_MASK_COMPUTE);
+		} else {
+			RENDER_TIMESTAMP("Render 3D Cluster Elements");
+
+			// Render elements.
 			RD::DrawListID draw_list = RD::get_singleton()->draw_list_begin(framebuffer, RD::INITIAL_ACTION_DROP, RD::FINAL_ACTION_DISCARD, RD::INITIAL_ACTION_DROP, RD::FINAL_ACTION_DISCARD);
 			ClusterBuilderSharedDataRD::ClusterRender::PushConstant push_constant = {};
 
@@ -31,6 +31,7 @@
 #ifndef CLUSTER_BUILDER_RD_H
 #define CLUSTER_BUILDER_RD_H
 
+#include "servers/rendering/renderer_rd/shaders/cluster_bin.glsl.gen.h"
 #include "servers/rendering/renderer_rd/shaders/cluster_debug.glsl.gen.h"
 #include "servers/rendering/renderer_rd/shaders/cluster_render.glsl.gen.h"
 #include "servers/rendering/renderer_rd/shaders/cluster_store.glsl.gen.h"
@@ -83,6 +84,23 @@ class ClusterBuilderSharedDataRD {
 		RID shader_pipelines[PIPELINE_MAX];
 	} cluster_render;
 
+	struct ClusterBin {
+		struct PushConstant {
+			uint32_t cluster_screen_size[2];
+			uint32_t render_element_count;
+			uint32_t cluster_size;
+
+			float screen_size[2];
+			uint32_t pad0;
+			uint32_t pad1;
+		};
+
+		ClusterBinShaderRD cluster_bin_shader;
+		RID shader_version;
+		RID shader;
+		RID shader_pipeline;
+	} cluster_bin;
+
 	struct ClusterStore {
 		struct PushConstant {
 			uint32_t cluster_render_data_size; // how much data for a single cluster takes
@@ -186,6 +204,7 @@ private:
 
 	uint32_t cluster_size = 32;
 	bool use_msaa = true;
+	bool use_compute_binning = false; // Bin elements in compute instead of rasterizing their proxy meshes.
 	Divisor divisor = DIVISOR_4;
 
 	Size2i screen_size;
@@ -199,6 +218,7 @@ private:
 	uint32_t cluster_buffer_size = 0;
 
 	RID cluster_render_uniform_set;
+	RID cluster_bin_uniform_set;
 	RID cluster_store_uniform_set;
 
 	// Persistent data.
@@ -375,6 +395,8 @@ public:
 		render_element_count++;
 	}
 
+	void set_use_compute_binning(bool p_enable);
+
 	void bake_cluster();
 	void debug(ElementType p_element);
 
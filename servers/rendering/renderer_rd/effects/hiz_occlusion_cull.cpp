@@ -0,0 +1,209 @@
+/**************************************************************************/
+/*  hiz_occlusion_cull.cpp                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "hiz_occlusion_cull.h"
+#include "../storage_rd/material_storage.h"
+#include "../storage_rd/render_scene_buffers_rd.h"
+#include "../uniform_set_cache_rd.h"
+
+using namespace RendererRD;
+
+HiZOcclusionCull *HiZOcclusionCull::hiz_singleton = nullptr;
+
+void HiZOcclusionCull::HiZBuffer::free_depth_buffers() {
+	for (const RID &depth_buffer : depth_buffers) {
+		RD::get_singleton()->free(depth_buffer);
+	}
+	depth_buffers.clear();
+	current_depth_buffer = 0;
+}
+
+void HiZOcclusionCull::HiZBuffer::resize(const Size2i &p_size) {
+	if (get_size() == p_size) {
+		return; // Size didn't change
+	}
+
+	HZBuffer::resize(p_size);
+
+	free_depth_buffers();
+	has_depth = false;
+
+	if (is_empty()) {
+		return;
+	}
+
+	uint32_t buffer_count = RD::get_singleton()->get_frame_delay() + 1;
+	for (uint32_t i = 0; i < buffer_count; i++) {
+		depth_buffers.push_back(RD::get_singleton()->storage_buffer_create(p_size.x * p_size.y * sizeof(float)));
+	}
+}
+
+void HiZOcclusionCull::HiZBuffer::set_depth(const Vector<uint8_t> &p_data, const Transform3D &p_cam_transform, float p_z_far) {
+	Size2i size = get_size();
+	if (p_data.size() != int(size.x * size.y * sizeof(float))) {
+		return; // Captured before the last resize.
+	}
+
+	memcpy(mips[0], p_data.ptr(), p_data.size());
+	update_mips();
+
+	has_depth = true;
+	depth_cam_transform = p_cam_transform;
+	debug_tex_range = p_z_far;
+}
+
+void HiZOcclusionCull::_buffer_read_back(const Vector<uint8_t> &p_data, RID p_buffer, const Transform3D &p_cam_transform, float p_z_far) {
+	ERR_FAIL_NULL(hiz_singleton);
+
+	HiZBuffer *buffer = hiz_singleton->buffers.getptr(p_buffer);
+	if (!buffer) {
+		return; // Removed while the read back was in flight.
+	}
+
+	buffer->set_depth(p_data, p_cam_transform, p_z_far);
+}
+
+void HiZOcclusionCull::add_buffer(RID p_buffer) {
+	ERR_FAIL_COND(buffers.has(p_buffer));
+	buffers[p_buffer] = HiZBuffer();
+}
+
+void HiZOcclusionCull::remove_buffer(RID p_buffer) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	buffers[p_buffer].free_depth_buffers();
+	buffers.erase(p_buffer);
+}
+
+RendererSceneOcclusionCull::HZBuffer *HiZOcclusionCull::buffer_get_ptr(RID p_buffer) {
+	HiZBuffer *buffer = buffers.getptr(p_buffer);
+	if (!buffer || !buffer->has_depth) {
+		return nullptr;
+	}
+
+	const Transform3D &from = buffer->depth_cam_transform;
+	const Transform3D &to = buffer->cam_transform;
+	if (from.origin.distance_squared_to(to.origin) > MAX_CAMERA_MOVEMENT * MAX_CAMERA_MOVEMENT || from.basis.get_column(2).normalized().dot(to.basis.get_column(2).normalized()) < MIN_CAMERA_ALIGNMENT) {
+		return nullptr;
+	}
+
+	return buffer;
+}
+
+void HiZOcclusionCull::buffer_set_size(RID p_buffer, const Vector2i &p_size) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	buffers[p_buffer].resize(p_size);
+}
+
+void HiZOcclusionCull::buffer_update(RID p_buffer, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) {
+	HiZBuffer *buffer = buffers.getptr(p_buffer);
+	if (!buffer) {
+		return;
+	}
+
+	// Nothing to render here, the depth comes from previous frames. Only remember where the camera is.
+	buffer->cam_transform = p_cam_transform;
+}
+
+void HiZOcclusionCull::buffer_capture(RID p_buffer, const Ref<RenderSceneBuffers> &p_render_buffers, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) {
+	HiZBuffer *buffer = buffers.getptr(p_buffer);
+	if (!buffer || buffer->depth_buffers.is_empty()) {
+		return;
+	}
+
+	Ref<RenderSceneBuffersRD> rb = p_render_buffers;
+	if (rb.is_null() || rb->get_view_count() != 1 || !rb->has_depth_texture()) {
+		return;
+	}
+
+	UniformSetCacheRD *uniform_set_cache = UniformSetCacheRD::get_singleton();
+	ERR_FAIL_NULL(uniform_set_cache);
+	MaterialStorage *material_storage = MaterialStorage::get_singleton();
+	ERR_FAIL_NULL(material_storage);
+
+	RID depth_buffer = buffer->depth_buffers[buffer->current_depth_buffer];
+	buffer->current_depth_buffer = (buffer->current_depth_buffer + 1) % buffer->depth_buffers.size();
+
+	Size2i source_size = rb->get_internal_size();
+	Size2i dest_size = buffer->get_size();
+
+	HiZReducePushConstant push_constant;
+	memset(&push_constant, 0, sizeof(HiZReducePushConstant));
+	push_constant.source_size[0] = source_size.x;
+	push_constant.source_size[1] = source_size.y;
+	push_constant.dest_size[0] = dest_size.x;
+	push_constant.dest_size[1] = dest_size.y;
+	push_constant.z_near = p_cam_projection.get_z_near();
+	push_constant.z_far = p_cam_projection.get_z_far();
+	push_constant.orthogonal = p_cam_orthogonal;
+
+	RID default_sampler = material_storage->sampler_rd_get_default(RS::CANVAS_ITEM_TEXTURE_FILTER_NEAREST, RS::CANVAS_ITEM_TEXTURE_REPEAT_DISABLED);
+
+	RD::Uniform u_source_depth(RD::UNIFORM_TYPE_SAMPLER_WITH_TEXTURE, 0, Vector<RID>({ default_sampler, rb->get_depth_texture() }));
+	RD::Uniform u_dest_depth(RD::UNIFORM_TYPE_STORAGE_BUFFER, 1, depth_buffer);
+
+	RID shader = hiz_reduce.shader.version_get_shader(hiz_reduce.shader_version, 0);
+	ERR_FAIL_COND(shader.is_null());
+
+	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
+	RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, hiz_reduce.pipeline);
+	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, uniform_set_cache->get_cache(shader, 0, u_source_depth, u_dest_depth), 0);
+	RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(HiZReducePushConstant));
+	RD::get_singleton()->compute_list_dispatch_threads(compute_list, dest_size.x, dest_size.y, 1);
+	RD::get_singleton()->compute_list_end(RD::BARRIER_MASK_TRANSFER);
+
+	RD::get_singleton()->buffer_get_data_async(depth_buffer, callable_mp_static(&HiZOcclusionCull::_buffer_read_back).bind(p_buffer, p_cam_transform, push_constant.z_far));
+}
+
+RID HiZOcclusionCull::buffer_get_debug_texture(RID p_buffer) {
+	ERR_FAIL_COND_V(!buffers.has(p_buffer), RID());
+	return buffers[p_buffer].get_debug_texture();
+}
+
+HiZOcclusionCull::HiZOcclusionCull() {
+	hiz_singleton = this;
+
+	Vector<String> hiz_reduce_modes;
+	hiz_reduce_modes.push_back("\n");
+
+	hiz_reduce.shader.initialize(hiz_reduce_modes);
+	hiz_reduce.shader_version = hiz_reduce.shader.version_create();
+	hiz_reduce.pipeline = RD::get_singleton()->compute_pipeline_create(hiz_reduce.shader.version_get_shader(hiz_reduce.shader_version, 0));
+}
+
+HiZOcclusionCull::~HiZOcclusionCull() {
+	for (KeyValue<RID, HiZBuffer> &E : buffers) {
+		E.value.free_depth_buffers();
+	}
+	buffers.clear();
+
+	hiz_reduce.shader.version_free(hiz_reduce.shader_version);
+
+	hiz_singleton = nullptr;
+}
@@ -0,0 +1,114 @@
+/**************************************************************************/
+/*  hiz_occlusion_cull.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef HIZ_OCCLUSION_CULL_RD_H
+#define HIZ_OCCLUSION_CULL_RD_H
+
+#include "core/templates/hash_map.h"
+#include "servers/rendering/renderer_rd/shaders/effects/hiz_reduce.glsl.gen.h"
+#include "servers/rendering/renderer_scene_occlusion_cull.h"
+#include "servers/rendering/rendering_device.h"
+
+namespace RendererRD {
+
+// Occlusion culling against the depth buffer of previous frames. The depth is
+// reduced on the GPU to the size of the occlusion buffer and read back
+// asynchronously, so it needs no baked occluders.
+class HiZOcclusionCull : public RendererSceneOcclusionCull {
+private:
+	static HiZOcclusionCull *hiz_singleton;
+
+	// The occlusion buffer is a few frames old by the time it's used, so it's
+	// ignored when the camera moved too far from where it was captured.
+	static constexpr float MAX_CAMERA_MOVEMENT = 0.5;
+	static constexpr float MIN_CAMERA_ALIGNMENT = 0.995;
+
+	struct HiZReducePushConstant {
+		int32_t source_size[2];
+		int32_t dest_size[2];
+
+		float z_near;
+		float z_far;
+		uint32_t orthogonal;
+		uint32_t pad;
+	};
+
+	struct HiZReduce {
+		HizReduceShaderRD shader;
+		RID shader_version;
+		RID pipeline;
+	} hiz_reduce;
+
+	class HiZBuffer : public HZBuffer {
+	public:
+		// One per frame in flight, so a reduction never overwrites a buffer still being read back.
+		LocalVector<RID> depth_buffers;
+		uint32_t current_depth_buffer = 0;
+
+		bool has_depth = false;
+		Transform3D depth_cam_transform;
+		Transform3D cam_transform;
+
+		Size2i get_size() const { return is_empty() ? Size2i() : sizes[0]; }
+
+		void free_depth_buffers();
+		virtual void resize(const Size2i &p_size) override;
+		void set_depth(const Vector<uint8_t> &p_data, const Transform3D &p_cam_transform, float p_z_far);
+	};
+
+	HashMap<RID, HiZBuffer> buffers;
+
+	static void _buffer_read_back(const Vector<uint8_t> &p_data, RID p_buffer, const Transform3D &p_cam_transform, float p_z_far);
+
+public:
+	virtual void free_occluder(RID p_occluder) override {}
+	virtual void occluder_set_mesh(RID p_occluder, const PackedVector3Array &p_vertices, const PackedInt32Array &p_indices) override {}
+
+	virtual void scenario_set_instance(RID p_scenario, RID p_instance, RID p_occluder, const Transform3D &p_xform, bool p_enabled) override {}
+	virtual void scenario_remove_instance(RID p_scenario, RID p_instance) override {}
+
+	virtual void add_buffer(RID p_buffer) override;
+	virtual void remove_buffer(RID p_buffer) override;
+	virtual HZBuffer *buffer_get_ptr(RID p_buffer) override;
+	virtual void buffer_set_scenario(RID p_buffer, RID p_scenario) override {}
+	virtual void buffer_set_size(RID p_buffer, const Vector2i &p_size) override;
+	virtual void buffer_update(RID p_buffer, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) override;
+	virtual void buffer_capture(RID p_buffer, const Ref<RenderSceneBuffers> &p_render_buffers, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) override;
+	virtual RID buffer_get_debug_texture(RID p_buffer) override;
+
+	virtual bool uses_depth_buffer() const override { return true; }
+
+	HiZOcclusionCull();
+	~HiZOcclusionCull();
+};
+
+} // namespace RendererRD
+
+#endif // HIZ_OCCLUSION_CULL_RD_H
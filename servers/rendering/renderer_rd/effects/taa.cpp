@@ -31,6 +31,7 @@
 #include "taa.h"
 #include "servers/rendering/renderer_rd/effects/copy_effects.h"
 #include "servers/rendering/renderer_rd/storage_rd/material_storage.h"
+#include "servers/rendering/renderer_rd/storage_rd/texture_storage.h"
 #include "servers/rendering/renderer_rd/uniform_set_cache_rd.h"
 
 using namespace RendererRD;
@@ -41,10 +42,17 @@ TAA::TAA() {
 	taa_shader.initialize(taa_modes);
 	shader_version = taa_shader.version_create();
 	pipeline = RD::get_singleton()->compute_pipeline_create(taa_shader.version_get_shader(shader_version, 0));
+
+	Vector<String> upscale_modes;
+	upscale_modes.push_back("");
+	upscale_shader.initialize(upscale_modes);
+	upscale_shader_version = upscale_shader.version_create();
+	upscale_pipeline = RD::get_singleton()->compute_pipeline_create(upscale_shader.version_get_shader(upscale_shader_version, 0));
 }
 
 TAA::~TAA() {
 	taa_shader.version_free(shader_version);
+	upscale_shader.version_free(upscale_shader_version);
 }
 
 void TAA::msaa_resolve(Ref<RenderSceneBuffersRD> p_render_buffers) {
@@ -136,3 +144,75 @@ void TAA::process(Ref<RenderSceneBuffersRD> p_render_buffers, RD::DataFormat p_f
 
 	RD::get_singleton()->draw_command_end_label();
 }
+
+void TAA::upscale(Ref<RenderSceneBuffersRD> p_render_buffers, const StringName &p_source_context, const StringName &p_source_name, const Vector2 &p_jitter) {
+	UniformSetCacheRD *uniform_set_cache = UniformSetCacheRD::get_singleton();
+	ERR_FAIL_NULL(uniform_set_cache);
+	MaterialStorage *material_storage = MaterialStorage::get_singleton();
+	ERR_FAIL_NULL(material_storage);
+	TextureStorage *texture_storage = TextureStorage::get_singleton();
+	ERR_FAIL_NULL(texture_storage);
+	CopyEffects *copy_effects = CopyEffects::get_singleton();
+
+	RID shader = upscale_shader.version_get_shader(upscale_shader_version, 0);
+	ERR_FAIL_COND(shader.is_null());
+
+	uint32_t view_count = p_render_buffers->get_view_count();
+	Size2i internal_size = p_render_buffers->get_internal_size();
+	Size2i target_size = p_render_buffers->get_target_size();
+	RID render_target = p_render_buffers->get_render_target();
+
+	// The history is kept at the target size, it is cleared whenever the buffers are reconfigured.
+	bool reset = false;
+	if (!p_render_buffers->has_texture(SNAME("taa_upscale"), SNAME("history"))) {
+		uint32_t usage_bits = RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_STORAGE_BIT;
+
+		p_render_buffers->create_texture(SNAME("taa_upscale"), SNAME("history"), RD::DATA_FORMAT_R16G16B16A16_SFLOAT, usage_bits, RD::TEXTURE_SAMPLES_1, target_size);
+		p_render_buffers->create_texture(SNAME("taa_upscale"), SNAME("temp"), RD::DATA_FORMAT_R16G16B16A16_SFLOAT, usage_bits, RD::TEXTURE_SAMPLES_1, target_size);
+
+		reset = true;
+	}
+
+	RID default_sampler = material_storage->sampler_rd_get_default(RS::CANVAS_ITEM_TEXTURE_FILTER_LINEAR, RS::CANVAS_ITEM_TEXTURE_REPEAT_DISABLED);
+
+	TAAUpscalePushConstant push_constant;
+	memset(&push_constant, 0, sizeof(TAAUpscalePushConstant));
+	push_constant.resolution_width = internal_size.width;
+	push_constant.resolution_height = internal_size.height;
+	push_constant.upscaled_width = target_size.width;
+	push_constant.upscaled_height = target_size.height;
+	// The jitter is a clip space offset, convert it to internal pixels.
+	push_constant.jitter[0] = p_jitter.x * 0.5 * internal_size.width;
+	push_constant.jitter[1] = p_jitter.y * 0.5 * internal_size.height;
+	push_constant.reset = reset;
+
+	RD::get_singleton()->draw_command_begin_label("TAA Upscale");
+
+	for (uint32_t v = 0; v < view_count; v++) {
+		RID source_texture = p_render_buffers->get_texture_slice(p_source_context, p_source_name, v, 0);
+		RID depth_texture = p_render_buffers->get_depth_texture(v);
+		RID velocity_buffer = p_render_buffers->get_velocity_buffer(false, v);
+		RID history = p_render_buffers->get_texture_slice(SNAME("taa_upscale"), SNAME("history"), v, 0);
+		RID temp = p_render_buffers->get_texture_slice(SNAME("taa_upscale"), SNAME("temp"), v, 0);
+		RID dest_texture = texture_storage->render_target_get_rd_texture_slice(render_target, v);
+
+		RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
+		RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, upscale_pipeline);
+
+		RD::Uniform u_color(RD::UNIFORM_TYPE_SAMPLER_WITH_TEXTURE, 0, { default_sampler, source_texture });
+		RD::Uniform u_depth(RD::UNIFORM_TYPE_SAMPLER_WITH_TEXTURE, 1, { default_sampler, depth_texture });
+		RD::Uniform u_velocity(RD::UNIFORM_TYPE_IMAGE, 2, { velocity_buffer });
+		RD::Uniform u_history(RD::UNIFORM_TYPE_SAMPLER_WITH_TEXTURE, 3, { default_sampler, history });
+		RD::Uniform u_dest(RD::UNIFORM_TYPE_IMAGE, 4, { dest_texture });
+		RD::Uniform u_history_dest(RD::UNIFORM_TYPE_IMAGE, 5, { temp });
+
+		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, uniform_set_cache->get_cache(shader, 0, u_color, u_depth, u_velocity, u_history, u_dest, u_history_dest), 0);
+		RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(TAAUpscalePushConstant));
+		RD::get_singleton()->compute_list_dispatch_threads(compute_list, target_size.width, target_size.height, 1);
+		RD::get_singleton()->compute_list_end();
+
+		copy_effects->copy_to_rect(temp, history, Rect2(0, 0, target_size.x, target_size.y));
+	}
+
+	RD::get_singleton()->draw_command_end_label();
+}
@@ -33,6 +33,7 @@
 
 #include "servers/rendering/renderer_rd/pipeline_cache_rd.h"
 #include "servers/rendering/renderer_rd/shaders/effects/taa_resolve.glsl.gen.h"
+#include "servers/rendering/renderer_rd/shaders/effects/taa_upscale.glsl.gen.h"
 #include "servers/rendering/renderer_rd/storage_rd/render_scene_buffers_rd.h"
 #include "servers/rendering/renderer_scene_render.h"
 
@@ -47,6 +48,7 @@ public:
 
 	void msaa_resolve(Ref<RenderSceneBuffersRD> p_render_buffers);
 	void process(Ref<RenderSceneBuffersRD> p_render_buffers, RD::DataFormat p_format, float p_z_near, float p_z_far);
+	void upscale(Ref<RenderSceneBuffersRD> p_render_buffers, const StringName &p_source_context, const StringName &p_source_name, const Vector2 &p_jitter);
 
 private:
 	struct TAAResolvePushConstant {
@@ -56,10 +58,24 @@ private:
 		float disocclusion_scale;
 	};
 
+	struct TAAUpscalePushConstant {
+		float resolution_width;
+		float resolution_height;
+		float upscaled_width;
+		float upscaled_height;
+		float jitter[2];
+		uint32_t reset;
+		uint32_t pad;
+	};
+
 	TaaResolveShaderRD taa_shader;
 	RID shader_version;
 	RID pipeline;
 
+	TaaUpscaleShaderRD upscale_shader;
+	RID upscale_shader_version;
+	RID upscale_pipeline;
+
 	void resolve(RID p_frame, RID p_temp, RID p_depth, RID p_velocity, RID p_prev_velocity, RID p_history, Size2 p_resolution, float p_z_near, float p_z_far);
 };
 
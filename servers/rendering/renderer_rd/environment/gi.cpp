@@ -1182,6 +1182,11 @@ void GI::SDFGI::update(RID p_env, const Vector3 &p_world_position) {
 
 	int32_t drag_margin = (cascade_size / SDFGI::PROBE_DIVISOR) / 2;
 
+	Vector3i prev_positions[SDFGI::MAX_CASCADES];
+	for (uint32_t i = 0; i < cascades.size(); i++) {
+		prev_positions[i] = cascades[i].position;
+	}
+
 	for (SDFGI::Cascade &cascade : cascades) {
 		cascade.dirty_regions = Vector3i();
 
@@ -1228,6 +1233,52 @@ void GI::SDFGI::update(RID p_env, const Vector3 &p_world_position) {
 			}
 		}
 	}
+
+	uint32_t dirty_cascades[SDFGI::MAX_CASCADES];
+	uint32_t dirty_cascade_count = 0;
+	for (uint32_t i = 0; i < cascades.size(); i++) {
+		if (cascades[i].dirty_regions == Vector3i()) {
+			cascades[i].update_pending_frames = 0;
+		} else {
+			dirty_cascades[dirty_cascade_count++] = i;
+		}
+	}
+
+	if (gi->sdfgi_max_cascade_updates == 0 || dirty_cascade_count <= gi->sdfgi_max_cascade_updates) {
+		for (uint32_t i = 0; i < dirty_cascade_count; i++) {
+			cascades[dirty_cascades[i]].update_pending_frames = 0;
+		}
+		gi->sdfgi_cascade_updates += dirty_cascade_count;
+		return;
+	}
+
+	// Scrolling a cascade re-voxelizes its dirty regions and scrolls its probes, which spikes when several
+	// cascades scroll at once. Only scroll as many as the budget allows, nearest first, and keep the others
+	// where they were until a later frame. Each frame waiting moves a cascade ahead of the next nearer one,
+	// so far cascades still get updated while the camera keeps moving.
+	for (uint32_t i = 1; i < dirty_cascade_count; i++) {
+		uint32_t cascade = dirty_cascades[i];
+		int32_t priority = int32_t(cascade) - int32_t(cascades[cascade].update_pending_frames);
+		uint32_t j = i;
+		while (j > 0 && int32_t(dirty_cascades[j - 1]) - int32_t(cascades[dirty_cascades[j - 1]].update_pending_frames) > priority) {
+			dirty_cascades[j] = dirty_cascades[j - 1];
+			j--;
+		}
+		dirty_cascades[j] = cascade;
+	}
+
+	for (uint32_t i = 0; i < dirty_cascade_count; i++) {
+		SDFGI::Cascade &cascade = cascades[dirty_cascades[i]];
+		if (i < gi->sdfgi_max_cascade_updates) {
+			cascade.update_pending_frames = 0;
+			gi->sdfgi_cascade_updates++;
+		} else {
+			cascade.position = prev_positions[dirty_cascades[i]];
+			cascade.dirty_regions = Vector3i();
+			cascade.update_pending_frames++;
+			gi->sdfgi_deferred_cascade_updates++;
+		}
+	}
 }
 
 void GI::SDFGI::update_light() {
@@ -3331,6 +3382,7 @@ GI::GI() {
 	sdfgi_ray_count = RS::EnvironmentSDFGIRayCount(CLAMP(int32_t(GLOBAL_GET("rendering/global_illumination/sdfgi/probe_ray_count")), 0, int32_t(RS::ENV_SDFGI_RAY_COUNT_MAX - 1)));
 	sdfgi_frames_to_converge = RS::EnvironmentSDFGIFramesToConverge(CLAMP(int32_t(GLOBAL_GET("rendering/global_illumination/sdfgi/frames_to_converge")), 0, int32_t(RS::ENV_SDFGI_CONVERGE_MAX - 1)));
 	sdfgi_frames_to_update_light = RS::EnvironmentSDFGIFramesToUpdateLight(CLAMP(int32_t(GLOBAL_GET("rendering/global_illumination/sdfgi/frames_to_update_lights")), 0, int32_t(RS::ENV_SDFGI_UPDATE_LIGHT_MAX - 1)));
+	sdfgi_max_cascade_updates = MAX(0, int32_t(GLOBAL_GET("rendering/global_illumination/sdfgi/max_cascade_updates_per_frame")));
 }
 
 GI::~GI() {
@@ -595,6 +595,7 @@ public:
 
 			static const Vector3i DIRTY_ALL;
 			Vector3i dirty_regions; //(0,0,0 is not dirty, negative is refresh from the end, DIRTY_ALL is refresh all.
+			uint32_t update_pending_frames = 0; // Frames this cascade has been waiting to scroll, when over the update budget.
 
 			RID sdf_store_uniform_set;
 			RID sdf_direct_light_static_uniform_set;
@@ -695,6 +696,11 @@ public:
 	RS::EnvironmentSDFGIRayCount sdfgi_ray_count = RS::ENV_SDFGI_RAY_COUNT_16;
 	RS::EnvironmentSDFGIFramesToConverge sdfgi_frames_to_converge = RS::ENV_SDFGI_CONVERGE_IN_30_FRAMES;
 	RS::EnvironmentSDFGIFramesToUpdateLight sdfgi_frames_to_update_light = RS::ENV_SDFGI_UPDATE_LIGHT_IN_4_FRAMES;
+	uint32_t sdfgi_max_cascade_updates = 0; // Zero means no limit.
+
+	// Accumulated over a frame for all viewports, reset by Utilities when caching the frame stats.
+	uint32_t sdfgi_cascade_updates = 0;
+	uint32_t sdfgi_deferred_cascade_updates = 0;
 
 	float sdfgi_solid_cell_ratio = 0.25;
 	Vector3 sdfgi_debug_probe_pos;
@@ -330,6 +330,13 @@ void RenderForwardClustered::_render_list_template(RenderingDevice::DrawListID p
 			continue;
 		}
 
+		if (unlikely(shader->compiling)) {
+			// Not compiled yet, don't wait for it.
+			should_request_redraw = true;
+			i += element_info.repeat - 1; //skip equal elements
+			continue;
+		}
+
 		//request a redraw if one of the shaders uses TIME
 		if (shader->uses_time) {
 			should_request_redraw = true;
@@ -351,6 +358,15 @@ void RenderForwardClustered::_render_list_template(RenderingDevice::DrawListID p
 		RS::PrimitiveType primitive = surf->primitive;
 		RID xforms_uniform_set = surf->owner->transforms_uniform_set;
 
+		// Passes drawing a different surface (such as the shadow mesh) can't use the culled command.
+		uint32_t gpu_cull_command = GPU_CULL_COMMAND_NONE;
+		if (p_params->gpu_cull_commands && mesh_surface == surf->surface) {
+			gpu_cull_command = p_params->gpu_cull_commands[i];
+			if (gpu_cull_command != GPU_CULL_COMMAND_NONE) {
+				xforms_uniform_set = surf->owner->gpu_cull_transforms_uniform_set;
+			}
+		}
+
 		SceneShaderForwardClustered::PipelineVersion pipeline_version = SceneShaderForwardClustered::PIPELINE_VERSION_MAX; // Assigned to silence wrong -Wmaybe-initialized.
 		uint32_t pipeline_color_pass_flags = 0;
 		uint32_t pipeline_specialization = 0;
@@ -457,6 +473,18 @@ void RenderForwardClustered::_render_list_template(RenderingDevice::DrawListID p
 
 		RID pipeline_rd = pipeline->get_render_pipeline(vertex_format, framebuffer_format, p_params->force_wireframe, 0, pipeline_specialization);
 
+		if (unlikely(pipeline_rd.is_null())) {
+			// Still being compiled asynchronously, keep redrawing until it's ready.
+			should_request_redraw = true;
+			if (pipeline_specialization != 0 && scene_shader.pipeline_compilation_mode == SceneShaderForwardClustered::PIPELINE_COMPILATION_MODE_ASYNC_UNSPECIALIZED_FALLBACK) {
+				pipeline_rd = pipeline->get_render_pipeline(vertex_format, framebuffer_format, p_params->force_wireframe, 0, 0);
+			}
+			if (pipeline_rd.is_null()) {
+				i += element_info.repeat - 1; //skip equal elements
+				continue;
+			}
+		}
+
 		if (pipeline_rd != prev_pipeline_rd) {
 			// checking with prev shader does not make so much sense, as
 			// the pipeline may still be different.
@@ -478,7 +506,10 @@ void RenderForwardClustered::_render_list_template(RenderingDevice::DrawListID p
 			prev_material_uniform_set = material_uniform_set;
 		}
 
-		if (surf->owner->base_flags & INSTANCE_DATA_FLAG_PARTICLES) {
+		if (gpu_cull_command != GPU_CULL_COMMAND_NONE) {
+			push_constant.multimesh_motion_vectors_current_offset = 0;
+			push_constant.multimesh_motion_vectors_previous_offset = surf->owner->gpu_cull_previous_offset;
+		} else if (surf->owner->base_flags & INSTANCE_DATA_FLAG_PARTICLES) {
 			particles_storage->particles_get_instance_buffer_motion_vectors_offsets(surf->owner->data->base, push_constant.multimesh_motion_vectors_current_offset, push_constant.multimesh_motion_vectors_previous_offset);
 		} else if (surf->owner->base_flags & INSTANCE_DATA_FLAG_MULTIMESH) {
 			mesh_storage->_multimesh_get_motion_vectors_offsets(surf->owner->data->base, push_constant.multimesh_motion_vectors_current_offset, push_constant.multimesh_motion_vectors_previous_offset);
@@ -489,12 +520,17 @@ void RenderForwardClustered::_render_list_template(RenderingDevice::DrawListID p
 
 		RD::get_singleton()->draw_list_set_push_constant(draw_list, &push_constant, sizeof(SceneState::PushConstant));
 
-		uint32_t instance_count = surf->owner->instance_count > 1 ? surf->owner->instance_count : element_info.repeat;
-		if (surf->flags & GeometryInstanceSurfaceDataCache::FLAG_USES_PARTICLE_TRAILS) {
-			instance_count /= surf->owner->trail_steps;
-		}
+		if (gpu_cull_command != GPU_CULL_COMMAND_NONE) {
+			// Instance count was written by the culling pass.
+			RD::get_singleton()->draw_list_draw_indirect(draw_list, index_array_rd.is_valid(), p_params->gpu_cull_command_buffer, gpu_cull_command * GPU_CULL_COMMAND_SIZE * sizeof(uint32_t));
+		} else {
+			uint32_t instance_count = surf->owner->instance_count > 1 ? surf->owner->instance_count : element_info.repeat;
+			if (surf->flags & GeometryInstanceSurfaceDataCache::FLAG_USES_PARTICLE_TRAILS) {
+				instance_count /= surf->owner->trail_steps;
+			}
 
-		RD::get_singleton()->draw_list_draw(draw_list, index_array_rd.is_valid(), instance_count);
+			RD::get_singleton()->draw_list_draw(draw_list, index_array_rd.is_valid(), instance_count);
+		}
 		i += element_info.repeat - 1; //skip equal elements
 	}
 
@@ -557,9 +593,13 @@ void RenderForwardClustered::_render_list(RenderingDevice::DrawListID p_draw_lis
 
 void RenderForwardClustered::_render_list_thread_function(uint32_t p_thread, RenderListParameters *p_params) {
 	uint32_t render_total = p_params->element_count;
-	uint32_t total_threads = WorkerThreadPool::get_singleton()->get_thread_count();
+	uint32_t total_threads = thread_draw_lists.size();
 	uint32_t render_from = p_thread * render_total / total_threads;
 	uint32_t render_to = (p_thread + 1 == total_threads) ? render_total : ((p_thread + 1) * render_total / total_threads);
+	// Repeated elements are drawn with instancing by the first one, which may belong to the previous split.
+	while (render_from > 0 && render_from < render_to && p_params->element_info[render_from - 1].repeat > 1) {
+		render_from++;
+	}
 	_render_list(thread_draw_lists[p_thread], p_params->framebuffer_format, p_params, render_from, render_to);
 }
 
@@ -567,9 +607,10 @@ void RenderForwardClustered::_render_list_with_threads(RenderListParameters *p_p
 	RD::FramebufferFormatID fb_format = RD::get_singleton()->framebuffer_get_format(p_framebuffer);
 	p_params->framebuffer_format = fb_format;
 
-	if ((uint32_t)p_params->element_count > render_list_thread_threshold && false) { // secondary command buffers need more testing at this time
-		//multi threaded
-		thread_draw_lists.resize(WorkerThreadPool::get_singleton()->get_thread_count());
+	if ((uint32_t)p_params->element_count > render_list_thread_threshold) {
+		//multi threaded, each split is recorded into its own secondary command buffer
+		uint32_t split_count = MIN((uint32_t)WorkerThreadPool::get_singleton()->get_thread_count(), MAX(1u, (uint32_t)p_params->element_count / RENDER_LIST_SPLIT_MIN_ELEMENTS));
+		thread_draw_lists.resize(split_count);
 		RD::get_singleton()->draw_list_begin_split(p_framebuffer, thread_draw_lists.size(), thread_draw_lists.ptr(), p_initial_color_action, p_final_color_action, p_initial_depth_action, p_final_depth_action, p_clear_color_values, p_clear_depth, p_clear_stencil, p_region, p_storage_textures);
 		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RenderForwardClustered::_render_list_thread_function, p_params, thread_draw_lists.size(), -1, true, SNAME("ForwardClusteredRenderList"));
 		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
@@ -770,6 +811,296 @@ void RenderForwardClustered::_fill_instance_data(RenderListType p_render_list, i
 	}
 }
 
+bool RenderForwardClustered::_geometry_instance_can_gpu_cull(GeometryInstanceForwardClustered *p_instance) const {
+	if (p_instance->instance_count < gpu_cull.minimum_instances) {
+		return false;
+	}
+
+	if (p_instance->data->base_type == RS::INSTANCE_MULTIMESH) {
+		return !(p_instance->base_flags & INSTANCE_DATA_FLAG_MULTIMESH_FORMAT_2D);
+	}
+
+	if (p_instance->data->base_type == RS::INSTANCE_PARTICLES) {
+		// Trails draw several instances per particle.
+		if (p_instance->trail_steps > 1) {
+			return false;
+		}
+		// Compacting visible particles doesn't keep their draw order, which only matters when blending.
+		for (const GeometryInstanceSurfaceDataCache *surf = p_instance->surface_caches; surf; surf = surf->next) {
+			if (surf->flags & GeometryInstanceSurfaceDataCache::FLAG_PASS_ALPHA) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	return false;
+}
+
+void RenderForwardClustered::_geometry_instance_get_gpu_cull_source(GeometryInstanceForwardClustered *p_instance, RID &r_buffer, uint32_t &r_stride, bool &r_motion_vectors) const {
+	if (p_instance->data->base_type == RS::INSTANCE_PARTICLES) {
+		RendererRD::ParticlesStorage *particles_storage = RendererRD::ParticlesStorage::get_singleton();
+		r_buffer = particles_storage->particles_get_instance_buffer(p_instance->data->base);
+		r_stride = (3 + 1 + 1) * 4; // Transform, color and custom data.
+		r_motion_vectors = particles_storage->particles_uses_motion_vectors(p_instance->data->base);
+	} else {
+		RendererRD::MeshStorage *mesh_storage = RendererRD::MeshStorage::get_singleton();
+		r_buffer = mesh_storage->multimesh_get_storage_buffer(p_instance->data->base);
+		r_stride = mesh_storage->multimesh_get_stride(p_instance->data->base);
+		r_motion_vectors = mesh_storage->multimesh_uses_motion_vectors(p_instance->data->base);
+	}
+}
+
+bool RenderForwardClustered::_geometry_instance_setup_gpu_cull(GeometryInstanceForwardClustered *p_instance) {
+	RID source_buffer;
+	uint32_t stride = 0;
+	bool motion_vectors = false;
+	_geometry_instance_get_gpu_cull_source(p_instance, source_buffer, stride, motion_vectors);
+	if (source_buffer.is_null()) {
+		return false;
+	}
+
+	// Reallocating the multimesh buffer frees the uniform sets that point to it.
+	if (p_instance->gpu_cull_buffer.is_valid() && RD::get_singleton()->uniform_set_is_valid(p_instance->gpu_cull_uniform_set) && RD::get_singleton()->uniform_set_is_valid(p_instance->gpu_cull_transforms_uniform_set)) {
+		return true;
+	}
+
+	_geometry_instance_free_gpu_cull(p_instance);
+
+	uint32_t buffer_size = p_instance->instance_count * stride * sizeof(float);
+	if (motion_vectors) {
+		buffer_size *= 2;
+	}
+	p_instance->gpu_cull_buffer = RD::get_singleton()->storage_buffer_create(buffer_size);
+
+	{
+		Vector<RD::Uniform> uniforms;
+		{
+			RD::Uniform u;
+			u.binding = 0;
+			u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+			u.append_id(source_buffer);
+			uniforms.push_back(u);
+		}
+		{
+			RD::Uniform u;
+			u.binding = 1;
+			u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+			u.append_id(p_instance->gpu_cull_buffer);
+			uniforms.push_back(u);
+		}
+		p_instance->gpu_cull_uniform_set = RD::get_singleton()->uniform_set_create(uniforms, gpu_cull.shader_rd, 1);
+	}
+	{
+		Vector<RD::Uniform> uniforms;
+		RD::Uniform u;
+		u.binding = 0;
+		u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+		u.append_id(p_instance->gpu_cull_buffer);
+		uniforms.push_back(u);
+		p_instance->gpu_cull_transforms_uniform_set = RD::get_singleton()->uniform_set_create(uniforms, scene_shader.default_shader_rd, TRANSFORMS_UNIFORM_SET);
+	}
+
+	return true;
+}
+
+void RenderForwardClustered::_geometry_instance_free_gpu_cull(GeometryInstanceForwardClustered *p_instance) {
+	if (p_instance->gpu_cull_buffer.is_valid()) {
+		RD::get_singleton()->free(p_instance->gpu_cull_buffer);
+		p_instance->gpu_cull_buffer = RID();
+		p_instance->gpu_cull_uniform_set = RID(); //cleared by dependency
+		p_instance->gpu_cull_transforms_uniform_set = RID(); //cleared by dependency
+	}
+}
+
+void RenderForwardClustered::_gpu_cull_instances(const RenderDataRD *p_render_data) {
+	render_list[RENDER_LIST_OPAQUE].gpu_cull_commands.clear();
+	render_list[RENDER_LIST_ALPHA].gpu_cull_commands.clear();
+
+	if (!gpu_cull.enabled || p_render_data->scene_data->view_count > 1) {
+		return;
+	}
+
+	RendererRD::MeshStorage *mesh_storage = RendererRD::MeshStorage::get_singleton();
+	RendererRD::ParticlesStorage *particles_storage = RendererRD::ParticlesStorage::get_singleton();
+	const RenderListType lists[2] = { RENDER_LIST_OPAQUE, RENDER_LIST_ALPHA };
+
+	gpu_cull.pass++;
+	gpu_cull.instances.clear();
+
+	// Count the draws of each instance first, so its commands can be allocated next to each other.
+	for (RenderListType list : lists) {
+		for (GeometryInstanceSurfaceDataCache *surf : render_list[list].elements) {
+			GeometryInstanceForwardClustered *inst = surf->owner;
+			if (inst->gpu_cull_pass != gpu_cull.pass) {
+				if (!_geometry_instance_can_gpu_cull(inst)) {
+					continue;
+				}
+				if (!_geometry_instance_setup_gpu_cull(inst)) {
+					continue;
+				}
+				inst->gpu_cull_pass = gpu_cull.pass;
+				inst->gpu_cull_command_count = 0;
+				gpu_cull.instances.push_back(inst);
+			}
+			inst->gpu_cull_command_count++;
+		}
+	}
+
+	if (gpu_cull.instances.is_empty()) {
+		return;
+	}
+
+	Vector<Plane> planes = p_render_data->scene_data->cam_projection.get_projection_planes(p_render_data->scene_data->cam_transform);
+	ERR_FAIL_COND(planes.size() != 6);
+
+	gpu_cull.items.resize(gpu_cull.instances.size());
+	uint32_t command_count = 0;
+
+	for (uint32_t i = 0; i < gpu_cull.instances.size(); i++) {
+		GeometryInstanceForwardClustered *inst = gpu_cull.instances[i];
+		GPUCull::Item &item = gpu_cull.items[i];
+
+		// Cull in the space of the node, so only the instance transforms are needed on the GPU.
+		// Particles in global coordinates are already stored in world space.
+		for (int j = 0; j < 6; j++) {
+			Plane plane = inst->store_transform_cache ? inst->transform.xform_inv(planes[j]) : planes[j];
+			item.planes[j][0] = plane.normal.x;
+			item.planes[j][1] = plane.normal.y;
+			item.planes[j][2] = plane.normal.z;
+			item.planes[j][3] = plane.d;
+		}
+
+		AABB aabb;
+		RID source_buffer;
+		uint32_t stride = 0;
+		bool motion_vectors = false;
+		_geometry_instance_get_gpu_cull_source(inst, source_buffer, stride, motion_vectors);
+
+		if (inst->data->base_type == RS::INSTANCE_PARTICLES) {
+			bool first = true;
+			for (int j = 0; j < particles_storage->particles_get_draw_passes(inst->data->base); j++) {
+				RID mesh = particles_storage->particles_get_draw_pass_mesh(inst->data->base, j);
+				if (mesh.is_valid()) {
+					AABB mesh_aabb = mesh_storage->mesh_get_aabb(mesh);
+					aabb = first ? mesh_aabb : aabb.merge(mesh_aabb);
+					first = false;
+				}
+			}
+			particles_storage->particles_get_instance_buffer_motion_vectors_offsets(inst->data->base, item.current_offset, item.previous_offset);
+			// Particle materials may billboard, or ignore the particle scale.
+			item.sphere_bounds = 1;
+		} else {
+			aabb = mesh_storage->mesh_get_aabb(mesh_storage->multimesh_get_mesh(inst->data->base));
+			mesh_storage->_multimesh_get_motion_vectors_offsets(inst->data->base, item.current_offset, item.previous_offset);
+			item.sphere_bounds = 0;
+		}
+
+		item.aabb_position[0] = aabb.position.x;
+		item.aabb_position[1] = aabb.position.y;
+		item.aabb_position[2] = aabb.position.z;
+		item.aabb_size[0] = aabb.size.x;
+		item.aabb_size[1] = aabb.size.y;
+		item.aabb_size[2] = aabb.size.z;
+
+		item.instance_count = inst->instance_count;
+		item.stride = stride / 4;
+		item.motion_vectors = motion_vectors;
+		item.command_first = command_count;
+		item.command_count = inst->gpu_cull_command_count;
+		item.pad[0] = 0;
+		item.pad[1] = 0;
+
+		inst->gpu_cull_command_first = command_count;
+		inst->gpu_cull_previous_offset = item.motion_vectors ? item.instance_count : 0;
+		command_count += inst->gpu_cull_command_count;
+		inst->gpu_cull_command_count = 0; // Reused below to hand out the commands.
+	}
+
+	gpu_cull.commands.resize(command_count * GPU_CULL_COMMAND_SIZE);
+
+	for (RenderListType list : lists) {
+		RenderList *rl = &render_list[list];
+		rl->gpu_cull_commands.resize(rl->elements.size());
+		for (uint32_t i = 0; i < rl->elements.size(); i++) {
+			GeometryInstanceSurfaceDataCache *surf = rl->elements[i];
+			GeometryInstanceForwardClustered *inst = surf->owner;
+			if (inst->gpu_cull_pass != gpu_cull.pass) {
+				rl->gpu_cull_commands[i] = GPU_CULL_COMMAND_NONE;
+				continue;
+			}
+
+			uint32_t command = inst->gpu_cull_command_first + inst->gpu_cull_command_count;
+			inst->gpu_cull_command_count++;
+
+			// The instance count starts at zero, visible instances add to it.
+			uint32_t *command_ptr = &gpu_cull.commands[command * GPU_CULL_COMMAND_SIZE];
+			command_ptr[0] = mesh_storage->mesh_surface_get_lod_vertices_drawn_count(surf->surface, rl->element_info[i].lod_index);
+			command_ptr[1] = 0;
+			command_ptr[2] = 0;
+			command_ptr[3] = 0;
+			command_ptr[4] = 0;
+
+			rl->gpu_cull_commands[i] = command;
+		}
+	}
+
+	if (gpu_cull.item_buffer.is_null() || gpu_cull.item_buffer_size < gpu_cull.items.size()) {
+		if (gpu_cull.item_buffer.is_valid()) {
+			RD::get_singleton()->free(gpu_cull.item_buffer);
+		}
+		gpu_cull.item_buffer_size = nearest_power_of_2_templated(MAX(uint32_t(GPU_CULL_BUFFER_MIN_SIZE), gpu_cull.items.size()));
+		gpu_cull.item_buffer = RD::get_singleton()->storage_buffer_create(gpu_cull.item_buffer_size * sizeof(GPUCull::Item));
+		gpu_cull.uniform_set = RID(); //cleared by dependency
+	}
+
+	if (gpu_cull.command_buffer.is_null() || gpu_cull.command_buffer_size < command_count) {
+		if (gpu_cull.command_buffer.is_valid()) {
+			RD::get_singleton()->free(gpu_cull.command_buffer);
+		}
+		gpu_cull.command_buffer_size = nearest_power_of_2_templated(MAX(uint32_t(GPU_CULL_BUFFER_MIN_SIZE), command_count));
+		gpu_cull.command_buffer = RD::get_singleton()->storage_buffer_create(gpu_cull.command_buffer_size * GPU_CULL_COMMAND_SIZE * sizeof(uint32_t), Vector<uint8_t>(), RD::STORAGE_BUFFER_USAGE_DISPATCH_INDIRECT);
+		gpu_cull.uniform_set = RID(); //cleared by dependency
+	}
+
+	if (gpu_cull.uniform_set.is_null()) {
+		Vector<RD::Uniform> uniforms;
+		{
+			RD::Uniform u;
+			u.binding = 0;
+			u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+			u.append_id(gpu_cull.item_buffer);
+			uniforms.push_back(u);
+		}
+		{
+			RD::Uniform u;
+			u.binding = 1;
+			u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+			u.append_id(gpu_cull.command_buffer);
+			uniforms.push_back(u);
+		}
+		gpu_cull.uniform_set = RD::get_singleton()->uniform_set_create(uniforms, gpu_cull.shader_rd, 0);
+	}
+
+	RD::get_singleton()->buffer_update(gpu_cull.item_buffer, 0, gpu_cull.items.size() * sizeof(GPUCull::Item), gpu_cull.items.ptr(), RD::BARRIER_MASK_COMPUTE);
+	RD::get_singleton()->buffer_update(gpu_cull.command_buffer, 0, gpu_cull.commands.size() * sizeof(uint32_t), gpu_cull.commands.ptr(), RD::BARRIER_MASK_COMPUTE);
+
+	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
+	RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, gpu_cull.pipeline);
+	RD::get_singleton()->compute_list_bind_uniform_set(compute_list, gpu_cull.uniform_set, 0);
+
+	GPUCull::PushConstant push_constant = {};
+	for (uint32_t i = 0; i < gpu_cull.instances.size(); i++) {
+		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, gpu_cull.instances[i]->gpu_cull_uniform_set, 1);
+		push_constant.item = i;
+		RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(GPUCull::PushConstant));
+		RD::get_singleton()->compute_list_dispatch_threads(compute_list, gpu_cull.items[i].instance_count, 1, 1);
+	}
+
+	// Both the indirect commands and the compacted transforms are read while drawing.
+	RD::get_singleton()->compute_list_end(RD::BARRIER_MASK_VERTEX);
+}
+
 _FORCE_INLINE_ static uint32_t _indices_to_primitives(RS::PrimitiveType p_primitive, uint32_t p_indices) {
 	static const uint32_t divisor[RS::PRIMITIVE_MAX] = { 1, 2, 1, 3, 1 };
 	static const uint32_t subtractor[RS::PRIMITIVE_MAX] = { 0, 0, 1, 0, 1 };
@@ -923,6 +1254,13 @@ void RenderForwardClustered::_fill_render_list(RenderListType p_render_list, con
 			surf->sort.uses_forward_gi = 0;
 			surf->sort.uses_lightmap = 0;
 
+			if (unlikely(surf->shader->compiling || surf->shader_shadow->compiling)) {
+				// Visible surfaces compile first, the closest ones before the others.
+				float priority = 1.0 + 1.0 / (1.0 + MAX(inst->depth, 0.0));
+				surf->shader->compile_priority = MAX(surf->shader->compile_priority, priority);
+				surf->shader_shadow->compile_priority = MAX(surf->shader_shadow->compile_priority, priority);
+			}
+
 			// LOD
 
 			if (p_render_data->scene_data->screen_mesh_lod_threshold > 0.0 && mesh_storage->mesh_surface_has_lod(surf->surface)) {
@@ -1092,6 +1430,7 @@ void RenderForwardClustered::_update_sdfgi(RenderDataRD *p_render_data) {
 			sdfgi->render_region(rb, p_render_data->render_sdfgi_regions[i].region, p_render_data->render_sdfgi_regions[i].instances, exposure_normalization);
 		}
 		if (p_render_data->sdfgi_update_data->update_static) {
+			RENDER_TIMESTAMP("Render SDFGI Static Lights");
 			sdfgi->render_static_lights(p_render_data, rb, p_render_data->sdfgi_update_data->static_cascade_count, p_render_data->sdfgi_update_data->static_cascade_indices, p_render_data->sdfgi_update_data->static_positional_lights);
 		}
 	}
@@ -1148,6 +1487,13 @@ void RenderForwardClustered::_update_volumetric_fog(Ref<RenderSceneBuffersRD> p_
 	uint32_t target_width = uint32_t(float(get_volumetric_fog_size()) * ratio);
 	uint32_t target_height = uint32_t(float(get_volumetric_fog_size()) / ratio);
 
+	if (p_environment.is_valid()) {
+		// Reduced resolutions only shrink the froxel grid on screen, depth slices are kept so fog volumes don't band.
+		uint32_t shift = environment_get_volumetric_fog_resolution(p_environment);
+		target_width = MAX(target_width >> shift, 1u);
+		target_height = MAX(target_height >> shift, 1u);
+	}
+
 	if (p_render_buffers->has_custom_data(RB_SCOPE_FOG)) {
 		Ref<RendererRD::Fog::VolumetricFog> fog = p_render_buffers->get_custom_data(RB_SCOPE_FOG);
 		//validate
@@ -1161,6 +1507,8 @@ void RenderForwardClustered::_update_volumetric_fog(Ref<RenderSceneBuffersRD> p_
 		return;
 	}
 
+	RENDER_TIMESTAMP("Volumetric Fog");
+
 	if (p_environment.is_valid() && environment_get_volumetric_fog_enabled(p_environment) && !p_render_buffers->has_custom_data(RB_SCOPE_FOG)) {
 		//required volumetric fog but not existing, create
 		Ref<RendererRD::Fog::VolumetricFog> fog;
@@ -1328,12 +1676,35 @@ void RenderForwardClustered::_pre_opaque_render(RenderDataRD *p_render_data, boo
 		sdfgi->store_probes();
 	}
 
+	bool use_ss_effects = rb_data.is_valid() && ss_effects && (p_use_ssao || p_use_ssil);
+	if (use_ss_effects) {
+		// Note, in multiview we're allocating buffers for each eye/view we're rendering.
+		// This should allow most of the processing to happen in parallel even if we're doing
+		// drawcalls per eye/view. It will all sync up at the barrier.
+
+		// SSAO only depends on the depth pre-pass, so it runs on the async compute queue while shadows and GI render.
+		RD::get_singleton()->async_compute_begin();
+
+		// Convert our depth buffer data to linear data in
+		for (uint32_t v = 0; v < rb->get_view_count(); v++) {
+			ss_effects->downsample_depth(rb, v, p_render_data->scene_data->view_projection[v]);
+		}
+
+		if (p_use_ssao) {
+			_process_ssao(rb, p_render_data->environment, p_normal_roughness_slices, p_render_data->scene_data->view_projection);
+		}
+
+		RD::get_singleton()->async_compute_end();
+	}
+
 	p_render_data->cube_shadows.clear();
 	p_render_data->shadows.clear();
 	p_render_data->directional_shadows.clear();
 
 	Plane camera_plane(-p_render_data->scene_data->cam_transform.basis.get_column(Vector3::AXIS_Z), p_render_data->scene_data->cam_transform.origin);
 	float lod_distance_multiplier = p_render_data->scene_data->cam_projection.get_lod_multiplier();
+	// Cached shadow passes restore and store their region with copies, so every pass must begin and end its own draw list.
+	bool use_static_shadow_cache = false;
 	{
 		for (int i = 0; i < p_render_data->render_shadow_count; i++) {
 			RID li = p_render_data->render_shadows[i].light;
@@ -1346,17 +1717,24 @@ void RenderForwardClustered::_pre_opaque_render(RenderDataRD *p_render_data, boo
 			} else {
 				p_render_data->shadows.push_back(i);
 			}
+
+			if (p_render_data->render_shadows[i].use_static_cache) {
+				use_static_shadow_cache = true;
+			}
 		}
 
 		//cube shadows are rendered in their own way
+		if (p_render_data->cube_shadows.size()) {
+			RENDER_TIMESTAMP("Render Cube Shadows");
+		}
 		for (const int &index : p_render_data->cube_shadows) {
-			_render_shadow_pass(p_render_data->render_shadows[index].light, p_render_data->shadow_atlas, p_render_data->render_shadows[index].pass, p_render_data->render_shadows[index].instances, camera_plane, lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, true, true, true, p_render_data->render_info);
+			_render_shadow_pass(p_render_data->render_shadows[index].light, p_render_data->shadow_atlas, p_render_data->render_shadows[index].pass, p_render_data->render_shadows[index].instances, camera_plane, lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, true, true, true, nullptr, false, p_render_data->render_info);
 		}
 
 		if (p_render_data->directional_shadows.size()) {
 			//open the pass for directional shadows
 			light_storage->update_directional_shadow_atlas();
-			RD::get_singleton()->draw_list_begin(light_storage->direction_shadow_get_fb(), RD::INITIAL_ACTION_DROP, RD::FINAL_ACTION_DISCARD, RD::INITIAL_ACTION_CLEAR, RD::FINAL_ACTION_CONTINUE);
+			RD::get_singleton()->draw_list_begin(light_storage->direction_shadow_get_fb(), RD::INITIAL_ACTION_DROP, RD::FINAL_ACTION_DISCARD, RD::INITIAL_ACTION_CLEAR, use_static_shadow_cache ? RD::FINAL_ACTION_READ : RD::FINAL_ACTION_CONTINUE);
 			RD::get_singleton()->draw_list_end();
 		}
 	}
@@ -1380,11 +1758,21 @@ void RenderForwardClustered::_pre_opaque_render(RenderDataRD *p_render_data, boo
 
 		//render directional shadows
 		for (uint32_t i = 0; i < p_render_data->directional_shadows.size(); i++) {
-			_render_shadow_pass(p_render_data->render_shadows[p_render_data->directional_shadows[i]].light, p_render_data->shadow_atlas, p_render_data->render_shadows[p_render_data->directional_shadows[i]].pass, p_render_data->render_shadows[p_render_data->directional_shadows[i]].instances, camera_plane, lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, false, i == p_render_data->directional_shadows.size() - 1, false, p_render_data->render_info);
+			const RenderShadowData &shadow_data = p_render_data->render_shadows[p_render_data->directional_shadows[i]];
+			if (use_static_shadow_cache) {
+				_render_shadow_pass(shadow_data.light, p_render_data->shadow_atlas, shadow_data.pass, shadow_data.instances, camera_plane, lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, true, true, true, &shadow_data.dynamic_instances, shadow_data.static_cache_dirty, p_render_data->render_info);
+			} else {
+				_render_shadow_pass(shadow_data.light, p_render_data->shadow_atlas, shadow_data.pass, shadow_data.instances, camera_plane, lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, false, i == p_render_data->directional_shadows.size() - 1, false, nullptr, false, p_render_data->render_info);
+			}
 		}
 		//render positional shadows
 		for (uint32_t i = 0; i < p_render_data->shadows.size(); i++) {
-			_render_shadow_pass(p_render_data->render_shadows[p_render_data->shadows[i]].light, p_render_data->shadow_atlas, p_render_data->render_shadows[p_render_data->shadows[i]].pass, p_render_data->render_shadows[p_render_data->shadows[i]].instances, camera_plane, lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, i == 0, i == p_render_data->shadows.size() - 1, true, p_render_data->render_info);
+			const RenderShadowData &shadow_data = p_render_data->render_shadows[p_render_data->shadows[i]];
+			if (use_static_shadow_cache) {
+				_render_shadow_pass(shadow_data.light, p_render_data->shadow_atlas, shadow_data.pass, shadow_data.instances, camera_plane, lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, true, true, true, &shadow_data.dynamic_instances, shadow_data.static_cache_dirty, p_render_data->render_info);
+			} else {
+				_render_shadow_pass(shadow_data.light, p_render_data->shadow_atlas, shadow_data.pass, shadow_data.instances, camera_plane, lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, i == 0, i == p_render_data->shadows.size() - 1, true, nullptr, false, p_render_data->render_info);
+			}
 		}
 
 		_render_shadow_process();
@@ -1404,36 +1792,27 @@ void RenderForwardClustered::_pre_opaque_render(RenderDataRD *p_render_data, boo
 		RD::get_singleton()->compute_list_end(RD::BARRIER_MASK_NO_BARRIER); //use a later barrier
 	}
 
-	if (rb_data.is_valid() && ss_effects) {
-		// Note, in multiview we're allocating buffers for each eye/view we're rendering.
-		// This should allow most of the processing to happen in parallel even if we're doing
-		// drawcalls per eye/view. It will all sync up at the barrier.
+	if (use_ss_effects) {
+		RD::get_singleton()->async_compute_sync();
 
-		if (p_use_ssao || p_use_ssil) {
-			// Convert our depth buffer data to linear data in
-			for (uint32_t v = 0; v < rb->get_view_count(); v++) {
-				ss_effects->downsample_depth(rb, v, p_render_data->scene_data->view_projection[v]);
-			}
-
-			if (p_use_ssao) {
-				_process_ssao(rb, p_render_data->environment, p_normal_roughness_slices, p_render_data->scene_data->view_projection);
-			}
-
-			if (p_use_ssil) {
-				_process_ssil(rb, p_render_data->environment, p_normal_roughness_slices, p_render_data->scene_data->view_projection, p_render_data->scene_data->cam_transform);
-			}
+		// SSIL clears its history with transfers and reads the previous frame, keep it on the graphics queue.
+		if (p_use_ssil) {
+			_process_ssil(rb, p_render_data->environment, p_normal_roughness_slices, p_render_data->scene_data->view_projection, p_render_data->scene_data->cam_transform);
 		}
 	}
 
 	//full barrier here, we need raster, transfer and compute and it depends from the previous work
 	RD::get_singleton()->barrier(RD::BARRIER_MASK_ALL_BARRIERS, RD::BARRIER_MASK_ALL_BARRIERS);
 
+	RENDER_TIMESTAMP("Setup Lights + Cluster");
+
 	if (current_cluster_builder) {
 		// Note: when rendering stereoscopic (multiview) we are using our combined frustum projection to create
 		// our cluster data. We use reprojection in the shader to adjust for our left/right eye.
 		// This only works as we don't filter our cluster by depth buffer.
 		// If we ever make this optimization we should make it optional and only use it in mono.
 		// What we win by filtering out a few lights, we loose by having to do the work double for stereo.
+		current_cluster_builder->set_use_compute_binning(GLOBAL_GET("rendering/limits/cluster_builder/use_compute_binning"));
 		current_cluster_builder->begin(p_render_data->scene_data->cam_transform, p_render_data->scene_data->cam_projection, !p_render_data->reflection_probe.is_valid());
 	}
 
@@ -1558,12 +1937,14 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 		if (rb->has_custom_data(RB_SCOPE_SDFGI)) {
 			Ref<RendererRD::GI::SDFGI> sdfgi = rb->get_custom_data(RB_SCOPE_SDFGI);
 			if (sdfgi.is_valid()) {
+				RENDER_TIMESTAMP("Update SDFGI");
 				sdfgi->update_cascades();
 				sdfgi->pre_process_gi(p_render_data->scene_data->cam_transform, p_render_data);
 				sdfgi->update_light();
 			}
 		}
 
+		RENDER_TIMESTAMP("Setup VoxelGI");
 		gi.setup_voxel_gi_instances(p_render_data, p_render_data->render_buffers, p_render_data->scene_data->cam_transform, *p_render_data->voxel_gi_instances, p_render_data->voxel_gi_count);
 	} else {
 		ERR_PRINT("No render buffer nor reflection atlas, bug"); //should never happen, will crash
@@ -1576,6 +1957,7 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 		p_render_data->cluster_max_elements = current_cluster_builder->get_max_cluster_elements();
 	}
 
+	RENDER_TIMESTAMP("Update VRS");
 	_update_vrs(rb);
 
 	RENDER_TIMESTAMP("Setup 3D Scene");
@@ -1583,7 +1965,7 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 	// check if we need motion vectors
 	if (get_debug_draw_mode() == RS::VIEWPORT_DEBUG_DRAW_MOTION_VECTORS) {
 		p_render_data->scene_data->calculate_motion_vectors = true;
-	} else if (!is_reflection_probe && rb->get_use_taa()) {
+	} else if (!is_reflection_probe && (rb->get_use_taa() || rb->get_use_temporal_upscale())) {
 		p_render_data->scene_data->calculate_motion_vectors = true;
 	} else {
 		p_render_data->scene_data->calculate_motion_vectors = false;
@@ -1625,7 +2007,7 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 	} else {
 		screen_size = rb->get_internal_size();
 
-		if (rb->get_use_taa() || get_debug_draw_mode() == RS::VIEWPORT_DEBUG_DRAW_MOTION_VECTORS) {
+		if (rb->get_use_taa() || rb->get_use_temporal_upscale() || get_debug_draw_mode() == RS::VIEWPORT_DEBUG_DRAW_MOTION_VECTORS) {
 			color_pass_flags |= COLOR_PASS_FLAG_MOTION_VECTORS;
 			scene_shader.enable_advanced_shader_group();
 		}
@@ -1666,11 +2048,14 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 	_update_render_base_uniform_set(); //may have changed due to the above (light buffer enlarged, as an example)
 
 	_fill_render_list(RENDER_LIST_OPAQUE, p_render_data, PASS_MODE_COLOR, color_pass_flags, using_sdfgi, using_sdfgi || using_voxelgi);
+	render_list[RENDER_LIST_OPAQUE].merge_instancing_depth_layers(0, render_list[RENDER_LIST_OPAQUE].elements.size());
 	render_list[RENDER_LIST_OPAQUE].sort_by_key();
 	render_list[RENDER_LIST_ALPHA].sort_by_reverse_depth_and_priority();
 	_fill_instance_data(RENDER_LIST_OPAQUE, p_render_data->render_info ? p_render_data->render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_VISIBLE] : (int *)nullptr);
 	_fill_instance_data(RENDER_LIST_ALPHA);
 
+	_gpu_cull_instances(p_render_data);
+
 	RD::get_singleton()->draw_command_end_label();
 
 	if (!is_reflection_probe) {
@@ -1847,6 +2232,10 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 
 		bool finish_depth = using_ssao || using_ssil || using_sdfgi || using_voxelgi;
 		RenderListParameters render_list_params(render_list[RENDER_LIST_OPAQUE].elements.ptr(), render_list[RENDER_LIST_OPAQUE].element_info.ptr(), render_list[RENDER_LIST_OPAQUE].elements.size(), reverse_cull, depth_pass_mode, 0, rb_data.is_null(), p_render_data->directional_light_soft_shadows, rp_uniform_set, get_debug_draw_mode() == RS::VIEWPORT_DEBUG_DRAW_WIREFRAME, Vector2(), p_render_data->scene_data->lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, p_render_data->scene_data->view_count);
+		if (!render_list[RENDER_LIST_OPAQUE].gpu_cull_commands.is_empty()) {
+			render_list_params.gpu_cull_commands = render_list[RENDER_LIST_OPAQUE].gpu_cull_commands.ptr();
+			render_list_params.gpu_cull_command_buffer = gpu_cull.command_buffer;
+		}
 		_render_list_with_threads(&render_list_params, depth_framebuffer, needs_pre_resolve ? RD::INITIAL_ACTION_CONTINUE : RD::INITIAL_ACTION_CLEAR, RD::FINAL_ACTION_READ, needs_pre_resolve ? RD::INITIAL_ACTION_CONTINUE : RD::INITIAL_ACTION_CLEAR, finish_depth ? RD::FINAL_ACTION_READ : RD::FINAL_ACTION_CONTINUE, needs_pre_resolve ? Vector<Color>() : depth_pass_clear);
 
 		RD::get_singleton()->draw_command_end_label();
@@ -1917,6 +2306,10 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 		}
 
 		RenderListParameters render_list_params(render_list[RENDER_LIST_OPAQUE].elements.ptr(), render_list[RENDER_LIST_OPAQUE].element_info.ptr(), render_list[RENDER_LIST_OPAQUE].elements.size(), reverse_cull, PASS_MODE_COLOR, color_pass_flags, rb_data.is_null(), p_render_data->directional_light_soft_shadows, rp_uniform_set, get_debug_draw_mode() == RS::VIEWPORT_DEBUG_DRAW_WIREFRAME, Vector2(), p_render_data->scene_data->lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, p_render_data->scene_data->view_count);
+		if (!render_list[RENDER_LIST_OPAQUE].gpu_cull_commands.is_empty()) {
+			render_list_params.gpu_cull_commands = render_list[RENDER_LIST_OPAQUE].gpu_cull_commands.ptr();
+			render_list_params.gpu_cull_command_buffer = gpu_cull.command_buffer;
+		}
 		_render_list_with_threads(&render_list_params, color_framebuffer, keep_color ? RD::INITIAL_ACTION_KEEP : RD::INITIAL_ACTION_CLEAR, will_continue_color ? RD::FINAL_ACTION_CONTINUE : RD::FINAL_ACTION_READ, depth_pre_pass ? (continue_depth ? RD::INITIAL_ACTION_CONTINUE : RD::INITIAL_ACTION_KEEP) : RD::INITIAL_ACTION_CLEAR, will_continue_depth ? RD::FINAL_ACTION_CONTINUE : RD::FINAL_ACTION_READ, c, 1.0, 0);
 		if (will_continue_color && using_separate_specular) {
 			// close the specular framebuffer, as it's no longer used
@@ -2051,6 +2444,10 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 		uint32_t transparent_color_pass_flags = (color_pass_flags | COLOR_PASS_FLAG_TRANSPARENT) & ~(COLOR_PASS_FLAG_SEPARATE_SPECULAR);
 		RID alpha_framebuffer = rb_data.is_valid() ? rb_data->get_color_pass_fb(transparent_color_pass_flags) : color_only_framebuffer;
 		RenderListParameters render_list_params(render_list[RENDER_LIST_ALPHA].elements.ptr(), render_list[RENDER_LIST_ALPHA].element_info.ptr(), render_list[RENDER_LIST_ALPHA].elements.size(), false, PASS_MODE_COLOR, transparent_color_pass_flags, rb_data.is_null(), p_render_data->directional_light_soft_shadows, rp_uniform_set, get_debug_draw_mode() == RS::VIEWPORT_DEBUG_DRAW_WIREFRAME, Vector2(), p_render_data->scene_data->lod_distance_multiplier, p_render_data->scene_data->screen_mesh_lod_threshold, p_render_data->scene_data->view_count);
+		if (!render_list[RENDER_LIST_ALPHA].gpu_cull_commands.is_empty()) {
+			render_list_params.gpu_cull_commands = render_list[RENDER_LIST_ALPHA].gpu_cull_commands.ptr();
+			render_list_params.gpu_cull_command_buffer = gpu_cull.command_buffer;
+		}
 		_render_list_with_threads(&render_list_params, alpha_framebuffer, can_continue_color ? RD::INITIAL_ACTION_CONTINUE : RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_READ, can_continue_depth ? RD::INITIAL_ACTION_CONTINUE : RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_READ);
 	}
 
@@ -2065,7 +2462,7 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 			RD::get_singleton()->texture_resolve_multisample(rb->get_color_msaa(v), rb->get_internal_texture(v));
 			resolve_effects->resolve_depth(rb->get_depth_msaa(v), rb->get_depth_texture(v), rb->get_internal_size(), texture_multisamples[rb->get_msaa_3d()]);
 		}
-		if (taa && rb->get_use_taa()) {
+		if (taa && (rb->get_use_taa() || rb->get_use_temporal_upscale())) {
 			taa->msaa_resolve(rb);
 		}
 	}
@@ -2079,7 +2476,8 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 	}
 	RD::get_singleton()->draw_command_end_label();
 
-	if (rb_data.is_valid() && taa && rb->get_use_taa()) {
+	// The temporal upscaler replaces TAA, it runs after tonemapping.
+	if (rb_data.is_valid() && taa && rb->get_use_taa() && !rb->get_use_temporal_upscale()) {
 		RENDER_TIMESTAMP("TAA")
 		taa->process(rb, _render_buffers_get_color_format(), p_render_data->scene_data->z_near, p_render_data->scene_data->z_far);
 	}
@@ -2111,6 +2509,15 @@ void RenderForwardClustered::_render_scene(RenderDataRD *p_render_data, const Co
 	}
 }
 
+void RenderForwardClustered::_render_buffers_temporal_upscale(const RenderDataRD *p_render_data, const StringName &p_source_context, const StringName &p_source_name) {
+	Ref<RenderSceneBuffersRD> rb = p_render_data->render_buffers;
+	ERR_FAIL_COND(rb.is_null());
+	ERR_FAIL_NULL(taa);
+
+	RENDER_TIMESTAMP("TAA Upscale");
+	taa->upscale(rb, p_source_context, p_source_name, p_render_data->scene_data->taa_jitter);
+}
+
 void RenderForwardClustered::_render_buffers_debug_draw(const RenderDataRD *p_render_data) {
 	RendererRD::TextureStorage *texture_storage = RendererRD::TextureStorage::get_singleton();
 
@@ -2144,7 +2551,7 @@ void RenderForwardClustered::_render_buffers_debug_draw(const RenderDataRD *p_re
 	}
 }
 
-void RenderForwardClustered::_render_shadow_pass(RID p_light, RID p_shadow_atlas, int p_pass, const PagedArray<RenderGeometryInstance *> &p_instances, const Plane &p_camera_plane, float p_lod_distance_multiplier, float p_screen_mesh_lod_threshold, bool p_open_pass, bool p_close_pass, bool p_clear_region, RenderingMethod::RenderInfo *p_render_info) {
+void RenderForwardClustered::_render_shadow_pass(RID p_light, RID p_shadow_atlas, int p_pass, const PagedArray<RenderGeometryInstance *> &p_instances, const Plane &p_camera_plane, float p_lod_distance_multiplier, float p_screen_mesh_lod_threshold, bool p_open_pass, bool p_close_pass, bool p_clear_region, const PagedArray<RenderGeometryInstance *> *p_dynamic_instances, bool p_static_cache_dirty, RenderingMethod::RenderInfo *p_render_info) {
 	RendererRD::LightStorage *light_storage = RendererRD::LightStorage::get_singleton();
 
 	ERR_FAIL_COND(!light_storage->owns_light_instance(p_light));
@@ -2161,6 +2568,7 @@ void RenderForwardClustered::_render_shadow_pass(RID p_light, RID p_shadow_atlas
 	Vector2i dual_paraboloid_offset;
 	RID render_fb;
 	RID render_texture;
+	RID atlas_texture;
 	float zfar;
 
 	bool use_pancake = false;
@@ -2217,6 +2625,7 @@ void RenderForwardClustered::_render_shadow_pass(RID p_light, RID p_shadow_atlas
 
 		render_fb = light_storage->direction_shadow_get_fb();
 		render_texture = RID();
+		atlas_texture = light_storage->directional_shadow_get_texture();
 		flip_y = true;
 
 	} else {
@@ -2284,6 +2693,7 @@ void RenderForwardClustered::_render_shadow_pass(RID p_light, RID p_shadow_atlas
 				using_dual_paraboloid = true;
 				using_dual_paraboloid_flip = p_pass == 1;
 				render_fb = light_storage->shadow_atlas_get_fb(p_shadow_atlas);
+				atlas_texture = light_storage->shadow_atlas_get_texture(p_shadow_atlas);
 				flip_y = true;
 			}
 
@@ -2292,6 +2702,7 @@ void RenderForwardClustered::_render_shadow_pass(RID p_light, RID p_shadow_atlas
 			light_transform = light_storage->light_instance_get_shadow_transform(p_light, 0);
 
 			render_fb = light_storage->shadow_atlas_get_fb(p_shadow_atlas);
+			atlas_texture = light_storage->shadow_atlas_get_texture(p_shadow_atlas);
 
 			flip_y = true;
 		}
@@ -2315,6 +2726,27 @@ void RenderForwardClustered::_render_shadow_pass(RID p_light, RID p_shadow_atlas
 			light_storage->light_instance_set_shadow_transform(p_light, Projection(), light_storage->light_instance_get_base_transform(p_light), zfar, 0, 0, 0);
 		}
 
+	} else if (p_dynamic_instances) {
+		// Static casters are only redrawn when they or the shadow matrices change, otherwise their depth is copied back from the cache.
+		RD::DataFormat format = RD::get_singleton()->texture_get_format(atlas_texture).format;
+		bool cache_valid = light_storage->light_instance_update_static_shadow_cache(p_light, p_pass, atlas_rect.size, format, light_projection, light_transform) && !p_static_cache_dirty;
+		RID cache = light_storage->light_instance_get_static_shadow_cache(p_light, p_pass);
+
+		if (!cache_valid) {
+			_render_shadow_append(render_fb, p_instances, light_projection, light_transform, zfar, 0, 0, reverse_cull_face, using_dual_paraboloid, using_dual_paraboloid_flip, use_pancake, p_camera_plane, p_lod_distance_multiplier, p_screen_mesh_lod_threshold, atlas_rect, flip_y, true, true, true, p_render_info);
+			SceneState::ShadowPass &static_pass = scene_state.shadow_passes[scene_state.shadow_passes.size() - 1];
+			static_pass.atlas_texture = atlas_texture;
+			static_pass.static_cache_store = cache;
+		}
+
+		_render_shadow_append(render_fb, *p_dynamic_instances, light_projection, light_transform, zfar, 0, 0, reverse_cull_face, using_dual_paraboloid, using_dual_paraboloid_flip, use_pancake, p_camera_plane, p_lod_distance_multiplier, p_screen_mesh_lod_threshold, atlas_rect, flip_y, false, true, true, p_render_info);
+		SceneState::ShadowPass &dynamic_pass = scene_state.shadow_passes[scene_state.shadow_passes.size() - 1];
+		dynamic_pass.initial_depth_action = RD::INITIAL_ACTION_KEEP;
+		dynamic_pass.atlas_texture = atlas_texture;
+		if (cache_valid) {
+			dynamic_pass.static_cache_restore = cache;
+		}
+
 	} else {
 		//render shadow
 		_render_shadow_append(render_fb, p_instances, light_projection, light_transform, zfar, 0, 0, reverse_cull_face, using_dual_paraboloid, using_dual_paraboloid_flip, use_pancake, p_camera_plane, p_lod_distance_multiplier, p_screen_mesh_lod_threshold, atlas_rect, flip_y, p_clear_region, p_open_pass, p_close_pass, p_render_info);
@@ -2367,6 +2799,7 @@ void RenderForwardClustered::_render_shadow_append(RID p_framebuffer, const Page
 	uint32_t render_list_from = render_list[RENDER_LIST_SECONDARY].elements.size();
 	_fill_render_list(RENDER_LIST_SECONDARY, &render_data, pass_mode, 0, false, false, true);
 	uint32_t render_list_size = render_list[RENDER_LIST_SECONDARY].elements.size() - render_list_from;
+	render_list[RENDER_LIST_SECONDARY].merge_instancing_depth_layers(render_list_from, render_list_size);
 	render_list[RENDER_LIST_SECONDARY].sort_by_key_range(render_list_from, render_list_size);
 	_fill_instance_data(RENDER_LIST_SECONDARY, p_render_info ? p_render_info->info[RS::VIEWPORT_RENDER_INFO_TYPE_SHADOW] : (int *)nullptr, render_list_from, render_list_size, false);
 
@@ -2416,8 +2849,21 @@ void RenderForwardClustered::_render_shadow_end(uint32_t p_barrier) {
 	RD::get_singleton()->draw_command_begin_label("Shadow Render");
 
 	for (SceneState::ShadowPass &shadow_pass : scene_state.shadow_passes) {
+		Vector3 rect_position = Vector3(shadow_pass.rect.position.x, shadow_pass.rect.position.y, 0);
+		Vector3 rect_size = Vector3(shadow_pass.rect.size.x, shadow_pass.rect.size.y, 1);
+
+		if (shadow_pass.static_cache_restore.is_valid()) {
+			RD::get_singleton()->barrier(RD::BARRIER_MASK_RASTER, RD::BARRIER_MASK_TRANSFER);
+			RD::get_singleton()->texture_copy(shadow_pass.static_cache_restore, shadow_pass.atlas_texture, Vector3(), rect_position, rect_size, 0, 0, 0, 0, RD::BARRIER_MASK_RASTER);
+		}
+
 		RenderListParameters render_list_parameters(render_list[RENDER_LIST_SECONDARY].elements.ptr() + shadow_pass.element_from, render_list[RENDER_LIST_SECONDARY].element_info.ptr() + shadow_pass.element_from, shadow_pass.element_count, shadow_pass.flip_cull, shadow_pass.pass_mode, 0, true, false, shadow_pass.rp_uniform_set, false, Vector2(), shadow_pass.lod_distance_multiplier, shadow_pass.screen_mesh_lod_threshold, 1, shadow_pass.element_from, RD::BARRIER_MASK_NO_BARRIER);
 		_render_list_with_threads(&render_list_parameters, shadow_pass.framebuffer, RD::INITIAL_ACTION_DROP, RD::FINAL_ACTION_DISCARD, shadow_pass.initial_depth_action, shadow_pass.final_depth_action, Vector<Color>(), 1.0, 0, shadow_pass.rect);
+
+		if (shadow_pass.static_cache_store.is_valid()) {
+			RD::get_singleton()->barrier(RD::BARRIER_MASK_RASTER, RD::BARRIER_MASK_TRANSFER);
+			RD::get_singleton()->texture_copy(shadow_pass.atlas_texture, shadow_pass.static_cache_store, rect_position, Vector3(), rect_size, 0, 0, 0, 0, RD::BARRIER_MASK_RASTER);
+		}
 	}
 
 	if (p_barrier != RD::BARRIER_MASK_NO_BARRIER) {
@@ -2426,7 +2872,7 @@ void RenderForwardClustered::_render_shadow_end(uint32_t p_barrier) {
 	RD::get_singleton()->draw_command_end_label();
 }
 
-void RenderForwardClustered::_render_particle_collider_heightfield(RID p_fb, const Transform3D &p_cam_transform, const Projection &p_cam_projection, const PagedArray<RenderGeometryInstance *> &p_instances) {
+void RenderForwardClustered::_render_particle_collider_heightfield(RID p_fb, const Transform3D &p_cam_transform, const Projection &p_cam_projection, const PagedArray<RenderGeometryInstance *> &p_instances, const Rect2i &p_region) {
 	RENDER_TIMESTAMP("Setup GPUParticlesCollisionHeightField3D");
 
 	RD::get_singleton()->draw_command_begin_label("Render Collider Heightfield");
@@ -2465,7 +2911,9 @@ void RenderForwardClustered::_render_particle_collider_heightfield(RID p_fb, con
 	{
 		//regular forward for now
 		RenderListParameters render_list_params(render_list[RENDER_LIST_SECONDARY].elements.ptr(), render_list[RENDER_LIST_SECONDARY].element_info.ptr(), render_list[RENDER_LIST_SECONDARY].elements.size(), false, pass_mode, 0, true, false, rp_uniform_set);
-		_render_list_with_threads(&render_list_params, p_fb, RD::INITIAL_ACTION_CLEAR, RD::FINAL_ACTION_READ, RD::INITIAL_ACTION_CLEAR, RD::FINAL_ACTION_READ);
+		// With a region, only that part is cleared and drawn, the rest keeps the depths from the previous update.
+		RD::InitialAction initial_action = p_region.has_area() ? RD::INITIAL_ACTION_CLEAR_REGION : RD::INITIAL_ACTION_CLEAR;
+		_render_list_with_threads(&render_list_params, p_fb, initial_action, RD::FINAL_ACTION_READ, initial_action, RD::FINAL_ACTION_READ, Vector<Color>(), 1.0, 0, p_region);
 	}
 	RD::get_singleton()->draw_command_end_label();
 }
@@ -3718,6 +4166,7 @@ void RenderForwardClustered::_geometry_instance_update(RenderGeometryInstance *p
 		if (particles_storage->particles_get_frame_counter(ginstance->data->base) == 0) {
 			// Particles haven't been cleared or updated, update once now to ensure they are ready to render.
 			particles_storage->update_particles();
+			particles_storage->sync_particles_update();
 		}
 
 		if (ginstance->data->dirty_dependencies) {
@@ -3752,6 +4201,9 @@ void RenderForwardClustered::_geometry_instance_update(RenderGeometryInstance *p
 }
 
 void RenderForwardClustered::_update_dirty_geometry_instances() {
+	// Shaders that finished compiling update their materials, which dirties the instances using them.
+	scene_shader.update_async_shaders();
+
 	while (geometry_instance_dirty_list.first()) {
 		_geometry_instance_update(geometry_instance_dirty_list.first()->self());
 	}
@@ -3843,6 +4295,7 @@ void RenderForwardClustered::geometry_instance_free(RenderGeometryInstance *p_ge
 	if (ginstance->lightmap_sh != nullptr) {
 		geometry_instance_lightmap_sh.free(ginstance->lightmap_sh);
 	}
+	_geometry_instance_free_gpu_cull(ginstance);
 	GeometryInstanceSurfaceDataCache *surf = ginstance->surface_caches;
 	while (surf) {
 		GeometryInstanceSurfaceDataCache *next = surf->next;
@@ -3978,6 +4431,19 @@ RenderForwardClustered::RenderForwardClustered() {
 
 	render_list_thread_threshold = GLOBAL_GET("rendering/limits/forward_renderer/threaded_render_minimum_instances");
 
+	/* GPU culling */
+	{
+		Vector<String> cull_modes;
+		cull_modes.push_back("");
+		gpu_cull.shader.initialize(cull_modes);
+		gpu_cull.shader_version = gpu_cull.shader.version_create();
+		gpu_cull.shader_rd = gpu_cull.shader.version_get_shader(gpu_cull.shader_version, 0);
+		gpu_cull.pipeline = RD::get_singleton()->compute_pipeline_create(gpu_cull.shader_rd);
+
+		gpu_cull.enabled = GLOBAL_GET("rendering/gpu_culling/enabled");
+		gpu_cull.minimum_instances = MAX(1, int(GLOBAL_GET("rendering/gpu_culling/multimesh_minimum_instances")));
+	}
+
 	_update_shader_quality_settings();
 
 	resolve_effects = memnew(RendererRD::Resolve());
@@ -4004,6 +4470,14 @@ RenderForwardClustered::~RenderForwardClustered() {
 	RD::get_singleton()->free(shadow_sampler);
 	RSG::light_storage->directional_shadow_atlas_set_size(0);
 
+	if (gpu_cull.item_buffer.is_valid()) {
+		RD::get_singleton()->free(gpu_cull.item_buffer);
+	}
+	if (gpu_cull.command_buffer.is_valid()) {
+		RD::get_singleton()->free(gpu_cull.command_buffer);
+	}
+	gpu_cull.shader.version_free(gpu_cull.shader_version);
+
 	{
 		for (const RID &rid : scene_state.uniform_buffers) {
 			RD::get_singleton()->free(rid);
@@ -31,6 +31,7 @@
 #ifndef RENDER_FORWARD_CLUSTERED_H
 #define RENDER_FORWARD_CLUSTERED_H
 
+#include "core/templates/hash_map.h"
 #include "core/templates/paged_allocator.h"
 #include "servers/rendering/renderer_rd/cluster_builder_rd.h"
 #include "servers/rendering/renderer_rd/effects/resolve.h"
@@ -39,6 +40,7 @@
 #include "servers/rendering/renderer_rd/forward_clustered/scene_shader_forward_clustered.h"
 #include "servers/rendering/renderer_rd/pipeline_cache_rd.h"
 #include "servers/rendering/renderer_rd/renderer_scene_render_rd.h"
+#include "servers/rendering/renderer_rd/shaders/forward_clustered/multimesh_cull.glsl.gen.h"
 #include "servers/rendering/renderer_rd/shaders/forward_clustered/scene_forward_clustered.glsl.gen.h"
 #include "servers/rendering/renderer_rd/storage_rd/utilities.h"
 
@@ -199,6 +201,8 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 		uint32_t element_offset = 0;
 		uint32_t barrier = RD::BARRIER_MASK_ALL_BARRIERS;
 		bool use_directional_soft_shadow = false;
+		const uint32_t *gpu_cull_commands = nullptr; // Per element, GPU_CULL_COMMAND_NONE when drawn directly.
+		RID gpu_cull_command_buffer;
 
 		RenderListParameters(GeometryInstanceSurfaceDataCache **p_elements, RenderElementInfo *p_element_info, int p_element_count, bool p_reverse_cull, PassMode p_pass_mode, uint32_t p_color_pass_flags, bool p_no_gi, bool p_use_directional_soft_shadows, RID p_render_pass_uniform_set, bool p_force_wireframe = false, const Vector2 &p_uv_offset = Vector2(), float p_lod_distance_multiplier = 0.0, float p_screen_mesh_lod_threshold = 0.0, uint32_t p_view_count = 1, uint32_t p_element_offset = 0, uint32_t p_barrier = RD::BARRIER_MASK_ALL_BARRIERS) {
 			elements = p_elements;
@@ -338,6 +342,10 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 			RD::InitialAction initial_depth_action;
 			RD::FinalAction final_depth_action;
 			Rect2i rect;
+
+			RID atlas_texture;
+			RID static_cache_restore; // Copied into the rect before the pass.
+			RID static_cache_store; // Copied from the rect after the pass.
 		};
 
 		LocalVector<ShadowPass> shadow_passes;
@@ -370,6 +378,8 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 	void _render_list_with_threads(RenderListParameters *p_params, RID p_framebuffer, RD::InitialAction p_initial_color_action, RD::FinalAction p_final_color_action, RD::InitialAction p_initial_depth_action, RD::FinalAction p_final_depth_action, const Vector<Color> &p_clear_color_values = Vector<Color>(), float p_clear_depth = 1.0, uint32_t p_clear_stencil = 0, const Rect2 &p_region = Rect2(), const Vector<RID> &p_storage_textures = Vector<RID>());
 
 	uint32_t render_list_thread_threshold = 500;
+	// Below this, recording a split costs more than it saves.
+	static const uint32_t RENDER_LIST_SPLIT_MIN_ELEMENTS = 128;
 
 	void _update_instance_data_buffer(RenderListType p_render_list);
 	void _fill_instance_data(RenderListType p_render_list, int *p_render_info = nullptr, uint32_t p_offset = 0, int32_t p_max_elements = -1, bool p_update_buffer = true);
@@ -454,6 +464,10 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 		RID transforms_uniform_set;
 		uint32_t instance_count = 0;
 		uint32_t trail_steps = 1;
+		uint64_t gpu_cull_pass = 0;
+		uint32_t gpu_cull_command_first = 0;
+		uint32_t gpu_cull_command_count = 0;
+		uint32_t gpu_cull_previous_offset = 0;
 		bool can_sdfgi = false;
 		bool using_projectors = false;
 		bool using_softshadows = false;
@@ -466,6 +480,11 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 		GeometryInstanceSurfaceDataCache *surface_caches = nullptr;
 		SelfList<GeometryInstanceForwardClustered> dirty_list_element;
 
+		// Compacted copy of the multimesh buffer written by the GPU culling pass.
+		RID gpu_cull_buffer;
+		RID gpu_cull_uniform_set;
+		RID gpu_cull_transforms_uniform_set;
+
 		GeometryInstanceForwardClustered() :
 				dirty_list_element(this) {}
 
@@ -503,10 +522,64 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 	struct RenderList {
 		LocalVector<GeometryInstanceSurfaceDataCache *> elements;
 		LocalVector<RenderElementInfo> element_info;
+		LocalVector<uint32_t> gpu_cull_commands;
+
+		struct InstancingKey {
+			uint64_t sort_key1 = 0;
+			uint64_t sort_key2 = 0;
+
+			bool operator==(const InstancingKey &p_key) const {
+				return sort_key1 == p_key.sort_key1 && sort_key2 == p_key.sort_key2;
+			}
+
+			static uint32_t hash(const InstancingKey &p_key) {
+				return hash_murmur3_one_64(p_key.sort_key2, hash_murmur3_one_64(p_key.sort_key1));
+			}
+		};
+
+		HashMap<InstancingKey, uint32_t, InstancingKey> instancing_depth_layers;
 
 		void clear() {
 			elements.clear();
 			element_info.clear();
+			gpu_cull_commands.clear();
+		}
+
+		// The depth layer sorts above geometry and material, so identical surfaces at different distances
+		// would be instanced once per layer. Move every surface that can be instanced into the nearest
+		// layer used by an identical one, so sorting by key keeps the whole group adjacent.
+		void merge_instancing_depth_layers(uint32_t p_from, uint32_t p_size) {
+			instancing_depth_layers.clear();
+
+			for (uint32_t i = p_from; i < p_from + p_size; i++) {
+				const GeometryInstanceSurfaceDataCache *surf = elements[i];
+				if (surf->owner->mesh_instance.is_valid() || (surf->owner->base_flags & INSTANCE_DATA_FLAG_MULTIMESH)) {
+					continue;
+				}
+				auto sort = surf->sort;
+				sort.depth_layer = 0;
+				InstancingKey key = { sort.sort_key1, sort.sort_key2 };
+				uint32_t *layer = instancing_depth_layers.getptr(key);
+				if (!layer) {
+					instancing_depth_layers.insert(key, surf->sort.depth_layer);
+				} else if (surf->sort.depth_layer < *layer) {
+					*layer = surf->sort.depth_layer;
+				}
+			}
+
+			if (instancing_depth_layers.size() == 0) {
+				return;
+			}
+
+			for (uint32_t i = p_from; i < p_from + p_size; i++) {
+				GeometryInstanceSurfaceDataCache *surf = elements[i];
+				if (surf->owner->mesh_instance.is_valid() || (surf->owner->base_flags & INSTANCE_DATA_FLAG_MULTIMESH)) {
+					continue;
+				}
+				auto sort = surf->sort;
+				sort.depth_layer = 0;
+				surf->sort.depth_layer = instancing_depth_layers[InstancingKey{ sort.sort_key1, sort.sort_key2 }];
+			}
 		}
 
 		//should eventually be replaced by radix
@@ -566,6 +639,65 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 	RendererRD::TAA *taa = nullptr;
 	RendererRD::SSEffects *ss_effects = nullptr;
 
+	/* GPU culling */
+
+	enum {
+		GPU_CULL_COMMAND_NONE = 0xFFFFFFFF,
+		GPU_CULL_COMMAND_SIZE = 5, // Matches an indexed indirect draw command, non-indexed draws ignore the last field.
+		GPU_CULL_BUFFER_MIN_SIZE = 64,
+	};
+
+	struct GPUCull {
+		struct Item {
+			float planes[6][4];
+
+			float aabb_position[3];
+			uint32_t instance_count;
+
+			float aabb_size[3];
+			uint32_t stride;
+
+			uint32_t current_offset;
+			uint32_t previous_offset;
+			uint32_t command_first;
+			uint32_t command_count;
+
+			uint32_t motion_vectors;
+			uint32_t sphere_bounds; // Bounds ignore the instance rotation and scale (at least 1), so billboards are never culled.
+			uint32_t pad[2];
+		};
+
+		struct PushConstant {
+			uint32_t item;
+			uint32_t pad[3];
+		};
+
+		MultimeshCullShaderRD shader;
+		RID shader_version;
+		RID shader_rd;
+		RID pipeline;
+
+		bool enabled = false;
+		uint32_t minimum_instances = 256;
+		uint64_t pass = 0;
+
+		LocalVector<GeometryInstanceForwardClustered *> instances;
+		LocalVector<Item> items;
+		LocalVector<uint32_t> commands;
+
+		RID item_buffer;
+		uint32_t item_buffer_size = 0;
+		RID command_buffer;
+		uint32_t command_buffer_size = 0;
+		RID uniform_set;
+	} gpu_cull;
+
+	bool _geometry_instance_can_gpu_cull(GeometryInstanceForwardClustered *p_instance) const;
+	void _geometry_instance_get_gpu_cull_source(GeometryInstanceForwardClustered *p_instance, RID &r_buffer, uint32_t &r_stride, bool &r_motion_vectors) const;
+	bool _geometry_instance_setup_gpu_cull(GeometryInstanceForwardClustered *p_instance);
+	void _geometry_instance_free_gpu_cull(GeometryInstanceForwardClustered *p_instance);
+	void _gpu_cull_instances(const RenderDataRD *p_render_data);
+
 	/* Cluster builder */
 
 	ClusterBuilderSharedDataRD cluster_builder_shared;
@@ -581,7 +713,7 @@ class RenderForwardClustered : public RendererSceneRenderRD {
 
 	/* Render shadows */
 
-	void _render_shadow_pass(RID p_light, RID p_shadow_atlas, int p_pass, const PagedArray<RenderGeometryInstance *> &p_instances, const Plane &p_camera_plane = Plane(), float p_lod_distance_multiplier = 0, float p_screen_mesh_lod_threshold = 0.0, bool p_open_pass = true, bool p_close_pass = true, bool p_clear_region = true, RenderingMethod::RenderInfo *p_render_info = nullptr);
+	void _render_shadow_pass(RID p_light, RID p_shadow_atlas, int p_pass, const PagedArray<RenderGeometryInstance *> &p_instances, const Plane &p_camera_plane = Plane(), float p_lod_distance_multiplier = 0, float p_screen_mesh_lod_threshold = 0.0, bool p_open_pass = true, bool p_close_pass = true, bool p_clear_region = true, const PagedArray<RenderGeometryInstance *> *p_dynamic_instances = nullptr, bool p_static_cache_dirty = false, RenderingMethod::RenderInfo *p_render_info = nullptr);
 	void _render_shadow_begin();
 	void _render_shadow_append(RID p_framebuffer, const PagedArray<RenderGeometryInstance *> &p_instances, const Projection &p_projection, const Transform3D &p_transform, float p_zfar, float p_bias, float p_normal_bias, bool p_reverse_cull_face, bool p_use_dp, bool p_use_dp_flip, bool p_use_pancake, const Plane &p_camera_plane = Plane(), float p_lod_distance_multiplier = 0.0, float p_screen_mesh_lod_threshold = 0.0, const Rect2i &p_rect = Rect2i(), bool p_flip_y = false, bool p_clear_region = true, bool p_begin = true, bool p_end = true, RenderingMethod::RenderInfo *p_render_info = nullptr);
 	void _render_shadow_process();
@@ -615,11 +747,12 @@ protected:
 
 	virtual void _render_scene(RenderDataRD *p_render_data, const Color &p_default_bg_color) override;
 	virtual void _render_buffers_debug_draw(const RenderDataRD *p_render_data) override;
+	virtual void _render_buffers_temporal_upscale(const RenderDataRD *p_render_data, const StringName &p_source_context, const StringName &p_source_name) override;
 
 	virtual void _render_material(const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, const PagedArray<RenderGeometryInstance *> &p_instances, RID p_framebuffer, const Rect2i &p_region, float p_exposure_normalization) override;
 	virtual void _render_uv2(const PagedArray<RenderGeometryInstance *> &p_instances, RID p_framebuffer, const Rect2i &p_region) override;
 	virtual void _render_sdfgi(Ref<RenderSceneBuffersRD> p_render_buffers, const Vector3i &p_from, const Vector3i &p_size, const AABB &p_bounds, const PagedArray<RenderGeometryInstance *> &p_instances, const RID &p_albedo_texture, const RID &p_emission_texture, const RID &p_emission_aniso_texture, const RID &p_geom_facing_texture, float p_exposure_normalization) override;
-	virtual void _render_particle_collider_heightfield(RID p_fb, const Transform3D &p_cam_transform, const Projection &p_cam_projection, const PagedArray<RenderGeometryInstance *> &p_instances) override;
+	virtual void _render_particle_collider_heightfield(RID p_fb, const Transform3D &p_cam_transform, const Projection &p_cam_projection, const PagedArray<RenderGeometryInstance *> &p_instances, const Rect2i &p_region = Rect2i()) override;
 
 public:
 	static RenderForwardClustered *get_singleton() { return singleton; }
@@ -633,6 +766,9 @@ public:
 	virtual void setup_added_decal(const Transform3D &p_transform, const Vector3 &p_half_size) override;
 
 	virtual void base_uniforms_changed() override;
+
+	virtual bool is_static_shadow_cache_supported() const override { return true; }
+
 	_FORCE_INLINE_ virtual void update_uniform_sets() override {
 		base_uniform_set_updated = true;
 		_update_render_base_uniform_set();
@@ -45,6 +45,14 @@ void SceneShaderForwardClustered::ShaderData::set_code(const String &p_code) {
 	ubo_size = 0;
 	uniforms.clear();
 
+	compiling = false;
+	if (async_compile_element.in_list()) {
+		async_compile_element.remove_from_list();
+	}
+	while (compile_waiting_materials.first()) {
+		compile_waiting_materials.remove(compile_waiting_materials.first()); // Materials get updated after the code is set anyway.
+	}
+
 	if (code.is_empty()) {
 		return; //just invalid, but no error
 	}
@@ -168,7 +176,9 @@ void SceneShaderForwardClustered::ShaderData::set_code(const String &p_code) {
 	print_line("\n**fragment_globals:\n" + gen_code.stage_globals[ShaderCompiler::STAGE_FRAGMENT]);
 #endif
 	shader_singleton->shader.version_set_code(version, gen_code.code, gen_code.uniforms, gen_code.stage_globals[ShaderCompiler::STAGE_VERTEX], gen_code.stage_globals[ShaderCompiler::STAGE_FRAGMENT], gen_code.defines);
-	ERR_FAIL_COND(!shader_singleton->shader.version_is_valid(version));
+	// When compiling asynchronously, the pipelines below are set up with placeholder shaders that get filled in later.
+	compiling = shader_singleton->shader.is_async_compilation_enabled();
+	ERR_FAIL_COND(!compiling && !shader_singleton->shader.version_is_valid(version));
 
 	ubo_size = gen_code.uniform_total_size;
 	ubo_offsets = gen_code.uniform_offsets;
@@ -360,6 +370,7 @@ void SceneShaderForwardClustered::ShaderData::set_code(const String &p_code) {
 
 						RID shader_variant = shader_singleton->shader.version_get_shader(version, variant);
 						color_pipelines[i][j][l].setup(shader_variant, primitive_rd, raster_state, multisample_state, depth_stencil, blend_state, 0, singleton->default_specialization_constants);
+						color_pipelines[i][j][l].set_async_compilation(shader_singleton->pipeline_compilation_mode != PIPELINE_COMPILATION_MODE_SYNCHRONOUS);
 					}
 				} else {
 					RD::PipelineColorBlendState blend_state;
@@ -380,11 +391,17 @@ void SceneShaderForwardClustered::ShaderData::set_code(const String &p_code) {
 
 					RID shader_variant = shader_singleton->shader.version_get_shader(version, shader_version);
 					pipelines[i][j][k].setup(shader_variant, primitive_rd, raster_state, multisample_state, depth_stencil, blend_state, 0, singleton->default_specialization_constants);
+					pipelines[i][j][k].set_async_compilation(shader_singleton->pipeline_compilation_mode != PIPELINE_COMPILATION_MODE_SYNCHRONOUS);
 				}
 			}
 		}
 	}
 
+	if (compiling) {
+		shader_singleton->shader.version_compile_async(version, compile_priority);
+		shader_singleton->async_compile_list.add(&async_compile_element);
+	}
+
 	valid = true;
 }
 
@@ -407,10 +424,15 @@ RS::ShaderNativeSourceCode SceneShaderForwardClustered::ShaderData::get_native_s
 }
 
 SceneShaderForwardClustered::ShaderData::ShaderData() :
+		async_compile_element(this),
 		shader_list_element(this) {
 }
 
 SceneShaderForwardClustered::ShaderData::~ShaderData() {
+	while (compile_waiting_materials.first()) {
+		compile_waiting_materials.remove(compile_waiting_materials.first());
+	}
+
 	SceneShaderForwardClustered *shader_singleton = (SceneShaderForwardClustered *)SceneShaderForwardClustered::singleton;
 	ERR_FAIL_COND(!shader_singleton);
 	//pipeline variants will clear themselves if shader is gone
@@ -436,9 +458,21 @@ void SceneShaderForwardClustered::MaterialData::set_next_pass(RID p_pass) {
 bool SceneShaderForwardClustered::MaterialData::update_parameters(const HashMap<StringName, Variant> &p_parameters, bool p_uniform_dirty, bool p_textures_dirty) {
 	SceneShaderForwardClustered *shader_singleton = (SceneShaderForwardClustered *)SceneShaderForwardClustered::singleton;
 
+	if (shader_data->compiling) {
+		// The uniform set needs the compiled shader, update_async_shaders() queues the material again once it's ready.
+		if (!compile_wait_element.in_list()) {
+			shader_data->compile_waiting_materials.add(&compile_wait_element);
+		}
+		return false;
+	}
+
 	return update_parameters_uniform_set(p_parameters, p_uniform_dirty, p_textures_dirty, shader_data->uniforms, shader_data->ubo_offsets.ptr(), shader_data->texture_uniforms, shader_data->default_texture_params, shader_data->ubo_size, uniform_set, shader_singleton->shader.version_get_shader(shader_data->version, 0), RenderForwardClustered::MATERIAL_UNIFORM_SET, true, true, RD::BARRIER_MASK_RASTER);
 }
 
+SceneShaderForwardClustered::MaterialData::MaterialData() :
+		compile_wait_element(this) {
+}
+
 SceneShaderForwardClustered::MaterialData::~MaterialData() {
 	free_parameters_uniform_set(uniform_set);
 }
@@ -475,6 +509,8 @@ SceneShaderForwardClustered::~SceneShaderForwardClustered() {
 void SceneShaderForwardClustered::init(const String p_defines) {
 	RendererRD::MaterialStorage *material_storage = RendererRD::MaterialStorage::get_singleton();
 
+	pipeline_compilation_mode = PipelineCompilationMode(int(GLOBAL_GET("rendering/shader_compiler/async_pipeline_compilation")));
+
 	{
 		Vector<ShaderRD::VariantDefine> shader_versions;
 		shader_versions.push_back(ShaderRD::VariantDefine(SHADER_GROUP_BASE, "\n#define MODE_RENDER_DEPTH\n", true)); // SHADER_VERSION_DEPTH_PASS
@@ -814,6 +850,10 @@ void fragment() {
 
 		default_vec4_xform_uniform_set = RD::get_singleton()->uniform_set_create(uniforms, default_shader_rd, RenderForwardClustered::TRANSFORMS_UNIFORM_SET);
 	}
+
+	// Built-in materials above are needed right away, only user materials are compiled in the background.
+	shader.set_async_compilation(GLOBAL_GET("rendering/shader_compiler/async_shader_compilation"));
+
 	{
 		RD::SamplerState sampler;
 		sampler.mag_filter = RD::SAMPLER_FILTER_LINEAR;
@@ -824,6 +864,46 @@ void fragment() {
 	}
 }
 
+void SceneShaderForwardClustered::update_async_shaders() {
+	if (!async_compile_list.first()) {
+		return;
+	}
+
+	RendererRD::MaterialStorage *material_storage = RendererRD::MaterialStorage::get_singleton();
+	bool materials_queued = false;
+
+	SelfList<ShaderData> *E = async_compile_list.first();
+	while (E) {
+		SelfList<ShaderData> *N = E->next();
+		ShaderData *shader_data = E->self();
+
+		if (shader.version_is_compiling(shader_data->version)) {
+			shader.version_set_compilation_priority(shader_data->version, shader_data->compile_priority);
+		} else {
+			shader_data->compiling = false;
+			if (!shader.version_is_valid(shader_data->version)) {
+				shader_data->valid = false; // Materials fall back to the default one.
+			}
+			while (shader_data->compile_waiting_materials.first()) {
+				MaterialData *material_data = shader_data->compile_waiting_materials.first()->self();
+				shader_data->compile_waiting_materials.remove(&material_data->compile_wait_element);
+				material_storage->material_data_queue_update(material_data);
+				materials_queued = true;
+			}
+			async_compile_list.remove(E);
+		}
+
+		E = N;
+	}
+
+	shader.collect_async_compilations();
+
+	if (materials_queued) {
+		// Their uniform sets must exist before the surfaces using them are drawn this frame.
+		material_storage->_update_queued_materials();
+	}
+}
+
 void SceneShaderForwardClustered::set_default_specialization_constants(const Vector<RD::PipelineSpecializationConstant> &p_constants) {
 	default_specialization_constants = p_constants;
 	for (SelfList<ShaderData> *E = shader_list.first(); E; E = E->next()) {
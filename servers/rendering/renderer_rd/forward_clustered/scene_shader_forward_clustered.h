@@ -100,6 +100,14 @@ public:
 		SHADER_SPECIALIZATION_DIRECTIONAL_SOFT_SHADOWS = 1 << 3,
 	};
 
+	enum PipelineCompilationMode {
+		PIPELINE_COMPILATION_MODE_SYNCHRONOUS,
+		PIPELINE_COMPILATION_MODE_ASYNC_SKIP_DRAW, // Don't draw until the pipeline is ready.
+		PIPELINE_COMPILATION_MODE_ASYNC_UNSPECIALIZED_FALLBACK, // Draw with the pipeline without bool specializations until then, if ready.
+	};
+
+	struct MaterialData;
+
 	struct ShaderData : public RendererRD::MaterialStorage::ShaderData {
 		enum BlendMode { //used internally
 			BLEND_MODE_MIX,
@@ -186,6 +194,12 @@ public:
 		uint64_t last_pass = 0;
 		uint32_t index = 0;
 
+		// The GPU shader is being compiled asynchronously, surfaces using it can't be drawn until it's done.
+		bool compiling = false;
+		float compile_priority = 0.0;
+		SelfList<ShaderData> async_compile_element;
+		SelfList<MaterialData>::List compile_waiting_materials;
+
 		virtual void set_code(const String &p_Code);
 
 		virtual bool is_animated() const;
@@ -214,6 +228,8 @@ public:
 		virtual void set_render_priority(int p_priority);
 		virtual void set_next_pass(RID p_pass);
 		virtual bool update_parameters(const HashMap<StringName, Variant> &p_parameters, bool p_uniform_dirty, bool p_textures_dirty);
+		SelfList<MaterialData> compile_wait_element;
+		MaterialData();
 		virtual ~MaterialData();
 	};
 
@@ -250,6 +266,11 @@ public:
 
 	Vector<RD::PipelineSpecializationConstant> default_specialization_constants;
 	bool valid_color_pass_pipelines[PIPELINE_COLOR_PASS_FLAG_COUNT];
+	PipelineCompilationMode pipeline_compilation_mode = PIPELINE_COMPILATION_MODE_SYNCHRONOUS;
+
+	SelfList<ShaderData>::List async_compile_list;
+	void update_async_shaders();
+
 	SceneShaderForwardClustered();
 	~SceneShaderForwardClustered();
 
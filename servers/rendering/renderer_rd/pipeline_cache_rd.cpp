@@ -32,16 +32,32 @@
 
 #include "core/os/memory.h"
 
+void PipelineCacheRD::_compile(void *p_compilation) {
+	Compilation *compilation = static_cast<Compilation *>(p_compilation);
+	compilation->pipeline = RD::get_singleton()->render_pipeline_create(compilation->shader, compilation->framebuffer_id, compilation->vertex_id, compilation->render_primitive, compilation->rasterization_state, compilation->multisample_state, compilation->depth_stencil_state, compilation->blend_state, compilation->dynamic_state_flags, compilation->render_pass, compilation->specialization_constants);
+}
+
 RID PipelineCacheRD::_generate_version(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations) {
-	RD::PipelineMultisampleState multisample_state_version = multisample_state;
-	multisample_state_version.sample_count = RD::get_singleton()->framebuffer_format_get_texture_samples(p_framebuffer_format_id, p_render_pass);
+	Compilation *compilation = memnew(Compilation);
+	compilation->shader = shader;
+	compilation->framebuffer_id = p_framebuffer_format_id;
+	compilation->vertex_id = p_vertex_format_id;
+	compilation->render_primitive = render_primitive;
+	compilation->depth_stencil_state = depth_stencil_state;
+	compilation->blend_state = blend_state;
+	compilation->dynamic_state_flags = dynamic_state_flags;
+	compilation->render_pass = p_render_pass;
+
+	compilation->multisample_state = multisample_state;
+	compilation->multisample_state.sample_count = RD::get_singleton()->framebuffer_format_get_texture_samples(p_framebuffer_format_id, p_render_pass);
 
 	bool wireframe = p_wireframe;
 
-	RD::PipelineRasterizationState raster_state_version = rasterization_state;
-	raster_state_version.wireframe = wireframe;
+	compilation->rasterization_state = rasterization_state;
+	compilation->rasterization_state.wireframe = wireframe;
 
-	Vector<RD::PipelineSpecializationConstant> specialization_constants = base_specialization_constants;
+	Vector<RD::PipelineSpecializationConstant> &specialization_constants = compilation->specialization_constants;
+	specialization_constants = base_specialization_constants;
 
 	uint32_t bool_index = 0;
 	uint32_t bool_specializations = p_bool_specializations;
@@ -57,8 +73,17 @@ RID PipelineCacheRD::_generate_version(RD::VertexFormatID p_vertex_format_id, RD
 		bool_index++;
 	}
 
-	RID pipeline = RD::get_singleton()->render_pipeline_create(shader, p_framebuffer_format_id, p_vertex_format_id, render_primitive, raster_state_version, multisample_state_version, depth_stencil_state, blend_state, dynamic_state_flags, p_render_pass, specialization_constants);
-	ERR_FAIL_COND_V(pipeline.is_null(), RID());
+	RID pipeline;
+	if (async_compilation) {
+		compilation->task_id = WorkerThreadPool::get_singleton()->add_native_task(&PipelineCacheRD::_compile, compilation, false, "PipelineCacheRD compilation");
+	} else {
+		_compile(compilation);
+		pipeline = compilation->pipeline;
+		memdelete(compilation);
+		compilation = nullptr;
+		ERR_FAIL_COND_V(pipeline.is_null(), RID());
+	}
+
 	versions = static_cast<Version *>(memrealloc(versions, sizeof(Version) * (version_count + 1)));
 	versions[version_count].framebuffer_id = p_framebuffer_format_id;
 	versions[version_count].vertex_id = p_vertex_format_id;
@@ -66,14 +91,31 @@ RID PipelineCacheRD::_generate_version(RD::VertexFormatID p_vertex_format_id, RD
 	versions[version_count].pipeline = pipeline;
 	versions[version_count].render_pass = p_render_pass;
 	versions[version_count].bool_specializations = p_bool_specializations;
+	versions[version_count].compilation = compilation;
 	version_count++;
 	return pipeline;
 }
 
+void PipelineCacheRD::_finish_compilation(Version &p_version, bool p_wait) {
+	Compilation *compilation = p_version.compilation;
+	if (!p_wait && !WorkerThreadPool::get_singleton()->is_task_completed(compilation->task_id)) {
+		return;
+	}
+
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(compilation->task_id);
+	// A failed compilation keeps an invalid pipeline, it's not retried.
+	p_version.pipeline = compilation->pipeline;
+	p_version.compilation = nullptr;
+	memdelete(compilation);
+}
+
 void PipelineCacheRD::_clear() {
 	// TODO: Clear should probably recompile all the variants already compiled instead to avoid stalls? Needs discussion.
 	if (versions) {
 		for (uint32_t i = 0; i < version_count; i++) {
+			if (versions[i].compilation) {
+				_finish_compilation(versions[i], true);
+			}
 			//shader may be gone, so this may not be valid
 			if (RD::get_singleton()->render_pipeline_is_valid(versions[i].pipeline)) {
 				RD::get_singleton()->free(versions[i].pipeline);
@@ -31,6 +31,7 @@
 #ifndef PIPELINE_CACHE_RD_H
 #define PIPELINE_CACHE_RD_H
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/spin_lock.h"
 #include "servers/rendering/rendering_device.h"
 
@@ -47,6 +48,25 @@ class PipelineCacheRD {
 	RD::PipelineColorBlendState blend_state;
 	int dynamic_state_flags = 0;
 	Vector<RD::PipelineSpecializationConstant> base_specialization_constants;
+	bool async_compilation = false;
+
+	// Everything needed to create a pipeline, so it can be done on a worker thread.
+	struct Compilation {
+		RID shader;
+		RD::FramebufferFormatID framebuffer_id;
+		RD::VertexFormatID vertex_id;
+		RD::RenderPrimitive render_primitive;
+		RD::PipelineRasterizationState rasterization_state;
+		RD::PipelineMultisampleState multisample_state;
+		RD::PipelineDepthStencilState depth_stencil_state;
+		RD::PipelineColorBlendState blend_state;
+		int dynamic_state_flags = 0;
+		uint32_t render_pass = 0;
+		Vector<RD::PipelineSpecializationConstant> specialization_constants;
+
+		RID pipeline;
+		WorkerThreadPool::TaskID task_id = WorkerThreadPool::INVALID_TASK_ID;
+	};
 
 	struct Version {
 		RD::VertexFormatID vertex_id;
@@ -55,12 +75,15 @@ class PipelineCacheRD {
 		bool wireframe;
 		uint32_t bool_specializations;
 		RID pipeline;
+		Compilation *compilation; // Pending asynchronous compilation, pipeline is invalid until it's done.
 	};
 
 	Version *versions = nullptr;
 	uint32_t version_count;
 
+	static void _compile(void *p_compilation);
 	RID _generate_version(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe, uint32_t p_render_pass, uint32_t p_bool_specializations = 0);
+	void _finish_compilation(Version &p_version, bool p_wait);
 
 	void _clear();
 
@@ -69,6 +92,11 @@ public:
 	void update_specialization_constants(const Vector<RD::PipelineSpecializationConstant> &p_base_specialization_constants);
 	void update_shader(RID p_shader);
 
+	// If enabled, new versions are compiled on the WorkerThreadPool and get_render_pipeline()
+	// returns an invalid RID for them until they are ready, so the caller can skip the draw or fall back.
+	void set_async_compilation(bool p_enable) { async_compilation = p_enable; }
+	bool is_async_compilation_enabled() const { return async_compilation; }
+
 	_FORCE_INLINE_ RID get_render_pipeline(RD::VertexFormatID p_vertex_format_id, RD::FramebufferFormatID p_framebuffer_format_id, bool p_wireframe = false, uint32_t p_render_pass = 0, uint32_t p_bool_specializations = 0) {
 #ifdef DEBUG_ENABLED
 		ERR_FAIL_COND_V_MSG(shader.is_null(), RID(),
@@ -81,6 +109,9 @@ public:
 		RID result;
 		for (uint32_t i = 0; i < version_count; i++) {
 			if (versions[i].vertex_id == p_vertex_format_id && versions[i].framebuffer_id == p_framebuffer_format_id && versions[i].wireframe == p_wireframe && versions[i].render_pass == p_render_pass && versions[i].bool_specializations == p_bool_specializations) {
+				if (unlikely(versions[i].compilation)) {
+					_finish_compilation(versions[i], false);
+				}
 				result = versions[i].pipeline;
 				spin_lock.unlock();
 				return result;
@@ -348,7 +348,184 @@ void RendererCanvasRenderRD::free_polygon(PolygonID p_polygon) {
 
 ////////////////////
 
-void RendererCanvasRenderRD::_bind_canvas_texture(RD::DrawListID p_draw_list, RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, RID &r_last_texture, PushConstant &push_constant, Size2 &r_texpixel_size, bool p_texture_is_data) {
+void RendererCanvasRenderRD::DrawRecorder::clear() {
+	ops.clear();
+	push_constants.clear();
+	instances.clear();
+
+	pipeline = RID();
+	for (uint32_t i = 0; i < 4; i++) {
+		uniform_sets[i] = RID();
+	}
+	vertex_array = RID();
+	index_array = RID();
+	blend_constants = Color();
+	blend_constants_set = false;
+	scissor_enabled = false;
+	scissor_rect = Rect2();
+}
+
+void RendererCanvasRenderRD::DrawRecorder::bind_render_pipeline(RID p_pipeline) {
+	if (pipeline == p_pipeline) {
+		return;
+	}
+	pipeline = p_pipeline;
+
+	Op op;
+	op.type = OP_BIND_RENDER_PIPELINE;
+	op.rid = p_pipeline;
+	ops.push_back(op);
+}
+
+void RendererCanvasRenderRD::DrawRecorder::bind_uniform_set(RID p_uniform_set, uint32_t p_index) {
+	ERR_FAIL_UNSIGNED_INDEX(p_index, 4);
+	if (uniform_sets[p_index] == p_uniform_set) {
+		return;
+	}
+	uniform_sets[p_index] = p_uniform_set;
+
+	Op op;
+	op.type = OP_BIND_UNIFORM_SET;
+	op.rid = p_uniform_set;
+	op.index = p_index;
+	ops.push_back(op);
+}
+
+void RendererCanvasRenderRD::DrawRecorder::bind_vertex_array(RID p_vertex_array) {
+	if (vertex_array == p_vertex_array) {
+		return;
+	}
+	vertex_array = p_vertex_array;
+
+	Op op;
+	op.type = OP_BIND_VERTEX_ARRAY;
+	op.rid = p_vertex_array;
+	ops.push_back(op);
+}
+
+void RendererCanvasRenderRD::DrawRecorder::bind_index_array(RID p_index_array) {
+	if (index_array == p_index_array) {
+		return;
+	}
+	index_array = p_index_array;
+
+	Op op;
+	op.type = OP_BIND_INDEX_ARRAY;
+	op.rid = p_index_array;
+	ops.push_back(op);
+}
+
+void RendererCanvasRenderRD::DrawRecorder::set_blend_constants(const Color &p_color) {
+	if (blend_constants_set && blend_constants == p_color) {
+		return;
+	}
+	blend_constants = p_color;
+	blend_constants_set = true;
+
+	Op op;
+	op.type = OP_SET_BLEND_CONSTANTS;
+	op.color = p_color;
+	ops.push_back(op);
+}
+
+void RendererCanvasRenderRD::DrawRecorder::set_push_constant(const PushConstant &p_push_constant) {
+	Op op;
+	op.type = OP_SET_PUSH_CONSTANT;
+	op.index = push_constants.size();
+	ops.push_back(op);
+	push_constants.push_back(p_push_constant);
+}
+
+void RendererCanvasRenderRD::DrawRecorder::draw(bool p_use_indices, uint32_t p_instances) {
+	Op op;
+	op.type = OP_DRAW;
+	op.use_indices = p_use_indices;
+	op.count = p_instances;
+	ops.push_back(op);
+}
+
+void RendererCanvasRenderRD::DrawRecorder::draw_instance(const PushConstant &p_instance) {
+	// Anything that changed state since the previous instanced draw was recorded after it, so it can only be extended when it is the last op.
+	if (ops.size() > 0 && ops[ops.size() - 1].type == OP_DRAW_INSTANCES) {
+		ops[ops.size() - 1].count++;
+	} else {
+		Op op;
+		op.type = OP_DRAW_INSTANCES;
+		op.index = instances.size();
+		op.count = 1;
+		ops.push_back(op);
+	}
+	instances.push_back(p_instance);
+}
+
+void RendererCanvasRenderRD::DrawRecorder::enable_scissor(const Rect2 &p_rect) {
+	if (scissor_enabled && scissor_rect == p_rect) {
+		return;
+	}
+	scissor_enabled = true;
+	scissor_rect = p_rect;
+
+	Op op;
+	op.type = OP_ENABLE_SCISSOR;
+	op.rect = p_rect;
+	ops.push_back(op);
+}
+
+void RendererCanvasRenderRD::DrawRecorder::disable_scissor() {
+	if (!scissor_enabled) {
+		return;
+	}
+	scissor_enabled = false;
+
+	Op op;
+	op.type = OP_DISABLE_SCISSOR;
+	ops.push_back(op);
+}
+
+void RendererCanvasRenderRD::DrawRecorder::replay(RD::DrawListID p_draw_list) const {
+	for (const Op &op : ops) {
+		switch (op.type) {
+			case OP_BIND_RENDER_PIPELINE: {
+				RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, op.rid);
+			} break;
+			case OP_BIND_UNIFORM_SET: {
+				RD::get_singleton()->draw_list_bind_uniform_set(p_draw_list, op.rid, op.index);
+			} break;
+			case OP_BIND_VERTEX_ARRAY: {
+				RD::get_singleton()->draw_list_bind_vertex_array(p_draw_list, op.rid);
+			} break;
+			case OP_BIND_INDEX_ARRAY: {
+				RD::get_singleton()->draw_list_bind_index_array(p_draw_list, op.rid);
+			} break;
+			case OP_SET_BLEND_CONSTANTS: {
+				RD::get_singleton()->draw_list_set_blend_constants(p_draw_list, op.color);
+			} break;
+			case OP_SET_PUSH_CONSTANT: {
+				RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constants[op.index], sizeof(PushConstant));
+			} break;
+			case OP_DRAW: {
+				RD::get_singleton()->draw_list_draw(p_draw_list, op.use_indices, op.count);
+			} break;
+			case OP_DRAW_INSTANCES: {
+				BatchPushConstant push_constant;
+				push_constant.base_instance = op.index;
+				push_constant.pad[0] = 0;
+				push_constant.pad[1] = 0;
+				push_constant.pad[2] = 0;
+				RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(BatchPushConstant));
+				RD::get_singleton()->draw_list_draw(p_draw_list, true, op.count);
+			} break;
+			case OP_ENABLE_SCISSOR: {
+				RD::get_singleton()->draw_list_enable_scissor(p_draw_list, op.rect);
+			} break;
+			case OP_DISABLE_SCISSOR: {
+				RD::get_singleton()->draw_list_disable_scissor(p_draw_list);
+			} break;
+		}
+	}
+}
+
+void RendererCanvasRenderRD::_bind_canvas_texture(RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, RID &r_last_texture, PushConstant &push_constant, Size2 &r_texpixel_size, bool p_texture_is_data) {
 	if (p_texture == RID()) {
 		p_texture = default_canvas_texture;
 	}
@@ -366,11 +543,11 @@ void RendererCanvasRenderRD::_bind_canvas_texture(RD::DrawListID p_draw_list, RI
 	bool success = RendererRD::TextureStorage::get_singleton()->canvas_texture_get_uniform_set(p_texture, p_base_filter, p_base_repeat, shader.default_version_rd_shader, CANVAS_TEXTURE_UNIFORM_SET, bool(push_constant.flags & FLAGS_CONVERT_ATTRIBUTES_TO_LINEAR), uniform_set, size, specular_shininess, use_normal, use_specular, p_texture_is_data);
 	//something odd happened
 	if (!success) {
-		_bind_canvas_texture(p_draw_list, default_canvas_texture, p_base_filter, p_base_repeat, r_last_texture, push_constant, r_texpixel_size);
+		_bind_canvas_texture(default_canvas_texture, p_base_filter, p_base_repeat, r_last_texture, push_constant, r_texpixel_size);
 		return;
 	}
 
-	RD::get_singleton()->draw_list_bind_uniform_set(p_draw_list, uniform_set, CANVAS_TEXTURE_UNIFORM_SET);
+	draw_recorder.bind_uniform_set(uniform_set, CANVAS_TEXTURE_UNIFORM_SET);
 
 	if (specular_shininess.a < 0.999) {
 		push_constant.flags |= FLAGS_DEFAULT_SPECULAR_MAP_USED;
@@ -398,7 +575,7 @@ void RendererCanvasRenderRD::_bind_canvas_texture(RD::DrawListID p_draw_list, RI
 	r_last_texture = p_texture;
 }
 
-void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_render_target, const Item *p_item, RD::FramebufferFormatID p_framebuffer_format, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, Light *p_lights, PipelineVariants *p_pipeline_variants, bool &r_sdf_used) {
+void RendererCanvasRenderRD::_render_item(RID p_render_target, const Item *p_item, RD::FramebufferFormatID p_framebuffer_format, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, Light *p_lights, PipelineVariants *p_pipeline_variants, bool &r_sdf_used) {
 	//create an empty push constant
 	RendererRD::TextureStorage *texture_storage = RendererRD::TextureStorage::get_singleton();
 	RendererRD::MeshStorage *mesh_storage = RendererRD::MeshStorage::get_singleton();
@@ -498,16 +675,16 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 				//bind pipeline
 				if (rect->flags & CANVAS_RECT_LCD) {
 					RID pipeline = pipeline_variants->variants[light_mode][PIPELINE_VARIANT_QUAD_LCD_BLEND].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
-					RD::get_singleton()->draw_list_set_blend_constants(p_draw_list, rect->modulate);
+					draw_recorder.bind_render_pipeline(pipeline);
+					draw_recorder.set_blend_constants(rect->modulate);
 				} else {
 					RID pipeline = pipeline_variants->variants[light_mode][PIPELINE_VARIANT_QUAD].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
+					draw_recorder.bind_render_pipeline(pipeline);
 				}
 
 				//bind textures
 
-				_bind_canvas_texture(p_draw_list, rect->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size, bool(rect->flags & CANVAS_RECT_MSDF));
+				_bind_canvas_texture(rect->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size, bool(rect->flags & CANVAS_RECT_MSDF));
 
 				Rect2 src_rect;
 				Rect2 dst_rect;
@@ -588,9 +765,8 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 				push_constant.dst_rect[2] = dst_rect.size.width;
 				push_constant.dst_rect[3] = dst_rect.size.height;
 
-				RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
-				RD::get_singleton()->draw_list_bind_index_array(p_draw_list, shader.quad_index_array);
-				RD::get_singleton()->draw_list_draw(p_draw_list, true);
+				draw_recorder.bind_index_array(shader.quad_index_array);
+				draw_recorder.draw_instance(push_constant);
 
 			} break;
 
@@ -600,12 +776,12 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 				//bind pipeline
 				{
 					RID pipeline = pipeline_variants->variants[light_mode][PIPELINE_VARIANT_NINEPATCH].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
+					draw_recorder.bind_render_pipeline(pipeline);
 				}
 
 				//bind textures
 
-				_bind_canvas_texture(p_draw_list, np->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
+				_bind_canvas_texture(np->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
 
 				Rect2 src_rect;
 				Rect2 dst_rect(np->rect.position.x, np->rect.position.y, np->rect.size.x, np->rect.size.y);
@@ -657,9 +833,8 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 				push_constant.ninepatch_margins[2] = np->margin[SIDE_RIGHT];
 				push_constant.ninepatch_margins[3] = np->margin[SIDE_BOTTOM];
 
-				RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
-				RD::get_singleton()->draw_list_bind_index_array(p_draw_list, shader.quad_index_array);
-				RD::get_singleton()->draw_list_draw(p_draw_list, true);
+				draw_recorder.bind_index_array(shader.quad_index_array);
+				draw_recorder.draw_instance(push_constant);
 
 				// Restore if overridden.
 				push_constant.color_texture_pixel_size[0] = texpixel_size.x;
@@ -676,17 +851,17 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					static const PipelineVariant variant[RS::PRIMITIVE_MAX] = { PIPELINE_VARIANT_ATTRIBUTE_POINTS, PIPELINE_VARIANT_ATTRIBUTE_LINES, PIPELINE_VARIANT_ATTRIBUTE_LINES_STRIP, PIPELINE_VARIANT_ATTRIBUTE_TRIANGLES, PIPELINE_VARIANT_ATTRIBUTE_TRIANGLE_STRIP };
 					ERR_CONTINUE(polygon->primitive < 0 || polygon->primitive >= RS::PRIMITIVE_MAX);
 					RID pipeline = pipeline_variants->variants[light_mode][variant[polygon->primitive]].get_render_pipeline(pb->vertex_format_id, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
+					draw_recorder.bind_render_pipeline(pipeline);
 				}
 
 				if (polygon->primitive == RS::PRIMITIVE_LINES) {
 					//not supported in most hardware, so pointless
-					//RD::get_singleton()->draw_list_set_line_width(p_draw_list, polygon->line_width);
+					//RD::get_singleton()->draw_list_set_line_width(draw_list, polygon->line_width);
 				}
 
 				//bind textures
 
-				_bind_canvas_texture(p_draw_list, polygon->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
+				_bind_canvas_texture(polygon->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
 
 				Color color = base_color;
 				if (use_linear_colors) {
@@ -704,12 +879,12 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					push_constant.ninepatch_margins[j] = 0;
 				}
 
-				RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
-				RD::get_singleton()->draw_list_bind_vertex_array(p_draw_list, pb->vertex_array);
+				draw_recorder.set_push_constant(push_constant);
+				draw_recorder.bind_vertex_array(pb->vertex_array);
 				if (pb->indices.is_valid()) {
-					RD::get_singleton()->draw_list_bind_index_array(p_draw_list, pb->indices);
+					draw_recorder.bind_index_array(pb->indices);
 				}
-				RD::get_singleton()->draw_list_draw(p_draw_list, pb->indices.is_valid());
+				draw_recorder.draw(pb->indices.is_valid());
 
 			} break;
 			case Item::Command::TYPE_PRIMITIVE: {
@@ -720,14 +895,14 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					static const PipelineVariant variant[4] = { PIPELINE_VARIANT_PRIMITIVE_POINTS, PIPELINE_VARIANT_PRIMITIVE_LINES, PIPELINE_VARIANT_PRIMITIVE_TRIANGLES, PIPELINE_VARIANT_PRIMITIVE_TRIANGLES };
 					ERR_CONTINUE(primitive->point_count == 0 || primitive->point_count > 4);
 					RID pipeline = pipeline_variants->variants[light_mode][variant[primitive->point_count - 1]].get_render_pipeline(RD::INVALID_ID, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
+					draw_recorder.bind_render_pipeline(pipeline);
 				}
 
 				//bind textures
 
-				_bind_canvas_texture(p_draw_list, primitive->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
+				_bind_canvas_texture(primitive->texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
 
-				RD::get_singleton()->draw_list_bind_index_array(p_draw_list, primitive_arrays.index_array[MIN(3u, primitive->point_count) - 1]);
+				draw_recorder.bind_index_array(primitive_arrays.index_array[MIN(3u, primitive->point_count) - 1]);
 
 				for (uint32_t j = 0; j < MIN(3u, primitive->point_count); j++) {
 					push_constant.points[j * 2 + 0] = primitive->points[j].x;
@@ -741,8 +916,8 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					push_constant.colors[j * 2 + 0] = (uint32_t(Math::make_half_float(col.g)) << 16) | Math::make_half_float(col.r);
 					push_constant.colors[j * 2 + 1] = (uint32_t(Math::make_half_float(col.a)) << 16) | Math::make_half_float(col.b);
 				}
-				RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
-				RD::get_singleton()->draw_list_draw(p_draw_list, true);
+				draw_recorder.set_push_constant(push_constant);
+				draw_recorder.draw(true);
 
 				if (primitive->point_count == 4) {
 					for (uint32_t j = 1; j < 3; j++) {
@@ -759,8 +934,8 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 						push_constant.colors[j * 2 + 1] = (uint32_t(Math::make_half_float(col.a)) << 16) | Math::make_half_float(col.b);
 					}
 
-					RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
-					RD::get_singleton()->draw_list_draw(p_draw_list, true);
+					draw_recorder.set_push_constant(push_constant);
+					draw_recorder.draw(true);
 				}
 
 			} break;
@@ -802,7 +977,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					}
 
 					RID uniform_set = mesh_storage->multimesh_get_2d_uniform_set(multimesh, shader.default_version_rd_shader, TRANSFORMS_UNIFORM_SET);
-					RD::get_singleton()->draw_list_bind_uniform_set(p_draw_list, uniform_set, TRANSFORMS_UNIFORM_SET);
+					draw_recorder.bind_uniform_set(uniform_set, TRANSFORMS_UNIFORM_SET);
 					push_constant.flags |= 1; //multimesh, trails disabled
 					if (mesh_storage->multimesh_uses_colors(multimesh)) {
 						push_constant.flags |= FLAGS_INSTANCING_HAS_COLORS;
@@ -829,7 +1004,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					instance_count = particles_storage->particles_get_amount(pt->particles, divisor);
 
 					RID uniform_set = particles_storage->particles_get_instance_buffer_uniform_set(pt->particles, shader.default_version_rd_shader, TRANSFORMS_UNIFORM_SET);
-					RD::get_singleton()->draw_list_bind_uniform_set(p_draw_list, uniform_set, TRANSFORMS_UNIFORM_SET);
+					draw_recorder.bind_uniform_set(uniform_set, TRANSFORMS_UNIFORM_SET);
 
 					push_constant.flags |= divisor;
 					instance_count /= divisor;
@@ -867,7 +1042,7 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					break;
 				}
 
-				_bind_canvas_texture(p_draw_list, texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
+				_bind_canvas_texture(texture, current_filter, current_repeat, last_texture, push_constant, texpixel_size);
 
 				uint32_t surf_count = mesh_storage->mesh_get_surface_count(mesh);
 				static const PipelineVariant variant[RS::PRIMITIVE_MAX] = { PIPELINE_VARIANT_ATTRIBUTE_POINTS, PIPELINE_VARIANT_ATTRIBUTE_LINES, PIPELINE_VARIANT_ATTRIBUTE_LINES_STRIP, PIPELINE_VARIANT_ATTRIBUTE_TRIANGLES, PIPELINE_VARIANT_ATTRIBUTE_TRIANGLE_STRIP };
@@ -906,18 +1081,18 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 					}
 
 					RID pipeline = pipeline_variants->variants[light_mode][variant[primitive]].get_render_pipeline(vertex_format, p_framebuffer_format);
-					RD::get_singleton()->draw_list_bind_render_pipeline(p_draw_list, pipeline);
+					draw_recorder.bind_render_pipeline(pipeline);
 
 					RID index_array = mesh_storage->mesh_surface_get_index_array(surface, 0);
 
 					if (index_array.is_valid()) {
-						RD::get_singleton()->draw_list_bind_index_array(p_draw_list, index_array);
+						draw_recorder.bind_index_array(index_array);
 					}
 
-					RD::get_singleton()->draw_list_bind_vertex_array(p_draw_list, vertex_array);
-					RD::get_singleton()->draw_list_set_push_constant(p_draw_list, &push_constant, sizeof(PushConstant));
+					draw_recorder.bind_vertex_array(vertex_array);
+					draw_recorder.set_push_constant(push_constant);
 
-					RD::get_singleton()->draw_list_draw(p_draw_list, index_array.is_valid(), instance_count);
+					draw_recorder.draw(index_array.is_valid(), instance_count);
 				}
 
 				for (int j = 0; j < 6; j++) {
@@ -935,10 +1110,10 @@ void RendererCanvasRenderRD::_render_item(RD::DrawListID p_draw_list, RID p_rend
 				if (current_clip) {
 					if (ci->ignore != reclip) {
 						if (ci->ignore) {
-							RD::get_singleton()->draw_list_disable_scissor(p_draw_list);
+							draw_recorder.disable_scissor();
 							reclip = true;
 						} else {
-							RD::get_singleton()->draw_list_enable_scissor(p_draw_list, current_clip->final_clip_rect);
+							draw_recorder.enable_scissor(current_clip->final_clip_rect);
 							reclip = false;
 						}
 					}
@@ -1037,6 +1212,14 @@ RID RendererCanvasRenderRD::_create_base_uniform_set(RID p_to_render_target, boo
 		uniforms.push_back(u);
 	}
 
+	{
+		RD::Uniform u;
+		u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+		u.binding = 8;
+		u.append_id(state.instance_buffer);
+		uniforms.push_back(u);
+	}
+
 	{
 		RD::Uniform u;
 		u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
@@ -1085,16 +1268,10 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 		fb_uniform_set = texture_storage->render_target_get_framebuffer_uniform_set(p_to_render_target);
 	}
 
-	if (fb_uniform_set.is_null() || !RD::get_singleton()->uniform_set_is_valid(fb_uniform_set)) {
-		fb_uniform_set = _create_base_uniform_set(p_to_render_target, p_to_backbuffer);
-	}
-
 	RD::FramebufferFormatID fb_format = RD::get_singleton()->framebuffer_get_format(framebuffer);
 
-	RD::DrawListID draw_list = RD::get_singleton()->draw_list_begin(framebuffer, clear ? RD::INITIAL_ACTION_CLEAR : RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_READ, RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_DISCARD, clear_colors);
-
-	RD::get_singleton()->draw_list_bind_uniform_set(draw_list, fb_uniform_set, BASE_UNIFORM_SET);
-	RD::get_singleton()->draw_list_bind_uniform_set(draw_list, state.default_transforms_uniform_set, TRANSFORMS_UNIFORM_SET);
+	draw_recorder.clear();
+	draw_recorder.bind_uniform_set(state.default_transforms_uniform_set, TRANSFORMS_UNIFORM_SET);
 
 	RID prev_material;
 
@@ -1108,10 +1285,10 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 
 			//setup clip
 			if (current_clip) {
-				RD::get_singleton()->draw_list_enable_scissor(draw_list, current_clip->final_clip_rect);
+				draw_recorder.enable_scissor(current_clip->final_clip_rect);
 
 			} else {
-				RD::get_singleton()->draw_list_disable_scissor(draw_list);
+				draw_recorder.disable_scissor();
 			}
 		}
 
@@ -1143,7 +1320,7 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 					// Update uniform set.
 					RID uniform_set = texture_storage->render_target_is_using_hdr(p_to_render_target) ? material_data->uniform_set : material_data->uniform_set_srgb;
 					if (uniform_set.is_valid() && RD::get_singleton()->uniform_set_is_valid(uniform_set)) { // Material may not have a uniform set.
-						RD::get_singleton()->draw_list_bind_uniform_set(draw_list, uniform_set, MATERIAL_UNIFORM_SET);
+						draw_recorder.bind_uniform_set(uniform_set, MATERIAL_UNIFORM_SET);
 						material_data->set_as_used();
 					}
 				} else {
@@ -1154,11 +1331,31 @@ void RendererCanvasRenderRD::_render_items(RID p_to_render_target, int p_item_co
 			}
 		}
 
-		_render_item(draw_list, p_to_render_target, ci, fb_format, canvas_transform_inverse, current_clip, p_lights, pipeline_variants, r_sdf_used);
+		_render_item(p_to_render_target, ci, fb_format, canvas_transform_inverse, current_clip, p_lights, pipeline_variants, r_sdf_used);
 
 		prev_material = material;
 	}
 
+	uint32_t instance_count = draw_recorder.instances.size();
+	if (instance_count > state.instance_buffer_size) {
+		// Freeing the buffer also frees the base uniform sets using it, they are recreated below.
+		RD::get_singleton()->free(state.instance_buffer);
+		state.instance_buffer_size = next_power_of_2(instance_count);
+		state.instance_buffer = RD::get_singleton()->storage_buffer_create(sizeof(PushConstant) * state.instance_buffer_size);
+	}
+	if (instance_count > 0) {
+		RD::get_singleton()->buffer_update(state.instance_buffer, 0, sizeof(PushConstant) * instance_count, draw_recorder.instances.ptr());
+	}
+
+	if (fb_uniform_set.is_null() || !RD::get_singleton()->uniform_set_is_valid(fb_uniform_set)) {
+		fb_uniform_set = _create_base_uniform_set(p_to_render_target, p_to_backbuffer);
+	}
+
+	RD::DrawListID draw_list = RD::get_singleton()->draw_list_begin(framebuffer, clear ? RD::INITIAL_ACTION_CLEAR : RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_READ, RD::INITIAL_ACTION_KEEP, RD::FINAL_ACTION_DISCARD, clear_colors);
+
+	RD::get_singleton()->draw_list_bind_uniform_set(draw_list, fb_uniform_set, BASE_UNIFORM_SET);
+	draw_recorder.replay(draw_list);
+
 	RD::get_singleton()->draw_list_end();
 }
 
@@ -1170,6 +1367,9 @@ void RendererCanvasRenderRD::canvas_render_items(RID p_to_render_target, Item *p
 	r_sdf_used = false;
 	int item_count = 0;
 
+	// Particles processed this frame may be drawn by these items.
+	RendererRD::ParticlesStorage::get_singleton()->sync_particles_update();
+
 	//setup canvas state uniforms if needed
 
 	Transform2D canvas_transform_inverse = p_canvas_transform.affine_inverse();
@@ -1583,6 +1783,7 @@ void RendererCanvasRenderRD::light_set_use_shadow(RID p_rid, bool p_enable) {
 	ERR_FAIL_COND(!cl);
 
 	cl->shadow.enabled = p_enable;
+	cl->shadow.cache_index = -1;
 }
 
 void RendererCanvasRenderRD::_update_shadow_atlas() {
@@ -1616,6 +1817,11 @@ void RendererCanvasRenderRD::_update_shadow_atlas() {
 		}
 
 		state.shadow_fb = RD::get_singleton()->framebuffer_create(fb_textures);
+
+		state.shadow_index_lights.resize(state.max_lights_per_render);
+		for (RID &light : state.shadow_index_lights) {
+			light = RID();
+		}
 	}
 }
 void RendererCanvasRenderRD::light_update_shadow(RID p_rid, int p_shadow_index, const Transform2D &p_light_xform, int p_light_mask, float p_near, float p_far, LightOccluderInstance *p_occluders) {
@@ -1626,6 +1832,47 @@ void RendererCanvasRenderRD::light_update_shadow(RID p_rid, int p_shadow_index,
 
 	cl->shadow.z_far = p_far;
 	cl->shadow.y_offset = float(p_shadow_index * 2 + 1) / float(state.max_lights_per_render * 2);
+
+	// Only the occluders reaching into the light radius can cast shadows.
+	Rect2 light_rect(-p_far, -p_far, p_far * 2.0, p_far * 2.0);
+	state.shadow_occluders.clear();
+	for (LightOccluderInstance *instance = p_occluders; instance; instance = instance->next) {
+		OccluderPolygon *co = occluder_polygon_owner.get_or_null(instance->occluder);
+		if (!co || co->index_array.is_null() || !(p_light_mask & instance->light_mask)) {
+			continue;
+		}
+
+		Transform2D modelview = p_light_xform * instance->xform_cache;
+		if (!light_rect.intersects_transformed(modelview, instance->aabb_cache)) {
+			continue;
+		}
+
+		ShadowCacheOccluder occluder;
+		occluder.polygon = instance->occluder;
+		occluder.shape_version = co->shape_version;
+		occluder.cull_mode = co->cull_mode;
+		occluder.modelview = modelview;
+		state.shadow_occluders.push_back(occluder);
+	}
+
+	// The row still holds this light's shadow if nothing moved relative to it since it was rendered.
+	bool cached = cl->shadow.cache_index == p_shadow_index && state.shadow_index_lights[p_shadow_index] == p_rid && Math::is_equal_approx(cl->shadow.cache_near, p_near) && Math::is_equal_approx(cl->shadow.cache_far, p_far) && cl->shadow.cache_occluders.size() == state.shadow_occluders.size();
+	for (uint32_t i = 0; cached && i < state.shadow_occluders.size(); i++) {
+		const ShadowCacheOccluder &a = cl->shadow.cache_occluders[i];
+		const ShadowCacheOccluder &b = state.shadow_occluders[i];
+		cached = a.polygon == b.polygon && a.shape_version == b.shape_version && a.cull_mode == b.cull_mode && a.modelview.is_equal_approx(b.modelview);
+	}
+
+	if (cached) {
+		return;
+	}
+
+	cl->shadow.cache_index = p_shadow_index;
+	cl->shadow.cache_near = p_near;
+	cl->shadow.cache_far = p_far;
+	cl->shadow.cache_occluders = state.shadow_occluders;
+	state.shadow_index_lights[p_shadow_index] = p_rid;
+
 	Vector<Color> cc;
 	cc.push_back(Color(p_far, p_far, p_far, 1.0));
 
@@ -1668,26 +1915,17 @@ void RendererCanvasRenderRD::light_update_shadow(RID p_rid, int p_shadow_index,
 		push_constant.z_far = p_far;
 		push_constant.pad = 0;
 
-		LightOccluderInstance *instance = p_occluders;
-
-		while (instance) {
-			OccluderPolygon *co = occluder_polygon_owner.get_or_null(instance->occluder);
-
-			if (!co || co->index_array.is_null() || !(p_light_mask & instance->light_mask)) {
-				instance = instance->next;
-				continue;
-			}
+		for (const ShadowCacheOccluder &occluder : state.shadow_occluders) {
+			OccluderPolygon *co = occluder_polygon_owner.get_or_null(occluder.polygon);
 
-			_update_transform_2d_to_mat2x4(p_light_xform * instance->xform_cache, push_constant.modelview);
+			_update_transform_2d_to_mat2x4(occluder.modelview, push_constant.modelview);
 
-			RD::get_singleton()->draw_list_bind_render_pipeline(draw_list, shadow_render.render_pipelines[co->cull_mode]);
+			RD::get_singleton()->draw_list_bind_render_pipeline(draw_list, shadow_render.render_pipelines[occluder.cull_mode]);
 			RD::get_singleton()->draw_list_bind_vertex_array(draw_list, co->vertex_array);
 			RD::get_singleton()->draw_list_bind_index_array(draw_list, co->index_array);
 			RD::get_singleton()->draw_list_set_push_constant(draw_list, &push_constant, sizeof(ShadowRenderPushConstant));
 
 			RD::get_singleton()->draw_list_draw(draw_list, true);
-
-			instance = instance->next;
 		}
 
 		RD::get_singleton()->draw_list_end();
@@ -1713,6 +1951,9 @@ void RendererCanvasRenderRD::light_update_directional_shadow(RID p_rid, int p_sh
 	cl->shadow.z_far = distance;
 	cl->shadow.y_offset = float(p_shadow_index * 2 + 1) / float(state.max_lights_per_render * 2);
 
+	// Overwrites whatever point light shadow was cached in this row.
+	state.shadow_index_lights[p_shadow_index] = RID();
+
 	Transform2D to_light_xform;
 
 	to_light_xform[2] = from_pos;
@@ -1851,6 +2092,8 @@ void RendererCanvasRenderRD::occluder_polygon_set_shape(RID p_occluder, const Ve
 	OccluderPolygon *oc = occluder_polygon_owner.get_or_null(p_occluder);
 	ERR_FAIL_COND(!oc);
 
+	oc->shape_version++;
+
 	Vector<Vector2> lines;
 
 	if (p_points.size()) {
@@ -2489,7 +2732,7 @@ RendererCanvasRenderRD::RendererCanvasRenderRD() {
 		actions.base_uniform_string = "material.";
 		actions.default_filter = ShaderLanguage::FILTER_LINEAR;
 		actions.default_repeat = ShaderLanguage::REPEAT_DISABLE;
-		actions.base_varying_index = 4;
+		actions.base_varying_index = 5;
 
 		actions.global_buffer_array_variable = "global_shader_uniforms.data";
 
@@ -2570,6 +2813,9 @@ RendererCanvasRenderRD::RendererCanvasRenderRD() {
 		state.canvas_state_buffer = RD::get_singleton()->uniform_buffer_create(sizeof(State::Buffer));
 		state.lights_uniform_buffer = RD::get_singleton()->uniform_buffer_create(sizeof(LightUniform) * state.max_lights_per_render);
 
+		state.instance_buffer_size = 1024; // Grows as needed.
+		state.instance_buffer = RD::get_singleton()->storage_buffer_create(sizeof(PushConstant) * state.instance_buffer_size);
+
 		RD::SamplerState shadow_sampler_state;
 		shadow_sampler_state.mag_filter = RD::SAMPLER_FILTER_LINEAR;
 		shadow_sampler_state.min_filter = RD::SAMPLER_FILTER_LINEAR;
@@ -2758,6 +3004,7 @@ RendererCanvasRenderRD::~RendererCanvasRenderRD() {
 
 		memdelete_arr(state.light_uniforms);
 		RD::get_singleton()->free(state.lights_uniform_buffer);
+		RD::get_singleton()->free(state.instance_buffer);
 	}
 
 	//shadow rendering
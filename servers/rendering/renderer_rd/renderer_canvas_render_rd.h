@@ -252,6 +252,14 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 	/**** LIGHTING ****/
 	/******************/
 
+	// Occluder as drawn into a point light shadow, relative to the light.
+	struct ShadowCacheOccluder {
+		RID polygon;
+		uint32_t shape_version = 0;
+		RS::CanvasOccluderPolygonCullMode cull_mode = RS::CANVAS_OCCLUDER_POLYGON_CULL_DISABLED;
+		Transform2D modelview;
+	};
+
 	struct CanvasLight {
 		RID texture;
 		struct {
@@ -259,6 +267,12 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 			float z_far;
 			float y_offset;
 			Transform2D directional_xform;
+
+			// Inputs of the last point light shadow render, which is skipped while they don't change.
+			int cache_index = -1;
+			float cache_near = 0.0;
+			float cache_far = 0.0;
+			LocalVector<ShadowCacheOccluder> cache_occluders;
 		} shadow;
 	};
 
@@ -287,6 +301,7 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 		RID sdf_index_buffer;
 		RID sdf_index_array;
 		bool sdf_is_lines;
+		uint32_t shape_version = 0;
 	};
 
 	struct LightUniform {
@@ -361,11 +376,15 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 
 		RID lights_uniform_buffer;
 		RID canvas_state_buffer;
+		RID instance_buffer;
+		uint32_t instance_buffer_size = 0; // In instances.
 		RID shadow_sampler;
 		RID shadow_texture;
 		RID shadow_depth_texture;
 		RID shadow_fb;
 		int shadow_texture_size = 2048;
+		LocalVector<RID> shadow_index_lights; // Point light last rendered in each row of the shadow texture.
+		LocalVector<ShadowCacheOccluder> shadow_occluders;
 
 		RID default_transforms_uniform_set;
 
@@ -403,6 +422,68 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 		uint32_t lights[4];
 	};
 
+	// Rects and nine-patches read their PushConstant from the instance buffer, starting at base_instance.
+	struct BatchPushConstant {
+		uint32_t base_instance;
+		uint32_t pad[3];
+	};
+
+	// Items are recorded before the draw list starts, so the instance data of rects and nine-patches can be uploaded
+	// first, and consecutive ones that share the same state are merged into a single instanced draw.
+	struct DrawRecorder {
+		enum OpType {
+			OP_BIND_RENDER_PIPELINE,
+			OP_BIND_UNIFORM_SET,
+			OP_BIND_VERTEX_ARRAY,
+			OP_BIND_INDEX_ARRAY,
+			OP_SET_BLEND_CONSTANTS,
+			OP_SET_PUSH_CONSTANT,
+			OP_DRAW,
+			OP_DRAW_INSTANCES,
+			OP_ENABLE_SCISSOR,
+			OP_DISABLE_SCISSOR,
+		};
+
+		struct Op {
+			OpType type;
+			uint32_t index = 0; // Uniform set index, push constant index or first instance.
+			uint32_t count = 0; // Instance count.
+			bool use_indices = false;
+			RID rid;
+			Rect2 rect;
+			Color color;
+		};
+
+		LocalVector<Op> ops;
+		LocalVector<PushConstant> push_constants;
+		LocalVector<PushConstant> instances;
+
+		// Currently bound state, redundant binds are skipped so they don't split batches.
+		RID pipeline;
+		RID uniform_sets[4];
+		RID vertex_array;
+		RID index_array;
+		Color blend_constants;
+		bool blend_constants_set = false;
+		bool scissor_enabled = false;
+		Rect2 scissor_rect;
+
+		void clear();
+
+		void bind_render_pipeline(RID p_pipeline);
+		void bind_uniform_set(RID p_uniform_set, uint32_t p_index);
+		void bind_vertex_array(RID p_vertex_array);
+		void bind_index_array(RID p_index_array);
+		void set_blend_constants(const Color &p_color);
+		void set_push_constant(const PushConstant &p_push_constant);
+		void draw(bool p_use_indices, uint32_t p_instances = 1);
+		void draw_instance(const PushConstant &p_instance);
+		void enable_scissor(const Rect2 &p_rect);
+		void disable_scissor();
+
+		void replay(RD::DrawListID p_draw_list) const;
+	} draw_recorder;
+
 	Item *items[MAX_RENDER_ITEMS];
 
 	bool using_directional_lights = false;
@@ -418,8 +499,8 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 
 	RID _create_base_uniform_set(RID p_to_render_target, bool p_backbuffer);
 
-	inline void _bind_canvas_texture(RD::DrawListID p_draw_list, RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, RID &r_last_texture, PushConstant &push_constant, Size2 &r_texpixel_size, bool p_texture_is_data = false); //recursive, so regular inline used instead.
-	void _render_item(RenderingDevice::DrawListID p_draw_list, RID p_render_target, const Item *p_item, RenderingDevice::FramebufferFormatID p_framebuffer_format, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, Light *p_lights, PipelineVariants *p_pipeline_variants, bool &r_sdf_used);
+	inline void _bind_canvas_texture(RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, RID &r_last_texture, PushConstant &push_constant, Size2 &r_texpixel_size, bool p_texture_is_data = false); //recursive, so regular inline used instead.
+	void _render_item(RID p_render_target, const Item *p_item, RenderingDevice::FramebufferFormatID p_framebuffer_format, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, Light *p_lights, PipelineVariants *p_pipeline_variants, bool &r_sdf_used);
 	void _render_items(RID p_to_render_target, int p_item_count, const Transform2D &p_canvas_transform_inverse, Light *p_lights, bool &r_sdf_used, bool p_to_backbuffer = false);
 
 	_FORCE_INLINE_ void _update_transform_2d_to_mat2x4(const Transform2D &p_transform, float *p_mat2x4);
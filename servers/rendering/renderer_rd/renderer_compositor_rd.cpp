@@ -100,9 +100,16 @@ void RendererCompositorRD::begin_frame(double frame_step) {
 
 	canvas->set_time(time);
 	scene->set_time(time, frame_step);
+
+	texture_storage->update_texture_streaming();
+	mesh_storage->update_mesh_lod_streaming();
+	RenderSceneBuffersRD::update_transient_textures();
 }
 
 void RendererCompositorRD::end_frame(bool p_swap_buffers) {
+	// Last chance to update the XR views, all commands of the frame are recorded.
+	scene->late_latch_views();
+
 	// TODO: Likely pass a bool to swap buffers to avoid display?
 	RD::get_singleton()->swap_buffers();
 }
@@ -147,6 +154,7 @@ void RendererCompositorRD::initialize() {
 uint64_t RendererCompositorRD::frame = 1;
 
 void RendererCompositorRD::finalize() {
+	RenderSceneBuffersRD::free_transient_textures();
 	memdelete(scene);
 	memdelete(canvas);
 	memdelete(fog);
@@ -289,6 +297,7 @@ RendererCompositorRD::RendererCompositorRD() {
 					ShaderRD::set_shader_cache_save_compressed(compress);
 					ShaderRD::set_shader_cache_save_compressed_zstd(use_zstd);
 					ShaderRD::set_shader_cache_save_debug(!strip_debug);
+					ShaderCompiler::set_cache_dir(shader_cache_dir.path_join("shader_compiler"));
 				}
 			}
 		}
@@ -327,4 +336,5 @@ RendererCompositorRD::~RendererCompositorRD() {
 	memdelete(uniform_set_cache);
 	memdelete(framebuffer_cache);
 	ShaderRD::set_shader_cache_dir(String());
+	ShaderCompiler::set_cache_dir(String());
 }
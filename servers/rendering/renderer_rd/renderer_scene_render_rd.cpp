@@ -38,6 +38,7 @@
 #include "servers/rendering/renderer_rd/storage_rd/texture_storage.h"
 #include "servers/rendering/rendering_server_default.h"
 #include "servers/rendering/storage/camera_attributes_storage.h"
+#include "servers/xr_server.h"
 
 void get_vogel_disk(float *r_kernel, int p_sample_count) {
 	const float golden_angle = 2.4;
@@ -217,6 +218,7 @@ void RendererSceneRenderRD::voxel_gi_update(RID p_probe, bool p_update_light_ins
 		return;
 	}
 
+	RendererRD::ParticlesStorage::get_singleton()->sync_particles_update();
 	gi.voxel_gi_update(p_probe, p_update_light_instances, p_light_instances, p_dynamic_objects);
 }
 
@@ -345,6 +347,9 @@ void RendererSceneRenderRD::_render_buffers_post_process_and_tonemap(const Rende
 
 	bool can_use_effects = target_size.x >= 8 && target_size.y >= 8; // FIXME I think this should check internal size, we do all our post processing at this size...
 	bool can_use_storage = _render_buffers_can_be_storage();
+	bool use_fsr = fsr && can_use_effects && rb->get_scaling_3d_mode() == RS::VIEWPORT_SCALING_3D_MODE_FSR;
+	// The temporal upscaler accumulates the tonemapped, jittered frames, in the same place FSR 1.0 upscales them.
+	bool use_temporal_upscale = can_use_storage && can_use_effects && rb->get_scaling_3d_mode() == RS::VIEWPORT_SCALING_3D_MODE_TEMPORAL;
 
 	RID render_target = rb->get_render_target();
 	RID internal_texture = rb->get_internal_texture();
@@ -555,8 +560,8 @@ void RendererSceneRenderRD::_render_buffers_post_process_and_tonemap(const Rende
 		tonemap.convert_to_srgb = !texture_storage->render_target_is_using_hdr(render_target);
 
 		RID dest_fb;
-		if (fsr && can_use_effects && rb->get_scaling_3d_mode() == RS::VIEWPORT_SCALING_3D_MODE_FSR) {
-			// If we use FSR to upscale we need to write our result into an intermediate buffer.
+		if (use_fsr || use_temporal_upscale) {
+			// If we use FSR or the temporal upscaler we need to write our result into an intermediate buffer.
 			// Note that this is cached so we only create the texture the first time.
 			RID dest_texture = rb->create_texture(SNAME("Tonemapper"), SNAME("destination"), _render_buffers_get_color_format(), RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_STORAGE_BIT | RD::TEXTURE_USAGE_COLOR_ATTACHMENT_BIT);
 			dest_fb = FramebufferCacheRD::get_singleton()->get_cache(dest_texture);
@@ -572,7 +577,11 @@ void RendererSceneRenderRD::_render_buffers_post_process_and_tonemap(const Rende
 		RD::get_singleton()->draw_command_end_label();
 	}
 
-	if (fsr && can_use_effects && rb->get_scaling_3d_mode() == RS::VIEWPORT_SCALING_3D_MODE_FSR) {
+	if (use_temporal_upscale) {
+		_render_buffers_temporal_upscale(p_render_data, SNAME("Tonemapper"), SNAME("destination"));
+	}
+
+	if (use_fsr) {
 		RD::get_singleton()->draw_command_begin_label("FSR 1.0 Upscale");
 
 		for (uint32_t v = 0; v < rb->get_view_count(); v++) {
@@ -863,6 +872,10 @@ void RendererSceneRenderRD::directional_soft_shadow_filter_set_quality(RS::Shado
 	_update_shader_quality_settings();
 }
 
+bool RendererSceneRenderRD::is_static_shadow_cache_supported() const {
+	return false;
+}
+
 void RendererSceneRenderRD::decals_set_filter(RenderingServer::DecalFilter p_filter) {
 	if (decals_filter == p_filter) {
 		return;
@@ -969,6 +982,7 @@ void RendererSceneRenderRD::render_scene(const Ref<RenderSceneBuffers> &p_render
 		scene_data.cam_orthogonal = p_camera_data->is_orthogonal;
 		scene_data.camera_visible_layers = p_camera_data->visible_layers;
 		scene_data.taa_jitter = p_camera_data->taa_jitter;
+		scene_data.late_latch = p_camera_data->late_latch;
 
 		scene_data.view_count = p_camera_data->view_count;
 		for (uint32_t v = 0; v < p_camera_data->view_count; v++) {
@@ -1061,18 +1075,51 @@ void RendererSceneRenderRD::render_scene(const Ref<RenderSceneBuffers> &p_render
 		clear_color = RSG::texture_storage->get_default_clear_color();
 	}
 
+	// Particles processed this frame are drawn from here on.
+	RendererRD::ParticlesStorage::get_singleton()->sync_particles_update();
+
 	//calls _pre_opaque_render between depth pre-pass and opaque pass
 	_render_scene(&render_data, clear_color);
+
+	if (rb.is_valid()) {
+		// Hand our transient textures to the next viewport.
+		rb->release_transient_textures();
+	}
 }
 
 void RendererSceneRenderRD::render_material(const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal, const PagedArray<RenderGeometryInstance *> &p_instances, RID p_framebuffer, const Rect2i &p_region) {
+	RendererRD::ParticlesStorage::get_singleton()->sync_particles_update();
 	_render_material(p_cam_transform, p_cam_projection, p_cam_orthogonal, p_instances, p_framebuffer, p_region, 1.0);
 }
 
-void RendererSceneRenderRD::render_particle_collider_heightfield(RID p_collider, const Transform3D &p_transform, const PagedArray<RenderGeometryInstance *> &p_instances) {
+bool RendererSceneRenderRD::particle_collider_heightfield_scroll(RID p_collider, const Transform3D &p_transform, Vector<AABB> &r_dirty_regions) {
+	RendererRD::ParticlesStorage *particles_storage = RendererRD::ParticlesStorage::get_singleton();
+
+	r_dirty_regions.clear();
+
+	Vector<Rect2i> dirty_rects;
+	if (!particles_storage->particles_collision_heightfield_scroll(p_collider, p_transform, dirty_rects)) {
+		return false;
+	}
+
+	// Texel U maps to local X and V to local Z, across the whole height.
+	Vector3 extents = particles_storage->particles_collision_get_extents(p_collider);
+	Vector2 size = particles_storage->particles_collision_get_heightfield_size(p_collider);
+	for (const Rect2i &rect : dirty_rects) {
+		AABB region;
+		region.position = Vector3(rect.position.x / size.x * 2.0 - 1.0, -1.0, rect.position.y / size.y * 2.0 - 1.0) * extents;
+		region.size = Vector3(rect.size.x / size.x * 2.0, 2.0, rect.size.y / size.y * 2.0) * extents;
+		r_dirty_regions.push_back(region);
+	}
+
+	return true;
+}
+
+void RendererSceneRenderRD::render_particle_collider_heightfield(RID p_collider, const Transform3D &p_transform, const PagedArray<RenderGeometryInstance *> &p_instances, const AABB &p_region) {
 	RendererRD::ParticlesStorage *particles_storage = RendererRD::ParticlesStorage::get_singleton();
 
 	ERR_FAIL_COND(!particles_storage->particles_collision_is_heightfield(p_collider));
+	particles_storage->sync_particles_update();
 	Vector3 extents = particles_storage->particles_collision_get_extents(p_collider) * p_transform.basis.get_scale();
 	Projection cm;
 	cm.set_orthogonal(-extents.x, extents.x, -extents.z, extents.z, 0, extents.y * 2.0);
@@ -1085,7 +1132,54 @@ void RendererSceneRenderRD::render_particle_collider_heightfield(RID p_collider,
 
 	RID fb = particles_storage->particles_collision_get_heightfield_framebuffer(p_collider);
 
-	_render_particle_collider_heightfield(fb, cam_xform, cm, p_instances);
+	Rect2i region;
+	if (p_region.has_volume()) {
+		Vector3 local_extents = particles_storage->particles_collision_get_extents(p_collider);
+		Vector2 size = particles_storage->particles_collision_get_heightfield_size(p_collider);
+		Vector2 from = (Vector2(p_region.position.x / local_extents.x, p_region.position.z / local_extents.z) * 0.5 + Vector2(0.5, 0.5)) * size;
+		Vector2 to = (Vector2(p_region.get_end().x / local_extents.x, p_region.get_end().z / local_extents.z) * 0.5 + Vector2(0.5, 0.5)) * size;
+		region = Rect2i(from.round(), (to - from).round());
+	}
+
+	_render_particle_collider_heightfield(fb, cam_xform, cm, p_instances, region);
+}
+
+void RendererSceneRenderRD::late_latch_add(RID p_uniform_buffer, uint32_t p_offset, const Transform3D &p_cam_transform) {
+	float matrices[32];
+	RenderSceneDataRD::store_view_matrices(p_cam_transform, matrices, matrices + 16);
+
+	LateLatch late_latch;
+	late_latch.latch = RD::get_singleton()->buffer_update_late_latched(p_uniform_buffer, p_offset, sizeof(matrices), matrices, RD::BARRIER_MASK_RASTER);
+	late_latch.cam_transform = p_cam_transform;
+	if (late_latch.latch != 0) {
+		late_latches.push_back(late_latch);
+	}
+}
+
+void RendererSceneRenderRD::late_latch_views() {
+	if (late_latches.is_empty()) {
+		return;
+	}
+
+	// Either every view is corrected or none is, as the XR interface submits the new pose to the compositor.
+	bool valid = true;
+	for (const LateLatch &late_latch : late_latches) {
+		valid = valid && RD::get_singleton()->buffer_late_latch_is_valid(late_latch.latch);
+	}
+
+	XRServer *xr_server = XRServer::get_singleton();
+	Ref<XRInterface> xr_interface = xr_server ? xr_server->get_primary_interface() : Ref<XRInterface>();
+
+	Transform3D correction;
+	if (valid && xr_interface.is_valid() && xr_interface->get_late_latch_correction(correction)) {
+		for (const LateLatch &late_latch : late_latches) {
+			float matrices[32];
+			RenderSceneDataRD::store_view_matrices(correction * late_latch.cam_transform, matrices, matrices + 16);
+			RD::get_singleton()->buffer_late_latch_write(late_latch.latch, matrices);
+		}
+	}
+
+	late_latches.clear();
 }
 
 bool RendererSceneRenderRD::free(RID p_rid) {
@@ -1325,6 +1419,10 @@ void RendererSceneRenderRD::init() {
 	}
 	if (can_use_storage) {
 		fsr = memnew(RendererRD::FSR);
+		if (int(GLOBAL_GET("rendering/occlusion_culling/method")) == 1) {
+			// Replaces the raycast occlusion culling, which checks for this when it's initialized.
+			hiz_occlusion_cull = memnew(RendererRD::HiZOcclusionCull);
+		}
 	}
 }
 
@@ -1354,6 +1452,9 @@ RendererSceneRenderRD::~RendererSceneRenderRD() {
 	if (fsr) {
 		memdelete(fsr);
 	}
+	if (hiz_occlusion_cull) {
+		memdelete(hiz_occlusion_cull);
+	}
 
 	if (sky.sky_scene_state.uniform_set.is_valid() && RD::get_singleton()->uniform_set_is_valid(sky.sky_scene_state.uniform_set)) {
 		RD::get_singleton()->free(sky.sky_scene_state.uniform_set);
@@ -220,6 +220,15 @@ void ShaderRD::_build_variant_code(StringBuilder &builder, uint32_t p_variant, c
 	}
 }
 
+void ShaderRD::_free_variant_placeholder(uint32_t p_variant, const CompileData *p_data) {
+	// The variant must end up invalid when it fails, so the version is known to be invalid.
+	MutexLock lock(variant_set_mutex);
+	if (p_data->version->variants[p_variant].is_valid()) {
+		RD::get_singleton()->free(p_data->version->variants[p_variant]);
+		p_data->version->variants[p_variant] = RID();
+	}
+}
+
 void ShaderRD::_compile_variant(uint32_t p_variant, const CompileData *p_data) {
 	uint32_t variant = group_to_variant_map[p_data->group][p_variant];
 
@@ -296,12 +305,16 @@ void ShaderRD::_compile_variant(uint32_t p_variant, const CompileData *p_data) {
 #ifdef DEBUG_ENABLED
 		ERR_PRINT("code:\n" + current_source.get_with_code_lines());
 #endif
+		_free_variant_placeholder(variant, p_data);
 		return;
 	}
 
 	Vector<uint8_t> shader_data = RD::get_singleton()->shader_compile_binary_from_spirv(stages, name + ":" + itos(variant));
 
-	ERR_FAIL_COND(shader_data.size() == 0);
+	if (shader_data.size() == 0) {
+		_free_variant_placeholder(variant, p_data);
+		ERR_FAIL_MSG("Error compiling shader binary, variant #" + itos(variant) + ".");
+	}
 
 	{
 		MutexLock lock(variant_set_mutex);
@@ -492,7 +505,7 @@ void ShaderRD::_allocate_placeholders(Version *p_version, int p_group) {
 
 // Try to compile all variants for a given group.
 // Will skip variants that are disabled.
-void ShaderRD::_compile_version(Version *p_version, int p_group) {
+void ShaderRD::_compile_version(Version *p_version, int p_group, bool p_parallel) {
 	if (!group_enabled[p_group]) {
 		return;
 	}
@@ -512,15 +525,15 @@ void ShaderRD::_compile_version(Version *p_version, int p_group) {
 	compile_data.version = p_version;
 	compile_data.group = p_group;
 
-#if 1
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ShaderRD::_compile_variant, &compile_data, group_to_variant_map[p_group].size(), -1, true, SNAME("ShaderCompilation"));
-	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
-
-#else
-	for (uint32_t i = 0; i < group_to_variant_map[p_group].size(); i++) {
-		_compile_variant(i, &compile_data);
+	if (p_parallel) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ShaderRD::_compile_variant, &compile_data, group_to_variant_map[p_group].size(), -1, true, SNAME("ShaderCompilation"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		// Already on a worker thread, waiting for a group task there could starve the pool.
+		for (uint32_t i = 0; i < group_to_variant_map[p_group].size(); i++) {
+			_compile_variant(i, &compile_data);
+		}
 	}
-#endif
 
 	bool all_valid = true;
 
@@ -563,26 +576,72 @@ void ShaderRD::_compile_version(Version *p_version, int p_group) {
 	p_version->valid = true;
 }
 
+bool ShaderRD::_version_code_matches(const Version *p_version, const HashMap<StringName, CharString> &p_code_sections, const Vector<CharString> &p_custom_defines) {
+	if (p_version->code_sections.size() != p_code_sections.size() || p_version->custom_defines.size() != p_custom_defines.size()) {
+		return false;
+	}
+	for (const KeyValue<StringName, CharString> &E : p_code_sections) {
+		const CharString *code = p_version->code_sections.getptr(E.key);
+		if (!code || !(*code == E.value)) {
+			return false;
+		}
+	}
+	for (int i = 0; i < p_custom_defines.size(); i++) {
+		if (!(p_version->custom_defines[i] == p_custom_defines[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
 void ShaderRD::version_set_code(RID p_version, const HashMap<String, String> &p_code, const String &p_uniforms, const String &p_vertex_globals, const String &p_fragment_globals, const Vector<String> &p_custom_defines) {
 	ERR_FAIL_COND(is_compute);
 
 	Version *version = version_owner.get_or_null(p_version);
 	ERR_FAIL_COND(!version);
-	version->vertex_globals = p_vertex_globals.utf8();
-	version->fragment_globals = p_fragment_globals.utf8();
-	version->uniforms = p_uniforms.utf8();
-	version->code_sections.clear();
+	_wait_for_async_compilation(version);
+
+	CharString vertex_globals = p_vertex_globals.utf8();
+	CharString fragment_globals = p_fragment_globals.utf8();
+	CharString uniforms = p_uniforms.utf8();
+	HashMap<StringName, CharString> code_sections;
 	for (const KeyValue<String, String> &E : p_code) {
-		version->code_sections[StringName(E.key.to_upper())] = E.value.utf8();
+		code_sections[StringName(E.key.to_upper())] = E.value.utf8();
 	}
-
-	version->custom_defines.clear();
+	Vector<CharString> custom_defines;
 	for (int i = 0; i < p_custom_defines.size(); i++) {
-		version->custom_defines.push_back(p_custom_defines[i].utf8());
+		custom_defines.push_back(p_custom_defines[i].utf8());
 	}
 
+	if (!version->initialize_needed && !version->dirty && version->valid && version->vertex_globals == vertex_globals && version->fragment_globals == fragment_globals && version->uniforms == uniforms && _version_code_matches(version, code_sections, custom_defines)) {
+		// Same code as before (e.g. only uniform defaults changed), the compiled variants are still valid.
+		return;
+	}
+
+	version->vertex_globals = vertex_globals;
+	version->fragment_globals = fragment_globals;
+	version->uniforms = uniforms;
+	version->code_sections = code_sections;
+	version->custom_defines = custom_defines;
+
 	version->dirty = true;
-	if (version->initialize_needed) {
+	if (async_compilation) {
+		// Placeholders keep the shader RIDs stable, version_compile_async() fills them.
+		_initialize_version(version);
+		for (int i = 0; i < group_enabled.size(); i++) {
+			if (!group_enabled[i]) {
+				_allocate_placeholders(version, i);
+				continue;
+			}
+			for (uint32_t j = 0; j < group_to_variant_map[i].size(); j++) {
+				int variant_id = group_to_variant_map[i][j];
+				if (variants_enabled[variant_id]) {
+					version->variants[variant_id] = RD::get_singleton()->shader_create_placeholder();
+				}
+			}
+		}
+		version->initialize_needed = false;
+	} else if (version->initialize_needed) {
 		_initialize_version(version);
 		for (int i = 0; i < group_enabled.size(); i++) {
 			if (!group_enabled[i]) {
@@ -646,9 +705,117 @@ bool ShaderRD::version_is_valid(RID p_version) {
 	return version->valid;
 }
 
+void ShaderRD::_compile_async(void *p_shader) {
+	static_cast<ShaderRD *>(p_shader)->_compile_next_queued_version();
+}
+
+void ShaderRD::_compile_next_queued_version() {
+	Version *version = nullptr;
+	{
+		MutexLock lock(async_mutex);
+		// Every queued version has a task, but any task takes the most urgent version, as priorities change while they wait.
+		int64_t best = -1;
+		for (uint32_t i = 0; i < async_queue.size(); i++) {
+			if (best == -1 || async_queue[i]->async_priority > async_queue[best]->async_priority) {
+				best = i;
+			}
+		}
+		if (best == -1) {
+			return; // Canceled.
+		}
+		version = async_queue[best];
+		async_queue.remove_at_unordered(best);
+		version->async_queued = false;
+		version->async_compiling = true;
+		async_compiling_count++;
+	}
+
+	for (int i = 0; i < group_enabled.size(); i++) {
+		if (!version->variants) {
+			break; // A previous group failed.
+		}
+		if (group_enabled[i]) {
+			_compile_version(version, i, false);
+		}
+	}
+
+	{
+		MutexLock lock(async_mutex);
+		version->async_compiling = false;
+		async_compiling_count--;
+		async_condition.notify_all();
+	}
+}
+
+void ShaderRD::_wait_for_async_compilation(Version *p_version) {
+	MutexLock lock(async_mutex);
+	if (p_version->async_queued) {
+		async_queue.erase(p_version);
+		p_version->async_queued = false;
+	}
+	while (p_version->async_compiling) {
+		async_condition.wait(lock);
+	}
+}
+
+void ShaderRD::_wait_for_all_async_compilations() {
+	MutexLock lock(async_mutex);
+	while (async_queue.size() || async_compiling_count > 0) {
+		async_condition.wait(lock);
+	}
+}
+
+void ShaderRD::_collect_async_tasks(bool p_wait) {
+	for (uint32_t i = 0; i < async_tasks.size(); i++) {
+		if (p_wait || WorkerThreadPool::get_singleton()->is_task_completed(async_tasks[i])) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(async_tasks[i]);
+			async_tasks.remove_at_unordered(i);
+			i--;
+		}
+	}
+}
+
+void ShaderRD::version_compile_async(RID p_version, float p_priority) {
+	ERR_FAIL_COND(!async_compilation);
+	Version *version = version_owner.get_or_null(p_version);
+	ERR_FAIL_COND(!version);
+	ERR_FAIL_COND_MSG(!version->variants, "Set the code of the shader version before compiling it.");
+
+	_collect_async_tasks(false);
+	{
+		MutexLock lock(async_mutex);
+		if (version->async_queued || version->async_compiling) {
+			return;
+		}
+		version->async_queued = true;
+		version->async_priority = p_priority;
+		async_queue.push_back(version);
+	}
+	async_tasks.push_back(WorkerThreadPool::get_singleton()->add_native_task(&ShaderRD::_compile_async, this, false, "ShaderRD compilation"));
+}
+
+void ShaderRD::version_set_compilation_priority(RID p_version, float p_priority) {
+	Version *version = version_owner.get_or_null(p_version);
+	ERR_FAIL_COND(!version);
+
+	MutexLock lock(async_mutex);
+	if (version->async_queued) {
+		version->async_priority = MAX(version->async_priority, p_priority);
+	}
+}
+
+bool ShaderRD::version_is_compiling(RID p_version) {
+	Version *version = version_owner.get_or_null(p_version);
+	ERR_FAIL_COND_V(!version, false);
+
+	MutexLock lock(async_mutex);
+	return version->async_queued || version->async_compiling;
+}
+
 bool ShaderRD::version_free(RID p_version) {
 	if (version_owner.owns(p_version)) {
 		Version *version = version_owner.get_or_null(p_version);
+		_wait_for_async_compilation(version);
 		_clear_version(version);
 		version_owner.free(p_version);
 	} else {
@@ -677,6 +844,8 @@ void ShaderRD::enable_group(int p_group) {
 		return;
 	}
 
+	// Versions being compiled asynchronously must not see the group change halfway.
+	_wait_for_all_async_compilations();
 	group_enabled.write[p_group] = true;
 
 	// Compile all versions again to include the new group.
@@ -843,4 +1012,5 @@ ShaderRD::~ShaderRD() {
 			remaining.pop_front();
 		}
 	}
+	_collect_async_tasks(true);
 }
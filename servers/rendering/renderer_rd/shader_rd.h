@@ -31,6 +31,8 @@
 #ifndef SHADER_RD_H
 #define SHADER_RD_H
 
+#include "core/object/worker_thread_pool.h"
+#include "core/os/condition_variable.h"
 #include "core/os/mutex.h"
 #include "core/string/string_builder.h"
 #include "core/templates/hash_map.h"
@@ -76,6 +78,11 @@ private:
 		bool valid;
 		bool dirty;
 		bool initialize_needed;
+
+		// Asynchronous compilation state, guarded by async_mutex.
+		bool async_queued = false;
+		bool async_compiling = false;
+		float async_priority = 0.0;
 	};
 
 	Mutex variant_set_mutex;
@@ -85,13 +92,28 @@ private:
 		int group = 0;
 	};
 
+	void _free_variant_placeholder(uint32_t p_variant, const CompileData *p_data);
 	void _compile_variant(uint32_t p_variant, const CompileData *p_data);
 
 	void _initialize_version(Version *p_version);
+	static bool _version_code_matches(const Version *p_version, const HashMap<StringName, CharString> &p_code_sections, const Vector<CharString> &p_custom_defines);
 	void _clear_version(Version *p_version);
-	void _compile_version(Version *p_version, int p_group);
+	void _compile_version(Version *p_version, int p_group, bool p_parallel = true);
 	void _allocate_placeholders(Version *p_version, int p_group);
 
+	bool async_compilation = false;
+	BinaryMutex async_mutex;
+	ConditionVariable async_condition;
+	LocalVector<Version *> async_queue;
+	LocalVector<WorkerThreadPool::TaskID> async_tasks;
+	uint32_t async_compiling_count = 0;
+
+	static void _compile_async(void *p_shader);
+	void _compile_next_queued_version();
+	void _wait_for_async_compilation(Version *p_version);
+	void _wait_for_all_async_compilations();
+	void _collect_async_tasks(bool p_wait);
+
 	RID_Owner<Version> version_owner;
 
 	struct StageTemplate {
@@ -184,6 +206,17 @@ public:
 
 	bool version_is_valid(RID p_version);
 
+	// When enabled, version_set_code() only allocates placeholder shaders, which version_get_shader() returns
+	// right away. The variants are compiled on the WorkerThreadPool after version_compile_async(), highest priority
+	// first, and the placeholders become the compiled shaders. version_is_valid() is false until it's done.
+	void set_async_compilation(bool p_enable) { async_compilation = p_enable; }
+	bool is_async_compilation_enabled() const { return async_compilation; }
+	void version_compile_async(RID p_version, float p_priority = 0.0);
+	void version_set_compilation_priority(RID p_version, float p_priority);
+	bool version_is_compiling(RID p_version);
+	// Releases the tasks of finished compilations, call regularly while compiling asynchronously.
+	void collect_async_compilations() { _collect_async_tasks(false); }
+
 	bool version_free(RID p_version);
 
 	// Enable/disable variants for things that you know won't be used at engine initialization time .
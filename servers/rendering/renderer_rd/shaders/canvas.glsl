@@ -26,6 +26,15 @@ layout(location = 3) out vec2 pixel_size_interp;
 
 #endif
 
+#if !defined(USE_ATTRIBUTES) && !defined(USE_PRIMITIVE)
+
+layout(location = 4) flat out uint instance_index_interp;
+
+uint instance_index;
+#define draw_data instances.data[instance_index]
+
+#endif
+
 #ifdef MATERIAL_UNIFORMS_USED
 layout(set = 1, binding = 0, std140) uniform MaterialUniforms{
 
@@ -44,6 +53,10 @@ vec3 srgb_to_linear(vec3 color) {
 
 void main() {
 	vec4 instance_custom = vec4(0.0);
+#if !defined(USE_ATTRIBUTES) && !defined(USE_PRIMITIVE)
+	instance_index = params.base_instance + uint(gl_InstanceIndex);
+	instance_index_interp = instance_index;
+#endif
 #ifdef USE_PRIMITIVE
 
 	//weird bug,
@@ -231,6 +244,14 @@ layout(location = 3) in vec2 pixel_size_interp;
 
 #endif
 
+#if !defined(USE_ATTRIBUTES) && !defined(USE_PRIMITIVE)
+
+layout(location = 4) flat in uint instance_index_interp;
+
+#define draw_data instances.data[instance_index_interp]
+
+#endif
+
 layout(location = 0) out vec4 frag_color;
 
 #ifdef MATERIAL_UNIFORMS_USED
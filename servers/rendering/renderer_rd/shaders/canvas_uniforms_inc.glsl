@@ -32,6 +32,8 @@
 
 // Push Constant
 
+#if defined(USE_PRIMITIVE) || defined(USE_ATTRIBUTES)
+
 layout(push_constant, std430) uniform DrawData {
 	vec2 world_x;
 	vec2 world_y;
@@ -55,6 +57,20 @@ layout(push_constant, std430) uniform DrawData {
 }
 draw_data;
 
+#else
+
+// Rects and nine-patches are batched, each instance reads its draw data from the instance buffer.
+
+layout(push_constant, std430) uniform Params {
+	uint base_instance;
+	uint pad0;
+	uint pad1;
+	uint pad2;
+}
+params;
+
+#endif
+
 // In vulkan, sets should always be ordered using the following logic:
 // Lower Sets: Sets that change format and layout less often
 // Higher sets: Sets that change format and layout very often
@@ -127,6 +143,27 @@ layout(set = 0, binding = 5) uniform sampler shadow_sampler;
 layout(set = 0, binding = 6) uniform texture2D color_buffer;
 layout(set = 0, binding = 7) uniform texture2D sdf_texture;
 
+// Same layout as DrawData for rects.
+struct InstanceData {
+	vec2 world_x;
+	vec2 world_y;
+	vec2 world_ofs;
+	uint flags;
+	uint specular_shininess;
+	vec4 modulation;
+	vec4 ninepatch_margins;
+	vec4 dst_rect; //for built-in rect and UV
+	vec4 src_rect;
+	vec2 pad;
+	vec2 color_texture_pixel_size;
+	uint lights[4];
+};
+
+layout(set = 0, binding = 8, std430) restrict readonly buffer Instances {
+	InstanceData data[];
+}
+instances;
+
 #include "samplers_inc.glsl"
 
 layout(set = 0, binding = 9, std430) restrict readonly buffer GlobalShaderUniformData {
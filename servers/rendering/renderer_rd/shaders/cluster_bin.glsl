@@ -0,0 +1,119 @@
+#[compute]
+
+#version 450
+
+#VERSION_DEFINES
+
+// Compute alternative to cluster_render, tests the bounds of every element against the frustum of every cluster tile
+// and writes the same usage and depth bits, so cluster_store can pack the result unchanged.
+
+layout(local_size_x = 64, local_size_y = 1, local_size_z = 1) in;
+
+layout(push_constant, std430) uniform Params {
+	uvec2 cluster_screen_size;
+	uint render_element_count;
+	uint cluster_size; // In screen pixels.
+
+	vec2 screen_size;
+	uint pad0;
+	uint pad1;
+}
+params;
+
+layout(set = 0, binding = 1, std140) uniform State {
+	mat4 projection;
+
+	float inv_z_far;
+	uint screen_to_clusters_shift; // shift to obtain coordinates in block indices
+	uint cluster_screen_width; //
+	uint cluster_data_size; // how much data for a single cluster takes
+
+	uint cluster_depth_offset;
+	uint pad0;
+	uint pad1;
+	uint pad2;
+}
+state;
+
+struct RenderElement {
+	uint type; //0-4
+	bool touches_near;
+	bool touches_far;
+	uint original_index;
+	mat3x4 transform_inv;
+	vec3 scale;
+	bool has_wide_spot_angle;
+};
+
+layout(set = 0, binding = 2, std430) buffer restrict readonly RenderElements {
+	RenderElement data[];
+}
+render_elements;
+
+layout(set = 0, binding = 3, std430) buffer restrict ClusterRender {
+	uint data[];
+}
+cluster_render;
+
+#define ELEMENT_TYPE_SPOT_LIGHT 1
+
+// Largest value of the plane equation over the box, negative means the box is fully outside.
+float plane_box_max(vec4 plane, vec3 center, vec3 axis_x, vec3 axis_y, vec3 axis_z) {
+	return dot(plane.xyz, center) + plane.w + abs(dot(plane.xyz, axis_x)) + abs(dot(plane.xyz, axis_y)) + abs(dot(plane.xyz, axis_z));
+}
+
+void main() {
+	uint element_index = gl_GlobalInvocationID.x;
+	uvec2 cluster = gl_GlobalInvocationID.yz;
+	if (element_index >= params.render_element_count || any(greaterThanEqual(cluster, params.cluster_screen_size))) {
+		return;
+	}
+
+	// Bounding box of the proxy shape the raster path would draw, in view space.
+	vec3 scale = render_elements.data[element_index].scale;
+	vec3 local_center = vec3(0.0);
+	if (render_elements.data[element_index].type == ELEMENT_TYPE_SPOT_LIGHT && !render_elements.data[element_index].has_wide_spot_angle) {
+		// Cone apex is at the origin, the base at -Z.
+		local_center.z = -0.5 * scale.z;
+		scale.z *= 0.5;
+	}
+
+	mat3x4 transform_inv = render_elements.data[element_index].transform_inv;
+	vec3 center = vec4(local_center, 1.0) * transform_inv;
+	vec3 axis_x = vec3(transform_inv[0].x, transform_inv[1].x, transform_inv[2].x) * scale.x;
+	vec3 axis_y = vec3(transform_inv[0].y, transform_inv[1].y, transform_inv[2].y) * scale.y;
+	vec3 axis_z = vec3(transform_inv[0].z, transform_inv[1].z, transform_inv[2].z) * scale.z;
+
+	float depth_extent = abs(axis_x.z) + abs(axis_y.z) + abs(axis_z.z);
+	float min_depth = -center.z - depth_extent;
+	float max_depth = -center.z + depth_extent;
+	if (max_depth < 0.0 || min_depth * state.inv_z_far > 1.0) {
+		return;
+	}
+
+	// Side planes of the tile, taken from the rows of the projection so perspective and orthogonal work alike.
+	vec2 ndc_from = (vec2(cluster * params.cluster_size) / params.screen_size) * 2.0 - 1.0;
+	vec2 ndc_to = (vec2((cluster + 1u) * params.cluster_size) / params.screen_size) * 2.0 - 1.0;
+	vec4 row_x = vec4(state.projection[0].x, state.projection[1].x, state.projection[2].x, state.projection[3].x);
+	vec4 row_y = vec4(state.projection[0].y, state.projection[1].y, state.projection[2].y, state.projection[3].y);
+	vec4 row_w = vec4(state.projection[0].w, state.projection[1].w, state.projection[2].w, state.projection[3].w);
+
+	if (plane_box_max(row_x - ndc_from.x * row_w, center, axis_x, axis_y, axis_z) < 0.0 ||
+			plane_box_max(ndc_to.x * row_w - row_x, center, axis_x, axis_y, axis_z) < 0.0 ||
+			plane_box_max(row_y - ndc_from.y * row_w, center, axis_x, axis_y, axis_z) < 0.0 ||
+			plane_box_max(ndc_to.y * row_w - row_y, center, axis_x, axis_y, axis_z) < 0.0) {
+		return;
+	}
+
+	uint cluster_offset = (cluster.x + state.cluster_screen_width * cluster.y) * state.cluster_data_size;
+
+	atomicOr(cluster_render.data[cluster_offset + (element_index >> 5)], 1u << (element_index & 0x1F));
+
+	// Mark every depth slice the box spans, cluster_store still widens this for elements touching near or far.
+	uint from_z = clamp(uint(floor(max(min_depth, 0.0) * state.inv_z_far * 32.0)), 0, 31);
+	uint to_z = clamp(uint(floor(max_depth * state.inv_z_far * 32.0)), 0, 31);
+	uint z_bits = (0xFFFFFFFFu >> (31u - to_z)) & (0xFFFFFFFFu << from_z);
+
+	// Only this invocation writes the depth bits of this element in this cluster.
+	cluster_render.data[cluster_offset + state.cluster_depth_offset + element_index] = z_bits;
+}
@@ -0,0 +1,57 @@
+#[compute]
+
+#version 450
+
+#VERSION_DEFINES
+
+layout(local_size_x = 8, local_size_y = 8, local_size_z = 1) in;
+
+layout(set = 0, binding = 0) uniform sampler2D source_depth;
+
+layout(set = 0, binding = 1, std430) buffer restrict writeonly DestDepth {
+	float data[];
+}
+dest_depth;
+
+layout(push_constant, std430) uniform Params {
+	ivec2 source_size;
+	ivec2 dest_size;
+
+	float z_near;
+	float z_far;
+	bool orthogonal;
+	uint pad;
+}
+params;
+
+#define FLT_MAX 3.402823466e+38
+
+void main() {
+	ivec2 pos = ivec2(gl_GlobalInvocationID.xy);
+	if (any(greaterThanEqual(pos, params.dest_size))) {
+		return;
+	}
+
+	// Every source texel touched by this destination texel, rounded outwards so nothing is missed.
+	ivec2 from = (pos * params.source_size) / params.dest_size;
+	ivec2 to = min(max(from + 1, ((pos + 1) * params.source_size + params.dest_size - 1) / params.dest_size), params.source_size);
+
+	float depth = 0.0;
+	for (int y = from.y; y < to.y; y++) {
+		for (int x = from.x; x < to.x; x++) {
+			// The occlusion buffer has its first row at the bottom of the screen.
+			depth = max(depth, texelFetch(source_depth, ivec2(x, params.source_size.y - 1 - y), 0).r);
+		}
+	}
+
+	float linear_depth;
+	if (depth >= 1.0) {
+		linear_depth = FLT_MAX; // Nothing was drawn here, so it can't occlude anything.
+	} else if (params.orthogonal) {
+		linear_depth = params.z_near + depth * (params.z_far - params.z_near);
+	} else {
+		linear_depth = params.z_near * params.z_far / (params.z_far - depth * (params.z_far - params.z_near));
+	}
+
+	dest_depth.data[pos.y * params.dest_size.x + pos.x] = linear_depth;
+}
@@ -0,0 +1,192 @@
+#[compute]
+
+#version 450
+
+#VERSION_DEFINES
+
+// Temporal upscaler, accumulates the jittered frames rendered at the internal resolution into a history at the target resolution.
+// Uses the same inputs as the TAA resolve (motion vectors, depth and history) and the same history clipping.
+
+#define FLT_MIN 0.00000001
+#define FLT_MAX 32767.0
+#define RPC_9 0.11111111111
+#define RPC_16 0.0625
+
+layout(local_size_x = 8, local_size_y = 8, local_size_z = 1) in;
+
+layout(set = 0, binding = 0) uniform sampler2D color_buffer;
+layout(set = 0, binding = 1) uniform sampler2D depth_buffer;
+layout(rg16f, set = 0, binding = 2) uniform restrict readonly image2D velocity_buffer;
+layout(set = 0, binding = 3) uniform sampler2D history_buffer;
+layout(rgba16f, set = 0, binding = 4) uniform restrict writeonly image2D output_buffer;
+layout(rgba16f, set = 0, binding = 5) uniform restrict writeonly image2D history_output_buffer;
+
+layout(push_constant, std430) uniform Params {
+	vec2 resolution;
+	vec2 upscaled_resolution;
+	vec2 jitter; // Offset the current frame was rendered at, in internal pixels.
+	bool reset;
+	uint pad;
+}
+params;
+
+vec3 reinhard(vec3 hdr) {
+	return hdr / (hdr + 1.0);
+}
+vec3 reinhard_inverse(vec3 sdr) {
+	return sdr / (1.0 - sdr);
+}
+
+const vec3 lumCoeff = vec3(0.299f, 0.587f, 0.114f);
+
+float luminance(vec3 color) {
+	return max(dot(color, lumCoeff), 0.0001f);
+}
+
+vec3 sample_catmull_rom_9(sampler2D stex, vec2 uv, vec2 resolution) {
+	// Source: https://gist.github.com/TheRealMJP/c83b8c0f46b63f3a88a5986f4fa982b1
+	// License: https://gist.github.com/TheRealMJP/bc503b0b87b643d3505d41eab8b332ae
+	vec2 sample_pos = uv * resolution;
+	vec2 texPos1 = floor(sample_pos - 0.5f) + 0.5f;
+	vec2 f = sample_pos - texPos1;
+
+	vec2 w0 = f * (-0.5f + f * (1.0f - 0.5f * f));
+	vec2 w1 = 1.0f + f * f * (-2.5f + 1.5f * f);
+	vec2 w2 = f * (0.5f + f * (2.0f - 1.5f * f));
+	vec2 w3 = f * f * (-0.5f + 0.5f * f);
+
+	vec2 w12 = w1 + w2;
+	vec2 offset12 = w2 / (w1 + w2);
+
+	vec2 texPos0 = (texPos1 - 1.0f) / resolution;
+	vec2 texPos3 = (texPos1 + 2.0f) / resolution;
+	vec2 texPos12 = (texPos1 + offset12) / resolution;
+
+	vec3 result = vec3(0.0f, 0.0f, 0.0f);
+
+	result += textureLod(stex, vec2(texPos0.x, texPos0.y), 0.0).xyz * w0.x * w0.y;
+	result += textureLod(stex, vec2(texPos12.x, texPos0.y), 0.0).xyz * w12.x * w0.y;
+	result += textureLod(stex, vec2(texPos3.x, texPos0.y), 0.0).xyz * w3.x * w0.y;
+
+	result += textureLod(stex, vec2(texPos0.x, texPos12.y), 0.0).xyz * w0.x * w12.y;
+	result += textureLod(stex, vec2(texPos12.x, texPos12.y), 0.0).xyz * w12.x * w12.y;
+	result += textureLod(stex, vec2(texPos3.x, texPos12.y), 0.0).xyz * w3.x * w12.y;
+
+	result += textureLod(stex, vec2(texPos0.x, texPos3.y), 0.0).xyz * w0.x * w3.y;
+	result += textureLod(stex, vec2(texPos12.x, texPos3.y), 0.0).xyz * w12.x * w3.y;
+	result += textureLod(stex, vec2(texPos3.x, texPos3.y), 0.0).xyz * w3.x * w3.y;
+
+	return max(result, 0.0f);
+}
+
+// Based on "Temporal Reprojection Anti-Aliasing" - https://github.com/playdeadgames/temporal
+vec3 clip_aabb(vec3 aabb_min, vec3 aabb_max, vec3 p, vec3 q) {
+	vec3 r = q - p;
+	vec3 rmax = (aabb_max - p.xyz);
+	vec3 rmin = (aabb_min - p.xyz);
+
+	if (r.x > rmax.x + FLT_MIN)
+		r *= (rmax.x / r.x);
+	if (r.y > rmax.y + FLT_MIN)
+		r *= (rmax.y / r.y);
+	if (r.z > rmax.z + FLT_MIN)
+		r *= (rmax.z / r.z);
+
+	if (r.x < rmin.x - FLT_MIN)
+		r *= (rmin.x / r.x);
+	if (r.y < rmin.y - FLT_MIN)
+		r *= (rmin.y / r.y);
+	if (r.z < rmin.z - FLT_MIN)
+		r *= (rmin.z / r.z);
+
+	return p + r;
+}
+
+void main() {
+	ivec2 pos = ivec2(gl_GlobalInvocationID.xy);
+	if (any(greaterThanEqual(pos, ivec2(params.upscaled_resolution)))) {
+		return;
+	}
+
+	vec2 uv = (vec2(pos) + 0.5) / params.upscaled_resolution;
+
+	// Position of this output pixel in the internal image, and the input pixel whose jittered sample is closest to it.
+	vec2 input_pos = uv * params.resolution;
+	ivec2 input_center = ivec2(floor(input_pos + params.jitter));
+	ivec2 input_max = ivec2(params.resolution) - ivec2(1);
+
+	vec3 color_sum = vec3(0.0);
+	float weight_sum = 0.0;
+	float max_weight = 0.0;
+	vec3 color_avg = vec3(0.0);
+	vec3 color_avg2 = vec3(0.0);
+	float min_depth = 1.0;
+	ivec2 min_pos = clamp(input_center, ivec2(0), input_max);
+
+	for (int y = -1; y <= 1; y++) {
+		for (int x = -1; x <= 1; x++) {
+			ivec2 sample_pos = clamp(input_center + ivec2(x, y), ivec2(0), input_max);
+			vec3 color = reinhard(texelFetch(color_buffer, sample_pos, 0).rgb);
+
+			// Gaussian fit of a Blackman-Harris window, over the distance to where this sample was actually rendered.
+			vec2 offset = input_pos - (vec2(sample_pos) + 0.5 - params.jitter);
+			float weight = exp(-2.29 * dot(offset, offset));
+
+			color_sum += color * weight;
+			weight_sum += weight;
+			max_weight = max(max_weight, weight);
+
+			color_avg += color;
+			color_avg2 += color * color;
+
+			float depth = texelFetch(depth_buffer, sample_pos, 0).r;
+			if (depth < min_depth) {
+				min_depth = depth;
+				min_pos = sample_pos;
+			}
+		}
+	}
+
+	vec3 color_input = color_sum / max(weight_sum, FLT_MIN);
+	float alpha = texelFetch(color_buffer, clamp(input_center, ivec2(0), input_max), 0).a;
+
+	vec3 color_resolved = color_input;
+	if (!params.reset) {
+		// Reproject using the velocity with the closest depth, as the TAA resolve does.
+		vec2 velocity = imageLoad(velocity_buffer, min_pos).xy;
+		vec2 uv_reprojected = uv + velocity;
+
+		vec3 color_history = reinhard(sample_catmull_rom_9(history_buffer, uv_reprojected, params.upscaled_resolution).rgb);
+
+		// Clip history to the neighbourhood of the current samples.
+		color_avg *= RPC_9;
+		color_avg2 *= RPC_9;
+		float box_size = mix(0.0f, 2.5f, smoothstep(0.02f, 0.0f, length(velocity)));
+		vec3 dev = sqrt(abs(color_avg2 - (color_avg * color_avg))) * box_size;
+		vec3 color_min = color_avg - dev;
+		vec3 color_max = color_avg + dev;
+		color_history = clamp(clip_aabb(color_min, color_max, clamp(color_avg, color_min, color_max), color_history), FLT_MIN, FLT_MAX);
+
+		// Trust the current frame more where one of its samples landed close to this output pixel.
+		float blend_factor = RPC_16 * max_weight;
+
+		// If re-projected UV is out of screen, converge to current color immediately.
+		if (any(lessThan(uv_reprojected, vec2(0.0))) || any(greaterThan(uv_reprojected, vec2(1.0)))) {
+			blend_factor = 1.0;
+		}
+
+		// Reduce flickering.
+		float lum_color = luminance(color_input);
+		float lum_history = luminance(color_history);
+		float diff = abs(lum_color - lum_history) / max(lum_color, max(lum_history, 1.001));
+		diff = 1.0 - diff;
+		blend_factor = mix(0.0, blend_factor, diff * diff);
+
+		color_resolved = mix(color_history, color_input, blend_factor);
+	}
+
+	color_resolved = reinhard_inverse(color_resolved);
+
+	imageStore(output_buffer, pos, vec4(color_resolved, alpha));
+	imageStore(history_output_buffer, pos, vec4(color_resolved, alpha));
+}
@@ -0,0 +1,122 @@
+#[compute]
+
+#version 450
+
+#VERSION_DEFINES
+
+layout(local_size_x = 64, local_size_y = 1, local_size_z = 1) in;
+
+struct CullItem {
+	vec4 planes[6]; // Frustum planes, in the local space of the multimesh instance.
+
+	vec3 aabb_position;
+	uint instance_count;
+
+	vec3 aabb_size;
+	uint stride; // In vec4s.
+
+	uint current_offset;
+	uint previous_offset;
+	uint command_first;
+	uint command_count;
+
+	bool motion_vectors;
+	bool sphere_bounds; // Ignore rotation and scale below 1, for instances that may be billboarded.
+	uint pad0;
+	uint pad1;
+};
+
+layout(set = 0, binding = 0, std430) buffer restrict readonly CullItems {
+	CullItem data[];
+}
+cull_items;
+
+layout(set = 0, binding = 1, std430) buffer restrict DrawCommands {
+	uint data[];
+}
+draw_commands;
+
+layout(set = 1, binding = 0, std430) buffer restrict readonly SrcTransforms {
+	vec4 data[];
+}
+src_transforms;
+
+layout(set = 1, binding = 1, std430) buffer restrict writeonly DstTransforms {
+	vec4 data[];
+}
+dst_transforms;
+
+layout(push_constant, std430) uniform Params {
+	uint item;
+	uint pad0;
+	uint pad1;
+	uint pad2;
+}
+params;
+
+// Matches the indexed indirect draw command layout, the instance count is the second field.
+#define DRAW_COMMAND_SIZE 5
+#define DRAW_COMMAND_INSTANCE_COUNT 1
+
+void main() {
+	uint index = gl_GlobalInvocationID.x;
+	if (index >= cull_items.data[params.item].instance_count) {
+		return;
+	}
+
+	uint stride = cull_items.data[params.item].stride;
+	uint src_offset = (cull_items.data[params.item].current_offset + index) * stride;
+
+	// Rows of the instance transform, the origin is stored in w.
+	vec4 row_x = src_transforms.data[src_offset + 0];
+	vec4 row_y = src_transforms.data[src_offset + 1];
+	vec4 row_z = src_transforms.data[src_offset + 2];
+
+	if (all(equal(row_x.xyz, vec3(0.0))) && all(equal(row_y.xyz, vec3(0.0))) && all(equal(row_z.xyz, vec3(0.0)))) {
+		return; // Zero scale, such as inactive particles.
+	}
+
+	vec3 half_size = cull_items.data[params.item].aabb_size * 0.5;
+	vec3 center = cull_items.data[params.item].aabb_position + half_size;
+
+	vec3 instance_center;
+	vec3 instance_extents;
+	if (cull_items.data[params.item].sphere_bounds) {
+		vec3 aabb_far = max(abs(cull_items.data[params.item].aabb_position), abs(cull_items.data[params.item].aabb_position + cull_items.data[params.item].aabb_size));
+		float scale = max(1.0, max(length(vec3(row_x.x, row_y.x, row_z.x)), max(length(vec3(row_x.y, row_y.y, row_z.y)), length(vec3(row_x.z, row_y.z, row_z.z)))));
+		instance_center = vec3(row_x.w, row_y.w, row_z.w);
+		instance_extents = vec3(length(aabb_far) * scale);
+	} else {
+		instance_center = vec3(dot(row_x.xyz, center), dot(row_y.xyz, center), dot(row_z.xyz, center)) + vec3(row_x.w, row_y.w, row_z.w);
+		instance_extents = vec3(dot(abs(row_x.xyz), half_size), dot(abs(row_y.xyz), half_size), dot(abs(row_z.xyz), half_size));
+	}
+
+	for (uint i = 0; i < 6; i++) {
+		vec4 plane = cull_items.data[params.item].planes[i];
+		if (dot(plane.xyz, instance_center) - plane.w > dot(abs(plane.xyz), instance_extents)) {
+			return; // Fully outside this plane.
+		}
+	}
+
+	// The first command decides where the instance goes, the others only need their count to match.
+	uint command_first = cull_items.data[params.item].command_first;
+	uint command_count = cull_items.data[params.item].command_count;
+	uint dst_index = atomicAdd(draw_commands.data[command_first * DRAW_COMMAND_SIZE + DRAW_COMMAND_INSTANCE_COUNT], 1);
+	for (uint i = 1; i < command_count; i++) {
+		atomicAdd(draw_commands.data[(command_first + i) * DRAW_COMMAND_SIZE + DRAW_COMMAND_INSTANCE_COUNT], 1);
+	}
+
+	uint dst_offset = dst_index * stride;
+	for (uint i = 0; i < stride; i++) {
+		dst_transforms.data[dst_offset + i] = src_transforms.data[src_offset + i];
+	}
+
+	if (cull_items.data[params.item].motion_vectors) {
+		// Previous transforms are compacted after the current ones, in the same order.
+		uint prev_src_offset = (cull_items.data[params.item].previous_offset + index) * stride;
+		uint prev_dst_offset = (cull_items.data[params.item].instance_count + dst_index) * stride;
+		for (uint i = 0; i < stride; i++) {
+			dst_transforms.data[prev_dst_offset + i] = src_transforms.data[prev_src_offset + i];
+		}
+	}
+}
@@ -0,0 +1,223 @@
+#[compute]
+
+#version 450
+
+#VERSION_DEFINES
+
+// Bakes the signed distance field of GPUParticlesCollisionSDF3D with a jump flood. Cells close to a face are seeded with
+// their exact closest face, which is then propagated to the rest of the volume. The distance to a face matches the CPU bake.
+
+#if defined(MODE_SEED_DISTANCE) || defined(MODE_SEED_FACE)
+layout(local_size_x = 64, local_size_y = 1, local_size_z = 1) in;
+#else
+layout(local_size_x = 4, local_size_y = 4, local_size_z = 4) in;
+#endif
+
+// All buffers start cleared to zero, so seeds store the face index plus one and distances are inverted for atomicMax().
+#define NO_FACE 0
+
+layout(set = 0, binding = 1, std430) restrict readonly buffer Faces {
+	vec4 data[]; // Three vertices per face.
+}
+faces;
+
+layout(set = 0, binding = 2, std430) restrict buffer Distances {
+	uint data[]; // Inverted closest seed distance, see distance_to_key().
+}
+distances;
+
+layout(set = 0, binding = 3, std430) restrict buffer SrcSeeds {
+	uint data[];
+}
+src_seeds;
+
+layout(set = 0, binding = 4, std430) restrict buffer DstSeeds {
+	uint data[];
+}
+dst_seeds;
+
+layout(set = 0, binding = 5, std430) restrict writeonly buffer Cells {
+	float data[];
+}
+cells;
+
+layout(push_constant, std430) uniform Params {
+	ivec3 size;
+	uint face_count;
+
+	vec3 cell_offset; // Center of the first cell.
+	float cell_size;
+
+	float thickness;
+	int step;
+	uint pad0;
+	uint pad1;
+}
+params;
+
+float dot2(vec3 v) {
+	return dot(v, v);
+}
+
+float face_distance(vec3 p_pos, uint p_face) {
+	vec3 a = faces.data[(p_face - 1) * 3 + 0].xyz;
+	vec3 b = faces.data[(p_face - 1) * 3 + 1].xyz;
+	vec3 c = faces.data[(p_face - 1) * 3 + 2].xyz;
+
+	// Same winding as Face3::get_plane().
+	vec3 normal = normalize(cross(a - c, a - b));
+	float d = dot(normal, p_pos) - dot(normal, a);
+	vec3 point = p_pos;
+
+	if (d < 0.0 && d > -params.thickness) {
+		// Inside planes, do this in 2D.
+		vec3 x_axis = normalize(a - b);
+		vec3 y_axis = normalize(cross(normal, x_axis));
+
+		vec2 points[3] = vec2[](vec2(dot(x_axis, a), dot(y_axis, a)), vec2(dot(x_axis, b), dot(y_axis, b)), vec2(dot(x_axis, c), dot(y_axis, c)));
+		vec2 p2d = vec2(dot(x_axis, point), dot(y_axis, point));
+
+		// https://www.shadertoy.com/view/XsXSz4
+		vec2 e0 = points[1] - points[0];
+		vec2 e1 = points[2] - points[1];
+		vec2 e2 = points[0] - points[2];
+
+		vec2 v0 = p2d - points[0];
+		vec2 v1 = p2d - points[1];
+		vec2 v2 = p2d - points[2];
+
+		vec2 pq0 = v0 - e0 * clamp(dot(v0, e0) / dot(e0, e0), 0.0, 1.0);
+		vec2 pq1 = v1 - e1 * clamp(dot(v1, e1) / dot(e1, e1), 0.0, 1.0);
+		vec2 pq2 = v2 - e2 * clamp(dot(v2, e2) / dot(e2, e2), 0.0, 1.0);
+
+		float s = sign(e0.x * e2.y - e0.y * e2.x);
+		vec2 d2 = min(min(vec2(dot(pq0, pq0), s * (v0.x * e0.y - v0.y * e0.x)), vec2(dot(pq1, pq1), s * (v1.x * e1.y - v1.y * e1.x))), vec2(dot(pq2, pq2), s * (v2.x * e2.y - v2.y * e2.x)));
+
+		float inside_d = -sqrt(d2.x) * sign(d2.y);
+
+		// Make sure distance to planes is not shorter if inside.
+		if (inside_d < 0.0) {
+			inside_d = max(inside_d, d);
+			inside_d = max(inside_d, -(params.thickness + d));
+		}
+
+		return inside_d;
+	}
+
+	if (d < 0.0) {
+		point -= normal * params.thickness; // Flatten.
+	}
+
+	// https://iquilezles.org/www/articles/distfunctions/distfunctions.htm
+	vec3 ba = b - a;
+	vec3 pa = point - a;
+	vec3 cb = c - b;
+	vec3 pb = point - b;
+	vec3 ac = a - c;
+	vec3 pc = point - c;
+	vec3 nor = cross(ba, ac);
+
+	return sqrt(
+			(sign(dot(cross(ba, nor), pa)) + sign(dot(cross(cb, nor), pb)) + sign(dot(cross(ac, nor), pc)) < 2.0)
+					? min(min(dot2(ba * clamp(dot(ba, pa) / dot2(ba), 0.0, 1.0) - pa), dot2(cb * clamp(dot(cb, pb) / dot2(cb), 0.0, 1.0) - pb)), dot2(ac * clamp(dot(ac, pc) / dot2(ac), 0.0, 1.0) - pc))
+					: dot(nor, pa) * dot(nor, pa) / dot2(nor));
+}
+
+// Larger keys are closer, and zero is further than any distance.
+uint distance_to_key(float p_distance) {
+	uint bits = floatBitsToUint(p_distance);
+	uint ordered = (bits & 0x80000000) != 0 ? ~bits : bits | 0x80000000;
+	return ~ordered;
+}
+
+uint cell_index(ivec3 p_cell) {
+	return uint((p_cell.z * params.size.y + p_cell.y) * params.size.x + p_cell.x);
+}
+
+vec3 cell_position(ivec3 p_cell) {
+	return params.cell_offset + vec3(p_cell) * params.cell_size;
+}
+
+void main() {
+#if defined(MODE_SEED_DISTANCE) || defined(MODE_SEED_FACE)
+	// One invocation per face and slice, covering the cells around the face.
+	if (gl_GlobalInvocationID.x >= params.face_count) {
+		return;
+	}
+	uint face = gl_GlobalInvocationID.x + 1;
+	int z = int(gl_GlobalInvocationID.y);
+
+	vec3 a = faces.data[gl_GlobalInvocationID.x * 3 + 0].xyz;
+	vec3 b = faces.data[gl_GlobalInvocationID.x * 3 + 1].xyz;
+	vec3 c = faces.data[gl_GlobalInvocationID.x * 3 + 2].xyz;
+	vec3 normal = normalize(cross(a - c, a - b));
+
+	vec3 bounds_min = min(min(a, b), c);
+	vec3 bounds_max = max(max(a, b), c);
+	if (params.thickness > 0.0) {
+		vec3 offset = normal * params.thickness;
+		bounds_min = min(bounds_min, min(min(a, b), c) - offset);
+		bounds_max = max(bounds_max, max(max(a, b), c) - offset);
+	}
+
+	// A margin of more than a cell, so the jump flood starts from exact seeds on both sides of the surface.
+	ivec3 from = clamp(ivec3(floor((bounds_min - params.cell_offset) / params.cell_size - 1.5)), ivec3(0), params.size - 1);
+	ivec3 to = clamp(ivec3(ceil((bounds_max - params.cell_offset) / params.cell_size + 1.5)), ivec3(0), params.size - 1);
+	if (z < from.z || z > to.z) {
+		return;
+	}
+
+	for (int y = from.y; y <= to.y; y++) {
+		for (int x = from.x; x <= to.x; x++) {
+			ivec3 cell = ivec3(x, y, z);
+			uint key = distance_to_key(face_distance(cell_position(cell), face));
+			uint index = cell_index(cell);
+#ifdef MODE_SEED_DISTANCE
+			atomicMax(distances.data[index], key);
+#else
+			// Highest face index wins ties, so the result does not depend on scheduling.
+			if (key == distances.data[index]) {
+				atomicMax(dst_seeds.data[index], face);
+			}
+#endif
+		}
+	}
+
+#else
+	ivec3 cell = ivec3(gl_GlobalInvocationID.xyz);
+	if (any(greaterThanEqual(cell, params.size))) {
+		return;
+	}
+
+	uint index = cell_index(cell);
+	vec3 pos = cell_position(cell);
+	uint best_face = src_seeds.data[index];
+
+#ifdef MODE_JUMP_FLOOD
+	float best_distance = best_face != NO_FACE ? face_distance(pos, best_face) : 1e20;
+
+	for (int i = 0; i < 27; i++) {
+		ivec3 neighbor = cell + (ivec3(i % 3, (i / 3) % 3, i / 9) - 1) * params.step;
+		if (i == 13 || any(lessThan(neighbor, ivec3(0))) || any(greaterThanEqual(neighbor, params.size))) {
+			continue;
+		}
+		uint face = src_seeds.data[cell_index(neighbor)];
+		if (face == NO_FACE || face == best_face) {
+			continue;
+		}
+		float d = face_distance(pos, face);
+		if (d < best_distance) {
+			best_distance = d;
+			best_face = face;
+		}
+	}
+
+	dst_seeds.data[index] = best_face;
+#endif
+
+#ifdef MODE_STORE
+	cells.data[index] = best_face != NO_FACE ? face_distance(pos, best_face) : 1e20;
+#endif
+
+#endif
+}
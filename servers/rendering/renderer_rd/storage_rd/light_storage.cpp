@@ -463,12 +463,55 @@ void LightStorage::light_instance_free(RID p_light) {
 		shadow_atlas->shadow_owners.erase(p_light);
 	}
 
+	for (const LightInstance::StaticShadowCache &cache : light_instance->static_shadow_cache) {
+		if (cache.texture.is_valid()) {
+			RD::get_singleton()->free(cache.texture);
+		}
+	}
+
 	if (light_instance->light_type != RS::LIGHT_DIRECTIONAL) {
 		ForwardIDStorage::get_singleton()->free_forward_id(light_instance->light_type == RS::LIGHT_OMNI ? FORWARD_ID_TYPE_OMNI_LIGHT : FORWARD_ID_TYPE_SPOT_LIGHT, light_instance->forward_id);
 	}
 	light_instance_owner.free(p_light);
 }
 
+bool LightStorage::light_instance_update_static_shadow_cache(RID p_light_instance, int p_pass, const Size2i &p_size, RD::DataFormat p_format, const Projection &p_camera, const Transform3D &p_transform) {
+	LightInstance *light_instance = light_instance_owner.get_or_null(p_light_instance);
+	ERR_FAIL_COND_V(!light_instance, false);
+	ERR_FAIL_INDEX_V(p_pass, 4, false);
+
+	LightInstance::StaticShadowCache &cache = light_instance->static_shadow_cache[p_pass];
+
+	if (cache.texture.is_valid() && (cache.size != p_size || cache.format != p_format)) {
+		RD::get_singleton()->free(cache.texture);
+		cache.texture = RID();
+	}
+
+	if (cache.texture.is_null()) {
+		RD::TextureFormat tf;
+		tf.format = p_format;
+		tf.width = p_size.width;
+		tf.height = p_size.height;
+		tf.usage_bits = RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | RD::TEXTURE_USAGE_CAN_COPY_FROM_BIT | RD::TEXTURE_USAGE_CAN_COPY_TO_BIT;
+
+		cache.texture = RD::get_singleton()->texture_create(tf, RD::TextureView());
+		RD::get_singleton()->set_resource_name(cache.texture, "Static Shadow Cache");
+		cache.size = p_size;
+		cache.format = p_format;
+		cache.camera = p_camera;
+		cache.transform = p_transform;
+		return false;
+	}
+
+	if (cache.camera != p_camera || cache.transform != p_transform) {
+		cache.camera = p_camera;
+		cache.transform = p_transform;
+		return false;
+	}
+
+	return true;
+}
+
 void LightStorage::light_instance_set_transform(RID p_light_instance, const Transform3D &p_transform) {
 	LightInstance *light_instance = light_instance_owner.get_or_null(p_light_instance);
 	ERR_FAIL_COND(!light_instance);
@@ -1526,7 +1569,7 @@ bool LightStorage::reflection_probe_instance_postprocess_step(RID p_instance) {
 	if (!atlas || rpi->atlas_index == -1) {
 		//does not belong to an atlas anymore, cancel (was removed from atlas or atlas changed while rendering)
 		rpi->rendering = false;
-		return false;
+		return true;
 	}
 
 	if (LightStorage::get_singleton()->reflection_probe_get_update_mode(rpi->probe) == RS::REFLECTION_PROBE_UPDATE_ALWAYS) {
@@ -1961,7 +2004,7 @@ void LightStorage::_update_shadow_atlas(ShadowAtlas *shadow_atlas) {
 		tf.format = shadow_atlas->use_16_bits ? RD::DATA_FORMAT_D16_UNORM : RD::DATA_FORMAT_D32_SFLOAT;
 		tf.width = shadow_atlas->size;
 		tf.height = shadow_atlas->size;
-		tf.usage_bits = RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+		tf.usage_bits = RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | RD::TEXTURE_USAGE_CAN_COPY_FROM_BIT | RD::TEXTURE_USAGE_CAN_COPY_TO_BIT;
 
 		shadow_atlas->depth = RD::get_singleton()->texture_create(tf, RD::TextureView());
 		Vector<RID> fb_tex;
@@ -2354,7 +2397,7 @@ void LightStorage::update_directional_shadow_atlas() {
 		tf.format = directional_shadow.use_16_bits ? RD::DATA_FORMAT_D16_UNORM : RD::DATA_FORMAT_D32_SFLOAT;
 		tf.width = directional_shadow.size;
 		tf.height = directional_shadow.size;
-		tf.usage_bits = RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+		tf.usage_bits = RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | RD::TEXTURE_USAGE_CAN_COPY_FROM_BIT | RD::TEXTURE_USAGE_CAN_COPY_TO_BIT;
 
 		directional_shadow.depth = RD::get_singleton()->texture_create(tf, RD::TextureView());
 		Vector<RID> fb_tex;
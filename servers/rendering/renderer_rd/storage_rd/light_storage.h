@@ -124,6 +124,17 @@ private:
 
 		Rect2 directional_rect;
 
+		// Depth of the static shadow casters of each pass, kept while the pass matrices don't change.
+		struct StaticShadowCache {
+			RID texture;
+			Size2i size;
+			RD::DataFormat format = RD::DATA_FORMAT_MAX;
+			Projection camera;
+			Transform3D transform;
+		};
+
+		StaticShadowCache static_shadow_cache[4];
+
 		HashSet<RID> shadow_atlases; //shadow atlases where this light is registered
 
 		ForwardID forward_id = -1;
@@ -760,6 +771,12 @@ public:
 		return li->directional_rect;
 	}
 
+	bool light_instance_update_static_shadow_cache(RID p_light_instance, int p_pass, const Size2i &p_size, RD::DataFormat p_format, const Projection &p_camera, const Transform3D &p_transform);
+	_FORCE_INLINE_ RID light_instance_get_static_shadow_cache(RID p_light_instance, int p_pass) {
+		LightInstance *li = light_instance_owner.get_or_null(p_light_instance);
+		return li->static_shadow_cache[p_pass].texture;
+	}
+
 	/* LIGHT DATA */
 
 	void free_light_data();
@@ -2391,6 +2391,33 @@ void MaterialStorage::material_get_instance_shader_parameters(RID p_material, Li
 	}
 }
 
+void MaterialStorage::material_get_textures(RID p_material, LocalVector<RID> &r_textures) {
+	Material *material = material_owner.get_or_null(p_material);
+	ERR_FAIL_COND(!material);
+
+	TextureStorage *texture_storage = TextureStorage::get_singleton();
+	for (const KeyValue<StringName, Variant> &E : material->params) {
+		if (E.value.get_type() == Variant::RID) {
+			RID texture = E.value;
+			if (texture_storage->owns_texture(texture)) {
+				r_textures.push_back(texture);
+			}
+		} else if (E.value.get_type() == Variant::ARRAY) {
+			Array array = E.value;
+			for (int i = 0; i < array.size(); i++) {
+				RID texture = array[i];
+				if (texture_storage->owns_texture(texture)) {
+					r_textures.push_back(texture);
+				}
+			}
+		}
+	}
+
+	if (material->next_pass.is_valid()) {
+		material_get_textures(material->next_pass, r_textures);
+	}
+}
+
 void MaterialStorage::material_update_dependency(RID p_material, DependencyTracker *p_instance) {
 	Material *material = material_owner.get_or_null(p_material);
 	ERR_FAIL_COND(!material);
@@ -2400,6 +2427,13 @@ void MaterialStorage::material_update_dependency(RID p_material, DependencyTrack
 	}
 }
 
+void MaterialStorage::material_data_queue_update(MaterialData *p_material_data) {
+	Material *material = material_owner.get_or_null(p_material_data->self);
+	ERR_FAIL_COND(!material);
+	material->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_MATERIAL);
+	_material_queue_update(material, true, true);
+}
+
 Vector<RD::Uniform> MaterialStorage::get_default_sampler_uniforms(int first_index) {
 	Vector<RD::Uniform> uniforms;
 
@@ -419,8 +419,11 @@ public:
 	virtual bool material_casts_shadows(RID p_material) override;
 
 	virtual void material_get_instance_shader_parameters(RID p_material, List<InstanceShaderParam> *r_parameters) override;
+	virtual void material_get_textures(RID p_material, LocalVector<RID> &r_textures) override;
 
 	virtual void material_update_dependency(RID p_material, DependencyTracker *p_instance) override;
+	// For shader data that can only update its materials later, such as when the shader is compiled asynchronously.
+	void material_data_queue_update(MaterialData *p_material_data);
 
 	void material_set_data_request_function(ShaderType p_shader_type, MaterialDataRequestFunction p_function);
 	MaterialDataRequestFunction material_get_data_request_function(ShaderType p_shader_type);
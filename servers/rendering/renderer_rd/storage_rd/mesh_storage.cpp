@@ -30,6 +30,8 @@
 
 #include "mesh_storage.h"
 
+#include "core/config/project_settings.h"
+
 using namespace RendererRD;
 
 MeshStorage *MeshStorage::singleton = nullptr;
@@ -41,6 +43,9 @@ MeshStorage *MeshStorage::get_singleton() {
 MeshStorage::MeshStorage() {
 	singleton = this;
 
+	lod_streaming.enabled = GLOBAL_GET("rendering/mesh_lod/streaming/enabled");
+	lod_streaming.memory_budget = uint64_t(int(GLOBAL_GET("rendering/mesh_lod/streaming/memory_budget_mb"))) * 1024 * 1024;
+
 	default_rd_storage_buffer = RD::get_singleton()->storage_buffer_create(sizeof(uint32_t) * 4);
 
 	//default rd buffers
@@ -370,17 +375,27 @@ void MeshStorage::mesh_add_surface(RID p_mesh, const RS::SurfaceData &p_surface)
 		s->index_buffer = RD::get_singleton()->index_buffer_create(p_surface.index_count, is_index_16 ? RD::INDEX_BUFFER_FORMAT_UINT16 : RD::INDEX_BUFFER_FORMAT_UINT32, p_surface.index_data, false);
 		s->index_count = p_surface.index_count;
 		s->index_array = RD::get_singleton()->index_array_create(s->index_buffer, 0, s->index_count);
+		s->index_16 = is_index_16;
 		if (p_surface.lods.size()) {
 			s->lods = memnew_arr(Mesh::Surface::LOD, p_surface.lods.size());
 			s->lod_count = p_surface.lods.size();
 
 			for (int i = 0; i < p_surface.lods.size(); i++) {
 				uint32_t indices = p_surface.lods[i].index_data.size() / (is_index_16 ? 2 : 4);
-				s->lods[i].index_buffer = RD::get_singleton()->index_buffer_create(indices, is_index_16 ? RD::INDEX_BUFFER_FORMAT_UINT16 : RD::INDEX_BUFFER_FORMAT_UINT32, p_surface.lods[i].index_data);
-				s->lods[i].index_array = RD::get_singleton()->index_array_create(s->lods[i].index_buffer, 0, indices);
+				if (lod_streaming.enabled) {
+					// Uploaded the first time the LOD gets selected.
+					s->lods[i].index_data = p_surface.lods[i].index_data;
+				} else {
+					s->lods[i].index_buffer = RD::get_singleton()->index_buffer_create(indices, is_index_16 ? RD::INDEX_BUFFER_FORMAT_UINT16 : RD::INDEX_BUFFER_FORMAT_UINT32, p_surface.lods[i].index_data);
+					s->lods[i].index_array = RD::get_singleton()->index_array_create(s->lods[i].index_buffer, 0, indices);
+				}
 				s->lods[i].edge_length = p_surface.lods[i].edge_length;
 				s->lods[i].index_count = indices;
 			}
+
+			if (lod_streaming.enabled) {
+				lod_streaming.surfaces.insert(s);
+			}
 		}
 	}
 
@@ -563,7 +578,11 @@ RS::SurfaceData MeshStorage::mesh_get_surface(RID p_mesh, int p_surface) const {
 	for (uint32_t i = 0; i < s.lod_count; i++) {
 		RS::SurfaceData::LOD lod;
 		lod.edge_length = s.lods[i].edge_length;
-		lod.index_data = RD::get_singleton()->buffer_get_data(s.lods[i].index_buffer);
+		if (s.lods[i].index_buffer.is_valid()) {
+			lod.index_data = RD::get_singleton()->buffer_get_data(s.lods[i].index_buffer);
+		} else {
+			lod.index_data = s.lods[i].index_data;
+		}
 		sd.lods.push_back(lod);
 	}
 
@@ -753,7 +772,18 @@ void MeshStorage::mesh_clear(RID p_mesh) {
 
 		if (s.lod_count) {
 			for (uint32_t j = 0; j < s.lod_count; j++) {
-				RD::get_singleton()->free(s.lods[j].index_buffer);
+				if (s.lods[j].index_buffer.is_valid()) {
+					_mesh_surface_lod_evict(&s.lods[j]);
+				}
+			}
+			if (lod_streaming.enabled) {
+				lod_streaming.surfaces.erase(&s);
+				for (uint32_t j = 0; j < lod_streaming.requests.size(); j++) {
+					if (lod_streaming.requests[j].surface == &s) {
+						lod_streaming.requests.remove_at_unordered(j);
+						j--;
+					}
+				}
 			}
 			memdelete_arr(s.lods);
 		}
@@ -946,6 +976,67 @@ void MeshStorage::mesh_instance_set_canvas_item_transform(RID p_mesh_instance, c
 	mi->canvas_item_transform_2d = p_transform;
 }
 
+void MeshStorage::_mesh_surface_lod_make_resident(Mesh::Surface *p_surface, Mesh::Surface::LOD *p_lod) {
+	p_lod->index_buffer = RD::get_singleton()->index_buffer_create(p_lod->index_count, p_surface->index_16 ? RD::INDEX_BUFFER_FORMAT_UINT16 : RD::INDEX_BUFFER_FORMAT_UINT32, p_lod->index_data);
+	p_lod->index_array = RD::get_singleton()->index_array_create(p_lod->index_buffer, 0, p_lod->index_count);
+	lod_streaming.memory_used += p_lod->index_data.size();
+}
+
+void MeshStorage::_mesh_surface_lod_evict(Mesh::Surface::LOD *p_lod) {
+	RD::get_singleton()->free(p_lod->index_buffer); // Frees the index array as a dependency.
+	p_lod->index_buffer = RID();
+	p_lod->index_array = RID();
+	if (lod_streaming.enabled) {
+		lod_streaming.memory_used -= p_lod->index_data.size();
+	}
+}
+
+void MeshStorage::update_mesh_lod_streaming() {
+	if (!lod_streaming.enabled) {
+		return;
+	}
+
+	lod_streaming.frame++;
+
+	for (const MeshLODStreaming::Request &request : lod_streaming.requests) {
+		Mesh::Surface::LOD *lod = &request.surface->lods[request.lod];
+		lod->requested = false;
+		if (lod->index_buffer.is_null()) {
+			_mesh_surface_lod_make_resident(request.surface, lod);
+		}
+	}
+	lod_streaming.requests.clear();
+
+	if (lod_streaming.memory_budget == 0 || lod_streaming.memory_used <= lod_streaming.memory_budget) {
+		return;
+	}
+
+	// Over budget, evict the least recently used LODs that haven't been drawn for a while.
+	struct EvictCandidate {
+		Mesh::Surface::LOD *lod = nullptr;
+		bool operator<(const EvictCandidate &p_other) const {
+			return lod->last_used_frame < p_other.lod->last_used_frame;
+		}
+	};
+
+	LocalVector<EvictCandidate> candidates;
+	for (Mesh::Surface *s : lod_streaming.surfaces) {
+		for (uint32_t i = 0; i < s->lod_count; i++) {
+			Mesh::Surface::LOD *lod = &s->lods[i];
+			if (lod->index_buffer.is_valid() && lod->last_used_frame + MESH_LOD_STREAMING_KEEP_FRAMES < lod_streaming.frame) {
+				EvictCandidate candidate;
+				candidate.lod = lod;
+				candidates.push_back(candidate);
+			}
+		}
+	}
+
+	candidates.sort();
+	for (uint32_t i = 0; i < candidates.size() && lod_streaming.memory_used > lod_streaming.memory_budget; i++) {
+		_mesh_surface_lod_evict(candidates[i].lod);
+	}
+}
+
 void MeshStorage::update_mesh_instances() {
 	while (dirty_mesh_instance_weights.first()) {
 		MeshInstance *mi = dirty_mesh_instance_weights.first()->self();
@@ -963,7 +1054,7 @@ void MeshStorage::update_mesh_instances() {
 	//process skeletons and blend shapes
 	uint64_t frame = RSG::rasterizer->get_frame_number();
 	bool uses_motion_vectors = (RSG::viewport->get_num_viewports_with_motion_vectors() > 0);
-	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
+	skinning_jobs.clear();
 
 	while (dirty_mesh_instance_arrays.first()) {
 		MeshInstance *mi = dirty_mesh_instance_arrays.first()->self();
@@ -999,17 +1090,14 @@ void MeshStorage::update_mesh_instances() {
 
 			bool array_is_2d = mi->mesh->surfaces[i]->format & RS::ARRAY_FLAG_USE_2D_VERTICES;
 
-			RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, skeleton_shader.pipeline[array_is_2d ? SkeletonShader::SHADER_MODE_2D : SkeletonShader::SHADER_MODE_3D]);
-
-			RD::get_singleton()->compute_list_bind_uniform_set(compute_list, mi_surface_uniform_set, SkeletonShader::UNIFORM_SET_INSTANCE);
-			RD::get_singleton()->compute_list_bind_uniform_set(compute_list, mi->mesh->surfaces[i]->uniform_set, SkeletonShader::UNIFORM_SET_SURFACE);
-			if (sk && sk->uniform_set_mi.is_valid()) {
-				RD::get_singleton()->compute_list_bind_uniform_set(compute_list, sk->uniform_set_mi, SkeletonShader::UNIFORM_SET_SKELETON);
-			} else {
-				RD::get_singleton()->compute_list_bind_uniform_set(compute_list, skeleton_shader.default_skeleton_uniform_set, SkeletonShader::UNIFORM_SET_SKELETON);
-			}
+			skinning_jobs.push_back(SkinningJob());
+			SkinningJob &job = skinning_jobs[skinning_jobs.size() - 1];
+			job.shader_mode = array_is_2d ? SkeletonShader::SHADER_MODE_2D : SkeletonShader::SHADER_MODE_3D;
+			job.instance_uniform_set = mi_surface_uniform_set;
+			job.surface_uniform_set = mi->mesh->surfaces[i]->uniform_set;
+			job.skeleton_uniform_set = (sk && sk->uniform_set_mi.is_valid()) ? sk->uniform_set_mi : skeleton_shader.default_skeleton_uniform_set;
 
-			SkeletonShader::PushConstant push_constant;
+			SkeletonShader::PushConstant &push_constant = job.push_constant;
 
 			push_constant.has_normal = mi->mesh->surfaces[i]->format & RS::ARRAY_FORMAT_NORMAL;
 			push_constant.has_tangent = mi->mesh->surfaces[i]->format & RS::ARRAY_FORMAT_TANGENT;
@@ -1044,11 +1132,6 @@ void MeshStorage::update_mesh_instances() {
 			push_constant.normalized_blend_shapes = mi->mesh->blend_shape_mode == RS::BLEND_SHAPE_MODE_NORMALIZED;
 			push_constant.pad0 = 0;
 			push_constant.pad1 = 0;
-
-			RD::get_singleton()->compute_list_set_push_constant(compute_list, &push_constant, sizeof(SkeletonShader::PushConstant));
-
-			//dispatch without barrier, so all is done at the same time
-			RD::get_singleton()->compute_list_dispatch_threads(compute_list, push_constant.vertex_count, 1, 1);
 		}
 
 		mi->dirty = false;
@@ -1058,6 +1141,44 @@ void MeshStorage::update_mesh_instances() {
 		dirty_mesh_instance_arrays.remove(&mi->array_update_list);
 	}
 
+	if (skinning_jobs.is_empty()) {
+		return;
+	}
+
+	// Group jobs by pipeline and skeleton, so those are only bound once for all the surfaces sharing them.
+	skinning_jobs.sort_custom<SkinningJobSort>();
+
+	RD::ComputeListID compute_list = RD::get_singleton()->compute_list_begin();
+
+	uint32_t prev_shader_mode = SkeletonShader::SHADER_MODE_MAX;
+	RID prev_skeleton_uniform_set;
+	RID prev_surface_uniform_set;
+
+	for (const SkinningJob &job : skinning_jobs) {
+		if (job.shader_mode != prev_shader_mode) {
+			RD::get_singleton()->compute_list_bind_compute_pipeline(compute_list, skeleton_shader.pipeline[job.shader_mode]);
+			prev_shader_mode = job.shader_mode;
+			// Rebind every set after a pipeline change.
+			prev_skeleton_uniform_set = RID();
+			prev_surface_uniform_set = RID();
+		}
+
+		RD::get_singleton()->compute_list_bind_uniform_set(compute_list, job.instance_uniform_set, SkeletonShader::UNIFORM_SET_INSTANCE);
+		if (job.surface_uniform_set != prev_surface_uniform_set) {
+			RD::get_singleton()->compute_list_bind_uniform_set(compute_list, job.surface_uniform_set, SkeletonShader::UNIFORM_SET_SURFACE);
+			prev_surface_uniform_set = job.surface_uniform_set;
+		}
+		if (job.skeleton_uniform_set != prev_skeleton_uniform_set) {
+			RD::get_singleton()->compute_list_bind_uniform_set(compute_list, job.skeleton_uniform_set, SkeletonShader::UNIFORM_SET_SKELETON);
+			prev_skeleton_uniform_set = job.skeleton_uniform_set;
+		}
+
+		RD::get_singleton()->compute_list_set_push_constant(compute_list, &job.push_constant, sizeof(SkeletonShader::PushConstant));
+
+		//dispatch without barrier, so all is done at the same time
+		RD::get_singleton()->compute_list_dispatch_threads(compute_list, job.push_constant.vertex_count, 1, 1);
+	}
+
 	RD::get_singleton()->compute_list_end();
 }
 
@@ -1432,7 +1553,7 @@ void MeshStorage::multimesh_set_mesh(RID p_multimesh, RID p_mesh) {
 	multimesh->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_MESH);
 }
 
-#define MULTIMESH_DIRTY_REGION_SIZE 512
+#define MULTIMESH_DIRTY_REGION_SIZE 128
 
 void MeshStorage::_multimesh_make_local(MultiMesh *multimesh) const {
 	if (multimesh->data_cache.size() > 0) {
@@ -1522,6 +1643,31 @@ void MeshStorage::_multimesh_mark_dirty(MultiMesh *multimesh, int p_index, bool
 	}
 }
 
+void MeshStorage::_multimesh_mark_range_dirty(MultiMesh *multimesh, int p_from, int p_count, bool p_aabb) {
+	uint32_t region_from = p_from / MULTIMESH_DIRTY_REGION_SIZE;
+	uint32_t region_to = (p_from + p_count - 1) / MULTIMESH_DIRTY_REGION_SIZE;
+#ifdef DEBUG_ENABLED
+	uint32_t data_cache_dirty_region_count = (multimesh->instances - 1) / MULTIMESH_DIRTY_REGION_SIZE + 1;
+	ERR_FAIL_UNSIGNED_INDEX(region_to, data_cache_dirty_region_count); //bug
+#endif
+	for (uint32_t i = region_from; i <= region_to; i++) {
+		if (!multimesh->data_cache_dirty_regions[i]) {
+			multimesh->data_cache_dirty_regions[i] = true;
+			multimesh->data_cache_dirty_region_count++;
+		}
+	}
+
+	if (p_aabb) {
+		multimesh->aabb_dirty = true;
+	}
+
+	if (!multimesh->dirty) {
+		multimesh->dirty_list = multimesh_dirty_list;
+		multimesh_dirty_list = multimesh;
+		multimesh->dirty = true;
+	}
+}
+
 void MeshStorage::_multimesh_mark_all_dirty(MultiMesh *multimesh, bool p_data, bool p_aabb) {
 	if (p_data) {
 		uint32_t data_cache_dirty_region_count = (multimesh->instances - 1) / MULTIMESH_DIRTY_REGION_SIZE + 1;
@@ -1852,6 +1998,35 @@ void MeshStorage::multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_b
 	}
 }
 
+void MeshStorage::multimesh_set_buffer_range(RID p_multimesh, int p_from_instance, const Vector<float> &p_buffer) {
+	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_COND(!multimesh);
+	ERR_FAIL_COND(multimesh->instances == 0);
+	ERR_FAIL_COND_MSG(p_buffer.size() % (int)multimesh->stride_cache != 0, "Buffer size must be a multiple of the per-instance data size.");
+	int instance_count = p_buffer.size() / (int)multimesh->stride_cache;
+	ERR_FAIL_COND(p_from_instance < 0 || p_from_instance + instance_count > multimesh->instances);
+
+	if (instance_count == 0) {
+		return;
+	}
+
+	// Keep a CPU copy so only the dirty regions covering the range get uploaded,
+	// and the AABB can be rebuilt from the whole buffer.
+	_multimesh_make_local(multimesh);
+
+	bool uses_motion_vectors = (RSG::viewport->get_num_viewports_with_motion_vectors() > 0);
+	if (uses_motion_vectors) {
+		_multimesh_enable_motion_vectors(multimesh);
+	}
+
+	_multimesh_update_motion_vectors_data_cache(multimesh);
+
+	float *w = multimesh->data_cache.ptrw();
+	memcpy(w + (multimesh->motion_vectors_current_offset + p_from_instance) * multimesh->stride_cache, p_buffer.ptr(), p_buffer.size() * sizeof(float));
+
+	_multimesh_mark_range_dirty(multimesh, p_from_instance, instance_count, true);
+}
+
 Vector<float> MeshStorage::multimesh_get_buffer(RID p_multimesh) const {
 	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
 	ERR_FAIL_COND_V(!multimesh, Vector<float>());
@@ -1927,18 +2102,27 @@ void MeshStorage::_update_dirty_multimeshes() {
 				uint32_t visible_region_count = visible_instances == 0 ? 0 : (visible_instances - 1) / MULTIMESH_DIRTY_REGION_SIZE + 1;
 
 				uint32_t region_size = multimesh->stride_cache * MULTIMESH_DIRTY_REGION_SIZE * sizeof(float);
-				if (total_dirty_regions > 32 || total_dirty_regions > visible_region_count / 2) {
-					//if there too many dirty regions, or represent the majority of regions, just copy all, else transfer cost piles up too much
+				if (total_dirty_regions > visible_region_count / 2) {
+					//if dirty regions represent the majority of regions, just copy all
 					RD::get_singleton()->buffer_update(multimesh->buffer, buffer_offset * sizeof(float), MIN(visible_region_count * region_size, multimesh->instances * (uint32_t)multimesh->stride_cache * (uint32_t)sizeof(float)), data);
 				} else {
-					//not that many regions? update them all
-					for (uint32_t i = 0; i < visible_region_count; i++) {
-						if (multimesh->data_cache_dirty_regions[i] || multimesh->previous_data_cache_dirty_regions[i]) {
-							uint32_t offset = i * region_size;
-							uint32_t size = multimesh->stride_cache * (uint32_t)multimesh->instances * (uint32_t)sizeof(float);
-							uint32_t region_start_index = multimesh->stride_cache * MULTIMESH_DIRTY_REGION_SIZE * i;
-							RD::get_singleton()->buffer_update(multimesh->buffer, buffer_offset * sizeof(float) + offset, MIN(region_size, size - offset), &data[region_start_index], RD::BARRIER_MASK_NO_BARRIER);
+					//otherwise coalesce consecutive dirty regions, and upload each run with a single copy
+					uint32_t size = multimesh->stride_cache * (uint32_t)multimesh->instances * (uint32_t)sizeof(float);
+					uint32_t i = 0;
+					while (i < visible_region_count) {
+						if (!multimesh->data_cache_dirty_regions[i] && !multimesh->previous_data_cache_dirty_regions[i]) {
+							i++;
+							continue;
 						}
+
+						uint32_t run_from = i;
+						while (i < visible_region_count && (multimesh->data_cache_dirty_regions[i] || multimesh->previous_data_cache_dirty_regions[i])) {
+							i++;
+						}
+
+						uint32_t offset = run_from * region_size;
+						uint32_t region_start_index = multimesh->stride_cache * MULTIMESH_DIRTY_REGION_SIZE * run_from;
+						RD::get_singleton()->buffer_update(multimesh->buffer, buffer_offset * sizeof(float) + offset, MIN((i - run_from) * region_size, size - offset), &data[region_start_index], RD::BARRIER_MASK_NO_BARRIER);
 					}
 					RD::get_singleton()->barrier(RD::BARRIER_MASK_NO_BARRIER, RD::BARRIER_MASK_ALL_BARRIERS);
 				}
@@ -2009,6 +2193,7 @@ void MeshStorage::skeleton_allocate_data(RID p_skeleton, int p_bones, bool p_2d_
 		RD::get_singleton()->free(skeleton->buffer);
 		skeleton->buffer = RID();
 		skeleton->data.clear();
+		skeleton->uploaded_data.clear();
 		skeleton->uniform_set_mi = RID();
 	}
 
@@ -2067,6 +2252,19 @@ void MeshStorage::skeleton_bone_set_transform(RID p_skeleton, int p_bone, const
 	_skeleton_make_dirty(skeleton);
 }
 
+void MeshStorage::skeleton_set_bone_transforms(RID p_skeleton, const Vector<float> &p_data) {
+	Skeleton *skeleton = skeleton_owner.get_or_null(p_skeleton);
+
+	ERR_FAIL_COND(!skeleton);
+	ERR_FAIL_COND(skeleton->use_2d);
+	ERR_FAIL_COND(p_data.size() != skeleton->size * 12);
+
+	// Same layout as skeleton_bone_set_transform, so it can be copied as is.
+	memcpy(skeleton->data.ptrw(), p_data.ptr(), p_data.size() * sizeof(float));
+
+	_skeleton_make_dirty(skeleton);
+}
+
 Transform3D MeshStorage::skeleton_bone_get_transform(RID p_skeleton, int p_bone) const {
 	Skeleton *skeleton = skeleton_owner.get_or_null(p_skeleton);
 
@@ -2148,15 +2346,29 @@ void MeshStorage::_update_dirty_skeletons() {
 	while (skeleton_dirty_list) {
 		Skeleton *skeleton = skeleton_dirty_list;
 
+		bool pose_changed = true;
 		if (skeleton->size) {
-			RD::get_singleton()->buffer_update(skeleton->buffer, 0, skeleton->data.size() * sizeof(float), skeleton->data.ptr());
+			uint32_t data_size = skeleton->data.size() * sizeof(float);
+			if (!skeleton->use_2d && skeleton->uploaded_data.size() == uint32_t(skeleton->data.size()) && memcmp(skeleton->uploaded_data.ptr(), skeleton->data.ptr(), data_size) == 0) {
+				// Bones were set again to the same pose, the skinned vertices from the last update are still valid.
+				// 2D skeletons are always updated, as their base transform is used when skinning.
+				pose_changed = false;
+			} else {
+				RD::get_singleton()->buffer_update(skeleton->buffer, 0, data_size, skeleton->data.ptr());
+				if (!skeleton->use_2d) {
+					skeleton->uploaded_data.resize(skeleton->data.size());
+					memcpy(skeleton->uploaded_data.ptr(), skeleton->data.ptr(), data_size);
+				}
+			}
 		}
 
 		skeleton_dirty_list = skeleton->dirty_list;
 
-		skeleton->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_SKELETON_BONES);
+		if (pose_changed) {
+			skeleton->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_SKELETON_BONES);
 
-		skeleton->version++;
+			skeleton->version++;
+		}
 
 		skeleton->dirty = false;
 		skeleton->dirty_list = nullptr;
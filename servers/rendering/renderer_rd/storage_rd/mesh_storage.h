@@ -111,10 +111,16 @@ private:
 				uint32_t index_count = 0;
 				RID index_buffer;
 				RID index_array;
+
+				// Only used when LODs are streamed, index_buffer is invalid while not resident.
+				Vector<uint8_t> index_data;
+				uint64_t last_used_frame = 0;
+				bool requested = false;
 			};
 
 			LOD *lods = nullptr;
 			uint32_t lod_count = 0;
+			bool index_16 = false;
 
 			AABB aabb;
 
@@ -160,6 +166,31 @@ private:
 
 	mutable RID_Owner<Mesh, true> mesh_owner;
 
+	/* LOD streaming */
+
+	enum {
+		MESH_LOD_STREAMING_KEEP_FRAMES = 120, // Recently used LODs survive going over budget.
+	};
+
+	struct MeshLODStreaming {
+		struct Request {
+			Mesh::Surface *surface = nullptr;
+			uint32_t lod = 0;
+		};
+
+		bool enabled = false;
+		uint64_t memory_budget = 0;
+		uint64_t memory_used = 0;
+		uint64_t frame = 0;
+
+		HashSet<Mesh::Surface *> surfaces;
+		SpinLock request_lock;
+		LocalVector<Request> requests;
+	} mutable lod_streaming;
+
+	void _mesh_surface_lod_make_resident(Mesh::Surface *p_surface, Mesh::Surface::LOD *p_lod);
+	void _mesh_surface_lod_evict(Mesh::Surface::LOD *p_lod);
+
 	/* Mesh Instance API */
 
 	struct MeshInstance {
@@ -245,6 +276,7 @@ private:
 	_FORCE_INLINE_ void _multimesh_enable_motion_vectors(MultiMesh *multimesh);
 	_FORCE_INLINE_ void _multimesh_update_motion_vectors_data_cache(MultiMesh *multimesh);
 	_FORCE_INLINE_ void _multimesh_mark_dirty(MultiMesh *multimesh, int p_index, bool p_aabb);
+	_FORCE_INLINE_ void _multimesh_mark_range_dirty(MultiMesh *multimesh, int p_from, int p_count, bool p_aabb);
 	_FORCE_INLINE_ void _multimesh_mark_all_dirty(MultiMesh *multimesh, bool p_data, bool p_aabb);
 	_FORCE_INLINE_ void _multimesh_re_create_aabb(MultiMesh *multimesh, const float *p_data, int p_instances);
 
@@ -295,10 +327,33 @@ private:
 		RID default_skeleton_uniform_set;
 	} skeleton_shader;
 
+	struct SkinningJob {
+		uint32_t shader_mode = SkeletonShader::SHADER_MODE_3D;
+		RID instance_uniform_set;
+		RID surface_uniform_set;
+		RID skeleton_uniform_set;
+		SkeletonShader::PushConstant push_constant;
+	};
+
+	struct SkinningJobSort {
+		_FORCE_INLINE_ bool operator()(const SkinningJob &p_a, const SkinningJob &p_b) const {
+			if (p_a.shader_mode != p_b.shader_mode) {
+				return p_a.shader_mode < p_b.shader_mode;
+			}
+			if (p_a.skeleton_uniform_set != p_b.skeleton_uniform_set) {
+				return p_a.skeleton_uniform_set < p_b.skeleton_uniform_set;
+			}
+			return p_a.surface_uniform_set < p_b.surface_uniform_set;
+		}
+	};
+
+	LocalVector<SkinningJob> skinning_jobs;
+
 	struct Skeleton {
 		bool use_2d = false;
 		int size = 0;
 		Vector<float> data;
+		LocalVector<float> uploaded_data; // Last pose uploaded to the buffer (3D only), to skip re-skinning when it doesn't change.
 		RID buffer;
 
 		bool dirty = false;
@@ -421,6 +476,14 @@ public:
 		return s->index_count ? s->index_count : s->vertex_count;
 	}
 
+	_FORCE_INLINE_ uint32_t mesh_surface_get_lod_vertices_drawn_count(void *p_surface, uint32_t p_lod) const {
+		Mesh::Surface *s = reinterpret_cast<Mesh::Surface *>(p_surface);
+		if (p_lod == 0) {
+			return s->index_count ? s->index_count : s->vertex_count;
+		}
+		return s->lods[p_lod - 1].index_count;
+	}
+
 	_FORCE_INLINE_ uint32_t mesh_surface_get_lod(void *p_surface, float p_model_scale, float p_distance_threshold, float p_mesh_lod_threshold, uint32_t &r_index_count) const {
 		Mesh::Surface *s = reinterpret_cast<Mesh::Surface *>(p_surface);
 
@@ -433,6 +496,33 @@ public:
 			}
 			current_lod = i;
 		}
+
+		if (lod_streaming.enabled && current_lod != -1) {
+			Mesh::Surface::LOD *lod = &s->lods[current_lod];
+			lod->last_used_frame = lod_streaming.frame;
+			if (lod->index_buffer.is_null()) {
+				if (!lod->requested) {
+					lod_streaming.request_lock.lock();
+					if (!lod->requested) {
+						lod->requested = true;
+						MeshLODStreaming::Request request;
+						request.surface = s;
+						request.lod = current_lod;
+						lod_streaming.requests.push_back(request);
+					}
+					lod_streaming.request_lock.unlock();
+				}
+
+				// Draw the closest more detailed LOD that is resident until this one is uploaded.
+				while (current_lod != -1 && s->lods[current_lod].index_buffer.is_null()) {
+					current_lod--;
+				}
+				if (current_lod != -1) {
+					s->lods[current_lod].last_used_frame = lod_streaming.frame;
+				}
+			}
+		}
+
 		if (current_lod == -1) {
 			return 0;
 		} else {
@@ -587,6 +677,7 @@ public:
 	virtual void mesh_instance_check_for_update(RID p_mesh_instance) override;
 	virtual void mesh_instance_set_canvas_item_transform(RID p_mesh_instance, const Transform2D &p_transform) override;
 	virtual void update_mesh_instances() override;
+	void update_mesh_lod_streaming();
 
 	/* MULTIMESH API */
 
@@ -613,6 +704,7 @@ public:
 	virtual Color multimesh_instance_get_custom_data(RID p_multimesh, int p_index) const override;
 
 	virtual void multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_buffer) override;
+	virtual void multimesh_set_buffer_range(RID p_multimesh, int p_from_instance, const Vector<float> &p_buffer) override;
 	virtual Vector<float> multimesh_get_buffer(RID p_multimesh) const override;
 
 	virtual void multimesh_set_visible_instances(RID p_multimesh, int p_visible) override;
@@ -638,6 +730,25 @@ public:
 		return multimesh->uses_custom_data;
 	}
 
+	_FORCE_INLINE_ bool multimesh_uses_motion_vectors(RID p_multimesh) const {
+		MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+		return multimesh->motion_vectors_enabled;
+	}
+
+	// Stride of one instance in the storage buffer, in floats.
+	_FORCE_INLINE_ uint32_t multimesh_get_stride(RID p_multimesh) const {
+		MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+		return multimesh->stride_cache;
+	}
+
+	_FORCE_INLINE_ RID multimesh_get_storage_buffer(RID p_multimesh) const {
+		MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+		if (multimesh == nullptr) {
+			return RID();
+		}
+		return multimesh->buffer;
+	}
+
 	_FORCE_INLINE_ uint32_t multimesh_get_instances_to_draw(RID p_multimesh) const {
 		MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
 		if (multimesh->visible_instances >= 0) {
@@ -702,6 +813,7 @@ public:
 	virtual void skeleton_set_base_transform_2d(RID p_skeleton, const Transform2D &p_base_transform) override;
 	virtual int skeleton_get_bone_count(RID p_skeleton) const override;
 	virtual void skeleton_bone_set_transform(RID p_skeleton, int p_bone, const Transform3D &p_transform) override;
+	virtual void skeleton_set_bone_transforms(RID p_skeleton, const Vector<float> &p_data) override;
 	virtual Transform3D skeleton_bone_get_transform(RID p_skeleton, int p_bone) const override;
 	virtual void skeleton_bone_set_transform_2d(RID p_skeleton, int p_bone, const Transform2D &p_transform) override;
 	virtual Transform2D skeleton_bone_get_transform_2d(RID p_skeleton, int p_bone) const override;
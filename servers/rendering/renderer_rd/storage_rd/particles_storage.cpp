@@ -188,6 +188,10 @@ ParticlesStorage::~ParticlesStorage() {
 
 	particles_shader.copy_shader.version_free(particles_shader.copy_shader_version);
 
+	if (sdf_bake_shader.shader_version.is_valid()) {
+		sdf_bake_shader.shader.version_free(sdf_bake_shader.shader_version);
+	}
+
 	material_storage->material_free(particles_shader.default_material);
 	material_storage->shader_free(particles_shader.default_shader);
 
@@ -1144,6 +1148,8 @@ void ParticlesStorage::particles_set_view_axis(RID p_particles, const Vector3 &p
 	Particles *particles = particles_owner.get_or_null(p_particles);
 	ERR_FAIL_COND(!particles);
 
+	sync_particles_update();
+
 	if (particles->draw_order != RS::PARTICLES_DRAW_ORDER_VIEW_DEPTH && particles->transform_align != RS::PARTICLES_TRANSFORM_ALIGN_Z_BILLBOARD && particles->transform_align != RS::PARTICLES_TRANSFORM_ALIGN_Z_BILLBOARD_Y_TO_VELOCITY) {
 		return;
 	}
@@ -1343,8 +1349,17 @@ void ParticlesStorage::_particles_update_buffers(Particles *particles) {
 	}
 }
 void ParticlesStorage::update_particles() {
+	if (!particle_update_list) {
+		return;
+	}
+
 	uint32_t frame = RSG::rasterizer->get_frame_number();
 	bool uses_motion_vectors = RSG::viewport->get_num_viewports_with_motion_vectors() > 0;
+
+	// Simulation only dispatches compute and updates buffers, so it can overlap the graphics work recorded until the particles are drawn.
+	RD::get_singleton()->async_compute_begin();
+	async_update_pending = true;
+
 	while (particle_update_list) {
 		//use transform feedback to process particles
 
@@ -1578,6 +1593,17 @@ void ParticlesStorage::update_particles() {
 
 		particles->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_AABB);
 	}
+
+	RD::get_singleton()->async_compute_end();
+}
+
+void ParticlesStorage::sync_particles_update() {
+	if (!async_update_pending) {
+		return;
+	}
+
+	RD::get_singleton()->async_compute_sync();
+	async_update_pending = false;
 }
 
 Dependency *ParticlesStorage::particles_get_dependency(RID p_particles) const {
@@ -1713,13 +1739,37 @@ void ParticlesStorage::particles_collision_initialize(RID p_rid) {
 void ParticlesStorage::particles_collision_free(RID p_rid) {
 	ParticlesCollision *particles_collision = particles_collision_owner.get_or_null(p_rid);
 
-	if (particles_collision->heightfield_texture.is_valid()) {
-		RD::get_singleton()->free(particles_collision->heightfield_texture);
-	}
+	_particles_collision_free_heightfield(particles_collision);
 	particles_collision->dependency.deleted_notify(p_rid);
 	particles_collision_owner.free(p_rid);
 }
 
+RID ParticlesStorage::_particles_collision_create_heightfield_texture(const Size2i &p_size) const {
+	RD::TextureFormat tf;
+	tf.format = RD::DATA_FORMAT_D32_SFLOAT;
+	tf.width = p_size.x;
+	tf.height = p_size.y;
+	tf.texture_type = RD::TEXTURE_TYPE_2D;
+	tf.usage_bits = RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | RD::TEXTURE_USAGE_CAN_COPY_FROM_BIT | RD::TEXTURE_USAGE_CAN_COPY_TO_BIT;
+
+	return RD::get_singleton()->texture_create(tf, RD::TextureView());
+}
+
+void ParticlesStorage::_particles_collision_free_heightfield(ParticlesCollision *p_particles_collision) {
+	// Framebuffers are freed along with their textures.
+	if (p_particles_collision->heightfield_texture.is_valid()) {
+		RD::get_singleton()->free(p_particles_collision->heightfield_texture);
+		p_particles_collision->heightfield_texture = RID();
+		p_particles_collision->heightfield_fb = RID();
+	}
+	if (p_particles_collision->heightfield_back_texture.is_valid()) {
+		RD::get_singleton()->free(p_particles_collision->heightfield_back_texture);
+		p_particles_collision->heightfield_back_texture = RID();
+		p_particles_collision->heightfield_back_fb = RID();
+	}
+	p_particles_collision->heightfield_dirty = true;
+}
+
 RID ParticlesStorage::particles_collision_get_heightfield_framebuffer(RID p_particles_collision) const {
 	ParticlesCollision *particles_collision = particles_collision_owner.get_or_null(p_particles_collision);
 	ERR_FAIL_COND_V(!particles_collision, RID());
@@ -1737,14 +1787,7 @@ RID ParticlesStorage::particles_collision_get_heightfield_framebuffer(RID p_part
 			size.x = int32_t(particles_collision->extents.x / particles_collision->extents.z * size.y);
 		}
 
-		RD::TextureFormat tf;
-		tf.format = RD::DATA_FORMAT_D32_SFLOAT;
-		tf.width = size.x;
-		tf.height = size.y;
-		tf.texture_type = RD::TEXTURE_TYPE_2D;
-		tf.usage_bits = RD::TEXTURE_USAGE_SAMPLING_BIT | RD::TEXTURE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
-
-		particles_collision->heightfield_texture = RD::get_singleton()->texture_create(tf, RD::TextureView());
+		particles_collision->heightfield_texture = _particles_collision_create_heightfield_texture(size);
 
 		Vector<RID> fb_tex;
 		fb_tex.push_back(particles_collision->heightfield_texture);
@@ -1755,6 +1798,72 @@ RID ParticlesStorage::particles_collision_get_heightfield_framebuffer(RID p_part
 	return particles_collision->heightfield_fb;
 }
 
+bool ParticlesStorage::particles_collision_heightfield_scroll(RID p_particles_collision, const Transform3D &p_transform, Vector<Rect2i> &r_dirty_rects) {
+	ParticlesCollision *particles_collision = particles_collision_owner.get_or_null(p_particles_collision);
+	ERR_FAIL_COND_V(!particles_collision, false);
+	ERR_FAIL_COND_V(particles_collision->type != RS::PARTICLES_COLLISION_TYPE_HEIGHTFIELD_COLLIDE, false);
+
+	r_dirty_rects.clear();
+
+	Transform3D prev_transform = particles_collision->heightfield_transform;
+	particles_collision->heightfield_transform = p_transform;
+
+	if (particles_collision->heightfield_dirty || particles_collision->heightfield_texture.is_null()) {
+		particles_collision->heightfield_dirty = false;
+		return false;
+	}
+
+	// Only a move along the X and Z axes of the collider keeps the stored depths valid.
+	if (!p_transform.basis.is_equal_approx(prev_transform.basis)) {
+		return false;
+	}
+
+	Vector3 delta = p_transform.origin - prev_transform.origin;
+	Vector3 scale = p_transform.basis.get_scale();
+	Vector3 extents = particles_collision->extents * scale;
+	if (!Math::is_zero_approx(p_transform.basis.get_column(Vector3::AXIS_Y).normalized().dot(delta))) {
+		return false;
+	}
+
+	Size2i size = particles_collision->heightfield_fb_size;
+	Vector2 shift_f = Vector2(
+			p_transform.basis.get_column(Vector3::AXIS_X).normalized().dot(delta) / (extents.x * 2.0) * size.x,
+			p_transform.basis.get_column(Vector3::AXIS_Z).normalized().dot(delta) / (extents.z * 2.0) * size.y);
+	Vector2i shift = Vector2i(Math::round(shift_f.x), Math::round(shift_f.y));
+
+	if (Math::abs(shift_f.x - shift.x) > 0.01 || Math::abs(shift_f.y - shift.y) > 0.01 || ABS(shift.x) >= size.x || ABS(shift.y) >= size.y) {
+		return false;
+	}
+	if (shift == Vector2i()) {
+		return true; // Nothing moved, nothing to render.
+	}
+
+	if (particles_collision->heightfield_back_texture.is_null()) {
+		particles_collision->heightfield_back_texture = _particles_collision_create_heightfield_texture(size);
+		Vector<RID> fb_tex;
+		fb_tex.push_back(particles_collision->heightfield_back_texture);
+		particles_collision->heightfield_back_fb = RD::get_singleton()->framebuffer_create(fb_tex);
+	}
+
+	// The texel at the new position U was at U + shift in the old heightfield.
+	Vector2i copy_size = size - shift.abs();
+	RD::get_singleton()->texture_copy(particles_collision->heightfield_texture, particles_collision->heightfield_back_texture, Vector3(MAX(shift.x, 0), MAX(shift.y, 0), 0), Vector3(MAX(-shift.x, 0), MAX(-shift.y, 0), 0), Vector3(copy_size.x, copy_size.y, 1), 0, 0, 0, 0);
+
+	SWAP(particles_collision->heightfield_texture, particles_collision->heightfield_back_texture);
+	SWAP(particles_collision->heightfield_fb, particles_collision->heightfield_back_fb);
+
+	if (shift.x != 0) {
+		r_dirty_rects.push_back(Rect2i(shift.x > 0 ? size.x - shift.x : 0, 0, ABS(shift.x), size.y));
+	}
+	if (shift.y != 0) {
+		// Skip the corner already covered by the column above.
+		int from_x = shift.x > 0 ? 0 : -shift.x;
+		r_dirty_rects.push_back(Rect2i(from_x, shift.y > 0 ? size.y - shift.y : 0, size.x - ABS(shift.x), ABS(shift.y)));
+	}
+
+	return true;
+}
+
 void ParticlesStorage::particles_collision_set_collision_type(RID p_particles_collision, RS::ParticlesCollisionType p_type) {
 	ParticlesCollision *particles_collision = particles_collision_owner.get_or_null(p_particles_collision);
 	ERR_FAIL_COND(!particles_collision);
@@ -1763,10 +1872,7 @@ void ParticlesStorage::particles_collision_set_collision_type(RID p_particles_co
 		return;
 	}
 
-	if (particles_collision->heightfield_texture.is_valid()) {
-		RD::get_singleton()->free(particles_collision->heightfield_texture);
-		particles_collision->heightfield_texture = RID();
-	}
+	_particles_collision_free_heightfield(particles_collision);
 	particles_collision->type = p_type;
 	particles_collision->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_AABB);
 }
@@ -1790,6 +1896,7 @@ void ParticlesStorage::particles_collision_set_box_extents(RID p_particles_colli
 	ERR_FAIL_COND(!particles_collision);
 
 	particles_collision->extents = p_extents;
+	particles_collision->heightfield_dirty = true;
 	particles_collision->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_AABB);
 }
 
@@ -1824,6 +1931,7 @@ void ParticlesStorage::particles_collision_set_field_texture(RID p_particles_col
 void ParticlesStorage::particles_collision_height_field_update(RID p_particles_collision) {
 	ParticlesCollision *particles_collision = particles_collision_owner.get_or_null(p_particles_collision);
 	ERR_FAIL_COND(!particles_collision);
+	particles_collision->heightfield_dirty = true;
 	particles_collision->dependency.changed_notify(Dependency::DEPENDENCY_CHANGED_AABB);
 }
 
@@ -1838,10 +1946,7 @@ void ParticlesStorage::particles_collision_set_height_field_resolution(RID p_par
 
 	particles_collision->heightfield_resolution = p_resolution;
 
-	if (particles_collision->heightfield_texture.is_valid()) {
-		RD::get_singleton()->free(particles_collision->heightfield_texture);
-		particles_collision->heightfield_texture = RID();
-	}
+	_particles_collision_free_heightfield(particles_collision);
 }
 
 AABB ParticlesStorage::particles_collision_get_aabb(RID p_particles_collision) const {
@@ -1877,6 +1982,131 @@ bool ParticlesStorage::particles_collision_is_heightfield(RID p_particles_collis
 	return particles_collision->type == RS::PARTICLES_COLLISION_TYPE_HEIGHTFIELD_COLLIDE;
 }
 
+Vector<uint8_t> ParticlesStorage::particles_collision_bake_sdf(const Vector<Vector3> &p_faces, const AABB &p_aabb, const Vector3i &p_size, float p_thickness) {
+	ERR_FAIL_COND_V(p_faces.is_empty() || p_faces.size() % 3 != 0, Vector<uint8_t>());
+	ERR_FAIL_COND_V(p_size.x <= 0 || p_size.y <= 0 || p_size.z <= 0, Vector<uint8_t>());
+
+	RD *rd = RD::get_singleton();
+
+	// Leave larger volumes to the CPU bake, 2^27 bytes is the storage buffer range every Vulkan device supports.
+	uint32_t face_count = p_faces.size() / 3;
+	uint64_t cell_count = uint64_t(p_size.x) * p_size.y * p_size.z;
+	const uint64_t max_buffer_size = 1 << 27;
+	if (cell_count * sizeof(uint32_t) > max_buffer_size || uint64_t(face_count) * 3 * sizeof(float) * 4 > max_buffer_size || (face_count + 63) / 64 > rd->limit_get(RD::LIMIT_MAX_COMPUTE_WORKGROUP_COUNT_X)) {
+		return Vector<uint8_t>();
+	}
+
+	if (sdf_bake_shader.shader_version.is_null()) {
+		Vector<String> modes;
+		modes.push_back("\n#define MODE_SEED_DISTANCE\n");
+		modes.push_back("\n#define MODE_SEED_FACE\n");
+		modes.push_back("\n#define MODE_JUMP_FLOOD\n");
+		modes.push_back("\n#define MODE_STORE\n");
+
+		sdf_bake_shader.shader.initialize(modes);
+		sdf_bake_shader.shader_version = sdf_bake_shader.shader.version_create();
+		for (int i = 0; i < SDFBakeShader::MODE_MAX; i++) {
+			sdf_bake_shader.pipelines[i] = rd->compute_pipeline_create(sdf_bake_shader.shader.version_get_shader(sdf_bake_shader.shader_version, i));
+		}
+	}
+
+	Vector<uint8_t> face_data;
+	face_data.resize(face_count * 3 * 4 * sizeof(float));
+	{
+		float *w = (float *)face_data.ptrw();
+		for (int i = 0; i < p_faces.size(); i++) {
+			w[i * 4 + 0] = p_faces[i].x;
+			w[i * 4 + 1] = p_faces[i].y;
+			w[i * 4 + 2] = p_faces[i].z;
+			w[i * 4 + 3] = 0.0;
+		}
+	}
+
+	uint32_t cells_size = cell_count * sizeof(uint32_t);
+	RID faces_buffer = rd->storage_buffer_create(face_data.size(), face_data);
+	RID distances_buffer = rd->storage_buffer_create(cells_size);
+	RID seed_buffers[2] = { rd->storage_buffer_create(cells_size), rd->storage_buffer_create(cells_size) };
+	RID cells_buffer = rd->storage_buffer_create(cells_size);
+
+	// The shader treats zero as no distance and no face.
+	rd->buffer_clear(distances_buffer, 0, cells_size);
+	rd->buffer_clear(seed_buffers[0], 0, cells_size);
+	rd->buffer_clear(seed_buffers[1], 0, cells_size);
+
+	// Seeds are read from the first buffer of a set and written to the second, one set for each direction.
+	RID uniform_sets[2];
+	for (int i = 0; i < 2; i++) {
+		Vector<RD::Uniform> uniforms;
+		RID buffers[5] = { faces_buffer, distances_buffer, seed_buffers[i], seed_buffers[1 - i], cells_buffer };
+		for (int j = 0; j < 5; j++) {
+			RD::Uniform u;
+			u.uniform_type = RD::UNIFORM_TYPE_STORAGE_BUFFER;
+			u.binding = j + 1;
+			u.append_id(buffers[j]);
+			uniforms.push_back(u);
+		}
+		uniform_sets[i] = rd->uniform_set_create(uniforms, sdf_bake_shader.shader.version_get_shader(sdf_bake_shader.shader_version, 0), 0);
+	}
+
+	SDFBakeShader::PushConstant push_constant;
+	push_constant.size[0] = p_size.x;
+	push_constant.size[1] = p_size.y;
+	push_constant.size[2] = p_size.z;
+	push_constant.face_count = face_count;
+	push_constant.cell_size = p_aabb.size.x / p_size.x;
+	push_constant.cell_offset[0] = p_aabb.position.x + push_constant.cell_size * 0.5;
+	push_constant.cell_offset[1] = p_aabb.position.y + push_constant.cell_size * 0.5;
+	push_constant.cell_offset[2] = p_aabb.position.z + push_constant.cell_size * 0.5;
+	push_constant.thickness = p_thickness;
+	push_constant.step = 0;
+	push_constant.pad[0] = 0;
+	push_constant.pad[1] = 0;
+
+	RD::ComputeListID compute_list = rd->compute_list_begin();
+
+	// Exact distances around every face, then the face they came from.
+	for (int i = SDFBakeShader::MODE_SEED_DISTANCE; i <= SDFBakeShader::MODE_SEED_FACE; i++) {
+		rd->compute_list_bind_compute_pipeline(compute_list, sdf_bake_shader.pipelines[i]);
+		rd->compute_list_bind_uniform_set(compute_list, uniform_sets[0], 0);
+		rd->compute_list_set_push_constant(compute_list, &push_constant, sizeof(SDFBakeShader::PushConstant));
+		rd->compute_list_dispatch_threads(compute_list, face_count, p_size.z, 1);
+		rd->compute_list_add_barrier(compute_list);
+	}
+
+	// Halve the step down to one cell, then do one more pass at one cell to fix most of the jump flood errors.
+	int src = 1;
+	int max_size = MAX(p_size.x, MAX(p_size.y, p_size.z));
+	rd->compute_list_bind_compute_pipeline(compute_list, sdf_bake_shader.pipelines[SDFBakeShader::MODE_JUMP_FLOOD]);
+	for (int step = nearest_power_of_2_templated(max_size) / 2; step >= 1; step /= 2) {
+		for (int pass = 0; pass < (step == 1 ? 2 : 1); pass++) {
+			push_constant.step = step;
+			rd->compute_list_bind_uniform_set(compute_list, uniform_sets[src], 0);
+			rd->compute_list_set_push_constant(compute_list, &push_constant, sizeof(SDFBakeShader::PushConstant));
+			rd->compute_list_dispatch_threads(compute_list, p_size.x, p_size.y, p_size.z);
+			rd->compute_list_add_barrier(compute_list);
+			src = 1 - src;
+		}
+	}
+
+	rd->compute_list_bind_compute_pipeline(compute_list, sdf_bake_shader.pipelines[SDFBakeShader::MODE_STORE]);
+	rd->compute_list_bind_uniform_set(compute_list, uniform_sets[src], 0);
+	rd->compute_list_set_push_constant(compute_list, &push_constant, sizeof(SDFBakeShader::PushConstant));
+	rd->compute_list_dispatch_threads(compute_list, p_size.x, p_size.y, p_size.z);
+
+	rd->compute_list_end();
+
+	Vector<uint8_t> cells = rd->buffer_get_data(cells_buffer);
+
+	// Uniform sets are freed along with the buffers.
+	rd->free(faces_buffer);
+	rd->free(distances_buffer);
+	rd->free(seed_buffers[0]);
+	rd->free(seed_buffers[1]);
+	rd->free(cells_buffer);
+
+	return cells;
+}
+
 Dependency *ParticlesStorage::particles_collision_get_dependency(RID p_particles_collision) const {
 	ParticlesCollision *pc = particles_collision_owner.get_or_null(p_particles_collision);
 	ERR_FAIL_NULL_V(pc, nullptr);
@@ -37,6 +37,7 @@
 #include "servers/rendering/renderer_rd/effects/sort_effects.h"
 #include "servers/rendering/renderer_rd/shaders/particles.glsl.gen.h"
 #include "servers/rendering/renderer_rd/shaders/particles_copy.glsl.gen.h"
+#include "servers/rendering/renderer_rd/shaders/particles_sdf_bake.glsl.gen.h"
 #include "servers/rendering/renderer_rd/storage_rd/material_storage.h"
 #include "servers/rendering/shader_compiler.h"
 #include "servers/rendering/storage/particles_storage.h"
@@ -323,6 +324,7 @@ private:
 	} particles_shader;
 
 	Particles *particle_update_list = nullptr;
+	bool async_update_pending = false; // Particles were processed in an async compute batch that was not waited on yet.
 
 	mutable RID_Owner<Particles, true> particles_owner;
 
@@ -390,6 +392,10 @@ private:
 		RID heightfield_texture;
 		RID heightfield_fb;
 		Size2i heightfield_fb_size;
+		RID heightfield_back_texture; // Destination of the copy when the heightfield scrolls, swapped with the front one afterwards.
+		RID heightfield_back_fb;
+		Transform3D heightfield_transform; // Transform the current heightfield contents were rendered with.
+		bool heightfield_dirty = true; // Needs a full redraw.
 
 		RS::ParticlesCollisionHeightfieldResolution heightfield_resolution = RS::PARTICLES_COLLISION_HEIGHTFIELD_RESOLUTION_1024;
 
@@ -406,6 +412,37 @@ private:
 
 	mutable RID_Owner<ParticlesCollisionInstance> particles_collision_instance_owner;
 
+	/* SDF Bake */
+
+	struct SDFBakeShader {
+		enum Mode {
+			MODE_SEED_DISTANCE,
+			MODE_SEED_FACE,
+			MODE_JUMP_FLOOD,
+			MODE_STORE,
+			MODE_MAX,
+		};
+
+		struct PushConstant {
+			int32_t size[3];
+			uint32_t face_count;
+
+			float cell_offset[3];
+			float cell_size;
+
+			float thickness;
+			int32_t step;
+			uint32_t pad[2];
+		};
+
+		ParticlesSdfBakeShaderRD shader;
+		RID shader_version;
+		RID pipelines[MODE_MAX];
+	} sdf_bake_shader; // Only compiled on the first bake.
+
+	RID _particles_collision_create_heightfield_texture(const Size2i &p_size) const;
+	void _particles_collision_free_heightfield(ParticlesCollision *p_particles_collision);
+
 public:
 	static ParticlesStorage *get_singleton();
 
@@ -531,11 +568,24 @@ public:
 
 	void particles_get_instance_buffer_motion_vectors_offsets(RID p_particles, uint32_t &r_current_offset, uint32_t &r_prev_offset);
 
+	_FORCE_INLINE_ RID particles_get_instance_buffer(RID p_particles) {
+		Particles *particles = particles_owner.get_or_null(p_particles);
+		ERR_FAIL_COND_V(!particles, RID());
+		return particles->particle_instance_buffer;
+	}
+
+	_FORCE_INLINE_ bool particles_uses_motion_vectors(RID p_particles) {
+		Particles *particles = particles_owner.get_or_null(p_particles);
+		ERR_FAIL_COND_V(!particles, false);
+		return particles->instance_motion_vectors_enabled;
+	}
+
 	virtual void particles_add_collision(RID p_particles, RID p_particles_collision_instance) override;
 	virtual void particles_remove_collision(RID p_particles, RID p_particles_collision_instance) override;
 	void particles_set_canvas_sdf_collision(RID p_particles, bool p_enable, const Transform2D &p_xform, const Rect2 &p_to_screen, RID p_texture);
 
 	virtual void update_particles() override;
+	void sync_particles_update();
 
 	void particles_update_dependency(RID p_particles, DependencyTracker *p_instance);
 	Dependency *particles_get_dependency(RID p_particles) const;
@@ -561,7 +611,14 @@ public:
 	virtual AABB particles_collision_get_aabb(RID p_particles_collision) const override;
 	Vector3 particles_collision_get_extents(RID p_particles_collision) const;
 	virtual bool particles_collision_is_heightfield(RID p_particles_collision) const override;
+	virtual Vector<uint8_t> particles_collision_bake_sdf(const Vector<Vector3> &p_faces, const AABB &p_aabb, const Vector3i &p_size, float p_thickness) override;
 	RID particles_collision_get_heightfield_framebuffer(RID p_particles_collision) const;
+	bool particles_collision_heightfield_scroll(RID p_particles_collision, const Transform3D &p_transform, Vector<Rect2i> &r_dirty_rects);
+	_FORCE_INLINE_ Size2i particles_collision_get_heightfield_size(RID p_particles_collision) const {
+		ParticlesCollision *particles_collision = particles_collision_owner.get_or_null(p_particles_collision);
+		ERR_FAIL_COND_V(!particles_collision, Size2i());
+		return particles_collision->heightfield_fb_size;
+	}
 
 	Dependency *particles_collision_get_dependency(RID p_particles) const;
 
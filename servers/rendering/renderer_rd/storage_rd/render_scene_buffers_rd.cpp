@@ -32,6 +32,7 @@
 #include "servers/rendering/renderer_rd/renderer_scene_render_rd.h"
 #include "servers/rendering/renderer_rd/storage_rd/material_storage.h"
 #include "servers/rendering/renderer_rd/storage_rd/texture_storage.h"
+#include "servers/rendering/rendering_server_globals.h"
 
 RenderSceneBuffersRD::RenderSceneBuffersRD() {
 }
@@ -83,6 +84,11 @@ void RenderSceneBuffersRD::update_sizes(NamedTexture &p_named_texture) {
 }
 
 void RenderSceneBuffersRD::free_named_texture(NamedTexture &p_named_texture) {
+	if (!p_named_texture.is_unique) {
+		release_transient_texture(p_named_texture);
+		return;
+	}
+
 	if (p_named_texture.texture.is_valid()) {
 		RD::get_singleton()->free(p_named_texture.texture);
 	}
@@ -90,6 +96,82 @@ void RenderSceneBuffersRD::free_named_texture(NamedTexture &p_named_texture) {
 	p_named_texture.slices.clear(); // slices should be freed automatically as dependents...
 }
 
+LocalVector<RenderSceneBuffersRD::TransientTexture> RenderSceneBuffersRD::transient_textures;
+
+void RenderSceneBuffersRD::acquire_transient_texture(NamedTexture &p_named_texture) {
+	if (p_named_texture.texture.is_valid()) {
+		return;
+	}
+
+	TransientTexture *transient = nullptr;
+	for (TransientTexture &E : transient_textures) {
+		if (!E.in_use && E.format == p_named_texture.format) {
+			transient = &E;
+			break;
+		}
+	}
+
+	if (!transient) {
+		transient_textures.push_back(TransientTexture());
+		transient = &transient_textures[transient_textures.size() - 1];
+		transient->format = p_named_texture.format;
+		transient->texture = RD::get_singleton()->texture_create(p_named_texture.format, RD::TextureView());
+		RD::get_singleton()->set_resource_name(transient->texture, "RenderBuffer Transient");
+	}
+
+	transient->in_use = true;
+	p_named_texture.texture = transient->texture;
+	p_named_texture.slices = transient->slices;
+}
+
+void RenderSceneBuffersRD::release_transient_texture(NamedTexture &p_named_texture) {
+	if (p_named_texture.texture.is_null()) {
+		return;
+	}
+
+	for (TransientTexture &E : transient_textures) {
+		if (E.texture == p_named_texture.texture) {
+			// Keep the slices around, they are views of the same texture and stay valid for the next user.
+			E.slices = p_named_texture.slices;
+			E.last_used_frame = RSG::rasterizer->get_frame_number();
+			E.in_use = false;
+			break;
+		}
+	}
+
+	p_named_texture.texture = RID();
+	p_named_texture.slices.clear();
+}
+
+void RenderSceneBuffersRD::release_transient_textures() {
+	for (KeyValue<NTKey, NamedTexture> &E : named_textures) {
+		if (!E.value.is_unique) {
+			release_transient_texture(E.value);
+		}
+	}
+}
+
+void RenderSceneBuffersRD::update_transient_textures() {
+	uint64_t frame = RSG::rasterizer->get_frame_number();
+
+	uint32_t i = 0;
+	while (i < transient_textures.size()) {
+		if (!transient_textures[i].in_use && transient_textures[i].last_used_frame + TRANSIENT_TEXTURE_KEEP_FRAMES < frame) {
+			RD::get_singleton()->free(transient_textures[i].texture); // Slices are freed as dependents.
+			transient_textures.remove_at_unordered(i);
+		} else {
+			i++;
+		}
+	}
+}
+
+void RenderSceneBuffersRD::free_transient_textures() {
+	for (TransientTexture &E : transient_textures) {
+		RD::get_singleton()->free(E.texture);
+	}
+	transient_textures.clear();
+}
+
 void RenderSceneBuffersRD::cleanup() {
 	// Free our data buffers (but don't destroy them)
 	for (KeyValue<StringName, Ref<RenderBufferCustomDataRD>> &E : data_buffers) {
@@ -295,19 +377,33 @@ RID RenderSceneBuffersRD::_create_texture_from_format(const StringName &p_contex
 }
 
 RID RenderSceneBuffersRD::create_texture_from_format(const StringName &p_context, const StringName &p_texture_name, const RD::TextureFormat &p_texture_format, RD::TextureView p_view, bool p_unique) {
-	// TODO p_unique, if p_unique is true, this is a texture that can be shared. This will be implemented later as an optimization.
+	// If p_unique is false the texture is transient, its contents don't survive past the current render and its memory is shared with other viewports.
 
 	NTKey key(p_context, p_texture_name);
 
 	// check if this is a known texture
 	if (named_textures.has(key)) {
-		return named_textures[key].texture;
+		NamedTexture &named_texture = named_textures[key];
+		if (!named_texture.is_unique) {
+			acquire_transient_texture(named_texture);
+		}
+		return named_texture.texture;
 	}
 
+	// Pooled textures are shared between users, so they can't carry a view of their own.
+	bool default_view = p_view.format_override == RD::DATA_FORMAT_MAX && p_view.swizzle_r == RD::TEXTURE_SWIZZLE_R && p_view.swizzle_g == RD::TEXTURE_SWIZZLE_G && p_view.swizzle_b == RD::TEXTURE_SWIZZLE_B && p_view.swizzle_a == RD::TEXTURE_SWIZZLE_A;
+
 	// Add a new entry..
 	NamedTexture &named_texture = named_textures[key];
 	named_texture.format = p_texture_format;
-	named_texture.is_unique = p_unique;
+	named_texture.is_unique = p_unique || !default_view;
+
+	if (!named_texture.is_unique) {
+		acquire_transient_texture(named_texture);
+		update_sizes(named_texture);
+		return named_texture.texture;
+	}
+
 	named_texture.texture = RD::get_singleton()->texture_create(p_texture_format, p_view);
 
 	Array arr;
@@ -344,6 +440,7 @@ RID RenderSceneBuffersRD::create_texture_view(const StringName &p_context, const
 	ERR_FAIL_COND_V(!named_textures.has(key), RID());
 
 	NamedTexture &named_texture = named_textures[key];
+	ERR_FAIL_COND_V_MSG(!named_texture.is_unique, RID(), "Can't create a view of a transient texture.");
 	NamedTexture &view_texture = named_textures[view_key];
 
 	view_texture.format = named_texture.format;
@@ -366,7 +463,11 @@ RID RenderSceneBuffersRD::get_texture(const StringName &p_context, const StringN
 
 	ERR_FAIL_COND_V(!named_textures.has(key), RID());
 
-	return named_textures[key].texture;
+	NamedTexture &named_texture = named_textures[key];
+	if (!named_texture.is_unique) {
+		acquire_transient_texture(named_texture);
+	}
+	return named_texture.texture;
 }
 
 Ref<RDTextureFormat> RenderSceneBuffersRD::_get_texture_format(const StringName &p_context, const StringName &p_texture_name) const {
@@ -392,6 +493,9 @@ RID RenderSceneBuffersRD::get_texture_slice(const StringName &p_context, const S
 	// check if this is a known texture
 	ERR_FAIL_COND_V(!named_textures.has(key), RID());
 	NamedTexture &named_texture = named_textures[key];
+	if (!named_texture.is_unique) {
+		acquire_transient_texture(named_texture);
+	}
 	ERR_FAIL_COND_V(named_texture.texture.is_null(), RID());
 
 	// check if we're in bounds
@@ -436,6 +540,9 @@ Size2i RenderSceneBuffersRD::get_texture_slice_size(const StringName &p_context,
 	// check if this is a known texture
 	ERR_FAIL_COND_V(!named_textures.has(key), Size2i());
 	NamedTexture &named_texture = named_textures[key];
+	if (!named_texture.is_unique) {
+		acquire_transient_texture(named_texture);
+	}
 	ERR_FAIL_COND_V(named_texture.texture.is_null(), Size2i());
 
 	// check if we're in bounds
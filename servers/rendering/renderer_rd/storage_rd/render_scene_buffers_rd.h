@@ -138,7 +138,7 @@ private:
 	struct NamedTexture {
 		// Cache the data used to create our texture
 		RD::TextureFormat format;
-		bool is_unique; // If marked as unique, we return it into our pool
+		bool is_unique; // If not marked as unique, the texture is transient and borrowed from our pool while rendering
 
 		// Our texture objects, slices are lazy (i.e. only created when requested).
 		RID texture;
@@ -150,6 +150,22 @@ private:
 	void update_sizes(NamedTexture &p_named_texture);
 	void free_named_texture(NamedTexture &p_named_texture);
 
+	// Transient textures, shared by all render buffers.
+	// Their contents are only valid while a viewport renders, so viewports rendering one after the other reuse the same allocations.
+
+	struct TransientTexture {
+		RD::TextureFormat format;
+		RID texture;
+		HashMap<NTSliceKey, RID, NTSliceKey> slices;
+		uint64_t last_used_frame = 0;
+		bool in_use = false;
+	};
+
+	static const uint64_t TRANSIENT_TEXTURE_KEEP_FRAMES = 60;
+	static LocalVector<TransientTexture> transient_textures;
+	static void acquire_transient_texture(NamedTexture &p_named_texture);
+	static void release_transient_texture(NamedTexture &p_named_texture);
+
 	// Data buffers
 	mutable HashMap<StringName, Ref<RenderBufferCustomDataRD>> data_buffers;
 
@@ -188,6 +204,11 @@ public:
 
 	void clear_context(const StringName &p_context);
 
+	// Transient textures
+	void release_transient_textures();
+	static void update_transient_textures();
+	static void free_transient_textures();
+
 	// Allocate shared buffers
 	void allocate_blur_textures();
 
@@ -208,6 +229,7 @@ public:
 	_FORCE_INLINE_ RD::TextureSamples get_texture_samples() const { return texture_samples; }
 	_FORCE_INLINE_ RS::ViewportScreenSpaceAA get_screen_space_aa() const { return screen_space_aa; }
 	_FORCE_INLINE_ bool get_use_taa() const { return use_taa; }
+	_FORCE_INLINE_ bool get_use_temporal_upscale() const { return scaling_3d_mode == RS::VIEWPORT_SCALING_3D_MODE_TEMPORAL; }
 	_FORCE_INLINE_ bool get_use_debanding() const { return use_debanding; }
 
 	uint64_t get_auto_exposure_version() const { return auto_exposure_version; }
@@ -56,14 +56,7 @@ void RenderSceneDataRD::update_ubo(RID p_uniform_buffer, RS::ViewportDebugDraw p
 	//store camera into ubo
 	RendererRD::MaterialStorage::store_camera(projection, ubo.projection_matrix);
 	RendererRD::MaterialStorage::store_camera(projection.inverse(), ubo.inv_projection_matrix);
-	RendererRD::MaterialStorage::store_transform(cam_transform, ubo.inv_view_matrix);
-	RendererRD::MaterialStorage::store_transform(cam_transform.affine_inverse(), ubo.view_matrix);
-
-#ifdef REAL_T_IS_DOUBLE
-	RendererRD::MaterialStorage::split_double(-cam_transform.origin.x, &ubo.inv_view_matrix[12], &ubo.inv_view_matrix[3]);
-	RendererRD::MaterialStorage::split_double(-cam_transform.origin.y, &ubo.inv_view_matrix[13], &ubo.inv_view_matrix[7]);
-	RendererRD::MaterialStorage::split_double(-cam_transform.origin.z, &ubo.inv_view_matrix[14], &ubo.inv_view_matrix[11]);
-#endif
+	store_view_matrices(cam_transform, ubo.inv_view_matrix, ubo.view_matrix);
 
 	for (uint32_t v = 0; v < view_count; v++) {
 		projection = correction * view_projection[v];
@@ -252,6 +245,22 @@ void RenderSceneDataRD::update_ubo(RID p_uniform_buffer, RS::ViewportDebugDraw p
 
 	uniform_buffer = p_uniform_buffer;
 	RD::get_singleton()->buffer_update(uniform_buffer, 0, sizeof(UBODATA), &ubo, RD::BARRIER_MASK_RASTER);
+
+	if (late_latch) {
+		static_assert(offsetof(UBO, view_matrix) == offsetof(UBO, inv_view_matrix) + sizeof(UBO::inv_view_matrix));
+		render_scene_render->late_latch_add(uniform_buffer, offsetof(UBODATA, ubo) + offsetof(UBO, inv_view_matrix), cam_transform);
+	}
+}
+
+void RenderSceneDataRD::store_view_matrices(const Transform3D &p_cam_transform, float *r_inv_view_matrix, float *r_view_matrix) {
+	RendererRD::MaterialStorage::store_transform(p_cam_transform, r_inv_view_matrix);
+	RendererRD::MaterialStorage::store_transform(p_cam_transform.affine_inverse(), r_view_matrix);
+
+#ifdef REAL_T_IS_DOUBLE
+	RendererRD::MaterialStorage::split_double(-p_cam_transform.origin.x, &r_inv_view_matrix[12], &r_inv_view_matrix[3]);
+	RendererRD::MaterialStorage::split_double(-p_cam_transform.origin.y, &r_inv_view_matrix[13], &r_inv_view_matrix[7]);
+	RendererRD::MaterialStorage::split_double(-p_cam_transform.origin.z, &r_inv_view_matrix[14], &r_inv_view_matrix[11]);
+#endif
 }
 
 RID RenderSceneDataRD::get_uniform_buffer() {
@@ -76,10 +76,15 @@ public:
 	float time;
 	float time_step;
 
+	// The view matrices are registered with RendererSceneRenderRD::late_latch_add(), to be replaced with a fresher XR pose right before submission.
+	bool late_latch = false;
+
 	RID create_uniform_buffer();
 	void update_ubo(RID p_uniform_buffer, RS::ViewportDebugDraw p_debug_mode, RID p_env, RID p_reflection_probe_instance, RID p_camera_attributes, bool p_flip_y, bool p_pancake_shadows, const Size2i &p_screen_size, const Color &p_default_bg_color, float p_luminance_multiplier, bool p_opaque_render_buffers);
 	RID get_uniform_buffer();
 
+	static void store_view_matrices(const Transform3D &p_cam_transform, float *r_inv_view_matrix, float *r_view_matrix);
+
 private:
 	RID uniform_buffer; // loaded into this uniform buffer (supplied externally)
 
@@ -30,6 +30,8 @@
 
 #include "texture_storage.h"
 
+#include "core/config/project_settings.h"
+
 #include "../effects/copy_effects.h"
 #include "../framebuffer_cache_rd.h"
 #include "material_storage.h"
@@ -89,6 +91,9 @@ TextureStorage *TextureStorage::get_singleton() {
 TextureStorage::TextureStorage() {
 	singleton = this;
 
+	texture_streaming.memory_budget = uint64_t(int(GLOBAL_GET("rendering/textures/streaming/memory_budget_mb"))) * 1024 * 1024;
+	texture_streaming.minimum_size = GLOBAL_GET("rendering/textures/streaming/minimum_size");
+
 	{ //create default textures
 
 		RD::TextureFormat tformat;
@@ -777,6 +782,7 @@ void TextureStorage::texture_free(RID p_texture) {
 	}
 
 	decal_atlas_remove_texture(p_texture);
+	texture_streaming.textures.erase(p_texture);
 
 	for (int i = 0; i < t->proxies.size(); i++) {
 		Texture *p = texture_owner.get_or_null(t->proxies[i]);
@@ -1456,6 +1462,140 @@ void TextureStorage::texture_set_detect_roughness_callback(RID p_texture, RS::Te
 	tex->detect_roughness_callback = p_callback;
 }
 
+void TextureStorage::texture_set_stream_callback(RID p_texture, RS::TextureStreamCallback p_callback, void *p_userdata) {
+	Texture *tex = texture_owner.get_or_null(p_texture);
+	ERR_FAIL_COND(!tex);
+	ERR_FAIL_COND(tex->type != TextureStorage::TYPE_2D);
+
+	tex->stream_callback_ud = p_userdata;
+	tex->stream_callback = p_callback;
+	tex->stream_requested_size = 0;
+	tex->stream_pending_size = -1;
+	tex->stream_unused_updates = 0;
+
+	if (p_callback) {
+		texture_streaming.textures.insert(p_texture);
+	} else {
+		texture_streaming.textures.erase(p_texture);
+	}
+}
+
+void TextureStorage::texture_stream_request(RID p_texture, int p_size) {
+	Texture *tex = texture_owner.get_or_null(p_texture);
+	if (!tex || !tex->stream_callback) {
+		return;
+	}
+
+	tex->stream_requested_size = MAX(tex->stream_requested_size, p_size);
+}
+
+void TextureStorage::update_texture_streaming() {
+	if (texture_streaming.textures.is_empty()) {
+		return;
+	}
+
+	if (texture_streaming.frames_until_update > 0) {
+		texture_streaming.frames_until_update--;
+		return;
+	}
+	texture_streaming.frames_until_update = TEXTURE_STREAMING_UPDATE_FRAMES;
+
+	struct StreamedTexture {
+		Texture *texture = nullptr;
+		Size2i size;
+	};
+
+	LocalVector<StreamedTexture> streamed;
+	LocalVector<RID> removed;
+	const int minimum_size = texture_streaming.minimum_size;
+
+	for (const RID &rid : texture_streaming.textures) {
+		Texture *tex = texture_owner.get_or_null(rid);
+		if (!tex || !tex->stream_callback) {
+			removed.push_back(rid);
+			continue;
+		}
+
+		// Smallest mip still as large as the texture is seen on screen.
+		Size2i size = Size2i(tex->width_2d, tex->height_2d);
+		while (MAX(size.x, size.y) > minimum_size && MAX(size.x, size.y) / 2 >= tex->stream_requested_size) {
+			size = Size2i(MAX(1, size.x >> 1), MAX(1, size.y >> 1));
+		}
+
+		if (MAX(size.x, size.y) < MAX(tex->width, tex->height)) {
+			// Textures out of view tend to come back soon, so don't drop their mips right away.
+			if (tex->stream_unused_updates < TEXTURE_STREAMING_UNLOAD_UPDATES) {
+				tex->stream_unused_updates++;
+				size = Size2i(tex->width, tex->height);
+			}
+		} else {
+			tex->stream_unused_updates = 0;
+		}
+		tex->stream_requested_size = 0;
+
+		StreamedTexture st;
+		st.texture = tex;
+		st.size = size;
+		streamed.push_back(st);
+	}
+
+	for (const RID &rid : removed) {
+		texture_streaming.textures.erase(rid);
+	}
+
+	bool has_budget = texture_streaming.memory_budget > 0;
+	uint64_t budget = texture_streaming.memory_budget;
+
+	uint64_t device_budget = RD::get_singleton()->get_memory_budget();
+	if (device_budget > 0) {
+		// Streamed mips are the first thing to give up when video memory is about to run out.
+		uint64_t streamed_used = 0;
+		for (const StreamedTexture &st : streamed) {
+			streamed_used += Image::get_image_data_size(st.texture->width, st.texture->height, st.texture->format, true);
+		}
+		uint64_t device_used = RD::get_singleton()->get_memory_usage(RD::MEMORY_DEVICE_LOCAL);
+		uint64_t other_used = device_used > streamed_used ? device_used - streamed_used : 0;
+		uint64_t device_limit = device_budget - device_budget / 20; // Leave room for transient allocations.
+		uint64_t available = device_limit > other_used ? device_limit - other_used : 0;
+		if (!has_budget || available < budget) {
+			has_budget = true;
+			budget = available;
+		}
+	}
+
+	// Over budget, drop the same number of mips from every texture until everything fits.
+	if (has_budget) {
+		for (int bias = 0; bias < 16; bias++) {
+			uint64_t total = 0;
+			for (StreamedTexture &st : streamed) {
+				if (bias > 0 && MAX(st.size.x, st.size.y) > minimum_size) {
+					st.size = Size2i(MAX(1, st.size.x >> 1), MAX(1, st.size.y >> 1));
+				}
+				total += Image::get_image_data_size(st.size.x, st.size.y, st.texture->format, true);
+			}
+
+			if (total <= budget) {
+				break;
+			}
+		}
+	}
+
+	for (const StreamedTexture &st : streamed) {
+		Texture *tex = st.texture;
+		if (st.size == Size2i(tex->width, tex->height)) {
+			continue;
+		}
+
+		int limit = st.size == Size2i(tex->width_2d, tex->height_2d) ? 0 : MAX(st.size.x, st.size.y);
+		if (limit == tex->stream_pending_size) {
+			continue; // Still loading.
+		}
+
+		tex->stream_pending_size = limit;
+		tex->stream_callback(tex->stream_callback_ud, limit);
+	}
+}
+
 void TextureStorage::texture_debug_usage(List<RS::TextureInfo> *r_info) {
 }
 
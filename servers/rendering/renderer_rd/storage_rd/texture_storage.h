@@ -167,6 +167,12 @@ private:
 		RS::TextureDetectRoughnessCallback detect_roughness_callback = nullptr;
 		void *detect_roughness_callback_ud = nullptr;
 
+		RS::TextureStreamCallback stream_callback = nullptr;
+		void *stream_callback_ud = nullptr;
+		int stream_requested_size = 0; // Largest on screen size since the last streaming update.
+		int stream_pending_size = -1; // Last size asked for through the callback.
+		uint32_t stream_unused_updates = 0;
+
 		CanvasTexture *canvas_texture = nullptr;
 
 		void cleanup();
@@ -217,6 +223,20 @@ private:
 
 	void _texture_format_from_rd(RD::DataFormat p_rd_format, TextureFromRDFormat &r_format);
 
+	/* TEXTURE STREAMING */
+
+	enum {
+		TEXTURE_STREAMING_UPDATE_FRAMES = 30,
+		TEXTURE_STREAMING_UNLOAD_UPDATES = 10, // Updates a texture keeps its mips for after it stops being seen at that size.
+	};
+
+	struct TextureStreaming {
+		HashSet<RID> textures;
+		uint64_t memory_budget = 0;
+		int minimum_size = 0;
+		uint32_t frames_until_update = 0;
+	} texture_streaming;
+
 	/* DECAL API */
 
 	struct DecalAtlas {
@@ -516,6 +536,10 @@ public:
 	virtual void texture_set_detect_normal_callback(RID p_texture, RS::TextureDetectCallback p_callback, void *p_userdata) override;
 	virtual void texture_set_detect_roughness_callback(RID p_texture, RS::TextureDetectRoughnessCallback p_callback, void *p_userdata) override;
 
+	virtual void texture_set_stream_callback(RID p_texture, RS::TextureStreamCallback p_callback, void *p_userdata) override;
+	virtual void texture_stream_request(RID p_texture, int p_size) override;
+	void update_texture_streaming();
+
 	virtual void texture_debug_usage(List<RS::TextureInfo> *r_info) override;
 
 	virtual void texture_set_force_redraw_if_visible(RID p_texture, bool p_enable) override;
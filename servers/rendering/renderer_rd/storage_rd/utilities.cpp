@@ -297,6 +297,18 @@ void Utilities::update_memory_info() {
 	texture_mem_cache = RenderingDevice::get_singleton()->get_memory_usage(RenderingDevice::MEMORY_TEXTURES);
 	buffer_mem_cache = RenderingDevice::get_singleton()->get_memory_usage(RenderingDevice::MEMORY_BUFFERS);
 	total_mem_cache = RenderingDevice::get_singleton()->get_memory_usage(RenderingDevice::MEMORY_TOTAL);
+	render_target_mem_cache = RenderingDevice::get_singleton()->get_memory_usage(RenderingDevice::MEMORY_RENDER_TARGETS);
+	mesh_mem_cache = RenderingDevice::get_singleton()->get_memory_usage(RenderingDevice::MEMORY_MESHES);
+	staging_mem_cache = RenderingDevice::get_singleton()->get_memory_usage(RenderingDevice::MEMORY_STAGING);
+	budget_mem_cache = RenderingDevice::get_singleton()->get_memory_budget();
+
+	GI *gi = GI::get_singleton();
+	if (gi) {
+		sdfgi_cascade_updates_cache = gi->sdfgi_cascade_updates;
+		sdfgi_deferred_cascade_updates_cache = gi->sdfgi_deferred_cascade_updates;
+		gi->sdfgi_cascade_updates = 0;
+		gi->sdfgi_deferred_cascade_updates = 0;
+	}
 }
 
 uint64_t Utilities::get_rendering_info(RS::RenderingInfo p_info) {
@@ -306,6 +318,18 @@ uint64_t Utilities::get_rendering_info(RS::RenderingInfo p_info) {
 		return buffer_mem_cache;
 	} else if (p_info == RS::RENDERING_INFO_VIDEO_MEM_USED) {
 		return total_mem_cache;
+	} else if (p_info == RS::RENDERING_INFO_RENDER_TARGET_MEM_USED) {
+		return render_target_mem_cache;
+	} else if (p_info == RS::RENDERING_INFO_MESH_MEM_USED) {
+		return mesh_mem_cache;
+	} else if (p_info == RS::RENDERING_INFO_STAGING_MEM_USED) {
+		return staging_mem_cache;
+	} else if (p_info == RS::RENDERING_INFO_VIDEO_MEM_BUDGET) {
+		return budget_mem_cache;
+	} else if (p_info == RS::RENDERING_INFO_SDFGI_CASCADE_UPDATES_IN_FRAME) {
+		return sdfgi_cascade_updates_cache;
+	} else if (p_info == RS::RENDERING_INFO_SDFGI_DEFERRED_CASCADE_UPDATES_IN_FRAME) {
+		return sdfgi_deferred_cascade_updates_cache;
 	}
 	return 0;
 }
@@ -326,6 +350,18 @@ String Utilities::get_video_adapter_api_version() const {
 	return RenderingDevice::get_singleton()->get_device_api_version();
 }
 
+Error Utilities::pipeline_bundle_save(const String &p_path) {
+	return RenderingDevice::get_singleton()->pipeline_bundle_save(p_path);
+}
+
+Error Utilities::pipeline_bundle_precompile(const String &p_path) {
+	return RenderingDevice::get_singleton()->pipeline_bundle_precompile(p_path);
+}
+
+float Utilities::pipeline_bundle_get_precompile_progress() const {
+	return RenderingDevice::get_singleton()->pipeline_bundle_get_precompile_progress();
+}
+
 Size2i Utilities::get_maximum_viewport_size() const {
 	RenderingDevice *device = RenderingDevice::get_singleton();
 
@@ -59,6 +59,12 @@ private:
 	uint64_t texture_mem_cache = 0;
 	uint64_t buffer_mem_cache = 0;
 	uint64_t total_mem_cache = 0;
+	uint64_t render_target_mem_cache = 0;
+	uint64_t mesh_mem_cache = 0;
+	uint64_t staging_mem_cache = 0;
+	uint64_t budget_mem_cache = 0;
+	uint32_t sdfgi_cascade_updates_cache = 0;
+	uint32_t sdfgi_deferred_cascade_updates_cache = 0;
 
 public:
 	static Utilities *get_singleton() { return singleton; }
@@ -116,6 +122,10 @@ public:
 	virtual RenderingDevice::DeviceType get_video_adapter_type() const override;
 	virtual String get_video_adapter_api_version() const override;
 
+	virtual Error pipeline_bundle_save(const String &p_path) override;
+	virtual Error pipeline_bundle_precompile(const String &p_path) override;
+	virtual float pipeline_bundle_get_precompile_progress() const override;
+
 	virtual Size2i get_maximum_viewport_size() const override;
 };
 
@@ -31,12 +31,18 @@
 #include "renderer_scene_cull.h"
 
 #include "core/config/project_settings.h"
+#include "core/math/batch_math.h"
 #include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "rendering_server_default.h"
 
 #include <new>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SCENE_CULL_SSE2
+#include <emmintrin.h>
+#endif
+
 /* CAMERA API */
 
 RID RendererSceneCull::camera_allocate() {
@@ -145,6 +151,9 @@ void RendererSceneCull::_instance_pair(Instance *p_A, Instance *p_B) {
 		if (geom->can_cast_shadows) {
 			light->shadow_dirty = true;
 		}
+		if (geom->static_shadow_caster) {
+			light->static_shadow_dirty = true;
+		}
 
 		if (A->scenario && A->array_index >= 0) {
 			InstanceData &idata = A->scenario->instance_data[A->array_index];
@@ -252,6 +261,9 @@ void RendererSceneCull::_instance_unpair(Instance *p_A, Instance *p_B) {
 		if (geom->can_cast_shadows) {
 			light->shadow_dirty = true;
 		}
+		if (geom->static_shadow_caster) {
+			light->static_shadow_dirty = true;
+		}
 
 		if (A->scenario && A->array_index >= 0) {
 			InstanceData &idata = A->scenario->instance_data[A->array_index];
@@ -366,7 +378,7 @@ void RendererSceneCull::scenario_initialize(RID p_rid) {
 
 	scenario->reflection_atlas = RSG::light_storage->reflection_atlas_create();
 
-	scenario->instance_aabbs.set_page_pool(&instance_aabb_page_pool);
+	scenario->instance_aabbs.packs.set_page_pool(&instance_aabb_page_pool);
 	scenario->instance_data.set_page_pool(&instance_data_page_pool);
 	scenario->instance_visibility.set_page_pool(&instance_visibility_data_page_pool);
 
@@ -859,6 +871,7 @@ void RendererSceneCull::instance_set_layer_mask(RID p_instance, uint32_t p_mask)
 				light->shadow_dirty = true;
 			}
 		}
+		_instance_update_static_shadow_caster(instance);
 	}
 }
 
@@ -909,9 +922,46 @@ void RendererSceneCull::instance_set_transform(RID p_instance, const Transform3D
 
 #endif
 	instance->transform = p_transform;
+	instance->moved = instance->moved || instance->version > 0;
 	_instance_queue_update(instance, true);
 }
 
+void RendererSceneCull::instance_set_transforms(const Vector<int64_t> &p_instances, const Vector<float> &p_transforms) {
+	const int count = p_instances.size();
+	ERR_FAIL_COND_MSG(p_transforms.size() != count * 12, "Transforms array must contain 12 floats per instance.");
+
+	const int64_t *ids = p_instances.ptr();
+	const float *t = p_transforms.ptr();
+
+	for (int i = 0; i < count; i++, t += 12) {
+		Instance *instance = instance_owner.get_or_null(RID::from_uint64(ids[i]));
+		ERR_CONTINUE(!instance);
+
+		Transform3D xform;
+		xform.basis.rows[0] = Vector3(t[0], t[1], t[2]);
+		xform.origin.x = t[3];
+		xform.basis.rows[1] = Vector3(t[4], t[5], t[6]);
+		xform.origin.y = t[7];
+		xform.basis.rows[2] = Vector3(t[8], t[9], t[10]);
+		xform.origin.z = t[11];
+
+		if (instance->transform == xform) {
+			continue;
+		}
+
+#ifdef DEBUG_ENABLED
+		bool finite = true;
+		for (int j = 0; j < 12; j++) {
+			finite = finite && Math::is_finite(t[j]);
+		}
+		ERR_CONTINUE(!finite);
+#endif
+		instance->transform = xform;
+		instance->moved = instance->moved || instance->version > 0;
+		_instance_queue_update(instance, true);
+	}
+}
+
 void RendererSceneCull::instance_attach_object_instance_id(RID p_instance, ObjectID p_id) {
 	Instance *instance = instance_owner.get_or_null(p_instance);
 	ERR_FAIL_COND(!instance);
@@ -1542,6 +1592,25 @@ void RendererSceneCull::instance_geometry_get_shader_parameter_list(RID p_instan
 	}
 }
 
+void RendererSceneCull::_instance_update_static_shadow_caster(Instance *p_instance) {
+	InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(p_instance->base_data);
+
+	// Anything that moved, deforms or animates its vertices is drawn into shadows every time instead.
+	bool is_static = geom->can_cast_shadows && !p_instance->moved && p_instance->base_type == RS::INSTANCE_MESH && !p_instance->mesh_instance.is_valid() && !geom->material_is_animated;
+
+	if (is_static || geom->static_shadow_caster) {
+		for (const Instance *E : geom->lights) {
+			InstanceLightData *light = static_cast<InstanceLightData *>(E->base_data);
+			light->static_shadow_dirty = true;
+		}
+		if (p_instance->scenario) {
+			p_instance->scenario->static_shadow_version++;
+		}
+	}
+
+	geom->static_shadow_caster = is_static;
+}
+
 void RendererSceneCull::_update_instance(Instance *p_instance) {
 	p_instance->version++;
 
@@ -1549,8 +1618,9 @@ void RendererSceneCull::_update_instance(Instance *p_instance) {
 		InstanceLightData *light = static_cast<InstanceLightData *>(p_instance->base_data);
 
 		RSG::light_storage->light_instance_set_transform(light->instance, p_instance->transform);
-		RSG::light_storage->light_instance_set_aabb(light->instance, p_instance->transform.xform(p_instance->aabb));
+		RSG::light_storage->light_instance_set_aabb(light->instance, BatchMath::xform(p_instance->transform, p_instance->aabb));
 		light->shadow_dirty = true;
+		light->static_shadow_dirty = true;
 
 		RS::LightBakeMode bake_mode = RSG::light_storage->light_get_bake_mode(p_instance->base);
 		if (RSG::light_storage->light_get_type(p_instance->base) != RS::LIGHT_DIRECTIONAL && bake_mode != light->bake_mode) {
@@ -1625,7 +1695,7 @@ void RendererSceneCull::_update_instance(Instance *p_instance) {
 	}
 
 	AABB new_aabb;
-	new_aabb = p_instance->transform.xform(p_instance->aabb);
+	new_aabb = BatchMath::xform(p_instance->transform, p_instance->aabb);
 	p_instance->transformed_aabb = new_aabb;
 
 	if ((1 << p_instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) {
@@ -1638,6 +1708,7 @@ void RendererSceneCull::_update_instance(Instance *p_instance) {
 				light->shadow_dirty = true;
 			}
 		}
+		_instance_update_static_shadow_caster(p_instance);
 
 		if (!p_instance->lightmap && geom->lightmap_captures.size()) {
 			//affected by lightmap captures, must update capture info!
@@ -1772,7 +1843,7 @@ void RendererSceneCull::_update_instance(Instance *p_instance) {
 		} else {
 			p_instance->scenario->indexers[Scenario::INDEXER_VOLUMES].update(p_instance->indexer_id, bvh_aabb);
 		}
-		p_instance->scenario->instance_aabbs[p_instance->array_index] = InstanceBounds(p_instance->transformed_aabb);
+		p_instance->scenario->instance_aabbs.set(p_instance->array_index, InstanceBounds(p_instance->transformed_aabb));
 	}
 
 	if (p_instance->visibility_index != -1) {
@@ -1837,6 +1908,10 @@ void RendererSceneCull::_unpair_instance(Instance *p_instance) {
 		return; //nothing to do
 	}
 
+	if (((1 << p_instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) && static_cast<InstanceGeometryData *>(p_instance->base_data)->static_shadow_caster) {
+		p_instance->scenario->static_shadow_version++;
+	}
+
 	while (p_instance->pairs.first()) {
 		InstancePair *pair = p_instance->pairs.first()->self();
 		Instance *other_instance = p_instance == pair->a ? pair->b : pair->a;
@@ -1858,7 +1933,7 @@ void RendererSceneCull::_unpair_instance(Instance *p_instance) {
 		Instance *swapped_instance = p_instance->scenario->instance_data[swap_with_index].instance;
 		swapped_instance->array_index = p_instance->array_index; //swap
 		p_instance->scenario->instance_data[p_instance->array_index] = p_instance->scenario->instance_data[swap_with_index];
-		p_instance->scenario->instance_aabbs[p_instance->array_index] = p_instance->scenario->instance_aabbs[swap_with_index];
+		p_instance->scenario->instance_aabbs.set(p_instance->array_index, p_instance->scenario->instance_aabbs.get(swap_with_index));
 
 		if (swapped_instance->visibility_index != -1) {
 			swapped_instance->scenario->instance_visibility[swapped_instance->visibility_index].array_index = swapped_instance->array_index;
@@ -2105,6 +2180,9 @@ void RendererSceneCull::_light_instance_setup_directional_shadow(int p_shadow_in
 	cull.shadow_count = p_shadow_index + 1;
 	cull.shadows[p_shadow_index].cascade_count = splits;
 	cull.shadows[p_shadow_index].light_instance = light->instance;
+	cull.shadows[p_shadow_index].static_cache_dirty = light->static_shadow_dirty || light->static_shadow_version != p_instance->scenario->static_shadow_version;
+	light->static_shadow_dirty = false;
+	light->static_shadow_version = p_instance->scenario->static_shadow_version;
 
 	for (int i = 0; i < splits; i++) {
 		RENDER_TIMESTAMP("Cull DirectionalLight3D, Split " + itos(i));
@@ -2328,6 +2406,8 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 					p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(planes.ptr(), planes.size(), points.ptr(), points.size(), cull_convex);
 
 					RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
+					shadow_data.use_static_cache = static_shadow_cache;
+					shadow_data.static_cache_dirty = light->static_shadow_dirty;
 
 					for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
 						Instance *instance = instance_shadow_cull_result[j];
@@ -2343,7 +2423,11 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 							}
 						}
 
-						shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+						if (shadow_data.use_static_cache && !static_cast<InstanceGeometryData *>(instance->base_data)->static_shadow_caster) {
+							shadow_data.dynamic_instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+						} else {
+							shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+						}
 					}
 
 					RSG::mesh_storage->update_mesh_instances();
@@ -2420,7 +2504,11 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 							}
 						}
 
-						shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+						if (shadow_data.use_static_cache && !static_cast<InstanceGeometryData *>(instance->base_data)->static_shadow_caster) {
+							shadow_data.dynamic_instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+						} else {
+							shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+						}
 					}
 
 					RSG::mesh_storage->update_mesh_instances();
@@ -2469,6 +2557,8 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 			p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(planes.ptr(), planes.size(), points.ptr(), points.size(), cull_convex);
 
 			RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
+			shadow_data.use_static_cache = static_shadow_cache;
+			shadow_data.static_cache_dirty = light->static_shadow_dirty;
 
 			for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
 				Instance *instance = instance_shadow_cull_result[j];
@@ -2483,7 +2573,11 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 						RSG::mesh_storage->mesh_instance_check_for_update(instance->mesh_instance);
 					}
 				}
-				shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+				if (shadow_data.use_static_cache && !static_cast<InstanceGeometryData *>(instance->base_data)->static_shadow_caster) {
+					shadow_data.dynamic_instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+				} else {
+					shadow_data.instances.push_back(static_cast<InstanceGeometryData *>(instance->base_data)->geometry_instance);
+				}
 			}
 
 			RSG::mesh_storage->update_mesh_instances();
@@ -2495,6 +2589,8 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 		} break;
 	}
 
+	light->static_shadow_dirty = false;
+
 	return animated_material_found;
 }
 
@@ -2577,6 +2673,7 @@ void RendererSceneCull::render_camera(const Ref<RenderSceneBuffers> &p_render_bu
 		} else {
 			// this won't be called (see fail check above) but keeping this comment to indicate we may support more then 2 views in the future...
 		}
+		camera_data.late_latch = p_xr_interface->is_late_latching_enabled();
 	}
 
 	RID environment = _render_get_environment(p_camera, p_scenario);
@@ -2586,9 +2683,41 @@ void RendererSceneCull::render_camera(const Ref<RenderSceneBuffers> &p_render_bu
 	RendererSceneOcclusionCull::get_singleton()->buffer_update(p_viewport, camera_data.main_transform, camera_data.main_projection, camera_data.is_orthogonal);
 
 	_render_scene(&camera_data, p_render_buffers, environment, camera->attributes, camera->visible_layers, p_scenario, p_viewport, p_shadow_atlas, RID(), -1, p_screen_mesh_lod_threshold, true, r_render_info);
+
+	if (camera_data.view_count == 1) {
+		RendererSceneOcclusionCull::get_singleton()->buffer_capture(p_viewport, p_render_buffers, camera_data.main_transform, camera_data.main_projection, camera_data.is_orthogonal);
+	}
+
+	if (texture_streaming) {
+		_request_streamed_textures(camera_data, p_viewport_size);
+	}
 #endif
 }
 
+void RendererSceneCull::_request_streamed_textures(const RendererSceneRender::CameraData &p_camera_data, const Size2i &p_viewport_size) {
+	// Estimate how many pixels each visible instance covers along its longest axis,
+	// textures don't need more resolution than that.
+	real_t pixel_scale = p_camera_data.main_projection.columns[0][0] * 0.5 * p_viewport_size.width;
+	real_t z_near = p_camera_data.main_projection.get_z_near();
+	Vector3 camera_position = p_camera_data.main_transform.origin;
+
+	for (uint32_t i = 0; i < scene_cull_result.streamed_texture_instances.size(); i++) {
+		Instance *instance = scene_cull_result.streamed_texture_instances[i];
+		InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(instance->base_data);
+
+		real_t size = instance->transformed_aabb.get_longest_axis_size() * pixel_scale;
+		if (!p_camera_data.is_orthogonal) {
+			Vector3 closest = camera_position.clamp(instance->transformed_aabb.position, instance->transformed_aabb.get_end());
+			size /= MAX(camera_position.distance_to(closest), z_near);
+		}
+
+		int pixel_size = MAX(1, int(Math::ceil(size)));
+		for (const RID &texture : geom->streamed_textures) {
+			RSG::texture_storage->texture_stream_request(texture, pixel_size);
+		}
+	}
+}
+
 void RendererSceneCull::_visibility_cull_threaded(uint32_t p_thread, VisibilityCullData *cull_data) {
 	uint32_t total_threads = WorkerThreadPool::get_singleton()->get_thread_count();
 	uint32_t bin_from = p_thread * cull_data->cull_count / total_threads;
@@ -2685,6 +2814,55 @@ bool RendererSceneCull::_visibility_parent_check(const CullData &p_cull_data, co
 	return ((parent_flags & InstanceData::FLAG_VISIBILITY_DEPENDENCY_NEEDS_CHECK) == InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN_CLOSE_RANGE) || (parent_flags & InstanceData::FLAG_VISIBILITY_DEPENDENCY_FADE_CHILDREN);
 }
 
+uint32_t RendererSceneCull::InstanceBoundsArray::get_pack_frustum_mask(uint64_t p_pack, const Frustum &p_frustum) const {
+	const InstanceBoundsPack &pack = packs[p_pack];
+	const uint32_t all_lanes = (1 << INSTANCE_BOUNDS_PACK_SIZE) - 1;
+	uint32_t outside = 0;
+
+	for (uint32_t i = 0; i < p_frustum.plane_count; i++) {
+		const Plane &plane = p_frustum.planes_ptr[i];
+		const uint32_t *signs = p_frustum.plane_signs_ptr[i].signs;
+		// Corner of each box furthest behind the plane, as picked by PlaneSign.
+		const real_t *x = signs[0] < 3 ? pack.min[0] : pack.max[0];
+		const real_t *y = signs[1] < 3 ? pack.min[1] : pack.max[1];
+		const real_t *z = signs[2] < 3 ? pack.min[2] : pack.max[2];
+
+#if defined(SCENE_CULL_SSE2) && !defined(REAL_T_IS_DOUBLE)
+		const __m128 nx = _mm_set1_ps(plane.normal.x);
+		const __m128 ny = _mm_set1_ps(plane.normal.y);
+		const __m128 nz = _mm_set1_ps(plane.normal.z);
+		const __m128 d = _mm_set1_ps(plane.d);
+		for (uint32_t j = 0; j < INSTANCE_BOUNDS_PACK_SIZE; j += 4) {
+			__m128 dist = _mm_add_ps(_mm_mul_ps(nx, _mm_loadu_ps(x + j)), _mm_mul_ps(ny, _mm_loadu_ps(y + j)));
+			dist = _mm_sub_ps(_mm_add_ps(dist, _mm_mul_ps(nz, _mm_loadu_ps(z + j))), d);
+			outside |= uint32_t(_mm_movemask_ps(_mm_cmpge_ps(dist, _mm_setzero_ps()))) << j;
+		}
+#elif defined(SCENE_CULL_SSE2)
+		const __m128d nx = _mm_set1_pd(plane.normal.x);
+		const __m128d ny = _mm_set1_pd(plane.normal.y);
+		const __m128d nz = _mm_set1_pd(plane.normal.z);
+		const __m128d d = _mm_set1_pd(plane.d);
+		for (uint32_t j = 0; j < INSTANCE_BOUNDS_PACK_SIZE; j += 2) {
+			__m128d dist = _mm_add_pd(_mm_mul_pd(nx, _mm_loadu_pd(x + j)), _mm_mul_pd(ny, _mm_loadu_pd(y + j)));
+			dist = _mm_sub_pd(_mm_add_pd(dist, _mm_mul_pd(nz, _mm_loadu_pd(z + j))), d);
+			outside |= uint32_t(_mm_movemask_pd(_mm_cmpge_pd(dist, _mm_setzero_pd()))) << j;
+		}
+#else
+		// Branchless, so compilers can vectorize it for other targets.
+		for (uint32_t j = 0; j < INSTANCE_BOUNDS_PACK_SIZE; j++) {
+			const real_t dist = plane.normal.x * x[j] + plane.normal.y * y[j] + plane.normal.z * z[j] - plane.d;
+			outside |= uint32_t(dist >= 0.0) << j;
+		}
+#endif
+
+		if (outside == all_lanes) {
+			break;
+		}
+	}
+
+	return ~outside & all_lanes;
+}
+
 void RendererSceneCull::_scene_cull_threaded(uint32_t p_thread, CullData *cull_data) {
 	uint32_t cull_total = cull_data->scenario->instance_data.size();
 	uint32_t total_threads = WorkerThreadPool::get_singleton()->get_thread_count();
@@ -2706,23 +2884,40 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 	Transform3D inv_cam_transform = cull_data.cam_transform.inverse();
 	float z_near = cull_data.camera_matrix->get_z_near();
 
+	// Frustum tests are done a whole bounds pack at a time, the loop below only looks up the bits.
+	uint64_t current_pack = UINT64_MAX;
+	uint32_t frustum_mask = 0;
+	uint32_t cascade_masks[RendererSceneRender::MAX_DIRECTIONAL_LIGHTS][RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES];
+
 	for (uint64_t i = p_from; i < p_to; i++) {
 		bool mesh_visible = false;
 
+		if ((i >> INSTANCE_BOUNDS_PACK_SHIFT) != current_pack) {
+			current_pack = i >> INSTANCE_BOUNDS_PACK_SHIFT;
+			const InstanceBoundsArray &aabbs = cull_data.scenario->instance_aabbs;
+			frustum_mask = aabbs.get_pack_frustum_mask(current_pack, cull_data.cull->frustum);
+			for (uint32_t j = 0; j < cull_data.cull->shadow_count; j++) {
+				for (uint32_t k = 0; k < cull_data.cull->shadows[j].cascade_count; k++) {
+					cascade_masks[j][k] = aabbs.get_pack_frustum_mask(current_pack, cull_data.cull->shadows[j].cascades[k].frustum);
+				}
+			}
+		}
+		const uint32_t lane_bit = 1 << (i & INSTANCE_BOUNDS_PACK_MASK);
+
 		InstanceData &idata = cull_data.scenario->instance_data[i];
 		uint32_t visibility_flags = idata.flags & (InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN_CLOSE_RANGE | InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN | InstanceData::FLAG_VISIBILITY_DEPENDENCY_FADE_CHILDREN);
 		int32_t visibility_check = -1;
 
 #define HIDDEN_BY_VISIBILITY_CHECKS (visibility_flags == InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN_CLOSE_RANGE || visibility_flags == InstanceData::FLAG_VISIBILITY_DEPENDENCY_HIDDEN)
 #define LAYER_CHECK (cull_data.visible_layers & idata.layer_mask)
-#define IN_FRUSTUM(f) (cull_data.scenario->instance_aabbs[i].in_frustum(f))
+#define IN_FRUSTUM(m_mask) ((m_mask) & lane_bit)
 #define VIS_RANGE_CHECK ((idata.visibility_index == -1) || _visibility_range_check<false>(cull_data.scenario->instance_visibility[idata.visibility_index], cull_data.cam_transform.origin, cull_data.visibility_viewport_mask) == 0)
 #define VIS_PARENT_CHECK (_visibility_parent_check(cull_data, idata))
 #define VIS_CHECK (visibility_check < 0 ? (visibility_check = (visibility_flags != InstanceData::FLAG_VISIBILITY_DEPENDENCY_NEEDS_CHECK || (VIS_RANGE_CHECK && VIS_PARENT_CHECK))) : visibility_check)
-#define OCCLUSION_CULLED (cull_data.occlusion_buffer != nullptr && (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_OCCLUSION_CULLING) == 0 && cull_data.occlusion_buffer->is_occluded(cull_data.scenario->instance_aabbs[i].bounds, cull_data.cam_transform.origin, inv_cam_transform, *cull_data.camera_matrix, z_near))
+#define OCCLUSION_CULLED (cull_data.occlusion_buffer != nullptr && (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_OCCLUSION_CULLING) == 0 && cull_data.occlusion_buffer->is_occluded(cull_data.scenario->instance_aabbs.get(i).bounds, cull_data.cam_transform.origin, inv_cam_transform, *cull_data.camera_matrix, z_near))
 
 		if (!HIDDEN_BY_VISIBILITY_CHECKS) {
-			if ((LAYER_CHECK && IN_FRUSTUM(cull_data.cull->frustum) && VIS_CHECK && !OCCLUSION_CULLED) || (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_ALL_CULLING)) {
+			if ((LAYER_CHECK && IN_FRUSTUM(frustum_mask) && VIS_CHECK && !OCCLUSION_CULLED) || (cull_data.scenario->instance_data[i].flags & InstanceData::FLAG_IGNORE_ALL_CULLING)) {
 				uint32_t base_type = idata.flags & InstanceData::FLAG_BASE_TYPE_MASK;
 				if (base_type == RS::INSTANCE_LIGHT) {
 					cull_result.lights.push_back(idata.instance);
@@ -2737,10 +2932,15 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 
 						if ((idata.flags & InstanceData::FLAG_REFLECTION_PROBE_DIRTY) || RSG::light_storage->reflection_probe_instance_needs_redraw(RID::from_uint64(idata.instance_data_rid))) {
 							InstanceReflectionProbeData *reflection_probe = static_cast<InstanceReflectionProbeData *>(idata.instance->base_data);
+							float camera_distance = cull_data.cam_transform.origin.distance_to(idata.instance->transform.origin);
 							cull_data.cull->lock.lock();
 							if (!reflection_probe->update_list.in_list()) {
 								reflection_probe->render_step = 0;
+								reflection_probe->camera_distance = camera_distance;
+								reflection_probe->queued_frame = RSG::rasterizer->get_frame_number();
 								reflection_probe_render_list.add_last(&reflection_probe->update_list);
+							} else {
+								reflection_probe->camera_distance = MIN(reflection_probe->camera_distance, camera_distance);
 							}
 							cull_data.cull->lock.unlock();
 
@@ -2908,17 +3108,24 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 
 					if (keep) {
 						cull_result.geometry_instances.push_back(idata.instance_geometry);
+						if (texture_streaming && !static_cast<InstanceGeometryData *>(idata.instance->base_data)->streamed_textures.is_empty()) {
+							cull_result.streamed_texture_instances.push_back(idata.instance);
+						}
 					}
 				}
 			}
 
 			for (uint32_t j = 0; j < cull_data.cull->shadow_count; j++) {
 				for (uint32_t k = 0; k < cull_data.cull->shadows[j].cascade_count; k++) {
-					if (IN_FRUSTUM(cull_data.cull->shadows[j].cascades[k].frustum) && VIS_CHECK) {
+					if (IN_FRUSTUM(cascade_masks[j][k]) && VIS_CHECK) {
 						uint32_t base_type = idata.flags & InstanceData::FLAG_BASE_TYPE_MASK;
 
 						if (((1 << base_type) & RS::INSTANCE_GEOMETRY_MASK) && idata.flags & InstanceData::FLAG_CAST_SHADOWS && LAYER_CHECK) {
-							cull_result.directional_shadows[j].cascade_geometry_instances[k].push_back(idata.instance_geometry);
+							if (cull_data.static_shadow_cache && !static_cast<InstanceGeometryData *>(idata.instance->base_data)->static_shadow_caster) {
+								cull_result.directional_shadows[j].cascade_dynamic_geometry_instances[k].push_back(idata.instance_geometry);
+							} else {
+								cull_result.directional_shadows[j].cascade_geometry_instances[k].push_back(idata.instance_geometry);
+							}
 							mesh_visible = true;
 						}
 					}
@@ -2935,7 +3142,7 @@ void RendererSceneCull::_scene_cull(CullData &cull_data, InstanceCullResult &cul
 #undef OCCLUSION_CULLED
 
 		for (uint32_t j = 0; j < cull_data.cull->sdfgi.region_count; j++) {
-			if (cull_data.scenario->instance_aabbs[i].in_aabb(cull_data.cull->sdfgi.region_aabb[j])) {
+			if (cull_data.scenario->instance_aabbs.get(i).in_aabb(cull_data.cull->sdfgi.region_aabb[j])) {
 				uint32_t base_type = idata.flags & InstanceData::FLAG_BASE_TYPE_MASK;
 
 				if (base_type == RS::INSTANCE_LIGHT) {
@@ -3095,6 +3302,7 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 		cull_data.occlusion_buffer = RendererSceneOcclusionCull::get_singleton()->buffer_get_ptr(p_viewport);
 		cull_data.camera_matrix = &p_camera_data->main_projection;
 		cull_data.visibility_viewport_mask = scenario->viewport_visibility_masks.has(p_viewport) ? scenario->viewport_visibility_masks[p_viewport] : 0;
+		cull_data.static_shadow_cache = static_shadow_cache;
 //#define DEBUG_CULL_TIME
 #ifdef DEBUG_CULL_TIME
 		uint64_t time_from = OS::get_singleton()->get_ticks_usec();
@@ -3152,6 +3360,11 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 				render_shadow_data[max_shadows_used].light = cull.shadows[i].light_instance;
 				render_shadow_data[max_shadows_used].pass = j;
 				render_shadow_data[max_shadows_used].instances.merge_unordered(scene_cull_result.directional_shadows[i].cascade_geometry_instances[j]);
+				if (static_shadow_cache) {
+					render_shadow_data[max_shadows_used].use_static_cache = true;
+					render_shadow_data[max_shadows_used].static_cache_dirty = cull.shadows[i].static_cache_dirty;
+					render_shadow_data[max_shadows_used].dynamic_instances.merge_unordered(scene_cull_result.directional_shadows[i].cascade_dynamic_geometry_instances[j]);
+				}
 				max_shadows_used++;
 			}
 		}
@@ -3320,6 +3533,8 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 
 	for (uint32_t i = 0; i < max_shadows_used; i++) {
 		render_shadow_data[i].instances.clear();
+		render_shadow_data[i].dynamic_instances.clear();
+		render_shadow_data[i].use_static_cache = false;
 	}
 	max_shadows_used = 0;
 
@@ -3449,11 +3664,63 @@ bool RendererSceneCull::_render_reflection_probe_step(Instance *p_instance, int
 	return false;
 }
 
+void RendererSceneCull::_render_reflection_probes_budgeted() {
+	// Probes that started rendering finish first, so their atlas slot is consistent again soon.
+	// The others go by distance to the camera, shortened the longer they wait so far ones are not starved.
+	struct ProbeSort {
+		InstanceReflectionProbeData *probe = nullptr;
+		float score = 0.0;
+		bool operator<(const ProbeSort &p_other) const {
+			return score < p_other.score;
+		}
+	};
+
+	uint64_t frame = RSG::rasterizer->get_frame_number();
+	LocalVector<ProbeSort> probes;
+	for (SelfList<InstanceReflectionProbeData> *E = reflection_probe_render_list.first(); E; E = E->next()) {
+		ProbeSort sort;
+		sort.probe = E->self();
+		sort.score = sort.probe->render_step > 0 ? -1.0 : sort.probe->camera_distance / float(1 + frame - sort.probe->queued_frame);
+		probes.push_back(sort);
+	}
+	probes.sort();
+
+	int faces_left = reflection_probe_max_faces_per_frame > 0 ? reflection_probe_max_faces_per_frame : INT_MAX;
+	int filter_steps_left = reflection_probe_max_filter_steps_per_frame > 0 ? reflection_probe_max_filter_steps_per_frame : INT_MAX;
+
+	for (const ProbeSort &E : probes) {
+		InstanceReflectionProbeData *probe = E.probe;
+		while (true) {
+			// Steps 0 to 5 render the cubemap faces, the ones after filter the roughness mipmaps.
+			int &budget = probe->render_step < 6 ? faces_left : filter_steps_left;
+			if (budget == 0) {
+				break;
+			}
+			budget--;
+
+			if (_render_reflection_probe_step(probe->owner, probe->render_step)) {
+				reflection_probe_render_list.remove(&probe->update_list);
+				break;
+			}
+			probe->render_step++;
+		}
+
+		if (faces_left == 0 && filter_steps_left == 0) {
+			break;
+		}
+	}
+}
+
 void RendererSceneCull::render_probes() {
 	/* REFLECTION PROBES */
 
 	SelfList<InstanceReflectionProbeData> *ref_probe = reflection_probe_render_list.first();
 
+	if (reflection_probe_max_faces_per_frame > 0 || reflection_probe_max_filter_steps_per_frame > 0) {
+		_render_reflection_probes_budgeted();
+		ref_probe = nullptr;
+	}
+
 	bool busy = false;
 
 	while (ref_probe) {
@@ -3696,35 +3963,45 @@ void RendererSceneCull::render_particle_colliders() {
 		Instance *hfpc = *heightfield_particle_colliders_update_list.begin();
 
 		if (hfpc->scenario && hfpc->base_type == RS::INSTANCE_PARTICLES_COLLISION && RSG::particles_storage->particles_collision_is_heightfield(hfpc->base)) {
-			//update heightfield
-			instance_cull_result.clear();
-			scene_cull_result.geometry_instances.clear();
+			//update heightfield, only the parts uncovered by a move when the rest can be reused
+			Vector<AABB> regions;
+			if (!scene_render->particle_collider_heightfield_scroll(hfpc->base, hfpc->transform, regions)) {
+				regions.clear();
+				regions.push_back(AABB());
+			}
 
-			struct CullAABB {
-				PagedArray<Instance *> *result;
-				_FORCE_INLINE_ bool operator()(void *p_data) {
-					Instance *p_instance = (Instance *)p_data;
-					result->push_back(p_instance);
-					return false;
-				}
-			};
+			for (const AABB &region : regions) {
+				instance_cull_result.clear();
+				scene_cull_result.geometry_instances.clear();
 
-			CullAABB cull_aabb;
-			cull_aabb.result = &instance_cull_result;
-			hfpc->scenario->indexers[Scenario::INDEXER_GEOMETRY].aabb_query(hfpc->transformed_aabb, cull_aabb);
-			hfpc->scenario->indexers[Scenario::INDEXER_VOLUMES].aabb_query(hfpc->transformed_aabb, cull_aabb);
+				struct CullAABB {
+					PagedArray<Instance *> *result;
+					_FORCE_INLINE_ bool operator()(void *p_data) {
+						Instance *p_instance = (Instance *)p_data;
+						result->push_back(p_instance);
+						return false;
+					}
+				};
 
-			for (int i = 0; i < (int)instance_cull_result.size(); i++) {
-				Instance *instance = instance_cull_result[i];
-				if (!instance || !((1 << instance->base_type) & (RS::INSTANCE_GEOMETRY_MASK & (~(1 << RS::INSTANCE_PARTICLES))))) { //all but particles to avoid self collision
-					continue;
+				AABB cull_bounds = region.has_volume() ? hfpc->transform.xform(region) : hfpc->transformed_aabb;
+
+				CullAABB cull_aabb;
+				cull_aabb.result = &instance_cull_result;
+				hfpc->scenario->indexers[Scenario::INDEXER_GEOMETRY].aabb_query(cull_bounds, cull_aabb);
+				hfpc->scenario->indexers[Scenario::INDEXER_VOLUMES].aabb_query(cull_bounds, cull_aabb);
+
+				for (int i = 0; i < (int)instance_cull_result.size(); i++) {
+					Instance *instance = instance_cull_result[i];
+					if (!instance || !((1 << instance->base_type) & (RS::INSTANCE_GEOMETRY_MASK & (~(1 << RS::INSTANCE_PARTICLES))))) { //all but particles to avoid self collision
+						continue;
+					}
+					InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(instance->base_data);
+					ERR_FAIL_NULL(geom->geometry_instance);
+					scene_cull_result.geometry_instances.push_back(geom->geometry_instance);
 				}
-				InstanceGeometryData *geom = static_cast<InstanceGeometryData *>(instance->base_data);
-				ERR_FAIL_NULL(geom->geometry_instance);
-				scene_cull_result.geometry_instances.push_back(geom->geometry_instance);
-			}
 
-			scene_render->render_particle_collider_heightfield(hfpc->base, hfpc->transform, scene_cull_result.geometry_instances);
+				scene_render->render_particle_collider_heightfield(hfpc->base, hfpc->transform, scene_cull_result.geometry_instances, region);
+			}
 		}
 		heightfield_particle_colliders_update_list.remove(heightfield_particle_colliders_update_list.begin());
 	}
@@ -3802,6 +4079,7 @@ void RendererSceneCull::_update_dirty_instance(Instance *p_instance) {
 			bool can_cast_shadows = true;
 			bool is_animated = false;
 			HashMap<StringName, Instance::InstanceShaderParameter> isparams;
+			geom->streamed_textures.clear();
 
 			if (p_instance->cast_shadows == RS::SHADOW_CASTING_SETTING_OFF) {
 				can_cast_shadows = false;
@@ -3813,6 +4091,9 @@ void RendererSceneCull::_update_dirty_instance(Instance *p_instance) {
 				}
 				is_animated = RSG::material_storage->material_is_animated(p_instance->material_override);
 				_update_instance_shader_uniforms_from_material(isparams, p_instance->instance_shader_uniforms, p_instance->material_override);
+				if (texture_streaming) {
+					RSG::material_storage->material_get_textures(p_instance->material_override, geom->streamed_textures);
+				}
 			} else {
 				if (p_instance->base_type == RS::INSTANCE_MESH) {
 					RID mesh = p_instance->base;
@@ -3835,6 +4116,9 @@ void RendererSceneCull::_update_dirty_instance(Instance *p_instance) {
 								}
 
 								_update_instance_shader_uniforms_from_material(isparams, p_instance->instance_shader_uniforms, mat);
+								if (texture_streaming) {
+									RSG::material_storage->material_get_textures(mat, geom->streamed_textures);
+								}
 
 								RSG::material_storage->material_update_dependency(mat, &p_instance->dependency_tracker);
 							}
@@ -3866,6 +4150,9 @@ void RendererSceneCull::_update_dirty_instance(Instance *p_instance) {
 								}
 
 								_update_instance_shader_uniforms_from_material(isparams, p_instance->instance_shader_uniforms, mat);
+								if (texture_streaming) {
+									RSG::material_storage->material_get_textures(mat, geom->streamed_textures);
+								}
 
 								RSG::material_storage->material_update_dependency(mat, &p_instance->dependency_tracker);
 							}
@@ -3904,6 +4191,9 @@ void RendererSceneCull::_update_dirty_instance(Instance *p_instance) {
 								}
 
 								_update_instance_shader_uniforms_from_material(isparams, p_instance->instance_shader_uniforms, mat);
+								if (texture_streaming) {
+									RSG::material_storage->material_get_textures(mat, geom->streamed_textures);
+								}
 
 								RSG::material_storage->material_update_dependency(mat, &p_instance->dependency_tracker);
 							}
@@ -3920,6 +4210,9 @@ void RendererSceneCull::_update_dirty_instance(Instance *p_instance) {
 				can_cast_shadows = can_cast_shadows && RSG::material_storage->material_casts_shadows(p_instance->material_overlay);
 				is_animated = is_animated || RSG::material_storage->material_is_animated(p_instance->material_overlay);
 				_update_instance_shader_uniforms_from_material(isparams, p_instance->instance_shader_uniforms, p_instance->material_overlay);
+				if (texture_streaming) {
+					RSG::material_storage->material_get_textures(p_instance->material_overlay, geom->streamed_textures);
+				}
 			}
 
 			if (can_cast_shadows != geom->can_cast_shadows) {
@@ -3933,6 +4226,7 @@ void RendererSceneCull::_update_dirty_instance(Instance *p_instance) {
 			}
 
 			geom->material_is_animated = is_animated;
+			_instance_update_static_shadow_caster(p_instance);
 			p_instance->instance_shader_uniforms = isparams;
 
 			if (p_instance->instance_allocated_shader_uniforms != (p_instance->instance_shader_uniforms.size() > 0)) {
@@ -4111,6 +4405,7 @@ RendererSceneCull *RendererSceneCull::singleton = nullptr;
 void RendererSceneCull::set_scene_render(RendererSceneRender *p_scene_render) {
 	scene_render = p_scene_render;
 	geometry_instance_pair_mask = scene_render->geometry_instance_get_pair_mask();
+	static_shadow_cache = GLOBAL_GET("rendering/lights_and_shadows/static_shadow_cache/enabled") && scene_render->is_static_shadow_cache_supported();
 }
 
 float get_halton_value(int index, int base) {
@@ -4133,6 +4428,7 @@ RendererSceneCull::RendererSceneCull() {
 
 	for (uint32_t i = 0; i < MAX_UPDATE_SHADOWS; i++) {
 		render_shadow_data[i].instances.set_page_pool(&geometry_instance_cull_page_pool);
+		render_shadow_data[i].dynamic_instances.set_page_pool(&geometry_instance_cull_page_pool);
 	}
 	for (uint32_t i = 0; i < SDFGI_MAX_CASCADES * SDFGI_MAX_REGIONS_PER_CASCADE; i++) {
 		render_sdfgi_data[i].instances.set_page_pool(&geometry_instance_cull_page_pool);
@@ -4145,6 +4441,10 @@ RendererSceneCull::RendererSceneCull() {
 	}
 
 	indexer_update_iterations = GLOBAL_GET("rendering/limits/spatial_indexer/update_iterations_per_frame");
+	texture_streaming = GLOBAL_GET("rendering/textures/streaming/enabled");
+	reflection_probe_max_faces_per_frame = GLOBAL_GET("rendering/reflections/reflection_probes/max_faces_per_frame");
+	reflection_probe_max_filter_steps_per_frame = GLOBAL_GET("rendering/reflections/reflection_probes/max_filter_steps_per_frame");
+
 	thread_cull_threshold = GLOBAL_GET("rendering/limits/spatial_indexer/threaded_cull_minimum_instances");
 	thread_cull_threshold = MAX(thread_cull_threshold, (uint32_t)WorkerThreadPool::get_singleton()->get_thread_count()); //make sure there is at least one thread per CPU
 
@@ -4163,6 +4463,7 @@ RendererSceneCull::~RendererSceneCull() {
 
 	for (uint32_t i = 0; i < MAX_UPDATE_SHADOWS; i++) {
 		render_shadow_data[i].instances.reset();
+		render_shadow_data[i].dynamic_instances.reset();
 	}
 	for (uint32_t i = 0; i < SDFGI_MAX_CASCADES * SDFGI_MAX_REGIONS_PER_CASCADE; i++) {
 		render_sdfgi_data[i].instances.reset();
@@ -33,6 +33,7 @@
 
 #include "core/math/dynamic_bvh.h"
 #include "core/templates/bin_sorted_array.h"
+#include "core/templates/flat_hash_map.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/paged_allocator.h"
 #include "core/templates/paged_array.h"
@@ -241,6 +242,66 @@ public:
 		}
 	};
 
+	enum {
+		INSTANCE_BOUNDS_PACK_SHIFT = 3,
+		INSTANCE_BOUNDS_PACK_SIZE = 1 << INSTANCE_BOUNDS_PACK_SHIFT,
+		INSTANCE_BOUNDS_PACK_MASK = INSTANCE_BOUNDS_PACK_SIZE - 1,
+	};
+
+	struct InstanceBoundsPack {
+		// Bounds of consecutive instances, min and max per axis,
+		// so culling can test the whole pack with a few vector operations.
+		real_t min[3][INSTANCE_BOUNDS_PACK_SIZE];
+		real_t max[3][INSTANCE_BOUNDS_PACK_SIZE];
+	};
+
+	struct InstanceBoundsArray {
+		PagedArray<InstanceBoundsPack> packs;
+		uint64_t count = 0;
+
+		_FORCE_INLINE_ uint64_t size() const {
+			return count;
+		}
+		_FORCE_INLINE_ InstanceBounds get(uint64_t p_index) const {
+			const InstanceBoundsPack &pack = packs[p_index >> INSTANCE_BOUNDS_PACK_SHIFT];
+			const uint32_t lane = p_index & INSTANCE_BOUNDS_PACK_MASK;
+			InstanceBounds r;
+			for (int i = 0; i < 3; i++) {
+				r.bounds[i] = pack.min[i][lane];
+				r.bounds[i + 3] = pack.max[i][lane];
+			}
+			return r;
+		}
+		_FORCE_INLINE_ void set(uint64_t p_index, const InstanceBounds &p_bounds) {
+			InstanceBoundsPack &pack = packs[p_index >> INSTANCE_BOUNDS_PACK_SHIFT];
+			const uint32_t lane = p_index & INSTANCE_BOUNDS_PACK_MASK;
+			for (int i = 0; i < 3; i++) {
+				pack.min[i][lane] = p_bounds.bounds[i];
+				pack.max[i][lane] = p_bounds.bounds[i + 3];
+			}
+		}
+		_FORCE_INLINE_ void push_back(const InstanceBounds &p_bounds) {
+			if ((count & INSTANCE_BOUNDS_PACK_MASK) == 0) {
+				packs.push_back(InstanceBoundsPack()); // Zeroed, so unused lanes hold no denormals or NaNs.
+			}
+			set(count++, p_bounds);
+		}
+		_FORCE_INLINE_ void pop_back() {
+			count--;
+			if ((count & INSTANCE_BOUNDS_PACK_MASK) == 0) {
+				packs.pop_back();
+			}
+		}
+		void reset() {
+			packs.reset();
+			count = 0;
+		}
+
+		// One bit per instance of the pack, set if the instance may be inside the frustum.
+		// Same test as InstanceBounds::in_frustum().
+		uint32_t get_pack_frustum_mask(uint64_t p_pack, const Frustum &p_frustum) const;
+	};
+
 	struct InstanceVisibilityNotifierData;
 
 	struct InstanceData {
@@ -303,7 +364,7 @@ public:
 		}
 	};
 
-	PagedArrayPool<InstanceBounds> instance_aabb_page_pool;
+	PagedArrayPool<InstanceBoundsPack> instance_aabb_page_pool;
 	PagedArrayPool<InstanceData> instance_data_page_pool;
 	PagedArrayPool<InstanceVisibilityData> instance_visibility_data_page_pool;
 
@@ -319,19 +380,20 @@ public:
 		RID self;
 
 		List<Instance *> directional_lights;
+		uint64_t static_shadow_version = 0; // Increased whenever a static shadow caster changes.
 		RID environment;
 		RID fallback_environment;
 		RID camera_attributes;
 		RID reflection_probe_shadow_atlas;
 		RID reflection_atlas;
 		uint64_t used_viewport_visibility_bits;
-		HashMap<RID, uint64_t> viewport_visibility_masks;
+		FlatHashMap<RID, uint64_t> viewport_visibility_masks;
 
 		SelfList<Instance>::List instances;
 
 		LocalVector<RID> dynamic_lights;
 
-		PagedArray<InstanceBounds> instance_aabbs;
+		InstanceBoundsArray instance_aabbs;
 		PagedArray<InstanceData> instance_data;
 		VisibilityArray instance_visibility;
 
@@ -469,6 +531,7 @@ public:
 		uint64_t last_frame_pass;
 
 		uint64_t version; // changes to this, and changes to base increase version
+		bool moved = false; // Transform changed after the first update, no longer a static shadow caster.
 
 		InstanceBaseData *base_data = nullptr;
 
@@ -611,6 +674,7 @@ public:
 		HashSet<Instance *> lights;
 		bool can_cast_shadows;
 		bool material_is_animated;
+		bool static_shadow_caster = false;
 		uint32_t projector_count = 0;
 		uint32_t softshadow_count = 0;
 
@@ -619,6 +683,8 @@ public:
 		HashSet<Instance *> voxel_gi_instances;
 		HashSet<Instance *> lightmap_captures;
 
+		LocalVector<RID> streamed_textures; // Only filled when texture streaming is enabled.
+
 		InstanceGeometryData() {
 			can_cast_shadows = true;
 			material_is_animated = true;
@@ -634,6 +700,8 @@ public:
 		SelfList<InstanceReflectionProbeData> update_list;
 
 		int render_step;
+		float camera_distance = 0.0; // To the closest camera that saw it since it was queued.
+		uint64_t queued_frame = 0;
 
 		InstanceReflectionProbeData() :
 				update_list(this) {
@@ -652,6 +720,9 @@ public:
 	};
 
 	SelfList<InstanceReflectionProbeData>::List reflection_probe_render_list;
+	// Per frame budgets shared by all reflection probes, 0 keeps the default scheduling.
+	int reflection_probe_max_faces_per_frame = 0;
+	int reflection_probe_max_filter_steps_per_frame = 0;
 
 	struct InstanceParticlesCollisionData : public InstanceBaseData {
 		RID instance;
@@ -680,6 +751,8 @@ public:
 		List<Instance *>::Element *D; // directional light in scenario
 
 		bool shadow_dirty;
+		bool static_shadow_dirty = true;
+		uint64_t static_shadow_version = 0; // Last scenario version cached, for directional lights.
 		bool uses_projector = false;
 		bool uses_softshadow = false;
 
@@ -829,9 +902,11 @@ public:
 		PagedArray<RID> voxel_gi_instances;
 		PagedArray<RID> mesh_instances;
 		PagedArray<RID> fog_volumes;
+		PagedArray<Instance *> streamed_texture_instances;
 
 		struct DirectionalShadow {
 			PagedArray<RenderGeometryInstance *> cascade_geometry_instances[RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES];
+			PagedArray<RenderGeometryInstance *> cascade_dynamic_geometry_instances[RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES]; // Only used with the static shadow cache.
 		} directional_shadows[RendererSceneRender::MAX_DIRECTIONAL_LIGHTS];
 
 		PagedArray<RenderGeometryInstance *> sdfgi_region_geometry_instances[SDFGI_MAX_CASCADES * SDFGI_MAX_REGIONS_PER_CASCADE];
@@ -847,9 +922,11 @@ public:
 			voxel_gi_instances.clear();
 			mesh_instances.clear();
 			fog_volumes.clear();
+			streamed_texture_instances.clear();
 			for (int i = 0; i < RendererSceneRender::MAX_DIRECTIONAL_LIGHTS; i++) {
 				for (int j = 0; j < RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES; j++) {
 					directional_shadows[i].cascade_geometry_instances[j].clear();
+					directional_shadows[i].cascade_dynamic_geometry_instances[j].clear();
 				}
 			}
 
@@ -872,9 +949,11 @@ public:
 			voxel_gi_instances.reset();
 			mesh_instances.reset();
 			fog_volumes.reset();
+			streamed_texture_instances.reset();
 			for (int i = 0; i < RendererSceneRender::MAX_DIRECTIONAL_LIGHTS; i++) {
 				for (int j = 0; j < RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES; j++) {
 					directional_shadows[i].cascade_geometry_instances[j].reset();
+					directional_shadows[i].cascade_dynamic_geometry_instances[j].reset();
 				}
 			}
 
@@ -897,10 +976,12 @@ public:
 			voxel_gi_instances.merge_unordered(p_cull_result.voxel_gi_instances);
 			mesh_instances.merge_unordered(p_cull_result.mesh_instances);
 			fog_volumes.merge_unordered(p_cull_result.fog_volumes);
+			streamed_texture_instances.merge_unordered(p_cull_result.streamed_texture_instances);
 
 			for (int i = 0; i < RendererSceneRender::MAX_DIRECTIONAL_LIGHTS; i++) {
 				for (int j = 0; j < RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES; j++) {
 					directional_shadows[i].cascade_geometry_instances[j].merge_unordered(p_cull_result.directional_shadows[i].cascade_geometry_instances[j]);
+					directional_shadows[i].cascade_dynamic_geometry_instances[j].merge_unordered(p_cull_result.directional_shadows[i].cascade_dynamic_geometry_instances[j]);
 				}
 			}
 
@@ -923,9 +1004,11 @@ public:
 			voxel_gi_instances.set_page_pool(p_rid_pool);
 			mesh_instances.set_page_pool(p_rid_pool);
 			fog_volumes.set_page_pool(p_rid_pool);
+			streamed_texture_instances.set_page_pool(p_instance_pool);
 			for (int i = 0; i < RendererSceneRender::MAX_DIRECTIONAL_LIGHTS; i++) {
 				for (int j = 0; j < RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES; j++) {
 					directional_shadows[i].cascade_geometry_instances[j].set_page_pool(p_geometry_instance_pool);
+					directional_shadows[i].cascade_dynamic_geometry_instances[j].set_page_pool(p_geometry_instance_pool);
 				}
 			}
 
@@ -950,6 +1033,9 @@ public:
 
 	uint32_t thread_cull_threshold = 200;
 
+	bool texture_streaming = false;
+	bool static_shadow_cache = false;
+
 	RID_Owner<Instance, true> instance_owner;
 
 	uint32_t geometry_instance_pair_mask = 0; // used in traditional forward, unnecessary on clustered
@@ -965,6 +1051,7 @@ public:
 	virtual void instance_set_layer_mask(RID p_instance, uint32_t p_mask);
 	virtual void instance_set_pivot_data(RID p_instance, float p_sorting_offset, bool p_use_aabb_center);
 	virtual void instance_set_transform(RID p_instance, const Transform3D &p_transform);
+	virtual void instance_set_transforms(const Vector<int64_t> &p_instances, const Vector<float> &p_transforms);
 	virtual void instance_attach_object_instance_id(RID p_instance, ObjectID p_id);
 	virtual void instance_set_blend_shape_weight(RID p_instance, int p_shape, float p_weight);
 	virtual void instance_set_surface_override_material(RID p_instance, int p_surface, RID p_material);
@@ -999,6 +1086,8 @@ public:
 	virtual void instance_geometry_set_lightmap(RID p_instance, RID p_lightmap, const Rect2 &p_lightmap_uv_scale, int p_slice_index);
 	virtual void instance_geometry_set_lod_bias(RID p_instance, float p_lod_bias);
 
+	void _instance_update_static_shadow_caster(Instance *p_instance);
+	void _request_streamed_textures(const RendererSceneRender::CameraData &p_camera_data, const Size2i &p_viewport_size);
 	void _update_instance_shader_uniforms_from_material(HashMap<StringName, Instance::InstanceShaderParameter> &isparams, const HashMap<StringName, Instance::InstanceShaderParameter> &existing_isparams, RID p_material);
 
 	virtual void instance_geometry_set_shader_parameter(RID p_instance, const StringName &p_parameter, const Variant &p_value);
@@ -1035,6 +1124,7 @@ public:
 
 			} cascades[RendererSceneRender::MAX_DIRECTIONAL_LIGHT_CASCADES]; //max 4 cascades
 			uint32_t cascade_count;
+			bool static_cache_dirty;
 
 		} shadows[RendererSceneRender::MAX_DIRECTIONAL_LIGHTS];
 
@@ -1079,6 +1169,7 @@ public:
 		const RendererSceneOcclusionCull::HZBuffer *occlusion_buffer;
 		const Projection *camera_matrix;
 		uint64_t visibility_viewport_mask;
+		bool static_shadow_cache = false;
 	};
 
 	void _scene_cull_threaded(uint32_t p_thread, CullData *cull_data);
@@ -1086,6 +1177,7 @@ public:
 	_FORCE_INLINE_ bool _visibility_parent_check(const CullData &p_cull_data, const InstanceData &p_instance_data);
 
 	bool _render_reflection_probe_step(Instance *p_instance, int p_step);
+	void _render_reflection_probes_budgeted();
 	void _render_scene(const RendererSceneRender::CameraData *p_camera_data, const Ref<RenderSceneBuffers> &p_render_buffers, RID p_environment, RID p_force_camera_attributes, uint32_t p_visible_layers, RID p_scenario, RID p_viewport, RID p_shadow_atlas, RID p_reflection_probe, int p_reflection_probe_pass, float p_screen_mesh_lod_threshold, bool p_using_shadows = true, RenderInfo *r_render_info = nullptr);
 	void render_empty_scene(const Ref<RenderSceneBuffers> &p_render_buffers, RID p_scenario, RID p_shadow_atlas);
 
@@ -1187,6 +1279,9 @@ public:
 	PASS1RC(float, environment_get_volumetric_fog_temporal_reprojection_amount, RID)
 	PASS1RC(float, environment_get_volumetric_fog_ambient_inject, RID)
 
+	PASS2(environment_set_volumetric_fog_resolution, RID, RS::EnvironmentVolumetricFogResolution)
+	PASS1RC(RS::EnvironmentVolumetricFogResolution, environment_get_volumetric_fog_resolution, RID)
+
 	// Glow
 	PASS13(environment_set_glow, RID, bool, Vector<float>, float, float, float, float, RS::EnvironmentGlowBlendMode, float, float, float, float, RID)
 
@@ -33,6 +33,7 @@
 
 #include "core/math/projection.h"
 #include "core/templates/local_vector.h"
+#include "servers/rendering/storage/render_scene_buffers.h"
 #include "servers/rendering_server.h"
 
 class RendererSceneOcclusionCull {
@@ -184,6 +185,8 @@ public:
 	virtual void buffer_set_scenario(RID p_buffer, RID p_scenario) { _print_warning(); }
 	virtual void buffer_set_size(RID p_buffer, const Vector2i &p_size) { _print_warning(); }
 	virtual void buffer_update(RID p_buffer, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) {}
+	// Called after the buffer's viewport was rendered, for implementations that cull against its depth.
+	virtual void buffer_capture(RID p_buffer, const Ref<RenderSceneBuffers> &p_render_buffers, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) {}
 
 	virtual RID buffer_get_debug_texture(RID p_buffer) {
 		_print_warning();
@@ -192,6 +195,8 @@ public:
 
 	virtual void set_build_quality(RS::ViewportOcclusionCullingBuildQuality p_quality) {}
 
+	virtual bool uses_depth_buffer() const { return false; }
+
 	RendererSceneOcclusionCull() {
 		singleton = this;
 	};
@@ -408,6 +408,14 @@ float RendererSceneRender::environment_get_volumetric_fog_ambient_inject(RID p_e
 	return environment_storage.environment_get_volumetric_fog_ambient_inject(p_env);
 }
 
+void RendererSceneRender::environment_set_volumetric_fog_resolution(RID p_env, RS::EnvironmentVolumetricFogResolution p_resolution) {
+	environment_storage.environment_set_volumetric_fog_resolution(p_env, p_resolution);
+}
+
+RS::EnvironmentVolumetricFogResolution RendererSceneRender::environment_get_volumetric_fog_resolution(RID p_env) const {
+	return environment_storage.environment_get_volumetric_fog_resolution(p_env);
+}
+
 // GLOW
 
 void RendererSceneRender::environment_set_glow(RID p_env, bool p_enable, Vector<float> p_levels, float p_intensity, float p_strength, float p_mix, float p_bloom_threshold, RS::EnvironmentGlowBlendMode p_blend_mode, float p_hdr_bleed_threshold, float p_hdr_bleed_scale, float p_hdr_luminance_cap, float p_glow_map_strength, RID p_glow_map) {
@@ -119,6 +119,18 @@ void RendererViewport::_configure_3d_render_buffers(Viewport *p_viewport) {
 			float scaling_3d_scale = p_viewport->scaling_3d_scale;
 			RS::ViewportScaling3DMode scaling_3d_mode = p_viewport->scaling_3d_mode;
 
+			if ((scaling_3d_mode == RS::VIEWPORT_SCALING_3D_MODE_TEMPORAL) && (scaling_3d_scale > 1.0)) {
+				// The temporal upscaler is not designed for downsampling either.
+				scaling_3d_mode = RS::VIEWPORT_SCALING_3D_MODE_BILINEAR;
+			}
+
+			if ((scaling_3d_mode == RS::VIEWPORT_SCALING_3D_MODE_TEMPORAL) && (!p_viewport->fsr_enabled || OS::get_singleton()->get_current_rendering_method() != "forward_plus")) {
+				// Motion vectors are only available in Forward+.
+				// Fall back to FSR 1.0, which is checked below.
+				WARN_PRINT_ONCE("Temporal 3D resolution scaling is only available when using the Forward+ renderer. Falling back to FSR 1.0 3D resolution scaling.");
+				scaling_3d_mode = RS::VIEWPORT_SCALING_3D_MODE_FSR;
+			}
+
 			if ((scaling_3d_mode == RS::VIEWPORT_SCALING_3D_MODE_FSR) && (scaling_3d_scale > 1.0)) {
 				// FSR is not designed for downsampling.
 				// Fall back to bilinear scaling.
@@ -151,6 +163,7 @@ void RendererViewport::_configure_3d_render_buffers(Viewport *p_viewport) {
 					render_height = height;
 					break;
 				case RS::VIEWPORT_SCALING_3D_MODE_FSR:
+				case RS::VIEWPORT_SCALING_3D_MODE_TEMPORAL:
 					width = p_viewport->size.width;
 					height = p_viewport->size.height;
 					render_width = MAX(width * scaling_3d_scale, 1.0); // width / (width * scaling)
@@ -176,6 +189,14 @@ void RendererViewport::_configure_3d_render_buffers(Viewport *p_viewport) {
 
 			p_viewport->internal_size = Size2(render_width, render_height);
 
+			bool use_temporal_upscale = scaling_3d_mode == RS::VIEWPORT_SCALING_3D_MODE_TEMPORAL;
+			if (use_temporal_upscale != p_viewport->use_temporal_upscale) {
+				if (!p_viewport->use_taa) {
+					num_viewports_with_motion_vectors += use_temporal_upscale ? 1 : -1;
+				}
+				p_viewport->use_temporal_upscale = use_temporal_upscale;
+			}
+
 			// At resolution scales lower than 1.0, use negative texture mipmap bias
 			// to compensate for the loss of sharpness.
 			const float texture_mipmap_bias = log2f(MIN(scaling_3d_scale, 1.0)) + p_viewport->texture_mipmap_bias;
@@ -221,7 +242,7 @@ void RendererViewport::_draw_3d(Viewport *p_viewport) {
 	}
 
 	float screen_mesh_lod_threshold = p_viewport->mesh_lod_threshold / float(p_viewport->size.width);
-	RSG::scene->render_camera(p_viewport->render_buffers, p_viewport->camera, p_viewport->scenario, p_viewport->self, p_viewport->internal_size, p_viewport->use_taa, screen_mesh_lod_threshold, p_viewport->shadow_atlas, xr_interface, &p_viewport->render_info);
+	RSG::scene->render_camera(p_viewport->render_buffers, p_viewport->camera, p_viewport->scenario, p_viewport->self, p_viewport->internal_size, p_viewport->use_taa || p_viewport->use_temporal_upscale, screen_mesh_lod_threshold, p_viewport->shadow_atlas, xr_interface, &p_viewport->render_info);
 
 	RENDER_TIMESTAMP("< Render 3D Scene");
 }
@@ -1194,7 +1215,9 @@ void RendererViewport::viewport_set_use_taa(RID p_viewport, bool p_use_taa) {
 		return;
 	}
 	viewport->use_taa = p_use_taa;
-	num_viewports_with_motion_vectors += p_use_taa ? 1 : -1;
+	if (!viewport->use_temporal_upscale) {
+		num_viewports_with_motion_vectors += p_use_taa ? 1 : -1;
+	}
 	_configure_3d_render_buffers(viewport);
 }
 
@@ -1379,7 +1402,7 @@ bool RendererViewport::free(RID p_rid) {
 			RendererSceneOcclusionCull::get_singleton()->remove_buffer(p_rid);
 		}
 
-		if (viewport->use_taa) {
+		if (viewport->use_taa || viewport->use_temporal_upscale) {
 			num_viewports_with_motion_vectors--;
 		}
 
@@ -72,6 +72,7 @@ public:
 		RS::ViewportMSAA msaa_3d = RenderingServer::VIEWPORT_MSAA_DISABLED;
 		RS::ViewportScreenSpaceAA screen_space_aa = RenderingServer::VIEWPORT_SCREEN_SPACE_AA_DISABLED;
 		bool use_taa = false;
+		bool use_temporal_upscale = false; // Resolved from scaling_3d_mode, needs the same jitter and motion vectors as TAA.
 		bool use_debanding = false;
 
 		RendererSceneRender::CameraData prev_camera_data;
@@ -716,6 +716,8 @@ public:
 		SUPPORTS_ATTACHMENT_VRS,
 		// If not supported, a fragment shader with only side effets (i.e., writes  to buffers, but doesn't output to attachments), may be optimized down to no-op by the GPU driver.
 		SUPPORTS_FRAGMENT_SHADER_WITH_ONLY_SIDE_EFFECTS,
+		// If not supported, async compute batches are recorded in order with the rest of the frame.
+		SUPPORTS_ASYNC_COMPUTE,
 	};
 	virtual bool has_feature(const Features p_feature) const = 0;
 
@@ -844,6 +846,12 @@ public:
 	virtual Error buffer_update(RID p_buffer, uint32_t p_offset, uint32_t p_size, const void *p_data, BitField<BarrierMask> p_post_barrier = BARRIER_MASK_ALL_BARRIERS) = 0;
 	virtual Error buffer_clear(RID p_buffer, uint32_t p_offset, uint32_t p_size, BitField<BarrierMask> p_post_barrier = BARRIER_MASK_ALL_BARRIERS) = 0;
 	virtual Vector<uint8_t> buffer_get_data(RID p_buffer, uint32_t p_offset = 0, uint32_t p_size = 0) = 0; // This causes stall, only use to retrieve large buffers for saving.
+	virtual Error buffer_get_data_async(RID p_buffer, const Callable &p_callback, uint32_t p_offset = 0, uint32_t p_size = 0) = 0; // Calls back with the data once the GPU is done with the current frame.
+	virtual uint64_t buffer_update_async(RID p_buffer, uint32_t p_offset, uint32_t p_size, const void *p_data, BitField<BarrierMask> p_post_barrier = BARRIER_MASK_ALL_BARRIERS) = 0; // Never stalls, returns 0 if the staging ring is full or an upload fence otherwise.
+	virtual bool upload_fence_is_signaled(uint64_t p_fence) const = 0;
+	virtual uint64_t buffer_update_late_latched(RID p_buffer, uint32_t p_offset, uint32_t p_size, const void *p_data, BitField<BarrierMask> p_post_barrier = BARRIER_MASK_ALL_BARRIERS) = 0; // Like buffer_update_async(), but returns a latch whose data can be replaced until the frame is submitted, or 0.
+	virtual bool buffer_late_latch_is_valid(uint64_t p_latch) const = 0; // False once the commands of the update were submitted.
+	virtual bool buffer_late_latch_write(uint64_t p_latch, const void *p_data) = 0;
 
 	/******************************************/
 	/**** PIPELINE SPECIALIZATION CONSTANT ****/
@@ -1180,6 +1188,7 @@ public:
 	virtual void draw_list_set_push_constant(DrawListID p_list, const void *p_data, uint32_t p_data_size) = 0;
 
 	virtual void draw_list_draw(DrawListID p_list, bool p_use_indices, uint32_t p_instances = 1, uint32_t p_procedural_vertices = 0) = 0;
+	virtual void draw_list_draw_indirect(DrawListID p_list, bool p_use_indices, RID p_buffer, uint32_t p_offset = 0, uint32_t p_draw_count = 1, uint32_t p_stride = 0) = 0;
 
 	virtual void draw_list_enable_scissor(DrawListID p_list, const Rect2 &p_rect) = 0;
 	virtual void draw_list_disable_scissor(DrawListID p_list) = 0;
@@ -1207,6 +1216,14 @@ public:
 
 	virtual void compute_list_end(BitField<BarrierMask> p_post_barrier = BARRIER_MASK_ALL_BARRIERS) = 0;
 
+	/***********************/
+	/**** ASYNC COMPUTE ****/
+	/***********************/
+
+	virtual void async_compute_begin() = 0;
+	virtual void async_compute_end() = 0;
+	virtual void async_compute_sync() = 0;
+
 	virtual void barrier(BitField<BarrierMask> p_from = BARRIER_MASK_ALL_BARRIERS, BitField<BarrierMask> p_to = BARRIER_MASK_ALL_BARRIERS) = 0;
 	virtual void full_barrier() = 0;
 
@@ -1291,10 +1308,15 @@ public:
 	enum MemoryType {
 		MEMORY_TEXTURES,
 		MEMORY_BUFFERS,
-		MEMORY_TOTAL
+		MEMORY_TOTAL,
+		MEMORY_RENDER_TARGETS, // Part of MEMORY_TEXTURES.
+		MEMORY_MESHES, // Part of MEMORY_BUFFERS.
+		MEMORY_STAGING,
+		MEMORY_DEVICE_LOCAL, // Usage of device-local heaps as reported by the driver, to compare with get_memory_budget().
 	};
 
 	virtual uint64_t get_memory_usage(MemoryType p_type) const = 0;
+	virtual uint64_t get_memory_budget() const = 0;
 
 	virtual RenderingDevice *create_local_device() = 0;
 
@@ -1310,6 +1332,10 @@ public:
 	virtual String get_device_api_version() const = 0;
 	virtual String get_device_pipeline_cache_uuid() const = 0;
 
+	virtual Error pipeline_bundle_save(const String &p_path) = 0;
+	virtual Error pipeline_bundle_precompile(const String &p_path) = 0;
+	virtual float pipeline_bundle_get_precompile_progress() const = 0;
+
 	virtual uint64_t get_driver_resource(DriverResource p_resource, RID p_rid = RID(), uint64_t p_index = 0) = 0;
 
 	static RenderingDevice *get_singleton();
@@ -1341,6 +1367,7 @@ protected:
 	RID _uniform_set_create(const TypedArray<RDUniform> &p_uniforms, RID p_shader, uint32_t p_shader_set);
 
 	Error _buffer_update(RID p_buffer, uint32_t p_offset, uint32_t p_size, const Vector<uint8_t> &p_data, BitField<BarrierMask> p_post_barrier = BARRIER_MASK_ALL_BARRIERS);
+	uint64_t _buffer_update_async(RID p_buffer, uint32_t p_offset, uint32_t p_size, const Vector<uint8_t> &p_data, BitField<BarrierMask> p_post_barrier = BARRIER_MASK_ALL_BARRIERS);
 
 	RID _render_pipeline_create(RID p_shader, FramebufferFormatID p_framebuffer_format, VertexFormatID p_vertex_format, RenderPrimitive p_render_primitive, const Ref<RDPipelineRasterizationState> &p_rasterization_state, const Ref<RDPipelineMultisampleState> &p_multisample_state, const Ref<RDPipelineDepthStencilState> &p_depth_stencil_state, const Ref<RDPipelineColorBlendState> &p_blend_state, BitField<PipelineDynamicStateFlags> p_dynamic_state_flags, uint32_t p_for_render_pass, const TypedArray<RDPipelineSpecializationConstant> &p_specialization_constants);
 	RID _compute_pipeline_create(RID p_shader, const TypedArray<RDPipelineSpecializationConstant> &p_specialization_constants);
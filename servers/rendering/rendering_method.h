@@ -74,6 +74,7 @@ public:
 	virtual void instance_set_layer_mask(RID p_instance, uint32_t p_mask) = 0;
 	virtual void instance_set_pivot_data(RID p_instance, float p_sorting_offset, bool p_use_aabb_center) = 0;
 	virtual void instance_set_transform(RID p_instance, const Transform3D &p_transform) = 0;
+	virtual void instance_set_transforms(const Vector<int64_t> &p_instances, const Vector<float> &p_transforms) = 0;
 	virtual void instance_attach_object_instance_id(RID p_instance, ObjectID p_id) = 0;
 	virtual void instance_set_blend_shape_weight(RID p_instance, int p_shape, float p_weight) = 0;
 	virtual void instance_set_surface_override_material(RID p_instance, int p_surface, RID p_material) = 0;
@@ -183,6 +184,9 @@ public:
 	virtual float environment_get_volumetric_fog_temporal_reprojection_amount(RID p_env) const = 0;
 	virtual float environment_get_volumetric_fog_ambient_inject(RID p_env) const = 0;
 
+	virtual void environment_set_volumetric_fog_resolution(RID p_env, RS::EnvironmentVolumetricFogResolution p_resolution) = 0;
+	virtual RS::EnvironmentVolumetricFogResolution environment_get_volumetric_fog_resolution(RID p_env) const = 0;
+
 	virtual void environment_set_volumetric_fog_volume_size(int p_size, int p_depth) = 0;
 	virtual void environment_set_volumetric_fog_filter_active(bool p_enable) = 0;
 
@@ -31,6 +31,7 @@
 #include "rendering_server_default.h"
 
 #include "core/config/project_settings.h"
+#include "core/debugger/trace_recorder.h"
 #include "core/io/marshalls.h"
 #include "core/os/os.h"
 #include "core/templates/sort_array.h"
@@ -69,6 +70,9 @@ void RenderingServerDefault::request_frame_drawn_callback(const Callable &p_call
 }
 
 void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
+	TRACE_ZONE("RenderingServer::_draw");
+	MEMORY_TAG_SCOPE("Rendering");
+
 	//needs to be done before changes is reset to 0, to not force the editor to redraw
 	RS::get_singleton()->emit_signal(SNAME("frame_pre_draw"));
 
@@ -84,12 +88,15 @@ void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
 
 	frame_setup_time = double(OS::get_singleton()->get_ticks_usec() - time_usec) / 1000.0;
 
-	RSG::particles_storage->update_particles(); //need to be done after instances are updated (colliders and particle transforms), and colliders are rendered
+	if (!server_mode) {
+		// In server mode the dummy rasterizer would discard all of this, skip culling the viewports too.
+		RSG::particles_storage->update_particles(); //need to be done after instances are updated (colliders and particle transforms), and colliders are rendered
 
-	RSG::scene->render_probes();
+		RSG::scene->render_probes();
 
-	RSG::viewport->draw_viewports();
-	RSG::canvas_render->update();
+		RSG::viewport->draw_viewports();
+		RSG::canvas_render->update();
+	}
 
 	if (OS::get_singleton()->get_current_rendering_driver_name() != "opengl3") {
 		// Already called for gl_compatibility renderer.
@@ -149,6 +156,10 @@ void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
 
 	frame_profile_frame = RSG::utilities->get_captured_timestamps_frame();
 
+	if (RSG::utilities->capturing_timestamps && frame_profile.size() > 1 && frame_profile_frame != frame_profile_pass_times_frame) {
+		_update_frame_profile_pass_times();
+	}
+
 	if (print_gpu_profile) {
 		if (print_frame_profile_ticks_from == 0) {
 			print_frame_profile_ticks_from = OS::get_singleton()->get_ticks_usec();
@@ -262,10 +273,27 @@ RenderingDevice::DeviceType RenderingServerDefault::get_video_adapter_type() con
 	return RSG::utilities->get_video_adapter_type();
 }
 
+float RenderingServerDefault::pipeline_bundle_get_precompile_progress() const {
+	// Only reads counters, so there is no need to sync with the render thread.
+	return RSG::utilities->pipeline_bundle_get_precompile_progress();
+}
+
 void RenderingServerDefault::set_frame_profiling_enabled(bool p_enable) {
+	if (p_enable && !RSG::utilities->capturing_timestamps) {
+		// Start the averages over, the frames in between weren't captured.
+		MutexLock lock(frame_profile_pass_mutex);
+		frame_profile_pass_times.clear();
+		frame_profile_total_time = FrameProfilePassTime();
+		frame_profile_history_index = 0;
+		frame_profile_history_count = 0;
+	}
 	RSG::utilities->capturing_timestamps = p_enable;
 }
 
+bool RenderingServerDefault::is_frame_profiling_enabled() const {
+	return RSG::utilities->capturing_timestamps;
+}
+
 uint64_t RenderingServerDefault::get_frame_profile_frame() {
 	return frame_profile_frame;
 }
@@ -274,6 +302,93 @@ Vector<RenderingServer::FrameProfileArea> RenderingServerDefault::get_frame_prof
 	return frame_profile;
 }
 
+void RenderingServerDefault::_update_frame_profile_pass_times() {
+	frame_profile_pass_times_frame = frame_profile_frame;
+
+	// Each timestamp marks the start of a pass, which lasts until the next one. Passes can run several times per frame.
+	HashMap<String, double> frame_times;
+	for (int i = 0; i < frame_profile.size() - 1; i++) {
+		const String &name = frame_profile[i].name;
+		if (name.is_empty() || name[0] == '<' || name[0] == '>' || name.begins_with("vp_")) {
+			continue;
+		}
+		double time = frame_profile[i + 1].gpu_msec - frame_profile[i].gpu_msec;
+		HashMap<String, double>::Iterator E = frame_times.find(name);
+		if (E) {
+			E->value += time;
+		} else {
+			frame_times.insert(name, time);
+		}
+	}
+
+	MutexLock lock(frame_profile_pass_mutex);
+
+	for (const KeyValue<String, double> &E : frame_times) {
+		if (!frame_profile_pass_times.has(E.key)) {
+			frame_profile_pass_times.insert(E.key, FrameProfilePassTime());
+		}
+	}
+
+	uint32_t index = frame_profile_history_index;
+	frame_profile_history_index = (frame_profile_history_index + 1) % FRAME_PROFILE_AVERAGE_FRAMES;
+	frame_profile_history_count = MIN(frame_profile_history_count + 1, (uint32_t)FRAME_PROFILE_AVERAGE_FRAMES);
+
+	auto push_time = [&](FrameProfilePassTime &r_pass, double p_time) {
+		r_pass.history[index] = p_time;
+		r_pass.last_msec = p_time;
+		double sum = 0.0;
+		for (uint32_t i = 0; i < frame_profile_history_count; i++) {
+			sum += r_pass.history[i];
+		}
+		r_pass.average_msec = sum / frame_profile_history_count;
+	};
+
+	LocalVector<String> unused;
+	for (KeyValue<String, FrameProfilePassTime> &E : frame_profile_pass_times) {
+		HashMap<String, double>::ConstIterator F = frame_times.find(E.key);
+		if (F) {
+			E.value.unused_frames = 0;
+			push_time(E.value, F->value);
+		} else {
+			// Passes that stopped running are forgotten once they are out of the average.
+			E.value.unused_frames++;
+			if (E.value.unused_frames >= FRAME_PROFILE_AVERAGE_FRAMES) {
+				unused.push_back(E.key);
+			} else {
+				push_time(E.value, 0.0);
+			}
+		}
+	}
+	for (const String &name : unused) {
+		frame_profile_pass_times.erase(name);
+	}
+
+	push_time(frame_profile_total_time, frame_profile[frame_profile.size() - 1].gpu_msec - frame_profile[0].gpu_msec);
+}
+
+PackedStringArray RenderingServerDefault::get_frame_profile_pass_names() const {
+	MutexLock lock(frame_profile_pass_mutex);
+	PackedStringArray names;
+	for (const KeyValue<String, FrameProfilePassTime> &E : frame_profile_pass_times) {
+		names.push_back(E.key);
+	}
+	return names;
+}
+
+double RenderingServerDefault::get_frame_profile_pass_gpu_time(const String &p_pass, bool p_average) const {
+	MutexLock lock(frame_profile_pass_mutex);
+	HashMap<String, FrameProfilePassTime>::ConstIterator E = frame_profile_pass_times.find(p_pass);
+	if (!E) {
+		return 0.0;
+	}
+	return p_average ? E->value.average_msec : E->value.last_msec;
+}
+
+double RenderingServerDefault::get_frame_profile_gpu_time(bool p_average) const {
+	MutexLock lock(frame_profile_pass_mutex);
+	return p_average ? frame_profile_total_time.average_msec : frame_profile_total_time.last_msec;
+}
+
 /* TESTING */
 
 void RenderingServerDefault::set_boot_image(const Ref<Image> &p_image, const Color &p_color, bool p_scale, bool p_use_filter) {
@@ -352,6 +467,8 @@ void RenderingServerDefault::_thread_callback(void *_instance) {
 
 void RenderingServerDefault::_thread_loop() {
 	server_thread = Thread::get_caller_id();
+	TraceRecorder::set_thread_name("Rendering");
+	MEMORY_TAG_SCOPE("Rendering");
 
 	DisplayServer::get_singleton()->make_rendering_thread();
 
@@ -392,11 +509,12 @@ void RenderingServerDefault::_call_on_render_thread(const Callable &p_callable)
 	p_callable.callp(nullptr, 0, ret, ce);
 }
 
-RenderingServerDefault::RenderingServerDefault(bool p_create_thread) :
+RenderingServerDefault::RenderingServerDefault(bool p_create_thread, bool p_server_mode) :
 		command_queue(p_create_thread) {
 	RenderingServer::init();
 
 	create_thread = p_create_thread;
+	server_mode = p_server_mode;
 
 	if (!p_create_thread) {
 		server_thread = Thread::get_caller_id();
@@ -65,6 +65,25 @@ class RenderingServerDefault : public RenderingServer {
 	uint64_t frame_profile_frame;
 	Vector<FrameProfileArea> frame_profile;
 
+	// GPU time of each pass over the last captured frames, for the rolling averages.
+	enum {
+		FRAME_PROFILE_AVERAGE_FRAMES = 60,
+	};
+	struct FrameProfilePassTime {
+		double history[FRAME_PROFILE_AVERAGE_FRAMES] = {};
+		double last_msec = 0.0;
+		double average_msec = 0.0;
+		uint32_t unused_frames = 0;
+	};
+	HashMap<String, FrameProfilePassTime> frame_profile_pass_times;
+	FrameProfilePassTime frame_profile_total_time;
+	uint32_t frame_profile_history_index = 0;
+	uint32_t frame_profile_history_count = 0;
+	uint64_t frame_profile_pass_times_frame = 0;
+	mutable Mutex frame_profile_pass_mutex;
+
+	void _update_frame_profile_pass_times();
+
 	double frame_setup_time = 0;
 
 	//for printing
@@ -209,6 +228,7 @@ public:
 	FUNC3(texture_set_detect_3d_callback, RID, TextureDetectCallback, void *)
 	FUNC3(texture_set_detect_normal_callback, RID, TextureDetectCallback, void *)
 	FUNC3(texture_set_detect_roughness_callback, RID, TextureDetectRoughnessCallback, void *)
+	FUNC3(texture_set_stream_callback, RID, TextureStreamCallback, void *)
 
 	FUNC2(texture_set_path, RID, const String &)
 	FUNC1RC(String, texture_get_path, RID)
@@ -341,6 +361,7 @@ public:
 	FUNC2RC(Color, multimesh_instance_get_custom_data, RID, int)
 
 	FUNC2(multimesh_set_buffer, RID, const Vector<float> &)
+	FUNC3(multimesh_set_buffer_range, RID, int, const Vector<float> &)
 	FUNC1RC(Vector<float>, multimesh_get_buffer, RID)
 
 	FUNC2(multimesh_set_visible_instances, RID, int)
@@ -352,6 +373,7 @@ public:
 	FUNC3(skeleton_allocate_data, RID, int, bool)
 	FUNC1RC(int, skeleton_get_bone_count, RID)
 	FUNC3(skeleton_bone_set_transform, RID, int, const Transform3D &)
+	FUNC2(skeleton_set_bone_transforms, RID, const Vector<float> &)
 	FUNC2RC(Transform3D, skeleton_bone_get_transform, RID, int)
 	FUNC3(skeleton_bone_set_transform_2d, RID, int, const Transform2D &)
 	FUNC2RC(Transform2D, skeleton_bone_get_transform_2d, RID, int)
@@ -536,6 +558,7 @@ public:
 	FUNC2(particles_collision_set_field_texture, RID, RID)
 	FUNC1(particles_collision_height_field_update, RID)
 	FUNC2(particles_collision_set_height_field_resolution, RID, ParticlesCollisionHeightfieldResolution)
+	FUNC4R(Vector<uint8_t>, particles_collision_bake_sdf, const Vector<Vector3> &, const AABB &, const Vector3i &, float)
 
 	/* FOG VOLUME */
 
@@ -715,6 +738,7 @@ public:
 
 	FUNC10(environment_set_fog, RID, bool, const Color &, float, float, float, float, float, float, float)
 	FUNC14(environment_set_volumetric_fog, RID, bool, float, const Color &, const Color &, float, float, float, float, float, bool, float, float, float)
+	FUNC2(environment_set_volumetric_fog_resolution, RID, EnvironmentVolumetricFogResolution)
 
 	FUNC2(environment_set_volumetric_fog_volume_size, int, int)
 	FUNC1(environment_set_volumetric_fog_filter_active, bool)
@@ -774,6 +798,7 @@ public:
 	FUNC2(instance_set_layer_mask, RID, uint32_t)
 	FUNC3(instance_set_pivot_data, RID, float, bool)
 	FUNC2(instance_set_transform, RID, const Transform3D &)
+	FUNC2(instance_set_transforms, const Vector<int64_t> &, const Vector<float> &)
 	FUNC2(instance_attach_object_instance_id, RID, ObjectID)
 	FUNC3(instance_set_blend_shape_weight, RID, int, float)
 	FUNC3(instance_set_surface_override_material, RID, int, RID)
@@ -959,6 +984,9 @@ public:
 	FUNC0RC(String, get_video_adapter_name)
 	FUNC0RC(String, get_video_adapter_vendor)
 	FUNC0RC(String, get_video_adapter_api_version)
+
+	FUNC1R(Error, pipeline_bundle_save, const String &)
+	FUNC1R(Error, pipeline_bundle_precompile, const String &)
 #undef server_name
 #undef ServerName
 #undef WRITE_ACTION
@@ -966,10 +994,15 @@ public:
 
 	virtual uint64_t get_rendering_info(RenderingInfo p_info) override;
 	virtual RenderingDevice::DeviceType get_video_adapter_type() const override;
+	virtual float pipeline_bundle_get_precompile_progress() const override;
 
 	virtual void set_frame_profiling_enabled(bool p_enable) override;
+	virtual bool is_frame_profiling_enabled() const override;
 	virtual Vector<FrameProfileArea> get_frame_profile() override;
 	virtual uint64_t get_frame_profile_frame() override;
+	virtual PackedStringArray get_frame_profile_pass_names() const override;
+	virtual double get_frame_profile_pass_gpu_time(const String &p_pass, bool p_average = true) const override;
+	virtual double get_frame_profile_gpu_time(bool p_average = true) const override;
 
 	virtual RID get_test_cube() override;
 
@@ -1024,7 +1057,7 @@ public:
 
 	virtual Size2i get_maximum_viewport_size() const override;
 
-	RenderingServerDefault(bool p_create_thread = false);
+	RenderingServerDefault(bool p_create_thread = false, bool p_server_mode = false);
 	~RenderingServerDefault();
 };
 
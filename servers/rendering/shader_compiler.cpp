@@ -31,7 +31,11 @@
 #include "shader_compiler.h"
 
 #include "core/config/project_settings.h"
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
 #include "core/os/os.h"
+#include "core/version.h"
+#include "servers/rendering/renderer_compositor.h"
 #include "servers/rendering/rendering_server_globals.h"
 #include "servers/rendering/shader_types.h"
 
@@ -1452,7 +1456,281 @@ ShaderLanguage::DataType ShaderCompiler::_get_global_shader_uniform_type(const S
 	return (ShaderLanguage::DataType)RS::global_shader_uniform_type_get_shader_datatype(gvt);
 }
 
+static const char *shader_cache_file_header = "GDSF";
+static const uint32_t shader_cache_file_version = 1;
+
+String ShaderCompiler::_get_cache_path(RS::ShaderMode p_mode, const String &p_code, const IdentifierActions *p_actions) {
+	if (cache_config.is_empty()) {
+		// Everything besides the code that the generated code depends on.
+		cache_config = vformat("[version:%s.%s][file:%d][method:%s][low_end:%d][xr:%d][editor:%d]", VERSION_FULL_BUILD, VERSION_HASH, shader_cache_file_version,
+				OS::get_singleton()->get_current_rendering_method(), RS::get_singleton()->is_low_end(), RendererCompositor::get_singleton()->is_xr_enabled(), Engine::get_singleton()->is_editor_hint());
+		for (const KeyValue<StringName, String> &E : actions.renames) {
+			cache_config += "[rename:" + String(E.key) + "=" + E.value + "]";
+		}
+		for (const KeyValue<StringName, String> &E : actions.render_mode_defines) {
+			cache_config += "[render_mode_define:" + String(E.key) + "=" + E.value + "]";
+		}
+		for (const KeyValue<StringName, String> &E : actions.usage_defines) {
+			cache_config += "[usage_define:" + String(E.key) + "=" + E.value + "]";
+		}
+		for (const KeyValue<StringName, String> &E : actions.custom_samplers) {
+			cache_config += "[custom_sampler:" + String(E.key) + "=" + E.value + "]";
+		}
+		cache_config += vformat("[filter:%d][repeat:%d][binding:%d][set:%d][varying:%d][luminance:%d][multiview:%d]", actions.default_filter, actions.default_repeat,
+				actions.base_texture_binding_index, actions.texture_layout_set, actions.base_varying_index, actions.apply_luminance_multiplier, actions.check_multiview_samplers);
+		cache_config += "[uniforms:" + actions.base_uniform_string + "][globals:" + actions.global_buffer_array_variable + "][instance:" + actions.instance_uniform_index_variable + "]";
+	}
+
+	String key = cache_config + "[mode:" + itos(p_mode) + "]";
+	for (const KeyValue<StringName, Stage> &E : p_actions->entry_point_stages) {
+		key += "[stage:" + String(E.key) + "=" + itos(E.value) + "]";
+	}
+	key += p_code;
+	return cache_dir.path_join(key.sha1_text()) + ".cache";
+}
+
+void ShaderCompiler::_apply_cached_actions(const CachedActions &p_cached_actions, IdentifierActions *p_actions) {
+	for (const StringName &E : p_cached_actions.render_modes) {
+		if (p_actions->render_mode_flags.has(E)) {
+			*p_actions->render_mode_flags[E] = true;
+		}
+		if (p_actions->render_mode_values.has(E)) {
+			Pair<int *, int> &p = p_actions->render_mode_values[E];
+			*p.first = p.second;
+		}
+	}
+	for (const StringName &E : p_cached_actions.usage_flags) {
+		if (p_actions->usage_flag_pointers.has(E)) {
+			*p_actions->usage_flag_pointers[E] = true;
+		}
+	}
+	for (const StringName &E : p_cached_actions.write_flags) {
+		if (p_actions->write_flag_pointers.has(E)) {
+			*p_actions->write_flag_pointers[E] = true;
+		}
+	}
+}
+
+static void _store_string_names(Ref<FileAccess> p_file, const Vector<StringName> &p_names) {
+	p_file->store_32(p_names.size());
+	for (const StringName &E : p_names) {
+		p_file->store_pascal_string(E);
+	}
+}
+
+static Vector<StringName> _get_string_names(Ref<FileAccess> p_file) {
+	Vector<StringName> names;
+	uint32_t count = p_file->get_32();
+	for (uint32_t i = 0; i < count && !p_file->eof_reached(); i++) {
+		names.push_back(p_file->get_pascal_string());
+	}
+	return names;
+}
+
+bool ShaderCompiler::_load_from_cache(const String &p_path, IdentifierActions *p_actions, GeneratedCode &r_gen_code) {
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ);
+	if (f.is_null()) {
+		return false;
+	}
+
+	char header[5] = { 0, 0, 0, 0, 0 };
+	f->get_buffer((uint8_t *)header, 4);
+	ERR_FAIL_COND_V(header != String(shader_cache_file_header), false);
+	if (f->get_32() != shader_cache_file_version) {
+		return false;
+	}
+
+	// Global uniforms are defined by the project, their type may have changed since the shader was cached.
+	uint32_t global_count = f->get_32();
+	for (uint32_t i = 0; i < global_count && !f->eof_reached(); i++) {
+		StringName name = f->get_pascal_string();
+		if (_get_global_shader_uniform_type(name) != SL::DataType(f->get_32())) {
+			return false;
+		}
+	}
+
+	CachedActions cached_actions;
+	cached_actions.render_modes = _get_string_names(f);
+	cached_actions.usage_flags = _get_string_names(f);
+	cached_actions.write_flags = _get_string_names(f);
+
+	HashMap<StringName, SL::ShaderNode::Uniform> uniforms;
+	uint32_t uniform_count = f->get_32();
+	for (uint32_t i = 0; i < uniform_count && !f->eof_reached(); i++) {
+		StringName name = f->get_pascal_string();
+		SL::ShaderNode::Uniform uniform;
+		uniform.order = f->get_32();
+		uniform.texture_order = f->get_32();
+		uniform.texture_binding = f->get_32();
+		uniform.type = SL::DataType(f->get_32());
+		uniform.precision = SL::DataPrecision(f->get_32());
+		uniform.array_size = f->get_32();
+		uniform.default_value.resize(f->get_32());
+		for (int j = 0; j < uniform.default_value.size(); j++) {
+			uniform.default_value.write[j].uint = f->get_32();
+		}
+		uniform.scope = SL::ShaderNode::Uniform::Scope(f->get_32());
+		uniform.hint = SL::ShaderNode::Uniform::Hint(f->get_32());
+		uniform.use_color = f->get_8();
+		uniform.filter = SL::TextureFilter(f->get_32());
+		uniform.repeat = SL::TextureRepeat(f->get_32());
+		for (int j = 0; j < 3; j++) {
+			uniform.hint_range[j] = f->get_float();
+		}
+		uniform.instance_index = f->get_32();
+		uniform.group = f->get_pascal_string();
+		uniform.subgroup = f->get_pascal_string();
+		uniforms.insert(name, uniform);
+	}
+
+	GeneratedCode gen_code;
+	uint32_t define_count = f->get_32();
+	for (uint32_t i = 0; i < define_count && !f->eof_reached(); i++) {
+		gen_code.defines.push_back(f->get_pascal_string());
+	}
+	uint32_t texture_count = f->get_32();
+	for (uint32_t i = 0; i < texture_count && !f->eof_reached(); i++) {
+		GeneratedCode::Texture texture;
+		texture.name = f->get_pascal_string();
+		texture.type = SL::DataType(f->get_32());
+		texture.hint = SL::ShaderNode::Uniform::Hint(f->get_32());
+		texture.use_color = f->get_8();
+		texture.filter = SL::TextureFilter(f->get_32());
+		texture.repeat = SL::TextureRepeat(f->get_32());
+		texture.global = f->get_8();
+		texture.array_size = f->get_32();
+		gen_code.texture_uniforms.push_back(texture);
+	}
+	gen_code.uniform_offsets.resize(f->get_32());
+	for (int i = 0; i < gen_code.uniform_offsets.size(); i++) {
+		gen_code.uniform_offsets.write[i] = f->get_32();
+	}
+	gen_code.uniform_total_size = f->get_32();
+	gen_code.uniforms = f->get_pascal_string();
+	for (int i = 0; i < STAGE_MAX; i++) {
+		gen_code.stage_globals[i] = f->get_pascal_string();
+	}
+	uint32_t code_count = f->get_32();
+	for (uint32_t i = 0; i < code_count && !f->eof_reached(); i++) {
+		String name = f->get_pascal_string();
+		gen_code.code[name] = f->get_pascal_string();
+	}
+	gen_code.uses_global_textures = f->get_8();
+	gen_code.uses_fragment_time = f->get_8();
+	gen_code.uses_vertex_time = f->get_8();
+	gen_code.uses_screen_texture_mipmaps = f->get_8();
+	gen_code.uses_screen_texture = f->get_8();
+	gen_code.uses_depth_texture = f->get_8();
+	gen_code.uses_normal_roughness_texture = f->get_8();
+
+	if (f->eof_reached() || f->get_position() != f->get_length()) {
+		return false; // Truncated or corrupted, it will be compiled and saved again.
+	}
+
+	r_gen_code = gen_code;
+	for (const KeyValue<StringName, SL::ShaderNode::Uniform> &E : uniforms) {
+		p_actions->uniforms->insert(E.key, E.value);
+	}
+	_apply_cached_actions(cached_actions, p_actions);
+	return true;
+}
+
+void ShaderCompiler::_save_to_cache(const String &p_path, const CachedActions &p_cached_actions, const IdentifierActions *p_actions, const GeneratedCode &p_gen_code) {
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE);
+	ERR_FAIL_COND(f.is_null());
+	f->store_buffer((const uint8_t *)shader_cache_file_header, 4);
+	f->store_32(shader_cache_file_version);
+
+	Vector<StringName> global_uniforms;
+	for (const KeyValue<StringName, SL::ShaderNode::Uniform> &E : *p_actions->uniforms) {
+		if (E.value.scope == SL::ShaderNode::Uniform::SCOPE_GLOBAL) {
+			global_uniforms.push_back(E.key);
+		}
+	}
+	f->store_32(global_uniforms.size());
+	for (const StringName &E : global_uniforms) {
+		f->store_pascal_string(E);
+		f->store_32(_get_global_shader_uniform_type(E));
+	}
+
+	_store_string_names(f, p_cached_actions.render_modes);
+	_store_string_names(f, p_cached_actions.usage_flags);
+	_store_string_names(f, p_cached_actions.write_flags);
+
+	f->store_32(p_actions->uniforms->size());
+	for (const KeyValue<StringName, SL::ShaderNode::Uniform> &E : *p_actions->uniforms) {
+		const SL::ShaderNode::Uniform &uniform = E.value;
+		f->store_pascal_string(E.key);
+		f->store_32(uniform.order);
+		f->store_32(uniform.texture_order);
+		f->store_32(uniform.texture_binding);
+		f->store_32(uniform.type);
+		f->store_32(uniform.precision);
+		f->store_32(uniform.array_size);
+		f->store_32(uniform.default_value.size());
+		for (const SL::ConstantNode::Value &value : uniform.default_value) {
+			f->store_32(value.uint);
+		}
+		f->store_32(uniform.scope);
+		f->store_32(uniform.hint);
+		f->store_8(uniform.use_color);
+		f->store_32(uniform.filter);
+		f->store_32(uniform.repeat);
+		for (int j = 0; j < 3; j++) {
+			f->store_float(uniform.hint_range[j]);
+		}
+		f->store_32(uniform.instance_index);
+		f->store_pascal_string(uniform.group);
+		f->store_pascal_string(uniform.subgroup);
+	}
+
+	f->store_32(p_gen_code.defines.size());
+	for (const String &E : p_gen_code.defines) {
+		f->store_pascal_string(E);
+	}
+	f->store_32(p_gen_code.texture_uniforms.size());
+	for (const GeneratedCode::Texture &texture : p_gen_code.texture_uniforms) {
+		f->store_pascal_string(texture.name);
+		f->store_32(texture.type);
+		f->store_32(texture.hint);
+		f->store_8(texture.use_color);
+		f->store_32(texture.filter);
+		f->store_32(texture.repeat);
+		f->store_8(texture.global);
+		f->store_32(texture.array_size);
+	}
+	f->store_32(p_gen_code.uniform_offsets.size());
+	for (const uint32_t offset : p_gen_code.uniform_offsets) {
+		f->store_32(offset);
+	}
+	f->store_32(p_gen_code.uniform_total_size);
+	f->store_pascal_string(p_gen_code.uniforms);
+	for (int i = 0; i < STAGE_MAX; i++) {
+		f->store_pascal_string(p_gen_code.stage_globals[i]);
+	}
+	f->store_32(p_gen_code.code.size());
+	for (const KeyValue<String, String> &E : p_gen_code.code) {
+		f->store_pascal_string(E.key);
+		f->store_pascal_string(E.value);
+	}
+	f->store_8(p_gen_code.uses_global_textures);
+	f->store_8(p_gen_code.uses_fragment_time);
+	f->store_8(p_gen_code.uses_vertex_time);
+	f->store_8(p_gen_code.uses_screen_texture_mipmaps);
+	f->store_8(p_gen_code.uses_screen_texture);
+	f->store_8(p_gen_code.uses_depth_texture);
+	f->store_8(p_gen_code.uses_normal_roughness_texture);
+}
+
 Error ShaderCompiler::compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code) {
+	String cache_path;
+	if (!cache_dir.is_empty()) {
+		cache_path = _get_cache_path(p_mode, p_code, p_actions);
+		if (_load_from_cache(cache_path, p_actions, r_gen_code)) {
+			return OK;
+		}
+	}
+
 	SL::ShaderCompileInfo info;
 	info.functions = ShaderTypes::get_singleton()->get_functions(p_mode);
 	info.render_modes = ShaderTypes::get_singleton()->get_modes(p_mode);
@@ -1555,11 +1833,56 @@ Error ShaderCompiler::compile(RS::ShaderMode p_mode, const String &p_code, Ident
 
 	shader = parser.get_shader();
 	function = nullptr;
-	_dump_node_code(shader, 1, r_gen_code, *p_actions, actions, false);
+
+	if (cache_path.is_empty()) {
+		_dump_node_code(shader, 1, r_gen_code, *p_actions, actions, false);
+		return OK;
+	}
+
+	// Generate against private usage and write flags, so the ones that get set can be stored and replayed from the cache.
+	IdentifierActions recorded_actions = *p_actions;
+	HashMap<StringName, bool> usage_flags;
+	HashMap<StringName, bool> write_flags;
+	for (KeyValue<StringName, bool *> &E : recorded_actions.usage_flag_pointers) {
+		E.value = &usage_flags.insert(E.key, false)->value;
+	}
+	for (KeyValue<StringName, bool *> &E : recorded_actions.write_flag_pointers) {
+		E.value = &write_flags.insert(E.key, false)->value;
+	}
+
+	_dump_node_code(shader, 1, r_gen_code, recorded_actions, actions, false);
+
+	CachedActions cached_actions;
+	cached_actions.render_modes = shader->render_modes;
+	for (const KeyValue<StringName, bool> &E : usage_flags) {
+		if (E.value) {
+			cached_actions.usage_flags.push_back(E.key);
+		}
+	}
+	for (const KeyValue<StringName, bool> &E : write_flags) {
+		if (E.value) {
+			cached_actions.write_flags.push_back(E.key);
+		}
+	}
+	_apply_cached_actions(cached_actions, p_actions);
+	_save_to_cache(cache_path, cached_actions, p_actions, r_gen_code);
 
 	return OK;
 }
 
+void ShaderCompiler::set_cache_dir(const String &p_dir) {
+	cache_dir = p_dir;
+	if (!cache_dir.is_empty() && !DirAccess::exists(cache_dir)) {
+		Error err = DirAccess::make_dir_recursive_absolute(cache_dir);
+		if (err != OK) {
+			ERR_PRINT("Can't create shader compiler cache folder, no shader code will be cached: " + cache_dir);
+			cache_dir = String();
+		}
+	}
+}
+
+String ShaderCompiler::cache_dir;
+
 void ShaderCompiler::initialize(DefaultIdentifierActions p_actions) {
 	actions = p_actions;
 
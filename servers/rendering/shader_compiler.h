@@ -127,9 +127,26 @@ private:
 
 	static ShaderLanguage::DataType _get_global_shader_uniform_type(const StringName &p_name);
 
+	// Caches the generated code on disk, so unchanged shaders skip parsing and code generation.
+	static String cache_dir;
+	String cache_config;
+
+	struct CachedActions {
+		Vector<StringName> render_modes;
+		Vector<StringName> usage_flags;
+		Vector<StringName> write_flags;
+	};
+
+	String _get_cache_path(RS::ShaderMode p_mode, const String &p_code, const IdentifierActions *p_actions);
+	void _apply_cached_actions(const CachedActions &p_cached_actions, IdentifierActions *p_actions);
+	bool _load_from_cache(const String &p_path, IdentifierActions *p_actions, GeneratedCode &r_gen_code);
+	void _save_to_cache(const String &p_path, const CachedActions &p_cached_actions, const IdentifierActions *p_actions, const GeneratedCode &p_gen_code);
+
 public:
 	Error compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code);
 
+	static void set_cache_dir(const String &p_dir);
+
 	void initialize(DefaultIdentifierActions p_actions);
 	ShaderCompiler();
 };
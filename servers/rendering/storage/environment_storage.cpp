@@ -376,6 +376,19 @@ float RendererEnvironmentStorage::environment_get_volumetric_fog_ambient_inject(
 	return env->volumetric_fog_ambient_inject;
 }
 
+void RendererEnvironmentStorage::environment_set_volumetric_fog_resolution(RID p_env, RS::EnvironmentVolumetricFogResolution p_resolution) {
+	Environment *env = environment_owner.get_or_null(p_env);
+	ERR_FAIL_COND(!env);
+	ERR_FAIL_INDEX(p_resolution, RS::ENV_VOLUMETRIC_FOG_RESOLUTION_QUARTER + 1);
+	env->volumetric_fog_resolution = p_resolution;
+}
+
+RS::EnvironmentVolumetricFogResolution RendererEnvironmentStorage::environment_get_volumetric_fog_resolution(RID p_env) const {
+	Environment *env = environment_owner.get_or_null(p_env);
+	ERR_FAIL_COND_V(!env, RS::ENV_VOLUMETRIC_FOG_RESOLUTION_FULL);
+	return env->volumetric_fog_resolution;
+}
+
 // GLOW
 
 void RendererEnvironmentStorage::environment_set_glow(RID p_env, bool p_enable, Vector<float> p_levels, float p_intensity, float p_strength, float p_mix, float p_bloom_threshold, RS::EnvironmentGlowBlendMode p_blend_mode, float p_hdr_bleed_threshold, float p_hdr_bleed_scale, float p_hdr_luminance_cap, float p_glow_map_strength, RID p_glow_map) {
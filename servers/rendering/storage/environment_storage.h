@@ -85,6 +85,7 @@ private:
 		float volumetric_fog_sky_affect = 1.0;
 		bool volumetric_fog_temporal_reprojection = true;
 		float volumetric_fog_temporal_reprojection_amount = 0.9;
+		RS::EnvironmentVolumetricFogResolution volumetric_fog_resolution = RS::ENV_VOLUMETRIC_FOG_RESOLUTION_FULL;
 
 		// Glow
 		bool glow_enabled = false;
@@ -218,6 +219,8 @@ public:
 	bool environment_get_volumetric_fog_temporal_reprojection(RID p_env) const;
 	float environment_get_volumetric_fog_temporal_reprojection_amount(RID p_env) const;
 	float environment_get_volumetric_fog_ambient_inject(RID p_env) const;
+	void environment_set_volumetric_fog_resolution(RID p_env, RS::EnvironmentVolumetricFogResolution p_resolution);
+	RS::EnvironmentVolumetricFogResolution environment_get_volumetric_fog_resolution(RID p_env) const;
 
 	// GLOW
 	void environment_set_glow(RID p_env, bool p_enable, Vector<float> p_levels, float p_intensity, float p_strength, float p_mix, float p_bloom_threshold, RS::EnvironmentGlowBlendMode p_blend_mode, float p_hdr_bleed_threshold, float p_hdr_bleed_scale, float p_hdr_luminance_cap, float p_glow_map_strength, RID p_glow_map);
@@ -31,6 +31,7 @@
 #ifndef MATERIAL_STORAGE_H
 #define MATERIAL_STORAGE_H
 
+#include "core/templates/local_vector.h"
 #include "servers/rendering_server.h"
 #include "utilities.h"
 
@@ -95,6 +96,7 @@ public:
 	};
 
 	virtual void material_get_instance_shader_parameters(RID p_material, List<InstanceShaderParam> *r_parameters) = 0;
+	virtual void material_get_textures(RID p_material, LocalVector<RID> &r_textures) = 0;
 
 	virtual void material_update_dependency(RID p_material, DependencyTracker *p_instance) = 0;
 };
@@ -183,6 +183,10 @@ public:
 	virtual RenderingDevice::DeviceType get_video_adapter_type() const = 0;
 	virtual String get_video_adapter_api_version() const = 0;
 
+	virtual Error pipeline_bundle_save(const String &p_path) = 0;
+	virtual Error pipeline_bundle_precompile(const String &p_path) = 0;
+	virtual float pipeline_bundle_get_precompile_progress() const = 0;
+
 	virtual Size2i get_maximum_viewport_size() const = 0;
 };
 
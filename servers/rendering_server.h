@@ -60,6 +60,8 @@ class RenderingServer : public Object {
 	virtual TypedArray<StringName> _global_shader_parameter_get_list() const;
 
 protected:
+	bool server_mode = false;
+
 	RID _make_test_cube();
 	void _free_internal_rids();
 	RID test_texture;
@@ -145,6 +147,11 @@ public:
 	typedef void (*TextureDetectRoughnessCallback)(void *, const String &, TextureDetectRoughnessChannel);
 	virtual void texture_set_detect_roughness_callback(RID p_texture, TextureDetectRoughnessCallback p_callback, void *p_userdata) = 0;
 
+	// Called with the largest texture size (0 means full size) the renderer wants resident, see rendering/textures/streaming.
+	typedef void (*TextureStreamCallback)(void *, int);
+
+	virtual void texture_set_stream_callback(RID p_texture, TextureStreamCallback p_callback, void *p_userdata) = 0;
+
 	struct TextureInfo {
 		RID texture;
 		uint32_t width;
@@ -396,6 +403,7 @@ public:
 	virtual Color multimesh_instance_get_custom_data(RID p_multimesh, int p_index) const = 0;
 
 	virtual void multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_buffer) = 0;
+	virtual void multimesh_set_buffer_range(RID p_multimesh, int p_from_instance, const Vector<float> &p_buffer) = 0;
 	virtual Vector<float> multimesh_get_buffer(RID p_multimesh) const = 0;
 
 	virtual void multimesh_set_visible_instances(RID p_multimesh, int p_visible) = 0;
@@ -407,6 +415,7 @@ public:
 	virtual void skeleton_allocate_data(RID p_skeleton, int p_bones, bool p_2d_skeleton = false) = 0;
 	virtual int skeleton_get_bone_count(RID p_skeleton) const = 0;
 	virtual void skeleton_bone_set_transform(RID p_skeleton, int p_bone, const Transform3D &p_transform) = 0;
+	virtual void skeleton_set_bone_transforms(RID p_skeleton, const Vector<float> &p_data) = 0;
 	virtual Transform3D skeleton_bone_get_transform(RID p_skeleton, int p_bone) const = 0;
 	virtual void skeleton_bone_set_transform_2d(RID p_skeleton, int p_bone, const Transform2D &p_transform) = 0;
 	virtual Transform2D skeleton_bone_get_transform_2d(RID p_skeleton, int p_bone) const = 0;
@@ -741,6 +750,8 @@ public:
 
 	virtual void particles_collision_set_height_field_resolution(RID p_particles_collision, ParticlesCollisionHeightfieldResolution p_resolution) = 0; // For SDF and vector field.
 
+	virtual Vector<uint8_t> particles_collision_bake_sdf(const Vector<Vector3> &p_faces, const AABB &p_aabb, const Vector3i &p_size, float p_thickness) = 0;
+
 	/* FOG VOLUME API */
 
 	virtual RID fog_volume_create() = 0;
@@ -807,6 +818,7 @@ public:
 	enum ViewportScaling3DMode {
 		VIEWPORT_SCALING_3D_MODE_BILINEAR,
 		VIEWPORT_SCALING_3D_MODE_FSR,
+		VIEWPORT_SCALING_3D_MODE_TEMPORAL,
 		VIEWPORT_SCALING_3D_MODE_MAX,
 		VIEWPORT_SCALING_3D_MODE_OFF = 255, // for internal use only
 	};
@@ -1146,6 +1158,14 @@ public:
 	virtual void environment_set_fog(RID p_env, bool p_enable, const Color &p_light_color, float p_light_energy, float p_sun_scatter, float p_density, float p_height, float p_height_density, float p_aerial_perspective, float p_sky_affect) = 0;
 
 	virtual void environment_set_volumetric_fog(RID p_env, bool p_enable, float p_density, const Color &p_albedo, const Color &p_emission, float p_emission_energy, float p_anisotropy, float p_length, float p_detail_spread, float p_gi_inject, bool p_temporal_reprojection, float p_temporal_reprojection_amount, float p_ambient_inject, float p_sky_affect) = 0;
+
+	enum EnvironmentVolumetricFogResolution {
+		ENV_VOLUMETRIC_FOG_RESOLUTION_FULL,
+		ENV_VOLUMETRIC_FOG_RESOLUTION_HALF,
+		ENV_VOLUMETRIC_FOG_RESOLUTION_QUARTER,
+	};
+
+	virtual void environment_set_volumetric_fog_resolution(RID p_env, EnvironmentVolumetricFogResolution p_resolution) = 0;
 	virtual void environment_set_volumetric_fog_volume_size(int p_size, int p_depth) = 0;
 	virtual void environment_set_volumetric_fog_filter_active(bool p_enable) = 0;
 
@@ -1226,6 +1246,8 @@ public:
 	virtual void instance_set_layer_mask(RID p_instance, uint32_t p_mask) = 0;
 	virtual void instance_set_pivot_data(RID p_instance, float p_sorting_offset, bool p_use_aabb_center) = 0;
 	virtual void instance_set_transform(RID p_instance, const Transform3D &p_transform) = 0;
+	// Each instance takes 12 floats, laid out like MultiMesh 3D transforms (basis rows interleaved with the origin).
+	virtual void instance_set_transforms(const Vector<int64_t> &p_instances, const Vector<float> &p_transforms) = 0;
 	virtual void instance_attach_object_instance_id(RID p_instance, ObjectID p_id) = 0;
 	virtual void instance_set_blend_shape_weight(RID p_instance, int p_shape, float p_weight) = 0;
 	virtual void instance_set_surface_override_material(RID p_instance, int p_surface, RID p_material) = 0;
@@ -1537,6 +1559,12 @@ public:
 		RENDERING_INFO_TEXTURE_MEM_USED,
 		RENDERING_INFO_BUFFER_MEM_USED,
 		RENDERING_INFO_VIDEO_MEM_USED,
+		RENDERING_INFO_RENDER_TARGET_MEM_USED,
+		RENDERING_INFO_MESH_MEM_USED,
+		RENDERING_INFO_STAGING_MEM_USED,
+		RENDERING_INFO_VIDEO_MEM_BUDGET,
+		RENDERING_INFO_SDFGI_CASCADE_UPDATES_IN_FRAME,
+		RENDERING_INFO_SDFGI_DEFERRED_CASCADE_UPDATES_IN_FRAME,
 		RENDERING_INFO_MAX
 	};
 
@@ -1546,6 +1574,10 @@ public:
 	virtual RenderingDevice::DeviceType get_video_adapter_type() const = 0;
 	virtual String get_video_adapter_api_version() const = 0;
 
+	virtual Error pipeline_bundle_save(const String &p_path) = 0;
+	virtual Error pipeline_bundle_precompile(const String &p_path) = 0;
+	virtual float pipeline_bundle_get_precompile_progress() const = 0;
+
 	struct FrameProfileArea {
 		String name;
 		double gpu_msec;
@@ -1553,8 +1585,12 @@ public:
 	};
 
 	virtual void set_frame_profiling_enabled(bool p_enable) = 0;
+	virtual bool is_frame_profiling_enabled() const = 0;
 	virtual Vector<FrameProfileArea> get_frame_profile() = 0;
 	virtual uint64_t get_frame_profile_frame() = 0;
+	virtual PackedStringArray get_frame_profile_pass_names() const = 0;
+	virtual double get_frame_profile_pass_gpu_time(const String &p_pass, bool p_average = true) const = 0;
+	virtual double get_frame_profile_gpu_time(bool p_average = true) const = 0;
 
 	virtual double get_frame_setup_time_cpu() const = 0;
 
@@ -1603,6 +1639,9 @@ public:
 	bool is_render_loop_enabled() const;
 	void set_render_loop_enabled(bool p_enabled);
 
+	// Nothing is ever drawn, so nodes can skip the server calls and work that only affect visuals.
+	_FORCE_INLINE_ bool is_in_server_mode() const { return server_mode; }
+
 	virtual void call_on_render_thread(const Callable &p_callable) = 0;
 
 	RenderingServer();
@@ -1677,6 +1716,7 @@ VARIANT_ENUM_CAST(RenderingServer::EnvironmentSSILQuality);
 VARIANT_ENUM_CAST(RenderingServer::EnvironmentSDFGIFramesToConverge);
 VARIANT_ENUM_CAST(RenderingServer::EnvironmentSDFGIRayCount);
 VARIANT_ENUM_CAST(RenderingServer::EnvironmentSDFGIFramesToUpdateLight);
+VARIANT_ENUM_CAST(RenderingServer::EnvironmentVolumetricFogResolution);
 VARIANT_ENUM_CAST(RenderingServer::EnvironmentSDFGIYScale);
 VARIANT_ENUM_CAST(RenderingServer::SubSurfaceScatteringQuality);
 VARIANT_ENUM_CAST(RenderingServer::DOFBlurQuality);
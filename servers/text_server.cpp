@@ -592,6 +592,7 @@ void TextServer::_bind_methods() {
 	BIND_ENUM_CONSTANT(FEATURE_USE_SUPPORT_DATA);
 	BIND_ENUM_CONSTANT(FEATURE_UNICODE_IDENTIFIERS);
 	BIND_ENUM_CONSTANT(FEATURE_UNICODE_SECURITY);
+	BIND_ENUM_CONSTANT(FEATURE_THREADED_SHAPING);
 
 	/* FT Contour Point Types */
 	BIND_ENUM_CONSTANT(CONTOUR_CURVE_TAG_ON);
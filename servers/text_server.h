@@ -175,6 +175,7 @@ public:
 		FEATURE_USE_SUPPORT_DATA = 1 << 12,
 		FEATURE_UNICODE_IDENTIFIERS = 1 << 13,
 		FEATURE_UNICODE_SECURITY = 1 << 14,
+		FEATURE_THREADED_SHAPING = 1 << 15,
 	};
 
 	enum ContourPointTag {
@@ -32,6 +32,8 @@
 #define TEST_JSON_H
 
 #include "core/io/json.h"
+#include "core/io/json_stream.h"
+#include "core/io/stream_peer.h"
 
 #include "thirdparty/doctest/doctest.h"
 
@@ -232,6 +234,249 @@ TEST_CASE("[JSON] Parsing escape sequences") {
 		ERR_PRINT_ON
 	}
 }
+
+static inline Array build_array() {
+	return Array();
+}
+template <typename... Targs>
+static inline Array build_array(Variant item, Targs... Fargs) {
+	Array a = build_array(Fargs...);
+	a.push_front(item);
+	return a;
+}
+
+static Ref<JSONReader> open_json_reader(const String &p_json) {
+	Ref<JSONReader> reader;
+	reader.instantiate();
+	reader->open_buffer(p_json.to_utf8_buffer());
+	return reader;
+}
+
+static String write_json(const Variant &p_value, const String &p_indent, bool p_sort_keys) {
+	Ref<StreamPeerBuffer> output;
+	output.instantiate();
+	Ref<JSONWriter> writer;
+	writer.instantiate();
+	writer->set_indent(p_indent);
+	writer->set_sort_keys(p_sort_keys);
+	writer->open_stream(output);
+	writer->write_value(p_value);
+	writer->close();
+	const Vector<uint8_t> data = output->get_data_array();
+	return String::utf8((const char *)data.ptr(), data.size());
+}
+
+TEST_CASE("[JSONReader] Event sequence of nested arrays and objects") {
+	Ref<JSONReader> reader = open_json_reader("{\"a\": [1, {\"b\": null}], \"c\": {}, \"d\": []}");
+
+	struct Event {
+		JSONReader::EventType type;
+		int depth;
+	};
+	const Event expected[] = {
+		{ JSONReader::EVENT_OBJECT_BEGIN, 1 },
+		{ JSONReader::EVENT_KEY, 1 },
+		{ JSONReader::EVENT_ARRAY_BEGIN, 2 },
+		{ JSONReader::EVENT_VALUE, 2 },
+		{ JSONReader::EVENT_OBJECT_BEGIN, 3 },
+		{ JSONReader::EVENT_KEY, 3 },
+		{ JSONReader::EVENT_VALUE, 3 },
+		{ JSONReader::EVENT_OBJECT_END, 2 },
+		{ JSONReader::EVENT_ARRAY_END, 1 },
+		{ JSONReader::EVENT_KEY, 1 },
+		{ JSONReader::EVENT_OBJECT_BEGIN, 2 },
+		{ JSONReader::EVENT_OBJECT_END, 1 },
+		{ JSONReader::EVENT_KEY, 1 },
+		{ JSONReader::EVENT_ARRAY_BEGIN, 2 },
+		{ JSONReader::EVENT_ARRAY_END, 1 },
+		{ JSONReader::EVENT_OBJECT_END, 0 },
+	};
+
+	bool sequence_matches = true;
+	Vector<String> keys;
+	Array values;
+	for (const Event &event : expected) {
+		sequence_matches &= reader->read() == OK && reader->get_event_type() == event.type && reader->get_depth() == event.depth;
+		if (reader->get_event_type() == JSONReader::EVENT_KEY) {
+			keys.push_back(reader->get_key());
+		} else if (reader->get_event_type() == JSONReader::EVENT_VALUE) {
+			values.push_back(reader->get_value());
+		}
+	}
+	CHECK_MESSAGE(sequence_matches, "The reader should produce the expected events at the expected depths.");
+	CHECK(keys == Vector<String>({ "a", "b", "c", "d" }));
+	CHECK(values == build_array(1.0, Variant()));
+
+	CHECK_MESSAGE(reader->read() == ERR_FILE_EOF, "The reader should report the end of the document.");
+	CHECK(reader->get_event_type() == JSONReader::EVENT_NONE);
+}
+
+TEST_CASE("[JSONReader] Reading values matches JSON.parse") {
+	const String documents[] = {
+		"null",
+		"-12.5e2",
+		"\"Text with \\\"escapes\\\" \\u00e9\"",
+		"[1, 2.5, true, false, null, \"x\", [], {}]",
+		"{\"a\": {\"b\": [1, {\"c\": [[], [2]]}]}, \"d\": \"e\", \"f\": -0.25}",
+	};
+
+	for (const String &document : documents) {
+		JSON json;
+		REQUIRE(json.parse(document) == OK);
+
+		Ref<JSONReader> reader = open_json_reader(document);
+		REQUIRE(reader->read() == OK);
+		const Variant value = reader->read_value();
+		CHECK_MESSAGE(value == json.get_data(), vformat("Reading `%s` should give the same value as JSON.parse().", document));
+		CHECK_MESSAGE(reader->read() == ERR_FILE_EOF, "The whole document should have been read.");
+	}
+
+	// Large enough to be read in several chunks from a stream.
+	Array large;
+	for (int i = 0; i < 20000; i++) {
+		Dictionary item;
+		item["index"] = i;
+		item["name"] = vformat("Item %d", i);
+		large.push_back(item);
+	}
+	const String large_json = JSON::stringify(large);
+	Ref<StreamPeerBuffer> input;
+	input.instantiate();
+	input->set_data_array(large_json.to_utf8_buffer());
+
+	Ref<JSONReader> reader;
+	reader.instantiate();
+	reader->open_stream(input);
+	REQUIRE(reader->read() == OK);
+	JSON json;
+	REQUIRE(json.parse(large_json) == OK);
+	CHECK_MESSAGE(reader->read_value() == json.get_data(), "Reading from a stream across chunks should give the same value as JSON.parse().");
+}
+
+TEST_CASE("[JSONReader] Skipping sections") {
+	Ref<JSONReader> reader = open_json_reader("{\"skip\": {\"x\": [1, 2, {\"y\": 3}]}, \"scalar\": 4, \"keep\": [5]}");
+
+	REQUIRE(reader->read() == OK);
+	REQUIRE(reader->read() == OK);
+	CHECK(reader->get_key() == "skip");
+	CHECK(reader->skip_section() == OK);
+	CHECK_MESSAGE(reader->get_depth() == 1, "Skipping a nested object should return to the depth of its key.");
+
+	REQUIRE(reader->read() == OK);
+	CHECK(reader->get_key() == "scalar");
+	CHECK(reader->skip_section() == OK);
+	CHECK_MESSAGE(reader->get_event_type() == JSONReader::EVENT_VALUE, "Skipping a scalar should only read its value.");
+
+	REQUIRE(reader->read() == OK);
+	CHECK(reader->get_key() == "keep");
+	CHECK(reader->read_value() == Variant(build_array(5.0)));
+
+	REQUIRE(reader->read() == OK);
+	CHECK(reader->get_event_type() == JSONReader::EVENT_OBJECT_END);
+	CHECK(reader->read() == ERR_FILE_EOF);
+}
+
+TEST_CASE("[JSONReader] Reading packed arrays") {
+	Ref<JSONReader> reader = open_json_reader("{\"ints\": [1, -2, 9007199254740993], \"floats\": [0.5, -1.25], \"bytes\": [0, 255], \"strings\": [\"a\", \"b\"], \"empty\": []}");
+	REQUIRE(reader->read() == OK);
+
+	REQUIRE(reader->read() == OK);
+	PackedInt64Array ints = reader->read_packed_array(Variant::PACKED_INT64_ARRAY);
+	CHECK(ints == PackedInt64Array({ 1, -2, 9007199254740993 }));
+
+	REQUIRE(reader->read() == OK);
+	PackedFloat32Array floats = reader->read_packed_array(Variant::PACKED_FLOAT32_ARRAY);
+	CHECK(floats == PackedFloat32Array({ 0.5, -1.25 }));
+
+	REQUIRE(reader->read() == OK);
+	PackedByteArray bytes = reader->read_packed_array(Variant::PACKED_BYTE_ARRAY);
+	CHECK(bytes == PackedByteArray({ 0, 255 }));
+
+	REQUIRE(reader->read() == OK);
+	PackedStringArray strings = reader->read_packed_array(Variant::PACKED_STRING_ARRAY);
+	CHECK(strings == PackedStringArray({ "a", "b" }));
+
+	REQUIRE(reader->read() == OK);
+	const Variant empty = reader->read_packed_array(Variant::PACKED_INT32_ARRAY);
+	CHECK(empty.get_type() == Variant::PACKED_INT32_ARRAY);
+	CHECK(PackedInt32Array(empty).is_empty());
+
+	REQUIRE(reader->read() == OK);
+	CHECK(reader->get_event_type() == JSONReader::EVENT_OBJECT_END);
+
+	Ref<JSONReader> mixed_reader = open_json_reader("[1, \"two\"]");
+	REQUIRE(mixed_reader->read() == OK);
+	CHECK_MESSAGE(mixed_reader->read_packed_array(Variant::PACKED_INT32_ARRAY) == Variant(), "A string in a numeric array should fail.");
+	CHECK(mixed_reader->read() == ERR_PARSE_ERROR);
+}
+
+TEST_CASE("[JSONReader] Malformed input") {
+	Ref<JSONReader> reader = open_json_reader("{\n\t\"a\": 1,\n\t\"b\" 2\n}");
+	REQUIRE(reader->read() == OK);
+	REQUIRE(reader->read() == OK);
+	REQUIRE(reader->read() == OK);
+	CHECK(reader->read() == ERR_PARSE_ERROR);
+	CHECK_MESSAGE(reader->get_error_line() == 3, "The error should be reported on the line of the missing ':'.");
+	CHECK(reader->get_error_message() == "Expected ':'");
+	CHECK_MESSAGE(reader->read() == ERR_PARSE_ERROR, "The reader should stay in the error state.");
+
+	reader = open_json_reader("[1,\n2,\n\n\"unterminated]");
+	REQUIRE(reader->read() == OK);
+	CHECK(reader->read_value() == Variant());
+	CHECK(reader->get_error_line() == 4);
+	CHECK(reader->get_error_message() == "Unterminated String");
+
+	reader = open_json_reader("[1] 2");
+	REQUIRE(reader->read() == OK);
+	REQUIRE(reader->read() == OK);
+	REQUIRE(reader->read() == OK);
+	CHECK(reader->read() == ERR_PARSE_ERROR);
+	CHECK(reader->get_error_line() == 1);
+	CHECK(reader->get_error_message() == "Expected 'EOF'");
+}
+
+TEST_CASE("[JSONWriter] Output matches JSON.stringify") {
+	Dictionary inner;
+	inner["z"] = true;
+	inner["y"] = Variant();
+	inner["x"] = PackedInt32Array({ 1, 2 });
+	Dictionary data;
+	data["b"] = build_array(1, 2.5, "text \"quoted\"", Array(), Dictionary());
+	data["a"] = inner;
+	data["c"] = -3;
+
+	CHECK(write_json(data, "", true) == JSON::stringify(data, "", true));
+	CHECK(write_json(data, "\t", true) == JSON::stringify(data, "\t", true));
+	CHECK(write_json(data, "  ", false) == JSON::stringify(data, "  ", false));
+	CHECK(write_json(data, "", false) == JSON::stringify(data, "", false));
+	CHECK(write_json("single value", "\t", true) == JSON::stringify("single value", "\t", true));
+
+	// Writing item by item gives the same output as a whole value.
+	Ref<StreamPeerBuffer> output;
+	output.instantiate();
+	Ref<JSONWriter> writer;
+	writer.instantiate();
+	writer->set_indent("\t");
+	writer->open_stream(output);
+	writer->begin_object();
+	writer->write_key("a");
+	writer->write_value(1);
+	writer->write_key("b");
+	writer->begin_array();
+	writer->write_value("x");
+	writer->begin_object();
+	writer->end_object();
+	writer->end_array();
+	writer->end_object();
+	CHECK(writer->get_depth() == 0);
+	CHECK(writer->close() == OK);
+
+	Dictionary expected;
+	expected["a"] = 1;
+	expected["b"] = build_array("x", Dictionary());
+	const Vector<uint8_t> written = output->get_data_array();
+	CHECK(String::utf8((const char *)written.ptr(), written.size()) == JSON::stringify(expected, "\t", false));
+}
 } // namespace TestJSON
 
 #endif // TEST_JSON_H
@@ -326,6 +326,72 @@ TEST_CASE("[Marshalls] FLOAT double precision Variant decoding") {
 	CHECK(r_len == 12);
 	CHECK(variant == Variant(0.33333333333333333));
 }
+TEST_CASE("[Marshalls] Single pass encoding matches encode_variant") {
+	Dictionary dict;
+	dict["name"] = "Godot";
+	dict[StringName("id")] = int64_t(1) << 40;
+	dict["scores"] = PackedInt32Array({ 1, 2, 3 });
+	dict["tags"] = PackedStringArray({ "", "a", "abcd" });
+
+	Array array;
+	array.push_back(dict);
+	array.push_back(0.15625);
+	array.push_back(Vector3(1, 2, 3));
+	array.push_back(PackedByteArray({ 1, 2, 3, 4, 5 }));
+	array.push_back(NodePath("a/b:c"));
+
+	int len = 0;
+	CHECK(encode_variant(array, nullptr, len) == OK);
+	Vector<uint8_t> expected;
+	expected.resize(len);
+	CHECK(encode_variant(array, expected.ptrw(), len) == OK);
+
+	// Reuses a buffer that is already larger than needed, and keeps what comes before the offset.
+	Vector<uint8_t> buffer;
+	buffer.resize(3);
+	buffer.fill(0xAB);
+	int buffer_len = 0;
+	CHECK(encode_variant_to_buffer(array, buffer, 3, buffer_len) == OK);
+	CHECK(buffer_len == len);
+	CHECK(buffer.size() >= 3 + len);
+	CHECK(buffer[0] == 0xAB);
+	CHECK(memcmp(buffer.ptr() + 3, expected.ptr(), len) == 0);
+
+	CHECK(encode_variant_to_buffer(Variant(), buffer, 0, buffer_len) == OK);
+	CHECK(buffer_len == 4);
+	CHECK(decode_uint32(buffer.ptr()) == Variant::NIL);
+}
+
+TEST_CASE("[Marshalls] Packed array views point into the encoded buffer") {
+	PackedFloat32Array floats({ 0.5f, 1.5f, 2.5f });
+	int len = 0;
+	Vector<uint8_t> buffer;
+	CHECK(encode_variant_to_buffer(floats, buffer, 0, len) == OK);
+
+	EncodedPackedArray view;
+	int view_len = 0;
+	CHECK(decode_packed_array_view(view, buffer.ptr(), len, &view_len) == OK);
+	CHECK(view_len == len);
+	CHECK(view.type == Variant::PACKED_FLOAT32_ARRAY);
+	CHECK(view.count == 3);
+	CHECK(view.item_size == 4);
+	CHECK(view.data == buffer.ptr() + 8);
+	CHECK(decode_float(view.data + 4) == 1.5f);
+
+	PackedByteArray bytes({ 1, 2, 3, 4, 5 });
+	CHECK(encode_variant_to_buffer(bytes, buffer, 0, len) == OK);
+	CHECK(decode_packed_array_view(view, buffer.ptr(), len, &view_len) == OK);
+	CHECK(view_len == 16); // Padded to 4 bytes, as decode_variant() does.
+	CHECK(view.count == 5);
+	CHECK(view.data[4] == 5);
+
+	// Truncated data and other types are rejected.
+	ERR_PRINT_OFF;
+	CHECK(decode_packed_array_view(view, buffer.ptr(), 10, nullptr) == ERR_INVALID_DATA);
+	CHECK(encode_variant_to_buffer("text", buffer, 0, len) == OK);
+	CHECK(decode_packed_array_view(view, buffer.ptr(), len, nullptr) == ERR_INVALID_PARAMETER);
+	ERR_PRINT_ON;
+}
 } // namespace TestMarshalls
 
 #endif // TEST_MARSHALLS_H
@@ -33,6 +33,7 @@
 
 #include "core/io/file_access_pack.h"
 #include "core/io/pck_packer.h"
+#include "core/math/random_pcg.h"
 #include "core/os/os.h"
 
 #include "tests/test_utils.h"
@@ -117,6 +118,146 @@ TEST_CASE("[PCKPacker] Pack a PCK file with some files and directories") {
 			f->get_length() <= 27000,
 			"The generated non-empty PCK file shouldn't be too large.");
 }
+
+// Spans three blocks, the last one partial.
+static Vector<uint8_t> get_compressible_data() {
+	Vector<uint8_t> data;
+	data.resize(PACK_COMPRESSION_BLOCK_SIZE * 2 + 12345);
+	uint8_t *w = data.ptrw();
+	for (int i = 0; i < data.size(); i++) {
+		w[i] = (i / 7 + i / 1000) % 97;
+	}
+	return data;
+}
+
+static Vector<uint8_t> get_random_data() {
+	RandomPCG rng(1234);
+	Vector<uint8_t> data;
+	data.resize(PACK_COMPRESSION_BLOCK_SIZE + 100);
+	uint8_t *w = data.ptrw();
+	for (int i = 0; i < data.size(); i++) {
+		w[i] = rng.rand() & 0xFF;
+	}
+	return data;
+}
+
+static String store_temp_file(const String &p_name, const Vector<uint8_t> &p_data) {
+	const String path = OS::get_singleton()->get_cache_path().path_join(p_name);
+	Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+	f->store_buffer(p_data.ptr(), p_data.size());
+	return path;
+}
+
+static void check_pack_file_contents(const Ref<FileAccess> &p_file, const Vector<uint8_t> &p_expected) {
+	REQUIRE(p_file.is_valid());
+	const uint64_t size = p_expected.size();
+	CHECK(p_file->get_length() == size);
+
+	Vector<uint8_t> buffer;
+	buffer.resize(size + 16);
+
+	// Whole file, then past its end.
+	CHECK(p_file->get_buffer(buffer.ptrw(), size) == size);
+	CHECK(memcmp(buffer.ptr(), p_expected.ptr(), size) == 0);
+	CHECK(p_file->get_position() == size);
+	CHECK(p_file->get_buffer(buffer.ptrw(), 16) == 0);
+	CHECK(p_file->eof_reached());
+
+	// Reads crossing block boundaries, going backwards so the cached block has to be replaced.
+	const uint64_t offsets[] = { size - 100, PACK_COMPRESSION_BLOCK_SIZE * 2 - 10, PACK_COMPRESSION_BLOCK_SIZE - 1, 0 };
+	for (uint64_t offset : offsets) {
+		const uint64_t length = MIN((uint64_t)PACK_COMPRESSION_BLOCK_SIZE + 20, size - offset);
+		p_file->seek(offset);
+		CHECK_FALSE(p_file->eof_reached());
+		CHECK(p_file->get_8() == p_expected[offset]);
+		CHECK(p_file->get_buffer(buffer.ptrw(), length - 1) == length - 1);
+		CHECK(memcmp(buffer.ptr(), p_expected.ptr() + offset + 1, length - 1) == 0);
+		CHECK(p_file->get_position() == offset + length);
+	}
+
+	// Positioned reads don't move the cursor.
+	p_file->seek(10);
+	const uint64_t at = PACK_COMPRESSION_BLOCK_SIZE - 3;
+	CHECK(p_file->get_buffer_at(at, buffer.ptrw(), PACK_COMPRESSION_BLOCK_SIZE + 6) == PACK_COMPRESSION_BLOCK_SIZE + 6);
+	CHECK(memcmp(buffer.ptr(), p_expected.ptr() + at, PACK_COMPRESSION_BLOCK_SIZE + 6) == 0);
+	CHECK(p_file->get_buffer_at(size - 5, buffer.ptrw(), 16) == 5);
+	CHECK(memcmp(buffer.ptr(), p_expected.ptr() + size - 5, 5) == 0);
+	CHECK(p_file->get_position() == 10);
+	CHECK(p_file->get_8() == p_expected[10]);
+}
+
+TEST_CASE("[PCKPacker] Compressed file blocks round trip") {
+	const Vector<uint8_t> data = get_compressible_data();
+
+	SUBCASE("FastLZ") {
+		Vector<uint8_t> stored = PackedData::compress_file(data.ptr(), data.size(), Compression::MODE_FASTLZ);
+		REQUIRE_FALSE(stored.is_empty());
+		CHECK(stored.size() < data.size());
+
+		PackedData::PackedFile pf;
+		pf.pack = store_temp_file("compressed_blocks_fastlz.bin", stored);
+		pf.offset = 0;
+		pf.size = data.size();
+		pf.encrypted = false;
+		pf.compressed = true;
+		check_pack_file_contents(memnew(FileAccessPack(pf.pack, pf)), data);
+	}
+
+	SUBCASE("Zstandard") {
+		Vector<uint8_t> stored = PackedData::compress_file(data.ptr(), data.size(), Compression::MODE_ZSTD);
+		REQUIRE_FALSE(stored.is_empty());
+		CHECK(stored.size() < data.size());
+
+		PackedData::PackedFile pf;
+		pf.pack = store_temp_file("compressed_blocks_zstd.bin", stored);
+		pf.offset = 0;
+		pf.size = data.size();
+		pf.encrypted = false;
+		pf.compressed = true;
+		check_pack_file_contents(memnew(FileAccessPack(pf.pack, pf)), data);
+	}
+
+	SUBCASE("Incompressible data isn't compressed") {
+		const Vector<uint8_t> random = get_random_data();
+		CHECK(PackedData::compress_file(random.ptr(), random.size(), Compression::MODE_ZSTD).is_empty());
+		CHECK(PackedData::compress_file(random.ptr(), random.size(), Compression::MODE_FASTLZ).is_empty());
+	}
+
+	SUBCASE("Brotli can't compress") {
+		ERR_PRINT_OFF;
+		CHECK(PackedData::compress_file(data.ptr(), data.size(), Compression::MODE_BROTLI).is_empty());
+		ERR_PRINT_ON;
+	}
+}
+
+TEST_CASE("[PCKPacker] Pack and read back compressed files") {
+	const Vector<uint8_t> data = get_compressible_data();
+	const Vector<uint8_t> random = get_random_data();
+	const String data_path = store_temp_file("compressible.bin", data);
+	const String random_path = store_temp_file("random.bin", random);
+
+	PCKPacker pck_packer;
+	const String output_pck_path = OS::get_singleton()->get_cache_path().path_join("output_compressed.pck");
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	CHECK(pck_packer.add_file("res://pck_compression/compressed.bin", data_path, false, true) == OK);
+	CHECK(pck_packer.add_file("res://pck_compression/encrypted.bin", data_path, true, true) == OK);
+	CHECK(pck_packer.add_file("res://pck_compression/uncompressed.bin", data_path, false, false) == OK);
+	CHECK(pck_packer.add_file("res://pck_compression/random.bin", random_path, false, true) == OK);
+	REQUIRE(pck_packer.flush() == OK);
+
+	{
+		// Only the uncompressed and the incompressible files are stored at full size.
+		Ref<FileAccess> f = FileAccess::open(output_pck_path, FileAccess::READ);
+		REQUIRE(f.is_valid());
+		CHECK(f->get_length() < uint64_t(data.size()) * 2 + random.size());
+	}
+
+	REQUIRE(PackedData::get_singleton()->add_pack(output_pck_path, true, 0) == OK);
+	check_pack_file_contents(FileAccess::open("res://pck_compression/compressed.bin", FileAccess::READ), data);
+	check_pack_file_contents(FileAccess::open("res://pck_compression/encrypted.bin", FileAccess::READ), data);
+	check_pack_file_contents(FileAccess::open("res://pck_compression/uncompressed.bin", FileAccess::READ), data);
+	check_pack_file_contents(FileAccess::open("res://pck_compression/random.bin", FileAccess::READ), random);
+}
 } // namespace TestPCKPacker
 
 #endif // TEST_PCK_PACKER_H
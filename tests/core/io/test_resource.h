@@ -110,6 +110,40 @@ TEST_CASE("[Resource] Saving and loading") {
 			"The loaded child resource name should be equal to the expected value.");
 }
 
+TEST_CASE("[Resource] Saving and loading many subresources") {
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_name("Root");
+	for (int i = 0; i < 100; i++) {
+		Ref<Resource> child_resource = memnew(Resource);
+		child_resource->set_name(vformat("Child %d", i));
+		resource->set_meta(vformat("child_%d", i), child_resource);
+	}
+
+	const String save_path = OS::get_singleton()->get_cache_path().path_join("resource_many.res");
+	const String save_path_compressed = OS::get_singleton()->get_cache_path().path_join("resource_many_compressed.res");
+	ResourceSaver::save(resource, save_path);
+	ResourceSaver::save(resource, save_path_compressed, ResourceSaver::FLAG_COMPRESS);
+
+	const Ref<Resource> &loaded_resource = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	const Ref<Resource> &loaded_resource_compressed = ResourceLoader::load(save_path_compressed, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	CHECK_MESSAGE(
+			loaded_resource->get_name() == "Root",
+			"The loaded resource name should be equal to the expected value.");
+	CHECK_MESSAGE(
+			loaded_resource_compressed->get_name() == "Root",
+			"The loaded compressed resource name should be equal to the expected value.");
+	for (int i = 0; i < 100; i++) {
+		const Ref<Resource> &loaded_child_resource = loaded_resource->get_meta(vformat("child_%d", i));
+		CHECK_MESSAGE(
+				loaded_child_resource->get_name() == vformat("Child %d", i),
+				"The loaded child resource names should keep their order.");
+		const Ref<Resource> &loaded_child_resource_compressed = loaded_resource_compressed->get_meta(vformat("child_%d", i));
+		CHECK_MESSAGE(
+				loaded_child_resource_compressed->get_name() == vformat("Child %d", i),
+				"The loaded compressed child resource names should keep their order.");
+	}
+}
+
 TEST_CASE("[Resource] Breaking circular references on save") {
 	Ref<Resource> resource_a = memnew(Resource);
 	resource_a->set_name("A");
@@ -32,6 +32,8 @@
 #define TEST_ASTAR_H
 
 #include "core/math/a_star.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
 
 #include "tests/test_macros.h"
 
@@ -357,6 +359,96 @@ TEST_CASE("[Stress][AStar3D] Find paths") {
 		CHECK_MESSAGE(match, "Found all paths.");
 	}
 }
+
+struct GridQueries {
+	AStar3D *astar = nullptr;
+	LocalVector<Vector2i> queries;
+	LocalVector<Vector<int64_t>> paths;
+
+	static void solve(void *p_userdata, uint32_t p_index) {
+		GridQueries *self = (GridQueries *)p_userdata;
+		self->paths[p_index] = self->astar->get_id_path(self->queries[p_index].x, self->queries[p_index].y);
+	}
+};
+
+static void build_grid(AStar3D &r_astar, int p_size) {
+	for (int y = 0; y < p_size; y++) {
+		for (int x = 0; x < p_size; x++) {
+			r_astar.add_point(y * p_size + x, Vector3(x, y, 0), 1.0 + (Math::rand() % 4));
+			if (x > 0) {
+				r_astar.connect_points(y * p_size + x, y * p_size + x - 1);
+			}
+			if (y > 0) {
+				r_astar.connect_points(y * p_size + x, (y - 1) * p_size + x);
+			}
+		}
+	}
+}
+
+static uint64_t run_grid_queries(GridQueries &r_queries, bool p_parallel) {
+	uint64_t begin_usec = OS::get_singleton()->get_ticks_usec();
+	r_queries.paths.clear();
+	r_queries.paths.resize(r_queries.queries.size());
+	if (p_parallel) {
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(&GridQueries::solve, &r_queries, r_queries.queries.size());
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	} else {
+		for (uint32_t i = 0; i < r_queries.queries.size(); i++) {
+			GridQueries::solve(&r_queries, i);
+		}
+	}
+	return OS::get_singleton()->get_ticks_usec() - begin_usec;
+}
+
+TEST_CASE("[AStar3D] Concurrent queries") {
+	const int size = 20;
+	Math::seed(0);
+
+	AStar3D a;
+	build_grid(a, size);
+	a.set_point_disabled(size + 1);
+
+	GridQueries queries;
+	queries.astar = &a;
+	for (int i = 0; i < 200; i++) {
+		queries.queries.push_back(Vector2i(Math::rand() % (size * size), Math::rand() % (size * size)));
+	}
+
+	run_grid_queries(queries, false);
+	LocalVector<Vector<int64_t>> serial_paths = queries.paths;
+	run_grid_queries(queries, true);
+
+	bool match = true;
+	for (uint32_t i = 0; i < queries.queries.size(); i++) {
+		match = match && queries.paths[i] == serial_paths[i];
+	}
+	CHECK_MESSAGE(match, "Paths found from several threads should match the ones found one after another.");
+}
+
+TEST_CASE("[Stress][AStar3D] Large graph queries") {
+	const int size = 300;
+	Math::seed(0);
+
+	AStar3D a;
+	build_grid(a, size);
+
+	GridQueries queries;
+	queries.astar = &a;
+	for (int i = 0; i < 256; i++) {
+		queries.queries.push_back(Vector2i(Math::rand() % (size * size), Math::rand() % (size * size)));
+	}
+
+	uint64_t serial_usec = run_grid_queries(queries, false);
+	LocalVector<Vector<int64_t>> serial_paths = queries.paths;
+	uint64_t parallel_usec = run_grid_queries(queries, true);
+	print_verbose(vformat("%d queries on %d points: %d usec serial, %d usec parallel.", queries.queries.size(), size * size, serial_usec, parallel_usec));
+
+	bool match = true;
+	for (uint32_t i = 0; i < queries.queries.size(); i++) {
+		match = match && queries.paths[i] == serial_paths[i] && !queries.paths[i].is_empty();
+	}
+	CHECK_MESSAGE(match, "All queries should find the same path from several threads.");
+}
 } // namespace TestAStar
 
 #endif // TEST_ASTAR_H
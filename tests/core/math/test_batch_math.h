@@ -0,0 +1,117 @@
+/**************************************************************************/
+/*  test_batch_math.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_BATCH_MATH_H
+#define TEST_BATCH_MATH_H
+
+#include "core/math/batch_math.h"
+
+#include "tests/test_macros.h"
+
+namespace TestBatchMath {
+
+Transform3D make_batch_transform(int p_index) {
+	Basis basis = Basis(Vector3(1, 2, 3).normalized(), 0.3 * p_index).scaled(Vector3(1, 2, 0.5 + p_index));
+	return Transform3D(basis, Vector3(p_index, -2 * p_index, 0.5));
+}
+
+TEST_CASE("[BatchMath] Single element kernels match Transform3D") {
+	const Transform3D a = make_batch_transform(1);
+	const Transform3D b = make_batch_transform(2);
+	CHECK(BatchMath::multiply(a, b).is_equal_approx(a * b));
+
+	const AABB aabb = AABB(Vector3(-1, 2, -3), Vector3(2, 4, 1));
+	CHECK(BatchMath::xform(a, aabb).is_equal_approx(a.xform(aabb)));
+	// A negative scale swaps the corners that end up as the minimum.
+	const Transform3D flipped = a.scaled(Vector3(-1, 1, -1));
+	CHECK(BatchMath::xform(flipped, aabb).is_equal_approx(flipped.xform(aabb)));
+}
+
+TEST_CASE("[BatchMath] Array kernels match Transform3D") {
+	const Transform3D xform = make_batch_transform(3);
+	const uint32_t count = 7; // Not a multiple of any vector width.
+
+	Vector3 points[count];
+	AABB aabbs[count];
+	Transform3D transforms[count];
+	Transform3D others[count];
+	for (uint32_t i = 0; i < count; i++) {
+		points[i] = Vector3(i, 1.0 - i, 0.25 * i);
+		aabbs[i] = AABB(points[i], Vector3(1, i + 1, 2));
+		transforms[i] = make_batch_transform(i);
+		others[i] = make_batch_transform(count - i);
+	}
+
+	Vector3 xformed_points[count];
+	BatchMath::xform_points(xform, points, xformed_points, count);
+	AABB xformed_aabbs[count];
+	BatchMath::xform_aabbs(xform, aabbs, xformed_aabbs, count);
+	Transform3D products[count];
+	BatchMath::multiply_transforms(xform, transforms, products, count);
+	Transform3D pairwise[count];
+	BatchMath::multiply_transforms(transforms, others, pairwise, count);
+
+	bool all_equal = true;
+	for (uint32_t i = 0; i < count; i++) {
+		all_equal &= xformed_points[i].is_equal_approx(xform.xform(points[i]));
+		all_equal &= xformed_aabbs[i].is_equal_approx(xform.xform(aabbs[i]));
+		all_equal &= products[i].is_equal_approx(xform * transforms[i]);
+		all_equal &= pairwise[i].is_equal_approx(transforms[i] * others[i]);
+	}
+	CHECK(all_equal);
+}
+
+TEST_CASE("[BatchMath] Array kernels work in place") {
+	const Transform3D xform = make_batch_transform(2);
+	const uint32_t count = 5;
+
+	Vector3 points[count];
+	Transform3D transforms[count];
+	Transform3D expected[count];
+	for (uint32_t i = 0; i < count; i++) {
+		points[i] = Vector3(i, 2, -1.0 * i);
+		transforms[i] = make_batch_transform(i);
+		expected[i] = xform * transforms[i];
+	}
+
+	BatchMath::xform_points(xform, points, points, count);
+	BatchMath::multiply_transforms(xform, transforms, transforms, count);
+
+	bool all_equal = true;
+	for (uint32_t i = 0; i < count; i++) {
+		all_equal &= points[i].is_equal_approx(xform.xform(Vector3(i, 2, -1.0 * i)));
+		all_equal &= transforms[i].is_equal_approx(expected[i]);
+	}
+	CHECK(all_equal);
+}
+
+} // namespace TestBatchMath
+
+#endif // TEST_BATCH_MATH_H
@@ -0,0 +1,226 @@
+/**************************************************************************/
+/*  test_bvh.h                                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_BVH_H
+#define TEST_BVH_H
+
+#include "core/math/bvh.h"
+#include "core/math/random_pcg.h"
+#include "core/templates/hash_set.h"
+
+#include "tests/test_macros.h"
+
+namespace TestBVH {
+
+class BVHTestPairFunction {
+public:
+	static bool user_pair_check(const int *p_a, const int *p_b) {
+		return true;
+	}
+};
+
+class BVHTestCullFunction {
+public:
+	static bool user_cull_check(const int *p_a, const int *p_b) {
+		return true;
+	}
+};
+
+typedef BVH_Manager<int, 1, false, 32, BVHTestPairFunction, BVHTestCullFunction> TestBVHManager;
+
+struct BVHTestData {
+	TestBVHManager bvh;
+	LocalVector<int> ids;
+	LocalVector<BVHHandle> handles;
+	LocalVector<AABB> aabbs;
+	RandomPCG rng = RandomPCG(1234);
+
+	AABB random_aabb(real_t p_range) {
+		Vector3 position(rng.random(-p_range, p_range), rng.random(-p_range, p_range), rng.random(-p_range, p_range));
+		return AABB(position, Vector3(rng.random(0.1, 2.0), rng.random(0.1, 2.0), rng.random(0.1, 2.0)));
+	}
+
+	void create(uint32_t p_count) {
+		// ids must not move once the BVH points at them
+		ids.resize(p_count);
+		for (uint32_t i = 0; i < p_count; i++) {
+			ids[i] = i;
+			aabbs.push_back(random_aabb(100.0));
+			handles.push_back(bvh.create(&ids[i], true, 0, 1, aabbs[i]));
+		}
+	}
+
+	void move_all(real_t p_range) {
+		for (uint32_t i = 0; i < handles.size(); i++) {
+			aabbs[i] = random_aabb(p_range);
+			bvh.move(handles[i], aabbs[i]);
+		}
+	}
+
+	// Compares culling the BVH against testing every item.
+	bool cull_matches(const AABB &p_query) {
+		LocalVector<int *> results;
+		results.resize(ids.size());
+		int count = bvh.cull_aabb(p_query, results.ptr(), results.size(), nullptr);
+
+		LocalVector<uint8_t> found;
+		found.resize(ids.size());
+		memset(found.ptr(), 0, found.size());
+		for (int i = 0; i < count; i++) {
+			found[*results[i]] = 1;
+		}
+
+		for (uint32_t i = 0; i < ids.size(); i++) {
+			// The BVH may return items near the query (leaf bounds are expanded), but never miss one.
+			if (aabbs[i].intersects(p_query) && !found[i]) {
+				return false;
+			}
+		}
+		return true;
+	}
+};
+
+TEST_CASE("[BVH] Culling stays exact across updates and rebuilds") {
+	BVHTestData data;
+	data.create(6000); // Big enough for the rebuild to build subtrees in parallel.
+
+	// The first checking update rebuilds the incrementally grown tree.
+	for (int i = 0; i < 64; i++) {
+		data.bvh.update();
+	}
+	CHECK(data.cull_matches(AABB(Vector3(-20, -20, -20), Vector3(40, 40, 40))));
+
+	// Move everything into a smaller area, so leaves shrink and get refit.
+	data.move_all(30.0);
+	data.bvh.update();
+	CHECK(data.cull_matches(AABB(Vector3(-5, -5, -5), Vector3(10, 10, 10))));
+
+	data.bvh.rebuild();
+	bool all_match = true;
+	for (int i = 0; i < 32; i++) {
+		all_match &= data.cull_matches(data.random_aabb(30.0).grow(4.0));
+	}
+	CHECK(all_match);
+
+	// Items removed after a rebuild must still be found in their new nodes.
+	for (uint32_t i = 0; i < data.handles.size(); i += 2) {
+		data.aabbs[i] = AABB(Vector3(1000, 1000, 1000), Vector3(1, 1, 1));
+		data.bvh.erase(data.handles[i]);
+	}
+	all_match = true;
+	LocalVector<int *> results;
+	results.resize(data.ids.size());
+	for (int i = 0; i < 32; i++) {
+		AABB query = data.random_aabb(30.0).grow(4.0);
+		int count = data.bvh.cull_aabb(query, results.ptr(), results.size(), nullptr);
+		for (int j = 0; j < count; j++) {
+			all_match &= (*results[j] % 2) == 1;
+		}
+	}
+	CHECK_MESSAGE(all_match, "Erased items should not be returned by culling.");
+}
+
+TEST_CASE("[BVH] Rebuild with a single leaf or no items") {
+	TestBVHManager bvh;
+	bvh.rebuild();
+
+	int id = 0;
+	BVHHandle handle = bvh.create(&id, true, 0, 1, AABB(Vector3(), Vector3(1, 1, 1)));
+	bvh.rebuild();
+
+	int *results[4];
+	CHECK(bvh.cull_aabb(AABB(Vector3(-1, -1, -1), Vector3(3, 3, 3)), results, 4, nullptr) == 1);
+	bvh.erase(handle);
+	CHECK(bvh.cull_aabb(AABB(Vector3(-1, -1, -1), Vector3(3, 3, 3)), results, 4, nullptr) == 0);
+}
+
+typedef BVH_Manager<int, 1, true, 32, BVHTestPairFunction, BVHTestCullFunction> TestBVHPairingManager;
+
+static uint64_t pair_key(int *p_a, int *p_b) {
+	return ((uint64_t)MIN(*p_a, *p_b) << 32) | (uint64_t)MAX(*p_a, *p_b);
+}
+
+static void *pair_added(void *p_self, uint32_t, int *p_a, int, uint32_t, int *p_b, int) {
+	HashSet<uint64_t> *pairs = (HashSet<uint64_t> *)p_self;
+	pairs->insert(pair_key(p_a, p_b));
+	return nullptr;
+}
+
+static void pair_removed(void *p_self, uint32_t, int *p_a, int, uint32_t, int *p_b, int, void *) {
+	HashSet<uint64_t> *pairs = (HashSet<uint64_t> *)p_self;
+	pairs->erase(pair_key(p_a, p_b));
+}
+
+TEST_CASE("[BVH] Pairing many changed items at once") {
+	TestBVHPairingManager bvh;
+	HashSet<uint64_t> pairs;
+	bvh.set_pair_callback(pair_added, &pairs);
+	bvh.set_unpair_callback(pair_removed, &pairs);
+
+	// Enough items changing per update that their overlap tests are split across threads.
+	const uint32_t count = 1000;
+	RandomPCG rng(4321);
+	LocalVector<int> ids;
+	LocalVector<BVHHandle> handles;
+	LocalVector<AABB> aabbs;
+	ids.resize(count);
+	aabbs.resize(count);
+	for (int round = 0; round < 3; round++) {
+		for (uint32_t i = 0; i < count; i++) {
+			aabbs[i] = AABB(Vector3(rng.random(-30.0, 30.0), rng.random(-30.0, 30.0), rng.random(-30.0, 30.0)), Vector3(2, 2, 2));
+			if (round == 0) {
+				ids[i] = i;
+				handles.push_back(bvh.create(&ids[i], true, 0, 1, aabbs[i]));
+			} else {
+				bvh.move(handles[i], aabbs[i]);
+			}
+		}
+		bvh.update();
+
+		bool all_paired = true;
+		for (uint32_t i = 0; i < count; i++) {
+			for (uint32_t j = i + 1; j < count; j++) {
+				if (aabbs[i].intersects(aabbs[j])) {
+					all_paired &= pairs.has(pair_key(&ids[i], &ids[j]));
+				}
+			}
+		}
+		CHECK_MESSAGE(all_paired, "Every overlapping pair should have been reported.");
+	}
+
+	for (uint32_t i = 0; i < count; i++) {
+		bvh.erase(handles[i]);
+	}
+	CHECK(pairs.is_empty());
+}
+
+} // namespace TestBVH
+
+#endif // TEST_BVH_H
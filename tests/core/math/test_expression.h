@@ -321,6 +321,47 @@ TEST_CASE("[Expression] Expressions with variables") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[Expression] Repeated execution") {
+	Expression expression;
+
+	PackedStringArray parameter_names;
+	parameter_names.push_back("foo");
+	CHECK_MESSAGE(
+			expression.parse("foo * (2 + 3) + Vector2(1, 2).x", parameter_names) == OK,
+			"The expression should parse successfully.");
+
+	Array values;
+	values.push_back(4);
+	CHECK_MESSAGE(
+			int(expression.execute(values)) == 21,
+			"The expression should return the expected value.");
+	values[0] = 2.5;
+	CHECK_MESSAGE(
+			double(expression.execute(values)) == doctest::Approx(13.5),
+			"The expression should return the expected value after the input type changed.");
+	values[0] = Vector2(1, 2);
+	ERR_PRINT_OFF;
+	expression.execute(values);
+	CHECK_MESSAGE(
+			expression.has_execute_failed(),
+			"The expression should fail with operands it can't add.");
+	ERR_PRINT_ON;
+	values[0] = 1;
+	CHECK_MESSAGE(
+			int(expression.execute(values)) == 6,
+			"The expression should recover once the operands are valid again.");
+
+	CHECK_MESSAGE(
+			expression.parse("[foo, foo]", parameter_names) == OK,
+			"The expression should parse successfully.");
+	Array first = expression.execute(values);
+	Array second = expression.execute(values);
+	first[0] = 10;
+	CHECK_MESSAGE(
+			int(second[0]) == 1,
+			"Every execution should create a new array.");
+}
+
 TEST_CASE("[Expression] Invalid expressions") {
 	Expression expression;
 
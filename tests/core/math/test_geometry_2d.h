@@ -589,6 +589,66 @@ TEST_CASE("[Geometry2D] Exclude polygons") {
 	}
 }
 
+TEST_CASE("[Geometry2D] Polygon batches") {
+	Vector<Vector<Point2>> polygons_a;
+	for (int i = 0; i < 16; i++) {
+		Vector<Point2> square;
+		square.push_back(Point2(i * 100, 0));
+		square.push_back(Point2(i * 100 + 80, 0));
+		square.push_back(Point2(i * 100 + 80, 80));
+		square.push_back(Point2(i * 100, 80));
+		polygons_a.push_back(square);
+	}
+	Vector<Point2> strip;
+	strip.push_back(Point2(-10, 40));
+	strip.push_back(Point2(2000, 40));
+	strip.push_back(Point2(2000, 100));
+	strip.push_back(Point2(-10, 100));
+
+	SUBCASE("[Geometry2D] Single clip polygon matches the per-pair operation") {
+		Vector<Vector<Point2>> polygons_b;
+		polygons_b.push_back(strip);
+		Vector<Vector<Vector<Point2>>> r = Geometry2D::polygons_do_operation_batch(Geometry2D::OPERATION_DIFFERENCE, polygons_a, polygons_b);
+		REQUIRE(r.size() == polygons_a.size());
+		for (int i = 0; i < polygons_a.size(); i++) {
+			Vector<Vector<Point2>> expected = Geometry2D::clip_polygons(polygons_a[i], strip);
+			REQUIRE(r[i].size() == expected.size());
+			for (int j = 0; j < expected.size(); j++) {
+				CHECK(r[i][j] == expected[j]);
+			}
+		}
+	}
+
+	SUBCASE("[Geometry2D] One clip polygon per polygon") {
+		Vector<Vector<Point2>> polygons_b;
+		for (int i = 0; i < polygons_a.size(); i++) {
+			polygons_b.push_back(polygons_a[polygons_a.size() - 1 - i]);
+		}
+		Vector<Vector<Vector<Point2>>> r = Geometry2D::polygons_do_operation_batch(Geometry2D::OPERATION_UNION, polygons_a, polygons_b);
+		REQUIRE(r.size() == polygons_a.size());
+		for (int i = 0; i < polygons_a.size(); i++) {
+			CHECK(r[i] == Geometry2D::merge_polygons(polygons_a[i], polygons_b[i]));
+		}
+	}
+
+	SUBCASE("[Geometry2D] Mismatched sizes") {
+		Vector<Vector<Point2>> polygons_b;
+		polygons_b.push_back(strip);
+		polygons_b.push_back(strip);
+		ERR_PRINT_OFF;
+		CHECK(Geometry2D::polygons_do_operation_batch(Geometry2D::OPERATION_UNION, polygons_a, polygons_b).is_empty());
+		ERR_PRINT_ON;
+	}
+
+	SUBCASE("[Geometry2D] Offset") {
+		Vector<Vector<Vector<Point2>>> r = Geometry2D::offset_polygons_batch(polygons_a, 10, Geometry2D::JOIN_MITER);
+		REQUIRE(r.size() == polygons_a.size());
+		for (int i = 0; i < polygons_a.size(); i++) {
+			CHECK(r[i] == Geometry2D::offset_polygon(polygons_a[i], 10, Geometry2D::JOIN_MITER));
+		}
+	}
+}
+
 TEST_CASE("[Geometry2D] Intersect polyline with polygon") {
 	Vector<Vector2> l;
 	Vector<Vector2> p;
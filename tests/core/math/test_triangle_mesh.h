@@ -0,0 +1,113 @@
+/**************************************************************************/
+/*  test_triangle_mesh.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_TRIANGLE_MESH_H
+#define TEST_TRIANGLE_MESH_H
+
+#include "core/math/triangle_mesh.h"
+
+#include "tests/test_macros.h"
+
+namespace TestTriangleMesh {
+
+// A flat grid of quads at y = 0, spanning [0, p_size] on X and Z.
+static Ref<TriangleMesh> create_grid(int p_size) {
+	Vector<Vector3> faces;
+	faces.resize(p_size * p_size * 6);
+	Vector3 *w = faces.ptrw();
+	for (int z = 0; z < p_size; z++) {
+		for (int x = 0; x < p_size; x++) {
+			*w++ = Vector3(x, 0, z);
+			*w++ = Vector3(x + 1, 0, z);
+			*w++ = Vector3(x + 1, 0, z + 1);
+			*w++ = Vector3(x, 0, z);
+			*w++ = Vector3(x + 1, 0, z + 1);
+			*w++ = Vector3(x, 0, z + 1);
+		}
+	}
+	Ref<TriangleMesh> mesh;
+	mesh.instantiate();
+	mesh->create(faces);
+	return mesh;
+}
+
+static void check_queries(const Ref<TriangleMesh> &p_mesh, int p_size) {
+	const int count = 37;
+	Vector3 begins[count];
+	Vector3 dirs[count];
+	Vector3 ends[count];
+	for (int i = 0; i < count; i++) {
+		// The last ray misses the grid.
+		real_t offset = i == count - 1 ? p_size + 5 : (i + 0.5) * p_size / count;
+		begins[i] = Vector3(offset, 10, p_size - offset);
+		dirs[i] = Vector3(0.01 * i, -1, 0);
+		ends[i] = begins[i] + dirs[i] * 20;
+	}
+
+	TriangleMesh::RayResult ray_results[count];
+	TriangleMesh::RayResult segment_results[count];
+	p_mesh->intersect_rays(begins, dirs, count, ray_results);
+	p_mesh->intersect_segments(begins, ends, count, segment_results);
+
+	for (int i = 0; i < count; i++) {
+		Vector3 point;
+		Vector3 normal;
+		bool hit = p_mesh->intersect_ray(begins[i], dirs[i], point, normal);
+		CHECK(ray_results[i].hit == hit);
+		CHECK(segment_results[i].hit == hit);
+		CHECK(hit == (i != count - 1));
+		if (hit) {
+			CHECK(ray_results[i].point.is_equal_approx(point));
+			CHECK(ray_results[i].normal.is_equal_approx(Vector3(0, 1, 0)));
+			CHECK(segment_results[i].point.is_equal_approx(point));
+			CHECK(segment_results[i].normal.is_equal_approx(Vector3(0, 1, 0)));
+			CHECK(Math::is_zero_approx(point.y));
+		}
+	}
+}
+
+TEST_CASE("[TriangleMesh] Small mesh ray queries") {
+	Ref<TriangleMesh> mesh = create_grid(4);
+	REQUIRE(mesh->is_valid());
+	CHECK(mesh->get_triangles().size() == 32);
+	check_queries(mesh, 4);
+}
+
+TEST_CASE("[TriangleMesh] Parallel build ray queries") {
+	// Large enough for the BVH to be built on the WorkerThreadPool.
+	Ref<TriangleMesh> mesh = create_grid(100);
+	REQUIRE(mesh->is_valid());
+	CHECK(mesh->get_triangles().size() == 20000);
+	check_queries(mesh, 100);
+}
+
+} // namespace TestTriangleMesh
+
+#endif // TEST_TRIANGLE_MESH_H
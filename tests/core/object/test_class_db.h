@@ -37,6 +37,58 @@
 
 #include "tests/test_macros.h"
 
+// Declared in global namespace because of GDCLASS macro warning (Windows):
+// "Unqualified friend declaration referring to type outside of the nearest enclosing namespace
+// is a Microsoft extension; add a nested name specifier".
+class _TestLookupTablesObject : public Object {
+	GDCLASS(_TestLookupTablesObject, Object);
+
+	int lookup_value = 0;
+
+protected:
+	static void _bind_methods() {
+		ClassDB::bind_method(D_METHOD("lookup_test"), &_TestLookupTablesObject::lookup_test);
+		ClassDB::bind_method(D_METHOD("set_lookup_value", "value"), &_TestLookupTablesObject::set_lookup_value);
+		ClassDB::bind_method(D_METHOD("get_lookup_value"), &_TestLookupTablesObject::get_lookup_value);
+		ADD_PROPERTY(PropertyInfo(Variant::INT, "lookup_value"), "set_lookup_value", "get_lookup_value");
+	}
+
+public:
+	void lookup_test() {}
+	void set_lookup_value(int p_value) { lookup_value = p_value; }
+	int get_lookup_value() const { return lookup_value; }
+};
+
+class _TestLazyObject : public _TestLookupTablesObject {
+	GDCLASS(_TestLazyObject, _TestLookupTablesObject);
+
+protected:
+	static void _bind_methods() {
+		ClassDB::bind_method(D_METHOD("lazy_test"), &_TestLazyObject::lazy_test);
+		ADD_SIGNAL(MethodInfo("lazy_signal"));
+		BIND_CONSTANT(LAZY_CONSTANT);
+	}
+
+public:
+	enum {
+		LAZY_CONSTANT = 3,
+	};
+
+	void lazy_test() {}
+};
+
+class _TestLazyDirectObject : public _TestLookupTablesObject {
+	GDCLASS(_TestLazyDirectObject, _TestLookupTablesObject);
+
+protected:
+	static void _bind_methods() {
+		ClassDB::bind_method(D_METHOD("lazy_direct_test"), &_TestLazyDirectObject::lazy_direct_test);
+	}
+
+public:
+	void lazy_direct_test() {}
+};
+
 namespace TestClassDB {
 
 struct TypeReference {
@@ -848,6 +900,70 @@ TEST_SUITE("[ClassDB]") {
 			}
 		}
 	}
+
+	TEST_CASE("[ClassDB] Flattened lookup tables") {
+		ClassDB::build_lookup_tables();
+
+		MethodBind *own = ClassDB::get_method("RefCounted", "reference");
+		REQUIRE(own);
+		CHECK(own->get_name() == StringName("reference"));
+
+		// Inherited methods resolve to the bind of the class declaring them.
+		MethodBind *inherited = ClassDB::get_method("Resource", "get_instance_id");
+		REQUIRE(inherited);
+		CHECK(inherited == ClassDB::get_method("Object", "get_instance_id"));
+
+		CHECK(ClassDB::get_method("Resource", "nonexistent_method") == nullptr);
+		CHECK(ClassDB::get_method("NonexistentClass", "get_instance_id") == nullptr);
+
+		// Dropped when classes change, then the regular lookup is used until built again.
+		GDREGISTER_CLASS(_TestLookupTablesObject);
+		CHECK(ClassDB::get_method("_TestLookupTablesObject", "get_instance_id") == inherited);
+		CHECK(ClassDB::get_method("_TestLookupTablesObject", "lookup_test"));
+		ClassDB::build_lookup_tables();
+		CHECK(ClassDB::get_method("_TestLookupTablesObject", "get_instance_id") == inherited);
+		CHECK(ClassDB::get_method("_TestLookupTablesObject", "lookup_test"));
+
+		_TestLookupTablesObject object;
+		bool valid = false;
+		object.set("lookup_value", 5, &valid);
+		CHECK(valid);
+		CHECK(object.get_lookup_value() == 5);
+	}
+
+	TEST_CASE("[ClassDB] Lazy class registration") {
+		GDREGISTER_CLASS(_TestLookupTablesObject);
+		GDREGISTER_LAZY_CLASS(_TestLazyObject);
+		GDREGISTER_LAZY_CLASS(_TestLazyDirectObject);
+		ClassDB::build_lookup_tables();
+
+		// Known right away, bound on the first lookup.
+		CHECK(ClassDB::class_exists("_TestLazyObject"));
+		CHECK(ClassDB::is_parent_class("_TestLazyObject", "_TestLookupTablesObject"));
+		CHECK(ClassDB::classes["_TestLazyObject"].method_map.is_empty());
+
+		CHECK(ClassDB::get_method("_TestLazyObject", "lazy_test"));
+		CHECK(ClassDB::get_method("_TestLazyObject", "lookup_test"));
+		CHECK(ClassDB::has_signal("_TestLazyObject", "lazy_signal"));
+		CHECK(ClassDB::get_integer_constant("_TestLazyObject", "LAZY_CONSTANT") == 3);
+
+		// Constructing it directly binds it too.
+		_TestLazyDirectObject *object = memnew(_TestLazyDirectObject);
+		CHECK(ClassDB::has_method("_TestLazyDirectObject", "lazy_direct_test", true));
+		bool valid = false;
+		object->set("lookup_value", 7, &valid);
+		CHECK(valid);
+		CHECK(object->get_lookup_value() == 7);
+		memdelete(object);
+
+		Object *instance = ClassDB::instantiate("_TestLazyObject");
+		REQUIRE(instance);
+		CHECK(instance->has_method("lazy_test"));
+		memdelete(instance);
+
+		ClassDB::initialize_lazy_classes();
+		CHECK(ClassDB::lazy_pending_count.load() == 0);
+	}
 }
 } // namespace TestClassDB
 
@@ -0,0 +1,145 @@
+/**************************************************************************/
+/*  test_message_queue.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_MESSAGE_QUEUE_H
+#define TEST_MESSAGE_QUEUE_H
+
+#include "core/object/message_queue.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/thread.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMessageQueue {
+
+class MessageQueueTarget : public Object {
+public:
+	LocalVector<int> values;
+	String text;
+
+	void add_value(int p_value) { values.push_back(p_value); }
+	void set_text(const String &p_text, int p_repeat) {
+		text = String();
+		for (int i = 0; i < p_repeat; i++) {
+			text += p_text;
+		}
+	}
+};
+
+struct MessageQueueRAII {
+	MessageQueue *queue = nullptr;
+
+	MessageQueueRAII() {
+		if (!MessageQueue::get_singleton()) {
+			queue = memnew(MessageQueue);
+		}
+	}
+	~MessageQueueRAII() {
+		if (queue) {
+			memdelete(queue);
+		}
+	}
+};
+
+TEST_CASE("[MessageQueue] Typed calls") {
+	MessageQueueRAII raii;
+	MessageQueueTarget target;
+
+	MessageQueue::get_singleton()->push_callable(callable_mp(&target, &MessageQueueTarget::add_value), 1);
+	MessageQueue::get_singleton()->push_callable(callable_mp(&target, &MessageQueueTarget::set_text), "ab", 3);
+	MessageQueue::get_singleton()->push_callable(callable_mp(&target, &MessageQueueTarget::add_value), 2);
+	CHECK(target.values.is_empty());
+
+	MessageQueue::get_singleton()->flush();
+	REQUIRE(target.values.size() == 2);
+	CHECK(target.values[0] == 1);
+	CHECK(target.values[1] == 2);
+	CHECK(target.text == "ababab");
+	CHECK_FALSE(MessageQueue::get_singleton()->has_messages());
+}
+
+static void push_values_in_thread(void *p_target) {
+	MessageQueueTarget *target = (MessageQueueTarget *)p_target;
+	for (int i = 0; i < 100; i++) {
+		MessageQueue::get_singleton()->push_callable(callable_mp(target, &MessageQueueTarget::add_value), i);
+	}
+}
+
+TEST_CASE("[MessageQueue] Calls pushed from other threads") {
+	MessageQueueRAII raii;
+
+	SUBCASE("Calls of a finished thread are kept") {
+		MessageQueueTarget target;
+		Thread thread;
+		thread.start(push_values_in_thread, &target);
+		thread.wait_to_finish();
+		CHECK(target.values.is_empty());
+
+		MessageQueue::get_singleton()->flush();
+		REQUIRE(target.values.size() == 100);
+		bool in_order = true;
+		for (int i = 0; i < 100; i++) {
+			in_order = in_order && target.values[i] == i;
+		}
+		CHECK(in_order);
+	}
+
+	SUBCASE("Calls of running threads are merged when flushing") {
+		MessageQueueTarget target;
+		WorkerThreadPool::TaskID task = WorkerThreadPool::get_singleton()->add_native_task(push_values_in_thread, &target);
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task);
+		CHECK(target.values.is_empty());
+
+		MessageQueue::get_singleton()->flush();
+		CHECK(target.values.size() == 100);
+	}
+
+	SUBCASE("Calls of other threads are counted before they're merged") {
+		MessageQueueTarget target;
+		CHECK_FALSE(MessageQueue::get_singleton()->has_messages());
+		CHECK(MessageQueue::get_singleton()->get_message_count() == 0);
+
+		WorkerThreadPool::TaskID task = WorkerThreadPool::get_singleton()->add_native_task(push_values_in_thread, &target);
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task);
+		MessageQueue::get_singleton()->push_callable(callable_mp(&target, &MessageQueueTarget::add_value), 100);
+		MessageQueue::get_singleton()->push_notification(&target, 1);
+		CHECK(MessageQueue::get_singleton()->has_messages());
+		CHECK(MessageQueue::get_singleton()->get_message_count() == 102);
+
+		MessageQueue::get_singleton()->flush();
+		CHECK(target.values.size() == 101);
+		CHECK_FALSE(MessageQueue::get_singleton()->has_messages());
+		CHECK(MessageQueue::get_singleton()->get_message_count() == 0);
+	}
+}
+
+} // namespace TestMessageQueue
+
+#endif // TEST_MESSAGE_QUEUE_H
@@ -424,6 +424,36 @@ TEST_CASE("[Object] Signals") {
 		object.get_all_signal_connections(&signal_connections);
 		CHECK(signal_connections.size() == 0);
 	}
+
+	SUBCASE("Emitting should call bound methods directly and through conversions") {
+		GDREGISTER_CLASS(_TestDerivedObject);
+		_TestDerivedObject target;
+		target.set_property(0);
+		object.connect("my_custom_signal", Callable(&target, "set_property"));
+
+		// Argument of the exact parameter type.
+		CHECK(object.emit_signal("my_custom_signal", 42) == OK);
+		CHECK(target.get_property() == 42);
+
+		// Argument that needs a conversion.
+		CHECK(object.emit_signal("my_custom_signal", 7.0) == OK);
+		CHECK(target.get_property() == 7);
+
+		// New connections must be seen by the next emission.
+		_TestDerivedObject other_target;
+		other_target.set_property(0);
+		object.connect("my_custom_signal", Callable(&other_target, "set_property"));
+		CHECK(object.emit_signal("my_custom_signal", 3) == OK);
+		CHECK(target.get_property() == 3);
+		CHECK(other_target.get_property() == 3);
+
+		object.disconnect("my_custom_signal", Callable(&target, "set_property"));
+		CHECK(object.emit_signal("my_custom_signal", 5) == OK);
+		CHECK(target.get_property() == 3);
+		CHECK(other_target.get_property() == 5);
+
+		object.disconnect("my_custom_signal", Callable(&other_target, "set_property"));
+	}
 }
 
 class NotificationObject1 : public Object {
@@ -0,0 +1,72 @@
+/**************************************************************************/
+/*  test_memory.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_MEMORY_H
+#define TEST_MEMORY_H
+
+#include "core/os/memory.h"
+
+#include "thirdparty/doctest/doctest.h"
+
+namespace TestMemory {
+
+#ifdef DEBUG_ENABLED
+TEST_CASE("[Memory] Tagged allocations") {
+	Memory::Tag tag = Memory::register_tag("Test Memory Tag");
+	CHECK_MESSAGE(tag != Memory::TAG_UNTAGGED, "A new tag should be registered.");
+	CHECK_MESSAGE(Memory::register_tag("Test Memory Tag") == tag, "Registering the same name should return the same tag.");
+	CHECK(String(Memory::get_tag_name(tag)) == "Test Memory Tag");
+
+	uint64_t usage = Memory::get_tag_usage(tag);
+	uint64_t allocations = Memory::get_tag_allocations(tag);
+
+	void *mem = nullptr;
+	{
+		MemoryTagScope scope(tag);
+		mem = memalloc(100);
+	}
+	CHECK(Memory::get_tag_usage(tag) == usage + 100);
+	CHECK(Memory::get_tag_allocations(tag) == allocations + 1);
+	CHECK(Memory::get_tag_max_usage(tag) >= usage + 100);
+
+	// Resizing outside of the scope keeps the memory with its original tag.
+	mem = memrealloc(mem, 300);
+	CHECK(Memory::get_tag_usage(tag) == usage + 300);
+
+	memfree(mem);
+	CHECK(Memory::get_tag_usage(tag) == usage);
+	CHECK(Memory::get_tag_allocations(tag) == allocations + 1);
+	CHECK_MESSAGE(Memory::get_current_tag() == Memory::TAG_UNTAGGED, "The scope should restore the previous tag.");
+}
+#endif
+
+} // namespace TestMemory
+
+#endif // TEST_MEMORY_H
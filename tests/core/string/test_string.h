@@ -262,6 +262,9 @@ TEST_CASE("[String] Concatenation") {
 	s = s + String("Day");
 
 	CHECK(s == "Have a Nice Day");
+	CHECK(String() + s == s);
+	CHECK(s + String() == s);
+	CHECK((String("Have") + String(" a")).length() == 6);
 }
 
 TEST_CASE("[String] Testing size and length of string") {
@@ -299,6 +302,11 @@ TEST_CASE("[String] Contains") {
 
 TEST_CASE("[String] Test chr") {
 	CHECK(String::chr('H') == "H");
+	CHECK(String::chr(0).is_empty());
+	String shared = String::chr('a');
+	shared += "b";
+	CHECK(shared == "ab");
+	CHECK(String::chr('a') == "a");
 	CHECK(String::chr(0x3012)[0] == 0x3012);
 	ERR_PRINT_OFF
 	CHECK(String::chr(0xd812)[0] == 0xfffd); // Unpaired UTF-16 surrogate
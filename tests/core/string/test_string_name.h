@@ -0,0 +1,104 @@
+/**************************************************************************/
+/*  test_string_name.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_STRING_NAME_H
+#define TEST_STRING_NAME_H
+
+#include "core/object/worker_thread_pool.h"
+#include "core/string/string_name.h"
+
+#include "tests/test_macros.h"
+
+namespace TestStringName {
+
+TEST_CASE("[StringName] Interning") {
+	const StringName a = "test_string_name_interning";
+	const StringName b = String("test_string_name_interning");
+	const StringName c = StringName::search("test_string_name_interning");
+
+	CHECK(a == b);
+	CHECK(a == c);
+	CHECK(a.data_unique_pointer() == b.data_unique_pointer());
+	CHECK(StringName::search("test_string_name_never_interned") == StringName());
+}
+
+TEST_CASE("[StringName] Interned count") {
+	const uint32_t initial_count = StringName::get_interned_count();
+	{
+		const StringName a = "test_string_name_count";
+		CHECK(StringName::get_interned_count() == initial_count + 1);
+		const StringName b = "test_string_name_count";
+		CHECK(StringName::get_interned_count() == initial_count + 1);
+	}
+	CHECK(StringName::get_interned_count() == initial_count);
+}
+
+TEST_CASE("[StringName] Table growth keeps names reachable") {
+	// Enough new names to force the table to grow at least once.
+	const int count = 200000;
+	LocalVector<StringName> names;
+	names.resize(count);
+	for (int i = 0; i < count; i++) {
+		names[i] = "test_string_name_growth_" + itos(i);
+	}
+
+	bool all_found = true;
+	for (int i = 0; i < count; i++) {
+		//Reduce number of check messages
+		all_found &= StringName::search("test_string_name_growth_" + itos(i)) == names[i];
+	}
+	CHECK(all_found);
+}
+
+static LocalVector<StringName> thread_names;
+static void intern_in_thread(void *p_arg, uint32_t p_index) {
+	thread_names[p_index] = "test_string_name_thread_" + itos(p_index % 100);
+}
+
+TEST_CASE("[StringName] Concurrent interning") {
+	const int count = 10000;
+	thread_names.clear();
+	thread_names.resize(count);
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(intern_in_thread, nullptr, count, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	bool all_match = true;
+	for (int i = 0; i < count; i++) {
+		//Reduce number of check messages
+		all_match &= thread_names[i] == thread_names[i % 100];
+		all_match &= thread_names[i] == StringName("test_string_name_thread_" + itos(i % 100));
+	}
+	CHECK(all_match);
+	thread_names.clear();
+}
+
+} // namespace TestStringName
+
+#endif // TEST_STRING_NAME_H
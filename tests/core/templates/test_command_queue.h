@@ -422,6 +422,85 @@ TEST_CASE("[Stress][CommandQueue] Stress test command queue") {
 	ProjectSettings::get_singleton()->set_setting(COMMAND_QUEUE_SETTING,
 			ProjectSettings::get_singleton()->property_get_revert(COMMAND_QUEUE_SETTING));
 }
+
+struct MultiProducerState {
+	static const int PRODUCERS = 4;
+	static const int MESSAGES = 20000; // Enough to fill several blocks per producer.
+
+	CommandQueueMT command_queue = CommandQueueMT(false);
+	int last_index[PRODUCERS];
+	int out_of_order = 0;
+	int count = 0;
+	SafeNumeric<int> started;
+
+	void receive(int p_producer, int p_index, Transform3D p_transform) {
+		if (p_index != last_index[p_producer] + 1) {
+			out_of_order++;
+		}
+		last_index[p_producer] = p_index;
+		count++;
+	}
+
+	static void producer_loop(void *p_userdata) {
+		MultiProducerState *state = static_cast<MultiProducerState *>(p_userdata);
+		int producer = state->started.postincrement();
+		for (int i = 0; i < MESSAGES; i++) {
+			state->command_queue.push(state, &MultiProducerState::receive, producer, i, Transform3D());
+		}
+	}
+};
+
+TEST_CASE("[CommandQueue] Test Multiple Producers") {
+	MultiProducerState state;
+	for (int i = 0; i < MultiProducerState::PRODUCERS; i++) {
+		state.last_index[i] = -1;
+	}
+
+	Thread threads[MultiProducerState::PRODUCERS];
+	for (int i = 0; i < MultiProducerState::PRODUCERS; i++) {
+		threads[i].start(&MultiProducerState::producer_loop, &state);
+	}
+
+	// Flush while the producers are still pushing.
+	while (state.count < MultiProducerState::PRODUCERS * MultiProducerState::MESSAGES) {
+		state.command_queue.flush_all();
+		OS::get_singleton()->delay_usec(100);
+	}
+
+	for (int i = 0; i < MultiProducerState::PRODUCERS; i++) {
+		threads[i].wait_to_finish();
+	}
+	state.command_queue.flush_all();
+
+	CHECK_MESSAGE(state.count == MultiProducerState::PRODUCERS * MultiProducerState::MESSAGES,
+			"Reader should have read all messages, and no more.");
+	CHECK_MESSAGE(state.out_of_order == 0,
+			"Messages from a given producer should be read in the order they were pushed.");
+}
+
+TEST_CASE("[CommandQueue] Test Short Lived Producers") {
+	// Each thread pushes and exits, its queue is freed by a later flush.
+	MultiProducerState state;
+	for (int i = 0; i < MultiProducerState::PRODUCERS; i++) {
+		state.last_index[i] = -1;
+	}
+
+	for (int i = 0; i < MultiProducerState::PRODUCERS; i++) {
+		Thread thread;
+		thread.start(&MultiProducerState::producer_loop, &state);
+		thread.wait_to_finish();
+		state.command_queue.flush_all();
+		CHECK_MESSAGE(state.count == (i + 1) * MultiProducerState::MESSAGES,
+				"Reader should have read all messages of the exited thread.");
+	}
+
+	state.command_queue.push(&state, &MultiProducerState::receive, 0, MultiProducerState::MESSAGES, Transform3D());
+	state.command_queue.flush_all();
+	CHECK_MESSAGE(state.count == MultiProducerState::PRODUCERS * MultiProducerState::MESSAGES + 1,
+			"Pushing after the other producers were freed should still work.");
+	CHECK_MESSAGE(state.out_of_order == 0,
+			"Messages from a given producer should be read in the order they were pushed.");
+}
 } // namespace TestCommandQueue
 
 #endif // TEST_COMMAND_QUEUE_H
@@ -0,0 +1,145 @@
+/**************************************************************************/
+/*  test_flat_hash_map.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_FLAT_HASH_MAP_H
+#define TEST_FLAT_HASH_MAP_H
+
+#include "core/templates/flat_hash_map.h"
+
+#include "tests/test_macros.h"
+
+namespace TestFlatHashMap {
+
+TEST_CASE("[FlatHashMap] Insert element") {
+	FlatHashMap<int, int> map;
+	FlatHashMap<int, int>::Iterator e = map.insert(42, 84);
+
+	CHECK(e);
+	CHECK(e->key == 42);
+	CHECK(e->value == 84);
+	CHECK(map[42] == 84);
+	CHECK(map.has(42));
+	CHECK(map.find(42));
+}
+
+TEST_CASE("[FlatHashMap] Overwrite element") {
+	FlatHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(42, 1234);
+
+	CHECK(map[42] == 1234);
+	CHECK(map.size() == 1);
+}
+
+TEST_CASE("[FlatHashMap] Erase via element") {
+	FlatHashMap<int, int> map;
+	map.insert(42, 84);
+	map.erase(42);
+	CHECK(!map.has(42));
+	CHECK(!map.find(42));
+	CHECK(map.is_empty());
+}
+
+TEST_CASE("[FlatHashMap] Insert, iterate and remove many elements") {
+	const int elem_max = 12343;
+	FlatHashMap<int, int> map;
+	for (int i = 0; i < elem_max; i++) {
+		map.insert(i, i);
+	}
+
+	// No insertion order, but all pairs are visited.
+	int64_t sum = 0;
+	for (const KeyValue<int, int> &K : map) {
+		sum += K.key;
+		CHECK(K.key == K.value);
+	}
+	CHECK(sum == int64_t(elem_max) * (elem_max - 1) / 2);
+
+	Vector<int> elems_still_valid;
+
+	for (int i = 0; i < elem_max; i++) {
+		if ((i % 5) == 0) {
+			map.erase(i);
+		} else {
+			elems_still_valid.push_back(i);
+		}
+	}
+
+	CHECK(elems_still_valid.size() == map.size());
+
+	bool all_found = true;
+	for (int i = 0; i < elems_still_valid.size(); i++) {
+		//Reduce number of check messages
+		all_found &= map.has(elems_still_valid[i]) && map[elems_still_valid[i]] == elems_still_valid[i];
+	}
+	for (int i = 0; i < elem_max; i += 5) {
+		all_found &= !map.has(i);
+	}
+	CHECK(all_found);
+}
+
+TEST_CASE("[FlatHashMap] Reuse deleted slots") {
+	FlatHashMap<String, int> map;
+	map.reserve(100);
+	uint32_t capacity = map.get_capacity();
+
+	// Churning through keys without growing the number of elements must not grow the table.
+	for (int i = 0; i < 10000; i++) {
+		map.insert(itos(i), i);
+		if (i >= 50) {
+			CHECK(map.erase(itos(i - 50)));
+		}
+	}
+	CHECK(map.size() == 50);
+	CHECK(map.get_capacity() == capacity);
+	CHECK(map["9999"] == 9999);
+	CHECK_FALSE(map.has("9949"));
+}
+
+TEST_CASE("[FlatHashMap] Copy and clear") {
+	FlatHashMap<int, String> map;
+	for (int i = 0; i < 100; i++) {
+		map[i] = itos(i);
+	}
+
+	FlatHashMap<int, String> copy = map;
+	map.clear();
+	CHECK(map.is_empty());
+	CHECK_FALSE(map.has(50));
+	CHECK(copy.size() == 100);
+	CHECK(copy[50] == "50");
+
+	map = copy;
+	CHECK(map.size() == 100);
+	CHECK(map.get(99) == "99");
+}
+} // namespace TestFlatHashMap
+
+#endif // TEST_FLAT_HASH_MAP_H
@@ -128,6 +128,59 @@ TEST_CASE("[HashMap] Const iteration") {
 		++idx;
 	}
 }
+
+TEST_CASE("[HashMap] Inline elements") {
+	typedef HashMap<int, String, HashMapHasherDefault, HashMapComparatorDefault<int>, DefaultTypedAllocator<HashMapElement<int, String>>, 3> SmallMap;
+	SmallMap map;
+	map.insert(1, "one");
+	map.insert(2, "two");
+	map.insert(3, "three");
+	CHECK(map.size() == 3);
+	CHECK(map[2] == "two");
+
+	// Spill over to the heap, keeping the insertion order and the inline elements.
+	for (int i = 4; i < 64; i++) {
+		map.insert(i, itos(i));
+	}
+	CHECK(map.size() == 63);
+	CHECK(map[1] == "one");
+	CHECK(map[63] == "63");
+
+	int expected = 1;
+	for (const KeyValue<int, String> &E : map) {
+		CHECK(E.key == expected);
+		expected++;
+	}
+
+	CHECK(map.erase(2));
+	CHECK_FALSE(map.has(2));
+	map.insert(2, "deux");
+	CHECK(map[2] == "deux");
+	CHECK(map.last()->key == 2);
+
+	const SmallMap copy = map;
+	CHECK(copy.size() == 63);
+	CHECK(copy[2] == "deux");
+
+	map.clear();
+	CHECK(map.is_empty());
+	map.insert(7, "seven");
+	CHECK(map[7] == "seven");
+	CHECK(copy[7] == "7");
+}
+
+TEST_CASE("[HashMap] Paged element allocator") {
+	HashMap<int, int, HashMapHasherDefault, HashMapComparatorDefault<int>, PagedAllocator<HashMapElement<int, int>>> map;
+	for (int i = 0; i < 1000; i++) {
+		map.insert(i, i * 2);
+	}
+	for (int i = 0; i < 1000; i += 2) {
+		map.erase(i);
+	}
+	CHECK(map.size() == 500);
+	CHECK(map[999] == 1998);
+	CHECK_FALSE(map.has(500));
+}
 } // namespace TestHashMap
 
 #endif // TEST_HASH_MAP_H
@@ -235,6 +235,36 @@ TEST_CASE("[LocalVector] Size / Resize / Reserve.") {
 	CHECK(vector.size() == 4);
 	CHECK(vector.get_capacity() >= 4);
 }
+
+TEST_CASE("[LocalVector] Frame allocator.") {
+	FrameLocalVector<int> vector;
+	for (int i = 0; i < 10000; i++) {
+		vector.push_back(i);
+	}
+	CHECK(vector.size() == 10000);
+	CHECK(Memory::get_frame_arena_max_usage() >= 10000 * sizeof(int));
+
+	{
+		// A second vector on top of the first one must not clobber it.
+		FrameLocalVector<int> other;
+		other.resize(5000);
+		for (int i = 0; i < 5000; i++) {
+			other[i] = -i;
+		}
+		CHECK(other[4999] == -4999);
+	}
+
+	bool all_valid = true;
+	for (int i = 0; i < 10000; i++) {
+		//Reduce number of check messages
+		all_valid &= vector[i] == i;
+	}
+	CHECK(all_valid);
+
+	vector.reset();
+	CHECK(vector.get_capacity() == 0);
+	CHECK(Memory::get_frame_arena_reserved() > 0);
+}
 } // namespace TestLocalVector
 
 #endif // TEST_LOCAL_VECTOR_H
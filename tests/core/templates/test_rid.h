@@ -31,7 +31,9 @@
 #ifndef TEST_RID_H
 #define TEST_RID_H
 
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/rid.h"
+#include "core/templates/rid_owner.h"
 
 #include "tests/test_macros.h"
 
@@ -96,6 +98,95 @@ TEST_CASE("[RID] 'get_local_index'") {
 	CHECK(RID::from_uint64(4'294'967'295).get_local_index() == 4'294'967'295);
 	CHECK(RID::from_uint64(4'294'967'297).get_local_index() == 1);
 }
+
+TEST_CASE("[RID_Owner] Allocation, lookup and free") {
+	RID_Owner<int> owner;
+	RID rid = owner.make_rid(42);
+	CHECK(owner.owns(rid));
+	REQUIRE(owner.get_or_null(rid));
+	CHECK(*owner.get_or_null(rid) == 42);
+
+	RID rid_late = owner.allocate_rid();
+	owner.initialize_rid(rid_late, 7);
+	CHECK(*owner.get_or_null(rid_late) == 7);
+	CHECK(owner.get_rid_count() == 2);
+
+	owner.free(rid);
+	CHECK_FALSE(owner.owns(rid));
+	CHECK(owner.get_or_null(rid) == nullptr);
+	owner.free(rid_late);
+	CHECK(owner.get_rid_count() == 0);
+}
+
+struct ThreadedOwnerData {
+	RID_Owner<uint32_t, true> owner = RID_Owner<uint32_t, true>(64); // Small chunks, so tables get grown a lot.
+	LocalVector<RID> rids;
+};
+
+static void make_rid_in_thread(void *p_arg, uint32_t p_index) {
+	ThreadedOwnerData *data = (ThreadedOwnerData *)p_arg;
+	RID rid = data->owner.make_rid(p_index);
+	// Look it up while other threads keep allocating (and growing the tables).
+	for (int i = 0; i < 16; i++) {
+		uint32_t *value = data->owner.get_or_null(rid);
+		if (!value || *value != p_index) {
+			return;
+		}
+	}
+	data->rids[p_index] = rid;
+}
+
+TEST_CASE("[RID_Owner] Thread safe allocation and lock-free lookup") {
+	ThreadedOwnerData data;
+	const uint32_t count = 4096;
+	data.rids.resize(count);
+
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(make_rid_in_thread, &data, count, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	bool all_valid = true;
+	for (uint32_t i = 0; i < count; i++) {
+		//Reduce number of check messages
+		uint32_t *value = data.owner.get_or_null(data.rids[i]);
+		all_valid &= value && *value == i;
+	}
+	CHECK(all_valid);
+	CHECK(data.owner.get_rid_count() == count);
+
+	for (uint32_t i = 0; i < count; i++) {
+		data.owner.free(data.rids[i]);
+	}
+	CHECK(data.owner.get_rid_count() == 0);
+}
+
+static void free_rid_in_thread(void *p_arg, uint32_t p_index) {
+	ThreadedOwnerData *data = (ThreadedOwnerData *)p_arg;
+	RID rid = data->owner.allocate_rid();
+	data->owner.initialize_rid(rid, p_index);
+	data->owner.free(rid);
+	// Slots are reused by other threads meanwhile, a freed RID must never be accepted again.
+	if (data->owner.owns(rid) || data->owner.get_or_null(rid)) {
+		return;
+	}
+	data->rids[p_index] = rid;
+}
+
+TEST_CASE("[RID_Owner] Thread safe free and lock-free lookup") {
+	ThreadedOwnerData data;
+	const uint32_t count = 4096;
+	data.rids.resize(count);
+
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(free_rid_in_thread, &data, count, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	bool all_rejected = true;
+	for (uint32_t i = 0; i < count; i++) {
+		//Reduce number of check messages
+		all_rejected &= data.rids[i].is_valid() && !data.owner.owns(data.rids[i]);
+	}
+	CHECK(all_rejected);
+	CHECK(data.owner.get_rid_count() == 0);
+}
 } // namespace TestRID
 
 #endif // TEST_RID_H
@@ -106,6 +106,109 @@ TEST_CASE("[WorkerThreadPool] Process elements using group tasks") {
 	}
 }
 
+static void static_range_group_test(void *p_arg, uint32_t p_from, uint32_t p_to) {
+	for (uint32_t i = p_from; i < p_to; i++) {
+		counter[i].increment();
+	}
+}
+TEST_CASE("[WorkerThreadPool] Process element ranges using range group tasks") {
+	for (int iterations = 0; iterations < 500; iterations++) {
+		const int count = Math::pow(2.0f, Math::random(0.0f, 10.0f));
+		const int min_grain = Math::pow(2.0f, Math::random(0.0f, 6.0f));
+		const bool low_priority = Math::rand() % 2;
+
+		counter.clear();
+		counter.resize(count);
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_range_group_task(static_range_group_test, nullptr, count, min_grain, -1, !low_priority);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+		bool all_run_once = true;
+		for (int i = 0; i < count; i++) {
+			//Reduce number of check messages
+			all_run_once &= counter[i].get() == 1;
+		}
+		CHECK(all_run_once);
+	}
+}
+
+static void static_counting_group_test(void *p_arg, uint32_t p_index) {
+	counter[p_index].increment();
+}
+
+static SafeFlag dependencies_completed;
+static void static_dependent_test(void *p_arg) {
+	bool all_run_once = true;
+	for (uint32_t i = 0; i < counter.size(); i++) {
+		all_run_once &= counter[i].get() == 1;
+	}
+	dependencies_completed.set_to(all_run_once);
+}
+static void static_dependent_group_test(void *p_arg, uint32_t p_index) {
+	if (dependencies_completed.is_set()) {
+		counter[p_index].increment();
+	}
+}
+TEST_CASE("[WorkerThreadPool] Dependent tasks") {
+	for (int iterations = 0; iterations < 500; iterations++) {
+		const int count = Math::pow(2.0f, Math::random(0.0f, 5.0f));
+		const bool low_priority = Math::rand() % 2;
+
+		counter.clear();
+		counter.resize(count);
+		dependencies_completed.clear();
+
+		WorkerThreadPool::GroupID group1 = WorkerThreadPool::get_singleton()->add_native_group_task(static_counting_group_test, nullptr, count, -1, !low_priority);
+		Vector<int64_t> dependencies;
+		dependencies.push_back(group1);
+		WorkerThreadPool::TaskID task = WorkerThreadPool::get_singleton()->add_native_dependent_task(static_dependent_test, nullptr, dependencies, low_priority);
+		dependencies.push_back(task);
+		WorkerThreadPool::GroupID group2 = WorkerThreadPool::get_singleton()->add_native_dependent_group_task(static_dependent_group_test, nullptr, count, dependencies, -1, !low_priority);
+
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group2);
+		CHECK(dependencies_completed.is_set());
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group1);
+
+		bool all_run_twice = true;
+		for (int i = 0; i < count; i++) {
+			//Reduce number of check messages
+			all_run_twice &= counter[i].get() == 2;
+		}
+		CHECK(all_run_twice);
+	}
+}
+
+static void static_spawning_test(void *p_arg) {
+	// Group tasks posted from a pool thread go to its local deque when work stealing is enabled.
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(static_counting_group_test, nullptr, counter.size(), -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+}
+TEST_CASE("[WorkerThreadPool] Work stealing") {
+	WorkerThreadPool::get_singleton()->finish();
+	WorkerThreadPool::get_singleton()->init(-1, true, 0.3, true);
+	CHECK(WorkerThreadPool::get_singleton()->is_using_work_stealing());
+
+	for (int iterations = 0; iterations < 500; iterations++) {
+		const int count = Math::pow(2.0f, Math::random(0.0f, 5.0f));
+
+		counter.clear();
+		counter.resize(count);
+		WorkerThreadPool::TaskID task = WorkerThreadPool::get_singleton()->add_native_task(static_spawning_test, nullptr, true);
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task);
+
+		bool all_run_once = true;
+		for (int i = 0; i < count; i++) {
+			//Reduce number of check messages
+			all_run_once &= counter[i].get() == 1;
+		}
+		CHECK(all_run_once);
+	}
+
+	WorkerThreadPool::get_singleton()->finish();
+	WorkerThreadPool::get_singleton()->init();
+	CHECK_FALSE(WorkerThreadPool::get_singleton()->is_using_work_stealing());
+}
+
 } // namespace TestWorkerThreadPool
 
 #endif // TEST_WORKER_THREAD_POOL_H
@@ -76,6 +76,10 @@ TEST_CASE("[Dictionary] Assignment using bracket notation ([])") {
 	CHECK(int(map["Hello"]) == 8);
 	map["Hello"] = 9;
 	CHECK(int(map[StringName("Hello")]) == 9);
+	const int size_before_lookup = map.size();
+	map[StringName("World!")] = 5;
+	CHECK(int(map["World!"]) == 5);
+	CHECK(map.size() == size_before_lookup);
 
 	// Test non-string keys, since keys can be of any Variant type.
 	map[12345] = -5;
@@ -0,0 +1,217 @@
+/**************************************************************************/
+/*  test_scene_pool.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_SCENE_POOL_H
+#define TEST_SCENE_POOL_H
+
+#include "scene/2d/node_2d.h"
+#include "scene/main/scene_pool.h"
+#include "scene/resources/packed_scene.h"
+
+#include "tests/test_macros.h"
+
+namespace TestScenePool {
+
+static Ref<ScenePool> create_pool() {
+	Node2D *scene = memnew(Node2D);
+	scene->set_name("TestScene");
+	scene->set_position(Vector2(1, 2));
+
+	Node2D *child = memnew(Node2D);
+	child->set_name("Child");
+	child->set_position(Vector2(3, 4));
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+	memdelete(scene);
+
+	Ref<ScenePool> pool;
+	pool.instantiate();
+	pool->set_scene(packed_scene);
+	return pool;
+}
+
+TEST_CASE("[ScenePool] Acquire and release reuse the same instance") {
+	Ref<ScenePool> pool = create_pool();
+	CHECK(pool->get_available_count() == 0);
+
+	Node *first = pool->acquire();
+	REQUIRE(first != nullptr);
+	CHECK(first->get_name() == "TestScene");
+	CHECK(pool->get_available_count() == 0);
+
+	pool->release(first);
+	CHECK(pool->get_available_count() == 1);
+
+	Node *second = pool->acquire();
+	CHECK(second == first);
+	CHECK(pool->get_available_count() == 0);
+
+	// Acquiring while the pool is empty instantiates a new scene.
+	Node *third = pool->acquire();
+	REQUIRE(third != nullptr);
+	CHECK(third != second);
+
+	pool->release(second);
+	pool->release(third);
+	CHECK(pool->get_available_count() == 2);
+
+	SUBCASE("Releasing a node that was not acquired fails") {
+		Node *node = memnew(Node);
+		ERR_PRINT_OFF;
+		pool->release(node);
+		ERR_PRINT_ON;
+		CHECK(pool->get_available_count() == 2);
+		memdelete(node);
+	}
+
+	SUBCASE("Released nodes are removed from their parent") {
+		Node *parent = memnew(Node);
+		Node *node = pool->acquire();
+		parent->add_child(node);
+		pool->release(node);
+		CHECK(node->get_parent() == nullptr);
+		CHECK(parent->get_child_count() == 0);
+		memdelete(parent);
+	}
+}
+
+TEST_CASE("[ScenePool] State is reset on release") {
+	Ref<ScenePool> pool = create_pool();
+
+	Node2D *node = Object::cast_to<Node2D>(pool->acquire());
+	REQUIRE(node != nullptr);
+	Node2D *child = Object::cast_to<Node2D>(node->get_node_or_null(NodePath("Child")));
+	REQUIRE(child != nullptr);
+	CHECK(node->get_position() == Vector2(1, 2));
+	CHECK(child->get_position() == Vector2(3, 4));
+
+	node->set_position(Vector2(10, 20));
+	child->set_position(Vector2(30, 40));
+	pool->release(node);
+
+	Node2D *reused = Object::cast_to<Node2D>(pool->acquire());
+	REQUIRE(reused == node);
+	CHECK(reused->get_position() == Vector2(1, 2));
+	CHECK(child->get_position() == Vector2(3, 4));
+	pool->release(reused);
+
+	SUBCASE("Instances whose nodes were removed are not pooled") {
+		Node *broken = pool->acquire();
+		Node *broken_child = broken->get_node_or_null(NodePath("Child"));
+		REQUIRE(broken_child != nullptr);
+		broken->remove_child(broken_child);
+		memdelete(broken_child);
+
+		ObjectID broken_id = broken->get_instance_id();
+		pool->release(broken);
+		CHECK(pool->get_available_count() == 0);
+		CHECK(ObjectDB::get_instance(broken_id) == nullptr);
+	}
+}
+
+TEST_CASE("[ScenePool] Capacity and prewarm limits") {
+	Ref<ScenePool> pool = create_pool();
+	CHECK(pool->get_max_size() == 32);
+
+	pool->set_max_size(2);
+	pool->prewarm(5);
+	CHECK(pool->get_available_count() == 2);
+
+	// Prewarming never shrinks the pool.
+	pool->prewarm(1);
+	CHECK(pool->get_available_count() == 2);
+
+	Node *a = pool->acquire();
+	Node *b = pool->acquire();
+	Node *c = pool->acquire();
+	CHECK(pool->get_available_count() == 0);
+
+	pool->release(a);
+	pool->release(b);
+	CHECK(pool->get_available_count() == 2);
+
+	// Releasing past the capacity frees the node instead of pooling it.
+	ObjectID c_id = c->get_instance_id();
+	pool->release(c);
+	CHECK(pool->get_available_count() == 2);
+	CHECK(ObjectDB::get_instance(c_id) == nullptr);
+
+	// Lowering the capacity frees the extra nodes.
+	pool->set_max_size(1);
+	CHECK(pool->get_available_count() == 1);
+
+	pool->set_max_size(0);
+	CHECK(pool->get_available_count() == 0);
+	pool->prewarm(3);
+	CHECK(pool->get_available_count() == 0);
+
+	ERR_PRINT_OFF;
+	pool->set_max_size(-1);
+	ERR_PRINT_ON;
+	CHECK(pool->get_max_size() == 0);
+}
+
+TEST_CASE("[ScenePool] Pooled nodes freed externally") {
+	Ref<ScenePool> pool = create_pool();
+
+	SUBCASE("Freed available nodes are skipped") {
+		Node *node = pool->acquire();
+		ObjectID node_id = node->get_instance_id();
+		pool->release(node);
+		CHECK(pool->get_available_count() == 1);
+
+		memdelete(node);
+
+		Node *fresh = pool->acquire();
+		REQUIRE(fresh != nullptr);
+		CHECK(fresh->get_instance_id() != node_id);
+		CHECK(pool->get_available_count() == 0);
+		pool->release(fresh);
+		CHECK(pool->get_available_count() == 1);
+	}
+
+	SUBCASE("Freed acquired nodes don't affect the pool") {
+		Node *node = pool->acquire();
+		memdelete(node);
+
+		pool->prewarm(2);
+		CHECK(pool->get_available_count() == 2);
+		pool->clear();
+		CHECK(pool->get_available_count() == 0);
+	}
+}
+
+} // namespace TestScenePool
+
+#endif // TEST_SCENE_POOL_H
@@ -0,0 +1,119 @@
+/**************************************************************************/
+/*  test_audio_mix.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_AUDIO_MIX_H
+#define TEST_AUDIO_MIX_H
+
+#include "servers/audio/audio_mix.h"
+
+#include "tests/test_macros.h"
+
+namespace TestAudioMix {
+
+const uint32_t frame_count = 37; // Not a multiple of the vector width.
+
+AudioFrame make_frame(uint32_t p_index) {
+	return AudioFrame(Math::sin(0.3f * p_index), Math::cos(0.7f * p_index) * 0.5f);
+}
+
+bool frames_equal_approx(const AudioFrame *p_a, const AudioFrame *p_b, uint32_t p_count) {
+	for (uint32_t i = 0; i < p_count; i++) {
+		if (!Math::is_equal_approx(p_a[i].l, p_b[i].l) || !Math::is_equal_approx(p_a[i].r, p_b[i].r)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+TEST_CASE("[AudioMix] Mixing kernels match scalar mixing") {
+	AudioFrame src[frame_count];
+	AudioFrame dst[frame_count];
+	AudioFrame expected[frame_count];
+	for (uint32_t i = 0; i < frame_count; i++) {
+		src[i] = make_frame(i);
+		dst[i] = make_frame(frame_count + i);
+		expected[i] = dst[i];
+	}
+
+	const AudioFrame vol_start = AudioFrame(0.25, 1.0);
+	const AudioFrame vol_final = AudioFrame(1.0, 0.0);
+	AudioMix::mix_ramp(dst, src, vol_start, vol_final, frame_count);
+	for (uint32_t i = 0; i < frame_count; i++) {
+		float lerp = (float)i / frame_count;
+		expected[i] += (vol_final * lerp + (1 - lerp) * vol_start) * src[i];
+	}
+	CHECK_MESSAGE(frames_equal_approx(dst, expected, frame_count), "Volume ramp should match.");
+
+	AudioMix::mix(dst, src, frame_count);
+	for (uint32_t i = 0; i < frame_count; i++) {
+		expected[i] += src[i];
+	}
+	CHECK_MESSAGE(frames_equal_approx(dst, expected, frame_count), "Sum should match.");
+
+	AudioFrame peak = AudioMix::scale_and_get_peak(dst, 0.5, frame_count);
+	AudioFrame expected_peak = AudioFrame(0, 0);
+	for (uint32_t i = 0; i < frame_count; i++) {
+		expected[i] *= 0.5;
+		expected_peak.l = MAX(expected_peak.l, ABS(expected[i].l));
+		expected_peak.r = MAX(expected_peak.r, ABS(expected[i].r));
+	}
+	CHECK_MESSAGE(frames_equal_approx(dst, expected, frame_count), "Scaled frames should match.");
+	CHECK_MESSAGE(frames_equal_approx(&peak, &expected_peak, 1), "Peak should match.");
+}
+
+TEST_CASE("[AudioMix] Cubic interpolation matches the scalar resampler") {
+	const uint32_t fp_bits = 16;
+	AudioFrame src[frame_count + 3];
+	for (uint32_t i = 0; i < frame_count + 3; i++) {
+		src[i] = make_frame(i);
+	}
+
+	// Resample by a ratio that is not an integer so every lane gets a different position.
+	const uint64_t increment = uint64_t(0.77 * (1 << fp_bits));
+	AudioFrame dst[frame_count];
+	AudioMix::interpolate_cubic(src, dst, 1234, increment, fp_bits, frame_count);
+
+	AudioFrame expected[frame_count];
+	for (uint32_t i = 0; i < frame_count; i++) {
+		uint64_t offset = 1234 + i * increment;
+		const AudioFrame *y = src + (offset >> fp_bits);
+		float mu = (offset & ((1 << fp_bits) - 1)) / float(1 << fp_bits);
+		float mu2 = mu * mu;
+		AudioFrame a0 = 3 * y[1] - 3 * y[2] + y[3] - y[0];
+		AudioFrame a1 = 2 * y[0] - 5 * y[1] + 4 * y[2] - y[3];
+		AudioFrame a2 = y[2] - y[0];
+		AudioFrame a3 = 2 * y[1];
+		expected[i] = (a0 * mu * mu2 + a1 * mu2 + a2 * mu + a3) / 2;
+	}
+	CHECK(frames_equal_approx(dst, expected, frame_count));
+}
+} // namespace TestAudioMix
+
+#endif // TEST_AUDIO_MIX_H
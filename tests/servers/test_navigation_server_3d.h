@@ -530,6 +530,30 @@ TEST_SUITE("[Navigation]") {
 		memdelete(node_3d);
 	}
 
+	TEST_CASE("[NavigationServer3D] Server should bake navigation mesh tiles") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+
+		Array arr;
+		arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(arr, Vector3(10.0, 0.001, 10.0));
+		source_geometry->add_mesh_array(arr, Transform3D());
+
+		Dictionary tiles = navigation_server->bake_tiles_from_source_geometry_data(navigation_mesh, source_geometry, 4.0);
+		CHECK_EQ(tiles.size(), 16);
+		Ref<NavigationMesh> center_tile = tiles[Vector2i(0, 0)];
+		CHECK(center_tile.is_valid());
+		CHECK_NE(center_tile->get_polygon_count(), 0);
+		CHECK_EQ(navigation_mesh->get_polygon_count(), 0);
+
+		SUBCASE("Only tiles touching the changed area should be baked") {
+			Dictionary changed_tiles = navigation_server->bake_tiles_from_source_geometry_data(navigation_mesh, source_geometry, 4.0, AABB(Vector3(1, -1, 1), Vector3(1, 2, 1)));
+			CHECK_EQ(changed_tiles.size(), 1);
+			CHECK(changed_tiles.has(Vector2i(0, 0)));
+		}
+	}
+
 	// This test case does not check precise values on purpose - to not be too sensitivte.
 	TEST_CASE("[NavigationServer3D] Server should respond to queries against valid map properly") {
 		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
@@ -561,6 +585,18 @@ TEST_SUITE("[Navigation]") {
 			CHECK_NE(navigation_server->map_get_path(map, Vector3(0, 0, 0), Vector3(10, 0, 10), false).size(), 0);
 		}
 
+		SUBCASE("Batched closest point query should match single queries") {
+			Vector<Vector3> points;
+			points.push_back(Vector3(0, 0, 0));
+			points.push_back(Vector3(3, 1, -2));
+			points.push_back(Vector3(20, 5, 20));
+			Vector<Vector3> closest_points = navigation_server->map_get_closest_points(map, points);
+			CHECK_EQ(closest_points.size(), points.size());
+			for (int i = 0; i < points.size(); i++) {
+				CHECK_EQ(closest_points[i], navigation_server->map_get_closest_point(map, points[i]));
+			}
+		}
+
 		SUBCASE("Elaborate query with 'CORRIDORFUNNEL' post-processing should yield non-empty result") {
 			Ref<NavigationPathQueryParameters3D> query_parameters = memnew(NavigationPathQueryParameters3D);
 			query_parameters->set_map(map);
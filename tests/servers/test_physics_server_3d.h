@@ -0,0 +1,220 @@
+/**************************************************************************/
+/*  test_physics_server_3d.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_PHYSICS_SERVER_3D_H
+#define TEST_PHYSICS_SERVER_3D_H
+
+#include "core/math/random_pcg.h"
+#include "servers/physics_server_3d.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPhysicsServer3D {
+
+// A floor with boxes scattered over it, one of them on another collision layer.
+struct BatchQueryScene {
+	PhysicsServer3D *physics_server = nullptr;
+	RID space;
+	RID floor_shape;
+	RID box_shape;
+	RID sphere_shape;
+	LocalVector<RID> bodies;
+	RID other_layer_body;
+
+	BatchQueryScene() {
+		physics_server = PhysicsServer3DManager::get_singleton()->new_default_server();
+		physics_server->init();
+
+		space = physics_server->space_create();
+		physics_server->space_set_active(space, true);
+
+		floor_shape = physics_server->box_shape_create();
+		physics_server->shape_set_data(floor_shape, Vector3(50, 1, 50));
+		box_shape = physics_server->box_shape_create();
+		physics_server->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+		sphere_shape = physics_server->sphere_shape_create();
+		physics_server->shape_set_data(sphere_shape, 0.4);
+
+		RID floor = physics_server->body_create();
+		physics_server->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+		physics_server->body_add_shape(floor, floor_shape);
+		physics_server->body_set_space(floor, space);
+		bodies.push_back(floor);
+
+		RandomPCG rng(42);
+		for (int i = 0; i < 40; i++) {
+			RID body = physics_server->body_create();
+			physics_server->body_set_mode(body, PhysicsServer3D::BODY_MODE_STATIC);
+			physics_server->body_add_shape(body, box_shape);
+			physics_server->body_set_space(body, space);
+			physics_server->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(Vector3(0, 1, 0), rng.randf() * Math_TAU), Vector3(rng.random(-10.0, 10.0), rng.random(1.5, 4.0), rng.random(-10.0, 10.0))));
+			bodies.push_back(body);
+		}
+		other_layer_body = bodies[bodies.size() - 1];
+		physics_server->body_set_collision_layer(other_layer_body, 2);
+
+		// Lets the broadphase take in the bodies.
+		physics_server->sync();
+		physics_server->flush_queries();
+		physics_server->end_sync();
+		physics_server->step(1.0 / 60.0);
+	}
+
+	~BatchQueryScene() {
+		for (const RID &body : bodies) {
+			physics_server->free(body);
+		}
+		physics_server->free(sphere_shape);
+		physics_server->free(box_shape);
+		physics_server->free(floor_shape);
+		physics_server->free(space);
+
+		physics_server->finish();
+		memdelete(physics_server);
+	}
+};
+
+TEST_CASE("[PhysicsServer3D] Batch ray queries match single ray queries") {
+	BatchQueryScene scene;
+	PhysicsDirectSpaceState3D *space_state = scene.physics_server->space_get_direct_state(scene.space);
+	REQUIRE(space_state != nullptr);
+
+	// More rays than a single task handles, so they're split across threads. Some point away from everything.
+	const int count = 300;
+	LocalVector<Vector3> from;
+	LocalVector<Vector3> to;
+	RandomPCG rng(7);
+	for (int i = 0; i < count; i++) {
+		Vector3 origin(rng.random(-12.0, 12.0), rng.random(5.0, 8.0), rng.random(-12.0, 12.0));
+		Vector3 direction = i % 10 == 0 ? Vector3(0, 1, 0) : Vector3(rng.random(-0.5, 0.5), -1, rng.random(-0.5, 0.5));
+		from.push_back(origin);
+		to.push_back(origin + direction * 20.0);
+	}
+
+	PhysicsDirectSpaceState3D::RayParameters parameters;
+
+	SUBCASE("Default parameters") {}
+	SUBCASE("Collision mask") {
+		parameters.collision_mask = 1;
+	}
+	SUBCASE("Excluded bodies") {
+		parameters.exclude.insert(scene.bodies[0]);
+		parameters.exclude.insert(scene.bodies[1]);
+	}
+
+	LocalVector<PhysicsDirectSpaceState3D::RayResult> results;
+	results.resize(count);
+	int hits = space_state->intersect_rays(parameters, from.ptr(), to.ptr(), count, results.ptr());
+
+	int single_hits = 0;
+	int mismatches = 0;
+	for (int i = 0; i < count; i++) {
+		PhysicsDirectSpaceState3D::RayParameters single_parameters = parameters;
+		single_parameters.from = from[i];
+		single_parameters.to = to[i];
+		PhysicsDirectSpaceState3D::RayResult single_result;
+		bool hit = space_state->intersect_ray(single_parameters, single_result);
+		if (hit) {
+			single_hits++;
+		}
+
+		const PhysicsDirectSpaceState3D::RayResult &result = results[i];
+		if (hit != result.rid.is_valid() || result.rid != single_result.rid || result.shape != single_result.shape ||
+				result.collider_id != single_result.collider_id || !result.position.is_equal_approx(single_result.position) ||
+				!result.normal.is_equal_approx(single_result.normal)) {
+			mismatches++;
+		}
+	}
+
+	CHECK(hits == single_hits);
+	CHECK(hits > 0);
+	CHECK(hits < count);
+	CHECK_MESSAGE(mismatches == 0, "Every batch ray result should match the single ray query.");
+}
+
+TEST_CASE("[PhysicsServer3D] Batch motion casts match single motion casts") {
+	BatchQueryScene scene;
+	PhysicsDirectSpaceState3D *space_state = scene.physics_server->space_get_direct_state(scene.space);
+	REQUIRE(space_state != nullptr);
+
+	const int count = 300;
+	LocalVector<Vector3> origins;
+	LocalVector<Vector3> motions;
+	RandomPCG rng(11);
+	for (int i = 0; i < count; i++) {
+		origins.push_back(Vector3(rng.random(-12.0, 12.0), rng.random(5.0, 8.0), rng.random(-12.0, 12.0)));
+		motions.push_back(i % 10 == 0 ? Vector3(0, 2, 0) : Vector3(rng.random(-3.0, 3.0), -10, rng.random(-3.0, 3.0)));
+	}
+
+	PhysicsDirectSpaceState3D::ShapeParameters parameters;
+	parameters.shape_rid = scene.sphere_shape;
+	parameters.transform = Transform3D(Basis(Vector3(1, 0, 0), 0.3), Vector3());
+
+	SUBCASE("Default parameters") {}
+	SUBCASE("Collision mask") {
+		parameters.collision_mask = 1;
+	}
+	SUBCASE("Excluded bodies and margin") {
+		parameters.exclude.insert(scene.bodies[0]);
+		parameters.margin = 0.04;
+	}
+
+	LocalVector<real_t> closest_safe;
+	LocalVector<real_t> closest_unsafe;
+	closest_safe.resize(count);
+	closest_unsafe.resize(count);
+	CHECK(space_state->cast_motions(parameters, origins.ptr(), motions.ptr(), count, closest_safe.ptr(), closest_unsafe.ptr()));
+
+	int blocked = 0;
+	int mismatches = 0;
+	for (int i = 0; i < count; i++) {
+		PhysicsDirectSpaceState3D::ShapeParameters single_parameters = parameters;
+		single_parameters.transform.origin = origins[i];
+		single_parameters.motion = motions[i];
+		real_t safe = 1.0;
+		real_t unsafe = 1.0;
+		CHECK(space_state->cast_motion(single_parameters, safe, unsafe));
+
+		if (safe < 1.0) {
+			blocked++;
+		}
+		if (!Math::is_equal_approx(closest_safe[i], safe) || !Math::is_equal_approx(closest_unsafe[i], unsafe)) {
+			mismatches++;
+		}
+	}
+
+	CHECK(blocked > 0);
+	CHECK(blocked < count);
+	CHECK_MESSAGE(mismatches == 0, "Every batch motion cast result should match the single motion cast.");
+}
+
+} // namespace TestPhysicsServer3D
+
+#endif // TEST_PHYSICS_SERVER_3D_H
@@ -47,6 +47,8 @@
 #include "tests/core/math/test_aabb.h"
 #include "tests/core/math/test_astar.h"
 #include "tests/core/math/test_basis.h"
+#include "tests/core/math/test_batch_math.h"
+#include "tests/core/math/test_bvh.h"
 #include "tests/core/math/test_color.h"
 #include "tests/core/math/test_expression.h"
 #include "tests/core/math/test_geometry_2d.h"
@@ -59,6 +61,7 @@
 #include "tests/core/math/test_rect2i.h"
 #include "tests/core/math/test_transform_2d.h"
 #include "tests/core/math/test_transform_3d.h"
+#include "tests/core/math/test_triangle_mesh.h"
 #include "tests/core/math/test_vector2.h"
 #include "tests/core/math/test_vector2i.h"
 #include "tests/core/math/test_vector3.h"
@@ -66,14 +69,18 @@
 #include "tests/core/math/test_vector4.h"
 #include "tests/core/math/test_vector4i.h"
 #include "tests/core/object/test_class_db.h"
+#include "tests/core/object/test_message_queue.h"
 #include "tests/core/object/test_method_bind.h"
 #include "tests/core/object/test_object.h"
+#include "tests/core/os/test_memory.h"
 #include "tests/core/os/test_os.h"
 #include "tests/core/string/test_node_path.h"
 #include "tests/core/string/test_string.h"
+#include "tests/core/string/test_string_name.h"
 #include "tests/core/string/test_translation.h"
 #include "tests/core/string/test_translation_server.h"
 #include "tests/core/templates/test_command_queue.h"
+#include "tests/core/templates/test_flat_hash_map.h"
 #include "tests/core/templates/test_hash_map.h"
 #include "tests/core/templates/test_hash_set.h"
 #include "tests/core/templates/test_list.h"
@@ -113,6 +120,7 @@
 #include "tests/scene/test_path_2d.h"
 #include "tests/scene/test_path_3d.h"
 #include "tests/scene/test_primitives.h"
+#include "tests/scene/test_scene_pool.h"
 #include "tests/scene/test_sprite_frames.h"
 #include "tests/scene/test_text_edit.h"
 #include "tests/scene/test_theme.h"
@@ -120,13 +128,26 @@
 #include "tests/scene/test_visual_shader.h"
 #include "tests/scene/test_window.h"
 #include "tests/servers/rendering/test_shader_preprocessor.h"
+#include "tests/servers/test_audio_mix.h"
 #include "tests/servers/test_navigation_server_2d.h"
 #include "tests/servers/test_navigation_server_3d.h"
+#include "tests/servers/test_physics_server_3d.h"
 #include "tests/servers/test_text_server.h"
 #include "tests/test_validate_testing.h"
 
 #include "modules/modules_tests.gen.h"
 
+#ifdef BENCHMARKS_ENABLED
+#include "benchmarks/core/benchmark_hash_map.h"
+#include "benchmarks/core/benchmark_resource_loader.h"
+#include "benchmarks/core/benchmark_string_name.h"
+#include "benchmarks/core/benchmark_variant.h"
+#include "benchmarks/core/benchmark_worker_thread_pool.h"
+#include "benchmarks/modules/benchmark_gdscript.h"
+#include "benchmarks/servers/benchmark_navigation_server_3d.h"
+#include "benchmarks/servers/benchmark_physics_server_3d.h"
+#endif
+
 #include "tests/display_server_mock.h"
 #include "tests/test_macros.h"
 
@@ -170,14 +191,34 @@ int test_main(int argc, char *argv[]) {
 	doctest::Context test_context;
 	List<String> test_args;
 
+#ifdef BENCHMARKS_ENABLED
+	bool run_benchmarks = false;
+	String benchmark_output;
+#endif
+
 	// Clean arguments of "--test" from the args.
 	for (int x = 0; x < argc; x++) {
 		String arg = String(argv[x]);
+#ifdef BENCHMARKS_ENABLED
+		if (arg == "--benchmarks") {
+			run_benchmarks = true;
+			continue;
+		}
+		if (arg.begins_with("--benchmark-output=")) {
+			benchmark_output = arg.trim_prefix("--benchmark-output=");
+			continue;
+		}
+#endif
 		if (arg != "--test") {
 			test_args.push_back(arg);
 		}
 	}
 
+#ifdef BENCHMARKS_ENABLED
+	// Benchmarks are slow, they only run when asked for and then without the unit tests.
+	test_args.push_back(run_benchmarks ? "--test-suite=*[Benchmark]*" : "--test-suite-exclude=*[Benchmark]*");
+#endif
+
 	if (test_args.size() > 0) {
 		// Convert Godot command line arguments back to standard arguments.
 		char **doctest_args = new char *[test_args.size()];
@@ -199,7 +240,15 @@ int test_main(int argc, char *argv[]) {
 		delete[] doctest_args;
 	}
 
-	return test_context.run();
+	int status = test_context.run();
+
+#ifdef BENCHMARKS_ENABLED
+	if (run_benchmarks && !benchmark_output.is_empty()) {
+		Benchmark::save_results(benchmark_output);
+	}
+#endif
+
+	return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
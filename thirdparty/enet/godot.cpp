@@ -66,10 +66,22 @@ class ENetUDP : public ENetGodotSocket {
 	friend class ENetDTLSServer;
 
 private:
+	enum {
+		RECV_BATCH_SIZE = 16,
+	};
+
 	Ref<NetSocket> sock;
 	IPAddress local_address;
 	bool bound = false;
 
+	// Datagrams received in a single batch, handed to ENet one at a time.
+	LocalVector<uint8_t> recv_batch;
+	int recv_read[RECV_BATCH_SIZE];
+	IPAddress recv_ip[RECV_BATCH_SIZE];
+	uint16_t recv_port[RECV_BATCH_SIZE];
+	int recv_count = 0;
+	int recv_next = 0;
+
 public:
 	ENetUDP() {
 		sock = Ref<NetSocket>(NetSocket::create());
@@ -104,11 +116,27 @@ public:
 	}
 
 	Error recvfrom(uint8_t *p_buffer, int p_len, int &r_read, IPAddress &r_ip, uint16_t &r_port) {
-		Error err = sock->poll(NetSocket::POLL_TYPE_IN, 0);
-		if (err != OK) {
-			return err;
+		if (recv_next == recv_count) {
+			Error err = sock->poll(NetSocket::POLL_TYPE_IN, 0);
+			if (err != OK) {
+				return err;
+			}
+			if (recv_batch.is_empty()) {
+				recv_batch.resize(ENET_PROTOCOL_MAXIMUM_MTU * RECV_BATCH_SIZE);
+			}
+			recv_next = 0;
+			recv_count = 0;
+			err = sock->recvfrom_batch(recv_batch.ptr(), ENET_PROTOCOL_MAXIMUM_MTU, RECV_BATCH_SIZE, recv_read, recv_ip, recv_port, recv_count);
+			if (err != OK) {
+				return err;
+			}
 		}
-		return sock->recvfrom(p_buffer, p_len, r_read, r_ip, r_port);
+		const int idx = recv_next++;
+		r_read = MIN(p_len, recv_read[idx]);
+		memcpy(p_buffer, recv_batch.ptr() + idx * ENET_PROTOCOL_MAXIMUM_MTU, r_read);
+		r_ip = recv_ip[idx];
+		r_port = recv_port[idx];
+		return OK;
 	}
 
 	int set_option(ENetSocketOption p_option, int p_value) {